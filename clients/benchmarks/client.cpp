@@ -22,6 +22,7 @@
 
 #include "program_options.hpp"
 
+#define ROCBLAS_BETA_FEATURES_API
 #include "rocblas.h"
 #include "rocblas.hpp"
 #include "rocblas_data.hpp"
@@ -32,28 +33,58 @@
 #include "utility.hpp"
 #include <algorithm>
 #include <cctype>
+#include <cmath>
+#include <condition_variable>
 #include <cstdio>
 #include <cstring>
 #include <iostream>
+#include <limits>
 #include <map>
+#include <mutex>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
 // aux
+#include "testing_batched_scalar_stride.hpp"
+#include "testing_batched_stride_detection.hpp"
+#include "testing_compensated_summation.hpp"
+#include "testing_device_api.hpp"
+#include "testing_gemm_backend.hpp"
+#include "testing_graph_safe.hpp"
+#include "testing_host_convert.hpp"
+#include "testing_host_numa.hpp"
+#include "testing_initialize_devices.hpp"
+#include "testing_managed_prefetch.hpp"
+#include "testing_perf_smoke.hpp"
+#include "testing_persisting_range.hpp"
+#include "testing_recording.hpp"
+#include "testing_reproducible.hpp"
 #include "testing_set_get_matrix.hpp"
 #include "testing_set_get_matrix_async.hpp"
+#include "testing_set_get_matrix_batched.hpp"
+#include "testing_set_get_matrix_ex.hpp"
 #include "testing_set_get_vector.hpp"
 #include "testing_set_get_vector_async.hpp"
+#include "testing_set_pointer_array.hpp"
+#include "testing_stochastic_rounding.hpp"
+#include "testing_workspace_scope.hpp"
 // blas1
 #include "testing_asum.hpp"
 #include "testing_asum_batched.hpp"
 #include "testing_asum_strided_batched.hpp"
+#include "testing_axpby_batched_ex.hpp"
+#include "testing_axpby_ex.hpp"
+#include "testing_axpby_strided_batched_ex.hpp"
 #include "testing_axpy.hpp"
 #include "testing_axpy_batched.hpp"
 #include "testing_axpy_batched_ex.hpp"
 #include "testing_axpy_ex.hpp"
 #include "testing_axpy_strided_batched.hpp"
 #include "testing_axpy_strided_batched_ex.hpp"
+#include "testing_axpyi.hpp"
 #include "testing_copy.hpp"
 #include "testing_copy_batched.hpp"
 #include "testing_copy_strided_batched.hpp"
@@ -63,24 +94,34 @@
 #include "testing_dot_ex.hpp"
 #include "testing_dot_strided_batched.hpp"
 #include "testing_dot_strided_batched_ex.hpp"
+#include "testing_doti.hpp"
+#include "testing_fused_blas1.hpp"
+#include "testing_gthr.hpp"
 #include "testing_iamax_iamin.hpp"
 #include "testing_iamax_iamin_batched.hpp"
 #include "testing_iamax_iamin_strided_batched.hpp"
+#include "testing_int64_api.hpp"
+#include "testing_level1_fusion.hpp"
+#include "testing_mdot_batched_ex.hpp"
 #include "testing_nrm2.hpp"
 #include "testing_nrm2_batched.hpp"
 #include "testing_nrm2_batched_ex.hpp"
 #include "testing_nrm2_ex.hpp"
 #include "testing_nrm2_strided_batched.hpp"
 #include "testing_nrm2_strided_batched_ex.hpp"
+#include "testing_planar_level1.hpp"
 #include "testing_rot.hpp"
 #include "testing_rot_batched.hpp"
 #include "testing_rot_batched_ex.hpp"
 #include "testing_rot_ex.hpp"
+#include "testing_rot_sequence.hpp"
 #include "testing_rot_strided_batched.hpp"
 #include "testing_rot_strided_batched_ex.hpp"
+#include "testing_rot_sweep.hpp"
 #include "testing_rotg.hpp"
 #include "testing_rotg_batched.hpp"
 #include "testing_rotg_strided_batched.hpp"
+#include "testing_roti.hpp"
 #include "testing_rotm.hpp"
 #include "testing_rotm_batched.hpp"
 #include "testing_rotm_strided_batched.hpp"
@@ -93,6 +134,7 @@
 #include "testing_scal_ex.hpp"
 #include "testing_scal_strided_batched.hpp"
 #include "testing_scal_strided_batched_ex.hpp"
+#include "testing_sctr.hpp"
 #include "testing_swap.hpp"
 #include "testing_swap_batched.hpp"
 #include "testing_swap_strided_batched.hpp"
@@ -102,10 +144,20 @@
 #include "testing_gbmv_strided_batched.hpp"
 #include "testing_gemv.hpp"
 #include "testing_gemv_batched.hpp"
+#include "testing_gemv_batched_ex.hpp"
+#include "testing_gemv_ex.hpp"
+#include "testing_gemv_nt.hpp"
+#include "testing_gemv_quantized_ex.hpp"
 #include "testing_gemv_strided_batched.hpp"
+#include "testing_gemv_strided_batched_ex.hpp"
+#include "testing_gemv_vbatched.hpp"
 #include "testing_ger.hpp"
 #include "testing_ger_batched.hpp"
+#include "testing_ger_batched_ex.hpp"
+#include "testing_ger_ex.hpp"
 #include "testing_ger_strided_batched.hpp"
+#include "testing_ger_strided_batched_ex.hpp"
+#include "testing_ger_multi.hpp"
 #include "testing_hbmv.hpp"
 #include "testing_hbmv_batched.hpp"
 #include "testing_hbmv_strided_batched.hpp"
@@ -127,6 +179,7 @@
 #include "testing_hpr2_strided_batched.hpp"
 #include "testing_hpr_batched.hpp"
 #include "testing_hpr_strided_batched.hpp"
+#include "testing_level2_tuning.hpp"
 #include "testing_sbmv.hpp"
 #include "testing_sbmv_batched.hpp"
 #include "testing_sbmv_strided_batched.hpp"
@@ -141,11 +194,17 @@
 #include "testing_spr_strided_batched.hpp"
 #include "testing_symv.hpp"
 #include "testing_symv_batched.hpp"
+#include "testing_symv_batched_ex.hpp"
+#include "testing_symv_ex.hpp"
 #include "testing_symv_strided_batched.hpp"
+#include "testing_symv_strided_batched_ex.hpp"
 #include "testing_syr.hpp"
 #include "testing_syr2.hpp"
 #include "testing_syr2_batched.hpp"
+#include "testing_syr2_batched_ex.hpp"
+#include "testing_syr2_ex.hpp"
 #include "testing_syr2_strided_batched.hpp"
+#include "testing_syr2_strided_batched_ex.hpp"
 #include "testing_syr_batched.hpp"
 #include "testing_syr_strided_batched.hpp"
 #include "testing_tbmv.hpp"
@@ -162,7 +221,10 @@
 #include "testing_tpsv_strided_batched.hpp"
 #include "testing_trmv.hpp"
 #include "testing_trmv_batched.hpp"
+#include "testing_trmv_batched_ex.hpp"
+#include "testing_trmv_ex.hpp"
 #include "testing_trmv_strided_batched.hpp"
+#include "testing_trmv_strided_batched_ex.hpp"
 #include "testing_trsv.hpp"
 #include "testing_trsv_batched.hpp"
 #include "testing_trsv_strided_batched.hpp"
@@ -173,13 +235,21 @@
 #include "testing_geam.hpp"
 #include "testing_geam_batched.hpp"
 #include "testing_geam_ex.hpp"
+#include "testing_geam_multi.hpp"
 #include "testing_geam_strided_batched.hpp"
+#include "testing_gemm_dgmm.hpp"
+#include "testing_gemm_grouped_ex.hpp"
+#include "testing_gemm_multi_device.hpp"
+#include "testing_gemm_offload.hpp"
 #include "testing_her2k.hpp"
 #include "testing_her2k_batched.hpp"
 #include "testing_her2k_strided_batched.hpp"
 #include "testing_herk.hpp"
 #include "testing_herk_batched.hpp"
 #include "testing_herk_strided_batched.hpp"
+#include "testing_imatcopy.hpp"
+#include "testing_omatcopy_ex.hpp"
+#include "testing_rfp.hpp"
 #include "testing_symm_hemm.hpp"
 #include "testing_symm_hemm_batched.hpp"
 #include "testing_symm_hemm_strided_batched.hpp"
@@ -188,10 +258,17 @@
 #include "testing_syr2k_strided_batched.hpp"
 #include "testing_syrk.hpp"
 #include "testing_syrk_batched.hpp"
+#include "testing_syrk_offload.hpp"
 #include "testing_syrk_strided_batched.hpp"
+#include "testing_triangular_factor.hpp"
 #include "testing_trmm_outofplace.hpp"
 #include "testing_trmm_outofplace_batched.hpp"
 #include "testing_trmm_outofplace_strided_batched.hpp"
+#include "testing_trsm_offload.hpp"
+// distributed functions of the optional rocblas-distributed library
+#ifdef ROCBLAS_BENCH_DISTRIBUTED
+#include "testing_distributed.hpp"
+#endif
 //
 #include "type_dispatch.hpp"
 #include "utility.hpp"
@@ -224,12 +301,21 @@ void run_function(const func_map& map, const Arguments& arg, const std::string&
 
 #if BUILD_WITH_TENSILE
 
+#include "testing_contract_ex.hpp"
 #include "testing_gemm.hpp"
 #include "testing_gemm_batched.hpp"
 #include "testing_gemm_batched_ex.hpp"
+#include "testing_gemm_block_sparse_ex.hpp"
+#include "testing_gemm_chain_ex.hpp"
+#include "testing_gemm_coalescer.hpp"
+#include "testing_gemm_epilogue.hpp"
 #include "testing_gemm_ex.hpp"
+#include "testing_gemm_packed_ex.hpp"
+#include "testing_gemm_planar_ex.hpp"
+#include "testing_gemm_real_complex.hpp"
 #include "testing_gemm_strided_batched.hpp"
 #include "testing_gemm_strided_batched_ex.hpp"
+#include "testing_gemm_warmup.hpp"
 #include "testing_trmm.hpp"
 #include "testing_trmm_batched.hpp"
 #include "testing_trmm_strided_batched.hpp"
@@ -237,6 +323,7 @@ void run_function(const func_map& map, const Arguments& arg, const std::string&
 #include "testing_trsm_batched.hpp"
 #include "testing_trsm_batched_ex.hpp"
 #include "testing_trsm_ex.hpp"
+#include "testing_trsm_refinement.hpp"
 #include "testing_trsm_strided_batched.hpp"
 #include "testing_trsm_strided_batched_ex.hpp"
 #include "testing_trtri.hpp"
@@ -264,6 +351,7 @@ struct perf_gemm_ex<Ti,
         static const func_map map = {
             {"gemm_ex", testing_gemm_ex<Ti, To, Tc>},
             {"gemm_batched_ex", testing_gemm_batched_ex<Ti, To, Tc>},
+            {"gemm_packed_ex", testing_gemm_packed_ex<Ti, To, Tc>},
         };
         run_function(map, arg);
     }
@@ -294,6 +382,237 @@ struct perf_gemm_strided_batched_ex<
     }
 };
 
+// The real d_type and compute_type pairs of the gemm_ex3 epilogue, and the requantizing
+// epilogue of i8_r inputs
+template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+struct perf_gemm_epilogue : rocblas_test_invalid
+{
+};
+
+template <typename Ti, typename To, typename Tc>
+struct perf_gemm_epilogue<
+    Ti,
+    To,
+    Tc,
+    std::enable_if_t<
+        (std::is_same<To, Tc>{}
+         && (std::is_same<To, float>{} || std::is_same<To, double>{}
+             || std::is_same<To, rocblas_half>{} || std::is_same<To, int32_t>{}))
+        || (std::is_same<Tc, float>{}
+            && (std::is_same<Ti, rocblas_half>{} || std::is_same<Ti, rocblas_bfloat16>{}))>>
+    : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gemm_epilogue", testing_gemm_epilogue<Ti, To, Tc>},
+        };
+        run_function(map, arg);
+    }
+};
+
+// The type combinations of rocblas_gemm_ex whose code objects are preloaded by
+// rocblas_gemm_warmup
+template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+struct perf_gemm_warmup : rocblas_test_invalid
+{
+};
+
+template <typename Ti, typename To, typename Tc>
+struct perf_gemm_warmup<
+    Ti,
+    To,
+    Tc,
+    std::enable_if_t<
+        (std::is_same<Ti, To>{} && std::is_same<To, Tc>{}
+         && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+             || std::is_same<Ti, rocblas_half>{} || std::is_same<Ti, rocblas_float_complex>{}
+             || std::is_same<Ti, rocblas_double_complex>{}))
+        || (std::is_same<Tc, float>{}
+            && (std::is_same<Ti, rocblas_half>{} || std::is_same<Ti, rocblas_bfloat16>{})
+            && (std::is_same<To, Ti>{} || std::is_same<To, float>{}))
+        || (std::is_same<Ti, int8_t>{} && std::is_same<To, int32_t>{}
+            && std::is_same<Tc, int32_t>{})>> : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gemm_warmup", testing_gemm_warmup<Ti, To, Tc>},
+        };
+        run_function(map, arg);
+    }
+};
+
+// The type combinations of rocblas_gemm_ex, which rocblas_gemm_coalesced_ex batches
+template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+struct perf_gemm_coalescer : rocblas_test_invalid
+{
+};
+
+template <typename Ti, typename To, typename Tc>
+struct perf_gemm_coalescer<
+    Ti,
+    To,
+    Tc,
+    std::enable_if_t<
+        (std::is_same<Ti, To>{} && std::is_same<To, Tc>{}
+         && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+             || std::is_same<Ti, rocblas_half>{} || std::is_same<Ti, rocblas_float_complex>{}
+             || std::is_same<Ti, rocblas_double_complex>{}))
+        || (std::is_same<Tc, float>{}
+            && (std::is_same<Ti, rocblas_half>{} || std::is_same<Ti, rocblas_bfloat16>{})
+            && (std::is_same<To, Ti>{} || std::is_same<To, float>{}))
+        || (std::is_same<Ti, int8_t>{} && std::is_same<To, int32_t>{}
+            && std::is_same<Tc, int32_t>{})>> : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gemm_coalescer", testing_gemm_coalescer<Ti, To, Tc>},
+        };
+        run_function(map, arg);
+    }
+};
+
+// The bound indices of rocblas_contract_ex beyond the first accumulate into D, so D is not of a
+// 16-bit type
+template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+struct perf_contract_ex : rocblas_test_invalid
+{
+};
+
+template <typename Ti, typename To, typename Tc>
+struct perf_contract_ex<
+    Ti,
+    To,
+    Tc,
+    std::enable_if_t<(std::is_same<Ti, To>{} && std::is_same<To, Tc>{}
+                      && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+                          || std::is_same<Ti, rocblas_float_complex>{}
+                          || std::is_same<Ti, rocblas_double_complex>{}))
+                     || ((std::is_same<Ti, rocblas_half>{} || std::is_same<Ti, rocblas_bfloat16>{})
+                         && std::is_same<To, float>{} && std::is_same<Tc, float>{})>>
+    : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"contract_ex", testing_contract_ex<Ti, To, Tc>},
+        };
+        run_function(map, arg);
+    }
+};
+
+template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+struct perf_gemm_chain_ex : rocblas_test_invalid
+{
+};
+
+template <typename Ti, typename To, typename Tc>
+struct perf_gemm_chain_ex<
+    Ti,
+    To,
+    Tc,
+    std::enable_if_t<std::is_same<Ti, To>{}
+                     && ((std::is_same<Tc, float>{}
+                          && (std::is_same<Ti, rocblas_half>{}
+                              || std::is_same<Ti, rocblas_bfloat16>{} || std::is_same<Ti, float>{}))
+                         || (std::is_same<Ti, double>{} && std::is_same<Tc, double>{}))>>
+    : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gemm_chain_ex", testing_gemm_chain_ex<Ti, To, Tc>},
+        };
+        run_function(map, arg);
+    }
+};
+
+// The refinement of rocblas_trsm_ex applies to double precision systems
+template <typename T, typename = void>
+struct perf_trsm_refinement : rocblas_test_invalid
+{
+};
+
+template <typename T>
+struct perf_trsm_refinement<
+    T,
+    std::enable_if_t<std::is_same<T, double>{} || std::is_same<T, rocblas_double_complex>{}>>
+    : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"trsm_refinement", testing_trsm_refinement<T>},
+        };
+        run_function(map, arg);
+    }
+};
+
+// The planar complex gemm splits complex matrices into real and imaginary arrays
+template <typename T, typename = void>
+struct perf_gemm_planar_ex : rocblas_test_invalid
+{
+};
+
+template <typename T>
+struct perf_gemm_planar_ex<T,
+                           std::enable_if_t<std::is_same<T, rocblas_float_complex>{}
+                                            || std::is_same<T, rocblas_double_complex>{}>>
+    : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gemm_planar_ex", testing_gemm_planar_ex<T>},
+        };
+        run_function(map, arg);
+    }
+};
+
+// gemm_ex of a real A by a complex B, C and D is dispatched on the real type of A
+template <typename T, typename = void>
+struct perf_gemm_real_complex : rocblas_test_invalid
+{
+};
+
+template <typename T>
+struct perf_gemm_real_complex<
+    T,
+    std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}>> : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gemm_real_complex", testing_gemm_real_complex<T>},
+        };
+        run_function(map, arg);
+    }
+};
+
+// gemm_block_sparse_ex has a single type for A, B, C, D and the computation
+template <typename T, typename = void>
+struct perf_gemm_block_sparse_ex : rocblas_test_invalid
+{
+};
+
+template <typename T>
+struct perf_gemm_block_sparse_ex<
+    T,
+    std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                     || std::is_same<T, rocblas_float_complex>{}
+                     || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gemm_block_sparse_ex", testing_gemm_block_sparse_ex<T>},
+        };
+        run_function(map, arg);
+    }
+};
+
 #endif // BUILD_WITH_TENSILE
 
 template <typename T, typename U = T, typename = void>
@@ -312,6 +631,18 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
                 {"set_get_vector_async", testing_set_get_vector_async<T>},
                 {"set_get_matrix", testing_set_get_matrix<T>},
                 {"set_get_matrix_async", testing_set_get_matrix_async<T>},
+                {"set_get_matrix_batched", testing_set_get_matrix_batched<T>},
+                {"set_get_matrix_ex", testing_set_get_matrix_ex<T>},
+                {"host_numa", testing_host_numa<T>},
+                {"graph_safe", testing_graph_safe<T>},
+                {"reproducible", testing_reproducible<T>},
+                {"compensated_summation", testing_compensated_summation<T>},
+                {"set_pointer_array", testing_set_pointer_array<T>},
+                {"initialize_devices", testing_initialize_devices<T>},
+                {"batched_stride_detection", testing_batched_stride_detection<T>},
+                {"recording", testing_recording<T>},
+                {"device_api", testing_device_api<T>},
+                {"batched_scalar_stride", testing_batched_scalar_stride<T>},
                 // L1
                 {"asum", testing_asum<T>},
                 {"asum_batched", testing_asum_batched<T>},
@@ -319,30 +650,42 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
                 {"axpy", testing_axpy<T>},
                 {"axpy_batched", testing_axpy_batched<T>},
                 {"axpy_strided_batched", testing_axpy_strided_batched<T>},
+                {"axpy_dot", testing_axpy_dot<T>},
+                {"axpyi", testing_axpyi<T>},
                 {"copy", testing_copy<T>},
                 {"copy_batched", testing_copy_batched<T>},
                 {"copy_strided_batched", testing_copy_strided_batched<T>},
                 {"dot", testing_dot<T>},
                 {"dot_batched", testing_dot_batched<T>},
                 {"dot_strided_batched", testing_dot_strided_batched<T>},
+                {"dot_nrm2", testing_dot_nrm2<T>},
+                {"doti", testing_doti<T>},
+                {"gthr", testing_gthr<T>},
                 {"iamax", testing_iamax<T>},
                 {"iamax_batched", testing_iamax_batched<T>},
                 {"iamax_strided_batched", testing_iamax_strided_batched<T>},
                 {"iamin", testing_iamin<T>},
                 {"iamin_batched", testing_iamin_batched<T>},
                 {"iamin_strided_batched", testing_iamin_strided_batched<T>},
+                {"int64_api", testing_int64_api<T>},
+                {"level1_fusion", testing_level1_fusion<T>},
                 {"nrm2", testing_nrm2<T>},
                 {"nrm2_batched", testing_nrm2_batched<T>},
                 {"nrm2_strided_batched", testing_nrm2_strided_batched<T>},
+                {"rot_sequence", testing_rot_sequence<T>},
+                {"rot_sweep", testing_rot_sweep<T>},
+                {"roti", testing_roti<T>},
                 {"rotm", testing_rotm<T>},
                 {"rotm_batched", testing_rotm_batched<T>},
                 {"rotm_strided_batched", testing_rotm_strided_batched<T>},
                 {"rotmg", testing_rotmg<T>},
                 {"rotmg_batched", testing_rotmg_batched<T>},
                 {"rotmg_strided_batched", testing_rotmg_strided_batched<T>},
+                {"sctr", testing_sctr<T>},
                 {"swap", testing_swap<T>},
                 {"swap_batched", testing_swap_batched<T>},
                 {"swap_strided_batched", testing_swap_strided_batched<T>},
+                {"waxpby", testing_waxpby<T>},
                 // L2
                 {"gbmv", testing_gbmv<T>},
                 {"gbmv_batched", testing_gbmv_batched<T>},
@@ -350,13 +693,20 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
                 {"geam", testing_geam<T>},
                 {"geam_batched", testing_geam_batched<T>},
                 {"geam_strided_batched", testing_geam_strided_batched<T>},
+                {"geam_multi", testing_geam_multi<T>},
                 {"geam_ex", testing_geam_ex<T>},
+                {"imatcopy", testing_imatcopy<T>},
                 {"gemv", testing_gemv<T>},
                 {"gemv_batched", testing_gemv_batched<T>},
+                {"gemv_nt", testing_gemv_nt<T>},
                 {"gemv_strided_batched", testing_gemv_strided_batched<T>},
+                {"gemv_vbatched", testing_gemv_vbatched<T>},
+                {"level2_tuning", testing_level2_tuning<T>},
+                {"persisting_range", testing_persisting_range<T>},
                 {"ger", testing_ger<T, false>},
                 {"ger_batched", testing_ger_batched<T, false>},
                 {"ger_strided_batched", testing_ger_strided_batched<T, false>},
+                {"ger_multi", testing_ger_multi<T>},
                 {"spr", testing_spr<T>},
                 {"spr_batched", testing_spr_batched<T>},
                 {"spr_strided_batched", testing_spr_strided_batched<T>},
@@ -397,6 +747,13 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
                 {"dgmm", testing_dgmm<T>},
                 {"dgmm_batched", testing_dgmm_batched<T>},
                 {"dgmm_strided_batched", testing_dgmm_strided_batched<T>},
+                {"gemm_dgmm", testing_gemm_dgmm<T>},
+                {"gemm_multi_device", testing_gemm_multi_device<T>},
+                {"gemm_offload", testing_gemm_offload<T>},
+                {"syrk_offload", testing_syrk_offload<T>},
+                {"trsm_offload", testing_trsm_offload<T>},
+                {"triangular_factor", testing_triangular_factor<T>},
+                {"rfp", testing_rfp<T>},
                 {"symm", testing_symm_hemm<T, false>},
                 {"symm_batched", testing_symm_hemm_batched<T, false>},
                 {"symm_strided_batched", testing_symm_hemm_strided_batched<T, false>},
@@ -425,12 +782,20 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
                 {"gemm", testing_gemm<T>},
                 {"gemm_batched", testing_gemm_batched<T>},
                 {"gemm_strided_batched", testing_gemm_strided_batched<T>},
+                {"gemm_backend", testing_gemm_backend<T>},
+                {"managed_prefetch", testing_managed_prefetch<T>},
+                {"perf_gemm", testing_perf_smoke<T>},
+                {"perf_gemm_strided_batched", testing_perf_smoke<T>},
+                {"perf_gemv", testing_perf_smoke<T>},
+                {"perf_axpy", testing_perf_smoke<T>},
+                {"perf_dot", testing_perf_smoke<T>},
                 {"trsm", testing_trsm<T>},
                 {"trsm_ex", testing_trsm_ex<T>},
                 {"trsm_batched", testing_trsm_batched<T>},
                 {"trsm_batched_ex", testing_trsm_batched_ex<T>},
                 {"trsm_strided_batched", testing_trsm_strided_batched<T>},
                 {"trsm_strided_batched_ex", testing_trsm_strided_batched_ex<T>},
+                {"workspace_scope", testing_workspace_scope<T>},
 #endif
               };
         run_function(map, arg);
@@ -446,6 +811,8 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, rocblas_bfloat16>{}>> :
             {"dot", testing_dot<T>},
             {"dot_batched", testing_dot_batched<T>},
             {"dot_strided_batched", testing_dot_strided_batched<T>},
+            {"set_get_matrix_ex", testing_set_get_matrix_ex<T>},
+            {"host_convert", testing_host_convert<T>},
         };
         run_function(map, arg);
     }
@@ -464,6 +831,8 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, rocblas_half>{}>> : rocb
                 {"dot_batched", testing_dot_batched<T>},
                 {"dot_strided_batched", testing_dot_strided_batched<T>},
                 {"geam_ex", testing_geam_ex<T>},
+                {"set_get_matrix_ex", testing_set_get_matrix_ex<T>},
+                {"host_convert", testing_host_convert<T>},
 #if BUILD_WITH_TENSILE
                 {"gemm", testing_gemm<T>},
                 {"gemm_batched", testing_gemm_batched<T>},
@@ -487,6 +856,17 @@ struct perf_blas<T,
                 {"set_get_vector_async", testing_set_get_vector_async<T>},
                 {"set_get_matrix", testing_set_get_matrix<T>},
                 {"set_get_matrix_async", testing_set_get_matrix_async<T>},
+                {"set_get_matrix_batched", testing_set_get_matrix_batched<T>},
+                {"host_numa", testing_host_numa<T>},
+                {"graph_safe", testing_graph_safe<T>},
+                {"reproducible", testing_reproducible<T>},
+                {"compensated_summation", testing_compensated_summation<T>},
+                {"set_pointer_array", testing_set_pointer_array<T>},
+                {"initialize_devices", testing_initialize_devices<T>},
+                {"batched_stride_detection", testing_batched_stride_detection<T>},
+                {"recording", testing_recording<T>},
+                {"device_api", testing_device_api<T>},
+                {"batched_scalar_stride", testing_batched_scalar_stride<T>},
                 // L1
                 {"asum", testing_asum<T>},
                 {"asum_batched", testing_asum_batched<T>},
@@ -494,40 +874,61 @@ struct perf_blas<T,
                 {"axpy", testing_axpy<T>},
                 {"axpy_batched", testing_axpy_batched<T>},
                 {"axpy_strided_batched", testing_axpy_strided_batched<T>},
+                {"axpy_dot", testing_axpy_dot<T>},
+                {"axpyi", testing_axpyi<T>},
                 {"copy", testing_copy<T>},
                 {"copy_batched", testing_copy_batched<T>},
                 {"copy_strided_batched", testing_copy_strided_batched<T>},
                 {"dot", testing_dot<T>},
                 {"dot_batched", testing_dot_batched<T>},
                 {"dot_strided_batched", testing_dot_strided_batched<T>},
+                {"dot_nrm2", testing_dot_nrm2<T>},
                 {"dotc", testing_dotc<T>},
                 {"dotc_batched", testing_dotc_batched<T>},
                 {"dotc_strided_batched", testing_dotc_strided_batched<T>},
+                {"dotci", testing_dotci<T>},
+                {"doti", testing_doti<T>},
+                {"gthr", testing_gthr<T>},
                 {"iamax", testing_iamax<T>},
                 {"iamax_batched", testing_iamax_batched<T>},
                 {"iamax_strided_batched", testing_iamax_strided_batched<T>},
                 {"iamin", testing_iamin<T>},
                 {"iamin_batched", testing_iamin_batched<T>},
                 {"iamin_strided_batched", testing_iamin_strided_batched<T>},
+                {"int64_api", testing_int64_api<T>},
                 {"nrm2", testing_nrm2<T>},
                 {"nrm2_batched", testing_nrm2_batched<T>},
                 {"nrm2_strided_batched", testing_nrm2_strided_batched<T>},
+                {"rot_sequence", testing_rot_sequence<T>},
+                {"rot_sweep", testing_rot_sweep<T>},
+                {"sctr", testing_sctr<T>},
                 {"swap", testing_swap<T>},
                 {"swap_batched", testing_swap_batched<T>},
                 {"swap_strided_batched", testing_swap_strided_batched<T>},
+                {"waxpby", testing_waxpby<T>},
+                {"axpy_planar", testing_axpy_planar<T>},
+                {"scal_planar", testing_scal_planar<T>},
+                {"dotu_planar", testing_dot_planar<T>},
+                {"dotc_planar", testing_dotc_planar<T>},
                 // L2
                 {"gbmv", testing_gbmv<T>},
                 {"gbmv_batched", testing_gbmv_batched<T>},
                 {"gbmv_strided_batched", testing_gbmv_strided_batched<T>},
                 {"gemv", testing_gemv<T>},
                 {"gemv_batched", testing_gemv_batched<T>},
+                {"gemv_nt", testing_gemv_nt<T>},
                 {"gemv_strided_batched", testing_gemv_strided_batched<T>},
+                {"gemv_vbatched", testing_gemv_vbatched<T>},
+                {"level2_tuning", testing_level2_tuning<T>},
+                {"persisting_range", testing_persisting_range<T>},
                 {"geru", testing_ger<T, false>},
                 {"geru_batched", testing_ger_batched<T, false>},
                 {"geru_strided_batched", testing_ger_strided_batched<T, false>},
                 {"gerc", testing_ger<T, true>},
                 {"gerc_batched", testing_ger_batched<T, true>},
                 {"gerc_strided_batched", testing_ger_strided_batched<T, true>},
+                {"ger_multi", testing_ger_multi<T>},
+                {"gerc_multi", testing_gerc_multi<T>},
                 {"hbmv", testing_hbmv<T>},
                 {"hbmv_batched", testing_hbmv_batched<T>},
                 {"hbmv_strided_batched", testing_hbmv_strided_batched<T>},
@@ -583,9 +984,18 @@ struct perf_blas<T,
                 {"dgmm", testing_dgmm<T>},
                 {"dgmm_batched", testing_dgmm_batched<T>},
                 {"dgmm_strided_batched", testing_dgmm_strided_batched<T>},
+                {"gemm_dgmm", testing_gemm_dgmm<T>},
+                {"gemm_multi_device", testing_gemm_multi_device<T>},
+                {"gemm_offload", testing_gemm_offload<T>},
+                {"syrk_offload", testing_syrk_offload<T>},
+                {"trsm_offload", testing_trsm_offload<T>},
+                {"triangular_factor", testing_triangular_factor<T>},
+                {"rfp", testing_rfp<T>},
                 {"geam", testing_geam<T>},
                 {"geam_batched", testing_geam_batched<T>},
                 {"geam_strided_batched", testing_geam_strided_batched<T>},
+                {"geam_multi", testing_geam_multi<T>},
+                {"imatcopy", testing_imatcopy<T>},
                 {"syrk", testing_syrk<T>},
                 {"syrk_batched", testing_syrk_batched<T>},
                 {"syrk_strided_batched", testing_syrk_strided_batched<T>},
@@ -620,12 +1030,15 @@ struct perf_blas<T,
                 {"gemm", testing_gemm<T>},
                 {"gemm_batched", testing_gemm_batched<T>},
                 {"gemm_strided_batched", testing_gemm_strided_batched<T>},
+                {"gemm_backend", testing_gemm_backend<T>},
+                {"managed_prefetch", testing_managed_prefetch<T>},
                 {"trsm", testing_trsm<T>},
                 {"trsm_ex", testing_trsm_ex<T>},
                 {"trsm_batched", testing_trsm_batched<T>},
                 {"trsm_batched_ex", testing_trsm_batched_ex<T>},
                 {"trsm_strided_batched", testing_trsm_strided_batched<T>},
                 {"trsm_strided_batched_ex", testing_trsm_strided_batched_ex<T>},
+                {"workspace_scope", testing_workspace_scope<T>},
                 {"trmm", testing_trmm<T>},
                 {"trmm_batched", testing_trmm_batched<T>},
                 {"trmm_strided_batched", testing_trmm_strided_batched<T>},
@@ -674,6 +1087,44 @@ struct perf_blas_axpy_ex<
             {"axpy_ex", testing_axpy_ex<Ta, Tx, Ty, Tex>},
             {"axpy_batched_ex", testing_axpy_batched_ex<Ta, Tx, Ty, Tex>},
             {"axpy_strided_batched_ex", testing_axpy_strided_batched_ex<Ta, Tx, Ty, Tex>},
+            {"axpby_ex", testing_axpby_ex<Ta, Tx, Ty, Tex>},
+            {"axpby_batched_ex", testing_axpby_batched_ex<Ta, Tx, Ty, Tex>},
+            {"axpby_strided_batched_ex", testing_axpby_strided_batched_ex<Ta, Tx, Ty, Tex>},
+        };
+        run_function(map, arg);
+    }
+};
+
+template <typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty, typename = void>
+struct perf_blas_copy_scal_ex : rocblas_test_invalid
+{
+};
+
+template <typename Ta, typename Tx, typename Ty, typename Tex>
+struct perf_blas_copy_scal_ex<
+    Ta,
+    Tx,
+    Ty,
+    Tex,
+    std::enable_if_t<
+        std::is_base_of<rocblas_test_valid, perf_blas_axpy_ex<Ta, Tx, Ty, Tex>>{}
+        || (std::is_same<Ta, float>{} && std::is_same<Ta, Tex>{}
+            && ((std::is_same<Tx, float>{}
+                 && (std::is_same<Ty, rocblas_half>{} || std::is_same<Ty, rocblas_bfloat16>{}))
+                || (std::is_same<Ty, float>{}
+                    && (std::is_same<Tx, rocblas_half>{} || std::is_same<Tx, rocblas_bfloat16>{}))))
+        || (std::is_same<Ta, double>{} && std::is_same<Ta, Tex>{}
+            && ((std::is_same<Tx, double>{} && std::is_same<Ty, float>{})
+                || (std::is_same<Tx, float>{} && std::is_same<Ty, double>{})))>>
+    : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"copy_scal_ex", testing_copy_scal_ex<Ta, Tx, Ty, Tex>},
+            {"copy_scal_batched_ex", testing_copy_scal_batched_ex<Ta, Tx, Ty, Tex>},
+            {"copy_scal_strided_batched_ex",
+             testing_copy_scal_strided_batched_ex<Ta, Tx, Ty, Tex>},
         };
         run_function(map, arg);
     }
@@ -715,6 +1166,8 @@ struct perf_blas_dot_ex<
             {"dotc_ex", testing_dotc_ex<Tx, Ty, Tr, Tex>},
             {"dotc_batched_ex", testing_dotc_batched_ex<Tx, Ty, Tr, Tex>},
             {"dotc_strided_batched_ex", testing_dotc_strided_batched_ex<Tx, Ty, Tr, Tex>},
+            {"mdot_batched_ex", testing_mdot_batched_ex<Tx, Ty, Tr, Tex>},
+            {"mdotc_batched_ex", testing_mdotc_batched_ex<Tx, Ty, Tr, Tex>},
         };
         run_function(map, arg);
     }
@@ -753,6 +1206,226 @@ struct perf_blas_nrm2_ex<
     }
 };
 
+template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+struct perf_blas_gemv_ex : rocblas_test_invalid
+{
+};
+
+template <typename Ti, typename To, typename Tc>
+struct perf_blas_gemv_ex<
+    Ti,
+    To,
+    Tc,
+    std::enable_if_t<(std::is_same<Ti, To>{} && std::is_same<To, Tc>{}
+                      && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+                          || std::is_same<Ti, rocblas_float_complex>{}
+                          || std::is_same<Ti, rocblas_double_complex>{}))
+                     || ((std::is_same<Ti, rocblas_half>{} || std::is_same<Ti, rocblas_bfloat16>{})
+                         && (std::is_same<To, Ti>{} || std::is_same<To, float>{})
+                         && std::is_same<Tc, float>{})>> : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gemv_ex", testing_gemv_ex<Ti, To, Tc>},
+            {"gemv_batched_ex", testing_gemv_batched_ex<Ti, To, Tc>},
+            {"gemv_strided_batched_ex", testing_gemv_strided_batched_ex<Ti, To, Tc>},
+        };
+        run_function(map, arg);
+    }
+};
+
+template <typename Ta, typename Tb = Ta, typename Tex = Tb, typename = void>
+struct perf_blas_omatcopy_ex : rocblas_test_invalid
+{
+};
+
+// omatcopy_ex converts between half, bfloat16 and float computed in float, and between float
+// and double computed in double
+template <typename Ta, typename Tb, typename Tex>
+struct perf_blas_omatcopy_ex<
+    Ta,
+    Tb,
+    Tex,
+    std::enable_if_t<(std::is_same<Ta, Tb>{} && std::is_same<Tb, Tex>{}
+                      && (std::is_same<Ta, float>{} || std::is_same<Ta, double>{}
+                          || std::is_same<Ta, rocblas_float_complex>{}
+                          || std::is_same<Ta, rocblas_double_complex>{}))
+                     || !std::is_same<Ta, Tex>{} || !std::is_same<Tb, Tex>{}>>
+    : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"omatcopy_ex", testing_omatcopy_ex<Ta, Tb, Tex>},
+        };
+        run_function(map, arg);
+    }
+};
+
+// Stochastic rounding applies to bfloat16 and half results with float execution
+template <typename T, typename = void>
+struct perf_stochastic_rounding : rocblas_test_invalid
+{
+};
+
+template <typename T>
+struct perf_stochastic_rounding<
+    T,
+    std::enable_if_t<std::is_same<T, rocblas_bfloat16>{} || std::is_same<T, rocblas_half>{}>>
+    : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"stochastic_rounding", testing_stochastic_rounding<T>},
+        };
+        run_function(map, arg);
+    }
+};
+
+#ifdef ROCBLAS_BENCH_DISTRIBUTED
+
+template <typename T, typename = void>
+struct perf_blas_distributed : rocblas_test_invalid
+{
+};
+
+template <typename T>
+struct perf_blas_distributed<
+    T,
+    std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                     || std::is_same<T, rocblas_float_complex>{}
+                     || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"dist_gemm", testing_dist_gemm<T>},
+            {"dist_syrk", testing_dist_syrk<T>},
+        };
+        run_function(map, arg);
+    }
+};
+
+#endif // ROCBLAS_BENCH_DISTRIBUTED
+
+template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+struct perf_blas_symv_ex : rocblas_test_invalid
+{
+};
+
+template <typename Ti, typename To, typename Tc>
+struct perf_blas_symv_ex<
+    Ti,
+    To,
+    Tc,
+    std::enable_if_t<(std::is_same<Ti, To>{} && std::is_same<To, Tc>{}
+                      && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+                          || std::is_same<Ti, rocblas_float_complex>{}
+                          || std::is_same<Ti, rocblas_double_complex>{}))
+                     || ((std::is_same<Ti, rocblas_half>{} || std::is_same<Ti, rocblas_bfloat16>{})
+                         && (std::is_same<To, Ti>{} || std::is_same<To, float>{})
+                         && std::is_same<Tc, float>{})>> : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"symv_ex", testing_symv_ex<Ti, To, Tc>},
+            {"symv_batched_ex", testing_symv_batched_ex<Ti, To, Tc>},
+            {"symv_strided_batched_ex", testing_symv_strided_batched_ex<Ti, To, Tc>},
+        };
+        run_function(map, arg);
+    }
+};
+
+// ger_ex, syr2_ex and trmv_ex update A or x in place, so the output type is the input type
+template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+struct perf_blas_level2_ex : rocblas_test_invalid
+{
+};
+
+template <typename Ti, typename To, typename Tc>
+struct perf_blas_level2_ex<
+    Ti,
+    To,
+    Tc,
+    std::enable_if_t<std::is_same<Ti, To>{}
+                     && ((std::is_same<Ti, Tc>{}
+                          && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+                              || std::is_same<Ti, rocblas_float_complex>{}
+                              || std::is_same<Ti, rocblas_double_complex>{}))
+                         || ((std::is_same<Ti, rocblas_half>{}
+                              || std::is_same<Ti, rocblas_bfloat16>{})
+                             && std::is_same<Tc, float>{}))>> : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"ger_ex", testing_ger_ex<Ti, Tc>},
+            {"ger_batched_ex", testing_ger_batched_ex<Ti, Tc>},
+            {"ger_strided_batched_ex", testing_ger_strided_batched_ex<Ti, Tc>},
+            {"syr2_ex", testing_syr2_ex<Ti, Tc>},
+            {"syr2_batched_ex", testing_syr2_batched_ex<Ti, Tc>},
+            {"syr2_strided_batched_ex", testing_syr2_strided_batched_ex<Ti, Tc>},
+            {"trmv_ex", testing_trmv_ex<Ti, Tc>},
+            {"trmv_batched_ex", testing_trmv_batched_ex<Ti, Tc>},
+            {"trmv_strided_batched_ex", testing_trmv_strided_batched_ex<Ti, Tc>},
+        };
+        run_function(map, arg);
+    }
+};
+
+// The quantized gemv takes half or bfloat16 x with float computation
+template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+struct perf_blas_gemv_quantized_ex : rocblas_test_invalid
+{
+};
+
+template <typename Ti, typename To, typename Tc>
+struct perf_blas_gemv_quantized_ex<
+    Ti,
+    To,
+    Tc,
+    std::enable_if_t<(std::is_same<Ti, rocblas_half>{} || std::is_same<Ti, rocblas_bfloat16>{})
+                     && (std::is_same<To, Ti>{} || std::is_same<To, float>{})
+                     && std::is_same<Tc, float>{}>> : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gemv_quantized_ex", testing_gemv_quantized_ex<Ti, To, Tc>},
+        };
+        run_function(map, arg);
+    }
+};
+
+// The grouped source kernels compute only uniform float, double and complex precisions
+template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+struct perf_gemm_grouped_ex : rocblas_test_invalid
+{
+};
+
+template <typename Ti, typename To, typename Tc>
+struct perf_gemm_grouped_ex<
+    Ti,
+    To,
+    Tc,
+    std::enable_if_t<std::is_same<Ti, To>{} && std::is_same<To, Tc>{}
+                     && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+                         || std::is_same<Ti, rocblas_float_complex>{}
+                         || std::is_same<Ti, rocblas_double_complex>{})>> : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gemm_grouped_ex", testing_gemm_grouped_ex<Ti, To, Tc>},
+            {"gemm_grouped_trans_ex", testing_gemm_grouped_trans_ex<Ti, To, Tc>},
+        };
+        run_function(map, arg);
+    }
+};
+
 template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
 struct perf_blas_rot : rocblas_test_invalid
 {
@@ -1029,7 +1702,8 @@ int run_bench_test(
         }
     }
 
-    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex"))
+    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex")
+       || !strcmp(function, "gemm_packed_ex"))
     {
         // adjust dimension for GEMM routines
         rocblas_int min_lda = arg.transA == 'N' ? arg.M : arg.K;
@@ -1109,6 +1783,24 @@ int run_bench_test(
 
         rocblas_gemm_dispatch<perf_gemm_strided_batched_ex>(arg);
     }
+    else if(!strcmp(function, "gemm_epilogue"))
+        rocblas_gemm_dispatch<perf_gemm_epilogue>(arg);
+    else if(!strcmp(function, "gemm_warmup"))
+        rocblas_gemm_dispatch<perf_gemm_warmup>(arg);
+    else if(!strcmp(function, "gemm_coalescer"))
+        rocblas_gemm_dispatch<perf_gemm_coalescer>(arg);
+    else if(!strcmp(function, "contract_ex"))
+        rocblas_gemm_dispatch<perf_contract_ex>(arg);
+    else if(!strcmp(function, "gemm_chain_ex"))
+        rocblas_gemm_dispatch<perf_gemm_chain_ex>(arg);
+    else if(!strcmp(function, "trsm_refinement"))
+        rocblas_simple_dispatch<perf_trsm_refinement>(arg);
+    else if(!strcmp(function, "gemm_planar_ex"))
+        rocblas_simple_dispatch<perf_gemm_planar_ex>(arg);
+    else if(!strcmp(function, "gemm_real_complex"))
+        rocblas_simple_dispatch<perf_gemm_real_complex>(arg);
+    else if(!strcmp(function, "gemm_block_sparse_ex"))
+        rocblas_simple_dispatch<perf_gemm_block_sparse_ex>(arg);
     else
 #endif
     {
@@ -1125,25 +1817,211 @@ int run_bench_test(
                 || !strcmp(function, "rot_strided_batched_ex"))
             rocblas_blas1_ex_dispatch<perf_blas_rot_ex>(arg);
         else if(!strcmp(function, "axpy_ex") || !strcmp(function, "axpy_batched_ex")
-                || !strcmp(function, "axpy_strided_batched_ex"))
+                || !strcmp(function, "axpy_strided_batched_ex") || !strcmp(function, "axpby_ex")
+                || !strcmp(function, "axpby_batched_ex")
+                || !strcmp(function, "axpby_strided_batched_ex"))
             rocblas_blas1_ex_dispatch<perf_blas_axpy_ex>(arg);
+        else if(!strcmp(function, "copy_scal_ex") || !strcmp(function, "copy_scal_batched_ex")
+                || !strcmp(function, "copy_scal_strided_batched_ex"))
+            rocblas_blas1_ex_dispatch<perf_blas_copy_scal_ex>(arg);
         else if(!strcmp(function, "dot_ex") || !strcmp(function, "dot_batched_ex")
                 || !strcmp(function, "dot_strided_batched_ex") || !strcmp(function, "dotc_ex")
                 || !strcmp(function, "dotc_batched_ex")
-                || !strcmp(function, "dotc_strided_batched_ex"))
+                || !strcmp(function, "dotc_strided_batched_ex")
+                || !strcmp(function, "mdot_batched_ex") || !strcmp(function, "mdotc_batched_ex"))
             rocblas_blas1_ex_dispatch<perf_blas_dot_ex>(arg);
         else if(!strcmp(function, "nrm2_ex") || !strcmp(function, "nrm2_batched_ex")
                 || !strcmp(function, "nrm2_strided_batched_ex"))
             rocblas_blas1_ex_dispatch<perf_blas_nrm2_ex>(arg);
+        else if(!strcmp(function, "gemv_ex") || !strcmp(function, "gemv_batched_ex")
+                || !strcmp(function, "gemv_strided_batched_ex"))
+            rocblas_gemm_dispatch<perf_blas_gemv_ex>(arg);
+        else if(!strcmp(function, "symv_ex") || !strcmp(function, "symv_batched_ex")
+                || !strcmp(function, "symv_strided_batched_ex"))
+            rocblas_gemm_dispatch<perf_blas_symv_ex>(arg);
+        else if(!strcmp(function, "ger_ex") || !strcmp(function, "ger_batched_ex")
+                || !strcmp(function, "ger_strided_batched_ex") || !strcmp(function, "syr2_ex")
+                || !strcmp(function, "syr2_batched_ex")
+                || !strcmp(function, "syr2_strided_batched_ex") || !strcmp(function, "trmv_ex")
+                || !strcmp(function, "trmv_batched_ex")
+                || !strcmp(function, "trmv_strided_batched_ex"))
+            rocblas_gemm_dispatch<perf_blas_level2_ex>(arg);
+        else if(!strcmp(function, "gemv_quantized_ex"))
+            rocblas_gemm_dispatch<perf_blas_gemv_quantized_ex>(arg);
+        else if(!strcmp(function, "omatcopy_ex"))
+            rocblas_matcopy_dispatch<perf_blas_omatcopy_ex>(arg);
+#ifdef ROCBLAS_BENCH_DISTRIBUTED
+        else if(!strcmp(function, "dist_gemm") || !strcmp(function, "dist_syrk"))
+            rocblas_simple_dispatch<perf_blas_distributed>(arg);
+#endif
+        else if(!strcmp(function, "gemm_grouped_ex") || !strcmp(function, "gemm_grouped_trans_ex"))
+            rocblas_gemm_dispatch<perf_gemm_grouped_ex>(arg);
         else if(!strcmp(function, "scal_ex") || !strcmp(function, "scal_batched_ex")
                 || !strcmp(function, "scal_strided_batched_ex"))
             rocblas_blas1_ex_dispatch<perf_blas_scal_ex>(arg);
+        else if(!strcmp(function, "stochastic_rounding"))
+            rocblas_simple_dispatch<perf_stochastic_rounding>(arg);
         else
             rocblas_simple_dispatch<perf_blas>(arg);
     }
     return 0;
 }
 
+#if BUILD_WITH_TENSILE
+
+// Size in bytes of one element of a rocblas_datatype
+static size_t rocblas_bench_datatype_size(rocblas_datatype type)
+{
+    switch(type)
+    {
+    case rocblas_datatype_f16_r:
+    case rocblas_datatype_bf16_r:
+        return 2;
+    case rocblas_datatype_f32_r:
+    case rocblas_datatype_i32_r:
+        return 4;
+    case rocblas_datatype_f64_r:
+    case rocblas_datatype_f32_c:
+        return 8;
+    case rocblas_datatype_f64_c:
+        return 16;
+    case rocblas_datatype_i8_r:
+        return 1;
+    default:
+        throw std::invalid_argument("Unsupported datatype for --tune: "s
+                                    + rocblas_datatype2string(type));
+    }
+}
+
+// Store a real scalar in the representation of the compute type
+static void rocblas_bench_set_scalar(rocblas_datatype type, double value, void* scalar)
+{
+    switch(type)
+    {
+    case rocblas_datatype_f16_r:
+        *static_cast<rocblas_half*>(scalar) = rocblas_half(value);
+        break;
+    case rocblas_datatype_f32_r:
+        *static_cast<float*>(scalar) = float(value);
+        break;
+    case rocblas_datatype_f64_r:
+        *static_cast<double*>(scalar) = value;
+        break;
+    case rocblas_datatype_i32_r:
+        *static_cast<int32_t*>(scalar) = int32_t(value);
+        break;
+    case rocblas_datatype_f32_c:
+        *static_cast<rocblas_float_complex*>(scalar) = rocblas_float_complex(float(value));
+        break;
+    case rocblas_datatype_f64_c:
+        *static_cast<rocblas_double_complex*>(scalar) = rocblas_double_complex(value);
+        break;
+    default:
+        throw std::invalid_argument("Unsupported compute_type for --tune: "s
+                                    + rocblas_datatype2string(type));
+    }
+}
+
+// Offline tuning of gemm_ex: time every Tensile solution which can solve the problem, and
+// record the fastest one in the tuning database, which is created if it does not exist
+int rocblas_bench_tune_gemm_ex(Arguments& arg, const std::string& tuning_db)
+{
+    if(strcmp(arg.function, "gemm_ex"))
+        throw std::invalid_argument("--tune is only supported for --function gemm_ex");
+
+    rocblas_client_initialize();
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+    rocblas_int       M = arg.M, N = arg.N, K = arg.K;
+    rocblas_int       lda = std::max(arg.lda, transA == rocblas_operation_none ? M : K);
+    rocblas_int       ldb = std::max(arg.ldb, transB == rocblas_operation_none ? K : N);
+    rocblas_int       ldc = std::max(arg.ldc, M);
+    rocblas_int       ldd = arg.c_noalias_d ? std::max(arg.ldd, M) : ldc;
+
+    size_t size_A = size_t(lda) * (transA == rocblas_operation_none ? K : M);
+    size_t size_B = size_t(ldb) * (transB == rocblas_operation_none ? N : K);
+    size_t size_C = size_t(ldc) * N;
+    size_t size_D = size_t(ldd) * N;
+
+    device_vector<char> dA(size_A * rocblas_bench_datatype_size(arg.a_type));
+    device_vector<char> dB(size_B * rocblas_bench_datatype_size(arg.b_type));
+    device_vector<char> dC(size_C * rocblas_bench_datatype_size(arg.c_type));
+    device_vector<char> dD(arg.c_noalias_d ? size_D * rocblas_bench_datatype_size(arg.d_type) : 1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_HIP_ERROR(hipMemset(dA, 0, dA.nmemb()));
+    CHECK_HIP_ERROR(hipMemset(dB, 0, dB.nmemb()));
+    CHECK_HIP_ERROR(hipMemset(dC, 0, dC.nmemb()));
+
+    void* D = arg.c_noalias_d ? (void*)dD : (void*)dC;
+
+    alignas(16) char alpha[16], beta[16];
+    rocblas_bench_set_scalar(arg.compute_type, arg.alpha, alpha);
+    rocblas_bench_set_scalar(arg.compute_type, arg.beta, beta);
+
+    // Merge with an existing database; a missing file is not an error
+    rocblas_load_tuning_db(tuning_db.c_str());
+
+    rocblas_local_handle handle{arg};
+    hipStream_t          stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+#define GEMM_EX_TUNE_ARGS                                                                          \
+    handle, transA, transB, M, N, K, alpha, dA, arg.a_type, lda, dB, arg.b_type, ldb, beta, dC,    \
+        arg.c_type, ldc, D, arg.d_type, ldd, arg.compute_type, rocblas_gemm_algo_solution_index
+
+    rocblas_int num_solutions = 0;
+    CHECK_ROCBLAS_ERROR(
+        rocblas_gemm_ex_get_solutions(GEMM_EX_TUNE_ARGS, arg.flags, nullptr, &num_solutions));
+    std::vector<rocblas_int> solutions(num_solutions);
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_get_solutions(
+        GEMM_EX_TUNE_ARGS, arg.flags, solutions.data(), &num_solutions));
+
+    double      best_time     = std::numeric_limits<double>::max();
+    rocblas_int best_solution = 0;
+    for(auto solution : solutions)
+    {
+        for(rocblas_int i = 0; i < arg.cold_iters; ++i)
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_ex(GEMM_EX_TUNE_ARGS, solution, arg.flags));
+
+        double time = get_time_us_sync(stream);
+        for(rocblas_int i = 0; i < arg.iters; ++i)
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_ex(GEMM_EX_TUNE_ARGS, solution, arg.flags));
+        time = (get_time_us_sync(stream) - time) / std::max(arg.iters, 1);
+
+        if(time < best_time)
+        {
+            best_time     = time;
+            best_solution = solution;
+        }
+    }
+
+    if(!best_solution)
+    {
+        rocblas_cerr << "rocblas-bench: no solutions found to tune" << std::endl;
+        return 1;
+    }
+
+    // Run the winner once with recording enabled to add it to the database
+    CHECK_ROCBLAS_ERROR(rocblas_set_tuning_db_record(handle, true));
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_ex(GEMM_EX_TUNE_ARGS, best_solution, arg.flags));
+    CHECK_ROCBLAS_ERROR(rocblas_set_tuning_db_record(handle, false));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+#undef GEMM_EX_TUNE_ARGS
+
+    CHECK_ROCBLAS_ERROR(rocblas_save_tuning_db(tuning_db.c_str()));
+
+    rocblas_cout << "rocblas-bench: tuned " << num_solutions << " solution(s), recorded solution "
+                 << best_solution << " (" << best_time << " us) in " << tuning_db << std::endl;
+    return 0;
+}
+
+#endif // BUILD_WITH_TENSILE
+
 int rocblas_bench_datafile(const std::string& filter, bool any_stride)
 {
     int ret = 0;
@@ -1208,6 +2086,213 @@ int run_bench_gpu_test(int                parallel_devices,
     return 0;
 }
 
+// Problems of each (device, stream) of a concurrent benchmark
+using rocblas_bench_streams = std::map<std::pair<int, int>, std::vector<Arguments>>;
+
+// Run the problems of each (device, stream) in order on one stream of that device, each stream
+// driven by its own thread, all streams concurrently
+int rocblas_bench_run_concurrent(const rocblas_bench_streams& streams,
+                                 const std::string&           filter,
+                                 bool                         any_stride)
+{
+    struct stream_work
+    {
+        int    device, stream;
+        size_t problems;
+        double wall_us, gpu_us, gflop, gbyte;
+    };
+    std::vector<stream_work> work;
+    for(auto& s : streams)
+        work.push_back({s.first.first, s.first.second, s.second.size(), 0, 0, 0, 0});
+
+    // all streams start their timed runs together, after every stream has warmed up
+    std::mutex              mutex;
+    std::condition_variable cond;
+    size_t                  ready = 0;
+
+    auto run_stream = [&](stream_work& w, const std::vector<Arguments>& problems) {
+        CHECK_HIP_ERROR(hipSetDevice(w.device));
+        rocblas_client_initialize();
+
+        hipStream_t stream;
+        CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+        rocblas_set_local_handle_stream(stream);
+
+        for(Arguments a : problems)
+        {
+            a.cold_iters = 1;
+            a.iters      = 0;
+            run_bench_test(false, a, filter, any_stride, true);
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if(++ready == work.size())
+                cond.notify_all();
+            else
+                cond.wait(lock, [&] { return ready == work.size(); });
+        }
+
+        ArgumentModel_reset_logged_work();
+        double wall_us = get_time_us_no_sync();
+        for(Arguments a : problems)
+            run_bench_test(false, a, filter, any_stride, true);
+        w.wall_us = get_time_us_no_sync() - wall_us;
+        ArgumentModel_get_logged_work(w.gflop, w.gbyte, w.gpu_us);
+
+        rocblas_set_local_handle_stream(nullptr);
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    };
+
+    std::vector<std::thread> threads;
+    auto                     problems = streams.begin();
+    for(auto& w : work)
+        threads.emplace_back(run_stream, std::ref(w), std::cref((problems++)->second));
+    for(auto& t : threads)
+        t.join();
+
+    // per stream latency and throughput of the hot calls, and their sum over the streams
+    double total_gflops = 0, total_GBps = 0, max_wall_us = 0;
+    rocblas_cout << "\ndevice,stream,problems,hot-us,wall-us,rocblas-Gflops,rocblas-GB/s\n";
+    for(auto& w : work)
+    {
+        double gflops = w.gpu_us > 0 ? w.gflop / w.gpu_us * 1e6 : 0;
+        double GBps   = w.gpu_us > 0 ? w.gbyte / w.gpu_us * 1e6 : 0;
+        total_gflops += gflops;
+        total_GBps += GBps;
+        max_wall_us = std::max(max_wall_us, w.wall_us);
+        rocblas_cout << w.device << "," << w.stream << "," << w.problems << "," << w.gpu_us << ","
+                     << w.wall_us << "," << gflops << "," << GBps << "\n";
+    }
+    rocblas_cout << "streams,performance_metric,wall-us,aggregate-Gflops,aggregate-GB/s\n"
+                 << work.size() << ","
+                 << rocblas_performance_metric2string(rocblas_get_local_handle_performance_metric())
+                 << "," << max_wall_us << "," << total_gflops << "," << total_GBps << std::endl;
+
+    return 0;
+}
+
+// Mixed workload: the problems of the data file run concurrently, on the devices and streams
+// given by their device_id and stream_id
+int rocblas_bench_concurrent(const std::string& filter, bool any_stride)
+{
+    int device_count;
+    CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+
+    rocblas_bench_streams streams;
+    for(Arguments arg : RocBLAS_TestData())
+    {
+        if(arg.device_id >= device_count)
+            throw std::invalid_argument("Invalid device_id " + std::to_string(arg.device_id)
+                                        + " in " + arg.name);
+        streams[{arg.device_id, arg.stream_id}].push_back(arg);
+    }
+
+    int ret = rocblas_bench_run_concurrent(streams, filter, any_stride);
+    test_cleanup::cleanup();
+    return ret;
+}
+
+// The same problem on num_streams streams of one device, with handles using each of the
+// performance metrics for solution selection
+int rocblas_bench_multi_stream(int                                            num_streams,
+                               const std::vector<rocblas_performance_metric>& metrics,
+                               Arguments&                                     arg,
+                               const std::string&                             filter,
+                               bool                                           any_stride)
+{
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    rocblas_bench_streams streams;
+    for(int s = 0; s < num_streams; ++s)
+        streams[{device, s}].push_back(arg);
+
+    int ret = 0;
+    for(auto metric : metrics)
+    {
+        rocblas_set_local_handle_performance_metric(metric);
+        ret |= rocblas_bench_run_concurrent(streams, filter, any_stride);
+    }
+    rocblas_set_local_handle_performance_metric(rocblas_default_performance_metric);
+    return ret;
+}
+
+// Create and destroy cycles of handles on the current device, the cost of short-lived handles
+int rocblas_bench_handle_create(const Arguments& arg)
+{
+    rocblas_client_initialize();
+
+    rocblas_handle handle;
+    for(rocblas_int i = 0; i < arg.cold_iters; ++i)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+        CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+    }
+
+    double create_us = 0, destroy_us = 0;
+    for(rocblas_int i = 0; i < arg.iters; ++i)
+    {
+        double start = get_time_us_no_sync();
+        CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+        double created = get_time_us_no_sync();
+        CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+        destroy_us += get_time_us_no_sync() - created;
+        create_us += created - start;
+    }
+
+    const rocblas_int iters    = std::max(arg.iters, 1);
+    const double      cycle_us = (create_us + destroy_us) / iters;
+    rocblas_cout << "function,iters,create-us,destroy-us,cycles-per-second\n"
+                 << arg.function << "," << arg.iters << "," << create_us / iters << ","
+                 << destroy_us / iters << "," << (cycle_us > 0 ? 1e6 / cycle_us : 0) << std::endl;
+    return 0;
+}
+
+// Time --iters lines of -m characters written concurrently to one file by 1, 2, 4, ... threads,
+// each through its own rocblas_internal_ostream, as the logging of handles on different threads
+int rocblas_bench_ostream_throughput(const Arguments& arg)
+{
+    FILE* file = std::tmpfile();
+    if(!file)
+    {
+        rocblas_cerr << "Cannot create a temporary file" << std::endl;
+        return -1;
+    }
+
+    const std::string line(std::max<int64_t>(arg.M, 1) - 1, 'x');
+    const unsigned    max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+    rocblas_cout << "function,threads,lines,line-bytes,lines-per-second,MB-per-second\n";
+    for(unsigned threads = 1;; threads = std::min(threads * 2, max_threads))
+    {
+        double start = get_time_us_no_sync();
+
+        // Each stream waits for its lines to be written when it is destroyed
+        std::vector<std::thread> writers;
+        for(unsigned t = 0; t < threads; ++t)
+            writers.emplace_back([&] {
+                rocblas_internal_ostream os(fileno(file));
+                for(rocblas_int i = 0; i < arg.iters; ++i)
+                    os << line << std::endl;
+            });
+        for(auto& writer : writers)
+            writer.join();
+
+        double seconds = (get_time_us_no_sync() - start) * 1e-6;
+        double lines   = double(threads) * arg.iters;
+        rocblas_cout << arg.function << "," << threads << "," << lines << "," << line.size() + 1
+                     << "," << lines / seconds << "," << lines * (line.size() + 1) / seconds * 1e-6
+                     << std::endl;
+
+        if(threads == max_threads)
+            break;
+    }
+
+    fclose(file);
+    return 0;
+}
+
 // Replace --batch with --batch_count for backward compatibility
 void fix_batch(int argc, char* argv[])
 {
@@ -1224,6 +2309,258 @@ void fix_batch(int argc, char* argv[])
         }
 }
 
+// Values of a sweep option: a comma separated list of values and start:end:step ranges, the step
+// being +S or S to add S, or xF to multiply by F, e.g. 128:16384:x2
+std::vector<rocblas_int> parse_sweep(const std::string& spec, const char* option)
+{
+    auto invalid = [&] {
+        return std::invalid_argument(std::string("Invalid value for ") + option + " " + spec);
+    };
+
+    auto parse_int = [&](const std::string& str) {
+        char* end = nullptr;
+        long  val = strtol(str.c_str(), &end, 10);
+        if(str.empty() || *end || val < 0 || val > std::numeric_limits<rocblas_int>::max())
+            throw invalid();
+        return rocblas_int(val);
+    };
+
+    std::vector<rocblas_int> values;
+    std::istringstream       list(spec);
+    std::string              item;
+    while(std::getline(list, item, ','))
+    {
+        size_t first = item.find(':');
+        if(first == std::string::npos)
+        {
+            values.push_back(parse_int(item));
+            continue;
+        }
+
+        size_t      second = item.find(':', first + 1);
+        rocblas_int start  = parse_int(item.substr(0, first));
+        rocblas_int stop   = parse_int(item.substr(first + 1, second - first - 1));
+        std::string step   = second == std::string::npos ? "1" : item.substr(second + 1);
+        if(start > stop || step.empty())
+            throw invalid();
+
+        if(step[0] == 'x')
+        {
+            char*  end    = nullptr;
+            double factor = strtod(step.c_str() + 1, &end);
+            if(*end || !(factor > 1))
+                throw invalid();
+            for(double val = start; val <= stop; val = std::max(std::floor(val * factor), val + 1))
+                values.push_back(rocblas_int(val));
+        }
+        else
+        {
+            rocblas_int inc = parse_int(step[0] == '+' ? step.substr(1) : step);
+            if(!inc)
+                throw invalid();
+            for(int64_t val = start; val <= stop; val += inc)
+                values.push_back(rocblas_int(val));
+        }
+    }
+
+    if(values.empty())
+        throw invalid();
+    return values;
+}
+
+// Transposes of a sweep option: a comma separated list of N, T or C
+std::vector<char> parse_sweep_transposes(const std::string& spec, const char* option)
+{
+    std::vector<char>  values;
+    std::istringstream list(spec);
+    std::string        item;
+    while(std::getline(list, item, ','))
+    {
+        if(item.size() != 1)
+            throw std::invalid_argument(std::string("Invalid value for ") + option + " " + spec);
+        values.push_back(item[0]);
+    }
+
+    if(values.empty())
+        throw std::invalid_argument(std::string("Invalid value for ") + option + " " + spec);
+    return values;
+}
+
+// Options of the sizes of a sweep left to their defaults, which are then set from the sizes of
+// each problem: the minimum leading dimensions and strides of the gemm functions, and for the
+// other functions leading dimensions and strides large enough for any of them
+struct sweep_defaults
+{
+    bool lda, ldb, ldc, ldd, stride_a, stride_b, stride_c, stride_d, stride_x, stride_y;
+
+    explicit sweep_defaults(variables_map& vm)
+        : lda(vm["lda"].defaulted())
+        , ldb(vm["ldb"].defaulted())
+        , ldc(vm["ldc"].defaulted())
+        , ldd(vm["ldd"].defaulted())
+        , stride_a(vm["stride_a"].defaulted())
+        , stride_b(vm["stride_b"].defaulted())
+        , stride_c(vm["stride_c"].defaulted())
+        , stride_d(vm["stride_d"].defaulted())
+        , stride_x(vm["stride_x"].defaulted())
+        , stride_y(vm["stride_y"].defaulted())
+    {
+    }
+
+    void apply(Arguments& arg) const
+    {
+        bool        gemm = strstr(arg.function, "gemm") != nullptr;
+        rocblas_int dim  = std::max({arg.M, arg.N, arg.K, arg.KL + arg.KU + 1, 1});
+        rocblas_int a_n  = gemm ? (arg.transA == 'N' ? arg.K : arg.M) : dim;
+        rocblas_int b_n  = gemm ? (arg.transB == 'N' ? arg.N : arg.K) : dim;
+        rocblas_int c_n  = gemm ? arg.N : dim;
+
+        if(lda)
+            arg.lda = gemm ? std::max(arg.transA == 'N' ? arg.M : arg.K, 1) : dim;
+        if(ldb)
+            arg.ldb = gemm ? std::max(arg.transB == 'N' ? arg.K : arg.N, 1) : dim;
+        if(ldc)
+            arg.ldc = gemm ? std::max(arg.M, 1) : dim;
+        if(ldd)
+            arg.ldd = gemm ? std::max(arg.M, 1) : dim;
+        if(stride_a)
+            arg.stride_a = rocblas_stride(arg.lda) * a_n;
+        if(stride_b)
+            arg.stride_b = rocblas_stride(arg.ldb) * b_n;
+        if(stride_c)
+            arg.stride_c = rocblas_stride(arg.ldc) * c_n;
+        if(stride_d)
+            arg.stride_d = rocblas_stride(arg.ldd) * c_n;
+        if(stride_x)
+            arg.stride_x = rocblas_stride(dim) * std::max(std::abs(arg.incx), 1);
+        if(stride_y)
+            arg.stride_y = rocblas_stride(dim) * std::max(std::abs(arg.incy), 1);
+    }
+};
+
+static const char* rocblas_gemm_backend_string(rocblas_gemm_backend backend)
+{
+    switch(backend)
+    {
+    case rocblas_gemm_backend_default:
+        return "default";
+    case rocblas_gemm_backend_tensile:
+        return "tensile";
+    case rocblas_gemm_backend_source:
+        return "source";
+    }
+    return "invalid";
+}
+
+// GEMM backends of --backend: a comma separated list, or all
+std::vector<rocblas_gemm_backend> parse_backends(const std::string& spec)
+{
+    static const rocblas_gemm_backend all[] = {
+        rocblas_gemm_backend_default,
+#if BUILD_WITH_TENSILE
+        rocblas_gemm_backend_tensile,
+#endif
+        rocblas_gemm_backend_source,
+    };
+
+    if(spec == "all")
+        return {std::begin(all), std::end(all)};
+
+    std::vector<rocblas_gemm_backend> backends;
+    std::istringstream                list(spec);
+    for(std::string item; std::getline(list, item, ',');)
+    {
+        auto match = std::find_if(std::begin(all), std::end(all), [&](rocblas_gemm_backend b) {
+            return item == rocblas_gemm_backend_string(b);
+        });
+        if(match == std::end(all))
+            throw std::invalid_argument("Invalid value for --backend " + spec);
+        backends.push_back(*match);
+    }
+    if(backends.empty())
+        throw std::invalid_argument("Invalid value for --backend " + spec);
+    return backends;
+}
+
+// Backends each problem is run with; with more than one, a backend column and the error norms
+// against the CPU reference are reported for each of them
+static std::vector<rocblas_gemm_backend> bench_backends{rocblas_gemm_backend_default};
+
+int run_bench_backends(Arguments& arg, const std::string& filter, bool any_stride)
+{
+    if(bench_backends.size() == 1)
+        return run_bench_test(true, arg, filter, any_stride);
+
+    int ret = 0;
+    for(auto backend : bench_backends)
+    {
+        Arguments backend_arg  = arg;
+        backend_arg.norm_check = 1;
+        rocblas_set_local_handle_gemm_backend(backend);
+        ArgumentModel_set_backend(rocblas_gemm_backend_string(backend));
+        ret |= run_bench_test(true, backend_arg, filter, any_stride);
+    }
+    rocblas_set_local_handle_gemm_backend(rocblas_gemm_backend_default);
+    ArgumentModel_set_backend("");
+    return ret;
+}
+
+// Runs every combination of the swept precisions, transposes and sizes in this process, after
+// an untimed run of the largest sizes of each precision so that the device buffers it allocates
+// are reused by all the problems of the sweep
+int rocblas_bench_sweep(const std::vector<Arguments>&   precisions,
+                        const std::vector<char>&        transA,
+                        const std::vector<char>&        transB,
+                        const std::vector<rocblas_int>& batch_count,
+                        const std::vector<rocblas_int>& M,
+                        const std::vector<rocblas_int>& N,
+                        const std::vector<rocblas_int>& K,
+                        const sweep_defaults&           defaults,
+                        const std::string&              filter,
+                        bool                            any_stride)
+{
+    device_set_buffer_reuse(true);
+
+    for(const Arguments& base : precisions)
+    {
+        Arguments arg   = base;
+        arg.transA      = transA[0];
+        arg.transB      = transB[0];
+        arg.batch_count = *std::max_element(batch_count.begin(), batch_count.end());
+        arg.M           = *std::max_element(M.begin(), M.end());
+        arg.N           = *std::max_element(N.begin(), N.end());
+        arg.K           = *std::max_element(K.begin(), K.end());
+        arg.cold_iters  = 0;
+        arg.iters       = 0;
+        defaults.apply(arg);
+        run_bench_test(true, arg, filter, any_stride);
+    }
+
+    int ret = 0;
+    for(const Arguments& base : precisions)
+        for(char ta : transA)
+            for(char tb : transB)
+                for(rocblas_int b : batch_count)
+                    for(rocblas_int m : M)
+                        for(rocblas_int n : N)
+                            for(rocblas_int k : K)
+                            {
+                                Arguments arg   = base;
+                                arg.transA      = ta;
+                                arg.transB      = tb;
+                                arg.batch_count = b;
+                                arg.M           = m;
+                                arg.N           = n;
+                                arg.K           = k;
+                                defaults.apply(arg);
+                                ret |= run_bench_backends(arg, filter, any_stride);
+                            }
+
+    device_buffer_release();
+    device_set_buffer_reuse(false);
+    return ret;
+}
+
 int main(int argc, char* argv[])
 try
 {
@@ -1231,6 +2568,12 @@ try
     Arguments   arg;
     std::string function;
     std::string precision;
+    std::string sizem;
+    std::string sizen;
+    std::string sizek;
+    std::string batch_count;
+    std::string transposeA;
+    std::string transposeB;
     std::string a_type;
     std::string b_type;
     std::string c_type;
@@ -1239,15 +2582,38 @@ try
     std::string initialization;
     std::string arithmetic_check;
     std::string filter;
+    std::string tuning_db;
     rocblas_int device_id;
     rocblas_int parallel_devices;
     int         flags               = 0;
     int         geam_ex_op          = 0;
     bool        datafile            = rocblas_parse_data(argc, argv);
     bool        atomics_not_allowed = false;
+    bool        reproducible        = false;
+    bool        compensated         = false;
+    rocblas_int trsm_refinement     = 0;
+    bool        managed_prefetch    = false;
     bool        log_function_name   = false;
     bool        log_datatype        = false;
     bool        any_stride          = false;
+    bool        flush               = false;
+    size_t      flush_mb            = 512;
+    bool        stats               = false;
+    std::string stats_csv;
+    bool        pinned              = false;
+    bool        transfer_time       = false;
+    bool        concurrent          = false;
+    rocblas_int streams             = 0;
+    std::string performance_metric;
+    std::string backend;
+    bool        roofline            = false;
+    bool        power               = false;
+    bool        clock_guard         = false;
+    rocblas_int clock_guard_retries = 3;
+    double      peak_gflops         = 0;
+    double      peak_gbps           = 0;
+    std::string json;
+    std::string counters;
 
     arg.init(); // set all defaults
 
@@ -1255,19 +2621,21 @@ try
     desc.add_options()
         // clang-format off
         ("sizem,m",
-         value<rocblas_int>(&arg.M)->default_value(128),
+         value<std::string>(&sizem)->default_value("128"),
          "Specific matrix size: sizem is only applicable to BLAS-2 & BLAS-3: the number of "
-         "rows or columns in matrix.")
+         "rows or columns in matrix. Or a sweep of sizes run in one process: a comma separated "
+         "list of sizes and start:end:step ranges, the step being +S or S to add S, or xF to "
+         "multiply by F, e.g. 128:16384:x2")
 
         ("sizen,n",
-         value<rocblas_int>(&arg.N)->default_value(128),
+         value<std::string>(&sizen)->default_value("128"),
          "Specific matrix/vector size: BLAS-1: the length of the vector. BLAS-2 & "
-         "BLAS-3: the number of rows or columns in matrix")
+         "BLAS-3: the number of rows or columns in matrix. Or a sweep of sizes as for -m")
 
         ("sizek,k",
-         value<rocblas_int>(&arg.K)->default_value(128),
+         value<std::string>(&sizek)->default_value("128"),
          "Specific matrix size: BLAS-2: the number of sub or super-diagonals of A. BLAS-3: "
-         "the number of columns in A and rows in B.")
+         "the number of columns in A and rows in B. Or a sweep of sizes as for -m")
 
         ("kl",
          value<rocblas_int>(&arg.KL)->default_value(32),
@@ -1341,6 +2709,10 @@ try
          value<rocblas_int>(&arg.incb)->default_value(1),
          "increment between values in b vector")
 
+        ("incd",
+         value<rocblas_int>(&arg.incd)->default_value(1),
+         "increment between values in d vector, e.g. z of axpy_dot or w of waxpby")
+
         ("alpha",
           value<double>(&arg.alpha)->default_value(1.0), "specifies the scalar alpha")
 
@@ -1355,10 +2727,13 @@ try
 
         ("function,f",
          value<std::string>(&function),
-         "BLAS function to test.")
+         "BLAS function to test. handle_create times rocblas_create_handle and "
+         "rocblas_destroy_handle cycles instead, and ostream_throughput the logging of --iters "
+         "lines of -m characters per thread by an increasing number of threads.")
 
         ("precision,r",
-         value<std::string>(&precision)->default_value("f32_r"), "Precision. "
+         value<std::string>(&precision)->default_value("f32_r"), "Precision, or a comma "
+         "separated list of them to sweep. "
          "Options: h,s,d,c,z,f16_r,f32_r,f64_r,bf16_r,f32_c,f64_c,i8_r,i32_r")
 
         ("a_type",
@@ -1392,12 +2767,14 @@ try
          "Options: ieee16_ieee32, no_check")
 
         ("transposeA",
-         value<char>(&arg.transA)->default_value('N'),
-         "N = no transpose, T = transpose, C = conjugate transpose")
+         value<std::string>(&transposeA)->default_value("N"),
+         "N = no transpose, T = transpose, C = conjugate transpose, or a comma separated list "
+         "of them to sweep")
 
         ("transposeB",
-         value<char>(&arg.transB)->default_value('N'),
-         "N = no transpose, T = transpose, C = conjugate transpose")
+         value<std::string>(&transposeB)->default_value("N"),
+         "N = no transpose, T = transpose, C = conjugate transpose, or a comma separated list "
+         "of them to sweep")
 
         ("side",
          value<char>(&arg.side)->default_value('L'),
@@ -1412,13 +2789,26 @@ try
          "U = unit diagonal, N = non unit diagonal. Only applicable to certain routines") // xtrsm xtrsm_ex xtrsv xtrmm
 
         ("batch_count",
-         value<rocblas_int>(&arg.batch_count)->default_value(1),
-         "Number of matrices. Only applicable to batched and strided_batched routines")
+         value<std::string>(&batch_count)->default_value("1"),
+         "Number of matrices. Only applicable to batched and strided_batched routines. Or a "
+         "sweep of counts as for -m")
 
         ("HMM",
          value<bool>(&arg.HMM)->default_value(false),
          "Parameter requesting the use of HipManagedMemory")
 
+        ("pinned",
+         bool_switch(&pinned)->default_value(false),
+         "Stage the host to device and device to host transfers of the test data through two "
+         "pinned host buffers with asynchronous copies, and pin the host buffers of set/get "
+         "vector and matrix.")
+
+        ("transfer_time",
+         bool_switch(&transfer_time)->default_value(false),
+         "Also report the wall time and bandwidth of the host transfers of the test data, in the "
+         "transfer-us and transfer-GB/s columns, and the time of a call including them, in the "
+         "us+transfer column. The gemm inputs are then initialized on the host.")
+
         ("verify,v",
          value<int8_t>(&arg.norm_check)->default_value(0),
          "Validate GPU results with CPU? 0 = No, 1 = Yes (default: No)")
@@ -1441,16 +2831,36 @@ try
 
         ("geam_ex_op",
          value<int>(&geam_ex_op)->default_value(rocblas_geam_ex_operation_min_plus),
-         "geam_ex_operation, 0: min_plus operation, 1: plus_min operation")
+         "geam_ex_operation, 0: min_plus operation, 1: plus_min operation, 2: max_plus operation, "
+         "3: max_min operation")
 
         ("flags",
          value<int>(&flags)->default_value(rocblas_gemm_flags_none),
-         "gemm_ex flags, 1: Use packed-i8, 0: (default) uses unpacked-i8, available on matrix-inst-supported device")
+         "gemm_ex flags, 1: Use packed-i8, 0: (default) uses unpacked-i8, available on matrix-inst-supported device, "
+         "16: split k, 32: complex 3M method, 64: fp64 emulation")
 
         ("atomics_not_allowed",
          bool_switch(&atomics_not_allowed)->default_value(false),
          "Atomic operations with non-determinism in results are not allowed")
 
+        ("reproducible",
+         bool_switch(&reproducible)->default_value(false),
+         "Run dot, asum, nrm2 and gemv in reproducible mode, whose results are bitwise identical on all devices")
+
+        ("compensated",
+         bool_switch(&compensated)->default_value(false),
+         "Run dot, asum and nrm2 in compensated summation mode")
+
+        ("trsm_refinement",
+         value<rocblas_int>(&trsm_refinement)->default_value(0),
+         "Solve double precision trsm_ex in single precision with at most this many "
+         "iterative refinement steps, 0 to disable")
+
+        ("managed_prefetch",
+         bool_switch(&managed_prefetch)->default_value(false),
+         "Prefetch the managed memory operands of the gemm functions to the device, "
+         "see --HMM")
+
         ("device",
          value<rocblas_int>(&device_id)->default_value(0),
          "Set default device to be used for subsequent program runs")
@@ -1479,10 +2889,103 @@ try
          bool_switch(&log_datatype)->default_value(false),
          "Include datatypes used in output.")
 
+        ("flush",
+         bool_switch(&flush)->default_value(false),
+         "Also time the hot calls with the L2 and MALL caches flushed before each call, "
+         "reported in the flushed- columns.")
+
+        ("flush_mb",
+         value<size_t>(&flush_mb)->default_value(512),
+         "Size in MiB of the scrub buffer written to flush the caches when --flush is set.")
+
+        ("stats",
+         bool_switch(&stats)->default_value(false),
+         "Also time each hot call with events on the handle stream and report the min, median, "
+         "p90, p99 and standard deviation of the iteration times.")
+
+        ("stats_csv",
+         value<std::string>(&stats_csv),
+         "Write the iteration times of each benchmark to this CSV file, after its arguments. "
+         "Implies --stats.")
+
+        ("concurrent",
+         bool_switch(&concurrent)->default_value(false),
+         "With --yaml, run the problems concurrently: those with the same device_id and "
+         "stream_id in order on one stream, and report the latency and throughput of each "
+         "stream and their aggregate.")
+
+        ("streams",
+         value<rocblas_int>(&streams)->default_value(0),
+         "Run the problem concurrently with this many handles on as many streams of the device, "
+         "and report the latency and throughput of each stream and their aggregate.")
+
+        ("performance_metric",
+         value<std::string>(&performance_metric),
+         "Performance metric of the handles for Tensile solution selection: default, "
+         "device_efficiency, cu_efficiency, latency, energy_efficiency, or all to run --streams "
+         "with each of them.")
+
+        ("backend",
+         value<std::string>(&backend)->default_value("default"),
+         "GEMM backend of the handles: default, tensile or source, a comma separated list of "
+         "them, or all. With more than one, each problem is run with each backend, with the "
+         "same timing, and reported with the backend and the relative error norm against the "
+         "CPU reference, to compare them.")
+
+        ("roofline",
+         bool_switch(&roofline)->default_value(false),
+         "Report the arithmetic intensity and the percentages of the peak Gflops, the peak GB/s "
+         "and the roofline achieved, for functions with flop and byte counts.")
+
+        ("power",
+         bool_switch(&power)->default_value(false),
+         "Report the average power of the device in watts while the hot calls run, the energy "
+         "of each call in joules and the Gflops per watt, where the driver reports the power. "
+         "Use enough --iters for the calls to run for several milliseconds.")
+
+        ("clock_guard",
+         bool_switch(&clock_guard)->default_value(false),
+         "Repeat the calls before timing them until the shader clock of the device is stable, "
+         "and time them again while the clock drops more than 5% during them. The stable and "
+         "lowest clocks, the highest temperature and whether the timing reported was throttled "
+         "are added to the output, where the driver reports the clock.")
+
+        ("clock_guard_retries",
+         value<rocblas_int>(&clock_guard_retries)->default_value(3),
+         "Number of times throttled timings are discarded and taken again with --clock_guard.")
+
+        ("peak_gflops",
+         value<double>(&peak_gflops)->default_value(0),
+         "Peak Gflops for --roofline, e.g. of the matrix cores for the precision benchmarked. "
+         "Defaults to the FP32 vector peak estimated from the device properties.")
+
+        ("peak_gbps",
+         value<double>(&peak_gbps)->default_value(0),
+         "Peak memory bandwidth in GB/s for --roofline. Defaults to the peak estimated from the "
+         "memory clock and bus width of the device.")
+
+        ("counters",
+         value<std::string>(&counters),
+         "Collect these hardware counters, a comma separated list of rocprofiler counter names "
+         "or default, while the hot calls are run once more after their timing, and report "
+         "the name, calls, time and counters of each of their kernels, with the bandwidth of "
+         "its FETCH_SIZE and WRITE_SIZE. The default counters are "s
+             + rocblas_default_counters
+             + ". Requires rocblas-bench built with BUILD_CLIENTS_WITH_ROCPROFILER.")
+
+        ("json",
+         value<std::string>(&json),
+         "Also write the results to this file as a JSON array of objects with the function, "
+         "datatypes, arguments and metrics of each benchmark")
+
         ("function_filter",
          value<std::string>(&filter),
          "Simple strstr filter on function name only without wildcards")
 
+        ("tune",
+         value<std::string>(&tuning_db),
+         "Time every gemm_ex solution and record the fastest in this tuning database file")
+
         ("help,h", "produces this help message")
 
         ("version", "Prints the version number");
@@ -1545,6 +3048,17 @@ try
 
     ArgumentModel_set_log_datatype(log_datatype);
 
+    rocblas_set_cache_flush_bytes(flush ? flush_mb << 20 : 0);
+
+    ArgumentModel_set_log_stats(stats || !stats_csv.empty());
+    ArgumentModel_set_stats_csv(stats_csv);
+
+    host_set_pinned_transfers(pinned);
+    ArgumentModel_set_log_transfers(transfer_time);
+    ArgumentModel_set_log_power(power);
+    ArgumentModel_set_clock_guard(clock_guard, clock_guard_retries);
+    ArgumentModel_set_json(json);
+
     // Device Query
     rocblas_int device_count = query_device_property();
 
@@ -1554,37 +3068,72 @@ try
     if(device_id >= 0)
         set_device(device_id);
 
-    if(datafile)
-        return rocblas_bench_datafile(filter, any_stride);
-
-    // single bench run
-
-    // validate arguments
-
-    std::transform(precision.begin(), precision.end(), precision.begin(), ::tolower);
-    auto prec = string2rocblas_datatype(precision);
-    if(prec == rocblas_datatype_invalid)
-        throw std::invalid_argument("Invalid value for --precision " + precision);
-
-    arg.a_type = a_type == "" ? prec : string2rocblas_datatype(a_type);
-    if(arg.a_type == rocblas_datatype_invalid)
-        throw std::invalid_argument("Invalid value for --a_type " + a_type);
+    std::vector<rocblas_performance_metric> metrics;
+    if(performance_metric.empty() || performance_metric == "default")
+        metrics = {rocblas_default_performance_metric};
+    else if(performance_metric == "device_efficiency")
+        metrics = {rocblas_device_efficiency_performance_metric};
+    else if(performance_metric == "cu_efficiency")
+        metrics = {rocblas_cu_efficiency_performance_metric};
+    else if(performance_metric == "latency")
+        metrics = {rocblas_latency_performance_metric};
+    else if(performance_metric == "energy_efficiency")
+        metrics = {rocblas_energy_efficiency_performance_metric};
+    else if(performance_metric == "all" && streams > 0)
+        metrics = {rocblas_default_performance_metric,
+                   rocblas_device_efficiency_performance_metric,
+                   rocblas_cu_efficiency_performance_metric,
+                   rocblas_latency_performance_metric,
+                   rocblas_energy_efficiency_performance_metric};
+    else
+        throw std::invalid_argument("Invalid value for --performance_metric " + performance_metric);
+
+    if(streams <= 0)
+        rocblas_set_local_handle_performance_metric(metrics[0]);
+
+    bench_backends = parse_backends(backend);
+    if(bench_backends.size() == 1)
+        rocblas_set_local_handle_gemm_backend(bench_backends[0]);
+    else if(!tuning_db.empty() || streams > 0 || parallel_devices
+            || !strcmp(arg.function, "handle_create")
+            || !strcmp(arg.function, "ostream_throughput"))
+        throw std::invalid_argument("Comparing backends is not supported with --tune, --streams, "
+                                    "--parallel_devices, handle_create or ostream_throughput");
+
+    rocblas_set_local_handle_reproducible_mode(reproducible);
+    rocblas_set_local_handle_compensated_summation_mode(compensated);
+    rocblas_set_local_handle_trsm_refinement(trsm_refinement);
+    rocblas_set_local_handle_managed_prefetch(managed_prefetch);
+
+    if(roofline)
+    {
+        double device_gflops = 0, device_gbps = 0;
+        if(!query_device_peaks(std::max(device_id, 0), device_gflops, device_gbps)
+           && (peak_gflops <= 0 || peak_gbps <= 0))
+            rocblas_cerr << "Cannot query the device peaks, set --peak_gflops and --peak_gbps"
+                         << std::endl;
+        ArgumentModel_set_roofline_peaks(peak_gflops > 0 ? peak_gflops : device_gflops,
+                                         peak_gbps > 0 ? peak_gbps : device_gbps);
+    }
 
-    arg.b_type = b_type == "" ? prec : string2rocblas_datatype(b_type);
-    if(arg.b_type == rocblas_datatype_invalid)
-        throw std::invalid_argument("Invalid value for --b_type " + b_type);
+    if(!counters.empty())
+    {
+        if(!rocblas_counters_available())
+            throw std::invalid_argument(
+                "--counters requires rocblas-bench built with BUILD_CLIENTS_WITH_ROCPROFILER");
+        if(concurrent || streams > 0 || parallel_devices)
+            throw std::invalid_argument(
+                "--counters is not supported with --concurrent, --streams or --parallel_devices");
+        rocblas_set_counters(counters == "default" ? rocblas_default_counters : counters);
+    }
 
-    arg.c_type = c_type == "" ? prec : string2rocblas_datatype(c_type);
-    if(arg.c_type == rocblas_datatype_invalid)
-        throw std::invalid_argument("Invalid value for --c_type " + c_type);
+    if(datafile)
+        return concurrent ? rocblas_bench_concurrent(filter, any_stride)
+                          : rocblas_bench_datafile(filter, any_stride);
 
-    arg.d_type = d_type == "" ? prec : string2rocblas_datatype(d_type);
-    if(arg.d_type == rocblas_datatype_invalid)
-        throw std::invalid_argument("Invalid value for --d_type " + d_type);
+    // single bench run, or sweep
 
-    arg.compute_type = compute_type == "" ? prec : string2rocblas_datatype(compute_type);
-    if(arg.compute_type == rocblas_datatype_invalid)
-        throw std::invalid_argument("Invalid value for --compute_type " + compute_type);
+    // validate arguments
 
     arg.initialization = string2rocblas_initialization(initialization);
     if(arg.initialization == static_cast<rocblas_initialization>(0)) // zero not in enum
@@ -1594,19 +3143,98 @@ try
     if(arg.arithmetic_check == static_cast<rocblas_arithmetic_check>(0)) // zero not in enum
         throw std::invalid_argument("Invalid value for --arithmetic_check " + arithmetic_check);
 
-    if(arg.M < 0)
-        throw std::invalid_argument("Invalid value for -m " + std::to_string(arg.M));
-    if(arg.N < 0)
-        throw std::invalid_argument("Invalid value for -n " + std::to_string(arg.N));
-    if(arg.K < 0)
-        throw std::invalid_argument("Invalid value for -k " + std::to_string(arg.K));
-
     int copied = snprintf(arg.function, sizeof(arg.function), "%s", function.c_str());
     if(copied <= 0 || copied >= sizeof(arg.function))
         throw std::invalid_argument("Invalid value for --function");
 
+    // arguments of each swept precision
+    std::vector<Arguments> precisions;
+    std::transform(precision.begin(), precision.end(), precision.begin(), ::tolower);
+    std::istringstream precision_list(precision);
+    for(std::string item; std::getline(precision_list, item, ',');)
+    {
+        auto prec = string2rocblas_datatype(item);
+        if(prec == rocblas_datatype_invalid)
+            throw std::invalid_argument("Invalid value for --precision " + precision);
+
+        arg.a_type = a_type == "" ? prec : string2rocblas_datatype(a_type);
+        if(arg.a_type == rocblas_datatype_invalid)
+            throw std::invalid_argument("Invalid value for --a_type " + a_type);
+
+        arg.b_type = b_type == "" ? prec : string2rocblas_datatype(b_type);
+        if(arg.b_type == rocblas_datatype_invalid)
+            throw std::invalid_argument("Invalid value for --b_type " + b_type);
+
+        arg.c_type = c_type == "" ? prec : string2rocblas_datatype(c_type);
+        if(arg.c_type == rocblas_datatype_invalid)
+            throw std::invalid_argument("Invalid value for --c_type " + c_type);
+
+        arg.d_type = d_type == "" ? prec : string2rocblas_datatype(d_type);
+        if(arg.d_type == rocblas_datatype_invalid)
+            throw std::invalid_argument("Invalid value for --d_type " + d_type);
+
+        arg.compute_type = compute_type == "" ? prec : string2rocblas_datatype(compute_type);
+        if(arg.compute_type == rocblas_datatype_invalid)
+            throw std::invalid_argument("Invalid value for --compute_type " + compute_type);
+
+        precisions.push_back(arg);
+    }
+    if(precisions.empty())
+        throw std::invalid_argument("Invalid value for --precision " + precision);
+
+    auto ms           = parse_sweep(sizem, "-m");
+    auto ns           = parse_sweep(sizen, "-n");
+    auto ks           = parse_sweep(sizek, "-k");
+    auto batch_counts = parse_sweep(batch_count, "--batch_count");
+    auto transAs      = parse_sweep_transposes(transposeA, "--transposeA");
+    auto transBs      = parse_sweep_transposes(transposeB, "--transposeB");
+
+    if(precisions.size() * transAs.size() * transBs.size() * batch_counts.size() * ms.size()
+           * ns.size() * ks.size()
+       > 1)
+    {
+        if(!tuning_db.empty() || streams > 0 || parallel_devices
+           || !strcmp(arg.function, "handle_create")
+           || !strcmp(arg.function, "ostream_throughput"))
+            throw std::invalid_argument("Sweeps are not supported with --tune, --streams, "
+                                        "--parallel_devices, handle_create or ostream_throughput");
+
+        return rocblas_bench_sweep(precisions,
+                                   transAs,
+                                   transBs,
+                                   batch_counts,
+                                   ms,
+                                   ns,
+                                   ks,
+                                   sweep_defaults(vm),
+                                   filter,
+                                   any_stride);
+    }
+
+    arg             = precisions[0];
+    arg.transA      = transAs[0];
+    arg.transB      = transBs[0];
+    arg.batch_count = batch_counts[0];
+    arg.M           = ms[0];
+    arg.N           = ns[0];
+    arg.K           = ks[0];
+
+#if BUILD_WITH_TENSILE
+    if(!tuning_db.empty())
+        return rocblas_bench_tune_gemm_ex(arg, tuning_db);
+#endif
+
+    if(!strcmp(arg.function, "handle_create"))
+        return rocblas_bench_handle_create(arg);
+
+    if(!strcmp(arg.function, "ostream_throughput"))
+        return rocblas_bench_ostream_throughput(arg);
+
+    if(streams > 0)
+        return rocblas_bench_multi_stream(streams, metrics, arg, filter, any_stride);
+
     if(!parallel_devices)
-        return run_bench_test(true, arg, filter, any_stride);
+        return run_bench_backends(arg, filter, any_stride);
     else
         return run_bench_gpu_test(parallel_devices, arg, filter, any_stride);
 }
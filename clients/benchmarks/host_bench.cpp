@@ -0,0 +1,385 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// rocblas-host-bench measures the host cost of a call of every public rocBLAS function: the
+// argument checks, the logging mode checks, the handle state and the workspace setup. The calls
+// are made with zero sizes, which return after the argument checks, and with tiny sizes, which
+// launch their kernels unless the handle is in the device memory size query state. The time of
+// the calls is measured on the host, and the kernels are waited for outside of it.
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "program_options.hpp"
+#include "rocblas.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace roc; // For emulated program_options
+
+namespace
+{
+    constexpr int HOST_BENCH_REGIONS = 7;
+
+    // Arguments of the benchmarked calls, which host_bench_gen.py binds by name and type
+    struct host_bench_state
+    {
+        rocblas_handle handle      = nullptr;
+        rocblas_int    n           = 0;
+        rocblas_int    ld          = 1;
+        rocblas_int    batch_count = 1;
+        rocblas_stride stride      = 0;
+        uint32_t       gemm_flags  = 0;
+
+        // scalars and the array of pointers to them, in host or device memory as the pointer mode
+        void* scalars       = nullptr;
+        void* scalar_arrays = nullptr;
+
+        // device data of the vector and matrix arguments, and device arrays of pointers to it
+        void* data[HOST_BENCH_REGIONS]   = {};
+        void* arrays[HOST_BENCH_REGIONS] = {};
+
+        mutable size_t workspace_bytes = 0;
+    };
+
+    struct host_bench_call
+    {
+        const char* name;
+        rocblas_status (*call)(const host_bench_state& s);
+    };
+
+#include "host_bench_calls.hpp"
+
+    void check_hip(hipError_t err)
+    {
+        if(err != hipSuccess)
+            throw std::runtime_error(std::string("HIP error: ") + hipGetErrorString(err));
+    }
+
+    void check_rocblas(rocblas_status status)
+    {
+        if(status != rocblas_status_success)
+            throw std::runtime_error(std::string("rocBLAS error: ")
+                                     + rocblas_status_to_string(status));
+    }
+
+    // Handle states the calls are benchmarked in
+    enum class host_bench_handle_state
+    {
+        default_state,
+        size_query,
+        atomics_not_allowed,
+        graph_safe,
+    };
+
+    const char* const handle_state_names[]
+        = {"default", "size_query", "atomics_not_allowed", "graph_safe"};
+
+    void enter_state(rocblas_handle handle, host_bench_handle_state state)
+    {
+        switch(state)
+        {
+        case host_bench_handle_state::default_state:
+            break;
+        case host_bench_handle_state::size_query:
+            check_rocblas(rocblas_start_device_memory_size_query(handle));
+            break;
+        case host_bench_handle_state::atomics_not_allowed:
+            check_rocblas(rocblas_set_atomics_mode(handle, rocblas_atomics_not_allowed));
+            break;
+        case host_bench_handle_state::graph_safe:
+            check_rocblas(rocblas_set_graph_safe_mode(handle, true));
+            break;
+        }
+    }
+
+    void leave_state(rocblas_handle handle, host_bench_handle_state state)
+    {
+        switch(state)
+        {
+        case host_bench_handle_state::default_state:
+            break;
+        case host_bench_handle_state::size_query:
+        {
+            size_t size;
+            check_rocblas(rocblas_stop_device_memory_size_query(handle, &size));
+            break;
+        }
+        case host_bench_handle_state::atomics_not_allowed:
+            check_rocblas(rocblas_set_atomics_mode(handle, rocblas_atomics_allowed));
+            break;
+        case host_bench_handle_state::graph_safe:
+            check_rocblas(rocblas_set_graph_safe_mode(handle, false));
+            break;
+        }
+    }
+
+    std::vector<std::string> split_list(const std::string& list)
+    {
+        std::vector<std::string> items;
+        std::istringstream       is(list);
+        for(std::string item; std::getline(is, item, ',');)
+            items.push_back(item);
+        return items;
+    }
+
+    // Device memory of the tiny problems, with the host and device scalars, all set to one
+    class host_bench_memory
+    {
+        std::vector<void*> m_device;
+        std::vector<float> m_host_scalars;
+        void*              m_host_scalar_array   = nullptr;
+        void*              m_device_scalars      = nullptr;
+        void*              m_device_scalar_array = nullptr;
+        void*              m_data[HOST_BENCH_REGIONS];
+        void*              m_arrays[HOST_BENCH_REGIONS];
+
+        void* device_ones(size_t bytes)
+        {
+            void* ptr;
+            check_hip(hipMalloc(&ptr, bytes));
+            m_device.push_back(ptr);
+            std::vector<float> ones(bytes / sizeof(float), 1.0f);
+            check_hip(hipMemcpy(ptr, ones.data(), bytes, hipMemcpyHostToDevice));
+            return ptr;
+        }
+
+        void* device_pointer_array(void* target)
+        {
+            void* ptr;
+            check_hip(hipMalloc(&ptr, sizeof(void*)));
+            m_device.push_back(ptr);
+            check_hip(hipMemcpy(ptr, &target, sizeof(void*), hipMemcpyHostToDevice));
+            return ptr;
+        }
+
+    public:
+        static constexpr size_t scalar_count = 64;
+
+        explicit host_bench_memory(rocblas_int ld)
+            : m_host_scalars(scalar_count, 1.0f)
+        {
+            // room for an ld x ld complex double matrix in each region
+            size_t region_bytes = ((size_t(ld) * ld * 16 + 255) / 256) * 256;
+
+            m_host_scalar_array   = m_host_scalars.data();
+            m_device_scalars      = device_ones(scalar_count * sizeof(float));
+            m_device_scalar_array = device_pointer_array(m_device_scalars);
+            for(int i = 0; i < HOST_BENCH_REGIONS; i++)
+            {
+                m_data[i]   = device_ones(region_bytes);
+                m_arrays[i] = device_pointer_array(m_data[i]);
+            }
+        }
+
+        ~host_bench_memory()
+        {
+            for(void* ptr : m_device)
+                (void)hipFree(ptr);
+        }
+
+        host_bench_memory(const host_bench_memory&) = delete;
+        host_bench_memory& operator=(const host_bench_memory&) = delete;
+
+        void bind(host_bench_state& s, rocblas_pointer_mode mode)
+        {
+            bool host = mode == rocblas_pointer_mode_host;
+
+            // the scalars may have been overwritten by results
+            std::fill(m_host_scalars.begin(), m_host_scalars.end(), 1.0f);
+            check_hip(hipMemcpy(m_device_scalars,
+                                m_host_scalars.data(),
+                                scalar_count * sizeof(float),
+                                hipMemcpyHostToDevice));
+
+            s.scalars       = host ? m_host_scalars.data() : m_device_scalars;
+            s.scalar_arrays = host ? &m_host_scalar_array : m_device_scalar_array;
+            std::copy(m_data, m_data + HOST_BENCH_REGIONS, s.data);
+            std::copy(m_arrays, m_arrays + HOST_BENCH_REGIONS, s.arrays);
+        }
+    };
+}
+
+int main(int argc, char* argv[])
+try
+{
+    std::string filter;
+    std::string pointer_modes;
+    std::string handle_states;
+    rocblas_int size;
+    rocblas_int iters;
+    rocblas_int cold_iters;
+    rocblas_int device_id;
+
+    options_description desc("rocblas-host-bench command line options");
+    desc.add_options()
+        // clang-format off
+        ("function_filter",
+         value<std::string>(&filter),
+         "Simple strstr filter on function name only without wildcards")
+
+        ("size",
+         value<rocblas_int>(&size)->default_value(1),
+         "Sizes of the tiny problems. The zero sized problems are always benchmarked as well.")
+
+        ("iters,i",
+         value<rocblas_int>(&iters)->default_value(1000),
+         "Calls timed per function, pointer mode, handle state and size")
+
+        ("cold_iters,j",
+         value<rocblas_int>(&cold_iters)->default_value(10),
+         "Untimed calls before the timed ones")
+
+        ("pointer_mode",
+         value<std::string>(&pointer_modes)->default_value("host,device"),
+         "Comma separated list of the pointer modes: host, device")
+
+        ("handle_state",
+         value<std::string>(&handle_states)->default_value("default,size_query,atomics_not_allowed,graph_safe"),
+         "Comma separated list of the handle states: default, size_query (no kernels are "
+         "launched), atomics_not_allowed, graph_safe")
+
+        ("device",
+         value<rocblas_int>(&device_id)->default_value(0),
+         "Set default device to be used for subsequent program runs")
+
+        ("list", "List the benchmarked functions, and the public functions left out")
+
+        ("help,h", "produces this help message");
+    // clang-format on
+
+    variables_map vm;
+    store(parse_command_line(argc, argv, desc), vm);
+    notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    if(vm.count("list"))
+    {
+        for(const auto& call : host_bench_calls)
+            std::cout << call.name << std::endl;
+        for(const char* const* name = host_bench_skipped; *name; ++name)
+            std::cout << *name << " (not benchmarked)" << std::endl;
+        return 0;
+    }
+
+    if(size < 1)
+        throw std::invalid_argument("Invalid value for --size " + std::to_string(size));
+    if(iters < 1)
+        throw std::invalid_argument("Invalid value for --iters " + std::to_string(iters));
+
+    std::vector<rocblas_pointer_mode> modes;
+    for(const auto& mode : split_list(pointer_modes))
+    {
+        if(mode == "host")
+            modes.push_back(rocblas_pointer_mode_host);
+        else if(mode == "device")
+            modes.push_back(rocblas_pointer_mode_device);
+        else
+            throw std::invalid_argument("Invalid value for --pointer_mode " + mode);
+    }
+
+    std::vector<host_bench_handle_state> states;
+    for(const auto& state : split_list(handle_states))
+    {
+        auto name = std::find_if(std::begin(handle_state_names),
+                                 std::end(handle_state_names),
+                                 [&](const char* name) { return state == name; });
+        if(name == std::end(handle_state_names))
+            throw std::invalid_argument("Invalid value for --handle_state " + state);
+        states.push_back(host_bench_handle_state(name - std::begin(handle_state_names)));
+    }
+
+    check_hip(hipSetDevice(device_id));
+
+    host_bench_state s;
+    check_rocblas(rocblas_create_handle(&s.handle));
+
+    // the banded functions need ld >= kl + ku + 1 with kl = ku = size
+    host_bench_memory memory(2 * size + 1);
+
+    hipStream_t stream;
+    check_rocblas(rocblas_get_stream(s.handle, &stream));
+
+    std::cout << "function,pointer_mode,handle_state,size,status,ns/call" << std::endl;
+
+    for(const auto& call : host_bench_calls)
+    {
+        if(!filter.empty() && !strstr(call.name, filter.c_str()))
+            continue;
+
+        for(auto mode : modes)
+        {
+            check_rocblas(rocblas_set_pointer_mode(s.handle, mode));
+            memory.bind(s, mode);
+
+            for(auto state : states)
+            {
+                for(rocblas_int n : {0, size})
+                {
+                    s.n      = n;
+                    s.ld     = 2 * n + 1;
+                    s.stride = rocblas_stride(s.ld) * s.ld;
+
+                    enter_state(s.handle, state);
+
+                    rocblas_status status = rocblas_status_success;
+                    for(rocblas_int i = 0; i < cold_iters; i++)
+                        status = call.call(s);
+                    check_hip(hipStreamSynchronize(stream));
+
+                    auto start = std::chrono::steady_clock::now();
+                    for(rocblas_int i = 0; i < iters; i++)
+                        status = call.call(s);
+                    std::chrono::duration<double, std::nano> ns
+                        = std::chrono::steady_clock::now() - start;
+
+                    check_hip(hipStreamSynchronize(stream));
+                    leave_state(s.handle, state);
+
+                    std::cout << call.name << ","
+                              << (mode == rocblas_pointer_mode_host ? "host" : "device") << ","
+                              << handle_state_names[int(state)] << "," << n << ","
+                              << rocblas_status_to_string(status) << "," << ns.count() / iters
+                              << std::endl;
+                }
+            }
+        }
+    }
+
+    check_rocblas(rocblas_destroy_handle(s.handle));
+    return 0;
+}
+catch(const std::exception& exp)
+{
+    std::cerr << exp.what() << std::endl;
+    return -1;
+}
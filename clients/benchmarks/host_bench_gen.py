@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+
+"""Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+   ies of the Software, and to permit persons to whom the Software is furnished
+   to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+   PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+   CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+Generate the calls of rocblas-host-bench from the public rocBLAS headers.
+
+Every BLAS function is called once per function family, in single precision,
+or single complex precision for the complex only families, and every _ex
+function is called with f32_r datatypes. The arguments are bound by their
+names and types to the members of host_bench_state; functions with arguments
+which cannot be bound are listed and left out."""
+
+import argparse
+import re
+import sys
+
+# Data arguments and the host_bench_state region they point to
+REGIONS = {'x': 0, 'X': 0, 'y': 1, 'Y': 1, 'A': 2, 'AP': 2, 'a': 2, 'B': 3, 'b': 3,
+           'C': 4, 'c': 4, 'D': 5, 'd': 5, 'invA': 5, 'z': 6, 'w': 6, 'ARF': 6}
+
+# Scalar arguments, which follow the pointer mode
+SCALARS = {'alpha', 'beta', 'gamma', 'delta', 'result', 'results', 'dot_result', 'nrm2_result',
+           'param', 'd1', 'd2', 'x1', 'y1'}
+
+# The a, b, c and s arguments of the rotations are scalars rather than data
+ROTATION_SCALARS = {'a', 'b', 'c', 's'}
+
+ENUMS = {
+    'rocblas_operation': 'rocblas_operation_none',
+    'rocblas_fill': 'rocblas_fill_upper',
+    'rocblas_diagonal': 'rocblas_diagonal_non_unit',
+    'rocblas_side': 'rocblas_side_left',
+    'rocblas_datatype': 'rocblas_datatype_f32_r',
+    'rocblas_gemm_algo': 'rocblas_gemm_algo_standard',
+    'rocblas_geam_ex_operation': 'rocblas_geam_ex_operation_min_plus',
+}
+
+INTEGERS = {'rocblas_int', 'int64_t', 'int32_t', 'int', 'rocblas_stride', 'uint32_t'}
+
+PARAM_RE = re.compile(r'(?P<type>.*?)(?P<name>\w+)\s*(?P<array>\[\])?$')
+
+
+def parse_prototypes(paths):
+    text = ''
+    for path in paths:
+        with open(path) as f:
+            text += f.read()
+    text = re.sub(r'//[^\n]*', '', text)
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    protos = {}
+    for name, params in re.findall(
+            r'ROCBLAS_EXPORT\s+rocblas_status\s+(rocblas_\w+)\s*\(([^;{]*?)\)\s*;', text, re.S):
+        args = []
+        for param in params.split(','):
+            m = PARAM_RE.match(' '.join(param.split()))
+            if not m:
+                args = None
+                break
+            args.append((m.group('type').strip() + ('*' if m.group('array') else ''),
+                         m.group('name')))
+        if args:
+            protos[name] = args
+    return protos
+
+
+def select(protos):
+    """One function per family: single precision, or single complex for the complex only
+    families, and the _ex functions taking a handle"""
+    selected = []
+    for name in sorted(protos):
+        base = name[len('rocblas_'):]
+        prefix = 'i' if base.startswith('is') and base[1:2] == 's' else ''
+        rest = base[len(prefix):]
+        if rest.startswith('s') and 'rocblas_' + prefix + 'd' + rest[1:] in protos:
+            selected.append(name)
+        elif (rest.startswith('c') and 'rocblas_' + prefix + 'z' + rest[1:] in protos
+              and 'rocblas_' + prefix + 's' + rest[1:] not in protos):
+            selected.append(name)
+        elif base.endswith('_ex') and protos[name][0][0] == 'rocblas_handle':
+            selected.append(name)
+    return selected
+
+
+def bind(fname, ptype, pname):
+    """C++ expression for an argument, or None if it cannot be bound"""
+    base = ptype.replace('const', '').replace('*', '').strip()
+    pointers = ptype.count('*')
+    batched_ex = fname.endswith('_ex') and 'batched' in fname and 'strided' not in fname
+
+    if ptype == 'rocblas_handle':
+        return 's.handle'
+    if ptype in ENUMS:
+        return ENUMS[ptype]
+    if ptype in INTEGERS:
+        if pname in ('n', 'm', 'k', 'kl', 'ku'):
+            return 's.n'
+        if pname.startswith('ld'):
+            return 's.ld'
+        if pname.startswith('inc'):
+            return '1'
+        if pname == 'batch_count':
+            return 's.batch_count'
+        if pname.startswith('stride'):
+            return 's.stride'
+        if pname.startswith('offset') or pname in ('solution_index', 'invA_size'):
+            return '0'
+        if pname == 'flags':
+            return 's.gemm_flags'
+        return None
+    if ptype == 'size_t*' and pname == 'size':
+        return '&s.workspace_bytes'
+    if pname == 'invA' and 'trsm' in fname:
+        return 'nullptr'
+    if pointers == 0 or base not in ('float', 'rocblas_float_complex', 'void', 'rocblas_int'):
+        return None
+
+    scalar = pname in SCALARS or ('rot' in fname and pname in ROTATION_SCALARS)
+    if base == 'rocblas_int' and pname not in ('result', 'results'):
+        return None
+    if scalar:
+        source = 's.scalar_arrays' if pointers > 1 or (batched_ex and pname not in
+                                                       ('alpha', 'beta')) else 's.scalars'
+    elif pname in REGIONS:
+        region = REGIONS[pname]
+        source = 's.arrays[%d]' % region if pointers > 1 or batched_ex else 's.data[%d]' % region
+    else:
+        return None
+    return '(%s)%s' % (ptype, source)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('headers', nargs='+')
+    parser.add_argument('-o', '--output', required=True)
+    args = parser.parse_args()
+
+    protos = parse_prototypes(args.headers)
+    calls, skipped = [], []
+    for name in select(protos):
+        bound = [bind(name, ptype, pname) for ptype, pname in protos[name]]
+        if None in bound:
+            skipped.append(name)
+            continue
+        calls.append('    {"%s",\n     [](const host_bench_state& s) {\n         return %s(%s);\n     }},\n'
+                     % (name, name, ',\n                '.join(bound)))
+
+    with open(args.output, 'w') as f:
+        f.write('// Generated by host_bench_gen.py from the rocBLAS headers\n\n')
+        f.write('static const host_bench_call host_bench_calls[] = {\n')
+        f.writelines(calls)
+        f.write('};\n\n')
+        f.write('static const char* const host_bench_skipped[] = {\n')
+        f.writelines('    "%s",\n' % name for name in skipped)
+        f.write('    nullptr};\n')
+
+
+if __name__ == '__main__':
+    main()
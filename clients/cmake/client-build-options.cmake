@@ -50,3 +50,8 @@ endif( )
 if( NOT BUILD_CLIENTS_BENCHMARKS )
   option( BUILD_CLIENTS_BENCHMARKS "Build rocBLAS benchmarks" OFF )
 endif( )
+
+# Hardware counter collection of rocblas-bench --counters depends on the rocprofiler SDK
+if( NOT BUILD_CLIENTS_WITH_ROCPROFILER )
+  option( BUILD_CLIENTS_WITH_ROCPROFILER "Build rocblas-bench with hardware counters through the rocprofiler SDK" OFF )
+endif( )
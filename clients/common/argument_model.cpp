@@ -21,6 +21,13 @@
  * ************************************************************************ */
 
 #include "argument_model.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
 
 // this should have been a member variable but due to the complex variadic template this singleton allows global control
 
@@ -47,3 +54,427 @@ bool ArgumentModel_get_log_datatype()
 {
     return log_datatype;
 }
+
+static bool log_power = false;
+
+void ArgumentModel_set_log_power(bool p)
+{
+    log_power = p;
+}
+
+bool ArgumentModel_get_log_power()
+{
+    return log_power;
+}
+
+// thread local, as parallel_devices benchmarks log from a thread per device
+static thread_local double power_watts = ArgumentLogging::NA_value;
+
+void ArgumentModel_set_power_watts(double watts)
+{
+    power_watts = watts;
+}
+
+double ArgumentModel_take_power_watts()
+{
+    double watts = power_watts;
+    power_watts  = ArgumentLogging::NA_value;
+    return watts;
+}
+
+static bool clock_guard         = false;
+static int  clock_guard_retries = 0;
+
+void ArgumentModel_set_clock_guard(bool guard, int retries)
+{
+    clock_guard         = guard;
+    clock_guard_retries = retries;
+}
+
+bool ArgumentModel_get_clock_guard()
+{
+    return clock_guard;
+}
+
+int ArgumentModel_get_clock_guard_retries()
+{
+    return clock_guard_retries;
+}
+
+// thread local, as parallel_devices benchmarks log from a thread per device
+static thread_local bool   clock_sampled   = false;
+static thread_local double clock_mhz       = 0;
+static thread_local double clock_min_mhz   = 0;
+static thread_local double clock_celsius   = 0;
+static thread_local bool   clock_throttled = false;
+
+void ArgumentModel_set_clock_sample(double mhz, double min_mhz, double celsius, bool throttled)
+{
+    clock_sampled   = true;
+    clock_mhz       = mhz;
+    clock_min_mhz   = min_mhz;
+    clock_celsius   = celsius;
+    clock_throttled = throttled;
+}
+
+bool ArgumentModel_take_clock_sample(double& mhz,
+                                     double& min_mhz,
+                                     double& celsius,
+                                     bool&   throttled)
+{
+    if(!clock_sampled)
+        return false;
+
+    clock_sampled = false;
+    mhz           = clock_mhz;
+    min_mhz       = clock_min_mhz;
+    celsius       = clock_celsius;
+    throttled     = clock_throttled;
+    return true;
+}
+
+static std::string backend_name;
+
+void ArgumentModel_set_backend(const std::string& backend)
+{
+    backend_name = backend;
+}
+
+const std::string& ArgumentModel_get_backend()
+{
+    return backend_name;
+}
+
+static double peak_gflops = 0;
+static double peak_gbps   = 0;
+
+void ArgumentModel_set_roofline_peaks(double gflops, double gbps)
+{
+    peak_gflops = gflops;
+    peak_gbps   = gbps;
+}
+
+double ArgumentModel_get_peak_gflops()
+{
+    return peak_gflops;
+}
+
+double ArgumentModel_get_peak_gbps()
+{
+    return peak_gbps;
+}
+
+// thread local, as parallel_devices benchmarks log from a thread per device
+static thread_local double flushed_time_us = ArgumentLogging::NA_value;
+
+void ArgumentModel_set_flushed_time_us(double us)
+{
+    flushed_time_us = us;
+}
+
+double ArgumentModel_take_flushed_time_us()
+{
+    double us       = flushed_time_us;
+    flushed_time_us = ArgumentLogging::NA_value;
+    return us;
+}
+
+static bool log_transfers = false;
+
+void ArgumentModel_set_log_transfers(bool t)
+{
+    log_transfers = t;
+}
+
+bool ArgumentModel_get_log_transfers()
+{
+    return log_transfers;
+}
+
+static thread_local double transfer_time_us = 0;
+static thread_local double transfer_bytes   = 0;
+
+void ArgumentModel_add_transfer(double us, size_t bytes)
+{
+    transfer_time_us += us;
+    transfer_bytes += bytes;
+}
+
+void ArgumentModel_take_transfers(double& us, double& bytes)
+{
+    us               = transfer_time_us;
+    bytes            = transfer_bytes;
+    transfer_time_us = 0;
+    transfer_bytes   = 0;
+}
+
+static bool log_stats = false;
+
+void ArgumentModel_set_log_stats(bool s)
+{
+    log_stats = s;
+}
+
+bool ArgumentModel_get_log_stats()
+{
+    return log_stats;
+}
+
+static std::unique_ptr<rocblas_internal_ostream> stats_csv;
+static std::mutex                                stats_csv_mutex;
+
+void ArgumentModel_set_stats_csv(const std::string& filename)
+{
+    std::lock_guard<std::mutex> lock(stats_csv_mutex);
+    if(filename.empty())
+        stats_csv.reset();
+    else
+        stats_csv = std::make_unique<rocblas_internal_ostream>(filename);
+}
+
+static thread_local double logged_gflop  = 0;
+static thread_local double logged_gbyte  = 0;
+static thread_local double logged_gpu_us = 0;
+
+void ArgumentModel_reset_logged_work()
+{
+    logged_gflop  = 0;
+    logged_gbyte  = 0;
+    logged_gpu_us = 0;
+}
+
+void ArgumentModel_add_logged_work(double gflop, double gbyte, double gpu_us)
+{
+    logged_gflop += gflop;
+    logged_gbyte += gbyte;
+    logged_gpu_us += gpu_us;
+}
+
+void ArgumentModel_get_logged_work(double& gflop, double& gbyte, double& gpu_us)
+{
+    gflop  = logged_gflop;
+    gbyte  = logged_gbyte;
+    gpu_us = logged_gpu_us;
+}
+
+static thread_local std::vector<double> iteration_times_us;
+
+void ArgumentModel_set_iteration_times_us(std::vector<double>&& us)
+{
+    iteration_times_us = std::move(us);
+}
+
+std::vector<double> ArgumentModel_take_iteration_times_us()
+{
+    std::vector<double> us;
+    us.swap(iteration_times_us);
+    return us;
+}
+
+static thread_local std::vector<rocblas_kernel_counters> kernel_counters;
+
+void ArgumentModel_set_kernel_counters(std::vector<rocblas_kernel_counters>&& counters)
+{
+    kernel_counters = std::move(counters);
+}
+
+std::vector<rocblas_kernel_counters> ArgumentModel_take_kernel_counters()
+{
+    std::vector<rocblas_kernel_counters> counters;
+    counters.swap(kernel_counters);
+    return counters;
+}
+
+void ArgumentModel_log_kernel_counters(rocblas_internal_ostream&            name_line,
+                                       rocblas_internal_ostream&            val_line,
+                                       std::vector<rocblas_kernel_counters> counters,
+                                       int                                  hot_calls)
+{
+    // kernels are numbered in the order of their first dispatch in the hot calls
+    for(size_t i = 0; i < counters.size(); i++)
+    {
+        const rocblas_kernel_counters& k      = counters[i];
+        std::string                    prefix = ",k" + std::to_string(i) + "-";
+
+        name_line << prefix << "kernel" << prefix << "calls" << prefix << "us";
+        val_line << ", " << k.kernel << ", " << double(k.dispatches) / hot_calls << ", "
+                 << k.us / hot_calls;
+
+        for(auto& value : k.values)
+        {
+            name_line << prefix << value.first;
+            val_line << ", " << value.second / k.dispatches;
+        }
+
+        // FETCH_SIZE and WRITE_SIZE are in KB
+        auto fetch = k.values.find("FETCH_SIZE");
+        auto write = k.values.find("WRITE_SIZE");
+        if(fetch != k.values.end() && write != k.values.end() && k.us > 0)
+        {
+            name_line << prefix << "counted-GB/s";
+            val_line << ", " << (fetch->second + write->second) * 1024 / k.us * 1e-3;
+        }
+    }
+}
+
+void ArgumentModel_log_iteration_stats(rocblas_internal_ostream& name_line,
+                                       rocblas_internal_ostream& val_line,
+                                       const std::string&        arg_names,
+                                       const std::string&        arg_values,
+                                       std::vector<double>       us)
+{
+    if(us.empty())
+        return;
+
+    // raw samples in iteration order, before sorting
+    {
+        std::lock_guard<std::mutex> lock(stats_csv_mutex);
+        if(stats_csv)
+        {
+            const char* delim = arg_names.empty() ? "" : ",";
+            *stats_csv << arg_names << delim << "iteration,us\n";
+            for(size_t i = 0; i < us.size(); i++)
+                *stats_csv << arg_values << delim << i << "," << us[i] << "\n";
+            stats_csv->flush();
+        }
+    }
+
+    size_t n    = us.size();
+    double mean = 0;
+    for(double t : us)
+        mean += t;
+    mean /= n;
+
+    double var = 0;
+    for(double t : us)
+        var += (t - mean) * (t - mean);
+    double stddev = n > 1 ? std::sqrt(var / (n - 1)) : 0;
+
+    std::sort(us.begin(), us.end());
+
+    // nearest rank percentile
+    auto percentile = [&](double p) {
+        size_t rank = size_t(std::ceil(p / 100 * n));
+        return us[rank ? rank - 1 : 0];
+    };
+
+    double median = n % 2 ? us[n / 2] : (us[n / 2 - 1] + us[n / 2]) / 2;
+
+    name_line << ",min-us,median-us,p90-us,p99-us,stddev-us";
+    val_line << ", " << us.front() << ", " << median << ", " << percentile(90) << ", "
+             << percentile(99) << ", " << stddev;
+}
+
+namespace
+{
+    // JSON array of the benchmark records, closed when the file is changed or at exit
+    struct json_writer
+    {
+        std::unique_ptr<std::ofstream> file;
+        bool                           first = true;
+
+        void close()
+        {
+            if(file)
+                *file << (first ? "[" : "\n") << "]\n";
+            file.reset();
+            first = true;
+        }
+
+        ~json_writer()
+        {
+            close();
+        }
+    };
+
+    json_writer json;
+    std::mutex  json_mutex;
+
+    std::vector<std::string> split_csv(const std::string& line)
+    {
+        std::vector<std::string> fields;
+        std::string              field;
+        std::istringstream       is(line);
+        while(std::getline(is, field, ','))
+        {
+            size_t begin = field.find_first_not_of(" \t");
+            size_t end   = field.find_last_not_of(" \t");
+            fields.push_back(begin == std::string::npos ? "" : field.substr(begin, end - begin + 1));
+        }
+        return fields;
+    }
+
+    // numbers are written as JSON numbers, anything else as a string
+    void write_json_value(std::ostream& os, const std::string& value)
+    {
+        char*  end = nullptr;
+        double x   = strtod(value.c_str(), &end);
+        if(!value.empty() && end && !*end && std::isfinite(x))
+        {
+            os << value;
+            return;
+        }
+
+        os << '"';
+        for(char c : value)
+        {
+            if(c == '"' || c == '\\')
+                os << '\\';
+            os << c;
+        }
+        os << '"';
+    }
+}
+
+void ArgumentModel_set_json(const std::string& filename)
+{
+    std::lock_guard<std::mutex> lock(json_mutex);
+    json.close();
+    if(!filename.empty())
+    {
+        json.file = std::make_unique<std::ofstream>(filename);
+        if(!*json.file)
+            throw std::invalid_argument("Cannot open JSON output file " + filename);
+    }
+}
+
+bool ArgumentModel_get_json()
+{
+    return json.file != nullptr;
+}
+
+void ArgumentModel_log_json(const Arguments&   arg,
+                            const std::string& names,
+                            const std::string& values)
+{
+    std::lock_guard<std::mutex> lock(json_mutex);
+    if(!json.file)
+        return;
+
+    std::ostream& os = *json.file;
+    os << (json.first ? "[\n" : ",\n") << "  {\"function\": ";
+    write_json_value(os, arg.function);
+
+    static constexpr const char* type_names[]
+        = {"a_type", "b_type", "c_type", "d_type", "compute_type"};
+    const rocblas_datatype types[]
+        = {arg.a_type, arg.b_type, arg.c_type, arg.d_type, arg.compute_type};
+    for(int i = 0; i < 5; i++)
+        os << ", \"" << type_names[i] << "\": \"" << rocblas_datatype2string(types[i]) << '"';
+
+    auto name_fields  = split_csv(names);
+    auto value_fields = split_csv(values);
+    for(size_t i = 0; i < name_fields.size() && i < value_fields.size(); i++)
+    {
+        // function and datatypes are already written, whether or not they are logged
+        if(name_fields[i] == "function" || name_fields[i].find("_type") != std::string::npos)
+            continue;
+        os << ", ";
+        write_json_value(os, name_fields[i]);
+        os << ": ";
+        write_json_value(os, value_fields[i]);
+    }
+    os << "}";
+    os.flush();
+    json.first = false;
+}
@@ -19,6 +19,7 @@
  * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  *
  * ************************************************************************/
+#define ROCBLAS_BETA_FEATURES_API
 #include "cblas_interface.hpp"
 #include "rocblas_vector.hpp"
 #include "utility.hpp"
@@ -599,10 +600,8 @@ void cblas_gemm<rocblas_bfloat16, float, float>(rocblas_operation       transA,
 
     host_vector<float> A_float(sizeA), B_float(sizeB);
 
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = static_cast<float>(A[i]);
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = static_cast<float>(B[i]);
+    rocblas_convert_bfloat16_to_float(sizeA, A, A_float);
+    rocblas_convert_bfloat16_to_float(sizeB, B, B_float);
 
     // just directly cast, since transA, transB are integers in the enum
     // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
@@ -647,12 +646,9 @@ void cblas_gemm<rocblas_bfloat16, rocblas_bfloat16, float>(rocblas_operation
 
     host_vector<float> A_float(sizeA), B_float(sizeB), C_float(sizeC);
 
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = static_cast<float>(A[i]);
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = static_cast<float>(B[i]);
-    for(size_t i = 0; i < sizeC; i++)
-        C_float[i] = static_cast<float>(C[i]);
+    rocblas_convert_bfloat16_to_float(sizeA, A, A_float);
+    rocblas_convert_bfloat16_to_float(sizeB, B, B_float);
+    rocblas_convert_bfloat16_to_float(sizeC, C, C_float);
 
     // just directly cast, since transA, transB are integers in the enum
     // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
@@ -671,8 +667,7 @@ void cblas_gemm<rocblas_bfloat16, rocblas_bfloat16, float>(rocblas_operation
                 C_float,
                 ldc);
 
-    for(size_t i = 0; i < sizeC; i++)
-        C[i] = static_cast<rocblas_bfloat16>(C_float[i]);
+    rocblas_convert_float_to_bfloat16(sizeC, C_float, C, false);
 }
 
 template <>
@@ -699,10 +694,8 @@ void cblas_gemm<rocblas_half, float, float>(rocblas_operation   transA,
 
     host_vector<float> A_float(sizeA), B_float(sizeB);
 
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = A[i];
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = B[i];
+    rocblas_convert_half_to_float(sizeA, A, A_float);
+    rocblas_convert_half_to_float(sizeB, B, B_float);
 
     // just directly cast, since transA, transB are integers in the enum
     // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
@@ -761,12 +754,9 @@ void cblas_gemm<rocblas_half, rocblas_half, float>(rocblas_operation   transA,
     }
     else
     {
-        for(size_t i = 0; i < sizeA; i++)
-            A_float[i] = A[i];
-        for(size_t i = 0; i < sizeB; i++)
-            B_float[i] = B[i];
-        for(size_t i = 0; i < sizeC; i++)
-            C_float[i] = C[i];
+        rocblas_convert_half_to_float(sizeA, A, A_float);
+        rocblas_convert_half_to_float(sizeB, B, B_float);
+        rocblas_convert_half_to_float(sizeC, C, C_float);
     }
 
     // just directly cast, since transA, transB are integers in the enum
@@ -786,8 +776,7 @@ void cblas_gemm<rocblas_half, rocblas_half, float>(rocblas_operation   transA,
                 C_float,
                 ldc);
 
-    for(size_t i = 0; i < sizeC; i++)
-        C[i] = rocblas_half(C_float[i]);
+    rocblas_convert_float_to_half(sizeC, C_float, C);
 }
 
 template <>
@@ -817,12 +806,9 @@ void cblas_gemm<rocblas_half, rocblas_half, rocblas_half>(rocblas_operation   tr
 
     host_vector<float> A_float(sizeA), B_float(sizeB), C_float(sizeC);
 
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = A[i];
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = B[i];
-    for(size_t i = 0; i < sizeC; i++)
-        C_float[i] = C[i];
+    rocblas_convert_half_to_float(sizeA, A, A_float);
+    rocblas_convert_half_to_float(sizeB, B, B_float);
+    rocblas_convert_half_to_float(sizeC, C, C_float);
 
     // just directly cast, since transA, transB are integers in the enum
     // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
@@ -841,8 +827,7 @@ void cblas_gemm<rocblas_half, rocblas_half, rocblas_half>(rocblas_operation   tr
                 C_float,
                 ldc);
 
-    for(size_t i = 0; i < sizeC; i++)
-        C[i] = rocblas_half(C_float[i]);
+    rocblas_convert_float_to_half(sizeC, C_float, C);
 }
 
 template <>
@@ -978,6 +963,82 @@ void cblas_geam_plus_min(rocblas_operation transA,
     }
 }
 
+template <typename T>
+void cblas_geam_max_plus(rocblas_operation transA,
+                         rocblas_operation transB,
+                         rocblas_int       m,
+                         rocblas_int       n,
+                         rocblas_int       k,
+                         const T           alpha,
+                         const T*          A,
+                         rocblas_int       lda,
+                         const T*          B,
+                         rocblas_int       ldb,
+                         const T           beta,
+                         const T*          C,
+                         rocblas_int       ldc,
+                         T*                D,
+                         rocblas_int       ldd)
+{
+    bool TRANSA = transA != rocblas_operation_none;
+    bool TRANSB = transB != rocblas_operation_none;
+
+#pragma omp parallel for
+    for(int n1 = 0; n1 < n; n1++)
+    {
+        for(int m1 = 0; m1 < m; m1++)
+        {
+            size_t idxC = size_t(ldc) * n1 + m1;
+            size_t idxD = size_t(ldd) * n1 + m1;
+            D[idxD]     = beta * C[idxC];
+            for(int k1 = 0; k1 < k; k1++)
+            {
+                size_t idxA = TRANSA ? size_t(lda) * m1 + k1 : size_t(lda) * k1 + m1;
+                size_t idxB = TRANSB ? size_t(ldb) * k1 + n1 : size_t(ldb) * n1 + k1;
+                D[idxD]     = std::max(alpha * (A[idxA] + B[idxB]), D[idxD]);
+            }
+        }
+    }
+}
+
+template <typename T>
+void cblas_geam_max_min(rocblas_operation transA,
+                        rocblas_operation transB,
+                        rocblas_int       m,
+                        rocblas_int       n,
+                        rocblas_int       k,
+                        const T           alpha,
+                        const T*          A,
+                        rocblas_int       lda,
+                        const T*          B,
+                        rocblas_int       ldb,
+                        const T           beta,
+                        const T*          C,
+                        rocblas_int       ldc,
+                        T*                D,
+                        rocblas_int       ldd)
+{
+    bool TRANSA = transA != rocblas_operation_none;
+    bool TRANSB = transB != rocblas_operation_none;
+
+#pragma omp parallel for
+    for(int n1 = 0; n1 < n; n1++)
+    {
+        for(int m1 = 0; m1 < m; m1++)
+        {
+            size_t idxC = size_t(ldc) * n1 + m1;
+            size_t idxD = size_t(ldd) * n1 + m1;
+            D[idxD]     = beta * C[idxC];
+            for(int k1 = 0; k1 < k; k1++)
+            {
+                size_t idxA = TRANSA ? size_t(lda) * m1 + k1 : size_t(lda) * k1 + m1;
+                size_t idxB = TRANSB ? size_t(ldb) * k1 + n1 : size_t(ldb) * n1 + k1;
+                D[idxD]     = std::max(std::min(alpha * A[idxA], alpha * B[idxB]), D[idxD]);
+            }
+        }
+    }
+}
+
 template <typename T, typename U>
 void cblas_herkx(rocblas_fill      uplo,
                  rocblas_operation transA,
@@ -1192,6 +1253,102 @@ template void cblas_geam_plus_min<rocblas_half>(rocblas_operation   transA,
                                                 rocblas_half*       D,
                                                 rocblas_int         ldd);
 
+template void cblas_geam_max_plus<float>(rocblas_operation transA,
+                                         rocblas_operation transB,
+                                         rocblas_int       m,
+                                         rocblas_int       n,
+                                         rocblas_int       k,
+                                         const float       alpha,
+                                         const float*      A,
+                                         rocblas_int       lda,
+                                         const float*      B,
+                                         rocblas_int       ldb,
+                                         const float       beta,
+                                         const float*      C,
+                                         rocblas_int       ldc,
+                                         float*            D,
+                                         rocblas_int       ldd);
+
+template void cblas_geam_max_plus<double>(rocblas_operation transA,
+                                          rocblas_operation transB,
+                                          rocblas_int       m,
+                                          rocblas_int       n,
+                                          rocblas_int       k,
+                                          const double      alpha,
+                                          const double*     A,
+                                          rocblas_int       lda,
+                                          const double*     B,
+                                          rocblas_int       ldb,
+                                          const double      beta,
+                                          const double*     C,
+                                          rocblas_int       ldc,
+                                          double*           D,
+                                          rocblas_int       ldd);
+
+template void cblas_geam_max_plus<rocblas_half>(rocblas_operation   transA,
+                                                rocblas_operation   transB,
+                                                rocblas_int         m,
+                                                rocblas_int         n,
+                                                rocblas_int         k,
+                                                const rocblas_half  alpha,
+                                                const rocblas_half* A,
+                                                rocblas_int         lda,
+                                                const rocblas_half* B,
+                                                rocblas_int         ldb,
+                                                const rocblas_half  beta,
+                                                const rocblas_half* C,
+                                                rocblas_int         ldc,
+                                                rocblas_half*       D,
+                                                rocblas_int         ldd);
+
+template void cblas_geam_max_min<float>(rocblas_operation transA,
+                                        rocblas_operation transB,
+                                        rocblas_int       m,
+                                        rocblas_int       n,
+                                        rocblas_int       k,
+                                        const float       alpha,
+                                        const float*      A,
+                                        rocblas_int       lda,
+                                        const float*      B,
+                                        rocblas_int       ldb,
+                                        const float       beta,
+                                        const float*      C,
+                                        rocblas_int       ldc,
+                                        float*            D,
+                                        rocblas_int       ldd);
+
+template void cblas_geam_max_min<double>(rocblas_operation transA,
+                                         rocblas_operation transB,
+                                         rocblas_int       m,
+                                         rocblas_int       n,
+                                         rocblas_int       k,
+                                         const double      alpha,
+                                         const double*     A,
+                                         rocblas_int       lda,
+                                         const double*     B,
+                                         rocblas_int       ldb,
+                                         const double      beta,
+                                         const double*     C,
+                                         rocblas_int       ldc,
+                                         double*           D,
+                                         rocblas_int       ldd);
+
+template void cblas_geam_max_min<rocblas_half>(rocblas_operation   transA,
+                                               rocblas_operation   transB,
+                                               rocblas_int         m,
+                                               rocblas_int         n,
+                                               rocblas_int         k,
+                                               const rocblas_half  alpha,
+                                               const rocblas_half* A,
+                                               rocblas_int         lda,
+                                               const rocblas_half* B,
+                                               rocblas_int         ldb,
+                                               const rocblas_half  beta,
+                                               const rocblas_half* C,
+                                               rocblas_int         ldc,
+                                               rocblas_half*       D,
+                                               rocblas_int         ldd);
+
 template void cblas_herkx<rocblas_float_complex, float>(rocblas_fill                 uplo,
                                                         rocblas_operation            transA,
                                                         rocblas_int                  n,
@@ -29,7 +29,11 @@
 #include <string.h>
 #endif
 
+#include <algorithm>
+#include <chrono>
+#include <map>
 #include <stdlib.h>
+#include <unordered_map>
 
 #include "host_alloc.hpp"
 #include "rocblas_test.hpp"
@@ -147,3 +151,217 @@ void* host_calloc(size_t nmemb, size_t size)
     else
         return nullptr;
 }
+
+static bool pinned_transfers = false;
+
+void host_set_pinned_transfers(bool pinned)
+{
+    pinned_transfers = pinned;
+}
+
+bool host_get_pinned_transfers()
+{
+    return pinned_transfers;
+}
+
+namespace
+{
+    // Pinned staging buffers and their events of the calling thread, allocated on first use
+    struct host_staging_buffers
+    {
+        static constexpr size_t chunk_bytes = size_t(8) << 20;
+
+        void*      buffer[2] = {};
+        hipEvent_t event[2]  = {};
+        bool       ready     = false;
+
+        bool setup()
+        {
+            if(!ready)
+            {
+                for(int i = 0; i < 2; i++)
+                {
+                    if(hipHostMalloc(&buffer[i], chunk_bytes, hipHostMallocDefault) != hipSuccess)
+                        buffer[i] = nullptr;
+                    if(hipEventCreateWithFlags(&event[i], hipEventDisableTiming) != hipSuccess)
+                        event[i] = nullptr;
+                }
+                ready = true;
+            }
+            return buffer[0] && buffer[1] && event[0] && event[1];
+        }
+
+        ~host_staging_buffers()
+        {
+            for(int i = 0; i < 2; i++)
+            {
+                if(buffer[i])
+                    (void)hipHostFree(buffer[i]);
+                if(event[i])
+                    (void)hipEventDestroy(event[i]);
+            }
+        }
+    };
+
+    thread_local host_staging_buffers staging;
+
+    // Host to device: chunk i is copied into its buffer once the transfer of chunk i - 2 from
+    // the same buffer has completed, while chunk i - 1 is being transferred
+    hipError_t staged_memcpy_to_device(char* dst, const char* src, size_t bytes)
+    {
+        const size_t chunk_bytes = host_staging_buffers::chunk_bytes;
+        hipError_t   hip_err     = hipSuccess;
+        for(size_t offset = 0, i = 0; offset < bytes; offset += chunk_bytes, i++)
+        {
+            size_t n   = std::min(chunk_bytes, bytes - offset);
+            int    buf = i & 1;
+            if(i >= 2 && (hip_err = hipEventSynchronize(staging.event[buf])) != hipSuccess)
+                return hip_err;
+
+            void* buffer = staging.buffer[buf];
+            memcpy(buffer, src + offset, n);
+            hip_err = hipMemcpyAsync(dst + offset, buffer, n, hipMemcpyHostToDevice, 0);
+            if(hip_err == hipSuccess)
+                hip_err = hipEventRecord(staging.event[buf], 0);
+            if(hip_err != hipSuccess)
+                return hip_err;
+        }
+        return hipStreamSynchronize(0);
+    }
+
+    // Device to host: the transfer of chunk i + 1 is queued before chunk i is copied out of its
+    // buffer, whose previous chunk i - 1 has already been copied out
+    hipError_t staged_memcpy_to_host(char* dst, const char* src, size_t bytes)
+    {
+        const size_t chunk_bytes = host_staging_buffers::chunk_bytes;
+        const size_t chunks      = (bytes - 1) / chunk_bytes + 1;
+        hipError_t   hip_err;
+
+        auto queue = [&](size_t i) {
+            size_t offset = i * chunk_bytes;
+            size_t n      = std::min(chunk_bytes, bytes - offset);
+            int    buf    = i & 1;
+
+            hipError_t err
+                = hipMemcpyAsync(staging.buffer[buf], src + offset, n, hipMemcpyDeviceToHost, 0);
+            return err != hipSuccess ? err : hipEventRecord(staging.event[buf], 0);
+        };
+
+        if((hip_err = queue(0)) != hipSuccess)
+            return hip_err;
+
+        for(size_t i = 0; i < chunks; i++)
+        {
+            if(i + 1 < chunks && (hip_err = queue(i + 1)) != hipSuccess)
+                return hip_err;
+
+            int buf = i & 1;
+            if((hip_err = hipEventSynchronize(staging.event[buf])) != hipSuccess)
+                return hip_err;
+
+            size_t offset = i * chunk_bytes;
+            memcpy(dst + offset, staging.buffer[buf], std::min(chunk_bytes, bytes - offset));
+        }
+        return hipSuccess;
+    }
+}
+
+hipError_t host_transfer_memcpy(void* dst, const void* src, size_t bytes, hipMemcpyKind kind)
+{
+    auto start  = std::chrono::steady_clock::now();
+    bool staged = pinned_transfers && bytes > host_staging_buffers::chunk_bytes
+                  && (kind == hipMemcpyHostToDevice || kind == hipMemcpyDeviceToHost)
+                  && staging.setup();
+
+    hipError_t hip_err;
+    if(!staged)
+        hip_err = hipMemcpy(dst, src, bytes, kind);
+    else if(kind == hipMemcpyHostToDevice)
+        hip_err = staged_memcpy_to_device((char*)dst, (const char*)src, bytes);
+    else
+        hip_err = staged_memcpy_to_host((char*)dst, (const char*)src, bytes);
+
+    if(ArgumentModel_get_log_transfers() && hip_err == hipSuccess && kind != hipMemcpyHostToHost)
+    {
+        std::chrono::duration<double, std::micro> us = std::chrono::steady_clock::now() - start;
+        ArgumentModel_add_transfer(us.count(), bytes);
+    }
+    return hip_err;
+}
+
+static bool buffer_reuse = false;
+
+void device_set_buffer_reuse(bool reuse)
+{
+    buffer_reuse = reuse;
+}
+
+bool device_get_buffer_reuse()
+{
+    return buffer_reuse;
+}
+
+namespace
+{
+    // Device buffers of the calling thread, by size when kept and by address when in use
+    struct device_buffers
+    {
+        std::multimap<size_t, void*>      kept;
+        std::unordered_map<void*, size_t> used;
+
+        void release()
+        {
+            for(auto& block : kept)
+                (void)(hipFree)(block.second);
+            kept.clear();
+        }
+
+        ~device_buffers()
+        {
+            release();
+        }
+    };
+
+    thread_local device_buffers buffers;
+}
+
+hipError_t device_buffer_malloc(void** ptr, size_t bytes)
+{
+    if(!buffer_reuse)
+        return (hipMalloc)(ptr, bytes);
+
+    // smallest kept buffer which fits
+    auto block = buffers.kept.lower_bound(bytes);
+    if(block != buffers.kept.end())
+    {
+        *ptr = block->second;
+        buffers.used.emplace(block->second, block->first);
+        buffers.kept.erase(block);
+        return hipSuccess;
+    }
+
+    buffers.release();
+    hipError_t hip_err = (hipMalloc)(ptr, bytes);
+    if(hip_err == hipSuccess)
+        buffers.used.emplace(*ptr, bytes);
+    return hip_err;
+}
+
+hipError_t device_buffer_free(void* ptr)
+{
+    auto block = buffers.used.find(ptr);
+    if(block == buffers.used.end())
+        return (hipFree)(ptr);
+
+    if(buffer_reuse)
+        buffers.kept.emplace(block->second, block->first);
+    else
+        (void)(hipFree)(ptr);
+    buffers.used.erase(block);
+    return hipSuccess;
+}
+
+void device_buffer_release()
+{
+    buffers.release();
+}
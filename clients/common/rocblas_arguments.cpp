@@ -37,6 +37,7 @@ void Arguments::init()
     strcpy(name, "rocblas-bench");
     category[0]            = 0;
     known_bug_platforms[0] = 0;
+    perf_arch[0]           = 0;
 
     // 64bit
 
@@ -45,6 +46,9 @@ void Arguments::init()
     beta   = 0.0;
     betai  = 0.0;
 
+    perf_min_percent = 0.0;
+    perf_tolerance   = 0.5;
+
     stride_a = 0;
     stride_b = 0;
     stride_c = 0;
@@ -105,6 +109,9 @@ void Arguments::init()
     // bytes
     devices = 0;
 
+    device_id = 0;
+    stream_id = 0;
+
     norm_check = 0;
     unit_check = 1;
     timing     = 0;
@@ -0,0 +1,363 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_counters.hpp"
+#include "rocblas_ostream.hpp"
+#include <mutex>
+#include <sstream>
+
+#ifdef ROCBLAS_BENCH_COUNTERS
+#include <rocprofiler-sdk/registration.h>
+#include <rocprofiler-sdk/rocprofiler.h>
+#include <cstdlib>
+#include <cxxabi.h>
+#include <set>
+#include <unordered_map>
+#endif
+
+static std::vector<std::string> counter_names;
+
+void rocblas_set_counters(const std::string& counters)
+{
+    counter_names.clear();
+    std::istringstream list(counters);
+    std::string        name;
+    while(std::getline(list, name, ','))
+        if(!name.empty())
+            counter_names.push_back(name);
+}
+
+const std::vector<std::string>& rocblas_get_counters()
+{
+    return counter_names;
+}
+
+#ifndef ROCBLAS_BENCH_COUNTERS
+
+bool rocblas_counters_available()
+{
+    return false;
+}
+
+std::vector<rocblas_kernel_counters>
+    rocblas_collect_counters(hipStream_t, int, const std::function<void()>&)
+{
+    return {};
+}
+
+#else
+
+namespace
+{
+    // Short name of a kernel symbol, e.g. rocblas_gemvn_kernel for the mangled
+    // void rocblas_gemvn_kernel<64, 16, float>(int, int, ...); Tensile kernels are not mangled
+    std::string short_kernel_name(const char* symbol)
+    {
+        if(!symbol)
+            return "unknown";
+
+        int         status    = 0;
+        char*       demangled = abi::__cxa_demangle(symbol, nullptr, nullptr, &status);
+        std::string s(status == 0 && demangled ? demangled : symbol);
+        free(demangled);
+
+        const std::string anonymous = "(anonymous namespace)::";
+        for(size_t pos; (pos = s.find(anonymous)) != std::string::npos;)
+            s.erase(pos, anonymous.size());
+
+        size_t end = s.find_first_of("<(");
+        if(end != std::string::npos)
+            s.resize(end);
+        size_t begin = s.rfind(' ');
+        return begin == std::string::npos ? s : s.substr(begin + 1);
+    }
+
+    // State of the tool, registered with the rocprofiler SDK at the initialization of the HIP
+    // runtime. The code object context is always started, to record the names of the kernels as
+    // they are loaded; the counting context only during the collections.
+    struct counters_tool
+    {
+        rocprofiler_context_id_t code_object_context{};
+        rocprofiler_context_id_t counting_context{};
+        rocprofiler_buffer_id_t  buffer{};
+        bool                     initialized = false;
+
+        std::mutex                                                    mutex;
+        std::unordered_map<uint64_t, std::string>                     kernel_names;
+        std::unordered_map<uint64_t, rocprofiler_counter_config_id_t> configs;
+        std::unordered_map<uint64_t, std::string>                     counter_ids;
+        std::set<std::string>                                         missing_reported;
+
+        // Records of the current collection, by dispatch
+        std::vector<uint64_t>                                       dispatch_order;
+        std::unordered_map<uint64_t, uint64_t>                      dispatch_kernels;
+        std::unordered_map<uint64_t, double>                        dispatch_us;
+        std::unordered_map<uint64_t, std::map<std::string, double>> dispatch_values;
+    };
+
+    counters_tool& tool()
+    {
+        static counters_tool* state = new counters_tool; // used until the runtime finalizes
+        return *state;
+    }
+
+    void code_object_callback(rocprofiler_callback_tracing_record_t record,
+                              rocprofiler_user_data_t*,
+                              void*)
+    {
+        if(record.kind != ROCPROFILER_CALLBACK_TRACING_CODE_OBJECT
+           || record.operation != ROCPROFILER_CODE_OBJECT_DEVICE_KERNEL_SYMBOL_REGISTER
+           || record.phase != ROCPROFILER_CALLBACK_PHASE_LOAD)
+            return;
+
+        using symbol_data_t
+            = rocprofiler_callback_tracing_code_object_kernel_symbol_register_data_t;
+
+        auto* data = static_cast<symbol_data_t*>(record.payload);
+        std::lock_guard<std::mutex> lock(tool().mutex);
+        tool().kernel_names[data->kernel_id] = short_kernel_name(data->kernel_name);
+    }
+
+    // Counter configuration of an agent with the requested counters it supports, created at the
+    // first dispatch on the agent
+    void dispatch_callback(rocprofiler_dispatch_counting_service_data_t dispatch_data,
+                           rocprofiler_counter_config_id_t*             config,
+                           rocprofiler_user_data_t*,
+                           void*)
+    {
+        auto&                       state = tool();
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        rocprofiler_agent_id_t agent = dispatch_data.dispatch_info.agent_id;
+        auto                   found = state.configs.find(agent.handle);
+        if(found != state.configs.end())
+        {
+            *config = found->second;
+            return;
+        }
+
+        std::map<std::string, rocprofiler_counter_id_t> supported;
+        rocprofiler_iterate_agent_supported_counters(
+            agent,
+            [](rocprofiler_agent_id_t,
+               rocprofiler_counter_id_t* counters,
+               size_t                    num_counters,
+               void*                     user_data) {
+                auto& supported = *static_cast<std::map<std::string, rocprofiler_counter_id_t>*>(
+                    user_data);
+                for(size_t i = 0; i < num_counters; i++)
+                {
+                    rocprofiler_counter_info_v0_t info;
+                    if(rocprofiler_query_counter_info(
+                           counters[i], ROCPROFILER_COUNTER_INFO_VERSION_0, &info)
+                       == ROCPROFILER_STATUS_SUCCESS)
+                        supported[info.name] = counters[i];
+                }
+                return ROCPROFILER_STATUS_SUCCESS;
+            },
+            &supported);
+
+        std::vector<rocprofiler_counter_id_t> ids;
+        for(const std::string& name : rocblas_get_counters())
+        {
+            auto counter = supported.find(name);
+            if(counter != supported.end())
+            {
+                ids.push_back(counter->second);
+                state.counter_ids[counter->second.handle] = name;
+            }
+            else if(state.missing_reported.insert(name).second)
+                rocblas_cerr << "Counter " << name << " is not supported by the device"
+                             << std::endl;
+        }
+
+        rocprofiler_counter_config_id_t agent_config{};
+        if(!ids.empty()
+           && rocprofiler_create_counter_config(agent, ids.data(), ids.size(), &agent_config)
+                  != ROCPROFILER_STATUS_SUCCESS)
+            agent_config = {};
+        state.configs[agent.handle] = agent_config;
+        *config                     = agent_config;
+    }
+
+    void buffered_callback(rocprofiler_context_id_t,
+                           rocprofiler_buffer_id_t,
+                           rocprofiler_record_header_t** headers,
+                           size_t                        num_headers,
+                           void*,
+                           uint64_t)
+    {
+        auto&                       state = tool();
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        for(size_t i = 0; i < num_headers; i++)
+        {
+            rocprofiler_record_header_t* header = headers[i];
+            if(header->category == ROCPROFILER_BUFFER_CATEGORY_TRACING
+               && header->kind == ROCPROFILER_BUFFER_TRACING_KERNEL_DISPATCH)
+            {
+                auto* record
+                    = static_cast<rocprofiler_buffer_tracing_kernel_dispatch_record_t*>(
+                        header->payload);
+                uint64_t dispatch = record->dispatch_info.dispatch_id;
+                if(!state.dispatch_kernels.count(dispatch))
+                    state.dispatch_order.push_back(dispatch);
+                state.dispatch_kernels[dispatch] = record->dispatch_info.kernel_id;
+                state.dispatch_us[dispatch]
+                    = (record->end_timestamp - record->start_timestamp) * 1e-3;
+            }
+            else if(header->category == ROCPROFILER_BUFFER_CATEGORY_COUNTERS
+                    && header->kind == ROCPROFILER_COUNTER_RECORD_VALUE)
+            {
+                // the values of the instances of a counter, e.g. per shader engine, are summed
+                auto* record = static_cast<rocprofiler_record_counter_t*>(header->payload);
+                rocprofiler_counter_id_t counter{};
+                if(rocprofiler_query_record_counter_id(record->id, &counter)
+                   != ROCPROFILER_STATUS_SUCCESS)
+                    continue;
+                auto name = state.counter_ids.find(counter.handle);
+                if(name != state.counter_ids.end())
+                    state.dispatch_values[record->dispatch_id][name->second]
+                        += record->counter_value;
+            }
+        }
+    }
+
+    int tool_init(rocprofiler_client_finalize_t, void*)
+    {
+        auto& state = tool();
+
+        if(rocprofiler_create_context(&state.code_object_context) != ROCPROFILER_STATUS_SUCCESS
+           || rocprofiler_configure_callback_tracing_service(
+                  state.code_object_context,
+                  ROCPROFILER_CALLBACK_TRACING_CODE_OBJECT,
+                  nullptr,
+                  0,
+                  code_object_callback,
+                  nullptr)
+                  != ROCPROFILER_STATUS_SUCCESS
+           || rocprofiler_start_context(state.code_object_context) != ROCPROFILER_STATUS_SUCCESS)
+            return -1;
+
+        constexpr size_t buffer_bytes = 1 << 22;
+        if(rocprofiler_create_context(&state.counting_context) != ROCPROFILER_STATUS_SUCCESS
+           || rocprofiler_create_buffer(state.counting_context,
+                                        buffer_bytes,
+                                        buffer_bytes / 2,
+                                        ROCPROFILER_BUFFER_POLICY_LOSSLESS,
+                                        buffered_callback,
+                                        nullptr,
+                                        &state.buffer)
+                  != ROCPROFILER_STATUS_SUCCESS
+           || rocprofiler_configure_buffered_tracing_service(
+                  state.counting_context,
+                  ROCPROFILER_BUFFER_TRACING_KERNEL_DISPATCH,
+                  nullptr,
+                  0,
+                  state.buffer)
+                  != ROCPROFILER_STATUS_SUCCESS
+           || rocprofiler_configure_buffered_dispatch_counting_service(
+                  state.counting_context, state.buffer, dispatch_callback, nullptr)
+                  != ROCPROFILER_STATUS_SUCCESS)
+            return -1;
+
+        state.initialized = true;
+        return 0;
+    }
+
+    void tool_fini(void*)
+    {
+        tool().initialized = false;
+    }
+}
+
+// Found by the rocprofiler SDK in the exported symbols of rocblas-bench
+extern "C" rocprofiler_tool_configure_result_t* rocprofiler_configure(uint32_t,
+                                                                      const char*,
+                                                                      uint32_t,
+                                                                      rocprofiler_client_id_t* id)
+{
+    id->name = "rocblas-bench";
+
+    static rocprofiler_tool_configure_result_t result{
+        sizeof(rocprofiler_tool_configure_result_t), tool_init, tool_fini, nullptr};
+    return &result;
+}
+
+bool rocblas_counters_available()
+{
+    return true;
+}
+
+std::vector<rocblas_kernel_counters>
+    rocblas_collect_counters(hipStream_t stream, int calls, const std::function<void()>& func)
+{
+    auto& state = tool();
+    if(!state.initialized || rocblas_get_counters().empty())
+        return {};
+
+    // the calls of the collection are separated from earlier work on the stream
+    if(hipStreamSynchronize(stream) != hipSuccess)
+        return {};
+
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.dispatch_order.clear();
+        state.dispatch_kernels.clear();
+        state.dispatch_us.clear();
+        state.dispatch_values.clear();
+    }
+
+    if(rocprofiler_start_context(state.counting_context) != ROCPROFILER_STATUS_SUCCESS)
+        return {};
+    for(int i = 0; i < calls; i++)
+        func();
+    (void)hipStreamSynchronize(stream);
+    rocprofiler_flush_buffer(state.buffer);
+    rocprofiler_stop_context(state.counting_context);
+
+    std::lock_guard<std::mutex>          lock(state.mutex);
+    std::vector<rocblas_kernel_counters> kernels;
+    std::map<std::string, size_t>        kernel_index;
+    for(uint64_t dispatch : state.dispatch_order)
+    {
+        auto        name   = state.kernel_names.find(state.dispatch_kernels[dispatch]);
+        std::string kernel = name != state.kernel_names.end() ? name->second : "unknown";
+
+        auto index = kernel_index.find(kernel);
+        if(index == kernel_index.end())
+        {
+            index = kernel_index.emplace(kernel, kernels.size()).first;
+            kernels.emplace_back();
+            kernels.back().kernel = kernel;
+        }
+
+        rocblas_kernel_counters& k = kernels[index->second];
+        k.dispatches++;
+        k.us += state.dispatch_us[dispatch];
+        for(auto& value : state.dispatch_values[dispatch])
+            k.values[value.first] += value.second;
+    }
+    return kernels;
+}
+
+#endif
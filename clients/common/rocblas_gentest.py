@@ -236,7 +236,8 @@ def setdefaults(test):
                             'rotm_strided_batched', 'iamax_strided_batched',
                             'iamin_strided_batched', 'axpy_strided_batched',
                             'axpy_strided_batched_ex', 'nrm2_strided_batched_ex',
-                            'scal_strided_batched_ex'):
+                            'scal_strided_batched_ex', 'axpby_strided_batched_ex',
+                            'copy_scal_strided_batched_ex'):
         setkey_product(test, 'stride_x', ['N', 'incx', 'stride_scale'])
         setkey_product(test, 'stride_y', ['N', 'incy', 'stride_scale'])
         # we are using stride_c for param in rotm
@@ -248,15 +249,18 @@ def setdefaults(test):
 # Let's use M * M (> (M * (M+1)) / 2) as a 'stride' size for the packed format.
         setkey_product(test, 'stride_a', ['M', 'M', 'stride_scale'])
 
-    elif test['function'] in ('trmv_strided_batched'):
+    elif test['function'] in ('trmv_strided_batched', 'trmv_strided_batched_ex'):
         setkey_product(test, 'stride_x', ['M', 'incx', 'stride_scale'])
         setkey_product(test, 'stride_a', ['M', 'lda', 'stride_scale'])
 
-    elif test['function'] in ('gemv_strided_batched', 'gbmv_strided_batched',
+    elif test['function'] in ('gemv_strided_batched', 'gemv_strided_batched_ex',
+                              'gbmv_strided_batched',
                               'ger_strided_batched', 'geru_strided_batched',
-                              'gerc_strided_batched', 'trsv_strided_batched'):
+                              'gerc_strided_batched', 'ger_strided_batched_ex',
+                              'trsv_strided_batched'):
         if test['function'] in ('ger_strided_batched', 'geru_strided_batched',
-                                'gerc_strided_batched', 'trsv_strided_batched'
+                                'gerc_strided_batched', 'ger_strided_batched_ex',
+                                'trsv_strided_batched'
                                 ) or test['transA'] in ('T', 'C'):
             setkey_product(test, 'stride_x', ['M', 'incx', 'stride_scale'])
             setkey_product(test, 'stride_y', ['N', 'incy', 'stride_scale'])
@@ -269,7 +273,7 @@ def setdefaults(test):
             setkey_product(test, 'stride_a', ['lda', 'M', 'stride_scale'])
 
     elif test['function'] in ('hemv_strided_batched', 'hbmv_strided_batched',
-                              'sbmv_strided_batched'):
+                              'sbmv_strided_batched', 'symv_strided_batched_ex'):
         if all([x in test for x in ('N', 'incx', 'incy', 'stride_scale')]):
             setkey_product(test, 'stride_x', ['N', 'incx', 'stride_scale'])
             setkey_product(test, 'stride_y', ['N', 'incy', 'stride_scale'])
@@ -290,7 +294,7 @@ def setdefaults(test):
         setkey_product(test, 'stride_a', ['N', 'N', 'stride_scale'])
 
     elif test['function'] in ('her_strided_batched', 'her2_strided_batched',
-                              'syr2_strided_batched'):
+                              'syr2_strided_batched', 'syr2_strided_batched_ex'):
         setkey_product(test, 'stride_x', ['N', 'incx', 'stride_scale'])
         setkey_product(test, 'stride_y', ['N', 'incy', 'stride_scale'])
         setkey_product(test, 'stride_a', ['N', 'lda', 'stride_scale'])
@@ -20,6 +20,7 @@
  *
  * ************************************************************************ */
 
+#define ROCBLAS_BETA_FEATURES_API
 #ifdef WIN32
 #include <windows.h>
 //
@@ -28,6 +29,8 @@
 #include "../../library/src/include/handle.hpp"
 #include "d_vector.hpp"
 #include "utility.hpp"
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdlib>
 #include <cstring>
@@ -189,6 +192,108 @@ double get_time_us_no_sync(void)
     return (static_cast<double>(duration));
 };
 
+static size_t cache_flush_bytes = 0;
+
+void rocblas_set_cache_flush_bytes(size_t bytes)
+{
+    cache_flush_bytes = bytes;
+}
+
+size_t rocblas_get_cache_flush_bytes()
+{
+    return cache_flush_bytes;
+}
+
+namespace
+{
+    // Scrub buffer of the thread's current device, reallocated when the flush size changes
+    struct rocblas_scrub_buffer
+    {
+        void*  ptr   = nullptr;
+        size_t bytes = 0;
+        int    fill  = 0;
+
+        void* get(size_t size)
+        {
+            if(bytes != size)
+            {
+                (void)hipFree(ptr);
+                ptr   = nullptr;
+                bytes = 0;
+                if(hipMalloc(&ptr, size) == hipSuccess)
+                    bytes = size;
+            }
+            return ptr;
+        }
+
+        ~rocblas_scrub_buffer()
+        {
+            (void)hipFree(ptr);
+        }
+    };
+
+    thread_local rocblas_scrub_buffer scrub_buffer;
+}
+
+/*! \brief  Write the scrub buffer on stream, evicting the operands of the next call from the L2
+            and last level (MALL) caches */
+void rocblas_flush_device_caches(hipStream_t stream)
+{
+    void* scrub = scrub_buffer.get(cache_flush_bytes);
+    if(scrub)
+        (void)hipMemsetAsync(scrub, ++scrub_buffer.fill & 0xff, scrub_buffer.bytes, stream);
+}
+
+/*! \brief  GPU Timer(in microsecond): run func calls times on stream, each call timed by its own
+            pair of events, optionally flushing the device caches before each call. The time of
+            each call is appended to samples when it is not null; returns the sum of the times */
+double get_time_us_per_call(hipStream_t                  stream,
+                            int                          calls,
+                            const std::function<void()>& func,
+                            bool                         flush,
+                            std::vector<double>*         samples)
+{
+    hipEvent_t start, stop;
+    if(hipEventCreate(&start) != hipSuccess)
+        return ArgumentLogging::NA_value;
+    if(hipEventCreate(&stop) != hipSuccess)
+    {
+        (void)hipEventDestroy(start);
+        return ArgumentLogging::NA_value;
+    }
+
+    if(samples)
+        samples->reserve(samples->size() + calls);
+
+    double gpu_time_used = 0;
+    for(int iter = 0; iter < calls; iter++)
+    {
+        if(flush)
+            rocblas_flush_device_caches(stream);
+        (void)hipEventRecord(start, stream);
+        func();
+        (void)hipEventRecord(stop, stream);
+        (void)hipEventSynchronize(stop);
+
+        float ms = 0;
+        (void)hipEventElapsedTime(&ms, start, stop);
+        gpu_time_used += ms * 1000.0;
+        if(samples)
+            samples->push_back(ms * 1000.0);
+    }
+
+    (void)hipEventDestroy(start);
+    (void)hipEventDestroy(stop);
+    return gpu_time_used;
+}
+
+/*! \brief  GPU Timer(in microsecond): run func calls times on stream, flushing the device caches
+            before each call, and return the sum of the GPU times of the calls */
+double get_time_us_flushed(hipStream_t stream, int calls, const std::function<void()>& func)
+{
+    return get_time_us_per_call(stream, calls, func, true, nullptr);
+}
+
 /* ============================================================================================ */
 /*  device query and print out their ID and name; return number of compute-capable devices. */
 rocblas_int query_device_property()
@@ -262,16 +367,330 @@ void set_device(rocblas_int device_id)
     }
 }
 
+/*! \brief  Peak rates of device_id estimated from its properties: the memory bandwidth in GB/s
+            from the memory clock and bus width, and the FP32 vector FMA throughput in Gflops
+            from the compute units and engine clock. Returns false when the query fails. */
+bool query_device_peaks(rocblas_int device_id, double& peak_gflops, double& peak_gbps)
+{
+    hipDeviceProp_t props;
+    if(hipGetDeviceProperties(&props, device_id) != hipSuccess)
+        return false;
+
+    // clocks are in kHz; double data rate memory, 2 flops per FMA on each lane of a 64 wide SIMD
+    peak_gbps   = 2.0 * props.memoryClockRate * 1e3 * (props.memoryBusWidth / 8.0) / 1e9;
+    peak_gflops = 2.0 * 64 * props.multiProcessorCount * props.clockRate * 1e3 / 1e9;
+    return peak_gbps > 0 && peak_gflops > 0;
+}
+
+#ifdef __linux__
+// sysfs directory of the PCI device of device_id, or an empty string if it is not known
+static std::string device_sysfs_path(rocblas_int device_id)
+{
+    char bus_id[64];
+    if(hipDeviceGetPCIBusId(bus_id, sizeof(bus_id), device_id) != hipSuccess)
+        return {};
+
+    // sysfs names PCI devices with lowercase hexadecimal digits
+    std::string name(bus_id);
+    for(auto& c : name)
+        c = std::tolower(c);
+    return "/sys/bus/pci/devices/" + name;
+}
+
+// First value read from one of the files of the hwmon directory of device_id, or -1
+static double read_device_hwmon(rocblas_int device_id, std::initializer_list<const char*> files)
+{
+    std::string path = device_sysfs_path(device_id);
+    if(path.empty())
+        return -1;
+
+    // hwmon directories are numbered across the system
+    std::string hwmon = path + "/hwmon/hwmon";
+    for(int i = 0; i < 256; i++)
+        for(const char* file : files)
+        {
+            std::ifstream input(hwmon + std::to_string(i) + file);
+            uint64_t      value;
+            if(input >> value)
+                return double(value);
+        }
+    return -1;
+}
+#endif
+
+double query_device_power(rocblas_int device_id)
+{
+#ifdef __linux__
+    // the power is in microwatts
+    double microwatts = read_device_hwmon(device_id, {"/power1_average", "/power1_input"});
+    if(microwatts >= 0)
+        return microwatts * 1e-6;
+#endif
+    return -1;
+}
+
+double query_device_clock(rocblas_int device_id)
+{
+#ifdef __linux__
+    // the shader clock is in Hz
+    double hz = read_device_hwmon(device_id, {"/freq1_input"});
+    if(hz >= 0)
+        return hz * 1e-6;
+
+    // older drivers only list the DPM levels, the current one marked with a *, e.g. "1: 1700Mhz *"
+    std::string path = device_sysfs_path(device_id);
+    if(!path.empty())
+    {
+        std::ifstream levels(path + "/pp_dpm_sclk");
+        std::string   line;
+        while(std::getline(levels, line))
+        {
+            auto colon = line.find(':');
+            if(colon != std::string::npos && line.find('*') != std::string::npos)
+                return std::strtod(line.c_str() + colon + 1, nullptr);
+        }
+    }
+#endif
+    return -1;
+}
+
+double query_device_temperature(rocblas_int device_id)
+{
+#ifdef __linux__
+    // the temperatures are in millidegrees; the junction (hotspot) temperature, which the
+    // throttling follows, is temp2 where the edge temperature is temp1
+    double millidegrees = read_device_hwmon(device_id, {"/temp2_input", "/temp1_input"});
+    if(millidegrees >= 0)
+        return millidegrees * 1e-3;
+#endif
+    return -1;
+}
+
+rocblas_power_sampler::rocblas_power_sampler(bool enabled)
+{
+    int device;
+    if(!enabled || hipGetDevice(&device) != hipSuccess || query_device_power(device) < 0)
+        return;
+
+    running = true;
+    thread  = std::thread([this, device] {
+        // The driver averages the power over milliseconds, so it is sampled every millisecond
+        do
+        {
+            double sample = query_device_power(device);
+            if(sample >= 0)
+            {
+                watts += sample;
+                samples++;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        } while(running);
+    });
+}
+
+rocblas_power_sampler::~rocblas_power_sampler()
+{
+    stop();
+}
+
+double rocblas_power_sampler::stop()
+{
+    if(thread.joinable())
+    {
+        running = false;
+        thread.join();
+    }
+    return samples ? watts / samples : ArgumentLogging::NA_value;
+}
+
+rocblas_clock_sampler::rocblas_clock_sampler(bool enabled)
+{
+    int device;
+    if(!enabled || hipGetDevice(&device) != hipSuccess || query_device_clock(device) < 0)
+        return;
+
+    running = true;
+    thread  = std::thread([this, device] {
+        // The driver updates the clock level every few milliseconds
+        do
+        {
+            double mhz = query_device_clock(device);
+            if(mhz >= 0 && (min_mhz == ArgumentLogging::NA_value || mhz < min_mhz))
+                min_mhz = mhz;
+
+            double celsius = query_device_temperature(device);
+            if(celsius >= 0 && (max_celsius == ArgumentLogging::NA_value || celsius > max_celsius))
+                max_celsius = celsius;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        } while(running);
+    });
+}
+
+rocblas_clock_sampler::~rocblas_clock_sampler()
+{
+    stop();
+}
+
+double rocblas_clock_sampler::stop()
+{
+    if(thread.joinable())
+    {
+        running = false;
+        thread.join();
+    }
+    return min_mhz;
+}
+
+double rocblas_wait_stable_clock(hipStream_t stream, const std::function<void()>& func)
+{
+    int device;
+    if(hipGetDevice(&device) != hipSuccess || query_device_clock(device) < 0)
+        return -1;
+
+    std::vector<double> readings;
+    int                 calls = 1;
+    double              start = get_time_us_sync(stream);
+    double              mhz;
+    do
+    {
+        // the calls between readings are doubled until they take a millisecond
+        double batch_start = get_time_us_sync(stream);
+        for(int i = 0; i < calls; i++)
+            func();
+        if(get_time_us_sync(stream) - batch_start < 1000)
+            calls *= 2;
+
+        mhz = query_device_clock(device);
+        readings.push_back(mhz);
+        if(readings.size() >= 3)
+        {
+            auto range = std::minmax_element(readings.end() - 3, readings.end());
+            if(*range.second - *range.first <= 0.02 * *range.second)
+                break;
+        }
+    } while(get_time_us_no_sync() - start < 1e6);
+
+    return mhz;
+}
+
 /*****************
  * local handles *
  *****************/
 
+static thread_local hipStream_t t_local_handle_stream = nullptr;
+
+void rocblas_set_local_handle_stream(hipStream_t stream)
+{
+    t_local_handle_stream = stream;
+}
+
+static std::atomic<rocblas_performance_metric> local_handle_performance_metric{
+    rocblas_default_performance_metric};
+
+void rocblas_set_local_handle_performance_metric(rocblas_performance_metric metric)
+{
+    local_handle_performance_metric = metric;
+}
+
+rocblas_performance_metric rocblas_get_local_handle_performance_metric()
+{
+    return local_handle_performance_metric;
+}
+
+static std::atomic<bool> local_handle_reproducible{false};
+
+void rocblas_set_local_handle_reproducible_mode(bool reproducible)
+{
+    local_handle_reproducible = reproducible;
+}
+
+static std::atomic<bool> local_handle_compensated{false};
+
+void rocblas_set_local_handle_compensated_summation_mode(bool compensated)
+{
+    local_handle_compensated = compensated;
+}
+
+static std::atomic<rocblas_int> local_handle_trsm_refinement{0};
+
+void rocblas_set_local_handle_trsm_refinement(rocblas_int max_steps)
+{
+    local_handle_trsm_refinement = max_steps;
+}
+
+static std::atomic<bool> local_handle_managed_prefetch{false};
+
+void rocblas_set_local_handle_managed_prefetch(bool prefetch)
+{
+    local_handle_managed_prefetch = prefetch;
+}
+
+static std::atomic<rocblas_gemm_backend> local_handle_gemm_backend{rocblas_gemm_backend_default};
+
+void rocblas_set_local_handle_gemm_backend(rocblas_gemm_backend backend)
+{
+    local_handle_gemm_backend = backend;
+}
+
 rocblas_local_handle::rocblas_local_handle()
 {
     auto status = rocblas_create_handle(&m_handle);
     if(status != rocblas_status_success)
         throw std::runtime_error(rocblas_status_to_string(status));
 
+    if(t_local_handle_stream)
+    {
+        status = rocblas_set_stream(m_handle, t_local_handle_stream);
+        if(status != rocblas_status_success)
+            throw std::runtime_error(rocblas_status_to_string(status));
+    }
+
+    rocblas_performance_metric metric = local_handle_performance_metric;
+    if(metric != rocblas_default_performance_metric)
+    {
+        status = rocblas_set_performance_metric(m_handle, metric);
+        if(status != rocblas_status_success)
+            throw std::runtime_error(rocblas_status_to_string(status));
+    }
+
+    if(local_handle_reproducible)
+    {
+        status = rocblas_set_reproducible_mode(m_handle, true);
+        if(status != rocblas_status_success)
+            throw std::runtime_error(rocblas_status_to_string(status));
+    }
+
+    if(local_handle_compensated)
+    {
+        status = rocblas_set_compensated_summation_mode(m_handle, true);
+        if(status != rocblas_status_success)
+            throw std::runtime_error(rocblas_status_to_string(status));
+    }
+
+    rocblas_int trsm_refinement = local_handle_trsm_refinement;
+    if(trsm_refinement)
+    {
+        status = rocblas_set_trsm_refinement(m_handle, trsm_refinement);
+        if(status != rocblas_status_success)
+            throw std::runtime_error(rocblas_status_to_string(status));
+    }
+
+    if(local_handle_managed_prefetch)
+    {
+        status = rocblas_set_managed_prefetch(m_handle, true);
+        if(status != rocblas_status_success)
+            throw std::runtime_error(rocblas_status_to_string(status));
+    }
+
+    rocblas_gemm_backend backend = local_handle_gemm_backend;
+    if(backend != rocblas_gemm_backend_default)
+    {
+        status = rocblas_set_gemm_backend(m_handle, backend);
+        if(status != rocblas_status_success)
+            throw std::runtime_error(rocblas_status_to_string(status));
+    }
+
 #ifdef GOOGLE_TEST
     if(t_set_stream_callback)
     {
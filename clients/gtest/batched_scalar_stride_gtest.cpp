@@ -0,0 +1,101 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_batched_scalar_stride.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct batched_scalar_stride_testing : rocblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct batched_scalar_stride_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "batched_scalar_stride"))
+                testing_batched_scalar_stride<T>(arg);
+            else if(!strcmp(arg.function, "batched_scalar_stride_bad_arg"))
+                testing_batched_scalar_stride_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    struct batched_scalar_stride
+        : RocBLAS_Test<batched_scalar_stride, batched_scalar_stride_testing>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "batched_scalar_stride")
+                   || !strcmp(arg.function, "batched_scalar_stride_bad_arg");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<batched_scalar_stride> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") == nullptr)
+                name << '_' << (char)std::toupper(arg.transA) << '_' << arg.M << '_' << arg.N
+                     << '_' << arg.alpha << '_' << arg.lda << '_' << arg.incx << '_' << arg.beta
+                     << '_' << arg.incy << '_' << arg.batch_count;
+
+            return std::move(name);
+        }
+    };
+
+    TEST_P(batched_scalar_stride, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<batched_scalar_stride_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(batched_scalar_stride);
+
+} // namespace
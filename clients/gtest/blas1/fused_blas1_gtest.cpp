@@ -0,0 +1,123 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_fused_blas1.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct fused_blas1_testing : rocblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct fused_blas1_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "axpy_dot"))
+                testing_axpy_dot<T>(arg);
+            else if(!strcmp(arg.function, "axpy_dot_bad_arg"))
+                testing_axpy_dot_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "waxpby"))
+                testing_waxpby<T>(arg);
+            else if(!strcmp(arg.function, "waxpby_bad_arg"))
+                testing_waxpby_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "dot_nrm2"))
+                testing_dot_nrm2<T>(arg);
+            else if(!strcmp(arg.function, "dot_nrm2_bad_arg"))
+                testing_dot_nrm2_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    struct fused_blas1 : RocBLAS_Test<fused_blas1, fused_blas1_testing>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "axpy_dot") || !strcmp(arg.function, "axpy_dot_bad_arg")
+                   || !strcmp(arg.function, "waxpby") || !strcmp(arg.function, "waxpby_bad_arg")
+                   || !strcmp(arg.function, "dot_nrm2")
+                   || !strcmp(arg.function, "dot_nrm2_bad_arg");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<fused_blas1> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") == nullptr)
+            {
+                name << '_' << arg.N;
+
+                if(strcmp(arg.function, "dot_nrm2"))
+                    name << '_' << arg.alpha << '_' << arg.alphai;
+
+                if(!strcmp(arg.function, "waxpby"))
+                    name << '_' << arg.beta << '_' << arg.betai;
+
+                name << '_' << arg.incx << '_' << arg.incy;
+
+                if(strcmp(arg.function, "dot_nrm2"))
+                    name << '_' << (arg.algo ? arg.incy : arg.incd);
+
+                if(arg.algo)
+                    name << "_aliased";
+            }
+
+            return std::move(name);
+        }
+    };
+
+    TEST_P(fused_blas1, blas1)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<fused_blas1_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(fused_blas1);
+
+} // namespace
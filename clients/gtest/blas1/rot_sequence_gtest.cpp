@@ -0,0 +1,157 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_rot_sequence.hpp"
+#include "testing_rot_sweep.hpp"
+#include "type_dispatch.hpp"
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible rot_sequence test cases
+    enum rot_sequence_test_type
+    {
+        ROT_SEQUENCE,
+        ROT_SWEEP,
+    };
+
+    //rot_sequence test template
+    template <template <typename...> class FILTER, rot_sequence_test_type ROT_SEQUENCE_TYPE>
+    struct rot_sequence_template
+        : RocBLAS_Test<rot_sequence_template<FILTER, ROT_SEQUENCE_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<rot_sequence_template::template type_filter_functor>(
+                arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(ROT_SEQUENCE_TYPE)
+            {
+            case ROT_SEQUENCE:
+                return !strcmp(arg.function, "rot_sequence")
+                       || !strcmp(arg.function, "rot_sequence_bad_arg");
+            case ROT_SWEEP:
+                return !strcmp(arg.function, "rot_sweep")
+                       || !strcmp(arg.function, "rot_sweep_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<rot_sequence_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else if(ROT_SEQUENCE_TYPE == ROT_SEQUENCE)
+            {
+                name << '_' << arg.N << '_' << arg.K << '_' << arg.incx << '_' << arg.incy;
+            }
+            else
+            {
+                name << '_' << arg.M << '_' << arg.N << '_' << arg.lda;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct rot_sequence_testing : rocblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    // Complex rot_sequence is csrot_sequence/zdrot_sequence, with real c and s.
+    template <typename T>
+    struct rot_sequence_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "rot_sequence"))
+                testing_rot_sequence<T>(arg);
+            else if(!strcmp(arg.function, "rot_sequence_bad_arg"))
+                testing_rot_sequence_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    template <typename, typename = void>
+    struct rot_sweep_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct rot_sweep_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "rot_sweep"))
+                testing_rot_sweep<T>(arg);
+            else if(!strcmp(arg.function, "rot_sweep_bad_arg"))
+                testing_rot_sweep_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using rot_sequence = rot_sequence_template<rot_sequence_testing, ROT_SEQUENCE>;
+    TEST_P(rot_sequence, blas1)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_simple_dispatch<rot_sequence_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(rot_sequence);
+
+    using rot_sweep = rot_sequence_template<rot_sweep_testing, ROT_SWEEP>;
+    TEST_P(rot_sweep, blas1)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_simple_dispatch<rot_sweep_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(rot_sweep);
+
+} // namespace
@@ -0,0 +1,289 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_axpyi.hpp"
+#include "testing_doti.hpp"
+#include "testing_gthr.hpp"
+#include "testing_roti.hpp"
+#include "testing_sctr.hpp"
+#include "type_dispatch.hpp"
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible sparse Level 1 test cases
+    enum sparse_level1_test_type
+    {
+        AXPYI,
+        DOTI,
+        DOTCI,
+        GTHR,
+        SCTR,
+        ROTI,
+    };
+
+    //sparse Level 1 test template
+    template <template <typename...> class FILTER, sparse_level1_test_type SPARSE_LEVEL1_TYPE>
+    struct sparse_level1_template
+        : RocBLAS_Test<sparse_level1_template<FILTER, SPARSE_LEVEL1_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<sparse_level1_template::template type_filter_functor>(
+                arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(SPARSE_LEVEL1_TYPE)
+            {
+            case AXPYI:
+                return !strcmp(arg.function, "axpyi") || !strcmp(arg.function, "axpyi_bad_arg");
+            case DOTI:
+                return !strcmp(arg.function, "doti") || !strcmp(arg.function, "doti_bad_arg");
+            case DOTCI:
+                return !strcmp(arg.function, "dotci") || !strcmp(arg.function, "dotci_bad_arg");
+            case GTHR:
+                return !strcmp(arg.function, "gthr") || !strcmp(arg.function, "gthr_bad_arg");
+            case SCTR:
+                return !strcmp(arg.function, "sctr") || !strcmp(arg.function, "sctr_bad_arg");
+            case ROTI:
+                return !strcmp(arg.function, "roti") || !strcmp(arg.function, "roti_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<sparse_level1_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << arg.N << '_' << arg.K;
+
+                if(SPARSE_LEVEL1_TYPE == AXPYI)
+                    name << '_' << arg.alpha << "_" << arg.alphai;
+
+                name << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct axpyi_testing : rocblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct axpyi_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "axpyi"))
+                testing_axpyi<T>(arg);
+            else if(!strcmp(arg.function, "axpyi_bad_arg"))
+                testing_axpyi_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    template <typename, typename = void>
+    struct doti_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct doti_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "doti"))
+                testing_doti<T>(arg);
+            else if(!strcmp(arg.function, "doti_bad_arg"))
+                testing_doti_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    // dotci only has complex precisions
+    template <typename, typename = void>
+    struct dotci_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct dotci_testing<T,
+                         std::enable_if_t<std::is_same<T, rocblas_float_complex>{}
+                                          || std::is_same<T, rocblas_double_complex>{}>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "dotci"))
+                testing_dotci<T>(arg);
+            else if(!strcmp(arg.function, "dotci_bad_arg"))
+                testing_dotci_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    template <typename, typename = void>
+    struct gthr_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct gthr_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gthr"))
+                testing_gthr<T>(arg);
+            else if(!strcmp(arg.function, "gthr_bad_arg"))
+                testing_gthr_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    template <typename, typename = void>
+    struct sctr_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct sctr_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "sctr"))
+                testing_sctr<T>(arg);
+            else if(!strcmp(arg.function, "sctr_bad_arg"))
+                testing_sctr_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    // roti only has real precisions
+    template <typename, typename = void>
+    struct roti_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct roti_testing<T,
+                        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "roti"))
+                testing_roti<T>(arg);
+            else if(!strcmp(arg.function, "roti_bad_arg"))
+                testing_roti_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using axpyi = sparse_level1_template<axpyi_testing, AXPYI>;
+    TEST_P(axpyi, blas1)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_simple_dispatch<axpyi_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(axpyi);
+
+    using doti = sparse_level1_template<doti_testing, DOTI>;
+    TEST_P(doti, blas1)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_simple_dispatch<doti_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(doti);
+
+    using dotci = sparse_level1_template<dotci_testing, DOTCI>;
+    TEST_P(dotci, blas1)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_simple_dispatch<dotci_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(dotci);
+
+    using gthr = sparse_level1_template<gthr_testing, GTHR>;
+    TEST_P(gthr, blas1)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_simple_dispatch<gthr_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gthr);
+
+    using sctr = sparse_level1_template<sctr_testing, SCTR>;
+    TEST_P(sctr, blas1)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_simple_dispatch<sctr_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(sctr);
+
+    using roti = sparse_level1_template<roti_testing, ROTI>;
+    TEST_P(roti, blas1)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_simple_dispatch<roti_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(roti);
+
+} // namespace
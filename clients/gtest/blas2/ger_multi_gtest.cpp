@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_ger_multi.hpp"
+#include "type_dispatch.hpp"
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible ger_multi test cases
+    enum ger_multi_test_type
+    {
+        GER_MULTI,
+        GERC_MULTI,
+    };
+
+    //ger_multi test template
+    template <template <typename...> class FILTER, ger_multi_test_type GER_MULTI_TYPE>
+    struct ger_multi_template : RocBLAS_Test<ger_multi_template<FILTER, GER_MULTI_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<ger_multi_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(GER_MULTI_TYPE)
+            {
+            case GER_MULTI:
+                return !strcmp(arg.function, "ger_multi")
+                       || !strcmp(arg.function, "ger_multi_bad_arg");
+            case GERC_MULTI:
+                return !strcmp(arg.function, "gerc_multi")
+                       || !strcmp(arg.function, "gerc_multi_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<ger_multi_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << arg.M << '_' << arg.N << '_' << arg.K << '_' << arg.alpha << '_'
+                     << arg.ldb << '_' << arg.ldc << '_' << arg.lda;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct ger_multi_testing : rocblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    // Complex ger_multi is geru_multi.
+    template <typename T>
+    struct ger_multi_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "ger_multi"))
+                testing_ger_multi<T>(arg);
+            else if(!strcmp(arg.function, "ger_multi_bad_arg"))
+                testing_ger_multi_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    template <typename, typename = void>
+    struct gerc_multi_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct gerc_multi_testing<T,
+                              std::enable_if_t<std::is_same<T, rocblas_float_complex>{}
+                                               || std::is_same<T, rocblas_double_complex>{}>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gerc_multi"))
+                testing_gerc_multi<T>(arg);
+            else if(!strcmp(arg.function, "gerc_multi_bad_arg"))
+                testing_gerc_multi_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using ger_multi = ger_multi_template<ger_multi_testing, GER_MULTI>;
+    TEST_P(ger_multi, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<ger_multi_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(ger_multi);
+
+    using gerc_multi = ger_multi_template<gerc_multi_testing, GERC_MULTI>;
+    TEST_P(gerc_multi, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<gerc_multi_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gerc_multi);
+
+} // namespace
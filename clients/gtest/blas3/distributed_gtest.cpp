@@ -0,0 +1,140 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_distributed.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible distributed test cases
+    enum distributed_test_type
+    {
+        DIST_GEMM,
+        DIST_SYRK,
+    };
+
+    // distributed test template
+    template <template <typename...> class FILTER, distributed_test_type DIST_TYPE>
+    struct distributed_template : RocBLAS_Test<distributed_template<FILTER, DIST_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<distributed_template::template type_filter_functor>(
+                arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(DIST_TYPE)
+            {
+            case DIST_GEMM:
+                return !strcmp(arg.function, "dist_gemm")
+                       || !strcmp(arg.function, "dist_gemm_bad_arg");
+            case DIST_SYRK:
+                return !strcmp(arg.function, "dist_syrk")
+                       || !strcmp(arg.function, "dist_syrk_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<distributed_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                if(DIST_TYPE == DIST_GEMM)
+                    name << '_' << arg.M;
+                else
+                    name << '_' << (char)std::toupper(arg.uplo);
+
+                name << '_' << arg.N << '_' << arg.K << '_' << arg.alpha << '_' << arg.beta;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary types are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename T, typename = void>
+    struct distributed_testing : rocblas_test_invalid
+    {
+    };
+
+    // The distributed functions have the precisions s, d, c and z
+    template <typename T>
+    struct distributed_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "dist_gemm"))
+                testing_dist_gemm<T>(arg);
+            else if(!strcmp(arg.function, "dist_gemm_bad_arg"))
+                testing_dist_gemm_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "dist_syrk"))
+                testing_dist_syrk<T>(arg);
+            else if(!strcmp(arg.function, "dist_syrk_bad_arg"))
+                testing_dist_syrk_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    // Each test creates the handles of the processes of its grid on their devices, so it does
+    // not run on the threads and streams of the other tests
+    using dist_gemm = distributed_template<distributed_testing, DIST_GEMM>;
+    TEST_P(dist_gemm, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<distributed_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(dist_gemm);
+
+    using dist_syrk = distributed_template<distributed_testing, DIST_SYRK>;
+    TEST_P(dist_syrk, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<distributed_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(dist_syrk);
+
+} // namespace
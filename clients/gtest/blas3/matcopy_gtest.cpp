@@ -0,0 +1,165 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_imatcopy.hpp"
+#include "testing_omatcopy_ex.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible matcopy test cases
+    enum matcopy_test_type
+    {
+        IMATCOPY,
+        OMATCOPY_EX,
+    };
+
+    //matcopy test template
+    template <template <typename...> class FILTER, matcopy_test_type MATCOPY_TYPE>
+    struct matcopy_template : RocBLAS_Test<matcopy_template<FILTER, MATCOPY_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_matcopy_dispatch<matcopy_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(MATCOPY_TYPE)
+            {
+            case IMATCOPY:
+                return !strcmp(arg.function, "imatcopy")
+                       || !strcmp(arg.function, "imatcopy_bad_arg");
+            case OMATCOPY_EX:
+                return !strcmp(arg.function, "omatcopy_ex")
+                       || !strcmp(arg.function, "omatcopy_ex_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<matcopy_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(MATCOPY_TYPE == OMATCOPY_EX)
+                name << '_' << rocblas_datatype2string(arg.b_type) << '_'
+                     << rocblas_datatype2string(arg.compute_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << (char)std::toupper(arg.transA) << '_' << arg.M << '_' << arg.N << '_'
+                     << arg.alpha << '_' << arg.lda << '_' << arg.ldb << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed fourth parameter is used for enable_if_t below.
+    template <typename T, typename Tb = T, typename Tex = Tb, typename = void>
+    struct imatcopy_testing : rocblas_test_invalid
+    {
+    };
+
+    // imatcopy has the precisions s, d, c and z, the types of A and op(A) being the same
+    template <typename T, typename Tb, typename Tex>
+    struct imatcopy_testing<
+        T,
+        Tb,
+        Tex,
+        std::enable_if_t<std::is_same<T, Tb>{} && std::is_same<Tb, Tex>{}
+                         && (std::is_same<T, float>{} || std::is_same<T, double>{}
+                             || std::is_same<T, rocblas_float_complex>{}
+                             || std::is_same<T, rocblas_double_complex>{})>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "imatcopy"))
+                testing_imatcopy<T>(arg);
+            else if(!strcmp(arg.function, "imatcopy_bad_arg"))
+                testing_imatcopy_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    template <typename Ta, typename Tb = Ta, typename Tex = Tb, typename = void>
+    struct omatcopy_ex_testing : rocblas_test_invalid
+    {
+    };
+
+    // omatcopy_ex has the precisions s, d, c and z, half and bfloat16 A or B with float
+    // computation, and float and double A and B with double computation
+    template <typename Ta, typename Tb, typename Tex>
+    struct omatcopy_ex_testing<
+        Ta,
+        Tb,
+        Tex,
+        std::enable_if_t<(std::is_same<Ta, Tb>{} && std::is_same<Tb, Tex>{}
+                          && (std::is_same<Ta, float>{} || std::is_same<Ta, double>{}
+                              || std::is_same<Ta, rocblas_float_complex>{}
+                              || std::is_same<Ta, rocblas_double_complex>{}))
+                         || !std::is_same<Ta, Tex>{} || !std::is_same<Tb, Tex>{}>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "omatcopy_ex"))
+                testing_omatcopy_ex<Ta, Tb, Tex>(arg);
+            else if(!strcmp(arg.function, "omatcopy_ex_bad_arg"))
+                testing_omatcopy_ex_bad_arg<Ta, Tb, Tex>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using imatcopy = matcopy_template<imatcopy_testing, IMATCOPY>;
+    TEST_P(imatcopy, blas3)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_matcopy_dispatch<imatcopy_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(imatcopy);
+
+    using omatcopy_ex = matcopy_template<omatcopy_ex_testing, OMATCOPY_EX>;
+    TEST_P(omatcopy_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_matcopy_dispatch<omatcopy_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(omatcopy_ex);
+
+} // namespace
@@ -0,0 +1,207 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_gemm_offload.hpp"
+#include "testing_syrk_offload.hpp"
+#include "testing_trsm_offload.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible offload test cases
+    enum offload_test_type
+    {
+        GEMM_OFFLOAD,
+        SYRK_OFFLOAD,
+        TRSM_OFFLOAD,
+    };
+
+    //offload test template
+    template <template <typename...> class FILTER, offload_test_type OFFLOAD_TYPE>
+    struct offload_template : RocBLAS_Test<offload_template<FILTER, OFFLOAD_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<offload_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(OFFLOAD_TYPE)
+            {
+            case GEMM_OFFLOAD:
+                return !strcmp(arg.function, "gemm_offload")
+                       || !strcmp(arg.function, "gemm_offload_bad_arg");
+            case SYRK_OFFLOAD:
+                return !strcmp(arg.function, "syrk_offload")
+                       || !strcmp(arg.function, "syrk_offload_bad_arg");
+            case TRSM_OFFLOAD:
+                return !strcmp(arg.function, "trsm_offload")
+                       || !strcmp(arg.function, "trsm_offload_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<offload_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                switch(OFFLOAD_TYPE)
+                {
+                case GEMM_OFFLOAD:
+                    name << '_' << (char)std::toupper(arg.transA) << (char)std::toupper(arg.transB)
+                         << '_' << arg.M << '_' << arg.N << '_' << arg.K << '_' << arg.alpha
+                         << '_' << arg.lda << '_' << arg.ldb << '_' << arg.beta << '_' << arg.ldc;
+                    break;
+                case SYRK_OFFLOAD:
+                    name << '_' << (char)std::toupper(arg.uplo) << (char)std::toupper(arg.transA)
+                         << '_' << arg.N << '_' << arg.K << '_' << arg.alpha << '_' << arg.lda
+                         << '_' << arg.beta << '_' << arg.ldc;
+                    break;
+                case TRSM_OFFLOAD:
+                    name << '_' << (char)std::toupper(arg.side) << (char)std::toupper(arg.uplo)
+                         << (char)std::toupper(arg.transA) << (char)std::toupper(arg.diag) << '_'
+                         << arg.M << '_' << arg.N << '_' << arg.alpha << '_' << arg.lda << '_'
+                         << arg.ldb;
+                    break;
+                }
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct gemm_offload_testing : rocblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct gemm_offload_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_offload"))
+                testing_gemm_offload<T>(arg);
+            else if(!strcmp(arg.function, "gemm_offload_bad_arg"))
+                testing_gemm_offload_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    template <typename, typename = void>
+    struct syrk_offload_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct syrk_offload_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "syrk_offload"))
+                testing_syrk_offload<T>(arg);
+            else if(!strcmp(arg.function, "syrk_offload_bad_arg"))
+                testing_syrk_offload_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    template <typename, typename = void>
+    struct trsm_offload_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct trsm_offload_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "trsm_offload"))
+                testing_trsm_offload<T>(arg);
+            else if(!strcmp(arg.function, "trsm_offload_bad_arg"))
+                testing_trsm_offload_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemm_offload = offload_template<gemm_offload_testing, GEMM_OFFLOAD>;
+    TEST_P(gemm_offload, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<gemm_offload_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_offload);
+
+    using syrk_offload = offload_template<syrk_offload_testing, SYRK_OFFLOAD>;
+    TEST_P(syrk_offload, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<syrk_offload_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(syrk_offload);
+
+    using trsm_offload = offload_template<trsm_offload_testing, TRSM_OFFLOAD>;
+    TEST_P(trsm_offload, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<trsm_offload_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(trsm_offload);
+
+} // namespace
@@ -19,8 +19,12 @@
  * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  *
  * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API
 #include "blas1_ex_gtest.hpp"
 
+#include "testing_axpby_batched_ex.hpp"
+#include "testing_axpby_ex.hpp"
+#include "testing_axpby_strided_batched_ex.hpp"
 #include "testing_axpy_batched_ex.hpp"
 #include "testing_axpy_ex.hpp"
 #include "testing_axpy_strided_batched_ex.hpp"
@@ -56,8 +60,15 @@ namespace
             }
             else
             {
-                bool is_batched = (BLAS1_EX == blas1_ex::axpy_batched_ex);
-                bool is_strided = (BLAS1_EX == blas1_ex::axpy_strided_batched_ex);
+                bool is_batched = (BLAS1_EX == blas1_ex::axpy_batched_ex
+                                   || BLAS1_EX == blas1_ex::axpby_batched_ex
+                                   || BLAS1_EX == blas1_ex::copy_scal_batched_ex);
+                bool is_strided = (BLAS1_EX == blas1_ex::axpy_strided_batched_ex
+                                   || BLAS1_EX == blas1_ex::axpby_strided_batched_ex
+                                   || BLAS1_EX == blas1_ex::copy_scal_strided_batched_ex);
+                bool is_axpby   = (BLAS1_EX == blas1_ex::axpby_ex
+                                   || BLAS1_EX == blas1_ex::axpby_batched_ex
+                                   || BLAS1_EX == blas1_ex::axpby_strided_batched_ex);
 
                 name << rocblas_datatype2string(arg.a_type) << '_'
                      << rocblas_datatype2string(arg.b_type);
@@ -70,6 +81,9 @@ namespace
 
                 name << '_' << arg.alpha << '_' << arg.alphai;
 
+                if(is_axpby)
+                    name << '_' << arg.beta << '_' << arg.betai;
+
                 name << '_' << arg.incx;
 
                 if(is_strided)
@@ -91,27 +105,52 @@ namespace
         }
     };
 
+    // Types of axpy_ex, also those of axpby_ex and copy_scal_ex
+    // T1 is alpha_type T2 is x_type, T3 is y_type, T4 is execution_type
+    template <typename T1, typename T2, typename T3, typename T4>
+    using axpy_ex_types = std::integral_constant<
+        bool,
+        (std::is_same<T1, T2>{} && std::is_same<T2, T3>{} && std::is_same<T3, T4>{}
+         && (std::is_same<T1, float>{} || std::is_same<T1, double>{}
+             || std::is_same<T1, rocblas_half>{} || std::is_same<T1, rocblas_float_complex>{}
+             || std::is_same<T1, rocblas_double_complex>{}))
+            || (std::is_same<T1, T2>{} && std::is_same<T2, T3>{}
+                && std::is_same<T1, rocblas_half>{} && std::is_same<T4, float>{})
+            || (std::is_same<T2, T3>{} && std::is_same<T1, T4>{}
+                && std::is_same<T2, rocblas_half>{} && std::is_same<T1, float>{})
+            || (std::is_same<T1, T2>{} && std::is_same<T2, T3>{} && std::is_same<T4, float>{}
+                && (std::is_same<T1, rocblas_bfloat16>{}))
+            || (std::is_same<T1, float>{} && std::is_same<T2, rocblas_bfloat16>{}
+                && std::is_same<T2, T3>{} && (std::is_same<T1, T4>{}))>;
+
+    // copy_scal_ex also converts between x and y in the precision of alpha
+    template <typename T1, typename T2, typename T3, typename T4>
+    using copy_scal_ex_types = std::integral_constant<
+        bool,
+        axpy_ex_types<T1, T2, T3, T4>{}
+            || (std::is_same<T1, float>{} && std::is_same<T1, T4>{}
+                && ((std::is_same<T2, float>{}
+                     && (std::is_same<T3, rocblas_half>{} || std::is_same<T3, rocblas_bfloat16>{}))
+                    || (std::is_same<T3, float>{}
+                        && (std::is_same<T2, rocblas_half>{}
+                            || std::is_same<T2, rocblas_bfloat16>{}))))
+            || (std::is_same<T1, double>{} && std::is_same<T1, T4>{}
+                && ((std::is_same<T2, double>{} && std::is_same<T3, float>{})
+                    || (std::is_same<T2, float>{} && std::is_same<T3, double>{})))>;
+
     // This tells whether the BLAS1_EX tests are enabled
     // Appears that we will need up to 4 template variables (see dot)
     template <blas1_ex BLAS1_EX, typename T1, typename T2, typename T3, typename T4>
     using blas1_ex_enabled = std::integral_constant<
         bool,
-        // axpy_ex
-        // T1 is alpha_type T2 is x_type, T3 is y_type, T4 is execution_type
         ((BLAS1_EX == blas1_ex::axpy_ex || BLAS1_EX == blas1_ex::axpy_batched_ex
-          || BLAS1_EX == blas1_ex::axpy_strided_batched_ex)
-         && ((std::is_same<T1, T2>{} && std::is_same<T2, T3>{} && std::is_same<T3, T4>{}
-              && (std::is_same<T1, float>{} || std::is_same<T1, double>{}
-                  || std::is_same<T1, rocblas_half>{} || std::is_same<T1, rocblas_float_complex>{}
-                  || std::is_same<T1, rocblas_double_complex>{}))
-             || (std::is_same<T1, T2>{} && std::is_same<T2, T3>{}
-                 && std::is_same<T1, rocblas_half>{} && std::is_same<T4, float>{})
-             || (std::is_same<T2, T3>{} && std::is_same<T1, T4>{}
-                 && std::is_same<T2, rocblas_half>{} && std::is_same<T1, float>{})
-             || (std::is_same<T1, T2>{} && std::is_same<T2, T3>{} && std::is_same<T4, float>{}
-                 && (std::is_same<T1, rocblas_bfloat16>{}))
-             || (std::is_same<T1, float>{} && std::is_same<T2, rocblas_bfloat16>{}
-                 && std::is_same<T2, T3>{} && (std::is_same<T1, T4>{}))))>;
+          || BLAS1_EX == blas1_ex::axpy_strided_batched_ex || BLAS1_EX == blas1_ex::axpby_ex
+          || BLAS1_EX == blas1_ex::axpby_batched_ex
+          || BLAS1_EX == blas1_ex::axpby_strided_batched_ex)
+         && axpy_ex_types<T1, T2, T3, T4>{})
+            || ((BLAS1_EX == blas1_ex::copy_scal_ex || BLAS1_EX == blas1_ex::copy_scal_batched_ex
+                 || BLAS1_EX == blas1_ex::copy_scal_strided_batched_ex)
+                && copy_scal_ex_types<T1, T2, T3, T4>{})>;
 
 // Creates tests for one of the BLAS 1 functions
 // ARG passes 1-3 template arguments to the testing_* function
@@ -169,5 +208,11 @@ namespace
     BLAS1_EX_TESTING(axpy_ex, ARG4)
     BLAS1_EX_TESTING(axpy_batched_ex, ARG4)
     BLAS1_EX_TESTING(axpy_strided_batched_ex, ARG4)
+    BLAS1_EX_TESTING(axpby_ex, ARG4)
+    BLAS1_EX_TESTING(axpby_batched_ex, ARG4)
+    BLAS1_EX_TESTING(axpby_strided_batched_ex, ARG4)
+    BLAS1_EX_TESTING(copy_scal_ex, ARG4)
+    BLAS1_EX_TESTING(copy_scal_batched_ex, ARG4)
+    BLAS1_EX_TESTING(copy_scal_strided_batched_ex, ARG4)
 
 } // namespace
@@ -29,12 +29,20 @@ enum class blas1_ex
     axpy_ex,
     axpy_batched_ex,
     axpy_strided_batched_ex,
+    axpby_ex,
+    axpby_batched_ex,
+    axpby_strided_batched_ex,
+    copy_scal_ex,
+    copy_scal_batched_ex,
+    copy_scal_strided_batched_ex,
     dot_ex,
     dotc_ex,
     dot_batched_ex,
     dotc_batched_ex,
     dot_strided_batched_ex,
     dotc_strided_batched_ex,
+    mdot_batched_ex,
+    mdotc_batched_ex,
     nrm2_ex,
     nrm2_batched_ex,
     nrm2_strided_batched_ex,
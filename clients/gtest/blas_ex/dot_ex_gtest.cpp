@@ -19,11 +19,13 @@
  * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  *
  * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API
 #include "blas1_ex_gtest.hpp"
 
 #include "testing_dot_batched_ex.hpp"
 #include "testing_dot_ex.hpp"
 #include "testing_dot_strided_batched_ex.hpp"
+#include "testing_mdot_batched_ex.hpp"
 
 namespace
 {
@@ -58,6 +60,8 @@ namespace
             {
                 bool is_batched = (BLAS1_EX == blas1_ex::dot_batched_ex);
                 bool is_strided = (BLAS1_EX == blas1_ex::dot_strided_batched_ex);
+                bool is_mdot    = (BLAS1_EX == blas1_ex::mdot_batched_ex
+                                || BLAS1_EX == blas1_ex::mdotc_batched_ex);
 
                 name << rocblas_datatype2string(arg.a_type) << '_'
                      << rocblas_datatype2string(arg.b_type);
@@ -68,6 +72,9 @@ namespace
 
                 name << '_' << arg.N;
 
+                if(is_mdot)
+                    name << '_' << arg.K;
+
                 name << '_' << arg.incx;
 
                 if(is_strided)
@@ -99,7 +106,8 @@ namespace
         // T1 is x_type, T2 is y_type, T3 is result_type, T4 is execution_type
         ((BLAS1_EX == blas1_ex::dot_ex || BLAS1_EX == blas1_ex::dot_batched_ex
           || BLAS1_EX == blas1_ex::dot_strided_batched_ex || BLAS1_EX == blas1_ex::dotc_ex
-          || BLAS1_EX == blas1_ex::dotc_batched_ex || BLAS1_EX == blas1_ex::dotc_strided_batched_ex)
+          || BLAS1_EX == blas1_ex::dotc_batched_ex || BLAS1_EX == blas1_ex::dotc_strided_batched_ex
+          || BLAS1_EX == blas1_ex::mdot_batched_ex || BLAS1_EX == blas1_ex::mdotc_batched_ex)
          && ((std::is_same<T1, T2>{} && std::is_same<T2, T3>{} && std::is_same<T3, T4>{}
               && (std::is_same<T1, float>{} || std::is_same<T1, double>{}
                   || std::is_same<T1, rocblas_half>{} || std::is_same<T1, rocblas_float_complex>{}
@@ -168,5 +176,7 @@ namespace
     BLAS1_EX_TESTING(dotc_ex, ARG4)
     BLAS1_EX_TESTING(dotc_batched_ex, ARG4)
     BLAS1_EX_TESTING(dotc_strided_batched_ex, ARG4)
+    BLAS1_EX_TESTING(mdot_batched_ex, ARG4)
+    BLAS1_EX_TESTING(mdotc_batched_ex, ARG4)
 
 } // namespace
@@ -74,6 +74,10 @@ namespace
                 name << "min_plus";
             else if(rocblas_geam_ex_operation(arg.geam_ex_op) == rocblas_geam_ex_operation_plus_min)
                 name << "plus_min";
+            else if(rocblas_geam_ex_operation(arg.geam_ex_op) == rocblas_geam_ex_operation_max_plus)
+                name << "max_plus";
+            else if(rocblas_geam_ex_operation(arg.geam_ex_op) == rocblas_geam_ex_operation_max_min)
+                name << "max_min";
 
             // No support for mixed precision
             name << '_' << rocblas_datatype2string(arg.a_type);
@@ -0,0 +1,110 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_gemm_block_sparse_ex.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // gemm_block_sparse_ex test template
+    template <template <typename...> class FILTER>
+    struct gemm_block_sparse_ex_template
+        : RocBLAS_Test<gemm_block_sparse_ex_template<FILTER>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<
+                gemm_block_sparse_ex_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "gemm_block_sparse_ex")
+                   || !strcmp(arg.function, "gemm_block_sparse_ex_bad_arg");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<gemm_block_sparse_ex_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << (char)std::toupper(arg.transB) << '_' << arg.M << '_' << arg.N
+                     << '_' << arg.K << '_' << arg.lda << '_' << arg.alpha << '_' << arg.alphai
+                     << '_' << arg.ldb << '_' << arg.beta << '_' << arg.betai << '_' << arg.ldc
+                     << '_' << arg.ldd;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct gemm_block_sparse_ex_testing : rocblas_test_invalid
+    {
+    };
+
+    // A single type for A, B, C, D and the computation
+    template <typename T>
+    struct gemm_block_sparse_ex_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_block_sparse_ex"))
+                testing_gemm_block_sparse_ex<T>(arg);
+            else if(!strcmp(arg.function, "gemm_block_sparse_ex_bad_arg"))
+                testing_gemm_block_sparse_ex_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemm_block_sparse_ex = gemm_block_sparse_ex_template<gemm_block_sparse_ex_testing>;
+    TEST_P(gemm_block_sparse_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(
+            rocblas_simple_dispatch<gemm_block_sparse_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_block_sparse_ex);
+
+} // namespace
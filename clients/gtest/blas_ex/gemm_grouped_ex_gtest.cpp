@@ -0,0 +1,139 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_gemm_grouped_ex.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible gemm_grouped_ex test cases
+    enum gemm_grouped_ex_test_type
+    {
+        GEMM_GROUPED_EX,
+        GEMM_GROUPED_TRANS_EX,
+    };
+
+    // gemm_grouped_ex test template
+    template <template <typename...> class FILTER, gemm_grouped_ex_test_type GEMM_GROUPED_TYPE>
+    struct gemm_grouped_ex_template
+        : RocBLAS_Test<gemm_grouped_ex_template<FILTER, GEMM_GROUPED_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_gemm_dispatch<gemm_grouped_ex_template::template type_filter_functor>(
+                arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(GEMM_GROUPED_TYPE)
+            {
+            case GEMM_GROUPED_EX:
+                return !strcmp(arg.function, "gemm_grouped_ex")
+                       || !strcmp(arg.function, "gemm_grouped_ex_bad_arg");
+            case GEMM_GROUPED_TRANS_EX:
+                return !strcmp(arg.function, "gemm_grouped_trans_ex")
+                       || !strcmp(arg.function, "gemm_grouped_trans_ex_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<gemm_grouped_ex_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << (char)std::toupper(arg.transA) << (char)std::toupper(arg.transB)
+                     << '_' << arg.M << '_' << arg.N << '_' << arg.K << '_' << arg.alpha << '_'
+                     << arg.beta << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed fourth parameter is used for enable_if_t below.
+    template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+    struct gemm_grouped_ex_testing : rocblas_test_invalid
+    {
+    };
+
+    // The precisions computed by the grouped source kernels, with or without Tensile
+    template <typename Ti, typename To, typename Tc>
+    struct gemm_grouped_ex_testing<
+        Ti,
+        To,
+        Tc,
+        std::enable_if_t<std::is_same<Ti, To>{} && std::is_same<To, Tc>{}
+                         && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+                             || std::is_same<Ti, rocblas_float_complex>{}
+                             || std::is_same<Ti, rocblas_double_complex>{})>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_grouped_ex"))
+                testing_gemm_grouped_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_grouped_ex_bad_arg"))
+                testing_gemm_grouped_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_grouped_trans_ex"))
+                testing_gemm_grouped_trans_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_grouped_trans_ex_bad_arg"))
+                testing_gemm_grouped_trans_ex_bad_arg<Ti, To, Tc>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemm_grouped_ex = gemm_grouped_ex_template<gemm_grouped_ex_testing, GEMM_GROUPED_EX>;
+    TEST_P(gemm_grouped_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<gemm_grouped_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_grouped_ex);
+
+    using gemm_grouped_trans_ex
+        = gemm_grouped_ex_template<gemm_grouped_ex_testing, GEMM_GROUPED_TRANS_EX>;
+    TEST_P(gemm_grouped_trans_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<gemm_grouped_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_grouped_trans_ex);
+
+} // namespace
@@ -0,0 +1,108 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_gemm_real_complex.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // gemm_ex of a real A by a complex B, C and D test template
+    template <template <typename...> class FILTER>
+    struct gemm_real_complex_template : RocBLAS_Test<gemm_real_complex_template<FILTER>, FILTER>
+    {
+        // Filter for which types apply to this suite, on the real type of A
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<
+                gemm_real_complex_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "gemm_real_complex")
+                   || !strcmp(arg.function, "gemm_real_complex_bad_arg");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<gemm_real_complex_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type) << '_'
+                 << rocblas_datatype2string(arg.compute_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << (char)std::toupper(arg.transA) << (char)std::toupper(arg.transB)
+                     << '_' << arg.M << '_' << arg.N << '_' << arg.K << '_' << arg.alpha << '_'
+                     << arg.alphai << '_' << arg.lda << '_' << arg.ldb << '_' << arg.beta << '_'
+                     << arg.betai << '_' << arg.ldc << '_' << arg.ldd << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct gemm_real_complex_testing : rocblas_test_invalid
+    {
+    };
+
+    // A of float or double, B, C, D and the computation of the complex type of the same precision
+    template <typename T>
+    struct gemm_real_complex_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_real_complex"))
+                testing_gemm_real_complex<T>(arg);
+            else if(!strcmp(arg.function, "gemm_real_complex_bad_arg"))
+                testing_gemm_real_complex_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemm_real_complex = gemm_real_complex_template<gemm_real_complex_testing>;
+    TEST_P(gemm_real_complex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_simple_dispatch<gemm_real_complex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_real_complex);
+
+} // namespace
@@ -0,0 +1,116 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_gemm_warmup.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed fourth parameter is used for enable_if_t below.
+    template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+    struct gemm_warmup_testing : rocblas_test_invalid
+    {
+    };
+
+    // The type combinations of rocblas_gemm_ex whose code objects are preloaded
+    template <typename Ti, typename To, typename Tc>
+    struct gemm_warmup_testing<
+        Ti,
+        To,
+        Tc,
+        std::enable_if_t<
+            (std::is_same<Ti, To>{} && std::is_same<To, Tc>{}
+             && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+                 || std::is_same<Ti, rocblas_half>{} || std::is_same<Ti, rocblas_float_complex>{}
+                 || std::is_same<Ti, rocblas_double_complex>{}))
+            || (std::is_same<Tc, float>{}
+                && (std::is_same<Ti, rocblas_half>{} || std::is_same<Ti, rocblas_bfloat16>{})
+                && (std::is_same<To, Ti>{} || std::is_same<To, float>{}))
+            || (std::is_same<Ti, int8_t>{} && std::is_same<To, int32_t>{}
+                && std::is_same<Tc, int32_t>{})>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_warmup"))
+                testing_gemm_warmup<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_warmup_bad_arg"))
+                testing_gemm_warmup_bad_arg<Ti, To, Tc>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    struct gemm_warmup : RocBLAS_Test<gemm_warmup, gemm_warmup_testing>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_gemm_dispatch<type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "gemm_warmup")
+                   || !strcmp(arg.function, "gemm_warmup_bad_arg");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<gemm_warmup> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type) << rocblas_datatype2string(arg.c_type)
+                 << rocblas_datatype2string(arg.compute_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << (char)std::toupper(arg.transA) << (char)std::toupper(arg.transB)
+                     << '_' << arg.M << '_' << arg.N << '_' << arg.K << '_' << arg.alpha << '_'
+                     << arg.lda << '_' << arg.ldb << '_' << arg.beta << '_' << arg.ldc << '_'
+                     << arg.ldd << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    TEST_P(gemm_warmup, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<gemm_warmup_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_warmup);
+
+} // namespace
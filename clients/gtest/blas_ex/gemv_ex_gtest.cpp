@@ -0,0 +1,173 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_gemv_batched_ex.hpp"
+#include "testing_gemv_ex.hpp"
+#include "testing_gemv_strided_batched_ex.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible gemv_ex test cases
+    enum gemv_ex_test_type
+    {
+        GEMV_EX,
+        GEMV_BATCHED_EX,
+        GEMV_STRIDED_BATCHED_EX,
+    };
+
+    // gemv_ex test template
+    template <template <typename...> class FILTER, gemv_ex_test_type GEMV_EX_TYPE>
+    struct gemv_ex_template : RocBLAS_Test<gemv_ex_template<FILTER, GEMV_EX_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_gemm_dispatch<gemv_ex_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(GEMV_EX_TYPE)
+            {
+            case GEMV_EX:
+                return !strcmp(arg.function, "gemv_ex") || !strcmp(arg.function, "gemv_ex_bad_arg");
+            case GEMV_BATCHED_EX:
+                return !strcmp(arg.function, "gemv_batched_ex")
+                       || !strcmp(arg.function, "gemv_batched_ex_bad_arg");
+            case GEMV_STRIDED_BATCHED_EX:
+                return !strcmp(arg.function, "gemv_strided_batched_ex")
+                       || !strcmp(arg.function, "gemv_strided_batched_ex_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<gemv_ex_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type) << '_'
+                 << rocblas_datatype2string(arg.c_type) << '_'
+                 << rocblas_datatype2string(arg.compute_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << (char)std::toupper(arg.transA) << '_' << arg.M << '_' << arg.N << '_'
+                     << arg.alpha << '_' << arg.lda;
+
+                if(GEMV_EX_TYPE == GEMV_STRIDED_BATCHED_EX)
+                    name << '_' << arg.stride_a;
+
+                name << '_' << arg.incx;
+
+                if(GEMV_EX_TYPE == GEMV_STRIDED_BATCHED_EX)
+                    name << '_' << arg.stride_x;
+
+                name << '_' << arg.beta << '_' << arg.incy;
+
+                if(GEMV_EX_TYPE == GEMV_STRIDED_BATCHED_EX)
+                    name << '_' << arg.stride_y;
+
+                if(GEMV_EX_TYPE == GEMV_STRIDED_BATCHED_EX || GEMV_EX_TYPE == GEMV_BATCHED_EX)
+                    name << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed fourth parameter is used for enable_if_t below.
+    template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+    struct gemv_ex_testing : rocblas_test_invalid
+    {
+    };
+
+    // The precisions of gemv, and half or bfloat16 A and x with float computation
+    // and y of either the input type or float.
+    template <typename Ti, typename To, typename Tc>
+    struct gemv_ex_testing<
+        Ti,
+        To,
+        Tc,
+        std::enable_if_t<(std::is_same<Ti, To>{} && std::is_same<To, Tc>{}
+                          && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+                              || std::is_same<Ti, rocblas_float_complex>{}
+                              || std::is_same<Ti, rocblas_double_complex>{}))
+                         || ((std::is_same<Ti, rocblas_half>{}
+                              || std::is_same<Ti, rocblas_bfloat16>{})
+                             && (std::is_same<To, Ti>{} || std::is_same<To, float>{})
+                             && std::is_same<Tc, float>{})>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemv_ex"))
+                testing_gemv_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemv_ex_bad_arg"))
+                testing_gemv_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemv_batched_ex"))
+                testing_gemv_batched_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemv_batched_ex_bad_arg"))
+                testing_gemv_batched_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemv_strided_batched_ex"))
+                testing_gemv_strided_batched_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemv_strided_batched_ex_bad_arg"))
+                testing_gemv_strided_batched_ex_bad_arg<Ti, To, Tc>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemv_ex = gemv_ex_template<gemv_ex_testing, GEMV_EX>;
+    TEST_P(gemv_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<gemv_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemv_ex);
+
+    using gemv_batched_ex = gemv_ex_template<gemv_ex_testing, GEMV_BATCHED_EX>;
+    TEST_P(gemv_batched_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<gemv_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemv_batched_ex);
+
+    using gemv_strided_batched_ex = gemv_ex_template<gemv_ex_testing, GEMV_STRIDED_BATCHED_EX>;
+    TEST_P(gemv_strided_batched_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<gemv_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemv_strided_batched_ex);
+
+} // namespace
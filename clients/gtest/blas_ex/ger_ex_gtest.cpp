@@ -0,0 +1,171 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_ger_batched_ex.hpp"
+#include "testing_ger_ex.hpp"
+#include "testing_ger_strided_batched_ex.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible ger_ex test cases
+    enum ger_ex_test_type
+    {
+        GER_EX,
+        GER_BATCHED_EX,
+        GER_STRIDED_BATCHED_EX,
+    };
+
+    // ger_ex test template
+    template <template <typename...> class FILTER, ger_ex_test_type GER_EX_TYPE>
+    struct ger_ex_template : RocBLAS_Test<ger_ex_template<FILTER, GER_EX_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_gemm_dispatch<ger_ex_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(GER_EX_TYPE)
+            {
+            case GER_EX:
+                return !strcmp(arg.function, "ger_ex") || !strcmp(arg.function, "ger_ex_bad_arg");
+            case GER_BATCHED_EX:
+                return !strcmp(arg.function, "ger_batched_ex")
+                       || !strcmp(arg.function, "ger_batched_ex_bad_arg");
+            case GER_STRIDED_BATCHED_EX:
+                return !strcmp(arg.function, "ger_strided_batched_ex")
+                       || !strcmp(arg.function, "ger_strided_batched_ex_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<ger_ex_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type) << '_'
+                 << rocblas_datatype2string(arg.compute_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << arg.M << '_' << arg.N << '_' << arg.alpha << '_' << arg.lda;
+
+                if(GER_EX_TYPE == GER_STRIDED_BATCHED_EX)
+                    name << '_' << arg.stride_a;
+
+                name << '_' << arg.incx;
+
+                if(GER_EX_TYPE == GER_STRIDED_BATCHED_EX)
+                    name << '_' << arg.stride_x;
+
+                name << '_' << arg.incy;
+
+                if(GER_EX_TYPE == GER_STRIDED_BATCHED_EX)
+                    name << '_' << arg.stride_y;
+
+                if(GER_EX_TYPE == GER_STRIDED_BATCHED_EX || GER_EX_TYPE == GER_BATCHED_EX)
+                    name << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed fourth parameter is used for enable_if_t below.
+    template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+    struct ger_ex_testing : rocblas_test_invalid
+    {
+    };
+
+    // The precisions of ger, and half or bfloat16 x, y and A with float computation.
+    // A is updated in place, so its type is both the input and the output type.
+    template <typename Ti, typename To, typename Tc>
+    struct ger_ex_testing<
+        Ti,
+        To,
+        Tc,
+        std::enable_if_t<std::is_same<Ti, To>{}
+                         && ((std::is_same<Ti, Tc>{}
+                              && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+                                  || std::is_same<Ti, rocblas_float_complex>{}
+                                  || std::is_same<Ti, rocblas_double_complex>{}))
+                             || ((std::is_same<Ti, rocblas_half>{}
+                                  || std::is_same<Ti, rocblas_bfloat16>{})
+                                 && std::is_same<Tc, float>{}))>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "ger_ex"))
+                testing_ger_ex<Ti, Tc>(arg);
+            else if(!strcmp(arg.function, "ger_ex_bad_arg"))
+                testing_ger_ex_bad_arg<Ti, Tc>(arg);
+            else if(!strcmp(arg.function, "ger_batched_ex"))
+                testing_ger_batched_ex<Ti, Tc>(arg);
+            else if(!strcmp(arg.function, "ger_batched_ex_bad_arg"))
+                testing_ger_batched_ex_bad_arg<Ti, Tc>(arg);
+            else if(!strcmp(arg.function, "ger_strided_batched_ex"))
+                testing_ger_strided_batched_ex<Ti, Tc>(arg);
+            else if(!strcmp(arg.function, "ger_strided_batched_ex_bad_arg"))
+                testing_ger_strided_batched_ex_bad_arg<Ti, Tc>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using ger_ex = ger_ex_template<ger_ex_testing, GER_EX>;
+    TEST_P(ger_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<ger_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(ger_ex);
+
+    using ger_batched_ex = ger_ex_template<ger_ex_testing, GER_BATCHED_EX>;
+    TEST_P(ger_batched_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<ger_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(ger_batched_ex);
+
+    using ger_strided_batched_ex = ger_ex_template<ger_ex_testing, GER_STRIDED_BATCHED_EX>;
+    TEST_P(ger_strided_batched_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<ger_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(ger_strided_batched_ex);
+
+} // namespace
@@ -0,0 +1,267 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_gemm_planar_ex.hpp"
+#include "testing_planar_level1.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible planar complex test cases
+    enum planar_complex_test_type
+    {
+        GEMM_PLANAR_EX,
+        AXPY_PLANAR,
+        SCAL_PLANAR,
+        DOTU_PLANAR,
+        DOTC_PLANAR,
+    };
+
+    //planar complex test template
+    template <template <typename...> class FILTER, planar_complex_test_type PLANAR_TYPE>
+    struct planar_complex_template
+        : RocBLAS_Test<planar_complex_template<FILTER, PLANAR_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<planar_complex_template::template type_filter_functor>(
+                arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(PLANAR_TYPE)
+            {
+            case GEMM_PLANAR_EX:
+                return !strcmp(arg.function, "gemm_planar_ex")
+                       || !strcmp(arg.function, "gemm_planar_ex_bad_arg");
+            case AXPY_PLANAR:
+                return !strcmp(arg.function, "axpy_planar")
+                       || !strcmp(arg.function, "axpy_planar_bad_arg");
+            case SCAL_PLANAR:
+                return !strcmp(arg.function, "scal_planar")
+                       || !strcmp(arg.function, "scal_planar_bad_arg");
+            case DOTU_PLANAR:
+                return !strcmp(arg.function, "dotu_planar")
+                       || !strcmp(arg.function, "dotu_planar_bad_arg");
+            case DOTC_PLANAR:
+                return !strcmp(arg.function, "dotc_planar")
+                       || !strcmp(arg.function, "dotc_planar_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<planar_complex_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else if(PLANAR_TYPE == GEMM_PLANAR_EX)
+            {
+                name << '_' << (char)std::toupper(arg.transA) << (char)std::toupper(arg.transB)
+                     << '_' << arg.M << '_' << arg.N << '_' << arg.K << '_' << arg.alpha << '_'
+                     << arg.alphai << '_' << arg.lda << '_' << arg.ldb << '_' << arg.beta << '_'
+                     << arg.betai << '_' << arg.ldc << '_' << arg.batch_count;
+            }
+            else
+            {
+                name << '_' << arg.N;
+
+                if(PLANAR_TYPE == AXPY_PLANAR || PLANAR_TYPE == SCAL_PLANAR)
+                    name << '_' << arg.alpha << "_" << arg.alphai;
+
+                name << '_' << arg.incx;
+
+                if(PLANAR_TYPE != SCAL_PLANAR)
+                    name << '_' << arg.incy;
+
+                name << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct gemm_planar_ex_testing : rocblas_test_invalid
+    {
+    };
+
+    // The planar complex functions only have complex precisions, the planar arrays being of the
+    // real type of the complex type
+    template <typename T>
+    struct gemm_planar_ex_testing<T,
+                                  std::enable_if_t<std::is_same<T, rocblas_float_complex>{}
+                                                   || std::is_same<T, rocblas_double_complex>{}>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_planar_ex"))
+                testing_gemm_planar_ex<T>(arg);
+            else if(!strcmp(arg.function, "gemm_planar_ex_bad_arg"))
+                testing_gemm_planar_ex_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    template <typename, typename = void>
+    struct axpy_planar_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct axpy_planar_testing<T,
+                               std::enable_if_t<std::is_same<T, rocblas_float_complex>{}
+                                                || std::is_same<T, rocblas_double_complex>{}>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "axpy_planar"))
+                testing_axpy_planar<T>(arg);
+            else if(!strcmp(arg.function, "axpy_planar_bad_arg"))
+                testing_axpy_planar_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    template <typename, typename = void>
+    struct scal_planar_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct scal_planar_testing<T,
+                               std::enable_if_t<std::is_same<T, rocblas_float_complex>{}
+                                                || std::is_same<T, rocblas_double_complex>{}>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "scal_planar"))
+                testing_scal_planar<T>(arg);
+            else if(!strcmp(arg.function, "scal_planar_bad_arg"))
+                testing_scal_planar_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    template <typename, typename = void>
+    struct dotu_planar_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct dotu_planar_testing<T,
+                               std::enable_if_t<std::is_same<T, rocblas_float_complex>{}
+                                                || std::is_same<T, rocblas_double_complex>{}>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "dotu_planar"))
+                testing_dot_planar<T>(arg);
+            else if(!strcmp(arg.function, "dotu_planar_bad_arg"))
+                testing_dot_planar_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    template <typename, typename = void>
+    struct dotc_planar_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct dotc_planar_testing<T,
+                               std::enable_if_t<std::is_same<T, rocblas_float_complex>{}
+                                                || std::is_same<T, rocblas_double_complex>{}>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "dotc_planar"))
+                testing_dotc_planar<T>(arg);
+            else if(!strcmp(arg.function, "dotc_planar_bad_arg"))
+                testing_dotc_planar_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemm_planar_ex = planar_complex_template<gemm_planar_ex_testing, GEMM_PLANAR_EX>;
+    TEST_P(gemm_planar_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_simple_dispatch<gemm_planar_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_planar_ex);
+
+    using axpy_planar = planar_complex_template<axpy_planar_testing, AXPY_PLANAR>;
+    TEST_P(axpy_planar, blas1)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_simple_dispatch<axpy_planar_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(axpy_planar);
+
+    using scal_planar = planar_complex_template<scal_planar_testing, SCAL_PLANAR>;
+    TEST_P(scal_planar, blas1)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_simple_dispatch<scal_planar_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(scal_planar);
+
+    using dotu_planar = planar_complex_template<dotu_planar_testing, DOTU_PLANAR>;
+    TEST_P(dotu_planar, blas1)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_simple_dispatch<dotu_planar_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(dotu_planar);
+
+    using dotc_planar = planar_complex_template<dotc_planar_testing, DOTC_PLANAR>;
+    TEST_P(dotc_planar, blas1)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_simple_dispatch<dotc_planar_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(dotc_planar);
+
+} // namespace
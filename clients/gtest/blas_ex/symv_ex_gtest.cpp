@@ -0,0 +1,173 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_symv_batched_ex.hpp"
+#include "testing_symv_ex.hpp"
+#include "testing_symv_strided_batched_ex.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible symv_ex test cases
+    enum symv_ex_test_type
+    {
+        SYMV_EX,
+        SYMV_BATCHED_EX,
+        SYMV_STRIDED_BATCHED_EX,
+    };
+
+    // symv_ex test template
+    template <template <typename...> class FILTER, symv_ex_test_type SYMV_EX_TYPE>
+    struct symv_ex_template : RocBLAS_Test<symv_ex_template<FILTER, SYMV_EX_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_gemm_dispatch<symv_ex_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(SYMV_EX_TYPE)
+            {
+            case SYMV_EX:
+                return !strcmp(arg.function, "symv_ex") || !strcmp(arg.function, "symv_ex_bad_arg");
+            case SYMV_BATCHED_EX:
+                return !strcmp(arg.function, "symv_batched_ex")
+                       || !strcmp(arg.function, "symv_batched_ex_bad_arg");
+            case SYMV_STRIDED_BATCHED_EX:
+                return !strcmp(arg.function, "symv_strided_batched_ex")
+                       || !strcmp(arg.function, "symv_strided_batched_ex_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<symv_ex_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type) << '_'
+                 << rocblas_datatype2string(arg.c_type) << '_'
+                 << rocblas_datatype2string(arg.compute_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << (char)std::toupper(arg.uplo) << '_' << arg.N << '_' << arg.alpha
+                     << '_' << arg.lda;
+
+                if(SYMV_EX_TYPE == SYMV_STRIDED_BATCHED_EX)
+                    name << '_' << arg.stride_a;
+
+                name << '_' << arg.incx;
+
+                if(SYMV_EX_TYPE == SYMV_STRIDED_BATCHED_EX)
+                    name << '_' << arg.stride_x;
+
+                name << '_' << arg.beta << '_' << arg.incy;
+
+                if(SYMV_EX_TYPE == SYMV_STRIDED_BATCHED_EX)
+                    name << '_' << arg.stride_y;
+
+                if(SYMV_EX_TYPE == SYMV_STRIDED_BATCHED_EX || SYMV_EX_TYPE == SYMV_BATCHED_EX)
+                    name << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed fourth parameter is used for enable_if_t below.
+    template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+    struct symv_ex_testing : rocblas_test_invalid
+    {
+    };
+
+    // The precisions of symv, and half or bfloat16 A and x with float computation
+    // and y of either the input type or float.
+    template <typename Ti, typename To, typename Tc>
+    struct symv_ex_testing<
+        Ti,
+        To,
+        Tc,
+        std::enable_if_t<(std::is_same<Ti, To>{} && std::is_same<To, Tc>{}
+                          && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+                              || std::is_same<Ti, rocblas_float_complex>{}
+                              || std::is_same<Ti, rocblas_double_complex>{}))
+                         || ((std::is_same<Ti, rocblas_half>{}
+                              || std::is_same<Ti, rocblas_bfloat16>{})
+                             && (std::is_same<To, Ti>{} || std::is_same<To, float>{})
+                             && std::is_same<Tc, float>{})>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "symv_ex"))
+                testing_symv_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "symv_ex_bad_arg"))
+                testing_symv_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "symv_batched_ex"))
+                testing_symv_batched_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "symv_batched_ex_bad_arg"))
+                testing_symv_batched_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "symv_strided_batched_ex"))
+                testing_symv_strided_batched_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "symv_strided_batched_ex_bad_arg"))
+                testing_symv_strided_batched_ex_bad_arg<Ti, To, Tc>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using symv_ex = symv_ex_template<symv_ex_testing, SYMV_EX>;
+    TEST_P(symv_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<symv_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(symv_ex);
+
+    using symv_batched_ex = symv_ex_template<symv_ex_testing, SYMV_BATCHED_EX>;
+    TEST_P(symv_batched_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<symv_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(symv_batched_ex);
+
+    using symv_strided_batched_ex = symv_ex_template<symv_ex_testing, SYMV_STRIDED_BATCHED_EX>;
+    TEST_P(symv_strided_batched_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<symv_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(symv_strided_batched_ex);
+
+} // namespace
@@ -0,0 +1,172 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_syr2_batched_ex.hpp"
+#include "testing_syr2_ex.hpp"
+#include "testing_syr2_strided_batched_ex.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible syr2_ex test cases
+    enum syr2_ex_test_type
+    {
+        SYR2_EX,
+        SYR2_BATCHED_EX,
+        SYR2_STRIDED_BATCHED_EX,
+    };
+
+    // syr2_ex test template
+    template <template <typename...> class FILTER, syr2_ex_test_type SYR2_EX_TYPE>
+    struct syr2_ex_template : RocBLAS_Test<syr2_ex_template<FILTER, SYR2_EX_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_gemm_dispatch<syr2_ex_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(SYR2_EX_TYPE)
+            {
+            case SYR2_EX:
+                return !strcmp(arg.function, "syr2_ex") || !strcmp(arg.function, "syr2_ex_bad_arg");
+            case SYR2_BATCHED_EX:
+                return !strcmp(arg.function, "syr2_batched_ex")
+                       || !strcmp(arg.function, "syr2_batched_ex_bad_arg");
+            case SYR2_STRIDED_BATCHED_EX:
+                return !strcmp(arg.function, "syr2_strided_batched_ex")
+                       || !strcmp(arg.function, "syr2_strided_batched_ex_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<syr2_ex_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type) << '_'
+                 << rocblas_datatype2string(arg.compute_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << (char)std::toupper(arg.uplo) << '_' << arg.N << '_' << arg.alpha
+                     << '_' << arg.lda;
+
+                if(SYR2_EX_TYPE == SYR2_STRIDED_BATCHED_EX)
+                    name << '_' << arg.stride_a;
+
+                name << '_' << arg.incx;
+
+                if(SYR2_EX_TYPE == SYR2_STRIDED_BATCHED_EX)
+                    name << '_' << arg.stride_x;
+
+                name << '_' << arg.incy;
+
+                if(SYR2_EX_TYPE == SYR2_STRIDED_BATCHED_EX)
+                    name << '_' << arg.stride_y;
+
+                if(SYR2_EX_TYPE == SYR2_STRIDED_BATCHED_EX || SYR2_EX_TYPE == SYR2_BATCHED_EX)
+                    name << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed fourth parameter is used for enable_if_t below.
+    template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+    struct syr2_ex_testing : rocblas_test_invalid
+    {
+    };
+
+    // The precisions of syr2, and half or bfloat16 x, y and A with float computation.
+    // A is updated in place, so its type is both the input and the output type.
+    template <typename Ti, typename To, typename Tc>
+    struct syr2_ex_testing<
+        Ti,
+        To,
+        Tc,
+        std::enable_if_t<std::is_same<Ti, To>{}
+                         && ((std::is_same<Ti, Tc>{}
+                              && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+                                  || std::is_same<Ti, rocblas_float_complex>{}
+                                  || std::is_same<Ti, rocblas_double_complex>{}))
+                             || ((std::is_same<Ti, rocblas_half>{}
+                                  || std::is_same<Ti, rocblas_bfloat16>{})
+                                 && std::is_same<Tc, float>{}))>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "syr2_ex"))
+                testing_syr2_ex<Ti, Tc>(arg);
+            else if(!strcmp(arg.function, "syr2_ex_bad_arg"))
+                testing_syr2_ex_bad_arg<Ti, Tc>(arg);
+            else if(!strcmp(arg.function, "syr2_batched_ex"))
+                testing_syr2_batched_ex<Ti, Tc>(arg);
+            else if(!strcmp(arg.function, "syr2_batched_ex_bad_arg"))
+                testing_syr2_batched_ex_bad_arg<Ti, Tc>(arg);
+            else if(!strcmp(arg.function, "syr2_strided_batched_ex"))
+                testing_syr2_strided_batched_ex<Ti, Tc>(arg);
+            else if(!strcmp(arg.function, "syr2_strided_batched_ex_bad_arg"))
+                testing_syr2_strided_batched_ex_bad_arg<Ti, Tc>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using syr2_ex = syr2_ex_template<syr2_ex_testing, SYR2_EX>;
+    TEST_P(syr2_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<syr2_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(syr2_ex);
+
+    using syr2_batched_ex = syr2_ex_template<syr2_ex_testing, SYR2_BATCHED_EX>;
+    TEST_P(syr2_batched_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<syr2_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(syr2_batched_ex);
+
+    using syr2_strided_batched_ex = syr2_ex_template<syr2_ex_testing, SYR2_STRIDED_BATCHED_EX>;
+    TEST_P(syr2_strided_batched_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<syr2_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(syr2_strided_batched_ex);
+
+} // namespace
@@ -0,0 +1,167 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_trmv_batched_ex.hpp"
+#include "testing_trmv_ex.hpp"
+#include "testing_trmv_strided_batched_ex.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible trmv_ex test cases
+    enum trmv_ex_test_type
+    {
+        TRMV_EX,
+        TRMV_BATCHED_EX,
+        TRMV_STRIDED_BATCHED_EX,
+    };
+
+    // trmv_ex test template
+    template <template <typename...> class FILTER, trmv_ex_test_type TRMV_EX_TYPE>
+    struct trmv_ex_template : RocBLAS_Test<trmv_ex_template<FILTER, TRMV_EX_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_gemm_dispatch<trmv_ex_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(TRMV_EX_TYPE)
+            {
+            case TRMV_EX:
+                return !strcmp(arg.function, "trmv_ex") || !strcmp(arg.function, "trmv_ex_bad_arg");
+            case TRMV_BATCHED_EX:
+                return !strcmp(arg.function, "trmv_batched_ex")
+                       || !strcmp(arg.function, "trmv_batched_ex_bad_arg");
+            case TRMV_STRIDED_BATCHED_EX:
+                return !strcmp(arg.function, "trmv_strided_batched_ex")
+                       || !strcmp(arg.function, "trmv_strided_batched_ex_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<trmv_ex_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type) << '_'
+                 << rocblas_datatype2string(arg.compute_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << (char)std::toupper(arg.uplo) << (char)std::toupper(arg.transA)
+                     << (char)std::toupper(arg.diag) << '_' << arg.M << '_' << arg.lda;
+
+                if(TRMV_EX_TYPE == TRMV_STRIDED_BATCHED_EX)
+                    name << '_' << arg.stride_a;
+
+                name << '_' << arg.incx;
+
+                if(TRMV_EX_TYPE == TRMV_STRIDED_BATCHED_EX)
+                    name << '_' << arg.stride_x;
+
+                if(TRMV_EX_TYPE == TRMV_STRIDED_BATCHED_EX || TRMV_EX_TYPE == TRMV_BATCHED_EX)
+                    name << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed fourth parameter is used for enable_if_t below.
+    template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+    struct trmv_ex_testing : rocblas_test_invalid
+    {
+    };
+
+    // The precisions of trmv, and half or bfloat16 A and x with float computation.
+    // x is overwritten, so its type is both the input and the output type.
+    template <typename Ti, typename To, typename Tc>
+    struct trmv_ex_testing<
+        Ti,
+        To,
+        Tc,
+        std::enable_if_t<std::is_same<Ti, To>{}
+                         && ((std::is_same<Ti, Tc>{}
+                              && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+                                  || std::is_same<Ti, rocblas_float_complex>{}
+                                  || std::is_same<Ti, rocblas_double_complex>{}))
+                             || ((std::is_same<Ti, rocblas_half>{}
+                                  || std::is_same<Ti, rocblas_bfloat16>{})
+                                 && std::is_same<Tc, float>{}))>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "trmv_ex"))
+                testing_trmv_ex<Ti, Tc>(arg);
+            else if(!strcmp(arg.function, "trmv_ex_bad_arg"))
+                testing_trmv_ex_bad_arg<Ti, Tc>(arg);
+            else if(!strcmp(arg.function, "trmv_batched_ex"))
+                testing_trmv_batched_ex<Ti, Tc>(arg);
+            else if(!strcmp(arg.function, "trmv_batched_ex_bad_arg"))
+                testing_trmv_batched_ex_bad_arg<Ti, Tc>(arg);
+            else if(!strcmp(arg.function, "trmv_strided_batched_ex"))
+                testing_trmv_strided_batched_ex<Ti, Tc>(arg);
+            else if(!strcmp(arg.function, "trmv_strided_batched_ex_bad_arg"))
+                testing_trmv_strided_batched_ex_bad_arg<Ti, Tc>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using trmv_ex = trmv_ex_template<trmv_ex_testing, TRMV_EX>;
+    TEST_P(trmv_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<trmv_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(trmv_ex);
+
+    using trmv_batched_ex = trmv_ex_template<trmv_ex_testing, TRMV_BATCHED_EX>;
+    TEST_P(trmv_batched_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<trmv_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(trmv_batched_ex);
+
+    using trmv_strided_batched_ex = trmv_ex_template<trmv_ex_testing, TRMV_STRIDED_BATCHED_EX>;
+    TEST_P(trmv_strided_batched_ex, blas_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<trmv_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(trmv_strided_batched_ex);
+
+} // namespace
@@ -298,6 +298,71 @@ namespace
 
         EXPECT_EQ(status, rocblas_status_check_numerics_fail);
 
+        //==============================================================================================
+        // Testing for Inf in the vector with deferred reporting
+        //==============================================================================================
+        int deferred_check_numerics = check_numerics | rocblas_check_numerics_mode_deferred;
+
+        status = rocblas_internal_check_numerics_vector_template(function_name,
+                                                                 handle,
+                                                                 N,
+                                                                 (T*)d_x,
+                                                                 offset_x,
+                                                                 inc_x,
+                                                                 stride_x,
+                                                                 1,
+                                                                 deferred_check_numerics,
+                                                                 is_input);
+        EXPECT_EQ(status, rocblas_status_success);
+
+        // The abnormal value is reported once, by the next report
+        EXPECT_EQ(rocblas_report_check_numerics(handle), rocblas_status_check_numerics_fail);
+        EXPECT_EQ(rocblas_report_check_numerics(handle), rocblas_status_success);
+
+        //==============================================================================================
+        // In async status mode the failure is read after a synchronization, without a report
+        //==============================================================================================
+        CHECK_ROCBLAS_ERROR(rocblas_set_async_status_mode(handle, true));
+        EXPECT_EQ(rocblas_get_async_status(handle), rocblas_status_success);
+
+        status = rocblas_internal_check_numerics_vector_template(function_name,
+                                                                 handle,
+                                                                 N,
+                                                                 (T*)d_x,
+                                                                 offset_x,
+                                                                 inc_x,
+                                                                 stride_x,
+                                                                 1,
+                                                                 deferred_check_numerics,
+                                                                 is_input);
+        EXPECT_EQ(status, rocblas_status_success);
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        EXPECT_EQ(rocblas_get_async_status(handle), rocblas_status_check_numerics_fail);
+        EXPECT_EQ(rocblas_get_async_status(handle), rocblas_status_success);
+
+        EXPECT_EQ(rocblas_report_check_numerics(handle), rocblas_status_check_numerics_fail);
+        CHECK_ROCBLAS_ERROR(rocblas_set_async_status_mode(handle, false));
+
+        //==============================================================================================
+        // In fused mode the inputs are not scanned
+        //==============================================================================================
+        int fused_check_numerics = check_numerics | rocblas_check_numerics_mode_fused;
+
+        status = rocblas_internal_check_numerics_vector_template(function_name,
+                                                                 handle,
+                                                                 N,
+                                                                 (T*)d_x,
+                                                                 offset_x,
+                                                                 inc_x,
+                                                                 stride_x,
+                                                                 1,
+                                                                 fused_check_numerics,
+                                                                 true);
+        EXPECT_EQ(status, rocblas_status_success);
+
         //==============================================================================================
         // Initializing and testing for NaN in the vector
         //==============================================================================================
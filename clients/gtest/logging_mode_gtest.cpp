@@ -20,6 +20,7 @@
  *
  * ************************************************************************ */
 
+#define ROCBLAS_BETA_FEATURES_API
 #include "rocblas_data.hpp"
 #include "rocblas_datatype2string.hpp"
 #include "rocblas_test.hpp"
@@ -49,6 +50,8 @@ namespace
         {
             if(!strcmp(arg.function, "logging"))
                 testing_logging<T>(arg);
+            else if(!strcmp(arg.function, "logging_sampling"))
+                testing_logging_sampling<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -65,7 +68,7 @@ namespace
         // Filter for which functions apply to this suite
         static bool function_filter(const Arguments& arg)
         {
-            return !strcmp(arg.function, "logging");
+            return !strcmp(arg.function, "logging") || !strcmp(arg.function, "logging_sampling");
         }
 
         // Google Test name suffix based on parameters
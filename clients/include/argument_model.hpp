@@ -23,6 +23,10 @@
 #pragma once
 
 #include "rocblas_arguments.hpp"
+#include "rocblas_counters.hpp"
+#include <algorithm>
+#include <string>
+#include <vector>
 
 namespace ArgumentLogging
 {
@@ -35,6 +39,86 @@ bool ArgumentModel_get_log_function_name();
 void ArgumentModel_set_log_datatype(bool d);
 bool ArgumentModel_get_log_datatype();
 
+// GPU time of the hot calls with flushed caches, reported in the next log_perf only
+void   ArgumentModel_set_flushed_time_us(double us);
+double ArgumentModel_take_flushed_time_us();
+
+// Wall time and bytes of the host transfers of the client containers, optionally reported with
+// the time of a call including them in the next log_perf, which takes them
+void ArgumentModel_set_log_transfers(bool t);
+bool ArgumentModel_get_log_transfers();
+void ArgumentModel_add_transfer(double us, size_t bytes);
+void ArgumentModel_take_transfers(double& us, double& bytes);
+
+// Per-iteration GPU time statistics, optionally with the raw samples written to a CSV file
+void ArgumentModel_set_log_stats(bool s);
+bool ArgumentModel_get_log_stats();
+void ArgumentModel_set_stats_csv(const std::string& filename);
+
+// Average power of the device during the hot calls, reported in the next log_perf only
+void   ArgumentModel_set_log_power(bool p);
+bool   ArgumentModel_get_log_power();
+void   ArgumentModel_set_power_watts(double watts);
+double ArgumentModel_take_power_watts();
+
+// Clock guard of the hot calls and its retries of throttled timings; the stable and lowest
+// clocks, the highest temperature and whether the calls were throttled are reported in the next
+// log_perf only
+void ArgumentModel_set_clock_guard(bool guard, int retries);
+bool ArgumentModel_get_clock_guard();
+int  ArgumentModel_get_clock_guard_retries();
+void ArgumentModel_set_clock_sample(double mhz, double min_mhz, double celsius, bool throttled);
+bool ArgumentModel_take_clock_sample(double& mhz,
+                                     double& min_mhz,
+                                     double& celsius,
+                                     bool&   throttled);
+
+// Name of the GEMM backend of the benchmarks, reported in a backend column unless it is empty
+void               ArgumentModel_set_backend(const std::string& backend);
+const std::string& ArgumentModel_get_backend();
+
+// Peak Gflops and GB/s of the device for the roofline columns, 0 to omit them
+void   ArgumentModel_set_roofline_peaks(double peak_gflops, double peak_gbps);
+double ArgumentModel_get_peak_gflops();
+double ArgumentModel_get_peak_gbps();
+
+// Work of the hot calls logged by the calling thread, for the concurrent benchmark summary
+void ArgumentModel_reset_logged_work();
+void ArgumentModel_add_logged_work(double gflop, double gbyte, double gpu_us);
+void ArgumentModel_get_logged_work(double& gflop, double& gbyte, double& gpu_us);
+
+// GPU times of the individual hot calls, reported in the next log_perf only
+void                ArgumentModel_set_iteration_times_us(std::vector<double>&& us);
+std::vector<double> ArgumentModel_take_iteration_times_us();
+
+// Hardware counters of the kernels of the hot calls, reported in the next log_perf only
+void ArgumentModel_set_kernel_counters(std::vector<rocblas_kernel_counters>&& counters);
+
+std::vector<rocblas_kernel_counters> ArgumentModel_take_kernel_counters();
+
+// Append the name, dispatches and time per hot call of each kernel, its counters per dispatch and
+// the bandwidth of its FETCH_SIZE and WRITE_SIZE counters
+void ArgumentModel_log_kernel_counters(rocblas_internal_ostream&            name_line,
+                                       rocblas_internal_ostream&            val_line,
+                                       std::vector<rocblas_kernel_counters> counters,
+                                       int                                  hot_calls);
+
+// Append the min, median, p90, p99 and stddev of the iteration times, and write the samples to
+// the statistics CSV file, each after the argument names and values of its benchmark line
+void ArgumentModel_log_iteration_stats(rocblas_internal_ostream& name_line,
+                                       rocblas_internal_ostream& val_line,
+                                       const std::string&        arg_names,
+                                       const std::string&        arg_values,
+                                       std::vector<double>       us);
+
+// Records of the benchmarks as a JSON array of objects with the function, datatypes, arguments
+// and metrics of each, written to a file when it is set, and closed when it is reset or at exit
+void ArgumentModel_set_json(const std::string& filename);
+bool ArgumentModel_get_json();
+void ArgumentModel_log_json(const Arguments&   arg,
+                            const std::string& names,
+                            const std::string& values);
+
 // ArgumentModel template has a variadic list of argument enums
 template <rocblas_argument... Args>
 class ArgumentModel
@@ -67,6 +151,15 @@ public:
         rocblas_int    batch_count     = has_batch_count ? arg.batch_count : 1;
         rocblas_int    hot_calls       = arg.iters < 1 ? 1 : arg.iters;
 
+        // arguments identify the samples in the statistics CSV file
+        std::vector<double> iteration_us = ArgumentModel_take_iteration_times_us();
+        std::string         arg_names, arg_values;
+        if(!iteration_us.empty())
+        {
+            arg_names  = name_line.str();
+            arg_values = val_line.str();
+        }
+
         // gpu time is total cumulative over hot calls, cpu is not
         if(hot_calls > 1)
             gpu_us /= hot_calls;
@@ -75,7 +168,19 @@ public:
         double rocblas_gflops = gflops * batch_count / gpu_us * 1e6;
         double rocblas_GBps   = gbytes * batch_count / gpu_us * 1e6;
 
+        ArgumentModel_add_logged_work(
+            gflops != ArgumentLogging::NA_value ? gflops * batch_count * hot_calls : 0,
+            gbytes != ArgumentLogging::NA_value ? gbytes * batch_count * hot_calls : 0,
+            gpu_us * hot_calls);
+
         // append performance fields
+        const std::string& backend = ArgumentModel_get_backend();
+        if(!backend.empty())
+        {
+            name_line << ",backend";
+            val_line << ", " << backend;
+        }
+
         if(gflops != ArgumentLogging::NA_value)
         {
             name_line << ",rocblas-Gflops";
@@ -92,6 +197,107 @@ public:
         name_line << ",us";
         val_line << ", " << gpu_us;
 
+        // roofline: the attainable rate is bounded by the peak flops and, at the arithmetic
+        // intensity of the function, by the peak memory bandwidth
+        double peak_gflops = ArgumentModel_get_peak_gflops();
+        double peak_gbps   = ArgumentModel_get_peak_gbps();
+        bool   has_flops   = gflops != ArgumentLogging::NA_value;
+        bool   has_bytes   = gbytes != ArgumentLogging::NA_value && gbytes > 0;
+
+        if(has_flops && has_bytes && (peak_gflops > 0 || peak_gbps > 0))
+        {
+            name_line << ",flops/byte";
+            val_line << ", " << gflops / gbytes;
+        }
+
+        if(has_flops && peak_gflops > 0)
+        {
+            name_line << ",%peak-Gflops";
+            val_line << ", " << 100 * rocblas_gflops / peak_gflops;
+        }
+
+        if(has_bytes && peak_gbps > 0)
+        {
+            name_line << ",%peak-GB/s";
+            val_line << ", " << 100 * rocblas_GBps / peak_gbps;
+        }
+
+        if(has_flops && has_bytes && peak_gflops > 0 && peak_gbps > 0)
+        {
+            double roofline_gflops = std::min(peak_gflops, gflops / gbytes * peak_gbps);
+            name_line << ",%roofline";
+            val_line << ", " << 100 * rocblas_gflops / roofline_gflops;
+        }
+
+        // average power, and energy of each hot call
+        double watts = ArgumentModel_take_power_watts();
+        if(watts != ArgumentLogging::NA_value)
+        {
+            name_line << ",W,J";
+            val_line << ", " << watts << ", " << watts * gpu_us * 1e-6;
+
+            if(has_flops && watts > 0)
+            {
+                name_line << ",Gflops/W";
+                val_line << ", " << rocblas_gflops / watts;
+            }
+        }
+
+        // shader clocks and temperature, with the throttled timings tagged
+        double mhz, min_mhz, celsius;
+        bool   throttled;
+        if(ArgumentModel_take_clock_sample(mhz, min_mhz, celsius, throttled))
+        {
+            name_line << ",MHz,min-MHz,C,throttled";
+            val_line << ", " << mhz << ", " << min_mhz << ", " << celsius << ", "
+                     << (throttled ? 1 : 0);
+        }
+
+        double flushed_us = ArgumentModel_take_flushed_time_us();
+        if(flushed_us != ArgumentLogging::NA_value)
+        {
+            if(hot_calls > 1)
+                flushed_us /= hot_calls;
+
+            if(gflops != ArgumentLogging::NA_value)
+            {
+                name_line << ",flushed-Gflops";
+                val_line << ", " << gflops * batch_count / flushed_us * 1e6;
+            }
+
+            if(gbytes != ArgumentLogging::NA_value)
+            {
+                name_line << ",flushed-GB/s";
+                val_line << ", " << gbytes * batch_count / flushed_us * 1e6;
+            }
+
+            name_line << ",flushed-us";
+            val_line << ", " << flushed_us;
+        }
+
+        if(ArgumentModel_get_log_transfers())
+        {
+            double transfer_us, transfer_bytes;
+            ArgumentModel_take_transfers(transfer_us, transfer_bytes);
+
+            name_line << ",transfer-GB/s";
+            val_line << ", " << (transfer_us > 0 ? transfer_bytes / transfer_us * 1e-3 : 0);
+
+            name_line << ",transfer-us";
+            val_line << ", " << transfer_us;
+
+            name_line << ",us+transfer";
+            val_line << ", " << gpu_us + transfer_us;
+        }
+
+        std::vector<rocblas_kernel_counters> counters = ArgumentModel_take_kernel_counters();
+        if(!counters.empty())
+            ArgumentModel_log_kernel_counters(name_line, val_line, std::move(counters), hot_calls);
+
+        if(!iteration_us.empty())
+            ArgumentModel_log_iteration_stats(
+                name_line, val_line, arg_names, arg_values, std::move(iteration_us));
+
         if(arg.unit_check || arg.norm_check)
         {
             if(cpu_us != ArgumentLogging::NA_value)
@@ -226,6 +432,9 @@ public:
                      norm3,
                      norm4);
 
+        if(ArgumentModel_get_json())
+            ArgumentModel_log_json(arg, name_list.str(), value_list.str());
+
         str << name_list << "\n" << value_list << std::endl;
     }
 };
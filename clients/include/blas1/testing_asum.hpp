@@ -180,14 +180,9 @@ void testing_asum(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_asum_fn(handle, N, dx, incx, dr);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_N, e_incx>{}.log_args<T>(rocblas_cout,
                                                  arg,
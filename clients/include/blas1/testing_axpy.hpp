@@ -209,14 +209,9 @@ void testing_axpy(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_axpy_fn(handle, N, &h_alpha, dx, incx, dy_1, incy);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_N, e_alpha, e_incx, e_incy>{}.log_args<T>(rocblas_cout,
                                                                   arg,
@@ -228,6 +228,7 @@ void testing_axpy_strided_batched(const Arguments& arg)
                 cpu_time_used = get_time_us_no_sync();
 
                 // Compute the host solution.
+#pragma omp parallel for
                 for(rocblas_int batch_index = 0; batch_index < batch_count; ++batch_index)
                 {
                     cblas_axpy<T>(N, h_alpha, hx[batch_index], incx, hy_gold[batch_index], incy);
@@ -273,13 +274,10 @@ void testing_axpy_strided_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_axpy_strided_batched_fn(
                 handle, N, &h_alpha, dx, incx, stridex, dy, incy, stridey, batch_count);
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_N, e_alpha, e_incx, e_incy, e_stride_x, e_stride_y, e_batch_count>{}
             .log_args<T>(rocblas_cout,
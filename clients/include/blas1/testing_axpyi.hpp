@@ -0,0 +1,318 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// The sparse Level 1 functions are beta features without Fortran bindings
+
+// axpyi
+template <typename T>
+static rocblas_status (*rocblas_axpyi)(rocblas_handle     handle,
+                                       rocblas_int        nnz,
+                                       const T*           alpha,
+                                       const T*           x_val,
+                                       const rocblas_int* x_ind,
+                                       T*                 y);
+
+template <>
+static auto rocblas_axpyi<float> = rocblas_saxpyi;
+template <>
+static auto rocblas_axpyi<double> = rocblas_daxpyi;
+template <>
+static auto rocblas_axpyi<rocblas_float_complex> = rocblas_caxpyi;
+template <>
+static auto rocblas_axpyi<rocblas_double_complex> = rocblas_zaxpyi;
+
+// axpyi_strided_batched
+template <typename T>
+static rocblas_status (*rocblas_axpyi_strided_batched)(rocblas_handle     handle,
+                                                       rocblas_int        nnz,
+                                                       const T*           alpha,
+                                                       const T*           x_val,
+                                                       rocblas_stride     stride_x,
+                                                       const rocblas_int* x_ind,
+                                                       rocblas_stride     stride_ind,
+                                                       T*                 y,
+                                                       rocblas_stride     stride_y,
+                                                       rocblas_int        batch_count);
+
+template <>
+static auto rocblas_axpyi_strided_batched<float> = rocblas_saxpyi_strided_batched;
+template <>
+static auto rocblas_axpyi_strided_batched<double> = rocblas_daxpyi_strided_batched;
+template <>
+static auto rocblas_axpyi_strided_batched<rocblas_float_complex> = rocblas_caxpyi_strided_batched;
+template <>
+static auto rocblas_axpyi_strided_batched<rocblas_double_complex> = rocblas_zaxpyi_strided_batched;
+
+template <typename T>
+void testing_axpyi_bad_arg(const Arguments& arg)
+{
+    auto rocblas_axpyi_fn                 = rocblas_axpyi<T>;
+    auto rocblas_axpyi_strided_batched_fn = rocblas_axpyi_strided_batched<T>;
+
+    rocblas_int    N           = 100;
+    rocblas_int    nnz         = 10;
+    rocblas_int    batch_count = 2;
+    rocblas_stride stride_x    = nnz;
+    rocblas_stride stride_ind  = nnz;
+    rocblas_stride stride_y    = N;
+
+    rocblas_local_handle handle{arg};
+
+    // Allocate device memory
+    device_strided_batch_vector<T> dx(nnz, 1, stride_x, batch_count);
+    device_vector<rocblas_int>     dind(nnz * batch_count);
+    device_strided_batch_vector<T> dy(N, 1, stride_y, batch_count);
+    device_vector<T>               alpha_d(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dind.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(alpha_d.memcheck());
+
+    const T alpha_h(1), zero_h(0);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const T* alpha = &alpha_h;
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+        }
+
+        // clang-format off
+EXPECT_ROCBLAS_STATUS(rocblas_axpyi_fn(nullptr, nnz, alpha, dx, dind, dy), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_axpyi_fn(handle, -1, alpha, dx, dind, dy), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_axpyi_fn(handle, nnz, nullptr, dx, dind, dy), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_axpyi_fn(handle, nnz, alpha, nullptr, dind, dy), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_axpyi_fn(handle, nnz, alpha, dx, nullptr, dy), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_axpyi_fn(handle, nnz, alpha, dx, dind, nullptr), rocblas_status_invalid_pointer);
+
+EXPECT_ROCBLAS_STATUS(rocblas_axpyi_strided_batched_fn(nullptr, nnz, alpha, dx, stride_x, dind, stride_ind, dy, stride_y, batch_count), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_axpyi_strided_batched_fn(handle, -1, alpha, dx, stride_x, dind, stride_ind, dy, stride_y, batch_count), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_axpyi_strided_batched_fn(handle, nnz, alpha, dx, stride_x, dind, stride_ind, dy, stride_y, -1), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_axpyi_strided_batched_fn(handle, nnz, nullptr, dx, stride_x, dind, stride_ind, dy, stride_y, batch_count), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_axpyi_strided_batched_fn(handle, nnz, alpha, nullptr, stride_x, dind, stride_ind, dy, stride_y, batch_count), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_axpyi_strided_batched_fn(handle, nnz, alpha, dx, stride_x, nullptr, stride_ind, dy, stride_y, batch_count), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_axpyi_strided_batched_fn(handle, nnz, alpha, dx, stride_x, dind, stride_ind, nullptr, stride_y, batch_count), rocblas_status_invalid_pointer);
+
+// If nnz is 0 or batch_count is 0, nothing is dereferenced
+EXPECT_ROCBLAS_STATUS(rocblas_axpyi_fn(handle, 0, nullptr, nullptr, nullptr, nullptr), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_axpyi_strided_batched_fn(handle, nnz, nullptr, nullptr, stride_x, nullptr, stride_ind, nullptr, stride_y, 0), rocblas_status_success);
+        // clang-format on
+    }
+
+    // With alpha 0 on the host, the vectors are not dereferenced
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    EXPECT_ROCBLAS_STATUS(rocblas_axpyi_fn(handle, nnz, &zero_h, nullptr, nullptr, nullptr),
+                          rocblas_status_success);
+}
+
+// axpyi must match the loop over the nonzeros on the host, for each batch of the strided_batched
+// variant, with indices per batch and shared between the batches
+template <typename T>
+void testing_axpyi(const Arguments& arg)
+{
+    auto rocblas_axpyi_fn                 = rocblas_axpyi<T>;
+    auto rocblas_axpyi_strided_batched_fn = rocblas_axpyi_strided_batched<T>;
+
+    rocblas_int N           = arg.N;
+    rocblas_int nnz         = arg.K;
+    rocblas_int batch_count = arg.batch_count;
+    T           h_alpha     = arg.get_alpha<T>();
+
+    rocblas_stride stride_x   = nnz;
+    rocblas_stride stride_ind = nnz;
+    rocblas_stride stride_y   = N;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = nnz < 0 || batch_count < 0;
+    if(invalid_size || !nnz || !batch_count)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        EXPECT_ROCBLAS_STATUS(rocblas_axpyi_strided_batched_fn(handle,
+                                                               nnz,
+                                                               nullptr,
+                                                               nullptr,
+                                                               stride_x,
+                                                               nullptr,
+                                                               stride_ind,
+                                                               nullptr,
+                                                               stride_y,
+                                                               batch_count),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    host_strided_batch_vector<T> hx(nnz, 1, stride_x, batch_count);
+    host_vector<rocblas_int>     hind(size_t(nnz) * batch_count);
+    host_strided_batch_vector<T> hy(N, 1, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_1(N, 1, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_2(N, 1, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_3(N, 1, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_gold(N, 1, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_gold_shared(N, 1, stride_y, batch_count);
+    host_vector<T>               halpha(1);
+    halpha[0] = h_alpha;
+
+    // Allocate device memory
+    device_strided_batch_vector<T> dx(nnz, 1, stride_x, batch_count);
+    device_vector<rocblas_int>     dind(size_t(nnz) * batch_count);
+    device_strided_batch_vector<T> dy(N, 1, stride_y, batch_count);
+    device_vector<T>               d_alpha(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dind.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false);
+    rocblas_init_sparse_indices(hind, nnz, N);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dind.transfer_from(hind));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // Indices per batch, with alpha on the host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_axpyi_strided_batched_fn(
+            handle, nnz, &h_alpha, dx, stride_x, dind, stride_ind, dy, stride_y, batch_count));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy));
+
+        // Indices shared between the batches, with alpha on the device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_axpyi_strided_batched_fn(
+            handle, nnz, d_alpha, dx, stride_x, dind, 0, dy, stride_y, batch_count));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hy_2.transfer_from(dy));
+
+        // The non batched function on each batch
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_axpyi_fn(
+                handle, nnz, d_alpha, dx[b], (rocblas_int*)dind + b * stride_ind, dy[b]));
+        }
+        CHECK_HIP_ERROR(hy_3.transfer_from(dy));
+
+        // CPU BLAS
+        hy_gold.copy_from(hy);
+        hy_gold_shared.copy_from(hy);
+
+        cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            for(rocblas_int i = 0; i < nnz; i++)
+            {
+                hy_gold[b][hind[b * stride_ind + i]] += h_alpha * hx[b][i];
+                hy_gold_shared[b][hind[i]] += h_alpha * hx[b][i];
+            }
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, 1, stride_y, hy_gold, hy_1, batch_count);
+            unit_check_general<T>(1, N, 1, stride_y, hy_gold_shared, hy_2, batch_count);
+            unit_check_general<T>(1, N, 1, stride_y, hy_gold, hy_3, batch_count);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1
+                = norm_check_general<T>('F', 1, N, 1, stride_y, hy_gold, hy_1, batch_count);
+            rocblas_error_2
+                = norm_check_general<T>('F', 1, N, 1, stride_y, hy_gold_shared, hy_2, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_axpyi_strided_batched_fn(
+                handle, nnz, &h_alpha, dx, stride_x, dind, stride_ind, dy, stride_y, batch_count);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_axpyi_strided_batched_fn(
+                handle, nnz, &h_alpha, dx, stride_x, dind, stride_ind, dy, stride_y, batch_count);
+        });
+
+        ArgumentModel<e_N, e_K, e_alpha, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            axpy_gflop_count<T>(nnz),
+            sparse_level1_gbyte_count<T>(nnz, 3),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
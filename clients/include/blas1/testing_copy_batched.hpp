@@ -133,6 +133,7 @@ void testing_copy_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(int b = 0; b < batch_count; ++b)
         {
             cblas_copy<T>(N, hx[b], incx, hy_gold[b], incy);
@@ -163,15 +164,10 @@ void testing_copy_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_copy_batched_fn(
                 handle, N, dx.ptr_on_device(), incx, dy.ptr_on_device(), incy, batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_N, e_incx, e_incy, e_batch_count>{}.log_args<T>(rocblas_cout,
                                                                         arg,
@@ -140,6 +140,7 @@ void testing_copy_strided_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(int b = 0; b < batch_count; ++b)
         {
             cblas_copy<T>(N, hx[b], incx, hy_gold[b], incy);
@@ -171,15 +172,10 @@ void testing_copy_strided_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_copy_strided_batched_fn(
                 handle, N, dx, incx, stride_x, dy, incy, stride_y, batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_N, e_incx, e_incy, e_stride_x, e_stride_y, e_batch_count>{}.log_args<T>(
             rocblas_cout,
@@ -328,10 +328,7 @@ void testing_dot_strided_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             (rocblas_dot_strided_batched_fn)(handle,
                                              N,
                                              dx,
@@ -342,9 +339,7 @@ void testing_dot_strided_batched(const Arguments& arg)
                                              stride_y,
                                              batch_count,
                                              d_rocblas_result_2);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_N, e_incx, e_incy, e_stride_x, e_stride_y, e_batch_count, e_algo>{}
             .log_args<T>(rocblas_cout,
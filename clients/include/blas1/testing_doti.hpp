@@ -0,0 +1,388 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// The sparse Level 1 functions are beta features without Fortran bindings
+
+// doti
+template <typename T>
+static rocblas_status (*rocblas_doti)(rocblas_handle     handle,
+                                      rocblas_int        nnz,
+                                      const T*           x_val,
+                                      const rocblas_int* x_ind,
+                                      const T*           y,
+                                      T*                 result);
+
+template <>
+static auto rocblas_doti<float> = rocblas_sdoti;
+template <>
+static auto rocblas_doti<double> = rocblas_ddoti;
+template <>
+static auto rocblas_doti<rocblas_float_complex> = rocblas_cdoti;
+template <>
+static auto rocblas_doti<rocblas_double_complex> = rocblas_zdoti;
+
+// dotci
+template <typename T>
+static rocblas_status (*rocblas_dotci)(rocblas_handle     handle,
+                                       rocblas_int        nnz,
+                                       const T*           x_val,
+                                       const rocblas_int* x_ind,
+                                       const T*           y,
+                                       T*                 result);
+
+template <>
+static auto rocblas_dotci<rocblas_float_complex> = rocblas_cdotci;
+template <>
+static auto rocblas_dotci<rocblas_double_complex> = rocblas_zdotci;
+
+// doti_strided_batched
+template <typename T>
+static rocblas_status (*rocblas_doti_strided_batched)(rocblas_handle     handle,
+                                                      rocblas_int        nnz,
+                                                      const T*           x_val,
+                                                      rocblas_stride     stride_x,
+                                                      const rocblas_int* x_ind,
+                                                      rocblas_stride     stride_ind,
+                                                      const T*           y,
+                                                      rocblas_stride     stride_y,
+                                                      rocblas_int        batch_count,
+                                                      T*                 result);
+
+template <>
+static auto rocblas_doti_strided_batched<float> = rocblas_sdoti_strided_batched;
+template <>
+static auto rocblas_doti_strided_batched<double> = rocblas_ddoti_strided_batched;
+template <>
+static auto rocblas_doti_strided_batched<rocblas_float_complex> = rocblas_cdoti_strided_batched;
+template <>
+static auto rocblas_doti_strided_batched<rocblas_double_complex> = rocblas_zdoti_strided_batched;
+
+// dotci_strided_batched
+template <typename T>
+static rocblas_status (*rocblas_dotci_strided_batched)(rocblas_handle     handle,
+                                                       rocblas_int        nnz,
+                                                       const T*           x_val,
+                                                       rocblas_stride     stride_x,
+                                                       const rocblas_int* x_ind,
+                                                       rocblas_stride     stride_ind,
+                                                       const T*           y,
+                                                       rocblas_stride     stride_y,
+                                                       rocblas_int        batch_count,
+                                                       T*                 result);
+
+template <>
+static auto rocblas_dotci_strided_batched<rocblas_float_complex> = rocblas_cdotci_strided_batched;
+template <>
+static auto rocblas_dotci_strided_batched<rocblas_double_complex> = rocblas_zdotci_strided_batched;
+
+template <typename T, bool CONJ = false>
+void testing_doti_bad_arg(const Arguments& arg)
+{
+    auto rocblas_doti_fn = CONJ ? rocblas_dotci<T> : rocblas_doti<T>;
+    auto rocblas_doti_strided_batched_fn
+        = CONJ ? rocblas_dotci_strided_batched<T> : rocblas_doti_strided_batched<T>;
+
+    rocblas_int    N           = 100;
+    rocblas_int    nnz         = 10;
+    rocblas_int    batch_count = 2;
+    rocblas_stride stride_x    = nnz;
+    rocblas_stride stride_ind  = nnz;
+    rocblas_stride stride_y    = N;
+
+    rocblas_local_handle handle{arg};
+
+    // Allocate device memory
+    device_strided_batch_vector<T> dx(nnz, 1, stride_x, batch_count);
+    device_vector<rocblas_int>     dind(nnz * batch_count);
+    device_strided_batch_vector<T> dy(N, 1, stride_y, batch_count);
+    device_vector<T>               d_result(batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dind.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+    host_vector<T> h_result(batch_count);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        T* result = pointer_mode == rocblas_pointer_mode_host ? (T*)h_result : (T*)d_result;
+
+        // clang-format off
+EXPECT_ROCBLAS_STATUS(rocblas_doti_fn(nullptr, nnz, dx, dind, dy, result), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_doti_fn(handle, -1, dx, dind, dy, result), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_doti_fn(handle, nnz, nullptr, dind, dy, result), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_doti_fn(handle, nnz, dx, nullptr, dy, result), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_doti_fn(handle, nnz, dx, dind, nullptr, result), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_doti_fn(handle, nnz, dx, dind, dy, nullptr), rocblas_status_invalid_pointer);
+
+EXPECT_ROCBLAS_STATUS(rocblas_doti_strided_batched_fn(nullptr, nnz, dx, stride_x, dind, stride_ind, dy, stride_y, batch_count, result), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_doti_strided_batched_fn(handle, -1, dx, stride_x, dind, stride_ind, dy, stride_y, batch_count, result), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_doti_strided_batched_fn(handle, nnz, dx, stride_x, dind, stride_ind, dy, stride_y, -1, result), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_doti_strided_batched_fn(handle, nnz, nullptr, stride_x, dind, stride_ind, dy, stride_y, batch_count, result), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_doti_strided_batched_fn(handle, nnz, dx, stride_x, nullptr, stride_ind, dy, stride_y, batch_count, result), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_doti_strided_batched_fn(handle, nnz, dx, stride_x, dind, stride_ind, nullptr, stride_y, batch_count, result), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_doti_strided_batched_fn(handle, nnz, dx, stride_x, dind, stride_ind, dy, stride_y, batch_count, nullptr), rocblas_status_invalid_pointer);
+
+// If batch_count is 0, nothing is dereferenced, and if nnz is 0 only the result is written
+EXPECT_ROCBLAS_STATUS(rocblas_doti_strided_batched_fn(handle, nnz, nullptr, stride_x, nullptr, stride_ind, nullptr, stride_y, 0, nullptr), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_doti_fn(handle, 0, nullptr, nullptr, nullptr, result), rocblas_status_success);
+        // clang-format on
+    }
+
+    // The result of an empty sparse vector is 0
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    h_result[0] = T(1);
+    CHECK_ROCBLAS_ERROR(rocblas_doti_fn(handle, 0, nullptr, nullptr, nullptr, h_result));
+    EXPECT_EQ(h_result[0], T(0));
+}
+
+template <typename T>
+void testing_dotci_bad_arg(const Arguments& arg)
+{
+    testing_doti_bad_arg<T, true>(arg);
+}
+
+// doti must match the sum over the nonzeros on the host, for each batch of the strided_batched
+// variant, with the results on the host and on the device
+template <typename T, bool CONJ = false>
+void testing_doti(const Arguments& arg)
+{
+    auto rocblas_doti_fn = CONJ ? rocblas_dotci<T> : rocblas_doti<T>;
+    auto rocblas_doti_strided_batched_fn
+        = CONJ ? rocblas_dotci_strided_batched<T> : rocblas_doti_strided_batched<T>;
+
+    rocblas_int N           = arg.N;
+    rocblas_int nnz         = arg.K;
+    rocblas_int batch_count = arg.batch_count;
+
+    rocblas_stride stride_x   = nnz;
+    rocblas_stride stride_ind = nnz;
+    rocblas_stride stride_y   = N;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = nnz < 0 || batch_count < 0;
+    if(invalid_size || !nnz || !batch_count)
+    {
+        host_vector<T> h_result(std::max(batch_count, 1));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        EXPECT_ROCBLAS_STATUS(rocblas_doti_strided_batched_fn(handle,
+                                                              nnz,
+                                                              nullptr,
+                                                              stride_x,
+                                                              nullptr,
+                                                              stride_ind,
+                                                              nullptr,
+                                                              stride_y,
+                                                              batch_count,
+                                                              h_result),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    host_strided_batch_vector<T> hx(nnz, 1, stride_x, batch_count);
+    host_vector<rocblas_int>     hind(size_t(nnz) * batch_count);
+    host_strided_batch_vector<T> hy(N, 1, stride_y, batch_count);
+    host_vector<T>               cpu_result(batch_count);
+    host_vector<T>               rocblas_result_1(batch_count);
+    host_vector<T>               rocblas_result_2(batch_count);
+    host_vector<T>               rocblas_result_3(batch_count);
+
+    // Allocate device memory
+    device_strided_batch_vector<T> dx(nnz, 1, stride_x, batch_count);
+    device_vector<rocblas_int>     dind(size_t(nnz) * batch_count);
+    device_strided_batch_vector<T> dy(N, 1, stride_y, batch_count);
+    device_vector<T>               d_rocblas_result_2(batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dind.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_rocblas_result_2.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false);
+    rocblas_init_sparse_indices(hind, nnz, N);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dind.transfer_from(hind));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_doti_strided_batched_fn(handle,
+                                                            nnz,
+                                                            dx,
+                                                            stride_x,
+                                                            dind,
+                                                            stride_ind,
+                                                            dy,
+                                                            stride_y,
+                                                            batch_count,
+                                                            rocblas_result_1));
+        handle.post_test(arg);
+
+        // The non batched function on each batch
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_doti_fn(handle,
+                                                nnz,
+                                                dx[b],
+                                                (rocblas_int*)dind + b * stride_ind,
+                                                dy[b],
+                                                &rocblas_result_3[b]));
+        }
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_doti_strided_batched_fn(handle,
+                                                            nnz,
+                                                            dx,
+                                                            stride_x,
+                                                            dind,
+                                                            stride_ind,
+                                                            dy,
+                                                            stride_y,
+                                                            batch_count,
+                                                            d_rocblas_result_2));
+        handle.post_test(arg);
+
+        CHECK_HIP_ERROR(rocblas_result_2.transfer_from(d_rocblas_result_2));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            T sum = T(0);
+            for(rocblas_int i = 0; i < nnz; i++)
+            {
+                T x_i = CONJ ? conjugate(hx[b][i]) : hx[b][i];
+                sum += x_i * hy[b][hind[b * stride_ind + i]];
+            }
+            cpu_result[b] = sum;
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, 1, 1, 1, cpu_result, rocblas_result_1, batch_count);
+            unit_check_general<T>(1, 1, 1, 1, cpu_result, rocblas_result_2, batch_count);
+            unit_check_general<T>(1, 1, 1, 1, cpu_result, rocblas_result_3, batch_count);
+        }
+
+        if(arg.norm_check)
+        {
+            for(int b = 0; b < batch_count; ++b)
+            {
+                rocblas_error_1
+                    += rocblas_abs((cpu_result[b] - rocblas_result_1[b]) / cpu_result[b]);
+                rocblas_error_2
+                    += rocblas_abs((cpu_result[b] - rocblas_result_2[b]) / cpu_result[b]);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_doti_strided_batched_fn(handle,
+                                            nnz,
+                                            dx,
+                                            stride_x,
+                                            dind,
+                                            stride_ind,
+                                            dy,
+                                            stride_y,
+                                            batch_count,
+                                            d_rocblas_result_2);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_doti_strided_batched_fn(handle,
+                                            nnz,
+                                            dx,
+                                            stride_x,
+                                            dind,
+                                            stride_ind,
+                                            dy,
+                                            stride_y,
+                                            batch_count,
+                                            d_rocblas_result_2);
+        });
+
+        ArgumentModel<e_N, e_K, e_batch_count>{}.log_args<T>(rocblas_cout,
+                                                             arg,
+                                                             gpu_time_used,
+                                                             dot_gflop_count<CONJ, T>(nnz),
+                                                             sparse_level1_gbyte_count<T>(nnz, 2),
+                                                             cpu_time_used,
+                                                             rocblas_error_1,
+                                                             rocblas_error_2);
+    }
+}
+
+template <typename T>
+void testing_dotci(const Arguments& arg)
+{
+    testing_doti<T, true>(arg);
+}
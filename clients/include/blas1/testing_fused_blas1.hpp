@@ -0,0 +1,736 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// The fused Level-1 functions are beta features without Fortran bindings, so only their
+// precision is templated here
+
+// axpy_dot, conjugating the updated y for complex types
+template <typename T>
+static rocblas_status (*rocblas_axpy_dot)(rocblas_handle handle,
+                                          rocblas_int    n,
+                                          const T*       alpha,
+                                          const T*       x,
+                                          rocblas_int    incx,
+                                          T*             y,
+                                          rocblas_int    incy,
+                                          const T*       z,
+                                          rocblas_int    incz,
+                                          T*             result);
+
+template <>
+static auto rocblas_axpy_dot<float> = rocblas_saxpy_dot;
+template <>
+static auto rocblas_axpy_dot<double> = rocblas_daxpy_dot;
+template <>
+static auto rocblas_axpy_dot<rocblas_float_complex> = rocblas_caxpy_dotc;
+template <>
+static auto rocblas_axpy_dot<rocblas_double_complex> = rocblas_zaxpy_dotc;
+
+// waxpby
+template <typename T>
+static rocblas_status (*rocblas_waxpby)(rocblas_handle handle,
+                                        rocblas_int    n,
+                                        const T*       alpha,
+                                        const T*       x,
+                                        rocblas_int    incx,
+                                        const T*       beta,
+                                        const T*       y,
+                                        rocblas_int    incy,
+                                        T*             w,
+                                        rocblas_int    incw);
+
+template <>
+static auto rocblas_waxpby<float> = rocblas_swaxpby;
+template <>
+static auto rocblas_waxpby<double> = rocblas_dwaxpby;
+template <>
+static auto rocblas_waxpby<rocblas_float_complex> = rocblas_cwaxpby;
+template <>
+static auto rocblas_waxpby<rocblas_double_complex> = rocblas_zwaxpby;
+
+// dot_nrm2, conjugating x for complex types
+template <typename T>
+static rocblas_status (*rocblas_dot_nrm2)(rocblas_handle handle,
+                                          rocblas_int    n,
+                                          const T*       x,
+                                          rocblas_int    incx,
+                                          const T*       y,
+                                          rocblas_int    incy,
+                                          T*             dot_result,
+                                          real_t<T>*     nrm2_result);
+
+template <>
+static auto rocblas_dot_nrm2<float> = rocblas_sdot_nrm2;
+template <>
+static auto rocblas_dot_nrm2<double> = rocblas_ddot_nrm2;
+template <>
+static auto rocblas_dot_nrm2<rocblas_float_complex> = rocblas_cdotc_nrm2;
+template <>
+static auto rocblas_dot_nrm2<rocblas_double_complex> = rocblas_zdotc_nrm2;
+
+// Reference for the dot products of the fused functions, which conjugate the first vector
+template <typename T>
+void cblas_fused_dot(
+    rocblas_int n, const T* x, rocblas_int incx, const T* y, rocblas_int incy, T* result)
+{
+    if constexpr(rocblas_is_complex<T>)
+        cblas_dotc<T>(n, x, incx, y, incy, result);
+    else
+        cblas_dot<T>(n, x, incx, y, incy, result);
+}
+
+// Tolerance for a reduction of N elements, which is summed in a different order than on the host
+template <typename T>
+double fused_blas1_tolerance(rocblas_int N, T cpu_result)
+{
+    double abs_result = double(rocblas_abs(cpu_result));
+    return 2.0 * std::numeric_limits<real_t<T>>::epsilon() * N * (abs_result > 0 ? abs_result : 1);
+}
+
+/* ============================================================================================ */
+template <typename T>
+void testing_axpy_dot_bad_arg(const Arguments& arg)
+{
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_int N    = 100;
+        rocblas_int incx = 1;
+        rocblas_int incy = 1;
+        rocblas_int incz = 1;
+
+        // Allocate device memory
+        device_vector<T> dx(N, incx);
+        device_vector<T> dy(N, incy);
+        device_vector<T> dz(N, incz);
+        device_vector<T> d_alpha(1);
+        device_vector<T> d_result(1);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy.memcheck());
+        CHECK_DEVICE_ALLOCATION(dz.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+        // don't dereference alpha or write to result, so device pointers are fine for both modes
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot<T>(nullptr, N, d_alpha, dx, incx, dy, incy, dz, incz, d_result),
+            rocblas_status_invalid_handle);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot<T>(handle, N, nullptr, dx, incx, dy, incy, dz, incz, d_result),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot<T>(handle, N, d_alpha, nullptr, incx, dy, incy, dz, incz, d_result),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot<T>(handle, N, d_alpha, dx, incx, nullptr, incy, dz, incz, d_result),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot<T>(handle, N, d_alpha, dx, incx, dy, incy, nullptr, incz, d_result),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot<T>(handle, N, d_alpha, dx, incx, dy, incy, dz, incz, nullptr),
+            rocblas_status_invalid_pointer);
+    }
+}
+
+// arg.algo makes z the same vector as y, as for the squared norm of an updated residual
+template <typename T>
+void testing_axpy_dot(const Arguments& arg)
+{
+    rocblas_int N       = arg.N;
+    rocblas_int incx    = arg.incx;
+    rocblas_int incy    = arg.incy;
+    rocblas_int incz    = arg.algo ? incy : arg.incd;
+    T           h_alpha = arg.get_alpha<T>();
+
+    rocblas_local_handle handle{arg};
+
+    // check to prevent undefined memory allocation error
+    if(N <= 0)
+    {
+        device_vector<T> d_result(1);
+        CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+        T cpu_0 = T(0);
+        T gpu_0 = T(1), gpu_1 = T(1);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_dot<T>(
+            handle, N, nullptr, nullptr, incx, nullptr, incy, nullptr, incz, d_result));
+        CHECK_HIP_ERROR(hipMemcpy(&gpu_0, d_result, sizeof(T), hipMemcpyDeviceToHost));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_dot<T>(
+            handle, N, nullptr, nullptr, incx, nullptr, incy, nullptr, incz, &gpu_1));
+
+        unit_check_general<T>(1, 1, 1, &cpu_0, &gpu_0);
+        unit_check_general<T>(1, 1, 1, &cpu_0, &gpu_1);
+        return;
+    }
+
+    rocblas_int abs_incy = incy >= 0 ? incy : -incy;
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    host_vector<T> hx(N, incx);
+    host_vector<T> hy(N, incy);
+    host_vector<T> hz(N, incz);
+    host_vector<T> hy_1(N, incy);
+    host_vector<T> hy_2(N, incy);
+    host_vector<T> hy_gold(N, incy);
+
+    // Allocate device memory
+    device_vector<T> dx(N, incx);
+    device_vector<T> dy_1(N, incy);
+    device_vector<T> dy_2(N, incy);
+    device_vector<T> dz(N, incz);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_result_2(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_result_2.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hz, arg, rocblas_client_alpha_sets_nan);
+
+    hy_gold = hy;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy_1.transfer_from(hy));
+    CHECK_HIP_ERROR(dz.transfer_from(hz));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    T cpu_result;
+    T rocblas_result_1;
+    T rocblas_result_2;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dy_2.transfer_from(hy));
+
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_dot<T>(handle,
+                                                N,
+                                                &h_alpha,
+                                                dx,
+                                                incx,
+                                                dy_1,
+                                                incy,
+                                                arg.algo ? dy_1 : dz,
+                                                incz,
+                                                &rocblas_result_1));
+        handle.post_test(arg);
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_dot<T>(handle,
+                                                N,
+                                                d_alpha,
+                                                dx,
+                                                incx,
+                                                dy_2,
+                                                incy,
+                                                arg.algo ? dy_2 : dz,
+                                                incz,
+                                                d_result_2));
+        handle.post_test(arg);
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+        cblas_axpy<T>(N, h_alpha, hx, incx, hy_gold, incy);
+        cblas_fused_dot<T>(N, hy_gold, incy, arg.algo ? hy_gold : hz, incz, &cpu_result);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy_1));
+        CHECK_HIP_ERROR(hy_2.transfer_from(dy_2));
+        CHECK_HIP_ERROR(
+            hipMemcpy(&rocblas_result_2, d_result_2, sizeof(T), hipMemcpyDeviceToHost));
+
+        if(arg.unit_check)
+        {
+            double tol = fused_blas1_tolerance(N, cpu_result);
+
+            unit_check_general<T>(1, N, abs_incy, hy_gold, hy_1);
+            unit_check_general<T>(1, N, abs_incy, hy_gold, hy_2);
+            near_check_general<T>(1, 1, 1, &cpu_result, &rocblas_result_1, tol);
+            near_check_general<T>(1, 1, 1, &cpu_result, &rocblas_result_2, tol);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', 1, N, abs_incy, hy_gold, hy_1);
+            rocblas_error_2 = norm_check_general<T>('F', 1, N, abs_incy, hy_gold, hy_2);
+            rocblas_error_1 += double(rocblas_abs((cpu_result - rocblas_result_1) / cpu_result));
+            rocblas_error_2 += double(rocblas_abs((cpu_result - rocblas_result_2) / cpu_result));
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_axpy_dot<T>(
+                handle, N, d_alpha, dx, incx, dy_1, incy, arg.algo ? dy_1 : dz, incz, d_result_2);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_axpy_dot<T>(
+                handle, N, d_alpha, dx, incx, dy_1, incy, arg.algo ? dy_1 : dz, incz, d_result_2);
+        });
+
+        ArgumentModel<e_N, e_alpha, e_incx, e_incy, e_incd, e_algo>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            axpy_gflop_count<T>(N) + dot_gflop_count<rocblas_is_complex<T>, T>(N),
+            axpy_gbyte_count<T>(N) + nrm2_gbyte_count<T>(N),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
+
+/* ============================================================================================ */
+template <typename T>
+void testing_waxpby_bad_arg(const Arguments& arg)
+{
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_int N    = 100;
+        rocblas_int incx = 1;
+        rocblas_int incy = 1;
+        rocblas_int incw = 1;
+
+        // Allocate device memory
+        device_vector<T> dx(N, incx);
+        device_vector<T> dy(N, incy);
+        device_vector<T> dw(N, incw);
+        device_vector<T> d_alpha(1);
+        device_vector<T> d_beta(1);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy.memcheck());
+        CHECK_DEVICE_ALLOCATION(dw.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_waxpby<T>(nullptr, N, d_alpha, dx, incx, d_beta, dy, incy, dw, incw),
+            rocblas_status_invalid_handle);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_waxpby<T>(handle, N, nullptr, dx, incx, d_beta, dy, incy, dw, incw),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_waxpby<T>(handle, N, d_alpha, nullptr, incx, d_beta, dy, incy, dw, incw),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_waxpby<T>(handle, N, d_alpha, dx, incx, nullptr, dy, incy, dw, incw),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_waxpby<T>(handle, N, d_alpha, dx, incx, d_beta, nullptr, incy, dw, incw),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_waxpby<T>(handle, N, d_alpha, dx, incx, d_beta, dy, incy, nullptr, incw),
+            rocblas_status_invalid_pointer);
+    }
+}
+
+// arg.algo writes w in place over y, as for the direction update of the conjugate gradient method
+template <typename T>
+void testing_waxpby(const Arguments& arg)
+{
+    rocblas_int N       = arg.N;
+    rocblas_int incx    = arg.incx;
+    rocblas_int incy    = arg.incy;
+    rocblas_int incw    = arg.algo ? incy : arg.incd;
+    T           h_alpha = arg.get_alpha<T>();
+    T           h_beta  = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+
+    // check to prevent undefined memory allocation error
+    if(N <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_waxpby<T>(
+            handle, N, nullptr, nullptr, incx, nullptr, nullptr, incy, nullptr, incw));
+        return;
+    }
+
+    rocblas_int abs_incw = incw >= 0 ? incw : -incw;
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    host_vector<T> hx(N, incx);
+    host_vector<T> hy(N, incy);
+    host_vector<T> hw(N, incw);
+    host_vector<T> hw_1(N, incw);
+    host_vector<T> hw_2(N, incw);
+    host_vector<T> hw_gold(N, incw);
+
+    // Allocate device memory
+    device_vector<T> dx(N, incx);
+    device_vector<T> dy_1(N, incy);
+    device_vector<T> dy_2(N, incy);
+    device_vector<T> dw_1(N, incw);
+    device_vector<T> dw_2(N, incw);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(dw_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dw_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_beta_sets_nan, false, true);
+    rocblas_init_vector(hw, arg, rocblas_client_never_set_nan);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy_1.transfer_from(hy));
+    CHECK_HIP_ERROR(dw_1.transfer_from(hw));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    T* dw_1_ptr = arg.algo ? (T*)dy_1 : (T*)dw_1;
+    T* dw_2_ptr = arg.algo ? (T*)dy_2 : (T*)dw_2;
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dy_2.transfer_from(hy));
+        CHECK_HIP_ERROR(dw_2.transfer_from(hw));
+
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_waxpby<T>(
+            handle, N, &h_alpha, dx, incx, &h_beta, dy_1, incy, dw_1_ptr, incw));
+        handle.post_test(arg);
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(
+            rocblas_waxpby<T>(handle, N, d_alpha, dx, incx, d_beta, dy_2, incy, dw_2_ptr, incw));
+        handle.post_test(arg);
+
+        // CPU BLAS, w := beta*y followed by w += alpha*x
+        cpu_time_used = get_time_us_no_sync();
+        cblas_copy<T>(N, hy, incy, hw_gold, incw);
+        cblas_scal<T>(N, h_beta, hw_gold, incw);
+        cblas_axpy<T>(N, h_alpha, hx, incx, hw_gold, incw);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hw_1.transfer_from(arg.algo ? dy_1 : dw_1));
+        CHECK_HIP_ERROR(hw_2.transfer_from(arg.algo ? dy_2 : dw_2));
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incw, hw_gold, hw_1);
+            unit_check_general<T>(1, N, abs_incw, hw_gold, hw_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', 1, N, abs_incw, hw_gold, hw_1);
+            rocblas_error_2 = norm_check_general<T>('F', 1, N, abs_incw, hw_gold, hw_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_waxpby<T>(handle, N, &h_alpha, dx, incx, &h_beta, dy_1, incy, dw_1_ptr, incw);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_waxpby<T>(handle, N, &h_alpha, dx, incx, &h_beta, dy_1, incy, dw_1_ptr, incw);
+        });
+
+        ArgumentModel<e_N, e_alpha, e_incx, e_beta, e_incy, e_incd, e_algo>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            axpby_gflop_count<T>(N),
+            axpy_gbyte_count<T>(N),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
+
+/* ============================================================================================ */
+template <typename T>
+void testing_dot_nrm2_bad_arg(const Arguments& arg)
+{
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_int N    = 100;
+        rocblas_int incx = 1;
+        rocblas_int incy = 1;
+
+        // Allocate device memory
+        device_vector<T>         dx(N, incx);
+        device_vector<T>         dy(N, incy);
+        device_vector<T>         d_dot(1);
+        device_vector<real_t<T>> d_nrm2(1);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_dot.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_nrm2.memcheck());
+
+        // don't write to the results, so device pointers are fine for both modes
+
+        EXPECT_ROCBLAS_STATUS(rocblas_dot_nrm2<T>(nullptr, N, dx, incx, dy, incy, d_dot, d_nrm2),
+                              rocblas_status_invalid_handle);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot_nrm2<T>(handle, N, nullptr, incx, dy, incy, d_dot, d_nrm2),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot_nrm2<T>(handle, N, dx, incx, nullptr, incy, d_dot, d_nrm2),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_dot_nrm2<T>(handle, N, dx, incx, dy, incy, nullptr, d_nrm2),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_dot_nrm2<T>(handle, N, dx, incx, dy, incy, d_dot, nullptr),
+                              rocblas_status_invalid_pointer);
+    }
+}
+
+template <typename T>
+void testing_dot_nrm2(const Arguments& arg)
+{
+    using Tr = real_t<T>;
+
+    rocblas_int N    = arg.N;
+    rocblas_int incx = arg.incx;
+    rocblas_int incy = arg.incy;
+
+    rocblas_local_handle handle{arg};
+
+    // check to prevent undefined memory allocation error
+    if(N <= 0)
+    {
+        device_vector<T>  d_dot(1);
+        device_vector<Tr> d_nrm2(1);
+        CHECK_DEVICE_ALLOCATION(d_dot.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_nrm2.memcheck());
+
+        T  dot_0 = T(1), dot_1 = T(1), cpu_dot_0 = T(0);
+        Tr nrm2_0 = Tr(1), nrm2_1 = Tr(1), cpu_nrm2_0 = Tr(0);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_dot_nrm2<T>(handle, N, nullptr, incx, nullptr, incy, d_dot, d_nrm2));
+        CHECK_HIP_ERROR(hipMemcpy(&dot_0, d_dot, sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(&nrm2_0, d_nrm2, sizeof(Tr), hipMemcpyDeviceToHost));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_dot_nrm2<T>(handle, N, nullptr, incx, nullptr, incy, &dot_1, &nrm2_1));
+
+        unit_check_general<T>(1, 1, 1, &cpu_dot_0, &dot_0);
+        unit_check_general<T>(1, 1, 1, &cpu_dot_0, &dot_1);
+        unit_check_general<Tr>(1, 1, 1, &cpu_nrm2_0, &nrm2_0);
+        unit_check_general<Tr>(1, 1, 1, &cpu_nrm2_0, &nrm2_1);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    host_vector<T> hx(N, incx);
+    host_vector<T> hy(N, incy);
+
+    // Allocate device memory
+    device_vector<T>  dx(N, incx);
+    device_vector<T>  dy(N, incy);
+    device_vector<T>  d_dot_2(1);
+    device_vector<Tr> d_nrm2_2(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_dot_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_nrm2_2.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false, true);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    T  cpu_dot, rocblas_dot_1, rocblas_dot_2;
+    Tr cpu_nrm2, rocblas_nrm2_1, rocblas_nrm2_2;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_dot_nrm2<T>(
+            handle, N, dx, incx, dy, incy, &rocblas_dot_1, &rocblas_nrm2_1));
+        handle.post_test(arg);
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(
+            rocblas_dot_nrm2<T>(handle, N, dx, incx, dy, incy, d_dot_2, d_nrm2_2));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hipMemcpy(&rocblas_dot_2, d_dot_2, sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(&rocblas_nrm2_2, d_nrm2_2, sizeof(Tr), hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+        cblas_fused_dot<T>(N, hx, incx, hy, incy, &cpu_dot);
+        cblas_nrm2<T>(N, hx, incx, &cpu_nrm2);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            double dot_tol  = fused_blas1_tolerance(N, cpu_dot);
+            double nrm2_tol = fused_blas1_tolerance(N, cpu_nrm2);
+
+            near_check_general<T>(1, 1, 1, &cpu_dot, &rocblas_dot_1, dot_tol);
+            near_check_general<T>(1, 1, 1, &cpu_dot, &rocblas_dot_2, dot_tol);
+            near_check_general<Tr>(1, 1, 1, &cpu_nrm2, &rocblas_nrm2_1, nrm2_tol);
+            near_check_general<Tr>(1, 1, 1, &cpu_nrm2, &rocblas_nrm2_2, nrm2_tol);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = double(rocblas_abs((cpu_dot - rocblas_dot_1) / cpu_dot))
+                              + double(rocblas_abs((cpu_nrm2 - rocblas_nrm2_1) / cpu_nrm2));
+            rocblas_error_2 = double(rocblas_abs((cpu_dot - rocblas_dot_2) / cpu_dot))
+                              + double(rocblas_abs((cpu_nrm2 - rocblas_nrm2_2) / cpu_nrm2));
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_dot_nrm2<T>(handle, N, dx, incx, dy, incy, d_dot_2, d_nrm2_2);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_dot_nrm2<T>(handle, N, dx, incx, dy, incy, d_dot_2, d_nrm2_2);
+        });
+
+        ArgumentModel<e_N, e_incx, e_incy>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            dot_gflop_count<rocblas_is_complex<T>, T>(N) + nrm2_gflop_count<T>(N),
+            dot_gbyte_count<T>(N),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
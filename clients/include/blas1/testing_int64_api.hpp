@@ -0,0 +1,420 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// The _64 functions are beta features, so they are templated here rather than in rocblas.hpp
+#define MAP2CF_64(FN, A, PFN)       \
+    template <>                     \
+    static auto FN<A, false> = PFN; \
+    template <>                     \
+    static auto FN<A, true> = PFN##_fortran
+
+// axpy_64
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_axpy_64)(rocblas_handle handle,
+                                         int64_t        n,
+                                         const T*       alpha,
+                                         const T*       x,
+                                         int64_t        incx,
+                                         T*             y,
+                                         int64_t        incy);
+
+MAP2CF_64(rocblas_axpy_64, float, rocblas_saxpy_64);
+MAP2CF_64(rocblas_axpy_64, double, rocblas_daxpy_64);
+MAP2CF_64(rocblas_axpy_64, rocblas_float_complex, rocblas_caxpy_64);
+MAP2CF_64(rocblas_axpy_64, rocblas_double_complex, rocblas_zaxpy_64);
+
+// scal_64
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_scal_64)(
+    rocblas_handle handle, int64_t n, const T* alpha, T* x, int64_t incx);
+
+MAP2CF_64(rocblas_scal_64, float, rocblas_sscal_64);
+MAP2CF_64(rocblas_scal_64, double, rocblas_dscal_64);
+MAP2CF_64(rocblas_scal_64, rocblas_float_complex, rocblas_cscal_64);
+MAP2CF_64(rocblas_scal_64, rocblas_double_complex, rocblas_zscal_64);
+
+// copy_64
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_copy_64)(
+    rocblas_handle handle, int64_t n, const T* x, int64_t incx, T* y, int64_t incy);
+
+MAP2CF_64(rocblas_copy_64, float, rocblas_scopy_64);
+MAP2CF_64(rocblas_copy_64, double, rocblas_dcopy_64);
+MAP2CF_64(rocblas_copy_64, rocblas_float_complex, rocblas_ccopy_64);
+MAP2CF_64(rocblas_copy_64, rocblas_double_complex, rocblas_zcopy_64);
+
+// swap_64
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_swap_64)(
+    rocblas_handle handle, int64_t n, T* x, int64_t incx, T* y, int64_t incy);
+
+MAP2CF_64(rocblas_swap_64, float, rocblas_sswap_64);
+MAP2CF_64(rocblas_swap_64, double, rocblas_dswap_64);
+MAP2CF_64(rocblas_swap_64, rocblas_float_complex, rocblas_cswap_64);
+MAP2CF_64(rocblas_swap_64, rocblas_double_complex, rocblas_zswap_64);
+
+// dot_64
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_dot_64)(rocblas_handle handle,
+                                        int64_t        n,
+                                        const T*       x,
+                                        int64_t        incx,
+                                        const T*       y,
+                                        int64_t        incy,
+                                        T*             result);
+
+MAP2CF_64(rocblas_dot_64, float, rocblas_sdot_64);
+MAP2CF_64(rocblas_dot_64, double, rocblas_ddot_64);
+MAP2CF_64(rocblas_dot_64, rocblas_float_complex, rocblas_cdotu_64);
+MAP2CF_64(rocblas_dot_64, rocblas_double_complex, rocblas_zdotu_64);
+
+// gemv_64
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_gemv_64)(rocblas_handle    handle,
+                                         rocblas_operation transA,
+                                         int64_t           m,
+                                         int64_t           n,
+                                         const T*          alpha,
+                                         const T*          A,
+                                         int64_t           lda,
+                                         const T*          x,
+                                         int64_t           incx,
+                                         const T*          beta,
+                                         T*                y,
+                                         int64_t           incy);
+
+MAP2CF_64(rocblas_gemv_64, float, rocblas_sgemv_64);
+MAP2CF_64(rocblas_gemv_64, double, rocblas_dgemv_64);
+MAP2CF_64(rocblas_gemv_64, rocblas_float_complex, rocblas_cgemv_64);
+MAP2CF_64(rocblas_gemv_64, rocblas_double_complex, rocblas_zgemv_64);
+
+#undef MAP2CF_64
+
+/* ============================================================================================ */
+template <typename T>
+void testing_int64_api_bad_arg(const Arguments& arg)
+{
+    const bool FORTRAN = arg.fortran;
+
+    auto rocblas_axpy_fn = FORTRAN ? rocblas_axpy_64<T, true> : rocblas_axpy_64<T, false>;
+    auto rocblas_dot_fn  = FORTRAN ? rocblas_dot_64<T, true> : rocblas_dot_64<T, false>;
+    auto rocblas_gemv_fn = FORTRAN ? rocblas_gemv_64<T, true> : rocblas_gemv_64<T, false>;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    const int64_t N = 100;
+    const T       alpha(1), beta(1);
+    T             result;
+
+    device_vector<T> dA(N * N), dx(N), dy(N);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_fn(nullptr, N, &alpha, dx, 1, dy, 1),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_dot_fn(nullptr, N, dx, 1, dy, 1, &result),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemv_fn(
+            nullptr, rocblas_operation_none, N, N, &alpha, dA, N, dx, 1, &beta, dy, 1),
+        rocblas_status_invalid_handle);
+
+    // Sizes which do not fit in rocblas_int are still checked
+    const int64_t N_64 = int64_t(1) << 32;
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_fn(handle, N_64, &alpha, nullptr, 1, nullptr, 1),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_dot_fn(handle, N_64, nullptr, 1, nullptr, 1, &result),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_fn(handle,
+                                          rocblas_operation_none,
+                                          N_64,
+                                          1,
+                                          &alpha,
+                                          nullptr,
+                                          1,
+                                          nullptr,
+                                          1,
+                                          &beta,
+                                          nullptr,
+                                          1),
+                          rocblas_status_invalid_size);
+}
+
+// The _64 functions must give the results of the rocblas_int functions for problems which fit
+// in rocblas_int
+template <typename T>
+void testing_int64_api(const Arguments& arg)
+{
+    const bool FORTRAN = arg.fortran;
+
+    auto rocblas_axpy_64_fn = FORTRAN ? rocblas_axpy_64<T, true> : rocblas_axpy_64<T, false>;
+    auto rocblas_scal_64_fn = FORTRAN ? rocblas_scal_64<T, true> : rocblas_scal_64<T, false>;
+    auto rocblas_copy_64_fn = FORTRAN ? rocblas_copy_64<T, true> : rocblas_copy_64<T, false>;
+    auto rocblas_swap_64_fn = FORTRAN ? rocblas_swap_64<T, true> : rocblas_swap_64<T, false>;
+    auto rocblas_dot_64_fn  = FORTRAN ? rocblas_dot_64<T, true> : rocblas_dot_64<T, false>;
+    auto rocblas_gemv_64_fn = FORTRAN ? rocblas_gemv_64<T, true> : rocblas_gemv_64<T, false>;
+
+    rocblas_int       M       = arg.M;
+    rocblas_int       N       = arg.N;
+    rocblas_int       lda     = arg.lda;
+    rocblas_int       incx    = arg.incx;
+    rocblas_int       incy    = arg.incy;
+    T                 h_alpha = arg.get_alpha<T>();
+    T                 h_beta  = arg.get_beta<T>();
+    rocblas_operation transA  = char2rocblas_operation(arg.transA);
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || lda < M || lda < 1 || !incx || !incy;
+    if(invalid_size || !M || !N)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        if(N <= 0)
+            CHECK_ROCBLAS_ERROR(
+                rocblas_axpy_64_fn(handle, N, nullptr, nullptr, incx, nullptr, incy));
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemv_64_fn(
+                handle, transA, M, N, nullptr, nullptr, lda, nullptr, incx, nullptr, nullptr, incy),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+
+        return;
+    }
+
+    rocblas_int abs_incx = incx >= 0 ? incx : -incx;
+    rocblas_int abs_incy = incy >= 0 ? incy : -incy;
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    host_vector<T> hx(N, incx);
+    host_vector<T> hy(N, incy);
+    host_vector<T> hx_1(N, incx);
+    host_vector<T> hx_64(N, incx);
+    host_vector<T> hy_1(N, incy);
+    host_vector<T> hy_64(N, incy);
+
+    // Allocate device memory
+    device_vector<T> dx(N, incx);
+    device_vector<T> dy(N, incy);
+    device_vector<T> dx_64(N, incx);
+    device_vector<T> dy_64(N, incy);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_64.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_64.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false, true);
+
+    auto reset = [&] {
+        CHECK_HIP_ERROR(dx.transfer_from(hx));
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_HIP_ERROR(dx_64.transfer_from(hx));
+        CHECK_HIP_ERROR(dy_64.transfer_from(hy));
+    };
+    auto check_x = [&] {
+        CHECK_HIP_ERROR(hx_1.transfer_from(dx));
+        CHECK_HIP_ERROR(hx_64.transfer_from(dx_64));
+        unit_check_general<T>(1, N, abs_incx, hx_1, hx_64);
+    };
+    auto check_y = [&] {
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy));
+        CHECK_HIP_ERROR(hy_64.transfer_from(dy_64));
+        unit_check_general<T>(1, N, abs_incy, hy_1, hy_64);
+    };
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        reset();
+        CHECK_ROCBLAS_ERROR(rocblas_axpy<T>(handle, N, &h_alpha, dx, incx, dy, incy));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_64_fn(handle, N, &h_alpha, dx_64, incx, dy_64, incy));
+        check_y();
+
+        reset();
+        CHECK_ROCBLAS_ERROR(rocblas_scal<T>(handle, N, &h_alpha, dx, incx));
+        CHECK_ROCBLAS_ERROR(rocblas_scal_64_fn(handle, N, &h_alpha, dx_64, incx));
+        check_x();
+
+        reset();
+        CHECK_ROCBLAS_ERROR(rocblas_copy<T>(handle, N, dx, incx, dy, incy));
+        CHECK_ROCBLAS_ERROR(rocblas_copy_64_fn(handle, N, dx_64, incx, dy_64, incy));
+        check_y();
+
+        reset();
+        CHECK_ROCBLAS_ERROR(rocblas_swap<T>(handle, N, dx, incx, dy, incy));
+        CHECK_ROCBLAS_ERROR(rocblas_swap_64_fn(handle, N, dx_64, incx, dy_64, incy));
+        check_x();
+        check_y();
+
+        reset();
+        T h_dot, h_dot_64;
+        CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, dx, incx, dy, incy, &h_dot));
+        CHECK_ROCBLAS_ERROR(rocblas_dot_64_fn(handle, N, dx_64, incx, dy_64, incy, &h_dot_64));
+        unit_check_general<T>(1, 1, 1, &h_dot, &h_dot_64);
+    }
+
+    // gemv with an M x N matrix, checked against CBLAS and rocblas_gemv in both pointer modes
+    size_t dim_x = transA == rocblas_operation_none ? N : M;
+    size_t dim_y = transA == rocblas_operation_none ? M : N;
+
+    host_matrix<T> hA(M, N, lda);
+    host_vector<T> hgx(dim_x, incx);
+    host_vector<T> hgy(dim_y, incy);
+    host_vector<T> hgy_1(dim_y, incy);
+    host_vector<T> hgy_2(dim_y, incy);
+    host_vector<T> hgy_int(dim_y, incy);
+    host_vector<T> hgy_gold(dim_y, incy);
+
+    device_matrix<T> dA(M, N, lda);
+    device_vector<T> dgx(dim_x, incx);
+    device_vector<T> dgy_1(dim_y, incy);
+    device_vector<T> dgy_2(dim_y, incy);
+    device_vector<T> dgy_int(dim_y, incy);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dgx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dgy_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dgy_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(dgy_int.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_vector(hgx, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hgy, arg, rocblas_client_beta_sets_nan);
+
+    hgy_gold = hgy;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dgx.transfer_from(hgx));
+    CHECK_HIP_ERROR(dgy_1.transfer_from(hgy));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dgy_2.transfer_from(hgy));
+        CHECK_HIP_ERROR(dgy_int.transfer_from(hgy));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_64_fn(
+            handle, transA, M, N, &h_alpha, dA, lda, dgx, incx, &h_beta, dgy_1, incy));
+        handle.post_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemv<T>(
+            handle, transA, M, N, &h_alpha, dA, lda, dgx, incx, &h_beta, dgy_int, incy));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_64_fn(
+            handle, transA, M, N, d_alpha, dA, lda, dgx, incx, d_beta, dgy_2, incy));
+        handle.post_test(arg);
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        cblas_gemv<T>(transA, M, N, h_alpha, hA, lda, hgx, incx, h_beta, hgy_gold, incy);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hgy_1.transfer_from(dgy_1));
+        CHECK_HIP_ERROR(hgy_2.transfer_from(dgy_2));
+        CHECK_HIP_ERROR(hgy_int.transfer_from(dgy_int));
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, dim_y, abs_incy, hgy_gold, hgy_1);
+            unit_check_general<T>(1, dim_y, abs_incy, hgy_gold, hgy_2);
+            unit_check_general<T>(1, dim_y, abs_incy, hgy_int, hgy_1);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', 1, dim_y, abs_incy, hgy_gold, hgy_1);
+            rocblas_error_2 = norm_check_general<T>('F', 1, dim_y, abs_incy, hgy_gold, hgy_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_gemv_64_fn(
+                handle, transA, M, N, &h_alpha, dA, lda, dgx, incx, &h_beta, dgy_1, incy);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_gemv_64_fn(
+                handle, transA, M, N, &h_alpha, dA, lda, dgx, incx, &h_beta, dgy_1, incy);
+        });
+
+        ArgumentModel<e_transA, e_M, e_N, e_alpha, e_lda, e_incx, e_beta, e_incy>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            gemv_gflop_count<T>(transA, M, N),
+            gemv_gbyte_count<T>(transA, M, N),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
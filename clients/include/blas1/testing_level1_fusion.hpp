@@ -0,0 +1,224 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <cmath>
+
+template <typename T>
+void testing_level1_fusion_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    bool enabled = true;
+    EXPECT_ROCBLAS_STATUS(rocblas_set_level1_fusion(nullptr, true), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_level1_fusion(nullptr, &enabled),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_level1_fusion(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_flush_level1_fusion(nullptr), rocblas_status_invalid_handle);
+
+    // disabled by default, and an empty queue may be flushed
+    CHECK_ROCBLAS_ERROR(rocblas_get_level1_fusion(handle, &enabled));
+    EXPECT_FALSE(enabled);
+    CHECK_ROCBLAS_ERROR(rocblas_flush_level1_fusion(handle));
+}
+
+// Level 1 calls deferred by the fusion mode must give the results of the calls run one by one,
+// once flushed or when a reduction consumes them
+template <typename T>
+void testing_level1_fusion(const Arguments& arg)
+{
+    rocblas_int N       = arg.N;
+    T           h_alpha = arg.get_alpha<T>();
+
+    const T minus_one(-1), three(3);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(rocblas_set_level1_fusion(handle, true));
+
+    bool enabled = false;
+    CHECK_ROCBLAS_ERROR(rocblas_get_level1_fusion(handle, &enabled));
+    EXPECT_TRUE(enabled);
+
+    // quick return queues nothing
+    if(N <= 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_axpy<T>(handle, N, &h_alpha, nullptr, 1, nullptr, 1),
+                              rocblas_status_success);
+        CHECK_ROCBLAS_ERROR(rocblas_flush_level1_fusion(handle));
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hy_1), `d` is in GPU (device) memory (eg dy).
+    // Allocate host memory
+    host_vector<T> hx(N);
+    host_vector<T> hy(N);
+    host_vector<T> hz(N);
+    host_vector<T> hw_1(N);
+    host_vector<T> hx_1(N);
+    host_vector<T> hy_1(N);
+    host_vector<T> hz_1(N);
+
+    // Allocate device memory
+    device_vector<T> dx(N);
+    device_vector<T> dy(N);
+    device_vector<T> dz(N);
+    device_vector<T> dw(N);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+    CHECK_DEVICE_ALLOCATION(dw.memcheck());
+
+    // Initialize data on host memory; small integers keep every result but nrm2 exact
+    rocblas_init_vector(hx, arg, rocblas_client_never_set_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_never_set_nan);
+    rocblas_init_vector(hz, arg, rocblas_client_never_set_nan, false, true);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(dz.transfer_from(hz));
+
+    // w = x, y = -(alpha x + y), z = 3 w + z, result = y . z
+    auto level1_sequence = [&](T* result) {
+        CHECK_ROCBLAS_ERROR(rocblas_copy<T>(handle, N, dx, 1, dw, 1));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy<T>(handle, N, &h_alpha, dx, 1, dy, 1));
+        CHECK_ROCBLAS_ERROR(rocblas_scal<T>(handle, N, &minus_one, dy, 1));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy<T>(handle, N, &three, dw, 1, dz, 1));
+        if(result)
+            CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, dy, 1, dz, 1, result));
+    };
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error          = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        handle.pre_test(arg);
+        level1_sequence(nullptr);
+
+        // Nothing has run yet
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy));
+        unit_check_general<T>(1, N, 1, hy, hy_1);
+
+        T result;
+        CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, dy, 1, dz, 1, &result));
+        handle.post_test(arg);
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        double dot_gold = 0;
+        for(rocblas_int i = 0; i < N; i++)
+        {
+            hy[i] = -(h_alpha * hx[i] + hy[i]);
+            hz[i] = three * hx[i] + hz[i];
+            dot_gold += double(hy[i]) * hz[i];
+        }
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        T result_gold(dot_gold);
+        unit_check_general<T>(1, 1, 1, &result_gold, &result);
+
+        CHECK_HIP_ERROR(hw_1.transfer_from(dw));
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy));
+        CHECK_HIP_ERROR(hz_1.transfer_from(dz));
+        unit_check_general<T>(1, N, 1, hx, hw_1);
+        unit_check_general<T>(1, N, 1, hy, hy_1);
+        unit_check_general<T>(1, N, 1, hz, hz_1);
+
+        // A flush runs the queue; a nrm2 consumes it
+        CHECK_ROCBLAS_ERROR(rocblas_scal<T>(handle, N, &h_alpha, dx, 1));
+        CHECK_ROCBLAS_ERROR(rocblas_flush_level1_fusion(handle));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy<T>(handle, N, &minus_one, dy, 1, dx, 1));
+        CHECK_ROCBLAS_ERROR(rocblas_nrm2<T>(handle, N, dx, 1, &result));
+
+        double nrm2_gold = 0;
+        for(rocblas_int i = 0; i < N; i++)
+        {
+            hx[i] = h_alpha * hx[i] - hy[i];
+            nrm2_gold += double(hx[i]) * hx[i];
+        }
+        nrm2_gold = std::sqrt(nrm2_gold);
+
+        T    nrm2_gold_T(nrm2_gold);
+        auto tol = nrm2_gold * N * std::numeric_limits<T>::epsilon();
+        if(arg.unit_check)
+            near_check_general<T>(1, 1, 1, &nrm2_gold_T, &result, tol);
+        if(arg.norm_check)
+            rocblas_error = std::abs(nrm2_gold - result) / nrm2_gold;
+
+        // Disabling the fusion runs the queue
+        CHECK_ROCBLAS_ERROR(rocblas_copy<T>(handle, N, dz, 1, dx, 1));
+        CHECK_ROCBLAS_ERROR(rocblas_set_level1_fusion(handle, false));
+        CHECK_ROCBLAS_ERROR(rocblas_get_level1_fusion(handle, &enabled));
+        EXPECT_FALSE(enabled);
+
+        CHECK_HIP_ERROR(hx_1.transfer_from(dx));
+        unit_check_general<T>(1, N, 1, hz, hx_1);
+        CHECK_ROCBLAS_ERROR(rocblas_set_level1_fusion(handle, true));
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        T result;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+            level1_sequence(&result);
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used
+            = get_time_us_hot_calls(stream, number_hot_calls, [&] { level1_sequence(&result); });
+
+        // The fused sequence reads x, y and z, and writes w, y and z, once each
+        ArgumentModel<e_N, e_alpha>{}.log_args<T>(rocblas_cout,
+                                                  arg,
+                                                  gpu_time_used,
+                                                  2 * axpy_gflop_count<T>(N)
+                                                      + scal_gflop_count<T, T>(N)
+                                                      + dot_gflop_count<false, T>(N),
+                                                  6.0 * N * sizeof(T) / 1e9,
+                                                  cpu_time_used,
+                                                  rocblas_error);
+    }
+}
@@ -169,6 +169,7 @@ void testing_nrm2_strided_batched(const Arguments& arg)
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
 
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
             cblas_nrm2<T>(N, hx[b], incx, cpu_result + b);
 
@@ -225,15 +226,10 @@ void testing_nrm2_strided_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_nrm2_strided_batched_fn(
                 handle, N, dx, incx, stridex, batch_count, d_rocblas_result_2);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_N, e_incx, e_stride_x, e_batch_count>{}.log_args<T>(rocblas_cout,
                                                                             arg,
@@ -0,0 +1,1022 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// The planar complex functions are beta features without Fortran bindings
+
+// axpy_planar
+template <typename T>
+static rocblas_status (*rocblas_axpy_planar)(rocblas_handle   handle,
+                                             rocblas_int      n,
+                                             const T*         alpha,
+                                             const real_t<T>* x_real,
+                                             const real_t<T>* x_imag,
+                                             rocblas_int      incx,
+                                             real_t<T>*       y_real,
+                                             real_t<T>*       y_imag,
+                                             rocblas_int      incy);
+
+template <>
+static auto rocblas_axpy_planar<rocblas_float_complex> = rocblas_caxpy_planar;
+template <>
+static auto rocblas_axpy_planar<rocblas_double_complex> = rocblas_zaxpy_planar;
+
+// axpy_planar_strided_batched
+template <typename T>
+static rocblas_status (*rocblas_axpy_planar_strided_batched)(rocblas_handle   handle,
+                                                             rocblas_int      n,
+                                                             const T*         alpha,
+                                                             const real_t<T>* x_real,
+                                                             const real_t<T>* x_imag,
+                                                             rocblas_int      incx,
+                                                             rocblas_stride   stride_x,
+                                                             real_t<T>*       y_real,
+                                                             real_t<T>*       y_imag,
+                                                             rocblas_int      incy,
+                                                             rocblas_stride   stride_y,
+                                                             rocblas_int      batch_count);
+
+template <>
+static auto rocblas_axpy_planar_strided_batched<rocblas_float_complex>
+    = rocblas_caxpy_planar_strided_batched;
+template <>
+static auto rocblas_axpy_planar_strided_batched<rocblas_double_complex>
+    = rocblas_zaxpy_planar_strided_batched;
+
+// scal_planar
+template <typename T>
+static rocblas_status (*rocblas_scal_planar)(rocblas_handle handle,
+                                             rocblas_int    n,
+                                             const T*       alpha,
+                                             real_t<T>*     x_real,
+                                             real_t<T>*     x_imag,
+                                             rocblas_int    incx);
+
+template <>
+static auto rocblas_scal_planar<rocblas_float_complex> = rocblas_cscal_planar;
+template <>
+static auto rocblas_scal_planar<rocblas_double_complex> = rocblas_zscal_planar;
+
+// scal_planar_strided_batched
+template <typename T>
+static rocblas_status (*rocblas_scal_planar_strided_batched)(rocblas_handle handle,
+                                                             rocblas_int    n,
+                                                             const T*       alpha,
+                                                             real_t<T>*     x_real,
+                                                             real_t<T>*     x_imag,
+                                                             rocblas_int    incx,
+                                                             rocblas_stride stride_x,
+                                                             rocblas_int    batch_count);
+
+template <>
+static auto rocblas_scal_planar_strided_batched<rocblas_float_complex>
+    = rocblas_cscal_planar_strided_batched;
+template <>
+static auto rocblas_scal_planar_strided_batched<rocblas_double_complex>
+    = rocblas_zscal_planar_strided_batched;
+
+// dotu_planar and dotc_planar
+template <typename T, bool CONJ>
+static rocblas_status (*rocblas_dot_planar)(rocblas_handle   handle,
+                                            rocblas_int      n,
+                                            const real_t<T>* x_real,
+                                            const real_t<T>* x_imag,
+                                            rocblas_int      incx,
+                                            const real_t<T>* y_real,
+                                            const real_t<T>* y_imag,
+                                            rocblas_int      incy,
+                                            T*               result);
+
+template <>
+static auto rocblas_dot_planar<rocblas_float_complex, false> = rocblas_cdotu_planar;
+template <>
+static auto rocblas_dot_planar<rocblas_double_complex, false> = rocblas_zdotu_planar;
+template <>
+static auto rocblas_dot_planar<rocblas_float_complex, true> = rocblas_cdotc_planar;
+template <>
+static auto rocblas_dot_planar<rocblas_double_complex, true> = rocblas_zdotc_planar;
+
+// dotu_planar_strided_batched and dotc_planar_strided_batched
+template <typename T, bool CONJ>
+static rocblas_status (*rocblas_dot_planar_strided_batched)(rocblas_handle   handle,
+                                                            rocblas_int      n,
+                                                            const real_t<T>* x_real,
+                                                            const real_t<T>* x_imag,
+                                                            rocblas_int      incx,
+                                                            rocblas_stride   stride_x,
+                                                            const real_t<T>* y_real,
+                                                            const real_t<T>* y_imag,
+                                                            rocblas_int      incy,
+                                                            rocblas_stride   stride_y,
+                                                            rocblas_int      batch_count,
+                                                            T*               result);
+
+template <>
+static auto rocblas_dot_planar_strided_batched<rocblas_float_complex, false>
+    = rocblas_cdotu_planar_strided_batched;
+template <>
+static auto rocblas_dot_planar_strided_batched<rocblas_double_complex, false>
+    = rocblas_zdotu_planar_strided_batched;
+template <>
+static auto rocblas_dot_planar_strided_batched<rocblas_float_complex, true>
+    = rocblas_cdotc_planar_strided_batched;
+template <>
+static auto rocblas_dot_planar_strided_batched<rocblas_double_complex, true>
+    = rocblas_zdotc_planar_strided_batched;
+
+// Copy the complex elements of a host strided batch vector or matrix to the real and imaginary
+// arrays of its planar copy. A vector is a single row with the absolute increment as ld.
+template <typename U, typename V>
+void rocblas_planar_split(size_t      rows,
+                          size_t      cols,
+                          size_t      ld,
+                          rocblas_int batch_count,
+                          const U&    h,
+                          V&          h_real,
+                          V&          h_imag)
+{
+    for(rocblas_int b = 0; b < batch_count; b++)
+        for(size_t j = 0; j < cols; j++)
+            for(size_t i = 0; i < rows; i++)
+            {
+                h_real[b][i + j * ld] = h[b][i + j * ld].real();
+                h_imag[b][i + j * ld] = h[b][i + j * ld].imag();
+            }
+}
+
+// The inverse of rocblas_planar_split
+template <typename U, typename V>
+void rocblas_planar_merge(size_t      rows,
+                          size_t      cols,
+                          size_t      ld,
+                          rocblas_int batch_count,
+                          const V&    h_real,
+                          const V&    h_imag,
+                          U&          h)
+{
+    for(rocblas_int b = 0; b < batch_count; b++)
+        for(size_t j = 0; j < cols; j++)
+            for(size_t i = 0; i < rows; i++)
+                h[b][i + j * ld] = {h_real[b][i + j * ld], h_imag[b][i + j * ld]};
+}
+
+template <typename T>
+void testing_axpy_planar_bad_arg(const Arguments& arg)
+{
+    using Tr = real_t<T>;
+
+    auto rocblas_axpy_planar_fn                 = rocblas_axpy_planar<T>;
+    auto rocblas_axpy_planar_strided_batched_fn = rocblas_axpy_planar_strided_batched<T>;
+
+    rocblas_int    N           = 100;
+    rocblas_int    incx        = 1;
+    rocblas_int    incy        = 1;
+    rocblas_int    batch_count = 2;
+    rocblas_stride stride_x    = N;
+    rocblas_stride stride_y    = N;
+
+    rocblas_local_handle handle{arg};
+
+    // Allocate device memory
+    device_strided_batch_vector<Tr> dx_r(N, incx, stride_x, batch_count);
+    device_strided_batch_vector<Tr> dx_i(N, incx, stride_x, batch_count);
+    device_strided_batch_vector<Tr> dy_r(N, incy, stride_y, batch_count);
+    device_strided_batch_vector<Tr> dy_i(N, incy, stride_y, batch_count);
+    device_vector<T>                alpha_d(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx_r.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_r.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(alpha_d.memcheck());
+
+    const T alpha_h(1), zero_h(0);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const T* alpha = &alpha_h;
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+        }
+
+        // clang-format off
+EXPECT_ROCBLAS_STATUS(rocblas_axpy_planar_fn(nullptr, N, alpha, dx_r, dx_i, incx, dy_r, dy_i, incy), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_axpy_planar_fn(handle, N, nullptr, dx_r, dx_i, incx, dy_r, dy_i, incy), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_axpy_planar_fn(handle, N, alpha, nullptr, dx_i, incx, dy_r, dy_i, incy), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_axpy_planar_fn(handle, N, alpha, dx_r, nullptr, incx, dy_r, dy_i, incy), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_axpy_planar_fn(handle, N, alpha, dx_r, dx_i, incx, nullptr, dy_i, incy), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_axpy_planar_fn(handle, N, alpha, dx_r, dx_i, incx, dy_r, nullptr, incy), rocblas_status_invalid_pointer);
+
+EXPECT_ROCBLAS_STATUS(rocblas_axpy_planar_strided_batched_fn(nullptr, N, alpha, dx_r, dx_i, incx, stride_x, dy_r, dy_i, incy, stride_y, batch_count), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_axpy_planar_strided_batched_fn(handle, N, nullptr, dx_r, dx_i, incx, stride_x, dy_r, dy_i, incy, stride_y, batch_count), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_axpy_planar_strided_batched_fn(handle, N, alpha, nullptr, dx_i, incx, stride_x, dy_r, dy_i, incy, stride_y, batch_count), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_axpy_planar_strided_batched_fn(handle, N, alpha, dx_r, nullptr, incx, stride_x, dy_r, dy_i, incy, stride_y, batch_count), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_axpy_planar_strided_batched_fn(handle, N, alpha, dx_r, dx_i, incx, stride_x, nullptr, dy_i, incy, stride_y, batch_count), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_axpy_planar_strided_batched_fn(handle, N, alpha, dx_r, dx_i, incx, stride_x, dy_r, nullptr, incy, stride_y, batch_count), rocblas_status_invalid_pointer);
+
+// If N is 0 or batch_count is 0, nothing is dereferenced
+EXPECT_ROCBLAS_STATUS(rocblas_axpy_planar_fn(handle, 0, nullptr, nullptr, nullptr, incx, nullptr, nullptr, incy), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_axpy_planar_strided_batched_fn(handle, N, nullptr, nullptr, nullptr, incx, stride_x, nullptr, nullptr, incy, stride_y, 0), rocblas_status_success);
+        // clang-format on
+    }
+
+    // With alpha 0 on the host, the vectors are not dereferenced
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_axpy_planar_fn(handle, N, &zero_h, nullptr, nullptr, incx, nullptr, nullptr, incy),
+        rocblas_status_success);
+}
+
+// axpy_planar must match cblas axpy on the interleaved copies of the planar vectors, for each
+// batch of the strided_batched variant and for the non batched function on each batch
+template <typename T>
+void testing_axpy_planar(const Arguments& arg)
+{
+    using Tr = real_t<T>;
+
+    auto rocblas_axpy_planar_fn                 = rocblas_axpy_planar<T>;
+    auto rocblas_axpy_planar_strided_batched_fn = rocblas_axpy_planar_strided_batched<T>;
+
+    rocblas_int N           = arg.N;
+    rocblas_int incx        = arg.incx;
+    rocblas_int incy        = arg.incy;
+    rocblas_int batch_count = arg.batch_count;
+    T           h_alpha     = arg.get_alpha<T>();
+
+    rocblas_int    abs_incx = incx >= 0 ? incx : -incx;
+    rocblas_int    abs_incy = incy >= 0 ? incy : -incy;
+    rocblas_stride stride_x = size_t(N) * abs_incx;
+    rocblas_stride stride_y = size_t(N) * abs_incy;
+
+    rocblas_local_handle handle{arg};
+
+    // The planar Level 1 functions have no invalid sizes, N <= 0 or batch_count <= 0 return early
+    if(N <= 0 || batch_count <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        EXPECT_ROCBLAS_STATUS(rocblas_axpy_planar_strided_batched_fn(handle,
+                                                                     N,
+                                                                     nullptr,
+                                                                     nullptr,
+                                                                     nullptr,
+                                                                     incx,
+                                                                     stride_x,
+                                                                     nullptr,
+                                                                     nullptr,
+                                                                     incy,
+                                                                     stride_y,
+                                                                     batch_count),
+                              rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory, interleaved and planar
+    host_strided_batch_vector<T>  hx(N, incx, stride_x, batch_count);
+    host_strided_batch_vector<T>  hy(N, incy, stride_y, batch_count);
+    host_strided_batch_vector<T>  hy_1(N, incy, stride_y, batch_count);
+    host_strided_batch_vector<T>  hy_2(N, incy, stride_y, batch_count);
+    host_strided_batch_vector<T>  hy_3(N, incy, stride_y, batch_count);
+    host_strided_batch_vector<T>  hy_gold(N, incy, stride_y, batch_count);
+    host_strided_batch_vector<Tr> hx_r(N, incx, stride_x, batch_count);
+    host_strided_batch_vector<Tr> hx_i(N, incx, stride_x, batch_count);
+    host_strided_batch_vector<Tr> hy_r(N, incy, stride_y, batch_count);
+    host_strided_batch_vector<Tr> hy_i(N, incy, stride_y, batch_count);
+    host_vector<T>                halpha(1);
+    halpha[0] = h_alpha;
+
+    // Allocate device memory
+    device_strided_batch_vector<Tr> dx_r(N, incx, stride_x, batch_count);
+    device_strided_batch_vector<Tr> dx_i(N, incx, stride_x, batch_count);
+    device_strided_batch_vector<Tr> dy_r(N, incy, stride_y, batch_count);
+    device_strided_batch_vector<Tr> dy_i(N, incy, stride_y, batch_count);
+    device_vector<T>                d_alpha(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx_r.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_r.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false);
+    rocblas_planar_split(1, N, abs_incx, batch_count, hx, hx_r, hx_i);
+    rocblas_planar_split(1, N, abs_incy, batch_count, hy, hy_r, hy_i);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx_r.transfer_from(hx_r));
+    CHECK_HIP_ERROR(dx_i.transfer_from(hx_i));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+
+    auto reset_y = [&]() {
+        CHECK_HIP_ERROR(dy_r.transfer_from(hy_r));
+        CHECK_HIP_ERROR(dy_i.transfer_from(hy_i));
+    };
+    auto fetch_y = [&](host_strided_batch_vector<T>& hy_result) {
+        host_strided_batch_vector<Tr> hres_r(N, incy, stride_y, batch_count);
+        host_strided_batch_vector<Tr> hres_i(N, incy, stride_y, batch_count);
+        CHECK_HIP_ERROR(hres_r.transfer_from(dy_r));
+        CHECK_HIP_ERROR(hres_i.transfer_from(dy_i));
+        rocblas_planar_merge(1, N, abs_incy, batch_count, hres_r, hres_i, hy_result);
+    };
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        reset_y();
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_planar_strided_batched_fn(handle,
+                                                                   N,
+                                                                   &h_alpha,
+                                                                   dx_r,
+                                                                   dx_i,
+                                                                   incx,
+                                                                   stride_x,
+                                                                   dy_r,
+                                                                   dy_i,
+                                                                   incy,
+                                                                   stride_y,
+                                                                   batch_count));
+        handle.post_test(arg);
+        fetch_y(hy_1);
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        reset_y();
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_planar_strided_batched_fn(handle,
+                                                                   N,
+                                                                   d_alpha,
+                                                                   dx_r,
+                                                                   dx_i,
+                                                                   incx,
+                                                                   stride_x,
+                                                                   dy_r,
+                                                                   dy_i,
+                                                                   incy,
+                                                                   stride_y,
+                                                                   batch_count));
+        handle.post_test(arg);
+        fetch_y(hy_2);
+
+        // The non batched function on each batch
+        reset_y();
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_axpy_planar_fn(
+                handle, N, d_alpha, dx_r[b], dx_i[b], incx, dy_r[b], dy_i[b], incy));
+        }
+        fetch_y(hy_3);
+
+        // CPU BLAS
+        hy_gold.copy_from(hy);
+
+        cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            cblas_axpy<T>(N, h_alpha, hx[b], incx, hy_gold[b], incy);
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incy, stride_y, hy_gold, hy_1, batch_count);
+            unit_check_general<T>(1, N, abs_incy, stride_y, hy_gold, hy_2, batch_count);
+            unit_check_general<T>(1, N, abs_incy, stride_y, hy_gold, hy_3, batch_count);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>(
+                'F', 1, N, abs_incy, stride_y, hy_gold, hy_1, batch_count);
+            rocblas_error_2 = norm_check_general<T>(
+                'F', 1, N, abs_incy, stride_y, hy_gold, hy_2, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        reset_y();
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_axpy_planar_strided_batched_fn(handle,
+                                                   N,
+                                                   &h_alpha,
+                                                   dx_r,
+                                                   dx_i,
+                                                   incx,
+                                                   stride_x,
+                                                   dy_r,
+                                                   dy_i,
+                                                   incy,
+                                                   stride_y,
+                                                   batch_count);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_axpy_planar_strided_batched_fn(handle,
+                                                   N,
+                                                   &h_alpha,
+                                                   dx_r,
+                                                   dx_i,
+                                                   incx,
+                                                   stride_x,
+                                                   dy_r,
+                                                   dy_i,
+                                                   incy,
+                                                   stride_y,
+                                                   batch_count);
+        });
+
+        ArgumentModel<e_N, e_alpha, e_incx, e_incy, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            axpy_gflop_count<T>(N),
+            axpy_gbyte_count<T>(N),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
+
+template <typename T>
+void testing_scal_planar_bad_arg(const Arguments& arg)
+{
+    using Tr = real_t<T>;
+
+    auto rocblas_scal_planar_fn                 = rocblas_scal_planar<T>;
+    auto rocblas_scal_planar_strided_batched_fn = rocblas_scal_planar_strided_batched<T>;
+
+    rocblas_int    N           = 100;
+    rocblas_int    incx        = 1;
+    rocblas_int    batch_count = 2;
+    rocblas_stride stride_x    = N;
+
+    rocblas_local_handle handle{arg};
+
+    // Allocate device memory
+    device_strided_batch_vector<Tr> dx_r(N, incx, stride_x, batch_count);
+    device_strided_batch_vector<Tr> dx_i(N, incx, stride_x, batch_count);
+    device_vector<T>                alpha_d(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx_r.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(alpha_d.memcheck());
+
+    const T alpha_h(2), one_h(1);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const T* alpha = &alpha_h;
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+        }
+
+        // clang-format off
+EXPECT_ROCBLAS_STATUS(rocblas_scal_planar_fn(nullptr, N, alpha, dx_r, dx_i, incx), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_scal_planar_fn(handle, N, nullptr, dx_r, dx_i, incx), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_scal_planar_fn(handle, N, alpha, nullptr, dx_i, incx), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_scal_planar_fn(handle, N, alpha, dx_r, nullptr, incx), rocblas_status_invalid_pointer);
+
+EXPECT_ROCBLAS_STATUS(rocblas_scal_planar_strided_batched_fn(nullptr, N, alpha, dx_r, dx_i, incx, stride_x, batch_count), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_scal_planar_strided_batched_fn(handle, N, nullptr, dx_r, dx_i, incx, stride_x, batch_count), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_scal_planar_strided_batched_fn(handle, N, alpha, nullptr, dx_i, incx, stride_x, batch_count), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_scal_planar_strided_batched_fn(handle, N, alpha, dx_r, nullptr, incx, stride_x, batch_count), rocblas_status_invalid_pointer);
+
+// If N is 0, incx is not positive or batch_count is 0, nothing is dereferenced
+EXPECT_ROCBLAS_STATUS(rocblas_scal_planar_fn(handle, 0, nullptr, nullptr, nullptr, incx), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_scal_planar_fn(handle, N, nullptr, nullptr, nullptr, 0), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_scal_planar_strided_batched_fn(handle, N, nullptr, nullptr, nullptr, incx, stride_x, 0), rocblas_status_success);
+        // clang-format on
+    }
+
+    // With alpha 1 on the host, the vector is not dereferenced
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    EXPECT_ROCBLAS_STATUS(rocblas_scal_planar_fn(handle, N, &one_h, nullptr, nullptr, incx),
+                          rocblas_status_success);
+}
+
+// scal_planar must match cblas scal on the interleaved copy of the planar vector, for each batch
+// of the strided_batched variant and for the non batched function on each batch
+template <typename T>
+void testing_scal_planar(const Arguments& arg)
+{
+    using Tr = real_t<T>;
+
+    auto rocblas_scal_planar_fn                 = rocblas_scal_planar<T>;
+    auto rocblas_scal_planar_strided_batched_fn = rocblas_scal_planar_strided_batched<T>;
+
+    rocblas_int N           = arg.N;
+    rocblas_int incx        = arg.incx;
+    rocblas_int batch_count = arg.batch_count;
+    T           h_alpha     = arg.get_alpha<T>();
+
+    rocblas_stride stride_x = size_t(N) * std::max(incx, 1);
+
+    rocblas_local_handle handle{arg};
+
+    // N <= 0, incx <= 0 or batch_count <= 0 return early
+    if(N <= 0 || incx <= 0 || batch_count <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        EXPECT_ROCBLAS_STATUS(rocblas_scal_planar_strided_batched_fn(handle,
+                                                                     N,
+                                                                     nullptr,
+                                                                     nullptr,
+                                                                     nullptr,
+                                                                     incx,
+                                                                     stride_x,
+                                                                     batch_count),
+                              rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory, interleaved and planar
+    host_strided_batch_vector<T>  hx(N, incx, stride_x, batch_count);
+    host_strided_batch_vector<T>  hx_1(N, incx, stride_x, batch_count);
+    host_strided_batch_vector<T>  hx_2(N, incx, stride_x, batch_count);
+    host_strided_batch_vector<T>  hx_3(N, incx, stride_x, batch_count);
+    host_strided_batch_vector<T>  hx_gold(N, incx, stride_x, batch_count);
+    host_strided_batch_vector<Tr> hx_r(N, incx, stride_x, batch_count);
+    host_strided_batch_vector<Tr> hx_i(N, incx, stride_x, batch_count);
+    host_vector<T>                halpha(1);
+    halpha[0] = h_alpha;
+
+    // Allocate device memory
+    device_strided_batch_vector<Tr> dx_r(N, incx, stride_x, batch_count);
+    device_strided_batch_vector<Tr> dx_i(N, incx, stride_x, batch_count);
+    device_vector<T>                d_alpha(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx_r.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_planar_split(1, N, incx, batch_count, hx, hx_r, hx_i);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+
+    auto reset_x = [&]() {
+        CHECK_HIP_ERROR(dx_r.transfer_from(hx_r));
+        CHECK_HIP_ERROR(dx_i.transfer_from(hx_i));
+    };
+    auto fetch_x = [&](host_strided_batch_vector<T>& hx_result) {
+        host_strided_batch_vector<Tr> hres_r(N, incx, stride_x, batch_count);
+        host_strided_batch_vector<Tr> hres_i(N, incx, stride_x, batch_count);
+        CHECK_HIP_ERROR(hres_r.transfer_from(dx_r));
+        CHECK_HIP_ERROR(hres_i.transfer_from(dx_i));
+        rocblas_planar_merge(1, N, incx, batch_count, hres_r, hres_i, hx_result);
+    };
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        reset_x();
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_scal_planar_strided_batched_fn(
+            handle, N, &h_alpha, dx_r, dx_i, incx, stride_x, batch_count));
+        handle.post_test(arg);
+        fetch_x(hx_1);
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        reset_x();
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_scal_planar_strided_batched_fn(
+            handle, N, d_alpha, dx_r, dx_i, incx, stride_x, batch_count));
+        handle.post_test(arg);
+        fetch_x(hx_2);
+
+        // The non batched function on each batch
+        reset_x();
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_scal_planar_fn(handle, N, d_alpha, dx_r[b], dx_i[b], incx));
+        }
+        fetch_x(hx_3);
+
+        // CPU BLAS
+        hx_gold.copy_from(hx);
+
+        cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            cblas_scal<T>(N, h_alpha, hx_gold[b], incx);
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, incx, stride_x, hx_gold, hx_1, batch_count);
+            unit_check_general<T>(1, N, incx, stride_x, hx_gold, hx_2, batch_count);
+            unit_check_general<T>(1, N, incx, stride_x, hx_gold, hx_3, batch_count);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1
+                = norm_check_general<T>('F', 1, N, incx, stride_x, hx_gold, hx_1, batch_count);
+            rocblas_error_2
+                = norm_check_general<T>('F', 1, N, incx, stride_x, hx_gold, hx_2, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        reset_x();
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_scal_planar_strided_batched_fn(
+                handle, N, &h_alpha, dx_r, dx_i, incx, stride_x, batch_count);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_scal_planar_strided_batched_fn(
+                handle, N, &h_alpha, dx_r, dx_i, incx, stride_x, batch_count);
+        });
+
+        ArgumentModel<e_N, e_alpha, e_incx, e_batch_count>{}.log_args<T>(rocblas_cout,
+                                                                         arg,
+                                                                         gpu_time_used,
+                                                                         scal_gflop_count<T, T>(N),
+                                                                         scal_gbyte_count<T>(N),
+                                                                         cpu_time_used,
+                                                                         rocblas_error_1,
+                                                                         rocblas_error_2);
+    }
+}
+
+template <typename T, bool CONJ = false>
+void testing_dot_planar_bad_arg(const Arguments& arg)
+{
+    using Tr = real_t<T>;
+
+    auto rocblas_dot_planar_fn                 = rocblas_dot_planar<T, CONJ>;
+    auto rocblas_dot_planar_strided_batched_fn = rocblas_dot_planar_strided_batched<T, CONJ>;
+
+    rocblas_int    N           = 100;
+    rocblas_int    incx        = 1;
+    rocblas_int    incy        = 1;
+    rocblas_int    batch_count = 2;
+    rocblas_stride stride_x    = N;
+    rocblas_stride stride_y    = N;
+
+    rocblas_local_handle handle{arg};
+
+    // Allocate device memory
+    device_strided_batch_vector<Tr> dx_r(N, incx, stride_x, batch_count);
+    device_strided_batch_vector<Tr> dx_i(N, incx, stride_x, batch_count);
+    device_strided_batch_vector<Tr> dy_r(N, incy, stride_y, batch_count);
+    device_strided_batch_vector<Tr> dy_i(N, incy, stride_y, batch_count);
+    device_vector<T>                d_result(batch_count);
+    host_vector<T>                  h_result(batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx_r.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_r.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        T* result = pointer_mode == rocblas_pointer_mode_host ? (T*)h_result : (T*)d_result;
+
+        // clang-format off
+EXPECT_ROCBLAS_STATUS(rocblas_dot_planar_fn(nullptr, N, dx_r, dx_i, incx, dy_r, dy_i, incy, result), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_dot_planar_fn(handle, N, nullptr, dx_i, incx, dy_r, dy_i, incy, result), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_dot_planar_fn(handle, N, dx_r, nullptr, incx, dy_r, dy_i, incy, result), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_dot_planar_fn(handle, N, dx_r, dx_i, incx, nullptr, dy_i, incy, result), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_dot_planar_fn(handle, N, dx_r, dx_i, incx, dy_r, nullptr, incy, result), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_dot_planar_fn(handle, N, dx_r, dx_i, incx, dy_r, dy_i, incy, nullptr), rocblas_status_invalid_pointer);
+
+EXPECT_ROCBLAS_STATUS(rocblas_dot_planar_strided_batched_fn(nullptr, N, dx_r, dx_i, incx, stride_x, dy_r, dy_i, incy, stride_y, batch_count, result), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_dot_planar_strided_batched_fn(handle, N, nullptr, dx_i, incx, stride_x, dy_r, dy_i, incy, stride_y, batch_count, result), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_dot_planar_strided_batched_fn(handle, N, dx_r, nullptr, incx, stride_x, dy_r, dy_i, incy, stride_y, batch_count, result), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_dot_planar_strided_batched_fn(handle, N, dx_r, dx_i, incx, stride_x, nullptr, dy_i, incy, stride_y, batch_count, result), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_dot_planar_strided_batched_fn(handle, N, dx_r, dx_i, incx, stride_x, dy_r, nullptr, incy, stride_y, batch_count, result), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_dot_planar_strided_batched_fn(handle, N, dx_r, dx_i, incx, stride_x, dy_r, dy_i, incy, stride_y, batch_count, nullptr), rocblas_status_invalid_pointer);
+
+// If N is 0 the results are zeroed without dereferencing the vectors
+EXPECT_ROCBLAS_STATUS(rocblas_dot_planar_fn(handle, 0, nullptr, nullptr, incx, nullptr, nullptr, incy, result), rocblas_status_success);
+
+// If batch_count is 0, nothing is dereferenced
+EXPECT_ROCBLAS_STATUS(rocblas_dot_planar_strided_batched_fn(handle, N, nullptr, nullptr, incx, stride_x, nullptr, nullptr, incy, stride_y, 0, nullptr), rocblas_status_success);
+        // clang-format on
+    }
+}
+
+template <typename T>
+void testing_dotc_planar_bad_arg(const Arguments& arg)
+{
+    testing_dot_planar_bad_arg<T, true>(arg);
+}
+
+// dotu_planar and dotc_planar must match cblas dot and dotc on the interleaved copies of the planar
+// vectors, for each batch of the strided_batched variant and for the non batched function on each
+// batch, with the results on the host and on the device
+template <typename T, bool CONJ = false>
+void testing_dot_planar(const Arguments& arg)
+{
+    using Tr = real_t<T>;
+
+    auto rocblas_dot_planar_fn                 = rocblas_dot_planar<T, CONJ>;
+    auto rocblas_dot_planar_strided_batched_fn = rocblas_dot_planar_strided_batched<T, CONJ>;
+
+    rocblas_int N           = arg.N;
+    rocblas_int incx        = arg.incx;
+    rocblas_int incy        = arg.incy;
+    rocblas_int batch_count = arg.batch_count;
+
+    rocblas_int    abs_incx = incx >= 0 ? incx : -incx;
+    rocblas_int    abs_incy = incy >= 0 ? incy : -incy;
+    rocblas_stride stride_x = size_t(N) * abs_incx;
+    rocblas_stride stride_y = size_t(N) * abs_incy;
+
+    rocblas_local_handle handle{arg};
+
+    // batch_count <= 0 returns early, N <= 0 sets the results to zero
+    if(N <= 0 || batch_count <= 0)
+    {
+        host_vector<T> h_result(std::max(batch_count, 1));
+        CHECK_HIP_ERROR(h_result.memcheck());
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        EXPECT_ROCBLAS_STATUS(rocblas_dot_planar_strided_batched_fn(handle,
+                                                                    N,
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    incx,
+                                                                    stride_x,
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    incy,
+                                                                    stride_y,
+                                                                    batch_count,
+                                                                    h_result),
+                              rocblas_status_success);
+
+        if(batch_count > 0)
+        {
+            host_vector<T> cpu_0(batch_count);
+            unit_check_general<T>(1, 1, 1, 1, cpu_0, h_result, batch_count);
+        }
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory, interleaved and planar
+    host_strided_batch_vector<T>  hx(N, incx, stride_x, batch_count);
+    host_strided_batch_vector<T>  hy(N, incy, stride_y, batch_count);
+    host_strided_batch_vector<Tr> hx_r(N, incx, stride_x, batch_count);
+    host_strided_batch_vector<Tr> hx_i(N, incx, stride_x, batch_count);
+    host_strided_batch_vector<Tr> hy_r(N, incy, stride_y, batch_count);
+    host_strided_batch_vector<Tr> hy_i(N, incy, stride_y, batch_count);
+    host_vector<T>                cpu_result(batch_count);
+    host_vector<T>                rocblas_result_1(batch_count);
+    host_vector<T>                rocblas_result_2(batch_count);
+    host_vector<T>                rocblas_result_3(batch_count);
+
+    // Allocate device memory
+    device_strided_batch_vector<Tr> dx_r(N, incx, stride_x, batch_count);
+    device_strided_batch_vector<Tr> dx_i(N, incx, stride_x, batch_count);
+    device_strided_batch_vector<Tr> dy_r(N, incy, stride_y, batch_count);
+    device_strided_batch_vector<Tr> dy_i(N, incy, stride_y, batch_count);
+    device_vector<T>                d_rocblas_result_2(batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx_r.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_r.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_rocblas_result_2.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_planar_split(1, N, abs_incx, batch_count, hx, hx_r, hx_i);
+    rocblas_planar_split(1, N, abs_incy, batch_count, hy, hy_r, hy_i);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx_r.transfer_from(hx_r));
+    CHECK_HIP_ERROR(dx_i.transfer_from(hx_i));
+    CHECK_HIP_ERROR(dy_r.transfer_from(hy_r));
+    CHECK_HIP_ERROR(dy_i.transfer_from(hy_i));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_dot_planar_strided_batched_fn(handle,
+                                                                  N,
+                                                                  dx_r,
+                                                                  dx_i,
+                                                                  incx,
+                                                                  stride_x,
+                                                                  dy_r,
+                                                                  dy_i,
+                                                                  incy,
+                                                                  stride_y,
+                                                                  batch_count,
+                                                                  rocblas_result_1));
+        handle.post_test(arg);
+
+        // The non batched function on each batch
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_dot_planar_fn(handle,
+                                                      N,
+                                                      dx_r[b],
+                                                      dx_i[b],
+                                                      incx,
+                                                      dy_r[b],
+                                                      dy_i[b],
+                                                      incy,
+                                                      &rocblas_result_3[b]));
+        }
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_dot_planar_strided_batched_fn(handle,
+                                                                  N,
+                                                                  dx_r,
+                                                                  dx_i,
+                                                                  incx,
+                                                                  stride_x,
+                                                                  dy_r,
+                                                                  dy_i,
+                                                                  incy,
+                                                                  stride_y,
+                                                                  batch_count,
+                                                                  d_rocblas_result_2));
+        handle.post_test(arg);
+
+        CHECK_HIP_ERROR(rocblas_result_2.transfer_from(d_rocblas_result_2));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            (CONJ ? cblas_dotc<T> : cblas_dot<T>)(N, hx[b], incx, hy[b], incy, &cpu_result[b]);
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, 1, 1, 1, cpu_result, rocblas_result_1, batch_count);
+            unit_check_general<T>(1, 1, 1, 1, cpu_result, rocblas_result_2, batch_count);
+            unit_check_general<T>(1, 1, 1, 1, cpu_result, rocblas_result_3, batch_count);
+        }
+
+        if(arg.norm_check)
+        {
+            for(rocblas_int b = 0; b < batch_count; b++)
+            {
+                rocblas_error_1
+                    += rocblas_abs((cpu_result[b] - rocblas_result_1[b]) / cpu_result[b]);
+                rocblas_error_2
+                    += rocblas_abs((cpu_result[b] - rocblas_result_2[b]) / cpu_result[b]);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_dot_planar_strided_batched_fn(handle,
+                                                  N,
+                                                  dx_r,
+                                                  dx_i,
+                                                  incx,
+                                                  stride_x,
+                                                  dy_r,
+                                                  dy_i,
+                                                  incy,
+                                                  stride_y,
+                                                  batch_count,
+                                                  d_rocblas_result_2);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_dot_planar_strided_batched_fn(handle,
+                                                  N,
+                                                  dx_r,
+                                                  dx_i,
+                                                  incx,
+                                                  stride_x,
+                                                  dy_r,
+                                                  dy_i,
+                                                  incy,
+                                                  stride_y,
+                                                  batch_count,
+                                                  d_rocblas_result_2);
+        });
+
+        ArgumentModel<e_N, e_incx, e_incy, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            dot_gflop_count<CONJ, T>(N),
+            dot_gbyte_count<T>(N),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
+
+template <typename T>
+void testing_dotc_planar(const Arguments& arg)
+{
+    testing_dot_planar<T, true>(arg);
+}
@@ -0,0 +1,285 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <cmath>
+#include <limits>
+
+// rot_sequence is a beta feature without Fortran bindings
+template <typename T>
+static rocblas_status (*rocblas_rot_sequence)(rocblas_handle   handle,
+                                              rocblas_int      n,
+                                              rocblas_int      k,
+                                              T*               x,
+                                              rocblas_int      incx,
+                                              T*               y,
+                                              rocblas_int      incy,
+                                              const real_t<T>* c,
+                                              const real_t<T>* s);
+
+template <>
+static auto rocblas_rot_sequence<float> = rocblas_srot_sequence;
+template <>
+static auto rocblas_rot_sequence<double> = rocblas_drot_sequence;
+template <>
+static auto rocblas_rot_sequence<rocblas_float_complex> = rocblas_csrot_sequence;
+template <>
+static auto rocblas_rot_sequence<rocblas_double_complex> = rocblas_zdrot_sequence;
+
+// Fill c and s with the cosines and sines of random angles in [-pi, pi)
+template <typename U>
+void rocblas_init_rotations(host_vector<U>& hc, host_vector<U>& hs)
+{
+    for(size_t j = 0; j < hc.size(); j++)
+    {
+        double theta = std::uniform_real_distribution<double>(-M_PI, M_PI)(t_rocblas_rng);
+        hc[j]        = U(std::cos(theta));
+        hs[j]        = U(std::sin(theta));
+    }
+}
+
+template <typename T>
+void testing_rot_sequence_bad_arg(const Arguments& arg)
+{
+    using U = real_t<T>;
+
+    auto        rocblas_rot_sequence_fn = rocblas_rot_sequence<T>;
+    rocblas_int N                       = 100;
+    rocblas_int K                       = 10;
+    rocblas_int incx                    = 1;
+    rocblas_int incy                    = 1;
+
+    rocblas_local_handle handle{arg};
+
+    // Allocate device memory
+    device_vector<T> dx(N, incx);
+    device_vector<T> dy(N, incy);
+    device_vector<U> dc(K);
+    device_vector<U> ds(K);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dc.memcheck());
+    CHECK_DEVICE_ALLOCATION(ds.memcheck());
+
+    // c and s are read from device memory whatever the pointer mode
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_fn(nullptr, N, K, dx, incx, dy, incy, dc, ds),
+                              rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_fn(handle, N, -1, dx, incx, dy, incy, dc, ds),
+                              rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_rot_sequence_fn(handle, N, K, nullptr, incx, dy, incy, dc, ds),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_rot_sequence_fn(handle, N, K, dx, incx, nullptr, incy, dc, ds),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_rot_sequence_fn(handle, N, K, dx, incx, dy, incy, nullptr, ds),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_rot_sequence_fn(handle, N, K, dx, incx, dy, incy, dc, nullptr),
+            rocblas_status_invalid_pointer);
+
+        // If N is 0 or K is 0, the vectors and the rotations are not dereferenced
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_rot_sequence_fn(handle, 0, K, nullptr, incx, nullptr, incy, nullptr, nullptr),
+            rocblas_status_success);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_rot_sequence_fn(handle, N, 0, nullptr, incx, nullptr, incy, nullptr, nullptr),
+            rocblas_status_success);
+    }
+}
+
+// rot_sequence must match the K rotations applied one at a time by the CPU rot
+template <typename T>
+void testing_rot_sequence(const Arguments& arg)
+{
+    using U = real_t<T>;
+
+    auto        rocblas_rot_sequence_fn = rocblas_rot_sequence<T>;
+    rocblas_int N                       = arg.N;
+    rocblas_int K                       = arg.K;
+    rocblas_int incx                    = arg.incx;
+    rocblas_int incy                    = arg.incy;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || K <= 0)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_rot_sequence_fn(handle, N, K, nullptr, incx, nullptr, incy, nullptr, nullptr),
+            K < 0 ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    rocblas_int abs_incx = incx >= 0 ? incx : -incx;
+    rocblas_int abs_incy = incy >= 0 ? incy : -incy;
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    host_vector<T> hx(N, incx ? incx : 1);
+    host_vector<T> hy(N, incy ? incy : 1);
+    host_vector<T> hx_1(N, incx ? incx : 1);
+    host_vector<T> hy_1(N, incy ? incy : 1);
+    host_vector<T> hx_2(N, incx ? incx : 1);
+    host_vector<T> hy_2(N, incy ? incy : 1);
+    host_vector<U> hc(K);
+    host_vector<U> hs(K);
+
+    // Allocate device memory
+    device_vector<T> dx_1(N, incx ? incx : 1);
+    device_vector<T> dy_1(N, incy ? incy : 1);
+    device_vector<T> dx_2(N, incx ? incx : 1);
+    device_vector<T> dy_2(N, incy ? incy : 1);
+    device_vector<U> dc(K);
+    device_vector<U> ds(K);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(dc.memcheck());
+    CHECK_DEVICE_ALLOCATION(ds.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false);
+    rocblas_init_rotations(hc, hs);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx_1.transfer_from(hx));
+    CHECK_HIP_ERROR(dy_1.transfer_from(hy));
+    CHECK_HIP_ERROR(dc.transfer_from(hc));
+    CHECK_HIP_ERROR(ds.transfer_from(hs));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dx_2.transfer_from(hx));
+        CHECK_HIP_ERROR(dy_2.transfer_from(hy));
+
+        // The pointer mode does not apply to c and s, both runs must give the same result
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_rot_sequence_fn(handle, N, K, dx_1, incx, dy_1, incy, dc, ds));
+        handle.post_test(arg);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_rot_sequence_fn(handle, N, K, dx_2, incx, dy_2, incy, dc, ds));
+        handle.post_test(arg);
+
+        // CPU BLAS
+        host_vector<T> cx = hx;
+        host_vector<T> cy = hy;
+
+        cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int j = 0; j < K; j++)
+            cblas_rot<T, T, U, U>(N, cx, incx, cy, incy, &hc[j], &hs[j]);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hx_1.transfer_from(dx_1));
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy_1));
+        CHECK_HIP_ERROR(hx_2.transfer_from(dx_2));
+        CHECK_HIP_ERROR(hy_2.transfer_from(dy_2));
+
+        if(arg.unit_check)
+        {
+            // The rotations are orthogonal, so the rounding error grows linearly with K
+            // relative to the magnitude of the (x_i, y_i) pairs
+            U max_abs = 0;
+            for(rocblas_int i = 0; i < N; i++)
+                max_abs = std::max(max_abs,
+                                   U(rocblas_abs(hx[i * size_t(abs_incx)])
+                                     + rocblas_abs(hy[i * size_t(abs_incy)])));
+            double tol = 4.0 * (K + 1) * max_abs * std::numeric_limits<U>::epsilon();
+
+            near_check_general<T>(1, N, abs_incx, cx, hx_1, tol);
+            near_check_general<T>(1, N, abs_incy, cy, hy_1, tol);
+            near_check_general<T>(1, N, abs_incx, cx, hx_2, tol);
+            near_check_general<T>(1, N, abs_incy, cy, hy_2, tol);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', 1, N, abs_incx, cx, hx_1)
+                              + norm_check_general<T>('F', 1, N, abs_incy, cy, hy_1);
+            rocblas_error_2 = norm_check_general<T>('F', 1, N, abs_incx, cx, hx_2)
+                              + norm_check_general<T>('F', 1, N, abs_incy, cy, hy_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_rot_sequence_fn(handle, N, K, dx_1, incx, dy_1, incy, dc, ds);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_rot_sequence_fn(handle, N, K, dx_1, incx, dy_1, incy, dc, ds);
+        });
+
+        ArgumentModel<e_N, e_K, e_incx, e_incy>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            K * rot_gflop_count<T, T, U, U>(N),
+            rot_sequence_gbyte_count<T, U>(N, K),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
@@ -161,6 +161,7 @@ void testing_rot_strided_batched(const Arguments& arg)
     // cx[0] = hx[0];
     // cy[0] = hy[0];
     cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
     for(int b = 0; b < batch_count; b++)
     {
         cblas_rot<T, T, U, V>(N, cx[b], incx, cy[b], incy, hc, hs);
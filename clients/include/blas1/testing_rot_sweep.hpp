@@ -0,0 +1,243 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_matrix.hpp"
+#include "testing_rot_sequence.hpp"
+
+// rot_sweep is a beta feature without Fortran bindings
+template <typename T>
+static rocblas_status (*rocblas_rot_sweep)(rocblas_handle   handle,
+                                           rocblas_int      m,
+                                           rocblas_int      n,
+                                           T*               A,
+                                           rocblas_int      lda,
+                                           const real_t<T>* c,
+                                           const real_t<T>* s);
+
+template <>
+static auto rocblas_rot_sweep<float> = rocblas_srot_sweep;
+template <>
+static auto rocblas_rot_sweep<double> = rocblas_drot_sweep;
+template <>
+static auto rocblas_rot_sweep<rocblas_float_complex> = rocblas_csrot_sweep;
+template <>
+static auto rocblas_rot_sweep<rocblas_double_complex> = rocblas_zdrot_sweep;
+
+template <typename T>
+void testing_rot_sweep_bad_arg(const Arguments& arg)
+{
+    using U = real_t<T>;
+
+    auto        rocblas_rot_sweep_fn = rocblas_rot_sweep<T>;
+    rocblas_int M                    = 100;
+    rocblas_int N                    = 100;
+    rocblas_int lda                  = 100;
+
+    rocblas_local_handle handle{arg};
+
+    // Allocate device memory
+    device_matrix<T> dA(M, N, lda);
+    device_vector<U> dc(N - 1);
+    device_vector<U> ds(N - 1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dc.memcheck());
+    CHECK_DEVICE_ALLOCATION(ds.memcheck());
+
+    // c and s are read from device memory whatever the pointer mode
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        EXPECT_ROCBLAS_STATUS(rocblas_rot_sweep_fn(nullptr, M, N, dA, lda, dc, ds),
+                              rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_rot_sweep_fn(handle, -1, N, dA, lda, dc, ds),
+                              rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(rocblas_rot_sweep_fn(handle, M, -1, dA, lda, dc, ds),
+                              rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(rocblas_rot_sweep_fn(handle, M, N, dA, M - 1, dc, ds),
+                              rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_rot_sweep_fn(handle, M, N, nullptr, lda, dc, ds),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_rot_sweep_fn(handle, M, N, dA, lda, nullptr, ds),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_rot_sweep_fn(handle, M, N, dA, lda, dc, nullptr),
+                              rocblas_status_invalid_pointer);
+
+        // If M is 0 or there is a single column, A and the rotations are not dereferenced
+        EXPECT_ROCBLAS_STATUS(rocblas_rot_sweep_fn(handle, 0, N, nullptr, lda, nullptr, nullptr),
+                              rocblas_status_success);
+        EXPECT_ROCBLAS_STATUS(rocblas_rot_sweep_fn(handle, M, 1, nullptr, lda, nullptr, nullptr),
+                              rocblas_status_success);
+    }
+}
+
+// rot_sweep must match the N - 1 rotations of adjacent columns applied one at a time by the
+// CPU rot, rows beyond M are left unchanged
+template <typename T>
+void testing_rot_sweep(const Arguments& arg)
+{
+    using U = real_t<T>;
+
+    auto        rocblas_rot_sweep_fn = rocblas_rot_sweep<T>;
+    rocblas_int M                    = arg.M;
+    rocblas_int N                    = arg.N;
+    rocblas_int lda                  = arg.lda;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || lda < M || lda < 1;
+    if(invalid_size || !M || N < 2)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_rot_sweep_fn(handle, M, N, nullptr, lda, nullptr, nullptr),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_matrix<T> hA(M, N, lda);
+    host_matrix<T> hA_1(M, N, lda);
+    host_matrix<T> hA_2(M, N, lda);
+    host_matrix<T> hA_gold(M, N, lda);
+    host_vector<U> hc(N - 1);
+    host_vector<U> hs(N - 1);
+
+    // Allocate device memory
+    device_matrix<T> dA_1(M, N, lda);
+    device_matrix<T> dA_2(M, N, lda);
+    device_vector<U> dc(N - 1);
+    device_vector<U> ds(N - 1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(dc.memcheck());
+    CHECK_DEVICE_ALLOCATION(ds.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_rotations(hc, hs);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA_1.transfer_from(hA));
+    CHECK_HIP_ERROR(dc.transfer_from(hc));
+    CHECK_HIP_ERROR(ds.transfer_from(hs));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dA_2.transfer_from(hA));
+
+        // The pointer mode does not apply to c and s, both runs must give the same result
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_rot_sweep_fn(handle, M, N, dA_1, lda, dc, ds));
+        handle.post_test(arg);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_rot_sweep_fn(handle, M, N, dA_2, lda, dc, ds));
+        handle.post_test(arg);
+
+        // CPU BLAS
+        hA_gold = hA;
+
+        cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int j = 0; j + 1 < N; j++)
+            cblas_rot<T, T, U, U>(M,
+                                  hA_gold[0] + size_t(lda) * j,
+                                  1,
+                                  hA_gold[0] + size_t(lda) * (j + 1),
+                                  1,
+                                  &hc[j],
+                                  &hs[j]);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hA_1.transfer_from(dA_1));
+        CHECK_HIP_ERROR(hA_2.transfer_from(dA_2));
+
+        if(arg.unit_check)
+        {
+            // The rotated values feed forward through the sweep, so the rounding error grows
+            // linearly with N relative to the 2-norm of each row, which the rotations preserve
+            double max_norm = 0;
+            for(rocblas_int i = 0; i < M; i++)
+            {
+                double row_norm = 0;
+                for(rocblas_int j = 0; j < N; j++)
+                {
+                    double a = rocblas_abs(hA[0][i + size_t(lda) * j]);
+                    row_norm += a * a;
+                }
+                max_norm = std::max(max_norm, std::sqrt(row_norm));
+            }
+            double tol = 4.0 * N * max_norm * std::numeric_limits<U>::epsilon();
+
+            near_check_general<T>(M, N, lda, hA_gold, hA_1, tol);
+            near_check_general<T>(M, N, lda, hA_gold, hA_2, tol);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', M, N, lda, hA_gold, hA_1);
+            rocblas_error_2 = norm_check_general<T>('F', M, N, lda, hA_gold, hA_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_rot_sweep_fn(handle, M, N, dA_1, lda, dc, ds);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_rot_sweep_fn(handle, M, N, dA_1, lda, dc, ds);
+        });
+
+        ArgumentModel<e_M, e_N, e_lda>{}.log_args<T>(rocblas_cout,
+                                                     arg,
+                                                     gpu_time_used,
+                                                     (N - 1) * rot_gflop_count<T, T, U, U>(M),
+                                                     rot_sweep_gbyte_count<T, U>(M, N),
+                                                     cpu_time_used,
+                                                     rocblas_error_1,
+                                                     rocblas_error_2);
+    }
+}
@@ -147,6 +147,7 @@ void testing_rotg_batched(const Arguments& arg)
     hs_gold.copy_from(hs);
 
     cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
     for(int b = 0; b < batch_count; b++)
     {
         cblas_rotg<T, U>(ha_gold[b], hb_gold[b], hc_gold[b], hs_gold[b]);
@@ -274,17 +275,14 @@ void testing_rotg_batched(const Arguments& arg)
         }
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_rotg_batched_fn(handle,
                                     da.ptr_on_device(),
                                     db.ptr_on_device(),
                                     dc.ptr_on_device(),
                                     ds.ptr_on_device(),
                                     batch_count);
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_batch_count>{}.log_args<T>(rocblas_cout,
                                                    arg,
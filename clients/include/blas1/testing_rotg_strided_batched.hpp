@@ -152,6 +152,7 @@ void testing_rotg_strided_batched(const Arguments& arg)
     hs_gold.copy_from(hs);
 
     cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
     for(int b = 0; b < batch_count; b++)
     {
         cblas_rotg<T, U>(ha_gold[b], hb_gold[b], hc_gold[b], hs_gold[b]);
@@ -294,13 +295,10 @@ void testing_rotg_strided_batched(const Arguments& arg)
         }
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_rotg_strided_batched_fn(
                 handle, da, stride_a, db, stride_b, dc, stride_c, ds, stride_s, batch_count);
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_stride_a, e_stride_b, e_stride_c, e_stride_d, e_batch_count>{}.log_args<T>(
             rocblas_cout,
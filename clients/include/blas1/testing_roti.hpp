@@ -0,0 +1,344 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// The sparse Level 1 functions are beta features without Fortran bindings
+
+// roti
+template <typename T>
+static rocblas_status (*rocblas_roti)(rocblas_handle     handle,
+                                      rocblas_int        nnz,
+                                      T*                 x_val,
+                                      const rocblas_int* x_ind,
+                                      T*                 y,
+                                      const T*           c,
+                                      const T*           s);
+
+template <>
+static auto rocblas_roti<float> = rocblas_sroti;
+template <>
+static auto rocblas_roti<double> = rocblas_droti;
+
+// roti_strided_batched
+template <typename T>
+static rocblas_status (*rocblas_roti_strided_batched)(rocblas_handle     handle,
+                                                      rocblas_int        nnz,
+                                                      T*                 x_val,
+                                                      rocblas_stride     stride_x,
+                                                      const rocblas_int* x_ind,
+                                                      rocblas_stride     stride_ind,
+                                                      T*                 y,
+                                                      rocblas_stride     stride_y,
+                                                      const T*           c,
+                                                      const T*           s,
+                                                      rocblas_int        batch_count);
+
+template <>
+static auto rocblas_roti_strided_batched<float> = rocblas_sroti_strided_batched;
+template <>
+static auto rocblas_roti_strided_batched<double> = rocblas_droti_strided_batched;
+
+template <typename T>
+void testing_roti_bad_arg(const Arguments& arg)
+{
+    auto rocblas_roti_fn                 = rocblas_roti<T>;
+    auto rocblas_roti_strided_batched_fn = rocblas_roti_strided_batched<T>;
+
+    rocblas_int    N           = 100;
+    rocblas_int    nnz         = 10;
+    rocblas_int    batch_count = 2;
+    rocblas_stride stride_x    = nnz;
+    rocblas_stride stride_ind  = nnz;
+    rocblas_stride stride_y    = N;
+
+    rocblas_local_handle handle{arg};
+
+    // Allocate device memory
+    device_strided_batch_vector<T> dx(nnz, 1, stride_x, batch_count);
+    device_vector<rocblas_int>     dind(nnz * batch_count);
+    device_strided_batch_vector<T> dy(N, 1, stride_y, batch_count);
+    device_vector<T>               dc(1);
+    device_vector<T>               ds(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dind.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dc.memcheck());
+    CHECK_DEVICE_ALLOCATION(ds.memcheck());
+
+    T h_c = T(1);
+    T h_s = T(0);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const T* c = &h_c;
+        const T* s = &h_s;
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(dc, &h_c, sizeof(T), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(ds, &h_s, sizeof(T), hipMemcpyHostToDevice));
+            c = dc;
+            s = ds;
+        }
+
+        // clang-format off
+EXPECT_ROCBLAS_STATUS(rocblas_roti_fn(nullptr, nnz, dx, dind, dy, c, s), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_roti_fn(handle, -1, dx, dind, dy, c, s), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_roti_fn(handle, nnz, nullptr, dind, dy, c, s), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_roti_fn(handle, nnz, dx, nullptr, dy, c, s), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_roti_fn(handle, nnz, dx, dind, nullptr, c, s), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_roti_fn(handle, nnz, dx, dind, dy, nullptr, s), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_roti_fn(handle, nnz, dx, dind, dy, c, nullptr), rocblas_status_invalid_pointer);
+
+EXPECT_ROCBLAS_STATUS(rocblas_roti_strided_batched_fn(nullptr, nnz, dx, stride_x, dind, stride_ind, dy, stride_y, c, s, batch_count), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_roti_strided_batched_fn(handle, -1, dx, stride_x, dind, stride_ind, dy, stride_y, c, s, batch_count), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_roti_strided_batched_fn(handle, nnz, dx, stride_x, dind, stride_ind, dy, stride_y, c, s, -1), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_roti_strided_batched_fn(handle, nnz, nullptr, stride_x, dind, stride_ind, dy, stride_y, c, s, batch_count), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_roti_strided_batched_fn(handle, nnz, dx, stride_x, nullptr, stride_ind, dy, stride_y, c, s, batch_count), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_roti_strided_batched_fn(handle, nnz, dx, stride_x, dind, stride_ind, nullptr, stride_y, c, s, batch_count), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_roti_strided_batched_fn(handle, nnz, dx, stride_x, dind, stride_ind, dy, stride_y, nullptr, s, batch_count), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_roti_strided_batched_fn(handle, nnz, dx, stride_x, dind, stride_ind, dy, stride_y, c, nullptr, batch_count), rocblas_status_invalid_pointer);
+
+// If nnz or batch_count is 0, the pointers are not checked
+EXPECT_ROCBLAS_STATUS(rocblas_roti_fn(handle, 0, nullptr, nullptr, nullptr, nullptr, nullptr), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_roti_strided_batched_fn(handle, nnz, nullptr, stride_x, nullptr, stride_ind, nullptr, stride_y, nullptr, nullptr, 0), rocblas_status_success);
+        // clang-format on
+    }
+}
+
+// roti must rotate the same pairs as the host, for each batch of the strided_batched variant
+// with per batch and with shared indices, for the non batched function, and with c and s on the
+// host and on the device
+template <typename T>
+void testing_roti(const Arguments& arg)
+{
+    auto rocblas_roti_fn                 = rocblas_roti<T>;
+    auto rocblas_roti_strided_batched_fn = rocblas_roti_strided_batched<T>;
+
+    rocblas_int N           = arg.N;
+    rocblas_int nnz         = arg.K;
+    rocblas_int batch_count = arg.batch_count;
+
+    rocblas_stride stride_x   = nnz;
+    rocblas_stride stride_ind = nnz;
+    rocblas_stride stride_y   = N;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = nnz < 0 || batch_count < 0;
+    if(invalid_size || !nnz || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_roti_strided_batched_fn(handle,
+                                                              nnz,
+                                                              nullptr,
+                                                              stride_x,
+                                                              nullptr,
+                                                              stride_ind,
+                                                              nullptr,
+                                                              stride_y,
+                                                              nullptr,
+                                                              nullptr,
+                                                              batch_count),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    host_strided_batch_vector<T> hx(nnz, 1, stride_x, batch_count);
+    host_strided_batch_vector<T> hx_1(nnz, 1, stride_x, batch_count);
+    host_strided_batch_vector<T> hx_2(nnz, 1, stride_x, batch_count);
+    host_strided_batch_vector<T> hx_3(nnz, 1, stride_x, batch_count);
+    host_strided_batch_vector<T> hx_gold(nnz, 1, stride_x, batch_count);
+    host_strided_batch_vector<T> hx_gold_shared(nnz, 1, stride_x, batch_count);
+    host_vector<rocblas_int>     hind(size_t(nnz) * batch_count);
+    host_strided_batch_vector<T> hy(N, 1, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_1(N, 1, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_2(N, 1, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_3(N, 1, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_gold(N, 1, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_gold_shared(N, 1, stride_y, batch_count);
+    host_vector<T>               hc(1);
+    host_vector<T>               hs(1);
+
+    // Allocate device memory
+    device_strided_batch_vector<T> dx(nnz, 1, stride_x, batch_count);
+    device_vector<rocblas_int>     dind(size_t(nnz) * batch_count);
+    device_strided_batch_vector<T> dy(N, 1, stride_y, batch_count);
+    device_vector<T>               dc(1);
+    device_vector<T>               ds(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dind.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dc.memcheck());
+    CHECK_DEVICE_ALLOCATION(ds.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false);
+    rocblas_init_vector(hc, arg, rocblas_client_alpha_sets_nan, false);
+    rocblas_init_vector(hs, arg, rocblas_client_alpha_sets_nan, false);
+    rocblas_init_sparse_indices(hind, nnz, N);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dind.transfer_from(hind));
+    CHECK_HIP_ERROR(dc.transfer_from(hc));
+    CHECK_HIP_ERROR(ds.transfer_from(hs));
+
+    double gpu_time_used, cpu_time_used;
+    double norm_error_x_1 = 0.0;
+    double norm_error_y_1 = 0.0;
+    double norm_error_x_2 = 0.0;
+    double norm_error_y_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host with per batch indices
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dx.transfer_from(hx));
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_roti_strided_batched_fn(
+            handle, nnz, dx, stride_x, dind, stride_ind, dy, stride_y, hc, hs, batch_count));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hx_1.transfer_from(dx));
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy));
+
+        // The non batched function on each batch
+        CHECK_HIP_ERROR(dx.transfer_from(hx));
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_roti_fn(
+                handle, nnz, dx[b], (rocblas_int*)dind + b * stride_ind, dy[b], hc, hs));
+        }
+        CHECK_HIP_ERROR(hx_3.transfer_from(dx));
+        CHECK_HIP_ERROR(hy_3.transfer_from(dy));
+
+        // GPU BLAS, rocblas_pointer_mode_device with indices shared between the batches
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(dx.transfer_from(hx));
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_roti_strided_batched_fn(
+            handle, nnz, dx, stride_x, dind, 0, dy, stride_y, dc, ds, batch_count));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hx_2.transfer_from(dx));
+        CHECK_HIP_ERROR(hy_2.transfer_from(dy));
+
+        // CPU BLAS
+        hy_gold.copy_from(hy);
+        hy_gold_shared.copy_from(hy);
+
+        cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            for(rocblas_int i = 0; i < nnz; i++)
+            {
+                T& y_i        = hy_gold[b][hind[b * stride_ind + i]];
+                T  x_i        = hx[b][i];
+                hx_gold[b][i] = hc[0] * x_i + hs[0] * y_i;
+                y_i           = hc[0] * y_i - hs[0] * x_i;
+
+                T& y_shared_i        = hy_gold_shared[b][hind[i]];
+                hx_gold_shared[b][i] = hc[0] * x_i + hs[0] * y_shared_i;
+                y_shared_i           = hc[0] * y_shared_i - hs[0] * x_i;
+            }
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, nnz, 1, stride_x, hx_gold, hx_1, batch_count);
+            unit_check_general<T>(1, N, 1, stride_y, hy_gold, hy_1, batch_count);
+            unit_check_general<T>(1, nnz, 1, stride_x, hx_gold_shared, hx_2, batch_count);
+            unit_check_general<T>(1, N, 1, stride_y, hy_gold_shared, hy_2, batch_count);
+            unit_check_general<T>(1, nnz, 1, stride_x, hx_gold, hx_3, batch_count);
+            unit_check_general<T>(1, N, 1, stride_y, hy_gold, hy_3, batch_count);
+        }
+
+        if(arg.norm_check)
+        {
+            norm_error_x_1
+                = norm_check_general<T>('F', 1, nnz, 1, stride_x, hx_gold, hx_1, batch_count);
+            norm_error_y_1
+                = norm_check_general<T>('F', 1, N, 1, stride_y, hy_gold, hy_1, batch_count);
+            norm_error_x_2 = norm_check_general<T>(
+                'F', 1, nnz, 1, stride_x, hx_gold_shared, hx_2, batch_count);
+            norm_error_y_2
+                = norm_check_general<T>('F', 1, N, 1, stride_y, hy_gold_shared, hy_2, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(dx.transfer_from(hx));
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_roti_strided_batched_fn(
+                handle, nnz, dx, stride_x, dind, stride_ind, dy, stride_y, dc, ds, batch_count);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_roti_strided_batched_fn(
+                handle, nnz, dx, stride_x, dind, stride_ind, dy, stride_y, dc, ds, batch_count);
+        });
+
+        ArgumentModel<e_N, e_K, e_batch_count>{}.log_args<T>(rocblas_cout,
+                                                             arg,
+                                                             gpu_time_used,
+                                                             rot_gflop_count<T, T, T, T>(nnz),
+                                                             sparse_level1_gbyte_count<T>(nnz, 4),
+                                                             cpu_time_used,
+                                                             norm_error_x_1 + norm_error_y_1,
+                                                             norm_error_x_2 + norm_error_y_2);
+    }
+}
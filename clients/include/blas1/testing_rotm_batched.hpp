@@ -171,6 +171,7 @@ void testing_rotm_batched(const Arguments& arg)
         hy_gold.copy_from(hy);
 
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
         {
             cblas_rotm<T>(N, hx_gold[b], incx, hy_gold[b], incy, hparam[b]);
@@ -287,9 +288,7 @@ void testing_rotm_batched(const Arguments& arg)
         }
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_rotm_batched_fn(handle,
                                     N,
                                     dx.ptr_on_device(),
@@ -298,8 +297,7 @@ void testing_rotm_batched(const Arguments& arg)
                                     incy,
                                     dparam.ptr_on_device(),
                                     batch_count);
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_N, e_incx, e_incy, e_batch_count>{}.log_args<T>(
             rocblas_cout,
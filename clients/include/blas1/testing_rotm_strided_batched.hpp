@@ -192,6 +192,7 @@ void testing_rotm_strided_batched(const Arguments& arg)
         hy_gold.copy_from(hy);
 
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
         {
             cblas_rotm<T>(N, hx_gold[b], incx, hy_gold[b], incy, hparam[b]);
@@ -163,6 +163,7 @@ void testing_rotmg_batched(const Arguments& arg)
         hparams_gold.copy_from(hparams);
 
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
         {
             cblas_rotmg<T>(hd1_gold[b], hd2_gold[b], hx_gold[b], hy_gold[b], hparams_gold[b]);
@@ -313,9 +314,7 @@ void testing_rotmg_batched(const Arguments& arg)
         }
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_rotgm_batched_fn(handle,
                                      dd1.ptr_on_device(),
                                      dd2.ptr_on_device(),
@@ -323,8 +322,7 @@ void testing_rotmg_batched(const Arguments& arg)
                                      dy.ptr_on_device(),
                                      dparams.ptr_on_device(),
                                      batch_count);
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_batch_count>{}.log_args<T>(rocblas_cout,
                                                    arg,
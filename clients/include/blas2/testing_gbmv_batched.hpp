@@ -475,6 +475,7 @@ void testing_gbmv_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(int b = 0; b < batch_count; ++b)
         {
             cblas_gbmv<T>(
@@ -528,10 +529,7 @@ void testing_gbmv_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_gbmv_batched_fn(handle,
                                     transA,
                                     M,
@@ -547,9 +545,7 @@ void testing_gbmv_batched(const Arguments& arg)
                                     dy_1.ptr_on_device(),
                                     incy,
                                     batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_transA,
                       e_M,
@@ -522,6 +522,7 @@ void testing_gbmv_strided_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(int b = 0; b < batch_count; ++b)
         {
             cblas_gbmv<T>(
@@ -578,10 +579,7 @@ void testing_gbmv_strided_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_gbmv_strided_batched_fn(handle,
                                             transA,
                                             M,
@@ -600,9 +598,7 @@ void testing_gbmv_strided_batched(const Arguments& arg)
                                             incy,
                                             stride_y,
                                             batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_transA,
                       e_M,
@@ -0,0 +1,628 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// gemv_nt is a beta feature without Fortran bindings
+template <typename T>
+static rocblas_status (*rocblas_gemv_nt)(rocblas_handle    handle,
+                                         rocblas_operation trans,
+                                         rocblas_int       m,
+                                         rocblas_int       n,
+                                         const T*          alpha,
+                                         const T*          A,
+                                         rocblas_int       lda,
+                                         const T*          x,
+                                         rocblas_int       incx,
+                                         const T*          beta,
+                                         T*                y,
+                                         rocblas_int       incy,
+                                         const T*          gamma,
+                                         const T*          w,
+                                         rocblas_int       incw,
+                                         const T*          delta,
+                                         T*                z,
+                                         rocblas_int       incz);
+
+template <>
+static auto rocblas_gemv_nt<float> = rocblas_sgemv_nt;
+template <>
+static auto rocblas_gemv_nt<double> = rocblas_dgemv_nt;
+template <>
+static auto rocblas_gemv_nt<rocblas_float_complex> = rocblas_cgemv_nt;
+template <>
+static auto rocblas_gemv_nt<rocblas_double_complex> = rocblas_zgemv_nt;
+
+template <typename T>
+void testing_gemv_nt_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemv_nt_fn = rocblas_gemv_nt<T>;
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const rocblas_operation trans = rocblas_operation_transpose;
+        const rocblas_int       M     = 100;
+        const rocblas_int       N     = 100;
+        const rocblas_int       lda   = 100;
+        const rocblas_int       incx  = 1;
+        const rocblas_int       incy  = 1;
+        const rocblas_int       incw  = 1;
+        const rocblas_int       incz  = 1;
+
+        device_vector<T> alpha_d(1), beta_d(1), one_d(1), zero_d(1);
+
+        const T alpha_h(1), beta_h(2), one_h(1), zero_h(0);
+
+        const T* alpha = &alpha_h;
+        const T* beta  = &beta_h;
+        const T* one   = &one_h;
+        const T* zero  = &zero_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(beta_d, beta, sizeof(*beta), hipMemcpyHostToDevice));
+            beta = beta_d;
+            CHECK_HIP_ERROR(hipMemcpy(one_d, one, sizeof(*one), hipMemcpyHostToDevice));
+            one = one_d;
+            CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+            zero = zero_d;
+        }
+
+        // Allocate device memory
+        device_matrix<T> dA(M, N, lda);
+        device_vector<T> dx(N, incx);
+        device_vector<T> dy(M, incy);
+        device_vector<T> dw(M, incw);
+        device_vector<T> dz(N, incz);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy.memcheck());
+        CHECK_DEVICE_ALLOCATION(dw.memcheck());
+        CHECK_DEVICE_ALLOCATION(dz.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_nt_fn(nullptr,
+                                                 trans,
+                                                 M,
+                                                 N,
+                                                 alpha,
+                                                 dA,
+                                                 lda,
+                                                 dx,
+                                                 incx,
+                                                 beta,
+                                                 dy,
+                                                 incy,
+                                                 alpha,
+                                                 dw,
+                                                 incw,
+                                                 beta,
+                                                 dz,
+                                                 incz),
+                              rocblas_status_invalid_handle);
+
+        // The first operation is always y := alpha*A*x + beta*y
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_nt_fn(handle,
+                                                 rocblas_operation_none,
+                                                 M,
+                                                 N,
+                                                 alpha,
+                                                 dA,
+                                                 lda,
+                                                 dx,
+                                                 incx,
+                                                 beta,
+                                                 dy,
+                                                 incy,
+                                                 alpha,
+                                                 dw,
+                                                 incw,
+                                                 beta,
+                                                 dz,
+                                                 incz),
+                              rocblas_status_invalid_value);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_nt_fn(handle,
+                                                 trans,
+                                                 M,
+                                                 N,
+                                                 alpha,
+                                                 dA,
+                                                 M - 1,
+                                                 dx,
+                                                 incx,
+                                                 beta,
+                                                 dy,
+                                                 incy,
+                                                 alpha,
+                                                 dw,
+                                                 incw,
+                                                 beta,
+                                                 dz,
+                                                 incz),
+                              rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_nt_fn(handle,
+                                                 trans,
+                                                 M,
+                                                 N,
+                                                 alpha,
+                                                 dA,
+                                                 lda,
+                                                 dx,
+                                                 incx,
+                                                 beta,
+                                                 dy,
+                                                 incy,
+                                                 alpha,
+                                                 dw,
+                                                 0,
+                                                 beta,
+                                                 dz,
+                                                 incz),
+                              rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_nt_fn(handle,
+                                                 trans,
+                                                 M,
+                                                 N,
+                                                 alpha,
+                                                 dA,
+                                                 lda,
+                                                 dx,
+                                                 incx,
+                                                 beta,
+                                                 dy,
+                                                 incy,
+                                                 alpha,
+                                                 dw,
+                                                 incw,
+                                                 beta,
+                                                 dz,
+                                                 0),
+                              rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_nt_fn(handle,
+                                                 trans,
+                                                 M,
+                                                 N,
+                                                 alpha,
+                                                 dA,
+                                                 lda,
+                                                 dx,
+                                                 incx,
+                                                 beta,
+                                                 dy,
+                                                 incy,
+                                                 nullptr,
+                                                 dw,
+                                                 incw,
+                                                 beta,
+                                                 dz,
+                                                 incz),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_nt_fn(handle,
+                                                 trans,
+                                                 M,
+                                                 N,
+                                                 alpha,
+                                                 dA,
+                                                 lda,
+                                                 dx,
+                                                 incx,
+                                                 beta,
+                                                 dy,
+                                                 incy,
+                                                 alpha,
+                                                 dw,
+                                                 incw,
+                                                 nullptr,
+                                                 dz,
+                                                 incz),
+                              rocblas_status_invalid_pointer);
+
+        // The matrix and vectors are only checked when the scalars are on the host
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv_nt_fn(handle,
+                                                     trans,
+                                                     M,
+                                                     N,
+                                                     alpha,
+                                                     nullptr,
+                                                     lda,
+                                                     dx,
+                                                     incx,
+                                                     beta,
+                                                     dy,
+                                                     incy,
+                                                     alpha,
+                                                     dw,
+                                                     incw,
+                                                     beta,
+                                                     dz,
+                                                     incz),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv_nt_fn(handle,
+                                                     trans,
+                                                     M,
+                                                     N,
+                                                     alpha,
+                                                     dA,
+                                                     lda,
+                                                     dx,
+                                                     incx,
+                                                     beta,
+                                                     dy,
+                                                     incy,
+                                                     alpha,
+                                                     nullptr,
+                                                     incw,
+                                                     beta,
+                                                     dz,
+                                                     incz),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv_nt_fn(handle,
+                                                     trans,
+                                                     M,
+                                                     N,
+                                                     alpha,
+                                                     dA,
+                                                     lda,
+                                                     dx,
+                                                     incx,
+                                                     beta,
+                                                     dy,
+                                                     incy,
+                                                     alpha,
+                                                     dw,
+                                                     incw,
+                                                     beta,
+                                                     nullptr,
+                                                     incz),
+                                  rocblas_status_invalid_pointer);
+
+            // If alpha and gamma are 0 and beta and delta are 1, nothing is dereferenced
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv_nt_fn(handle,
+                                                     trans,
+                                                     M,
+                                                     N,
+                                                     zero,
+                                                     nullptr,
+                                                     lda,
+                                                     nullptr,
+                                                     incx,
+                                                     one,
+                                                     nullptr,
+                                                     incy,
+                                                     zero,
+                                                     nullptr,
+                                                     incw,
+                                                     one,
+                                                     nullptr,
+                                                     incz),
+                                  rocblas_status_success);
+        }
+
+        // If M is 0, the scalars, matrix and vectors are not dereferenced
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_nt_fn(handle,
+                                                 trans,
+                                                 0,
+                                                 N,
+                                                 nullptr,
+                                                 nullptr,
+                                                 lda,
+                                                 nullptr,
+                                                 incx,
+                                                 nullptr,
+                                                 nullptr,
+                                                 incy,
+                                                 nullptr,
+                                                 nullptr,
+                                                 incw,
+                                                 nullptr,
+                                                 nullptr,
+                                                 incz),
+                              rocblas_status_success);
+    }
+}
+
+// gemv_nt must match the two CPU gemv y := alpha*A*x + beta*y and z := gamma*op(A)*w + delta*z,
+// with op(A) from transA. w and z have the increments incd and incb, and gamma and delta are
+// beta and alpha, so that one of the operations may scale only while the other does not.
+template <typename T>
+void testing_gemv_nt(const Arguments& arg)
+{
+    auto rocblas_gemv_nt_fn = rocblas_gemv_nt<T>;
+
+    rocblas_operation trans   = char2rocblas_operation(arg.transA);
+    rocblas_int       M       = arg.M;
+    rocblas_int       N       = arg.N;
+    rocblas_int       lda     = arg.lda;
+    rocblas_int       incx    = arg.incx;
+    rocblas_int       incy    = arg.incy;
+    rocblas_int       incw    = arg.incd;
+    rocblas_int       incz    = arg.incb;
+    T                 h_alpha = arg.get_alpha<T>();
+    T                 h_beta  = arg.get_beta<T>();
+    T                 h_gamma = h_beta;
+    T                 h_delta = h_alpha;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || lda < M || lda < 1 || !incx || !incy || !incw || !incz;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_nt_fn(handle,
+                                                 trans,
+                                                 M,
+                                                 N,
+                                                 nullptr,
+                                                 nullptr,
+                                                 lda,
+                                                 nullptr,
+                                                 incx,
+                                                 nullptr,
+                                                 nullptr,
+                                                 incy,
+                                                 nullptr,
+                                                 nullptr,
+                                                 incw,
+                                                 nullptr,
+                                                 nullptr,
+                                                 incz),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hy_1), `d` is in GPU (device) memory (eg dy_1).
+    // Allocate host memory
+    host_matrix<T> hA(M, N, lda);
+    host_vector<T> hx(N, incx);
+    host_vector<T> hy(M, incy);
+    host_vector<T> hy_1(M, incy);
+    host_vector<T> hy_2(M, incy);
+    host_vector<T> hy_gold(M, incy);
+    host_vector<T> hw(M, incw);
+    host_vector<T> hz(N, incz);
+    host_vector<T> hz_1(N, incz);
+    host_vector<T> hz_2(N, incz);
+    host_vector<T> hz_gold(N, incz);
+    host_vector<T> hscalars(4);
+
+    // Allocate device memory
+    device_matrix<T> dA(M, N, lda);
+    device_vector<T> dx(N, incx);
+    device_vector<T> dy_1(M, incy);
+    device_vector<T> dy_2(M, incy);
+    device_vector<T> dw(M, incw);
+    device_vector<T> dz_1(N, incz);
+    device_vector<T> dz_2(N, incz);
+    device_vector<T> d_scalars(4);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(dw.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_scalars.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hy, arg, rocblas_client_beta_sets_nan);
+    rocblas_init_vector(hw, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hz, arg, rocblas_client_alpha_sets_nan);
+
+    hscalars[0] = h_alpha;
+    hscalars[1] = h_beta;
+    hscalars[2] = h_gamma;
+    hscalars[3] = h_delta;
+
+    // Transfer data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy_1.transfer_from(hy));
+    CHECK_HIP_ERROR(dw.transfer_from(hw));
+    CHECK_HIP_ERROR(dz_1.transfer_from(hz));
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dy_2.transfer_from(hy));
+        CHECK_HIP_ERROR(dz_2.transfer_from(hz));
+        CHECK_HIP_ERROR(d_scalars.transfer_from(hscalars));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_nt_fn(handle,
+                                               trans,
+                                               M,
+                                               N,
+                                               &h_alpha,
+                                               dA,
+                                               lda,
+                                               dx,
+                                               incx,
+                                               &h_beta,
+                                               dy_1,
+                                               incy,
+                                               &h_gamma,
+                                               dw,
+                                               incw,
+                                               &h_delta,
+                                               dz_1,
+                                               incz));
+        handle.post_test(arg);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        const T* s = d_scalars;
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_nt_fn(handle,
+                                               trans,
+                                               M,
+                                               N,
+                                               s,
+                                               dA,
+                                               lda,
+                                               dx,
+                                               incx,
+                                               s + 1,
+                                               dy_2,
+                                               incy,
+                                               s + 2,
+                                               dw,
+                                               incw,
+                                               s + 3,
+                                               dz_2,
+                                               incz));
+        handle.post_test(arg);
+
+        // CPU BLAS
+        hy_gold = hy;
+        hz_gold = hz;
+
+        cpu_time_used = get_time_us_no_sync();
+
+        cblas_gemv<T>(
+            rocblas_operation_none, M, N, h_alpha, hA, lda, hx, incx, h_beta, hy_gold, incy);
+        cblas_gemv<T>(trans, M, N, h_gamma, hA, lda, hw, incw, h_delta, hz_gold, incz);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy_1));
+        CHECK_HIP_ERROR(hy_2.transfer_from(dy_2));
+        CHECK_HIP_ERROR(hz_1.transfer_from(dz_1));
+        CHECK_HIP_ERROR(hz_2.transfer_from(dz_2));
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, M, std::abs(incy), hy_gold, hy_1);
+            unit_check_general<T>(1, M, std::abs(incy), hy_gold, hy_2);
+            unit_check_general<T>(1, N, std::abs(incz), hz_gold, hz_1);
+            unit_check_general<T>(1, N, std::abs(incz), hz_gold, hz_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', 1, M, std::abs(incy), hy_gold, hy_1)
+                              + norm_check_general<T>('F', 1, N, std::abs(incz), hz_gold, hz_1);
+            rocblas_error_2 = norm_check_general<T>('F', 1, M, std::abs(incy), hy_gold, hy_2)
+                              + norm_check_general<T>('F', 1, N, std::abs(incz), hz_gold, hz_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_gemv_nt_fn(handle,
+                               trans,
+                               M,
+                               N,
+                               &h_alpha,
+                               dA,
+                               lda,
+                               dx,
+                               incx,
+                               &h_beta,
+                               dy_1,
+                               incy,
+                               &h_gamma,
+                               dw,
+                               incw,
+                               &h_delta,
+                               dz_1,
+                               incz);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_gemv_nt_fn(handle,
+                               trans,
+                               M,
+                               N,
+                               &h_alpha,
+                               dA,
+                               lda,
+                               dx,
+                               incx,
+                               &h_beta,
+                               dy_1,
+                               incy,
+                               &h_gamma,
+                               dw,
+                               incw,
+                               &h_delta,
+                               dz_1,
+                               incz);
+        });
+
+        // A is read once for both products
+        ArgumentModel<e_transA, e_M, e_N, e_alpha, e_lda, e_incx, e_beta, e_incy, e_incd, e_incb>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemv_gflop_count<T>(rocblas_operation_none, M, N)
+                             + gemv_gflop_count<T>(trans, M, N),
+                         gemv_gbyte_count<T>(rocblas_operation_none, M, N)
+                             + gemv_gbyte_count<T>(trans, M, N) - sizeof(T) * double(M) * N / 1e9,
+                         cpu_time_used,
+                         rocblas_error_1,
+                         rocblas_error_2);
+    }
+}
@@ -0,0 +1,629 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// gemv_vbatched is a beta feature without Fortran bindings
+template <typename T>
+static rocblas_status (*rocblas_gemv_vbatched)(rocblas_handle     handle,
+                                               rocblas_operation  transA,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               const T*           alpha,
+                                               const T* const     A[],
+                                               const rocblas_int* lda,
+                                               const T* const     x[],
+                                               const rocblas_int* incx,
+                                               const T*           beta,
+                                               T* const           y[],
+                                               const rocblas_int* incy,
+                                               rocblas_int        batch_count);
+
+template <>
+static auto rocblas_gemv_vbatched<float> = rocblas_sgemv_vbatched;
+template <>
+static auto rocblas_gemv_vbatched<double> = rocblas_dgemv_vbatched;
+template <>
+static auto rocblas_gemv_vbatched<rocblas_float_complex> = rocblas_cgemv_vbatched;
+template <>
+static auto rocblas_gemv_vbatched<rocblas_double_complex> = rocblas_zgemv_vbatched;
+
+template <typename T>
+void testing_gemv_vbatched_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemv_vbatched_fn = rocblas_gemv_vbatched<T>;
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const rocblas_operation transA      = rocblas_operation_none;
+        const rocblas_int       M           = 100;
+        const rocblas_int       N           = 100;
+        const rocblas_int       batch_count = 5;
+
+        device_vector<T> alpha_d(1), beta_d(1), one_d(1), zero_d(1);
+
+        const T alpha_h(1), beta_h(2), one_h(1), zero_h(0);
+
+        const T* alpha = &alpha_h;
+        const T* beta  = &beta_h;
+        const T* one   = &one_h;
+        const T* zero  = &zero_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(beta_d, beta, sizeof(*beta), hipMemcpyHostToDevice));
+            beta = beta_d;
+            CHECK_HIP_ERROR(hipMemcpy(one_d, one, sizeof(*one), hipMemcpyHostToDevice));
+            one = one_d;
+            CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+            zero = zero_d;
+        }
+
+        // Allocate device memory
+        device_batch_matrix<T>     dA(M, N, M, batch_count);
+        device_batch_vector<T>     dx(N, 1, batch_count);
+        device_batch_vector<T>     dy(M, 1, batch_count);
+        device_vector<rocblas_int> dm(batch_count), dn(batch_count), dlda(batch_count);
+        device_vector<rocblas_int> dincx(batch_count), dincy(batch_count);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy.memcheck());
+        CHECK_DEVICE_ALLOCATION(dm.memcheck());
+        CHECK_DEVICE_ALLOCATION(dn.memcheck());
+        CHECK_DEVICE_ALLOCATION(dlda.memcheck());
+        CHECK_DEVICE_ALLOCATION(dincx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dincy.memcheck());
+
+        auto dA_array = dA.ptr_on_device();
+        auto dx_array = dx.ptr_on_device();
+        auto dy_array = dy.ptr_on_device();
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_vbatched_fn(nullptr,
+                                                       transA,
+                                                       dm,
+                                                       dn,
+                                                       alpha,
+                                                       dA_array,
+                                                       dlda,
+                                                       dx_array,
+                                                       dincx,
+                                                       beta,
+                                                       dy_array,
+                                                       dincy,
+                                                       batch_count),
+                              rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_vbatched_fn(handle,
+                                                       (rocblas_operation)rocblas_fill_full,
+                                                       dm,
+                                                       dn,
+                                                       alpha,
+                                                       dA_array,
+                                                       dlda,
+                                                       dx_array,
+                                                       dincx,
+                                                       beta,
+                                                       dy_array,
+                                                       dincy,
+                                                       batch_count),
+                              rocblas_status_invalid_value);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_vbatched_fn(handle,
+                                                       transA,
+                                                       dm,
+                                                       dn,
+                                                       alpha,
+                                                       dA_array,
+                                                       dlda,
+                                                       dx_array,
+                                                       dincx,
+                                                       beta,
+                                                       dy_array,
+                                                       dincy,
+                                                       -1),
+                              rocblas_status_invalid_size);
+
+        // The size arrays are always needed, as they are only read on the device
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_vbatched_fn(handle,
+                                                       transA,
+                                                       nullptr,
+                                                       dn,
+                                                       alpha,
+                                                       dA_array,
+                                                       dlda,
+                                                       dx_array,
+                                                       dincx,
+                                                       beta,
+                                                       dy_array,
+                                                       dincy,
+                                                       batch_count),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_vbatched_fn(handle,
+                                                       transA,
+                                                       dm,
+                                                       nullptr,
+                                                       alpha,
+                                                       dA_array,
+                                                       dlda,
+                                                       dx_array,
+                                                       dincx,
+                                                       beta,
+                                                       dy_array,
+                                                       dincy,
+                                                       batch_count),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_vbatched_fn(handle,
+                                                       transA,
+                                                       dm,
+                                                       dn,
+                                                       alpha,
+                                                       dA_array,
+                                                       nullptr,
+                                                       dx_array,
+                                                       dincx,
+                                                       beta,
+                                                       dy_array,
+                                                       dincy,
+                                                       batch_count),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_vbatched_fn(handle,
+                                                       transA,
+                                                       dm,
+                                                       dn,
+                                                       alpha,
+                                                       dA_array,
+                                                       dlda,
+                                                       dx_array,
+                                                       nullptr,
+                                                       beta,
+                                                       dy_array,
+                                                       dincy,
+                                                       batch_count),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_vbatched_fn(handle,
+                                                       transA,
+                                                       dm,
+                                                       dn,
+                                                       alpha,
+                                                       dA_array,
+                                                       dlda,
+                                                       dx_array,
+                                                       dincx,
+                                                       beta,
+                                                       dy_array,
+                                                       nullptr,
+                                                       batch_count),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_vbatched_fn(handle,
+                                                       transA,
+                                                       dm,
+                                                       dn,
+                                                       nullptr,
+                                                       dA_array,
+                                                       dlda,
+                                                       dx_array,
+                                                       dincx,
+                                                       beta,
+                                                       dy_array,
+                                                       dincy,
+                                                       batch_count),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_vbatched_fn(handle,
+                                                       transA,
+                                                       dm,
+                                                       dn,
+                                                       alpha,
+                                                       dA_array,
+                                                       dlda,
+                                                       dx_array,
+                                                       dincx,
+                                                       nullptr,
+                                                       dy_array,
+                                                       dincy,
+                                                       batch_count),
+                              rocblas_status_invalid_pointer);
+
+        // The matrix and vector arrays are only checked when alpha and beta are on the host
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv_vbatched_fn(handle,
+                                                           transA,
+                                                           dm,
+                                                           dn,
+                                                           alpha,
+                                                           nullptr,
+                                                           dlda,
+                                                           dx_array,
+                                                           dincx,
+                                                           beta,
+                                                           dy_array,
+                                                           dincy,
+                                                           batch_count),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv_vbatched_fn(handle,
+                                                           transA,
+                                                           dm,
+                                                           dn,
+                                                           alpha,
+                                                           dA_array,
+                                                           dlda,
+                                                           nullptr,
+                                                           dincx,
+                                                           beta,
+                                                           dy_array,
+                                                           dincy,
+                                                           batch_count),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv_vbatched_fn(handle,
+                                                           transA,
+                                                           dm,
+                                                           dn,
+                                                           alpha,
+                                                           dA_array,
+                                                           dlda,
+                                                           dx_array,
+                                                           dincx,
+                                                           beta,
+                                                           nullptr,
+                                                           dincy,
+                                                           batch_count),
+                                  rocblas_status_invalid_pointer);
+
+            // If alpha is 0 and beta is 1, A, x and y are not dereferenced
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv_vbatched_fn(handle,
+                                                           transA,
+                                                           dm,
+                                                           dn,
+                                                           zero,
+                                                           nullptr,
+                                                           dlda,
+                                                           nullptr,
+                                                           dincx,
+                                                           one,
+                                                           nullptr,
+                                                           dincy,
+                                                           batch_count),
+                                  rocblas_status_success);
+        }
+
+        // If batch_count is 0, nothing is dereferenced
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_vbatched_fn(handle,
+                                                       transA,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       0),
+                              rocblas_status_success);
+    }
+}
+
+// Instance b of the batch has m_b and n_b from 0 to M and N, lda_b from m_b to m_b + 2 and
+// increments of both signs. One instance has lda_b < m_b and one has incx_b of 0, which must
+// be skipped and leave y_b unchanged, as must the empty instances. The instances are packed
+// in single allocations, so that the whole of y is compared with the CPU gemv of each instance.
+template <typename T>
+void testing_gemv_vbatched(const Arguments& arg)
+{
+    auto rocblas_gemv_vbatched_fn = rocblas_gemv_vbatched<T>;
+
+    rocblas_operation transA      = char2rocblas_operation(arg.transA);
+    rocblas_int       M           = arg.M;
+    rocblas_int       N           = arg.N;
+    rocblas_int       batch_count = arg.batch_count;
+    T                 h_alpha     = arg.get_alpha<T>();
+    T                 h_beta      = arg.get_beta<T>();
+    bool              trans       = transA != rocblas_operation_none;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(batch_count <= 0 || M < 0 || N < 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_vbatched_fn(handle,
+                                                       transA,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       batch_count),
+                              batch_count < 0 ? rocblas_status_invalid_size
+                                              : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hy_1), `d` is in GPU (device) memory (eg dy_1).
+    host_vector<rocblas_int> hm(batch_count), hn(batch_count), hlda(batch_count);
+    host_vector<rocblas_int> hincx(batch_count), hincy(batch_count);
+    std::vector<size_t>      offA(batch_count), offx(batch_count), offy(batch_count);
+
+    size_t sizeA = 0, sizex = 0, sizey = 0;
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        hm[b]    = (b * 37 + 11) % (M + 1);
+        hn[b]    = (b * 53 + 7) % (N + 1);
+        hlda[b]  = hm[b] + b % 3;
+        hincx[b] = b % 4 == 3 ? -2 : 1;
+        hincy[b] = b % 5 == 4 ? -1 : 1 + b % 2;
+
+        // invalid, skipped
+        if(b == batch_count / 2 && hm[b] > 1)
+            hlda[b] = hm[b] - 1;
+        if(b == batch_count / 3 && b != batch_count / 2)
+            hincx[b] = 0;
+
+        offA[b] = sizeA;
+        offx[b] = sizex;
+        offy[b] = sizey;
+        sizeA += std::max(1, hlda[b]) * size_t(std::max(1, hn[b]));
+        sizex += std::max(1, std::abs(hincx[b])) * size_t(std::max(1, trans ? hm[b] : hn[b]));
+        sizey += std::abs(hincy[b]) * size_t(std::max(1, trans ? hn[b] : hm[b]));
+    }
+
+    // Allocate host memory
+    host_vector<T> hA(sizeA);
+    host_vector<T> hx(sizex);
+    host_vector<T> hy(sizey);
+    host_vector<T> hy_1(sizey);
+    host_vector<T> hy_2(sizey);
+    host_vector<T> hy_gold(sizey);
+
+    // Allocate device memory
+    device_vector<T>           dA(sizeA);
+    device_vector<T>           dx(sizex);
+    device_vector<T>           dy_1(sizey);
+    device_vector<T>           dy_2(sizey);
+    device_vector<T>           d_alpha(1);
+    device_vector<T>           d_beta(1);
+    device_vector<rocblas_int> dm(batch_count), dn(batch_count), dlda(batch_count);
+    device_vector<rocblas_int> dincx(batch_count), dincy(batch_count);
+    device_vector<const T*>    dA_array(batch_count), dx_array(batch_count);
+    device_vector<T*>          dy_1_array(batch_count), dy_2_array(batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+    CHECK_DEVICE_ALLOCATION(dm.memcheck());
+    CHECK_DEVICE_ALLOCATION(dn.memcheck());
+    CHECK_DEVICE_ALLOCATION(dlda.memcheck());
+    CHECK_DEVICE_ALLOCATION(dincx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dincy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_array.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_array.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_1_array.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_2_array.memcheck());
+
+    // Initialize data on host memory
+    rocblas_seedrand();
+    rocblas_init(hA, sizeA, 1, sizeA);
+    rocblas_init(hx, sizex, 1, sizex);
+    rocblas_init(hy, sizey, 1, sizey);
+
+    host_vector<const T*> hA_array(batch_count), hx_array(batch_count);
+    host_vector<T*>       hy_1_array(batch_count), hy_2_array(batch_count);
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        hA_array[b]   = (const T*)dA + offA[b];
+        hx_array[b]   = (const T*)dx + offx[b];
+        hy_1_array[b] = (T*)dy_1 + offy[b];
+        hy_2_array[b] = (T*)dy_2 + offy[b];
+    }
+
+    // Transfer data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy_1.transfer_from(hy));
+    CHECK_HIP_ERROR(dm.transfer_from(hm));
+    CHECK_HIP_ERROR(dn.transfer_from(hn));
+    CHECK_HIP_ERROR(dlda.transfer_from(hlda));
+    CHECK_HIP_ERROR(dincx.transfer_from(hincx));
+    CHECK_HIP_ERROR(dincy.transfer_from(hincy));
+    CHECK_HIP_ERROR(dA_array.transfer_from(hA_array));
+    CHECK_HIP_ERROR(dx_array.transfer_from(hx_array));
+    CHECK_HIP_ERROR(dy_1_array.transfer_from(hy_1_array));
+    CHECK_HIP_ERROR(dy_2_array.transfer_from(hy_2_array));
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dy_2.transfer_from(hy));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_vbatched_fn(handle,
+                                                     transA,
+                                                     dm,
+                                                     dn,
+                                                     &h_alpha,
+                                                     dA_array,
+                                                     dlda,
+                                                     dx_array,
+                                                     dincx,
+                                                     &h_beta,
+                                                     dy_1_array,
+                                                     dincy,
+                                                     batch_count));
+        handle.post_test(arg);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_vbatched_fn(handle,
+                                                     transA,
+                                                     dm,
+                                                     dn,
+                                                     d_alpha,
+                                                     dA_array,
+                                                     dlda,
+                                                     dx_array,
+                                                     dincx,
+                                                     d_beta,
+                                                     dy_2_array,
+                                                     dincy,
+                                                     batch_count));
+        handle.post_test(arg);
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        hy_gold = hy;
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            if(hm[b] > 0 && hn[b] > 0 && hlda[b] >= hm[b] && hincx[b] && hincy[b])
+                cblas_gemv<T>(transA,
+                              hm[b],
+                              hn[b],
+                              h_alpha,
+                              hA + offA[b],
+                              hlda[b],
+                              hx + offx[b],
+                              hincx[b],
+                              h_beta,
+                              hy_gold + offy[b],
+                              hincy[b]);
+        }
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy_1));
+        CHECK_HIP_ERROR(hy_2.transfer_from(dy_2));
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, sizey, 1, hy_gold, hy_1);
+            unit_check_general<T>(1, sizey, 1, hy_gold, hy_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', 1, sizey, 1, hy_gold, hy_1);
+            rocblas_error_2 = norm_check_general<T>('F', 1, sizey, 1, hy_gold, hy_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_gemv_vbatched_fn(handle,
+                                     transA,
+                                     dm,
+                                     dn,
+                                     &h_alpha,
+                                     dA_array,
+                                     dlda,
+                                     dx_array,
+                                     dincx,
+                                     &h_beta,
+                                     dy_1_array,
+                                     dincy,
+                                     batch_count);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_gemv_vbatched_fn(handle,
+                                     transA,
+                                     dm,
+                                     dn,
+                                     &h_alpha,
+                                     dA_array,
+                                     dlda,
+                                     dx_array,
+                                     dincx,
+                                     &h_beta,
+                                     dy_1_array,
+                                     dincy,
+                                     batch_count);
+        });
+
+        // flops and bytes of the instances that are computed
+        double gflops = 0.0, gbytes = 0.0;
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            if(hm[b] > 0 && hn[b] > 0 && hlda[b] >= hm[b] && hincx[b] && hincy[b])
+            {
+                gflops += gemv_gflop_count<T>(transA, hm[b], hn[b]);
+                gbytes += gemv_gbyte_count<T>(transA, hm[b], hn[b]);
+            }
+        }
+
+        ArgumentModel<e_transA, e_M, e_N, e_alpha, e_beta, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            gflops,
+            gbytes,
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
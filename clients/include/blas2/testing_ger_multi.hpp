@@ -0,0 +1,345 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// ger_multi is a beta feature without Fortran bindings, so only the precision and the
+// conjugation of Y are templated here
+
+// ger_multi, geru_multi and gerc_multi
+template <typename T, bool CONJ = false>
+static rocblas_status (*rocblas_ger_multi)(rocblas_handle handle,
+                                           rocblas_int    m,
+                                           rocblas_int    n,
+                                           rocblas_int    k,
+                                           const T*       alpha,
+                                           const T*       X,
+                                           rocblas_int    ldx,
+                                           const T*       Y,
+                                           rocblas_int    ldy,
+                                           T*             A,
+                                           rocblas_int    lda);
+
+template <>
+static auto rocblas_ger_multi<float, false> = rocblas_sger_multi;
+template <>
+static auto rocblas_ger_multi<double, false> = rocblas_dger_multi;
+template <>
+static auto rocblas_ger_multi<rocblas_float_complex, false> = rocblas_cgeru_multi;
+template <>
+static auto rocblas_ger_multi<rocblas_double_complex, false> = rocblas_zgeru_multi;
+template <>
+static auto rocblas_ger_multi<rocblas_float_complex, true> = rocblas_cgerc_multi;
+template <>
+static auto rocblas_ger_multi<rocblas_double_complex, true> = rocblas_zgerc_multi;
+
+template <typename T, bool CONJ = false>
+void testing_ger_multi_bad_arg(const Arguments& arg)
+{
+    auto rocblas_ger_multi_fn = rocblas_ger_multi<T, CONJ>;
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_int M   = 100;
+        rocblas_int N   = 100;
+        rocblas_int K   = 4;
+        rocblas_int ldx = 100;
+        rocblas_int ldy = 100;
+        rocblas_int lda = 100;
+
+        device_vector<T> alpha_d(K), zero_d(K);
+
+        host_vector<T> alpha_h(K), zero_h(K);
+        for(rocblas_int i = 0; i < K; i++)
+        {
+            alpha_h[i] = T(1);
+            zero_h[i]  = T(0);
+        }
+
+        const T* alpha = alpha_h;
+        const T* zero  = zero_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(alpha_d.transfer_from(alpha_h));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(zero_d.transfer_from(zero_h));
+            zero = zero_d;
+        }
+
+        // Allocate device memory
+        device_matrix<T> dA(M, N, lda);
+        device_matrix<T> dX(M, K, ldx);
+        device_matrix<T> dY(N, K, ldy);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dX.memcheck());
+        CHECK_DEVICE_ALLOCATION(dY.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_ger_multi_fn(nullptr, M, N, K, alpha, dX, ldx, dY, ldy, dA, lda),
+            rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_ger_multi_fn(handle, M, N, -1, alpha, dX, ldx, dY, ldy, dA, lda),
+            rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_ger_multi_fn(handle, M, N, K, alpha, dX, M - 1, dY, ldy, dA, lda),
+            rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_ger_multi_fn(handle, M, N, K, alpha, dX, ldx, dY, N - 1, dA, lda),
+            rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_ger_multi_fn(handle, M, N, K, alpha, dX, ldx, dY, ldy, dA, M - 1),
+            rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_ger_multi_fn(handle, M, N, K, nullptr, dX, ldx, dY, ldy, dA, lda),
+            rocblas_status_invalid_pointer);
+
+        // The matrices are only validated when they are dereferenced, so in host mode with
+        // nonzero alpha
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_ger_multi_fn(handle, M, N, K, alpha, nullptr, ldx, dY, ldy, dA, lda),
+                rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_ger_multi_fn(handle, M, N, K, alpha, dX, ldx, nullptr, ldy, dA, lda),
+                rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_ger_multi_fn(handle, M, N, K, alpha, dX, ldx, dY, ldy, nullptr, lda),
+                rocblas_status_invalid_pointer);
+
+            // If all alpha are 0, nothing is dereferenced
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_ger_multi_fn(
+                    handle, M, N, K, zero, nullptr, ldx, nullptr, ldy, nullptr, lda),
+                rocblas_status_success);
+        }
+
+        // If k is 0, alpha and the matrices are not dereferenced
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_ger_multi_fn(
+                handle, M, N, 0, nullptr, nullptr, ldx, nullptr, ldy, nullptr, lda),
+            rocblas_status_success);
+    }
+}
+
+template <typename T>
+void testing_gerc_multi_bad_arg(const Arguments& arg)
+{
+    testing_ger_multi_bad_arg<T, true>(arg);
+}
+
+// ger_multi must give the result of k ger calls, both with the fused kernel (k <= 16) and
+// with gemm. alpha_i cycle through arg.alpha times 1, 0, -1 and 2, so that zero updates are
+// skipped correctly, and X and Y have the leading dimensions ldb and ldc.
+template <typename T, bool CONJ = false>
+void testing_ger_multi(const Arguments& arg)
+{
+    auto rocblas_ger_multi_fn = rocblas_ger_multi<T, CONJ>;
+
+    rocblas_int M       = arg.M;
+    rocblas_int N       = arg.N;
+    rocblas_int K       = arg.K;
+    rocblas_int lda     = arg.lda;
+    rocblas_int ldx     = arg.ldb;
+    rocblas_int ldy     = arg.ldc;
+    T           h_alpha = arg.get_alpha<T>();
+
+    rocblas_local_handle handle{arg};
+
+    // argument check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || ldx < M || ldx < 1 || ldy < N || ldy < 1
+                        || lda < M || lda < 1;
+    if(invalid_size || !M || !N || !K)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_ger_multi_fn(
+                handle, M, N, K, nullptr, nullptr, ldx, nullptr, ldy, nullptr, lda),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA_1), `d` is in GPU (device) memory (eg dA_1).
+    // Allocate host memory
+    host_matrix<T> hA_1(M, N, lda);
+    host_matrix<T> hA_2(M, N, lda);
+    host_matrix<T> hA_gold(M, N, lda);
+    host_matrix<T> hX(M, K, ldx);
+    host_matrix<T> hY(N, K, ldy);
+    host_vector<T> halpha(K);
+
+    // Allocate device memory
+    device_matrix<T> dA_1(M, N, lda);
+    device_matrix<T> dA_2(M, N, lda);
+    device_matrix<T> dX(M, K, ldx);
+    device_matrix<T> dY(N, K, ldy);
+    device_vector<T> d_alpha(K);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dY.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA_1, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hX, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hY, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix);
+
+    const T alpha_scale[] = {T(1), T(0), T(-1), T(2)};
+    for(rocblas_int i = 0; i < K; i++)
+        halpha[i] = h_alpha * alpha_scale[i % 4];
+
+    hA_gold = hA_1;
+    hA_2    = hA_1;
+
+    // Transfer data from CPU to device
+    CHECK_HIP_ERROR(dA_1.transfer_from(hA_1));
+    CHECK_HIP_ERROR(dX.transfer_from(hX));
+    CHECK_HIP_ERROR(dY.transfer_from(hY));
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // Transfer data from CPU to device
+        CHECK_HIP_ERROR(dA_2.transfer_from(hA_2));
+        CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(
+            rocblas_ger_multi_fn(handle, M, N, K, halpha, dX, ldx, dY, ldy, dA_1, lda));
+        handle.post_test(arg);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(
+            rocblas_ger_multi_fn(handle, M, N, K, d_alpha, dX, ldx, dY, ldy, dA_2, lda));
+        handle.post_test(arg);
+
+        // CPU BLAS, one ger per update
+        cpu_time_used = get_time_us_no_sync();
+
+        for(rocblas_int i = 0; i < K; i++)
+            cblas_ger<T, CONJ>(M,
+                               N,
+                               halpha[i],
+                               hX + size_t(i) * ldx,
+                               1,
+                               hY + size_t(i) * ldy,
+                               1,
+                               hA_gold,
+                               lda);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // Transfer output from device to CPU
+        CHECK_HIP_ERROR(hA_1.transfer_from(dA_1));
+        CHECK_HIP_ERROR(hA_2.transfer_from(dA_2));
+
+        if(arg.unit_check)
+        {
+            if(std::is_same<T, float>{} || std::is_same<T, double>{})
+            {
+                unit_check_general<T>(M, N, lda, hA_gold, hA_1);
+                unit_check_general<T>(M, N, lda, hA_gold, hA_2);
+            }
+            else
+            {
+                const double tol = K * sum_error_tolerance<T>;
+                near_check_general<T>(M, N, lda, hA_gold, hA_1, tol);
+                near_check_general<T>(M, N, lda, hA_gold, hA_2, tol);
+            }
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', M, N, lda, hA_gold, hA_1);
+            rocblas_error_2 = norm_check_general<T>('F', M, N, lda, hA_gold, hA_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_ger_multi_fn(handle, M, N, K, halpha, dX, ldx, dY, ldy, dA_1, lda);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_ger_multi_fn(handle, M, N, K, halpha, dX, ldx, dY, ldy, dA_1, lda);
+        });
+
+        ArgumentModel<e_M, e_N, e_K, e_alpha, e_lda, e_ldb, e_ldc>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            K * ger_gflop_count<T>(M, N),
+            ger_multi_gbyte_count<T>(M, N, K),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
+
+template <typename T>
+void testing_gerc_multi(const Arguments& arg)
+{
+    testing_ger_multi<T, true>(arg);
+}
@@ -387,6 +387,7 @@ void testing_ger_strided_batched(const Arguments& arg)
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
 
+#pragma omp parallel for
         for(int b = 0; b < batch_count; ++b)
         {
             cblas_ger<T, CONJ>(M, N, h_alpha, hx[b], incx, hy[b], incy, hA_gold[b], lda);
@@ -448,10 +449,7 @@ void testing_ger_strided_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_ger_strided_batched_fn(handle,
                                            M,
                                            N,
@@ -466,9 +464,7 @@ void testing_ger_strided_batched(const Arguments& arg)
                                            lda,
                                            stride_a,
                                            batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_M,
                       e_N,
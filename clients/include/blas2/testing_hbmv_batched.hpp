@@ -411,6 +411,7 @@ void testing_hbmv_batched(const Arguments& arg)
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
 
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
             cblas_hbmv<T>(uplo, N, K, h_alpha, hAb[b], lda, hx[b], incx, h_beta, hy_gold[b], incy);
 
@@ -460,10 +461,7 @@ void testing_hbmv_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_hbmv_batched_fn(handle,
                                     uplo,
                                     N,
@@ -477,9 +475,7 @@ void testing_hbmv_batched(const Arguments& arg)
                                     dy_1.ptr_on_device(),
                                     incy,
                                     batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_uplo, e_N, e_K, e_alpha, e_lda, e_incx, e_beta, e_incy, e_batch_count>{}
             .log_args<T>(rocblas_cout,
@@ -459,6 +459,7 @@ void testing_hbmv_strided_batched(const Arguments& arg)
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
 
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
             cblas_hbmv<T>(uplo, N, K, h_alpha, hAb[b], lda, hx[b], incx, h_beta, hy_gold[b], incy);
 
@@ -511,10 +512,7 @@ void testing_hbmv_strided_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_hbmv_strided_batched_fn(handle,
                                             uplo,
                                             N,
@@ -531,9 +529,7 @@ void testing_hbmv_strided_batched(const Arguments& arg)
                                             incy,
                                             stride_y,
                                             batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_uplo,
                       e_N,
@@ -225,6 +225,7 @@ void testing_her_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(int i = 0; i < batch_count; i++)
         {
             cblas_her<T>(uplo, N, h_alpha, hx[i], incx, hA_gold[i], lda);
@@ -270,10 +271,7 @@ void testing_her_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_her_batched_fn(handle,
                                    uplo,
                                    N,
@@ -283,9 +281,7 @@ void testing_her_batched(const Arguments& arg)
                                    dA_1.ptr_on_device(),
                                    lda,
                                    batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_uplo, e_N, e_alpha, e_lda, e_incx, e_batch_count>{}.log_args<T>(
             rocblas_cout,
@@ -286,6 +286,7 @@ void testing_hpr2_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(int i = 0; i < batch_count; i++)
         {
             cblas_hpr2<T>(uplo, N, h_alpha, hx[i], incx, hy[i], incy, hAp_gold[i]);
@@ -334,10 +335,7 @@ void testing_hpr2_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_hpr2_batched_fn(handle,
                                     uplo,
                                     N,
@@ -348,9 +346,7 @@ void testing_hpr2_batched(const Arguments& arg)
                                     incy,
                                     dAp_1.ptr_on_device(),
                                     batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_uplo, e_N, e_alpha, e_incx, e_incy, e_batch_count>{}.log_args<T>(
             rocblas_cout,
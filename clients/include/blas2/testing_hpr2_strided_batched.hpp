@@ -366,6 +366,7 @@ void testing_hpr2_strided_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(int i = 0; i < batch_count; i++)
         {
             cblas_hpr2<T>(uplo, N, h_alpha, hx[i], incx, hy[i], incy, hA_gold[i]);
@@ -417,10 +418,7 @@ void testing_hpr2_strided_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_hpr2_strided_batched_fn(handle,
                                             uplo,
                                             N,
@@ -434,9 +432,7 @@ void testing_hpr2_strided_batched(const Arguments& arg)
                                             dAp_1,
                                             stride_A,
                                             batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_uplo,
                       e_N,
@@ -226,6 +226,7 @@ void testing_hpr_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(int i = 0; i < batch_count; i++)
         {
             cblas_hpr<T>(uplo, N, h_alpha, hx[i], incx, hAp_gold[i]);
@@ -272,10 +273,7 @@ void testing_hpr_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_hpr_batched_fn(handle,
                                    uplo,
                                    N,
@@ -284,9 +282,7 @@ void testing_hpr_batched(const Arguments& arg)
                                    incx,
                                    dAp_1.ptr_on_device(),
                                    batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_uplo, e_N, e_alpha, e_incx, e_batch_count>{}.log_args<T>(
             rocblas_cout,
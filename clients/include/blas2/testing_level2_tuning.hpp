@@ -0,0 +1,279 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+// Name of the thresholds file written by the level2_tuning tests of a precision
+inline std::string testing_level2_tuning_path(const Arguments& arg)
+{
+    return std::string("rocblas_level2_tuning_") + rocblas_datatype2string(arg.a_type) + ".txt";
+}
+
+/* ============================================================================================ */
+template <typename T>
+void testing_level2_tuning_bad_arg(const Arguments& arg)
+{
+    std::string path = testing_level2_tuning_path(arg);
+    std::string arch = rocblas_internal_get_arch_name();
+
+    EXPECT_ROCBLAS_STATUS(rocblas_tune_level2_thresholds(nullptr), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_save_level2_thresholds(nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // Missing and malformed files are rejected
+    std::remove(path.c_str());
+    EXPECT_ROCBLAS_STATUS(rocblas_load_level2_thresholds(path.c_str()),
+                          rocblas_status_invalid_value);
+    {
+        std::ofstream file(path);
+        file << arch << " gemvt_unknown 1\n";
+    }
+    EXPECT_ROCBLAS_STATUS(rocblas_load_level2_thresholds(path.c_str()),
+                          rocblas_status_invalid_value);
+    {
+        std::ofstream file(path);
+        file << arch << " gemvt -1\n";
+    }
+    EXPECT_ROCBLAS_STATUS(rocblas_load_level2_thresholds(path.c_str()),
+                          rocblas_status_invalid_value);
+    {
+        std::ofstream file(path);
+        file << arch << " gemvt\n";
+    }
+    EXPECT_ROCBLAS_STATUS(rocblas_load_level2_thresholds(path.c_str()),
+                          rocblas_status_invalid_value);
+
+    CHECK_ROCBLAS_ERROR(rocblas_load_level2_thresholds(nullptr));
+    std::remove(path.c_str());
+}
+
+// Every gemv (transpose) kernel which the Level 2 thresholds select must give the results of
+// the default selection
+template <typename T>
+void testing_level2_tuning(const Arguments& arg)
+{
+    auto rocblas_gemv_fn = arg.fortran ? rocblas_gemv<T, true> : rocblas_gemv<T, false>;
+
+    rocblas_int       M       = arg.M;
+    rocblas_int       N       = arg.N;
+    rocblas_int       lda     = arg.lda;
+    rocblas_int       incx    = arg.incx;
+    rocblas_int       incy    = arg.incy;
+    T                 h_alpha = arg.get_alpha<T>();
+    T                 h_beta  = arg.get_beta<T>();
+    rocblas_operation transA  = char2rocblas_operation(arg.transA);
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || lda < M || lda < 1 || !incx || !incy;
+    if(invalid_size || !M || !N)
+    {
+        rocblas_local_handle handle{arg};
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemv_fn(
+                handle, transA, M, N, nullptr, nullptr, lda, nullptr, incx, nullptr, nullptr, incy),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+
+        return;
+    }
+
+    size_t dim_x = transA == rocblas_operation_none ? N : M;
+    size_t dim_y = transA == rocblas_operation_none ? M : N;
+
+    rocblas_int abs_incy = incy >= 0 ? incy : -incy;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_matrix<T> hA(M, N, lda);
+    host_vector<T> hx(dim_x, incx);
+    host_vector<T> hy(dim_y, incy);
+    host_vector<T> hy_default(dim_y, incy);
+    host_vector<T> hy_1(dim_y, incy);
+    host_vector<T> hy_2(dim_y, incy);
+    host_vector<T> hy_gold(dim_y, incy);
+
+    // Allocate device memory
+    device_matrix<T> dA(M, N, lda);
+    device_vector<T> dx(dim_x, incx);
+    device_vector<T> dy(dim_y, incy);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hy, arg, rocblas_client_beta_sets_nan);
+
+    hy_gold = hy;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // The thresholds of a handle are fixed when it is created
+    auto gemv = [&](host_vector<T>& result, rocblas_pointer_mode mode) {
+        rocblas_local_handle handle{arg};
+        bool                 host  = mode == rocblas_pointer_mode_host;
+        const T*             alpha = host ? &h_alpha : d_alpha;
+        const T*             beta  = host ? &h_beta : d_beta;
+
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, mode));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(
+            rocblas_gemv_fn(handle, transA, M, N, alpha, dA, lda, dx, incx, beta, dy, incy));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(result.transfer_from(dy));
+    };
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    std::string path = testing_level2_tuning_path(arg);
+    std::string arch = rocblas_internal_get_arch_name();
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_load_level2_thresholds(nullptr));
+        gemv(hy_default, rocblas_pointer_mode_host);
+
+        // Handles created after loading use the double buffered and warp reduction kernels
+        {
+            std::ofstream file(path);
+            file << "# forced kernels\n"
+                 << arch << " sgemvt_double_buffered 0\n"
+                 << arch << " dgemvt_double_buffered 0\n"
+                 << arch << " sgemvt_warp_reduce 0\n"
+                 << arch << " gemvt 0\n";
+        }
+        CHECK_ROCBLAS_ERROR(rocblas_load_level2_thresholds(path.c_str()));
+        gemv(hy_1, rocblas_pointer_mode_host);
+        gemv(hy_2, rocblas_pointer_mode_device);
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, dim_y, abs_incy, hy_default, hy_1);
+            unit_check_general<T>(1, dim_y, abs_incy, hy_default, hy_2);
+        }
+
+        // Measured thresholds are recorded, saved and loaded back
+        {
+            rocblas_local_handle handle{arg};
+            CHECK_ROCBLAS_ERROR(rocblas_tune_level2_thresholds(handle));
+        }
+        CHECK_ROCBLAS_ERROR(rocblas_save_level2_thresholds(path.c_str()));
+        CHECK_ROCBLAS_ERROR(rocblas_load_level2_thresholds(path.c_str()));
+        gemv(hy_1, rocblas_pointer_mode_host);
+        gemv(hy_2, rocblas_pointer_mode_device);
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        cblas_gemv<T>(transA, M, N, h_alpha, hA, lda, hx, incx, h_beta, hy_gold, incy);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, dim_y, abs_incy, hy_default, hy_1);
+            unit_check_general<T>(1, dim_y, abs_incy, hy_default, hy_2);
+            unit_check_general<T>(1, dim_y, abs_incy, hy_gold, hy_1);
+            unit_check_general<T>(1, dim_y, abs_incy, hy_gold, hy_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', 1, dim_y, abs_incy, hy_gold, hy_1);
+            rocblas_error_2 = norm_check_general<T>('F', 1, dim_y, abs_incy, hy_gold, hy_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        // Time gemv with the thresholds measured on this device
+        {
+            rocblas_local_handle handle{arg};
+            CHECK_ROCBLAS_ERROR(rocblas_tune_level2_thresholds(handle));
+        }
+
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_gemv_fn(handle, transA, M, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_gemv_fn(handle, transA, M, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy);
+        });
+
+        ArgumentModel<e_transA, e_M, e_N, e_alpha, e_lda, e_incx, e_beta, e_incy>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            gemv_gflop_count<T>(transA, M, N),
+            gemv_gbyte_count<T>(transA, M, N),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+
+    CHECK_ROCBLAS_ERROR(rocblas_load_level2_thresholds(nullptr));
+    std::remove(path.c_str());
+}
@@ -409,6 +409,7 @@ void testing_sbmv_batched(const Arguments& arg)
 
         cpu_time_used = get_time_us_no_sync();
         // cpu reference
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
         {
             cblas_sbmv<T>(
@@ -456,10 +457,7 @@ void testing_sbmv_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             CHECK_ROCBLAS_ERROR(rocblas_sbmv_batched_fn(handle,
                                                         uplo,
                                                         N,
@@ -473,9 +471,7 @@ void testing_sbmv_batched(const Arguments& arg)
                                                         dy.ptr_on_device(),
                                                         incy,
                                                         batch_count));
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_uplo, e_N, e_K, e_alpha, e_lda, e_incx, e_beta, e_incy, e_batch_count>{}
             .log_args<T>(rocblas_cout,
@@ -249,6 +249,7 @@ void testing_spr2_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
         {
             cblas_spr2<T>(uplo, N, h_alpha, hx[b], incx, hy[b], incy, hAp_gold[b]);
@@ -296,10 +297,7 @@ void testing_spr2_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_spr2_batched_fn(handle,
                                     uplo,
                                     N,
@@ -310,9 +308,7 @@ void testing_spr2_batched(const Arguments& arg)
                                     incy,
                                     dAp_1.ptr_on_device(),
                                     batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_uplo, e_N, e_alpha, e_incx, e_incy, e_batch_count>{}.log_args<T>(
             rocblas_cout,
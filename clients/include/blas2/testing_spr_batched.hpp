@@ -224,6 +224,7 @@ void testing_spr_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
         {
             cblas_spr<T>(uplo, N, h_alpha, hx[b], incx, hAp_gold[b]);
@@ -279,10 +280,7 @@ void testing_spr_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_spr_batched_fn(handle,
                                    uplo,
                                    N,
@@ -291,9 +289,7 @@ void testing_spr_batched(const Arguments& arg)
                                    incx,
                                    dAp_1.ptr_on_device(),
                                    batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_uplo, e_N, e_alpha, e_incx, e_batch_count>{}.log_args<T>(
             rocblas_cout,
@@ -378,6 +378,7 @@ void testing_symv_batched(const Arguments& arg)
         cpu_time_used = get_time_us_no_sync();
 
         // cpu reference
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
         {
             cblas_symv<T>(uplo, N, alpha[0], hA[b], lda, hx[b], incx, beta[0], hy_gold[b], incy);
@@ -435,10 +436,7 @@ void testing_symv_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             CHECK_ROCBLAS_ERROR(rocblas_symv_batched_fn(handle,
                                                         uplo,
                                                         N,
@@ -451,9 +449,7 @@ void testing_symv_batched(const Arguments& arg)
                                                         dy.ptr_on_device(),
                                                         incy,
                                                         batch_count));
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_uplo, e_N, e_alpha, e_lda, e_incx, e_beta, e_incy, e_batch_count>{}
             .log_args<T>(rocblas_cout,
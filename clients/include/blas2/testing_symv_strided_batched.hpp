@@ -439,6 +439,7 @@ void testing_symv_strided_batched(const Arguments& arg)
         // cpu reference
         cpu_time_used = get_time_us_no_sync();
 
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
         {
             cblas_symv<T>(uplo, N, alpha[0], hA[b], lda, hx[b], incx, beta[0], hy_gold[b], incy);
@@ -502,10 +503,7 @@ void testing_symv_strided_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             CHECK_ROCBLAS_ERROR(rocblas_symv_strided_batched_fn(handle,
                                                                 uplo,
                                                                 N,
@@ -521,9 +519,7 @@ void testing_symv_strided_batched(const Arguments& arg)
                                                                 incy,
                                                                 stridey,
                                                                 batch_count));
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         Arguments targ(arg);
         targ.stride_a = strideA;
@@ -244,6 +244,7 @@ void testing_syr_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
         {
             cblas_syr<T>(uplo, N, h_alpha, hx[b], incx, hA_gold[b], lda);
@@ -297,10 +298,7 @@ void testing_syr_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_syr_batched_fn(handle,
                                    uplo,
                                    N,
@@ -310,9 +308,7 @@ void testing_syr_batched(const Arguments& arg)
                                    dA_1.ptr_on_device(),
                                    lda,
                                    batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_uplo, e_N, e_alpha, e_lda, e_incx, e_batch_count>{}.log_args<T>(
             rocblas_cout,
@@ -273,6 +273,7 @@ void testing_syr_strided_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
         {
             cblas_syr<T>(uplo, N, h_alpha, hx[b], incx, hA_gold[b], lda);
@@ -321,15 +322,10 @@ void testing_syr_strided_batched(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_syr_strided_batched_fn(
                 handle, uplo, N, &h_alpha, dx, incx, stride_x, dA_1, lda, stride_A, batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         Arguments targ(arg);
         targ.stride_a = stride_A;
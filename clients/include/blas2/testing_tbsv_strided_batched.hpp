@@ -359,6 +359,7 @@ void testing_tbsv_strided_batched(const Arguments& arg)
         cpu_time_used = get_time_us_no_sync();
 
         if(arg.norm_check)
+#pragma omp parallel for
             for(int b = 0; b < batch_count; b++)
                 cblas_tbsv<T>(uplo, transA, diag, N, K, hAb[b], lda, cpu_x_or_b[b], incx);
 
@@ -182,6 +182,7 @@ void testing_tpmv_strided_batched(const Arguments& arg)
         // CPU BLAS
         {
             cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
             for(rocblas_int b = 0; b < batch_count; ++b)
             {
                 cblas_tpmv<T>(uplo, transA, diag, M, hAp[b], hx[b], incx);
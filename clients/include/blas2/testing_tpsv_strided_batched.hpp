@@ -306,6 +306,7 @@ void testing_tpsv_strided_batched(const Arguments& arg)
         cpu_time_used = get_time_us_no_sync();
 
         if(arg.norm_check)
+#pragma omp parallel for
             for(int b = 0; b < batch_count; b++)
                 cblas_tpsv<T>(uplo, transA, diag, N, hAp[b], cpu_x_or_b[b], incx);
 
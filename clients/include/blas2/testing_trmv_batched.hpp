@@ -177,6 +177,7 @@ void testing_trmv_batched(const Arguments& arg)
         // CPU BLAS
         {
             cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
             for(rocblas_int batch_index = 0; batch_index < batch_count; ++batch_index)
             {
                 cblas_trmv<T>(uplo, transA, diag, M, hA[batch_index], lda, hx[batch_index], incx);
@@ -347,6 +347,7 @@ void testing_trsv_batched(const Arguments& arg)
         cpu_time_used = get_time_us_no_sync();
 
         if(arg.norm_check)
+#pragma omp parallel for
             for(int b = 0; b < batch_count; b++)
                 cblas_trsv<T>(uplo, transA, diag, M, hA[b], lda, cpu_x_or_b[b], incx);
 
@@ -183,6 +183,7 @@ void testing_dgmm_batched(const Arguments& arg)
         // reference calculation for golden result
         cpu_time_used = get_time_us_no_sync();
 
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
             cblas_dgmm<T>(side, M, N, hA[b], lda, hx[b], incx, hC_gold[b], ldc);
 
@@ -0,0 +1,728 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas-distributed.h"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <cmath>
+#include <thread>
+#include <vector>
+
+// The distributed functions are in the optional rocblas-distributed library, without Fortran
+// bindings
+
+// dist_gemm
+template <typename T>
+static rocblas_status (*rocblas_dist_gemm)(rocblas_handle    handle,
+                                           rocblas_dist_grid grid,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           rocblas_int       mb,
+                                           rocblas_int       nb,
+                                           rocblas_int       kb,
+                                           const T*          alpha,
+                                           const T*          A,
+                                           rocblas_int       lda,
+                                           const T*          B,
+                                           rocblas_int       ldb,
+                                           const T*          beta,
+                                           T*                C,
+                                           rocblas_int       ldc);
+
+template <>
+static auto rocblas_dist_gemm<float> = rocblas_dist_sgemm;
+template <>
+static auto rocblas_dist_gemm<double> = rocblas_dist_dgemm;
+template <>
+static auto rocblas_dist_gemm<rocblas_float_complex> = rocblas_dist_cgemm;
+template <>
+static auto rocblas_dist_gemm<rocblas_double_complex> = rocblas_dist_zgemm;
+
+// dist_syrk
+template <typename T>
+static rocblas_status (*rocblas_dist_syrk)(rocblas_handle    handle,
+                                           rocblas_dist_grid grid,
+                                           rocblas_fill      uplo,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           rocblas_int       nb,
+                                           rocblas_int       kb,
+                                           const T*          alpha,
+                                           const T*          A,
+                                           rocblas_int       lda,
+                                           const T*          beta,
+                                           T*                C,
+                                           rocblas_int       ldc);
+
+template <>
+static auto rocblas_dist_syrk<float> = rocblas_dist_ssyrk;
+template <>
+static auto rocblas_dist_syrk<double> = rocblas_dist_dsyrk;
+template <>
+static auto rocblas_dist_syrk<rocblas_float_complex> = rocblas_dist_csyrk;
+template <>
+static auto rocblas_dist_syrk<rocblas_double_complex> = rocblas_dist_zsyrk;
+
+// Block sizes of the checks: smaller than and not dividing the matrices, and larger than them.
+// The timing uses the last one.
+static constexpr rocblas_int rocblas_dist_blocks[][3] = {{4, 3, 5}, {16, 16, 8}, {64, 64, 64}};
+static constexpr size_t      rocblas_dist_num_blocks  = 3;
+
+// A global matrix distributed in blocks of mb x nb over a grid of nprow x npcol processes
+struct rocblas_dist_layout
+{
+    rocblas_int mb, nb, nprow, npcol;
+
+    // Global row or column of local row or column i of process p of np, in blocks of b
+    static size_t global(rocblas_int i, rocblas_int b, rocblas_int p, rocblas_int np)
+    {
+        return size_t(i / b) * np * b + size_t(p) * b + i % b;
+    }
+
+    // Copies between the global matrix g with leading dimension ldg and the local matrix l of
+    // process (pr, pc) with rows x cols elements and a leading dimension of rows
+    template <bool TO_LOCAL, typename T>
+    void copy(T*          g,
+              size_t      ldg,
+              T*          l,
+              rocblas_int rows,
+              rocblas_int cols,
+              rocblas_int pr,
+              rocblas_int pc) const
+    {
+        for(rocblas_int j = 0; j < cols; j++)
+            for(rocblas_int i = 0; i < rows; i++)
+            {
+                T& gv = g[global(i, mb, pr, nprow) + global(j, nb, pc, npcol) * ldg];
+                T& lv = l[i + size_t(j) * rows];
+                if(TO_LOCAL)
+                    lv = gv;
+                else
+                    gv = lv;
+            }
+    }
+};
+
+// Side of the largest square grid of the devices, one process per device
+inline rocblas_int rocblas_dist_grid_side()
+{
+    int count;
+    CHECK_HIP_ERROR(hipGetDeviceCount(&count));
+    return std::max(std::min(rocblas_int(std::sqrt(double(count))), 8), 1);
+}
+
+// Local size of n elements in blocks of b on process q of p
+inline rocblas_int rocblas_dist_local(rocblas_int n, rocblas_int b, rocblas_int q, rocblas_int p)
+{
+    rocblas_int size = 0;
+    EXPECT_ROCBLAS_STATUS(rocblas_dist_local_size(n, b, q, p, &size), rocblas_status_success);
+    return size;
+}
+
+// Runs work(r, c, handle, grid) for every process of a p x p grid, the process at row r and
+// column c being a thread on device r * p + c with its own handle and RCCL communicators
+template <typename F>
+void rocblas_dist_run_grid(rocblas_int p, F work)
+{
+    std::vector<ncclUniqueId> row_id(p), col_id(p);
+    for(rocblas_int q = 0; q < p; q++)
+    {
+        ASSERT_EQ(ncclGetUniqueId(&row_id[q]), ncclSuccess);
+        ASSERT_EQ(ncclGetUniqueId(&col_id[q]), ncclSuccess);
+    }
+
+    std::vector<std::thread> threads;
+    for(rocblas_int r = 0; r < p; r++)
+        for(rocblas_int c = 0; c < p; c++)
+            threads.emplace_back([&, r, c] {
+                CHECK_HIP_ERROR(hipSetDevice(r * p + c));
+
+                ncclComm_t row_comm, col_comm;
+                EXPECT_EQ(ncclCommInitRank(&row_comm, p, row_id[r], c), ncclSuccess);
+                EXPECT_EQ(ncclCommInitRank(&col_comm, p, col_id[c], r), ncclSuccess);
+
+                rocblas_local_handle handle;
+                rocblas_dist_grid    grid;
+                EXPECT_ROCBLAS_STATUS(rocblas_dist_grid_create(&grid, p, p, row_comm, col_comm),
+                                      rocblas_status_success);
+
+                work(r, c, handle, grid);
+
+                EXPECT_ROCBLAS_STATUS(rocblas_dist_grid_destroy(grid), rocblas_status_success);
+                EXPECT_EQ(ncclCommDestroy(row_comm), ncclSuccess);
+                EXPECT_EQ(ncclCommDestroy(col_comm), ncclSuccess);
+            });
+    for(auto& t : threads)
+        t.join();
+}
+
+template <typename T>
+void testing_dist_gemm_bad_arg(const Arguments& arg)
+{
+    const rocblas_int M   = 100;
+    const rocblas_int N   = 100;
+    const rocblas_int K   = 100;
+    const rocblas_int mb  = 32;
+    const rocblas_int nb  = 32;
+    const rocblas_int kb  = 32;
+    const rocblas_int lda = 100;
+    const rocblas_int ldb = 100;
+    const rocblas_int ldc = 100;
+
+    auto bad_arg = [&](rocblas_int, rocblas_int, rocblas_handle handle, rocblas_dist_grid grid) {
+        // Allocate device memory
+        device_matrix<T> dA(M, K, lda);
+        device_matrix<T> dB(K, N, ldb);
+        device_matrix<T> dC(M, N, ldc);
+        device_vector<T> alpha_d(1), beta_d(1), zero_d(1);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC.memcheck());
+        CHECK_DEVICE_ALLOCATION(alpha_d.memcheck());
+        CHECK_DEVICE_ALLOCATION(beta_d.memcheck());
+        CHECK_DEVICE_ALLOCATION(zero_d.memcheck());
+
+        const T alpha_h(1), beta_h(1), zero_h(0);
+
+        for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+            const T* alpha = &alpha_h;
+            const T* beta  = &beta_h;
+            const T* zero  = &zero_h;
+            if(pointer_mode == rocblas_pointer_mode_device)
+            {
+                CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(beta_d, beta, sizeof(*beta), hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+                alpha = alpha_d;
+                beta  = beta_d;
+                zero  = zero_d;
+            }
+
+            // clang-format off
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(nullptr, grid, M, N, K, mb, nb, kb, alpha, dA, lda, dB, ldb, beta, dC, ldc), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, nullptr, M, N, K, mb, nb, kb, alpha, dA, lda, dB, ldb, beta, dC, ldc), rocblas_status_invalid_pointer);
+
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, grid, -1, N, K, mb, nb, kb, alpha, dA, lda, dB, ldb, beta, dC, ldc), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, grid, M, -1, K, mb, nb, kb, alpha, dA, lda, dB, ldb, beta, dC, ldc), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, grid, M, N, -1, mb, nb, kb, alpha, dA, lda, dB, ldb, beta, dC, ldc), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, grid, M, N, K, 0, nb, kb, alpha, dA, lda, dB, ldb, beta, dC, ldc), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, grid, M, N, K, mb, 0, kb, alpha, dA, lda, dB, ldb, beta, dC, ldc), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, grid, M, N, K, mb, nb, 0, alpha, dA, lda, dB, ldb, beta, dC, ldc), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, grid, M, N, K, mb, nb, kb, alpha, dA, M - 1, dB, ldb, beta, dC, ldc), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, grid, M, N, K, mb, nb, kb, alpha, dA, lda, dB, K - 1, beta, dC, ldc), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, grid, M, N, K, mb, nb, kb, alpha, dA, lda, dB, ldb, beta, dC, M - 1), rocblas_status_invalid_size);
+
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, grid, M, N, K, mb, nb, kb, nullptr, dA, lda, dB, ldb, beta, dC, ldc), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, grid, M, N, K, mb, nb, kb, alpha, nullptr, lda, dB, ldb, beta, dC, ldc), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, grid, M, N, K, mb, nb, kb, alpha, dA, lda, nullptr, ldb, beta, dC, ldc), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, grid, M, N, K, mb, nb, kb, alpha, dA, lda, dB, ldb, nullptr, dC, ldc), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, grid, M, N, K, mb, nb, kb, alpha, dA, lda, dB, ldb, beta, nullptr, ldc), rocblas_status_invalid_pointer);
+
+// If M or N is 0, the pointers are not checked
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, grid, 0, N, K, mb, nb, kb, nullptr, nullptr, lda, nullptr, ldb, nullptr, nullptr, ldc), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, grid, M, 0, K, mb, nb, kb, nullptr, nullptr, lda, nullptr, ldb, nullptr, nullptr, ldc), rocblas_status_success);
+
+// If alpha is 0, A and B are not referenced
+EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(handle, grid, M, N, K, mb, nb, kb, zero, nullptr, lda, nullptr, ldb, beta, dC, ldc), rocblas_status_success);
+            // clang-format on
+        }
+    };
+
+    // A grid of one process
+    rocblas_dist_run_grid(1, bad_arg);
+}
+
+template <typename T>
+void testing_dist_syrk_bad_arg(const Arguments& arg)
+{
+    const rocblas_fill uplo     = rocblas_fill_lower;
+    const rocblas_fill bad_uplo = rocblas_fill_full;
+    const rocblas_int  N        = 100;
+    const rocblas_int  K        = 100;
+    const rocblas_int  nb       = 32;
+    const rocblas_int  kb       = 32;
+    const rocblas_int  lda      = 100;
+    const rocblas_int  ldc      = 100;
+
+    auto bad_arg = [&](rocblas_int, rocblas_int, rocblas_handle handle, rocblas_dist_grid grid) {
+        // Allocate device memory
+        device_matrix<T> dA(N, K, lda);
+        device_matrix<T> dC(N, N, ldc);
+        device_vector<T> alpha_d(1), beta_d(1), zero_d(1);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC.memcheck());
+        CHECK_DEVICE_ALLOCATION(alpha_d.memcheck());
+        CHECK_DEVICE_ALLOCATION(beta_d.memcheck());
+        CHECK_DEVICE_ALLOCATION(zero_d.memcheck());
+
+        const T alpha_h(1), beta_h(1), zero_h(0);
+
+        for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+            const T* alpha = &alpha_h;
+            const T* beta  = &beta_h;
+            const T* zero  = &zero_h;
+            if(pointer_mode == rocblas_pointer_mode_device)
+            {
+                CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(beta_d, beta, sizeof(*beta), hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+                alpha = alpha_d;
+                beta  = beta_d;
+                zero  = zero_d;
+            }
+
+            // clang-format off
+EXPECT_ROCBLAS_STATUS(rocblas_dist_syrk<T>(nullptr, grid, uplo, N, K, nb, kb, alpha, dA, lda, beta, dC, ldc), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_syrk<T>(handle, nullptr, uplo, N, K, nb, kb, alpha, dA, lda, beta, dC, ldc), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_syrk<T>(handle, grid, bad_uplo, N, K, nb, kb, alpha, dA, lda, beta, dC, ldc), rocblas_status_invalid_value);
+
+EXPECT_ROCBLAS_STATUS(rocblas_dist_syrk<T>(handle, grid, uplo, -1, K, nb, kb, alpha, dA, lda, beta, dC, ldc), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_syrk<T>(handle, grid, uplo, N, -1, nb, kb, alpha, dA, lda, beta, dC, ldc), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_syrk<T>(handle, grid, uplo, N, K, 0, kb, alpha, dA, lda, beta, dC, ldc), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_syrk<T>(handle, grid, uplo, N, K, nb, 0, alpha, dA, lda, beta, dC, ldc), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_syrk<T>(handle, grid, uplo, N, K, nb, kb, alpha, dA, N - 1, beta, dC, ldc), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_syrk<T>(handle, grid, uplo, N, K, nb, kb, alpha, dA, lda, beta, dC, N - 1), rocblas_status_invalid_size);
+
+EXPECT_ROCBLAS_STATUS(rocblas_dist_syrk<T>(handle, grid, uplo, N, K, nb, kb, nullptr, dA, lda, beta, dC, ldc), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_syrk<T>(handle, grid, uplo, N, K, nb, kb, alpha, nullptr, lda, beta, dC, ldc), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_syrk<T>(handle, grid, uplo, N, K, nb, kb, alpha, dA, lda, nullptr, dC, ldc), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_dist_syrk<T>(handle, grid, uplo, N, K, nb, kb, alpha, dA, lda, beta, nullptr, ldc), rocblas_status_invalid_pointer);
+
+// If N is 0, the pointers are not checked
+EXPECT_ROCBLAS_STATUS(rocblas_dist_syrk<T>(handle, grid, uplo, 0, K, nb, kb, nullptr, nullptr, lda, nullptr, nullptr, ldc), rocblas_status_success);
+
+// If alpha is 0, A is not referenced
+EXPECT_ROCBLAS_STATUS(rocblas_dist_syrk<T>(handle, grid, uplo, N, K, nb, kb, zero, nullptr, lda, beta, dC, ldc), rocblas_status_success);
+            // clang-format on
+        }
+    };
+
+    // A grid of one process
+    rocblas_dist_run_grid(1, bad_arg);
+}
+
+// dist_gemm on the largest square grid of the devices must match the host GEMM of the global
+// matrices, for each block size and with alpha and beta on the host and on the device
+template <typename T>
+void testing_dist_gemm(const Arguments& arg)
+{
+    const rocblas_int M = arg.M;
+    const rocblas_int N = arg.N;
+    const rocblas_int K = arg.K;
+    const rocblas_int p = rocblas_dist_grid_side();
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0;
+    if(invalid_size || !M || !N)
+    {
+        const rocblas_int ld = std::max({M, N, K, 1});
+        auto quick_return = [&](rocblas_int, rocblas_int, rocblas_handle h, rocblas_dist_grid g) {
+            EXPECT_ROCBLAS_STATUS(rocblas_dist_gemm<T>(h,
+                                                       g,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       1,
+                                                       1,
+                                                       1,
+                                                       nullptr,
+                                                       nullptr,
+                                                       ld,
+                                                       nullptr,
+                                                       ld,
+                                                       nullptr,
+                                                       nullptr,
+                                                       ld),
+                                  invalid_size ? rocblas_status_invalid_size
+                                               : rocblas_status_success);
+        };
+        rocblas_dist_run_grid(p, quick_return);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory for the global matrices
+    host_matrix<T> hA(M, K, M);
+    host_matrix<T> hB(K, N, K);
+    host_matrix<T> hC(M, N, M);
+    host_matrix<T> hC_1(M, N, M);
+    host_matrix<T> hC_2(M, N, M);
+    host_matrix<T> hC_gold(M, N, M);
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+    hC_gold = hC;
+
+    double              gpu_time_used = 0.0, cpu_time_used = 0.0;
+    double              rocblas_error_1 = 0.0;
+    double              rocblas_error_2 = 0.0;
+    std::vector<double> process_time(p * p);
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+        cblas_gemm<T>(rocblas_operation_none,
+                      rocblas_operation_none,
+                      M,
+                      N,
+                      K,
+                      h_alpha,
+                      hA,
+                      M,
+                      hB,
+                      K,
+                      h_beta,
+                      hC_gold,
+                      M);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+    }
+
+    for(size_t b = 0; b < rocblas_dist_num_blocks; b++)
+    {
+        const rocblas_int mb         = rocblas_dist_blocks[b][0];
+        const rocblas_int nb         = rocblas_dist_blocks[b][1];
+        const rocblas_int kb         = rocblas_dist_blocks[b][2];
+        const bool        time_block = arg.timing && b + 1 == rocblas_dist_num_blocks;
+        if(!(arg.unit_check || arg.norm_check) && !time_block)
+            continue;
+
+        auto process = [&](rocblas_int       r,
+                           rocblas_int       c,
+                           rocblas_handle    handle,
+                           rocblas_dist_grid grid) {
+            // Local sizes of the rows and columns of C, of the columns of A and of the rows of B
+            const rocblas_int mloc   = rocblas_dist_local(M, mb, r, p);
+            const rocblas_int nloc   = rocblas_dist_local(N, nb, c, p);
+            const rocblas_int kloc_a = rocblas_dist_local(K, kb, c, p);
+            const rocblas_int kloc_b = rocblas_dist_local(K, kb, r, p);
+            const rocblas_int lda    = std::max(mloc, 1);
+            const rocblas_int ldb    = std::max(kloc_b, 1);
+            const rocblas_int ldc    = std::max(mloc, 1);
+
+            const rocblas_dist_layout layout_a{mb, kb, p, p};
+            const rocblas_dist_layout layout_b{kb, nb, p, p};
+            const rocblas_dist_layout layout_c{mb, nb, p, p};
+
+            host_vector<T> lA(size_t(mloc) * kloc_a);
+            host_vector<T> lB(size_t(kloc_b) * nloc);
+            host_vector<T> lC(size_t(mloc) * nloc);
+            layout_a.copy<true>((T*)hA, M, (T*)lA, mloc, kloc_a, r, c);
+            layout_b.copy<true>((T*)hB, K, (T*)lB, kloc_b, nloc, r, c);
+            layout_c.copy<true>((T*)hC, M, (T*)lC, mloc, nloc, r, c);
+
+            device_vector<T> dA(std::max<size_t>(lA.size(), 1));
+            device_vector<T> dB(std::max<size_t>(lB.size(), 1));
+            device_vector<T> dC(std::max<size_t>(lC.size(), 1));
+            device_vector<T> d_alpha(1), d_beta(1);
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB.memcheck());
+            CHECK_DEVICE_ALLOCATION(dC.memcheck());
+            CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+            CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+            auto to_device = [](T* dst, const T* src, size_t size) {
+                CHECK_HIP_ERROR(hipMemcpy(dst, src, size * sizeof(T), hipMemcpyHostToDevice));
+            };
+            auto to_host = [](T* dst, const T* src, size_t size) {
+                CHECK_HIP_ERROR(hipMemcpy(dst, src, size * sizeof(T), hipMemcpyDeviceToHost));
+            };
+            to_device(dA, lA, lA.size());
+            to_device(dB, lB, lB.size());
+            to_device(dC, lC, lC.size());
+            to_device(d_alpha, &h_alpha, 1);
+            to_device(d_beta, &h_beta, 1);
+
+            auto dist_gemm = [&](const T* alpha, const T* beta) {
+                return rocblas_dist_gemm<T>(
+                    handle, grid, M, N, K, mb, nb, kb, alpha, dA, lda, dB, ldb, beta, dC, ldc);
+            };
+
+            if(arg.unit_check || arg.norm_check)
+            {
+                // GPU BLAS, rocblas_pointer_mode_host
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+                CHECK_ROCBLAS_ERROR(dist_gemm(&h_alpha, &h_beta));
+                to_host(lC, dC, lC.size());
+                layout_c.copy<false>((T*)hC_1, M, (T*)lC, mloc, nloc, r, c);
+
+                // GPU BLAS, rocblas_pointer_mode_device
+                layout_c.copy<true>((T*)hC, M, (T*)lC, mloc, nloc, r, c);
+                to_device(dC, lC, lC.size());
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+                CHECK_ROCBLAS_ERROR(dist_gemm(d_alpha, d_beta));
+                to_host(lC, dC, lC.size());
+                layout_c.copy<false>((T*)hC_2, M, (T*)lC, mloc, nloc, r, c);
+            }
+
+            if(time_block)
+            {
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+                auto dist_gemm_host = [&] { dist_gemm(&h_alpha, &h_beta); };
+                for(int iter = 0; iter < arg.cold_iters; iter++)
+                    dist_gemm_host();
+
+                hipStream_t stream;
+                CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+                process_time[r * p + c]
+                    = get_time_us_hot_calls(stream, arg.iters, dist_gemm_host);
+            }
+        };
+
+        rocblas_dist_run_grid(p, process);
+
+        if(arg.unit_check || arg.norm_check)
+        {
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(M, N, M, hC_gold, hC_1);
+                unit_check_general<T>(M, N, M, hC_gold, hC_2);
+            }
+
+            if(arg.norm_check)
+            {
+                rocblas_error_1
+                    = std::max(rocblas_error_1, norm_check_general<T>('F', M, N, M, hC_gold, hC_1));
+                rocblas_error_2
+                    = std::max(rocblas_error_2, norm_check_general<T>('F', M, N, M, hC_gold, hC_2));
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        // The processes synchronize through the broadcasts, so the grid takes the longest time
+        gpu_time_used = *std::max_element(process_time.begin(), process_time.end());
+
+        ArgumentModel<e_M, e_N, e_K, e_alpha, e_beta>{}.log_args<T>(rocblas_cout,
+                                                                     arg,
+                                                                     gpu_time_used,
+                                                                     gemm_gflop_count<T>(M, N, K),
+                                                                     gemm_gbyte_count<T>(M, N, K),
+                                                                     cpu_time_used,
+                                                                     rocblas_error_1,
+                                                                     rocblas_error_2);
+    }
+}
+
+// dist_syrk on the largest square grid of the devices must match the host SYRK of the global
+// matrices, for each block size and with alpha and beta on the host and on the device
+template <typename T>
+void testing_dist_syrk(const Arguments& arg)
+{
+    const rocblas_fill uplo = char2rocblas_fill(arg.uplo);
+    const rocblas_int  N    = arg.N;
+    const rocblas_int  K    = arg.K;
+    const rocblas_int  p    = rocblas_dist_grid_side();
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = N < 0 || K < 0;
+    if(invalid_size || !N)
+    {
+        const rocblas_int ld = std::max(N, 1);
+        auto quick_return = [&](rocblas_int, rocblas_int, rocblas_handle h, rocblas_dist_grid g) {
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_dist_syrk<T>(
+                    h, g, uplo, N, K, 1, 1, nullptr, nullptr, ld, nullptr, nullptr, ld),
+                invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        };
+        rocblas_dist_run_grid(p, quick_return);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory for the global matrices
+    host_matrix<T> hA(N, K, N);
+    host_matrix<T> hC(N, N, N);
+    host_matrix<T> hC_1(N, N, N);
+    host_matrix<T> hC_2(N, N, N);
+    host_matrix<T> hC_gold(N, N, N);
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_symmetric_matrix);
+    hC_gold = hC;
+
+    double              gpu_time_used = 0.0, cpu_time_used = 0.0;
+    double              rocblas_error_1 = 0.0;
+    double              rocblas_error_2 = 0.0;
+    std::vector<double> process_time(p * p);
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+        cblas_syrk<T>(uplo, rocblas_operation_none, N, K, h_alpha, hA, N, h_beta, hC_gold, N);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+    }
+
+    for(size_t b = 0; b < rocblas_dist_num_blocks; b++)
+    {
+        const rocblas_int nb         = rocblas_dist_blocks[b][0];
+        const rocblas_int kb         = rocblas_dist_blocks[b][2];
+        const bool        time_block = arg.timing && b + 1 == rocblas_dist_num_blocks;
+        if(!(arg.unit_check || arg.norm_check) && !time_block)
+            continue;
+
+        auto process = [&](rocblas_int       r,
+                           rocblas_int       c,
+                           rocblas_handle    handle,
+                           rocblas_dist_grid grid) {
+            // Local sizes of the rows and columns of C and of the columns of A
+            const rocblas_int nloc_r = rocblas_dist_local(N, nb, r, p);
+            const rocblas_int nloc_c = rocblas_dist_local(N, nb, c, p);
+            const rocblas_int kloc_a = rocblas_dist_local(K, kb, c, p);
+            const rocblas_int lda    = std::max(nloc_r, 1);
+            const rocblas_int ldc    = std::max(nloc_r, 1);
+
+            const rocblas_dist_layout layout_a{nb, kb, p, p};
+            const rocblas_dist_layout layout_c{nb, nb, p, p};
+
+            host_vector<T> lA(size_t(nloc_r) * kloc_a);
+            host_vector<T> lC(size_t(nloc_r) * nloc_c);
+            layout_a.copy<true>((T*)hA, N, (T*)lA, nloc_r, kloc_a, r, c);
+            layout_c.copy<true>((T*)hC, N, (T*)lC, nloc_r, nloc_c, r, c);
+
+            device_vector<T> dA(std::max<size_t>(lA.size(), 1));
+            device_vector<T> dC(std::max<size_t>(lC.size(), 1));
+            device_vector<T> d_alpha(1), d_beta(1);
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dC.memcheck());
+            CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+            CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+            auto to_device = [](T* dst, const T* src, size_t size) {
+                CHECK_HIP_ERROR(hipMemcpy(dst, src, size * sizeof(T), hipMemcpyHostToDevice));
+            };
+            auto to_host = [](T* dst, const T* src, size_t size) {
+                CHECK_HIP_ERROR(hipMemcpy(dst, src, size * sizeof(T), hipMemcpyDeviceToHost));
+            };
+            to_device(dA, lA, lA.size());
+            to_device(dC, lC, lC.size());
+            to_device(d_alpha, &h_alpha, 1);
+            to_device(d_beta, &h_beta, 1);
+
+            auto dist_syrk = [&](const T* alpha, const T* beta) {
+                return rocblas_dist_syrk<T>(
+                    handle, grid, uplo, N, K, nb, kb, alpha, dA, lda, beta, dC, ldc);
+            };
+
+            if(arg.unit_check || arg.norm_check)
+            {
+                // GPU BLAS, rocblas_pointer_mode_host
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+                CHECK_ROCBLAS_ERROR(dist_syrk(&h_alpha, &h_beta));
+                to_host(lC, dC, lC.size());
+                layout_c.copy<false>((T*)hC_1, N, (T*)lC, nloc_r, nloc_c, r, c);
+
+                // GPU BLAS, rocblas_pointer_mode_device
+                layout_c.copy<true>((T*)hC, N, (T*)lC, nloc_r, nloc_c, r, c);
+                to_device(dC, lC, lC.size());
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+                CHECK_ROCBLAS_ERROR(dist_syrk(d_alpha, d_beta));
+                to_host(lC, dC, lC.size());
+                layout_c.copy<false>((T*)hC_2, N, (T*)lC, nloc_r, nloc_c, r, c);
+            }
+
+            if(time_block)
+            {
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+                auto dist_syrk_host = [&] { dist_syrk(&h_alpha, &h_beta); };
+                for(int iter = 0; iter < arg.cold_iters; iter++)
+                    dist_syrk_host();
+
+                hipStream_t stream;
+                CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+                process_time[r * p + c]
+                    = get_time_us_hot_calls(stream, arg.iters, dist_syrk_host);
+            }
+        };
+
+        rocblas_dist_run_grid(p, process);
+
+        // The triangle of C which is not referenced must be unchanged, so all of C is checked
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(N, N, N, hC_gold, hC_1);
+            unit_check_general<T>(N, N, N, hC_gold, hC_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1
+                = std::max(rocblas_error_1, norm_check_general<T>('F', N, N, N, hC_gold, hC_1));
+            rocblas_error_2
+                = std::max(rocblas_error_2, norm_check_general<T>('F', N, N, N, hC_gold, hC_2));
+        }
+    }
+
+    if(arg.timing)
+    {
+        // The processes synchronize through the broadcasts, so the grid takes the longest time
+        gpu_time_used = *std::max_element(process_time.begin(), process_time.end());
+
+        ArgumentModel<e_uplo, e_N, e_K, e_alpha, e_beta>{}.log_args<T>(rocblas_cout,
+                                                                        arg,
+                                                                        gpu_time_used,
+                                                                        syrk_gflop_count<T>(N, K),
+                                                                        syrk_gbyte_count<T>(N, K),
+                                                                        cpu_time_used,
+                                                                        rocblas_error_1,
+                                                                        rocblas_error_2);
+    }
+}
@@ -0,0 +1,389 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <vector>
+
+// geam_multi is a beta feature without Fortran bindings
+template <typename T>
+static rocblas_status (*rocblas_geam_multi)(rocblas_handle           handle,
+                                            rocblas_int              m,
+                                            rocblas_int              n,
+                                            rocblas_int              count,
+                                            const rocblas_operation* trans,
+                                            const T*                 alpha,
+                                            const T* const           A[],
+                                            const rocblas_int*       lda,
+                                            T*                       C,
+                                            rocblas_int              ldc);
+
+template <>
+static auto rocblas_geam_multi<float> = rocblas_sgeam_multi;
+template <>
+static auto rocblas_geam_multi<double> = rocblas_dgeam_multi;
+template <>
+static auto rocblas_geam_multi<rocblas_float_complex> = rocblas_cgeam_multi;
+template <>
+static auto rocblas_geam_multi<rocblas_double_complex> = rocblas_zgeam_multi;
+
+template <typename T>
+void testing_geam_multi_bad_arg(const Arguments& arg)
+{
+    auto rocblas_geam_multi_fn = rocblas_geam_multi<T>;
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const rocblas_int M   = 100;
+        const rocblas_int N   = 80;
+        const rocblas_int K   = 3;
+        const rocblas_int ldc = 100;
+
+        // A_0, A_1**T and C
+        std::vector<rocblas_operation> trans
+            = {rocblas_operation_none, rocblas_operation_transpose, rocblas_operation_none};
+        std::vector<rocblas_int> lda = {M, N, ldc};
+
+        device_vector<T> alpha_d(K), zero_d(K);
+
+        host_vector<T> alpha_h(K), zero_h(K);
+        for(rocblas_int i = 0; i < K; i++)
+        {
+            alpha_h[i] = T(1);
+            zero_h[i]  = T(0);
+        }
+
+        const T* alpha = alpha_h;
+        const T* zero  = zero_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(alpha_d.transfer_from(alpha_h));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(zero_d.transfer_from(zero_h));
+            zero = zero_d;
+        }
+
+        // Allocate device memory
+        device_vector<T> dA_0(size_t(M) * N);
+        device_vector<T> dA_1(size_t(N) * M);
+        device_vector<T> dC(size_t(ldc) * N);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dA_0.memcheck());
+        CHECK_DEVICE_ALLOCATION(dA_1.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+        std::vector<const T*> A = {dA_0, dA_1, dC};
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_geam_multi_fn(
+                nullptr, M, N, K, trans.data(), alpha, A.data(), lda.data(), dC, ldc),
+            rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_geam_multi_fn(
+                handle, -1, N, K, trans.data(), alpha, A.data(), lda.data(), dC, ldc),
+            rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_geam_multi_fn(
+                handle, M, N, -1, trans.data(), alpha, A.data(), lda.data(), dC, ldc),
+            rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_geam_multi_fn(
+                handle, M, N, K, trans.data(), alpha, A.data(), lda.data(), dC, M - 1),
+            rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_geam_multi_fn(handle, M, N, K, nullptr, alpha, A.data(), lda.data(), dC, ldc),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_geam_multi_fn(
+                handle, M, N, K, trans.data(), alpha, nullptr, lda.data(), dC, ldc),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_geam_multi_fn(handle, M, N, K, trans.data(), alpha, A.data(), nullptr, dC, ldc),
+            rocblas_status_invalid_pointer);
+
+        std::vector<rocblas_operation> bad_trans = trans;
+        bad_trans[0]                             = (rocblas_operation)rocblas_fill_full;
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_geam_multi_fn(
+                handle, M, N, K, bad_trans.data(), alpha, A.data(), lda.data(), dC, ldc),
+            rocblas_status_invalid_value);
+
+        // lda_1 of the transposed A_1 is checked against N
+        std::vector<rocblas_int> bad_lda = lda;
+        bad_lda[1]                       = N - 1;
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_geam_multi_fn(
+                handle, M, N, K, trans.data(), alpha, A.data(), bad_lda.data(), dC, ldc),
+            rocblas_status_invalid_size);
+
+        // C may only be an operand if it is not transposed and has lda_i == ldc
+        bad_trans    = trans;
+        bad_trans[2] = rocblas_operation_transpose;
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_geam_multi_fn(
+                handle, M, N, K, bad_trans.data(), alpha, A.data(), lda.data(), dC, ldc),
+            rocblas_status_invalid_size);
+        bad_lda    = lda;
+        bad_lda[2] = ldc + 1;
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_geam_multi_fn(
+                handle, M, N, K, trans.data(), alpha, A.data(), bad_lda.data(), dC, ldc),
+            rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_geam_multi_fn(
+                handle, M, N, K, trans.data(), nullptr, A.data(), lda.data(), dC, ldc),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_geam_multi_fn(
+                handle, M, N, K, trans.data(), alpha, A.data(), lda.data(), nullptr, ldc),
+            rocblas_status_invalid_pointer);
+
+        // The operands are only checked when their scalars are on the host
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            std::vector<const T*> null_A = {dA_0, nullptr, dC};
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_geam_multi_fn(
+                    handle, M, N, K, trans.data(), alpha, null_A.data(), lda.data(), dC, ldc),
+                rocblas_status_invalid_pointer);
+
+            // Operands with a zero scalar are not dereferenced
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_geam_multi_fn(
+                    handle, M, N, K, trans.data(), zero, null_A.data(), lda.data(), dC, ldc),
+                rocblas_status_success);
+        }
+
+        // If M is 0, the scalars, operands and C are not dereferenced
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_geam_multi_fn(
+                handle, 0, N, K, trans.data(), nullptr, A.data(), lda.data(), nullptr, ldc),
+            rocblas_status_success);
+    }
+}
+
+// The K operands cycle through A_i, A_i**T and A_i**H, each with its own lda_i, and for K > 1
+// the last of them is C itself. K <= 8 takes one pass over C and larger K several. The scalars
+// are initialized like the matrices, with alpha_1 zero so that zero operands are skipped
+// correctly, or are all zero when alpha is 0, which sets C to zero.
+template <typename T>
+void testing_geam_multi(const Arguments& arg)
+{
+    auto rocblas_geam_multi_fn = rocblas_geam_multi<T>;
+
+    rocblas_int M   = arg.M;
+    rocblas_int N   = arg.N;
+    rocblas_int K   = arg.K;
+    rocblas_int ldc = arg.ldc;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || ldc < M || ldc < 1;
+    if(invalid_size || !M || !N)
+    {
+        // trans, A and lda are checked before the quick return, so it is reached with count 0
+        rocblas_int count = invalid_size ? K : 0;
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_geam_multi_fn(
+                handle, M, N, count, nullptr, nullptr, nullptr, nullptr, nullptr, ldc),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    const rocblas_operation ops[] = {rocblas_operation_none,
+                                     rocblas_operation_transpose,
+                                     rocblas_operation_conjugate_transpose};
+
+    // The operands other than C are stored one after the other, operand i at offset[i]
+    std::vector<rocblas_operation> trans(K);
+    std::vector<rocblas_int>       lda(K);
+    std::vector<size_t>            offset(K + 1, 0);
+    for(rocblas_int i = 0; i < K; i++)
+    {
+        bool        is_c = K > 1 && i == K - 1;
+        rocblas_int rows = i % 3 == 0 || is_c ? M : N;
+        rocblas_int cols = i % 3 == 0 || is_c ? N : M;
+
+        trans[i]      = is_c ? rocblas_operation_none : ops[i % 3];
+        lda[i]        = is_c ? ldc : rows + i;
+        offset[i + 1] = offset[i] + (is_c ? 0 : size_t(lda[i]) * cols);
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hC_1), `d` is in GPU (device) memory (eg dC_1).
+    // Allocate host memory
+    host_vector<T> hA(std::max(offset[K], size_t(1)));
+    host_vector<T> hC(size_t(ldc) * N);
+    host_vector<T> hC_1(size_t(ldc) * N);
+    host_vector<T> hC_2(size_t(ldc) * N);
+    host_vector<T> hC_gold(size_t(ldc) * N);
+    host_vector<T> halpha(std::max(K, 1));
+
+    // Allocate device memory
+    device_vector<T> dA(hA.size());
+    device_vector<T> dC_1(hC.size());
+    device_vector<T> dC_2(hC.size());
+    device_vector<T> d_alpha(halpha.size());
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    // Initialize data on host memory
+    rocblas_seedrand();
+    rocblas_init(hA, 1, hA.size(), 1);
+    rocblas_init(hC, M, N, ldc);
+    rocblas_init(halpha, 1, halpha.size(), 1);
+    if(K > 2)
+        halpha[1] = T(0);
+    if(arg.alpha == 0 && arg.alphai == 0)
+        for(size_t i = 0; i < halpha.size(); i++)
+            halpha[i] = T(0);
+
+    // Transfer data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dC_1.transfer_from(hC));
+
+    std::vector<const T*> A_1(K), A_2(K);
+    for(rocblas_int i = 0; i < K; i++)
+    {
+        bool is_c = K > 1 && i == K - 1;
+        A_1[i]    = is_c ? (const T*)dC_1 : (const T*)dA + offset[i];
+        A_2[i]    = is_c ? (const T*)dC_2 : (const T*)dA + offset[i];
+    }
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dC_2.transfer_from(hC));
+        CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_geam_multi_fn(
+            handle, M, N, K, trans.data(), halpha, A_1.data(), lda.data(), dC_1, ldc));
+        handle.post_test(arg);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_geam_multi_fn(
+            handle, M, N, K, trans.data(), d_alpha, A_2.data(), lda.data(), dC_2, ldc));
+        handle.post_test(arg);
+
+        // CPU reference
+        cpu_time_used = get_time_us_no_sync();
+
+        hC_gold = hC;
+        for(rocblas_int j = 0; j < N; j++)
+            for(rocblas_int i = 0; i < M; i++)
+            {
+                T sum = T(0);
+                for(rocblas_int l = 0; l < K; l++)
+                {
+                    bool is_c = K > 1 && l == K - 1;
+                    T    a    = is_c ? hC[i + size_t(ldc) * j]
+                              : trans[l] == rocblas_operation_none
+                                  ? hA[offset[l] + i + size_t(lda[l]) * j]
+                                  : hA[offset[l] + j + size_t(lda[l]) * i];
+                    if(trans[l] == rocblas_operation_conjugate_transpose)
+                        a = conj(a);
+                    sum += halpha[l] * a;
+                }
+                hC_gold[i + size_t(ldc) * j] = sum;
+            }
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hC_1.transfer_from(dC_1));
+        CHECK_HIP_ERROR(hC_2.transfer_from(dC_2));
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+            unit_check_general<T>(M, N, ldc, hC_gold, hC_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', M, N, ldc, hC_gold, hC_1);
+            rocblas_error_2 = norm_check_general<T>('F', M, N, ldc, hC_gold, hC_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_geam_multi_fn(
+                handle, M, N, K, trans.data(), halpha, A_1.data(), lda.data(), dC_1, ldc);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_geam_multi_fn(
+                handle, M, N, K, trans.data(), halpha, A_1.data(), lda.data(), dC_1, ldc);
+        });
+
+        ArgumentModel<e_M, e_N, e_K, e_ldc>{}.log_args<T>(rocblas_cout,
+                                                          arg,
+                                                          gpu_time_used,
+                                                          geam_multi_gflop_count<T>(M, N, K),
+                                                          geam_multi_gbyte_count<T>(M, N, K),
+                                                          cpu_time_used,
+                                                          rocblas_error_1,
+                                                          rocblas_error_2);
+    }
+}
@@ -558,6 +558,7 @@ void testing_geam_strided_batched(const Arguments& arg)
         // reference calculation for golden result
         cpu_time_used = get_time_us_no_sync();
 
+#pragma omp parallel for
         for(size_t b = 0; b < batch_count; b++)
         {
             cblas_geam(transA,
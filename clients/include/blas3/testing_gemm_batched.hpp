@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
 #include "near.hpp"
@@ -352,6 +353,7 @@ void testing_gemm_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(rocblas_int b = 0; b < batch_count; b++)
         {
             cblas_gemm<T>(
@@ -462,7 +464,7 @@ void testing_gemm_batched(const Arguments& arg)
                          arg,
                          gpu_time_used,
                          gemm_gflop_count<T>(M, N, K),
-                         ArgumentLogging::NA_value,
+                         gemm_gbyte_count<T>(M, N, K),
                          cpu_time_used,
                          rocblas_error);
     }
@@ -0,0 +1,703 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// gemm_dgmm is a beta feature without Fortran bindings
+template <typename T>
+static rocblas_status (*rocblas_gemm_dgmm)(rocblas_handle    handle,
+                                           rocblas_operation trans_a,
+                                           rocblas_operation trans_b,
+                                           rocblas_side      side,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           const T*          alpha,
+                                           const T*          A,
+                                           rocblas_int       lda,
+                                           const T*          x,
+                                           rocblas_int       incx,
+                                           const T*          B,
+                                           rocblas_int       ldb,
+                                           const T*          beta,
+                                           T*                C,
+                                           rocblas_int       ldc);
+
+template <>
+static auto rocblas_gemm_dgmm<float> = rocblas_sgemm_dgmm;
+template <>
+static auto rocblas_gemm_dgmm<double> = rocblas_dgemm_dgmm;
+template <>
+static auto rocblas_gemm_dgmm<rocblas_float_complex> = rocblas_cgemm_dgmm;
+template <>
+static auto rocblas_gemm_dgmm<rocblas_double_complex> = rocblas_zgemm_dgmm;
+
+template <typename T>
+void testing_gemm_dgmm_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemm_dgmm_fn = rocblas_gemm_dgmm<T>;
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const rocblas_operation transA = rocblas_operation_none;
+        const rocblas_operation transB = rocblas_operation_none;
+        const rocblas_side      side   = rocblas_side_left;
+        const rocblas_int       M      = 100;
+        const rocblas_int       N      = 100;
+        const rocblas_int       K      = 100;
+        const rocblas_int       lda    = 100;
+        const rocblas_int       ldb    = 100;
+        const rocblas_int       ldc    = 100;
+        const rocblas_int       incx   = 1;
+
+        device_vector<T> alpha_d(1), beta_d(1), one_d(1), zero_d(1);
+
+        const T alpha_h(1), beta_h(2), one_h(1), zero_h(0);
+
+        const T* alpha = &alpha_h;
+        const T* beta  = &beta_h;
+        const T* one   = &one_h;
+        const T* zero  = &zero_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(beta_d, beta, sizeof(*beta), hipMemcpyHostToDevice));
+            beta = beta_d;
+            CHECK_HIP_ERROR(hipMemcpy(one_d, one, sizeof(*one), hipMemcpyHostToDevice));
+            one = one_d;
+            CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+            zero = zero_d;
+        }
+
+        // Allocate device memory
+        device_matrix<T> dA(M, K, lda);
+        device_matrix<T> dB(K, N, ldb);
+        device_matrix<T> dC(M, N, ldc);
+        device_vector<T> dx(M, incx);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC.memcheck());
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dgmm_fn(nullptr,
+                                                   transA,
+                                                   transB,
+                                                   side,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   alpha,
+                                                   dA,
+                                                   lda,
+                                                   dx,
+                                                   incx,
+                                                   dB,
+                                                   ldb,
+                                                   beta,
+                                                   dC,
+                                                   ldc),
+                              rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dgmm_fn(handle,
+                                                   (rocblas_operation)rocblas_fill_full,
+                                                   transB,
+                                                   side,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   alpha,
+                                                   dA,
+                                                   lda,
+                                                   dx,
+                                                   incx,
+                                                   dB,
+                                                   ldb,
+                                                   beta,
+                                                   dC,
+                                                   ldc),
+                              rocblas_status_invalid_value);
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dgmm_fn(handle,
+                                                   transA,
+                                                   (rocblas_operation)rocblas_fill_full,
+                                                   side,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   alpha,
+                                                   dA,
+                                                   lda,
+                                                   dx,
+                                                   incx,
+                                                   dB,
+                                                   ldb,
+                                                   beta,
+                                                   dC,
+                                                   ldc),
+                              rocblas_status_invalid_value);
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dgmm_fn(handle,
+                                                   transA,
+                                                   transB,
+                                                   rocblas_side_both,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   alpha,
+                                                   dA,
+                                                   lda,
+                                                   dx,
+                                                   incx,
+                                                   dB,
+                                                   ldb,
+                                                   beta,
+                                                   dC,
+                                                   ldc),
+                              rocblas_status_invalid_value);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dgmm_fn(handle,
+                                                   transA,
+                                                   transB,
+                                                   side,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   alpha,
+                                                   dA,
+                                                   M - 1,
+                                                   dx,
+                                                   incx,
+                                                   dB,
+                                                   ldb,
+                                                   beta,
+                                                   dC,
+                                                   ldc),
+                              rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dgmm_fn(handle,
+                                                   transA,
+                                                   transB,
+                                                   side,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   alpha,
+                                                   dA,
+                                                   lda,
+                                                   dx,
+                                                   incx,
+                                                   dB,
+                                                   K - 1,
+                                                   beta,
+                                                   dC,
+                                                   ldc),
+                              rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dgmm_fn(handle,
+                                                   transA,
+                                                   transB,
+                                                   side,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   alpha,
+                                                   dA,
+                                                   lda,
+                                                   dx,
+                                                   incx,
+                                                   dB,
+                                                   ldb,
+                                                   beta,
+                                                   dC,
+                                                   M - 1),
+                              rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dgmm_fn(handle,
+                                                   transA,
+                                                   transB,
+                                                   side,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   nullptr,
+                                                   dA,
+                                                   lda,
+                                                   dx,
+                                                   incx,
+                                                   dB,
+                                                   ldb,
+                                                   beta,
+                                                   dC,
+                                                   ldc),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dgmm_fn(handle,
+                                                   transA,
+                                                   transB,
+                                                   side,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   alpha,
+                                                   dA,
+                                                   lda,
+                                                   dx,
+                                                   incx,
+                                                   dB,
+                                                   ldb,
+                                                   nullptr,
+                                                   dC,
+                                                   ldc),
+                              rocblas_status_invalid_pointer);
+
+        // The matrices and x are checked in both pointer modes, as they are needed for k > 0
+        // unless alpha is known to be 0
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dgmm_fn(handle,
+                                                   transA,
+                                                   transB,
+                                                   side,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   alpha,
+                                                   nullptr,
+                                                   lda,
+                                                   dx,
+                                                   incx,
+                                                   dB,
+                                                   ldb,
+                                                   beta,
+                                                   dC,
+                                                   ldc),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dgmm_fn(handle,
+                                                   transA,
+                                                   transB,
+                                                   side,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   alpha,
+                                                   dA,
+                                                   lda,
+                                                   nullptr,
+                                                   incx,
+                                                   dB,
+                                                   ldb,
+                                                   beta,
+                                                   dC,
+                                                   ldc),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dgmm_fn(handle,
+                                                   transA,
+                                                   transB,
+                                                   side,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   alpha,
+                                                   dA,
+                                                   lda,
+                                                   dx,
+                                                   incx,
+                                                   nullptr,
+                                                   ldb,
+                                                   beta,
+                                                   dC,
+                                                   ldc),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dgmm_fn(handle,
+                                                   transA,
+                                                   transB,
+                                                   side,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   alpha,
+                                                   dA,
+                                                   lda,
+                                                   dx,
+                                                   incx,
+                                                   dB,
+                                                   ldb,
+                                                   beta,
+                                                   nullptr,
+                                                   ldc),
+                              rocblas_status_invalid_pointer);
+
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            // If alpha is 0, A, x and B are not dereferenced
+            EXPECT_ROCBLAS_STATUS(rocblas_gemm_dgmm_fn(handle,
+                                                       transA,
+                                                       transB,
+                                                       side,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       zero,
+                                                       nullptr,
+                                                       lda,
+                                                       nullptr,
+                                                       incx,
+                                                       nullptr,
+                                                       ldb,
+                                                       beta,
+                                                       dC,
+                                                       ldc),
+                                  rocblas_status_success);
+
+            // If alpha is 0 and beta is 1, C is not dereferenced either
+            EXPECT_ROCBLAS_STATUS(rocblas_gemm_dgmm_fn(handle,
+                                                       transA,
+                                                       transB,
+                                                       side,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       zero,
+                                                       nullptr,
+                                                       lda,
+                                                       nullptr,
+                                                       incx,
+                                                       nullptr,
+                                                       ldb,
+                                                       one,
+                                                       nullptr,
+                                                       ldc),
+                                  rocblas_status_success);
+        }
+
+        // If M is 0, the scalars, matrices and x are not dereferenced
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dgmm_fn(handle,
+                                                   transA,
+                                                   transB,
+                                                   side,
+                                                   0,
+                                                   N,
+                                                   K,
+                                                   nullptr,
+                                                   nullptr,
+                                                   lda,
+                                                   nullptr,
+                                                   incx,
+                                                   nullptr,
+                                                   ldb,
+                                                   nullptr,
+                                                   nullptr,
+                                                   ldc),
+                              rocblas_status_success);
+    }
+}
+
+// gemm_dgmm must match the CPU gemm of diag(x)*op(A) (side left) or op(A)*diag(x) (side right),
+// formed explicitly as an M by K matrix, with op(B)
+template <typename T>
+void testing_gemm_dgmm(const Arguments& arg)
+{
+    auto rocblas_gemm_dgmm_fn = rocblas_gemm_dgmm<T>;
+
+    rocblas_operation transA  = char2rocblas_operation(arg.transA);
+    rocblas_operation transB  = char2rocblas_operation(arg.transB);
+    rocblas_side      side    = char2rocblas_side(arg.side);
+    rocblas_int       M       = arg.M;
+    rocblas_int       N       = arg.N;
+    rocblas_int       K       = arg.K;
+    rocblas_int       lda     = arg.lda;
+    rocblas_int       ldb     = arg.ldb;
+    rocblas_int       ldc     = arg.ldc;
+    rocblas_int       incx    = arg.incx;
+    T                 h_alpha = arg.get_alpha<T>();
+    T                 h_beta  = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : std::max(K, 1);
+    rocblas_int A_col = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : std::max(K, 1);
+    rocblas_int dim_x = side == rocblas_side_left ? M : K;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M
+                        || lda < 1 || ldb < 1 || ldc < 1;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dgmm_fn(handle,
+                                                   transA,
+                                                   transB,
+                                                   side,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   nullptr,
+                                                   nullptr,
+                                                   lda,
+                                                   nullptr,
+                                                   incx,
+                                                   nullptr,
+                                                   ldb,
+                                                   nullptr,
+                                                   nullptr,
+                                                   ldc),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hC_1), `d` is in GPU (device) memory (eg dC_1).
+    // Allocate host memory
+    host_matrix<T> hA(A_row, A_col, lda);
+    host_matrix<T> hB(B_row, B_col, ldb);
+    host_matrix<T> hC(M, N, ldc);
+    host_matrix<T> hC_1(M, N, ldc);
+    host_matrix<T> hC_2(M, N, ldc);
+    host_matrix<T> hC_gold(M, N, ldc);
+    host_matrix<T> hAx(M, std::max(K, 1), M);
+    host_vector<T> hx(std::max(dim_x, 1), incx);
+
+    // Allocate device memory
+    device_matrix<T> dA(A_row, A_col, lda);
+    device_matrix<T> dB(B_row, B_col, ldb);
+    device_matrix<T> dC_1(M, N, ldc);
+    device_matrix<T> dC_2(M, N, ldc);
+    device_vector<T> dx(std::max(dim_x, 1), incx);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, false, true);
+
+    // Transfer data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dC_1.transfer_from(hC));
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dC_2.transfer_from(hC));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_dgmm_fn(handle,
+                                                 transA,
+                                                 transB,
+                                                 side,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 &h_alpha,
+                                                 dA,
+                                                 lda,
+                                                 dx,
+                                                 incx,
+                                                 dB,
+                                                 ldb,
+                                                 &h_beta,
+                                                 dC_1,
+                                                 ldc));
+        handle.post_test(arg);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_dgmm_fn(handle,
+                                                 transA,
+                                                 transB,
+                                                 side,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 d_alpha,
+                                                 dA,
+                                                 lda,
+                                                 dx,
+                                                 incx,
+                                                 dB,
+                                                 ldb,
+                                                 d_beta,
+                                                 dC_2,
+                                                 ldc));
+        handle.post_test(arg);
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        // element i of x, counted from the end for a negative incx
+        auto x_at = [&](rocblas_int i) {
+            return hx[incx >= 0 ? size_t(i) * incx : size_t(dim_x - 1 - i) * -incx];
+        };
+
+        for(rocblas_int l = 0; l < K; l++)
+            for(rocblas_int i = 0; i < M; i++)
+            {
+                T a = transA == rocblas_operation_none ? hA[0][i + size_t(lda) * l]
+                                                       : hA[0][l + size_t(lda) * i];
+                if(transA == rocblas_operation_conjugate_transpose)
+                    a = conj(a);
+                hAx[0][i + size_t(M) * l] = a * x_at(side == rocblas_side_left ? i : l);
+            }
+
+        hC_gold = hC;
+        cblas_gemm<T>(rocblas_operation_none,
+                      transB,
+                      M,
+                      N,
+                      K,
+                      h_alpha,
+                      hAx,
+                      M,
+                      hB,
+                      ldb,
+                      h_beta,
+                      hC_gold,
+                      ldc);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hC_1.transfer_from(dC_1));
+        CHECK_HIP_ERROR(hC_2.transfer_from(dC_2));
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+            unit_check_general<T>(M, N, ldc, hC_gold, hC_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', M, N, ldc, hC_gold, hC_1);
+            rocblas_error_2 = norm_check_general<T>('F', M, N, ldc, hC_gold, hC_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_gemm_dgmm_fn(handle,
+                                 transA,
+                                 transB,
+                                 side,
+                                 M,
+                                 N,
+                                 K,
+                                 &h_alpha,
+                                 dA,
+                                 lda,
+                                 dx,
+                                 incx,
+                                 dB,
+                                 ldb,
+                                 &h_beta,
+                                 dC_1,
+                                 ldc);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_gemm_dgmm_fn(handle,
+                                 transA,
+                                 transB,
+                                 side,
+                                 M,
+                                 N,
+                                 K,
+                                 &h_alpha,
+                                 dA,
+                                 lda,
+                                 dx,
+                                 incx,
+                                 dB,
+                                 ldb,
+                                 &h_beta,
+                                 dC_1,
+                                 ldc);
+        });
+
+        // the scaling of op(A) is fused into the loads of the gemm
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_side,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_incx,
+                      e_ldb,
+                      e_beta,
+                      e_ldc>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemm_gflop_count<T>(M, N, K) + dgmm_gflop_count<T>(M, K),
+                         gemm_gbyte_count<T>(M, N, K) + sizeof(T) * double(dim_x) / 1e9,
+                         cpu_time_used,
+                         rocblas_error_1,
+                         rocblas_error_2);
+    }
+}
@@ -0,0 +1,411 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <memory>
+#include <vector>
+
+// gemm_multi_device is a beta feature without Fortran bindings, so only its precision is
+// templated here
+template <typename T>
+static rocblas_status (*rocblas_gemm_multi_device)(const rocblas_handle* handles,
+                                                   rocblas_int           handle_count,
+                                                   rocblas_operation     transA,
+                                                   rocblas_operation     transB,
+                                                   rocblas_int           m,
+                                                   rocblas_int           n,
+                                                   rocblas_int           k,
+                                                   const T*              alpha,
+                                                   const T*              A,
+                                                   rocblas_int           lda,
+                                                   const T*              B,
+                                                   rocblas_int           ldb,
+                                                   const T*              beta,
+                                                   T*                    C,
+                                                   rocblas_int           ldc);
+
+template <>
+static auto rocblas_gemm_multi_device<float> = rocblas_sgemm_multi_device;
+template <>
+static auto rocblas_gemm_multi_device<double> = rocblas_dgemm_multi_device;
+template <>
+static auto rocblas_gemm_multi_device<rocblas_float_complex> = rocblas_cgemm_multi_device;
+template <>
+static auto rocblas_gemm_multi_device<rocblas_double_complex> = rocblas_zgemm_multi_device;
+
+template <typename T>
+void testing_gemm_multi_device_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemm_multi_device_fn = rocblas_gemm_multi_device<T>;
+
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+
+    const rocblas_int M = 100;
+    const rocblas_int N = 101;
+    const rocblas_int K = 102;
+
+    const rocblas_int lda = 103;
+    const rocblas_int ldb = 103;
+    const rocblas_int ldc = 103;
+
+    const T alpha(1), beta(2), zero(0), one(1);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    // Allocate device memory
+    device_matrix<T> dA(M, K, lda);
+    device_matrix<T> dB(K, N, ldb);
+    device_matrix<T> dC(M, N, ldc);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    rocblas_handle handles[2] = {handle, nullptr};
+
+    // check for a null handle array, an empty one and a null handle in it
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_multi_device_fn(
+            nullptr, 1, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_multi_device_fn(
+            handles, 0, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_multi_device_fn(
+            handles, 2, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_handle);
+
+    // check for two handles on the same device
+    handles[1] = handle;
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_multi_device_fn(
+            handles, 2, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_value);
+
+    // check for invalid enum
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_multi_device_fn(handles,
+                                                       1,
+                                                       (rocblas_operation)rocblas_fill_full,
+                                                       transB,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       &alpha,
+                                                       dA,
+                                                       lda,
+                                                       dB,
+                                                       ldb,
+                                                       &beta,
+                                                       dC,
+                                                       ldc),
+                          rocblas_status_invalid_value);
+
+    // check for invalid size and leading dimension
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_multi_device_fn(
+            handles, 1, transA, transB, -1, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_multi_device_fn(
+            handles, 1, transA, transB, M, N, K, &alpha, dA, M - 1, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_multi_device_fn(
+            handles, 1, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, M - 1),
+        rocblas_status_invalid_size);
+
+    // check for null pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_multi_device_fn(
+            handles, 1, transA, transB, M, N, K, nullptr, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_multi_device_fn(
+            handles, 1, transA, transB, M, N, K, &alpha, nullptr, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_multi_device_fn(
+            handles, 1, transA, transB, M, N, K, &alpha, dA, lda, nullptr, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_multi_device_fn(
+            handles, 1, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, nullptr, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_multi_device_fn(
+            handles, 1, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, nullptr, ldc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with an empty C, and with alpha 0 and beta 1 without A and B
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_multi_device_fn(handles,
+                                                       1,
+                                                       transA,
+                                                       transB,
+                                                       0,
+                                                       N,
+                                                       K,
+                                                       nullptr,
+                                                       nullptr,
+                                                       lda,
+                                                       nullptr,
+                                                       ldb,
+                                                       nullptr,
+                                                       nullptr,
+                                                       ldc),
+                          rocblas_status_success);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_multi_device_fn(
+            handles, 1, transA, transB, M, N, K, &zero, nullptr, lda, nullptr, ldb, &one, dC, ldc),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_gemm_multi_device(const Arguments& arg)
+{
+    auto rocblas_gemm_multi_device_fn = rocblas_gemm_multi_device<T>;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error          = 0.0;
+
+    // One handle per device, starting with the current device, which holds the matrices
+    int device_count, home;
+    CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+    CHECK_HIP_ERROR(hipGetDevice(&home));
+
+    std::vector<std::unique_ptr<rocblas_local_handle>> local_handles;
+    std::vector<rocblas_handle>                        handles;
+    for(int d = 0; d < device_count; d++)
+    {
+        CHECK_HIP_ERROR(hipSetDevice((home + d) % device_count));
+        local_handles.push_back(std::make_unique<rocblas_local_handle>(arg));
+        handles.push_back(*local_handles.back());
+    }
+    CHECK_HIP_ERROR(hipSetDevice(home));
+
+    rocblas_handle handle = handles[0];
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : std::max(K, 1);
+    rocblas_int A_col = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : std::max(K, 1);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_multi_device_fn(handles.data(),
+                                                           device_count,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           nullptr,
+                                                           nullptr,
+                                                           lda,
+                                                           nullptr,
+                                                           ldb,
+                                                           nullptr,
+                                                           nullptr,
+                                                           ldc),
+                              rocblas_status_invalid_size);
+
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_matrix<T> hA(A_row, A_col, lda);
+    host_matrix<T> hB(B_row, B_col, ldb);
+    host_matrix<T> hC(M, N, ldc);
+    host_matrix<T> hC_1(M, N, ldc);
+    host_matrix<T> hC_gold(M, N, ldc);
+
+    // Allocate device memory on the device of the first handle
+    device_matrix<T> dA(A_row, A_col, lda);
+    device_matrix<T> dB(B_row, B_col, ldb);
+    device_matrix<T> dC(M, N, ldc);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        hC_gold = hC;
+
+        if(arg.timing)
+        {
+            cpu_time_used = get_time_us_no_sync();
+        }
+
+        cblas_gemm<T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC_gold, ldc);
+
+        if(arg.timing)
+        {
+            cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+        }
+
+        // alpha and beta follow the pointer mode of the first handle
+        for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+            const T* alpha = pointer_mode == rocblas_pointer_mode_host ? &h_alpha : d_alpha;
+            const T* beta  = pointer_mode == rocblas_pointer_mode_host ? &h_beta : d_beta;
+
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_multi_device_fn(handles.data(),
+                                                             device_count,
+                                                             transA,
+                                                             transB,
+                                                             M,
+                                                             N,
+                                                             K,
+                                                             alpha,
+                                                             dA,
+                                                             lda,
+                                                             dB,
+                                                             ldb,
+                                                             beta,
+                                                             dC,
+                                                             ldc));
+            CHECK_HIP_ERROR(hC_1.transfer_from(dC));
+
+            if(arg.unit_check)
+                unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+
+            if(arg.norm_check)
+            {
+                auto err = std::abs(norm_check_general<T>('F', M, N, ldc, hC_gold, hC_1));
+                rocblas_error = err > rocblas_error ? err : rocblas_error;
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        auto gemm_multi_device = [&]() {
+            return rocblas_gemm_multi_device_fn(handles.data(),
+                                                device_count,
+                                                transA,
+                                                transB,
+                                                M,
+                                                N,
+                                                K,
+                                                &h_alpha,
+                                                dA,
+                                                lda,
+                                                dB,
+                                                ldb,
+                                                &h_beta,
+                                                dC,
+                                                ldc);
+        };
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+            gemm_multi_device();
+
+        // the work on all devices is ordered on the stream of the first handle
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used
+            = get_time_us_hot_calls(stream, number_hot_calls, [&] { gemm_multi_device(); });
+
+        ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_lda, e_beta, e_ldb, e_ldc>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemm_gflop_count<T>(M, N, K),
+                         gemm_gbyte_count<T>(M, N, K),
+                         cpu_time_used,
+                         rocblas_error);
+    }
+}
@@ -0,0 +1,390 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// Device memory of the handle in the tests, small enough for their problems to be split into
+// many tiles. rocblas-bench keeps the default device memory.
+constexpr size_t rocblas_offload_test_device_memory = 1 << 20;
+
+// Pin a host matrix, so that the offload copies it directly instead of staging it
+template <typename T>
+void rocblas_offload_host_register(host_matrix<T>& h)
+{
+    CHECK_HIP_ERROR(hipHostRegister((T*)h, h.size() * sizeof(T), hipHostRegisterDefault));
+}
+
+template <typename T>
+void rocblas_offload_host_unregister(host_matrix<T>& h)
+{
+    CHECK_HIP_ERROR(hipHostUnregister((T*)h));
+}
+
+// gemm_offload is a beta feature without Fortran bindings
+template <typename T>
+static rocblas_status (*rocblas_gemm_offload)(rocblas_handle    handle,
+                                              rocblas_operation trans_a,
+                                              rocblas_operation trans_b,
+                                              rocblas_int       m,
+                                              rocblas_int       n,
+                                              rocblas_int       k,
+                                              const T*          alpha,
+                                              const T*          A,
+                                              rocblas_int       lda,
+                                              const T*          B,
+                                              rocblas_int       ldb,
+                                              const T*          beta,
+                                              T*                C,
+                                              rocblas_int       ldc);
+
+template <>
+static auto rocblas_gemm_offload<float> = rocblas_sgemm_offload;
+template <>
+static auto rocblas_gemm_offload<double> = rocblas_dgemm_offload;
+template <>
+static auto rocblas_gemm_offload<rocblas_float_complex> = rocblas_cgemm_offload;
+template <>
+static auto rocblas_gemm_offload<rocblas_double_complex> = rocblas_zgemm_offload;
+
+template <typename T>
+void testing_gemm_offload_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemm_offload_fn = rocblas_gemm_offload<T>;
+
+    rocblas_local_handle handle{arg};
+
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+    const rocblas_int       M      = 100;
+    const rocblas_int       N      = 100;
+    const rocblas_int       K      = 100;
+    const rocblas_int       lda    = 100;
+    const rocblas_int       ldb    = 100;
+    const rocblas_int       ldc    = 100;
+
+    // alpha and beta are host pointers whatever the pointer mode
+    const T alpha(1), beta(2), one(1), zero(0);
+
+    // The matrices of the offload are in host memory
+    host_matrix<T> hA(M, K, lda);
+    host_matrix<T> hB(K, N, ldb);
+    host_matrix<T> hC(M, N, ldc);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_offload_fn(
+            nullptr, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_offload_fn(handle,
+                                                  (rocblas_operation)rocblas_fill_full,
+                                                  transB,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &alpha,
+                                                  hA,
+                                                  lda,
+                                                  hB,
+                                                  ldb,
+                                                  &beta,
+                                                  hC,
+                                                  ldc),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_offload_fn(handle,
+                                                  transA,
+                                                  (rocblas_operation)rocblas_fill_full,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &alpha,
+                                                  hA,
+                                                  lda,
+                                                  hB,
+                                                  ldb,
+                                                  &beta,
+                                                  hC,
+                                                  ldc),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_offload_fn(
+            handle, transA, transB, M, N, K, &alpha, hA, M - 1, hB, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_offload_fn(
+            handle, transA, transB, M, N, K, &alpha, hA, lda, hB, K - 1, &beta, hC, ldc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_offload_fn(
+            handle, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, &beta, hC, M - 1),
+        rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_offload_fn(
+            handle, transA, transB, M, N, K, nullptr, hA, lda, hB, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_offload_fn(
+            handle, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, nullptr, hC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_offload_fn(
+            handle, transA, transB, M, N, K, &alpha, nullptr, lda, hB, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_offload_fn(
+            handle, transA, transB, M, N, K, &alpha, hA, lda, nullptr, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_offload_fn(
+            handle, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, &beta, nullptr, ldc),
+        rocblas_status_invalid_pointer);
+
+    // If alpha is 0, A and B are not dereferenced
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_offload_fn(
+            handle, transA, transB, M, N, K, &zero, nullptr, lda, nullptr, ldb, &beta, hC, ldc),
+        rocblas_status_success);
+
+    // If alpha is 0 and beta is 1, C is not dereferenced either
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_offload_fn(handle,
+                                                  transA,
+                                                  transB,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &zero,
+                                                  nullptr,
+                                                  lda,
+                                                  nullptr,
+                                                  ldb,
+                                                  &one,
+                                                  nullptr,
+                                                  ldc),
+                          rocblas_status_success);
+
+    // If M is 0, nothing is dereferenced
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_offload_fn(handle,
+                                                  transA,
+                                                  transB,
+                                                  0,
+                                                  N,
+                                                  K,
+                                                  nullptr,
+                                                  nullptr,
+                                                  lda,
+                                                  nullptr,
+                                                  ldb,
+                                                  nullptr,
+                                                  nullptr,
+                                                  ldc),
+                          rocblas_status_success);
+}
+
+// The offload is checked with A, B and C in pageable host memory, which is staged through the
+// device memory of the handle, in pinned host memory, which is copied directly, and with A and
+// B in device memory and C in pinned host memory
+template <typename T>
+void testing_gemm_offload(const Arguments& arg)
+{
+    auto rocblas_gemm_offload_fn = rocblas_gemm_offload<T>;
+
+    rocblas_operation transA  = char2rocblas_operation(arg.transA);
+    rocblas_operation transB  = char2rocblas_operation(arg.transB);
+    rocblas_int       M       = arg.M;
+    rocblas_int       N       = arg.N;
+    rocblas_int       K       = arg.K;
+    rocblas_int       lda     = arg.lda;
+    rocblas_int       ldb     = arg.ldb;
+    rocblas_int       ldc     = arg.ldc;
+    T                 h_alpha = arg.get_alpha<T>();
+    T                 h_beta  = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+    if(!arg.timing)
+        CHECK_ROCBLAS_ERROR(
+            rocblas_set_device_memory_size(handle, rocblas_offload_test_device_memory));
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : std::max(K, 1);
+    rocblas_int A_col = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : std::max(K, 1);
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_offload_fn(handle,
+                                                      transA,
+                                                      transB,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      nullptr,
+                                                      nullptr,
+                                                      lda,
+                                                      nullptr,
+                                                      ldb,
+                                                      nullptr,
+                                                      nullptr,
+                                                      ldc),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hC_1), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_matrix<T> hA(A_row, A_col, lda);
+    host_matrix<T> hB(B_row, B_col, ldb);
+    host_matrix<T> hC(M, N, ldc);
+    host_matrix<T> hC_1(M, N, ldc);
+    host_matrix<T> hC_gold(M, N, ldc);
+
+    // Allocate device memory
+    device_matrix<T> dA(A_row, A_col, lda);
+    device_matrix<T> dB(B_row, B_col, ldb);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    // Transfer data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        hC_gold = hC;
+        cblas_gemm<T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC_gold, ldc);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        for(int memory : {0, 1, 2})
+        {
+            const bool pinned = memory == 1, device = memory == 2;
+
+            // alpha and beta stay on the host in device pointer mode
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(
+                handle, pinned ? rocblas_pointer_mode_device : rocblas_pointer_mode_host));
+
+            hC_1 = hC;
+            if(pinned)
+            {
+                rocblas_offload_host_register(hA);
+                rocblas_offload_host_register(hB);
+            }
+            if(pinned || device)
+                rocblas_offload_host_register(hC_1);
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_offload_fn(handle,
+                                                        transA,
+                                                        transB,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        &h_alpha,
+                                                        device ? (const T*)dA : hA,
+                                                        lda,
+                                                        device ? (const T*)dB : hB,
+                                                        ldb,
+                                                        &h_beta,
+                                                        hC_1,
+                                                        ldc));
+            handle.post_test(arg);
+
+            if(pinned)
+            {
+                rocblas_offload_host_unregister(hA);
+                rocblas_offload_host_unregister(hB);
+            }
+            if(pinned || device)
+                rocblas_offload_host_unregister(hC_1);
+
+            if(arg.unit_check)
+                unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+
+            if(arg.norm_check)
+                rocblas_error = std::max(
+                    rocblas_error, double(norm_check_general<T>('F', M, N, ldc, hC_gold, hC_1)));
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_gemm_offload_fn(
+                handle, transA, transB, M, N, K, &h_alpha, hA, lda, hB, ldb, &h_beta, hC_1, ldc);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_gemm_offload_fn(
+                handle, transA, transB, M, N, K, &h_alpha, hA, lda, hB, ldb, &h_beta, hC_1, ldc);
+        });
+
+        // the time includes the transfers of the pageable host matrices
+        ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_lda, e_ldb, e_beta, e_ldc>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemm_gflop_count<T>(M, N, K),
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         rocblas_error);
+    }
+}
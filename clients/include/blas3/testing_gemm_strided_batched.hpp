@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
 #include "near.hpp"
@@ -313,16 +314,27 @@ void testing_gemm_strided_batched(const Arguments& arg)
     CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
     CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
 
-    // Initialize data on host memory
-    rocblas_init_matrix(
-        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
-    rocblas_init_matrix(
-        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
-    rocblas_init_matrix(hC_1, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+    if(rocblas_client_device_init<T>(arg))
+    {
+        // Initialize data on device memory, the results are not verified
+        CHECK_HIP_ERROR(rocblas_init_matrix_device(dA, arg, true, false));
+        CHECK_HIP_ERROR(rocblas_init_matrix_device(dB, arg, false, true));
+        CHECK_HIP_ERROR(rocblas_init_matrix_device(dC, arg, false, false));
+    }
+    else
+    {
+        // Initialize data on host memory
+        rocblas_init_matrix(
+            hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+        rocblas_init_matrix(
+            hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+        rocblas_init_matrix(
+            hC_1, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
 
-    // copy data from CPU to device
-    CHECK_HIP_ERROR(dA.transfer_from(hA));
-    CHECK_HIP_ERROR(dB.transfer_from(hB));
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
 
     if(arg.unit_check || arg.norm_check)
     {
@@ -389,6 +401,7 @@ void testing_gemm_strided_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(rocblas_int b = 0; b < batch_count; b++)
         {
             cblas_gemm<T>(
@@ -507,7 +520,7 @@ void testing_gemm_strided_batched(const Arguments& arg)
                          arg,
                          gpu_time_used,
                          gemm_gflop_count<T>(M, N, K),
-                         ArgumentLogging::NA_value,
+                         gemm_gbyte_count<T>(M, N, K),
                          cpu_time_used,
                          rocblas_error);
     }
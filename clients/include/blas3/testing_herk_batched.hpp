@@ -394,6 +394,7 @@ void testing_herk_batched(const Arguments& arg)
         }
 
         // cpu reference
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
         {
             cblas_herk<T>(uplo, transA, N, K, h_alpha[0], hA[b], lda, h_beta[0], hC_gold[b], ldc);
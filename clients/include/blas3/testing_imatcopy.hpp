@@ -0,0 +1,347 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// imatcopy is a beta feature without Fortran bindings
+
+// imatcopy
+template <typename T>
+static rocblas_status (*rocblas_imatcopy)(rocblas_handle    handle,
+                                          rocblas_operation trans,
+                                          rocblas_int       m,
+                                          rocblas_int       n,
+                                          const T*          alpha,
+                                          T*                A,
+                                          rocblas_int       lda,
+                                          rocblas_int       ldb);
+
+template <>
+static auto rocblas_imatcopy<float> = rocblas_simatcopy;
+template <>
+static auto rocblas_imatcopy<double> = rocblas_dimatcopy;
+template <>
+static auto rocblas_imatcopy<rocblas_float_complex> = rocblas_cimatcopy;
+template <>
+static auto rocblas_imatcopy<rocblas_double_complex> = rocblas_zimatcopy;
+
+// imatcopy_batched
+template <typename T>
+static rocblas_status (*rocblas_imatcopy_batched)(rocblas_handle    handle,
+                                                  rocblas_operation trans,
+                                                  rocblas_int       m,
+                                                  rocblas_int       n,
+                                                  const T*          alpha,
+                                                  T* const          A[],
+                                                  rocblas_int       lda,
+                                                  rocblas_int       ldb,
+                                                  rocblas_int       batch_count);
+
+template <>
+static auto rocblas_imatcopy_batched<float> = rocblas_simatcopy_batched;
+template <>
+static auto rocblas_imatcopy_batched<double> = rocblas_dimatcopy_batched;
+template <>
+static auto rocblas_imatcopy_batched<rocblas_float_complex> = rocblas_cimatcopy_batched;
+template <>
+static auto rocblas_imatcopy_batched<rocblas_double_complex> = rocblas_zimatcopy_batched;
+
+// imatcopy_strided_batched
+template <typename T>
+static rocblas_status (*rocblas_imatcopy_strided_batched)(rocblas_handle    handle,
+                                                          rocblas_operation trans,
+                                                          rocblas_int       m,
+                                                          rocblas_int       n,
+                                                          const T*          alpha,
+                                                          T*                A,
+                                                          rocblas_int       lda,
+                                                          rocblas_int       ldb,
+                                                          rocblas_stride    stride_a,
+                                                          rocblas_int       batch_count);
+
+template <>
+static auto rocblas_imatcopy_strided_batched<float> = rocblas_simatcopy_strided_batched;
+template <>
+static auto rocblas_imatcopy_strided_batched<double> = rocblas_dimatcopy_strided_batched;
+template <>
+static auto rocblas_imatcopy_strided_batched<rocblas_float_complex>
+    = rocblas_cimatcopy_strided_batched;
+template <>
+static auto rocblas_imatcopy_strided_batched<rocblas_double_complex>
+    = rocblas_zimatcopy_strided_batched;
+
+template <typename T>
+void testing_imatcopy_bad_arg(const Arguments& arg)
+{
+    auto rocblas_imatcopy_fn                 = rocblas_imatcopy<T>;
+    auto rocblas_imatcopy_batched_fn         = rocblas_imatcopy_batched<T>;
+    auto rocblas_imatcopy_strided_batched_fn = rocblas_imatcopy_strided_batched<T>;
+
+    const rocblas_operation trans       = rocblas_operation_transpose;
+    const rocblas_operation none        = rocblas_operation_none;
+    const rocblas_operation bad_trans   = (rocblas_operation)rocblas_fill_full;
+    const rocblas_int       M           = 100;
+    const rocblas_int       N           = 50;
+    const rocblas_int       lda         = 100;
+    const rocblas_int       ldb         = 100;
+    const rocblas_stride    stride_a    = size_t(lda) * M;
+    const rocblas_int       batch_count = 2;
+
+    rocblas_local_handle handle{arg};
+
+    // Allocate device memory
+    device_strided_batch_vector<T> dA(stride_a, 1, stride_a, batch_count);
+    device_batch_vector<T>         dAb(stride_a, 1, batch_count);
+    device_vector<T>               alpha_d(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dAb.memcheck());
+    CHECK_DEVICE_ALLOCATION(alpha_d.memcheck());
+
+    T** dA_array = dAb.ptr_on_device();
+
+    const T alpha_h(1);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const T* alpha = &alpha_h;
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+        }
+
+        // clang-format off
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_fn(nullptr, trans, M, N, alpha, dA, lda, ldb), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_fn(handle, bad_trans, M, N, alpha, dA, lda, ldb), rocblas_status_invalid_value);
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_fn(handle, trans, -1, N, alpha, dA, lda, ldb), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_fn(handle, trans, M, -1, alpha, dA, lda, ldb), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_fn(handle, trans, M, N, alpha, dA, M - 1, ldb), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_fn(handle, trans, M, N, alpha, dA, lda, N - 1), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_fn(handle, none, M, N, alpha, dA, lda, M - 1), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_fn(handle, trans, M, N, nullptr, dA, lda, ldb), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_fn(handle, trans, M, N, alpha, nullptr, lda, ldb), rocblas_status_invalid_pointer);
+
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_batched_fn(nullptr, trans, M, N, alpha, dA_array, lda, ldb, batch_count), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_batched_fn(handle, trans, M, N, alpha, dA_array, lda, ldb, -1), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_batched_fn(handle, trans, M, N, nullptr, dA_array, lda, ldb, batch_count), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_batched_fn(handle, trans, M, N, alpha, nullptr, lda, ldb, batch_count), rocblas_status_invalid_pointer);
+
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_strided_batched_fn(nullptr, trans, M, N, alpha, dA, lda, ldb, stride_a, batch_count), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_strided_batched_fn(handle, trans, M, N, alpha, dA, lda, ldb, stride_a, -1), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_strided_batched_fn(handle, trans, M, N, nullptr, dA, lda, ldb, stride_a, batch_count), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_strided_batched_fn(handle, trans, M, N, alpha, nullptr, lda, ldb, stride_a, batch_count), rocblas_status_invalid_pointer);
+
+// If M, N or batch_count is 0, the pointers are not checked
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_fn(handle, trans, 0, N, nullptr, nullptr, lda, ldb), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_fn(handle, trans, M, 0, nullptr, nullptr, lda, ldb), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_batched_fn(handle, trans, M, N, nullptr, nullptr, lda, ldb, 0), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_imatcopy_strided_batched_fn(handle, trans, M, N, nullptr, nullptr, lda, ldb, stride_a, 0), rocblas_status_success);
+        // clang-format on
+    }
+}
+
+// imatcopy must overwrite each A with alpha*op(A) computed on the host, for the strided batched,
+// batched and non batched functions, in place on a square matrix with an unchanged leading
+// dimension, and through the workspace for a rectangular transpose or a change of leading
+// dimension
+template <typename T>
+void testing_imatcopy(const Arguments& arg)
+{
+    auto rocblas_imatcopy_fn                 = rocblas_imatcopy<T>;
+    auto rocblas_imatcopy_batched_fn         = rocblas_imatcopy_batched<T>;
+    auto rocblas_imatcopy_strided_batched_fn = rocblas_imatcopy_strided_batched<T>;
+
+    rocblas_operation trans       = char2rocblas_operation(arg.transA);
+    rocblas_int       M           = arg.M;
+    rocblas_int       N           = arg.N;
+    rocblas_int       lda         = arg.lda;
+    rocblas_int       ldb         = arg.ldb;
+    rocblas_int       batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    rocblas_local_handle handle{arg};
+
+    // op(A) is rows x cols with leading dimension ldb, in the memory of A
+    rocblas_int rows = trans == rocblas_operation_none ? M : N;
+    rocblas_int cols = trans == rocblas_operation_none ? N : M;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size
+        = M < 0 || N < 0 || batch_count < 0 || lda < M || lda < 1 || ldb < rows || ldb < 1;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_imatcopy_strided_batched_fn(
+                handle, trans, M, N, nullptr, nullptr, lda, ldb, lda * N, batch_count),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Each matrix holds both A and op(A)
+    rocblas_stride stride_a = std::max(size_t(lda) * N, size_t(ldb) * cols);
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_strided_batch_vector<T> hA(stride_a, 1, stride_a, batch_count);
+    host_strided_batch_vector<T> hA_1(stride_a, 1, stride_a, batch_count);
+    host_strided_batch_vector<T> hA_2(stride_a, 1, stride_a, batch_count);
+    host_strided_batch_vector<T> hA_gold(stride_a, 1, stride_a, batch_count);
+    host_batch_vector<T>         hAb(stride_a, 1, batch_count);
+    host_vector<T>               halpha(1);
+    halpha[0] = h_alpha;
+
+    // Allocate device memory
+    device_strided_batch_vector<T> dA(stride_a, 1, stride_a, batch_count);
+    device_batch_vector<T>         dAb(stride_a, 1, batch_count);
+    device_vector<T>               d_alpha(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dAb.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hA, arg, rocblas_client_alpha_sets_nan, true);
+    for(rocblas_int b = 0; b < batch_count; b++)
+        std::copy(hA[b], hA[b] + stride_a, hAb[b]);
+
+    CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_imatcopy_strided_batched_fn(
+            handle, trans, M, N, &h_alpha, dA, lda, ldb, stride_a, batch_count));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hA_1.transfer_from(dA));
+
+        // The batched function
+        CHECK_HIP_ERROR(dAb.transfer_from(hAb));
+        CHECK_ROCBLAS_ERROR(rocblas_imatcopy_batched_fn(
+            handle, trans, M, N, &h_alpha, dAb.ptr_on_device(), lda, ldb, batch_count));
+        CHECK_HIP_ERROR(hAb.transfer_from(dAb));
+
+        // GPU BLAS, rocblas_pointer_mode_device, with the non batched function on each batch
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        handle.pre_test(arg);
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_imatcopy_fn(handle, trans, M, N, d_alpha, dA[b], lda, ldb));
+        }
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hA_2.transfer_from(dA));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            for(rocblas_int j = 0; j < cols; j++)
+            {
+                for(rocblas_int i = 0; i < rows; i++)
+                {
+                    T a = trans == rocblas_operation_none ? hA[b][i + size_t(j) * lda]
+                                                          : hA[b][j + size_t(i) * lda];
+                    if(trans == rocblas_operation_conjugate_transpose)
+                        a = conjugate(a);
+                    hA_gold[b][i + size_t(j) * ldb] = h_alpha * a;
+                }
+            }
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(rows, cols, ldb, stride_a, hA_gold, hA_1, batch_count);
+            unit_check_general<T>(rows, cols, ldb, stride_a, hA_gold, hA_2, batch_count);
+            for(rocblas_int b = 0; b < batch_count; b++)
+                unit_check_general<T>(rows, cols, ldb, hA_gold[b], hAb[b]);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>(
+                'F', rows, cols, ldb, stride_a, hA_gold, hA_1, batch_count);
+            rocblas_error_2 = norm_check_general<T>(
+                'F', rows, cols, ldb, stride_a, hA_gold, hA_2, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_imatcopy_strided_batched_fn(
+                handle, trans, M, N, &h_alpha, dA, lda, ldb, stride_a, batch_count);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_imatcopy_strided_batched_fn(
+                handle, trans, M, N, &h_alpha, dA, lda, ldb, stride_a, batch_count);
+        });
+
+        ArgumentModel<e_transA, e_M, e_N, e_alpha, e_lda, e_ldb, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            scal_gflop_count<T, T>(M * N),
+            matcopy_gbyte_count<T>(M, N),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
@@ -0,0 +1,670 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// The Rectangular Full Packed routines are beta features without Fortran bindings
+template <typename T>
+static rocblas_status (*rocblas_trttf)(rocblas_handle    handle,
+                                       rocblas_operation transr,
+                                       rocblas_fill      uplo,
+                                       rocblas_int       n,
+                                       const T*          A,
+                                       rocblas_int       lda,
+                                       T*                ARF);
+
+template <>
+static auto rocblas_trttf<float> = rocblas_strttf;
+template <>
+static auto rocblas_trttf<double> = rocblas_dtrttf;
+template <>
+static auto rocblas_trttf<rocblas_float_complex> = rocblas_ctrttf;
+template <>
+static auto rocblas_trttf<rocblas_double_complex> = rocblas_ztrttf;
+
+template <typename T>
+static rocblas_status (*rocblas_tfttr)(rocblas_handle    handle,
+                                       rocblas_operation transr,
+                                       rocblas_fill      uplo,
+                                       rocblas_int       n,
+                                       const T*          ARF,
+                                       T*                A,
+                                       rocblas_int       lda);
+
+template <>
+static auto rocblas_tfttr<float> = rocblas_stfttr;
+template <>
+static auto rocblas_tfttr<double> = rocblas_dtfttr;
+template <>
+static auto rocblas_tfttr<rocblas_float_complex> = rocblas_ctfttr;
+template <>
+static auto rocblas_tfttr<rocblas_double_complex> = rocblas_ztfttr;
+
+template <typename T>
+static rocblas_status (*rocblas_tpttf)(rocblas_handle    handle,
+                                       rocblas_operation transr,
+                                       rocblas_fill      uplo,
+                                       rocblas_int       n,
+                                       const T*          AP,
+                                       T*                ARF);
+
+template <>
+static auto rocblas_tpttf<float> = rocblas_stpttf;
+template <>
+static auto rocblas_tpttf<double> = rocblas_dtpttf;
+template <>
+static auto rocblas_tpttf<rocblas_float_complex> = rocblas_ctpttf;
+template <>
+static auto rocblas_tpttf<rocblas_double_complex> = rocblas_ztpttf;
+
+template <typename T>
+static rocblas_status (*rocblas_tfttp)(rocblas_handle    handle,
+                                       rocblas_operation transr,
+                                       rocblas_fill      uplo,
+                                       rocblas_int       n,
+                                       const T*          ARF,
+                                       T*                AP);
+
+template <>
+static auto rocblas_tfttp<float> = rocblas_stfttp;
+template <>
+static auto rocblas_tfttp<double> = rocblas_dtfttp;
+template <>
+static auto rocblas_tfttp<rocblas_float_complex> = rocblas_ctfttp;
+template <>
+static auto rocblas_tfttp<rocblas_double_complex> = rocblas_ztfttp;
+
+// sfrk for real types and hfrk for complex types, both with real scalars
+template <typename T>
+static rocblas_status (*rocblas_sfrk)(rocblas_handle    handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill      uplo,
+                                      rocblas_operation trans,
+                                      rocblas_int       n,
+                                      rocblas_int       k,
+                                      const real_t<T>*  alpha,
+                                      const T*          A,
+                                      rocblas_int       lda,
+                                      const real_t<T>*  beta,
+                                      T*                C);
+
+template <>
+static auto rocblas_sfrk<float> = rocblas_ssfrk;
+template <>
+static auto rocblas_sfrk<double> = rocblas_dsfrk;
+template <>
+static auto rocblas_sfrk<rocblas_float_complex> = rocblas_chfrk;
+template <>
+static auto rocblas_sfrk<rocblas_double_complex> = rocblas_zhfrk;
+
+template <typename T>
+static rocblas_status (*rocblas_tfsm)(rocblas_handle    handle,
+                                      rocblas_operation transr,
+                                      rocblas_side      side,
+                                      rocblas_fill      uplo,
+                                      rocblas_operation trans,
+                                      rocblas_diagonal  diag,
+                                      rocblas_int       m,
+                                      rocblas_int       n,
+                                      const T*          alpha,
+                                      const T*          A,
+                                      T*                B,
+                                      rocblas_int       ldb);
+
+template <>
+static auto rocblas_tfsm<float> = rocblas_stfsm;
+template <>
+static auto rocblas_tfsm<double> = rocblas_dtfsm;
+template <>
+static auto rocblas_tfsm<rocblas_float_complex> = rocblas_ctfsm;
+template <>
+static auto rocblas_tfsm<rocblas_double_complex> = rocblas_ztfsm;
+
+template <typename T>
+void testing_rfp_bad_arg(const Arguments& arg)
+{
+    auto rocblas_trttf_fn = rocblas_trttf<T>;
+    auto rocblas_tfttr_fn = rocblas_tfttr<T>;
+    auto rocblas_tpttf_fn = rocblas_tpttf<T>;
+    auto rocblas_tfttp_fn = rocblas_tfttp<T>;
+    auto rocblas_sfrk_fn  = rocblas_sfrk<T>;
+    auto rocblas_tfsm_fn  = rocblas_tfsm<T>;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    const rocblas_operation transr   = rocblas_operation_none;
+    const rocblas_operation trans    = rocblas_operation_none;
+    const rocblas_side      side     = rocblas_side_left;
+    const rocblas_fill      uplo     = rocblas_fill_lower;
+    const rocblas_diagonal  diag     = rocblas_diagonal_non_unit;
+    const rocblas_int       N        = 100;
+    const rocblas_int       K        = 100;
+    const rocblas_int       lda      = 100;
+    const rocblas_int       ldb      = 100;
+    const size_t            size_rfp = size_t(N) * (N + 1) / 2;
+
+    const real_t<T> alpha(1), beta(1), zero(0);
+    const T         alpha_tfsm(1);
+
+    // Allocate device memory
+    device_matrix<T> dA(N, N, lda);
+    device_matrix<T> dB(N, K, ldb);
+    device_vector<T> dARF(size_rfp);
+    device_vector<T> dP(size_rfp);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dARF.memcheck());
+    CHECK_DEVICE_ALLOCATION(dP.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(rocblas_trttf_fn(nullptr, transr, uplo, N, dA, lda, dARF),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trttf_fn(handle, (rocblas_operation)rocblas_fill_full, uplo, N, dA, lda, dARF),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_trttf_fn(handle, transr, rocblas_fill_full, N, dA, lda, dARF),
+                          rocblas_status_invalid_value);
+
+    // the transposed RFP format of complex types is the conjugate transpose
+    if(rocblas_is_complex<T>)
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_trttf_fn(handle, rocblas_operation_transpose, uplo, N, dA, lda, dARF),
+            rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_trttf_fn(handle, transr, uplo, -1, dA, lda, dARF),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_trttf_fn(handle, transr, uplo, N, dA, N - 1, dARF),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_trttf_fn(handle, transr, uplo, N, nullptr, lda, dARF),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_trttf_fn(handle, transr, uplo, N, dA, lda, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_trttf_fn(handle, transr, uplo, 0, nullptr, lda, nullptr),
+                          rocblas_status_success);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_tfttr_fn(nullptr, transr, uplo, N, dARF, dA, lda),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_tfttr_fn(handle, transr, uplo, N, dARF, dA, N - 1),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_tfttr_fn(handle, transr, uplo, N, nullptr, dA, lda),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_tfttr_fn(handle, transr, uplo, N, dARF, nullptr, lda),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_tpttf_fn(nullptr, transr, uplo, N, dP, dARF),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_tpttf_fn(handle, transr, uplo, -1, dP, dARF),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_tpttf_fn(handle, transr, uplo, N, nullptr, dARF),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_tpttf_fn(handle, transr, uplo, N, dP, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_tfttp_fn(nullptr, transr, uplo, N, dARF, dP),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_tfttp_fn(handle, transr, rocblas_fill_full, N, dARF, dP),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_tfttp_fn(handle, transr, uplo, N, nullptr, dP),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_tfttp_fn(handle, transr, uplo, N, dARF, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_sfrk_fn(nullptr, transr, uplo, trans, N, K, &alpha, dB, ldb, &beta, dARF),
+        rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_sfrk_fn(handle,
+                                          transr,
+                                          uplo,
+                                          (rocblas_operation)rocblas_fill_full,
+                                          N,
+                                          K,
+                                          &alpha,
+                                          dB,
+                                          ldb,
+                                          &beta,
+                                          dARF),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_sfrk_fn(handle, transr, uplo, trans, N, -1, &alpha, dB, ldb, &beta, dARF),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_sfrk_fn(handle, transr, uplo, trans, N, K, &alpha, dB, N - 1, &beta, dARF),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_sfrk_fn(handle, transr, uplo, trans, N, K, nullptr, dB, ldb, &beta, dARF),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_sfrk_fn(handle, transr, uplo, trans, N, K, &alpha, dB, ldb, nullptr, dARF),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_sfrk_fn(handle, transr, uplo, trans, N, K, &alpha, nullptr, ldb, &beta, dARF),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_sfrk_fn(handle, transr, uplo, trans, N, K, &alpha, dB, ldb, &beta, nullptr),
+        rocblas_status_invalid_pointer);
+
+    // If alpha is 0 and beta is 1, neither A nor C is dereferenced
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_sfrk_fn(handle, transr, uplo, trans, N, K, &zero, nullptr, ldb, &beta, nullptr),
+        rocblas_status_success);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_tfsm_fn(
+            nullptr, transr, side, uplo, trans, diag, N, K, &alpha_tfsm, dARF, dB, ldb),
+        rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_tfsm_fn(
+            handle, transr, rocblas_side_both, uplo, trans, diag, N, K, &alpha_tfsm, dARF, dB, ldb),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_tfsm_fn(handle,
+                                          transr,
+                                          side,
+                                          uplo,
+                                          trans,
+                                          (rocblas_diagonal)rocblas_side_both,
+                                          N,
+                                          K,
+                                          &alpha_tfsm,
+                                          dARF,
+                                          dB,
+                                          ldb),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_tfsm_fn(
+            handle, transr, side, uplo, trans, diag, N, K, &alpha_tfsm, dARF, dB, N - 1),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_tfsm_fn(handle, transr, side, uplo, trans, diag, N, K, nullptr, dARF, dB, ldb),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_tfsm_fn(
+            handle, transr, side, uplo, trans, diag, N, K, &alpha_tfsm, nullptr, dB, ldb),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_tfsm_fn(
+            handle, transr, side, uplo, trans, diag, N, K, &alpha_tfsm, dARF, nullptr, ldb),
+        rocblas_status_invalid_pointer);
+
+    // If M is 0, nothing is dereferenced
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_tfsm_fn(
+            handle, transr, side, uplo, trans, diag, 0, K, nullptr, nullptr, nullptr, ldb),
+        rocblas_status_success);
+}
+
+// The N by N triangle uplo of A goes through every conversion in both RFP formats, then the
+// RFP form of A is used for the sfrk (hfrk) rank K update, checked against syrk (herk) on
+// the full matrix, and for the tfsm solve, checked against the known solution X of a B
+// formed as op(A) X / alpha or X op(A) / alpha, as in the trsm test. B is N by K for the
+// left side and K by N for the right side; the A of the rank K update is stored with ldb.
+template <typename T>
+void testing_rfp(const Arguments& arg)
+{
+    auto rocblas_trttf_fn = rocblas_trttf<T>;
+    auto rocblas_tfttr_fn = rocblas_tfttr<T>;
+    auto rocblas_tpttf_fn = rocblas_tpttf<T>;
+    auto rocblas_tfttp_fn = rocblas_tfttp<T>;
+    auto rocblas_sfrk_fn  = rocblas_sfrk<T>;
+    auto rocblas_tfsm_fn  = rocblas_tfsm<T>;
+
+    using U = real_t<T>;
+
+    rocblas_side      side    = char2rocblas_side(arg.side);
+    rocblas_fill      uplo    = char2rocblas_fill(arg.uplo);
+    rocblas_operation transA  = char2rocblas_operation(arg.transA);
+    rocblas_diagonal  diag    = char2rocblas_diagonal(arg.diag);
+    rocblas_int       N       = arg.N;
+    rocblas_int       K       = arg.K;
+    rocblas_int       lda     = arg.lda;
+    rocblas_int       ldb     = arg.ldb;
+    T                 h_alpha = arg.get_alpha<T>();
+    U                 alpha   = arg.get_alpha<U>();
+    U                 beta    = arg.get_beta<U>();
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    const bool        left = side == rocblas_side_left;
+    const rocblas_int M    = left ? N : K;
+    const rocblas_int NB   = left ? K : N;
+
+    // the transposed RFP format of complex types is the conjugate transpose
+    const rocblas_operation transr_t = rocblas_is_complex<T> ? rocblas_operation_conjugate_transpose
+                                                             : rocblas_operation_transpose;
+
+    // argument sanity check before allocating invalid memory
+    rocblas_int ldak            = transA == rocblas_operation_none ? N : K;
+    bool        invalid_convert = N < 0 || lda < N || lda < 1;
+    bool        invalid_sfrk    = N < 0 || K < 0 || ldb < ldak || ldb < 1;
+    bool        invalid_tfsm    = M < 0 || NB < 0 || ldb < M || ldb < 1;
+    if(invalid_convert || invalid_sfrk || invalid_tfsm || !N)
+    {
+        // the sizes are checked before the pointers, which are only needed for a nonempty call
+        auto status = [](bool invalid, bool empty) {
+            return invalid ? rocblas_status_invalid_size
+                           : empty ? rocblas_status_success : rocblas_status_invalid_pointer;
+        };
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_trttf_fn(handle, rocblas_operation_none, uplo, N, nullptr, lda, nullptr),
+            status(invalid_convert, !N));
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_sfrk_fn(
+                handle, transr_t, uplo, transA, N, K, nullptr, nullptr, ldb, nullptr, nullptr),
+            status(invalid_sfrk, !N));
+        EXPECT_ROCBLAS_STATUS(rocblas_tfsm_fn(handle,
+                                              rocblas_operation_none,
+                                              side,
+                                              uplo,
+                                              transA,
+                                              diag,
+                                              M,
+                                              NB,
+                                              nullptr,
+                                              nullptr,
+                                              nullptr,
+                                              ldb),
+                              status(invalid_tfsm, !M || !NB));
+        return;
+    }
+
+    const size_t      size_rfp = size_t(N) * (N + 1) / 2;
+    const rocblas_int A_row    = transA == rocblas_operation_none ? N : K;
+    const rocblas_int A_col    = transA == rocblas_operation_none ? K : N;
+
+    auto in_triangle = [uplo](rocblas_int i, rocblas_int j) {
+        return uplo == rocblas_fill_lower ? i >= j : i <= j;
+    };
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_matrix<T> hA(N, N, lda);
+    host_matrix<T> hS(N, N, lda);
+    host_matrix<T> hS_1(N, N, lda);
+    host_matrix<T> hS_gold(N, N, lda);
+    host_matrix<T> hC(N, N, lda);
+    host_matrix<T> hC_gold(N, N, lda);
+    host_matrix<T> hAK(A_row, A_col, ldb);
+    host_matrix<T> hB(M, NB, ldb);
+    host_matrix<T> hX(M, NB, ldb);
+    host_matrix<T> hXorB(M, NB, ldb);
+    host_vector<T> hARF(size_rfp);
+    host_vector<T> hARF2(size_rfp);
+    host_vector<T> hP(size_rfp);
+    host_vector<T> hP_gold(size_rfp);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hS.memcheck());
+    CHECK_HIP_ERROR(hS_1.memcheck());
+    CHECK_HIP_ERROR(hS_gold.memcheck());
+    CHECK_HIP_ERROR(hC.memcheck());
+    CHECK_HIP_ERROR(hC_gold.memcheck());
+    CHECK_HIP_ERROR(hAK.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hX.memcheck());
+    CHECK_HIP_ERROR(hXorB.memcheck());
+
+    // Allocate device memory
+    device_matrix<T> dA(N, N, lda);
+    device_matrix<T> dS(N, N, lda);
+    device_matrix<T> dAK(A_row, A_col, ldb);
+    device_matrix<T> dXorB(M, NB, ldb);
+    device_vector<T> dARF(size_rfp);
+    device_vector<T> dARF2(size_rfp);
+    device_vector<T> dP(size_rfp);
+    device_vector<T> d_alpha_T(1);
+    device_vector<U> d_alpha(1);
+    device_vector<U> d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dS.memcheck());
+    CHECK_DEVICE_ALLOCATION(dAK.memcheck());
+    CHECK_DEVICE_ALLOCATION(dXorB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dARF.memcheck());
+    CHECK_DEVICE_ALLOCATION(dARF2.memcheck());
+    CHECK_DEVICE_ALLOCATION(dP.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha_T.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(hA,
+                        arg,
+                        rocblas_client_never_set_nan,
+                        rocblas_client_diagonally_dominant_triangular_matrix,
+                        true);
+    rocblas_init_matrix(
+        hS, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(
+        hC, arg, rocblas_client_never_set_nan, rocblas_client_hermitian_matrix, false, true);
+    rocblas_init_matrix(
+        hAK, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(
+        hX, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
+
+    //  make hA unit diagonal if diag == rocblas_diagonal_unit
+    if(diag == rocblas_diagonal_unit)
+    {
+        make_unit_diagonal(uplo, (T*)hA, lda, N);
+    }
+
+    // tfttr writes the triangle uplo of A over hS and leaves the other triangle as is, and
+    // the packed format holds the triangle column by column
+    hS_gold = hS;
+    size_t p = 0;
+    for(rocblas_int j = 0; j < N; j++)
+        for(rocblas_int i = 0; i < N; i++)
+            if(in_triangle(i, j))
+            {
+                size_t e     = i + size_t(j) * lda;
+                hS_gold[e]   = hA[e];
+                hP_gold[p++] = hA[e];
+            }
+
+    // Calculate hC_gold with the rank K update of the full matrix
+    hC_gold = hC;
+    if constexpr(rocblas_is_complex<T>)
+        cblas_herk<T>(uplo, transA, N, K, alpha, hAK, ldb, beta, hC_gold, lda);
+    else
+        cblas_syrk<T>(uplo, transA, N, K, alpha, hAK, ldb, beta, hC_gold, lda);
+
+    // Calculate hB = hA*hX / alpha; the solution for a zero alpha is zero
+    hB = hX;
+    if(h_alpha != T(0))
+        cblas_trmm<T>(side, uplo, transA, diag, M, NB, 1.0 / h_alpha, hA, lda, hB, ldb);
+    else
+        rocblas_init_zero((T*)hX, M, NB, ldb);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dAK.transfer_from(hAK));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha_T, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(U), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(U), hipMemcpyHostToDevice));
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double error_eps_multiplier   = 40;
+    double eps                    = std::numeric_limits<U>::epsilon();
+    double max_err                = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(auto transr : {rocblas_operation_none, transr_t})
+        {
+            // the conversions are exact
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_trttf_fn(handle, transr, uplo, N, dA, lda, dARF));
+            CHECK_HIP_ERROR(dS.transfer_from(hS));
+            CHECK_ROCBLAS_ERROR(rocblas_tfttr_fn(handle, transr, uplo, N, dARF, dS, lda));
+            CHECK_ROCBLAS_ERROR(rocblas_tfttp_fn(handle, transr, uplo, N, dARF, dP));
+            CHECK_ROCBLAS_ERROR(rocblas_tpttf_fn(handle, transr, uplo, N, dP, dARF2));
+            handle.post_test(arg);
+
+            CHECK_HIP_ERROR(hS_1.transfer_from(dS));
+            CHECK_HIP_ERROR(hP.transfer_from(dP));
+            CHECK_HIP_ERROR(hARF.transfer_from(dARF));
+            CHECK_HIP_ERROR(hARF2.transfer_from(dARF2));
+            unit_check_general<T>(N, N, lda, hS_gold, hS_1);
+            unit_check_general<T>(1, size_rfp, 1, hP_gold, hP);
+            unit_check_general<T>(1, size_rfp, 1, hARF, hARF2);
+
+            for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+            {
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+                const bool host_mode = pointer_mode == rocblas_pointer_mode_host;
+
+                // the rank K update of C in RFP format
+                CHECK_HIP_ERROR(dS.transfer_from(hC));
+                CHECK_ROCBLAS_ERROR(rocblas_trttf_fn(handle, transr, uplo, N, dS, lda, dARF2));
+                handle.pre_test(arg);
+                CHECK_ROCBLAS_ERROR(rocblas_sfrk_fn(handle,
+                                                    transr,
+                                                    uplo,
+                                                    transA,
+                                                    N,
+                                                    K,
+                                                    host_mode ? &alpha : d_alpha,
+                                                    dAK,
+                                                    ldb,
+                                                    host_mode ? &beta : d_beta,
+                                                    dARF2));
+                handle.post_test(arg);
+                CHECK_ROCBLAS_ERROR(rocblas_tfttr_fn(handle, transr, uplo, N, dARF2, dS, lda));
+                CHECK_HIP_ERROR(hS_1.transfer_from(dS));
+
+                if(arg.unit_check)
+                {
+                    const double tol = K * sum_error_tolerance<T>;
+                    near_check_general<T>(N, N, lda, hC_gold, hS_1, tol);
+                }
+                if(arg.norm_check)
+                {
+                    double err = std::abs(norm_check_general<T>('F', N, N, lda, hC_gold, hS_1));
+                    max_err    = std::max(max_err, err);
+                }
+
+                // the solve with A in RFP format; a zero alpha zeroes B exactly, otherwise the
+                // error is ||X - X_sol||_1 / ||X||_1
+                CHECK_HIP_ERROR(dXorB.transfer_from(hB));
+                handle.pre_test(arg);
+                CHECK_ROCBLAS_ERROR(rocblas_tfsm_fn(handle,
+                                                    transr,
+                                                    side,
+                                                    uplo,
+                                                    transA,
+                                                    diag,
+                                                    M,
+                                                    NB,
+                                                    host_mode ? &h_alpha : d_alpha_T,
+                                                    dARF,
+                                                    dXorB,
+                                                    ldb));
+                handle.post_test(arg);
+                CHECK_HIP_ERROR(hXorB.transfer_from(dXorB));
+
+                if(h_alpha == T(0))
+                {
+                    if(arg.unit_check)
+                        unit_check_general<T>(M, NB, ldb, hX, hXorB);
+                }
+                else
+                {
+                    double err = rocblas_abs(matrix_norm_1<T>(M, NB, ldb, hX, hXorB));
+                    if(arg.unit_check)
+                        trsm_err_res_check<T>(err, M, error_eps_multiplier, eps);
+                    max_err = std::max(max_err, err);
+                }
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        // the solve overwrites B, which is left as is between the calls
+        CHECK_ROCBLAS_ERROR(
+            rocblas_trttf_fn(handle, rocblas_operation_none, uplo, N, dA, lda, dARF));
+        CHECK_HIP_ERROR(dXorB.transfer_from(hB));
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_tfsm_fn(handle,
+                            rocblas_operation_none,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            M,
+                            NB,
+                            &h_alpha,
+                            dARF,
+                            dXorB,
+                            ldb);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_tfsm_fn(handle,
+                            rocblas_operation_none,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            M,
+                            NB,
+                            &h_alpha,
+                            dARF,
+                            dXorB,
+                            ldb);
+        });
+
+        ArgumentModel<e_side, e_uplo, e_transA, e_diag, e_N, e_K, e_alpha, e_lda, e_ldb>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         trsm_gflop_count<T>(M, NB, N),
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         max_err);
+    }
+}
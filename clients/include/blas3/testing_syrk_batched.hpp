@@ -346,6 +346,7 @@ void testing_syrk_batched(const Arguments& arg)
         cpu_time_used = get_time_us_no_sync();
 
         // cpu reference
+#pragma omp parallel for
         for(int i = 0; i < batch_count; i++)
         {
             cblas_syrk<T>(uplo, transA, N, K, h_alpha[0], hA[i], lda, h_beta[0], hC_gold[i], ldc);
@@ -0,0 +1,278 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_gemm_offload.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// syrk_offload is a beta feature without Fortran bindings
+template <typename T>
+static rocblas_status (*rocblas_syrk_offload)(rocblas_handle    handle,
+                                              rocblas_fill      uplo,
+                                              rocblas_operation trans_a,
+                                              rocblas_int       n,
+                                              rocblas_int       k,
+                                              const T*          alpha,
+                                              const T*          A,
+                                              rocblas_int       lda,
+                                              const T*          beta,
+                                              T*                C,
+                                              rocblas_int       ldc);
+
+template <>
+static auto rocblas_syrk_offload<float> = rocblas_ssyrk_offload;
+template <>
+static auto rocblas_syrk_offload<double> = rocblas_dsyrk_offload;
+template <>
+static auto rocblas_syrk_offload<rocblas_float_complex> = rocblas_csyrk_offload;
+template <>
+static auto rocblas_syrk_offload<rocblas_double_complex> = rocblas_zsyrk_offload;
+
+template <typename T>
+void testing_syrk_offload_bad_arg(const Arguments& arg)
+{
+    auto rocblas_syrk_offload_fn = rocblas_syrk_offload<T>;
+
+    rocblas_local_handle handle{arg};
+
+    const rocblas_fill      uplo   = rocblas_fill_upper;
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_int       N      = 100;
+    const rocblas_int       K      = 100;
+    const rocblas_int       lda    = 100;
+    const rocblas_int       ldc    = 100;
+
+    // alpha and beta are host pointers whatever the pointer mode
+    const T alpha(1), beta(2), one(1), zero(0);
+
+    // The matrices of the offload are in host memory
+    host_matrix<T> hA(N, K, lda);
+    host_matrix<T> hC(N, N, ldc);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syrk_offload_fn(nullptr, uplo, transA, N, K, &alpha, hA, lda, &beta, hC, ldc),
+        rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syrk_offload_fn(
+            handle, rocblas_fill_full, transA, N, K, &alpha, hA, lda, &beta, hC, ldc),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_syrk_offload_fn(handle,
+                                                  uplo,
+                                                  (rocblas_operation)rocblas_fill_full,
+                                                  N,
+                                                  K,
+                                                  &alpha,
+                                                  hA,
+                                                  lda,
+                                                  &beta,
+                                                  hC,
+                                                  ldc),
+                          rocblas_status_invalid_value);
+
+    // Complex syrk has no conjugate transpose, which is herk
+    if(rocblas_is_complex<T>)
+        EXPECT_ROCBLAS_STATUS(rocblas_syrk_offload_fn(handle,
+                                                      uplo,
+                                                      rocblas_operation_conjugate_transpose,
+                                                      N,
+                                                      K,
+                                                      &alpha,
+                                                      hA,
+                                                      lda,
+                                                      &beta,
+                                                      hC,
+                                                      ldc),
+                              rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syrk_offload_fn(handle, uplo, transA, N, K, &alpha, hA, N - 1, &beta, hC, ldc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syrk_offload_fn(handle, uplo, transA, N, K, &alpha, hA, lda, &beta, hC, N - 1),
+        rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syrk_offload_fn(handle, uplo, transA, N, K, nullptr, hA, lda, &beta, hC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syrk_offload_fn(handle, uplo, transA, N, K, &alpha, hA, lda, nullptr, hC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syrk_offload_fn(handle, uplo, transA, N, K, &alpha, nullptr, lda, &beta, hC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syrk_offload_fn(handle, uplo, transA, N, K, &alpha, hA, lda, &beta, nullptr, ldc),
+        rocblas_status_invalid_pointer);
+
+    // If alpha is 0 and beta is 1, neither A nor C is dereferenced
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syrk_offload_fn(
+            handle, uplo, transA, N, K, &zero, nullptr, lda, &one, nullptr, ldc),
+        rocblas_status_success);
+
+    // If N is 0, nothing is dereferenced
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syrk_offload_fn(
+            handle, uplo, transA, 0, K, nullptr, nullptr, lda, nullptr, nullptr, ldc),
+        rocblas_status_success);
+}
+
+// Only the uplo triangle of C is updated, by the offload and by the CPU syrk alike, so the
+// whole of C is compared
+template <typename T>
+void testing_syrk_offload(const Arguments& arg)
+{
+    auto rocblas_syrk_offload_fn = rocblas_syrk_offload<T>;
+
+    rocblas_fill      uplo    = char2rocblas_fill(arg.uplo);
+    rocblas_operation transA  = char2rocblas_operation(arg.transA);
+    rocblas_int       N       = arg.N;
+    rocblas_int       K       = arg.K;
+    rocblas_int       lda     = arg.lda;
+    rocblas_int       ldc     = arg.ldc;
+    T                 h_alpha = arg.get_alpha<T>();
+    T                 h_beta  = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+    if(!arg.timing)
+        CHECK_ROCBLAS_ERROR(
+            rocblas_set_device_memory_size(handle, rocblas_offload_test_device_memory));
+
+    rocblas_int A_row = transA == rocblas_operation_none ? N : std::max(K, 1);
+    rocblas_int A_col = transA == rocblas_operation_none ? std::max(K, 1) : N;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = N < 0 || K < 0 || ldc < N || lda < A_row;
+    if(invalid_size || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_syrk_offload_fn(
+                handle, uplo, transA, N, K, nullptr, nullptr, lda, nullptr, nullptr, ldc),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hC_1), `d` is in GPU (device) memory.
+    // Allocate host memory
+    host_matrix<T> hA(A_row, A_col, lda);
+    host_matrix<T> hC(N, N, ldc);
+    host_matrix<T> hC_1(N, N, ldc);
+    host_matrix<T> hC_gold(N, N, ldc);
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_symmetric_matrix);
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        hC_gold = hC;
+        cblas_syrk<T>(uplo, transA, N, K, h_alpha, hA, lda, h_beta, hC_gold, ldc);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // pageable and pinned host matrices
+        for(bool pinned : {false, true})
+        {
+            // alpha and beta stay on the host in device pointer mode
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(
+                handle, pinned ? rocblas_pointer_mode_device : rocblas_pointer_mode_host));
+
+            hC_1 = hC;
+            if(pinned)
+            {
+                rocblas_offload_host_register(hA);
+                rocblas_offload_host_register(hC_1);
+            }
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_syrk_offload_fn(
+                handle, uplo, transA, N, K, &h_alpha, hA, lda, &h_beta, hC_1, ldc));
+            handle.post_test(arg);
+
+            if(pinned)
+            {
+                rocblas_offload_host_unregister(hA);
+                rocblas_offload_host_unregister(hC_1);
+            }
+
+            if(arg.unit_check)
+                unit_check_general<T>(N, N, ldc, hC_gold, hC_1);
+
+            if(arg.norm_check)
+                rocblas_error = std::max(
+                    rocblas_error, double(norm_check_general<T>('F', N, N, ldc, hC_gold, hC_1)));
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_syrk_offload_fn(
+                handle, uplo, transA, N, K, &h_alpha, hA, lda, &h_beta, hC_1, ldc);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_syrk_offload_fn(
+                handle, uplo, transA, N, K, &h_alpha, hA, lda, &h_beta, hC_1, ldc);
+        });
+
+        // the time includes the transfers of the pageable host matrices
+        ArgumentModel<e_uplo, e_transA, e_N, e_K, e_alpha, e_lda, e_beta, e_ldc>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            syrk_gflop_count<T>(N, K),
+            ArgumentLogging::NA_value,
+            cpu_time_used,
+            rocblas_error);
+    }
+}
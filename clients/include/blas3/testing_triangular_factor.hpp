@@ -0,0 +1,470 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <vector>
+
+template <typename T>
+void testing_triangular_factor_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    const rocblas_datatype  type        = rocblas_type2datatype<T>();
+    const rocblas_fill      uplo        = rocblas_fill_lower;
+    const rocblas_diagonal  diag        = rocblas_diagonal_non_unit;
+    const rocblas_operation transA      = rocblas_operation_none;
+    const rocblas_int       K           = 100;
+    const rocblas_int       N           = 100;
+    const rocblas_int       lda         = 100;
+    const rocblas_int       ldb         = 100;
+    const rocblas_int       batch_count = 2;
+    const rocblas_stride    stride_A    = size_t(lda) * K;
+    const rocblas_stride    stride_B    = size_t(ldb) * N;
+    const T                 alpha(1);
+
+    device_strided_batch_matrix<T> dA(K, K, lda, stride_A, batch_count);
+    device_strided_batch_matrix<T> dB(K, N, ldb, stride_B, batch_count);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+
+    rocblas_triangular_factor factor;
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_create_triangular_factor(
+            nullptr, uplo, diag, K, dA, lda, stride_A, batch_count, type, &factor),
+        rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_create_triangular_factor(
+            handle, uplo, diag, K, dA, lda, stride_A, batch_count, type, nullptr),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_create_triangular_factor(
+            handle, rocblas_fill_full, diag, K, dA, lda, stride_A, batch_count, type, &factor),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_create_triangular_factor(handle,
+                                                           uplo,
+                                                           (rocblas_diagonal)rocblas_side_both,
+                                                           K,
+                                                           dA,
+                                                           lda,
+                                                           stride_A,
+                                                           batch_count,
+                                                           type,
+                                                           &factor),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_create_triangular_factor(
+            handle, uplo, diag, -1, dA, lda, stride_A, batch_count, type, &factor),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_create_triangular_factor(
+            handle, uplo, diag, K, dA, K - 1, stride_A, batch_count, type, &factor),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_create_triangular_factor(
+            handle, uplo, diag, K, dA, lda, stride_A, -1, type, &factor),
+        rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_create_triangular_factor(
+            handle, uplo, diag, K, nullptr, lda, stride_A, batch_count, type, &factor),
+        rocblas_status_invalid_pointer);
+
+    // Only the real and complex single and double precisions are supported
+    EXPECT_ROCBLAS_STATUS(rocblas_create_triangular_factor(handle,
+                                                           uplo,
+                                                           diag,
+                                                           K,
+                                                           dA,
+                                                           lda,
+                                                           stride_A,
+                                                           batch_count,
+                                                           rocblas_datatype_f16_r,
+                                                           &factor),
+                          rocblas_status_not_implemented);
+
+    // If K or batch_count is 0, A is not dereferenced
+    CHECK_ROCBLAS_ERROR(rocblas_create_triangular_factor(
+        handle, uplo, diag, K, nullptr, lda, stride_A, 0, type, &factor));
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_triangular_factor(factor));
+
+    CHECK_ROCBLAS_ERROR(rocblas_create_triangular_factor(
+        handle, uplo, diag, K, dA, lda, stride_A, batch_count, type, &factor));
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_factor(
+            nullptr, factor, rocblas_side_left, transA, K, N, &alpha, dB, ldb, stride_B),
+        rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_factor(
+            handle, nullptr, rocblas_side_left, transA, K, N, &alpha, dB, ldb, stride_B),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_factor(
+            handle, factor, rocblas_side_both, transA, K, N, &alpha, dB, ldb, stride_B),
+        rocblas_status_invalid_value);
+
+    // The order of A must be M for the left side and N for the right side
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_factor(
+            handle, factor, rocblas_side_left, transA, K + 1, N, &alpha, dB, ldb, stride_B),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_factor(
+            handle, factor, rocblas_side_right, transA, K, N + 1, &alpha, dB, ldb, stride_B),
+        rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_trsv_factor(nullptr, factor, transA, dB, 1, stride_B),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_trsv_factor(handle, nullptr, transA, dB, 1, stride_B),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsv_factor(handle, factor, (rocblas_operation)rocblas_fill_full, dB, 1, stride_B),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_trsv_factor(handle, factor, transA, dB, 0, stride_B),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_trsv_factor(handle, factor, transA, nullptr, 1, stride_B),
+                          rocblas_status_invalid_pointer);
+
+    const void*    invA;
+    rocblas_int    invA_size;
+    rocblas_stride stride_invA;
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_get_triangular_factor_inverse(nullptr, &invA, &invA_size, &stride_invA),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_get_triangular_factor_inverse(factor, nullptr, &invA_size, &stride_invA),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_get_triangular_factor_inverse(factor, &invA, nullptr, &stride_invA),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_triangular_factor_inverse(factor, &invA, &invA_size, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_triangular_factor(factor));
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_triangular_factor(nullptr));
+}
+
+// B is formed from a known solution X as op(A) X / alpha or X op(A) / alpha, as in the trsm
+// test, and b from a known x as op(A) x. Both a strided factor and a batched factor over the
+// same matrices are created once and reused for every solve, which must match X and x.
+template <typename T>
+void testing_triangular_factor(const Arguments& arg)
+{
+    const rocblas_datatype type = rocblas_type2datatype<T>();
+
+    rocblas_side      side        = char2rocblas_side(arg.side);
+    rocblas_fill      uplo        = char2rocblas_fill(arg.uplo);
+    rocblas_operation transA      = char2rocblas_operation(arg.transA);
+    rocblas_diagonal  diag        = char2rocblas_diagonal(arg.diag);
+    rocblas_int       M           = arg.M;
+    rocblas_int       N           = arg.N;
+    rocblas_int       lda         = arg.lda;
+    rocblas_int       ldb         = arg.ldb;
+    rocblas_int       incx        = arg.incx;
+    rocblas_int       batch_count = arg.batch_count;
+    T                 h_alpha     = arg.get_alpha<T>();
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    rocblas_int K = side == rocblas_side_left ? M : N;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_factor = K < 0 || lda < K || lda < 1 || batch_count < 0;
+    bool invalid_size   = invalid_factor || M < 0 || N < 0 || ldb < M || !incx;
+    if(invalid_size || !K || !batch_count)
+    {
+        rocblas_triangular_factor factor;
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_create_triangular_factor(
+                handle, uplo, diag, K, nullptr, lda, 0, batch_count, type, &factor),
+            invalid_factor ? rocblas_status_invalid_size : rocblas_status_success);
+        if(invalid_factor)
+            return;
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_trsm_factor(handle, factor, side, transA, M, N, nullptr, nullptr, ldb, 0),
+            M < 0 || N < 0 || ldb < M ? rocblas_status_invalid_size : rocblas_status_success);
+        EXPECT_ROCBLAS_STATUS(rocblas_trsv_factor(handle, factor, transA, nullptr, incx, 0),
+                              !incx ? rocblas_status_invalid_size : rocblas_status_success);
+        CHECK_ROCBLAS_ERROR(rocblas_destroy_triangular_factor(factor));
+        return;
+    }
+
+    size_t         abs_incx = size_t(incx >= 0 ? incx : -incx);
+    rocblas_stride stride_A = size_t(lda) * K;
+    rocblas_stride stride_B = size_t(ldb) * N;
+    rocblas_stride stride_x = abs_incx * K;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_strided_batch_matrix<T> hA(K, K, lda, stride_A, batch_count);
+    host_strided_batch_matrix<T> hB(M, N, ldb, stride_B, batch_count);
+    host_strided_batch_matrix<T> hX(M, N, ldb, stride_B, batch_count);
+    host_strided_batch_matrix<T> hXorB(M, N, ldb, stride_B, batch_count);
+    host_strided_batch_vector<T> hb(K, incx, stride_x, batch_count);
+    host_strided_batch_vector<T> hx(K, incx, stride_x, batch_count);
+    host_strided_batch_vector<T> hx_or_b(K, incx, stride_x, batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hX.memcheck());
+    CHECK_HIP_ERROR(hXorB.memcheck());
+    CHECK_HIP_ERROR(hb.memcheck());
+    CHECK_HIP_ERROR(hx.memcheck());
+    CHECK_HIP_ERROR(hx_or_b.memcheck());
+
+    // Allocate device memory
+    device_strided_batch_matrix<T> dA(K, K, lda, stride_A, batch_count);
+    device_strided_batch_matrix<T> dXorB(M, N, ldb, stride_B, batch_count);
+    device_strided_batch_vector<T> dx_or_b(K, incx, stride_x, batch_count);
+    device_vector<T>               d_alpha(1);
+    device_vector<T*>              dA_arr(batch_count);
+    device_vector<T*>              dXorB_arr(batch_count);
+    device_vector<T*>              dx_or_b_arr(batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dXorB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_or_b.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_arr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dXorB_arr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_or_b_arr.memcheck());
+
+    // The batched factor and its solves use arrays of pointers into the strided matrices
+    std::vector<T*> hA_arr(batch_count), hXorB_arr(batch_count), hx_or_b_arr(batch_count);
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        hA_arr[b]      = dA[b];
+        hXorB_arr[b]   = dXorB[b];
+        hx_or_b_arr[b] = dx_or_b[b];
+    }
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA_arr, hA_arr.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dXorB_arr, hXorB_arr.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dx_or_b_arr, hx_or_b_arr.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    // Initialize data on host memory
+    rocblas_init_matrix(hA,
+                        arg,
+                        rocblas_client_never_set_nan,
+                        rocblas_client_diagonally_dominant_triangular_matrix,
+                        true);
+    rocblas_init_matrix(
+        hX, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_vector(hx, arg, rocblas_client_never_set_nan, false, true);
+
+    //  make hA unit diagonal if diag == rocblas_diagonal_unit
+    if(diag == rocblas_diagonal_unit)
+    {
+        make_unit_diagonal(uplo, hA);
+    }
+
+    // Calculate hB = hA*hX / alpha; the solution for a zero alpha is zero
+    hB.copy_from(hX);
+    hb.copy_from(hx);
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        if(h_alpha != T(0))
+            cblas_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / h_alpha, hA[b], lda, hB[b], ldb);
+        else
+            rocblas_init_zero(hX[b], M, N, ldb);
+
+        cblas_trmv<T>(uplo, transA, diag, K, hA[b], lda, hb[b], incx);
+    }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    rocblas_triangular_factor strided, batched;
+    CHECK_ROCBLAS_ERROR(rocblas_create_triangular_factor(
+        handle, uplo, diag, K, dA, lda, stride_A, batch_count, type, &strided));
+    CHECK_ROCBLAS_ERROR(rocblas_create_triangular_factor_batched(handle,
+                                                                 uplo,
+                                                                 diag,
+                                                                 K,
+                                                                 (const void* const*)(T**)dA_arr,
+                                                                 lda,
+                                                                 batch_count,
+                                                                 type,
+                                                                 &batched));
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double error_eps_multiplier   = 40;
+    double eps                    = std::numeric_limits<real_t<T>>::epsilon();
+    double max_err                = 0.0;
+
+    // A zero alpha zeroes B exactly, otherwise the error is ||X - X_sol||_1 / ||X||_1
+    auto check_X = [&]() {
+        CHECK_HIP_ERROR(hXorB.transfer_from(dXorB));
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            if(h_alpha == T(0))
+            {
+                if(arg.unit_check)
+                    unit_check_general<T>(M, N, ldb, hX[b], hXorB[b]);
+            }
+            else
+            {
+                double err = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hX[b], hXorB[b]));
+                if(arg.unit_check)
+                    trsm_err_res_check<T>(err, K, error_eps_multiplier, eps);
+                max_err = std::max(max_err, err);
+            }
+        }
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+            const T* alpha = pointer_mode == rocblas_pointer_mode_host ? &h_alpha : d_alpha;
+
+            // each factor is reused for several solves
+            for(auto factor : {strided, batched, strided})
+            {
+                void* B = factor == batched ? (void*)(T**)dXorB_arr : (void*)(T*)dXorB;
+                void* x = factor == batched ? (void*)(T**)dx_or_b_arr : (void*)(T*)dx_or_b;
+
+                CHECK_HIP_ERROR(dXorB.transfer_from(hB));
+                handle.pre_test(arg);
+                CHECK_ROCBLAS_ERROR(rocblas_trsm_factor(
+                    handle, factor, side, transA, M, N, alpha, B, ldb, stride_B));
+                handle.post_test(arg);
+                check_X();
+
+                CHECK_HIP_ERROR(dx_or_b.transfer_from(hb));
+                handle.pre_test(arg);
+                CHECK_ROCBLAS_ERROR(rocblas_trsv_factor(handle, factor, transA, x, incx, stride_x));
+                handle.post_test(arg);
+                CHECK_HIP_ERROR(hx_or_b.transfer_from(dx_or_b));
+
+                for(rocblas_int b = 0; b < batch_count; b++)
+                {
+                    double err = rocblas_abs(vector_norm_1<T>(K, abs_incx, hx[b], hx_or_b[b]));
+                    if(arg.unit_check)
+                        trsm_err_res_check<T>(err, K, error_eps_multiplier, eps);
+                    max_err = std::max(max_err, err);
+                }
+            }
+        }
+
+        // the inverses can be passed to rocblas_trsm_strided_batched_ex directly
+        const void*    invA;
+        rocblas_int    invA_size;
+        rocblas_stride stride_invA;
+        CHECK_ROCBLAS_ERROR(
+            rocblas_get_triangular_factor_inverse(strided, &invA, &invA_size, &stride_invA));
+        EXPECT_EQ(invA_size, 128 * K);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dXorB.transfer_from(hB));
+        CHECK_ROCBLAS_ERROR(rocblas_trsm_strided_batched_ex(handle,
+                                                            side,
+                                                            uplo,
+                                                            transA,
+                                                            diag,
+                                                            M,
+                                                            N,
+                                                            &h_alpha,
+                                                            dA,
+                                                            lda,
+                                                            stride_A,
+                                                            dXorB,
+                                                            ldb,
+                                                            stride_B,
+                                                            batch_count,
+                                                            invA,
+                                                            invA_size,
+                                                            stride_invA,
+                                                            type));
+        check_X();
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        // the solve overwrites B, which is left as is between the calls
+        CHECK_HIP_ERROR(dXorB.transfer_from(hB));
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_trsm_factor(
+                handle, strided, side, transA, M, N, &h_alpha, dXorB, ldb, stride_B);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_trsm_factor(
+                handle, strided, side, transA, M, N, &h_alpha, dXorB, ldb, stride_B);
+        });
+
+        // the time excludes the inversion of the diagonal blocks when the factor is created
+        ArgumentModel<e_side,
+                      e_uplo,
+                      e_transA,
+                      e_diag,
+                      e_M,
+                      e_N,
+                      e_alpha,
+                      e_lda,
+                      e_ldb,
+                      e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         trsm_gflop_count<T>(M, N, K),
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         max_err);
+    }
+
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_triangular_factor(strided));
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_triangular_factor(batched));
+}
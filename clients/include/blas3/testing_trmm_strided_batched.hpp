@@ -545,6 +545,7 @@ void testing_trmm_strided_batched(const Arguments& arg)
             cpu_time_used = get_time_us_no_sync();
         }
 
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
         {
             cblas_trmm<T>(side, uplo, transA, diag, M, N, alpha, hA[b], lda, hB_gold[b], ldb);
@@ -0,0 +1,302 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_gemm_offload.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// trsm_offload is a beta feature without Fortran bindings
+template <typename T>
+static rocblas_status (*rocblas_trsm_offload)(rocblas_handle    handle,
+                                              rocblas_side      side,
+                                              rocblas_fill      uplo,
+                                              rocblas_operation trans_a,
+                                              rocblas_diagonal  diag,
+                                              rocblas_int       m,
+                                              rocblas_int       n,
+                                              const T*          alpha,
+                                              const T*          A,
+                                              rocblas_int       lda,
+                                              T*                B,
+                                              rocblas_int       ldb);
+
+template <>
+static auto rocblas_trsm_offload<float> = rocblas_strsm_offload;
+template <>
+static auto rocblas_trsm_offload<double> = rocblas_dtrsm_offload;
+template <>
+static auto rocblas_trsm_offload<rocblas_float_complex> = rocblas_ctrsm_offload;
+template <>
+static auto rocblas_trsm_offload<rocblas_double_complex> = rocblas_ztrsm_offload;
+
+template <typename T>
+void testing_trsm_offload_bad_arg(const Arguments& arg)
+{
+    auto rocblas_trsm_offload_fn = rocblas_trsm_offload<T>;
+
+    rocblas_local_handle handle{arg};
+
+    const rocblas_side      side   = rocblas_side_left;
+    const rocblas_fill      uplo   = rocblas_fill_upper;
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_diagonal  diag   = rocblas_diagonal_non_unit;
+    const rocblas_int       M      = 100;
+    const rocblas_int       N      = 100;
+    const rocblas_int       lda    = 100;
+    const rocblas_int       ldb    = 100;
+
+    // alpha is a host pointer whatever the pointer mode
+    const T alpha(1), zero(0);
+
+    // The matrices of the offload are in host memory
+    host_matrix<T> hA(M, M, lda);
+    host_matrix<T> hB(M, N, ldb);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_offload_fn(nullptr, side, uplo, transA, diag, M, N, &alpha, hA, lda, hB, ldb),
+        rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_offload_fn(
+            handle, rocblas_side_both, uplo, transA, diag, M, N, &alpha, hA, lda, hB, ldb),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_offload_fn(
+            handle, side, rocblas_fill_full, transA, diag, M, N, &alpha, hA, lda, hB, ldb),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_trsm_offload_fn(handle,
+                                                  side,
+                                                  uplo,
+                                                  (rocblas_operation)rocblas_fill_full,
+                                                  diag,
+                                                  M,
+                                                  N,
+                                                  &alpha,
+                                                  hA,
+                                                  lda,
+                                                  hB,
+                                                  ldb),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_trsm_offload_fn(handle,
+                                                  side,
+                                                  uplo,
+                                                  transA,
+                                                  (rocblas_diagonal)rocblas_side_both,
+                                                  M,
+                                                  N,
+                                                  &alpha,
+                                                  hA,
+                                                  lda,
+                                                  hB,
+                                                  ldb),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_offload_fn(handle, side, uplo, transA, diag, M, N, &alpha, hA, M - 1, hB, ldb),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_offload_fn(handle, side, uplo, transA, diag, M, N, &alpha, hA, lda, hB, M - 1),
+        rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_offload_fn(handle, side, uplo, transA, diag, M, N, nullptr, hA, lda, hB, ldb),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_offload_fn(
+            handle, side, uplo, transA, diag, M, N, &alpha, nullptr, lda, hB, ldb),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_offload_fn(
+            handle, side, uplo, transA, diag, M, N, &alpha, hA, lda, nullptr, ldb),
+        rocblas_status_invalid_pointer);
+
+    // If alpha is 0, A is not dereferenced and B is zeroed on the host
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_offload_fn(
+            handle, side, uplo, transA, diag, M, N, &zero, nullptr, lda, hB, ldb),
+        rocblas_status_success);
+
+    // If M is 0, nothing is dereferenced
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_offload_fn(
+            handle, side, uplo, transA, diag, 0, N, nullptr, nullptr, lda, nullptr, ldb),
+        rocblas_status_success);
+}
+
+// B is formed from a known solution X as op(A) X / alpha or X op(A) / alpha, as in the trsm
+// test, and the solve of the offload is compared with X
+template <typename T>
+void testing_trsm_offload(const Arguments& arg)
+{
+    auto rocblas_trsm_offload_fn = rocblas_trsm_offload<T>;
+
+    rocblas_side      side    = char2rocblas_side(arg.side);
+    rocblas_fill      uplo    = char2rocblas_fill(arg.uplo);
+    rocblas_operation transA  = char2rocblas_operation(arg.transA);
+    rocblas_diagonal  diag    = char2rocblas_diagonal(arg.diag);
+    rocblas_int       M       = arg.M;
+    rocblas_int       N       = arg.N;
+    rocblas_int       lda     = arg.lda;
+    rocblas_int       ldb     = arg.ldb;
+    T                 h_alpha = arg.get_alpha<T>();
+
+    rocblas_local_handle handle{arg};
+    if(!arg.timing)
+        CHECK_ROCBLAS_ERROR(
+            rocblas_set_device_memory_size(handle, rocblas_offload_test_device_memory));
+
+    rocblas_int K = side == rocblas_side_left ? M : N;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || lda < K || ldb < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_trsm_offload_fn(
+                handle, side, uplo, transA, diag, M, N, nullptr, nullptr, lda, nullptr, ldb),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hXorB_1), `d` is in GPU (device) memory.
+    // Allocate host memory
+    host_matrix<T> hA(K, K, lda);
+    host_matrix<T> hB(M, N, ldb);
+    host_matrix<T> hX(M, N, ldb);
+    host_matrix<T> hXorB_1(M, N, ldb);
+
+    // Initialize data on host memory
+    rocblas_init_matrix(hA,
+                        arg,
+                        rocblas_client_never_set_nan,
+                        rocblas_client_diagonally_dominant_triangular_matrix,
+                        true);
+    rocblas_init_matrix(
+        hX, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
+
+    //  make hA unit diagonal if diag == rocblas_diagonal_unit
+    if(diag == rocblas_diagonal_unit)
+    {
+        make_unit_diagonal(uplo, (T*)hA, lda, K);
+    }
+
+    // Calculate hB = hA*hX / alpha; the solution for a zero alpha is zero
+    hB = hX;
+    if(h_alpha != T(0))
+        cblas_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / h_alpha, hA, lda, hB, ldb);
+    else
+        rocblas_init_zero((T*)hX, M, N, ldb);
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double error_eps_multiplier   = 40;
+    double eps                    = std::numeric_limits<real_t<T>>::epsilon();
+    double max_err                = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // pageable and pinned host matrices
+        for(bool pinned : {false, true})
+        {
+            // alpha stays on the host in device pointer mode
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(
+                handle, pinned ? rocblas_pointer_mode_device : rocblas_pointer_mode_host));
+
+            hXorB_1 = hB;
+            if(pinned)
+            {
+                rocblas_offload_host_register(hA);
+                rocblas_offload_host_register(hXorB_1);
+            }
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_trsm_offload_fn(
+                handle, side, uplo, transA, diag, M, N, &h_alpha, hA, lda, hXorB_1, ldb));
+            handle.post_test(arg);
+
+            if(pinned)
+            {
+                rocblas_offload_host_unregister(hA);
+                rocblas_offload_host_unregister(hXorB_1);
+            }
+
+            // A zero alpha zeroes B exactly, otherwise the error is ||X - X_sol||_1 / ||X||_1
+            if(h_alpha == T(0))
+            {
+                if(arg.unit_check)
+                    unit_check_general<T>(M, N, ldb, hX, hXorB_1);
+            }
+            else
+            {
+                double err = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hX, hXorB_1));
+                if(arg.unit_check)
+                    trsm_err_res_check<T>(err, M, error_eps_multiplier, eps);
+                max_err = std::max(max_err, err);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        // the solve overwrites B, which is left as is between the calls
+        hXorB_1 = hB;
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_trsm_offload_fn(
+                handle, side, uplo, transA, diag, M, N, &h_alpha, hA, lda, hXorB_1, ldb);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_trsm_offload_fn(
+                handle, side, uplo, transA, diag, M, N, &h_alpha, hA, lda, hXorB_1, ldb);
+        });
+
+        // the time includes the transfers of the pageable host matrices
+        ArgumentModel<e_side, e_uplo, e_transA, e_diag, e_M, e_N, e_alpha, e_lda, e_ldb>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         trsm_gflop_count<T>(M, N, K),
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         max_err);
+    }
+}
@@ -709,6 +709,7 @@ void testing_trsm_strided_batched(const Arguments& arg)
         // CPU cblas
         cpu_time_used = get_time_us_no_sync();
 
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
             cblas_trsm<T>(side, uplo, transA, diag, M, N, alpha_h, hA[b], lda, cpuXorB[b], ldb);
 
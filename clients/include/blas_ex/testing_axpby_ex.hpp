@@ -0,0 +1,436 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// copy_scal_ex with the arguments of axpby_ex, beta being ignored
+inline rocblas_status testing_copy_scal_ex_fn(rocblas_handle   handle,
+                                              rocblas_int      n,
+                                              const void*      alpha,
+                                              rocblas_datatype alpha_type,
+                                              const void*      x,
+                                              rocblas_datatype x_type,
+                                              rocblas_int      incx,
+                                              const void*      beta,
+                                              void*            y,
+                                              rocblas_datatype y_type,
+                                              rocblas_int      incy,
+                                              rocblas_datatype execution_type)
+{
+    return rocblas_copy_scal_ex(
+        handle, n, alpha, alpha_type, x, x_type, incx, y, y_type, incy, execution_type);
+}
+
+/* ============================================================================================ */
+template <typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty, bool COPY = false>
+void testing_axpby_ex_bad_arg(const Arguments& arg)
+{
+    auto rocblas_axpby_ex_fn = COPY ? testing_copy_scal_ex_fn : rocblas_axpby_ex;
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_datatype alpha_type     = rocblas_type2datatype<Ta>();
+        rocblas_datatype x_type         = rocblas_type2datatype<Tx>();
+        rocblas_datatype y_type         = rocblas_type2datatype<Ty>();
+        rocblas_datatype execution_type = rocblas_type2datatype<Tex>();
+
+        rocblas_int N = 100, incx = 1, incy = 1;
+
+        device_vector<Ta> alpha_d(1), one_d(1), zero_d(1);
+
+        const Ta alpha_h(1), one_h(1), zero_h(0);
+
+        const Ta* alpha = &alpha_h;
+        const Ta* one   = &one_h;
+        const Ta* zero  = &zero_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(one_d, one, sizeof(*one), hipMemcpyHostToDevice));
+            one = one_d;
+            CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+            zero = zero_d;
+        }
+
+        device_vector<Tx> dx(N);
+        device_vector<Ty> dy(N);
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_ex_fn(nullptr,
+                                                  N,
+                                                  alpha,
+                                                  alpha_type,
+                                                  dx,
+                                                  x_type,
+                                                  incx,
+                                                  one,
+                                                  dy,
+                                                  y_type,
+                                                  incy,
+                                                  execution_type),
+                              rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_ex_fn(handle,
+                                                  N,
+                                                  nullptr,
+                                                  alpha_type,
+                                                  dx,
+                                                  x_type,
+                                                  incx,
+                                                  one,
+                                                  dy,
+                                                  y_type,
+                                                  incy,
+                                                  execution_type),
+                              rocblas_status_invalid_pointer);
+
+        if(!COPY)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_axpby_ex_fn(handle,
+                                                      N,
+                                                      alpha,
+                                                      alpha_type,
+                                                      dx,
+                                                      x_type,
+                                                      incx,
+                                                      nullptr,
+                                                      dy,
+                                                      y_type,
+                                                      incy,
+                                                      execution_type),
+                                  rocblas_status_invalid_pointer);
+
+            // Conversions between x and y are only supported without beta
+            EXPECT_ROCBLAS_STATUS(rocblas_axpby_ex_fn(handle,
+                                                      N,
+                                                      alpha,
+                                                      rocblas_datatype_f64_r,
+                                                      dx,
+                                                      rocblas_datatype_f64_r,
+                                                      incx,
+                                                      one,
+                                                      dy,
+                                                      rocblas_datatype_f32_r,
+                                                      incy,
+                                                      rocblas_datatype_f64_r),
+                                  rocblas_status_not_implemented);
+        }
+
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_ex_fn(handle,
+                                                  N,
+                                                  alpha,
+                                                  alpha_type,
+                                                  dx,
+                                                  x_type,
+                                                  incx,
+                                                  one,
+                                                  dy,
+                                                  rocblas_datatype_i8_r,
+                                                  incy,
+                                                  execution_type),
+                              rocblas_status_not_implemented);
+
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_axpby_ex_fn(handle,
+                                                      N,
+                                                      alpha,
+                                                      alpha_type,
+                                                      nullptr,
+                                                      x_type,
+                                                      incx,
+                                                      one,
+                                                      dy,
+                                                      y_type,
+                                                      incy,
+                                                      execution_type),
+                                  rocblas_status_invalid_pointer);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_axpby_ex_fn(handle,
+                                                      N,
+                                                      alpha,
+                                                      alpha_type,
+                                                      dx,
+                                                      x_type,
+                                                      incx,
+                                                      one,
+                                                      nullptr,
+                                                      y_type,
+                                                      incy,
+                                                      execution_type),
+                                  rocblas_status_invalid_pointer);
+
+            // If alpha == 0 and beta == 1, then X and Y can be nullptr without error
+            if(!COPY)
+                EXPECT_ROCBLAS_STATUS(rocblas_axpby_ex_fn(handle,
+                                                          N,
+                                                          zero,
+                                                          alpha_type,
+                                                          nullptr,
+                                                          x_type,
+                                                          incx,
+                                                          one,
+                                                          nullptr,
+                                                          y_type,
+                                                          incy,
+                                                          execution_type),
+                                      rocblas_status_success);
+        }
+
+        // If N == 0, then alpha, beta, X and Y can be nullptr without error
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_ex_fn(handle,
+                                                  0,
+                                                  nullptr,
+                                                  alpha_type,
+                                                  nullptr,
+                                                  x_type,
+                                                  incx,
+                                                  nullptr,
+                                                  nullptr,
+                                                  y_type,
+                                                  incy,
+                                                  execution_type),
+                              rocblas_status_success);
+    }
+}
+
+template <typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty>
+void testing_copy_scal_ex_bad_arg(const Arguments& arg)
+{
+    testing_axpby_ex_bad_arg<Ta, Tx, Ty, Tex, true>(arg);
+}
+
+template <typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty, bool COPY = false>
+void testing_axpby_ex(const Arguments& arg)
+{
+    auto rocblas_axpby_ex_fn = COPY ? testing_copy_scal_ex_fn : rocblas_axpby_ex;
+
+    rocblas_datatype alpha_type     = arg.a_type;
+    rocblas_datatype x_type         = arg.b_type;
+    rocblas_datatype y_type         = arg.c_type;
+    rocblas_datatype execution_type = arg.compute_type;
+
+    rocblas_int          N       = arg.N;
+    rocblas_int          incx    = arg.incx;
+    rocblas_int          incy    = arg.incy;
+    Ta                   h_alpha = arg.get_alpha<Ta>();
+    Ta                   h_beta  = COPY ? Ta(0) : arg.get_beta<Ta>();
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_axpby_ex_fn(handle,
+                                                N,
+                                                nullptr,
+                                                alpha_type,
+                                                nullptr,
+                                                x_type,
+                                                incx,
+                                                nullptr,
+                                                nullptr,
+                                                y_type,
+                                                incy,
+                                                execution_type));
+        return;
+    }
+
+    size_t abs_incy = std::abs(incy);
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_vector<Tx> hx(N, incx ? incx : 1);
+    host_vector<Ty> hy_1(N, incy ? incy : 1);
+    host_vector<Ty> hy_2(N, incy ? incy : 1);
+    host_vector<Ty> hy_gold(N, incy ? incy : 1);
+
+    // Allocate device memory
+    device_vector<Tx> dx(N, incx ? incx : 1);
+    device_vector<Ty> dy_1(N, incy ? incy : 1);
+    device_vector<Ty> dy_2(N, incy ? incy : 1);
+    device_vector<Ta> d_alpha(1);
+    device_vector<Ta> d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory, y is not read when beta is zero or for copy_scal_ex
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy_1, arg, rocblas_client_beta_sets_nan, false, true);
+    if(COPY)
+        rocblas_init_nan<Ty>(hy_1, hy_1.size());
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy_1.transfer_from(hy_1));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dy_2.transfer_from(hy_2));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Ta), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Ta), hipMemcpyHostToDevice));
+        handle.pre_test(arg);
+        // ROCBLAS pointer mode host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_axpby_ex_fn(handle,
+                                                N,
+                                                &h_alpha,
+                                                alpha_type,
+                                                dx,
+                                                x_type,
+                                                incx,
+                                                &h_beta,
+                                                dy_1,
+                                                y_type,
+                                                incy,
+                                                execution_type));
+        handle.post_test(arg);
+        // ROCBLAS pointer mode device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_axpby_ex_fn(handle,
+                                                N,
+                                                d_alpha,
+                                                alpha_type,
+                                                dx,
+                                                x_type,
+                                                incx,
+                                                d_beta,
+                                                dy_2,
+                                                y_type,
+                                                incy,
+                                                execution_type));
+        handle.post_test(arg);
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy_1));
+        CHECK_HIP_ERROR(hy_2.transfer_from(dy_2));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        cblas_axpby_ex<Ta, Tx, Ty, Tex>(N, h_alpha, hx, incx, h_beta, hy_gold, incy);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<Ty>(1, N, abs_incy, hy_gold, hy_1);
+            unit_check_general<Ty>(1, N, abs_incy, hy_gold, hy_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<Ty>('F', 1, N, abs_incy, hy_gold, hy_1);
+            rocblas_error_2 = norm_check_general<Ty>('F', 1, N, abs_incy, hy_gold, hy_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_axpby_ex_fn(handle,
+                                N,
+                                &h_alpha,
+                                alpha_type,
+                                dx,
+                                x_type,
+                                incx,
+                                &h_beta,
+                                dy_1,
+                                y_type,
+                                incy,
+                                execution_type);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_axpby_ex_fn(handle,
+                                N,
+                                &h_alpha,
+                                alpha_type,
+                                dx,
+                                x_type,
+                                incx,
+                                &h_beta,
+                                dy_1,
+                                y_type,
+                                incy,
+                                execution_type);
+        });
+
+        // copy_scal_ex does not read y
+        double gflops = COPY ? scal_gflop_count<Tx, Ta>(N) : axpby_gflop_count<Tx>(N);
+        double gbytes = COPY ? copy_gbyte_count<Tx>(N) : axpy_gbyte_count<Tx>(N);
+
+        ArgumentModel<e_N, e_alpha, e_beta, e_incx, e_incy>{}.log_args<Ta>(rocblas_cout,
+                                                                           arg,
+                                                                           gpu_time_used,
+                                                                           gflops,
+                                                                           gbytes,
+                                                                           cpu_time_used,
+                                                                           rocblas_error_1,
+                                                                           rocblas_error_2);
+    }
+}
+
+template <typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty>
+void testing_copy_scal_ex(const Arguments& arg)
+{
+    testing_axpby_ex<Ta, Tx, Ty, Tex, true>(arg);
+}
@@ -0,0 +1,547 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// copy_scal_strided_batched_ex with the arguments of axpby_strided_batched_ex, beta being ignored
+inline rocblas_status testing_copy_scal_strided_batched_ex_fn(rocblas_handle   handle,
+                                                              rocblas_int      n,
+                                                              const void*      alpha,
+                                                              rocblas_datatype alpha_type,
+                                                              const void*      x,
+                                                              rocblas_datatype x_type,
+                                                              rocblas_int      incx,
+                                                              rocblas_stride   stride_x,
+                                                              const void*      beta,
+                                                              void*            y,
+                                                              rocblas_datatype y_type,
+                                                              rocblas_int      incy,
+                                                              rocblas_stride   stride_y,
+                                                              rocblas_int      batch_count,
+                                                              rocblas_datatype execution_type)
+{
+    return rocblas_copy_scal_strided_batched_ex(handle,
+                                                n,
+                                                alpha,
+                                                alpha_type,
+                                                x,
+                                                x_type,
+                                                incx,
+                                                stride_x,
+                                                y,
+                                                y_type,
+                                                incy,
+                                                stride_y,
+                                                batch_count,
+                                                execution_type);
+}
+
+/* ============================================================================================ */
+template <typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty, bool COPY = false>
+void testing_axpby_strided_batched_ex_bad_arg(const Arguments& arg)
+{
+    auto rocblas_axpby_strided_batched_ex_fn
+        = COPY ? testing_copy_scal_strided_batched_ex_fn : rocblas_axpby_strided_batched_ex;
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_datatype alpha_type     = rocblas_type2datatype<Ta>();
+        rocblas_datatype x_type         = rocblas_type2datatype<Tx>();
+        rocblas_datatype y_type         = rocblas_type2datatype<Ty>();
+        rocblas_datatype execution_type = rocblas_type2datatype<Tex>();
+
+        rocblas_int N = 100, incx = 1, incy = 1, batch_count = 2;
+
+        rocblas_stride stridex = N, stridey = N;
+
+        device_vector<Ta> alpha_d(1), one_d(1), zero_d(1);
+
+        const Ta alpha_h(1), one_h(1), zero_h(0);
+
+        const Ta* alpha = &alpha_h;
+        const Ta* one   = &one_h;
+        const Ta* zero  = &zero_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(one_d, one, sizeof(*one), hipMemcpyHostToDevice));
+            one = one_d;
+            CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+            zero = zero_d;
+        }
+
+        device_strided_batch_vector<Tx> dx(N, incx, stridex, batch_count);
+        device_strided_batch_vector<Ty> dy(N, incy, stridey, batch_count);
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_strided_batched_ex_fn(nullptr,
+                                                                  N,
+                                                                  alpha,
+                                                                  alpha_type,
+                                                                  dx,
+                                                                  x_type,
+                                                                  incx,
+                                                                  stridex,
+                                                                  one,
+                                                                  dy,
+                                                                  y_type,
+                                                                  incy,
+                                                                  stridey,
+                                                                  batch_count,
+                                                                  execution_type),
+                              rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_strided_batched_ex_fn(handle,
+                                                                  N,
+                                                                  nullptr,
+                                                                  alpha_type,
+                                                                  dx,
+                                                                  x_type,
+                                                                  incx,
+                                                                  stridex,
+                                                                  one,
+                                                                  dy,
+                                                                  y_type,
+                                                                  incy,
+                                                                  stridey,
+                                                                  batch_count,
+                                                                  execution_type),
+                              rocblas_status_invalid_pointer);
+
+        if(!COPY)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_axpby_strided_batched_ex_fn(handle,
+                                                                      N,
+                                                                      alpha,
+                                                                      alpha_type,
+                                                                      dx,
+                                                                      x_type,
+                                                                      incx,
+                                                                      stridex,
+                                                                      nullptr,
+                                                                      dy,
+                                                                      y_type,
+                                                                      incy,
+                                                                      stridey,
+                                                                      batch_count,
+                                                                      execution_type),
+                                  rocblas_status_invalid_pointer);
+
+            // Conversions between x and y are only supported without beta
+            EXPECT_ROCBLAS_STATUS(rocblas_axpby_strided_batched_ex_fn(handle,
+                                                                      N,
+                                                                      alpha,
+                                                                      rocblas_datatype_f64_r,
+                                                                      dx,
+                                                                      rocblas_datatype_f64_r,
+                                                                      incx,
+                                                                      stridex,
+                                                                      one,
+                                                                      dy,
+                                                                      rocblas_datatype_f32_r,
+                                                                      incy,
+                                                                      stridey,
+                                                                      batch_count,
+                                                                      rocblas_datatype_f64_r),
+                                  rocblas_status_not_implemented);
+        }
+
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_strided_batched_ex_fn(handle,
+                                                                  N,
+                                                                  alpha,
+                                                                  alpha_type,
+                                                                  dx,
+                                                                  x_type,
+                                                                  incx,
+                                                                  stridex,
+                                                                  one,
+                                                                  dy,
+                                                                  rocblas_datatype_i8_r,
+                                                                  incy,
+                                                                  stridey,
+                                                                  batch_count,
+                                                                  execution_type),
+                              rocblas_status_not_implemented);
+
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_axpby_strided_batched_ex_fn(handle,
+                                                                      N,
+                                                                      alpha,
+                                                                      alpha_type,
+                                                                      nullptr,
+                                                                      x_type,
+                                                                      incx,
+                                                                      stridex,
+                                                                      one,
+                                                                      dy,
+                                                                      y_type,
+                                                                      incy,
+                                                                      stridey,
+                                                                      batch_count,
+                                                                      execution_type),
+                                  rocblas_status_invalid_pointer);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_axpby_strided_batched_ex_fn(handle,
+                                                                      N,
+                                                                      alpha,
+                                                                      alpha_type,
+                                                                      dx,
+                                                                      x_type,
+                                                                      incx,
+                                                                      stridex,
+                                                                      one,
+                                                                      nullptr,
+                                                                      y_type,
+                                                                      incy,
+                                                                      stridey,
+                                                                      batch_count,
+                                                                      execution_type),
+                                  rocblas_status_invalid_pointer);
+
+            // If alpha == 0 and beta == 1, then X and Y can be nullptr without error
+            if(!COPY)
+                EXPECT_ROCBLAS_STATUS(rocblas_axpby_strided_batched_ex_fn(handle,
+                                                                          N,
+                                                                          zero,
+                                                                          alpha_type,
+                                                                          nullptr,
+                                                                          x_type,
+                                                                          incx,
+                                                                          stridex,
+                                                                          one,
+                                                                          nullptr,
+                                                                          y_type,
+                                                                          incy,
+                                                                          stridey,
+                                                                          batch_count,
+                                                                          execution_type),
+                                      rocblas_status_success);
+        }
+
+        // If N == 0, then alpha, beta, X and Y can be nullptr without error
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_strided_batched_ex_fn(handle,
+                                                                  0,
+                                                                  nullptr,
+                                                                  alpha_type,
+                                                                  nullptr,
+                                                                  x_type,
+                                                                  incx,
+                                                                  stridex,
+                                                                  nullptr,
+                                                                  nullptr,
+                                                                  y_type,
+                                                                  incy,
+                                                                  stridey,
+                                                                  batch_count,
+                                                                  execution_type),
+                              rocblas_status_success);
+
+        // If batch_count == 0, then alpha, beta, X and Y can be nullptr without error
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_strided_batched_ex_fn(handle,
+                                                                  N,
+                                                                  nullptr,
+                                                                  alpha_type,
+                                                                  nullptr,
+                                                                  x_type,
+                                                                  incx,
+                                                                  stridex,
+                                                                  nullptr,
+                                                                  nullptr,
+                                                                  y_type,
+                                                                  incy,
+                                                                  stridey,
+                                                                  0,
+                                                                  execution_type),
+                              rocblas_status_success);
+    }
+}
+
+template <typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty>
+void testing_copy_scal_strided_batched_ex_bad_arg(const Arguments& arg)
+{
+    testing_axpby_strided_batched_ex_bad_arg<Ta, Tx, Ty, Tex, true>(arg);
+}
+
+template <typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty, bool COPY = false>
+void testing_axpby_strided_batched_ex(const Arguments& arg)
+{
+    auto rocblas_axpby_strided_batched_ex_fn
+        = COPY ? testing_copy_scal_strided_batched_ex_fn : rocblas_axpby_strided_batched_ex;
+
+    rocblas_datatype alpha_type     = arg.a_type;
+    rocblas_datatype x_type         = arg.b_type;
+    rocblas_datatype y_type         = arg.c_type;
+    rocblas_datatype execution_type = arg.compute_type;
+
+    rocblas_local_handle handle{arg};
+    rocblas_int          N = arg.N, incx = arg.incx, incy = arg.incy, batch_count = arg.batch_count;
+
+    rocblas_stride stridex = arg.stride_x, stridey = arg.stride_y;
+    if(!stridex)
+        stridex = N;
+    if(!stridey)
+        stridey = N;
+
+    Ta h_alpha = arg.get_alpha<Ta>();
+    Ta h_beta  = COPY ? Ta(0) : arg.get_beta<Ta>();
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || batch_count <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_strided_batched_ex_fn(handle,
+                                                                  N,
+                                                                  nullptr,
+                                                                  alpha_type,
+                                                                  nullptr,
+                                                                  x_type,
+                                                                  incx,
+                                                                  stridex,
+                                                                  nullptr,
+                                                                  nullptr,
+                                                                  y_type,
+                                                                  incy,
+                                                                  stridey,
+                                                                  batch_count,
+                                                                  execution_type),
+                              rocblas_status_success);
+        return;
+    }
+
+    size_t abs_incy = std::abs(incy);
+    size_t size_y   = N * (abs_incy ? abs_incy : 1);
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    host_strided_batch_vector<Tx> hx(N, incx ? incx : 1, stridex, batch_count);
+    host_strided_batch_vector<Ty> hy(N, incy ? incy : 1, stridey, batch_count),
+        hy1(N, incy ? incy : 1, stridey, batch_count),
+        hy2(N, incy ? incy : 1, stridey, batch_count);
+    host_vector<Ta> halpha(1), hbeta(1);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hx.memcheck());
+    CHECK_HIP_ERROR(hy.memcheck());
+    CHECK_HIP_ERROR(hy1.memcheck());
+    CHECK_HIP_ERROR(hy2.memcheck());
+    CHECK_HIP_ERROR(halpha.memcheck());
+    CHECK_HIP_ERROR(hbeta.memcheck());
+
+    // Allocate device memory
+    device_strided_batch_vector<Tx> dx(N, incx ? incx : 1, stridex, batch_count);
+    device_strided_batch_vector<Ty> dy(N, incy ? incy : 1, stridey, batch_count);
+    device_vector<Ta>               dalpha(1), dbeta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dalpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(dbeta.memcheck());
+
+    // Assign host alpha and beta.
+    halpha[0] = h_alpha;
+    hbeta[0]  = h_beta;
+
+    // Initialize data on host memory, y is not read when beta is zero or for copy_scal_ex
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_beta_sets_nan, false);
+    if(COPY)
+        for(rocblas_int b = 0; b < batch_count; b++)
+            rocblas_init_nan<Ty>(hy[b], size_y);
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    // Transfer host to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // Pointer mode host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_axpby_strided_batched_ex_fn(handle,
+                                                                N,
+                                                                halpha,
+                                                                alpha_type,
+                                                                dx,
+                                                                x_type,
+                                                                incx,
+                                                                stridex,
+                                                                hbeta,
+                                                                dy,
+                                                                y_type,
+                                                                incy,
+                                                                stridey,
+                                                                batch_count,
+                                                                execution_type));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hy1.transfer_from(dy));
+
+        // Pointer mode device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(dalpha.transfer_from(halpha));
+        CHECK_HIP_ERROR(dbeta.transfer_from(hbeta));
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_axpby_strided_batched_ex_fn(handle,
+                                                                N,
+                                                                dalpha,
+                                                                alpha_type,
+                                                                dx,
+                                                                x_type,
+                                                                incx,
+                                                                stridex,
+                                                                dbeta,
+                                                                dy,
+                                                                y_type,
+                                                                incy,
+                                                                stridey,
+                                                                batch_count,
+                                                                execution_type));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hy2.transfer_from(dy));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+#pragma omp parallel for
+        for(rocblas_int b = 0; b < batch_count; ++b)
+        {
+            cblas_axpby_ex<Ta, Tx, Ty, Tex>(N, h_alpha, hx[b], incx, h_beta, hy[b], incy);
+        }
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<Ty>(1, N, abs_incy, stridey, hy, hy1, batch_count);
+            unit_check_general<Ty>(1, N, abs_incy, stridey, hy, hy2, batch_count);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1
+                = norm_check_general<Ty>('I', 1, N, abs_incy, stridey, hy, hy1, batch_count);
+            rocblas_error_2
+                = norm_check_general<Ty>('I', 1, N, abs_incy, stridey, hy, hy2, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        // Transfer from host to device.
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_axpby_strided_batched_ex_fn(handle,
+                                                N,
+                                                &h_alpha,
+                                                alpha_type,
+                                                dx,
+                                                x_type,
+                                                incx,
+                                                stridex,
+                                                &h_beta,
+                                                dy,
+                                                y_type,
+                                                incy,
+                                                stridey,
+                                                batch_count,
+                                                execution_type);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_axpby_strided_batched_ex_fn(handle,
+                                                N,
+                                                &h_alpha,
+                                                alpha_type,
+                                                dx,
+                                                x_type,
+                                                incx,
+                                                stridex,
+                                                &h_beta,
+                                                dy,
+                                                y_type,
+                                                incy,
+                                                stridey,
+                                                batch_count,
+                                                execution_type);
+        });
+
+        // copy_scal_ex does not read y
+        double gflops = COPY ? scal_gflop_count<Tx, Ta>(N) : axpby_gflop_count<Tx>(N);
+        double gbytes = COPY ? copy_gbyte_count<Tx>(N) : axpy_gbyte_count<Tx>(N);
+
+        ArgumentModel<e_N,
+                      e_alpha,
+                      e_beta,
+                      e_incx,
+                      e_incy,
+                      e_stride_x,
+                      e_stride_y,
+                      e_batch_count>{}
+            .log_args<Ta>(rocblas_cout,
+                          arg,
+                          gpu_time_used,
+                          gflops,
+                          gbytes,
+                          cpu_time_used,
+                          rocblas_error_1,
+                          rocblas_error_2);
+    }
+}
+
+template <typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty>
+void testing_copy_scal_strided_batched_ex(const Arguments& arg)
+{
+    testing_axpby_strided_batched_ex<Ta, Tx, Ty, Tex, true>(arg);
+}
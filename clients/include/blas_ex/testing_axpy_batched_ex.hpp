@@ -336,6 +336,7 @@ void testing_axpy_batched_ex(const Arguments& arg)
             cpu_time_used = get_time_us_no_sync();
 
             // Compute the host solution.
+#pragma omp parallel for
             for(rocblas_int b = 0; b < batch_count; ++b)
             {
                 cblas_axpy<Tex>(N, h_alpha_ex, hx_ex[b], incx, hy_ex[b], incy);
@@ -395,9 +396,7 @@ void testing_axpy_batched_ex(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_axpy_batched_ex_fn(handle,
                                        N,
                                        &h_alpha,
@@ -410,8 +409,7 @@ void testing_axpy_batched_ex(const Arguments& arg)
                                        incy,
                                        batch_count,
                                        execution_type);
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_N, e_alpha, e_incx, e_incy, e_batch_count>{}.log_args<Ta>(
             rocblas_cout,
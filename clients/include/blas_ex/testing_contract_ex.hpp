@@ -0,0 +1,373 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// The tests contract
+//     D[i1, j, i2, l] = alpha * sum_{k1, k2} A[k1, i1, k2, i2, l] * B[j, k2, k1, l]
+//                       + beta * C[i1, j, i2, l],
+// with the indices listed from the fastest, so that A and B are transposed, i2 is looped over on
+// the host and k2 accumulates into D. The sizes are listed as the free indices of A (i1, i2),
+// of B (j), the bound (k1, k2) and the batch (l) indices.
+struct rocblas_contract_ex_layout
+{
+    int64_t        sizes[6];
+    rocblas_stride strides_a[5];
+    rocblas_stride strides_b[4];
+    rocblas_stride strides_c[4];
+    size_t         size_a, size_b, size_c;
+
+    rocblas_contract_ex_layout(int64_t I1, int64_t J, int64_t K1, int64_t L)
+    {
+        const int64_t I2 = 3, K2 = 2;
+
+        const int64_t        s[]  = {I1, I2, J, K1, K2, L};
+        const rocblas_stride sa[] = {K1, K1 * I1 * K2, 1, K1 * I1, K1 * I1 * K2 * I2};
+        const rocblas_stride sb[] = {1, J * K2, J, J * K2 * K1};
+        const rocblas_stride sc[] = {1, I1 * J, I1, I1 * J * I2};
+        std::copy(s, s + 6, sizes);
+        std::copy(sa, sa + 5, strides_a);
+        std::copy(sb, sb + 4, strides_b);
+        std::copy(sc, sc + 4, strides_c);
+
+        size_a = K1 * I1 * K2 * I2 * L;
+        size_b = J * K2 * K1 * L;
+        size_c = I1 * J * I2 * L;
+    }
+};
+
+template <typename Ti, typename To = Ti, typename Tc = To>
+void testing_contract_ex_bad_arg(const Arguments& arg)
+{
+    const rocblas_contract_ex_layout t(8, 4, 4, 2);
+
+    const rocblas_datatype  a_type       = arg.a_type;
+    const rocblas_datatype  b_type       = arg.b_type;
+    const rocblas_datatype  c_type       = arg.c_type;
+    const rocblas_datatype  d_type       = arg.d_type;
+    const rocblas_datatype  compute_type = arg.compute_type;
+    const rocblas_gemm_algo algo         = rocblas_gemm_algo_standard;
+
+    // sizes with a negative free index of A, and with an empty free index of B
+    const int64_t         bad_sizes[] = {8, -1, 4, 4, 2, 2};
+    const int64_t         no_sizes[]  = {8, 3, 0, 4, 2, 2};
+    const int64_t*        sizes       = t.sizes;
+    const rocblas_stride* sa          = t.strides_a;
+    const rocblas_stride* sb          = t.strides_b;
+    const rocblas_stride* sc          = t.strides_c;
+
+    rocblas_local_handle handle{arg};
+
+    // Allocate device memory
+    device_vector<Ti> dA(t.size_a);
+    device_vector<Ti> dB(t.size_b);
+    device_vector<To> dC(t.size_c);
+    device_vector<To> dD(t.size_c);
+    device_vector<Tc> alpha_d(1), beta_d(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(alpha_d.memcheck());
+    CHECK_DEVICE_ALLOCATION(beta_d.memcheck());
+
+    const Tc alpha_h(1), beta_h(1);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const Tc* alpha = &alpha_h;
+        const Tc* beta  = &beta_h;
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(beta_d, beta, sizeof(*beta), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            beta  = beta_d;
+        }
+
+        // clang-format off
+EXPECT_ROCBLAS_STATUS(rocblas_contract_ex(nullptr, 2, 1, 2, 1, sizes, alpha, dA, a_type, sa, dB, b_type, sb, beta, dC, c_type, sc, dD, d_type, sc, compute_type, algo, 0, 0), rocblas_status_invalid_handle);
+
+EXPECT_ROCBLAS_STATUS(rocblas_contract_ex(handle, -1, 1, 2, 1, sizes, alpha, dA, a_type, sa, dB, b_type, sb, beta, dC, c_type, sc, dD, d_type, sc, compute_type, algo, 0, 0), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_contract_ex(handle, 2, 1, -1, 1, sizes, alpha, dA, a_type, sa, dB, b_type, sb, beta, dC, c_type, sc, dD, d_type, sc, compute_type, algo, 0, 0), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_contract_ex(handle, 2, 1, 2, 1, bad_sizes, alpha, dA, a_type, sa, dB, b_type, sb, beta, dC, c_type, sc, dD, d_type, sc, compute_type, algo, 0, 0), rocblas_status_invalid_size);
+
+EXPECT_ROCBLAS_STATUS(rocblas_contract_ex(handle, 2, 1, 2, 1, nullptr, alpha, dA, a_type, sa, dB, b_type, sb, beta, dC, c_type, sc, dD, d_type, sc, compute_type, algo, 0, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_contract_ex(handle, 2, 1, 2, 1, sizes, alpha, dA, a_type, nullptr, dB, b_type, sb, beta, dC, c_type, sc, dD, d_type, sc, compute_type, algo, 0, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_contract_ex(handle, 2, 1, 2, 1, sizes, alpha, dA, a_type, sa, dB, b_type, nullptr, beta, dC, c_type, sc, dD, d_type, sc, compute_type, algo, 0, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_contract_ex(handle, 2, 1, 2, 1, sizes, alpha, dA, a_type, sa, dB, b_type, sb, beta, dC, c_type, nullptr, dD, d_type, sc, compute_type, algo, 0, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_contract_ex(handle, 2, 1, 2, 1, sizes, alpha, dA, a_type, sa, dB, b_type, sb, beta, dC, c_type, sc, dD, d_type, nullptr, compute_type, algo, 0, 0), rocblas_status_invalid_pointer);
+
+EXPECT_ROCBLAS_STATUS(rocblas_contract_ex(handle, 2, 1, 2, 1, sizes, nullptr, dA, a_type, sa, dB, b_type, sb, beta, dC, c_type, sc, dD, d_type, sc, compute_type, algo, 0, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_contract_ex(handle, 2, 1, 2, 1, sizes, alpha, nullptr, a_type, sa, dB, b_type, sb, beta, dC, c_type, sc, dD, d_type, sc, compute_type, algo, 0, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_contract_ex(handle, 2, 1, 2, 1, sizes, alpha, dA, a_type, sa, nullptr, b_type, sb, beta, dC, c_type, sc, dD, d_type, sc, compute_type, algo, 0, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_contract_ex(handle, 2, 1, 2, 1, sizes, alpha, dA, a_type, sa, dB, b_type, sb, nullptr, dC, c_type, sc, dD, d_type, sc, compute_type, algo, 0, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_contract_ex(handle, 2, 1, 2, 1, sizes, alpha, dA, a_type, sa, dB, b_type, sb, beta, nullptr, c_type, sc, dD, d_type, sc, compute_type, algo, 0, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_contract_ex(handle, 2, 1, 2, 1, sizes, alpha, dA, a_type, sa, dB, b_type, sb, beta, dC, c_type, sc, nullptr, d_type, sc, compute_type, algo, 0, 0), rocblas_status_invalid_pointer);
+
+// If a free or batch index is empty, the tensor pointers and scalars are not checked
+EXPECT_ROCBLAS_STATUS(rocblas_contract_ex(handle, 2, 1, 2, 1, no_sizes, nullptr, nullptr, a_type, sa, nullptr, b_type, sb, nullptr, nullptr, c_type, sc, nullptr, d_type, sc, compute_type, algo, 0, 0), rocblas_status_success);
+        // clang-format on
+    }
+}
+
+// contract_ex must match the contraction computed on the host in Tc, with C and D distinct and in
+// place, and with alpha and beta on the host and on the device
+template <typename Ti, typename To = Ti, typename Tc = To>
+void testing_contract_ex(const Arguments& arg)
+{
+    const int64_t I1 = arg.M, J = arg.N, K1 = arg.K, L = arg.batch_count;
+
+    const rocblas_datatype  a_type       = arg.a_type;
+    const rocblas_datatype  b_type       = arg.b_type;
+    const rocblas_datatype  c_type       = arg.c_type;
+    const rocblas_datatype  d_type       = arg.d_type;
+    const rocblas_datatype  compute_type = arg.compute_type;
+    const rocblas_gemm_algo algo         = rocblas_gemm_algo(arg.algo);
+
+    Tc h_alpha = arg.get_alpha<Tc>();
+    Tc h_beta  = arg.get_beta<Tc>();
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = I1 < 0 || J < 0 || K1 < 0 || L < 0;
+    if(invalid_size || !I1 || !J || !L)
+    {
+        const rocblas_contract_ex_layout t(std::max<int64_t>(I1, 0),
+                                           std::max<int64_t>(J, 0),
+                                           std::max<int64_t>(K1, 0),
+                                           std::max<int64_t>(L, 0));
+        int64_t sizes[6];
+        std::copy(t.sizes, t.sizes + 6, sizes);
+        sizes[0] = I1;
+        sizes[2] = J;
+        sizes[3] = K1;
+        sizes[5] = L;
+        EXPECT_ROCBLAS_STATUS(rocblas_contract_ex(handle,
+                                                  2,
+                                                  1,
+                                                  2,
+                                                  1,
+                                                  sizes,
+                                                  nullptr,
+                                                  nullptr,
+                                                  a_type,
+                                                  t.strides_a,
+                                                  nullptr,
+                                                  b_type,
+                                                  t.strides_b,
+                                                  nullptr,
+                                                  nullptr,
+                                                  c_type,
+                                                  t.strides_c,
+                                                  nullptr,
+                                                  d_type,
+                                                  t.strides_c,
+                                                  compute_type,
+                                                  algo,
+                                                  arg.solution_index,
+                                                  arg.flags),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    const rocblas_contract_ex_layout t(I1, J, K1, L);
+    const int64_t                    I2 = t.sizes[1], K2 = t.sizes[4];
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_vector<Ti> hA(t.size_a);
+    host_vector<Ti> hB(t.size_b);
+    host_vector<To> hC(t.size_c);
+    host_vector<To> hD_1(t.size_c);
+    host_vector<To> hD_2(t.size_c);
+    host_vector<To> hD_3(t.size_c);
+    host_vector<To> hD_gold(t.size_c);
+    host_vector<Tc> halpha(1), hbeta(1);
+    halpha[0] = h_alpha;
+    hbeta[0]  = h_beta;
+
+    // Allocate device memory
+    device_vector<Ti> dA(t.size_a);
+    device_vector<Ti> dB(t.size_b);
+    device_vector<To> dC(t.size_c);
+    device_vector<To> dD(t.size_c);
+    device_vector<Tc> d_alpha(1), d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hA, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hB, arg, rocblas_client_alpha_sets_nan, false);
+    rocblas_init_vector(hC, arg, rocblas_client_beta_sets_nan, false);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+    CHECK_HIP_ERROR(d_beta.transfer_from(hbeta));
+
+    auto contract = [&](const Tc* alpha, const Tc* beta, const To* c, To* d) {
+        return rocblas_contract_ex(handle,
+                                   2,
+                                   1,
+                                   2,
+                                   1,
+                                   t.sizes,
+                                   alpha,
+                                   dA,
+                                   a_type,
+                                   t.strides_a,
+                                   dB,
+                                   b_type,
+                                   t.strides_b,
+                                   beta,
+                                   c,
+                                   c_type,
+                                   t.strides_c,
+                                   d,
+                                   d_type,
+                                   t.strides_c,
+                                   compute_type,
+                                   algo,
+                                   arg.solution_index,
+                                   arg.flags);
+    };
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+    double rocblas_error_3 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(contract(&h_alpha, &h_beta, dC, dD));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hD_1.transfer_from(dD));
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(contract(d_alpha, d_beta, dC, dD));
+        CHECK_HIP_ERROR(hD_2.transfer_from(dD));
+
+        // D in place of C
+        CHECK_ROCBLAS_ERROR(contract(d_alpha, d_beta, dC, dC));
+        CHECK_HIP_ERROR(hD_3.transfer_from(dC));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
+        for(int64_t l = 0; l < L; l++)
+            for(int64_t i2 = 0; i2 < I2; i2++)
+                for(int64_t j = 0; j < J; j++)
+                    for(int64_t i1 = 0; i1 < I1; i1++)
+                    {
+                        Tc sum(0);
+                        for(int64_t k2 = 0; k2 < K2; k2++)
+                            for(int64_t k1 = 0; k1 < K1; k1++)
+                                sum += Tc(hA[i1 * t.strides_a[0] + i2 * t.strides_a[1]
+                                             + k1 * t.strides_a[2] + k2 * t.strides_a[3]
+                                             + l * t.strides_a[4]])
+                                       * Tc(hB[j * t.strides_b[0] + k1 * t.strides_b[1]
+                                               + k2 * t.strides_b[2] + l * t.strides_b[3]]);
+                        size_t ic = i1 * t.strides_c[0] + i2 * t.strides_c[1]
+                                    + j * t.strides_c[2] + l * t.strides_c[3];
+                        hD_gold[ic] = To(h_alpha * sum + h_beta * Tc(hC[ic]));
+                    }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // D is checked as an I1 x (J * I2 * L) matrix
+        const rocblas_int M = I1, N = J * I2 * L;
+        if(arg.unit_check)
+        {
+            unit_check_general<To>(M, N, M, hD_gold, hD_1);
+            unit_check_general<To>(M, N, M, hD_gold, hD_2);
+            unit_check_general<To>(M, N, M, hD_gold, hD_3);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<To>('F', M, N, M, hD_gold, hD_1);
+            rocblas_error_2 = norm_check_general<To>('F', M, N, M, hD_gold, hD_2);
+            rocblas_error_3 = norm_check_general<To>('F', M, N, M, hD_gold, hD_3);
+            rocblas_error_1 = std::max(rocblas_error_1, rocblas_error_3);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        auto contract_ex = [&] { contract(&h_alpha, &h_beta, dC, dD); };
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+            contract_ex();
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, contract_ex);
+
+        // Each batch is a GEMM of op(A) of (I1 * I2) x (K1 * K2) and op(B) of (K1 * K2) x J
+        ArgumentModel<e_M, e_N, e_K, e_alpha, e_beta, e_batch_count>{}.log_args<Tc>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            gemm_gflop_count<Tc>(I1 * I2, J, K1 * K2),
+            gemm_gbyte_count<Ti, To>(I1 * I2, J, K1 * K2),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
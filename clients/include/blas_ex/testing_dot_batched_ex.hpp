@@ -332,10 +332,7 @@ void testing_dot_batched_ex(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             (rocblas_dot_batched_ex_fn)(handle,
                                         N,
                                         dx.ptr_on_device(),
@@ -348,9 +345,7 @@ void testing_dot_batched_ex(const Arguments& arg)
                                         d_rocblas_result_2,
                                         result_type,
                                         execution_type);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_N, e_incx, e_incy, e_batch_count, e_algo>{}.log_args<Tx>(
             rocblas_cout,
@@ -505,6 +505,31 @@ void testing_geam_ex_bad_arg(const Arguments& arg)
                                                  compute_type,
                                                  geam_ex_op),
                               rocblas_status_success);
+
+        // unknown operation
+        EXPECT_ROCBLAS_STATUS(rocblas_geam_ex_fn(handle,
+                                                 transA,
+                                                 transB,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 alpha,
+                                                 dA,
+                                                 a_type,
+                                                 lda,
+                                                 dB,
+                                                 b_type,
+                                                 ldb,
+                                                 beta,
+                                                 dC,
+                                                 c_type,
+                                                 ldc,
+                                                 dD,
+                                                 d_type,
+                                                 ldd,
+                                                 compute_type,
+                                                 rocblas_geam_ex_operation(0x4)),
+                              rocblas_status_invalid_value);
     }
 }
 
@@ -703,9 +728,13 @@ void testing_geam_ex(const Arguments& arg)
         // reference calculation for golden result
         cpu_time_used = get_time_us_no_sync();
 
-        auto cblas_geam_ex_fn = geam_ex_op == rocblas_geam_ex_operation_min_plus
-                                    ? cblas_geam_min_plus<T>
-                                    : cblas_geam_plus_min<T>;
+        auto cblas_geam_ex_fn = cblas_geam_min_plus<T>;
+        if(geam_ex_op == rocblas_geam_ex_operation_plus_min)
+            cblas_geam_ex_fn = cblas_geam_plus_min<T>;
+        else if(geam_ex_op == rocblas_geam_ex_operation_max_plus)
+            cblas_geam_ex_fn = cblas_geam_max_plus<T>;
+        else if(geam_ex_op == rocblas_geam_ex_operation_max_min)
+            cblas_geam_ex_fn = cblas_geam_max_min<T>;
 
         cblas_geam_ex_fn(transA,
                          transB,
@@ -0,0 +1,493 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <vector>
+
+// The block sparsity of A of mb block rows and kb block columns: block row I has I % 4 blocks, at
+// most kb, in block columns (I + s) % kb, so that some block rows are empty and the block columns
+// of a block row are not always sorted. Returns nnzb.
+inline rocblas_int rocblas_block_sparse_pattern(rocblas_int               mb,
+                                                rocblas_int               kb,
+                                                std::vector<rocblas_int>& row_ptr,
+                                                std::vector<rocblas_int>& col_ind)
+{
+    row_ptr.assign(1, 0);
+    col_ind.clear();
+    for(rocblas_int I = 0; I < mb; I++)
+    {
+        for(rocblas_int s = 0; s < std::min(I % 4, kb); s++)
+            col_ind.push_back((I + s) % kb);
+        row_ptr.push_back(rocblas_int(col_ind.size()));
+    }
+    return rocblas_int(col_ind.size());
+}
+
+template <typename T>
+void testing_gemm_block_sparse_ex_bad_arg(const Arguments& arg)
+{
+    const rocblas_int mb = 2;
+    const rocblas_int kb = 2;
+    const rocblas_int N  = 4;
+    const rocblas_int bd = 4;
+    const rocblas_int M  = mb * bd;
+    const rocblas_int K  = kb * bd;
+
+    const rocblas_int ldb = K;
+    const rocblas_int ldc = M;
+    const rocblas_int ldd = M;
+
+    const rocblas_operation opN = rocblas_operation_none;
+
+    const rocblas_datatype  type = rocblas_type2datatype<T>();
+    const rocblas_gemm_algo algo = rocblas_gemm_algo_standard;
+
+    rocblas_local_handle handle{arg};
+
+    // One block in each block row, on the diagonal
+    const rocblas_int        nnzb    = 2;
+    std::vector<rocblas_int> row_ptr = {0, 1, 2}, col_ind = {0, 1};
+
+    // Allocate device memory
+    device_vector<rocblas_int> drow_ptr(mb + 1);
+    device_vector<rocblas_int> dcol_ind(nnzb);
+    device_vector<T>           dval(size_t(nnzb) * bd * bd);
+    device_matrix<T>           dB(K, N, ldb);
+    device_matrix<T>           dC(M, N, ldc);
+    device_matrix<T>           dD(M, N, ldd);
+    device_vector<T>           alpha_d(1), beta_d(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(drow_ptr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dcol_ind.memcheck());
+    CHECK_DEVICE_ALLOCATION(dval.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(alpha_d.memcheck());
+    CHECK_DEVICE_ALLOCATION(beta_d.memcheck());
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        drow_ptr, row_ptr.data(), sizeof(rocblas_int) * row_ptr.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcol_ind, col_ind.data(), sizeof(rocblas_int) * col_ind.size(), hipMemcpyHostToDevice));
+
+    const T alpha_h(1), beta_h(1);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const T* alpha = &alpha_h;
+        const T* beta  = &beta_h;
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(beta_d, beta, sizeof(*beta), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            beta  = beta_d;
+        }
+
+        // clang-format off
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(nullptr, opN, mb, N, kb, nnzb, bd, alpha, drow_ptr, dcol_ind, dval, type, dB, type, ldb, beta, dC, type, ldc, dD, type, ldd, type, algo, 0, 0), rocblas_status_invalid_handle);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, (rocblas_operation)rocblas_side_both, mb, N, kb, nnzb, bd, alpha, drow_ptr, dcol_ind, dval, type, dB, type, ldb, beta, dC, type, ldc, dD, type, ldd, type, algo, 0, 0), rocblas_status_invalid_value);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, -1, N, kb, nnzb, bd, alpha, drow_ptr, dcol_ind, dval, type, dB, type, ldb, beta, dC, type, ldc, dD, type, ldd, type, algo, 0, 0), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, -1, kb, nnzb, bd, alpha, drow_ptr, dcol_ind, dval, type, dB, type, ldb, beta, dC, type, ldc, dD, type, ldd, type, algo, 0, 0), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, N, -1, nnzb, bd, alpha, drow_ptr, dcol_ind, dval, type, dB, type, ldb, beta, dC, type, ldc, dD, type, ldd, type, algo, 0, 0), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, N, kb, -1, bd, alpha, drow_ptr, dcol_ind, dval, type, dB, type, ldb, beta, dC, type, ldc, dD, type, ldd, type, algo, 0, 0), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, N, kb, nnzb, -1, alpha, drow_ptr, dcol_ind, dval, type, dB, type, ldb, beta, dC, type, ldc, dD, type, ldd, type, algo, 0, 0), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, N, kb, nnzb, bd, alpha, drow_ptr, dcol_ind, dval, type, dB, type, K - 1, beta, dC, type, ldc, dD, type, ldd, type, algo, 0, 0), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, N, kb, nnzb, bd, alpha, drow_ptr, dcol_ind, dval, type, dB, type, ldb, beta, dC, type, M - 1, dD, type, ldd, type, algo, 0, 0), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, N, kb, nnzb, bd, alpha, drow_ptr, dcol_ind, dval, type, dB, type, ldb, beta, dC, type, ldc, dD, type, M - 1, type, algo, 0, 0), rocblas_status_invalid_size);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, N, kb, nnzb, bd, alpha, nullptr, dcol_ind, dval, type, dB, type, ldb, beta, dC, type, ldc, dD, type, ldd, type, algo, 0, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, N, kb, nnzb, bd, alpha, drow_ptr, nullptr, dval, type, dB, type, ldb, beta, dC, type, ldc, dD, type, ldd, type, algo, 0, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, N, kb, nnzb, bd, alpha, drow_ptr, dcol_ind, nullptr, type, dB, type, ldb, beta, dC, type, ldc, dD, type, ldd, type, algo, 0, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, N, kb, nnzb, bd, alpha, drow_ptr, dcol_ind, dval, type, nullptr, type, ldb, beta, dC, type, ldc, dD, type, ldd, type, algo, 0, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, N, kb, nnzb, bd, nullptr, drow_ptr, dcol_ind, dval, type, dB, type, ldb, beta, dC, type, ldc, dD, type, ldd, type, algo, 0, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, N, kb, nnzb, bd, alpha, drow_ptr, dcol_ind, dval, type, dB, type, ldb, nullptr, dC, type, ldc, dD, type, ldd, type, algo, 0, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, N, kb, nnzb, bd, alpha, drow_ptr, dcol_ind, dval, type, dB, type, ldb, beta, dC, type, ldc, nullptr, type, ldd, type, algo, 0, 0), rocblas_status_invalid_pointer);
+
+// The block row pointers must end at nnzb and the block column indices must be below kb
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, N, kb, nnzb - 1, bd, alpha, drow_ptr, dcol_ind, dval, type, dB, type, ldb, beta, dC, type, ldc, dD, type, ldd, type, algo, 0, 0), rocblas_status_invalid_value);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, N, 1, nnzb, bd, alpha, drow_ptr, dcol_ind, dval, type, dB, type, ldb, beta, dC, type, ldc, dD, type, ldd, type, algo, 0, 0), rocblas_status_invalid_value);
+
+// If M or N is 0, nothing is dereferenced
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, 0, N, kb, nnzb, bd, nullptr, nullptr, nullptr, nullptr, type, nullptr, type, ldb, nullptr, nullptr, type, ldc, nullptr, type, ldd, type, algo, 0, 0), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, 0, kb, nnzb, bd, nullptr, nullptr, nullptr, nullptr, type, nullptr, type, ldb, nullptr, nullptr, type, ldc, nullptr, type, ldd, type, algo, 0, 0), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle, opN, mb, N, kb, nnzb, 0, nullptr, nullptr, nullptr, nullptr, type, nullptr, type, 1, nullptr, nullptr, type, 1, nullptr, type, 1, type, algo, 0, 0), rocblas_status_success);
+        // clang-format on
+    }
+}
+
+// rocblas_gemm_block_sparse_ex of a block sparse A of M block rows and K block columns of
+// block_dim lda, with the pattern of rocblas_block_sparse_pattern, by a dense op( B ) of N columns.
+// D must match the sum of the products of the blocks with alpha and beta on the host and on the
+// device, for D distinct from C and in place.
+template <typename T>
+void testing_gemm_block_sparse_ex(const Arguments& arg)
+{
+    const rocblas_int mb = arg.M;
+    const rocblas_int N  = arg.N;
+    const rocblas_int kb = arg.K;
+    const rocblas_int bd = arg.lda;
+
+    const rocblas_int ldb = arg.ldb;
+    const rocblas_int ldc = arg.ldc;
+    const rocblas_int ldd = arg.ldd;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    const rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    const rocblas_datatype  type           = rocblas_type2datatype<T>();
+    const rocblas_gemm_algo algo           = rocblas_gemm_algo(arg.algo);
+    const int32_t           solution_index = arg.solution_index;
+    const uint32_t          flags          = arg.flags;
+
+    rocblas_local_handle handle{arg};
+
+    const rocblas_int M = mb * bd;
+    const rocblas_int K = kb * bd;
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = mb < 0 || N < 0 || kb < 0 || bd < 0 || ldc < M || ldd < M
+                        || ldb < (transB == rocblas_operation_none ? K : N);
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_block_sparse_ex(handle,
+                                                           transB,
+                                                           mb,
+                                                           N,
+                                                           kb,
+                                                           0,
+                                                           bd,
+                                                           nullptr,
+                                                           nullptr,
+                                                           nullptr,
+                                                           nullptr,
+                                                           type,
+                                                           nullptr,
+                                                           type,
+                                                           ldb,
+                                                           nullptr,
+                                                           nullptr,
+                                                           type,
+                                                           ldc,
+                                                           nullptr,
+                                                           type,
+                                                           ldd,
+                                                           type,
+                                                           algo,
+                                                           solution_index,
+                                                           flags),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    std::vector<rocblas_int> row_ptr, col_ind;
+    const rocblas_int        nnzb = rocblas_block_sparse_pattern(mb, kb, row_ptr, col_ind);
+
+    rocblas_int B_row = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : std::max(K, 1);
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error          = 0.0;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_vector<T> hval(size_t(nnzb) * bd * bd);
+    host_matrix<T> hB(B_row, B_col, ldb);
+    host_matrix<T> hC(M, N, ldc);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hval.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hC.memcheck());
+
+    // Allocate device memory
+    device_vector<rocblas_int> drow_ptr(mb + 1);
+    device_vector<rocblas_int> dcol_ind(nnzb);
+    device_vector<T>           dval(size_t(nnzb) * bd * bd);
+    device_matrix<T>           dB(B_row, B_col, ldb);
+    device_matrix<T>           dC(M, N, ldc);
+    device_matrix<T>           dD(M, N, ldd);
+    device_vector<T>           d_alpha(1);
+    device_vector<T>           d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(drow_ptr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dcol_ind.memcheck());
+    CHECK_DEVICE_ALLOCATION(dval.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hval, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        drow_ptr, row_ptr.data(), sizeof(rocblas_int) * row_ptr.size(), hipMemcpyHostToDevice));
+    if(nnzb)
+        CHECK_HIP_ERROR(hipMemcpy(
+            dcol_ind, col_ind.data(), sizeof(rocblas_int) * nnzb, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(dval.transfer_from(hval));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        host_matrix<T> hD_1(M, N, ldd);
+        host_matrix<T> hD_2(M, N, ldd);
+        host_matrix<T> hC_3(M, N, ldc);
+        host_matrix<T> hD_gold(M, N, ldd);
+        host_matrix<T> hC_gold(M, N, ldc);
+        CHECK_HIP_ERROR(hD_1.memcheck());
+        CHECK_HIP_ERROR(hD_2.memcheck());
+        CHECK_HIP_ERROR(hC_3.memcheck());
+        CHECK_HIP_ERROR(hD_gold.memcheck());
+        CHECK_HIP_ERROR(hC_gold.memcheck());
+
+        // ROCBLAS rocblas_pointer_mode_host, D distinct from C
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_block_sparse_ex(handle,
+                                                         transB,
+                                                         mb,
+                                                         N,
+                                                         kb,
+                                                         nnzb,
+                                                         bd,
+                                                         &h_alpha,
+                                                         drow_ptr,
+                                                         dcol_ind,
+                                                         dval,
+                                                         type,
+                                                         dB,
+                                                         type,
+                                                         ldb,
+                                                         &h_beta,
+                                                         dC,
+                                                         type,
+                                                         ldc,
+                                                         dD,
+                                                         type,
+                                                         ldd,
+                                                         type,
+                                                         algo,
+                                                         solution_index,
+                                                         flags));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hD_1.transfer_from(dD));
+
+        // ROCBLAS rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_block_sparse_ex(handle,
+                                                         transB,
+                                                         mb,
+                                                         N,
+                                                         kb,
+                                                         nnzb,
+                                                         bd,
+                                                         d_alpha,
+                                                         drow_ptr,
+                                                         dcol_ind,
+                                                         dval,
+                                                         type,
+                                                         dB,
+                                                         type,
+                                                         ldb,
+                                                         d_beta,
+                                                         dC,
+                                                         type,
+                                                         ldc,
+                                                         dD,
+                                                         type,
+                                                         ldd,
+                                                         type,
+                                                         algo,
+                                                         solution_index,
+                                                         flags));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hD_2.transfer_from(dD));
+
+        // In place, D being C
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_block_sparse_ex(handle,
+                                                         transB,
+                                                         mb,
+                                                         N,
+                                                         kb,
+                                                         nnzb,
+                                                         bd,
+                                                         d_alpha,
+                                                         drow_ptr,
+                                                         dcol_ind,
+                                                         dval,
+                                                         type,
+                                                         dB,
+                                                         type,
+                                                         ldb,
+                                                         d_beta,
+                                                         dC,
+                                                         type,
+                                                         ldc,
+                                                         dC,
+                                                         type,
+                                                         ldc,
+                                                         type,
+                                                         algo,
+                                                         solution_index,
+                                                         flags));
+        CHECK_HIP_ERROR(hC_3.transfer_from(dC));
+
+        // op( B )[k, j]
+        auto op_b = [&](rocblas_int k, rocblas_int j) {
+            if(transB == rocblas_operation_none)
+                return hB[k + j * size_t(ldb)];
+            T b = hB[j + k * size_t(ldb)];
+            return transB == rocblas_operation_conjugate_transpose ? conjugate(b) : b;
+        };
+
+        // CPU BLAS, the sum of the products of the blocks of each block row
+        cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
+        for(rocblas_int j = 0; j < N; j++)
+            for(rocblas_int I = 0; I < mb; I++)
+                for(rocblas_int i = 0; i < bd; i++)
+                {
+                    T sum(0);
+                    for(rocblas_int blk = row_ptr[I]; blk < row_ptr[I + 1]; blk++)
+                        for(rocblas_int l = 0; l < bd; l++)
+                            sum += hval[(size_t(blk) * bd + l) * bd + i]
+                                   * op_b(col_ind[blk] * bd + l, j);
+
+                    const rocblas_int row = I * bd + i;
+                    T                 d   = h_alpha * sum;
+                    if(h_beta != T(0))
+                        d += h_beta * hC[row + j * size_t(ldc)];
+                    hD_gold[row + j * size_t(ldd)] = d;
+                    hC_gold[row + j * size_t(ldc)] = d;
+                }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, ldd, hD_gold, hD_1);
+            unit_check_general<T>(M, N, ldd, hD_gold, hD_2);
+            unit_check_general<T>(M, N, ldc, hC_gold, hC_3);
+        }
+
+        if(arg.norm_check)
+        {
+            double error_hst_ptr
+                = std::abs(norm_check_general<T>('F', M, N, ldd, (T*)hD_gold, (T*)hD_1));
+            double error_dev_ptr
+                = std::abs(norm_check_general<T>('F', M, N, ldd, (T*)hD_gold, (T*)hD_2));
+            rocblas_error = error_hst_ptr > error_dev_ptr ? error_hst_ptr : error_dev_ptr;
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+        auto gemm_block_sparse_ex = [&]() {
+            return rocblas_gemm_block_sparse_ex(handle,
+                                                transB,
+                                                mb,
+                                                N,
+                                                kb,
+                                                nnzb,
+                                                bd,
+                                                &h_alpha,
+                                                drow_ptr,
+                                                dcol_ind,
+                                                dval,
+                                                type,
+                                                dB,
+                                                type,
+                                                ldb,
+                                                &h_beta,
+                                                dC,
+                                                type,
+                                                ldc,
+                                                dD,
+                                                type,
+                                                ldd,
+                                                type,
+                                                algo,
+                                                solution_index,
+                                                flags);
+        };
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(gemm_block_sparse_ex());
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, gemm_block_sparse_ex);
+
+        // One block_dim x N x block_dim gemm per block of A
+        ArgumentModel<e_transB, e_M, e_N, e_K, e_alpha, e_lda, e_ldb, e_beta, e_ldc, e_ldd>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         nnzb * gemm_gflop_count<T>(bd, N, bd),
+                         gemm_block_sparse_gbyte_count<T>(nnzb, bd, M, N),
+                         cpu_time_used,
+                         rocblas_error);
+    }
+}
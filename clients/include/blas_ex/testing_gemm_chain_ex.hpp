@@ -0,0 +1,414 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_gemm_epilogue.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename Ti, typename To = Ti, typename Tc = To>
+void testing_gemm_chain_ex_bad_arg(const Arguments& arg)
+{
+    const rocblas_int M = 8;
+    const rocblas_int N = 4;
+    const rocblas_int K = 6;
+    const rocblas_int L = 5;
+
+    const rocblas_int lda = M;
+    const rocblas_int ldb = K;
+    const rocblas_int ldd = N;
+    const rocblas_int lde = M;
+
+    const rocblas_operation       opN   = rocblas_operation_none;
+    const rocblas_operation       opBad = rocblas_operation(rocblas_fill_full);
+    const rocblas_gemm_activation relu  = rocblas_gemm_activation_relu;
+    const rocblas_gemm_activation act3  = rocblas_gemm_activation(3);
+
+    const rocblas_datatype type         = arg.a_type;
+    const rocblas_datatype compute_type = arg.compute_type;
+    const rocblas_datatype i32_r        = rocblas_datatype_i32_r;
+
+    rocblas_local_handle handle{arg};
+
+    // Allocate device memory
+    device_matrix<Ti> dA(M, K, lda);
+    device_matrix<Ti> dB(K, N, ldb);
+    device_matrix<Ti> dD(N, L, ldd);
+    device_matrix<To> dE(M, L, lde);
+    device_vector<To> dbias(M);
+    device_vector<Tc> alpha_d(1), beta_d(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(dE.memcheck());
+    CHECK_DEVICE_ALLOCATION(dbias.memcheck());
+    CHECK_DEVICE_ALLOCATION(alpha_d.memcheck());
+    CHECK_DEVICE_ALLOCATION(beta_d.memcheck());
+
+    const Tc alpha_h(1), beta_h(1);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const Tc* alpha = &alpha_h;
+        const Tc* beta  = &beta_h;
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(beta_d, beta, sizeof(*beta), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            beta  = beta_d;
+        }
+
+        // clang-format off
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(nullptr, opN, opN, opN, M, N, K, L, alpha, dA, lda, dB, ldb, dbias, relu, dD, ldd, beta, dE, lde, type, compute_type), rocblas_status_invalid_handle);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, N, K, L, alpha, dA, lda, dB, ldb, dbias, relu, dD, ldd, beta, dE, lde, type, i32_r), rocblas_status_not_implemented);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, N, K, L, alpha, dA, lda, dB, ldb, dbias, act3, dD, ldd, beta, dE, lde, type, compute_type), rocblas_status_invalid_value);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opBad, opN, opN, M, N, K, L, alpha, dA, lda, dB, ldb, dbias, relu, dD, ldd, beta, dE, lde, type, compute_type), rocblas_status_invalid_value);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opBad, opN, M, N, K, L, alpha, dA, lda, dB, ldb, dbias, relu, dD, ldd, beta, dE, lde, type, compute_type), rocblas_status_invalid_value);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opBad, M, N, K, L, alpha, dA, lda, dB, ldb, dbias, relu, dD, ldd, beta, dE, lde, type, compute_type), rocblas_status_invalid_value);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, -1, N, K, L, alpha, dA, lda, dB, ldb, dbias, relu, dD, ldd, beta, dE, lde, type, compute_type), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, -1, K, L, alpha, dA, lda, dB, ldb, dbias, relu, dD, ldd, beta, dE, lde, type, compute_type), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, N, -1, L, alpha, dA, lda, dB, ldb, dbias, relu, dD, ldd, beta, dE, lde, type, compute_type), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, N, K, -1, alpha, dA, lda, dB, ldb, dbias, relu, dD, ldd, beta, dE, lde, type, compute_type), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, N, K, L, alpha, dA, lda - 1, dB, ldb, dbias, relu, dD, ldd, beta, dE, lde, type, compute_type), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, N, K, L, alpha, dA, lda, dB, ldb - 1, dbias, relu, dD, ldd, beta, dE, lde, type, compute_type), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, N, K, L, alpha, dA, lda, dB, ldb, dbias, relu, dD, ldd - 1, beta, dE, lde, type, compute_type), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, N, K, L, alpha, dA, lda, dB, ldb, dbias, relu, dD, ldd, beta, dE, lde - 1, type, compute_type), rocblas_status_invalid_size);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, N, K, L, nullptr, dA, lda, dB, ldb, dbias, relu, dD, ldd, beta, dE, lde, type, compute_type), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, N, K, L, alpha, nullptr, lda, dB, ldb, dbias, relu, dD, ldd, beta, dE, lde, type, compute_type), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, N, K, L, alpha, dA, lda, nullptr, ldb, dbias, relu, dD, ldd, beta, dE, lde, type, compute_type), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, N, K, L, alpha, dA, lda, dB, ldb, dbias, relu, nullptr, ldd, beta, dE, lde, type, compute_type), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, N, K, L, alpha, dA, lda, dB, ldb, dbias, relu, dD, ldd, nullptr, dE, lde, type, compute_type), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, N, K, L, alpha, dA, lda, dB, ldb, dbias, relu, dD, ldd, beta, nullptr, lde, type, compute_type), rocblas_status_invalid_pointer);
+
+// A and B are not read when k is 0, nor D when n is 0, and nothing is read when m or l is 0
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, N, 0, L, alpha, nullptr, lda, nullptr, ldb, dbias, relu, dD, ldd, beta, dE, lde, type, compute_type), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, 0, K, L, alpha, nullptr, lda, nullptr, ldb, dbias, relu, nullptr, 1, beta, dE, lde, type, compute_type), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, 0, N, K, L, nullptr, nullptr, K, nullptr, ldb, nullptr, relu, nullptr, ldd, nullptr, nullptr, 1, type, compute_type), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle, opN, opN, opN, M, N, K, 0, nullptr, nullptr, lda, nullptr, ldb, nullptr, relu, nullptr, ldd, nullptr, nullptr, lde, type, compute_type), rocblas_status_success);
+        // clang-format on
+    }
+}
+
+// gemm_chain_ex must match the chain computed on the host in double for each activation, with
+// op( D ) of both forms and alpha and beta on the host and on the device. E has l = m + 3
+// columns, so that l and m differ, and its leading dimension is arg.ldc. The bias is omitted,
+// as nullptr, with no activation.
+template <typename Ti, typename To = Ti, typename Tc = To>
+void testing_gemm_chain_ex(const Arguments& arg)
+{
+    const rocblas_operation transA = char2rocblas_operation(arg.transA);
+    const rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    const rocblas_int M   = arg.M;
+    const rocblas_int N   = arg.N;
+    const rocblas_int K   = arg.K;
+    const rocblas_int L   = arg.M + 3;
+    const rocblas_int lda = arg.lda;
+    const rocblas_int ldb = arg.ldb;
+    const rocblas_int lde = arg.ldc;
+
+    const rocblas_datatype type         = arg.a_type;
+    const rocblas_datatype compute_type = arg.compute_type;
+
+    const rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    const rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    const rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    const rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    rocblas_local_handle handle{arg};
+
+    // check for invalid sizes and quick return
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < std::max(1, A_row)
+                        || ldb < std::max(1, B_row) || lde < std::max(1, M);
+    if(invalid_size || !M)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_chain_ex(handle,
+                                                    transA,
+                                                    transB,
+                                                    rocblas_operation_none,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    L,
+                                                    nullptr,
+                                                    nullptr,
+                                                    lda,
+                                                    nullptr,
+                                                    ldb,
+                                                    nullptr,
+                                                    rocblas_gemm_activation_none,
+                                                    nullptr,
+                                                    std::max(1, N),
+                                                    nullptr,
+                                                    nullptr,
+                                                    lde,
+                                                    type,
+                                                    compute_type),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    Tc h_alpha = arg.get_alpha<Tc>();
+    Tc h_beta  = arg.get_beta<Tc>();
+
+    // Naming: dX is in GPU (device) memory. hX is in CPU (host) memory
+    host_matrix<Ti> hA(A_row, A_col, lda);
+    host_matrix<Ti> hB(B_row, B_col, ldb);
+    host_matrix<To> hE(M, L, lde);
+    host_matrix<To> hE_gold(M, L, lde);
+    host_matrix<To> hE_result(M, L, lde);
+    host_vector<To> hbias(M);
+
+    device_matrix<Ti> dA(A_row, A_col, lda);
+    device_matrix<Ti> dB(B_row, B_col, ldb);
+    device_matrix<To> dE(M, L, lde);
+    device_vector<To> dbias(M);
+    device_vector<Tc> d_alpha(1);
+    device_vector<Tc> d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dE.memcheck());
+    CHECK_DEVICE_ALLOCATION(dbias.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // A and the bias alternate in sign, so that relu and gelu see both signs of their argument
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, true, true);
+    rocblas_init_matrix(hB, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+    rocblas_init_matrix(hE, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+    rocblas_init_vector(hbias, arg, rocblas_client_never_set_nan, false, true);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dbias.transfer_from(hbias));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tc), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tc), hipMemcpyHostToDevice));
+
+    const Ti* A    = hA;
+    const Ti* B    = hB;
+    const To* E    = hE;
+    const To* bias = hbias;
+
+    // alpha*op( A )*op( B ) in double
+    host_vector<double> hAB(size_t(M) * N);
+    for(rocblas_int j = 0; j < N; j++)
+        for(rocblas_int i = 0; i < M; i++)
+        {
+            double sum = 0;
+            for(rocblas_int p = 0; p < K; p++)
+            {
+                Ti a = transA == rocblas_operation_none ? A[i + size_t(p) * lda]
+                                                        : A[p + size_t(i) * lda];
+                Ti b = transB == rocblas_operation_none ? B[p + size_t(j) * ldb]
+                                                        : B[j + size_t(p) * ldb];
+                sum += double(a) * double(b);
+            }
+            hAB[i + size_t(j) * M] = double(h_alpha) * sum;
+        }
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error          = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(auto transD : {rocblas_operation_none, rocblas_operation_transpose})
+        {
+            const rocblas_int D_row = transD == rocblas_operation_none ? N : L;
+            const rocblas_int D_col = transD == rocblas_operation_none ? L : N;
+            const rocblas_int ldd   = std::max(1, D_row);
+
+            host_matrix<Ti>   hD(D_row, D_col, ldd);
+            device_matrix<Ti> dD(D_row, D_col, ldd);
+            CHECK_DEVICE_ALLOCATION(dD.memcheck());
+            rocblas_init_matrix(
+                hD, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+            CHECK_HIP_ERROR(dD.transfer_from(hD));
+
+            const Ti* D = hD;
+
+            for(auto activation : {rocblas_gemm_activation_none,
+                                   rocblas_gemm_activation_relu,
+                                   rocblas_gemm_activation_gelu})
+            {
+                bool      with_bias  = activation != rocblas_gemm_activation_none;
+                const To* chain_bias = with_bias ? (const To*)dbias : nullptr;
+
+                // E_gold = activation( alpha*op( A )*op( B ) + bias )*op( D ) + beta*E
+                cpu_time_used = get_time_us_no_sync();
+                host_vector<double> hT(size_t(M) * N);
+                for(rocblas_int j = 0; j < N; j++)
+                    for(rocblas_int i = 0; i < M; i++)
+                    {
+                        double t = hAB[i + size_t(j) * M] + (with_bias ? double(bias[i]) : 0.0);
+                        hT[i + size_t(j) * M] = gemm_epilogue_activation(t, activation);
+                    }
+
+                // E_gold is zero when beta is 0 and T or op( D ) is empty, or relu zeroes T, and
+                // then the result is compared exactly rather than by its relative error
+                To*  E_gold    = hE_gold;
+                bool gold_zero = true;
+                for(rocblas_int j = 0; j < L; j++)
+                    for(rocblas_int i = 0; i < M; i++)
+                    {
+                        double sum = 0;
+                        for(rocblas_int p = 0; p < N; p++)
+                        {
+                            Ti d = transD == rocblas_operation_none ? D[p + size_t(j) * ldd]
+                                                                    : D[j + size_t(p) * ldd];
+                            sum += hT[i + size_t(p) * M] * double(d);
+                        }
+                        size_t idx  = i + size_t(j) * lde;
+                        E_gold[idx] = To(sum + double(h_beta) * double(E[idx]));
+                        gold_zero   = gold_zero && double(E_gold[idx]) == 0;
+                    }
+                cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+                for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+                {
+                    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+                    bool host = pointer_mode == rocblas_pointer_mode_host;
+
+                    CHECK_HIP_ERROR(dE.transfer_from(hE));
+
+                    handle.pre_test(arg);
+                    CHECK_ROCBLAS_ERROR(rocblas_gemm_chain_ex(handle,
+                                                              transA,
+                                                              transB,
+                                                              transD,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              L,
+                                                              host ? &h_alpha : (const Tc*)d_alpha,
+                                                              dA,
+                                                              lda,
+                                                              dB,
+                                                              ldb,
+                                                              chain_bias,
+                                                              activation,
+                                                              dD,
+                                                              ldd,
+                                                              host ? &h_beta : (const Tc*)d_beta,
+                                                              dE,
+                                                              lde,
+                                                              type,
+                                                              compute_type));
+                    handle.post_test(arg);
+
+                    CHECK_HIP_ERROR(hE_result.transfer_from(dE));
+
+                    if(gold_zero)
+                    {
+                        if(arg.unit_check)
+                            unit_check_general<To>(M, L, lde, hE_gold, hE_result);
+                        continue;
+                    }
+
+                    double error = std::abs(
+                        norm_check_general<To>('F', M, L, lde, (To*)hE_gold, (To*)hE_result));
+                    if(arg.unit_check)
+                        EXPECT_LE(error, gemm_epilogue_tolerance<To>);
+                    rocblas_error = error > rocblas_error ? error : rocblas_error;
+                }
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        const rocblas_int ldd = std::max(1, N);
+
+        device_matrix<Ti> dD(N, L, ldd);
+        CHECK_DEVICE_ALLOCATION(dD.memcheck());
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        auto gemm_chain = [&]() {
+            return rocblas_gemm_chain_ex(handle,
+                                         transA,
+                                         transB,
+                                         rocblas_operation_none,
+                                         M,
+                                         N,
+                                         K,
+                                         L,
+                                         &h_alpha,
+                                         dA,
+                                         lda,
+                                         dB,
+                                         ldb,
+                                         dbias,
+                                         rocblas_gemm_activation_relu,
+                                         dD,
+                                         ldd,
+                                         &h_beta,
+                                         dE,
+                                         lde,
+                                         type,
+                                         compute_type);
+        };
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+            gemm_chain();
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] { gemm_chain(); });
+
+        ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_lda, e_beta, e_ldb, e_ldc>{}
+            .log_args<Tc>(rocblas_cout,
+                          arg,
+                          gpu_time_used,
+                          gemm_gflop_count<Tc>(M, N, K) + gemm_gflop_count<Tc>(M, L, N),
+                          gemm_chain_gbyte_count<To>(M, N, K, L),
+                          cpu_time_used,
+                          rocblas_error);
+    }
+}
@@ -0,0 +1,402 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <thread>
+#include <vector>
+
+/* ============================================================================================ */
+template <typename Ti, typename To, typename Tc>
+void testing_gemm_coalescer_bad_arg(const Arguments& arg)
+{
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+
+    const rocblas_int M = 100;
+    const rocblas_int N = 100;
+    const rocblas_int K = 100;
+
+    const rocblas_int lda = 100;
+    const rocblas_int ldb = 100;
+    const rocblas_int ldc = 100;
+    const rocblas_int ldd = 100;
+
+    const rocblas_datatype a_type       = rocblas_type2datatype<Ti>();
+    const rocblas_datatype b_type       = rocblas_type2datatype<Ti>();
+    const rocblas_datatype c_type       = rocblas_type2datatype<To>();
+    const rocblas_datatype d_type       = rocblas_type2datatype<To>();
+    const rocblas_datatype compute_type = rocblas_type2datatype<Tc>();
+
+    rocblas_gemm_algo algo           = rocblas_gemm_algo_standard;
+    int32_t           solution_index = 0;
+    rocblas_int       flags          = 0;
+
+    // alpha and beta are always in host memory
+    const Tc alpha(1), beta(2);
+
+    // Allocate device memory
+    device_matrix<Ti> dA(M, K, lda);
+    device_matrix<Ti> dB(K, N, ldb);
+    device_matrix<To> dC(M, N, ldc);
+    device_matrix<To> dD(M, N, ldd);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+
+    rocblas_gemm_coalescer coalescer;
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalescer_create(nullptr, 10, 1),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalescer_create(&coalescer, -1, 1),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalescer_create(&coalescer, 10, 0),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalescer_destroy(nullptr), rocblas_status_invalid_pointer);
+
+    // Each call below fails or returns before joining a batch, so none waits for the window
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_coalescer_create(&coalescer, 10, 1));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    // clang-format off
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalesced_ex(nullptr, stream, transA, transB, M, N, K, &alpha,
+dA, a_type, lda, dB, b_type, ldb, &beta, dC, c_type, ldc,
+dD, d_type, ldd, compute_type, algo, solution_index, flags), rocblas_status_invalid_handle);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalesced_ex(coalescer, stream, transA, transB, -1, N, K, &alpha,
+dA, a_type, lda, dB, b_type, ldb, &beta, dC, c_type, ldc,
+dD, d_type, ldd, compute_type, algo, solution_index, flags), rocblas_status_invalid_size);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalesced_ex(coalescer, stream, transA, transB, M, -1, K, &alpha,
+dA, a_type, lda, dB, b_type, ldb, &beta, dC, c_type, ldc,
+dD, d_type, ldd, compute_type, algo, solution_index, flags), rocblas_status_invalid_size);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalesced_ex(coalescer, stream, transA, transB, M, N, -1, &alpha,
+dA, a_type, lda, dB, b_type, ldb, &beta, dC, c_type, ldc,
+dD, d_type, ldd, compute_type, algo, solution_index, flags), rocblas_status_invalid_size);
+
+// check for unsupported compute type
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalesced_ex(coalescer, stream, transA, transB, M, N, K, &alpha,
+dA, a_type, lda, dB, b_type, ldb, &beta, dC, c_type, ldc,
+dD, d_type, ldd, rocblas_datatype(0), algo, solution_index, flags), rocblas_status_not_implemented);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalesced_ex(coalescer, stream, transA, transB, M, N, K, nullptr,
+dA, a_type, lda, dB, b_type, ldb, &beta, dC, c_type, ldc,
+dD, d_type, ldd, compute_type, algo, solution_index, flags), rocblas_status_invalid_pointer);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalesced_ex(coalescer, stream, transA, transB, M, N, K, &alpha,
+dA, a_type, lda, dB, b_type, ldb, nullptr, dC, c_type, ldc,
+dD, d_type, ldd, compute_type, algo, solution_index, flags), rocblas_status_invalid_pointer);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalesced_ex(coalescer, stream, transA, transB, M, N, K, &alpha,
+nullptr, a_type, lda, dB, b_type, ldb, &beta, dC, c_type, ldc,
+dD, d_type, ldd, compute_type, algo, solution_index, flags), rocblas_status_invalid_pointer);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalesced_ex(coalescer, stream, transA, transB, M, N, K, &alpha,
+dA, a_type, lda, nullptr, b_type, ldb, &beta, dC, c_type, ldc,
+dD, d_type, ldd, compute_type, algo, solution_index, flags), rocblas_status_invalid_pointer);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalesced_ex(coalescer, stream, transA, transB, M, N, K, &alpha,
+dA, a_type, lda, dB, b_type, ldb, &beta, dC, c_type, ldc,
+nullptr, d_type, ldd, compute_type, algo, solution_index, flags), rocblas_status_invalid_pointer);
+
+// C may only be nullptr when beta is 0
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalesced_ex(coalescer, stream, transA, transB, M, N, K, &alpha,
+dA, a_type, lda, dB, b_type, ldb, &beta, nullptr, c_type, ldc,
+dD, d_type, ldd, compute_type, algo, solution_index, flags), rocblas_status_invalid_pointer);
+
+// If M==0, then all pointers can be nullptr without issue
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalesced_ex(coalescer, stream, transA, transB, 0, N, K, nullptr,
+nullptr, a_type, lda, nullptr, b_type, ldb, nullptr, nullptr, c_type, ldc,
+nullptr, d_type, ldd, compute_type, algo, solution_index, flags), rocblas_status_success);
+
+// If N==0, then all pointers can be nullptr without issue
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalesced_ex(coalescer, stream, transA, transB, M, 0, K, nullptr,
+nullptr, a_type, lda, nullptr, b_type, ldb, nullptr, nullptr, c_type, ldc,
+nullptr, d_type, ldd, compute_type, algo, solution_index, flags), rocblas_status_success);
+
+    // clang-format on
+
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_coalescer_destroy(coalescer));
+}
+
+// batch_count threads each compute D_t = alpha * op(A_t) * op(B_t) + beta * C_t on their own
+// stream through one coalescer, which batches their calls, and every result must match the host
+template <typename Ti, typename To, typename Tc>
+void testing_gemm_coalescer(const Arguments& arg)
+{
+    Tc h_alpha = arg.get_alpha<Tc>();
+    Tc h_beta  = arg.get_beta<Tc>();
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error          = 0.0;
+
+    rocblas_local_handle handle{arg};
+    auto                 transA = char2rocblas_operation(arg.transA);
+    auto                 transB = char2rocblas_operation(arg.transB);
+    auto                 M = arg.M, N = arg.N, K = arg.K;
+    auto                 lda = arg.lda, ldb = arg.ldb, ldc = arg.ldc, ldd = arg.ldd;
+    auto                 stride_a = arg.stride_a, stride_b = arg.stride_b;
+    auto                 stride_c = arg.stride_c, stride_d = arg.stride_d;
+    auto                 A_row       = transA == rocblas_operation_none ? M : std::max(K, 1);
+    auto                 A_col       = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    auto                 B_row       = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    auto                 B_col       = transB == rocblas_operation_none ? N : std::max(K, 1);
+    auto                 batch_count = arg.batch_count;
+
+    // The calls of the threads form two batches, the second closed by the window
+    const rocblas_int window_us = 200;
+    const rocblas_int max_batch = std::max((batch_count + 1) / 2, 1);
+
+    rocblas_gemm_coalescer coalescer;
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_coalescer_create(&coalescer, window_us, max_batch));
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0;
+    if(invalid_size || !M || !N || batch_count <= 0)
+    {
+        // Without threads there is no call to make
+        if(invalid_size || !M || !N)
+        {
+            // clang-format off
+            EXPECT_ROCBLAS_STATUS(rocblas_gemm_coalesced_ex(coalescer, nullptr, transA, transB, M, N, K, nullptr,
+                                  nullptr, arg.a_type, lda, nullptr, arg.b_type, ldb, nullptr, nullptr, arg.c_type, ldc,
+                                  nullptr, arg.d_type, ldd, arg.compute_type, rocblas_gemm_algo_standard, 0, rocblas_gemm_flags_none),
+                                  invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+            // clang-format on
+        }
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_coalescer_destroy(coalescer));
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    using To_hpa = std::conditional_t<std::is_same<To, rocblas_bfloat16>{}, float, To>;
+    host_strided_batch_matrix<Ti>     hA(A_row, A_col, lda, stride_a, batch_count);
+    host_strided_batch_matrix<Ti>     hB(B_row, B_col, ldb, stride_b, batch_count);
+    host_strided_batch_matrix<To>     hC(M, N, ldc, stride_c, batch_count);
+    host_strided_batch_matrix<To>     hD(M, N, ldd, stride_d, batch_count);
+    host_strided_batch_matrix<To_hpa> hD_gold(M, N, ldd, stride_d, batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hC.memcheck());
+    CHECK_HIP_ERROR(hD.memcheck());
+    CHECK_HIP_ERROR(hD_gold.memcheck());
+
+    // Allocate device memory
+    device_strided_batch_matrix<Ti> dA(A_row, A_col, lda, stride_a, batch_count);
+    device_strided_batch_matrix<Ti> dB(B_row, B_col, ldb, stride_b, batch_count);
+    device_strided_batch_matrix<To> dC(M, N, ldc, stride_c, batch_count);
+    device_strided_batch_matrix<To> dD(M, N, ldd, stride_d, batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix<Ti>(
+        hA, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix<Ti>(
+        hB, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix<To>(hC, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+    std::vector<hipStream_t> streams(batch_count);
+    for(auto& stream : streams)
+        CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    // Each thread makes one call on its own stream, and the statuses are checked once all joined
+    std::vector<rocblas_status> statuses(batch_count);
+    auto                        rocblas_gemm_coalesced_ex_fn = [&] {
+        std::vector<std::thread> threads;
+        for(rocblas_int t = 0; t < batch_count; t++)
+            threads.emplace_back([&, t] {
+                statuses[t] = rocblas_gemm_coalesced_ex(coalescer,
+                                                        streams[t],
+                                                        transA,
+                                                        transB,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        &h_alpha,
+                                                        dA[t],
+                                                        arg.a_type,
+                                                        lda,
+                                                        dB[t],
+                                                        arg.b_type,
+                                                        ldb,
+                                                        &h_beta,
+                                                        dC[t],
+                                                        arg.c_type,
+                                                        ldc,
+                                                        dD[t],
+                                                        arg.d_type,
+                                                        ldd,
+                                                        arg.compute_type,
+                                                        rocblas_gemm_algo_standard,
+                                                        0,
+                                                        rocblas_gemm_flags_none);
+            });
+        for(auto& thread : threads)
+            thread.join();
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        handle.pre_test(arg);
+        rocblas_gemm_coalesced_ex_fn();
+        handle.post_test(arg);
+
+        for(auto status : statuses)
+            CHECK_ROCBLAS_ERROR(status);
+
+        // The result of each call is ordered before later work on its stream
+        for(rocblas_int t = 0; t < batch_count; t++)
+        {
+            CHECK_HIP_ERROR(hipMemcpyAsync(hD[t],
+                                           dD[t],
+                                           sizeof(To) * ldd * N,
+                                           hipMemcpyDeviceToHost,
+                                           streams[t]));
+            CHECK_HIP_ERROR(hipStreamSynchronize(streams[t]));
+        }
+
+        // copy C matrix into D matrix
+        copy_matrix_with_different_leading_dimensions(hC, hD_gold);
+        cpu_time_used = get_time_us_no_sync();
+
+        // CPU BLAS
+#pragma omp parallel for
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            cblas_gemm<Ti, To_hpa, Tc>(transA,
+                                       transB,
+                                       M,
+                                       N,
+                                       K,
+                                       h_alpha,
+                                       hA[b],
+                                       lda,
+                                       hB[b],
+                                       ldb,
+                                       h_beta,
+                                       hD_gold[b],
+                                       ldd);
+        }
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            if((rocblas_handle(handle)->getArchMajor() == 11) && (sizeof(Ti) == 2))
+            {
+                const double tol = K * sum_error_tolerance_for_gfx11<Tc, Ti, To>;
+                near_check_general<To, To_hpa>(M, N, ldd, stride_d, hD_gold, hD, batch_count, tol);
+            }
+            else
+            {
+                unit_check_general<To, To_hpa>(M, N, ldd, stride_d, hD_gold, hD, batch_count);
+            }
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error = std::abs(norm_check_general('F', hD_gold, hD));
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_gemm_coalesced_ex_fn();
+        }
+
+        // Each hot call is one round of the threads, timed until all their streams are done
+        gpu_time_used = get_time_us_sync_device();
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_gemm_coalesced_ex_fn();
+        }
+        gpu_time_used = get_time_us_sync_device() - gpu_time_used;
+        gpu_time_used /= std::max(number_hot_calls, 1);
+
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_beta,
+                      e_ldb,
+                      e_ldc,
+                      e_ldd,
+                      e_batch_count>{}
+            .log_args<Tc>(rocblas_cout,
+                          arg,
+                          gpu_time_used,
+                          gemm_gflop_count<Tc>(M, N, K),
+                          gemm_gbyte_count<Ti, To>(M, N, K),
+                          cpu_time_used,
+                          rocblas_error);
+    }
+
+    for(auto& stream : streams)
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_coalescer_destroy(coalescer));
+}
@@ -0,0 +1,907 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <cmath>
+
+// Relative error bound of the epilogue result, which the device evaluates in float, or in double
+// for rocblas_datatype_f64_r, and the host in double
+template <class T>
+static constexpr double gemm_epilogue_tolerance = 1e-5;
+
+template <>
+ROCBLAS_CLANG_STATIC constexpr double gemm_epilogue_tolerance<double> = 1e-12;
+
+template <>
+ROCBLAS_CLANG_STATIC constexpr double gemm_epilogue_tolerance<rocblas_half> = 1 / 100.0;
+
+template <>
+ROCBLAS_CLANG_STATIC constexpr double gemm_epilogue_tolerance<rocblas_bfloat16> = 1 / 50.0;
+
+// Host reference of the activation of a rocblas_gemm_epilogue
+template <typename T>
+T gemm_epilogue_activation(T x, rocblas_gemm_activation activation)
+{
+    switch(activation)
+    {
+    case rocblas_gemm_activation_relu:
+        return x > 0 ? x : T(0);
+    case rocblas_gemm_activation_gelu:
+        return T(0.5) * x
+               * (1 + std::tanh(T(0.7978845608028654) * (x + T(0.044715) * x * x * x)));
+    default:
+        return x;
+    }
+}
+
+// Encodes v, which must be exactly representable, as an 8-bit float with WE exponent bits
+// and WM mantissa bits, as for rocblas_datatype_f8_r (4, 3) and rocblas_datatype_bf8_r (5, 2)
+template <int WE, int WM>
+uint8_t gemm_epilogue_f8_encode(float v)
+{
+    if(v == 0)
+        return 0;
+    int   e;
+    float f    = std::frexp(std::abs(v), &e);
+    int   mant = int((f * 2 - 1) * (1 << WM));
+    return (v < 0 ? 0x80 : 0) | (e - 1 + (1 << (WE - 1))) << WM | mant;
+}
+
+// Calls rocblas_gemm_ex3 with the data types of Ti, To and Tc, and a d_type of Td, which is
+// rocblas_datatype_i8_r for the requantizing epilogue
+template <typename Ti, typename To, typename Tc, typename Td = To>
+rocblas_status testing_gemm_epilogue_call(rocblas_handle               handle,
+                                          rocblas_operation            transA,
+                                          rocblas_operation            transB,
+                                          rocblas_int                  M,
+                                          rocblas_int                  N,
+                                          rocblas_int                  K,
+                                          const Tc*                    alpha,
+                                          const Ti*                    A,
+                                          rocblas_int                  lda,
+                                          const Ti*                    B,
+                                          rocblas_int                  ldb,
+                                          const Tc*                    beta,
+                                          const To*                    C,
+                                          rocblas_int                  ldc,
+                                          Td*                          D,
+                                          rocblas_int                  ldd,
+                                          const rocblas_gemm_epilogue* epilogue)
+{
+    return rocblas_gemm_ex3(handle,
+                            transA,
+                            transB,
+                            M,
+                            N,
+                            K,
+                            alpha,
+                            A,
+                            rocblas_type2datatype<Ti>(),
+                            lda,
+                            B,
+                            rocblas_type2datatype<Ti>(),
+                            ldb,
+                            beta,
+                            C,
+                            rocblas_type2datatype<To>(),
+                            ldc,
+                            D,
+                            rocblas_type2datatype<Td>(),
+                            ldd,
+                            rocblas_type2datatype<Tc>(),
+                            rocblas_gemm_algo_standard,
+                            0,
+                            rocblas_gemm_flags_none,
+                            epilogue);
+}
+
+template <typename Ti, typename To, typename Tc>
+void testing_gemm_epilogue_bad_arg(const Arguments& arg)
+{
+    // The requantizing epilogue of i8_r inputs writes an i8_r D
+    using Td = std::conditional_t<std::is_same<Ti, int8_t>{}, int8_t, To>;
+
+    auto rocblas_gemm_ex3_fn = testing_gemm_epilogue_call<Ti, To, Tc, Td>;
+
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+
+    const rocblas_int M = 100;
+    const rocblas_int N = 100;
+    const rocblas_int K = 101;
+
+    const rocblas_int lda = 101;
+    const rocblas_int ldb = 101;
+    const rocblas_int ldc = 101;
+    const rocblas_int ldd = 101;
+
+    const Tc alpha(1), beta(1), scale(1);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    // Allocate device memory
+    device_matrix<Ti>    dA(M, K, lda);
+    device_matrix<Ti>    dB(K, N, ldb);
+    device_matrix<To>    dC(M, N, ldc);
+    device_matrix<Td>    dD(M, N, ldd);
+    device_matrix<Td>    daux(M, N, ldd);
+    device_vector<To>    dbias(M);
+    device_vector<float> dquant_scale(M);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(daux.memcheck());
+    CHECK_DEVICE_ALLOCATION(dbias.memcheck());
+    CHECK_DEVICE_ALLOCATION(dquant_scale.memcheck());
+
+    rocblas_gemm_epilogue epilogue{};
+    epilogue.bias       = dbias;
+    epilogue.activation = rocblas_gemm_activation_relu;
+
+    auto gemm_ex3 = [&](rocblas_handle h) {
+        return rocblas_gemm_ex3_fn(h,
+                                   transA,
+                                   transB,
+                                   M,
+                                   N,
+                                   K,
+                                   &alpha,
+                                   dA,
+                                   lda,
+                                   dB,
+                                   ldb,
+                                   &beta,
+                                   dC,
+                                   ldc,
+                                   dD,
+                                   ldd,
+                                   &epilogue);
+    };
+
+    EXPECT_ROCBLAS_STATUS(gemm_ex3(nullptr), rocblas_status_invalid_handle);
+
+    // check for invalid activation
+    epilogue.activation = rocblas_gemm_activation(-1);
+    EXPECT_ROCBLAS_STATUS(gemm_ex3(handle), rocblas_status_invalid_value);
+    epilogue.activation = rocblas_gemm_activation_relu;
+
+    if constexpr(std::is_same<Ti, int8_t>{})
+    {
+        // check for a quant_scale_count which is neither 1 nor m
+        epilogue.quant_scale       = dquant_scale;
+        epilogue.quant_scale_count = M + 1;
+        EXPECT_ROCBLAS_STATUS(gemm_ex3(handle), rocblas_status_invalid_size);
+        epilogue.quant_scale_count = M;
+
+        // check for the members which the requantizing epilogue does not support
+        epilogue.scale = &scale;
+        EXPECT_ROCBLAS_STATUS(gemm_ex3(handle), rocblas_status_not_implemented);
+    }
+    else
+    {
+        // check for an aux leading dimension smaller than m
+        epilogue.aux   = daux;
+        epilogue.ldaux = M - 1;
+        EXPECT_ROCBLAS_STATUS(gemm_ex3(handle), rocblas_status_invalid_size);
+        epilogue.ldaux = ldd;
+
+        // scale_a, scale_b and amax require an f32_r compute_type
+        if(!std::is_same<Tc, float>{})
+        {
+            float scale_a    = 1;
+            epilogue.scale_a = &scale_a;
+            EXPECT_ROCBLAS_STATUS(gemm_ex3(handle), rocblas_status_not_implemented);
+        }
+    }
+}
+
+template <typename Ti,
+          typename To,
+          typename Tc,
+          std::enable_if_t<!std::is_same<Ti, int8_t>{}, int> = 0>
+void testing_gemm_epilogue(const Arguments& arg)
+{
+    auto rocblas_gemm_ex3_fn = testing_gemm_epilogue_call<Ti, To, Tc>;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M     = arg.M;
+    rocblas_int N     = arg.N;
+    rocblas_int K     = arg.K;
+    rocblas_int lda   = arg.lda;
+    rocblas_int ldb   = arg.ldb;
+    rocblas_int ldc   = arg.ldc;
+    rocblas_int ldd   = arg.ldd;
+    rocblas_int ldaux = M + 1;
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : std::max(K, 1);
+    rocblas_int A_col = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : std::max(K, 1);
+
+    rocblas_local_handle handle{arg};
+
+    // check for invalid sizes and quick return
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || ldd < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex3_fn(handle,
+                                                  transA,
+                                                  transB,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  nullptr,
+                                                  nullptr,
+                                                  lda,
+                                                  nullptr,
+                                                  ldb,
+                                                  nullptr,
+                                                  nullptr,
+                                                  ldc,
+                                                  nullptr,
+                                                  ldd,
+                                                  nullptr),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    Tc h_alpha = arg.get_alpha<Tc>();
+    Tc h_beta  = arg.get_beta<Tc>();
+    Tc h_scale(0.5f);
+
+    // Naming: dX is in GPU (device) memory. hX is in CPU (host) memory
+    host_matrix<Ti> hA(A_row, A_col, lda);
+    host_matrix<Ti> hB(B_row, B_col, ldb);
+    host_matrix<To> hC(M, N, ldc);
+    host_matrix<To> hD(M, N, ldd);
+    host_matrix<To> hD_gold(M, N, ldd);
+    host_matrix<To> haux(M, N, ldaux);
+    host_matrix<To> haux_gold(M, N, ldaux);
+    host_vector<To> hbias(M);
+    host_vector<Tc> hrow_scale(M);
+    host_vector<Tc> hcol_scale(N);
+
+    device_matrix<Ti> dA(A_row, A_col, lda);
+    device_matrix<Ti> dB(B_row, B_col, ldb);
+    device_matrix<To> dC(M, N, ldc);
+    device_matrix<To> dD(M, N, ldd);
+    device_matrix<To> daux(M, N, ldaux);
+    device_vector<To> dbias(M);
+    device_vector<Tc> drow_scale(M);
+    device_vector<Tc> dcol_scale(N);
+    device_vector<Tc> d_alpha(1);
+    device_vector<Tc> d_beta(1);
+    device_vector<Tc> d_scale(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(daux.memcheck());
+    CHECK_DEVICE_ALLOCATION(dbias.memcheck());
+    CHECK_DEVICE_ALLOCATION(drow_scale.memcheck());
+    CHECK_DEVICE_ALLOCATION(dcol_scale.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_scale.memcheck());
+
+    // A and the bias alternate in sign so that the pre-activation result reaches both signs
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, true, true);
+    rocblas_init_matrix(hB, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+    rocblas_init_matrix(hC, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+    rocblas_init_vector(hbias, arg, rocblas_client_never_set_nan, false, true);
+
+    // power of two row and column scales
+    for(rocblas_int i = 0; i < M; i++)
+        hrow_scale[i] = Tc(float(1 << (i % 3)));
+    for(rocblas_int j = 0; j < N; j++)
+        hcol_scale[j] = Tc(j % 2 ? 0.5f : 2.0f);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(dbias.transfer_from(hbias));
+    CHECK_HIP_ERROR(drow_scale.transfer_from(hrow_scale));
+    CHECK_HIP_ERROR(dcol_scale.transfer_from(hcol_scale));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tc), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tc), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_scale, &h_scale, sizeof(Tc), hipMemcpyHostToDevice));
+
+    const Ti* A    = hA;
+    const Ti* B    = hB;
+    const To* C    = hC;
+    const To* bias = hbias;
+
+    // op( A ) * op( B ) in double, which is exact for the integer data
+    host_vector<double> hAB(size_t(M) * N);
+    for(rocblas_int j = 0; j < N; j++)
+        for(rocblas_int i = 0; i < M; i++)
+        {
+            double sum = 0;
+            for(rocblas_int l = 0; l < K; l++)
+            {
+                Ti a = transA == rocblas_operation_none ? A[i + size_t(l) * lda]
+                                                        : A[l + size_t(i) * lda];
+                Ti b = transB == rocblas_operation_none ? B[l + size_t(j) * ldb]
+                                                        : B[j + size_t(l) * ldb];
+                sum += double(a) * double(b);
+            }
+            hAB[i + size_t(j) * M] = sum;
+        }
+
+    // t = alpha*diag( row_scale )*op( A )*op( B )*diag( col_scale ) + beta*C + bias, and
+    // D = scale*activation( t ), with scales of 1 for nullptr
+    auto epilogue_gold = [&](rocblas_gemm_activation activation,
+                             double                  scale,
+                             const Tc*               row_scale,
+                             const Tc*               col_scale) {
+        To* D_gold   = hD_gold;
+        To* aux_gold = haux_gold;
+        for(rocblas_int j = 0; j < N; j++)
+            for(rocblas_int i = 0; i < M; i++)
+            {
+                double t = double(h_alpha) * hAB[i + size_t(j) * M]
+                           * (row_scale ? double(row_scale[i]) : 1.0)
+                           * (col_scale ? double(col_scale[j]) : 1.0)
+                           + double(h_beta) * double(C[i + size_t(j) * ldc]) + double(bias[i]);
+                double d = scale * gemm_epilogue_activation(t, activation);
+
+                aux_gold[i + size_t(j) * ldaux] = To(t);
+                D_gold[i + size_t(j) * ldd]     = To(d);
+            }
+    };
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error          = 0.0;
+
+    auto check_result = [&](host_matrix<To>& gold, host_matrix<To>& result, rocblas_int ld) {
+        double error = std::abs(norm_check_general<To>('F', M, N, ld, (To*)gold, (To*)result));
+        if(arg.unit_check)
+            EXPECT_LE(error, gemm_epilogue_tolerance<To>);
+        rocblas_error = error > rocblas_error ? error : rocblas_error;
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // bias, activation, scale and the pre-activation aux output; scale is read according
+        // to the pointer mode
+        for(auto activation : {rocblas_gemm_activation_none,
+                               rocblas_gemm_activation_relu,
+                               rocblas_gemm_activation_gelu})
+        {
+            epilogue_gold(activation, double(h_scale), nullptr, nullptr);
+
+            for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+            {
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+                bool host = pointer_mode == rocblas_pointer_mode_host;
+
+                rocblas_gemm_epilogue epilogue{};
+                epilogue.bias       = dbias;
+                epilogue.activation = activation;
+                epilogue.scale      = host ? &h_scale : (const Tc*)d_scale;
+                epilogue.aux        = daux;
+                epilogue.ldaux      = ldaux;
+
+                handle.pre_test(arg);
+                CHECK_ROCBLAS_ERROR(rocblas_gemm_ex3_fn(handle,
+                                                        transA,
+                                                        transB,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        host ? &h_alpha : d_alpha,
+                                                        dA,
+                                                        lda,
+                                                        dB,
+                                                        ldb,
+                                                        host ? &h_beta : d_beta,
+                                                        dC,
+                                                        ldc,
+                                                        dD,
+                                                        ldd,
+                                                        &epilogue));
+                handle.post_test(arg);
+
+                CHECK_HIP_ERROR(hD.transfer_from(dD));
+                CHECK_HIP_ERROR(haux.transfer_from(daux));
+                check_result(hD_gold, hD, ldd);
+                check_result(haux_gold, haux, ldaux);
+            }
+        }
+
+        // Row and column scales with beta, out of place, and in place with C as D when their
+        // leading dimensions agree
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        epilogue_gold(rocblas_gemm_activation_none, 1.0, hrow_scale, hcol_scale);
+
+        rocblas_gemm_epilogue epilogue{};
+        epilogue.bias      = dbias;
+        epilogue.row_scale = drow_scale;
+        epilogue.col_scale = dcol_scale;
+
+        for(bool in_place : {false, true})
+        {
+            if(in_place && ldc != ldd)
+                continue;
+            if(in_place)
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dD, hC, sizeof(To) * size_t(ldc) * N, hipMemcpyHostToDevice));
+
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_ex3_fn(handle,
+                                                    transA,
+                                                    transB,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    &h_alpha,
+                                                    dA,
+                                                    lda,
+                                                    dB,
+                                                    ldb,
+                                                    &h_beta,
+                                                    in_place ? (const To*)dD : (const To*)dC,
+                                                    ldc,
+                                                    dD,
+                                                    ldd,
+                                                    &epilogue));
+
+            CHECK_HIP_ERROR(hD.transfer_from(dD));
+            check_result(hD_gold, hD, ldd);
+        }
+
+        // FP8 A and BF8 B dequantized by scale_a and scale_b, with amax. A is exact in FP8, and
+        // B is mapped into [1, 8], which is exact in BF8.
+        if constexpr(std::is_same<Ti, float>{} && std::is_same<To, float>{}
+                     && std::is_same<Tc, float>{})
+        {
+            host_matrix<uint8_t> hA8(A_row, A_col, lda);
+            host_matrix<uint8_t> hB8(B_row, B_col, ldb);
+            uint8_t*             A8 = hA8;
+            uint8_t*             B8 = hB8;
+            for(rocblas_int j = 0; j < A_col; j++)
+                for(rocblas_int i = 0; i < A_row; i++)
+                    A8[i + size_t(j) * lda] = gemm_epilogue_f8_encode<4, 3>(A[i + size_t(j) * lda]);
+
+            host_matrix<float> hB_exact(B_row, B_col, ldb);
+            float*             B_exact = hB_exact;
+            for(rocblas_int j = 0; j < B_col; j++)
+                for(rocblas_int i = 0; i < B_row; i++)
+                {
+                    size_t idx   = i + size_t(j) * ldb;
+                    B_exact[idx] = float(std::abs(int(B[idx])) % 8 + 1);
+                    B8[idx]      = gemm_epilogue_f8_encode<5, 2>(B_exact[idx]);
+                }
+
+            device_matrix<uint8_t> dA8(A_row, A_col, lda);
+            device_matrix<uint8_t> dB8(B_row, B_col, ldb);
+            device_vector<float>   damax(1);
+            CHECK_DEVICE_ALLOCATION(dA8.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB8.memcheck());
+            CHECK_DEVICE_ALLOCATION(damax.memcheck());
+            CHECK_HIP_ERROR(dA8.transfer_from(hA8));
+            CHECK_HIP_ERROR(dB8.transfer_from(hB8));
+
+            const float scale_a = 0.5f, scale_b = 4;
+
+            rocblas_gemm_epilogue epilogue_f8{};
+            epilogue_f8.bias       = dbias;
+            epilogue_f8.activation = rocblas_gemm_activation_relu;
+            epilogue_f8.scale      = &h_scale;
+            epilogue_f8.scale_a    = &scale_a;
+            epilogue_f8.scale_b    = &scale_b;
+            epilogue_f8.amax       = damax;
+
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_ex3(handle,
+                                                 transA,
+                                                 transB,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 &h_alpha,
+                                                 dA8,
+                                                 rocblas_datatype_f8_r,
+                                                 lda,
+                                                 dB8,
+                                                 rocblas_datatype_bf8_r,
+                                                 ldb,
+                                                 &h_beta,
+                                                 dC,
+                                                 rocblas_datatype_f32_r,
+                                                 ldc,
+                                                 dD,
+                                                 rocblas_datatype_f32_r,
+                                                 ldd,
+                                                 rocblas_datatype_f32_r,
+                                                 rocblas_gemm_algo_standard,
+                                                 0,
+                                                 rocblas_gemm_flags_none,
+                                                 &epilogue_f8));
+
+            float amax;
+            CHECK_HIP_ERROR(hD.transfer_from(dD));
+            CHECK_HIP_ERROR(hipMemcpy(&amax, damax, sizeof(float), hipMemcpyDeviceToHost));
+
+            float* D_gold        = hD_gold;
+            double amax_expected = 0;
+            for(rocblas_int j = 0; j < N; j++)
+                for(rocblas_int i = 0; i < M; i++)
+                {
+                    double sum = 0;
+                    for(rocblas_int l = 0; l < K; l++)
+                    {
+                        float a = transA == rocblas_operation_none ? A[i + size_t(l) * lda]
+                                                                   : A[l + size_t(i) * lda];
+                        float b = transB == rocblas_operation_none
+                                      ? B_exact[l + size_t(j) * ldb]
+                                      : B_exact[j + size_t(l) * ldb];
+                        sum += double(a) * double(b);
+                    }
+                    double t = double(h_alpha) * scale_a * scale_b * sum
+                               + double(h_beta) * C[i + size_t(j) * ldc] + bias[i];
+                    double a = gemm_epilogue_activation(t, rocblas_gemm_activation_relu);
+                    amax_expected               = std::max(amax_expected, a);
+                    D_gold[i + size_t(j) * ldd] = float(h_scale * a);
+                }
+
+            check_result(hD_gold, hD, ldd);
+            if(arg.unit_check)
+                EXPECT_NEAR(amax, amax_expected, amax_expected * gemm_epilogue_tolerance<float>);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        rocblas_gemm_epilogue epilogue{};
+        epilogue.bias       = dbias;
+        epilogue.activation = rocblas_gemm_activation_relu;
+        epilogue.scale      = &h_scale;
+
+        auto gemm_ex3 = [&]() {
+            return rocblas_gemm_ex3_fn(handle,
+                                       transA,
+                                       transB,
+                                       M,
+                                       N,
+                                       K,
+                                       &h_alpha,
+                                       dA,
+                                       lda,
+                                       dB,
+                                       ldb,
+                                       &h_beta,
+                                       dC,
+                                       ldc,
+                                       dD,
+                                       ldd,
+                                       &epilogue);
+        };
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+            gemm_ex3();
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] { gemm_ex3(); });
+
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_beta,
+                      e_ldb,
+                      e_ldc,
+                      e_ldd>{}
+            .log_args<Tc>(rocblas_cout,
+                          arg,
+                          gpu_time_used,
+                          gemm_gflop_count<Tc>(M, N, K),
+                          gemm_gbyte_count<Ti, To>(M, N, K),
+                          cpu_time_used,
+                          rocblas_error);
+    }
+}
+
+// i8_r A and B with i32_r C and bias, requantized to i8_r D with per-tensor and per-row scales.
+// The scaling and rounding of each element is one float multiply and rint, so the host and
+// device results are identical.
+template <typename Ti,
+          typename To,
+          typename Tc,
+          std::enable_if_t<std::is_same<Ti, int8_t>{}, int> = 0>
+void testing_gemm_epilogue(const Arguments& arg)
+{
+    auto rocblas_gemm_ex3_fn = testing_gemm_epilogue_call<Ti, To, Tc, int8_t>;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M   = arg.M;
+    rocblas_int N   = arg.N;
+    rocblas_int K   = arg.K;
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+    rocblas_int ldd = arg.ldd;
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : std::max(K, 1);
+    rocblas_int A_col = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : std::max(K, 1);
+
+    rocblas_local_handle handle{arg};
+
+    // check for invalid sizes and quick return
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || ldd < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex3_fn(handle,
+                                                  transA,
+                                                  transB,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  nullptr,
+                                                  nullptr,
+                                                  lda,
+                                                  nullptr,
+                                                  ldb,
+                                                  nullptr,
+                                                  nullptr,
+                                                  ldc,
+                                                  nullptr,
+                                                  ldd,
+                                                  nullptr),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    Tc            h_alpha    = arg.get_alpha<Tc>();
+    Tc            h_beta     = arg.get_beta<Tc>();
+    const int32_t zero_point = 3;
+
+    // Naming: dX is in GPU (device) memory. hX is in CPU (host) memory
+    host_matrix<Ti>     hA(A_row, A_col, lda);
+    host_matrix<Ti>     hB(B_row, B_col, ldb);
+    host_matrix<To>     hC(M, N, ldc);
+    host_matrix<int8_t> hD(M, N, ldd);
+    host_matrix<int8_t> hD_gold(M, N, ldd);
+    host_vector<To>     hbias(M);
+    host_vector<float>  hquant_scale(M);
+
+    device_matrix<Ti>     dA(A_row, A_col, lda);
+    device_matrix<Ti>     dB(B_row, B_col, ldb);
+    device_matrix<To>     dC(M, N, ldc);
+    device_matrix<int8_t> dD(M, N, ldd);
+    device_vector<To>     dbias(M);
+    device_vector<float>  dquant_scale(M);
+    device_vector<Tc>     d_alpha(1);
+    device_vector<Tc>     d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(dbias.memcheck());
+    CHECK_DEVICE_ALLOCATION(dquant_scale.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // A and the bias alternate in sign so that the pre-activation result reaches both signs
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, true, true);
+    rocblas_init_matrix(hB, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+    rocblas_init_matrix(hC, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+    rocblas_init_vector(hbias, arg, rocblas_client_never_set_nan, false, true);
+
+    // scales which bring the i32_r result into the range of i8_r
+    for(rocblas_int i = 0; i < M; i++)
+        hquant_scale[i] = 1.0f / (3 + i % 5) / std::max(K, 1);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(dbias.transfer_from(hbias));
+    CHECK_HIP_ERROR(dquant_scale.transfer_from(hquant_scale));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tc), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tc), hipMemcpyHostToDevice));
+
+    const Ti* A    = hA;
+    const Ti* B    = hB;
+    const To* C    = hC;
+    const To* bias = hbias;
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error          = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(auto activation : {rocblas_gemm_activation_none, rocblas_gemm_activation_relu})
+        {
+            for(rocblas_int count : {1, M})
+            {
+                int8_t* D_gold = hD_gold;
+                for(rocblas_int j = 0; j < N; j++)
+                    for(rocblas_int i = 0; i < M; i++)
+                    {
+                        int32_t sum = 0;
+                        for(rocblas_int l = 0; l < K; l++)
+                        {
+                            Ti a = transA == rocblas_operation_none ? A[i + size_t(l) * lda]
+                                                                    : A[l + size_t(i) * lda];
+                            Ti b = transB == rocblas_operation_none ? B[l + size_t(j) * ldb]
+                                                                    : B[j + size_t(l) * ldb];
+                            sum += int32_t(a) * int32_t(b);
+                        }
+                        int32_t t = h_alpha * sum + h_beta * C[i + size_t(j) * ldc] + bias[i];
+                        float   a = gemm_epilogue_activation(float(t), activation)
+                                  * hquant_scale[count == 1 ? 0 : i];
+                        float   q = std::nearbyint(a) + zero_point;
+
+                        D_gold[i + size_t(j) * ldd]
+                            = int8_t(std::min(127.0f, std::max(-128.0f, q)));
+                    }
+
+                for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+                {
+                    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+                    bool host = pointer_mode == rocblas_pointer_mode_host;
+
+                    rocblas_gemm_epilogue epilogue{};
+                    epilogue.bias              = dbias;
+                    epilogue.activation        = activation;
+                    epilogue.quant_scale       = dquant_scale;
+                    epilogue.quant_scale_count = count;
+                    epilogue.quant_zero_point  = zero_point;
+
+                    handle.pre_test(arg);
+                    CHECK_ROCBLAS_ERROR(rocblas_gemm_ex3_fn(handle,
+                                                            transA,
+                                                            transB,
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            host ? &h_alpha : d_alpha,
+                                                            dA,
+                                                            lda,
+                                                            dB,
+                                                            ldb,
+                                                            host ? &h_beta : d_beta,
+                                                            dC,
+                                                            ldc,
+                                                            dD,
+                                                            ldd,
+                                                            &epilogue));
+                    handle.post_test(arg);
+
+                    CHECK_HIP_ERROR(hD.transfer_from(dD));
+                    if(arg.unit_check)
+                        unit_check_general<int8_t>(M, N, ldd, hD_gold, hD);
+                    if(arg.norm_check)
+                    {
+                        auto err = std::abs(norm_check_general<int8_t>(
+                            'F', M, N, ldd, (int8_t*)hD_gold, (int8_t*)hD));
+                        rocblas_error = err > rocblas_error ? err : rocblas_error;
+                    }
+                }
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        rocblas_gemm_epilogue epilogue{};
+        epilogue.bias              = dbias;
+        epilogue.activation        = rocblas_gemm_activation_relu;
+        epilogue.quant_scale       = dquant_scale;
+        epilogue.quant_scale_count = M;
+        epilogue.quant_zero_point  = zero_point;
+
+        auto gemm_ex3 = [&]() {
+            return rocblas_gemm_ex3_fn(handle,
+                                       transA,
+                                       transB,
+                                       M,
+                                       N,
+                                       K,
+                                       &h_alpha,
+                                       dA,
+                                       lda,
+                                       dB,
+                                       ldb,
+                                       &h_beta,
+                                       dC,
+                                       ldc,
+                                       dD,
+                                       ldd,
+                                       &epilogue);
+        };
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+            gemm_ex3();
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] { gemm_ex3(); });
+
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_beta,
+                      e_ldb,
+                      e_ldc,
+                      e_ldd>{}
+            .log_args<Tc>(rocblas_cout,
+                          arg,
+                          gpu_time_used,
+                          gemm_gflop_count<Tc>(M, N, K),
+                          gemm_gbyte_count<Ti, To>(M, N, K),
+                          cpu_time_used,
+                          rocblas_error);
+    }
+}
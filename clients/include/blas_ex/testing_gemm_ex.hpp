@@ -23,6 +23,7 @@
 #pragma once
 
 #include "../../library/src/include/handle.hpp"
+#include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
 #include "near.hpp"
@@ -422,89 +423,100 @@ void testing_gemm_ex(const Arguments& arg)
 
     bool alt = (rocblas_gemm_flags_fp16_alt_impl & flags);
 
-    // Initialize data on host memory
-    rocblas_init_matrix<Ti>(
-        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
-    rocblas_init_matrix<Ti>(
-        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
-    rocblas_init_matrix<To>(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
-
-    if(std::is_same<To, rocblas_half>{} && std::is_same<Tc, float>{}
-       && arg.arithmetic_check == rocblas_arithmetic_check::ieee16_ieee32)
+    if(rocblas_client_device_init<Ti>(arg) && rocblas_client_device_init<To>(arg))
     {
-        // half precision IEEE has max and lowest values 65504 and -65504,
-        // float precision IEEE has max and lowest values 3.403e+38 and -3.403e+38
-        // the following will overflow to inf in half arithmetic,
-        // but it will equal zero in float arithmetic   65504 * 2 - 65504 * 2
-        //
-        // set matrix A and matrix B so reduction sum has 65504 * 2 - 65504 * 2
-        //
-        const rocblas_half ieee_half_near_max(65504.0 - 4.0);
-        const rocblas_half positive_two(2.0);
-        const rocblas_half negative_two(-2.0);
-        if(M >= 2 && N >= 2 && K >= 2)
+        // Initialize data on device memory, the results are not verified
+        CHECK_HIP_ERROR(rocblas_init_matrix_device(dA, arg, true, false));
+        CHECK_HIP_ERROR(rocblas_init_matrix_device(dB, arg, false, true));
+        CHECK_HIP_ERROR(rocblas_init_matrix_device(dC, arg, false, false));
+    }
+    else
+    {
+        // Initialize data on host memory
+        rocblas_init_matrix<Ti>(
+            hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+        rocblas_init_matrix<Ti>(
+            hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+        rocblas_init_matrix<To>(
+            hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+        if(std::is_same<To, rocblas_half>{} && std::is_same<Tc, float>{}
+           && arg.arithmetic_check == rocblas_arithmetic_check::ieee16_ieee32)
         {
-            Ti* A = (Ti*)hA;
-            Ti* B = (Ti*)hB;
-            if(transA == rocblas_operation_none)
-            {
-                A[0]   = Ti(ieee_half_near_max);
-                A[lda] = Ti(ieee_half_near_max);
-            }
-            else
+            // half precision IEEE has max and lowest values 65504 and -65504,
+            // float precision IEEE has max and lowest values 3.403e+38 and -3.403e+38
+            // the following will overflow to inf in half arithmetic,
+            // but it will equal zero in float arithmetic   65504 * 2 - 65504 * 2
+            //
+            // set matrix A and matrix B so reduction sum has 65504 * 2 - 65504 * 2
+            //
+            const rocblas_half ieee_half_near_max(65504.0 - 4.0);
+            const rocblas_half positive_two(2.0);
+            const rocblas_half negative_two(-2.0);
+            if(M >= 2 && N >= 2 && K >= 2)
             {
-                A[0] = Ti(ieee_half_near_max);
-                A[1] = Ti(ieee_half_near_max);
-            }
-            if(transB == rocblas_operation_none)
-            {
-                for(int j = 0; j < N; j++)
+                Ti* A = (Ti*)hA;
+                Ti* B = (Ti*)hB;
+                if(transA == rocblas_operation_none)
                 {
-                    B[j * ldb]     = j % 2 == 0 ? Ti(positive_two) : Ti(negative_two);
-                    B[1 + j * ldb] = j % 2 == 0 ? Ti(negative_two) : Ti(positive_two);
+                    A[0]   = Ti(ieee_half_near_max);
+                    A[lda] = Ti(ieee_half_near_max);
                 }
-            }
-            else
-            {
-                for(int j = 0; j < N; j++)
+                else
                 {
-                    B[j]       = j % 2 == 0 ? Ti(positive_two) : Ti(negative_two);
-                    B[ldb + j] = j % 2 == 0 ? Ti(negative_two) : Ti(positive_two);
+                    A[0] = Ti(ieee_half_near_max);
+                    A[1] = Ti(ieee_half_near_max);
+                }
+                if(transB == rocblas_operation_none)
+                {
+                    for(int j = 0; j < N; j++)
+                    {
+                        B[j * ldb]     = j % 2 == 0 ? Ti(positive_two) : Ti(negative_two);
+                        B[1 + j * ldb] = j % 2 == 0 ? Ti(negative_two) : Ti(positive_two);
+                    }
+                }
+                else
+                {
+                    for(int j = 0; j < N; j++)
+                    {
+                        B[j]       = j % 2 == 0 ? Ti(positive_two) : Ti(negative_two);
+                        B[ldb + j] = j % 2 == 0 ? Ti(negative_two) : Ti(positive_two);
+                    }
                 }
             }
         }
-    }
 
-    // copy data from CPU to device
-    // do packing only when pack_to_int8x4=true (int8x4)
-    // if int8x4 and A not transposed and valid case, pack A
-    if(std::is_same<Ti, int8_t>{} && transA == rocblas_operation_none && pack_to_int8x4)
-    {
-        host_matrix<Ti> hA_packed(A_row, A_col, lda);
+        // copy data from CPU to device
+        // do packing only when pack_to_int8x4=true (int8x4)
+        // if int8x4 and A not transposed and valid case, pack A
+        if(std::is_same<Ti, int8_t>{} && transA == rocblas_operation_none && pack_to_int8x4)
+        {
+            host_matrix<Ti> hA_packed(A_row, A_col, lda);
 
-        rocblas_packInt8((Ti*)hA_packed, (Ti*)hA, M, K, lda);
-        CHECK_HIP_ERROR(dA.transfer_from(hA_packed));
-    }
-    else
-    {
-        CHECK_HIP_ERROR(dA.transfer_from(hA));
-    }
+            rocblas_packInt8((Ti*)hA_packed, (Ti*)hA, M, K, lda);
+            CHECK_HIP_ERROR(dA.transfer_from(hA_packed));
+        }
+        else
+        {
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+        }
 
-    // do packing only when pack_to_int8x4=true (int8x4)
-    // if int8x4 and B transposed and valid case, pack B
-    if(std::is_same<Ti, int8_t>{} && transB != rocblas_operation_none && pack_to_int8x4)
-    {
-        host_matrix<Ti> hB_packed(B_row, B_col, ldb);
+        // do packing only when pack_to_int8x4=true (int8x4)
+        // if int8x4 and B transposed and valid case, pack B
+        if(std::is_same<Ti, int8_t>{} && transB != rocblas_operation_none && pack_to_int8x4)
+        {
+            host_matrix<Ti> hB_packed(B_row, B_col, ldb);
 
-        rocblas_packInt8((Ti*)hB_packed, (Ti*)hB, N, K, ldb);
-        CHECK_HIP_ERROR(dB.transfer_from(hB_packed));
-    }
-    else
-    {
-        CHECK_HIP_ERROR(dB.transfer_from(hB));
-    }
+            rocblas_packInt8((Ti*)hB_packed, (Ti*)hB, N, K, ldb);
+            CHECK_HIP_ERROR(dB.transfer_from(hB_packed));
+        }
+        else
+        {
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+        }
 
-    CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+    }
 
     if(arg.unit_check || arg.norm_check)
     {
@@ -733,7 +745,7 @@ void testing_gemm_ex(const Arguments& arg)
                           arg,
                           gpu_time_used,
                           gemm_gflop_count<Tc>(M, N, K),
-                          ArgumentLogging::NA_value,
+                          gemm_gbyte_count<Ti, To>(M, N, K),
                           cpu_time_used,
                           rocblas_error);
     }
@@ -0,0 +1,651 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <memory>
+#include <vector>
+
+// Calls rocblas_gemm_grouped_ex with the operations of the first group, or
+// rocblas_gemm_grouped_trans_ex with the operations of each group
+template <bool PER_GROUP_OPS>
+rocblas_status testing_gemm_grouped_ex_call(rocblas_handle           handle,
+                                            rocblas_operation        trans_a,
+                                            rocblas_operation        trans_b,
+                                            const rocblas_operation* trans_a_array,
+                                            const rocblas_operation* trans_b_array,
+                                            const rocblas_int*       m,
+                                            const rocblas_int*       n,
+                                            const rocblas_int*       k,
+                                            const void*              alpha,
+                                            const void* const        a[],
+                                            rocblas_datatype         a_type,
+                                            const rocblas_int*       lda,
+                                            const void* const        b[],
+                                            rocblas_datatype         b_type,
+                                            const rocblas_int*       ldb,
+                                            const void*              beta,
+                                            const void* const        c[],
+                                            rocblas_datatype         c_type,
+                                            const rocblas_int*       ldc,
+                                            void* const              d[],
+                                            rocblas_datatype         d_type,
+                                            const rocblas_int*       ldd,
+                                            rocblas_int              group_count,
+                                            rocblas_datatype         compute_type)
+{
+    if(PER_GROUP_OPS)
+        return rocblas_gemm_grouped_trans_ex(handle,
+                                             trans_a_array,
+                                             trans_b_array,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             a,
+                                             a_type,
+                                             lda,
+                                             b,
+                                             b_type,
+                                             ldb,
+                                             beta,
+                                             c,
+                                             c_type,
+                                             ldc,
+                                             d,
+                                             d_type,
+                                             ldd,
+                                             group_count,
+                                             compute_type,
+                                             rocblas_gemm_algo_standard,
+                                             0,
+                                             rocblas_gemm_flags_none);
+    else
+        return rocblas_gemm_grouped_ex(handle,
+                                       trans_a,
+                                       trans_b,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       a,
+                                       a_type,
+                                       lda,
+                                       b,
+                                       b_type,
+                                       ldb,
+                                       beta,
+                                       c,
+                                       c_type,
+                                       ldc,
+                                       d,
+                                       d_type,
+                                       ldd,
+                                       group_count,
+                                       compute_type,
+                                       rocblas_gemm_algo_standard,
+                                       0,
+                                       rocblas_gemm_flags_none);
+}
+
+template <typename Ti, typename To, typename Tc, bool PER_GROUP_OPS = false>
+void testing_gemm_grouped_ex_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemm_grouped_ex_fn = testing_gemm_grouped_ex_call<PER_GROUP_OPS>;
+
+    const rocblas_datatype a_type       = rocblas_type2datatype<Ti>();
+    const rocblas_datatype c_type       = rocblas_type2datatype<To>();
+    const rocblas_datatype compute_type = rocblas_type2datatype<Tc>();
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const rocblas_operation transA = rocblas_operation_none;
+        const rocblas_operation transB = rocblas_operation_none;
+
+        const rocblas_int group_count = 2;
+        const rocblas_int M           = 100;
+        const rocblas_int N           = 101;
+        const rocblas_int K           = 102;
+
+        device_vector<Tc> alpha_d(1), beta_d(1);
+        const Tc          alpha_h(1), beta_h(2);
+
+        const Tc* alpha = &alpha_h;
+        const Tc* beta  = &beta_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(beta_d, beta, sizeof(*beta), hipMemcpyHostToDevice));
+            beta = beta_d;
+        }
+
+        // Allocate device memory
+        device_vector<rocblas_int>       dm(group_count), dn(group_count), dk(group_count);
+        device_vector<rocblas_operation> dtrans(group_count);
+        device_matrix<Ti>                dA(M, K, M);
+        device_matrix<Ti>                dB(K, N, K);
+        device_matrix<To>                dC(M, N, M);
+        device_vector<Ti*>               dpA(group_count), dpB(group_count);
+        device_vector<To*>               dpC(group_count);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(alpha_d.memcheck());
+        CHECK_DEVICE_ALLOCATION(beta_d.memcheck());
+        CHECK_DEVICE_ALLOCATION(dm.memcheck());
+        CHECK_DEVICE_ALLOCATION(dn.memcheck());
+        CHECK_DEVICE_ALLOCATION(dk.memcheck());
+        CHECK_DEVICE_ALLOCATION(dtrans.memcheck());
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC.memcheck());
+        CHECK_DEVICE_ALLOCATION(dpA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dpB.memcheck());
+        CHECK_DEVICE_ALLOCATION(dpC.memcheck());
+
+        host_vector<rocblas_int>       hm(group_count), hn(group_count), hk(group_count);
+        host_vector<rocblas_operation> htrans(group_count);
+        host_vector<Ti*>               hpA(group_count), hpB(group_count);
+        host_vector<To*>               hpC(group_count);
+        for(rocblas_int g = 0; g < group_count; g++)
+        {
+            hm[g]     = M;
+            hn[g]     = N;
+            hk[g]     = K;
+            htrans[g] = rocblas_operation_none;
+            hpA[g]    = dA;
+            hpB[g]    = dB;
+            hpC[g]    = dC;
+        }
+        CHECK_HIP_ERROR(dm.transfer_from(hm));
+        CHECK_HIP_ERROR(dn.transfer_from(hn));
+        CHECK_HIP_ERROR(dk.transfer_from(hk));
+        CHECK_HIP_ERROR(dtrans.transfer_from(htrans));
+        CHECK_HIP_ERROR(dpA.transfer_from(hpA));
+        CHECK_HIP_ERROR(dpB.transfer_from(hpB));
+        CHECK_HIP_ERROR(dpC.transfer_from(hpC));
+
+        const void* const* a = (const void* const*)(Ti**)dpA;
+        const void* const* b = (const void* const*)(Ti**)dpB;
+        const void* const* c = (const void* const*)(To**)dpC;
+        void* const*       d = (void* const*)(To**)dpC;
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_ex_fn(nullptr,
+                                                         transA,
+                                                         transB,
+                                                         dtrans,
+                                                         dtrans,
+                                                         dm,
+                                                         dn,
+                                                         dk,
+                                                         alpha,
+                                                         a,
+                                                         a_type,
+                                                         dm,
+                                                         b,
+                                                         a_type,
+                                                         dk,
+                                                         beta,
+                                                         c,
+                                                         c_type,
+                                                         dm,
+                                                         d,
+                                                         c_type,
+                                                         dm,
+                                                         group_count,
+                                                         compute_type),
+                              rocblas_status_invalid_handle);
+
+        if(!PER_GROUP_OPS)
+            EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_ex_fn(handle,
+                                                             (rocblas_operation)rocblas_fill_full,
+                                                             transB,
+                                                             dtrans,
+                                                             dtrans,
+                                                             dm,
+                                                             dn,
+                                                             dk,
+                                                             alpha,
+                                                             a,
+                                                             a_type,
+                                                             dm,
+                                                             b,
+                                                             a_type,
+                                                             dk,
+                                                             beta,
+                                                             c,
+                                                             c_type,
+                                                             dm,
+                                                             d,
+                                                             c_type,
+                                                             dm,
+                                                             group_count,
+                                                             compute_type),
+                                  rocblas_status_invalid_value);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_ex_fn(handle,
+                                                         transA,
+                                                         transB,
+                                                         dtrans,
+                                                         dtrans,
+                                                         dm,
+                                                         dn,
+                                                         dk,
+                                                         alpha,
+                                                         a,
+                                                         a_type,
+                                                         dm,
+                                                         b,
+                                                         a_type,
+                                                         dk,
+                                                         beta,
+                                                         c,
+                                                         c_type,
+                                                         dm,
+                                                         d,
+                                                         c_type,
+                                                         dm,
+                                                         -1,
+                                                         compute_type),
+                              rocblas_status_invalid_size);
+
+        // Each of the arrays, the operations of the groups, and the scalars are checked
+        auto expect_invalid_pointer = [&](const rocblas_operation* trans_arg,
+                                          const rocblas_int*       m_arg,
+                                          const void*              alpha_arg,
+                                          const void*              beta_arg,
+                                          const void* const*       a_arg,
+                                          void* const*             d_arg) {
+            EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_ex_fn(handle,
+                                                             transA,
+                                                             transB,
+                                                             trans_arg,
+                                                             trans_arg,
+                                                             m_arg,
+                                                             dn,
+                                                             dk,
+                                                             alpha_arg,
+                                                             a_arg,
+                                                             a_type,
+                                                             dm,
+                                                             b,
+                                                             a_type,
+                                                             dk,
+                                                             beta_arg,
+                                                             c,
+                                                             c_type,
+                                                             dm,
+                                                             d_arg,
+                                                             c_type,
+                                                             dm,
+                                                             group_count,
+                                                             compute_type),
+                                  rocblas_status_invalid_pointer);
+        };
+        expect_invalid_pointer(dtrans, nullptr, alpha, beta, a, d);
+        expect_invalid_pointer(dtrans, dm, nullptr, beta, a, d);
+        expect_invalid_pointer(dtrans, dm, alpha, nullptr, a, d);
+        expect_invalid_pointer(dtrans, dm, alpha, beta, nullptr, d);
+        expect_invalid_pointer(dtrans, dm, alpha, beta, a, nullptr);
+        if(PER_GROUP_OPS)
+            expect_invalid_pointer(nullptr, dm, alpha, beta, a, d);
+
+        // Quick return with no groups, before any pointer is checked
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_ex_fn(handle,
+                                                         transA,
+                                                         transB,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         a_type,
+                                                         nullptr,
+                                                         nullptr,
+                                                         a_type,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         c_type,
+                                                         nullptr,
+                                                         nullptr,
+                                                         c_type,
+                                                         nullptr,
+                                                         0,
+                                                         compute_type),
+                              rocblas_status_success);
+    }
+}
+
+template <typename Ti, typename To, typename Tc>
+void testing_gemm_grouped_trans_ex_bad_arg(const Arguments& arg)
+{
+    testing_gemm_grouped_ex_bad_arg<Ti, To, Tc, true>(arg);
+}
+
+// Groups of distinct and repeated sizes: consecutive pairs of groups share m, and every third
+// group shares n. With per-group operations, the odd groups swap the operation of A between
+// none and transpose.
+template <typename Ti, typename To, typename Tc, bool PER_GROUP_OPS = false>
+void testing_gemm_grouped_ex(const Arguments& arg)
+{
+    auto rocblas_gemm_grouped_ex_fn = testing_gemm_grouped_ex_call<PER_GROUP_OPS>;
+
+    const rocblas_datatype a_type       = rocblas_type2datatype<Ti>();
+    const rocblas_datatype c_type       = rocblas_type2datatype<To>();
+    const rocblas_datatype compute_type = rocblas_type2datatype<Tc>();
+
+    rocblas_operation transA      = char2rocblas_operation(arg.transA);
+    rocblas_operation transB      = char2rocblas_operation(arg.transB);
+    rocblas_int       M           = arg.M;
+    rocblas_int       N           = arg.N;
+    rocblas_int       K           = arg.K;
+    rocblas_int       group_count = arg.batch_count;
+
+    Tc h_alpha = arg.get_alpha<Tc>();
+    Tc h_beta  = arg.get_beta<Tc>();
+
+    rocblas_local_handle handle{arg};
+
+    // check for invalid sizes
+    if(M < 0 || N < 0 || K < 0 || group_count <= 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_ex_fn(handle,
+                                                         transA,
+                                                         transB,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         a_type,
+                                                         nullptr,
+                                                         nullptr,
+                                                         a_type,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         c_type,
+                                                         nullptr,
+                                                         nullptr,
+                                                         c_type,
+                                                         nullptr,
+                                                         group_count,
+                                                         compute_type),
+                              group_count < 0 ? rocblas_status_invalid_size
+                                              : rocblas_status_success);
+        return;
+    }
+
+    host_vector<rocblas_int>       hm(group_count), hn(group_count), hk(group_count);
+    host_vector<rocblas_int>       hlda(group_count), hldb(group_count), hldc(group_count);
+    host_vector<rocblas_operation> htransA(group_count), htransB(group_count);
+    for(rocblas_int g = 0; g < group_count; g++)
+    {
+        hm[g]      = M + (g / 2) * 3;
+        hn[g]      = N + (g % 3);
+        hk[g]      = K;
+        htransA[g] = PER_GROUP_OPS && g % 2 ? (transA == rocblas_operation_none
+                                                   ? rocblas_operation_transpose
+                                                   : rocblas_operation_none)
+                                            : transA;
+        htransB[g] = transB;
+        hlda[g]    = std::max(htransA[g] == rocblas_operation_none ? hm[g] : hk[g], 1);
+        hldb[g]    = std::max(htransB[g] == rocblas_operation_none ? hk[g] : hn[g], 1);
+        hldc[g]    = std::max(hm[g], 1);
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    std::vector<host_matrix<Ti>> hA, hB;
+    std::vector<host_matrix<To>> hC, hD_1, hD_gold;
+
+    // Allocate device memory
+    std::vector<std::unique_ptr<device_matrix<Ti>>> dA, dB;
+    std::vector<std::unique_ptr<device_matrix<To>>> dC, dD;
+    host_vector<Ti*>                                hpA(group_count), hpB(group_count);
+    host_vector<To*>                                hpC(group_count), hpD(group_count);
+
+    for(rocblas_int g = 0; g < group_count; g++)
+    {
+        rocblas_int A_row = htransA[g] == rocblas_operation_none ? hm[g] : std::max(hk[g], 1);
+        rocblas_int A_col = htransA[g] == rocblas_operation_none ? std::max(hk[g], 1) : hm[g];
+        rocblas_int B_row = htransB[g] == rocblas_operation_none ? std::max(hk[g], 1) : hn[g];
+        rocblas_int B_col = htransB[g] == rocblas_operation_none ? hn[g] : std::max(hk[g], 1);
+
+        hA.emplace_back(A_row, A_col, hlda[g]);
+        hB.emplace_back(B_row, B_col, hldb[g]);
+        hC.emplace_back(hm[g], hn[g], hldc[g]);
+        hD_1.emplace_back(hm[g], hn[g], hldc[g]);
+
+        dA.emplace_back(new device_matrix<Ti>(A_row, A_col, hlda[g]));
+        dB.emplace_back(new device_matrix<Ti>(B_row, B_col, hldb[g]));
+        dC.emplace_back(new device_matrix<To>(hm[g], hn[g], hldc[g]));
+        dD.emplace_back(new device_matrix<To>(hm[g], hn[g], hldc[g]));
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dA[g]->memcheck());
+        CHECK_DEVICE_ALLOCATION(dB[g]->memcheck());
+        CHECK_DEVICE_ALLOCATION(dC[g]->memcheck());
+        CHECK_DEVICE_ALLOCATION(dD[g]->memcheck());
+
+        // Initialize data on host memory
+        rocblas_init_matrix(
+            hA[g], arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, g == 0);
+        rocblas_init_matrix(
+            hB[g], arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+        rocblas_init_matrix(
+            hC[g], arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+        hD_gold.push_back(hC[g]);
+
+        CHECK_HIP_ERROR(dA[g]->transfer_from(hA[g]));
+        CHECK_HIP_ERROR(dB[g]->transfer_from(hB[g]));
+        CHECK_HIP_ERROR(dC[g]->transfer_from(hC[g]));
+
+        hpA[g] = *dA[g];
+        hpB[g] = *dB[g];
+        hpC[g] = *dC[g];
+        hpD[g] = *dD[g];
+    }
+
+    device_vector<rocblas_int>       dm(group_count), dn(group_count), dk(group_count);
+    device_vector<rocblas_int>       dlda(group_count), dldb(group_count), dldc(group_count);
+    device_vector<rocblas_operation> dtransA(group_count), dtransB(group_count);
+    device_vector<Ti*>               dpA(group_count), dpB(group_count);
+    device_vector<To*>               dpC(group_count), dpD(group_count);
+    device_vector<Tc>                d_alpha(1), d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dm.memcheck());
+    CHECK_DEVICE_ALLOCATION(dn.memcheck());
+    CHECK_DEVICE_ALLOCATION(dk.memcheck());
+    CHECK_DEVICE_ALLOCATION(dlda.memcheck());
+    CHECK_DEVICE_ALLOCATION(dldb.memcheck());
+    CHECK_DEVICE_ALLOCATION(dldc.memcheck());
+    CHECK_DEVICE_ALLOCATION(dtransA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dtransB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dpA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dpB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dpC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dpD.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    CHECK_HIP_ERROR(dm.transfer_from(hm));
+    CHECK_HIP_ERROR(dn.transfer_from(hn));
+    CHECK_HIP_ERROR(dk.transfer_from(hk));
+    CHECK_HIP_ERROR(dlda.transfer_from(hlda));
+    CHECK_HIP_ERROR(dldb.transfer_from(hldb));
+    CHECK_HIP_ERROR(dldc.transfer_from(hldc));
+    CHECK_HIP_ERROR(dtransA.transfer_from(htransA));
+    CHECK_HIP_ERROR(dtransB.transfer_from(htransB));
+    CHECK_HIP_ERROR(dpA.transfer_from(hpA));
+    CHECK_HIP_ERROR(dpB.transfer_from(hpB));
+    CHECK_HIP_ERROR(dpC.transfer_from(hpC));
+    CHECK_HIP_ERROR(dpD.transfer_from(hpD));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tc), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tc), hipMemcpyHostToDevice));
+
+    const void* const* a = (const void* const*)(Ti**)dpA;
+    const void* const* b = (const void* const*)(Ti**)dpB;
+    const void* const* c = (const void* const*)(To**)dpC;
+    void* const*       d = (void* const*)(To**)dpD;
+
+    auto gemm_grouped = [&](const Tc* alpha, const Tc* beta) {
+        return rocblas_gemm_grouped_ex_fn(handle,
+                                          transA,
+                                          transB,
+                                          dtransA,
+                                          dtransB,
+                                          dm,
+                                          dn,
+                                          dk,
+                                          alpha,
+                                          a,
+                                          a_type,
+                                          dlda,
+                                          b,
+                                          a_type,
+                                          dldb,
+                                          beta,
+                                          c,
+                                          c_type,
+                                          dldc,
+                                          d,
+                                          c_type,
+                                          dldc,
+                                          group_count,
+                                          compute_type);
+    };
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error          = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int g = 0; g < group_count; g++)
+            cblas_gemm<Ti, To, Tc>(htransA[g],
+                                   htransB[g],
+                                   hm[g],
+                                   hn[g],
+                                   hk[g],
+                                   h_alpha,
+                                   hA[g],
+                                   hlda[g],
+                                   hB[g],
+                                   hldb[g],
+                                   h_beta,
+                                   hD_gold[g],
+                                   hldc[g]);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+            const Tc* alpha = pointer_mode == rocblas_pointer_mode_host ? &h_alpha : d_alpha;
+            const Tc* beta  = pointer_mode == rocblas_pointer_mode_host ? &h_beta : d_beta;
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(gemm_grouped(alpha, beta));
+            handle.post_test(arg);
+
+            for(rocblas_int g = 0; g < group_count; g++)
+            {
+                CHECK_HIP_ERROR(hD_1[g].transfer_from(*dD[g]));
+
+                if(arg.unit_check)
+                    unit_check_general<To>(hm[g], hn[g], hldc[g], hD_gold[g], hD_1[g]);
+
+                if(arg.norm_check)
+                {
+                    auto err = std::abs(
+                        norm_check_general<To>('F', hm[g], hn[g], hldc[g], hD_gold[g], hD_1[g]));
+                    rocblas_error = err > rocblas_error ? err : rocblas_error;
+                }
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+            gemm_grouped(&h_alpha, &h_beta);
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(
+            stream, number_hot_calls, [&] { gemm_grouped(&h_alpha, &h_beta); });
+
+        double gflops = 0, gbytes = 0;
+        for(rocblas_int g = 0; g < group_count; g++)
+        {
+            gflops += gemm_gflop_count<Tc>(hm[g], hn[g], hk[g]);
+            gbytes += gemm_gbyte_count<Ti>(hm[g], hn[g], hk[g]);
+        }
+
+        ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_beta, e_batch_count>{}
+            .log_args<To>(rocblas_cout,
+                          arg,
+                          gpu_time_used,
+                          gflops,
+                          gbytes,
+                          cpu_time_used,
+                          rocblas_error);
+    }
+}
+
+template <typename Ti, typename To, typename Tc>
+void testing_gemm_grouped_trans_ex(const Arguments& arg)
+{
+    testing_gemm_grouped_ex<Ti, To, Tc, true>(arg);
+}
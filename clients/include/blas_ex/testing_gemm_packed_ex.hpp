@@ -0,0 +1,447 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <cmath>
+
+// Encodes v, which must be exactly representable, as a BF8 value (5 exponent and 2 mantissa
+// bits), as for rocblas_datatype_bf8_r
+inline uint8_t gemm_packed_bf8_encode(float v)
+{
+    if(v == 0)
+        return 0;
+    int   e;
+    float f    = std::frexp(std::abs(v), &e);
+    int   mant = int((f * 2 - 1) * (1 << 2));
+    return (v < 0 ? 0x80 : 0) | (e - 1 + (1 << 4)) << 2 | mant;
+}
+
+// Calls rocblas_gemm_packed_ex with the data types of Ti, To and Tc
+template <typename Ti, typename To, typename Tc>
+rocblas_status testing_gemm_packed_ex_call(rocblas_handle        handle,
+                                           rocblas_operation     transA,
+                                           rocblas_int           M,
+                                           rocblas_int           N,
+                                           rocblas_int           K,
+                                           const Tc*             alpha,
+                                           const Ti*             A,
+                                           rocblas_int           lda,
+                                           rocblas_gemm_packed_b packed_b,
+                                           const Tc*             beta,
+                                           const To*             C,
+                                           rocblas_int           ldc,
+                                           To*                   D,
+                                           rocblas_int           ldd)
+{
+    return rocblas_gemm_packed_ex(handle,
+                                  transA,
+                                  M,
+                                  N,
+                                  K,
+                                  alpha,
+                                  A,
+                                  rocblas_type2datatype<Ti>(),
+                                  lda,
+                                  packed_b,
+                                  beta,
+                                  C,
+                                  rocblas_type2datatype<To>(),
+                                  ldc,
+                                  D,
+                                  rocblas_type2datatype<To>(),
+                                  ldd,
+                                  rocblas_type2datatype<Tc>(),
+                                  rocblas_gemm_algo_standard,
+                                  rocblas_gemm_flags_none);
+}
+
+template <typename Ti, typename To, typename Tc>
+void testing_gemm_packed_ex_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemm_packed_ex_fn = testing_gemm_packed_ex_call<Ti, To, Tc>;
+
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+
+    const rocblas_int M = 100;
+    const rocblas_int N = 100;
+    const rocblas_int K = 101;
+
+    const rocblas_int lda = 101;
+    const rocblas_int ldb = 101;
+    const rocblas_int ldc = 101;
+    const rocblas_int ldd = 101;
+
+    const rocblas_datatype type = rocblas_type2datatype<Ti>();
+
+    // a type which differs from Ti, and to which Ti cannot be packed
+    const rocblas_datatype other_type
+        = std::is_same<Ti, double>{} ? rocblas_datatype_f32_r : rocblas_datatype_f64_r;
+
+    const Tc alpha(1), beta(1);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    // Allocate device memory
+    device_matrix<Ti> dA(M, K, lda);
+    device_matrix<Ti> dB(K, N, ldb);
+    device_matrix<To> dC(M, N, ldc);
+    device_matrix<To> dD(M, N, ldd);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+
+    rocblas_gemm_packed_b packed = nullptr;
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_pack_b(nullptr, transB, K, N, dB, type, ldb, type, &packed),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_pack_b(handle, transB, K, N, dB, type, ldb, type, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_pack_b(handle, rocblas_operation(-1), K, N, dB, type, ldb, type, &packed),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_pack_b(handle, transB, -1, N, dB, type, ldb, type, &packed),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_pack_b(handle, transB, K, -1, dB, type, ldb, type, &packed),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_pack_b(handle, transB, K, N, dB, type, K - 1, type, &packed),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_pack_b(handle, transB, K, N, nullptr, type, ldb, type, &packed),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_pack_b(handle, transB, K, N, dB, type, ldb, other_type, &packed),
+        rocblas_status_not_implemented);
+
+    // a nullptr packed B may be destroyed
+    EXPECT_ROCBLAS_STATUS(rocblas_destroy_gemm_packed_b(nullptr), rocblas_status_success);
+
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_pack_b(handle, transB, K, N, dB, type, ldb, type, &packed));
+
+    auto gemm_packed_ex = [&](rocblas_handle h, rocblas_int k, rocblas_gemm_packed_b packed_b) {
+        return rocblas_gemm_packed_ex_fn(
+            h, transA, M, N, k, &alpha, dA, lda, packed_b, &beta, dC, ldc, dD, ldd);
+    };
+
+    EXPECT_ROCBLAS_STATUS(gemm_packed_ex(nullptr, K, packed), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(gemm_packed_ex(handle, K, nullptr), rocblas_status_invalid_pointer);
+
+    // the sizes must be those of the packed B
+    EXPECT_ROCBLAS_STATUS(gemm_packed_ex(handle, K + 1, packed), rocblas_status_invalid_size);
+
+    // a_type must be the packed type
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_packed_ex(handle,
+                                                 transA,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 &alpha,
+                                                 dA,
+                                                 other_type,
+                                                 lda,
+                                                 packed,
+                                                 &beta,
+                                                 dC,
+                                                 rocblas_type2datatype<To>(),
+                                                 ldc,
+                                                 dD,
+                                                 rocblas_type2datatype<To>(),
+                                                 ldd,
+                                                 rocblas_type2datatype<Tc>(),
+                                                 rocblas_gemm_algo_standard,
+                                                 rocblas_gemm_flags_none),
+                          rocblas_status_invalid_value);
+
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_gemm_packed_b(packed));
+}
+
+template <typename Ti, typename To, typename Tc>
+void testing_gemm_packed_ex(const Arguments& arg)
+{
+    auto rocblas_gemm_packed_ex_fn = testing_gemm_packed_ex_call<Ti, To, Tc>;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M   = arg.M;
+    rocblas_int N   = arg.N;
+    rocblas_int K   = arg.K;
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+    rocblas_int ldd = arg.ldd;
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : std::max(K, 1);
+    rocblas_int A_col = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : std::max(K, 1);
+
+    const rocblas_datatype type = rocblas_type2datatype<Ti>();
+
+    rocblas_local_handle handle{arg};
+
+    // check for invalid sizes and quick return; rocblas_gemm_pack_b checks the sizes of B, and
+    // rocblas_gemm_packed_ex the sizes of A, C and D
+    bool invalid_size_b = N < 0 || K < 0 || ldb < B_row;
+    bool invalid_size   = invalid_size_b || M < 0 || lda < A_row || ldc < M || ldd < M;
+    if(invalid_size || !M || !N)
+    {
+        rocblas_gemm_packed_b packed = nullptr;
+        if(invalid_size_b)
+        {
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_gemm_pack_b(handle, transB, K, N, nullptr, type, ldb, type, &packed),
+                rocblas_status_invalid_size);
+            return;
+        }
+
+        device_matrix<Ti> dB(B_row, B_col, ldb);
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+        CHECK_ROCBLAS_ERROR(
+            rocblas_gemm_pack_b(handle, transB, K, N, dB, type, ldb, type, &packed));
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_packed_ex_fn(handle,
+                                                        transA,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        nullptr,
+                                                        nullptr,
+                                                        lda,
+                                                        packed,
+                                                        nullptr,
+                                                        nullptr,
+                                                        ldc,
+                                                        nullptr,
+                                                        ldd),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+
+        CHECK_ROCBLAS_ERROR(rocblas_destroy_gemm_packed_b(packed));
+        return;
+    }
+
+    // the reference of a bf16 output is computed in float
+    using To_hpa = std::conditional_t<std::is_same<To, rocblas_bfloat16>{}, float, To>;
+
+    Tc h_alpha = arg.get_alpha<Tc>();
+    Tc h_beta  = arg.get_beta<Tc>();
+
+    // Naming: dX is in GPU (device) memory. hX is in CPU (host) memory
+    host_matrix<Ti>     hA(A_row, A_col, lda);
+    host_matrix<Ti>     hB(B_row, B_col, ldb);
+    host_matrix<To>     hC(M, N, ldc);
+    host_matrix<To>     hD(M, N, ldd);
+    host_matrix<To_hpa> hD_gold(M, N, ldd);
+
+    device_matrix<Ti> dA(A_row, A_col, lda);
+    device_matrix<Ti> dB(B_row, B_col, ldb);
+    device_matrix<To> dC(M, N, ldc);
+    device_matrix<To> dD(M, N, ldd);
+    device_vector<Tc> d_alpha(1);
+    device_vector<Tc> d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory; B alternates in sign, as in testing_gemm_ex, which keeps
+    // the sums of the small integers exact
+    rocblas_init_matrix(hA, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tc), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tc), hipMemcpyHostToDevice));
+
+    // B is packed once, and reused by every rocblas_gemm_packed_ex below
+    rocblas_gemm_packed_b packed = nullptr;
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_pack_b(handle, transB, K, N, dB, type, ldb, type, &packed));
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error          = 0.0;
+
+    auto check_result = [&]() {
+        CHECK_HIP_ERROR(hD.transfer_from(dD));
+        if(arg.unit_check)
+            unit_check_general<To, To_hpa>(M, N, ldd, hD_gold, hD);
+        if(arg.norm_check)
+        {
+            auto err
+                = std::abs(norm_check_general<To>('F', M, N, ldd, (To_hpa*)hD_gold, (To*)hD));
+            rocblas_error = err > rocblas_error ? err : rocblas_error;
+        }
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // CPU BLAS on the original B
+        copy_matrix_with_different_leading_dimensions(hC, hD_gold);
+
+        cpu_time_used = get_time_us_no_sync();
+
+        cblas_gemm<Ti, To_hpa, Tc>(
+            transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hD_gold, ldd);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // the packed B is reused with alpha and beta in host and device memory
+        for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+            bool host = pointer_mode == rocblas_pointer_mode_host;
+
+            CHECK_HIP_ERROR(hipMemset(dD, 0, sizeof(To) * size_t(ldd) * N));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_packed_ex_fn(handle,
+                                                          transA,
+                                                          M,
+                                                          N,
+                                                          K,
+                                                          host ? &h_alpha : d_alpha,
+                                                          dA,
+                                                          lda,
+                                                          packed,
+                                                          host ? &h_beta : d_beta,
+                                                          dC,
+                                                          ldc,
+                                                          dD,
+                                                          ldd));
+            handle.post_test(arg);
+
+            check_result();
+        }
+
+        // BF8 B widened once to rocblas_half, multiplied with a rocblas_half A. B is mapped
+        // into [1, 8], which is exact in BF8, and K <= 16 keeps the result exact.
+        if constexpr(std::is_same<Ti, rocblas_half>{} && std::is_same<To, rocblas_half>{}
+                     && std::is_same<Tc, float>{})
+        {
+            if(K <= 16)
+            {
+                host_matrix<uint8_t> hB8(B_row, B_col, ldb);
+                host_matrix<Ti>      hB_exact(B_row, B_col, ldb);
+                const Ti*            B       = hB;
+                uint8_t*             B8      = hB8;
+                Ti*                  B_exact = hB_exact;
+                for(rocblas_int j = 0; j < B_col; j++)
+                    for(rocblas_int i = 0; i < B_row; i++)
+                    {
+                        size_t idx   = i + size_t(j) * ldb;
+                        float  b     = float(std::abs(int(float(B[idx]))) % 8 + 1);
+                        B_exact[idx] = Ti(b);
+                        B8[idx]      = gemm_packed_bf8_encode(b);
+                    }
+
+                device_matrix<uint8_t> dB8(B_row, B_col, ldb);
+                CHECK_DEVICE_ALLOCATION(dB8.memcheck());
+                CHECK_HIP_ERROR(dB8.transfer_from(hB8));
+
+                rocblas_gemm_packed_b packed8 = nullptr;
+                CHECK_ROCBLAS_ERROR(rocblas_gemm_pack_b(
+                    handle, transB, K, N, dB8, rocblas_datatype_bf8_r, ldb, type, &packed8));
+
+                const Tc one(1), zero(0);
+                rocblas_init_zero((To_hpa*)hD_gold, M, N, ldd);
+                cblas_gemm<Ti, To_hpa, Tc>(
+                    transA, transB, M, N, K, one, hA, lda, hB_exact, ldb, zero, hD_gold, ldd);
+
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+                CHECK_ROCBLAS_ERROR(rocblas_gemm_packed_ex_fn(
+                    handle, transA, M, N, K, &one, dA, lda, packed8, &zero, dC, ldc, dD, ldd));
+                CHECK_ROCBLAS_ERROR(rocblas_destroy_gemm_packed_b(packed8));
+
+                check_result();
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        auto gemm_packed_ex = [&]() {
+            return rocblas_gemm_packed_ex_fn(
+                handle, transA, M, N, K, &h_alpha, dA, lda, packed, &h_beta, dC, ldc, dD, ldd);
+        };
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+            gemm_packed_ex();
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] { gemm_packed_ex(); });
+
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_beta,
+                      e_ldb,
+                      e_ldc,
+                      e_ldd>{}
+            .log_args<Tc>(rocblas_cout,
+                          arg,
+                          gpu_time_used,
+                          gemm_gflop_count<Tc>(M, N, K),
+                          gemm_gbyte_count<Ti, To>(M, N, K),
+                          cpu_time_used,
+                          rocblas_error);
+    }
+
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_gemm_packed_b(packed));
+}
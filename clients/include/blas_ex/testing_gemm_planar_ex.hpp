@@ -0,0 +1,519 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_planar_level1.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_gemm_planar_ex_bad_arg(const Arguments& arg)
+{
+    using Tr = real_t<T>;
+
+    const rocblas_int M = 100;
+    const rocblas_int N = 100;
+    const rocblas_int K = 100;
+
+    const rocblas_int lda = 100;
+    const rocblas_int ldb = 100;
+    const rocblas_int ldc = 100;
+
+    const rocblas_stride stride_a    = size_t(lda) * K;
+    const rocblas_stride stride_b    = size_t(ldb) * N;
+    const rocblas_stride stride_c    = size_t(ldc) * N;
+    const rocblas_int    batch_count = 2;
+
+    const rocblas_operation opN   = rocblas_operation_none;
+    const rocblas_operation opBad = rocblas_operation(rocblas_fill_full);
+
+    const rocblas_datatype type   = rocblas_type2datatype<T>();
+    const rocblas_datatype r_type = rocblas_type2datatype<Tr>();
+
+    rocblas_local_handle handle{arg};
+
+    // Allocate device memory
+    device_strided_batch_matrix<Tr> dA_r(M, K, lda, stride_a, batch_count);
+    device_strided_batch_matrix<Tr> dA_i(M, K, lda, stride_a, batch_count);
+    device_strided_batch_matrix<Tr> dB_r(K, N, ldb, stride_b, batch_count);
+    device_strided_batch_matrix<Tr> dB_i(K, N, ldb, stride_b, batch_count);
+    device_strided_batch_matrix<Tr> dC_r(M, N, ldc, stride_c, batch_count);
+    device_strided_batch_matrix<Tr> dC_i(M, N, ldc, stride_c, batch_count);
+    device_vector<T>                alpha_d(1), beta_d(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA_r.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB_r.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_r.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(alpha_d.memcheck());
+    CHECK_DEVICE_ALLOCATION(beta_d.memcheck());
+
+    const T alpha_h(1), beta_h(1);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const T* alpha = &alpha_h;
+        const T* beta  = &beta_h;
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(beta_d, beta, sizeof(*beta), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            beta  = beta_d;
+        }
+
+        // clang-format off
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(nullptr, opN, opN, M, N, K, alpha, dA_r, dA_i, type, lda, dB_r, dB_i, type, ldb, beta, dC_r, dC_i, type, ldc, type, 0), rocblas_status_invalid_handle);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opBad, opN, M, N, K, alpha, dA_r, dA_i, type, lda, dB_r, dB_i, type, ldb, beta, dC_r, dC_i, type, ldc, type, 0), rocblas_status_invalid_value);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opBad, M, N, K, alpha, dA_r, dA_i, type, lda, dB_r, dB_i, type, ldb, beta, dC_r, dC_i, type, ldc, type, 0), rocblas_status_invalid_value);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, -1, N, K, alpha, dA_r, dA_i, type, lda, dB_r, dB_i, type, ldb, beta, dC_r, dC_i, type, ldc, type, 0), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, M, -1, K, alpha, dA_r, dA_i, type, lda, dB_r, dB_i, type, ldb, beta, dC_r, dC_i, type, ldc, type, 0), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, M, N, -1, alpha, dA_r, dA_i, type, lda, dB_r, dB_i, type, ldb, beta, dC_r, dC_i, type, ldc, type, 0), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, M, N, K, alpha, dA_r, dA_i, type, M - 1, dB_r, dB_i, type, ldb, beta, dC_r, dC_i, type, ldc, type, 0), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, M, N, K, alpha, dA_r, dA_i, type, lda, dB_r, dB_i, type, K - 1, beta, dC_r, dC_i, type, ldc, type, 0), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, M, N, K, alpha, dA_r, dA_i, type, lda, dB_r, dB_i, type, ldb, beta, dC_r, dC_i, type, M - 1, type, 0), rocblas_status_invalid_size);
+
+// The planar arrays must be of the real type of the same complex type for all the matrices
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, M, N, K, alpha, dA_r, dA_i, r_type, lda, dB_r, dB_i, r_type, ldb, beta, dC_r, dC_i, r_type, ldc, r_type, 0), rocblas_status_not_implemented);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, M, N, K, alpha, dA_r, dA_i, r_type, lda, dB_r, dB_i, type, ldb, beta, dC_r, dC_i, type, ldc, type, 0), rocblas_status_not_implemented);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, M, N, K, nullptr, dA_r, dA_i, type, lda, dB_r, dB_i, type, ldb, beta, dC_r, dC_i, type, ldc, type, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, M, N, K, alpha, nullptr, dA_i, type, lda, dB_r, dB_i, type, ldb, beta, dC_r, dC_i, type, ldc, type, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, M, N, K, alpha, dA_r, nullptr, type, lda, dB_r, dB_i, type, ldb, beta, dC_r, dC_i, type, ldc, type, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, M, N, K, alpha, dA_r, dA_i, type, lda, nullptr, dB_i, type, ldb, beta, dC_r, dC_i, type, ldc, type, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, M, N, K, alpha, dA_r, dA_i, type, lda, dB_r, nullptr, type, ldb, beta, dC_r, dC_i, type, ldc, type, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, M, N, K, alpha, dA_r, dA_i, type, lda, dB_r, dB_i, type, ldb, nullptr, dC_r, dC_i, type, ldc, type, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, M, N, K, alpha, dA_r, dA_i, type, lda, dB_r, dB_i, type, ldb, beta, nullptr, dC_i, type, ldc, type, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, M, N, K, alpha, dA_r, dA_i, type, lda, dB_r, dB_i, type, ldb, beta, dC_r, nullptr, type, ldc, type, 0), rocblas_status_invalid_pointer);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_strided_batched_planar_ex(nullptr, opN, opN, M, N, K, alpha, dA_r, dA_i, type, lda, stride_a, dB_r, dB_i, type, ldb, stride_b, beta, dC_r, dC_i, type, ldc, stride_c, batch_count, type, 0), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_strided_batched_planar_ex(handle, opN, opN, M, N, K, alpha, dA_r, dA_i, type, lda, stride_a, dB_r, dB_i, type, ldb, stride_b, beta, dC_r, dC_i, type, ldc, stride_c, -1, type, 0), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_strided_batched_planar_ex(handle, opN, opN, M, N, K, alpha, dA_r, dA_i, r_type, lda, stride_a, dB_r, dB_i, r_type, ldb, stride_b, beta, dC_r, dC_i, r_type, ldc, stride_c, batch_count, r_type, 0), rocblas_status_not_implemented);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_strided_batched_planar_ex(handle, opN, opN, M, N, K, alpha, nullptr, dA_i, type, lda, stride_a, dB_r, dB_i, type, ldb, stride_b, beta, dC_r, dC_i, type, ldc, stride_c, batch_count, type, 0), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_strided_batched_planar_ex(handle, opN, opN, M, N, K, alpha, dA_r, dA_i, type, lda, stride_a, dB_r, dB_i, type, ldb, stride_b, beta, dC_r, nullptr, type, ldc, stride_c, batch_count, type, 0), rocblas_status_invalid_pointer);
+
+// If M, N or batch_count is 0, nothing is dereferenced
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, 0, N, K, nullptr, nullptr, nullptr, type, lda, nullptr, nullptr, type, ldb, nullptr, nullptr, nullptr, type, ldc, type, 0), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, M, 0, K, nullptr, nullptr, nullptr, type, lda, nullptr, nullptr, type, ldb, nullptr, nullptr, nullptr, type, ldc, type, 0), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_strided_batched_planar_ex(handle, opN, opN, M, N, K, nullptr, nullptr, nullptr, type, lda, stride_a, nullptr, nullptr, type, ldb, stride_b, nullptr, nullptr, nullptr, type, ldc, stride_c, 0, type, 0), rocblas_status_success);
+
+// If K is 0, A and B are not dereferenced, C is still scaled by beta
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_ex(handle, opN, opN, M, N, 0, alpha, nullptr, nullptr, type, lda, nullptr, nullptr, type, ldb, beta, dC_r, dC_i, type, ldc, type, 0), rocblas_status_success);
+        // clang-format on
+    }
+}
+
+// gemm_strided_batched_planar_ex must match cblas gemm on the interleaved copies of the planar
+// matrices for each batch, with alpha and beta on the host and on the device, and so must
+// gemm_planar_ex on each batch
+template <typename T>
+void testing_gemm_planar_ex(const Arguments& arg)
+{
+    using Tr = real_t<T>;
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+
+    rocblas_int batch_count = arg.batch_count;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    const rocblas_datatype type = rocblas_type2datatype<T>();
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : std::max(K, 1);
+    rocblas_int A_col = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : std::max(K, 1);
+
+    // check here to prevent undefined memory allocation error
+    // Note: K==0 is not an early exit, since C must still be multiplied by beta
+    bool invalid_size
+        = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_strided_batched_planar_ex(handle,
+                                                                     transA,
+                                                                     transB,
+                                                                     M,
+                                                                     N,
+                                                                     K,
+                                                                     nullptr,
+                                                                     nullptr,
+                                                                     nullptr,
+                                                                     type,
+                                                                     lda,
+                                                                     0,
+                                                                     nullptr,
+                                                                     nullptr,
+                                                                     type,
+                                                                     ldb,
+                                                                     0,
+                                                                     nullptr,
+                                                                     nullptr,
+                                                                     nullptr,
+                                                                     type,
+                                                                     ldc,
+                                                                     0,
+                                                                     batch_count,
+                                                                     type,
+                                                                     0),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    rocblas_stride stride_a = size_t(lda) * A_col;
+    rocblas_stride stride_b = size_t(ldb) * B_col;
+    rocblas_stride stride_c = size_t(ldc) * N;
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error          = 0.0;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory, interleaved and planar
+    host_strided_batch_matrix<T>  hA(A_row, A_col, lda, stride_a, batch_count);
+    host_strided_batch_matrix<T>  hB(B_row, B_col, ldb, stride_b, batch_count);
+    host_strided_batch_matrix<T>  hC(M, N, ldc, stride_c, batch_count);
+    host_strided_batch_matrix<Tr> hA_r(A_row, A_col, lda, stride_a, batch_count);
+    host_strided_batch_matrix<Tr> hA_i(A_row, A_col, lda, stride_a, batch_count);
+    host_strided_batch_matrix<Tr> hB_r(B_row, B_col, ldb, stride_b, batch_count);
+    host_strided_batch_matrix<Tr> hB_i(B_row, B_col, ldb, stride_b, batch_count);
+    host_strided_batch_matrix<Tr> hC_r(M, N, ldc, stride_c, batch_count);
+    host_strided_batch_matrix<Tr> hC_i(M, N, ldc, stride_c, batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hC.memcheck());
+    CHECK_HIP_ERROR(hA_r.memcheck());
+    CHECK_HIP_ERROR(hA_i.memcheck());
+    CHECK_HIP_ERROR(hB_r.memcheck());
+    CHECK_HIP_ERROR(hB_i.memcheck());
+    CHECK_HIP_ERROR(hC_r.memcheck());
+    CHECK_HIP_ERROR(hC_i.memcheck());
+
+    // Allocate device memory
+    device_strided_batch_matrix<Tr> dA_r(A_row, A_col, lda, stride_a, batch_count);
+    device_strided_batch_matrix<Tr> dA_i(A_row, A_col, lda, stride_a, batch_count);
+    device_strided_batch_matrix<Tr> dB_r(B_row, B_col, ldb, stride_b, batch_count);
+    device_strided_batch_matrix<Tr> dB_i(B_row, B_col, ldb, stride_b, batch_count);
+    device_strided_batch_matrix<Tr> dC_r(M, N, ldc, stride_c, batch_count);
+    device_strided_batch_matrix<Tr> dC_i(M, N, ldc, stride_c, batch_count);
+    device_vector<T>                d_alpha(1);
+    device_vector<T>                d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA_r.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB_r.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_r.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+    rocblas_planar_split(A_row, A_col, lda, batch_count, hA, hA_r, hA_i);
+    rocblas_planar_split(B_row, B_col, ldb, batch_count, hB, hB_r, hB_i);
+    rocblas_planar_split(M, N, ldc, batch_count, hC, hC_r, hC_i);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA_r.transfer_from(hA_r));
+    CHECK_HIP_ERROR(dA_i.transfer_from(hA_i));
+    CHECK_HIP_ERROR(dB_r.transfer_from(hB_r));
+    CHECK_HIP_ERROR(dB_i.transfer_from(hB_i));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    auto reset_c = [&]() {
+        CHECK_HIP_ERROR(dC_r.transfer_from(hC_r));
+        CHECK_HIP_ERROR(dC_i.transfer_from(hC_i));
+    };
+    auto fetch_c = [&](host_strided_batch_matrix<T>& hC_result) {
+        host_strided_batch_matrix<Tr> hres_r(M, N, ldc, stride_c, batch_count);
+        host_strided_batch_matrix<Tr> hres_i(M, N, ldc, stride_c, batch_count);
+        CHECK_HIP_ERROR(hres_r.transfer_from(dC_r));
+        CHECK_HIP_ERROR(hres_i.transfer_from(dC_i));
+        rocblas_planar_merge(M, N, ldc, batch_count, hres_r, hres_i, hC_result);
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        host_strided_batch_matrix<T> hC_1(M, N, ldc, stride_c, batch_count);
+        host_strided_batch_matrix<T> hC_2(M, N, ldc, stride_c, batch_count);
+        host_strided_batch_matrix<T> hC_3(M, N, ldc, stride_c, batch_count);
+        host_strided_batch_matrix<T> hC_gold(M, N, ldc, stride_c, batch_count);
+        CHECK_HIP_ERROR(hC_1.memcheck());
+        CHECK_HIP_ERROR(hC_2.memcheck());
+        CHECK_HIP_ERROR(hC_3.memcheck());
+        CHECK_HIP_ERROR(hC_gold.memcheck());
+
+        // ROCBLAS rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        reset_c();
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_strided_batched_planar_ex(handle,
+                                                                   transA,
+                                                                   transB,
+                                                                   M,
+                                                                   N,
+                                                                   K,
+                                                                   &h_alpha,
+                                                                   dA_r,
+                                                                   dA_i,
+                                                                   type,
+                                                                   lda,
+                                                                   stride_a,
+                                                                   dB_r,
+                                                                   dB_i,
+                                                                   type,
+                                                                   ldb,
+                                                                   stride_b,
+                                                                   &h_beta,
+                                                                   dC_r,
+                                                                   dC_i,
+                                                                   type,
+                                                                   ldc,
+                                                                   stride_c,
+                                                                   batch_count,
+                                                                   type,
+                                                                   0));
+        handle.post_test(arg);
+        fetch_c(hC_1);
+
+        // ROCBLAS rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        reset_c();
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_strided_batched_planar_ex(handle,
+                                                                   transA,
+                                                                   transB,
+                                                                   M,
+                                                                   N,
+                                                                   K,
+                                                                   d_alpha,
+                                                                   dA_r,
+                                                                   dA_i,
+                                                                   type,
+                                                                   lda,
+                                                                   stride_a,
+                                                                   dB_r,
+                                                                   dB_i,
+                                                                   type,
+                                                                   ldb,
+                                                                   stride_b,
+                                                                   d_beta,
+                                                                   dC_r,
+                                                                   dC_i,
+                                                                   type,
+                                                                   ldc,
+                                                                   stride_c,
+                                                                   batch_count,
+                                                                   type,
+                                                                   0));
+        handle.post_test(arg);
+        fetch_c(hC_2);
+
+        // The non batched function on each batch
+        reset_c();
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_planar_ex(handle,
+                                                       transA,
+                                                       transB,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       d_alpha,
+                                                       dA_r[b],
+                                                       dA_i[b],
+                                                       type,
+                                                       lda,
+                                                       dB_r[b],
+                                                       dB_i[b],
+                                                       type,
+                                                       ldb,
+                                                       d_beta,
+                                                       dC_r[b],
+                                                       dC_i[b],
+                                                       type,
+                                                       ldc,
+                                                       type,
+                                                       0));
+        }
+        fetch_c(hC_3);
+
+        // CPU BLAS
+        hC_gold.copy_from(hC);
+
+        cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            cblas_gemm<T>(
+                transA, transB, M, N, K, h_alpha, hA[b], lda, hB[b], ldb, h_beta, hC_gold[b], ldc);
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, ldc, stride_c, hC_gold, hC_1, batch_count);
+            unit_check_general<T>(M, N, ldc, stride_c, hC_gold, hC_2, batch_count);
+            unit_check_general<T>(M, N, ldc, stride_c, hC_gold, hC_3, batch_count);
+        }
+
+        if(arg.norm_check)
+        {
+            double error_hst_ptr = std::abs(
+                norm_check_general<T>('F', M, N, ldc, stride_c, hC_gold, hC_1, batch_count));
+            double error_dev_ptr = std::abs(
+                norm_check_general<T>('F', M, N, ldc, stride_c, hC_gold, hC_2, batch_count));
+            rocblas_error = error_hst_ptr > error_dev_ptr ? error_hst_ptr : error_dev_ptr;
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        reset_c();
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_strided_batched_planar_ex(handle,
+                                                                       transA,
+                                                                       transB,
+                                                                       M,
+                                                                       N,
+                                                                       K,
+                                                                       &h_alpha,
+                                                                       dA_r,
+                                                                       dA_i,
+                                                                       type,
+                                                                       lda,
+                                                                       stride_a,
+                                                                       dB_r,
+                                                                       dB_i,
+                                                                       type,
+                                                                       ldb,
+                                                                       stride_b,
+                                                                       &h_beta,
+                                                                       dC_r,
+                                                                       dC_i,
+                                                                       type,
+                                                                       ldc,
+                                                                       stride_c,
+                                                                       batch_count,
+                                                                       type,
+                                                                       0));
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_gemm_strided_batched_planar_ex(handle,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   &h_alpha,
+                                                   dA_r,
+                                                   dA_i,
+                                                   type,
+                                                   lda,
+                                                   stride_a,
+                                                   dB_r,
+                                                   dB_i,
+                                                   type,
+                                                   ldb,
+                                                   stride_b,
+                                                   &h_beta,
+                                                   dC_r,
+                                                   dC_i,
+                                                   type,
+                                                   ldc,
+                                                   stride_c,
+                                                   batch_count,
+                                                   type,
+                                                   0);
+        });
+
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_beta,
+                      e_ldb,
+                      e_ldc,
+                      e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemm_gflop_count<T>(M, N, K),
+                         gemm_gbyte_count<T>(M, N, K),
+                         cpu_time_used,
+                         rocblas_error);
+    }
+}
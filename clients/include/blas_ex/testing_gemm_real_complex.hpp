@@ -0,0 +1,526 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// gemm_ex of a real A of T by a complex B, C and D of the complex type of the same precision
+template <typename T>
+void testing_gemm_real_complex_bad_arg(const Arguments& arg)
+{
+    using Tc = rocblas_complex_num<T>;
+
+    const rocblas_int M = 100;
+    const rocblas_int N = 100;
+    const rocblas_int K = 100;
+
+    const rocblas_int lda = 100;
+    const rocblas_int ldb = 100;
+    const rocblas_int ldc = 100;
+    const rocblas_int ldd = 100;
+
+    const rocblas_stride stride_a    = size_t(lda) * K;
+    const rocblas_stride stride_b    = size_t(ldb) * N;
+    const rocblas_stride stride_c    = size_t(ldc) * N;
+    const rocblas_stride stride_d    = size_t(ldd) * N;
+    const rocblas_int    batch_count = 2;
+
+    const rocblas_operation opN = rocblas_operation_none;
+
+    const rocblas_datatype r_type = rocblas_type2datatype<T>();
+    const rocblas_datatype c_type = rocblas_type2datatype<Tc>();
+
+    // A complex B of the other precision
+    const rocblas_datatype other_type = std::is_same<T, float>{} ? rocblas_datatype_f64_c
+                                                                 : rocblas_datatype_f32_c;
+
+    const rocblas_gemm_algo algo           = rocblas_gemm_algo_standard;
+    const int32_t           solution_index = 0;
+    const uint32_t          flags          = 0;
+
+    rocblas_local_handle handle{arg};
+
+    // Allocate device memory
+    device_strided_batch_matrix<T>  dA(M, K, lda, stride_a, batch_count);
+    device_strided_batch_matrix<Tc> dB(K, N, ldb, stride_b, batch_count);
+    device_strided_batch_matrix<Tc> dC(M, N, ldc, stride_c, batch_count);
+    device_strided_batch_matrix<Tc> dD(M, N, ldd, stride_d, batch_count);
+    device_vector<Tc>               alpha_d(1), beta_d(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(alpha_d.memcheck());
+    CHECK_DEVICE_ALLOCATION(beta_d.memcheck());
+
+    const Tc alpha_h(1), beta_h(1);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const Tc* alpha = &alpha_h;
+        const Tc* beta  = &beta_h;
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(beta_d, beta, sizeof(*beta), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            beta  = beta_d;
+        }
+
+        // clang-format off
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex(nullptr, opN, opN, M, N, K, alpha, dA, r_type, lda, dB, c_type, ldb, beta, dC, c_type, ldc, dD, c_type, ldd, c_type, algo, solution_index, flags), rocblas_status_invalid_handle);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex(handle, opN, opN, M, N, K, alpha, dA, r_type, M - 1, dB, c_type, ldb, beta, dC, c_type, ldc, dD, c_type, ldd, c_type, algo, solution_index, flags), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex(handle, opN, opN, M, N, K, alpha, dA, r_type, lda, dB, c_type, K - 1, beta, dC, c_type, ldc, dD, c_type, ldd, c_type, algo, solution_index, flags), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex(handle, opN, opN, M, N, K, alpha, dA, r_type, lda, dB, c_type, ldb, beta, dC, c_type, ldc, dD, c_type, M - 1, c_type, algo, solution_index, flags), rocblas_status_invalid_size);
+
+// B, C, D and the computation must all be of the complex type of the precision of A
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex(handle, opN, opN, M, N, K, alpha, dA, r_type, lda, dB, other_type, ldb, beta, dC, c_type, ldc, dD, c_type, ldd, c_type, algo, solution_index, flags), rocblas_status_not_implemented);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex(handle, opN, opN, M, N, K, alpha, dA, r_type, lda, dB, r_type, ldb, beta, dC, c_type, ldc, dD, c_type, ldd, c_type, algo, solution_index, flags), rocblas_status_not_implemented);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex(handle, opN, opN, M, N, K, alpha, dA, r_type, lda, dB, c_type, ldb, beta, dC, c_type, ldc, dD, r_type, ldd, c_type, algo, solution_index, flags), rocblas_status_not_implemented);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex(handle, opN, opN, M, N, K, nullptr, dA, r_type, lda, dB, c_type, ldb, beta, dC, c_type, ldc, dD, c_type, ldd, c_type, algo, solution_index, flags), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex(handle, opN, opN, M, N, K, alpha, nullptr, r_type, lda, dB, c_type, ldb, beta, dC, c_type, ldc, dD, c_type, ldd, c_type, algo, solution_index, flags), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex(handle, opN, opN, M, N, K, alpha, dA, r_type, lda, nullptr, c_type, ldb, beta, dC, c_type, ldc, dD, c_type, ldd, c_type, algo, solution_index, flags), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex(handle, opN, opN, M, N, K, alpha, dA, r_type, lda, dB, c_type, ldb, nullptr, dC, c_type, ldc, dD, c_type, ldd, c_type, algo, solution_index, flags), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex(handle, opN, opN, M, N, K, alpha, dA, r_type, lda, dB, c_type, ldb, beta, nullptr, c_type, ldc, dD, c_type, ldd, c_type, algo, solution_index, flags), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex(handle, opN, opN, M, N, K, alpha, dA, r_type, lda, dB, c_type, ldb, beta, dC, c_type, ldc, nullptr, c_type, ldd, c_type, algo, solution_index, flags), rocblas_status_invalid_pointer);
+
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_strided_batched_ex(nullptr, opN, opN, M, N, K, alpha, dA, r_type, lda, stride_a, dB, c_type, ldb, stride_b, beta, dC, c_type, ldc, stride_c, dD, c_type, ldd, stride_d, batch_count, c_type, algo, solution_index, flags), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_strided_batched_ex(handle, opN, opN, M, N, K, alpha, dA, r_type, lda, stride_a, dB, c_type, ldb, stride_b, beta, dC, c_type, ldc, stride_c, dD, c_type, ldd, stride_d, -1, c_type, algo, solution_index, flags), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_strided_batched_ex(handle, opN, opN, M, N, K, alpha, dA, r_type, lda, stride_a, dB, other_type, ldb, stride_b, beta, dC, c_type, ldc, stride_c, dD, c_type, ldd, stride_d, batch_count, c_type, algo, solution_index, flags), rocblas_status_not_implemented);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_strided_batched_ex(handle, opN, opN, M, N, K, alpha, dA, r_type, lda, stride_a, nullptr, c_type, ldb, stride_b, beta, dC, c_type, ldc, stride_c, dD, c_type, ldd, stride_d, batch_count, c_type, algo, solution_index, flags), rocblas_status_invalid_pointer);
+
+// If M, N or batch_count is 0, nothing is dereferenced
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex(handle, opN, opN, 0, N, K, nullptr, nullptr, r_type, lda, nullptr, c_type, ldb, nullptr, nullptr, c_type, ldc, nullptr, c_type, ldd, c_type, algo, solution_index, flags), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex(handle, opN, opN, M, 0, K, nullptr, nullptr, r_type, lda, nullptr, c_type, ldb, nullptr, nullptr, c_type, ldc, nullptr, c_type, ldd, c_type, algo, solution_index, flags), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_gemm_strided_batched_ex(handle, opN, opN, M, N, K, nullptr, nullptr, r_type, lda, stride_a, nullptr, c_type, ldb, stride_b, nullptr, nullptr, c_type, ldc, stride_c, nullptr, c_type, ldd, stride_d, 0, c_type, algo, solution_index, flags), rocblas_status_success);
+        // clang-format on
+    }
+}
+
+// gemm_ex and gemm_strided_batched_ex of a real A by a complex B, C and D must match cblas gemm of
+// A promoted to complex, for each batch, with alpha and beta on the host and on the device, for D
+// distinct from C and in place. The real and imaginary planes of B and of the product are
+// workspace.
+template <typename T>
+void testing_gemm_real_complex(const Arguments& arg)
+{
+    using Tc = rocblas_complex_num<T>;
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    Tc h_alpha = arg.get_alpha<Tc>();
+    Tc h_beta  = arg.get_beta<Tc>();
+
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+    rocblas_int ldd = arg.ldd;
+
+    rocblas_int batch_count = arg.batch_count;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    const rocblas_datatype r_type = rocblas_type2datatype<T>();
+    const rocblas_datatype c_type = rocblas_type2datatype<Tc>();
+
+    const rocblas_gemm_algo algo           = rocblas_gemm_algo(arg.algo);
+    const int32_t           solution_index = arg.solution_index;
+    const uint32_t          flags          = arg.flags;
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : std::max(K, 1);
+    rocblas_int A_col = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : std::max(K, 1);
+
+    // check here to prevent undefined memory allocation error
+    // Note: K==0 is not an early exit, since C must still be multiplied by beta
+    bool invalid_size = M < 0 || N < 0 || K < 0 || ldc < M || ldd < M || batch_count < 0
+                        || lda < (transA == rocblas_operation_none ? M : K)
+                        || ldb < (transB == rocblas_operation_none ? K : N);
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_strided_batched_ex(handle,
+                                                              transA,
+                                                              transB,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              nullptr,
+                                                              nullptr,
+                                                              r_type,
+                                                              lda,
+                                                              0,
+                                                              nullptr,
+                                                              c_type,
+                                                              ldb,
+                                                              0,
+                                                              nullptr,
+                                                              nullptr,
+                                                              c_type,
+                                                              ldc,
+                                                              0,
+                                                              nullptr,
+                                                              c_type,
+                                                              ldd,
+                                                              0,
+                                                              batch_count,
+                                                              c_type,
+                                                              algo,
+                                                              solution_index,
+                                                              flags),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    rocblas_stride stride_a = size_t(lda) * A_col;
+    rocblas_stride stride_b = size_t(ldb) * B_col;
+    rocblas_stride stride_c = size_t(ldc) * N;
+    rocblas_stride stride_d = size_t(ldd) * N;
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error          = 0.0;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_strided_batch_matrix<T>  hA(A_row, A_col, lda, stride_a, batch_count);
+    host_strided_batch_matrix<Tc> hB(B_row, B_col, ldb, stride_b, batch_count);
+    host_strided_batch_matrix<Tc> hC(M, N, ldc, stride_c, batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hC.memcheck());
+
+    // Allocate device memory
+    device_strided_batch_matrix<T>  dA(A_row, A_col, lda, stride_a, batch_count);
+    device_strided_batch_matrix<Tc> dB(B_row, B_col, ldb, stride_b, batch_count);
+    device_strided_batch_matrix<Tc> dC(M, N, ldc, stride_c, batch_count);
+    device_strided_batch_matrix<Tc> dD(M, N, ldd, stride_d, batch_count);
+    device_vector<Tc>               d_alpha(1);
+    device_vector<Tc>               d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tc), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tc), hipMemcpyHostToDevice));
+
+    // The planes of B and of the product
+    size_t workspace_size = 0;
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_workspace_size(handle,
+                                                       transA,
+                                                       transB,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       r_type,
+                                                       lda,
+                                                       c_type,
+                                                       ldb,
+                                                       c_type,
+                                                       ldc,
+                                                       c_type,
+                                                       ldd,
+                                                       c_type,
+                                                       algo,
+                                                       solution_index,
+                                                       flags,
+                                                       &workspace_size));
+    if(K)
+        EXPECT_GE(workspace_size, sizeof(T) * 2 * (size_t(K) * N + size_t(M) * N));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        host_strided_batch_matrix<Tc> hA_c(A_row, A_col, lda, stride_a, batch_count);
+        host_strided_batch_matrix<Tc> hC_3(M, N, ldc, stride_c, batch_count);
+        host_strided_batch_matrix<Tc> hD_1(M, N, ldd, stride_d, batch_count);
+        host_strided_batch_matrix<Tc> hD_2(M, N, ldd, stride_d, batch_count);
+        host_strided_batch_matrix<Tc> hC_gold(M, N, ldc, stride_c, batch_count);
+        host_strided_batch_matrix<Tc> hD_gold(M, N, ldd, stride_d, batch_count);
+        CHECK_HIP_ERROR(hA_c.memcheck());
+        CHECK_HIP_ERROR(hC_3.memcheck());
+        CHECK_HIP_ERROR(hD_1.memcheck());
+        CHECK_HIP_ERROR(hD_2.memcheck());
+        CHECK_HIP_ERROR(hC_gold.memcheck());
+        CHECK_HIP_ERROR(hD_gold.memcheck());
+
+        // ROCBLAS rocblas_pointer_mode_host, D distinct from C
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_strided_batched_ex(handle,
+                                                            transA,
+                                                            transB,
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            &h_alpha,
+                                                            dA,
+                                                            r_type,
+                                                            lda,
+                                                            stride_a,
+                                                            dB,
+                                                            c_type,
+                                                            ldb,
+                                                            stride_b,
+                                                            &h_beta,
+                                                            dC,
+                                                            c_type,
+                                                            ldc,
+                                                            stride_c,
+                                                            dD,
+                                                            c_type,
+                                                            ldd,
+                                                            stride_d,
+                                                            batch_count,
+                                                            c_type,
+                                                            algo,
+                                                            solution_index,
+                                                            flags));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hD_1.transfer_from(dD));
+
+        // ROCBLAS rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_strided_batched_ex(handle,
+                                                            transA,
+                                                            transB,
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            d_alpha,
+                                                            dA,
+                                                            r_type,
+                                                            lda,
+                                                            stride_a,
+                                                            dB,
+                                                            c_type,
+                                                            ldb,
+                                                            stride_b,
+                                                            d_beta,
+                                                            dC,
+                                                            c_type,
+                                                            ldc,
+                                                            stride_c,
+                                                            dD,
+                                                            c_type,
+                                                            ldd,
+                                                            stride_d,
+                                                            batch_count,
+                                                            c_type,
+                                                            algo,
+                                                            solution_index,
+                                                            flags));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hD_2.transfer_from(dD));
+
+        // gemm_ex on each batch in place, D being C
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_ex(handle,
+                                                transA,
+                                                transB,
+                                                M,
+                                                N,
+                                                K,
+                                                d_alpha,
+                                                dA[b],
+                                                r_type,
+                                                lda,
+                                                dB[b],
+                                                c_type,
+                                                ldb,
+                                                d_beta,
+                                                dC[b],
+                                                c_type,
+                                                ldc,
+                                                dC[b],
+                                                c_type,
+                                                ldc,
+                                                c_type,
+                                                algo,
+                                                solution_index,
+                                                flags));
+        }
+        CHECK_HIP_ERROR(hC_3.transfer_from(dC));
+
+        // CPU BLAS, of A promoted to complex
+        for(rocblas_int b = 0; b < batch_count; b++)
+            for(rocblas_int j = 0; j < A_col; j++)
+                for(rocblas_int i = 0; i < A_row; i++)
+                    hA_c[b][i + j * size_t(lda)] = Tc(hA[b][i + j * size_t(lda)]);
+        hC_gold.copy_from(hC);
+
+        cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            cblas_gemm<Tc>(transA,
+                           transB,
+                           M,
+                           N,
+                           K,
+                           h_alpha,
+                           hA_c[b],
+                           lda,
+                           hB[b],
+                           ldb,
+                           h_beta,
+                           hC_gold[b],
+                           ldc);
+            for(rocblas_int j = 0; j < N; j++)
+                for(rocblas_int i = 0; i < M; i++)
+                    hD_gold[b][i + j * size_t(ldd)] = hC_gold[b][i + j * size_t(ldc)];
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<Tc>(M, N, ldd, stride_d, hD_gold, hD_1, batch_count);
+            unit_check_general<Tc>(M, N, ldd, stride_d, hD_gold, hD_2, batch_count);
+            unit_check_general<Tc>(M, N, ldc, stride_c, hC_gold, hC_3, batch_count);
+        }
+
+        if(arg.norm_check)
+        {
+            double error_hst_ptr = std::abs(
+                norm_check_general<Tc>('F', M, N, ldd, stride_d, hD_gold, hD_1, batch_count));
+            double error_dev_ptr = std::abs(
+                norm_check_general<Tc>('F', M, N, ldd, stride_d, hD_gold, hD_2, batch_count));
+            rocblas_error = error_hst_ptr > error_dev_ptr ? error_hst_ptr : error_dev_ptr;
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+        auto gemm_real_complex = [&]() {
+            return rocblas_gemm_strided_batched_ex(handle,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   &h_alpha,
+                                                   dA,
+                                                   r_type,
+                                                   lda,
+                                                   stride_a,
+                                                   dB,
+                                                   c_type,
+                                                   ldb,
+                                                   stride_b,
+                                                   &h_beta,
+                                                   dC,
+                                                   c_type,
+                                                   ldc,
+                                                   stride_c,
+                                                   dD,
+                                                   c_type,
+                                                   ldd,
+                                                   stride_d,
+                                                   batch_count,
+                                                   c_type,
+                                                   algo,
+                                                   solution_index,
+                                                   flags);
+        };
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(gemm_real_complex());
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, gemm_real_complex);
+
+        // Two real gemms of A, on the real and imaginary parts of B
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_beta,
+                      e_ldb,
+                      e_ldc,
+                      e_ldd,
+                      e_batch_count>{}
+            .log_args<Tc>(rocblas_cout,
+                          arg,
+                          gpu_time_used,
+                          2 * gemm_gflop_count<T>(M, N, K),
+                          gemm_real_complex_gbyte_count<T>(M, N, K),
+                          cpu_time_used,
+                          rocblas_error);
+    }
+}
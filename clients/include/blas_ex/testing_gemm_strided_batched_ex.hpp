@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
 #include "near.hpp"
@@ -464,12 +465,56 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
 
     bool alt = (rocblas_gemm_flags_fp16_alt_impl & flags);
 
-    // Initialize data on host memory
-    rocblas_init_matrix<Ti>(
-        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
-    rocblas_init_matrix<Ti>(
-        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
-    rocblas_init_matrix<To>(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+    if(rocblas_client_device_init<Ti>(arg) && rocblas_client_device_init<To>(arg))
+    {
+        // Initialize data on device memory, the results are not verified
+        CHECK_HIP_ERROR(rocblas_init_matrix_device(dA, arg, true, false));
+        CHECK_HIP_ERROR(rocblas_init_matrix_device(dB, arg, false, true));
+        CHECK_HIP_ERROR(rocblas_init_matrix_device(dC, arg, false, false));
+    }
+    else
+    {
+        // Initialize data on host memory
+        rocblas_init_matrix<Ti>(
+            hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+        rocblas_init_matrix<Ti>(
+            hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+        rocblas_init_matrix<To>(
+            hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+        // copy data from CPU to device
+        if(std::is_same<Ti, int8_t>{} && transA == rocblas_operation_none && pack_to_int8x4)
+        {
+            host_strided_batch_matrix<Ti> hA_packed(A_row, A_col, lda, stride_a, batch_count);
+            hA_packed.copy_from(hA);
+
+            for(int b = 0; b < batch_count; b++)
+                rocblas_packInt8(hA_packed[b], hA[b], M, K, lda);
+
+            CHECK_HIP_ERROR(dA.transfer_from(hA_packed));
+        }
+        else
+        {
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+        }
+
+        // if int8 and B transposed and valid case, pack B
+        if(std::is_same<Ti, int8_t>{} && transB != rocblas_operation_none && pack_to_int8x4)
+        {
+            host_strided_batch_matrix<Ti> hB_packed(B_row, B_col, ldb, stride_b, batch_count);
+            hB_packed.copy_from(hB);
+            for(int b = 0; b < batch_count; b++)
+                rocblas_packInt8(hB_packed[b], hB[b], N, K, ldb);
+
+            CHECK_HIP_ERROR(dB.transfer_from(hB_packed));
+        }
+        else
+        {
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+        }
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+    }
 
     rocblas_init_nan<To>(hD_1, M, N, ldd, stride_d, batch_count);
     rocblas_init_nan<To_hpa>(hD_gold, M, N, ldd, stride_d, batch_count);
@@ -509,39 +554,6 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
     }
 #endif
 
-    // copy data from CPU to device
-    if(std::is_same<Ti, int8_t>{} && transA == rocblas_operation_none && pack_to_int8x4)
-    {
-        host_strided_batch_matrix<Ti> hA_packed(A_row, A_col, lda, stride_a, batch_count);
-        hA_packed.copy_from(hA);
-
-        for(int b = 0; b < batch_count; b++)
-            rocblas_packInt8(hA_packed[b], hA[b], M, K, lda);
-
-        CHECK_HIP_ERROR(dA.transfer_from(hA_packed));
-    }
-    else
-    {
-        CHECK_HIP_ERROR(dA.transfer_from(hA));
-    }
-
-    // if int8 and B transposed and valid case, pack B
-    if(std::is_same<Ti, int8_t>{} && transB != rocblas_operation_none && pack_to_int8x4)
-    {
-        host_strided_batch_matrix<Ti> hB_packed(B_row, B_col, ldb, stride_b, batch_count);
-        hB_packed.copy_from(hB);
-        for(int b = 0; b < batch_count; b++)
-            rocblas_packInt8(hB_packed[b], hB[b], N, K, ldb);
-
-        CHECK_HIP_ERROR(dB.transfer_from(hB_packed));
-    }
-    else
-    {
-        CHECK_HIP_ERROR(dB.transfer_from(hB));
-    }
-
-    CHECK_HIP_ERROR(dC.transfer_from(hC));
-
     if(arg.unit_check || arg.norm_check)
     {
         // ROCBLAS rocblas_pointer_mode_host
@@ -622,6 +634,7 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
         cpu_time_used = get_time_us_no_sync();
 
         // CPU BLAS
+#pragma omp parallel for
         for(rocblas_int b = 0; b < batch_count; b++)
         {
             cblas_gemm<Ti, To_hpa>(transA,
@@ -774,7 +787,7 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
                           arg,
                           gpu_time_used,
                           gemm_gflop_count<Tc>(M, N, K),
-                          ArgumentLogging::NA_value,
+                          gemm_gbyte_count<Ti, To>(M, N, K),
                           cpu_time_used,
                           rocblas_error);
     }
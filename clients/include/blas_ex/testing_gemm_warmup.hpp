@@ -0,0 +1,303 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+/* ============================================================================================ */
+template <typename Ti, typename To, typename Tc>
+void testing_gemm_warmup_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    const rocblas_gemm_warmup_problem problem = {rocblas_operation_none,
+                                                 rocblas_operation_none,
+                                                 100,
+                                                 100,
+                                                 100,
+                                                 1,
+                                                 rocblas_type2datatype<Ti>(),
+                                                 rocblas_type2datatype<To>(),
+                                                 rocblas_type2datatype<Tc>()};
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_warmup(nullptr, 1, &problem),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_warmup(handle, -1, &problem), rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_warmup(handle, 1, nullptr), rocblas_status_invalid_pointer);
+
+    rocblas_gemm_warmup_problem invalid = problem;
+    invalid.k                           = -1;
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_warmup(handle, 1, &invalid), rocblas_status_invalid_size);
+    invalid             = problem;
+    invalid.batch_count = -1;
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_warmup(handle, 1, &invalid), rocblas_status_invalid_size);
+    invalid         = problem;
+    invalid.trans_a = rocblas_operation(0);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_warmup(handle, 1, &invalid), rocblas_status_invalid_value);
+    invalid         = problem;
+    invalid.trans_b = rocblas_operation(0);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_warmup(handle, 1, &invalid), rocblas_status_invalid_value);
+
+    // If count == 0, then problems can be nullptr without error
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_warmup(handle, 0, nullptr));
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_warmup_wait());
+
+    // Types which rocblas_gemm_ex does not support are reported by the wait
+    rocblas_gemm_warmup_problem unsupported = problem;
+    unsupported.c_type                      = rocblas_datatype_f64_c;
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_warmup(handle, 1, &unsupported));
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_warmup_wait(), rocblas_status_not_implemented);
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_warmup_wait());
+}
+
+// GEMM calls of a problem must be correct while its code objects are preloaded, and after
+template <typename Ti, typename To, typename Tc>
+void testing_gemm_warmup(const Arguments& arg)
+{
+    Tc h_alpha = arg.get_alpha<Tc>();
+    Tc h_beta  = arg.get_beta<Tc>();
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error          = 0.0;
+
+    rocblas_local_handle handle{arg};
+    auto                 transA = char2rocblas_operation(arg.transA);
+    auto                 transB = char2rocblas_operation(arg.transB);
+    auto                 M = arg.M, N = arg.N, K = arg.K;
+    auto                 lda = arg.lda, ldb = arg.ldb, ldc = arg.ldc, ldd = arg.ldd;
+    auto                 A_row       = transA == rocblas_operation_none ? M : std::max(K, 1);
+    auto                 A_col       = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    auto                 B_row       = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    auto                 B_col       = transB == rocblas_operation_none ? N : std::max(K, 1);
+    auto                 batch_count = arg.batch_count;
+
+    const rocblas_gemm_warmup_problem problem = {transA,
+                                                 transB,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 batch_count,
+                                                 arg.a_type,
+                                                 arg.c_type,
+                                                 arg.compute_type};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count || lda < A_row || ldb < B_row || ldc < M
+       || ldd < M)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_warmup(handle, 1, &problem),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_warmup_wait());
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    using To_hpa = std::conditional_t<std::is_same<To, rocblas_bfloat16>{}, float, To>;
+    host_matrix<Ti>     hA(A_row, A_col, lda);
+    host_matrix<Ti>     hB(B_row, B_col, ldb);
+    host_matrix<To>     hC(M, N, ldc);
+    host_matrix<To>     hD_1(M, N, ldd);
+    host_matrix<To>     hD_2(M, N, ldd);
+    host_matrix<To_hpa> hD_gold(M, N, ldd);
+
+    // Allocate device memory
+    device_matrix<Ti> dA(A_row, A_col, lda);
+    device_matrix<Ti> dB(B_row, B_col, ldb);
+    device_matrix<To> dC(M, N, ldc);
+    device_matrix<To> dD(M, N, ldd);
+    device_vector<Tc> d_alpha(1);
+    device_vector<Tc> d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix<Ti>(
+        hA, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix<Ti>(
+        hB, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix<To>(hC, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tc), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tc), hipMemcpyHostToDevice));
+
+    auto rocblas_gemm_ex_fn = [&](const Tc* alpha, const Tc* beta) {
+        return rocblas_gemm_ex(handle,
+                               transA,
+                               transB,
+                               M,
+                               N,
+                               K,
+                               alpha,
+                               dA,
+                               arg.a_type,
+                               lda,
+                               dB,
+                               arg.b_type,
+                               ldb,
+                               beta,
+                               dC,
+                               arg.c_type,
+                               ldc,
+                               dD,
+                               arg.d_type,
+                               ldd,
+                               arg.compute_type,
+                               rocblas_gemm_algo_standard,
+                               0,
+                               rocblas_gemm_flags_none);
+    };
+
+    auto check_result = [&](host_matrix<To>& hD) {
+        if(arg.unit_check)
+        {
+            if((rocblas_handle(handle)->getArchMajor() == 11) && (sizeof(Ti) == 2))
+            {
+                const double tol = K * sum_error_tolerance_for_gfx11<Tc, Ti, To>;
+                near_check_general<To, To_hpa>(M, N, ldd, hD_gold, hD, tol);
+            }
+            else if(std::is_same<Tc, rocblas_half>{} && K > 10000)
+            {
+                // For large K, rocblas_half tends to diverge proportional to K
+                const double tol = K * sum_error_tolerance<Tc>;
+                near_check_general<To, To_hpa>(M, N, ldd, hD_gold, hD, tol);
+            }
+            else
+            {
+                unit_check_general<To, To_hpa>(M, N, ldd, hD_gold, hD);
+            }
+        }
+
+        if(arg.norm_check)
+        {
+            auto error
+                = std::abs(norm_check_general<To>('F', M, N, ldd, (To_hpa*)hD_gold, (To*)hD));
+            rocblas_error = error > rocblas_error ? error : rocblas_error;
+        }
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // ROCBLAS rocblas_pointer_mode_host, while the warm-up is running
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_warmup(handle, 1, &problem));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_fn(&h_alpha, &h_beta));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hD_1.transfer_from(dD));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_warmup_wait());
+
+        // ROCBLAS rocblas_pointer_mode_device, after a warm-up of a preloaded problem which
+        // does nothing
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_warmup(handle, 1, &problem));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_warmup_wait());
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_fn(d_alpha, d_beta));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hD_2.transfer_from(dD));
+
+        // copy C matrix into D matrix
+        copy_matrix_with_different_leading_dimensions(hC, hD_gold);
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        cblas_gemm<Ti, To_hpa, Tc>(
+            transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hD_gold, ldd);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        check_result(hD_1);
+        check_result(hD_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        // Time the GEMM calls of the preloaded problem
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_warmup(handle, 1, &problem));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_warmup_wait());
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_gemm_ex_fn(&h_alpha, &h_beta);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(
+            stream, number_hot_calls, [&] { rocblas_gemm_ex_fn(&h_alpha, &h_beta); });
+
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_beta,
+                      e_ldb,
+                      e_ldc,
+                      e_ldd,
+                      e_batch_count>{}
+            .log_args<Tc>(rocblas_cout,
+                          arg,
+                          gpu_time_used,
+                          gemm_gflop_count<Tc>(M, N, K),
+                          gemm_gbyte_count<Ti, To>(M, N, K),
+                          cpu_time_used,
+                          rocblas_error);
+    }
+}
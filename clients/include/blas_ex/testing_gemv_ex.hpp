@@ -0,0 +1,565 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename Ti, typename To = Ti, typename Tc = To>
+void testing_gemv_ex_bad_arg(const Arguments& arg)
+{
+    rocblas_datatype a_type       = rocblas_type2datatype<Ti>();
+    rocblas_datatype y_type       = rocblas_type2datatype<To>();
+    rocblas_datatype compute_type = rocblas_type2datatype<Tc>();
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const rocblas_operation transA = rocblas_operation_none;
+        const rocblas_int       M      = 100;
+        const rocblas_int       N      = 100;
+        const rocblas_int       lda    = 100;
+        const rocblas_int       incx   = 1;
+        const rocblas_int       incy   = 1;
+
+        device_vector<Tc> alpha_d(1), beta_d(1), zero_d(1), one_d(1);
+        const Tc          alpha_h(1), beta_h(1), zero_h(0), one_h(1);
+
+        const Tc* alpha = &alpha_h;
+        const Tc* beta  = &beta_h;
+        const Tc* zero  = &zero_h;
+        const Tc* one   = &one_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(beta_d, beta, sizeof(*beta), hipMemcpyHostToDevice));
+            beta = beta_d;
+            CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+            zero = zero_d;
+            CHECK_HIP_ERROR(hipMemcpy(one_d, one, sizeof(*one), hipMemcpyHostToDevice));
+            one = one_d;
+        }
+
+        // Allocate device memory
+        device_matrix<Ti> dA(M, N, lda);
+        device_vector<Ti> dx(N, incx);
+        device_vector<To> dy(M, incy);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(nullptr,
+                                              transA,
+                                              M,
+                                              N,
+                                              alpha,
+                                              dA,
+                                              a_type,
+                                              lda,
+                                              dx,
+                                              a_type,
+                                              incx,
+                                              beta,
+                                              dy,
+                                              y_type,
+                                              incy,
+                                              compute_type),
+                              rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                              (rocblas_operation)rocblas_fill_full,
+                                              M,
+                                              N,
+                                              alpha,
+                                              dA,
+                                              a_type,
+                                              lda,
+                                              dx,
+                                              a_type,
+                                              incx,
+                                              beta,
+                                              dy,
+                                              y_type,
+                                              incy,
+                                              compute_type),
+                              rocblas_status_invalid_value);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                              transA,
+                                              M,
+                                              N,
+                                              alpha,
+                                              dA,
+                                              a_type,
+                                              M - 1,
+                                              dx,
+                                              a_type,
+                                              incx,
+                                              beta,
+                                              dy,
+                                              y_type,
+                                              incy,
+                                              compute_type),
+                              rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                              transA,
+                                              M,
+                                              N,
+                                              nullptr,
+                                              dA,
+                                              a_type,
+                                              lda,
+                                              dx,
+                                              a_type,
+                                              incx,
+                                              beta,
+                                              dy,
+                                              y_type,
+                                              incy,
+                                              compute_type),
+                              rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                              transA,
+                                              M,
+                                              N,
+                                              alpha,
+                                              dA,
+                                              a_type,
+                                              lda,
+                                              dx,
+                                              a_type,
+                                              incx,
+                                              nullptr,
+                                              dy,
+                                              y_type,
+                                              incy,
+                                              compute_type),
+                              rocblas_status_invalid_pointer);
+
+        // x must have the type of A
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                              transA,
+                                              M,
+                                              N,
+                                              alpha,
+                                              dA,
+                                              a_type,
+                                              lda,
+                                              dx,
+                                              rocblas_datatype_i8_r,
+                                              incx,
+                                              beta,
+                                              dy,
+                                              y_type,
+                                              incy,
+                                              compute_type),
+                              rocblas_status_not_implemented);
+
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                                  transA,
+                                                  M,
+                                                  N,
+                                                  alpha,
+                                                  nullptr,
+                                                  a_type,
+                                                  lda,
+                                                  dx,
+                                                  a_type,
+                                                  incx,
+                                                  beta,
+                                                  dy,
+                                                  y_type,
+                                                  incy,
+                                                  compute_type),
+                                  rocblas_status_invalid_pointer);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                                  transA,
+                                                  M,
+                                                  N,
+                                                  alpha,
+                                                  dA,
+                                                  a_type,
+                                                  lda,
+                                                  nullptr,
+                                                  a_type,
+                                                  incx,
+                                                  beta,
+                                                  dy,
+                                                  y_type,
+                                                  incy,
+                                                  compute_type),
+                                  rocblas_status_invalid_pointer);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                                  transA,
+                                                  M,
+                                                  N,
+                                                  alpha,
+                                                  dA,
+                                                  a_type,
+                                                  lda,
+                                                  dx,
+                                                  a_type,
+                                                  incx,
+                                                  beta,
+                                                  nullptr,
+                                                  y_type,
+                                                  incy,
+                                                  compute_type),
+                                  rocblas_status_invalid_pointer);
+
+            // When alpha==0, A and x may be nullptr without error
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                                  transA,
+                                                  M,
+                                                  N,
+                                                  zero,
+                                                  nullptr,
+                                                  a_type,
+                                                  lda,
+                                                  nullptr,
+                                                  a_type,
+                                                  incx,
+                                                  beta,
+                                                  dy,
+                                                  y_type,
+                                                  incy,
+                                                  compute_type),
+                                  rocblas_status_success);
+
+            // When alpha==0 && beta==1, A, x and y may be nullptr without error
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                                  transA,
+                                                  M,
+                                                  N,
+                                                  zero,
+                                                  nullptr,
+                                                  a_type,
+                                                  lda,
+                                                  nullptr,
+                                                  a_type,
+                                                  incx,
+                                                  one,
+                                                  nullptr,
+                                                  y_type,
+                                                  incy,
+                                                  compute_type),
+                                  rocblas_status_success);
+        }
+
+        // When M==0, all pointers may be nullptr without error
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                              transA,
+                                              0,
+                                              N,
+                                              nullptr,
+                                              nullptr,
+                                              a_type,
+                                              lda,
+                                              nullptr,
+                                              a_type,
+                                              incx,
+                                              nullptr,
+                                              nullptr,
+                                              y_type,
+                                              incy,
+                                              compute_type),
+                              rocblas_status_success);
+
+        // When N==0, all pointers may be nullptr without error
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                              transA,
+                                              M,
+                                              0,
+                                              nullptr,
+                                              nullptr,
+                                              a_type,
+                                              lda,
+                                              nullptr,
+                                              a_type,
+                                              incx,
+                                              nullptr,
+                                              nullptr,
+                                              y_type,
+                                              incy,
+                                              compute_type),
+                              rocblas_status_success);
+    }
+}
+
+template <typename Ti, typename To = Ti, typename Tc = To>
+void testing_gemv_ex(const Arguments& arg)
+{
+    rocblas_datatype  a_type       = arg.a_type;
+    rocblas_datatype  y_type       = arg.c_type;
+    rocblas_datatype  compute_type = arg.compute_type;
+    rocblas_int       M            = arg.M;
+    rocblas_int       N            = arg.N;
+    rocblas_int       lda          = arg.lda;
+    rocblas_int       incx         = arg.incx;
+    rocblas_int       incy         = arg.incy;
+    Tc                h_alpha      = arg.get_alpha<Tc>();
+    Tc                h_beta       = arg.get_beta<Tc>();
+    rocblas_operation transA       = char2rocblas_operation(arg.transA);
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || lda < M || lda < 1 || !incx || !incy;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                              transA,
+                                              M,
+                                              N,
+                                              nullptr,
+                                              nullptr,
+                                              a_type,
+                                              lda,
+                                              nullptr,
+                                              a_type,
+                                              incx,
+                                              nullptr,
+                                              nullptr,
+                                              y_type,
+                                              incy,
+                                              compute_type),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t dim_x, dim_y, abs_incy;
+
+    if(transA == rocblas_operation_none)
+    {
+        dim_x = N;
+        dim_y = M;
+    }
+    else
+    {
+        dim_x = M;
+        dim_y = N;
+    }
+
+    abs_incy = incy >= 0 ? incy : -incy;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_matrix<Ti> hA(M, N, lda);
+    host_vector<Ti> hx(dim_x, incx);
+    host_vector<To> hy_1(dim_y, incy);
+    host_vector<To> hy_2(dim_y, incy);
+    host_vector<To> hy_gold(dim_y, incy);
+    host_vector<Tc> halpha(1);
+    host_vector<Tc> hbeta(1);
+    halpha[0] = h_alpha;
+    hbeta[0]  = h_beta;
+
+    // Allocate device memory
+    device_matrix<Ti> dA(M, N, lda);
+    device_vector<Ti> dx(dim_x, incx);
+    device_vector<To> dy_1(dim_y, incy);
+    device_vector<To> dy_2(dim_y, incy);
+    device_vector<Tc> d_alpha(1);
+    device_vector<Tc> d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hy_1, arg, rocblas_client_beta_sets_nan);
+
+    hy_gold = hy_1;
+    hy_2    = hy_1;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy_1.transfer_from(hy_1));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1;
+    double rocblas_error_2;
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dy_2.transfer_from(hy_2));
+        CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+        CHECK_HIP_ERROR(d_beta.transfer_from(hbeta));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_ex(handle,
+                                            transA,
+                                            M,
+                                            N,
+                                            &h_alpha,
+                                            dA,
+                                            a_type,
+                                            lda,
+                                            dx,
+                                            a_type,
+                                            incx,
+                                            &h_beta,
+                                            dy_1,
+                                            y_type,
+                                            incy,
+                                            compute_type));
+        handle.post_test(arg);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_ex(handle,
+                                            transA,
+                                            M,
+                                            N,
+                                            d_alpha,
+                                            dA,
+                                            a_type,
+                                            lda,
+                                            dx,
+                                            a_type,
+                                            incx,
+                                            d_beta,
+                                            dy_2,
+                                            y_type,
+                                            incy,
+                                            compute_type));
+        handle.post_test(arg);
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        cblas_gemv_ex<Ti, To, Tc>(transA, M, N, h_alpha, hA, lda, hx, incx, h_beta, hy_gold, incy);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy_1));
+        CHECK_HIP_ERROR(hy_2.transfer_from(dy_2));
+
+        if(arg.unit_check)
+        {
+            unit_check_general<To>(1, dim_y, abs_incy, hy_gold, hy_1);
+            unit_check_general<To>(1, dim_y, abs_incy, hy_gold, hy_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<To>('F', 1, dim_y, abs_incy, hy_gold, hy_1);
+            rocblas_error_2 = norm_check_general<To>('F', 1, dim_y, abs_incy, hy_gold, hy_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_gemv_ex(handle,
+                            transA,
+                            M,
+                            N,
+                            &h_alpha,
+                            dA,
+                            a_type,
+                            lda,
+                            dx,
+                            a_type,
+                            incx,
+                            &h_beta,
+                            dy_1,
+                            y_type,
+                            incy,
+                            compute_type);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_gemv_ex(handle,
+                            transA,
+                            M,
+                            N,
+                            &h_alpha,
+                            dA,
+                            a_type,
+                            lda,
+                            dx,
+                            a_type,
+                            incx,
+                            &h_beta,
+                            dy_1,
+                            y_type,
+                            incy,
+                            compute_type);
+        });
+
+        ArgumentModel<e_transA, e_M, e_N, e_alpha, e_lda, e_incx, e_beta, e_incy>{}.log_args<Tc>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            gemv_gflop_count<Tc>(transA, M, N),
+            gemv_gbyte_count<Ti>(transA, M, N),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
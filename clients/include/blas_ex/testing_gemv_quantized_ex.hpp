@@ -0,0 +1,585 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <random>
+
+// A uniformly distributed integer in [lo, hi]
+inline rocblas_int gemv_quantized_random(rocblas_int lo, rocblas_int hi)
+{
+    return std::uniform_int_distribution<rocblas_int>{lo, hi}(t_rocblas_rng);
+}
+
+template <typename Ti, typename To, typename Tc>
+void testing_gemv_quantized_ex_bad_arg(const Arguments& arg)
+{
+    const rocblas_datatype x_type       = rocblas_type2datatype<Ti>();
+    const rocblas_datatype y_type       = rocblas_type2datatype<To>();
+    const rocblas_datatype compute_type = rocblas_type2datatype<Tc>();
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const rocblas_operation transA     = rocblas_operation_transpose;
+        const rocblas_int       M          = 100;
+        const rocblas_int       N          = 100;
+        const rocblas_int       lda        = 128;
+        const rocblas_int       a_bits     = 8;
+        const rocblas_int       group_size = 32;
+        const rocblas_int       groups     = (M - 1) / group_size + 1;
+        const rocblas_int       incx       = 1;
+        const rocblas_int       incy       = 1;
+
+        device_vector<Tc> alpha_d(1), beta_d(1), one_d(1), zero_d(1);
+
+        const Tc alpha_h(1), beta_h(2), one_h(1), zero_h(0);
+
+        const Tc* alpha = &alpha_h;
+        const Tc* beta  = &beta_h;
+        const Tc* one   = &one_h;
+        const Tc* zero  = &zero_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(beta_d, beta, sizeof(*beta), hipMemcpyHostToDevice));
+            beta = beta_d;
+            CHECK_HIP_ERROR(hipMemcpy(one_d, one, sizeof(*one), hipMemcpyHostToDevice));
+            one = one_d;
+            CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+            zero = zero_d;
+        }
+
+        // Allocate device memory
+        device_vector<uint8_t>      dA(size_t(lda) * N);
+        device_vector<rocblas_half> dscales(size_t(groups) * N);
+        device_vector<Ti>           dx(M);
+        device_vector<To>           dy(N);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dscales.memcheck());
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+        auto gemv_quantized_fn = [&](rocblas_handle    handle_,
+                                     rocblas_operation transA_,
+                                     rocblas_int       M_,
+                                     const Tc*         alpha_,
+                                     const void*       A_,
+                                     rocblas_int       a_bits_,
+                                     rocblas_int       lda_,
+                                     rocblas_int       group_size_,
+                                     rocblas_int       incx_,
+                                     const Tc*         beta_,
+                                     void*             y_,
+                                     rocblas_datatype  compute_type_) {
+            return rocblas_gemv_quantized_ex(handle_,
+                                             transA_,
+                                             M_,
+                                             N,
+                                             alpha_,
+                                             A_,
+                                             a_bits_,
+                                             lda_,
+                                             dscales,
+                                             nullptr,
+                                             group_size_,
+                                             dx,
+                                             x_type,
+                                             incx_,
+                                             beta_,
+                                             y_,
+                                             y_type,
+                                             incy,
+                                             compute_type_);
+        };
+
+        EXPECT_ROCBLAS_STATUS(gemv_quantized_fn(nullptr,
+                                                transA,
+                                                M,
+                                                alpha,
+                                                dA,
+                                                a_bits,
+                                                lda,
+                                                group_size,
+                                                incx,
+                                                beta,
+                                                dy,
+                                                compute_type),
+                              rocblas_status_invalid_handle);
+
+        // Only op(A) = A**T and A**H are supported
+        EXPECT_ROCBLAS_STATUS(gemv_quantized_fn(handle,
+                                                rocblas_operation_none,
+                                                M,
+                                                alpha,
+                                                dA,
+                                                a_bits,
+                                                lda,
+                                                group_size,
+                                                incx,
+                                                beta,
+                                                dy,
+                                                compute_type),
+                              rocblas_status_not_implemented);
+
+        EXPECT_ROCBLAS_STATUS(gemv_quantized_fn(handle,
+                                                transA,
+                                                M,
+                                                alpha,
+                                                dA,
+                                                2,
+                                                lda,
+                                                group_size,
+                                                incx,
+                                                beta,
+                                                dy,
+                                                compute_type),
+                              rocblas_status_invalid_value);
+
+        EXPECT_ROCBLAS_STATUS(gemv_quantized_fn(handle,
+                                                transA,
+                                                M,
+                                                alpha,
+                                                dA,
+                                                a_bits,
+                                                M - 1,
+                                                group_size,
+                                                incx,
+                                                beta,
+                                                dy,
+                                                compute_type),
+                              rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(gemv_quantized_fn(handle,
+                                                transA,
+                                                M,
+                                                alpha,
+                                                dA,
+                                                4,
+                                                lda - 1,
+                                                group_size,
+                                                incx,
+                                                beta,
+                                                dy,
+                                                compute_type),
+                              rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(
+            gemv_quantized_fn(
+                handle, transA, M, alpha, dA, a_bits, lda, 0, incx, beta, dy, compute_type),
+            rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(gemv_quantized_fn(handle,
+                                                transA,
+                                                M,
+                                                alpha,
+                                                dA,
+                                                a_bits,
+                                                lda,
+                                                33,
+                                                incx,
+                                                beta,
+                                                dy,
+                                                compute_type),
+                              rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(gemv_quantized_fn(handle,
+                                                transA,
+                                                M,
+                                                alpha,
+                                                dA,
+                                                a_bits,
+                                                lda,
+                                                group_size,
+                                                0,
+                                                beta,
+                                                dy,
+                                                compute_type),
+                              rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(gemv_quantized_fn(handle,
+                                                transA,
+                                                M,
+                                                nullptr,
+                                                dA,
+                                                a_bits,
+                                                lda,
+                                                group_size,
+                                                incx,
+                                                beta,
+                                                dy,
+                                                compute_type),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(gemv_quantized_fn(handle,
+                                                transA,
+                                                M,
+                                                alpha,
+                                                dA,
+                                                a_bits,
+                                                lda,
+                                                group_size,
+                                                incx,
+                                                nullptr,
+                                                dy,
+                                                compute_type),
+                              rocblas_status_invalid_pointer);
+
+        // Only f32_r computation is supported
+        EXPECT_ROCBLAS_STATUS(gemv_quantized_fn(handle,
+                                                transA,
+                                                M,
+                                                alpha,
+                                                dA,
+                                                a_bits,
+                                                lda,
+                                                group_size,
+                                                incx,
+                                                beta,
+                                                dy,
+                                                rocblas_datatype_f16_r),
+                              rocblas_status_not_implemented);
+
+        // A, x and y are only dereferenced when there is work to do
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            EXPECT_ROCBLAS_STATUS(gemv_quantized_fn(handle,
+                                                    transA,
+                                                    M,
+                                                    alpha,
+                                                    nullptr,
+                                                    a_bits,
+                                                    lda,
+                                                    group_size,
+                                                    incx,
+                                                    beta,
+                                                    dy,
+                                                    compute_type),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(gemv_quantized_fn(handle,
+                                                    transA,
+                                                    M,
+                                                    alpha,
+                                                    dA,
+                                                    a_bits,
+                                                    lda,
+                                                    group_size,
+                                                    incx,
+                                                    beta,
+                                                    nullptr,
+                                                    compute_type),
+                                  rocblas_status_invalid_pointer);
+
+            // If alpha is 0 and beta is 1, nothing is dereferenced
+            EXPECT_ROCBLAS_STATUS(gemv_quantized_fn(handle,
+                                                    transA,
+                                                    M,
+                                                    zero,
+                                                    nullptr,
+                                                    a_bits,
+                                                    lda,
+                                                    group_size,
+                                                    incx,
+                                                    one,
+                                                    nullptr,
+                                                    compute_type),
+                                  rocblas_status_success);
+        }
+
+        // If M is 0, alpha, beta, A and y are not dereferenced
+        EXPECT_ROCBLAS_STATUS(gemv_quantized_fn(handle,
+                                                transA,
+                                                0,
+                                                nullptr,
+                                                nullptr,
+                                                a_bits,
+                                                lda,
+                                                group_size,
+                                                incx,
+                                                nullptr,
+                                                nullptr,
+                                                compute_type),
+                              rocblas_status_success);
+    }
+}
+
+// A holds a_bits = arg.algo (8, or 4 when algo is 4) integers with one f16 scale and zero
+// point per group of arg.K elements of a column, or per column when K is 0. The small integers
+// of A, x, y and the zero points and the power of two scales make every product and partial
+// sum exact in f32_r, so the result is compared with the gemv of the dequantized A computed in
+// double. Both explicit zero points and the default zero point (nullptr zeros) are tested.
+template <typename Ti, typename To, typename Tc>
+void testing_gemv_quantized_ex(const Arguments& arg)
+{
+    const rocblas_datatype x_type       = rocblas_type2datatype<Ti>();
+    const rocblas_datatype y_type       = rocblas_type2datatype<To>();
+    const rocblas_datatype compute_type = rocblas_type2datatype<Tc>();
+
+    rocblas_operation transA     = char2rocblas_operation(arg.transA);
+    rocblas_int       M          = arg.M;
+    rocblas_int       N          = arg.N;
+    rocblas_int       lda        = arg.lda;
+    rocblas_int       incx       = arg.incx;
+    rocblas_int       incy       = arg.incy;
+    rocblas_int       a_bits     = arg.algo == 4 ? 4 : 8;
+    rocblas_int       group_size = arg.K ? arg.K : std::max(M, 1);
+    Tc                h_alpha    = arg.get_alpha<Tc>();
+    Tc                h_beta     = arg.get_beta<Tc>();
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || lda < M || lda < 1 || (a_bits == 4 && lda % 2) || !incx
+                        || !incy || group_size < 1
+                        || (group_size < M && group_size % (128 / a_bits));
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_quantized_ex(handle,
+                                                        transA,
+                                                        M,
+                                                        N,
+                                                        nullptr,
+                                                        nullptr,
+                                                        a_bits,
+                                                        lda,
+                                                        nullptr,
+                                                        nullptr,
+                                                        group_size,
+                                                        nullptr,
+                                                        x_type,
+                                                        incx,
+                                                        nullptr,
+                                                        nullptr,
+                                                        y_type,
+                                                        incy,
+                                                        compute_type),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    const rocblas_int groups   = (M - 1) / group_size + 1;
+    const size_t      abs_incx = incx >= 0 ? incx : -incx;
+    const size_t      abs_incy = incy >= 0 ? incy : -incy;
+
+    // Naming: `h` is in CPU (host) memory(eg hy_1), `d` is in GPU (device) memory (eg dy_1).
+    // Allocate host memory
+    host_vector<rocblas_int>  hq(size_t(M) * N);
+    host_vector<uint8_t>      hA(size_t(lda) * N * a_bits / 8);
+    host_vector<rocblas_half> hscales(size_t(groups) * N);
+    host_vector<rocblas_half> hzeros(size_t(groups) * N);
+    host_vector<Ti>           hx(M * abs_incx);
+    host_vector<To>           hy(N * abs_incy);
+    host_vector<To>           hy_1(N * abs_incy);
+    host_vector<To>           hy_2(N * abs_incy);
+    host_vector<To>           hy_gold(N * abs_incy);
+
+    // Allocate device memory
+    device_vector<uint8_t>      dA(hA.size());
+    device_vector<rocblas_half> dscales(hscales.size());
+    device_vector<rocblas_half> dzeros(hzeros.size());
+    device_vector<Ti>           dx(hx.size());
+    device_vector<To>           dy_1(hy.size());
+    device_vector<To>           dy_2(hy.size());
+    device_vector<Tc>           d_alpha(1);
+    device_vector<Tc>           d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dscales.memcheck());
+    CHECK_DEVICE_ALLOCATION(dzeros.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory. 8-bit elements are signed, 4-bit elements are unsigned
+    // and packed two to a byte, the even row of each pair in the low 4 bits.
+    rocblas_seedrand();
+    for(size_t k = 0; k < hA.size(); k++)
+        hA[k] = 0;
+    for(rocblas_int j = 0; j < N; j++)
+        for(rocblas_int i = 0; i < M; i++)
+        {
+            rocblas_int q = a_bits == 8 ? gemv_quantized_random(-16, 15)
+                                        : gemv_quantized_random(0, 15);
+            hq[i + size_t(M) * j] = q;
+            if(a_bits == 8)
+                hA[i + size_t(lda) * j] = uint8_t(int8_t(q));
+            else
+                hA[i / 2 + size_t(lda / 2) * j] |= uint8_t(q << ((i & 1) * 4));
+        }
+    for(size_t k = 0; k < hscales.size(); k++)
+    {
+        hscales[k] = rocblas_half(std::ldexp(1.0f, gemv_quantized_random(-3, 1)));
+        hzeros[k]  = rocblas_half(float(gemv_quantized_random(0, a_bits == 8 ? 4 : 15)));
+    }
+    for(size_t i = 0; i < hx.size(); i++)
+        hx[i] = Ti(float(gemv_quantized_random(-2, 2)));
+    for(size_t i = 0; i < hy.size(); i++)
+        hy[i] = To(float(gemv_quantized_random(-2, 2)));
+
+    // Transfer data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dscales.transfer_from(hscales));
+    CHECK_HIP_ERROR(dzeros.transfer_from(hzeros));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tc), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tc), hipMemcpyHostToDevice));
+
+    auto gemv_quantized = [&](const Tc* alpha, const Tc* beta, const rocblas_half* zeros, To* y) {
+        return rocblas_gemv_quantized_ex(handle,
+                                         transA,
+                                         M,
+                                         N,
+                                         alpha,
+                                         dA,
+                                         a_bits,
+                                         lda,
+                                         dscales,
+                                         zeros,
+                                         group_size,
+                                         dx,
+                                         x_type,
+                                         incx,
+                                         beta,
+                                         y,
+                                         y_type,
+                                         incy,
+                                         compute_type);
+    };
+
+    auto offset = [](rocblas_int n, rocblas_int inc, rocblas_int i) {
+        return inc < 0 ? size_t(n - 1 - i) * -inc : size_t(i) * inc;
+    };
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(bool has_zeros : {false, true})
+        {
+            const rocblas_half* zeros = has_zeros ? (const rocblas_half*)dzeros : nullptr;
+
+            CHECK_HIP_ERROR(dy_1.transfer_from(hy));
+            CHECK_HIP_ERROR(dy_2.transfer_from(hy));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(gemv_quantized(&h_alpha, &h_beta, zeros, dy_1));
+            handle.post_test(arg);
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(gemv_quantized(d_alpha, d_beta, zeros, dy_2));
+            handle.post_test(arg);
+
+            // CPU gemv of the dequantized A
+            cpu_time_used = get_time_us_no_sync();
+
+            const double zero_point = a_bits == 8 ? 0 : 8;
+            hy_gold                 = hy;
+            for(rocblas_int j = 0; j < N; j++)
+            {
+                double sum = 0;
+                for(rocblas_int i = 0; i < M; i++)
+                {
+                    size_t g    = i / group_size + size_t(groups) * j;
+                    double zero = has_zeros ? double(float(hzeros[g])) : zero_point;
+                    sum += double(float(hscales[g])) * (hq[i + size_t(M) * j] - zero)
+                           * double(float(hx[offset(M, incx, i)]));
+                }
+                size_t iy   = offset(N, incy, j);
+                hy_gold[iy] = To(float(h_alpha * sum + h_beta * double(float(hy[iy]))));
+            }
+
+            cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+            // copy output from device to CPU
+            CHECK_HIP_ERROR(hy_1.transfer_from(dy_1));
+            CHECK_HIP_ERROR(hy_2.transfer_from(dy_2));
+
+            if(arg.unit_check)
+            {
+                unit_check_general<To>(1, N, abs_incy, hy_gold, hy_1);
+                unit_check_general<To>(1, N, abs_incy, hy_gold, hy_2);
+            }
+
+            if(arg.norm_check)
+            {
+                rocblas_error_1 = std::max(
+                    rocblas_error_1, norm_check_general<To>('F', 1, N, abs_incy, hy_gold, hy_1));
+                rocblas_error_2 = std::max(
+                    rocblas_error_2, norm_check_general<To>('F', 1, N, abs_incy, hy_gold, hy_2));
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dy_1.transfer_from(hy));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            gemv_quantized(&h_alpha, &h_beta, dzeros, dy_1);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            gemv_quantized(&h_alpha, &h_beta, dzeros, dy_1);
+        });
+
+        ArgumentModel<e_transA, e_M, e_N, e_alpha, e_lda, e_K, e_algo, e_incx, e_beta, e_incy>{}
+            .log_args<To>(rocblas_cout,
+                          arg,
+                          gpu_time_used,
+                          gemv_gflop_count<Tc>(transA, M, N),
+                          gemv_quantized_gbyte_count<Ti, To>(M, N, a_bits, groups, true),
+                          cpu_time_used,
+                          rocblas_error_1,
+                          rocblas_error_2);
+    }
+}
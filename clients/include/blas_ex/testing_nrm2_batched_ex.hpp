@@ -218,6 +218,7 @@ void testing_nrm2_batched_ex(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
         {
             cblas_nrm2<Tx>(N, hx[b], incx, cpu_result + b);
@@ -278,10 +279,7 @@ void testing_nrm2_batched_ex(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_nrm2_batched_ex_fn(handle,
                                        N,
                                        dx.ptr_on_device(),
@@ -291,9 +289,7 @@ void testing_nrm2_batched_ex(const Arguments& arg)
                                        d_rocblas_result_2,
                                        result_type,
                                        execution_type);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_N, e_incx, e_batch_count>{}.log_args<Tx>(rocblas_cout,
                                                                  arg,
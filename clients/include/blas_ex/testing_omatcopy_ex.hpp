@@ -0,0 +1,356 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename Ta, typename Tb = Ta, typename Tex = Tb>
+void testing_omatcopy_ex_bad_arg(const Arguments& arg)
+{
+    const rocblas_operation trans       = rocblas_operation_transpose;
+    const rocblas_operation none        = rocblas_operation_none;
+    const rocblas_operation bad_trans   = (rocblas_operation)rocblas_fill_full;
+    const rocblas_int       M           = 100;
+    const rocblas_int       N           = 50;
+    const rocblas_int       lda         = 100;
+    const rocblas_int       ldb         = 100;
+    const rocblas_stride    stride_a    = size_t(lda) * N;
+    const rocblas_stride    stride_b    = size_t(ldb) * M;
+    const rocblas_int       batch_count = 2;
+
+    const rocblas_datatype a_type       = rocblas_type2datatype<Ta>();
+    const rocblas_datatype b_type       = rocblas_type2datatype<Tb>();
+    const rocblas_datatype compute_type = rocblas_type2datatype<Tex>();
+
+    rocblas_local_handle handle{arg};
+
+    // Allocate device memory
+    device_strided_batch_vector<Ta> dA(stride_a, 1, stride_a, batch_count);
+    device_strided_batch_vector<Tb> dB(stride_b, 1, stride_b, batch_count);
+    device_batch_vector<Ta>         dAb(stride_a, 1, batch_count);
+    device_batch_vector<Tb>         dBb(stride_b, 1, batch_count);
+    device_vector<Tex>              alpha_d(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dAb.memcheck());
+    CHECK_DEVICE_ALLOCATION(dBb.memcheck());
+    CHECK_DEVICE_ALLOCATION(alpha_d.memcheck());
+
+    Ta** dA_array = dAb.ptr_on_device();
+    Tb** dB_array = dBb.ptr_on_device();
+
+    const Tex alpha_h(1);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const Tex* alpha = &alpha_h;
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+        }
+
+        // clang-format off
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_ex(nullptr, trans, M, N, alpha, dA, a_type, lda, dB, b_type, ldb, compute_type), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_ex(handle, bad_trans, M, N, alpha, dA, a_type, lda, dB, b_type, ldb, compute_type), rocblas_status_invalid_value);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_ex(handle, trans, -1, N, alpha, dA, a_type, lda, dB, b_type, ldb, compute_type), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_ex(handle, trans, M, -1, alpha, dA, a_type, lda, dB, b_type, ldb, compute_type), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_ex(handle, trans, M, N, alpha, dA, a_type, M - 1, dB, b_type, ldb, compute_type), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_ex(handle, trans, M, N, alpha, dA, a_type, lda, dB, b_type, N - 1, compute_type), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_ex(handle, none, M, N, alpha, dA, a_type, lda, dB, b_type, M - 1, compute_type), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_ex(handle, trans, M, N, nullptr, dA, a_type, lda, dB, b_type, ldb, compute_type), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_ex(handle, trans, M, N, alpha, nullptr, a_type, lda, dB, b_type, ldb, compute_type), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_ex(handle, trans, M, N, alpha, dA, a_type, lda, nullptr, b_type, ldb, compute_type), rocblas_status_invalid_pointer);
+
+// A compute type which is not supported with the types of A and B
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_ex(handle, trans, M, N, alpha, dA, a_type, lda, dB, b_type, ldb, rocblas_datatype_i32_r), rocblas_status_not_implemented);
+
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_batched_ex(nullptr, trans, M, N, alpha, dA_array, a_type, lda, dB_array, b_type, ldb, batch_count, compute_type), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_batched_ex(handle, trans, M, N, alpha, dA_array, a_type, lda, dB_array, b_type, ldb, -1, compute_type), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_batched_ex(handle, trans, M, N, nullptr, dA_array, a_type, lda, dB_array, b_type, ldb, batch_count, compute_type), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_batched_ex(handle, trans, M, N, alpha, nullptr, a_type, lda, dB_array, b_type, ldb, batch_count, compute_type), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_batched_ex(handle, trans, M, N, alpha, dA_array, a_type, lda, nullptr, b_type, ldb, batch_count, compute_type), rocblas_status_invalid_pointer);
+
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_strided_batched_ex(nullptr, trans, M, N, alpha, dA, a_type, lda, stride_a, dB, b_type, ldb, stride_b, batch_count, compute_type), rocblas_status_invalid_handle);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_strided_batched_ex(handle, trans, M, N, alpha, dA, a_type, lda, stride_a, dB, b_type, ldb, stride_b, -1, compute_type), rocblas_status_invalid_size);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_strided_batched_ex(handle, trans, M, N, nullptr, dA, a_type, lda, stride_a, dB, b_type, ldb, stride_b, batch_count, compute_type), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_strided_batched_ex(handle, trans, M, N, alpha, nullptr, a_type, lda, stride_a, dB, b_type, ldb, stride_b, batch_count, compute_type), rocblas_status_invalid_pointer);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_strided_batched_ex(handle, trans, M, N, alpha, dA, a_type, lda, stride_a, nullptr, b_type, ldb, stride_b, batch_count, compute_type), rocblas_status_invalid_pointer);
+
+// If M, N or batch_count is 0, the pointers are not checked
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_ex(handle, trans, 0, N, nullptr, nullptr, a_type, lda, nullptr, b_type, ldb, compute_type), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_ex(handle, trans, M, 0, nullptr, nullptr, a_type, lda, nullptr, b_type, ldb, compute_type), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_batched_ex(handle, trans, M, N, nullptr, nullptr, a_type, lda, nullptr, b_type, ldb, 0, compute_type), rocblas_status_success);
+EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_strided_batched_ex(handle, trans, M, N, nullptr, nullptr, a_type, lda, stride_a, nullptr, b_type, ldb, stride_b, 0, compute_type), rocblas_status_success);
+        // clang-format on
+    }
+}
+
+// omatcopy_ex must write alpha*op(A), computed in Tex and converted to Tb on the host, for the
+// strided batched, batched and non batched functions
+template <typename Ta, typename Tb = Ta, typename Tex = Tb>
+void testing_omatcopy_ex(const Arguments& arg)
+{
+    rocblas_operation trans       = char2rocblas_operation(arg.transA);
+    rocblas_int       M           = arg.M;
+    rocblas_int       N           = arg.N;
+    rocblas_int       lda         = arg.lda;
+    rocblas_int       ldb         = arg.ldb;
+    rocblas_int       batch_count = arg.batch_count;
+
+    const rocblas_datatype a_type       = rocblas_type2datatype<Ta>();
+    const rocblas_datatype b_type       = rocblas_type2datatype<Tb>();
+    const rocblas_datatype compute_type = rocblas_type2datatype<Tex>();
+
+    Tex h_alpha = arg.get_alpha<Tex>();
+
+    rocblas_local_handle handle{arg};
+
+    // B is the rows x cols matrix op(A)
+    rocblas_int rows = trans == rocblas_operation_none ? M : N;
+    rocblas_int cols = trans == rocblas_operation_none ? N : M;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size
+        = M < 0 || N < 0 || batch_count < 0 || lda < M || lda < 1 || ldb < rows || ldb < 1;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_omatcopy_strided_batched_ex(handle,
+                                                                  trans,
+                                                                  M,
+                                                                  N,
+                                                                  nullptr,
+                                                                  nullptr,
+                                                                  a_type,
+                                                                  lda,
+                                                                  lda * N,
+                                                                  nullptr,
+                                                                  b_type,
+                                                                  ldb,
+                                                                  ldb * cols,
+                                                                  batch_count,
+                                                                  compute_type),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    rocblas_stride stride_a = size_t(lda) * N;
+    rocblas_stride stride_b = size_t(ldb) * cols;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_strided_batch_vector<Ta> hA(stride_a, 1, stride_a, batch_count);
+    host_strided_batch_vector<Tb> hB_1(stride_b, 1, stride_b, batch_count);
+    host_strided_batch_vector<Tb> hB_2(stride_b, 1, stride_b, batch_count);
+    host_strided_batch_vector<Tb> hB_gold(stride_b, 1, stride_b, batch_count);
+    host_batch_vector<Ta>         hAb(stride_a, 1, batch_count);
+    host_batch_vector<Tb>         hBb(stride_b, 1, batch_count);
+    host_vector<Tex>              halpha(1);
+    halpha[0] = h_alpha;
+
+    // Allocate device memory
+    device_strided_batch_vector<Ta> dA(stride_a, 1, stride_a, batch_count);
+    device_strided_batch_vector<Tb> dB(stride_b, 1, stride_b, batch_count);
+    device_batch_vector<Ta>         dAb(stride_a, 1, batch_count);
+    device_batch_vector<Tb>         dBb(stride_b, 1, batch_count);
+    device_vector<Tex>              d_alpha(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dAb.memcheck());
+    CHECK_DEVICE_ALLOCATION(dBb.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hA, arg, rocblas_client_alpha_sets_nan, true);
+    for(rocblas_int b = 0; b < batch_count; b++)
+        std::copy(hA[b], hA[b] + stride_a, hAb[b]);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dAb.transfer_from(hAb));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_omatcopy_strided_batched_ex(handle,
+                                                                trans,
+                                                                M,
+                                                                N,
+                                                                &h_alpha,
+                                                                dA,
+                                                                a_type,
+                                                                lda,
+                                                                stride_a,
+                                                                dB,
+                                                                b_type,
+                                                                ldb,
+                                                                stride_b,
+                                                                batch_count,
+                                                                compute_type));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hB_1.transfer_from(dB));
+
+        // The batched function
+        CHECK_ROCBLAS_ERROR(rocblas_omatcopy_batched_ex(handle,
+                                                        trans,
+                                                        M,
+                                                        N,
+                                                        &h_alpha,
+                                                        dAb.ptr_on_device(),
+                                                        a_type,
+                                                        lda,
+                                                        dBb.ptr_on_device(),
+                                                        b_type,
+                                                        ldb,
+                                                        batch_count,
+                                                        compute_type));
+        CHECK_HIP_ERROR(hBb.transfer_from(dBb));
+
+        // GPU BLAS, rocblas_pointer_mode_device, with the non batched function on each batch
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_omatcopy_ex(handle,
+                                                    trans,
+                                                    M,
+                                                    N,
+                                                    d_alpha,
+                                                    dA[b],
+                                                    a_type,
+                                                    lda,
+                                                    dB[b],
+                                                    b_type,
+                                                    ldb,
+                                                    compute_type));
+        }
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hB_2.transfer_from(dB));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            for(rocblas_int j = 0; j < cols; j++)
+            {
+                for(rocblas_int i = 0; i < rows; i++)
+                {
+                    Tex a = static_cast<Tex>(trans == rocblas_operation_none
+                                                 ? hA[b][i + size_t(j) * lda]
+                                                 : hA[b][j + size_t(i) * lda]);
+                    if(trans == rocblas_operation_conjugate_transpose)
+                        a = conjugate(a);
+                    hB_gold[b][i + size_t(j) * ldb] = static_cast<Tb>(h_alpha * a);
+                }
+            }
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<Tb>(rows, cols, ldb, stride_b, hB_gold, hB_1, batch_count);
+            unit_check_general<Tb>(rows, cols, ldb, stride_b, hB_gold, hB_2, batch_count);
+            for(rocblas_int b = 0; b < batch_count; b++)
+                unit_check_general<Tb>(rows, cols, ldb, hB_gold[b], hBb[b]);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<Tb>(
+                'F', rows, cols, ldb, stride_b, hB_gold, hB_1, batch_count);
+            rocblas_error_2 = norm_check_general<Tb>(
+                'F', rows, cols, ldb, stride_b, hB_gold, hB_2, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        auto omatcopy_strided_batched_ex = [&] {
+            rocblas_omatcopy_strided_batched_ex(handle,
+                                                trans,
+                                                M,
+                                                N,
+                                                &h_alpha,
+                                                dA,
+                                                a_type,
+                                                lda,
+                                                stride_a,
+                                                dB,
+                                                b_type,
+                                                ldb,
+                                                stride_b,
+                                                batch_count,
+                                                compute_type);
+        };
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+            omatcopy_strided_batched_ex();
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used
+            = get_time_us_hot_calls(stream, number_hot_calls, omatcopy_strided_batched_ex);
+
+        ArgumentModel<e_transA, e_M, e_N, e_alpha, e_lda, e_ldb, e_batch_count>{}.log_args<Tex>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            scal_gflop_count<Tex, Tex>(M * N),
+            matcopy_gbyte_count<Ta, Tb>(M, N),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
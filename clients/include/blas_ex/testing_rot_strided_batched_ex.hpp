@@ -230,6 +230,7 @@ void testing_rot_strided_batched_ex(const Arguments& arg)
     // hx_gold[0] = hx[0];
     // hy_gold[0] = hy[0];
     cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
     for(int b = 0; b < batch_count; b++)
     {
         cblas_rot<Tx, Ty, Tcs, Tcs>(N, hx_gold[b], incx, hy_gold[b], incy, hc, hs);
@@ -356,9 +357,7 @@ void testing_rot_strided_batched_ex(const Arguments& arg)
         }
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_rot_strided_batched_ex_fn(handle,
                                               N,
                                               dx,
@@ -374,8 +373,7 @@ void testing_rot_strided_batched_ex(const Arguments& arg)
                                               cs_type,
                                               batch_count,
                                               execution_type);
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_N, e_incx, e_stride_x, e_incy, e_stride_y, e_batch_count>{}.log_args<Tx>(
             rocblas_cout,
@@ -216,6 +216,7 @@ void testing_scal_strided_batched_ex(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
         for(int b = 0; b < batch_count; b++)
         {
             cblas_scal(N, h_alpha, (Tx*)hx_gold[b], incx);
@@ -261,10 +262,7 @@ void testing_scal_strided_batched_ex(const Arguments& arg)
 
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
             rocblas_scal_strided_batched_ex_fn(handle,
                                                N,
                                                &h_alpha,
@@ -275,9 +273,7 @@ void testing_scal_strided_batched_ex(const Arguments& arg)
                                                stridex,
                                                batch_count,
                                                execution_type);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_N, e_alpha, e_incx, e_stride_x, e_batch_count>{}.log_args<Tx>(
             rocblas_cout,
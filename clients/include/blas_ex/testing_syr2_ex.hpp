@@ -0,0 +1,448 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T, typename Tc = T>
+void testing_syr2_ex_bad_arg(const Arguments& arg)
+{
+    rocblas_datatype a_type       = rocblas_type2datatype<T>();
+    rocblas_datatype compute_type = rocblas_type2datatype<Tc>();
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const rocblas_fill uplo = rocblas_fill_upper;
+        const rocblas_int  N    = 100;
+        const rocblas_int  lda  = 100;
+        const rocblas_int  incx = 1;
+        const rocblas_int  incy = 1;
+
+        device_vector<Tc> alpha_d(1), zero_d(1);
+        const Tc          alpha_h(1), zero_h(0);
+
+        const Tc* alpha = &alpha_h;
+        const Tc* zero  = &zero_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+            zero = zero_d;
+        }
+
+        // Allocate device memory
+        device_matrix<T> dA(N, N, lda);
+        device_vector<T> dx(N, incx);
+        device_vector<T> dy(N, incy);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(rocblas_syr2_ex(nullptr,
+                                              uplo,
+                                              N,
+                                              alpha,
+                                              dx,
+                                              a_type,
+                                              incx,
+                                              dy,
+                                              a_type,
+                                              incy,
+                                              dA,
+                                              a_type,
+                                              lda,
+                                              compute_type),
+                              rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_syr2_ex(handle,
+                                              rocblas_fill_full,
+                                              N,
+                                              alpha,
+                                              dx,
+                                              a_type,
+                                              incx,
+                                              dy,
+                                              a_type,
+                                              incy,
+                                              dA,
+                                              a_type,
+                                              lda,
+                                              compute_type),
+                              rocblas_status_invalid_value);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_syr2_ex(handle,
+                                              uplo,
+                                              N,
+                                              alpha,
+                                              dx,
+                                              a_type,
+                                              incx,
+                                              dy,
+                                              a_type,
+                                              incy,
+                                              dA,
+                                              a_type,
+                                              N - 1,
+                                              compute_type),
+                              rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_syr2_ex(handle,
+                                              uplo,
+                                              N,
+                                              nullptr,
+                                              dx,
+                                              a_type,
+                                              incx,
+                                              dy,
+                                              a_type,
+                                              incy,
+                                              dA,
+                                              a_type,
+                                              lda,
+                                              compute_type),
+                              rocblas_status_invalid_pointer);
+
+        // x and y must have the type of A
+        EXPECT_ROCBLAS_STATUS(rocblas_syr2_ex(handle,
+                                              uplo,
+                                              N,
+                                              alpha,
+                                              dx,
+                                              rocblas_datatype_i8_r,
+                                              incx,
+                                              dy,
+                                              a_type,
+                                              incy,
+                                              dA,
+                                              a_type,
+                                              lda,
+                                              compute_type),
+                              rocblas_status_not_implemented);
+
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_syr2_ex(handle,
+                                                  uplo,
+                                                  N,
+                                                  alpha,
+                                                  nullptr,
+                                                  a_type,
+                                                  incx,
+                                                  dy,
+                                                  a_type,
+                                                  incy,
+                                                  dA,
+                                                  a_type,
+                                                  lda,
+                                                  compute_type),
+                                  rocblas_status_invalid_pointer);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_syr2_ex(handle,
+                                                  uplo,
+                                                  N,
+                                                  alpha,
+                                                  dx,
+                                                  a_type,
+                                                  incx,
+                                                  nullptr,
+                                                  a_type,
+                                                  incy,
+                                                  dA,
+                                                  a_type,
+                                                  lda,
+                                                  compute_type),
+                                  rocblas_status_invalid_pointer);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_syr2_ex(handle,
+                                                  uplo,
+                                                  N,
+                                                  alpha,
+                                                  dx,
+                                                  a_type,
+                                                  incx,
+                                                  dy,
+                                                  a_type,
+                                                  incy,
+                                                  nullptr,
+                                                  a_type,
+                                                  lda,
+                                                  compute_type),
+                                  rocblas_status_invalid_pointer);
+
+            // When alpha==0, all pointers may be nullptr without error
+            EXPECT_ROCBLAS_STATUS(rocblas_syr2_ex(handle,
+                                                  uplo,
+                                                  N,
+                                                  zero,
+                                                  nullptr,
+                                                  a_type,
+                                                  incx,
+                                                  nullptr,
+                                                  a_type,
+                                                  incy,
+                                                  nullptr,
+                                                  a_type,
+                                                  lda,
+                                                  compute_type),
+                                  rocblas_status_success);
+        }
+
+        // When N==0, all pointers may be nullptr without error
+        EXPECT_ROCBLAS_STATUS(rocblas_syr2_ex(handle,
+                                              uplo,
+                                              0,
+                                              nullptr,
+                                              nullptr,
+                                              a_type,
+                                              incx,
+                                              nullptr,
+                                              a_type,
+                                              incy,
+                                              nullptr,
+                                              a_type,
+                                              lda,
+                                              compute_type),
+                              rocblas_status_success);
+    }
+}
+
+template <typename T, typename Tc = T>
+void testing_syr2_ex(const Arguments& arg)
+{
+    rocblas_datatype a_type       = arg.a_type;
+    rocblas_datatype compute_type = arg.compute_type;
+    rocblas_fill     uplo         = char2rocblas_fill(arg.uplo);
+    rocblas_int      N            = arg.N;
+    rocblas_int      lda          = arg.lda;
+    rocblas_int      incx         = arg.incx;
+    rocblas_int      incy         = arg.incy;
+    Tc               h_alpha      = arg.get_alpha<Tc>();
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = N < 0 || lda < N || lda < 1 || !incx || !incy;
+    if(invalid_size || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_syr2_ex(handle,
+                                              uplo,
+                                              N,
+                                              nullptr,
+                                              nullptr,
+                                              a_type,
+                                              incx,
+                                              nullptr,
+                                              a_type,
+                                              incy,
+                                              nullptr,
+                                              a_type,
+                                              lda,
+                                              compute_type),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA_1), `d` is in GPU (device) memory (eg dA_1).
+    // Allocate host memory
+    host_matrix<T>  hA_1(N, N, lda);
+    host_matrix<T>  hA_2(N, N, lda);
+    host_matrix<T>  hA_gold(N, N, lda);
+    host_vector<T>  hx(N, incx);
+    host_vector<T>  hy(N, incy);
+    host_vector<Tc> halpha(1);
+    halpha[0] = h_alpha;
+
+    // Allocate device memory
+    device_matrix<T>  dA_1(N, N, lda);
+    device_matrix<T>  dA_2(N, N, lda);
+    device_vector<T>  dx(N, incx);
+    device_vector<T>  dy(N, incy);
+    device_vector<Tc> d_alpha(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA_1, arg, rocblas_client_never_set_nan, rocblas_client_symmetric_matrix, true);
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan);
+
+    hA_2    = hA_1;
+    hA_gold = hA_1;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA_1.transfer_from(hA_1));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1;
+    double rocblas_error_2;
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dA_2.transfer_from(hA_2));
+        CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_syr2_ex(handle,
+                                            uplo,
+                                            N,
+                                            &h_alpha,
+                                            dx,
+                                            a_type,
+                                            incx,
+                                            dy,
+                                            a_type,
+                                            incy,
+                                            dA_1,
+                                            a_type,
+                                            lda,
+                                            compute_type));
+        handle.post_test(arg);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_syr2_ex(handle,
+                                            uplo,
+                                            N,
+                                            d_alpha,
+                                            dx,
+                                            a_type,
+                                            incx,
+                                            dy,
+                                            a_type,
+                                            incy,
+                                            dA_2,
+                                            a_type,
+                                            lda,
+                                            compute_type));
+        handle.post_test(arg);
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        cblas_syr2_ex<T, Tc>(uplo, N, h_alpha, hx, incx, hy, incy, hA_gold, lda);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hA_1.transfer_from(dA_1));
+        CHECK_HIP_ERROR(hA_2.transfer_from(dA_2));
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(N, N, lda, hA_gold, hA_1);
+            unit_check_general<T>(N, N, lda, hA_gold, hA_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', N, N, lda, hA_gold, hA_1);
+            rocblas_error_2 = norm_check_general<T>('F', N, N, lda, hA_gold, hA_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_syr2_ex(handle,
+                            uplo,
+                            N,
+                            &h_alpha,
+                            dx,
+                            a_type,
+                            incx,
+                            dy,
+                            a_type,
+                            incy,
+                            dA_1,
+                            a_type,
+                            lda,
+                            compute_type);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_syr2_ex(handle,
+                            uplo,
+                            N,
+                            &h_alpha,
+                            dx,
+                            a_type,
+                            incx,
+                            dy,
+                            a_type,
+                            incy,
+                            dA_1,
+                            a_type,
+                            lda,
+                            compute_type);
+        });
+
+        ArgumentModel<e_uplo, e_N, e_alpha, e_lda, e_incx, e_incy>{}.log_args<Tc>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            syr2_gflop_count<Tc>(N),
+            syr2_gbyte_count<T>(N),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
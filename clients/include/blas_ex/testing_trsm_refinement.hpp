@@ -0,0 +1,267 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_trsm_ex.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// The refinement steps of the tests, which are plenty for the diagonally dominant matrices
+#define TRSM_REFINEMENT_STEPS 10
+
+template <typename T>
+void testing_trsm_refinement_bad_arg(const Arguments&)
+{
+    // A new handle does not refine, whatever rocblas-bench selects for its handles
+    rocblas_handle handle;
+    CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+    rocblas_int max_steps = -1;
+    CHECK_ROCBLAS_ERROR(rocblas_get_trsm_refinement(handle, &max_steps));
+    EXPECT_EQ(max_steps, 0);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_trsm_refinement(nullptr, 1), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_trsm_refinement(nullptr, &max_steps),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_trsm_refinement(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_trsm_refinement(handle, -1), rocblas_status_invalid_value);
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_trsm_refinement(handle, TRSM_REFINEMENT_STEPS));
+    CHECK_ROCBLAS_ERROR(rocblas_get_trsm_refinement(handle, &max_steps));
+    EXPECT_EQ(max_steps, TRSM_REFINEMENT_STEPS);
+
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+}
+
+// trsm_ex with refinement, which solves in single precision, must reach the forward error and
+// residual bounds of the double precision solve
+template <typename T>
+void testing_trsm_refinement(const Arguments& arg)
+{
+    rocblas_int M   = arg.M;
+    rocblas_int N   = arg.N;
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+
+    T alpha_h = arg.get_alpha<T>();
+
+    rocblas_side      side   = char2rocblas_side(arg.side);
+    rocblas_fill      uplo   = char2rocblas_fill(arg.uplo);
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_diagonal  diag   = char2rocblas_diagonal(arg.diag);
+
+    rocblas_int K = side == rocblas_side_left ? M : N;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(rocblas_set_trsm_refinement(handle, TRSM_REFINEMENT_STEPS));
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || lda < K || lda < 1 || ldb < M || ldb < 1;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_trsm_ex(handle,
+                                              side,
+                                              uplo,
+                                              transA,
+                                              diag,
+                                              M,
+                                              N,
+                                              nullptr,
+                                              nullptr,
+                                              lda,
+                                              nullptr,
+                                              ldb,
+                                              nullptr,
+                                              0,
+                                              arg.compute_type),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_matrix<T> hA(K, K, lda);
+    host_matrix<T> hB(M, N, ldb);
+    host_matrix<T> hX(M, N, ldb);
+    host_matrix<T> hXorB_1(M, N, ldb);
+    host_matrix<T> hXorB_2(M, N, ldb);
+    host_matrix<T> cpuXorB(M, N, ldb);
+
+    // Allocate device memory
+    device_matrix<T> dA(K, K, lda);
+    device_matrix<T> dXorB(M, N, ldb);
+    device_vector<T> alpha_d(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dXorB.memcheck());
+    CHECK_DEVICE_ALLOCATION(alpha_d.memcheck());
+
+    // Initialize data on host memory, with a diagonally dominant A, so that the single precision
+    // solve converges
+    rocblas_init_matrix(hA,
+                        arg,
+                        rocblas_client_never_set_nan,
+                        rocblas_client_diagonally_dominant_triangular_matrix,
+                        true);
+    rocblas_init_matrix(
+        hX, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
+    hB = hX;
+
+    //  make hA unit diagonal if diag == rocblas_diagonal_unit
+    if(diag == rocblas_diagonal_unit)
+    {
+        make_unit_diagonal(uplo, (T*)hA, lda, K);
+    }
+
+    // Calculate hB = hA*hX;
+    cblas_trmm<T>(side, uplo, transA, diag, M, N, T(1) / alpha_h, hA, lda, hB, ldb);
+
+    hXorB_1 = hB; // hXorB <- B
+    hXorB_2 = hB; // hXorB <- B
+    cpuXorB = hB; // cpuXorB <- B
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(hipMemcpy(alpha_d, &alpha_h, sizeof(T), hipMemcpyHostToDevice));
+
+    auto trsm_ex = [&](const T* alpha) {
+        return rocblas_trsm_ex(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               M,
+                               N,
+                               alpha,
+                               dA,
+                               lda,
+                               dXorB,
+                               ldb,
+                               nullptr,
+                               0,
+                               arg.compute_type);
+    };
+
+    // Device memory size queries include the memory of the refinement while it is enabled
+    size_t size_off, size_on;
+    CHECK_ROCBLAS_ERROR(rocblas_set_trsm_refinement(handle, 0));
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ALLOC_QUERY(trsm_ex(&alpha_h));
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size_off));
+    CHECK_ROCBLAS_ERROR(rocblas_set_trsm_refinement(handle, TRSM_REFINEMENT_STEPS));
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ALLOC_QUERY(trsm_ex(&alpha_h));
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size_on));
+    EXPECT_GT(size_on, size_off);
+
+    if(!ROCBLAS_REALLOC_ON_DEMAND)
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size_on));
+
+    double max_err_1 = 0.0;
+    double max_err_2 = 0.0;
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used  = 0.0;
+    double error_eps_multiplier    = ERROR_EPS_MULTIPLIER;
+    double residual_eps_multiplier = RESIDUAL_EPS_MULTIPLIER;
+    double eps                     = std::numeric_limits<real_t<T>>::epsilon();
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // calculate dXorB <- A^(-1) B   rocblas_device_pointer_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dXorB.transfer_from(hXorB_1));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(trsm_ex(&alpha_h));
+        handle.post_test(arg);
+        CHECK_HIP_ERROR(hXorB_1.transfer_from(dXorB));
+
+        // calculate dXorB <- A^(-1) B   rocblas_device_pointer_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(dXorB.transfer_from(hXorB_2));
+        CHECK_ROCBLAS_ERROR(trsm_ex(alpha_d));
+        CHECK_HIP_ERROR(hXorB_2.transfer_from(dXorB));
+
+        // The forward error E = hX - hXorB, in the vector-induced 1-norm, is that of double
+        // precision, far below the error of a single precision solve
+        max_err_1 = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hX, hXorB_1));
+        max_err_2 = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hX, hXorB_2));
+
+        trsm_err_res_check<T>(max_err_1, M, error_eps_multiplier, eps);
+        trsm_err_res_check<T>(max_err_2, M, error_eps_multiplier, eps);
+
+        // hXorB contains A * (calculated X), so res = A * (calculated x) - b = hXorB - hB
+        cblas_trmm<T>(side, uplo, transA, diag, M, N, T(1) / alpha_h, hA, lda, hXorB_1, ldb);
+        cblas_trmm<T>(side, uplo, transA, diag, M, N, T(1) / alpha_h, hA, lda, hXorB_2, ldb);
+
+        max_err_1 = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hXorB_1, hB));
+        max_err_2 = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hXorB_2, hB));
+
+        trsm_err_res_check<T>(max_err_1, M, residual_eps_multiplier, eps);
+        trsm_err_res_check<T>(max_err_2, M, residual_eps_multiplier, eps);
+    }
+
+    if(arg.timing)
+    {
+        // GPU rocBLAS, once, as the solve of its own result would drift towards values which do
+        // not fit in single precision
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dXorB.transfer_from(hB));
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        CHECK_ROCBLAS_ERROR(trsm_ex(&alpha_h));
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // CPU cblas
+        cpu_time_used = get_time_us_no_sync();
+        cblas_trsm<T>(side, uplo, transA, diag, M, N, alpha_h, hA, lda, cpuXorB, ldb);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        ArgumentModel<e_side, e_uplo, e_transA, e_diag, e_M, e_N, e_alpha, e_lda, e_ldb>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         trsm_gflop_count<T>(M, N, K),
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         max_err_1,
+                         max_err_2);
+    }
+}
@@ -87,6 +87,13 @@ constexpr double dot_gbyte_count(rocblas_int n)
     return (sizeof(T) * 2.0 * n) / 1e9;
 }
 
+/* \brief byte counts of MDOT, k vectors x against a single vector y */
+template <typename T>
+constexpr double mdot_gbyte_count(rocblas_int n, rocblas_int k)
+{
+    return (sizeof(T) * (k + 1.0) * n) / 1e9;
+}
+
 /* \brief byte counts of IAMAX AND IAMIN */
 template <typename T>
 constexpr double iamax_iamin_gbyte_count(rocblas_int n)
@@ -122,6 +129,30 @@ constexpr double rot_gbyte_count(rocblas_int n)
     return (sizeof(T) * 4.0 * n) / 1e9; //2 loads and 2 stores
 }
 
+/* \brief byte counts of ROT_SEQUENCE */
+template <typename T, typename Tc>
+constexpr double rot_sequence_gbyte_count(rocblas_int n, rocblas_int k)
+{
+    // x and y are loaded and stored once for all k rotations (c_j, s_j)
+    return (sizeof(T) * 4.0 * n + sizeof(Tc) * 2.0 * k) / 1e9;
+}
+
+/* \brief byte counts of ROT_SWEEP */
+template <typename T, typename Tc>
+constexpr double rot_sweep_gbyte_count(rocblas_int m, rocblas_int n)
+{
+    // each element of A is loaded and stored once for all n - 1 rotations
+    return (sizeof(T) * 2.0 * m * n + sizeof(Tc) * 2.0 * (n - 1)) / 1e9;
+}
+
+/* \brief byte counts of the sparse Level 1 functions AXPYI, DOTI, GTHR, SCTR and ROTI */
+template <typename T>
+constexpr double sparse_level1_gbyte_count(rocblas_int nnz, rocblas_int accesses)
+{
+    // each nonzero loads its index, and loads or stores accesses values of x_val and y
+    return ((sizeof(T) * double(accesses) + sizeof(rocblas_int)) * nnz) / 1e9;
+}
+
 /* \brief byte counts of ROTM */
 template <typename T>
 constexpr double rotm_gbyte_count(rocblas_int n, T flag)
@@ -175,6 +206,20 @@ constexpr double gemv_gbyte_count(rocblas_operation transA, rocblas_int m, rocbl
     return (sizeof(T) * (m * n + 2 * (transA == rocblas_operation_none ? n : m))) / 1e9;
 }
 
+/* \brief byte counts of GEMV_QUANTIZED_EX, with a_bits per element of A and an f16 scale and
+   zero point per group */
+template <typename Tx, typename Ty>
+constexpr double gemv_quantized_gbyte_count(rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int a_bits,
+                                            rocblas_int groups,
+                                            bool        has_zeros)
+{
+    return (double(m) * n * a_bits / 8 + 2.0 * groups * n * (has_zeros ? 2 : 1)
+            + sizeof(Tx) * double(m) + 2.0 * sizeof(Ty) * n)
+           / 1e9;
+}
+
 /* \brief byte counts of GER */
 template <typename T>
 constexpr double ger_gbyte_count(rocblas_int m, rocblas_int n)
@@ -182,6 +227,13 @@ constexpr double ger_gbyte_count(rocblas_int m, rocblas_int n)
     return (sizeof(T) * (m * n + m + n)) / 1e9;
 }
 
+/* \brief byte counts of GER_MULTI, which reads and writes A once for all k updates */
+template <typename T>
+constexpr double ger_multi_gbyte_count(rocblas_int m, rocblas_int n, rocblas_int k)
+{
+    return (sizeof(T) * (2.0 * m * n + double(k) * (m + n))) / 1e9;
+}
+
 /* \brief byte counts of HEMV */
 template <typename T>
 constexpr double hemv_gbyte_count(rocblas_int n)
@@ -321,6 +373,54 @@ constexpr double tpsv_gbyte_count(rocblas_int n)
  * ===========================================================================
  */
 
+/* \brief byte counts of GEMM, reading A, B and C once and writing D */
+template <typename Ti, typename To = Ti>
+constexpr double gemm_gbyte_count(rocblas_int m, rocblas_int n, rocblas_int k)
+{
+    return (sizeof(Ti) * (double(m) * k + double(k) * n) + sizeof(To) * 2.0 * m * n) / 1e9;
+}
+
+/* \brief byte counts of GEMM_CHAIN_EX, reading A, B, D, the bias and E once and writing E, with
+   the intermediate T kept on chip */
+template <typename T>
+constexpr double gemm_chain_gbyte_count(rocblas_int m, rocblas_int n, rocblas_int k, rocblas_int l)
+{
+    return (sizeof(T) * (double(m) * k + double(k) * n + double(n) * l + m + 2.0 * m * l)) / 1e9;
+}
+
+/* \brief byte counts of GEMM_EX of a real A of T by a complex B, C and D, reading A, B and C once
+   and writing D */
+template <typename T>
+constexpr double gemm_real_complex_gbyte_count(rocblas_int m, rocblas_int n, rocblas_int k)
+{
+    return (sizeof(T) * (double(m) * k + 2.0 * k * n + 4.0 * m * n)) / 1e9;
+}
+
+/* \brief byte counts of GEMM_BLOCK_SPARSE_EX, reading the nnzb blocks of A, the block_dim rows of
+   B of each block and C once, and writing D */
+template <typename T>
+constexpr double gemm_block_sparse_gbyte_count(rocblas_int nnzb,
+                                               rocblas_int block_dim,
+                                               rocblas_int m,
+                                               rocblas_int n)
+{
+    return (sizeof(T) * (double(nnzb) * block_dim * (block_dim + n) + 2.0 * m * n)) / 1e9;
+}
+
+/* \brief byte counts of IMATCOPY and OMATCOPY_EX, reading A of Ta and writing op(A) of Tb */
+template <typename Ta, typename Tb = Ta>
+constexpr double matcopy_gbyte_count(rocblas_int m, rocblas_int n)
+{
+    return ((sizeof(Ta) + sizeof(Tb)) * double(m) * n) / 1e9;
+}
+
+/* \brief byte counts of GEAM_MULTI, reading each of the count operands once and writing C */
+template <typename T>
+constexpr double geam_multi_gbyte_count(rocblas_int m, rocblas_int n, rocblas_int count)
+{
+    return (sizeof(T) * (count + 1.0) * m * n) / 1e9;
+}
+
 /* \brief byte counts of SYRK */
 template <typename T>
 constexpr double syrk_gbyte_count(rocblas_int n, rocblas_int k)
@@ -28,6 +28,7 @@
 #include "rocblas.h"
 #include "rocblas.hpp"
 #include <type_traits>
+#include <vector>
 
 /*
  * ===========================================================================
@@ -139,6 +140,24 @@ inline void cblas_axpy(rocblas_int             n,
     cblas_zaxpy(n, &alpha, x, incx, y, incy);
 }
 
+// axpby_ex
+// y := alpha * x + beta * y computed in Tex, y is not read when beta is zero (copy_scal_ex)
+template <typename Ta, typename Tx, typename Ty, typename Tex>
+void cblas_axpby_ex(
+    rocblas_int n, Ta alpha, const Tx* x, rocblas_int incx, Ta beta, Ty* y, rocblas_int incy)
+{
+    ptrdiff_t ix = incx < 0 ? ptrdiff_t(incx) * (1 - n) : 0;
+    ptrdiff_t iy = incy < 0 ? ptrdiff_t(incy) * (1 - n) : 0;
+
+    for(rocblas_int i = 0; i < n; i++, ix += incx, iy += incy)
+    {
+        Tex value = Tex(alpha) * Tex(x[ix]);
+        if(Tex(beta) != Tex(0))
+            value += Tex(beta) * Tex(y[iy]);
+        y[iy] = Ty(value);
+    }
+}
+
 // copy
 template <typename T>
 void cblas_copy(rocblas_int n, T* x, rocblas_int incx, T* y, rocblas_int incy);
@@ -723,6 +742,41 @@ inline void cblas_gemv(rocblas_operation       transA,
         CblasColMajor, CBLAS_TRANSPOSE(transA), m, n, &alpha, A, lda, x, incx, &beta, y, incy);
 }
 
+// gemv_ex
+// cblas does not support the mixed types, so A, x and y are converted to the compute type
+template <typename Ti, typename To, typename Tc>
+void cblas_gemv_ex(rocblas_operation transA,
+                   rocblas_int       m,
+                   rocblas_int       n,
+                   Tc                alpha,
+                   const Ti*         A,
+                   rocblas_int       lda,
+                   const Ti*         x,
+                   rocblas_int       incx,
+                   Tc                beta,
+                   To*               y,
+                   rocblas_int       incy)
+{
+    size_t dim_x  = transA == rocblas_operation_none ? n : m;
+    size_t dim_y  = transA == rocblas_operation_none ? m : n;
+    size_t size_a = size_t(lda) * n;
+    size_t size_x = dim_x * (incx >= 0 ? incx : -incx);
+    size_t size_y = dim_y * (incy >= 0 ? incy : -incy);
+
+    std::vector<Tc> A_c(size_a), x_c(size_x), y_c(size_y);
+    for(size_t i = 0; i < size_a; i++)
+        A_c[i] = static_cast<Tc>(A[i]);
+    for(size_t i = 0; i < size_x; i++)
+        x_c[i] = static_cast<Tc>(x[i]);
+    for(size_t i = 0; i < size_y; i++)
+        y_c[i] = static_cast<Tc>(y[i]);
+
+    cblas_gemv<Tc>(transA, m, n, alpha, A_c.data(), lda, x_c.data(), incx, beta, y_c.data(), incy);
+
+    for(size_t i = 0; i < size_y; i++)
+        y[i] = static_cast<To>(y_c[i]);
+}
+
 // tbmv
 template <typename T>
 void cblas_tbmv(rocblas_fill      uplo,
@@ -1245,6 +1299,33 @@ inline void cblas_trmv(rocblas_fill                  uplo,
                 incx);
 }
 
+// trmv_ex
+// cblas does not support the mixed types, so A and x are converted to the compute type
+template <typename T, typename Tc>
+void cblas_trmv_ex(rocblas_fill      uplo,
+                   rocblas_operation transA,
+                   rocblas_diagonal  diag,
+                   rocblas_int       m,
+                   const T*          A,
+                   rocblas_int       lda,
+                   T*                x,
+                   rocblas_int       incx)
+{
+    size_t size_a = size_t(lda) * m;
+    size_t size_x = m * size_t(incx >= 0 ? incx : -incx);
+
+    std::vector<Tc> A_c(size_a), x_c(size_x);
+    for(size_t i = 0; i < size_a; i++)
+        A_c[i] = static_cast<Tc>(A[i]);
+    for(size_t i = 0; i < size_x; i++)
+        x_c[i] = static_cast<Tc>(x[i]);
+
+    cblas_trmv<Tc>(uplo, transA, diag, m, A_c.data(), lda, x_c.data(), incx);
+
+    for(size_t i = 0; i < size_x; i++)
+        x[i] = static_cast<T>(x_c[i]);
+}
+
 // sbmv
 template <typename T>
 void cblas_sbmv(rocblas_fill uplo,
@@ -1443,6 +1524,38 @@ inline void cblas_spr(rocblas_fill            uplo,
     lapack_xspr(uplo, n, alpha, x, incx, A);
 }
 
+// symv_ex
+// cblas does not support the mixed types, so A, x and y are converted to the compute type
+template <typename Ti, typename To, typename Tc>
+void cblas_symv_ex(rocblas_fill uplo,
+                   rocblas_int  n,
+                   Tc           alpha,
+                   const Ti*    A,
+                   rocblas_int  lda,
+                   const Ti*    x,
+                   rocblas_int  incx,
+                   Tc           beta,
+                   To*          y,
+                   rocblas_int  incy)
+{
+    size_t size_a = size_t(lda) * n;
+    size_t size_x = n * size_t(incx >= 0 ? incx : -incx);
+    size_t size_y = n * size_t(incy >= 0 ? incy : -incy);
+
+    std::vector<Tc> A_c(size_a), x_c(size_x), y_c(size_y);
+    for(size_t i = 0; i < size_a; i++)
+        A_c[i] = static_cast<Tc>(A[i]);
+    for(size_t i = 0; i < size_x; i++)
+        x_c[i] = static_cast<Tc>(x[i]);
+    for(size_t i = 0; i < size_y; i++)
+        y_c[i] = static_cast<Tc>(y[i]);
+
+    cblas_symv<Tc>(uplo, n, alpha, A_c.data(), lda, x_c.data(), incx, beta, y_c.data(), incy);
+
+    for(size_t i = 0; i < size_y; i++)
+        y[i] = static_cast<To>(y_c[i]);
+}
+
 // spr2
 template <typename T>
 void cblas_spr2(rocblas_fill uplo,
@@ -1576,6 +1689,37 @@ inline void cblas_ger<rocblas_double_complex, true>(rocblas_int             m,
     cblas_zgerc(CblasColMajor, m, n, &alpha, x, incx, y, incy, A, lda);
 }
 
+// ger_ex
+// cblas does not support the mixed types, so x, y and A are converted to the compute type
+template <typename T, typename Tc>
+void cblas_ger_ex(rocblas_int m,
+                  rocblas_int n,
+                  Tc          alpha,
+                  const T*    x,
+                  rocblas_int incx,
+                  const T*    y,
+                  rocblas_int incy,
+                  T*          A,
+                  rocblas_int lda)
+{
+    size_t size_a = size_t(lda) * n;
+    size_t size_x = m * size_t(incx >= 0 ? incx : -incx);
+    size_t size_y = n * size_t(incy >= 0 ? incy : -incy);
+
+    std::vector<Tc> A_c(size_a), x_c(size_x), y_c(size_y);
+    for(size_t i = 0; i < size_a; i++)
+        A_c[i] = static_cast<Tc>(A[i]);
+    for(size_t i = 0; i < size_x; i++)
+        x_c[i] = static_cast<Tc>(x[i]);
+    for(size_t i = 0; i < size_y; i++)
+        y_c[i] = static_cast<Tc>(y[i]);
+
+    cblas_ger<Tc, false>(m, n, alpha, x_c.data(), incx, y_c.data(), incy, A_c.data(), lda);
+
+    for(size_t i = 0; i < size_a; i++)
+        A[i] = static_cast<T>(A_c[i]);
+}
+
 // syr
 template <typename T>
 inline void cblas_syr(
@@ -1697,6 +1841,37 @@ inline void cblas_syr2(rocblas_fill            uplo,
     lapack_xsyr2(uplo, n, alpha, x, incx, y, incy, A, lda);
 }
 
+// syr2_ex
+// cblas does not support the mixed types, so x, y and A are converted to the compute type
+template <typename T, typename Tc>
+void cblas_syr2_ex(rocblas_fill uplo,
+                   rocblas_int  n,
+                   Tc           alpha,
+                   const T*     x,
+                   rocblas_int  incx,
+                   const T*     y,
+                   rocblas_int  incy,
+                   T*           A,
+                   rocblas_int  lda)
+{
+    size_t size_a = size_t(lda) * n;
+    size_t size_x = n * size_t(incx >= 0 ? incx : -incx);
+    size_t size_y = n * size_t(incy >= 0 ? incy : -incy);
+
+    std::vector<Tc> A_c(size_a), x_c(size_x), y_c(size_y);
+    for(size_t i = 0; i < size_a; i++)
+        A_c[i] = static_cast<Tc>(A[i]);
+    for(size_t i = 0; i < size_x; i++)
+        x_c[i] = static_cast<Tc>(x[i]);
+    for(size_t i = 0; i < size_y; i++)
+        y_c[i] = static_cast<Tc>(y[i]);
+
+    cblas_syr2<Tc>(uplo, n, alpha, x_c.data(), incx, y_c.data(), incy, A_c.data(), lda);
+
+    for(size_t i = 0; i < size_a; i++)
+        A[i] = static_cast<T>(A_c[i]);
+}
+
 // hbmv
 template <typename T>
 void cblas_hbmv(rocblas_fill uplo,
@@ -2797,6 +2972,40 @@ void cblas_geam_plus_min(rocblas_operation transA,
                          T*                D,
                          rocblas_int       ldd);
 
+template <typename T>
+void cblas_geam_max_plus(rocblas_operation transA,
+                         rocblas_operation transB,
+                         rocblas_int       m,
+                         rocblas_int       n,
+                         rocblas_int       k,
+                         const T           alpha,
+                         const T*          A,
+                         rocblas_int       lda,
+                         const T*          B,
+                         rocblas_int       ldb,
+                         const T           beta,
+                         const T*          C,
+                         rocblas_int       ldc,
+                         T*                D,
+                         rocblas_int       ldd);
+
+template <typename T>
+void cblas_geam_max_min(rocblas_operation transA,
+                        rocblas_operation transB,
+                        rocblas_int       m,
+                        rocblas_int       n,
+                        rocblas_int       k,
+                        const T           alpha,
+                        const T*          A,
+                        rocblas_int       lda,
+                        const T*          B,
+                        rocblas_int       ldb,
+                        const T           beta,
+                        const T*          C,
+                        rocblas_int       ldc,
+                        T*                D,
+                        rocblas_int       ldd);
+
 // cblas_herkx doesn't exist. implementation in cpp
 template <typename T, typename U = real_t<T>>
 void cblas_herkx(rocblas_fill      uplo,
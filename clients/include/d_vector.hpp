@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "host_alloc.hpp"
 #include "rocblas.h"
 #include "rocblas_test.hpp"
 #include "singletons.hpp"
@@ -88,7 +89,8 @@ public:
     T* device_vector_setup()
     {
         T* d = nullptr;
-        if(use_HMM ? hipMallocManaged(&d, m_bytes) : (hipMalloc)(&d, m_bytes) != hipSuccess)
+        if(use_HMM ? hipMallocManaged(&d, m_bytes)
+                   : device_buffer_malloc((void**)&d, m_bytes) != hipSuccess)
         {
             rocblas_cerr << "Warning: hip can't allocate " << m_bytes << " bytes ("
                          << (m_bytes >> 30) << " GB)" << std::endl;
@@ -153,7 +155,7 @@ public:
                 d -= m_pad; // restore to start of alloc
 
             // Free device memory
-            CHECK_HIP_ERROR((hipFree)(d));
+            CHECK_HIP_ERROR(use_HMM ? (hipFree)(d) : device_buffer_free(d));
         }
     }
 };
@@ -200,9 +200,8 @@ public:
         hipMemcpyKind kind = this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice;
         if(m_batch_count > 0)
         {
-            if(hipSuccess
-               != (hip_err
-                   = hipMemcpy((*this)[0], that[0], sizeof(T) * m_nmemb * m_batch_count, kind)))
+            size_t num_bytes = sizeof(T) * m_nmemb * m_batch_count;
+            if(hipSuccess != (hip_err = host_transfer_memcpy((*this)[0], that[0], num_bytes, kind)))
             {
                 return hip_err;
             }
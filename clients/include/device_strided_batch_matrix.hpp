@@ -199,10 +199,10 @@ public:
     //!
     hipError_t transfer_from(const host_strided_batch_matrix<T>& that)
     {
-        return hipMemcpy(this->data(),
-                         that.data(),
-                         sizeof(T) * this->nmemb(),
-                         this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
+        return host_transfer_memcpy(this->data(),
+                                    that.data(),
+                                    sizeof(T) * this->nmemb(),
+                                    this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
     }
 
     //!
@@ -181,10 +181,10 @@ public:
     //!
     hipError_t transfer_from(const host_strided_batch_vector<T>& that)
     {
-        return hipMemcpy(this->data(),
-                         that.data(),
-                         sizeof(T) * this->nmemb(),
-                         this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
+        return host_transfer_memcpy(this->data(),
+                                    that.data(),
+                                    sizeof(T) * this->nmemb(),
+                                    this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
     }
 
     //!
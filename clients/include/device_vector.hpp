@@ -126,10 +126,10 @@ public:
     //!
     hipError_t transfer_from(const host_vector<T>& that)
     {
-        return hipMemcpy(m_data,
-                         (const T*)that,
-                         this->nmemb() * sizeof(T),
-                         this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
+        return host_transfer_memcpy(m_data,
+                                    (const T*)that,
+                                    this->nmemb() * sizeof(T),
+                                    this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
     }
 
     hipError_t memcheck() const
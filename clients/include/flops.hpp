@@ -76,6 +76,23 @@ constexpr double axpy_gflop_count<rocblas_double_complex>(rocblas_int n)
     return (8.0 * n) / 1e9;
 }
 
+// axpby
+template <typename T>
+constexpr double axpby_gflop_count(rocblas_int n)
+{
+    return (3.0 * n) / 1e9;
+}
+template <>
+constexpr double axpby_gflop_count<rocblas_float_complex>(rocblas_int n)
+{
+    return (14.0 * n) / 1e9; // 6 for each of the 2 c-c multiplies, 2 for c-c add
+}
+template <>
+constexpr double axpby_gflop_count<rocblas_double_complex>(rocblas_int n)
+{
+    return (14.0 * n) / 1e9;
+}
+
 // dot
 template <bool CONJ, typename T>
 constexpr double dot_gflop_count(rocblas_int n)
@@ -574,6 +591,27 @@ constexpr double geam_gflop_count<rocblas_double_complex>(rocblas_int m, rocblas
     return (14.0 * m * n) / 1e9;
 }
 
+/* \brief floating point counts of GEAM_MULTI, scaling each of the count operands and summing */
+template <typename T>
+constexpr double geam_multi_gflop_count(rocblas_int m, rocblas_int n, rocblas_int count)
+{
+    return ((2.0 * count - 1) * m * n) / 1e9;
+}
+
+template <>
+constexpr double
+    geam_multi_gflop_count<rocblas_float_complex>(rocblas_int m, rocblas_int n, rocblas_int count)
+{
+    return ((8.0 * count - 2) * m * n) / 1e9;
+}
+
+template <>
+constexpr double
+    geam_multi_gflop_count<rocblas_double_complex>(rocblas_int m, rocblas_int n, rocblas_int count)
+{
+    return geam_multi_gflop_count<rocblas_float_complex>(m, n, count);
+}
+
 /* \brief floating point counts of DGMM */
 template <typename T>
 constexpr double dgmm_gflop_count(rocblas_int m, rocblas_int n)
@@ -22,6 +22,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdlib>
+#include <hip/hip_runtime_api.h>
+#include <new>
+
 //!
 //! @brief Host free memory w/o swap.  Returns kB or -1 if unknown.
 //!
@@ -100,3 +105,67 @@ constexpr bool operator!=(const host_memory_allocator<T>&, const host_memory_all
 {
     return false;
 }
+
+//!
+//! @brief Sets whether the transfers of the client host and device containers are staged through
+//!        two pinned host buffers, false by default. Set before the containers are used.
+//!
+void host_set_pinned_transfers(bool pinned);
+bool host_get_pinned_transfers();
+
+//!
+//! @brief Copies bytes between host and device memory as hipMemcpy, the transfer_from of the
+//!        client containers. With pinned transfers set, host to device and device to host copies
+//!        are split into chunks moved through two pinned host buffers, so that the host copy of
+//!        each chunk overlaps the asynchronous transfer of the other. The time and bytes of the
+//!        copy are added to the transfer time of the next benchmark line when it is logged.
+//!
+hipError_t host_transfer_memcpy(void* dst, const void* src, size_t bytes, hipMemcpyKind kind);
+
+//!
+//! @brief Pins existing host memory with hipHostRegister for the lifetime of the object when
+//!        pinned transfers are set, so that library transfers of that memory run at pinned
+//!        bandwidth.
+//!
+class host_pinned_registration
+{
+    void* m_ptr = nullptr;
+
+public:
+    host_pinned_registration(void* ptr, size_t bytes)
+    {
+        if(host_get_pinned_transfers() && ptr && bytes
+           && hipHostRegister(ptr, bytes, hipHostRegisterDefault) == hipSuccess)
+            m_ptr = ptr;
+    }
+
+    ~host_pinned_registration()
+    {
+        if(m_ptr)
+            (void)hipHostUnregister(m_ptr);
+    }
+
+    host_pinned_registration(const host_pinned_registration&) = delete;
+    host_pinned_registration& operator=(const host_pinned_registration&) = delete;
+};
+
+//!
+//! @brief Sets whether the device buffers of the client containers are kept when freed and reused
+//!        by later allocations of the same thread which fit in them, false by default. Used by
+//!        rocblas-bench sweeps, which allocate the largest problem first so that the smaller ones
+//!        reuse its buffers. A request which fits in no kept buffer frees them all first.
+//!
+void device_set_buffer_reuse(bool reuse);
+bool device_get_buffer_reuse();
+
+//!
+//! @brief Allocates and frees device memory as hipMalloc and hipFree, through the kept buffers of
+//!        the calling thread when buffer reuse is set.
+//!
+hipError_t device_buffer_malloc(void** ptr, size_t bytes);
+hipError_t device_buffer_free(void* ptr);
+
+//!
+//! @brief Frees the kept device buffers of the calling thread.
+//!
+void device_buffer_release();
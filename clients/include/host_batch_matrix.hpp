@@ -187,7 +187,7 @@ public:
 
         if(m_batch_count > 0)
         {
-            if(hipSuccess != (hip_err = hipMemcpy((*this)[0], that[0], num_bytes, kind)))
+            if(hipSuccess != (hip_err = host_transfer_memcpy((*this)[0], that[0], num_bytes, kind)))
             {
                 return hip_err;
             }
@@ -222,10 +222,10 @@ public:
         if(that.use_HMM && hipSuccess != (hip_err = hipDeviceSynchronize()))
             return hip_err;
 
-        return hipMemcpy(this->m_data,
-                         that.data(),
-                         sizeof(T) * this->m_nmemb,
-                         that.use_HMM ? hipMemcpyHostToHost : hipMemcpyDeviceToHost);
+        return host_transfer_memcpy(this->m_data,
+                                    that.data(),
+                                    sizeof(T) * this->m_nmemb,
+                                    that.use_HMM ? hipMemcpyHostToHost : hipMemcpyDeviceToHost);
     }
 
     //!
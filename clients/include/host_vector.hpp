@@ -89,10 +89,10 @@ struct host_vector : std::vector<T, host_memory_allocator<T>>
         if(that.use_HMM && hipSuccess != (hip_err = hipDeviceSynchronize()))
             return hip_err;
 
-        return hipMemcpy(*this,
-                         that,
-                         sizeof(T) * this->size(),
-                         that.use_HMM ? hipMemcpyHostToHost : hipMemcpyDeviceToHost);
+        return host_transfer_memcpy(*this,
+                                    that,
+                                    sizeof(T) * this->size(),
+                                    that.use_HMM ? hipMemcpyHostToHost : hipMemcpyDeviceToHost);
     }
 
     //!
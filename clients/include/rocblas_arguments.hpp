@@ -51,6 +51,9 @@ struct Arguments
     char category[64];
     char known_bug_platforms[64];
 
+    // architecture of the thresholds of the perf category
+    char perf_arch[64];
+
     // 64bit
 
     double alpha;
@@ -58,6 +61,11 @@ struct Arguments
     double beta;
     double betai;
 
+    // minimum percentage of the roofline expected in the perf category, and the fraction of it
+    // below which the test fails
+    double perf_min_percent;
+    double perf_tolerance;
+
     rocblas_stride stride_a; //  stride_a > transA == 'N' ? lda * K : lda * M
     rocblas_stride stride_b; //  stride_b > transB == 'N' ? ldb * N : ldb * K
     rocblas_stride stride_c; //  stride_c > ldc * N
@@ -120,6 +128,10 @@ struct Arguments
     // bytes
     uint8_t devices;
 
+    // device and stream of the problem in concurrent benchmarks
+    uint8_t device_id;
+    uint8_t stream_id;
+
     int8_t norm_check;
     int8_t unit_check;
     int8_t timing;
@@ -151,10 +163,13 @@ struct Arguments
     OPER(name) SEP                   \
     OPER(category) SEP               \
     OPER(known_bug_platforms) SEP    \
+    OPER(perf_arch) SEP              \
     OPER(alpha) SEP                  \
     OPER(alphai) SEP                 \
     OPER(beta) SEP                   \
     OPER(betai) SEP                  \
+    OPER(perf_min_percent) SEP       \
+    OPER(perf_tolerance) SEP         \
     OPER(stride_a) SEP               \
     OPER(stride_b) SEP               \
     OPER(stride_c) SEP               \
@@ -194,6 +209,8 @@ struct Arguments
     OPER(threads) SEP                \
     OPER(streams) SEP                \
     OPER(devices) SEP                \
+    OPER(device_id) SEP              \
+    OPER(stream_id) SEP              \
     OPER(norm_check) SEP             \
     OPER(unit_check) SEP             \
     OPER(timing) SEP                 \
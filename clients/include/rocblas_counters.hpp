@@ -0,0 +1,67 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <hip/hip_runtime_api.h>
+#include <map>
+#include <string>
+#include <vector>
+
+/* ============================================================================================ */
+/*  Hardware counters of the kernels of the benchmarks, collected through the rocprofiler SDK
+    when rocblas-bench is built with BUILD_CLIENTS_WITH_ROCPROFILER */
+
+/*! \brief  Counters of the dispatches of one kernel during a collection */
+struct rocblas_kernel_counters
+{
+    // kernel name, without its parameters and template arguments
+    std::string kernel;
+    size_t      dispatches = 0;
+
+    // total duration of the dispatches, and sums of the counters over them by counter name
+    double                        us = 0;
+    std::map<std::string, double> values;
+};
+
+/*! \brief  Counters collected when --counters is given without a list: the bytes read and
+            written by the kernels, VALU and MFMA utilization, L2 hit rate, LDS bank conflicts and
+            occupancy */
+constexpr char rocblas_default_counters[]
+    = "FETCH_SIZE,WRITE_SIZE,VALUUtilization,MfmaUtil,L2CacheHit,LDSBankConflict,"
+      "MeanOccupancyPerCU";
+
+/*! \brief  Whether this executable can collect hardware counters */
+bool rocblas_counters_available();
+
+/*! \brief  Comma separated names of the counters collected in the hot calls of the benchmarks,
+            empty to disable the collection */
+void                            rocblas_set_counters(const std::string& counters);
+const std::vector<std::string>& rocblas_get_counters();
+
+/*! \brief  Run func calls times on stream, collecting the counters of its kernels. Returns the
+            counters of each kernel in the order of their first dispatch, or no kernels if the
+            counters are not available */
+std::vector<rocblas_kernel_counters>
+    rocblas_collect_counters(hipStream_t stream, int calls, const std::function<void()>& func);
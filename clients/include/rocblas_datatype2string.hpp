@@ -136,6 +136,10 @@ constexpr auto rocblas_datatype2string(rocblas_datatype type)
         return "bf16_r";
     case rocblas_datatype_bf16_c:
         return "bf16_c";
+    case rocblas_datatype_f8_r:
+        return "f8_r";
+    case rocblas_datatype_bf8_r:
+        return "bf8_r";
     case rocblas_datatype_invalid:
         return "invalid";
     }
@@ -170,6 +174,24 @@ constexpr auto rocblas_arithmetic_check2string(rocblas_arithmetic_check check)
     return "invalid";
 }
 
+constexpr auto rocblas_performance_metric2string(rocblas_performance_metric metric)
+{
+    switch(metric)
+    {
+    case rocblas_default_performance_metric:
+        return "default";
+    case rocblas_device_efficiency_performance_metric:
+        return "device_efficiency";
+    case rocblas_cu_efficiency_performance_metric:
+        return "cu_efficiency";
+    case rocblas_latency_performance_metric:
+        return "latency";
+    case rocblas_energy_efficiency_performance_metric:
+        return "energy_efficiency";
+    }
+    return "invalid";
+}
+
 inline rocblas_internal_ostream& operator<<(rocblas_internal_ostream& os,
                                             rocblas_initialization    init)
 {
@@ -333,6 +355,8 @@ inline rocblas_datatype string2rocblas_datatype(const std::string& value)
         value == "u32_r"                 ? rocblas_datatype_u32_r  :
         value == "u8_c"                  ? rocblas_datatype_u8_c   :
         value == "u32_c"                 ? rocblas_datatype_u32_c  :
+        value == "f8_r"                  ? rocblas_datatype_f8_r   :
+        value == "bf8_r"                 ? rocblas_datatype_bf8_r  :
         rocblas_datatype_invalid;
 }
 // clang-format on
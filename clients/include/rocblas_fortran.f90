@@ -13108,4 +13108,530 @@ contains
                 invA, invA_size, stride_invA, compute_type)
     end function rocblas_trsm_strided_batched_ex_fortran
 
+    !-----------------!
+    ! rocblas-beta.h  !
+    !-----------------!
+
+    function rocblas_set_pointer_array_fortran(handle, elem_size, base, stride, batch_count, &
+                                               ptr_array) &
+        bind(c, name='rocblas_set_pointer_array_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_set_pointer_array_fortran
+        type(c_ptr), value :: handle
+        integer(c_int), value :: elem_size
+        type(c_ptr), value :: base
+        integer(c_int64_t), value :: stride
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: ptr_array
+        rocblas_set_pointer_array_fortran = &
+            rocblas_set_pointer_array(handle, elem_size, base, stride, batch_count, ptr_array)
+        return
+    end function rocblas_set_pointer_array_fortran
+
+    function rocblas_saxpy_64_fortran(handle, n, alpha, x, incx, y, incy) &
+        bind(c, name='rocblas_saxpy_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_saxpy_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        rocblas_saxpy_64_fortran = &
+            rocblas_saxpy_64(handle, n, alpha, x, incx, y, incy)
+        return
+    end function rocblas_saxpy_64_fortran
+
+    function rocblas_sgemv_64_fortran(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy) &
+        bind(c, name='rocblas_sgemv_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_sgemv_64_fortran
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(c_int64_t), value :: m
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int64_t), value :: lda
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        rocblas_sgemv_64_fortran = &
+            rocblas_sgemv_64(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy)
+        return
+    end function rocblas_sgemv_64_fortran
+
+    function rocblas_sscal_64_fortran(handle, n, alpha, x, incx) &
+        bind(c, name='rocblas_sscal_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_sscal_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        rocblas_sscal_64_fortran = &
+            rocblas_sscal_64(handle, n, alpha, x, incx)
+        return
+    end function rocblas_sscal_64_fortran
+
+    function rocblas_dscal_64_fortran(handle, n, alpha, x, incx) &
+        bind(c, name='rocblas_dscal_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_dscal_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        rocblas_dscal_64_fortran = &
+            rocblas_dscal_64(handle, n, alpha, x, incx)
+        return
+    end function rocblas_dscal_64_fortran
+
+    function rocblas_cscal_64_fortran(handle, n, alpha, x, incx) &
+        bind(c, name='rocblas_cscal_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_cscal_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        rocblas_cscal_64_fortran = &
+            rocblas_cscal_64(handle, n, alpha, x, incx)
+        return
+    end function rocblas_cscal_64_fortran
+
+    function rocblas_zscal_64_fortran(handle, n, alpha, x, incx) &
+        bind(c, name='rocblas_zscal_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_zscal_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        rocblas_zscal_64_fortran = &
+            rocblas_zscal_64(handle, n, alpha, x, incx)
+        return
+    end function rocblas_zscal_64_fortran
+
+    function rocblas_csscal_64_fortran(handle, n, alpha, x, incx) &
+        bind(c, name='rocblas_csscal_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_csscal_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        rocblas_csscal_64_fortran = &
+            rocblas_csscal_64(handle, n, alpha, x, incx)
+        return
+    end function rocblas_csscal_64_fortran
+
+    function rocblas_zdscal_64_fortran(handle, n, alpha, x, incx) &
+        bind(c, name='rocblas_zdscal_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_zdscal_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        rocblas_zdscal_64_fortran = &
+            rocblas_zdscal_64(handle, n, alpha, x, incx)
+        return
+    end function rocblas_zdscal_64_fortran
+
+    function rocblas_scopy_64_fortran(handle, n, x, incx, y, incy) &
+        bind(c, name='rocblas_scopy_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_scopy_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        rocblas_scopy_64_fortran = &
+            rocblas_scopy_64(handle, n, x, incx, y, incy)
+        return
+    end function rocblas_scopy_64_fortran
+
+    function rocblas_dcopy_64_fortran(handle, n, x, incx, y, incy) &
+        bind(c, name='rocblas_dcopy_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_dcopy_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        rocblas_dcopy_64_fortran = &
+            rocblas_dcopy_64(handle, n, x, incx, y, incy)
+        return
+    end function rocblas_dcopy_64_fortran
+
+    function rocblas_ccopy_64_fortran(handle, n, x, incx, y, incy) &
+        bind(c, name='rocblas_ccopy_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_ccopy_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        rocblas_ccopy_64_fortran = &
+            rocblas_ccopy_64(handle, n, x, incx, y, incy)
+        return
+    end function rocblas_ccopy_64_fortran
+
+    function rocblas_zcopy_64_fortran(handle, n, x, incx, y, incy) &
+        bind(c, name='rocblas_zcopy_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_zcopy_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        rocblas_zcopy_64_fortran = &
+            rocblas_zcopy_64(handle, n, x, incx, y, incy)
+        return
+    end function rocblas_zcopy_64_fortran
+
+    function rocblas_sswap_64_fortran(handle, n, x, incx, y, incy) &
+        bind(c, name='rocblas_sswap_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_sswap_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        rocblas_sswap_64_fortran = &
+            rocblas_sswap_64(handle, n, x, incx, y, incy)
+        return
+    end function rocblas_sswap_64_fortran
+
+    function rocblas_dswap_64_fortran(handle, n, x, incx, y, incy) &
+        bind(c, name='rocblas_dswap_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_dswap_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        rocblas_dswap_64_fortran = &
+            rocblas_dswap_64(handle, n, x, incx, y, incy)
+        return
+    end function rocblas_dswap_64_fortran
+
+    function rocblas_cswap_64_fortran(handle, n, x, incx, y, incy) &
+        bind(c, name='rocblas_cswap_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_cswap_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        rocblas_cswap_64_fortran = &
+            rocblas_cswap_64(handle, n, x, incx, y, incy)
+        return
+    end function rocblas_cswap_64_fortran
+
+    function rocblas_zswap_64_fortran(handle, n, x, incx, y, incy) &
+        bind(c, name='rocblas_zswap_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_zswap_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        rocblas_zswap_64_fortran = &
+            rocblas_zswap_64(handle, n, x, incx, y, incy)
+        return
+    end function rocblas_zswap_64_fortran
+
+    function rocblas_sdot_64_fortran(handle, n, x, incx, y, incy, result) &
+        bind(c, name='rocblas_sdot_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_sdot_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        type(c_ptr), value :: result
+        rocblas_sdot_64_fortran = &
+            rocblas_sdot_64(handle, n, x, incx, y, incy, result)
+        return
+    end function rocblas_sdot_64_fortran
+
+    function rocblas_ddot_64_fortran(handle, n, x, incx, y, incy, result) &
+        bind(c, name='rocblas_ddot_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_ddot_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        type(c_ptr), value :: result
+        rocblas_ddot_64_fortran = &
+            rocblas_ddot_64(handle, n, x, incx, y, incy, result)
+        return
+    end function rocblas_ddot_64_fortran
+
+    function rocblas_cdotu_64_fortran(handle, n, x, incx, y, incy, result) &
+        bind(c, name='rocblas_cdotu_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_cdotu_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        type(c_ptr), value :: result
+        rocblas_cdotu_64_fortran = &
+            rocblas_cdotu_64(handle, n, x, incx, y, incy, result)
+        return
+    end function rocblas_cdotu_64_fortran
+
+    function rocblas_zdotu_64_fortran(handle, n, x, incx, y, incy, result) &
+        bind(c, name='rocblas_zdotu_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_zdotu_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        type(c_ptr), value :: result
+        rocblas_zdotu_64_fortran = &
+            rocblas_zdotu_64(handle, n, x, incx, y, incy, result)
+        return
+    end function rocblas_zdotu_64_fortran
+
+    function rocblas_cdotc_64_fortran(handle, n, x, incx, y, incy, result) &
+        bind(c, name='rocblas_cdotc_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_cdotc_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        type(c_ptr), value :: result
+        rocblas_cdotc_64_fortran = &
+            rocblas_cdotc_64(handle, n, x, incx, y, incy, result)
+        return
+    end function rocblas_cdotc_64_fortran
+
+    function rocblas_zdotc_64_fortran(handle, n, x, incx, y, incy, result) &
+        bind(c, name='rocblas_zdotc_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_zdotc_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        type(c_ptr), value :: result
+        rocblas_zdotc_64_fortran = &
+            rocblas_zdotc_64(handle, n, x, incx, y, incy, result)
+        return
+    end function rocblas_zdotc_64_fortran
+
+    function rocblas_daxpy_64_fortran(handle, n, alpha, x, incx, y, incy) &
+        bind(c, name='rocblas_daxpy_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_daxpy_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        rocblas_daxpy_64_fortran = &
+            rocblas_daxpy_64(handle, n, alpha, x, incx, y, incy)
+        return
+    end function rocblas_daxpy_64_fortran
+
+    function rocblas_caxpy_64_fortran(handle, n, alpha, x, incx, y, incy) &
+        bind(c, name='rocblas_caxpy_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_caxpy_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        rocblas_caxpy_64_fortran = &
+            rocblas_caxpy_64(handle, n, alpha, x, incx, y, incy)
+        return
+    end function rocblas_caxpy_64_fortran
+
+    function rocblas_zaxpy_64_fortran(handle, n, alpha, x, incx, y, incy) &
+        bind(c, name='rocblas_zaxpy_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_zaxpy_64_fortran
+        type(c_ptr), value :: handle
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        rocblas_zaxpy_64_fortran = &
+            rocblas_zaxpy_64(handle, n, alpha, x, incx, y, incy)
+        return
+    end function rocblas_zaxpy_64_fortran
+
+    function rocblas_dgemv_64_fortran(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy) &
+        bind(c, name='rocblas_dgemv_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_dgemv_64_fortran
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(c_int64_t), value :: m
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int64_t), value :: lda
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        rocblas_dgemv_64_fortran = &
+            rocblas_dgemv_64(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy)
+        return
+    end function rocblas_dgemv_64_fortran
+
+    function rocblas_cgemv_64_fortran(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy) &
+        bind(c, name='rocblas_cgemv_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_cgemv_64_fortran
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(c_int64_t), value :: m
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int64_t), value :: lda
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        rocblas_cgemv_64_fortran = &
+            rocblas_cgemv_64(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy)
+        return
+    end function rocblas_cgemv_64_fortran
+
+    function rocblas_zgemv_64_fortran(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy) &
+        bind(c, name='rocblas_zgemv_64_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        integer(kind(rocblas_status_success)) :: rocblas_zgemv_64_fortran
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(c_int64_t), value :: m
+        integer(c_int64_t), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int64_t), value :: lda
+        type(c_ptr), value :: x
+        integer(c_int64_t), value :: incx
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: y
+        integer(c_int64_t), value :: incy
+        rocblas_zgemv_64_fortran = &
+            rocblas_zgemv_64(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy)
+        return
+    end function rocblas_zgemv_64_fortran
+
 end module rocblas_interface
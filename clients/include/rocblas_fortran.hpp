@@ -7023,4 +7023,236 @@ rocblas_status rocblas_geam_ex_fortran(rocblas_handle            handle,
                                        rocblas_int               ldd,
                                        rocblas_datatype          compute_type,
                                        rocblas_geam_ex_operation geam_ex_op);
+
+// beta
+rocblas_status rocblas_set_pointer_array_fortran(rocblas_handle handle,
+                                                 rocblas_int    elem_size,
+                                                 void*          base,
+                                                 rocblas_stride stride,
+                                                 rocblas_int    batch_count,
+                                                 void**         ptr_array);
+
+rocblas_status rocblas_saxpy_64_fortran(rocblas_handle handle,
+                                        int64_t        n,
+                                        const float*   alpha,
+                                        const float*   x,
+                                        int64_t        incx,
+                                        float*         y,
+                                        int64_t        incy);
+
+rocblas_status rocblas_sgemv_64_fortran(rocblas_handle    handle,
+                                        rocblas_operation transA,
+                                        int64_t           m,
+                                        int64_t           n,
+                                        const float*      alpha,
+                                        const float*      A,
+                                        int64_t           lda,
+                                        const float*      x,
+                                        int64_t           incx,
+                                        const float*      beta,
+                                        float*            y,
+                                        int64_t           incy);
+
+rocblas_status rocblas_sscal_64_fortran(rocblas_handle handle,
+                                        int64_t        n,
+                                        const float*   alpha,
+                                        float*         x,
+                                        int64_t        incx);
+
+rocblas_status rocblas_dscal_64_fortran(rocblas_handle handle,
+                                        int64_t        n,
+                                        const double*  alpha,
+                                        double*        x,
+                                        int64_t        incx);
+
+rocblas_status rocblas_cscal_64_fortran(rocblas_handle               handle,
+                                        int64_t                      n,
+                                        const rocblas_float_complex* alpha,
+                                        rocblas_float_complex*       x,
+                                        int64_t                      incx);
+
+rocblas_status rocblas_zscal_64_fortran(rocblas_handle                handle,
+                                        int64_t                       n,
+                                        const rocblas_double_complex* alpha,
+                                        rocblas_double_complex*       x,
+                                        int64_t                       incx);
+
+rocblas_status rocblas_csscal_64_fortran(rocblas_handle         handle,
+                                         int64_t                n,
+                                         const float*           alpha,
+                                         rocblas_float_complex* x,
+                                         int64_t                incx);
+
+rocblas_status rocblas_zdscal_64_fortran(rocblas_handle          handle,
+                                         int64_t                 n,
+                                         const double*           alpha,
+                                         rocblas_double_complex* x,
+                                         int64_t                 incx);
+
+rocblas_status rocblas_scopy_64_fortran(rocblas_handle handle,
+                                        int64_t        n,
+                                        const float*   x,
+                                        int64_t        incx,
+                                        float*         y,
+                                        int64_t        incy);
+
+rocblas_status rocblas_dcopy_64_fortran(rocblas_handle handle,
+                                        int64_t        n,
+                                        const double*  x,
+                                        int64_t        incx,
+                                        double*        y,
+                                        int64_t        incy);
+
+rocblas_status rocblas_ccopy_64_fortran(rocblas_handle               handle,
+                                        int64_t                      n,
+                                        const rocblas_float_complex* x,
+                                        int64_t                      incx,
+                                        rocblas_float_complex*       y,
+                                        int64_t                      incy);
+
+rocblas_status rocblas_zcopy_64_fortran(rocblas_handle                handle,
+                                        int64_t                       n,
+                                        const rocblas_double_complex* x,
+                                        int64_t                       incx,
+                                        rocblas_double_complex*       y,
+                                        int64_t                       incy);
+
+rocblas_status rocblas_sswap_64_fortran(rocblas_handle handle,
+                                        int64_t        n,
+                                        float*         x,
+                                        int64_t        incx,
+                                        float*         y,
+                                        int64_t        incy);
+
+rocblas_status rocblas_dswap_64_fortran(rocblas_handle handle,
+                                        int64_t        n,
+                                        double*        x,
+                                        int64_t        incx,
+                                        double*        y,
+                                        int64_t        incy);
+
+rocblas_status rocblas_cswap_64_fortran(rocblas_handle         handle,
+                                        int64_t                n,
+                                        rocblas_float_complex* x,
+                                        int64_t                incx,
+                                        rocblas_float_complex* y,
+                                        int64_t                incy);
+
+rocblas_status rocblas_zswap_64_fortran(rocblas_handle          handle,
+                                        int64_t                 n,
+                                        rocblas_double_complex* x,
+                                        int64_t                 incx,
+                                        rocblas_double_complex* y,
+                                        int64_t                 incy);
+
+rocblas_status rocblas_sdot_64_fortran(rocblas_handle handle,
+                                       int64_t        n,
+                                       const float*   x,
+                                       int64_t        incx,
+                                       const float*   y,
+                                       int64_t        incy,
+                                       float*         result);
+
+rocblas_status rocblas_ddot_64_fortran(rocblas_handle handle,
+                                       int64_t        n,
+                                       const double*  x,
+                                       int64_t        incx,
+                                       const double*  y,
+                                       int64_t        incy,
+                                       double*        result);
+
+rocblas_status rocblas_cdotu_64_fortran(rocblas_handle               handle,
+                                        int64_t                      n,
+                                        const rocblas_float_complex* x,
+                                        int64_t                      incx,
+                                        const rocblas_float_complex* y,
+                                        int64_t                      incy,
+                                        rocblas_float_complex*       result);
+
+rocblas_status rocblas_zdotu_64_fortran(rocblas_handle                handle,
+                                        int64_t                       n,
+                                        const rocblas_double_complex* x,
+                                        int64_t                       incx,
+                                        const rocblas_double_complex* y,
+                                        int64_t                       incy,
+                                        rocblas_double_complex*       result);
+
+rocblas_status rocblas_cdotc_64_fortran(rocblas_handle               handle,
+                                        int64_t                      n,
+                                        const rocblas_float_complex* x,
+                                        int64_t                      incx,
+                                        const rocblas_float_complex* y,
+                                        int64_t                      incy,
+                                        rocblas_float_complex*       result);
+
+rocblas_status rocblas_zdotc_64_fortran(rocblas_handle                handle,
+                                        int64_t                       n,
+                                        const rocblas_double_complex* x,
+                                        int64_t                       incx,
+                                        const rocblas_double_complex* y,
+                                        int64_t                       incy,
+                                        rocblas_double_complex*       result);
+
+rocblas_status rocblas_daxpy_64_fortran(rocblas_handle handle,
+                                        int64_t        n,
+                                        const double*  alpha,
+                                        const double*  x,
+                                        int64_t        incx,
+                                        double*        y,
+                                        int64_t        incy);
+
+rocblas_status rocblas_caxpy_64_fortran(rocblas_handle               handle,
+                                        int64_t                      n,
+                                        const rocblas_float_complex* alpha,
+                                        const rocblas_float_complex* x,
+                                        int64_t                      incx,
+                                        rocblas_float_complex*       y,
+                                        int64_t                      incy);
+
+rocblas_status rocblas_zaxpy_64_fortran(rocblas_handle                handle,
+                                        int64_t                       n,
+                                        const rocblas_double_complex* alpha,
+                                        const rocblas_double_complex* x,
+                                        int64_t                       incx,
+                                        rocblas_double_complex*       y,
+                                        int64_t                       incy);
+
+rocblas_status rocblas_dgemv_64_fortran(rocblas_handle    handle,
+                                        rocblas_operation transA,
+                                        int64_t           m,
+                                        int64_t           n,
+                                        const double*     alpha,
+                                        const double*     A,
+                                        int64_t           lda,
+                                        const double*     x,
+                                        int64_t           incx,
+                                        const double*     beta,
+                                        double*           y,
+                                        int64_t           incy);
+
+rocblas_status rocblas_cgemv_64_fortran(rocblas_handle               handle,
+                                        rocblas_operation            transA,
+                                        int64_t                      m,
+                                        int64_t                      n,
+                                        const rocblas_float_complex* alpha,
+                                        const rocblas_float_complex* A,
+                                        int64_t                      lda,
+                                        const rocblas_float_complex* x,
+                                        int64_t                      incx,
+                                        const rocblas_float_complex* beta,
+                                        rocblas_float_complex*       y,
+                                        int64_t                      incy);
+
+rocblas_status rocblas_zgemv_64_fortran(rocblas_handle                handle,
+                                        rocblas_operation             transA,
+                                        int64_t                       m,
+                                        int64_t                       n,
+                                        const rocblas_double_complex* alpha,
+                                        const rocblas_double_complex* A,
+                                        int64_t                       lda,
+                                        const rocblas_double_complex* x,
+                                        int64_t                       incx,
+                                        const rocblas_double_complex* beta,
+                                        rocblas_double_complex*       y,
+                                        int64_t                       incy);
 }
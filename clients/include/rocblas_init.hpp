@@ -27,8 +27,10 @@
 #include "rocblas.h"
 #include "rocblas_math.hpp"
 #include "rocblas_random.hpp"
+#include <algorithm>
 #include <cinttypes>
 #include <iostream>
+#include <numeric>
 #include <omp.h>
 #include <vector>
 
@@ -666,6 +668,84 @@ void rocblas_init_vector_trig(T* x, rocblas_int N, rocblas_stride incx, bool see
         x[j * incx] = T(seedReset ? cos(j * incx) : sin(j * incx));
 }
 
+/* ============================================================================================ */
+/*! \brief  Device general matrix initialization: */
+// Initialize a general matrix in device memory with the counter based rand_int/hpl generators,
+// or with the same trig_float values as rocblas_init_matrix_trig
+
+template <typename T>
+__global__ void rocblas_init_matrix_device_kernel(rocblas_initialization initialization,
+                                                  bool                   seedReset,
+                                                  bool                   alternating_sign,
+                                                  uint64_t               seed,
+                                                  T*                     A,
+                                                  size_t                 M,
+                                                  size_t                 N,
+                                                  size_t                 lda,
+                                                  rocblas_stride         stride,
+                                                  size_t                 batch_count)
+{
+    const size_t total = M * N * batch_count;
+    for(size_t k = blockIdx.x * size_t(blockDim.x) + threadIdx.x; k < total;
+        k += gridDim.x * size_t(blockDim.x))
+    {
+        size_t i    = k % M;
+        size_t j    = (k / M) % N;
+        size_t b    = k / (M * N);
+        size_t idx  = i + j * lda + b * stride;
+        int    sign = alternating_sign && !((i ^ j) & 1) ? -1 : 1;
+
+        if(initialization == rocblas_initialization::hpl)
+            A[idx] = rocblas_counter_hpl_generator<T>(seed, idx, sign);
+        else if(initialization == rocblas_initialization::rand_int)
+            A[idx] = rocblas_counter_int_generator<T>(seed, idx, sign);
+        else
+            A[idx] = T(seedReset ? cos(double(idx)) : sin(double(idx)));
+    }
+}
+
+template <typename T>
+hipError_t rocblas_init_matrix_device(rocblas_initialization initialization,
+                                      bool                   seedReset,
+                                      bool                   alternating_sign,
+                                      T*                     A,
+                                      size_t                 M,
+                                      size_t                 N,
+                                      size_t                 lda,
+                                      rocblas_stride         stride      = 0,
+                                      size_t                 batch_count = 1)
+{
+    if(!M || !N || !batch_count)
+        return hipSuccess;
+
+    // a different seed for each matrix, which follows the host seed
+    if(seedReset)
+        rocblas_seedrand();
+    uint64_t seed = t_rocblas_rng();
+
+    constexpr int NB     = 256;
+    const size_t  total  = M * N * batch_count;
+    const size_t  blocks = std::min((total - 1) / NB + 1, size_t(1) << 16);
+    hipLaunchKernelGGL(rocblas_init_matrix_device_kernel<T>,
+                       dim3(blocks),
+                       dim3(NB),
+                       0,
+                       0,
+                       initialization,
+                       seedReset,
+                       alternating_sign,
+                       seed,
+                       A,
+                       M,
+                       N,
+                       lda,
+                       stride,
+                       batch_count);
+
+    hipError_t hip_err = hipGetLastError();
+    return hip_err != hipSuccess ? hip_err : hipStreamSynchronize(0);
+}
+
 /* ============================================================================================ */
 /*! \brief  matrix/vector initialization: */
 // for vector x (M=1, N=lengthX, lda=incx);
@@ -782,6 +862,21 @@ void rocblas_init_inf(
     rocblas_init_inf(A.data(), M, N, lda, stride, batch_count);
 }
 
+/* ============================================================================================ */
+/*! \brief  Initialize each block of nnz entries of ind with distinct random 0-based indices
+            below n, in random order, as the indices of the nonzeros of a sparse vector */
+
+inline void rocblas_init_sparse_indices(host_vector<rocblas_int>& ind, size_t nnz, rocblas_int n)
+{
+    std::vector<rocblas_int> perm(n);
+    for(size_t block = 0; nnz && block + nnz <= ind.size(); block += nnz)
+    {
+        std::iota(perm.begin(), perm.end(), 0);
+        std::shuffle(perm.begin(), perm.end(), t_rocblas_rng);
+        std::copy(perm.begin(), perm.begin() + nnz, ind.begin() + block);
+    }
+}
+
 /* ============================================================================================ */
 /*! \brief  Initialize an array with random data, with zero */
 
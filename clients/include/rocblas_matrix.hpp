@@ -178,3 +178,69 @@ inline void rocblas_init_matrix(host_matrix<T>&           hA,
         rocblas_init_matrix_trig<T>(matrix_type, arg.uplo, hA, seedReset);
     }
 }
+
+//!
+//! @brief Returns true if the general matrices of type T may be initialized in device memory by
+//!        rocblas_init_matrix_device instead of on the host: the results are not verified, as when
+//!        rocblas-bench is run without --verify, nor the host transfers timed, and
+//!        arg.initialization is hpl, rand_int or trig_float with neither alpha nor beta NaN.
+//! @param arg Specifies the argument class.
+//!
+template <typename T>
+inline bool rocblas_client_device_init(const Arguments& arg)
+{
+    constexpr bool supported_type
+        = std::is_same<T, float>{} || std::is_same<T, double>{} || std::is_same<T, rocblas_half>{}
+          || std::is_same<T, rocblas_bfloat16>{} || std::is_same<T, int8_t>{}
+          || std::is_same<T, int32_t>{} || rocblas_is_complex<T>;
+
+    return supported_type && !arg.unit_check && !arg.norm_check
+           && !ArgumentModel_get_log_transfers() && !rocblas_isnan(arg.alpha)
+           && !rocblas_isnan(arg.beta)
+           && (arg.initialization == rocblas_initialization::hpl
+               || arg.initialization == rocblas_initialization::rand_int
+               || arg.initialization == rocblas_initialization::trig_float);
+}
+
+//!
+//! @brief Initialize a general device_strided_batch_matrix in device memory.
+//! @param dA The device_strided_batch_matrix.
+//! @param arg Specifies the argument class.
+//! @param seedReset reset the seed if true, do not reset the seed otherwise. Use init_cos if seedReset is true else use init_sin.
+//! @param alternating_sign Initialize matrix so adjacent entries have alternating sign.
+//! @return the hip error.
+//!
+template <typename T>
+inline hipError_t rocblas_init_matrix_device(device_strided_batch_matrix<T>& dA,
+                                             const Arguments&                arg,
+                                             bool                            seedReset,
+                                             bool                            alternating_sign)
+{
+    return rocblas_init_matrix_device(arg.initialization,
+                                      seedReset,
+                                      alternating_sign,
+                                      dA.data(),
+                                      dA.m(),
+                                      dA.n(),
+                                      dA.lda(),
+                                      dA.stride(),
+                                      dA.batch_count());
+}
+
+//!
+//! @brief Initialize a general device matrix in device memory.
+//! @param dA The device matrix.
+//! @param arg Specifies the argument class.
+//! @param seedReset reset the seed if true, do not reset the seed otherwise. Use init_cos if seedReset is true else use init_sin.
+//! @param alternating_sign Initialize matrix so adjacent entries have alternating sign.
+//! @return the hip error.
+//!
+template <typename T>
+inline hipError_t rocblas_init_matrix_device(device_matrix<T>& dA,
+                                             const Arguments&  arg,
+                                             bool              seedReset,
+                                             bool              alternating_sign)
+{
+    return rocblas_init_matrix_device(
+        arg.initialization, seedReset, alternating_sign, (T*)dA, dA.m(), dA.n(), dA.lda());
+}
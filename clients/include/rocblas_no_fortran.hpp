@@ -28,5 +28,34 @@
 #define rocblas_trsm_ex_fortran rocblas_trsm_ex
 #define rocblas_trsm_batched_ex_fortran rocblas_trsm_batched_ex
 #define rocblas_trsm_strided_batched_ex_fortran rocblas_trsm_strided_batched_ex
+#define rocblas_set_pointer_array_fortran rocblas_set_pointer_array
+#define rocblas_sscal_64_fortran rocblas_sscal_64
+#define rocblas_dscal_64_fortran rocblas_dscal_64
+#define rocblas_cscal_64_fortran rocblas_cscal_64
+#define rocblas_zscal_64_fortran rocblas_zscal_64
+#define rocblas_csscal_64_fortran rocblas_csscal_64
+#define rocblas_zdscal_64_fortran rocblas_zdscal_64
+#define rocblas_scopy_64_fortran rocblas_scopy_64
+#define rocblas_dcopy_64_fortran rocblas_dcopy_64
+#define rocblas_ccopy_64_fortran rocblas_ccopy_64
+#define rocblas_zcopy_64_fortran rocblas_zcopy_64
+#define rocblas_sswap_64_fortran rocblas_sswap_64
+#define rocblas_dswap_64_fortran rocblas_dswap_64
+#define rocblas_cswap_64_fortran rocblas_cswap_64
+#define rocblas_zswap_64_fortran rocblas_zswap_64
+#define rocblas_sdot_64_fortran rocblas_sdot_64
+#define rocblas_ddot_64_fortran rocblas_ddot_64
+#define rocblas_cdotu_64_fortran rocblas_cdotu_64
+#define rocblas_zdotu_64_fortran rocblas_zdotu_64
+#define rocblas_cdotc_64_fortran rocblas_cdotc_64
+#define rocblas_zdotc_64_fortran rocblas_zdotc_64
+#define rocblas_saxpy_64_fortran rocblas_saxpy_64
+#define rocblas_daxpy_64_fortran rocblas_daxpy_64
+#define rocblas_caxpy_64_fortran rocblas_caxpy_64
+#define rocblas_zaxpy_64_fortran rocblas_zaxpy_64
+#define rocblas_sgemv_64_fortran rocblas_sgemv_64
+#define rocblas_dgemv_64_fortran rocblas_dgemv_64
+#define rocblas_cgemv_64_fortran rocblas_cgemv_64
+#define rocblas_zgemv_64_fortran rocblas_zgemv_64
 
 #endif
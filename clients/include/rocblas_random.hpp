@@ -392,3 +392,44 @@ inline std::string random_string(size_t n)
     }
     return str;
 }
+
+/* ============================================================================================ */
+/* Counter based random numbers, used to initialize the data on the device:                    */
+
+/*! \brief  64 random bits of element idx, the splitmix64 finalizer of the seed and idx, so that
+ *          each element is generated independently of the others and in any order */
+__host__ __device__ inline uint64_t rocblas_counter_random(uint64_t seed, uint64_t idx)
+{
+    uint64_t z = seed + (idx + 1) * 0x9E3779B97F4A7C15ull;
+    z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z          = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/*! \brief  counter based random_generator: element idx in [1, 10], [-2, 2] for rocblas_half and
+ *          rocblas_bfloat16 and [1, 3] for int8_t, with the given sign */
+template <typename T>
+__host__ __device__ inline T rocblas_counter_int_generator(uint64_t seed, uint64_t idx, int sign)
+{
+    uint64_t r = rocblas_counter_random(seed, idx);
+    if constexpr(std::is_same<T, rocblas_half>{} || std::is_same<T, rocblas_bfloat16>{})
+        return T(float(sign * (int(r % 5) - 2)));
+    else if constexpr(std::is_same<T, int8_t>{})
+        return T(sign * int(1 + r % 3));
+    else if constexpr(rocblas_is_complex<T>)
+        return T(sign * int(1 + (r & 0xFFFFFFFF) % 10), sign * int(1 + (r >> 32) % 10));
+    else
+        return T(sign * int(1 + r % 10));
+}
+
+/*! \brief  counter based random_hpl_generator: element idx in HPL-like [-0.5,0.5) doubles, with
+ *          the given sign */
+template <typename T>
+__host__ __device__ inline T rocblas_counter_hpl_generator(uint64_t seed, uint64_t idx, int sign)
+{
+    double value = sign * (double(rocblas_counter_random(seed, idx) >> 11) * 0x1.0p-53 - 0.5);
+    if constexpr(std::is_same<T, rocblas_bfloat16>{})
+        return T(float(value));
+    else
+        return T(value);
+}
@@ -0,0 +1,303 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_batched_scalar_stride_bad_arg(const Arguments&)
+{
+    // A new handle uses the same scalars for all batches, whatever rocblas-bench selects
+    rocblas_handle handle;
+    CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+    rocblas_stride alpha_stride = -1, beta_stride = -1;
+    CHECK_ROCBLAS_ERROR(rocblas_get_batched_scalar_stride(handle, &alpha_stride, &beta_stride));
+    EXPECT_EQ(alpha_stride, 0);
+    EXPECT_EQ(beta_stride, 0);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_batched_scalar_stride(nullptr, 1, 1),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_batched_scalar_stride(nullptr, &alpha_stride, &beta_stride),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_batched_scalar_stride(handle, nullptr, &beta_stride),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_batched_scalar_stride(handle, &alpha_stride, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_batched_scalar_stride(handle, 3, 5));
+    CHECK_ROCBLAS_ERROR(rocblas_get_batched_scalar_stride(handle, &alpha_stride, &beta_stride));
+    EXPECT_EQ(alpha_stride, 3);
+    EXPECT_EQ(beta_stride, 5);
+
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+}
+
+// With per batch scalars each batch of axpy_strided_batched, scal_batched and
+// gemv_strided_batched uses its own alpha and beta, read from device arrays, and gives the
+// results of a host loop over the batches
+template <typename T>
+void testing_batched_scalar_stride(const Arguments& arg)
+{
+    rocblas_int       M           = arg.M;
+    rocblas_int       N           = arg.N;
+    rocblas_int       lda         = arg.lda;
+    rocblas_int       incx        = arg.incx;
+    rocblas_int       incy        = arg.incy;
+    T                 h_alpha     = arg.get_alpha<T>();
+    T                 h_beta      = arg.get_beta<T>();
+    rocblas_operation transA      = char2rocblas_operation(arg.transA);
+    rocblas_int       batch_count = arg.batch_count;
+
+    rocblas_local_handle handle{arg};
+
+    // The scalars of batch b are at b * 2, the stride being larger than one
+    const rocblas_stride scalar_stride = 2;
+
+    rocblas_int dim_x = transA == rocblas_operation_none ? N : M;
+    rocblas_int dim_y = transA == rocblas_operation_none ? M : N;
+
+    size_t abs_incx = incx >= 0 ? incx : -incx;
+    size_t abs_incy = incy >= 0 ? incy : -incy;
+
+    rocblas_stride stride_a = rocblas_stride(lda) * N;
+    rocblas_stride stride_x = dim_x * abs_incx;
+    rocblas_stride stride_y = dim_y * abs_incy;
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    CHECK_ROCBLAS_ERROR(rocblas_set_batched_scalar_stride(handle, scalar_stride, scalar_stride));
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || lda < M || lda < 1 || !incx || !incy || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_strided_batched<T>(handle,
+                                                              transA,
+                                                              M,
+                                                              N,
+                                                              nullptr,
+                                                              nullptr,
+                                                              lda,
+                                                              stride_a,
+                                                              nullptr,
+                                                              incx,
+                                                              stride_x,
+                                                              nullptr,
+                                                              nullptr,
+                                                              incy,
+                                                              stride_y,
+                                                              batch_count),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_strided_batch_matrix<T> hA(M, N, lda, stride_a, batch_count);
+    host_strided_batch_vector<T> hx(dim_x, incx, stride_x, batch_count);
+    host_strided_batch_vector<T> hy(dim_y, incy, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_res(dim_y, incy, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_gold(dim_y, incy, stride_y, batch_count);
+    host_strided_batch_vector<T> hz(dim_x, incx, stride_x, batch_count);
+    host_strided_batch_vector<T> hz_res(dim_x, incx, stride_x, batch_count);
+    host_strided_batch_vector<T> hz_gold(dim_x, incx, stride_x, batch_count);
+    host_batch_vector<T>         hxb(dim_x, incx, batch_count);
+    host_batch_vector<T>         hxb_gold(dim_x, incx, batch_count);
+    host_vector<T>               halpha(scalar_stride * batch_count);
+    host_vector<T>               hbeta(scalar_stride * batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+
+    // Allocate device memory
+    device_strided_batch_matrix<T> dA(M, N, lda, stride_a, batch_count);
+    device_strided_batch_vector<T> dx(dim_x, incx, stride_x, batch_count);
+    device_strided_batch_vector<T> dy(dim_y, incy, stride_y, batch_count);
+    device_strided_batch_vector<T> dz(dim_x, incx, stride_x, batch_count);
+    device_batch_vector<T>         dxb(dim_x, incx, batch_count);
+    device_vector<T>               d_alpha(scalar_stride * batch_count);
+    device_vector<T>               d_beta(scalar_stride * batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+    CHECK_DEVICE_ALLOCATION(dxb.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(hA, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, true);
+    rocblas_init_vector(hx, arg, rocblas_client_never_set_nan, false, true);
+    rocblas_init_vector(hy, arg, rocblas_client_never_set_nan);
+    rocblas_init_vector(hz, arg, rocblas_client_never_set_nan);
+    rocblas_init_vector(hxb, arg, rocblas_client_never_set_nan);
+    hxb_gold.copy_from(hxb);
+
+    // Each batch scales alpha and beta differently, and the values between them would give
+    // wrong results if they were read
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        halpha[b * scalar_stride]     = h_alpha * T(b % 7 - 3);
+        halpha[b * scalar_stride + 1] = T(100);
+        hbeta[b * scalar_stride]      = h_beta * T(b % 5 - 2);
+        hbeta[b * scalar_stride + 1]  = T(100);
+    }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+    CHECK_HIP_ERROR(d_beta.transfer_from(hbeta));
+
+    auto rocblas_gemv_fn = [&](const T* alpha, const T* beta) {
+        return rocblas_gemv_strided_batched<T>(handle,
+                                               transA,
+                                               M,
+                                               N,
+                                               alpha,
+                                               dA,
+                                               lda,
+                                               stride_a,
+                                               dx,
+                                               incx,
+                                               stride_x,
+                                               beta,
+                                               dy,
+                                               incy,
+                                               stride_y,
+                                               batch_count);
+    };
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error          = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // z = alpha_b * x + z
+        CHECK_HIP_ERROR(dz.transfer_from(hz));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_strided_batched<T>(
+            handle, dim_x, d_alpha, dx, incx, stride_x, dz, incx, stride_x, batch_count));
+        CHECK_HIP_ERROR(hz_res.transfer_from(dz));
+
+        // x = alpha_b * x, through an array of pointers
+        CHECK_HIP_ERROR(dxb.transfer_from(hxb));
+        CHECK_ROCBLAS_ERROR(rocblas_scal_batched<T>(
+            handle, dim_x, d_alpha, dxb.ptr_on_device(), incx, batch_count));
+        CHECK_HIP_ERROR(hxb.transfer_from(dxb));
+
+        // y = alpha_b * op(A) * x + beta_b * y
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_fn(d_alpha, d_beta));
+        CHECK_HIP_ERROR(hy_res.transfer_from(dy));
+
+        // CPU BLAS
+        hz_gold.copy_from(hz);
+        hy_gold.copy_from(hy);
+
+        cpu_time_used = get_time_us_no_sync();
+#pragma omp parallel for
+        for(int b = 0; b < batch_count; b++)
+        {
+            T alpha_b = halpha[b * scalar_stride];
+            T beta_b  = hbeta[b * scalar_stride];
+            cblas_axpy<T>(dim_x, alpha_b, hx[b], incx, hz_gold[b], incx);
+            cblas_scal(dim_x, alpha_b, (T*)hxb_gold[b], incx);
+            cblas_gemv<T>(
+                transA, M, N, alpha_b, hA[b], lda, hx[b], incx, beta_b, hy_gold[b], incy);
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, dim_x, abs_incx, stride_x, hz_gold, hz_res, batch_count);
+            unit_check_general<T>(1, dim_x, abs_incx, hxb_gold, hxb, batch_count);
+            unit_check_general<T>(1, dim_y, abs_incy, stride_y, hy_gold, hy_res, batch_count);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error = norm_check_general<T>(
+                'F', 1, dim_y, abs_incy, stride_y, hy_gold, hy_res, batch_count);
+        }
+
+        // In host pointer mode every batch uses the same alpha and beta
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_fn(&h_alpha, &h_beta));
+        CHECK_HIP_ERROR(hy_res.transfer_from(dy));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        hy_gold.copy_from(hy);
+#pragma omp parallel for
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_gemv<T>(
+                transA, M, N, h_alpha, hA[b], lda, hx[b], incx, h_beta, hy_gold[b], incy);
+        }
+
+        if(arg.unit_check)
+            unit_check_general<T>(1, dim_y, abs_incy, stride_y, hy_gold, hy_res, batch_count);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_gemv_fn(d_alpha, d_beta);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(
+            stream, number_hot_calls, [&] { rocblas_gemv_fn(d_alpha, d_beta); });
+
+        ArgumentModel<e_transA, e_M, e_N, e_alpha, e_lda, e_incx, e_beta, e_incy, e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemv_gflop_count<T>(transA, M, N),
+                         gemv_gbyte_count<T>(transA, M, N),
+                         cpu_time_used,
+                         rocblas_error);
+    }
+}
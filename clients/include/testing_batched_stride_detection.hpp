@@ -0,0 +1,294 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_batched_stride_detection_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    bool detect;
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_batched_stride_detection(nullptr, true),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_batched_stride_detection(nullptr, &detect),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_batched_stride_detection(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+}
+
+// Point the arrays at the batches of a strided batch, in reverse order if reverse is set
+template <typename T>
+void batched_stride_detection_set_arrays(device_vector<T*>&              d_array,
+                                         device_strided_batch_matrix<T>& dM,
+                                         rocblas_stride                  stride,
+                                         bool                            reverse)
+{
+    rocblas_int     batch_count = d_array.n();
+    host_vector<T*> h_array(batch_count);
+    for(rocblas_int b = 0; b < batch_count; b++)
+        h_array[b] = (T*)dM + (reverse ? batch_count - 1 - b : b) * stride;
+    CHECK_HIP_ERROR(d_array.transfer_from(h_array));
+}
+
+// With batched stride detection, gemm_batched must give the results of gemm_strided_batched,
+// both for evenly strided pointer arrays, which run the strided batched gemm, and for the same
+// pointers in reverse order, which do not
+template <typename T>
+void testing_batched_stride_detection(const Arguments& arg)
+{
+    rocblas_operation transA      = char2rocblas_operation(arg.transA);
+    rocblas_operation transB      = char2rocblas_operation(arg.transB);
+    rocblas_int       M           = arg.M;
+    rocblas_int       N           = arg.N;
+    rocblas_int       K           = arg.K;
+    rocblas_int       lda         = arg.lda;
+    rocblas_int       ldb         = arg.ldb;
+    rocblas_int       ldc         = arg.ldc;
+    rocblas_stride    stride_a    = arg.stride_a;
+    rocblas_stride    stride_b    = arg.stride_b;
+    rocblas_stride    stride_c    = arg.stride_c;
+    rocblas_int       batch_count = arg.batch_count;
+    T                 h_alpha     = arg.get_alpha<T>();
+    T                 h_beta      = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    bool detect = true;
+    CHECK_ROCBLAS_ERROR(rocblas_get_batched_stride_detection(handle, &detect));
+    EXPECT_FALSE(detect);
+    CHECK_ROCBLAS_ERROR(rocblas_set_batched_stride_detection(handle, true));
+    CHECK_ROCBLAS_ERROR(rocblas_get_batched_stride_detection(handle, &detect));
+    EXPECT_TRUE(detect);
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    // Naming: `h` is in CPU (host) memory(eg hC_1), `d` is in GPU (device) memory (eg dC_1).
+    // Allocate host memory
+    host_strided_batch_matrix<T> hA(A_row, A_col, lda, stride_a, batch_count);
+    host_strided_batch_matrix<T> hB(B_row, B_col, ldb, stride_b, batch_count);
+    host_strided_batch_matrix<T> hC(M, N, ldc, stride_c, batch_count);
+    host_strided_batch_matrix<T> hC_1(M, N, ldc, stride_c, batch_count);
+    host_strided_batch_matrix<T> hC_gold(M, N, ldc, stride_c, batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hC.memcheck());
+
+    // Allocate device memory
+    device_strided_batch_matrix<T> dA(A_row, A_col, lda, stride_a, batch_count);
+    device_strided_batch_matrix<T> dB(B_row, B_col, ldb, stride_b, batch_count);
+    device_strided_batch_matrix<T> dC(M, N, ldc, stride_c, batch_count);
+    device_vector<T*>              dA_array(batch_count);
+    device_vector<T*>              dB_array(batch_count);
+    device_vector<T*>              dC_array(batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_array.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB_array.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_array.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+        hC_gold.copy_from(hC);
+        for(rocblas_int b = 0; b < batch_count; b++)
+            cblas_gemm<T>(
+                transA, transB, M, N, K, h_alpha, hA[b], lda, hB[b], ldb, h_beta, hC_gold[b], ldc);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // gemm_strided_batched, then gemm_batched on strided and on reversed pointer arrays
+        for(int run : {0, 1, 2})
+        {
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+            handle.pre_test(arg);
+            if(run == 0)
+            {
+                CHECK_ROCBLAS_ERROR(rocblas_gemm_strided_batched<T>(handle,
+                                                                    transA,
+                                                                    transB,
+                                                                    M,
+                                                                    N,
+                                                                    K,
+                                                                    &h_alpha,
+                                                                    dA,
+                                                                    lda,
+                                                                    stride_a,
+                                                                    dB,
+                                                                    ldb,
+                                                                    stride_b,
+                                                                    &h_beta,
+                                                                    dC,
+                                                                    ldc,
+                                                                    stride_c,
+                                                                    batch_count));
+            }
+            else
+            {
+                bool reverse = run == 2;
+                batched_stride_detection_set_arrays(dA_array, dA, stride_a, reverse);
+                batched_stride_detection_set_arrays(dB_array, dB, stride_b, reverse);
+                batched_stride_detection_set_arrays(dC_array, dC, stride_c, reverse);
+
+                CHECK_ROCBLAS_ERROR(rocblas_gemm_batched<T>(handle,
+                                                            transA,
+                                                            transB,
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            &h_alpha,
+                                                            dA_array,
+                                                            lda,
+                                                            dB_array,
+                                                            ldb,
+                                                            &h_beta,
+                                                            dC_array,
+                                                            ldc,
+                                                            batch_count));
+            }
+            handle.post_test(arg);
+
+            // copy output from device to CPU
+            CHECK_HIP_ERROR(hC_1.transfer_from(dC));
+
+            if(arg.unit_check)
+                unit_check_general<T>(M, N, ldc, stride_c, hC_gold, hC_1, batch_count);
+
+            if(arg.norm_check)
+                rocblas_error = std::max(
+                    rocblas_error,
+                    double(norm_check_general<T>(
+                        'F', M, N, ldc, stride_c, hC_gold, hC_1, batch_count)));
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        // the time includes the detection on evenly strided arrays
+        batched_stride_detection_set_arrays(dA_array, dA, stride_a, false);
+        batched_stride_detection_set_arrays(dB_array, dB, stride_b, false);
+        batched_stride_detection_set_arrays(dC_array, dC, stride_c, false);
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_gemm_batched<T>(handle,
+                                    transA,
+                                    transB,
+                                    M,
+                                    N,
+                                    K,
+                                    &h_alpha,
+                                    dA_array,
+                                    lda,
+                                    dB_array,
+                                    ldb,
+                                    &h_beta,
+                                    dC_array,
+                                    ldc,
+                                    batch_count);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_gemm_batched<T>(handle,
+                                    transA,
+                                    transB,
+                                    M,
+                                    N,
+                                    K,
+                                    &h_alpha,
+                                    dA_array,
+                                    lda,
+                                    dB_array,
+                                    ldb,
+                                    &h_beta,
+                                    dC_array,
+                                    ldc,
+                                    batch_count);
+        });
+
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_ldb,
+                      e_beta,
+                      e_ldc,
+                      e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemm_gflop_count<T>(M, N, K),
+                         gemm_gbyte_count<T>(M, N, K),
+                         cpu_time_used,
+                         rocblas_error);
+    }
+}
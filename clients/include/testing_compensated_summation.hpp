@@ -0,0 +1,308 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <cmath>
+#include <limits>
+
+// Host reference of a compensated sum, with the rounding errors of the additions and of the
+// real products kept exactly by TwoSum and FMA, so that it is accurate to about 1 ulp
+template <typename Tr>
+struct compensated_sum_reference
+{
+    Tr sum = 0;
+    Tr err = 0;
+
+    void add(Tr val)
+    {
+        Tr s       = sum + val;
+        Tr b_round = s - sum;
+        err += (sum - (s - b_round)) + (val - b_round);
+        sum = s;
+    }
+
+    void add_product(Tr a, Tr b)
+    {
+        Tr prod = a * b;
+        add(prod);
+        err += std::fma(a, b, -prod);
+    }
+
+    Tr value() const
+    {
+        return sum + err;
+    }
+};
+
+template <typename T>
+void testing_compensated_summation_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    bool compensated;
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_compensated_summation_mode(nullptr, true),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_compensated_summation_mode(nullptr, &compensated),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_compensated_summation_mode(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+}
+
+// In compensated summation mode dot, asum and nrm2, and dot_ex and nrm2_ex in the execution
+// type of the vectors, are accurate to a few ulps of the result for mostly cancelling sums,
+// where the default summation loses many bits
+template <typename T>
+void testing_compensated_summation(const Arguments& arg)
+{
+    using Tr = real_t<T>;
+
+    rocblas_int N           = arg.N;
+    rocblas_int incx        = arg.incx;
+    rocblas_int incy        = arg.incy;
+    rocblas_int batch_count = arg.batch_count;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    bool compensated = true;
+    CHECK_ROCBLAS_ERROR(rocblas_get_compensated_summation_mode(handle, &compensated));
+    EXPECT_FALSE(compensated);
+    CHECK_ROCBLAS_ERROR(rocblas_set_compensated_summation_mode(handle, true));
+    CHECK_ROCBLAS_ERROR(rocblas_get_compensated_summation_mode(handle, &compensated));
+    EXPECT_TRUE(compensated);
+
+    // check to prevent undefined memory allocation error
+    if(N <= 0 || batch_count <= 0)
+    {
+        T  cpu_0 = T(0), dot = T(1);
+        Tr cpu_r0 = Tr(0), asum = Tr(1), nrm2 = Tr(1);
+        CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, nullptr, incx, nullptr, incy, &dot));
+        CHECK_ROCBLAS_ERROR(rocblas_asum<T>(handle, N, nullptr, incx, &asum));
+        CHECK_ROCBLAS_ERROR(rocblas_nrm2<T>(handle, N, nullptr, incx, &nrm2));
+        unit_check_general<T>(1, 1, 1, &cpu_0, &dot);
+        unit_check_general<Tr>(1, 1, 1, &cpu_r0, &asum);
+        unit_check_general<Tr>(1, 1, 1, &cpu_r0, &nrm2);
+        return;
+    }
+
+    rocblas_int    abs_incx = incx >= 0 ? incx : -incx;
+    rocblas_int    abs_incy = incy >= 0 ? incy : -incy;
+    rocblas_stride stride_x = size_t(N) * abs_incx;
+    rocblas_stride stride_y = size_t(N) * abs_incy;
+    size_t         size_x   = size_t(stride_x) * batch_count;
+    size_t         size_y   = size_t(stride_y) * batch_count;
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    host_vector<T>  hx(size_x);
+    host_vector<T>  hy(size_y);
+    host_vector<T>  hdot_1(batch_count);
+    host_vector<T>  hdot_2(batch_count);
+    host_vector<Tr> hasum(batch_count);
+    host_vector<Tr> hnrm2(batch_count);
+
+    // Magnitudes spread over a wide range and products of both signs, so that the default
+    // summation loses many bits of the mostly cancelling dot product
+    rocblas_seedrand();
+    rocblas_init(hx, 1, size_x, 1);
+    rocblas_init(hy, 1, size_y, 1);
+    constexpr int digits = std::numeric_limits<Tr>::digits;
+    for(size_t i = 0; i < size_x; i++)
+        hx[i] *= T(std::ldexp(Tr(1), int(i % (digits - 1)) - digits / 2));
+    for(size_t i = 1; i < size_y; i += 2)
+        hy[i] = -hy[i];
+
+    device_vector<T> dx(size_x);
+    device_vector<T> dy(size_y);
+    device_vector<T> d_dot(batch_count);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_dot.memcheck());
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // CPU reference, element i of a vector is counted from the end for a negative increment
+        host_vector<T>      cpu_dot(batch_count);
+        host_vector<Tr>     cpu_asum(batch_count);
+        host_vector<Tr>     cpu_nrm2(batch_count);
+        std::vector<double> dot_tol(batch_count);
+
+        constexpr double eps = std::numeric_limits<Tr>::epsilon();
+
+        cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            const T* x = &hx[size_t(b) * stride_x];
+            const T* y = &hy[size_t(b) * stride_y];
+
+            compensated_sum_reference<Tr> dot_re, dot_im, asum, nrm2;
+            double                        abs_dot = 0;
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                T xi = x[incx >= 0 ? size_t(i) * incx : size_t(N - 1 - i) * abs_incx];
+                T yi = y[incy >= 0 ? size_t(i) * incy : size_t(N - 1 - i) * abs_incy];
+                abs_dot += double(rocblas_abs(xi)) * double(rocblas_abs(yi));
+
+                if constexpr(rocblas_is_complex<T>)
+                {
+                    dot_re.add_product(std::real(xi), std::real(yi));
+                    dot_re.add_product(-std::imag(xi), std::imag(yi));
+                    dot_im.add_product(std::real(xi), std::imag(yi));
+                    dot_im.add_product(std::imag(xi), std::real(yi));
+                    asum.add(std::abs(std::real(xi)));
+                    asum.add(std::abs(std::imag(xi)));
+                    nrm2.add_product(std::real(xi), std::real(xi));
+                    nrm2.add_product(std::imag(xi), std::imag(xi));
+                }
+                else
+                {
+                    dot_re.add_product(xi, yi);
+                    asum.add(std::abs(xi));
+                    nrm2.add_product(xi, xi);
+                }
+            }
+
+            if constexpr(rocblas_is_complex<T>)
+                cpu_dot[b] = T(dot_re.value(), dot_im.value());
+            else
+                cpu_dot[b] = dot_re.value();
+            cpu_asum[b] = asum.value();
+            cpu_nrm2[b] = std::sqrt(nrm2.value());
+
+            // A few ulps of the result, and a second order term in the sum of the magnitudes
+            // instead of the first order term of the default summation. The rounding errors of
+            // the complex products are not compensated, they add a first order term of the
+            // magnitudes which does not grow with N.
+            dot_tol[b] = 4 * eps * rocblas_abs(cpu_dot[b])
+                         + (rocblas_is_complex<T> ? 4 * eps : 16 * eps * eps * N) * abs_dot;
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // Without atomics nrm2 also uses the two kernel reduction in the default mode
+        for(auto atomics : {rocblas_atomics_allowed, rocblas_atomics_not_allowed})
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_atomics_mode(handle, atomics));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_dot_strided_batched<T>(
+                handle, N, dx, incx, stride_x, dy, incy, stride_y, batch_count, hdot_1));
+            handle.post_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_asum_strided_batched<T>(
+                handle, N, dx, incx, stride_x, batch_count, hasum));
+            CHECK_ROCBLAS_ERROR(rocblas_nrm2_strided_batched<T>(
+                handle, N, dx, incx, stride_x, batch_count, hnrm2));
+
+            // Device pointer mode gives the same results
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            CHECK_ROCBLAS_ERROR(rocblas_dot_strided_batched<T>(
+                handle, N, dx, incx, stride_x, dy, incy, stride_y, batch_count, d_dot));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            CHECK_HIP_ERROR(hdot_2.transfer_from(d_dot));
+
+            // dot_ex and nrm2_ex in the type of the vectors use the same reductions
+            T                      dot_ex;
+            Tr                     nrm2_ex;
+            const rocblas_datatype type   = rocblas_type2datatype<T>();
+            const rocblas_datatype r_type = rocblas_type2datatype<Tr>();
+            CHECK_ROCBLAS_ERROR(
+                rocblas_dot_ex(handle, N, dx, type, incx, dy, type, incy, &dot_ex, type, type));
+            CHECK_ROCBLAS_ERROR(
+                rocblas_nrm2_ex(handle, N, dx, type, incx, &nrm2_ex, r_type, r_type));
+
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(1, batch_count, 1, hdot_1, hdot_2);
+
+                for(rocblas_int b = 0; b < batch_count; b++)
+                {
+                    near_check_general<T>(1, 1, 1, &cpu_dot[b], &hdot_1[b], dot_tol[b]);
+                    near_check_general<Tr>(1, 1, 1, &cpu_asum[b], &hasum[b], 4 * eps * cpu_asum[b]);
+                    near_check_general<Tr>(1, 1, 1, &cpu_nrm2[b], &hnrm2[b], 4 * eps * cpu_nrm2[b]);
+                }
+
+                near_check_general<T>(1, 1, 1, &cpu_dot[0], &dot_ex, dot_tol[0]);
+                near_check_general<Tr>(1, 1, 1, &cpu_nrm2[0], &nrm2_ex, 4 * eps * cpu_nrm2[0]);
+            }
+
+            if(arg.norm_check)
+            {
+                for(rocblas_int b = 0; b < batch_count; b++)
+                    rocblas_error = std::max(
+                        rocblas_error, double(rocblas_abs((cpu_dot[b] - hdot_1[b]) / cpu_dot[b])));
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_dot_strided_batched<T>(
+                handle, N, dx, incx, stride_x, dy, incy, stride_y, batch_count, d_dot);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_dot_strided_batched<T>(
+                handle, N, dx, incx, stride_x, dy, incy, stride_y, batch_count, d_dot);
+        });
+
+        ArgumentModel<e_N, e_incx, e_incy, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            dot_gflop_count<false, T>(N),
+            dot_gbyte_count<T>(N),
+            cpu_time_used,
+            rocblas_error);
+    }
+}
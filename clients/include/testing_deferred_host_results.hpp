@@ -0,0 +1,158 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "cblas_interface.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_deferred_host_results_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    bool deferred;
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_deferred_host_results(nullptr, true),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_deferred_host_results(nullptr, &deferred),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_deferred_host_results(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+}
+
+// Reductions with host results run the same kernels whether the results are copied back
+// blocking or deferred, so the deferred results, in pageable or pinned memory, match exactly
+template <typename T>
+void testing_deferred_host_results(const Arguments& arg)
+{
+    auto rocblas_nrm2_strided_batched_fn = arg.fortran ? rocblas_nrm2_strided_batched<T, true>
+                                                       : rocblas_nrm2_strided_batched<T, false>;
+    auto rocblas_asum_strided_batched_fn = arg.fortran ? rocblas_asum_strided_batched<T, true>
+                                                       : rocblas_asum_strided_batched<T, false>;
+    auto rocblas_dot_strided_batched_fn  = arg.fortran ? rocblas_dot_strided_batched<T, true>
+                                                       : rocblas_dot_strided_batched<T, false>;
+    auto rocblas_iamax_strided_batched_fn = arg.fortran ? rocblas_iamax_strided_batched<T, true>
+                                                        : rocblas_iamax_strided_batched<T, false>;
+    auto rocblas_nrm2_fn = arg.fortran ? rocblas_nrm2<T, true> : rocblas_nrm2<T, false>;
+
+    rocblas_int    N           = arg.N;
+    rocblas_int    incx        = arg.incx;
+    rocblas_int    batch_count = arg.batch_count;
+    rocblas_stride stridex     = size_t(N) * incx;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    host_strided_batch_vector<T> hx(N, incx, stridex, batch_count);
+
+    // Allocate device memory
+    device_strided_batch_vector<T> dx(N, incx, stridex, batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_never_set_nan, true);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    bool deferred = true;
+    CHECK_ROCBLAS_ERROR(rocblas_get_deferred_host_results(handle, &deferred));
+    EXPECT_FALSE(deferred);
+
+    // Reference results with the default, blocking copies
+    host_vector<real_t<T>>   nrm2_ref(batch_count);
+    host_vector<real_t<T>>   asum_ref(batch_count);
+    host_vector<T>           dot_ref(batch_count);
+    host_vector<rocblas_int> amax_ref(batch_count);
+    CHECK_ROCBLAS_ERROR(
+        rocblas_nrm2_strided_batched_fn(handle, N, dx, incx, stridex, batch_count, nrm2_ref));
+    CHECK_ROCBLAS_ERROR(
+        rocblas_asum_strided_batched_fn(handle, N, dx, incx, stridex, batch_count, asum_ref));
+    CHECK_ROCBLAS_ERROR(rocblas_dot_strided_batched_fn(
+        handle, N, dx, incx, stridex, dx, incx, stridex, batch_count, dot_ref));
+    CHECK_ROCBLAS_ERROR(
+        rocblas_iamax_strided_batched_fn(handle, N, dx, incx, stridex, batch_count, amax_ref));
+
+    // Deferred results into pageable and into pinned memory
+    CHECK_ROCBLAS_ERROR(rocblas_set_deferred_host_results(handle, true));
+    CHECK_ROCBLAS_ERROR(rocblas_get_deferred_host_results(handle, &deferred));
+    EXPECT_TRUE(deferred);
+
+    host_vector<real_t<T>>   nrm2(batch_count);
+    host_vector<real_t<T>>   asum(batch_count);
+    host_pinned_vector<T>    dot(batch_count);
+    host_vector<rocblas_int> amax(batch_count);
+    CHECK_ROCBLAS_ERROR(
+        rocblas_nrm2_strided_batched_fn(handle, N, dx, incx, stridex, batch_count, nrm2));
+    CHECK_ROCBLAS_ERROR(
+        rocblas_asum_strided_batched_fn(handle, N, dx, incx, stridex, batch_count, asum));
+    CHECK_ROCBLAS_ERROR(rocblas_dot_strided_batched_fn(
+        handle, N, dx, incx, stridex, dx, incx, stridex, batch_count, dot));
+    CHECK_ROCBLAS_ERROR(
+        rocblas_iamax_strided_batched_fn(handle, N, dx, incx, stridex, batch_count, amax));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    unit_check_general<real_t<T>>(1, batch_count, 1, nrm2_ref, nrm2);
+    unit_check_general<real_t<T>>(1, batch_count, 1, asum_ref, asum);
+    unit_check_general<T>(1, batch_count, 1, dot_ref, dot);
+    unit_check_general<rocblas_int>(1, batch_count, 1, amax_ref, amax);
+
+    // The integer data keeps asum and dot exact on the CPU
+    if(arg.unit_check)
+    {
+        host_vector<real_t<T>> asum_gold(batch_count);
+        host_vector<T>         dot_gold(batch_count);
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            cblas_asum<T>(N, hx[b], incx, asum_gold + b);
+            cblas_dot<T>(N, hx[b], incx, hx[b], incx, dot_gold + b);
+        }
+        unit_check_general<real_t<T>>(1, batch_count, 1, asum_gold, asum);
+        unit_check_general<T>(1, batch_count, 1, dot_gold, dot);
+    }
+
+    // A single vector is finalized on the device
+    real_t<T> nrm2_single = 0;
+    CHECK_ROCBLAS_ERROR(rocblas_nrm2_fn(handle, N, dx, incx, &nrm2_single));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    real_t<T> abs_error = 2 * std::numeric_limits<real_t<T>>::epsilon() * N * nrm2_ref[0];
+    near_check_general<real_t<T>, real_t<T>>(1, 1, 1, nrm2_ref, &nrm2_single, abs_error);
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_deferred_host_results(handle, false));
+}
@@ -0,0 +1,437 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "rocblas.hpp"
+#include "rocblas_device.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <cctype>
+
+// User kernels built on the device API of rocblas_device.hpp, with thread blocks of
+// device_api_nb threads and gemm tiles of device_api_tile_m by device_api_tile_n
+constexpr int device_api_nb     = 256;
+constexpr int device_api_tile_m = 32;
+constexpr int device_api_tile_n = 32;
+constexpr int device_api_tile_k = 8;
+
+constexpr int device_api_lds_elements
+    = rocblas_device::gemm_tile_lds_elements<device_api_tile_m,
+                                             device_api_tile_n,
+                                             device_api_tile_k>;
+
+template <int WF, bool CONJ, typename T>
+__global__ __launch_bounds__(WF) void device_api_dot_wavefront_kernel(int      n,
+                                                                      const T* x,
+                                                                      const T* y,
+                                                                      T*       result)
+{
+    result[threadIdx.x] = rocblas_device::dot_wavefront<WF, CONJ>(n, x, 1, y, 1);
+}
+
+template <int WF, bool CONJ, typename T>
+__global__ __launch_bounds__(device_api_nb) void device_api_dot_block_kernel(int      n,
+                                                                             const T* x,
+                                                                             const T* y,
+                                                                             T*       result)
+{
+    __shared__ T lds[device_api_nb / WF];
+    T            dot = rocblas_device::dot_block<device_api_nb, WF, CONJ>(n, x, 1, y, 1, lds);
+    if(threadIdx.x == 0)
+        *result = dot;
+}
+
+template <int WF, char TRANS, typename T>
+__global__ __launch_bounds__(device_api_nb) void device_api_gemv_kernel(
+    int m, int n, T alpha, const T* A, int lda, const T* x, T beta, T* y)
+{
+    if constexpr(TRANS == 'N')
+        rocblas_device::gemv_tile<device_api_nb>(m, n, alpha, A, lda, x, 1, beta, y, 1);
+    else
+        rocblas_device::gemv_t_tile<device_api_nb, WF, TRANS == 'C'>(
+            m, n, alpha, A, lda, x, 1, beta, y, 1);
+}
+
+template <bool TRANS_A, bool TRANS_B, typename T>
+__global__ __launch_bounds__(device_api_nb) void device_api_gemm_kernel(int      m,
+                                                                        int      n,
+                                                                        int      k,
+                                                                        T        alpha,
+                                                                        const T* A,
+                                                                        int      lda,
+                                                                        const T* B,
+                                                                        int      ldb,
+                                                                        T        beta,
+                                                                        T*       C,
+                                                                        int      ldc)
+{
+    __shared__ T lds[device_api_lds_elements];
+    rocblas_device::gemm_tile<device_api_tile_m,
+                              device_api_tile_n,
+                              device_api_tile_k,
+                              device_api_nb,
+                              TRANS_A,
+                              TRANS_B>(m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, lds);
+}
+
+// The building blocks must give the exact results of the host reference on small integers.
+// transA selects the dot products and gemv tile: N for dot_wavefront, dot_block and gemv_tile,
+// T for the same dot products and gemv_t_tile, and C for the conjugated dot products and
+// gemv_t_tile. transA and transB select the transposes of gemm_tile, which has no conjugate
+// transpose, so C is applied as T.
+template <typename T, int WF>
+void testing_device_api_wavefront(const Arguments& arg)
+{
+    char transA = char(toupper(arg.transA));
+    char transB = char(toupper(arg.transB));
+    bool conj   = transA == 'C';
+
+    int M = arg.M;
+    int N = arg.N;
+    int K = arg.K;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // gemv computes y := alpha * op(A) * x + beta * y for the M by N matrix A
+    int x_size = transA == 'N' ? N : M;
+    int y_size = transA == 'N' ? M : N;
+
+    // gemm computes a partial m by n tile of C := alpha * op(A) * op(B) + beta * C
+    int m     = std::min(M, device_api_tile_m);
+    int n     = std::min(N, device_api_tile_n);
+    int A_row = transA == 'N' ? m : K;
+    int A_col = transA == 'N' ? K : m;
+    int B_row = transB == 'N' ? K : n;
+    int B_col = transB == 'N' ? n : K;
+    int lda_g = std::max(A_row, 1);
+    int ldb_g = std::max(B_row, 1);
+    int ldc_g = std::max(m, 1);
+
+    // Naming: `h` is in CPU (host) memory(eg hy_1), `d` is in GPU (device) memory (eg dy).
+    // Allocate host memory
+    host_vector<T> hx(N);
+    host_vector<T> hy(N);
+    host_vector<T> hresult(WF);
+    host_vector<T> hresult_gold(WF);
+    host_matrix<T> hA(M, N, std::max(M, 1));
+    host_vector<T> hv(x_size);
+    host_vector<T> hw(y_size);
+    host_vector<T> hw_1(y_size);
+    host_vector<T> hw_gold(y_size);
+    host_matrix<T> hGA(A_row, A_col, lda_g);
+    host_matrix<T> hGB(B_row, B_col, ldb_g);
+    host_matrix<T> hC(m, n, ldc_g);
+    host_matrix<T> hC_1(m, n, ldc_g);
+    host_matrix<T> hC_gold(m, n, ldc_g);
+
+    // Allocate device memory
+    device_vector<T> dx(N);
+    device_vector<T> dy(N);
+    device_vector<T> dresult(WF);
+    device_matrix<T> dA(M, N, std::max(M, 1));
+    device_vector<T> dv(x_size);
+    device_vector<T> dw(y_size);
+    device_matrix<T> dGA(A_row, A_col, lda_g);
+    device_matrix<T> dGB(B_row, B_col, ldb_g);
+    device_matrix<T> dC(m, n, ldc_g);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dresult.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dv.memcheck());
+    CHECK_DEVICE_ALLOCATION(dw.memcheck());
+    CHECK_DEVICE_ALLOCATION(dGA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dGB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_never_set_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_never_set_nan, false, true);
+    rocblas_init_matrix(hA, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+    rocblas_init_vector(hv, arg, rocblas_client_never_set_nan, false, true);
+    rocblas_init_vector(hw, arg, rocblas_client_never_set_nan);
+    rocblas_init_matrix(hGA, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+    rocblas_init_matrix(
+        hGB, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dv.transfer_from(hv));
+    CHECK_HIP_ERROR(dGA.transfer_from(hGA));
+    CHECK_HIP_ERROR(dGB.transfer_from(hGB));
+
+    auto gemm = [&]() {
+        if(transA == 'N' && transB == 'N')
+            hipLaunchKernelGGL((device_api_gemm_kernel<false, false, T>),
+                               1,
+                               device_api_nb,
+                               0,
+                               0,
+                               m,
+                               n,
+                               K,
+                               h_alpha,
+                               dGA,
+                               lda_g,
+                               dGB,
+                               ldb_g,
+                               h_beta,
+                               dC,
+                               ldc_g);
+        else if(transA == 'N')
+            hipLaunchKernelGGL((device_api_gemm_kernel<false, true, T>),
+                               1,
+                               device_api_nb,
+                               0,
+                               0,
+                               m,
+                               n,
+                               K,
+                               h_alpha,
+                               dGA,
+                               lda_g,
+                               dGB,
+                               ldb_g,
+                               h_beta,
+                               dC,
+                               ldc_g);
+        else if(transB == 'N')
+            hipLaunchKernelGGL((device_api_gemm_kernel<true, false, T>),
+                               1,
+                               device_api_nb,
+                               0,
+                               0,
+                               m,
+                               n,
+                               K,
+                               h_alpha,
+                               dGA,
+                               lda_g,
+                               dGB,
+                               ldb_g,
+                               h_beta,
+                               dC,
+                               ldc_g);
+        else
+            hipLaunchKernelGGL((device_api_gemm_kernel<true, true, T>),
+                               1,
+                               device_api_nb,
+                               0,
+                               0,
+                               m,
+                               n,
+                               K,
+                               h_alpha,
+                               dGA,
+                               lda_g,
+                               dGB,
+                               ldb_g,
+                               h_beta,
+                               dC,
+                               ldc_g);
+    };
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // CPU reference
+        cpu_time_used = get_time_us_no_sync();
+
+        T dot_gold(0);
+        for(int i = 0; i < N; i++)
+            dot_gold += (conj ? conjugate(hx[i]) : hx[i]) * hy[i];
+
+        const T* A = hA;
+        for(int i = 0; i < y_size; i++)
+        {
+            T sum(0);
+            for(int j = 0; j < x_size; j++)
+            {
+                T a = transA == 'N' ? A[i + size_t(j) * hA.lda()] : A[j + size_t(i) * hA.lda()];
+                sum += (conj ? conjugate(a) : a) * hv[j];
+            }
+            hw_gold[i] = h_alpha * sum + h_beta * hw[i];
+        }
+
+        const T* GA = hGA;
+        const T* GB = hGB;
+        const T* C  = hC;
+        T*       CG = hC_gold;
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < m; i++)
+            {
+                T sum(0);
+                for(int l = 0; l < K; l++)
+                {
+                    T a = transA == 'N' ? GA[i + size_t(l) * lda_g] : GA[l + size_t(i) * lda_g];
+                    T b = transB == 'N' ? GB[l + size_t(j) * ldb_g] : GB[j + size_t(l) * ldb_g];
+                    sum += a * b;
+                }
+                CG[i + size_t(j) * ldc_g] = h_alpha * sum + h_beta * C[i + size_t(j) * ldc_g];
+            }
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // dot: every lane of the wavefront gets the sum
+        for(int lane = 0; lane < WF; lane++)
+            hresult_gold[lane] = dot_gold;
+
+        if(conj)
+            hipLaunchKernelGGL(
+                (device_api_dot_wavefront_kernel<WF, true, T>), 1, WF, 0, 0, N, dx, dy, dresult);
+        else
+            hipLaunchKernelGGL(
+                (device_api_dot_wavefront_kernel<WF, false, T>), 1, WF, 0, 0, N, dx, dy, dresult);
+        CHECK_HIP_ERROR(hipGetLastError());
+        CHECK_HIP_ERROR(hresult.transfer_from(dresult));
+        unit_check_general<T>(1, WF, 1, hresult_gold, hresult);
+
+        if(conj)
+            hipLaunchKernelGGL((device_api_dot_block_kernel<WF, true, T>),
+                               1,
+                               device_api_nb,
+                               0,
+                               0,
+                               N,
+                               dx,
+                               dy,
+                               dresult);
+        else
+            hipLaunchKernelGGL((device_api_dot_block_kernel<WF, false, T>),
+                               1,
+                               device_api_nb,
+                               0,
+                               0,
+                               N,
+                               dx,
+                               dy,
+                               dresult);
+        CHECK_HIP_ERROR(hipGetLastError());
+        CHECK_HIP_ERROR(hresult.transfer_from(dresult));
+        unit_check_general<T>(1, 1, 1, hresult_gold, hresult);
+
+        // gemv
+        CHECK_HIP_ERROR(dw.transfer_from(hw));
+        if(transA == 'N')
+            hipLaunchKernelGGL((device_api_gemv_kernel<WF, 'N', T>),
+                               1,
+                               device_api_nb,
+                               0,
+                               0,
+                               M,
+                               N,
+                               h_alpha,
+                               dA,
+                               int(hA.lda()),
+                               dv,
+                               h_beta,
+                               dw);
+        else if(transA == 'T')
+            hipLaunchKernelGGL((device_api_gemv_kernel<WF, 'T', T>),
+                               1,
+                               device_api_nb,
+                               0,
+                               0,
+                               M,
+                               N,
+                               h_alpha,
+                               dA,
+                               int(hA.lda()),
+                               dv,
+                               h_beta,
+                               dw);
+        else
+            hipLaunchKernelGGL((device_api_gemv_kernel<WF, 'C', T>),
+                               1,
+                               device_api_nb,
+                               0,
+                               0,
+                               M,
+                               N,
+                               h_alpha,
+                               dA,
+                               int(hA.lda()),
+                               dv,
+                               h_beta,
+                               dw);
+        CHECK_HIP_ERROR(hipGetLastError());
+        CHECK_HIP_ERROR(hw_1.transfer_from(dw));
+        unit_check_general<T>(1, y_size, 1, hw_gold, hw_1);
+
+        // gemm
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        gemm();
+        CHECK_HIP_ERROR(hipGetLastError());
+        CHECK_HIP_ERROR(hC_1.transfer_from(dC));
+        unit_check_general<T>(m, n, ldc_g, hC_gold, hC_1);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+            gemm();
+
+        gpu_time_used = get_time_us_hot_calls(0, number_hot_calls, [&] { gemm(); });
+
+        ArgumentModel<e_transA, e_transB, e_M, e_N, e_K>{}.log_args<T>(rocblas_cout,
+                                                                       arg,
+                                                                       gpu_time_used,
+                                                                       gemm_gflop_count<T>(m, n, K),
+                                                                       gemm_gbyte_count<T>(m, n, K),
+                                                                       cpu_time_used,
+                                                                       ArgumentLogging::NA_value);
+    }
+}
+
+template <typename T>
+void testing_device_api(const Arguments& arg)
+{
+    int             device;
+    hipDeviceProp_t props;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    CHECK_HIP_ERROR(hipGetDeviceProperties(&props, device));
+
+    if(props.warpSize == 32)
+        testing_device_api_wavefront<T, 32>(arg);
+    else
+        testing_device_api_wavefront<T, 64>(arg);
+}
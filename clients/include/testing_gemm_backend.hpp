@@ -0,0 +1,324 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_gemm_backend_bad_arg(const Arguments&)
+{
+    // A new handle selects the default backend, whatever rocblas-bench selects for its handles
+    rocblas_handle handle;
+    CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+    rocblas_gemm_backend backend = rocblas_gemm_backend_source;
+    CHECK_ROCBLAS_ERROR(rocblas_get_gemm_backend(handle, &backend));
+    EXPECT_EQ(backend, rocblas_gemm_backend_default);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_backend(handle, rocblas_gemm_backend(3)),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_backend(nullptr, rocblas_gemm_backend_source),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_gemm_backend(nullptr, &backend),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_gemm_backend(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+}
+
+// Each GEMM backend must give the results of the host, which the integer initialization keeps
+// exact whatever the order of the sums, including for the degenerate and tall and skinny shapes
+// which the default backend runs with other kernels. The source kernels load device alpha and
+// beta themselves, and the default backend uses them for device scalars in graph safe mode.
+template <typename T>
+void testing_gemm_backend(const Arguments& arg)
+{
+    auto rocblas_gemm_strided_batched_fn = arg.fortran ? rocblas_gemm_strided_batched<T, true>
+                                                       : rocblas_gemm_strided_batched<T, false>;
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+
+    rocblas_stride stride_a    = arg.stride_a;
+    rocblas_stride stride_b    = arg.stride_b;
+    rocblas_stride stride_c    = arg.stride_c;
+    rocblas_int    batch_count = arg.batch_count;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : std::max(K, 1);
+    rocblas_int A_col = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : std::max(K, 1);
+
+    // check here to prevent undefined memory allocation error
+    // Note: K==0 is not an early exit, since C must still be multiplied by beta
+    bool invalid_size
+        = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_strided_batched_fn(handle,
+                                                              transA,
+                                                              transB,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              nullptr,
+                                                              nullptr,
+                                                              lda,
+                                                              stride_a,
+                                                              nullptr,
+                                                              ldb,
+                                                              stride_b,
+                                                              nullptr,
+                                                              nullptr,
+                                                              ldc,
+                                                              stride_c,
+                                                              batch_count),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error = 0.0;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_strided_batch_matrix<T> hA(A_row, A_col, lda, stride_a, batch_count);
+    host_strided_batch_matrix<T> hB(B_row, B_col, ldb, stride_b, batch_count);
+    host_strided_batch_matrix<T> hC(M, N, ldc, stride_c, batch_count);
+    host_strided_batch_matrix<T> hC_1(M, N, ldc, stride_c, batch_count);
+    host_strided_batch_matrix<T> hC_gold(M, N, ldc, stride_c, batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hC.memcheck());
+    CHECK_HIP_ERROR(hC_1.memcheck());
+    CHECK_HIP_ERROR(hC_gold.memcheck());
+
+    // Allocate device memory
+    device_strided_batch_matrix<T> dA(A_row, A_col, lda, stride_a, batch_count);
+    device_strided_batch_matrix<T> dB(B_row, B_col, ldb, stride_b, batch_count);
+    device_strided_batch_matrix<T> dC(M, N, ldc, stride_c, batch_count);
+    device_vector<T>               d_alpha(1);
+    device_vector<T>               d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    auto rocblas_gemm_backend_fn = [&](const T* alpha, const T* beta) {
+        return rocblas_gemm_strided_batched_fn(handle,
+                                               transA,
+                                               transB,
+                                               M,
+                                               N,
+                                               K,
+                                               alpha,
+                                               dA,
+                                               lda,
+                                               stride_a,
+                                               dB,
+                                               ldb,
+                                               stride_b,
+                                               beta,
+                                               dC,
+                                               ldc,
+                                               stride_c,
+                                               batch_count);
+    };
+
+    // The backend of the handle, which rocblas-bench selects with --backend
+    rocblas_gemm_backend handle_backend;
+    CHECK_ROCBLAS_ERROR(rocblas_get_gemm_backend(handle, &handle_backend));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        static const rocblas_gemm_backend backends[] = {
+            rocblas_gemm_backend_default,
+#if BUILD_WITH_TENSILE
+            rocblas_gemm_backend_tensile,
+#endif
+            rocblas_gemm_backend_source,
+        };
+
+        // The source kernels also handle zero alpha and beta on the device
+        const T scalars[][2] = {{h_alpha, h_beta}, {T(0), h_beta}, {h_alpha, T(0)}};
+
+        for(auto& scalar : scalars)
+        {
+            // CPU BLAS
+            hC_gold.copy_from(hC);
+            double cpu_time_start = get_time_us_no_sync();
+#pragma omp parallel for
+            for(rocblas_int b = 0; b < batch_count; b++)
+            {
+                cblas_gemm<T>(transA,
+                              transB,
+                              M,
+                              N,
+                              K,
+                              scalar[0],
+                              hA[b],
+                              lda,
+                              hB[b],
+                              ldb,
+                              scalar[1],
+                              hC_gold[b],
+                              ldc);
+            }
+            cpu_time_used += get_time_us_no_sync() - cpu_time_start;
+
+            CHECK_HIP_ERROR(hipMemcpy(d_alpha, &scalar[0], sizeof(T), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(d_beta, &scalar[1], sizeof(T), hipMemcpyHostToDevice));
+
+            auto check_result = [&] {
+                CHECK_HIP_ERROR(hC_1.transfer_from(dC));
+
+                if(arg.unit_check)
+                    unit_check_general<T>(M, N, ldc, stride_c, hC_gold, hC_1, batch_count);
+
+                if(arg.norm_check)
+                {
+                    auto error    = std::abs(norm_check_general('F', hC_gold, hC_1));
+                    rocblas_error = error > rocblas_error ? error : rocblas_error;
+                }
+            };
+
+            for(auto backend : backends)
+            {
+                rocblas_gemm_backend selected = rocblas_gemm_backend(3);
+                CHECK_ROCBLAS_ERROR(rocblas_set_gemm_backend(handle, backend));
+                CHECK_ROCBLAS_ERROR(rocblas_get_gemm_backend(handle, &selected));
+                EXPECT_EQ(selected, backend);
+
+                // ROCBLAS rocblas_pointer_mode_host
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+                CHECK_HIP_ERROR(dC.transfer_from(hC));
+                handle.pre_test(arg);
+                CHECK_ROCBLAS_ERROR(rocblas_gemm_backend_fn(&scalar[0], &scalar[1]));
+                handle.post_test(arg);
+                check_result();
+
+                // ROCBLAS rocblas_pointer_mode_device, also in graph safe mode, in which the
+                // scalars cannot be copied to the host
+                for(bool graph_safe : {false, true})
+                {
+                    CHECK_ROCBLAS_ERROR(rocblas_set_graph_safe_mode(handle, graph_safe));
+                    CHECK_ROCBLAS_ERROR(
+                        rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+                    CHECK_HIP_ERROR(dC.transfer_from(hC));
+                    CHECK_ROCBLAS_ERROR(rocblas_gemm_backend_fn(d_alpha, d_beta));
+                    CHECK_ROCBLAS_ERROR(rocblas_set_graph_safe_mode(handle, false));
+                    check_result();
+                }
+            }
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_set_gemm_backend(handle, handle_backend));
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_gemm_backend_fn(&h_alpha, &h_beta);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(
+            stream, number_hot_calls, [&] { rocblas_gemm_backend_fn(&h_alpha, &h_beta); });
+
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_stride_a,
+                      e_beta,
+                      e_ldb,
+                      e_stride_b,
+                      e_ldc,
+                      e_stride_c,
+                      e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemm_gflop_count<T>(M, N, K),
+                         gemm_gbyte_count<T>(M, N, K),
+                         cpu_time_used,
+                         rocblas_error);
+    }
+}
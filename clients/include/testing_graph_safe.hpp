@@ -0,0 +1,343 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_graph_safe_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    bool graph_safe;
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_graph_safe_mode(nullptr, true),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_graph_safe_mode(nullptr, &graph_safe),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_graph_safe_mode(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    rocblas_int N = 100;
+
+    device_matrix<T>         dA(N, N, N);
+    device_matrix<T>         dB(N, N, N);
+    device_vector<T>         dx(N);
+    device_vector<T>         d_alpha(1);
+    device_vector<real_t<T>> d_nrm2(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_nrm2.memcheck());
+
+    // Functions which would have to synchronize fail instead in graph safe mode
+    CHECK_ROCBLAS_ERROR(rocblas_set_graph_safe_mode(handle, true));
+
+    // A pageable host result cannot be written by a stream ordered copy
+    real_t<T> nrm2_pageable = 0;
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    EXPECT_ROCBLAS_STATUS(rocblas_nrm2<T>(handle, N, dx, 1, &nrm2_pageable),
+                          rocblas_status_not_implemented);
+
+    // Device scalars which are read on the host
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm<T>(handle,
+                                          rocblas_operation_none,
+                                          rocblas_operation_none,
+                                          N,
+                                          N,
+                                          N,
+                                          d_alpha,
+                                          dA,
+                                          N,
+                                          dB,
+                                          N,
+                                          d_alpha,
+                                          dB,
+                                          N),
+                          rocblas_status_not_implemented);
+    EXPECT_ROCBLAS_STATUS(rocblas_trsm<T>(handle,
+                                          rocblas_side_left,
+                                          rocblas_fill_lower,
+                                          rocblas_operation_none,
+                                          rocblas_diagonal_non_unit,
+                                          N,
+                                          N,
+                                          d_alpha,
+                                          dA,
+                                          N,
+                                          dB,
+                                          N),
+                          rocblas_status_not_implemented);
+}
+
+// gemv, dot, nrm2, gemm and trsm are captured into a HIP graph in graph safe mode. Every call
+// writes its own output, so each replay of the graph must reproduce the results of a direct run.
+template <typename T>
+void testing_graph_safe(const Arguments& arg)
+{
+    using Tr = real_t<T>;
+
+    rocblas_int  N       = arg.N;
+    rocblas_fill uplo    = char2rocblas_fill(arg.uplo);
+    T            h_alpha = arg.get_alpha<T>();
+    T            h_zero  = T(0);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    // Reductions without atomics give the same results in every run
+    CHECK_ROCBLAS_ERROR(rocblas_set_atomics_mode(handle, rocblas_atomics_not_allowed));
+
+    // The legacy default stream cannot be captured
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_matrix<T> hA(N, N, N);
+    host_matrix<T> hB(N, N, N);
+    host_vector<T> hx(N);
+
+    // Allocate device memory for the inputs
+    device_matrix<T> dA(N, N, N);
+    device_matrix<T> dB(N, N, N);
+    device_vector<T> dx(N);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+
+    // A is diagonally dominant, so that triangular solves with it are well conditioned
+    rocblas_init_matrix(hA,
+                        arg,
+                        rocblas_client_never_set_nan,
+                        rocblas_client_diagonally_dominant_triangular_matrix,
+                        true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_vector(hx, arg, rocblas_client_never_set_nan);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    // Outputs of a direct run and of the graph
+    device_vector<T>      dy_ref(N), dy(N);
+    device_matrix<T>      dC_ref(N, N, N), dC(N, N, N);
+    device_matrix<T>      dX_ref(N, N, N), dX(N, N, N);
+    device_vector<Tr>     d_nrm2_ref(1), d_nrm2(1);
+    host_pinned_vector<T> h_dot_ref(1), h_dot(1);
+    CHECK_DEVICE_ALLOCATION(dy_ref.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_ref.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dX_ref.memcheck());
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_nrm2_ref.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_nrm2.memcheck());
+
+    auto run = [&](T* y, Tr* nrm2, T* dot, T* C, T* X) {
+        CHECK_ROCBLAS_ERROR(rocblas_gemv<T>(
+            handle, rocblas_operation_none, N, N, &h_alpha, dA, N, dx, 1, &h_zero, y, 1));
+        CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, dx, 1, y, 1, dot));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_nrm2<T>(handle, N, y, 1, nrm2));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        CHECK_ROCBLAS_ERROR(rocblas_gemm<T>(handle,
+                                            rocblas_operation_none,
+                                            rocblas_operation_none,
+                                            N,
+                                            N,
+                                            N,
+                                            &h_alpha,
+                                            dA,
+                                            N,
+                                            dB,
+                                            N,
+                                            &h_zero,
+                                            C,
+                                            N));
+
+        CHECK_HIP_ERROR(
+            hipMemcpyAsync(X, dB, sizeof(T) * size_t(N) * N, hipMemcpyDeviceToDevice, stream));
+        CHECK_ROCBLAS_ERROR(rocblas_trsm<T>(handle,
+                                            rocblas_side_left,
+                                            uplo,
+                                            rocblas_operation_none,
+                                            rocblas_diagonal_non_unit,
+                                            N,
+                                            N,
+                                            &h_alpha,
+                                            dA,
+                                            N,
+                                            X,
+                                            N));
+    };
+
+    bool graph_safe = true;
+    CHECK_ROCBLAS_ERROR(rocblas_get_graph_safe_mode(handle, &graph_safe));
+    EXPECT_FALSE(graph_safe);
+
+    run(dy_ref, d_nrm2_ref, h_dot_ref, dC_ref, dX_ref);
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_graph_safe_mode(handle, true));
+    CHECK_ROCBLAS_ERROR(rocblas_get_graph_safe_mode(handle, &graph_safe));
+    EXPECT_TRUE(graph_safe);
+
+    hipGraph_t     graph;
+    hipGraphExec_t graph_exec;
+    CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    run(dy, d_nrm2, h_dot, dC, dX);
+    CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+    CHECK_HIP_ERROR(hipGraphInstantiate(&graph_exec, graph, nullptr, nullptr, 0));
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        host_vector<T>  hy_ref(N), hy(N), hy_gold(N);
+        host_matrix<T>  hC_ref(N, N, N), hC(N, N, N), hC_gold(N, N, N);
+        host_matrix<T>  hX_ref(N, N, N), hX(N, N, N);
+        host_vector<Tr> h_nrm2_ref(1), h_nrm2(1);
+        T               cpu_dot;
+
+        CHECK_HIP_ERROR(hy_ref.transfer_from(dy_ref));
+        CHECK_HIP_ERROR(hC_ref.transfer_from(dC_ref));
+        CHECK_HIP_ERROR(hX_ref.transfer_from(dX_ref));
+        CHECK_HIP_ERROR(h_nrm2_ref.transfer_from(d_nrm2_ref));
+
+        // The direct run is checked against CBLAS
+        cpu_time_used = get_time_us_no_sync();
+        cblas_gemv<T>(rocblas_operation_none, N, N, h_alpha, hA, N, hx, 1, h_zero, hy_gold, 1);
+        cblas_dot<T>(N, hx, 1, hy_gold, 1, &cpu_dot);
+        cblas_gemm<T>(rocblas_operation_none,
+                      rocblas_operation_none,
+                      N,
+                      N,
+                      N,
+                      h_alpha,
+                      hA,
+                      N,
+                      hB,
+                      N,
+                      h_zero,
+                      hC_gold,
+                      N);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        double abs_dot = double(rocblas_abs(cpu_dot));
+        double dot_tol = 2.0 * std::numeric_limits<Tr>::epsilon() * N * std::max(1.0, abs_dot);
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, 1, hy_gold, hy_ref);
+            unit_check_general<T>(N, N, N, hC_gold, hC_ref);
+            near_check_general<T>(1, 1, 1, &cpu_dot, h_dot_ref, dot_tol);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error = norm_check_general<T>('F', 1, N, 1, hy_gold, hy_ref);
+            rocblas_error += norm_check_general<T>('F', N, N, N, hC_gold, hC_ref);
+        }
+
+        // Each replay recomputes the same results
+        for(int replay = 0; replay < 2; replay++)
+        {
+            h_dot[0] = T(0);
+            CHECK_HIP_ERROR(hipGraphLaunch(graph_exec, stream));
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+            CHECK_HIP_ERROR(hy.transfer_from(dy));
+            CHECK_HIP_ERROR(hC.transfer_from(dC));
+            CHECK_HIP_ERROR(hX.transfer_from(dX));
+            CHECK_HIP_ERROR(h_nrm2.transfer_from(d_nrm2));
+
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(1, N, 1, hy_ref, hy);
+                unit_check_general<T>(N, N, N, hC_ref, hC);
+                unit_check_general<T>(N, N, N, hX_ref, hX);
+                unit_check_general<Tr>(1, 1, 1, h_nrm2_ref, h_nrm2);
+                unit_check_general<T>(1, 1, 1, h_dot_ref, h_dot);
+            }
+
+            if(arg.norm_check)
+            {
+                rocblas_error += norm_check_general<T>('F', N, N, N, hX_ref, hX);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            hipGraphLaunch(graph_exec, stream);
+        }
+
+        gpu_time_used = get_time_us_hot_calls(
+            stream, number_hot_calls, [&] { hipGraphLaunch(graph_exec, stream); });
+
+        ArgumentModel<e_N, e_alpha, e_uplo>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            gemv_gflop_count<T>(rocblas_operation_none, N, N) + gemm_gflop_count<T>(N, N, N)
+                + trsm_gflop_count<T>(N, N, N),
+            gemv_gbyte_count<T>(rocblas_operation_none, N, N) + gemm_gbyte_count<T>(N, N, N),
+            cpu_time_used,
+            rocblas_error);
+    }
+
+    CHECK_HIP_ERROR(hipGraphExecDestroy(graph_exec));
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_graph_safe_mode(handle, false));
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, 0));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
@@ -0,0 +1,220 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "utility.hpp"
+#include <cmath>
+#include <cstring>
+
+// The host conversions between float and T, where only rocblas_bfloat16 can truncate
+template <typename T>
+rocblas_status rocblas_convert_from_float(size_t n, const float* x, T* y, bool truncate);
+
+template <>
+inline rocblas_status rocblas_convert_from_float(size_t            n,
+                                                 const float*      x,
+                                                 rocblas_bfloat16* y,
+                                                 bool              truncate)
+{
+    return rocblas_convert_float_to_bfloat16(n, x, y, truncate);
+}
+
+template <>
+inline rocblas_status
+    rocblas_convert_from_float(size_t n, const float* x, rocblas_half* y, bool truncate)
+{
+    return rocblas_convert_float_to_half(n, x, y);
+}
+
+template <typename T>
+static rocblas_status (*rocblas_convert_to_float)(size_t n, const T* x, float* y);
+
+template <>
+static auto rocblas_convert_to_float<rocblas_bfloat16> = rocblas_convert_bfloat16_to_float;
+template <>
+static auto rocblas_convert_to_float<rocblas_half> = rocblas_convert_half_to_float;
+
+// The element conversion which the bulk conversion must match bit for bit
+template <typename T>
+inline T host_convert_reference(float x, bool truncate)
+{
+    return T(x);
+}
+
+template <>
+inline rocblas_bfloat16 host_convert_reference(float x, bool truncate)
+{
+    return truncate ? float_to_bfloat16_truncate(x) : rocblas_bfloat16(x);
+}
+
+template <typename T>
+void testing_host_convert_bad_arg(const Arguments& arg)
+{
+    const size_t N = 100;
+
+    host_vector<float> x(N), y(N);
+    host_vector<T>     t(N);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_convert_from_float<T>(N, nullptr, t, false),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_convert_from_float<T>(N, x, nullptr, false),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_convert_to_float<T>(N, nullptr, y),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_convert_to_float<T>(N, t, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // If N is 0, nothing is dereferenced
+    EXPECT_ROCBLAS_STATUS(rocblas_convert_from_float<T>(0, nullptr, nullptr, false),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocblas_convert_to_float<T>(0, nullptr, nullptr),
+                          rocblas_status_success);
+}
+
+// The bulk conversions use SIMD instructions with scalar tails, which must give exactly the
+// element conversions, NaN payloads and signs of zeros included
+template <typename T>
+void testing_host_convert(const Arguments& arg)
+{
+    const bool bf16 = std::is_same<T, rocblas_bfloat16>{};
+
+    rocblas_int N = arg.N;
+
+    if(N <= 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_convert_from_float<T>(0, nullptr, nullptr, false),
+                              rocblas_status_success);
+        EXPECT_ROCBLAS_STATUS(rocblas_convert_to_float<T>(0, nullptr, nullptr),
+                              rocblas_status_success);
+        return;
+    }
+
+    host_vector<float> hx(N);
+    host_vector<T>     ht(N);
+    host_vector<T>     ht_gold(N);
+    host_vector<float> hy(N);
+    host_vector<float> hy_gold(N);
+
+    rocblas_seedrand();
+    if(bf16)
+    {
+        // random bit patterns, which include subnormals, infinities and NaNs, with special
+        // values at the start
+        const uint32_t special[] = {0x7f800000,
+                                    0xff800000,
+                                    0x7f800001,
+                                    0x7fc00000,
+                                    0x7f810000,
+                                    0x00000001,
+                                    0x807fffff,
+                                    0x7f7fffff,
+                                    0x3f808000,
+                                    0x3f818000};
+        for(rocblas_int i = 0; i < N; i++)
+        {
+            uint32_t u = size_t(i) < sizeof(special) / sizeof(special[0])
+                             ? special[i]
+                             : uint32_t(t_rocblas_rng());
+            memcpy(&hx[i], &u, sizeof(u));
+        }
+    }
+    else
+    {
+        // finite values across the range of rocblas_half, including subnormals
+        for(rocblas_int i = 0; i < N; i++)
+            hx[i] = std::ldexp(float(t_rocblas_rng() % 2048) - 1023.5f, int(i % 40) - 35);
+    }
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(bool truncate : {false, true})
+        {
+            if(truncate && !bf16)
+                break;
+
+            CHECK_ROCBLAS_ERROR(rocblas_convert_from_float<T>(N, hx, ht, truncate));
+            CHECK_ROCBLAS_ERROR(rocblas_convert_to_float<T>(N, ht, hy));
+
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                ht_gold[i] = host_convert_reference<T>(hx[i], truncate);
+                hy_gold[i] = float(ht[i]);
+            }
+
+            if(arg.unit_check)
+            {
+                for(rocblas_int i = 0; i < N; i++)
+                {
+                    ASSERT_EQ(memcmp(&ht[i], &ht_gold[i], sizeof(T)), 0) << "element " << i;
+                    ASSERT_EQ(memcmp(&hy[i], &hy_gold[i], sizeof(float)), 0) << "element " << i;
+                }
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_convert_from_float<T>(N, hx, ht, false);
+            rocblas_convert_to_float<T>(N, ht, hy);
+        }
+
+        // the conversions run on the host, so both times are host times: that of the bulk
+        // conversions and that of the element conversions they replace
+        gpu_time_used = get_time_us_no_sync();
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_convert_from_float<T>(N, hx, ht, false);
+            rocblas_convert_to_float<T>(N, ht, hy);
+        }
+        gpu_time_used = get_time_us_no_sync() - gpu_time_used;
+
+        cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int i = 0; i < N; i++)
+            ht_gold[i] = T(hx[i]);
+        for(rocblas_int i = 0; i < N; i++)
+            hy_gold[i] = float(ht_gold[i]);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        ArgumentModel<e_N>{}.log_args<T>(rocblas_cout,
+                                         arg,
+                                         gpu_time_used,
+                                         ArgumentLogging::NA_value,
+                                         2.0 * N * (sizeof(float) + sizeof(T)) / 1e9,
+                                         cpu_time_used,
+                                         ArgumentLogging::NA_value);
+    }
+}
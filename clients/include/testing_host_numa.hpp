@@ -0,0 +1,139 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_host_numa_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    int numa_node;
+    EXPECT_ROCBLAS_STATUS(rocblas_get_host_numa_node(nullptr, &numa_node),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_host_numa_node(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+}
+
+// The pageable host matrices are transferred through the pinned staging buffers, which are
+// allocated on the NUMA node of the device
+template <typename T>
+void testing_host_numa(const Arguments& arg)
+{
+    rocblas_int M   = arg.M;
+    rocblas_int N   = arg.N;
+    rocblas_int lda = arg.lda;
+
+    rocblas_local_handle handle{arg};
+
+    // the node is read once per device, so that every handle reports the same one
+    int numa_node = -2, numa_node_2 = -2;
+    CHECK_ROCBLAS_ERROR(rocblas_get_host_numa_node(handle, &numa_node));
+    EXPECT_GE(numa_node, -1);
+    {
+        rocblas_local_handle handle_2{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_get_host_numa_node(handle_2, &numa_node_2));
+    }
+    EXPECT_EQ(numa_node, numa_node_2);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || N < 0 || lda <= 0 || lda < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_set_matrix(M, N, sizeof(T), nullptr, lda, nullptr, lda),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(N * size_t(lda));
+    host_vector<T>   hB(N * size_t(lda));
+    device_vector<T> dA(N * size_t(lda));
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error          = 0.0;
+
+    rocblas_seedrand();
+    rocblas_init<T>(hA, M, N, lda);
+    rocblas_init<T>(hB, M, N, lda);
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_matrix(M, N, sizeof(T), hA, lda, dA, lda));
+        CHECK_ROCBLAS_ERROR(rocblas_get_matrix(M, N, sizeof(T), dA, lda, hB, lda));
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, lda, hA, hB);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error = norm_check_general<T>('F', M, N, lda, hA, hB);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_set_matrix(M, N, sizeof(T), hA, lda, dA, lda);
+            rocblas_get_matrix(M, N, sizeof(T), dA, lda, hB, lda);
+        }
+
+        gpu_time_used = get_time_us_sync_device(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_set_matrix(M, N, sizeof(T), hA, lda, dA, lda);
+            rocblas_get_matrix(M, N, sizeof(T), dA, lda, hB, lda);
+        }
+
+        gpu_time_used = get_time_us_sync_device() - gpu_time_used;
+
+        ArgumentModel<e_M, e_N, e_lda>{}.log_args<T>(rocblas_cout,
+                                                     arg,
+                                                     gpu_time_used,
+                                                     ArgumentLogging::NA_value,
+                                                     set_get_matrix_gbyte_count<T>(M, N),
+                                                     cpu_time_used,
+                                                     rocblas_error);
+    }
+}
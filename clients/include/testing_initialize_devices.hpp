@@ -0,0 +1,194 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <vector>
+
+template <typename T>
+void testing_initialize_devices_bad_arg(const Arguments& arg)
+{
+    int count, current;
+    CHECK_HIP_ERROR(hipGetDeviceCount(&count));
+    CHECK_HIP_ERROR(hipGetDevice(&current));
+
+    int ids[] = {current, count};
+    EXPECT_ROCBLAS_STATUS(rocblas_initialize_devices(ids, 2), rocblas_status_invalid_value);
+    ids[1] = -1;
+    EXPECT_ROCBLAS_STATUS(rocblas_initialize_devices(ids, 2), rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_initialize_devices(ids, -1), rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_initialize_devices(nullptr, 1), rocblas_status_invalid_pointer);
+
+    // If n is 0, ids is not dereferenced
+    EXPECT_ROCBLAS_STATUS(rocblas_initialize_devices(nullptr, 0), rocblas_status_success);
+}
+
+// All devices, with the current device repeated, are initialized at once, without changing the
+// current device, and a gemm then runs on each of them
+template <typename T>
+void testing_initialize_devices(const Arguments& arg)
+{
+    rocblas_int M       = arg.M;
+    rocblas_int N       = arg.N;
+    rocblas_int K       = arg.K;
+    rocblas_int lda     = M;
+    rocblas_int ldb     = K;
+    rocblas_int ldc     = M;
+    T           h_alpha = arg.get_alpha<T>();
+    T           h_beta  = arg.get_beta<T>();
+
+    int count, current;
+    CHECK_HIP_ERROR(hipGetDeviceCount(&count));
+    CHECK_HIP_ERROR(hipGetDevice(&current));
+
+    std::vector<int> ids;
+    for(int id = 0; id < count; ++id)
+        ids.push_back(id);
+    ids.push_back(current);
+
+    double gpu_time_used = get_time_us_no_sync();
+    CHECK_ROCBLAS_ERROR(rocblas_initialize_devices(ids.data(), int(ids.size())));
+    gpu_time_used = get_time_us_no_sync() - gpu_time_used;
+
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    EXPECT_EQ(device, current);
+
+    // Initializing again does nothing
+    CHECK_ROCBLAS_ERROR(rocblas_initialize_devices(ids.data(), int(ids.size())));
+
+    // Naming: `h` is in CPU (host) memory(eg hC_1), `d` is in GPU (device) memory (eg dC).
+    // Allocate host memory
+    host_matrix<T> hA(M, K, lda);
+    host_matrix<T> hB(K, N, ldb);
+    host_matrix<T> hC(M, N, ldc);
+    host_matrix<T> hC_1(M, N, ldc);
+    host_matrix<T> hC_gold(M, N, ldc);
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    double cpu_time_used   = 0.0;
+    double rocblas_error_1 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        hC_gold = hC;
+        cblas_gemm<T>(rocblas_operation_none,
+                      rocblas_operation_none,
+                      M,
+                      N,
+                      K,
+                      h_alpha,
+                      hA,
+                      lda,
+                      hB,
+                      ldb,
+                      h_beta,
+                      hC_gold,
+                      ldc);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        for(int id = 0; id < count; ++id)
+        {
+            CHECK_HIP_ERROR(hipSetDevice(id));
+            {
+                rocblas_local_handle handle{arg};
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+                // Allocate device memory on device id
+                device_matrix<T> dA(M, K, lda);
+                device_matrix<T> dB(K, N, ldb);
+                device_matrix<T> dC(M, N, ldc);
+
+                // Check device memory allocation
+                CHECK_DEVICE_ALLOCATION(dA.memcheck());
+                CHECK_DEVICE_ALLOCATION(dB.memcheck());
+                CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+                CHECK_HIP_ERROR(dA.transfer_from(hA));
+                CHECK_HIP_ERROR(dB.transfer_from(hB));
+                CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+                handle.pre_test(arg);
+                CHECK_ROCBLAS_ERROR(rocblas_gemm<T>(handle,
+                                                    rocblas_operation_none,
+                                                    rocblas_operation_none,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    &h_alpha,
+                                                    dA,
+                                                    lda,
+                                                    dB,
+                                                    ldb,
+                                                    &h_beta,
+                                                    dC,
+                                                    ldc));
+                handle.post_test(arg);
+
+                CHECK_HIP_ERROR(hC_1.transfer_from(dC));
+            }
+
+            if(arg.unit_check)
+                unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+
+            if(arg.norm_check)
+                rocblas_error_1 = std::max(
+                    rocblas_error_1, double(norm_check_general<T>('F', M, N, ldc, hC_gold, hC_1)));
+        }
+        CHECK_HIP_ERROR(hipSetDevice(current));
+    }
+
+    // The initialization happens once per process, so its time is of the first call only
+    if(arg.timing)
+    {
+        ArgumentModel<e_M, e_N, e_K>{}.log_args<T>(rocblas_cout,
+                                                   arg,
+                                                   gpu_time_used,
+                                                   ArgumentLogging::NA_value,
+                                                   ArgumentLogging::NA_value,
+                                                   cpu_time_used,
+                                                   rocblas_error_1);
+    }
+}
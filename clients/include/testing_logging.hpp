@@ -1198,3 +1198,77 @@ void testing_logging(const Arguments& arg)
         }
     }
 }
+
+template <typename T>
+void testing_logging_sampling(const Arguments& arg)
+{
+    // log the traces of the scal calls to a file
+    static std::string tmp_dir      = rocblas_tempname();
+    const fs::path     trace_fspath = tmp_dir + std::string("trace_sampled_")
+                                      + std::string(precision_letter<T>) + std::string(".csv");
+    std::string        trace_path   = trace_fspath.generic_string();
+
+    int setenv_status = setenv("ROCBLAS_LAYER", "1", true)
+                        | setenv("ROCBLAS_LOG_TRACE_PATH", trace_path.c_str(), true);
+
+#ifdef GOOGLE_TEST
+    ASSERT_EQ(setenv_status, 0);
+#endif
+
+    const rocblas_int n     = 1;
+    const T           alpha = 1.0;
+    device_vector<T>  dx(n);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+
+    const int calls = 24;
+    {
+        rocblas_local_handle handle;
+        setenv_status = setenv("ROCBLAS_LAYER", "0", true);
+
+        rocblas_int sample_every, max_per_second;
+        CHECK_ROCBLAS_ERROR(rocblas_get_log_sampling(handle, &sample_every, &max_per_second));
+#ifdef GOOGLE_TEST
+        ASSERT_EQ(setenv_status, 0);
+        EXPECT_EQ(sample_every, 1);
+        EXPECT_EQ(max_per_second, 0);
+#endif
+        EXPECT_ROCBLAS_STATUS(rocblas_set_log_sampling(handle, -1, 0),
+                              rocblas_status_invalid_value);
+        EXPECT_ROCBLAS_STATUS(rocblas_set_log_sampling(handle, 1, -1),
+                              rocblas_status_invalid_value);
+        EXPECT_ROCBLAS_STATUS(rocblas_get_log_sampling(handle, nullptr, &max_per_second),
+                              rocblas_status_invalid_pointer);
+
+        // one call in every 4
+        CHECK_ROCBLAS_ERROR(rocblas_set_log_sampling(handle, 4, 0));
+        CHECK_ROCBLAS_ERROR(rocblas_get_log_sampling(handle, &sample_every, &max_per_second));
+#ifdef GOOGLE_TEST
+        EXPECT_EQ(sample_every, 4);
+#endif
+        for(int i = 0; i < calls; i++)
+            CHECK_ROCBLAS_ERROR(rocblas_scal<T>(handle, n, &alpha, dx, 1));
+
+        // at most 2 calls per second, so at most 4 in the two seconds the calls may span
+        CHECK_ROCBLAS_ERROR(rocblas_set_log_sampling(handle, 1, 2));
+        for(int i = 0; i < calls; i++)
+            CHECK_ROCBLAS_ERROR(rocblas_scal<T>(handle, n, &alpha, dx, 1));
+    }
+
+#ifdef WIN32
+    rocblas_internal_ostream::clear_workers();
+#endif
+
+    std::ifstream trace(trace_path);
+    std::string   line;
+    int           logged = 0;
+    while(std::getline(trace, line))
+        logged += line.rfind(replaceX<T>("rocblas_Xscal,"), 0) == 0;
+    trace.close();
+
+#ifdef GOOGLE_TEST
+    EXPECT_GE(logged, calls / 4);
+    EXPECT_LE(logged, calls / 4 + 4);
+#endif
+
+    fs::remove(trace_fspath);
+}
@@ -0,0 +1,314 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_managed_prefetch_bad_arg(const Arguments&)
+{
+    // A new handle does not prefetch, whatever rocblas-bench selects for its handles
+    rocblas_handle handle;
+    CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+    bool prefetch = true;
+    CHECK_ROCBLAS_ERROR(rocblas_get_managed_prefetch(handle, &prefetch));
+    EXPECT_FALSE(prefetch);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_managed_prefetch(nullptr, true),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_managed_prefetch(nullptr, &prefetch),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_managed_prefetch(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+}
+
+// gemm and gemm_strided_batched on matrices in managed memory, written by the host, with
+// managed prefetching enabled must give the results computed from device memory without it
+template <typename T>
+void testing_managed_prefetch(const Arguments& arg)
+{
+    auto rocblas_gemm_fn = arg.fortran ? rocblas_gemm<T, true> : rocblas_gemm<T, false>;
+
+    auto rocblas_gemm_strided_batched_fn = arg.fortran ? rocblas_gemm_strided_batched<T, true>
+                                                       : rocblas_gemm_strided_batched<T, false>;
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+
+    rocblas_stride stride_a    = arg.stride_a;
+    rocblas_stride stride_b    = arg.stride_b;
+    rocblas_stride stride_c    = arg.stride_c;
+    rocblas_int    batch_count = arg.batch_count;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : std::max(K, 1);
+    rocblas_int A_col = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : std::max(K, 1);
+
+    // check here to prevent undefined memory allocation error
+    // Note: K==0 is not an early exit, since C must still be multiplied by beta
+    bool invalid_size
+        = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_managed_prefetch(handle, true));
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_strided_batched_fn(handle,
+                                                              transA,
+                                                              transB,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              nullptr,
+                                                              nullptr,
+                                                              lda,
+                                                              stride_a,
+                                                              nullptr,
+                                                              ldb,
+                                                              stride_b,
+                                                              nullptr,
+                                                              nullptr,
+                                                              ldc,
+                                                              stride_c,
+                                                              batch_count),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error = 0.0;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA), and `m`
+    // is in managed memory (eg mA).
+    // Allocate host memory
+    host_strided_batch_matrix<T> hA(A_row, A_col, lda, stride_a, batch_count);
+    host_strided_batch_matrix<T> hB(B_row, B_col, ldb, stride_b, batch_count);
+    host_strided_batch_matrix<T> hC(M, N, ldc, stride_c, batch_count);
+    host_strided_batch_matrix<T> hC_1(M, N, ldc, stride_c, batch_count);
+    host_strided_batch_matrix<T> hC_2(M, N, ldc, stride_c, batch_count);
+    host_strided_batch_matrix<T> hC_gold(M, N, ldc, stride_c, batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hC.memcheck());
+    CHECK_HIP_ERROR(hC_1.memcheck());
+    CHECK_HIP_ERROR(hC_2.memcheck());
+    CHECK_HIP_ERROR(hC_gold.memcheck());
+
+    // Allocate device and managed memory
+    device_strided_batch_matrix<T> dA(A_row, A_col, lda, stride_a, batch_count);
+    device_strided_batch_matrix<T> dB(B_row, B_col, ldb, stride_b, batch_count);
+    device_strided_batch_matrix<T> dC(M, N, ldc, stride_c, batch_count);
+    device_strided_batch_matrix<T> mA(A_row, A_col, lda, stride_a, batch_count, true);
+    device_strided_batch_matrix<T> mB(B_row, B_col, ldb, stride_b, batch_count, true);
+    device_strided_batch_matrix<T> mC(M, N, ldc, stride_c, batch_count, true);
+
+    // Check device and managed memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(mA.memcheck());
+    CHECK_DEVICE_ALLOCATION(mB.memcheck());
+    CHECK_DEVICE_ALLOCATION(mC.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    // gemm computes the first matrix of the batch
+    auto rocblas_managed_prefetch_fn = [&](bool                            batched,
+                                           device_strided_batch_matrix<T>& A,
+                                           device_strided_batch_matrix<T>& B,
+                                           device_strided_batch_matrix<T>& C) {
+        if(!batched)
+            return rocblas_gemm_fn(
+                handle, transA, transB, M, N, K, &h_alpha, A, lda, B, ldb, &h_beta, C, ldc);
+
+        return rocblas_gemm_strided_batched_fn(handle,
+                                               transA,
+                                               transB,
+                                               M,
+                                               N,
+                                               K,
+                                               &h_alpha,
+                                               A,
+                                               lda,
+                                               stride_a,
+                                               B,
+                                               ldb,
+                                               stride_b,
+                                               &h_beta,
+                                               C,
+                                               ldc,
+                                               stride_c,
+                                               batch_count);
+    };
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(bool batched : {false, true})
+        {
+            // Reference from device memory
+            CHECK_ROCBLAS_ERROR(rocblas_set_managed_prefetch(handle, false));
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+            CHECK_ROCBLAS_ERROR(rocblas_managed_prefetch_fn(batched, dA, dB, dC));
+            CHECK_HIP_ERROR(hC_1.transfer_from(dC));
+
+            // The host writes the managed matrices, so that their pages are on the host
+            CHECK_HIP_ERROR(mA.transfer_from(hA));
+            CHECK_HIP_ERROR(mB.transfer_from(hB));
+            CHECK_HIP_ERROR(mC.transfer_from(hC));
+
+            bool prefetch = false;
+            CHECK_ROCBLAS_ERROR(rocblas_set_managed_prefetch(handle, true));
+            CHECK_ROCBLAS_ERROR(rocblas_get_managed_prefetch(handle, &prefetch));
+            EXPECT_TRUE(prefetch);
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_managed_prefetch_fn(batched, mA, mB, mC));
+            handle.post_test(arg);
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            CHECK_HIP_ERROR(hC_2.transfer_from(mC));
+
+            // CPU BLAS
+            hC_gold.copy_from(hC);
+            double cpu_time_start = get_time_us_no_sync();
+#pragma omp parallel for
+            for(rocblas_int b = 0; b < (batched ? batch_count : 1); b++)
+            {
+                cblas_gemm<T>(transA,
+                              transB,
+                              M,
+                              N,
+                              K,
+                              h_alpha,
+                              hA[b],
+                              lda,
+                              hB[b],
+                              ldb,
+                              h_beta,
+                              hC_gold[b],
+                              ldc);
+            }
+            cpu_time_used += get_time_us_no_sync() - cpu_time_start;
+
+            if(arg.unit_check)
+            {
+                // The same kernels run on the same data, so the results are identical
+                unit_check_general<T>(M, N, ldc, stride_c, hC_1, hC_2, batch_count);
+                unit_check_general<T>(M, N, ldc, stride_c, hC_gold, hC_2, batch_count);
+            }
+
+            if(arg.norm_check)
+            {
+                auto error    = std::abs(norm_check_general('F', hC_gold, hC_2));
+                rocblas_error = error > rocblas_error ? error : rocblas_error;
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        // The matrices are written by the host before the calls, which prefetch them
+        CHECK_HIP_ERROR(mA.transfer_from(hA));
+        CHECK_HIP_ERROR(mB.transfer_from(hB));
+        CHECK_HIP_ERROR(mC.transfer_from(hC));
+        CHECK_ROCBLAS_ERROR(rocblas_set_managed_prefetch(handle, true));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_managed_prefetch_fn(true, mA, mB, mC);
+        }
+
+        gpu_time_used = get_time_us_hot_calls(
+            stream, number_hot_calls, [&] { rocblas_managed_prefetch_fn(true, mA, mB, mC); });
+
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_stride_a,
+                      e_beta,
+                      e_ldb,
+                      e_stride_b,
+                      e_ldc,
+                      e_stride_c,
+                      e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemm_gflop_count<T>(M, N, K),
+                         gemm_gbyte_count<T>(M, N, K),
+                         cpu_time_used,
+                         rocblas_error);
+    }
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocblas_test.hpp"
+#include "testing_axpy.hpp"
+#include "testing_dot.hpp"
+#include "testing_gemm.hpp"
+#include "testing_gemm_strided_batched.hpp"
+#include "testing_gemv.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+template <typename T>
+void testing_perf_smoke_bad_arg(const Arguments& arg)
+{
+    // Without a device there is no roofline to compare with
+    double peak_gflops, peak_gbps;
+    EXPECT_FALSE(query_device_peaks(-1, peak_gflops, peak_gbps));
+
+    // A function which is not timed logs no work, which the smoke tests report as a failure
+    Arguments untimed = arg;
+    untimed.timing    = 0;
+    ArgumentModel_reset_logged_work();
+    testing_axpy<T>(untimed);
+
+    double gflop, gbyte, gpu_us;
+    ArgumentModel_get_logged_work(gflop, gbyte, gpu_us);
+    EXPECT_EQ(gflop, 0);
+    EXPECT_EQ(gbyte, 0);
+    EXPECT_EQ(gpu_us, 0);
+}
+
+// Runs the benchmark of a function, perf_<function> in the YAML, and fails if it reaches less
+// than perf_min_percent * (1 - perf_tolerance) percent of the roofline of the device. The
+// thresholds are those of the architecture perf_arch, and are skipped on other ones; rocblas-bench
+// reports the percentage without checking it.
+template <typename T>
+void testing_perf_smoke(const Arguments& arg)
+{
+    static const std::string arch = rocblas_internal_get_arch_name();
+#ifdef GOOGLE_TEST
+    if(arch != arg.perf_arch)
+    {
+        GTEST_SKIP() << "Thresholds of " << arg.perf_arch << ", not of " << arch;
+        return;
+    }
+#endif
+
+    int    device;
+    double peak_gflops, peak_gbps;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    if(!query_device_peaks(device, peak_gflops, peak_gbps))
+    {
+#ifdef GOOGLE_TEST
+        GTEST_SKIP() << "Cannot query the device peaks";
+#else
+        rocblas_cerr << "Cannot query the device peaks" << std::endl;
+#endif
+        return;
+    }
+
+    const char* function = arg.function + strlen("perf_");
+    ArgumentModel_reset_logged_work();
+    if(!strcmp(function, "gemm"))
+        testing_gemm<T>(arg);
+    else if(!strcmp(function, "gemm_strided_batched"))
+        testing_gemm_strided_batched<T>(arg);
+    else if(!strcmp(function, "gemv"))
+        testing_gemv<T>(arg);
+    else if(!strcmp(function, "axpy"))
+        testing_axpy<T>(arg);
+    else if(!strcmp(function, "dot"))
+        testing_dot<T>(arg);
+    else
+    {
+#ifdef GOOGLE_TEST
+        FAIL() << "No performance smoke test of " << function;
+#else
+        rocblas_cerr << "No performance smoke test of " << function << std::endl;
+#endif
+        return;
+    }
+
+    double gflop, gbyte, gpu_us;
+    ArgumentModel_get_logged_work(gflop, gbyte, gpu_us);
+#ifdef GOOGLE_TEST
+    ASSERT_GT(gpu_us, 0) << function << " was not timed";
+#else
+    if(gpu_us <= 0)
+        return;
+#endif
+
+    // percentage of the roofline at the arithmetic intensity of the function, or of the peak
+    // bandwidth for the functions without a flop count
+    double seconds = gpu_us * 1e-6, percent;
+    if(gflop > 0)
+    {
+        double roofline
+            = gbyte > 0 ? std::min(peak_gflops, gflop / gbyte * peak_gbps) : peak_gflops;
+        percent = 100 * gflop / seconds / roofline;
+    }
+    else
+        percent = 100 * gbyte / seconds / peak_gbps;
+
+#ifdef GOOGLE_TEST
+    double threshold = arg.perf_min_percent * (1 - arg.perf_tolerance);
+    EXPECT_GE(percent, threshold) << function << " reached " << percent << "% of the roofline on "
+                                  << arch << ", expected at least " << arg.perf_min_percent
+                                  << "% less " << 100 * arg.perf_tolerance << "%";
+#else
+    rocblas_cout << function << " reached " << percent << "% of the roofline on " << arch
+                 << std::endl;
+#endif
+}
@@ -0,0 +1,264 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_persisting_range_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    device_vector<T> dA(16);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(rocblas_add_persisting_range(nullptr, dA, sizeof(T)),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_add_persisting_range(handle, nullptr, sizeof(T)),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_clear_persisting_ranges(nullptr),
+                          rocblas_status_invalid_handle);
+
+    // a size of 0 adds no range
+    EXPECT_ROCBLAS_STATUS(rocblas_add_persisting_range(handle, dA, 0), rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocblas_clear_persisting_ranges(handle), rocblas_status_success);
+}
+
+// gemv_strided_batched must give the same results with no persisting ranges, with A streamed
+// past a persisting x, and with A persisting, as only the cache policy of the loads of A
+// distinguishes them
+template <typename T>
+void testing_persisting_range(const Arguments& arg)
+{
+    auto rocblas_gemv_strided_batched_fn = arg.fortran ? rocblas_gemv_strided_batched<T, true>
+                                                       : rocblas_gemv_strided_batched<T, false>;
+
+    rocblas_int       M           = arg.M;
+    rocblas_int       N           = arg.N;
+    rocblas_int       lda         = arg.lda;
+    rocblas_int       incx        = arg.incx;
+    rocblas_int       incy        = arg.incy;
+    T                 h_alpha     = arg.get_alpha<T>();
+    T                 h_beta      = arg.get_beta<T>();
+    rocblas_operation transA      = char2rocblas_operation(arg.transA);
+    rocblas_stride    stride_a    = arg.stride_a;
+    rocblas_stride    stride_x    = arg.stride_x;
+    rocblas_stride    stride_y    = arg.stride_y;
+    rocblas_int       batch_count = arg.batch_count;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    size_t dim_x    = transA == rocblas_operation_none ? N : M;
+    size_t dim_y    = transA == rocblas_operation_none ? M : N;
+    size_t abs_incx = incx >= 0 ? incx : -incx;
+    size_t abs_incy = incy >= 0 ? incy : -incy;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || lda < M || lda < 1 || !incx || !incy || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_strided_batched_fn(handle,
+                                                              transA,
+                                                              M,
+                                                              N,
+                                                              nullptr,
+                                                              nullptr,
+                                                              lda,
+                                                              stride_a,
+                                                              nullptr,
+                                                              incx,
+                                                              stride_x,
+                                                              nullptr,
+                                                              nullptr,
+                                                              incy,
+                                                              stride_y,
+                                                              batch_count),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_strided_batch_matrix<T> hA(M, N, lda, stride_a, batch_count);
+    host_strided_batch_vector<T> hx(dim_x, incx, stride_x, batch_count);
+    host_strided_batch_vector<T> hy(dim_y, incy, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_1(dim_y, incy, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_2(dim_y, incy, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_gold(dim_y, incy, stride_y, batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+
+    // Allocate device memory
+    device_strided_batch_matrix<T> dA(M, N, lda, stride_a, batch_count);
+    device_strided_batch_vector<T> dx(dim_x, incx, stride_x, batch_count);
+    device_strided_batch_vector<T> dy(dim_y, incy, stride_y, batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hy, arg, rocblas_client_beta_sets_nan);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    auto gemv_strided_batched = [&]() {
+        return rocblas_gemv_strided_batched_fn(handle,
+                                               transA,
+                                               M,
+                                               N,
+                                               &h_alpha,
+                                               dA,
+                                               lda,
+                                               stride_a,
+                                               dx,
+                                               incx,
+                                               stride_x,
+                                               &h_beta,
+                                               dy,
+                                               incy,
+                                               stride_y,
+                                               batch_count);
+    };
+
+    // The bytes of the batch of A and of x, from their first to their last element
+    size_t bytes_A = sizeof(T) * (size_t(lda) * (N - 1) + M + size_t(batch_count - 1) * stride_a);
+    size_t bytes_x = sizeof(T) * ((dim_x - 1) * abs_incx + 1 + size_t(batch_count - 1) * stride_x);
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error_1        = 0.0;
+    double rocblas_error_2        = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // Reference without persisting ranges
+        CHECK_ROCBLAS_ERROR(rocblas_clear_persisting_ranges(handle));
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(gemv_strided_batched());
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy));
+
+        // CPU BLAS
+        hy_gold.copy_from(hy);
+        cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            cblas_gemv<T>(transA, M, N, h_alpha, hA[b], lda, hx[b], incx, h_beta, hy_gold[b], incy);
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // A streamed past a persisting x, then A persisting; the error of the latter is logged
+        for(bool persisting : {false, true})
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_clear_persisting_ranges(handle));
+            if(persisting)
+                CHECK_ROCBLAS_ERROR(rocblas_add_persisting_range(handle, dA, bytes_A));
+            else
+                CHECK_ROCBLAS_ERROR(rocblas_add_persisting_range(handle, dx, bytes_x));
+
+            CHECK_HIP_ERROR(dy.transfer_from(hy));
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(gemv_strided_batched());
+            handle.post_test(arg);
+            CHECK_HIP_ERROR(hy_2.transfer_from(dy));
+
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(1, dim_y, abs_incy, stride_y, hy_gold, hy_1, batch_count);
+                unit_check_general<T>(1, dim_y, abs_incy, stride_y, hy_1, hy_2, batch_count);
+            }
+
+            if(arg.norm_check)
+            {
+                rocblas_error_1 = norm_check_general<T>(
+                    'F', 1, dim_y, abs_incy, stride_y, hy_gold, hy_1, batch_count);
+                rocblas_error_2 = norm_check_general<T>(
+                    'F', 1, dim_y, abs_incy, stride_y, hy_gold, hy_2, batch_count);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        // A is reused by every call, so it is marked as persisting
+        CHECK_ROCBLAS_ERROR(rocblas_clear_persisting_ranges(handle));
+        CHECK_ROCBLAS_ERROR(rocblas_add_persisting_range(handle, dA, bytes_A));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            gemv_strided_batched();
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used
+            = get_time_us_hot_calls(stream, number_hot_calls, [&] { gemv_strided_batched(); });
+
+        ArgumentModel<e_transA,
+                      e_M,
+                      e_N,
+                      e_alpha,
+                      e_lda,
+                      e_stride_a,
+                      e_incx,
+                      e_stride_x,
+                      e_beta,
+                      e_incy,
+                      e_stride_y,
+                      e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemv_gflop_count<T>(transA, M, N),
+                         gemv_gbyte_count<T>(transA, M, N),
+                         cpu_time_used,
+                         rocblas_error_1,
+                         rocblas_error_2);
+    }
+
+    CHECK_ROCBLAS_ERROR(rocblas_clear_persisting_ranges(handle));
+}
@@ -0,0 +1,229 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_recording_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    rocblas_recording recording = nullptr;
+
+    EXPECT_ROCBLAS_STATUS(rocblas_begin_recording(nullptr, 0), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_end_recording(nullptr, &recording),
+                          rocblas_status_invalid_handle);
+
+    // end without a recording begun
+    EXPECT_ROCBLAS_STATUS(rocblas_end_recording(handle, &recording), rocblas_status_invalid_value);
+
+    // recordings do not nest, and a recording ended without where to return it is discarded
+    CHECK_ROCBLAS_ERROR(rocblas_begin_recording(handle, 0));
+    EXPECT_ROCBLAS_STATUS(rocblas_begin_recording(handle, 0), rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_end_recording(handle, nullptr), rocblas_status_invalid_pointer);
+
+    // the handle is usable again
+    CHECK_ROCBLAS_ERROR(rocblas_begin_recording(handle, 0));
+    CHECK_ROCBLAS_ERROR(rocblas_end_recording(handle, &recording));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_launch_recording(nullptr, 0), rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_destroy_recording(nullptr), rocblas_status_success);
+
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_recording(recording));
+}
+
+// A recording of axpy, scal and dot replays them with each launch, reading the scalars in
+// device memory at each replay, and is updated in place by recording the same calls with
+// other vectors
+template <typename T>
+void testing_recording(const Arguments& arg)
+{
+    rocblas_int N       = arg.N;
+    const int   replays = 3;
+
+    rocblas_local_handle handle{arg};
+
+    if(N <= 0)
+    {
+        // a recording of quick returns replays nothing
+        rocblas_recording recording = nullptr;
+        CHECK_ROCBLAS_ERROR(rocblas_begin_recording(handle, 0));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy<T>(handle, N, nullptr, nullptr, 1, nullptr, 1));
+        CHECK_ROCBLAS_ERROR(rocblas_end_recording(handle, &recording));
+        CHECK_ROCBLAS_ERROR(rocblas_launch_recording(recording, 0));
+        CHECK_ROCBLAS_ERROR(rocblas_destroy_recording(recording));
+        return;
+    }
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+    // Reductions without atomics give the same results in every run
+    CHECK_ROCBLAS_ERROR(rocblas_set_atomics_mode(handle, rocblas_atomics_not_allowed));
+
+    // Naming: `h` is in CPU (host) memory(eg hy_1), `d` is in GPU (device) memory (eg dy).
+    // Allocate host memory
+    host_vector<T> hx(N);
+    host_vector<T> hy(N);
+    host_vector<T> hy_1(N);
+    host_vector<T> hy_gold(N);
+    host_vector<T> hscalars(2);
+
+    // Allocate device memory
+    device_vector<T> dx(N);
+    device_vector<T> dy(N);
+    device_vector<T> dy2(N);
+    device_vector<T> dscalars(2);
+    device_vector<T> dresult(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy2.memcheck());
+    CHECK_DEVICE_ALLOCATION(dscalars.memcheck());
+    CHECK_DEVICE_ALLOCATION(dresult.memcheck());
+
+    // Initialize data on host memory. Small integers, and a scale of 1 or -1, keep every
+    // result exact.
+    rocblas_init_vector(hx, arg, rocblas_client_never_set_nan, true, true);
+    rocblas_init_vector(hy, arg, rocblas_client_never_set_nan);
+    hscalars[0] = arg.get_alpha<T>();
+    hscalars[1] = T(-1);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(dy2.transfer_from(hy));
+    CHECK_HIP_ERROR(dscalars.transfer_from(hscalars));
+
+    T* alpha = dscalars;
+    T* scale = alpha + 1;
+
+    auto record = [&](T* y) {
+        CHECK_ROCBLAS_ERROR(rocblas_axpy<T>(handle, N, alpha, dx, 1, y, 1));
+        CHECK_ROCBLAS_ERROR(rocblas_scal<T>(handle, N, scale, y, 1));
+        CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, dx, 1, y, 1, dresult));
+    };
+
+    // y = scale * (alpha * x + y), and returns x . y
+    auto gold = [&]() {
+        T dot(0);
+        for(rocblas_int i = 0; i < N; i++)
+        {
+            hy_gold[i] = hscalars[1] * (hscalars[0] * hx[i] + hy_gold[i]);
+            dot += hx[i] * hy_gold[i];
+        }
+        return dot;
+    };
+
+    hipStream_t handle_stream, stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &handle_stream));
+
+    rocblas_recording recording = nullptr;
+    CHECK_ROCBLAS_ERROR(rocblas_begin_recording(handle, 0));
+    record(dy);
+    CHECK_ROCBLAS_ERROR(rocblas_end_recording(handle, &recording));
+
+    // Recording ran nothing, and returned the handle to its stream
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    EXPECT_EQ(stream, handle_stream);
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy));
+        unit_check_general<T>(1, N, 1, hy, hy_1);
+
+        hy_gold = hy;
+        T dot_gold(0);
+        for(int replay = 0; replay < replays; replay++)
+        {
+            // Scalars in device memory are read at each replay
+            hscalars[1] = replay % 2 ? T(1) : T(-1);
+            CHECK_HIP_ERROR(dscalars.transfer_from(hscalars));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_launch_recording(recording, 0));
+            handle.post_test(arg);
+
+            cpu_time_used = get_time_us_no_sync();
+            dot_gold      = gold();
+            cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+        }
+
+        T dot;
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy));
+        CHECK_HIP_ERROR(hipMemcpy(&dot, dresult, sizeof(T), hipMemcpyDeviceToHost));
+        unit_check_general<T>(1, N, 1, hy_gold, hy_1);
+        unit_check_general<T>(1, 1, 1, &dot_gold, &dot);
+
+        // Recording the same calls on y2 updates the recording, which no longer writes y
+        rocblas_recording updated = recording;
+        CHECK_ROCBLAS_ERROR(rocblas_begin_recording(handle, 0));
+        record(dy2);
+        CHECK_ROCBLAS_ERROR(rocblas_end_recording(handle, &updated));
+        CHECK_ROCBLAS_ERROR(rocblas_launch_recording(updated, 0));
+        recording = updated;
+
+        hy_gold  = hy;
+        dot_gold = gold();
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy2));
+        CHECK_HIP_ERROR(hipMemcpy(&dot, dresult, sizeof(T), hipMemcpyDeviceToHost));
+        unit_check_general<T>(1, N, 1, hy_gold, hy_1);
+        unit_check_general<T>(1, 1, 1, &dot_gold, &dot);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+            rocblas_launch_recording(recording, handle_stream);
+
+        gpu_time_used = get_time_us_hot_calls(handle_stream, number_hot_calls, [&] {
+            rocblas_launch_recording(recording, handle_stream);
+        });
+
+        ArgumentModel<e_N>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            axpy_gflop_count<T>(N) + scal_gflop_count<T, T>(N) + dot_gflop_count<false, T>(N),
+            axpy_gbyte_count<T>(N) + scal_gbyte_count<T>(N) + dot_gbyte_count<T>(N),
+            cpu_time_used,
+            ArgumentLogging::NA_value);
+    }
+
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_recording(recording));
+}
@@ -0,0 +1,323 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <cstring>
+
+// Reproducible results must match bit for bit, which is stricter than unit_check_general
+template <typename T>
+void reproducible_bitwise_check(size_t n, const T* expected, const T* result)
+{
+    for(size_t i = 0; i < n; i++)
+        EXPECT_EQ(memcmp(expected + i, result + i, sizeof(T)), 0) << "at element " << i;
+}
+
+template <typename T>
+void testing_reproducible_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    bool reproducible;
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_reproducible_mode(nullptr, true),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_reproducible_mode(nullptr, &reproducible),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_reproducible_mode(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+}
+
+// In reproducible mode the results of dot, asum, nrm2 and gemv do not depend on the order of
+// the elements, on the increments or on the atomics mode, and they remain accurate
+template <typename T>
+void testing_reproducible(const Arguments& arg)
+{
+    using Tr = real_t<T>;
+
+    rocblas_int N       = arg.N;
+    rocblas_int M       = arg.M;
+    T           h_alpha = arg.get_alpha<T>();
+    T           h_beta  = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    bool reproducible = true;
+    CHECK_ROCBLAS_ERROR(rocblas_get_reproducible_mode(handle, &reproducible));
+    EXPECT_FALSE(reproducible);
+    CHECK_ROCBLAS_ERROR(rocblas_set_reproducible_mode(handle, true));
+    CHECK_ROCBLAS_ERROR(rocblas_get_reproducible_mode(handle, &reproducible));
+    EXPECT_TRUE(reproducible);
+
+    // check to prevent undefined memory allocation error
+    if(N <= 0)
+    {
+        T  cpu_0 = T(0), dot = T(1);
+        Tr cpu_r0 = Tr(0), asum = Tr(1), nrm2 = Tr(1);
+        CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, nullptr, 1, nullptr, 1, &dot));
+        CHECK_ROCBLAS_ERROR(rocblas_asum<T>(handle, N, nullptr, 1, &asum));
+        CHECK_ROCBLAS_ERROR(rocblas_nrm2<T>(handle, N, nullptr, 1, &nrm2));
+        unit_check_general<T>(1, 1, 1, &cpu_0, &dot);
+        unit_check_general<Tr>(1, 1, 1, &cpu_r0, &asum);
+        unit_check_general<Tr>(1, 1, 1, &cpu_r0, &nrm2);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // x and y, and the same elements in reverse order, whose sums are added in another order
+    // by the threads of the reduction
+    host_vector<T> hx(N);
+    host_vector<T> hy(N);
+    host_vector<T> hx_rev(N);
+    host_vector<T> hy_rev(N);
+
+    rocblas_init_vector(hx, arg, rocblas_client_never_set_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_never_set_nan, false, true);
+
+    // magnitudes spread over a wide range, so that the rounding of the default summation
+    // depends on the order
+    constexpr int digits = std::numeric_limits<Tr>::digits;
+    for(rocblas_int i = 0; i < N; i++)
+        hx[i] *= T(std::ldexp(Tr(1), i % (digits - 1) - digits / 2));
+
+    for(rocblas_int i = 0; i < N; i++)
+    {
+        hx_rev[i] = hx[N - 1 - i];
+        hy_rev[i] = hy[N - 1 - i];
+    }
+
+    device_vector<T> dx(N);
+    device_vector<T> dy(N);
+    device_vector<T> dx_rev(N);
+    device_vector<T> dy_rev(N);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_rev.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_rev.memcheck());
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(dx_rev.transfer_from(hx_rev));
+    CHECK_HIP_ERROR(dy_rev.transfer_from(hy_rev));
+
+    // gemv with the columns of A reversed, for which each element of y for transA none is
+    // reduced in another order
+    host_matrix<T> hA(M, N, M);
+    host_matrix<T> hA_rev(M, N, M);
+    host_vector<T> hz(M);
+    host_vector<T> hz_1(M);
+    host_vector<T> hz_rev(M);
+
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_vector(hz, arg, rocblas_client_never_set_nan);
+    for(rocblas_int j = 0; j < N; j++)
+        for(rocblas_int i = 0; i < M; i++)
+            hA_rev[0][i + size_t(j) * M] = hA[0][i + size_t(N - 1 - j) * M];
+
+    device_matrix<T> dA(M, N, M);
+    device_matrix<T> dA_rev(M, N, M);
+    device_vector<T> dz(M);
+    device_vector<T> dz_rev(M);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_rev.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz_rev.memcheck());
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dA_rev.transfer_from(hA_rev));
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // CPU BLAS
+        T  cpu_dot;
+        Tr cpu_asum, cpu_nrm2;
+        cpu_time_used = get_time_us_no_sync();
+        cblas_dot<T>(N, hx, 1, hy, 1, &cpu_dot);
+        cblas_asum<T>(N, hx, 1, &cpu_asum);
+        cblas_nrm2<T>(N, hx, 1, &cpu_nrm2);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // Bounds of the rounding error of a sum of N terms
+        double abs_dot = 0;
+        for(rocblas_int i = 0; i < N; i++)
+            abs_dot += double(rocblas_abs(hx[i])) * double(rocblas_abs(hy[i]));
+        double eps_N    = std::numeric_limits<Tr>::epsilon() * N;
+        double dot_tol  = eps_N * abs_dot;
+        double asum_tol = eps_N * cpu_asum;
+        double nrm2_tol = eps_N * cpu_nrm2;
+
+        T  first_dot  = T(0);
+        Tr first_asum = Tr(0), first_nrm2 = Tr(0);
+
+        for(auto atomics : {rocblas_atomics_allowed, rocblas_atomics_not_allowed})
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_atomics_mode(handle, atomics));
+
+            T  dot, dot_rev, dot_neg;
+            Tr asum, asum_rev, nrm2, nrm2_rev;
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, dx, 1, dy, 1, &dot));
+            handle.post_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, dx_rev, 1, dy_rev, 1, &dot_rev));
+            CHECK_ROCBLAS_ERROR(rocblas_asum<T>(handle, N, dx, 1, &asum));
+            CHECK_ROCBLAS_ERROR(rocblas_asum<T>(handle, N, dx_rev, 1, &asum_rev));
+            CHECK_ROCBLAS_ERROR(rocblas_nrm2<T>(handle, N, dx, 1, &nrm2));
+            CHECK_ROCBLAS_ERROR(rocblas_nrm2<T>(handle, N, dx_rev, 1, &nrm2_rev));
+
+            // Negative increments read the vectors backwards
+            CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, dx_rev, -1, dy_rev, -1, &dot_neg));
+
+            if(atomics == rocblas_atomics_allowed)
+            {
+                first_dot  = dot;
+                first_asum = asum;
+                first_nrm2 = nrm2;
+            }
+
+            if(arg.unit_check)
+            {
+                reproducible_bitwise_check(1, &dot, &dot_rev);
+                reproducible_bitwise_check(1, &dot, &dot_neg);
+                reproducible_bitwise_check(1, &asum, &asum_rev);
+                reproducible_bitwise_check(1, &nrm2, &nrm2_rev);
+
+                reproducible_bitwise_check(1, &first_dot, &dot);
+                reproducible_bitwise_check(1, &first_asum, &asum);
+                reproducible_bitwise_check(1, &first_nrm2, &nrm2);
+
+                near_check_general<T>(1, 1, 1, &cpu_dot, &dot, dot_tol);
+                near_check_general<Tr>(1, 1, 1, &cpu_asum, &asum, asum_tol);
+                near_check_general<Tr>(1, 1, 1, &cpu_nrm2, &nrm2, nrm2_tol);
+            }
+
+            if(arg.norm_check)
+            {
+                rocblas_error = std::max(rocblas_error,
+                                         double(rocblas_abs((cpu_dot - dot) / cpu_dot)));
+            }
+        }
+
+        // dotc conjugates x, which is also reduced in any order to the same result
+        if constexpr(rocblas_is_complex<T>)
+        {
+            T dotc, dotc_rev;
+            CHECK_ROCBLAS_ERROR(rocblas_dotc<T>(handle, N, dx, 1, dy, 1, &dotc));
+            CHECK_ROCBLAS_ERROR(rocblas_dotc<T>(handle, N, dx_rev, 1, dy_rev, 1, &dotc_rev));
+            if(arg.unit_check)
+                reproducible_bitwise_check(1, &dotc, &dotc_rev);
+        }
+
+        CHECK_HIP_ERROR(dz.transfer_from(hz));
+        CHECK_HIP_ERROR(dz_rev.transfer_from(hz));
+        CHECK_ROCBLAS_ERROR(rocblas_gemv<T>(
+            handle, rocblas_operation_none, M, N, &h_alpha, dA, M, dx, 1, &h_beta, dz, 1));
+        CHECK_ROCBLAS_ERROR(rocblas_gemv<T>(handle,
+                                            rocblas_operation_none,
+                                            M,
+                                            N,
+                                            &h_alpha,
+                                            dA_rev,
+                                            M,
+                                            dx_rev,
+                                            1,
+                                            &h_beta,
+                                            dz_rev,
+                                            1));
+        CHECK_HIP_ERROR(hz_1.transfer_from(dz));
+        CHECK_HIP_ERROR(hz_rev.transfer_from(dz_rev));
+        if(arg.unit_check)
+            reproducible_bitwise_check<T>(M, hz_1, hz_rev);
+
+        // Each element of A^T z for transA transpose is the dot product of a column of A with
+        // x, reduced as by dot, and then scaled without contraction as below. Complex products
+        // may be contracted differently on the host, so only real types are compared.
+        if constexpr(!rocblas_is_complex<T>)
+        {
+            CHECK_HIP_ERROR(dz.transfer_from(hz));
+            CHECK_ROCBLAS_ERROR(rocblas_gemv<T>(
+                handle, rocblas_operation_transpose, N, M, &h_alpha, dA, N, dx, 1, &h_beta, dz, 1));
+            CHECK_HIP_ERROR(hz_1.transfer_from(dz));
+            for(rocblas_int i = 0; i < M; i++)
+            {
+                T dot;
+                CHECK_ROCBLAS_ERROR(
+                    rocblas_dot<T>(handle, N, (T*)dA + size_t(i) * N, 1, dx, 1, &dot));
+                volatile T scaled   = h_alpha * dot;
+                volatile T shifted  = h_beta * hz[i];
+                T          expected = scaled + shifted;
+                if(arg.unit_check)
+                    reproducible_bitwise_check(1, &expected, &hz_1[i]);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        device_vector<T> d_dot(1);
+        CHECK_DEVICE_ALLOCATION(d_dot.memcheck());
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_dot<T>(handle, N, dx, 1, dy, 1, d_dot);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_dot<T>(handle, N, dx, 1, dy, 1, d_dot);
+        });
+
+        ArgumentModel<e_N>{}.log_args<T>(rocblas_cout,
+                                         arg,
+                                         gpu_time_used,
+                                         dot_gflop_count<false, T>(N),
+                                         dot_gbyte_count<T>(N),
+                                         cpu_time_used,
+                                         rocblas_error);
+    }
+}
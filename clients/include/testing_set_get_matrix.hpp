@@ -69,6 +69,10 @@ void testing_set_get_matrix(const Arguments& arg)
     host_vector<T> hc(cols * size_t(ldc));
     host_vector<T> hb_gold(cols * size_t(ldb));
 
+    // pinned with rocblas-bench --pinned, so that set and get transfer at pinned bandwidth
+    host_pinned_registration ha_pinned(ha, sizeof(T) * ha.size());
+    host_pinned_registration hb_pinned(hb, sizeof(T) * hb.size());
+
     double gpu_time_used, cpu_time_used;
     double rocblas_error = 0.0;
 
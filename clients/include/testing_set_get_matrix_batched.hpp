@@ -0,0 +1,297 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <vector>
+
+template <typename T>
+void testing_set_get_matrix_batched_bad_arg(const Arguments& arg)
+{
+    const rocblas_int    M           = 10;
+    const rocblas_int    N           = 10;
+    const rocblas_int    lda         = 10;
+    const rocblas_int    ldb         = 10;
+    const rocblas_int    batch_count = 2;
+    const rocblas_int    elem_size   = sizeof(T);
+    const rocblas_stride stride_a    = size_t(lda) * N;
+    const rocblas_stride stride_b    = size_t(ldb) * N;
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    host_vector<T>   hA(stride_a * batch_count);
+    device_vector<T> dB(stride_b * batch_count);
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+
+    T* pA     = hA;
+    T* dB_ptr = dB;
+
+    std::vector<const void*> a_h(batch_count), b_d_const(batch_count);
+    std::vector<void*>       b_d(batch_count), a_h_out(batch_count);
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        a_h[b]       = pA + b * stride_a;
+        a_h_out[b]   = pA + b * stride_a;
+        b_d[b]       = dB_ptr + b * stride_b;
+        b_d_const[b] = b_d[b];
+    }
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_set_matrix_batched_async(
+            M, N, elem_size, a_h.data(), M - 1, b_d.data(), ldb, batch_count, stream),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_set_matrix_batched_async(
+            M, N, elem_size, a_h.data(), lda, b_d.data(), M - 1, batch_count, stream),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_set_matrix_batched_async(
+            M, N, 0, a_h.data(), lda, b_d.data(), ldb, batch_count, stream),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_get_matrix_batched_async(
+            M, N, elem_size, b_d_const.data(), ldb, a_h_out.data(), lda, -1, stream),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_set_matrix_strided_batched_async(
+            M, N, elem_size, hA, lda, stride_a, dB, ldb, stride_b, -1, stream),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_get_matrix_strided_batched_async(
+            M, N, elem_size, dB, M - 1, stride_b, hA, lda, stride_a, batch_count, stream),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_set_vector_batched_async(
+            M, elem_size, a_h.data(), 0, b_d.data(), 1, batch_count, stream),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_get_vector_strided_batched_async(
+            M, elem_size, dB, 1, stride_b, hA, 0, stride_a, batch_count, stream),
+        rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_set_matrix_batched_async(
+            M, N, elem_size, nullptr, lda, b_d.data(), ldb, batch_count, stream),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_get_matrix_batched_async(
+            M, N, elem_size, nullptr, ldb, a_h_out.data(), lda, batch_count, stream),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_set_matrix_strided_batched_async(
+            M, N, elem_size, hA, lda, stride_a, nullptr, ldb, stride_b, batch_count, stream),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_get_matrix_strided_batched_async(
+            M, N, elem_size, dB, ldb, stride_b, nullptr, lda, stride_a, batch_count, stream),
+        rocblas_status_invalid_pointer);
+
+    // If batch_count is 0, nothing is dereferenced
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_set_matrix_batched_async(M, N, elem_size, nullptr, lda, nullptr, ldb, 0, stream),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_get_matrix_strided_batched_async(
+            M, N, elem_size, nullptr, ldb, stride_b, nullptr, lda, stride_a, 0, stream),
+        rocblas_status_success);
+
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+// Round trips of batches of matrices, strided and scattered in a random order
+template <typename T>
+void testing_set_get_matrix_batched(const Arguments& arg)
+{
+    rocblas_int    M           = arg.M;
+    rocblas_int    N           = arg.N;
+    rocblas_int    lda         = arg.lda;
+    rocblas_int    ldb         = arg.ldb;
+    rocblas_stride stride_a    = arg.stride_a;
+    rocblas_stride stride_b    = arg.stride_b;
+    rocblas_int    batch_count = arg.batch_count;
+    rocblas_int    elem_size   = sizeof(T);
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || N < 0 || lda <= 0 || ldb <= 0 || lda < M || ldb < M
+                        || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_set_matrix_strided_batched_async(M,
+                                                                       N,
+                                                                       elem_size,
+                                                                       nullptr,
+                                                                       lda,
+                                                                       stride_a,
+                                                                       nullptr,
+                                                                       ldb,
+                                                                       stride_b,
+                                                                       batch_count,
+                                                                       stream),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_get_matrix_batched_async(
+                M, N, elem_size, nullptr, ldb, nullptr, lda, batch_count, stream),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+        return;
+    }
+
+    size_t size_a = size_t(stride_a) * (batch_count - 1) + size_t(lda) * N;
+    size_t size_b = size_t(stride_b) * (batch_count - 1) + size_t(ldb) * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(size_a);
+    host_vector<T>   hB(size_b);
+    host_vector<T>   hC(size_a);
+    device_vector<T> dB(size_b);
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+
+    rocblas_seedrand();
+    rocblas_init<T>(hA, size_a, 1, size_a);
+
+    T* pA     = hA;
+    T* pB     = hB;
+    T* pC     = hC;
+    T* dB_ptr = dB;
+
+    // the matrices a and b of leading dimensions ld_a and ld_b hold the same elements
+    auto check = [&](const T* a, rocblas_int ld_a, const T* b, rocblas_int ld_b) {
+        for(rocblas_int j = 0; j < N; j++)
+            for(rocblas_int i = 0; i < M; i++)
+                ASSERT_EQ(b[i + size_t(j) * ld_b], a[i + size_t(j) * ld_a]);
+    };
+
+    // a quarter of the device matrices swapped, leaving adjacent runs of various lengths
+    std::vector<rocblas_int> order(batch_count);
+    for(rocblas_int b = 0; b < batch_count; b++)
+        order[b] = b;
+    for(rocblas_int b = 3; b < batch_count; b += 4)
+        std::swap(order[b], order[t_rocblas_rng() % (b + 1)]);
+
+    std::vector<const void*> a_h(batch_count), b_d_const(batch_count);
+    std::vector<void*>       b_d(batch_count), c_h(batch_count);
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        a_h[b]       = pA + b * stride_a;
+        b_d[b]       = dB_ptr + order[b] * stride_b;
+        b_d_const[b] = b_d[b];
+        c_h[b]       = pC + b * stride_a;
+    }
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_matrix_strided_batched_async(
+            M, N, elem_size, hA, lda, stride_a, dB, ldb, stride_b, batch_count, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        CHECK_HIP_ERROR(hB.transfer_from(dB));
+        for(rocblas_int b = 0; b < batch_count; b++)
+            check(pA + b * stride_a, lda, pB + b * stride_b, ldb);
+
+        std::fill(hC.begin(), hC.end(), T(0));
+        CHECK_ROCBLAS_ERROR(rocblas_get_matrix_strided_batched_async(
+            M, N, elem_size, dB, ldb, stride_b, hC, lda, stride_a, batch_count, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        for(rocblas_int b = 0; b < batch_count; b++)
+            check(pA + b * stride_a, lda, pC + b * stride_a, lda);
+
+        CHECK_HIP_ERROR(hipMemset(dB, 0, size_b * sizeof(T)));
+        CHECK_ROCBLAS_ERROR(rocblas_set_matrix_batched_async(
+            M, N, elem_size, a_h.data(), lda, b_d.data(), ldb, batch_count, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        CHECK_HIP_ERROR(hB.transfer_from(dB));
+        for(rocblas_int b = 0; b < batch_count; b++)
+            check(pA + b * stride_a, lda, pB + order[b] * stride_b, ldb);
+
+        std::fill(hC.begin(), hC.end(), T(0));
+        CHECK_ROCBLAS_ERROR(rocblas_get_matrix_batched_async(
+            M, N, elem_size, b_d_const.data(), ldb, c_h.data(), lda, batch_count, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        for(rocblas_int b = 0; b < batch_count; b++)
+            check(pA + b * stride_a, lda, pC + b * stride_a, lda);
+
+        // contiguous vectors of M elements
+        if(N == 1)
+        {
+            std::fill(hC.begin(), hC.end(), T(0));
+            CHECK_HIP_ERROR(hipMemset(dB, 0, size_b * sizeof(T)));
+            CHECK_ROCBLAS_ERROR(rocblas_set_vector_strided_batched_async(
+                M, elem_size, hA, 1, stride_a, dB, 1, stride_b, batch_count, stream));
+            CHECK_ROCBLAS_ERROR(rocblas_get_vector_batched_async(
+                M, elem_size, b_d_const.data(), 1, c_h.data(), 1, batch_count, stream));
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            for(rocblas_int b = 0; b < batch_count; b++)
+                check(pA + order[b] * stride_a, lda, pC + b * stride_a, lda);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_set_matrix_batched_async(
+                M, N, elem_size, a_h.data(), lda, b_d.data(), ldb, batch_count, stream);
+            rocblas_get_matrix_batched_async(
+                M, N, elem_size, b_d_const.data(), ldb, c_h.data(), lda, batch_count, stream);
+        }
+
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_set_matrix_batched_async(
+                M, N, elem_size, a_h.data(), lda, b_d.data(), ldb, batch_count, stream);
+            rocblas_get_matrix_batched_async(
+                M, N, elem_size, b_d_const.data(), ldb, c_h.data(), lda, batch_count, stream);
+        });
+
+        ArgumentModel<e_M, e_N, e_lda, e_ldb, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            set_get_matrix_gbyte_count<T>(M, N),
+            cpu_time_used,
+            ArgumentLogging::NA_value);
+    }
+
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
@@ -0,0 +1,217 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <type_traits>
+
+// Host type of the matrices transferred to a device matrix of type T: rocblas_set_matrix_ex
+// narrows rocblas_datatype_f32_r to rocblas_datatype_f16_r or rocblas_datatype_bf16_r, and
+// rocblas_datatype_f64_r to rocblas_datatype_f32_r. A double device matrix has a double host
+// matrix, for which the functions are rocblas_set_matrix and rocblas_get_matrix.
+template <typename T>
+using set_get_matrix_ex_host_t
+    = std::conditional_t<std::is_same<T, float>{} || std::is_same<T, double>{}, double, float>;
+
+template <typename T>
+void testing_set_get_matrix_ex_bad_arg(const Arguments& arg)
+{
+    using Th = set_get_matrix_ex_host_t<T>;
+
+    const rocblas_datatype h_type = rocblas_type2datatype<Th>();
+    const rocblas_datatype d_type = rocblas_type2datatype<T>();
+    const rocblas_int      rows   = 100;
+    const rocblas_int      cols   = 100;
+    const rocblas_int      lda    = 100;
+    const rocblas_int      ldb    = 100;
+
+    host_vector<Th>  ha(cols * size_t(lda));
+    device_vector<T> db(cols * size_t(ldb));
+    CHECK_HIP_ERROR(ha.memcheck());
+    CHECK_DEVICE_ALLOCATION(db.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_matrix_ex(rows, cols, ha, h_type, rows - 1, db, d_type, ldb),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_matrix_ex(rows, cols, ha, h_type, lda, db, d_type, rows - 1),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_matrix_ex(rows, cols, db, d_type, rows - 1, ha, h_type, lda),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_matrix_ex(rows, cols, db, d_type, ldb, ha, h_type, rows - 1),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_matrix_ex(rows, cols, nullptr, h_type, lda, db, d_type, ldb),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_matrix_ex(rows, cols, ha, h_type, lda, nullptr, d_type, ldb),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_matrix_ex(rows, cols, nullptr, d_type, ldb, ha, h_type, lda),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_matrix_ex(rows, cols, db, d_type, ldb, nullptr, h_type, lda),
+                          rocblas_status_invalid_pointer);
+
+    // If rows or cols is 0, nothing is dereferenced
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_set_matrix_ex(0, cols, nullptr, h_type, lda, nullptr, d_type, ldb),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_get_matrix_ex(rows, 0, nullptr, d_type, ldb, nullptr, h_type, lda),
+        rocblas_status_success);
+
+    // Only narrowing transfers to the device and widening transfers to the host convert
+    if(h_type != d_type)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_set_matrix_ex(rows, cols, db, d_type, ldb, ha, h_type, lda),
+                              rocblas_status_not_implemented);
+        EXPECT_ROCBLAS_STATUS(rocblas_get_matrix_ex(rows, cols, ha, h_type, lda, db, d_type, ldb),
+                              rocblas_status_not_implemented);
+    }
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_set_matrix_ex(rows, cols, ha, rocblas_datatype_f32_c, lda, db, d_type, ldb),
+        rocblas_status_not_implemented);
+}
+
+template <typename T>
+void testing_set_get_matrix_ex(const Arguments& arg)
+{
+    using Th = set_get_matrix_ex_host_t<T>;
+
+    const rocblas_datatype h_type = rocblas_type2datatype<Th>();
+    const rocblas_datatype d_type = rocblas_type2datatype<T>();
+
+    rocblas_int rows = arg.M;
+    rocblas_int cols = arg.N;
+    rocblas_int lda  = arg.lda;
+    rocblas_int ldb  = arg.ldb;
+    rocblas_int ldc  = arg.ldc;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalidGPUMatrix = rows < 0 || cols < 0 || ldb <= 0 || ldb < rows;
+    bool invalidSet       = invalidGPUMatrix || lda <= 0 || lda < rows;
+    bool invalidGet       = invalidGPUMatrix || ldc <= 0 || ldc < rows;
+
+    if(invalidSet || invalidGet || !rows || !cols)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_set_matrix_ex(rows, cols, nullptr, h_type, lda, nullptr, d_type, ldb),
+            invalidSet ? rocblas_status_invalid_size : rocblas_status_success);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_get_matrix_ex(rows, cols, nullptr, d_type, ldb, nullptr, h_type, ldc),
+            invalidGet ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<Th>  ha(cols * size_t(lda));
+    host_vector<T>   hb(cols * size_t(ldb));
+    host_vector<T>   hb_gold(cols * size_t(ldb));
+    host_vector<Th>  hc(cols * size_t(ldc));
+    host_vector<Th>  hc_gold(cols * size_t(ldc));
+    device_vector<T> db(cols * size_t(ldb));
+    CHECK_DEVICE_ALLOCATION(db.memcheck());
+
+    // pinned with rocblas-bench --pinned, so that set and get transfer at pinned bandwidth
+    host_pinned_registration ha_pinned(ha, sizeof(Th) * ha.size());
+    host_pinned_registration hc_pinned(hc, sizeof(Th) * hc.size());
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error = 0.0;
+
+    // Initial Data on CPU; the fractions are not all exactly representable in T
+    rocblas_seedrand();
+    rocblas_init<Th>(ha, rows, cols, lda);
+    for(size_t i = 0; i < ha.size(); i++)
+        ha[i] += Th(0.1) * Th(i % 7);
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(hipMemset(db, 0, sizeof(T) * db.size()));
+        CHECK_ROCBLAS_ERROR(rocblas_set_matrix_ex(rows, cols, ha, h_type, lda, db, d_type, ldb));
+        CHECK_HIP_ERROR(hb.transfer_from(db));
+        CHECK_ROCBLAS_ERROR(rocblas_get_matrix_ex(rows, cols, db, d_type, ldb, hc, h_type, ldc));
+
+        // reference calculation: the device matrix holds the rounded elements, which widen
+        // exactly to the host matrix
+        cpu_time_used = get_time_us_no_sync();
+        for(int i2 = 0; i2 < cols; i2++)
+            for(int i1 = 0; i1 < rows; i1++)
+            {
+                hb_gold[i1 + i2 * size_t(ldb)] = T(ha[i1 + i2 * size_t(lda)]);
+                hc_gold[i1 + i2 * size_t(ldc)] = Th(hb_gold[i1 + i2 * size_t(ldb)]);
+            }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(rows, cols, ldb, hb_gold, hb);
+            unit_check_general<Th>(rows, cols, ldc, hc_gold, hc);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error = norm_check_general<Th>('F', rows, cols, ldc, hc_gold, hc);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_set_matrix_ex(rows, cols, ha, h_type, lda, db, d_type, ldb);
+            rocblas_get_matrix_ex(rows, cols, db, d_type, ldb, hc, h_type, ldc);
+        }
+
+        gpu_time_used = get_time_us_sync_device(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_set_matrix_ex(rows, cols, ha, h_type, lda, db, d_type, ldb);
+            rocblas_get_matrix_ex(rows, cols, db, d_type, ldb, hc, h_type, ldc);
+        }
+
+        gpu_time_used = get_time_us_sync_device() - gpu_time_used;
+
+        // only the elements of the device type are transferred
+        ArgumentModel<e_M, e_N, e_lda, e_ldb, e_ldc>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            set_get_matrix_gbyte_count<T>(rows, cols),
+            cpu_time_used,
+            rocblas_error);
+    }
+}
@@ -68,6 +68,10 @@ void testing_set_get_vector(const Arguments& arg)
     host_vector<T> hb(M * size_t(incb));
     host_vector<T> hy_gold(M * size_t(incy));
 
+    // pinned with rocblas-bench --pinned, so that set and get transfer at pinned bandwidth
+    host_pinned_registration hx_pinned(hx, sizeof(T) * hx.size());
+    host_pinned_registration hy_pinned(hy, sizeof(T) * hy.size());
+
     double gpu_time_used, cpu_time_used;
     gpu_time_used = cpu_time_used = 0.0;
     double rocblas_error          = 0.0;
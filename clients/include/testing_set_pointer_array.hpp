@@ -0,0 +1,317 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_set_pointer_array_bad_arg(const Arguments& arg)
+{
+    auto rocblas_set_pointer_array_fn
+        = arg.fortran ? rocblas_set_pointer_array_fortran : rocblas_set_pointer_array;
+
+    rocblas_local_handle handle{arg};
+
+    const rocblas_int    elem_size   = sizeof(T);
+    const rocblas_stride stride      = 100;
+    const rocblas_int    batch_count = 3;
+
+    device_vector<T>  d_base(stride * batch_count);
+    device_vector<T*> d_array(batch_count);
+    CHECK_DEVICE_ALLOCATION(d_base.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_array.memcheck());
+
+    void*  base      = (T*)d_base;
+    void** ptr_array = (void**)(T**)d_array;
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_set_pointer_array_fn(nullptr, elem_size, base, stride, batch_count, ptr_array),
+        rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_set_pointer_array_fn(handle, 0, base, stride, batch_count, ptr_array),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_set_pointer_array_fn(handle, elem_size, base, stride, -1, ptr_array),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_set_pointer_array_fn(handle, elem_size, base, stride, batch_count, nullptr),
+        rocblas_status_invalid_pointer);
+
+    // If batch_count is 0, the array is not written
+    EXPECT_ROCBLAS_STATUS(rocblas_set_pointer_array_fn(handle, elem_size, base, stride, 0, nullptr),
+                          rocblas_status_success);
+
+    // rocblas_get_pointer_array has no Fortran binding
+    if(arg.fortran)
+        return;
+
+    void* const* cached_array = nullptr;
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_get_pointer_array(nullptr, elem_size, base, stride, batch_count, &cached_array),
+        rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_get_pointer_array(handle, 0, base, stride, batch_count, &cached_array),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_get_pointer_array(handle, elem_size, base, stride, -1, &cached_array),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_get_pointer_array(handle, elem_size, base, stride, batch_count, nullptr),
+        rocblas_status_invalid_pointer);
+
+    // If batch_count is 0, no array is cached and nullptr is returned
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_get_pointer_array(handle, elem_size, base, stride, 0, &cached_array),
+        rocblas_status_success);
+    EXPECT_EQ(cached_array, nullptr);
+}
+
+// The arrays of pointers built on the device by rocblas_set_pointer_array must be those of the
+// strided batch, and give gemv_batched the results of gemv_strided_batched. The arrays returned
+// by rocblas_get_pointer_array must be the same, cached by the handle for repeated calls.
+template <typename T>
+void testing_set_pointer_array(const Arguments& arg)
+{
+    auto rocblas_set_pointer_array_fn
+        = arg.fortran ? rocblas_set_pointer_array_fortran : rocblas_set_pointer_array;
+    auto rocblas_gemv_batched_fn
+        = arg.fortran ? rocblas_gemv_batched<T, true> : rocblas_gemv_batched<T, false>;
+    auto rocblas_gemv_strided_batched_fn = arg.fortran ? rocblas_gemv_strided_batched<T, true>
+                                                       : rocblas_gemv_strided_batched<T, false>;
+
+    rocblas_int       M           = arg.M;
+    rocblas_int       N           = arg.N;
+    rocblas_int       lda         = arg.lda;
+    rocblas_int       incx        = arg.incx;
+    rocblas_int       incy        = arg.incy;
+    T                 h_alpha     = arg.get_alpha<T>();
+    T                 h_beta      = arg.get_beta<T>();
+    rocblas_operation transA      = char2rocblas_operation(arg.transA);
+    rocblas_stride    stride_a    = arg.stride_a;
+    rocblas_stride    stride_x    = arg.stride_x;
+    rocblas_stride    stride_y    = arg.stride_y;
+    rocblas_int       batch_count = arg.batch_count;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(batch_count <= 0)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_set_pointer_array_fn(
+                handle, sizeof(T), nullptr, stride_a, batch_count, nullptr),
+            batch_count < 0 ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t dim_x    = transA == rocblas_operation_none ? N : M;
+    size_t dim_y    = transA == rocblas_operation_none ? M : N;
+    size_t abs_incy = incy >= 0 ? incy : -incy;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_strided_batch_matrix<T> hA(M, N, lda, stride_a, batch_count);
+    host_strided_batch_vector<T> hx(dim_x, incx, stride_x, batch_count);
+    host_strided_batch_vector<T> hy_1(dim_y, incy, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_2(dim_y, incy, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_gold(dim_y, incy, stride_y, batch_count);
+    host_vector<T*>              hA_array(batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+
+    // Allocate device memory
+    device_strided_batch_matrix<T> dA(M, N, lda, stride_a, batch_count);
+    device_strided_batch_vector<T> dx(dim_x, incx, stride_x, batch_count);
+    device_strided_batch_vector<T> dy_1(dim_y, incy, stride_y, batch_count);
+    device_strided_batch_vector<T> dy_2(dim_y, incy, stride_y, batch_count);
+    device_vector<T*>              dA_array(batch_count);
+    device_vector<T*>              dx_array(batch_count);
+    device_vector<T*>              dy_array(batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_array.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_array.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_array.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hy_1, arg, rocblas_client_beta_sets_nan);
+
+    hy_2.copy_from(hy_1);
+    hy_gold.copy_from(hy_1);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy_1.transfer_from(hy_1));
+    CHECK_HIP_ERROR(dy_2.transfer_from(hy_2));
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_array_fn(
+            handle, sizeof(T), (T*)dA, stride_a, batch_count, (void**)(T**)dA_array));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_array_fn(
+            handle, sizeof(T), (T*)dx, stride_x, batch_count, (void**)(T**)dx_array));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_array_fn(
+            handle, sizeof(T), (T*)dy_1, stride_y, batch_count, (void**)(T**)dy_array));
+        handle.post_test(arg);
+
+        CHECK_HIP_ERROR(hA_array.transfer_from(dA_array));
+        for(rocblas_int b = 0; b < batch_count; b++)
+            ASSERT_EQ(hA_array[b], (T*)dA + b * stride_a);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_batched_fn(handle,
+                                                    transA,
+                                                    M,
+                                                    N,
+                                                    &h_alpha,
+                                                    dA_array,
+                                                    lda,
+                                                    dx_array,
+                                                    incx,
+                                                    &h_beta,
+                                                    dy_array,
+                                                    incy,
+                                                    batch_count));
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_strided_batched_fn(handle,
+                                                            transA,
+                                                            M,
+                                                            N,
+                                                            &h_alpha,
+                                                            dA,
+                                                            lda,
+                                                            stride_a,
+                                                            dx,
+                                                            incx,
+                                                            stride_x,
+                                                            &h_beta,
+                                                            dy_2,
+                                                            incy,
+                                                            stride_y,
+                                                            batch_count));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < batch_count; b++)
+            cblas_gemv<T>(transA, M, N, h_alpha, hA[b], lda, hx[b], incx, h_beta, hy_gold[b], incy);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy_1));
+        CHECK_HIP_ERROR(hy_2.transfer_from(dy_2));
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, dim_y, abs_incy, stride_y, hy_gold, hy_1, batch_count);
+            unit_check_general<T>(1, dim_y, abs_incy, stride_y, hy_gold, hy_2, batch_count);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>(
+                'F', 1, dim_y, abs_incy, stride_y, hy_gold, hy_1, batch_count);
+            rocblas_error_2 = norm_check_general<T>(
+                'F', 1, dim_y, abs_incy, stride_y, hy_gold, hy_2, batch_count);
+        }
+
+        if(!arg.fortran)
+        {
+            // The cached array is written once and returned again for the same strided batch
+            void* const* cA_array  = nullptr;
+            void* const* cA_array2 = nullptr;
+            void* const* cx_array  = nullptr;
+            CHECK_ROCBLAS_ERROR(rocblas_get_pointer_array(
+                handle, sizeof(T), (T*)dA, stride_a, batch_count, &cA_array));
+            CHECK_ROCBLAS_ERROR(rocblas_get_pointer_array(
+                handle, sizeof(T), (T*)dx, stride_x, batch_count, &cx_array));
+            CHECK_ROCBLAS_ERROR(rocblas_get_pointer_array(
+                handle, sizeof(T), (T*)dA, stride_a, batch_count, &cA_array2));
+            EXPECT_EQ(cA_array, cA_array2);
+            EXPECT_NE(cA_array, cx_array);
+
+            host_vector<T*> hcA_array(batch_count);
+            CHECK_HIP_ERROR(hipMemcpy(
+                hcA_array, cA_array, sizeof(T*) * batch_count, hipMemcpyDeviceToHost));
+            for(rocblas_int b = 0; b < batch_count; b++)
+                ASSERT_EQ(hcA_array[b], hA_array[b]);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_set_pointer_array_fn(
+                handle, sizeof(T), (T*)dA, stride_a, batch_count, (void**)(T**)dA_array);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+            rocblas_set_pointer_array_fn(
+                handle, sizeof(T), (T*)dA, stride_a, batch_count, (void**)(T**)dA_array);
+        });
+
+        // one pointer is written per batch
+        ArgumentModel<e_stride_a, e_batch_count>{}.log_args<T>(rocblas_cout,
+                                                              arg,
+                                                              gpu_time_used,
+                                                              ArgumentLogging::NA_value,
+                                                              sizeof(T*) / 1e9,
+                                                              cpu_time_used,
+                                                              rocblas_error_1,
+                                                              rocblas_error_2);
+    }
+}
@@ -0,0 +1,251 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <vector>
+
+template <typename T>
+void testing_solution_cache_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    rocblas_solution_cache_info info;
+    rocblas_tensile_host_stats  stats;
+    rocblas_int                 cu_count;
+
+    EXPECT_ROCBLAS_STATUS(rocblas_get_solution_cache_info(nullptr, &info),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_solution_cache_capacity(nullptr, 0),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_clear_solution_cache(nullptr), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_tensile_host_stats(nullptr, &stats),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_reset_tensile_host_stats(nullptr),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_tensile_host_timing(nullptr, 1),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_cu_count(nullptr, 0), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_cu_count(nullptr, &cu_count),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_get_solution_cache_info(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_tensile_host_stats(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_cu_count(handle, nullptr), rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_cu_count(handle, -1), rocblas_status_invalid_value);
+}
+
+// Check the per-handle cache of Tensile solution selections:
+// - the first gemm of a size populates the cache and the next ones hit it
+// - changing the performance metric or the capacity invalidates the cached selections
+// - the host stages of the calls are counted, and timed while timing is enabled
+// - the compute units set on the handle, or enabled by the CU mask of its stream, and the
+//   latency metric may select other solutions, but the result of small integers is the same
+template <typename T>
+void testing_solution_cache(const Arguments& arg)
+{
+    auto rocblas_gemm_fn = arg.fortran ? rocblas_gemm<T, true> : rocblas_gemm<T, false>;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M   = arg.M;
+    rocblas_int N   = arg.N;
+    rocblas_int K   = arg.K;
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_matrix<T> hA(A_row, A_col, lda);
+    host_matrix<T> hB(B_row, B_col, ldb);
+    host_matrix<T> hC(M, N, ldc);
+    host_matrix<T> hC_gold(M, N, ldc);
+    host_matrix<T> hC_1(M, N, ldc);
+
+    // Allocate device memory
+    device_matrix<T> dA(A_row, A_col, lda);
+    device_matrix<T> dB(B_row, B_col, ldb);
+    device_matrix<T> dC(M, N, ldc);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    auto run_gemm = [&](hipStream_t stream) {
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_fn(
+            handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    };
+
+    // The cache starts empty
+    rocblas_solution_cache_info info;
+    CHECK_ROCBLAS_ERROR(rocblas_clear_solution_cache(handle));
+    CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_info(handle, &info));
+    EXPECT_EQ(info.entries, 0);
+    EXPECT_EQ(info.hits, 0);
+
+    // The first call populates the cache, the second one hits it
+    run_gemm(0);
+    run_gemm(0);
+    CHECK_HIP_ERROR(hC_gold.transfer_from(dC));
+    CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_info(handle, &info));
+    if(info.capacity)
+    {
+        EXPECT_GE(info.entries, 1);
+        EXPECT_GE(info.hits, 1);
+    }
+
+    // Changing the performance metric invalidates cached selections
+    CHECK_ROCBLAS_ERROR(rocblas_set_performance_metric(handle, rocblas_default_performance_metric));
+    CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_info(handle, &info));
+    EXPECT_EQ(info.entries, 0);
+
+    // Clearing resets entries and statistics
+    run_gemm(0);
+    CHECK_ROCBLAS_ERROR(rocblas_clear_solution_cache(handle));
+    CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_info(handle, &info));
+    EXPECT_EQ(info.entries, 0);
+    EXPECT_EQ(info.hits, 0);
+    EXPECT_EQ(info.misses, 0);
+
+    // A capacity of 0 disables the cache
+    CHECK_ROCBLAS_ERROR(rocblas_set_solution_cache_capacity(handle, 0));
+    run_gemm(0);
+    run_gemm(0);
+    CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_info(handle, &info));
+    EXPECT_EQ(info.capacity, 0);
+    EXPECT_EQ(info.entries, 0);
+    EXPECT_EQ(info.hits, 0);
+
+    // Every problem is counted, and its host stages timed while timing is enabled
+    rocblas_tensile_host_stats stats;
+    CHECK_ROCBLAS_ERROR(rocblas_set_solution_cache_capacity(handle, 1024));
+    CHECK_ROCBLAS_ERROR(rocblas_reset_tensile_host_stats(handle));
+    CHECK_ROCBLAS_ERROR(rocblas_set_tensile_host_timing(handle, 1));
+    run_gemm(0);
+    run_gemm(0);
+    CHECK_ROCBLAS_ERROR(rocblas_get_tensile_host_stats(handle, &stats));
+    EXPECT_EQ(stats.calls, 2);
+    EXPECT_EQ(stats.launches, 2);
+    EXPECT_LE(stats.selections, 1);
+    EXPECT_GT(stats.construct_us + stats.select_us + stats.solve_us + stats.launch_us, 0);
+
+    // Without timing only the counts are updated, unless the profile is being logged
+    const char* layer     = getenv("ROCBLAS_LAYER");
+    bool        profiling = layer && (strtol(layer, nullptr, 0) & rocblas_layer_mode_log_profile);
+    CHECK_ROCBLAS_ERROR(rocblas_reset_tensile_host_stats(handle));
+    CHECK_ROCBLAS_ERROR(rocblas_set_tensile_host_timing(handle, 0));
+    run_gemm(0);
+    CHECK_ROCBLAS_ERROR(rocblas_get_tensile_host_stats(handle, &stats));
+    EXPECT_EQ(stats.calls, 1);
+    EXPECT_EQ(stats.selections, 0);
+    if(!profiling)
+        EXPECT_EQ(stats.launch_us, 0);
+
+    // Solutions are selected for the compute units set on the handle
+    rocblas_int cu_count, limited_cu_count;
+    CHECK_ROCBLAS_ERROR(rocblas_get_cu_count(handle, &cu_count));
+    EXPECT_GT(cu_count, 0);
+    const rocblas_int half_cu_count = (cu_count + 1) / 2;
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_cu_count(handle, half_cu_count));
+    CHECK_ROCBLAS_ERROR(rocblas_get_cu_count(handle, &limited_cu_count));
+    EXPECT_EQ(limited_cu_count, half_cu_count);
+    run_gemm(0);
+    CHECK_HIP_ERROR(hC_1.transfer_from(dC));
+    unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_cu_count(handle, cu_count + 1));
+    CHECK_ROCBLAS_ERROR(rocblas_get_cu_count(handle, &limited_cu_count));
+    EXPECT_EQ(limited_cu_count, cu_count);
+    CHECK_ROCBLAS_ERROR(rocblas_set_cu_count(handle, 0));
+
+    // or enabled by the CU mask of its stream
+    std::vector<uint32_t> cu_mask((cu_count + 31) / 32);
+    for(rocblas_int cu = 0; cu < half_cu_count; cu++)
+        cu_mask[cu / 32] |= 1u << (cu % 32);
+    hipStream_t masked_stream;
+    CHECK_HIP_ERROR(hipExtStreamCreateWithCUMask(&masked_stream, cu_mask.size(), cu_mask.data()));
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, masked_stream));
+    CHECK_ROCBLAS_ERROR(rocblas_get_cu_count(handle, &limited_cu_count));
+    EXPECT_EQ(limited_cu_count, half_cu_count);
+    run_gemm(masked_stream);
+    CHECK_HIP_ERROR(hC_1.transfer_from(dC));
+    unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, 0));
+    CHECK_HIP_ERROR(hipStreamDestroy(masked_stream));
+
+    // The latency metric may select another solution, and on a high-priority stream one
+    // splitting k
+    int least_priority, greatest_priority;
+    CHECK_HIP_ERROR(hipDeviceGetStreamPriorityRange(&least_priority, &greatest_priority));
+    hipStream_t priority_stream;
+    CHECK_HIP_ERROR(
+        hipStreamCreateWithPriority(&priority_stream, hipStreamNonBlocking, greatest_priority));
+    CHECK_ROCBLAS_ERROR(rocblas_set_performance_metric(handle, rocblas_latency_performance_metric));
+    for(hipStream_t stream : {hipStream_t(0), priority_stream})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+        run_gemm(stream);
+        CHECK_HIP_ERROR(hC_1.transfer_from(dC));
+        unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+    }
+    CHECK_ROCBLAS_ERROR(rocblas_set_performance_metric(handle, rocblas_default_performance_metric));
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, 0));
+    CHECK_HIP_ERROR(hipStreamDestroy(priority_stream));
+}
@@ -0,0 +1,443 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <cmath>
+
+// Fraction of the n elements of increment inc of the batches of y which are rounded up from one
+template <typename T>
+double stochastic_rounded_up_fraction(
+    const T* y, size_t n, rocblas_int inc, rocblas_stride stride, rocblas_int batch_count)
+{
+    size_t up = 0;
+    for(rocblas_int b = 0; b < batch_count; b++)
+        for(size_t i = 0; i < n; i++)
+            up += float(y[b * stride + i * std::abs(inc)]) > 1.0f;
+    return double(up) / (n * batch_count);
+}
+
+// Number of the n elements of increment inc of batch b0 of y and of batch b1 of z which differ
+template <typename T>
+size_t stochastic_rounding_differences(const T*       y,
+                                       rocblas_int    b0,
+                                       const T*       z,
+                                       rocblas_int    b1,
+                                       size_t         n,
+                                       rocblas_int    inc,
+                                       rocblas_stride stride)
+{
+    size_t diff = 0;
+    for(size_t i = 0; i < n; i++)
+        diff += float(y[b0 * stride + i * std::abs(inc)])
+                != float(z[b1 * stride + i * std::abs(inc)]);
+    return diff;
+}
+
+// Six standard deviations of the fraction of size elements rounded up with probability 1/8
+inline double stochastic_rounded_up_tolerance(size_t size)
+{
+    return 6 * std::sqrt(0.125 * 0.875 / size);
+}
+
+template <typename T>
+void testing_stochastic_rounding_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    bool     stochastic;
+    uint64_t seed, offset;
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_stochastic_rounding_mode(nullptr, true, 0, 0),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_get_stochastic_rounding_mode(nullptr, &stochastic, &seed, &offset),
+        rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_stochastic_rounding_mode(handle, nullptr, &seed, &offset),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_get_stochastic_rounding_mode(handle, &stochastic, nullptr, &offset),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_stochastic_rounding_mode(handle, &stochastic, &seed, nullptr),
+                          rocblas_status_invalid_pointer);
+}
+
+// In stochastic rounding mode the T results of axpy_ex, scal_ex and gemm_ex with float execution
+// of one plus an eighth of the spacing of T above one are rounded up for about an eighth of the
+// elements. The same seed and offset round the same elements in both pointer modes, another
+// offset and each batch round others, and rounding to nearest leaves them at one.
+template <typename T>
+void testing_stochastic_rounding(const Arguments& arg)
+{
+    rocblas_int N           = arg.N;
+    rocblas_int incx        = arg.incx;
+    rocblas_int incy        = arg.incy;
+    rocblas_int batch_count = arg.batch_count;
+
+    const rocblas_datatype type   = rocblas_type2datatype<T>();
+    const rocblas_datatype f_type = rocblas_datatype_f32_r;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    bool     stochastic = true;
+    uint64_t seed = 1, offset = 1;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stochastic_rounding_mode(handle, &stochastic, &seed, &offset));
+    EXPECT_FALSE(stochastic);
+    EXPECT_EQ(seed, 0u);
+    EXPECT_EQ(offset, 0u);
+    CHECK_ROCBLAS_ERROR(rocblas_set_stochastic_rounding_mode(handle, true, 7, 0));
+    CHECK_ROCBLAS_ERROR(rocblas_get_stochastic_rounding_mode(handle, &stochastic, &seed, &offset));
+    EXPECT_TRUE(stochastic);
+    EXPECT_EQ(seed, 7u);
+    EXPECT_EQ(offset, 0u);
+
+    // check to prevent undefined memory allocation error
+    if(N <= 0 || batch_count <= 0)
+    {
+        const float alpha = 1.0f;
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_strided_batched_ex(handle,
+                                                            N,
+                                                            &alpha,
+                                                            f_type,
+                                                            nullptr,
+                                                            type,
+                                                            incx,
+                                                            0,
+                                                            nullptr,
+                                                            type,
+                                                            incy,
+                                                            0,
+                                                            batch_count,
+                                                            f_type));
+        CHECK_ROCBLAS_ERROR(rocblas_scal_strided_batched_ex(
+            handle, N, &alpha, f_type, nullptr, type, incx, 0, batch_count, f_type));
+        return;
+    }
+
+    // An eighth of the spacing of T above one, 2^-10 for bfloat16 and 2^-13 for half
+    const float update = std::is_same<T, rocblas_bfloat16>{} ? 0x1p-10f : 0x1p-13f;
+
+    rocblas_int    abs_incx = incx >= 0 ? incx : -incx;
+    rocblas_int    abs_incy = incy >= 0 ? incy : -incy;
+    rocblas_stride stride_x = size_t(N) * abs_incx;
+    rocblas_stride stride_y = size_t(N) * abs_incy;
+
+    // gemm_ex of a column of ones and a row of update, added to C of ones with a beta of one
+    const rocblas_int    m        = 64;
+    const rocblas_int    n        = (N - 1) / m + 1;
+    const rocblas_stride stride_c = rocblas_stride(m) * n;
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    host_strided_batch_vector<T> hx(N, incx, stride_x, batch_count);
+    host_strided_batch_vector<T> hy(N, incy, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_1(N, incy, stride_y, batch_count);
+    host_strided_batch_vector<T> hy_2(N, incy, stride_y, batch_count);
+    host_strided_batch_vector<T> hx_1(N, incx, stride_x, batch_count);
+    host_strided_batch_matrix<T> hA(m, 1, m, m, batch_count);
+    host_strided_batch_matrix<T> hB(1, n, 1, n, batch_count);
+    host_strided_batch_matrix<T> hC(m, n, m, stride_c, batch_count);
+    host_strided_batch_matrix<T> hC_1(m, n, m, stride_c, batch_count);
+    host_strided_batch_matrix<T> hC_2(m, n, m, stride_c, batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hx.memcheck());
+    CHECK_HIP_ERROR(hy.memcheck());
+    CHECK_HIP_ERROR(hy_1.memcheck());
+    CHECK_HIP_ERROR(hy_2.memcheck());
+    CHECK_HIP_ERROR(hx_1.memcheck());
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hC.memcheck());
+    CHECK_HIP_ERROR(hC_1.memcheck());
+    CHECK_HIP_ERROR(hC_2.memcheck());
+
+    // Allocate device memory
+    device_strided_batch_vector<T> dx(N, incx, stride_x, batch_count);
+    device_strided_batch_vector<T> dy(N, incy, stride_y, batch_count);
+    device_strided_batch_matrix<T> dA(m, 1, m, m, batch_count);
+    device_strided_batch_matrix<T> dB(1, n, 1, n, batch_count);
+    device_strided_batch_matrix<T> dC(m, n, m, stride_c, batch_count);
+    device_vector<float>           d_scalars(2);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_scalars.memcheck());
+
+    // x of update, y, A and C of ones and B of update, and x of ones for scal_ex
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        for(size_t i = 0; i < size_t(stride_x); i++)
+        {
+            hx[b][i]   = T(update);
+            hx_1[b][i] = T(1.0f);
+        }
+        for(size_t i = 0; i < size_t(stride_y); i++)
+            hy[b][i] = T(1.0f);
+        for(rocblas_int i = 0; i < m; i++)
+            hA[b][i] = T(1.0f);
+        for(rocblas_int j = 0; j < n; j++)
+            hB[b][j] = T(update);
+        for(size_t i = 0; i < size_t(stride_c); i++)
+            hC[b][i] = T(1.0f);
+    }
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    // alpha of one for axpy_ex and gemm_ex, with a beta of one
+    const float h_scalars[2] = {1.0f, 1.0f};
+    CHECK_HIP_ERROR(hipMemcpy(d_scalars, h_scalars, sizeof(h_scalars), hipMemcpyHostToDevice));
+
+    // scal_ex of x of ones by one plus update
+    const float h_scale = 1.0f + update;
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error = 0.0;
+
+    auto axpy = [&](host_strided_batch_vector<T>& result, rocblas_pointer_mode mode) {
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, mode));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_strided_batched_ex(
+            handle,
+            N,
+            mode == rocblas_pointer_mode_device ? (const float*)d_scalars : &h_scalars[0],
+            f_type,
+            dx,
+            type,
+            incx,
+            stride_x,
+            dy,
+            type,
+            incy,
+            stride_y,
+            batch_count,
+            f_type));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(result.transfer_from(dy));
+    };
+
+    auto gemm = [&](host_strided_batch_matrix<T>& result, rocblas_pointer_mode mode) {
+        const bool   device = mode == rocblas_pointer_mode_device;
+        const float* alpha  = device ? (const float*)d_scalars : &h_scalars[0];
+        const float* beta   = device ? (const float*)d_scalars + 1 : &h_scalars[1];
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, mode));
+        if(batch_count == 1)
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_ex(handle,
+                                                rocblas_operation_none,
+                                                rocblas_operation_none,
+                                                m,
+                                                n,
+                                                1,
+                                                alpha,
+                                                dA,
+                                                type,
+                                                m,
+                                                dB,
+                                                type,
+                                                1,
+                                                beta,
+                                                dC,
+                                                type,
+                                                m,
+                                                dC,
+                                                type,
+                                                m,
+                                                f_type,
+                                                rocblas_gemm_algo_standard,
+                                                0,
+                                                0));
+        else
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_strided_batched_ex(handle,
+                                                                rocblas_operation_none,
+                                                                rocblas_operation_none,
+                                                                m,
+                                                                n,
+                                                                1,
+                                                                alpha,
+                                                                dA,
+                                                                type,
+                                                                m,
+                                                                m,
+                                                                dB,
+                                                                type,
+                                                                1,
+                                                                n,
+                                                                beta,
+                                                                dC,
+                                                                type,
+                                                                m,
+                                                                stride_c,
+                                                                dC,
+                                                                type,
+                                                                m,
+                                                                stride_c,
+                                                                batch_count,
+                                                                f_type,
+                                                                rocblas_gemm_algo_standard,
+                                                                0,
+                                                                0));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(result.transfer_from(dC));
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        const double tol_y = stochastic_rounded_up_tolerance(size_t(N) * batch_count);
+        const double tol_c = stochastic_rounded_up_tolerance(size_t(stride_c) * batch_count);
+
+        // axpy_ex, in both pointer modes, then with another offset
+        axpy(hy_1, rocblas_pointer_mode_host);
+        double fraction_y
+            = stochastic_rounded_up_fraction<T>(hy_1[0], N, incy, stride_y, batch_count);
+
+        axpy(hy_2, rocblas_pointer_mode_device);
+        if(arg.unit_check)
+            unit_check_general<T>(1, N, abs_incy, stride_y, hy_1, hy_2, batch_count);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_stochastic_rounding_mode(handle, true, 7, N));
+        axpy(hy_2, rocblas_pointer_mode_host);
+        double fraction_y_offset
+            = stochastic_rounded_up_fraction<T>(hy_2[0], N, incy, stride_y, batch_count);
+        size_t offset_differences = stochastic_rounding_differences<T>(
+            hy_1[0], 0, hy_2[0], 0, N, incy, stride_y);
+        CHECK_ROCBLAS_ERROR(rocblas_set_stochastic_rounding_mode(handle, true, 7, 0));
+
+        // scal_ex of ones by one plus update, in place
+        CHECK_HIP_ERROR(dx.transfer_from(hx_1));
+        CHECK_ROCBLAS_ERROR(rocblas_scal_strided_batched_ex(
+            handle, N, &h_scale, f_type, dx, type, incx, stride_x, batch_count, f_type));
+        CHECK_HIP_ERROR(hx_1.transfer_from(dx));
+        CHECK_HIP_ERROR(dx.transfer_from(hx));
+        double fraction_x
+            = stochastic_rounded_up_fraction<T>(hx_1[0], N, incx, stride_x, batch_count);
+
+        // gemm_ex or gemm_strided_batched_ex, in both pointer modes
+        gemm(hC_1, rocblas_pointer_mode_host);
+        gemm(hC_2, rocblas_pointer_mode_device);
+        double fraction_c
+            = stochastic_rounded_up_fraction<T>(hC_1[0], stride_c, 1, stride_c, batch_count);
+
+        if(arg.unit_check)
+        {
+            EXPECT_NEAR(fraction_y, 0.125, tol_y);
+            EXPECT_NEAR(fraction_y_offset, 0.125, tol_y);
+            EXPECT_NEAR(fraction_x, 0.125, tol_y);
+            EXPECT_NEAR(fraction_c, 0.125, tol_c);
+            unit_check_general<T>(m, n, m, stride_c, hC_1, hC_2, batch_count);
+
+            // Large enough vectors and batches cannot all round the same elements
+            if(N >= 1000)
+            {
+                EXPECT_NE(offset_differences, 0u);
+                for(rocblas_int b = 1; b < batch_count; b++)
+                {
+                    EXPECT_NE(stochastic_rounding_differences<T>(
+                                  hy_1[0], 0, hy_1[0], b, N, incy, stride_y),
+                              0u);
+                    EXPECT_NE(stochastic_rounding_differences<T>(
+                                  hC_1[0], 0, hC_1[0], b, stride_c, 1, stride_c),
+                              0u);
+                }
+            }
+        }
+
+        if(arg.norm_check)
+            rocblas_error = std::abs(fraction_y - 0.125);
+
+        // Rounding to nearest leaves the results at one
+        CHECK_ROCBLAS_ERROR(rocblas_set_stochastic_rounding_mode(handle, false, 0, 0));
+        axpy(hy_2, rocblas_pointer_mode_device);
+        gemm(hC_2, rocblas_pointer_mode_host);
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incy, stride_y, hy, hy_2, batch_count);
+            unit_check_general<T>(m, n, m, stride_c, hC, hC_2, batch_count);
+        }
+        CHECK_ROCBLAS_ERROR(rocblas_set_stochastic_rounding_mode(handle, true, 7, 0));
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+        auto axpy_stochastic = [&]() {
+            return rocblas_axpy_strided_batched_ex(handle,
+                                                   N,
+                                                   &h_scalars[0],
+                                                   f_type,
+                                                   dx,
+                                                   type,
+                                                   incx,
+                                                   stride_x,
+                                                   dy,
+                                                   type,
+                                                   incy,
+                                                   stride_y,
+                                                   batch_count,
+                                                   f_type);
+        };
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            CHECK_ROCBLAS_ERROR(axpy_stochastic());
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, axpy_stochastic);
+
+        ArgumentModel<e_N, e_incx, e_incy, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            axpy_gflop_count<T>(N),
+            axpy_gbyte_count<T>(N),
+            cpu_time_used,
+            rocblas_error);
+    }
+}
@@ -0,0 +1,356 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "tuning_db.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+template <typename T>
+void testing_tuning_db_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    rocblas_int value;
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_tuning_db_record(nullptr, true),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_autotune(nullptr, 0), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_gemm_autotune(nullptr, &value),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_workgroup_mapping(nullptr, 0),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_gemm_workgroup_mapping(nullptr, &value),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_load_tuning_db("rocblas_tuning_db_gtest_missing.db"),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_save_tuning_db(nullptr), rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_autotune(handle, -1), rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_gemm_autotune(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_workgroup_mapping(handle, -1),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_gemm_workgroup_mapping(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // A database written with another key layout is rejected, not mismatched
+    std::string                    path = "rocblas_tuning_db_gtest_version.db";
+    rocblas_tuning_db::file_header header{};
+    memcpy(header.magic, rocblas_tuning_db::MAGIC, sizeof(header.magic));
+    header.key_words = rocblas_tuning_db::KEY_WORDS;
+
+    header.version = rocblas_tuning_db::VERSION - 1;
+    std::ofstream(path, std::ios::binary)
+        .write(reinterpret_cast<const char*>(&header), sizeof(header));
+    EXPECT_ROCBLAS_STATUS(rocblas_load_tuning_db(path.c_str()), rocblas_status_invalid_value);
+
+    header.version = rocblas_tuning_db::VERSION;
+    std::ofstream(path, std::ios::binary)
+        .write(reinterpret_cast<const char*>(&header), sizeof(header));
+    EXPECT_ROCBLAS_STATUS(rocblas_load_tuning_db(path.c_str()), rocblas_status_success);
+
+    CHECK_ROCBLAS_ERROR(rocblas_load_tuning_db(nullptr));
+    std::remove(path.c_str());
+}
+
+// Check that the solutions chosen by the tuning controls compute the same gemm_ex result:
+// - a solution recorded in a saved and reloaded tuning database is used by default selection,
+//   on the recording device and on the other devices of the same arch
+// - autotuning times the candidates with D in workspace, so an in-place C is updated once
+// - a workgroup mapping hint only changes the order in which the tiles of C are computed
+template <typename T>
+void testing_tuning_db(const Arguments& arg)
+{
+    auto rocblas_gemm_ex_fn = arg.fortran ? rocblas_gemm_ex_fortran : rocblas_gemm_ex;
+
+    const rocblas_datatype type = rocblas_type2datatype<T>();
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M   = arg.M;
+    rocblas_int N   = arg.N;
+    rocblas_int K   = arg.K;
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_matrix<T> hA(A_row, A_col, lda);
+    host_matrix<T> hB(B_row, B_col, ldb);
+    host_matrix<T> hC(M, N, ldc);
+    host_matrix<T> hC_gold(M, N, ldc);
+    host_matrix<T> hC_1(M, N, ldc);
+
+    // Allocate device memory
+    device_matrix<T> dA(A_row, A_col, lda);
+    device_matrix<T> dB(B_row, B_col, ldb);
+    device_matrix<T> dC(M, N, ldc);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    hC_gold = hC;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    // CPU BLAS
+    cblas_gemm<T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC_gold, ldc);
+
+    // Runs C := alpha * op(A) * op(B) + beta * C in place and checks it against the reference
+    auto check_gemm_ex = [&](rocblas_gemm_algo algo, int32_t solution_index) {
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_fn(handle,
+                                               transA,
+                                               transB,
+                                               M,
+                                               N,
+                                               K,
+                                               &h_alpha,
+                                               dA,
+                                               type,
+                                               lda,
+                                               dB,
+                                               type,
+                                               ldb,
+                                               &h_beta,
+                                               dC,
+                                               type,
+                                               ldc,
+                                               dC,
+                                               type,
+                                               ldc,
+                                               type,
+                                               algo,
+                                               solution_index,
+                                               rocblas_gemm_flags_none));
+        CHECK_HIP_ERROR(hC_1.transfer_from(dC));
+        if(arg.unit_check)
+            unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+        if(arg.norm_check)
+        {
+            double error = norm_check_general<T>('F', M, N, ldc, hC_gold, hC_1);
+            EXPECT_LE(error, K * sum_error_tolerance<T>);
+        }
+    };
+
+    // Record a solution, write the database, and reload it
+    rocblas_int num_solutions = 0;
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_get_solutions(handle,
+                                                      transA,
+                                                      transB,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      &h_alpha,
+                                                      dA,
+                                                      type,
+                                                      lda,
+                                                      dB,
+                                                      type,
+                                                      ldb,
+                                                      &h_beta,
+                                                      dC,
+                                                      type,
+                                                      ldc,
+                                                      dC,
+                                                      type,
+                                                      ldc,
+                                                      type,
+                                                      rocblas_gemm_algo_solution_index,
+                                                      rocblas_gemm_flags_none,
+                                                      nullptr,
+                                                      &num_solutions));
+    if(num_solutions)
+    {
+        std::vector<rocblas_int> solutions(num_solutions);
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_get_solutions(handle,
+                                                          transA,
+                                                          transB,
+                                                          M,
+                                                          N,
+                                                          K,
+                                                          &h_alpha,
+                                                          dA,
+                                                          type,
+                                                          lda,
+                                                          dB,
+                                                          type,
+                                                          ldb,
+                                                          &h_beta,
+                                                          dC,
+                                                          type,
+                                                          ldc,
+                                                          dC,
+                                                          type,
+                                                          ldc,
+                                                          type,
+                                                          rocblas_gemm_algo_solution_index,
+                                                          rocblas_gemm_flags_none,
+                                                          solutions.data(),
+                                                          &num_solutions));
+
+        std::string path = "rocblas_tuning_db_gtest.db";
+        CHECK_ROCBLAS_ERROR(rocblas_set_tuning_db_record(handle, true));
+        check_gemm_ex(rocblas_gemm_algo_solution_index, solutions.back());
+        CHECK_ROCBLAS_ERROR(rocblas_set_tuning_db_record(handle, false));
+        CHECK_ROCBLAS_ERROR(rocblas_save_tuning_db(path.c_str()));
+        CHECK_ROCBLAS_ERROR(rocblas_load_tuning_db(path.c_str()));
+
+        // Default selection now uses the tuned solution, without a Tensile selection
+        rocblas_tensile_host_stats stats;
+        CHECK_ROCBLAS_ERROR(rocblas_reset_tensile_host_stats(handle));
+        check_gemm_ex(rocblas_gemm_algo_solution_index, 0);
+        CHECK_ROCBLAS_ERROR(rocblas_get_tensile_host_stats(handle, &stats));
+        EXPECT_EQ(stats.selections, 0);
+
+        // The tuned solution is also used by the handles of other devices of the same arch
+        int device_count, home;
+        CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+        CHECK_HIP_ERROR(hipGetDevice(&home));
+
+        std::vector<std::string> arch_names(device_count);
+        for(int d = 0; d < device_count; d++)
+        {
+            hipDeviceProp_t props;
+            CHECK_HIP_ERROR(hipGetDeviceProperties(&props, d));
+            arch_names[d] = props.gcnArchName;
+            arch_names[d] = arch_names[d].substr(0, arch_names[d].find(':'));
+        }
+
+        for(int d = 0; d < device_count; d++)
+        {
+            if(d == home || arch_names[d] != arch_names[home])
+                continue;
+
+            CHECK_HIP_ERROR(hipSetDevice(d));
+            {
+                rocblas_local_handle handle_d{arg};
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle_d, rocblas_pointer_mode_host));
+
+                device_matrix<T> dA_d(A_row, A_col, lda);
+                device_matrix<T> dB_d(B_row, B_col, ldb);
+                device_matrix<T> dC_d(M, N, ldc);
+                CHECK_DEVICE_ALLOCATION(dA_d.memcheck());
+                CHECK_DEVICE_ALLOCATION(dB_d.memcheck());
+                CHECK_DEVICE_ALLOCATION(dC_d.memcheck());
+                CHECK_HIP_ERROR(dA_d.transfer_from(hA));
+                CHECK_HIP_ERROR(dB_d.transfer_from(hB));
+                CHECK_HIP_ERROR(dC_d.transfer_from(hC));
+
+                CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_fn(handle_d,
+                                                       transA,
+                                                       transB,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       &h_alpha,
+                                                       dA_d,
+                                                       type,
+                                                       lda,
+                                                       dB_d,
+                                                       type,
+                                                       ldb,
+                                                       &h_beta,
+                                                       dC_d,
+                                                       type,
+                                                       ldc,
+                                                       dC_d,
+                                                       type,
+                                                       ldc,
+                                                       type,
+                                                       rocblas_gemm_algo_solution_index,
+                                                       0,
+                                                       rocblas_gemm_flags_none));
+                CHECK_ROCBLAS_ERROR(rocblas_get_tensile_host_stats(handle_d, &stats));
+                EXPECT_EQ(stats.selections, 0);
+
+                CHECK_HIP_ERROR(hC_1.transfer_from(dC_d));
+                if(arg.unit_check)
+                    unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+                if(arg.norm_check)
+                {
+                    double error = norm_check_general<T>('F', M, N, ldc, hC_gold, hC_1);
+                    EXPECT_LE(error, K * sum_error_tolerance<T>);
+                }
+            }
+            CHECK_HIP_ERROR(hipSetDevice(home));
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_load_tuning_db(nullptr));
+        std::remove(path.c_str());
+    }
+
+    // Autotuning updates C once, whichever candidate is selected
+    rocblas_int candidates = 0;
+    CHECK_ROCBLAS_ERROR(rocblas_set_gemm_autotune(handle, 4));
+    CHECK_ROCBLAS_ERROR(rocblas_get_gemm_autotune(handle, &candidates));
+    EXPECT_EQ(candidates, 4);
+    check_gemm_ex(rocblas_gemm_algo_standard, 0);
+    CHECK_ROCBLAS_ERROR(rocblas_set_gemm_autotune(handle, 0));
+
+    // The workgroup mapping does not change the result
+    rocblas_int wgm = 0;
+    CHECK_ROCBLAS_ERROR(rocblas_set_gemm_workgroup_mapping(handle, 8));
+    CHECK_ROCBLAS_ERROR(rocblas_get_gemm_workgroup_mapping(handle, &wgm));
+    EXPECT_EQ(wgm, 8);
+    check_gemm_ex(rocblas_gemm_algo_standard, 0);
+    CHECK_ROCBLAS_ERROR(rocblas_set_gemm_workgroup_mapping(handle, 0));
+}
@@ -0,0 +1,263 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_device_malloc.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_workspace_size.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_workspace_scope_bad_arg(const Arguments&)
+{
+    // A new handle, whatever rocblas-bench selects for the workspace of its handles
+    rocblas_handle handle;
+    CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+    void* reserved = &reserved;
+
+    EXPECT_ROCBLAS_STATUS(rocblas_pop_workspace_scope(handle), rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_push_workspace_scope(handle, 0, 0, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_push_workspace_scope(nullptr, 0, 0, &reserved),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_pop_workspace_scope(nullptr), rocblas_status_invalid_handle);
+
+    // A workspace too small for the scope is not reallocated
+    const size_t reserved_bytes = 1024 * sizeof(T);
+    size_t       reserved_size;
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ROCBLAS_ERROR(rocblas_push_workspace_scope(handle, reserved_bytes, 0, &reserved));
+    CHECK_ROCBLAS_ERROR(rocblas_pop_workspace_scope(handle));
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &reserved_size));
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, reserved_size));
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_push_workspace_scope(handle, reserved_bytes, reserved_bytes, &reserved),
+        rocblas_status_memory_error);
+    EXPECT_ROCBLAS_STATUS(rocblas_pop_workspace_scope(handle), rocblas_status_invalid_value);
+
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+}
+
+// A caller reserving a panel in a workspace scope and calling trsm in it, as a solver would,
+// runs in the single block of device memory returned by a size query
+template <typename T>
+void testing_workspace_scope(const Arguments& arg)
+{
+    rocblas_int M   = arg.M;
+    rocblas_int N   = arg.N;
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+
+    rocblas_side      side    = char2rocblas_side(arg.side);
+    rocblas_fill      uplo    = char2rocblas_fill(arg.uplo);
+    rocblas_operation transA  = char2rocblas_operation(arg.transA);
+    rocblas_diagonal  diag    = char2rocblas_diagonal(arg.diag);
+    T                 alpha_h = arg.get_alpha<T>();
+
+    rocblas_int K = side == rocblas_side_left ? M : N;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    // Calls in a scope return early as they would outside of one
+    bool invalid_size = M < 0 || N < 0 || lda < K || ldb < M;
+    if(invalid_size || !M || !N)
+    {
+        rocblas_workspace_scope scope(handle, 0);
+        CHECK_ROCBLAS_ERROR(scope.status());
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_trsm<T>(
+                handle, side, uplo, transA, diag, M, N, nullptr, nullptr, lda, nullptr, ldb),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    const size_t panel_bytes = sizeof(T) * ldb * N;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_matrix<T> hA(K, K, lda);
+    host_matrix<T> hX(M, N, ldb);
+    host_matrix<T> hB(M, N, ldb);
+    host_matrix<T> hB_ref(M, N, ldb);
+    host_matrix<T> hB_scope(M, N, ldb);
+
+    // Allocate device memory
+    device_matrix<T> dA(K, K, lda);
+    device_matrix<T> dB(M, N, ldb);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(hA,
+                        arg,
+                        rocblas_client_never_set_nan,
+                        rocblas_client_diagonally_dominant_triangular_matrix,
+                        true);
+    rocblas_init_matrix(
+        hX, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
+
+    if(diag == rocblas_diagonal_unit)
+        make_unit_diagonal(uplo, (T*)hA, lda, K);
+
+    // Calculate hB = hA*hX / alpha, so that the solution is hX
+    hB = hX;
+    if(alpha_h != T(0))
+        cblas_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA, lda, hB, ldb);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    auto rocblas_trsm_fn = [&](T* B) {
+        return rocblas_trsm<T>(handle, side, uplo, transA, diag, M, N, &alpha_h, dA, lda, B, ldb);
+    };
+
+    // Reference outside of any scope
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_ROCBLAS_ERROR(rocblas_trsm_fn(dB));
+    CHECK_HIP_ERROR(hB_ref.transfer_from(dB));
+
+    size_t trsm_size;
+    CHECK_ROCBLAS_ERROR(rocblas_trsm_workspace_size<T>(
+        handle, side, uplo, transA, diag, M, N, lda, ldb, &trsm_size));
+
+    // A query adds the reserved region to the sizes of the calls made in the scope
+    size_t panel_size, total_size;
+    void*  reserved = &reserved;
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ROCBLAS_ERROR(rocblas_push_workspace_scope(handle, panel_bytes, 0, &reserved));
+    EXPECT_EQ(reserved, nullptr);
+    CHECK_ROCBLAS_ERROR(rocblas_pop_workspace_scope(handle));
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &panel_size));
+    EXPECT_GE(panel_size, panel_bytes);
+
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    {
+        rocblas_workspace_scope scope(handle, panel_bytes);
+        CHECK_ROCBLAS_ERROR(scope.status());
+        CHECK_ALLOC_QUERY(rocblas_trsm_fn(dB));
+    }
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &total_size));
+    EXPECT_EQ(total_size, panel_size + trsm_size);
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double max_err                = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // Both with a workspace of the queried size and with one managed by rocBLAS
+        for(size_t device_memory_size : {total_size, size_t(0)})
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, device_memory_size));
+            {
+                rocblas_workspace_scope scope(handle, panel_bytes, trsm_size);
+                CHECK_ROCBLAS_ERROR(scope.status());
+
+                // The panel is the caller's, and trsm takes the rest of the workspace
+                T* panel = static_cast<T*>(scope);
+                ASSERT_NE(panel, nullptr);
+                CHECK_HIP_ERROR(hipMemcpy(panel, (T*)hB, panel_bytes, hipMemcpyHostToDevice));
+                CHECK_ROCBLAS_ERROR(rocblas_trsm_fn(panel));
+                CHECK_HIP_ERROR(hipMemcpy((T*)hB_scope, panel, panel_bytes, hipMemcpyDeviceToHost));
+
+                if(device_memory_size)
+                {
+                    size_t size;
+                    CHECK_ROCBLAS_ERROR(rocblas_get_device_memory_size(handle, &size));
+                    EXPECT_EQ(size, total_size);
+                }
+            }
+
+            // The same kernels run in the scope as outside of it
+            if(arg.unit_check)
+                unit_check_general<T>(M, N, ldb, hB_ref, hB_scope);
+
+            if(arg.norm_check)
+                max_err = std::max(
+                    max_err, std::abs(norm_check_general<T>('F', M, N, ldb, hB_ref, hB_scope)));
+        }
+
+        // The solution in the panel is hX
+        if(arg.unit_check && alpha_h != T(0))
+        {
+            const double error_eps_multiplier = 40;
+            const double eps                  = std::numeric_limits<real_t<T>>::epsilon();
+
+            double err = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hX, hB_scope));
+            trsm_err_res_check<T>(err, M, error_eps_multiplier, eps);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        // The panel is reserved once, as a solver would, and solved in place by the calls
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, total_size));
+        {
+            rocblas_workspace_scope scope(handle, panel_bytes, trsm_size);
+            CHECK_ROCBLAS_ERROR(scope.status());
+
+            T* panel = static_cast<T*>(scope);
+            CHECK_HIP_ERROR(hipMemcpy(panel, (T*)hB, panel_bytes, hipMemcpyHostToDevice));
+
+            for(int iter = 0; iter < number_cold_calls; iter++)
+            {
+                CHECK_ROCBLAS_ERROR(rocblas_trsm_fn(panel));
+            }
+
+            gpu_time_used = get_time_us_hot_calls(stream, number_hot_calls, [&] {
+                CHECK_ROCBLAS_ERROR(rocblas_trsm_fn(panel));
+            });
+        }
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, 0));
+
+        ArgumentModel<e_side, e_uplo, e_transA, e_diag, e_M, e_N, e_alpha, e_lda, e_ldb>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         trsm_gflop_count<T>(M, N, K),
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         max_err);
+    }
+}
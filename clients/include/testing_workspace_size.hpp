@@ -0,0 +1,592 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <future>
+#include <thread>
+#include <vector>
+
+// The workspace size functions are beta features without Fortran bindings, so only their
+// precision is templated here
+
+// trsm_workspace_size
+template <typename T>
+static rocblas_status (*rocblas_trsm_workspace_size)(rocblas_handle    handle,
+                                                     rocblas_side      side,
+                                                     rocblas_fill      uplo,
+                                                     rocblas_operation transA,
+                                                     rocblas_diagonal  diag,
+                                                     rocblas_int       m,
+                                                     rocblas_int       n,
+                                                     rocblas_int       lda,
+                                                     rocblas_int       ldb,
+                                                     size_t*           size);
+
+template <>
+static auto rocblas_trsm_workspace_size<float> = rocblas_strsm_workspace_size;
+template <>
+static auto rocblas_trsm_workspace_size<double> = rocblas_dtrsm_workspace_size;
+template <>
+static auto rocblas_trsm_workspace_size<rocblas_float_complex> = rocblas_ctrsm_workspace_size;
+template <>
+static auto rocblas_trsm_workspace_size<rocblas_double_complex> = rocblas_ztrsm_workspace_size;
+
+// trtri_workspace_size
+template <typename T>
+static rocblas_status (*rocblas_trtri_workspace_size)(rocblas_handle   handle,
+                                                      rocblas_fill     uplo,
+                                                      rocblas_diagonal diag,
+                                                      rocblas_int      n,
+                                                      rocblas_int      lda,
+                                                      rocblas_int      ldinvA,
+                                                      size_t*          size);
+
+template <>
+static auto rocblas_trtri_workspace_size<float> = rocblas_strtri_workspace_size;
+template <>
+static auto rocblas_trtri_workspace_size<double> = rocblas_dtrtri_workspace_size;
+template <>
+static auto rocblas_trtri_workspace_size<rocblas_float_complex> = rocblas_ctrtri_workspace_size;
+template <>
+static auto rocblas_trtri_workspace_size<rocblas_double_complex> = rocblas_ztrtri_workspace_size;
+
+// trsv_workspace_size
+template <typename T>
+static rocblas_status (*rocblas_trsv_workspace_size)(rocblas_handle    handle,
+                                                     rocblas_fill      uplo,
+                                                     rocblas_operation transA,
+                                                     rocblas_diagonal  diag,
+                                                     rocblas_int       m,
+                                                     rocblas_int       lda,
+                                                     rocblas_int       incx,
+                                                     size_t*           size);
+
+template <>
+static auto rocblas_trsv_workspace_size<float> = rocblas_strsv_workspace_size;
+template <>
+static auto rocblas_trsv_workspace_size<double> = rocblas_dtrsv_workspace_size;
+template <>
+static auto rocblas_trsv_workspace_size<rocblas_float_complex> = rocblas_ctrsv_workspace_size;
+template <>
+static auto rocblas_trsv_workspace_size<rocblas_double_complex> = rocblas_ztrsv_workspace_size;
+
+// asum_workspace_size
+template <typename T>
+static rocblas_status (*rocblas_asum_workspace_size)(rocblas_handle handle,
+                                                     rocblas_int    n,
+                                                     rocblas_int    incx,
+                                                     size_t*        size);
+
+template <>
+static auto rocblas_asum_workspace_size<float> = rocblas_sasum_workspace_size;
+template <>
+static auto rocblas_asum_workspace_size<double> = rocblas_dasum_workspace_size;
+template <>
+static auto rocblas_asum_workspace_size<rocblas_float_complex> = rocblas_scasum_workspace_size;
+template <>
+static auto rocblas_asum_workspace_size<rocblas_double_complex> = rocblas_dzasum_workspace_size;
+
+// nrm2_workspace_size
+template <typename T>
+static rocblas_status (*rocblas_nrm2_workspace_size)(rocblas_handle handle,
+                                                     rocblas_int    n,
+                                                     rocblas_int    incx,
+                                                     size_t*        size);
+
+template <>
+static auto rocblas_nrm2_workspace_size<float> = rocblas_snrm2_workspace_size;
+template <>
+static auto rocblas_nrm2_workspace_size<double> = rocblas_dnrm2_workspace_size;
+template <>
+static auto rocblas_nrm2_workspace_size<rocblas_float_complex> = rocblas_scnrm2_workspace_size;
+template <>
+static auto rocblas_nrm2_workspace_size<rocblas_double_complex> = rocblas_dznrm2_workspace_size;
+
+// dot_workspace_size
+template <typename T>
+static rocblas_status (*rocblas_dot_workspace_size)(
+    rocblas_handle handle, rocblas_int n, rocblas_int incx, rocblas_int incy, size_t* size);
+
+template <>
+static auto rocblas_dot_workspace_size<float> = rocblas_sdot_workspace_size;
+template <>
+static auto rocblas_dot_workspace_size<double> = rocblas_ddot_workspace_size;
+template <>
+static auto rocblas_dot_workspace_size<rocblas_float_complex> = rocblas_cdotu_workspace_size;
+template <>
+static auto rocblas_dot_workspace_size<rocblas_double_complex> = rocblas_zdotu_workspace_size;
+
+// iamax_workspace_size
+template <typename T>
+static rocblas_status (*rocblas_iamax_workspace_size)(rocblas_handle handle,
+                                                      rocblas_int    n,
+                                                      rocblas_int    incx,
+                                                      size_t*        size);
+
+template <>
+static auto rocblas_iamax_workspace_size<float> = rocblas_isamax_workspace_size;
+template <>
+static auto rocblas_iamax_workspace_size<double> = rocblas_idamax_workspace_size;
+template <>
+static auto rocblas_iamax_workspace_size<rocblas_float_complex> = rocblas_icamax_workspace_size;
+template <>
+static auto rocblas_iamax_workspace_size<rocblas_double_complex> = rocblas_izamax_workspace_size;
+
+template <typename T>
+void testing_workspace_size_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    const rocblas_int N = 100;
+
+    size_t                      size;
+    rocblas_device_memory_stats stats;
+
+    EXPECT_ROCBLAS_STATUS(rocblas_asum_workspace_size<T>(nullptr, N, 1, &size),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_device_memory_stats(nullptr, nullptr, &stats),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_asum_workspace_size<T>(handle, N, 1, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_dot_workspace_size<T>(handle, N, 1, 1, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_device_memory_stats(handle, nullptr, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trtri_workspace_size<T>(
+            handle, rocblas_fill_upper, rocblas_diagonal_unit, N, N - 1, N, &size),
+        rocblas_status_invalid_size);
+
+    // Only handles acquired from the handle pool are released to it
+    EXPECT_ROCBLAS_STATUS(rocblas_handle_pool_release(handle), rocblas_status_invalid_handle);
+}
+
+// Check that the workspace size functions report the device memory the functions request,
+// and that the device memory statistics, workspace pools, handle pool and thread handles
+// account for and share it correctly
+template <typename T>
+void testing_workspace_size(const Arguments& arg)
+{
+    const rocblas_int N = arg.N;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    T alpha = arg.get_alpha<T>();
+    T beta  = arg.get_beta<T>();
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_matrix<T> hA(N, N, N);
+    host_matrix<T> hB(N, N, N);
+
+    // Allocate device memory
+    device_matrix<T> dA(N, N, N);
+    device_matrix<T> dB(N, N, N);
+    device_matrix<T> dC(N, N, N);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(hA, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(hB, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    // The size returned by a workspace size function must match a device memory
+    // size query of the function itself
+    auto queried_size = [&](auto&& func) {
+        size_t size = 0;
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        func();
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        return size;
+    };
+
+    size_t size, expected;
+
+    CHECK_ROCBLAS_ERROR(rocblas_trsm_workspace_size<T>(handle,
+                                                       rocblas_side_left,
+                                                       rocblas_fill_lower,
+                                                       rocblas_operation_none,
+                                                       rocblas_diagonal_non_unit,
+                                                       N,
+                                                       N,
+                                                       N,
+                                                       N,
+                                                       &size));
+    expected = queried_size([&] {
+        rocblas_trsm<T>(handle,
+                        rocblas_side_left,
+                        rocblas_fill_lower,
+                        rocblas_operation_none,
+                        rocblas_diagonal_non_unit,
+                        N,
+                        N,
+                        &alpha,
+                        dA,
+                        N,
+                        dB,
+                        N);
+    });
+    EXPECT_EQ(size, expected);
+
+    CHECK_ROCBLAS_ERROR(rocblas_trtri_workspace_size<T>(
+        handle, rocblas_fill_upper, rocblas_diagonal_unit, N, N, N, &size));
+    expected = queried_size([&] {
+        rocblas_trtri<T>(handle, rocblas_fill_upper, rocblas_diagonal_unit, N, dA, N, dB, N);
+    });
+    EXPECT_EQ(size, expected);
+
+    CHECK_ROCBLAS_ERROR(rocblas_trsv_workspace_size<T>(handle,
+                                                       rocblas_fill_lower,
+                                                       rocblas_operation_transpose,
+                                                       rocblas_diagonal_non_unit,
+                                                       N,
+                                                       N,
+                                                       1,
+                                                       &size));
+    expected = queried_size([&] {
+        rocblas_trsv<T>(handle,
+                        rocblas_fill_lower,
+                        rocblas_operation_transpose,
+                        rocblas_diagonal_non_unit,
+                        N,
+                        dA,
+                        N,
+                        dB,
+                        1);
+    });
+    EXPECT_EQ(size, expected);
+
+    CHECK_ROCBLAS_ERROR(rocblas_asum_workspace_size<T>(handle, N, 1, &size));
+    expected = queried_size([&] {
+        real_t<T> result;
+        rocblas_asum<T>(handle, N, dA, 1, &result);
+    });
+    EXPECT_EQ(size, expected);
+
+    CHECK_ROCBLAS_ERROR(rocblas_nrm2_workspace_size<T>(handle, N, 1, &size));
+    expected = queried_size([&] {
+        real_t<T> result;
+        rocblas_nrm2<T>(handle, N, dA, 1, &result);
+    });
+    EXPECT_EQ(size, expected);
+
+    CHECK_ROCBLAS_ERROR(rocblas_dot_workspace_size<T>(handle, N, 1, 1, &size));
+    expected = queried_size([&] {
+        T result;
+        rocblas_dot<T>(handle, N, dA, 1, dB, 1, &result);
+    });
+    EXPECT_EQ(size, expected);
+
+    CHECK_ROCBLAS_ERROR(rocblas_iamax_workspace_size<T>(handle, N, 1, &size));
+    expected = queried_size([&] {
+        rocblas_int result;
+        rocblas_iamax<T>(handle, N, dA, 1, &result);
+    });
+    EXPECT_EQ(size, expected);
+
+    const rocblas_datatype type = rocblas_type2datatype<T>();
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_workspace_size(handle,
+                                                       rocblas_operation_none,
+                                                       rocblas_operation_none,
+                                                       N,
+                                                       N,
+                                                       N,
+                                                       type,
+                                                       N,
+                                                       type,
+                                                       N,
+                                                       type,
+                                                       N,
+                                                       type,
+                                                       N,
+                                                       type,
+                                                       rocblas_gemm_algo_standard,
+                                                       0,
+                                                       0,
+                                                       &size));
+    expected = queried_size([&] {
+        rocblas_gemm_ex(handle,
+                        rocblas_operation_none,
+                        rocblas_operation_none,
+                        N,
+                        N,
+                        N,
+                        &alpha,
+                        dA,
+                        type,
+                        N,
+                        dB,
+                        type,
+                        N,
+                        &beta,
+                        dC,
+                        type,
+                        N,
+                        dC,
+                        type,
+                        N,
+                        type,
+                        rocblas_gemm_algo_standard,
+                        0,
+                        0);
+    });
+    EXPECT_EQ(size, expected);
+
+    // A workspace size query does not disturb a device memory size query in progress
+    size_t total = 0;
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ROCBLAS_ERROR(rocblas_asum_workspace_size<T>(handle, N, 1, &size));
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &total));
+    EXPECT_EQ(total, 0);
+
+    // Empty problems need no workspace
+    CHECK_ROCBLAS_ERROR(rocblas_nrm2_workspace_size<T>(handle, 0, 1, &size));
+    EXPECT_EQ(size, 0);
+
+    // Device memory allocations are counted, with the largest device memory in use,
+    // and with the profile layer for each function
+    const char* layer     = getenv("ROCBLAS_LAYER");
+    bool        profiling = layer && (strtol(layer, nullptr, 0) & rocblas_layer_mode_log_profile);
+    rocblas_device_memory_stats stats;
+    T                           result;
+    CHECK_ROCBLAS_ERROR(rocblas_dot_workspace_size<T>(handle, N, 1, 1, &size));
+    CHECK_ROCBLAS_ERROR(rocblas_reset_device_memory_stats(handle));
+    CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, dA, 1, dB, 1, &result));
+    CHECK_ROCBLAS_ERROR(rocblas_get_device_memory_stats(handle, nullptr, &stats));
+    EXPECT_EQ(stats.failures, 0);
+    if(size)
+    {
+        EXPECT_EQ(stats.allocations, 1);
+        EXPECT_EQ(stats.total_size, size);
+        EXPECT_EQ(stats.peak_size, size);
+    }
+
+    const char* dot_name = std::is_same<T, float>{}                   ? "rocblas_sdot"
+                           : std::is_same<T, double>{}                ? "rocblas_ddot"
+                           : std::is_same<T, rocblas_float_complex>{} ? "rocblas_cdotu"
+                                                                      : "rocblas_zdotu";
+    CHECK_ROCBLAS_ERROR(rocblas_get_device_memory_stats(handle, dot_name, &stats));
+    EXPECT_EQ(stats.allocations, profiling && size ? 1 : 0);
+    CHECK_ROCBLAS_ERROR(rocblas_get_device_memory_stats(handle, "rocblas_strsm", &stats));
+    EXPECT_EQ(stats.allocations, 0);
+
+    CHECK_ROCBLAS_ERROR(rocblas_reset_device_memory_stats(handle));
+    CHECK_ROCBLAS_ERROR(rocblas_get_device_memory_stats(handle, nullptr, &stats));
+    EXPECT_EQ(stats.allocations, 0);
+    EXPECT_EQ(stats.peak_size, 0);
+
+    // A new handle allocates no device memory, and its memory pool holds nothing, until a
+    // function first needs a workspace, unless ROCBLAS_DEVICE_MEMORY_SIZE preallocates it
+    rocblas_handle new_handle;
+    CHECK_ROCBLAS_ERROR(rocblas_create_handle(&new_handle));
+    size_t         reserved = 0;
+    rocblas_status pool_status
+        = rocblas_get_device_memory_pool_attributes(new_handle, &reserved, nullptr, nullptr);
+    if(pool_status != rocblas_status_not_implemented)
+    {
+        CHECK_ROCBLAS_ERROR(pool_status);
+        if(!rocblas_is_user_managing_device_memory(new_handle))
+            EXPECT_EQ(reserved, 0);
+    }
+    CHECK_ROCBLAS_ERROR(rocblas_dot<T>(new_handle, N, dA, 1, dB, 1, &result));
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(new_handle));
+
+    // Handles attached to a workspace pool allocate from it, within its size
+    rocblas_workspace_pool pool, empty_pool;
+    rocblas_status         status = rocblas_create_workspace_pool(&pool, 64 << 20);
+    if(status != rocblas_status_not_implemented)
+    {
+        CHECK_ROCBLAS_ERROR(status);
+        CHECK_ROCBLAS_ERROR(rocblas_create_workspace_pool(&empty_pool, 0));
+        status = rocblas_set_workspace_pool(handle, pool);
+        if(status != rocblas_status_not_implemented)
+        {
+            CHECK_ROCBLAS_ERROR(status);
+            CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, dA, 1, dB, 1, &result));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_workspace_pool(handle, empty_pool));
+            EXPECT_ROCBLAS_STATUS(rocblas_dot<T>(handle, N, dA, 1, dB, 1, &result),
+                                  size ? rocblas_status_memory_error : rocblas_status_success);
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_workspace_pool(handle, nullptr));
+            CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, dA, 1, dB, 1, &result));
+
+            // An attached pool remains alive until the handle is detached
+            CHECK_ROCBLAS_ERROR(rocblas_set_workspace_pool(handle, pool));
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_workspace_pool(pool));
+            CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, dA, 1, dB, 1, &result));
+            CHECK_ROCBLAS_ERROR(rocblas_set_workspace_pool(handle, nullptr));
+        }
+        else
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_workspace_pool(pool));
+        }
+        CHECK_ROCBLAS_ERROR(rocblas_destroy_workspace_pool(empty_pool));
+    }
+
+    // Handles released to the handle pool are acquired again, bound to the new stream and
+    // with the settings they had when they were first acquired
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_ROCBLAS_ERROR(rocblas_handle_pool_reserve(1));
+
+    rocblas_handle pooled, reacquired;
+    CHECK_ROCBLAS_ERROR(rocblas_handle_pool_acquire(&pooled, 0));
+    CHECK_ROCBLAS_ERROR(rocblas_dot<T>(pooled, N, dA, 1, dB, 1, &result));
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(pooled, rocblas_pointer_mode_device));
+    CHECK_ROCBLAS_ERROR(rocblas_handle_pool_release(pooled));
+    EXPECT_ROCBLAS_STATUS(rocblas_handle_pool_release(pooled), rocblas_status_invalid_handle);
+
+    CHECK_ROCBLAS_ERROR(rocblas_handle_pool_acquire(&reacquired, stream));
+    EXPECT_EQ(reacquired, pooled);
+    rocblas_pointer_mode mode;
+    hipStream_t          handle_stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_pointer_mode(reacquired, &mode));
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(reacquired, &handle_stream));
+    EXPECT_EQ(mode, rocblas_pointer_mode_host);
+    EXPECT_EQ(handle_stream, stream);
+    CHECK_ROCBLAS_ERROR(rocblas_dot<T>(reacquired, N, dA, 1, dB, 1, &result));
+    CHECK_ROCBLAS_ERROR(rocblas_handle_pool_release(reacquired));
+
+    CHECK_ROCBLAS_ERROR(rocblas_handle_pool_clear());
+
+    // The thread handle of a shared handle is returned again on the same thread, and its
+    // settings do not change the shared handle
+    rocblas_handle thread_handle, thread_handle_again;
+    CHECK_ROCBLAS_ERROR(rocblas_get_thread_handle(handle, &thread_handle));
+    CHECK_ROCBLAS_ERROR(rocblas_get_thread_handle(handle, &thread_handle_again));
+    EXPECT_EQ(thread_handle, thread_handle_again);
+    EXPECT_NE(thread_handle, (rocblas_handle)handle);
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(thread_handle, stream));
+    CHECK_ROCBLAS_ERROR(rocblas_dot<T>(thread_handle, N, dA, 1, dB, 1, &result));
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &handle_stream));
+    EXPECT_NE(handle_stream, stream);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_thread_handle(thread_handle, &thread_handle_again),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_destroy_handle(thread_handle), rocblas_status_invalid_handle);
+
+    // Threads use their thread handles of a shared handle concurrently. The thread handles of
+    // the even threads are destroyed when they exit, and those of the odd threads, still
+    // running, by rocblas_destroy_handle, after which they exit cleanly
+    constexpr int  THREADS = 8;
+    rocblas_handle shared;
+    CHECK_ROCBLAS_ERROR(rocblas_create_handle(&shared));
+    CHECK_ROCBLAS_ERROR(rocblas_dot<T>(shared, N, dA, 1, dB, 1, &result));
+
+    host_vector<T>   h_results(THREADS);
+    host_vector<T>   h_results_gold(THREADS);
+    device_vector<T> d_results(THREADS);
+    CHECK_DEVICE_ALLOCATION(d_results.memcheck());
+    for(auto& r : h_results_gold)
+        r = result;
+
+    rocblas_handle                 thread_handles[THREADS] = {};
+    std::promise<void>             ready[THREADS], destroyed;
+    std::vector<std::future<void>> ready_futures;
+    for(auto& r : ready)
+        ready_futures.push_back(r.get_future());
+    std::shared_future<void> destroyed_future = destroyed.get_future().share();
+
+    auto run_thread = [&](int t) {
+        rocblas_handle thread_handle, thread_handle_again;
+        hipStream_t    thread_stream;
+        CHECK_HIP_ERROR(hipStreamCreate(&thread_stream));
+        CHECK_ROCBLAS_ERROR(rocblas_get_thread_handle(shared, &thread_handle));
+        CHECK_ROCBLAS_ERROR(rocblas_get_thread_handle(shared, &thread_handle_again));
+        EXPECT_EQ(thread_handle, thread_handle_again);
+        CHECK_ROCBLAS_ERROR(rocblas_set_stream(thread_handle, thread_stream));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(thread_handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_dot<T>(thread_handle, N, dA, 1, dB, 1, d_results + t));
+        CHECK_HIP_ERROR(hipStreamSynchronize(thread_stream));
+        CHECK_HIP_ERROR(hipStreamDestroy(thread_stream));
+        thread_handles[t] = thread_handle;
+    };
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < THREADS; t++)
+        threads.emplace_back([&, t] {
+            run_thread(t);
+            ready[t].set_value();
+            if(t % 2)
+                destroyed_future.wait();
+        });
+    for(auto& f : ready_futures)
+        f.wait();
+    for(int t = 0; t < THREADS; t += 2)
+        threads[t].join();
+
+    CHECK_HIP_ERROR(h_results.transfer_from(d_results));
+    unit_check_general<T>(1, THREADS, 1, h_results_gold, h_results);
+    for(int t = 1; t < THREADS; t += 2)
+    {
+        EXPECT_NE(thread_handles[t], shared);
+        for(int u = 1; u < t; u += 2)
+            EXPECT_NE(thread_handles[t], thread_handles[u]);
+    }
+
+    // The calling thread's cached thread handle of a destroyed handle is not returned for a
+    // new handle, which is usually created at the same address
+    rocblas_handle main_thread_handle, reused;
+    CHECK_ROCBLAS_ERROR(rocblas_get_thread_handle(shared, &main_thread_handle));
+    CHECK_ROCBLAS_ERROR(rocblas_dot<T>(main_thread_handle, N, dA, 1, dB, 1, &result));
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(shared));
+    destroyed.set_value();
+    for(int t = 1; t < THREADS; t += 2)
+        threads[t].join();
+
+    CHECK_ROCBLAS_ERROR(rocblas_create_handle(&reused));
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(reused, rocblas_pointer_mode_device));
+    CHECK_ROCBLAS_ERROR(rocblas_get_thread_handle(reused, &thread_handle));
+    EXPECT_NE(thread_handle, reused);
+    rocblas_pointer_mode thread_mode;
+    CHECK_ROCBLAS_ERROR(rocblas_get_pointer_mode(thread_handle, &thread_mode));
+    EXPECT_EQ(thread_mode, rocblas_pointer_mode_device);
+    CHECK_ROCBLAS_ERROR(rocblas_dot<T>(thread_handle, N, dA, 1, dB, 1, d_results));
+    CHECK_HIP_ERROR(h_results.transfer_from(d_results));
+    unit_check_general<T>(1, 1, 1, h_results_gold, h_results);
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(reused));
+
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
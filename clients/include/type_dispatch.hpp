@@ -245,8 +245,12 @@ auto rocblas_blas1_ex_dispatch(const Arguments& arg)
 {
     const auto        Ta = arg.a_type, Tx = arg.b_type, Ty = arg.c_type, Tex = arg.compute_type;
     const std::string function = arg.function;
+    // axpby_ex and copy_scal_ex support the types of axpy_ex
     const bool        is_axpy  = function == "axpy_ex" || function == "axpy_batched_ex"
-                         || function == "axpy_strided_batched_ex";
+                         || function == "axpy_strided_batched_ex" || function == "axpby_ex"
+                         || function == "axpby_batched_ex" || function == "axpby_strided_batched_ex"
+                         || function == "copy_scal_ex" || function == "copy_scal_batched_ex"
+                         || function == "copy_scal_strided_batched_ex";
     const bool is_dot = function == "dot_ex" || function == "dot_batched_ex"
                         || function == "dot_strided_batched_ex" || function == "dotc_ex"
                         || function == "dotc_batched_ex" || function == "dotc_strided_batched_ex";
@@ -256,6 +260,8 @@ auto rocblas_blas1_ex_dispatch(const Arguments& arg)
                         || function == "rot_strided_batched_ex";
     const bool is_scal = function == "scal_ex" || function == "scal_batched_ex"
                          || function == "scal_strided_batched_ex";
+    const bool is_copy_scal = function == "copy_scal_ex" || function == "copy_scal_batched_ex"
+                              || function == "copy_scal_strided_batched_ex";
 
     if(Ta == Tx && Tx == Ty && Ty == Tex)
     {
@@ -344,6 +350,28 @@ auto rocblas_blas1_ex_dispatch(const Arguments& arg)
             return TEST<rocblas_double_complex, double, double>{}(arg);
         }
     }
+    else if(is_copy_scal)
+    {
+        // conversions between x and y in the precision of alpha
+        if(Ta == rocblas_datatype_f32_r && Tex == Ta)
+        {
+            if(Tx == Ta && Ty == rocblas_datatype_f16_r)
+                return TEST<float, float, rocblas_half, float>{}(arg);
+            else if(Tx == rocblas_datatype_f16_r && Ty == Ta)
+                return TEST<float, rocblas_half, float, float>{}(arg);
+            else if(Tx == Ta && Ty == rocblas_datatype_bf16_r)
+                return TEST<float, float, rocblas_bfloat16, float>{}(arg);
+            else if(Tx == rocblas_datatype_bf16_r && Ty == Ta)
+                return TEST<float, rocblas_bfloat16, float, float>{}(arg);
+        }
+        else if(Ta == rocblas_datatype_f64_r && Tex == Ta)
+        {
+            if(Tx == Ta && Ty == rocblas_datatype_f32_r)
+                return TEST<double, double, float, double>{}(arg);
+            else if(Tx == rocblas_datatype_f32_r && Ty == Ta)
+                return TEST<double, float, double, double>{}(arg);
+        }
+    }
     else if(is_rot)
     {
         if(Ta == rocblas_datatype_f32_c && Tx == rocblas_datatype_f32_c
@@ -420,3 +448,41 @@ auto rocblas_gemm_dispatch(const Arguments& arg)
     }
     return TEST<void>{}(arg);
 }
+
+// matcopy functions
+template <template <typename...> class TEST>
+auto rocblas_matcopy_dispatch(const Arguments& arg)
+{
+    const auto Ta = arg.a_type, Tb = arg.b_type, Tc = arg.compute_type;
+
+    if(Ta == Tb && Tb == Tc)
+    {
+        return rocblas_simple_dispatch<TEST>(arg); // Ta == Tb == Tc
+    }
+    else if(Tc == rocblas_datatype_f32_r)
+    {
+        // conversions between f16_r, bf16_r and f32_r, computed in f32_r
+        if(Ta == rocblas_datatype_f16_r && Tb == Ta)
+            return TEST<rocblas_half, rocblas_half, float>{}(arg);
+        else if(Ta == rocblas_datatype_bf16_r && Tb == Ta)
+            return TEST<rocblas_bfloat16, rocblas_bfloat16, float>{}(arg);
+        else if(Ta == Tc && Tb == rocblas_datatype_f16_r)
+            return TEST<float, rocblas_half, float>{}(arg);
+        else if(Ta == rocblas_datatype_f16_r && Tb == Tc)
+            return TEST<rocblas_half, float, float>{}(arg);
+        else if(Ta == Tc && Tb == rocblas_datatype_bf16_r)
+            return TEST<float, rocblas_bfloat16, float>{}(arg);
+        else if(Ta == rocblas_datatype_bf16_r && Tb == Tc)
+            return TEST<rocblas_bfloat16, float, float>{}(arg);
+    }
+    else if(Tc == rocblas_datatype_f64_r)
+    {
+        // conversions between f32_r and f64_r, computed in f64_r
+        if(Ta == Tc && Tb == rocblas_datatype_f32_r)
+            return TEST<double, float, double>{}(arg);
+        else if(Ta == rocblas_datatype_f32_r && Tb == Tc)
+            return TEST<float, double, double>{}(arg);
+    }
+
+    return TEST<void>{}(arg);
+}
@@ -25,12 +25,19 @@
 
 #include "../../library/src/include/logging.hpp"
 #include "../../library/src/include/utility.hpp"
+#include "argument_model.hpp"
 #include "rocblas.h"
+#include "rocblas_counters.hpp"
 #include "rocblas_vector.hpp"
+#include <atomic>
+#include <cctype>
 #include <cstdio>
+#include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -103,6 +110,35 @@
  */
 void rocblas_client_initialize();
 
+/*! \brief  Stream which the rocblas_local_handles subsequently created by the calling thread are
+            set to, for concurrent benchmarks; nullptr for the default stream */
+void rocblas_set_local_handle_stream(hipStream_t stream);
+
+/*! \brief  Performance metric for solution selection of the rocblas_local_handles subsequently
+            created by any thread */
+void                       rocblas_set_local_handle_performance_metric(rocblas_performance_metric);
+rocblas_performance_metric rocblas_get_local_handle_performance_metric();
+
+/*! \brief  Reproducible mode of the rocblas_local_handles subsequently created by any thread */
+void rocblas_set_local_handle_reproducible_mode(bool reproducible);
+
+/*! \brief  Compensated summation mode of the rocblas_local_handles subsequently created by any
+            thread */
+void rocblas_set_local_handle_compensated_summation_mode(bool compensated);
+
+/*! \brief  Maximum trsm refinement steps of the rocblas_local_handles subsequently created by any
+            thread */
+void rocblas_set_local_handle_trsm_refinement(rocblas_int max_steps);
+
+/*! \brief  Managed memory prefetching of the rocblas_local_handles subsequently created by any
+            thread */
+void rocblas_set_local_handle_managed_prefetch(bool prefetch);
+
+#ifdef ROCBLAS_BETA_FEATURES_API
+/*! \brief  GEMM backend of the rocblas_local_handles subsequently created by any thread */
+void rocblas_set_local_handle_gemm_backend(rocblas_gemm_backend backend);
+#endif
+
 /* ============================================================================================ */
 /*! \brief  local handle which is automatically created and destroyed  */
 class rocblas_local_handle
@@ -159,6 +195,67 @@ rocblas_int query_device_property();
 /*  set current device to device_id */
 void set_device(rocblas_int device_id);
 
+/*! \brief  Peak rates of device_id estimated from its properties: the memory bandwidth in GB/s
+            from the memory clock and bus width, and the FP32 vector FMA throughput in Gflops
+            from the compute units and engine clock. Returns false when the query fails. */
+bool query_device_peaks(rocblas_int device_id, double& peak_gflops, double& peak_gbps);
+
+/*! \brief  Power of device_id in watts, as averaged by the amdgpu driver and reported through its
+            hwmon interface, or a negative value if the driver does not report it */
+double query_device_power(rocblas_int device_id);
+
+/*! \brief  Samples the power of the current device from another thread, from its construction
+            until stop(), if enabled */
+class rocblas_power_sampler
+{
+public:
+    explicit rocblas_power_sampler(bool enabled);
+    ~rocblas_power_sampler();
+
+    /*! \brief  Stop sampling and return the average power in watts, or
+                ArgumentLogging::NA_value if it was not sampled */
+    double stop();
+
+private:
+    std::thread       thread;
+    std::atomic<bool> running{false};
+    double            watts   = 0;
+    int               samples = 0;
+};
+
+/*! \brief  Shader clock of device_id in MHz, as reported by the amdgpu driver, or a negative value
+            if the driver does not report it */
+double query_device_clock(rocblas_int device_id);
+
+/*! \brief  Junction temperature of device_id in degrees Celsius, or a negative value if the
+            driver does not report it */
+double query_device_temperature(rocblas_int device_id);
+
+/*! \brief  Samples the shader clock and the temperature of the current device from another thread,
+            from its construction until stop(), if enabled */
+class rocblas_clock_sampler
+{
+public:
+    explicit rocblas_clock_sampler(bool enabled);
+    ~rocblas_clock_sampler();
+
+    /*! \brief  Stop sampling and return the lowest clock in MHz, or
+                ArgumentLogging::NA_value if it was not sampled */
+    double stop();
+
+    /*! \brief  Highest temperature sampled in degrees Celsius, or ArgumentLogging::NA_value */
+    double max_temperature() const
+    {
+        return max_celsius;
+    }
+
+private:
+    std::thread       thread;
+    std::atomic<bool> running{false};
+    double            min_mhz     = ArgumentLogging::NA_value;
+    double            max_celsius = ArgumentLogging::NA_value;
+};
+
 /* ============================================================================================ */
 /*  timing: HIP only provides very limited timers function clock() and not general;
             rocblas sync CPU and device and use more accurate CPU timer*/
@@ -172,6 +269,102 @@ double get_time_us_sync(hipStream_t stream);
 /*! \brief  CPU Timer(in microsecond): no GPU synchronization and return wall time */
 double get_time_us_no_sync();
 
+/*! \brief  Bytes of the scrub buffer written before each flushed timing call, 0 to disable */
+void   rocblas_set_cache_flush_bytes(size_t bytes);
+size_t rocblas_get_cache_flush_bytes();
+
+/*! \brief  Write the scrub buffer on stream, evicting the operands of the next call from the L2
+            and last level (MALL) caches */
+void rocblas_flush_device_caches(hipStream_t stream);
+
+/*! \brief  GPU Timer(in microsecond): run func calls times on stream, each call timed by its own
+            pair of events, optionally flushing the device caches before each call. The time of
+            each call is appended to samples when it is not null; returns the sum of the times */
+double get_time_us_per_call(hipStream_t                  stream,
+                            int                          calls,
+                            const std::function<void()>& func,
+                            bool                         flush,
+                            std::vector<double>*         samples);
+
+/*! \brief  GPU Timer(in microsecond): run func calls times on stream, flushing the device caches
+            before each call, and return the sum of the GPU times of the calls */
+double get_time_us_flushed(hipStream_t stream, int calls, const std::function<void()>& func);
+
+/*! \brief  Run func on stream until the shader clock of the current device, read after each
+            millisecond or more of calls, varies by at most 2% over 3 readings, for at most a
+            second. Returns the last clock read in MHz, or a negative value if it cannot be read */
+double rocblas_wait_stable_clock(hipStream_t stream, const std::function<void()>& func);
+
+/*! \brief  CPU Timer(in microsecond): run func hot_calls times on stream and return the wall time.
+            With a cache flush size set, the calls are also timed from cold caches, for the
+            flushed columns of the benchmark output, and with statistics logging enabled each
+            call is also timed separately, for the percentile columns. With power logging, the
+            average power of the device during the calls is reported in the power columns. With
+            the clock guard, the calls are first repeated until the clock is stable, and timed
+            again while the clock drops more than 5% below it during them, up to the retries;
+            the clocks, the temperature and whether the last timing was throttled are reported
+            in the clock columns. With hardware counters set, the calls are run once more with
+            the counters collected, for the kernel columns, since counting serializes the
+            kernels and would distort the timing. */
+template <typename F>
+double get_time_us_hot_calls(hipStream_t stream, int hot_calls, F&& func)
+{
+    double stable_mhz  = -1;
+    bool   clock_guard = ArgumentModel_get_clock_guard() && hot_calls > 0;
+    if(clock_guard)
+    {
+        stable_mhz  = rocblas_wait_stable_clock(stream, func);
+        clock_guard = stable_mhz > 0;
+    }
+
+    double gpu_time_used;
+    for(int attempt = 0;; attempt++)
+    {
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        // With power logging, the power of the device is sampled while the hot calls run
+        rocblas_power_sampler power(ArgumentModel_get_log_power() && hot_calls > 0);
+        rocblas_clock_sampler clocks(clock_guard);
+
+        for(int iter = 0; iter < hot_calls; iter++)
+            func();
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        ArgumentModel_set_power_watts(power.stop());
+
+        if(!clock_guard)
+            break;
+
+        double min_mhz   = clocks.stop();
+        bool   throttled = min_mhz != ArgumentLogging::NA_value && min_mhz < 0.95 * stable_mhz;
+        if(!throttled || attempt >= ArgumentModel_get_clock_guard_retries())
+        {
+            ArgumentModel_set_clock_sample(
+                stable_mhz, min_mhz, clocks.max_temperature(), throttled);
+            break;
+        }
+
+        // the throttled timing is discarded once the clock has settled again
+        stable_mhz = rocblas_wait_stable_clock(stream, func);
+    }
+
+    if(rocblas_get_cache_flush_bytes() && hot_calls > 0)
+        ArgumentModel_set_flushed_time_us(get_time_us_flushed(stream, hot_calls, func));
+
+    if(!rocblas_get_counters().empty() && hot_calls > 0)
+        ArgumentModel_set_kernel_counters(rocblas_collect_counters(stream, hot_calls, func));
+
+    if(ArgumentModel_get_log_stats() && hot_calls > 0)
+    {
+        std::vector<double> samples;
+        if(get_time_us_per_call(stream, hot_calls, func, false, &samples)
+           != ArgumentLogging::NA_value)
+            ArgumentModel_set_iteration_times_us(std::move(samples));
+    }
+
+    return gpu_time_used;
+}
+
 /* ============================================================================================ */
 // Return path of this executable
 std::string rocblas_exepath();
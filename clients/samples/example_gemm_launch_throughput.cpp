@@ -0,0 +1,173 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Measures how the rate at which small GEMMs are launched scales with the number of
+// host threads, each of which drives its own handle and stream on the same device.
+//
+// Usage: rocblas-example-gemm-launch-throughput [max_threads [launches_per_thread [size]]]
+
+#include "rocblas.h"
+#include "utility.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <hip/hip_runtime.h>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct thread_result
+    {
+        double enqueue_us = 0; // time spent launching, excluding the final synchronization
+    };
+
+    void launch_gemms(rocblas_int              size,
+                      int                      launches,
+                      std::atomic<int>&        ready,
+                      const std::atomic<bool>& start,
+                      thread_result&           result)
+    {
+        const float  alpha = 1, beta = 0;
+        const size_t bytes = sizeof(float) * size * size;
+
+        float *da, *db, *dc;
+        CHECK_HIP_ERROR(hipMalloc(&da, bytes));
+        CHECK_HIP_ERROR(hipMalloc(&db, bytes));
+        CHECK_HIP_ERROR(hipMalloc(&dc, bytes));
+        CHECK_HIP_ERROR(hipMemset(da, 0, bytes));
+        CHECK_HIP_ERROR(hipMemset(db, 0, bytes));
+
+        hipStream_t    stream;
+        rocblas_handle handle;
+        CHECK_HIP_ERROR(hipStreamCreate(&stream));
+        CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+        CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+
+        auto gemm = [&] {
+            CHECK_ROCBLAS_ERROR(rocblas_sgemm(handle,
+                                              rocblas_operation_none,
+                                              rocblas_operation_none,
+                                              size,
+                                              size,
+                                              size,
+                                              &alpha,
+                                              da,
+                                              size,
+                                              db,
+                                              size,
+                                              &beta,
+                                              dc,
+                                              size));
+        };
+
+        // Warm up, so that solution selection and code object loading are not timed
+        gemm();
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        ready++;
+        while(!start)
+            std::this_thread::yield();
+
+        auto t0 = std::chrono::steady_clock::now();
+        for(int i = 0; i < launches; i++)
+            gemm();
+        auto t1 = std::chrono::steady_clock::now();
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        result.enqueue_us = std::chrono::duration<double, std::micro>(t1 - t0).count();
+
+        CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+        CHECK_HIP_ERROR(hipFree(da));
+        CHECK_HIP_ERROR(hipFree(db));
+        CHECK_HIP_ERROR(hipFree(dc));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int         max_threads = argc > 1 ? atoi(argv[1]) : 32;
+    int         launches    = argc > 2 ? atoi(argv[2]) : 2000;
+    rocblas_int size        = argc > 3 ? atoi(argv[3]) : 16;
+
+    if(max_threads < 1 || launches < 1 || size < 1)
+    {
+        rocblas_cerr << "Usage: " << argv[0] << " [max_threads [launches_per_thread [size]]]"
+                     << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    rocblas_initialize();
+
+    rocblas_cout << "sgemm " << size << "x" << size << "x" << size << ", " << launches
+                 << " launches per thread" << std::endl;
+    rocblas_cout << "threads, launches/s, speedup, mean enqueue us/launch" << std::endl;
+
+    // Powers of 2 up to max_threads, and max_threads
+    std::vector<int> thread_counts;
+    for(int threads = 1; threads < max_threads; threads *= 2)
+        thread_counts.push_back(threads);
+    thread_counts.push_back(max_threads);
+
+    double single_rate = 0;
+    for(int threads : thread_counts)
+    {
+        std::atomic<int>           ready{0};
+        std::atomic<bool>          start{false};
+        std::vector<thread_result> results(threads);
+        std::vector<std::thread>   workers;
+
+        for(int t = 0; t < threads; t++)
+            workers.emplace_back(launch_gemms,
+                                 size,
+                                 launches,
+                                 std::ref(ready),
+                                 std::cref(start),
+                                 std::ref(results[t]));
+
+        while(ready < threads)
+            std::this_thread::yield();
+
+        auto t0 = std::chrono::steady_clock::now();
+        start   = true;
+        for(auto& worker : workers)
+            worker.join();
+        auto t1 = std::chrono::steady_clock::now();
+
+        double seconds = std::chrono::duration<double>(t1 - t0).count();
+        double rate    = double(threads) * launches / seconds;
+        double enqueue = 0;
+        for(auto& result : results)
+            enqueue += result.enqueue_us;
+        enqueue /= double(threads) * launches;
+
+        if(threads == 1)
+            single_rate = rate;
+
+        rocblas_cout << threads << ", " << rate << ", " << rate / single_rate << ", " << enqueue
+                     << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,118 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Measures the host cost of enqueueing the smallest level 1 calls, n = 1 axpy, scal and dot,
+// which is dominated by argument checking, logging checks and the kernel launch itself.
+// dot uses the device pointer mode so that no call synchronizes.
+//
+// Usage: rocblas-example-level1-launch-cost [launches]
+
+#include "rocblas.h"
+#include "utility.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    //! @brief Mean host microseconds per call of launch, excluding the final synchronization
+    template <typename F>
+    double enqueue_us(hipStream_t stream, int launches, F launch)
+    {
+        // Warm up, so that code object loading is not timed
+        launch();
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        auto t0 = std::chrono::steady_clock::now();
+        for(int i = 0; i < launches; i++)
+            launch();
+        auto t1 = std::chrono::steady_clock::now();
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        return std::chrono::duration<double, std::micro>(t1 - t0).count() / launches;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int launches = argc > 1 ? atoi(argv[1]) : 10000;
+
+    if(launches < 1)
+    {
+        rocblas_cerr << "Usage: " << argv[0] << " [launches]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const rocblas_int n = 1;
+    float *           dx, *dy, *dresult, *dalpha;
+    CHECK_HIP_ERROR(hipMalloc(&dx, sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dy, sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dresult, sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dalpha, sizeof(float)));
+    CHECK_HIP_ERROR(hipMemset(dx, 0, sizeof(float)));
+    CHECK_HIP_ERROR(hipMemset(dy, 0, sizeof(float)));
+    CHECK_HIP_ERROR(hipMemset(dalpha, 0, sizeof(float)));
+
+    hipStream_t    stream;
+    rocblas_handle handle;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+
+    const float alpha = 1;
+
+    rocblas_cout << "n = " << n << ", " << launches << " launches" << std::endl;
+    rocblas_cout << "function, pointer mode, mean enqueue us/call" << std::endl;
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    rocblas_cout << "saxpy, host, " << enqueue_us(stream, launches, [&] {
+        CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, n, &alpha, dx, 1, dy, 1));
+    }) << std::endl;
+    rocblas_cout << "sscal, host, " << enqueue_us(stream, launches, [&] {
+        CHECK_ROCBLAS_ERROR(rocblas_sscal(handle, n, &alpha, dx, 1));
+    }) << std::endl;
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    rocblas_cout << "saxpy, device, " << enqueue_us(stream, launches, [&] {
+        CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, n, dalpha, dx, 1, dy, 1));
+    }) << std::endl;
+    rocblas_cout << "sscal, device, " << enqueue_us(stream, launches, [&] {
+        CHECK_ROCBLAS_ERROR(rocblas_sscal(handle, n, dalpha, dx, 1));
+    }) << std::endl;
+    rocblas_cout << "sdot, device, " << enqueue_us(stream, launches, [&] {
+        CHECK_ROCBLAS_ERROR(rocblas_sdot(handle, n, dx, 1, dy, 1, dresult));
+    }) << std::endl;
+
+    // The cost of an asynchronous runtime call on the same stream, for comparison
+    rocblas_cout << "hipMemsetAsync, -, " << enqueue_us(stream, launches, [&] {
+        CHECK_HIP_ERROR(hipMemsetAsync(dresult, 0, sizeof(float), stream));
+    }) << std::endl;
+
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_HIP_ERROR(hipFree(dx));
+    CHECK_HIP_ERROR(hipFree(dy));
+    CHECK_HIP_ERROR(hipFree(dresult));
+    CHECK_HIP_ERROR(hipFree(dalpha));
+
+    return EXIT_SUCCESS;
+}
@@ -52,6 +52,12 @@ option(BUILD_CODE_COVERAGE "Build rocBLAS with code coverage enabled" OFF)
 # FOR OPTIONAL ADDRESS SANITIZER
 option(BUILD_ADDRESS_SANITIZER "Build with address sanitizer enabled" OFF)
 
+# FOR OPTIONAL ROCTX RANGES AROUND THE ROCBLAS CALLS, enabled at runtime with ROCBLAS_LAYER
+option(BUILD_WITH_ROCTX "Build with ROCTX range annotations of the rocBLAS calls" OFF)
+
+# FOR THE OPTIONAL rocblas-distributed COMPANION LIBRARY OF DISTRIBUTED GEMM AND SYRK OVER RCCL
+option(BUILD_DISTRIBUTED "Build the rocblas-distributed library, which depends on RCCL" OFF)
+
 # FOR OPTIONAL HEADER TESTSING
 option(RUN_HEADER_TESTING "Post build header compatibility testing" OFF)
 
@@ -65,6 +71,12 @@ if( BUILD_WITH_TENSILE )
   set( Tensile_LIBRARY_FORMAT "msgpack" CACHE STRING "Tensile library format")
 
   set_property( CACHE Tensile_LOGIC PROPERTY STRINGS aldebaran asm_full asm_lite asm_miopen hip_lite other )
+
+  # Restrict the Tensile logic to the GEMMs of a deployment; all empty builds all of Tensile_LOGIC.
+  # GEMMs outside of the selection return rocblas_status_not_implemented in the built library.
+  set( Tensile_LOGIC_DATATYPES "" CACHE STRING "Tensile datatypes of the logic to build, e.g. HHS;BBS;S (empty for all)")
+  set( Tensile_LOGIC_TRANSPOSES "" CACHE STRING "Tensile transposes of the logic to build, e.g. NN;NT (empty for all)")
+  set( Tensile_LOGIC_SHAPE_LOG "" CACHE FILEPATH "rocblas-bench log (ROCBLAS_LAYER=2) of the GEMMs whose Tensile logic to build")
   set_property( CACHE Tensile_CODE_OBJECT_VERSION PROPERTY STRINGS default V4 V5 )
   set_property( CACHE Tensile_COMPILER PROPERTY STRINGS hcc hipcc)
   set_property( CACHE Tensile_LIBRARY_FORMAT PROPERTY STRINGS msgpack yaml)
@@ -74,6 +86,7 @@ if( BUILD_WITH_TENSILE )
   option( Tensile_PRINT_DEBUG "Tensile to print runtime debug info?" OFF )
   option( Tensile_SEPARATE_ARCHITECTURES "Tensile to use GPU architecture specific files?" ON )
   option( Tensile_LAZY_LIBRARY_LOADING "Tensile to load kernels on demand?" ON )
+  option( Tensile_EMBED_LIBRARY "Tensile to embed its library and kernels in librocblas, with no file reads at initialization?" OFF )
 
   if(Tensile_LIBRARY_FORMAT MATCHES "yaml")
     option(TENSILE_USE_LLVM      "Use LLVM for parsing config files." ON)
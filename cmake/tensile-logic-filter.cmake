@@ -0,0 +1,155 @@
+# ########################################################################
+# Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+# ies of the Software, and to permit persons to whom the Software is furnished
+# to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+# PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+# FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+# COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+# IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+# CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# ########################################################################
+
+# Selection of the Tensile logic files of a subset of the GEMM datatypes and transposes, for
+# deployment specific libraries. The logic files are named
+#   <arch>_Cijk_<A>_<B>_<datatype>..., e.g. aldebaran_Cijk_Ailk_Bjlk_HHS_BH.yaml
+# where <A> is Ailk, Alik or AlikC for the N, T or C transpose of A, <B> is Bljk, Bjlk or BjlkC
+# for the N, T or C transpose of B, and <datatype> is the Tensile code of the input, output and
+# compute types: H, S, D, C, Z, HHS, HSS, BBS, BSS, I8II or 4xi8II.
+
+# Tensile datatype code of a rocblas-bench gemm_ex a_type, c_type and compute_type
+function(rocblas_tensile_ex_datatype a_type c_type compute_type out_var)
+  set(codes_f16_r H)
+  set(codes_f32_r S)
+  set(codes_f64_r D)
+  set(codes_f32_c C)
+  set(codes_f64_c Z)
+  if(a_type STREQUAL c_type AND a_type STREQUAL compute_type AND DEFINED codes_${a_type})
+    set(${out_var} ${codes_${a_type}} PARENT_SCOPE)
+  elseif(a_type STREQUAL "f16_r" AND c_type STREQUAL "f16_r" AND compute_type STREQUAL "f32_r")
+    set(${out_var} HHS PARENT_SCOPE)
+  elseif(a_type STREQUAL "f16_r" AND c_type STREQUAL "f32_r" AND compute_type STREQUAL "f32_r")
+    set(${out_var} HSS PARENT_SCOPE)
+  elseif(a_type STREQUAL "bf16_r" AND c_type STREQUAL "bf16_r" AND compute_type STREQUAL "f32_r")
+    set(${out_var} BBS PARENT_SCOPE)
+  elseif(a_type STREQUAL "bf16_r" AND c_type STREQUAL "f32_r" AND compute_type STREQUAL "f32_r")
+    set(${out_var} BSS PARENT_SCOPE)
+  elseif(a_type STREQUAL "i8_r" AND c_type STREQUAL "i32_r" AND compute_type STREQUAL "i32_r")
+    # the packed int8 kernels are used on the architectures without int8 dot instructions
+    set(${out_var} I8II 4xi8II PARENT_SCOPE)
+  else()
+    set(${out_var} "" PARENT_SCOPE)
+  endif()
+endfunction()
+
+# Datatype;transpose pairs, e.g. HHS;NT, of the GEMMs of a rocblas-bench log, as written by
+# ROCBLAS_LAYER=2
+function(rocblas_tensile_log_problems log_file out_var)
+  file(STRINGS ${log_file} log_lines REGEX "-f gemm")
+  set(problems "")
+  foreach(line IN LISTS log_lines)
+    set(transA N)
+    set(transB N)
+    if(line MATCHES "--transposeA ([NTC])")
+      set(transA ${CMAKE_MATCH_1})
+    endif()
+    if(line MATCHES "--transposeB ([NTC])")
+      set(transB ${CMAKE_MATCH_1})
+    endif()
+
+    set(datatypes "")
+    if(line MATCHES "-f gemm[a-z_]*_ex ")
+      if(line MATCHES "--a_type ([a-z0-9_]+)")
+        set(a_type ${CMAKE_MATCH_1})
+      endif()
+      if(line MATCHES "--c_type ([a-z0-9_]+)")
+        set(c_type ${CMAKE_MATCH_1})
+      endif()
+      if(line MATCHES "--compute_type ([a-z0-9_]+)")
+        set(compute_type ${CMAKE_MATCH_1})
+      endif()
+      rocblas_tensile_ex_datatype("${a_type}" "${c_type}" "${compute_type}" datatypes)
+    elseif(line MATCHES "-r ([a-z0-9_]+)")
+      rocblas_tensile_ex_datatype(${CMAKE_MATCH_1} ${CMAKE_MATCH_1} ${CMAKE_MATCH_1} datatypes)
+    endif()
+
+    if(NOT datatypes)
+      message(WARNING "Ignoring the GEMM of an unsupported datatype in ${log_file}: ${line}")
+    endif()
+    foreach(datatype IN LISTS datatypes)
+      list(APPEND problems "${datatype}:${transA}${transB}")
+    endforeach()
+  endforeach()
+  list(REMOVE_DUPLICATES problems)
+  set(${out_var} ${problems} PARENT_SCOPE)
+endfunction()
+
+# Copies the logic files of logic_dir which match the datatypes and transposes, or the GEMMs of
+# the rocblas-bench log shape_log, to out_dir. An empty datatypes or transposes list matches
+# all datatypes or transposes.
+function(rocblas_filter_tensile_logic logic_dir out_dir datatypes transposes shape_log)
+  set(problems "")
+  if(datatypes OR transposes)
+    if(NOT datatypes)
+      set(datatypes H S D C Z HHS HSS BBS BSS I8II 4xi8II)
+    endif()
+    if(NOT transposes)
+      set(transposes NN NT NC TN TT TC CN CT CC)
+    endif()
+    foreach(datatype IN LISTS datatypes)
+      foreach(transpose IN LISTS transposes)
+        list(APPEND problems "${datatype}:${transpose}")
+      endforeach()
+    endforeach()
+  endif()
+  if(shape_log)
+    rocblas_tensile_log_problems(${shape_log} log_problems)
+    list(APPEND problems ${log_problems})
+  endif()
+
+  set(A_N Ailk)
+  set(A_T Alik)
+  set(A_C AlikC)
+  set(B_N Bljk)
+  set(B_T Bjlk)
+  set(B_C BjlkC)
+  set(patterns "")
+  foreach(problem IN LISTS problems)
+    if(NOT problem MATCHES "^([A-Za-z0-9]+):([NTC])([NTC])$")
+      message(FATAL_ERROR "Invalid Tensile logic datatype or transpose: ${problem}")
+    endif()
+    # the datatype code is followed by B for batched, or by _B for the high precision accumulate
+    list(APPEND patterns
+         "_Cijk_${A_${CMAKE_MATCH_2}}_${B_${CMAKE_MATCH_3}}_${CMAKE_MATCH_1}_?B[^/]*\\.yaml$")
+  endforeach()
+
+  # start from an empty directory, so that files of an earlier selection are not built
+  file(REMOVE_RECURSE ${out_dir})
+  file(GLOB_RECURSE logic_files RELATIVE ${logic_dir} ${logic_dir}/*.yaml)
+  set(num_selected 0)
+  foreach(logic_file IN LISTS logic_files)
+    foreach(pattern IN LISTS patterns)
+      if(logic_file MATCHES "${pattern}")
+        configure_file(${logic_dir}/${logic_file} ${out_dir}/${logic_file} COPYONLY)
+        math(EXPR num_selected "${num_selected} + 1")
+        break()
+      endif()
+    endforeach()
+  endforeach()
+
+  list(LENGTH logic_files num_files)
+  if(num_selected EQUAL 0)
+    message(FATAL_ERROR "No Tensile logic files of ${logic_dir} match the selected datatypes and transposes")
+  endif()
+  message(STATUS "Building ${num_selected} of the ${num_files} Tensile logic files of ${logic_dir}")
+endfunction()
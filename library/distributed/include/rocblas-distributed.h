@@ -0,0 +1,350 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*!\file
+ * \brief rocblas-distributed.h declares the GEMM and SYRK of matrices distributed over a 2D grid
+ *  of processes, of the optional rocblas-distributed library built with BUILD_DISTRIBUTED=ON
+ */
+
+#ifndef ROCBLAS_DISTRIBUTED_H
+#define ROCBLAS_DISTRIBUTED_H
+
+#include "rocblas-distributed-export.h"
+#include <rccl/rccl.h>
+#include <rocblas/rocblas.h>
+
+/*! \brief rocblas_dist_grid describes the place of a process in a 2D grid of processes.
+ *
+ *  The matrices of the distributed functions are distributed 2D block-cyclically over the grid,
+ *  as in ScaLAPACK: with blocks of mb x nb elements, block (I, J) of a matrix is held by the
+ *  process at row I % nprow and column J % npcol of the grid, which stores its blocks in column
+ *  major order in a local matrix with a leading dimension. The first block is held by the process
+ *  at row 0 and column 0. rocblas_dist_local_size gives the number of rows or columns a process
+ *  holds.
+ *
+ *  A grid is created with rocblas_dist_grid_create on the device of the handles it is used with,
+ *  and keeps a stream for the communication and the panel buffers of the distributed functions,
+ *  which reuse them from one call to the next. A grid must not be used by several threads at once.
+ */
+typedef struct _rocblas_dist_grid* rocblas_dist_grid;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \brief Create a grid of nprow x npcol processes on the current device.
+
+    @param[out]
+    grid      the created grid.
+    @param[in]
+    nprow     number of rows of processes.
+    @param[in]
+    npcol     number of columns of processes.
+    @param[in]
+    row_comm  RCCL communicator of the npcol processes of the row of the grid of this process,
+              in which the rank of a process is its column.
+    @param[in]
+    col_comm  RCCL communicator of the nprow processes of the column of the grid of this process,
+              in which the rank of a process is its row.
+
+    The communicators must remain valid until the grid is destroyed. It returns
+    rocblas_status_invalid_size if the sizes of the communicators do not match nprow and npcol.
+ */
+ROCBLAS_DISTRIBUTED_EXPORT rocblas_status rocblas_dist_grid_create(rocblas_dist_grid* grid,
+                                                                   rocblas_int        nprow,
+                                                                   rocblas_int        npcol,
+                                                                   ncclComm_t         row_comm,
+                                                                   ncclComm_t         col_comm);
+
+/*! \brief Destroy a grid, after the work enqueued with it has completed. The communicators are
+ *  not destroyed.
+ */
+ROCBLAS_DISTRIBUTED_EXPORT rocblas_status rocblas_dist_grid_destroy(rocblas_dist_grid grid);
+
+/*! \brief Get the row and the column of this process in a grid. */
+ROCBLAS_DISTRIBUTED_EXPORT rocblas_status rocblas_dist_grid_get_coords(rocblas_dist_grid grid,
+                                                                       rocblas_int*      myrow,
+                                                                       rocblas_int*      mycol);
+
+/*! \brief Get the number of rows or columns, of a global matrix dimension n distributed in blocks
+ *  of nb over nprocs process rows or columns, held by the process at row or column iproc.
+ */
+ROCBLAS_DISTRIBUTED_EXPORT rocblas_status rocblas_dist_local_size(rocblas_int  n,
+                                                                  rocblas_int  nb,
+                                                                  rocblas_int  iproc,
+                                                                  rocblas_int  nprocs,
+                                                                  rocblas_int* size);
+
+/*! \brief Distributed GEMM
+
+    \details
+    dist_gemm performs the matrix-matrix operation
+
+        C = alpha*A*B + beta*C,
+
+    with a global m x k matrix A, k x n matrix B and m x n matrix C distributed over a grid in
+    blocks of mb x kb, kb x nb and mb x nb elements. Every process of the grid calls it with the
+    same global arguments and its local matrices.
+
+    It is the SUMMA algorithm: for each panel of kb columns of A and kb rows of B, the process
+    column holding the A panel broadcasts it along the process rows, the process row holding the
+    B panel broadcasts it along the process columns, and each process updates its local C with a
+    GEMM of the two panels. The broadcasts are enqueued on the stream of the grid, into two sets
+    of panel buffers, so that the broadcasts of the next panels overlap the GEMM of the current
+    ones on the stream of the handle.
+
+    The call is asynchronous with respect to the host. Its work is ordered after prior work on
+    the stream of the handle, and later work on that stream is ordered after it. alpha and beta
+    follow the pointer mode of the handle.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle on the device of the grid.
+    @param[in]
+    grid      [rocblas_dist_grid]
+              grid of the processes.
+    @param[in]
+    m         [rocblas_int]
+              global number of rows of A and C.
+    @param[in]
+    n         [rocblas_int]
+              global number of columns of B and C.
+    @param[in]
+    k         [rocblas_int]
+              global number of columns of A and rows of B.
+    @param[in]
+    mb        [rocblas_int]
+              number of rows of the blocks of A and C.
+    @param[in]
+    nb        [rocblas_int]
+              number of columns of the blocks of B and C.
+    @param[in]
+    kb        [rocblas_int]
+              number of columns of the blocks of A and rows of the blocks of B.
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    A         device pointer to the local matrix of A.
+    @param[in]
+    lda       [rocblas_int]
+              leading dimension of the local matrix of A.
+    @param[in]
+    B         device pointer to the local matrix of B.
+    @param[in]
+    ldb       [rocblas_int]
+              leading dimension of the local matrix of B.
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[inout]
+    C         device pointer to the local matrix of C.
+    @param[in]
+    ldc       [rocblas_int]
+              leading dimension of the local matrix of C.
+    ********************************************************************/
+ROCBLAS_DISTRIBUTED_EXPORT rocblas_status rocblas_dist_sgemm(rocblas_handle    handle,
+                                                             rocblas_dist_grid grid,
+                                                             rocblas_int       m,
+                                                             rocblas_int       n,
+                                                             rocblas_int       k,
+                                                             rocblas_int       mb,
+                                                             rocblas_int       nb,
+                                                             rocblas_int       kb,
+                                                             const float*      alpha,
+                                                             const float*      A,
+                                                             rocblas_int       lda,
+                                                             const float*      B,
+                                                             rocblas_int       ldb,
+                                                             const float*      beta,
+                                                             float*            C,
+                                                             rocblas_int       ldc);
+
+ROCBLAS_DISTRIBUTED_EXPORT rocblas_status rocblas_dist_dgemm(rocblas_handle    handle,
+                                                             rocblas_dist_grid grid,
+                                                             rocblas_int       m,
+                                                             rocblas_int       n,
+                                                             rocblas_int       k,
+                                                             rocblas_int       mb,
+                                                             rocblas_int       nb,
+                                                             rocblas_int       kb,
+                                                             const double*     alpha,
+                                                             const double*     A,
+                                                             rocblas_int       lda,
+                                                             const double*     B,
+                                                             rocblas_int       ldb,
+                                                             const double*     beta,
+                                                             double*           C,
+                                                             rocblas_int       ldc);
+
+ROCBLAS_DISTRIBUTED_EXPORT rocblas_status rocblas_dist_cgemm(rocblas_handle               handle,
+                                                             rocblas_dist_grid            grid,
+                                                             rocblas_int                  m,
+                                                             rocblas_int                  n,
+                                                             rocblas_int                  k,
+                                                             rocblas_int                  mb,
+                                                             rocblas_int                  nb,
+                                                             rocblas_int                  kb,
+                                                             const rocblas_float_complex* alpha,
+                                                             const rocblas_float_complex* A,
+                                                             rocblas_int                  lda,
+                                                             const rocblas_float_complex* B,
+                                                             rocblas_int                  ldb,
+                                                             const rocblas_float_complex* beta,
+                                                             rocblas_float_complex*       C,
+                                                             rocblas_int                  ldc);
+
+ROCBLAS_DISTRIBUTED_EXPORT rocblas_status rocblas_dist_zgemm(rocblas_handle                handle,
+                                                             rocblas_dist_grid             grid,
+                                                             rocblas_int                   m,
+                                                             rocblas_int                   n,
+                                                             rocblas_int                   k,
+                                                             rocblas_int                   mb,
+                                                             rocblas_int                   nb,
+                                                             rocblas_int                   kb,
+                                                             const rocblas_double_complex* alpha,
+                                                             const rocblas_double_complex* A,
+                                                             rocblas_int                   lda,
+                                                             const rocblas_double_complex* B,
+                                                             rocblas_int                   ldb,
+                                                             const rocblas_double_complex* beta,
+                                                             rocblas_double_complex*       C,
+                                                             rocblas_int                   ldc);
+
+/*! \brief Distributed SYRK
+
+    \details
+    dist_syrk performs the symmetric rank k update
+
+        C = alpha*A*A**T + beta*C,
+
+    with a global n x k matrix A distributed over a grid in blocks of nb x kb elements, and the
+    uplo triangle of a global n x n symmetric matrix C distributed in blocks of nb x nb elements.
+    The grid must be square. Every process of the grid calls it with the same global arguments
+    and its local matrices.
+
+    For each panel of kb columns of A, as in dist_gemm, the process column holding the panel
+    broadcasts it along the process rows. The process on the diagonal of each process column then
+    holds the rows of the panel matching the columns of C of its process column, and broadcasts
+    them along it. Each process updates the blocks of its local C in the uplo triangle, with a
+    SYRK on a diagonal block and a GEMM on the blocks of a column past it. Blocks of C outside
+    the triangle are not referenced.
+
+    The call is asynchronous with respect to the host. Its work is ordered after prior work on
+    the stream of the handle, and later work on that stream is ordered after it. alpha and beta
+    follow the pointer mode of the handle.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle on the device of the grid.
+    @param[in]
+    grid      [rocblas_dist_grid]
+              square grid of the processes.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies the triangle of C which is updated.
+    @param[in]
+    n         [rocblas_int]
+              global number of rows of A and of rows and columns of C.
+    @param[in]
+    k         [rocblas_int]
+              global number of columns of A.
+    @param[in]
+    nb        [rocblas_int]
+              number of rows of the blocks of A and of rows and columns of the blocks of C.
+    @param[in]
+    kb        [rocblas_int]
+              number of columns of the blocks of A.
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    A         device pointer to the local matrix of A.
+    @param[in]
+    lda       [rocblas_int]
+              leading dimension of the local matrix of A.
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[inout]
+    C         device pointer to the local matrix of C.
+    @param[in]
+    ldc       [rocblas_int]
+              leading dimension of the local matrix of C.
+    ********************************************************************/
+ROCBLAS_DISTRIBUTED_EXPORT rocblas_status rocblas_dist_ssyrk(rocblas_handle    handle,
+                                                             rocblas_dist_grid grid,
+                                                             rocblas_fill      uplo,
+                                                             rocblas_int       n,
+                                                             rocblas_int       k,
+                                                             rocblas_int       nb,
+                                                             rocblas_int       kb,
+                                                             const float*      alpha,
+                                                             const float*      A,
+                                                             rocblas_int       lda,
+                                                             const float*      beta,
+                                                             float*            C,
+                                                             rocblas_int       ldc);
+
+ROCBLAS_DISTRIBUTED_EXPORT rocblas_status rocblas_dist_dsyrk(rocblas_handle    handle,
+                                                             rocblas_dist_grid grid,
+                                                             rocblas_fill      uplo,
+                                                             rocblas_int       n,
+                                                             rocblas_int       k,
+                                                             rocblas_int       nb,
+                                                             rocblas_int       kb,
+                                                             const double*     alpha,
+                                                             const double*     A,
+                                                             rocblas_int       lda,
+                                                             const double*     beta,
+                                                             double*           C,
+                                                             rocblas_int       ldc);
+
+ROCBLAS_DISTRIBUTED_EXPORT rocblas_status rocblas_dist_csyrk(rocblas_handle               handle,
+                                                             rocblas_dist_grid            grid,
+                                                             rocblas_fill                 uplo,
+                                                             rocblas_int                  n,
+                                                             rocblas_int                  k,
+                                                             rocblas_int                  nb,
+                                                             rocblas_int                  kb,
+                                                             const rocblas_float_complex* alpha,
+                                                             const rocblas_float_complex* A,
+                                                             rocblas_int                  lda,
+                                                             const rocblas_float_complex* beta,
+                                                             rocblas_float_complex*       C,
+                                                             rocblas_int                  ldc);
+
+ROCBLAS_DISTRIBUTED_EXPORT rocblas_status rocblas_dist_zsyrk(rocblas_handle                handle,
+                                                             rocblas_dist_grid             grid,
+                                                             rocblas_fill                  uplo,
+                                                             rocblas_int                   n,
+                                                             rocblas_int                   k,
+                                                             rocblas_int                   nb,
+                                                             rocblas_int                   kb,
+                                                             const rocblas_double_complex* alpha,
+                                                             const rocblas_double_complex* A,
+                                                             rocblas_int                   lda,
+                                                             const rocblas_double_complex* beta,
+                                                             rocblas_double_complex*       C,
+                                                             rocblas_int                   ldc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ROCBLAS_DISTRIBUTED_H */
@@ -0,0 +1,870 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas-distributed.h"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+#include <memory>
+#include <new>
+#include <rocblas/internal/rocblas-exported-proto.hpp>
+
+#define RETURN_IF_DIST_HIP_ERROR(expr)            \
+    do                                            \
+    {                                             \
+        hipError_t status_ = (expr);              \
+        if(status_ == hipErrorOutOfMemory)        \
+            return rocblas_status_memory_error;   \
+        if(status_ != hipSuccess)                 \
+            return rocblas_status_internal_error; \
+    } while(0)
+
+#define RETURN_IF_DIST_NCCL_ERROR(expr)           \
+    do                                            \
+    {                                             \
+        if((expr) != ncclSuccess)                 \
+            return rocblas_status_internal_error; \
+    } while(0)
+
+#define RETURN_IF_DIST_ROCBLAS_ERROR(expr)    \
+    do                                        \
+    {                                         \
+        rocblas_status status_ = (expr);      \
+        if(status_ != rocblas_status_success) \
+            return status_;                   \
+    } while(0)
+
+/*******************************************************************************
+ * The grid, with the stream on which the panels are broadcast and the panel
+ * buffers, two of each kind, which are reused from one call to the next.
+ ******************************************************************************/
+struct _rocblas_dist_grid
+{
+    rocblas_int nprow, npcol, myrow, mycol;
+    ncclComm_t  row_comm, col_comm;
+    int         device;
+    hipStream_t comm_stream = nullptr;
+    hipEvent_t  start       = nullptr;
+    hipEvent_t  received[2] = {};
+    hipEvent_t  consumed[2] = {};
+    void*       panels      = nullptr;
+    size_t      panels_size = 0;
+
+    ~_rocblas_dist_grid()
+    {
+        if(comm_stream)
+            (void)hipStreamSynchronize(comm_stream);
+        (void)hipFree(panels);
+        for(auto e : {start, received[0], received[1], consumed[0], consumed[1]})
+            if(e)
+                (void)hipEventDestroy(e);
+        if(comm_stream)
+            (void)hipStreamDestroy(comm_stream);
+    }
+
+    // Panel buffers of at least size bytes. Freeing the previous buffers synchronizes the
+    // device, so that no work of a previous call still uses them.
+    rocblas_status reserve(size_t size)
+    {
+        if(size <= panels_size)
+            return rocblas_status_success;
+        (void)hipFree(panels);
+        panels      = nullptr;
+        panels_size = 0;
+        RETURN_IF_DIST_HIP_ERROR(hipMalloc(&panels, size));
+        panels_size = size;
+        return rocblas_status_success;
+    }
+};
+
+namespace
+{
+    // Number of rows or columns of a dimension n in blocks of nb held by process iproc of nprocs
+    rocblas_int
+        rocblas_dist_numroc(rocblas_int n, rocblas_int nb, rocblas_int iproc, rocblas_int nprocs)
+    {
+        rocblas_int blocks = n / nb;
+        rocblas_int size   = blocks / nprocs * nb;
+        rocblas_int extra  = blocks % nprocs;
+        if(iproc < extra)
+            size += nb;
+        else if(iproc == extra)
+            size += n % nb;
+        return size;
+    }
+
+    // Sets the pointer mode of a handle to host for the local GEMMs, and restores it
+    class rocblas_dist_host_pointer_mode
+    {
+        rocblas_handle       handle;
+        rocblas_pointer_mode saved = rocblas_pointer_mode_host;
+
+    public:
+        explicit rocblas_dist_host_pointer_mode(rocblas_handle handle)
+            : handle(handle)
+        {
+            (void)rocblas_get_pointer_mode(handle, &saved);
+            (void)rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+        }
+
+        ~rocblas_dist_host_pointer_mode()
+        {
+            (void)rocblas_set_pointer_mode(handle, saved);
+        }
+
+        rocblas_dist_host_pointer_mode(const rocblas_dist_host_pointer_mode&) = delete;
+        rocblas_dist_host_pointer_mode& operator=(const rocblas_dist_host_pointer_mode&) = delete;
+    };
+
+    // alpha and beta on the host, copied in the order of the stream if on the device
+    template <typename T>
+    rocblas_status rocblas_dist_scalars_to_host(rocblas_handle handle,
+                                                hipStream_t    stream,
+                                                const T*       alpha,
+                                                const T*       beta,
+                                                T&             alpha_h,
+                                                T&             beta_h)
+    {
+        rocblas_pointer_mode mode;
+        RETURN_IF_DIST_ROCBLAS_ERROR(rocblas_get_pointer_mode(handle, &mode));
+        if(mode == rocblas_pointer_mode_host)
+        {
+            alpha_h = *alpha;
+            beta_h  = *beta;
+            return rocblas_status_success;
+        }
+        RETURN_IF_DIST_HIP_ERROR(
+            hipMemcpyAsync(&alpha_h, alpha, sizeof(T), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_DIST_HIP_ERROR(
+            hipMemcpyAsync(&beta_h, beta, sizeof(T), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_DIST_HIP_ERROR(hipStreamSynchronize(stream));
+        return rocblas_status_success;
+    }
+
+    // SYRK of a diagonal block of C
+    rocblas_status rocblas_dist_local_syrk(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           rocblas_int    k,
+                                           const float*   alpha,
+                                           const float*   A,
+                                           rocblas_int    lda,
+                                           const float*   beta,
+                                           float*         C,
+                                           rocblas_int    ldc)
+    {
+        return rocblas_ssyrk(
+            handle, uplo, rocblas_operation_none, n, k, alpha, A, lda, beta, C, ldc);
+    }
+
+    rocblas_status rocblas_dist_local_syrk(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           rocblas_int    k,
+                                           const double*  alpha,
+                                           const double*  A,
+                                           rocblas_int    lda,
+                                           const double*  beta,
+                                           double*        C,
+                                           rocblas_int    ldc)
+    {
+        return rocblas_dsyrk(
+            handle, uplo, rocblas_operation_none, n, k, alpha, A, lda, beta, C, ldc);
+    }
+
+    rocblas_status rocblas_dist_local_syrk(rocblas_handle               handle,
+                                           rocblas_fill                 uplo,
+                                           rocblas_int                  n,
+                                           rocblas_int                  k,
+                                           const rocblas_float_complex* alpha,
+                                           const rocblas_float_complex* A,
+                                           rocblas_int                  lda,
+                                           const rocblas_float_complex* beta,
+                                           rocblas_float_complex*       C,
+                                           rocblas_int                  ldc)
+    {
+        return rocblas_csyrk(
+            handle, uplo, rocblas_operation_none, n, k, alpha, A, lda, beta, C, ldc);
+    }
+
+    rocblas_status rocblas_dist_local_syrk(rocblas_handle                handle,
+                                           rocblas_fill                  uplo,
+                                           rocblas_int                   n,
+                                           rocblas_int                   k,
+                                           const rocblas_double_complex* alpha,
+                                           const rocblas_double_complex* A,
+                                           rocblas_int                   lda,
+                                           const rocblas_double_complex* beta,
+                                           rocblas_double_complex*       C,
+                                           rocblas_int                   ldc)
+    {
+        return rocblas_zsyrk(
+            handle, uplo, rocblas_operation_none, n, k, alpha, A, lda, beta, C, ldc);
+    }
+
+    // GEMM of local blocks, C = alpha*A*op(B) + beta*C
+    template <typename T>
+    rocblas_status rocblas_dist_local_gemm(rocblas_handle    handle,
+                                           rocblas_operation trans_b,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           const T*          alpha,
+                                           const T*          A,
+                                           rocblas_int       lda,
+                                           const T*          B,
+                                           rocblas_int       ldb,
+                                           const T*          beta,
+                                           T*                C,
+                                           rocblas_int       ldc)
+    {
+        return rocblas_internal_gemm_template<false>(handle,
+                                                     rocblas_operation_none,
+                                                     trans_b,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     A,
+                                                     0,
+                                                     std::max(lda, 1),
+                                                     0,
+                                                     B,
+                                                     0,
+                                                     std::max(ldb, 1),
+                                                     0,
+                                                     beta,
+                                                     C,
+                                                     0,
+                                                     ldc,
+                                                     0,
+                                                     1);
+    }
+
+    /*******************************************************************************
+     * Broadcast panel l of kb columns of the local matrix of A, of rows rows, along
+     * the process row into the buffer a_panel, packed with a leading dimension of
+     * rows. The root broadcasts straight from A when its columns are contiguous.
+     ******************************************************************************/
+    template <typename T>
+    rocblas_status rocblas_dist_broadcast_a_panel(_rocblas_dist_grid* grid,
+                                                  rocblas_int         l,
+                                                  rocblas_int         kb,
+                                                  rocblas_int         kp,
+                                                  rocblas_int         rows,
+                                                  const T*            A,
+                                                  rocblas_int         lda,
+                                                  T*                  a_panel)
+    {
+        size_t count = size_t(rows) * kp;
+        if(!count)
+            return rocblas_status_success;
+
+        rocblas_int root = l % grid->npcol;
+        const T*    send = a_panel;
+        if(grid->mycol == root)
+        {
+            const T* panel = A + size_t(l / grid->npcol) * kb * lda;
+            if(lda == rows)
+                send = panel;
+            else
+                RETURN_IF_DIST_HIP_ERROR(hipMemcpy2DAsync(a_panel,
+                                                          rows * sizeof(T),
+                                                          panel,
+                                                          lda * sizeof(T),
+                                                          rows * sizeof(T),
+                                                          kp,
+                                                          hipMemcpyDeviceToDevice,
+                                                          grid->comm_stream));
+        }
+        RETURN_IF_DIST_NCCL_ERROR(ncclBroadcast(send,
+                                                a_panel,
+                                                count * sizeof(T),
+                                                ncclChar,
+                                                root,
+                                                grid->row_comm,
+                                                grid->comm_stream));
+        return rocblas_status_success;
+    }
+
+    /*******************************************************************************
+     * Broadcast panel l of kb rows of the local matrix of B, of cols columns, along
+     * the process column into the buffer b_panel, packed with a leading dimension
+     * of kp.
+     ******************************************************************************/
+    template <typename T>
+    rocblas_status rocblas_dist_broadcast_b_panel(_rocblas_dist_grid* grid,
+                                                  rocblas_int         l,
+                                                  rocblas_int         kb,
+                                                  rocblas_int         kp,
+                                                  rocblas_int         cols,
+                                                  const T*            B,
+                                                  rocblas_int         ldb,
+                                                  T*                  b_panel)
+    {
+        size_t count = size_t(kp) * cols;
+        if(!count)
+            return rocblas_status_success;
+
+        rocblas_int root = l % grid->nprow;
+        if(grid->myrow == root)
+            RETURN_IF_DIST_HIP_ERROR(hipMemcpy2DAsync(b_panel,
+                                                      kp * sizeof(T),
+                                                      B + size_t(l / grid->nprow) * kb,
+                                                      ldb * sizeof(T),
+                                                      kp * sizeof(T),
+                                                      cols,
+                                                      hipMemcpyDeviceToDevice,
+                                                      grid->comm_stream));
+        RETURN_IF_DIST_NCCL_ERROR(ncclBroadcast(b_panel,
+                                                b_panel,
+                                                count * sizeof(T),
+                                                ncclChar,
+                                                root,
+                                                grid->col_comm,
+                                                grid->comm_stream));
+        return rocblas_status_success;
+    }
+
+    /*******************************************************************************
+     * Run the panel steps of a SUMMA loop: broadcast(l, b) enqueues the broadcasts
+     * of panel l into buffer set b on the stream of the grid, and update(l, b)
+     * enqueues the local update with them on the compute stream. Panel l + 1 is
+     * broadcast before panel l is consumed, and a buffer set is refilled once the
+     * update two panels back has consumed it.
+     ******************************************************************************/
+    template <typename Broadcast, typename Update>
+    rocblas_status rocblas_dist_summa(_rocblas_dist_grid* grid,
+                                      hipStream_t         stream,
+                                      rocblas_int         panels,
+                                      Broadcast&&         broadcast,
+                                      Update&&            update)
+    {
+        // The broadcasts follow prior work on the compute stream, which includes the updates
+        // of a previous call with the same stream; the updates of a previous call on another
+        // stream are waited for through the consumed events
+        RETURN_IF_DIST_HIP_ERROR(hipEventRecord(grid->start, stream));
+        RETURN_IF_DIST_HIP_ERROR(hipStreamWaitEvent(grid->comm_stream, grid->start, 0));
+        for(int b = 0; b < 2; b++)
+            RETURN_IF_DIST_HIP_ERROR(hipStreamWaitEvent(grid->comm_stream, grid->consumed[b], 0));
+
+        auto enqueue_broadcast = [&](rocblas_int l) -> rocblas_status {
+            int b = l % 2;
+            if(l >= 2)
+                RETURN_IF_DIST_HIP_ERROR(
+                    hipStreamWaitEvent(grid->comm_stream, grid->consumed[b], 0));
+            RETURN_IF_DIST_ROCBLAS_ERROR(broadcast(l, b));
+            RETURN_IF_DIST_HIP_ERROR(hipEventRecord(grid->received[b], grid->comm_stream));
+            return rocblas_status_success;
+        };
+
+        RETURN_IF_DIST_ROCBLAS_ERROR(enqueue_broadcast(0));
+        for(rocblas_int l = 0; l < panels; l++)
+        {
+            int b = l % 2;
+            if(l + 1 < panels)
+                RETURN_IF_DIST_ROCBLAS_ERROR(enqueue_broadcast(l + 1));
+
+            RETURN_IF_DIST_HIP_ERROR(hipStreamWaitEvent(stream, grid->received[b], 0));
+            RETURN_IF_DIST_ROCBLAS_ERROR(update(l, b));
+            RETURN_IF_DIST_HIP_ERROR(hipEventRecord(grid->consumed[b], stream));
+        }
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_dist_gemm_impl(rocblas_handle    handle,
+                                          rocblas_dist_grid grid,
+                                          rocblas_int       m,
+                                          rocblas_int       n,
+                                          rocblas_int       k,
+                                          rocblas_int       mb,
+                                          rocblas_int       nb,
+                                          rocblas_int       kb,
+                                          const T*          alpha,
+                                          const T*          A,
+                                          rocblas_int       lda,
+                                          const T*          B,
+                                          rocblas_int       ldb,
+                                          const T*          beta,
+                                          T*                C,
+                                          rocblas_int       ldc)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        if(!grid)
+            return rocblas_status_invalid_pointer;
+        if(m < 0 || n < 0 || k < 0 || mb <= 0 || nb <= 0 || kb <= 0)
+            return rocblas_status_invalid_size;
+
+        // Local sizes of C, of the columns of A and of the rows of B
+        rocblas_int mloc   = rocblas_dist_numroc(m, mb, grid->myrow, grid->nprow);
+        rocblas_int nloc   = rocblas_dist_numroc(n, nb, grid->mycol, grid->npcol);
+        rocblas_int kloc_a = rocblas_dist_numroc(k, kb, grid->mycol, grid->npcol);
+        rocblas_int kloc_b = rocblas_dist_numroc(k, kb, grid->myrow, grid->nprow);
+        if(lda < std::max(1, mloc) || ldb < std::max(1, kloc_b) || ldc < std::max(1, mloc))
+            return rocblas_status_invalid_size;
+
+        if(!m || !n)
+            return rocblas_status_success;
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        hipStream_t stream;
+        RETURN_IF_DIST_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        T alpha_h, beta_h;
+        RETURN_IF_DIST_ROCBLAS_ERROR(
+            rocblas_dist_scalars_to_host(handle, stream, alpha, beta, alpha_h, beta_h));
+        rocblas_dist_host_pointer_mode host_mode(handle);
+
+        bool update = k && alpha_h != T(0);
+        if((mloc && nloc && !C) || (update && mloc && kloc_a && !A)
+           || (update && kloc_b && nloc && !B))
+            return rocblas_status_invalid_pointer;
+
+        // Without an update, C is only scaled by beta
+        if(!update)
+            return mloc && nloc ? rocblas_dist_local_gemm(handle,
+                                                          rocblas_operation_none,
+                                                          mloc,
+                                                          nloc,
+                                                          0,
+                                                          &alpha_h,
+                                                          (const T*)C,
+                                                          ldc,
+                                                          (const T*)C,
+                                                          ldc,
+                                                          &beta_h,
+                                                          C,
+                                                          ldc)
+                                : rocblas_status_success;
+
+        size_t a_panel_size = size_t(mloc) * kb;
+        size_t b_panel_size = size_t(kb) * nloc;
+        RETURN_IF_DIST_ROCBLAS_ERROR(grid->reserve(2 * (a_panel_size + b_panel_size) * sizeof(T)));
+        T* a_panel[2] = {(T*)grid->panels, (T*)grid->panels + a_panel_size};
+        T* b_panel[2] = {a_panel[1] + a_panel_size, a_panel[1] + a_panel_size + b_panel_size};
+
+        const T     one    = 1;
+        rocblas_int panels = (k - 1) / kb + 1;
+        auto        depth  = [&](rocblas_int l) { return std::min(kb, k - l * kb); };
+
+        return rocblas_dist_summa(
+            grid,
+            stream,
+            panels,
+            [&](rocblas_int l, int b) -> rocblas_status {
+                RETURN_IF_DIST_ROCBLAS_ERROR(rocblas_dist_broadcast_a_panel(
+                    grid, l, kb, depth(l), mloc, A, lda, a_panel[b]));
+                return rocblas_dist_broadcast_b_panel(
+                    grid, l, kb, depth(l), nloc, B, ldb, b_panel[b]);
+            },
+            [&](rocblas_int l, int b) -> rocblas_status {
+                if(!mloc || !nloc)
+                    return rocblas_status_success;
+                return rocblas_dist_local_gemm(handle,
+                                               rocblas_operation_none,
+                                               mloc,
+                                               nloc,
+                                               depth(l),
+                                               &alpha_h,
+                                               (const T*)a_panel[b],
+                                               mloc,
+                                               (const T*)b_panel[b],
+                                               depth(l),
+                                               l ? &one : &beta_h,
+                                               C,
+                                               ldc);
+            });
+    }
+
+    /*******************************************************************************
+     * Update the local blocks of C in the uplo triangle with the rows of a panel
+     * of A matching the local rows of C, in a_panel with a leading dimension of
+     * nloc_r, and the rows matching its local columns, in t_panel with a leading
+     * dimension of nloc_c. Each local column block of C has a diagonal block, at
+     * most, updated with a SYRK, and a run of local blocks in the triangle past
+     * it, updated with a GEMM.
+     ******************************************************************************/
+    template <typename T>
+    rocblas_status rocblas_dist_syrk_update(rocblas_handle      handle,
+                                            _rocblas_dist_grid* grid,
+                                            rocblas_fill        uplo,
+                                            rocblas_int         n,
+                                            rocblas_int         nb,
+                                            rocblas_int         nloc_r,
+                                            rocblas_int         nloc_c,
+                                            rocblas_int         kp,
+                                            const T*            alpha,
+                                            const T*            a_panel,
+                                            const T*            t_panel,
+                                            const T*            beta,
+                                            T*                  C,
+                                            rocblas_int         ldc)
+    {
+        const rocblas_int p = grid->nprow, myrow = grid->myrow;
+        for(rocblas_int jc = 0; jc < nloc_c; jc += nb)
+        {
+            rocblas_int J = jc / nb * grid->npcol + grid->mycol;
+            rocblas_int w = std::min(nb, n - J * nb);
+
+            // The local row blocks in the triangle are those of global row blocks I >= J for
+            // lower and I <= J for upper, of which the one of I == J is diagonal
+            rocblas_int r0, r1, diag = -1;
+            if(uplo == rocblas_fill_lower)
+            {
+                r0 = J > myrow ? (J - myrow + p - 1) / p * nb : 0;
+                r1 = nloc_r;
+                if(r0 < r1 && r0 / nb * p + myrow == J)
+                {
+                    diag = r0;
+                    r0 += w;
+                }
+            }
+            else
+            {
+                r0 = 0;
+                r1 = J >= myrow ? std::min(((J - myrow) / p + 1) * nb, nloc_r) : 0;
+                if(r0 < r1 && (r1 - 1) / nb * p + myrow == J)
+                {
+                    diag = (r1 - 1) / nb * nb;
+                    r1   = diag;
+                }
+            }
+
+            if(diag >= 0)
+                RETURN_IF_DIST_ROCBLAS_ERROR(rocblas_dist_local_syrk(handle,
+                                                                     uplo,
+                                                                     w,
+                                                                     kp,
+                                                                     alpha,
+                                                                     a_panel + diag,
+                                                                     std::max(nloc_r, 1),
+                                                                     beta,
+                                                                     C + diag + size_t(jc) * ldc,
+                                                                     ldc));
+            if(r0 < r1)
+                RETURN_IF_DIST_ROCBLAS_ERROR(rocblas_dist_local_gemm(handle,
+                                                                     rocblas_operation_transpose,
+                                                                     r1 - r0,
+                                                                     w,
+                                                                     kp,
+                                                                     alpha,
+                                                                     a_panel + r0,
+                                                                     nloc_r,
+                                                                     t_panel + jc,
+                                                                     nloc_c,
+                                                                     beta,
+                                                                     C + r0 + size_t(jc) * ldc,
+                                                                     ldc));
+        }
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_dist_syrk_impl(rocblas_handle    handle,
+                                          rocblas_dist_grid grid,
+                                          rocblas_fill      uplo,
+                                          rocblas_int       n,
+                                          rocblas_int       k,
+                                          rocblas_int       nb,
+                                          rocblas_int       kb,
+                                          const T*          alpha,
+                                          const T*          A,
+                                          rocblas_int       lda,
+                                          const T*          beta,
+                                          T*                C,
+                                          rocblas_int       ldc)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        if(!grid)
+            return rocblas_status_invalid_pointer;
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+        if(grid->nprow != grid->npcol)
+            return rocblas_status_invalid_size;
+        if(n < 0 || k < 0 || nb <= 0 || kb <= 0)
+            return rocblas_status_invalid_size;
+
+        // Local sizes of the rows and columns of C and of the columns of A
+        rocblas_int nloc_r = rocblas_dist_numroc(n, nb, grid->myrow, grid->nprow);
+        rocblas_int nloc_c = rocblas_dist_numroc(n, nb, grid->mycol, grid->npcol);
+        rocblas_int kloc_a = rocblas_dist_numroc(k, kb, grid->mycol, grid->npcol);
+        if(lda < std::max(1, nloc_r) || ldc < std::max(1, nloc_r))
+            return rocblas_status_invalid_size;
+
+        if(!n)
+            return rocblas_status_success;
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        hipStream_t stream;
+        RETURN_IF_DIST_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        T alpha_h, beta_h;
+        RETURN_IF_DIST_ROCBLAS_ERROR(
+            rocblas_dist_scalars_to_host(handle, stream, alpha, beta, alpha_h, beta_h));
+        rocblas_dist_host_pointer_mode host_mode(handle);
+
+        bool update = k && alpha_h != T(0);
+        if((nloc_r && nloc_c && !C) || (update && nloc_r && kloc_a && !A))
+            return rocblas_status_invalid_pointer;
+
+        // Without an update, the triangle of C is only scaled by beta
+        if(!update)
+            return rocblas_dist_syrk_update(handle,
+                                            grid,
+                                            uplo,
+                                            n,
+                                            nb,
+                                            nloc_r,
+                                            nloc_c,
+                                            0,
+                                            &alpha_h,
+                                            (const T*)C,
+                                            (const T*)C,
+                                            &beta_h,
+                                            C,
+                                            ldc);
+
+        size_t a_panel_size = size_t(nloc_r) * kb;
+        size_t t_panel_size = size_t(nloc_c) * kb;
+        RETURN_IF_DIST_ROCBLAS_ERROR(grid->reserve(2 * (a_panel_size + t_panel_size) * sizeof(T)));
+        T* a_panel[2] = {(T*)grid->panels, (T*)grid->panels + a_panel_size};
+        T* t_panel[2] = {a_panel[1] + a_panel_size, a_panel[1] + a_panel_size + t_panel_size};
+
+        const T     one    = 1;
+        rocblas_int panels = (k - 1) / kb + 1;
+        auto        depth  = [&](rocblas_int l) { return std::min(kb, k - l * kb); };
+
+        return rocblas_dist_summa(
+            grid,
+            stream,
+            panels,
+            [&](rocblas_int l, int b) -> rocblas_status {
+                RETURN_IF_DIST_ROCBLAS_ERROR(rocblas_dist_broadcast_a_panel(
+                    grid, l, kb, depth(l), nloc_r, A, lda, a_panel[b]));
+
+                // On a square grid, the process on the diagonal of a process column holds the
+                // rows of the panel of the columns of C of the process column
+                size_t count = size_t(nloc_c) * depth(l);
+                if(count)
+                    RETURN_IF_DIST_NCCL_ERROR(ncclBroadcast(a_panel[b],
+                                                            t_panel[b],
+                                                            count * sizeof(T),
+                                                            ncclChar,
+                                                            grid->mycol,
+                                                            grid->col_comm,
+                                                            grid->comm_stream));
+                return rocblas_status_success;
+            },
+            [&](rocblas_int l, int b) -> rocblas_status {
+                return rocblas_dist_syrk_update(handle,
+                                                grid,
+                                                uplo,
+                                                n,
+                                                nb,
+                                                nloc_r,
+                                                nloc_c,
+                                                depth(l),
+                                                &alpha_h,
+                                                (const T*)a_panel[b],
+                                                (const T*)t_panel[b],
+                                                l ? &one : &beta_h,
+                                                C,
+                                                ldc);
+            });
+    }
+
+    rocblas_status rocblas_dist_grid_create_impl(rocblas_dist_grid* grid,
+                                                 rocblas_int        nprow,
+                                                 rocblas_int        npcol,
+                                                 ncclComm_t         row_comm,
+                                                 ncclComm_t         col_comm)
+    {
+        if(!grid || !row_comm || !col_comm)
+            return rocblas_status_invalid_pointer;
+        *grid = nullptr;
+        if(nprow <= 0 || npcol <= 0)
+            return rocblas_status_invalid_size;
+
+        int row_size, col_size, row_rank, col_rank;
+        RETURN_IF_DIST_NCCL_ERROR(ncclCommCount(row_comm, &row_size));
+        RETURN_IF_DIST_NCCL_ERROR(ncclCommCount(col_comm, &col_size));
+        RETURN_IF_DIST_NCCL_ERROR(ncclCommUserRank(row_comm, &row_rank));
+        RETURN_IF_DIST_NCCL_ERROR(ncclCommUserRank(col_comm, &col_rank));
+        if(row_size != npcol || col_size != nprow)
+            return rocblas_status_invalid_size;
+
+        auto g      = std::make_unique<_rocblas_dist_grid>();
+        g->nprow    = nprow;
+        g->npcol    = npcol;
+        g->myrow    = col_rank;
+        g->mycol    = row_rank;
+        g->row_comm = row_comm;
+        g->col_comm = col_comm;
+        RETURN_IF_DIST_HIP_ERROR(hipGetDevice(&g->device));
+        RETURN_IF_DIST_HIP_ERROR(hipStreamCreateWithFlags(&g->comm_stream, hipStreamNonBlocking));
+        RETURN_IF_DIST_HIP_ERROR(hipEventCreateWithFlags(&g->start, hipEventDisableTiming));
+        for(int b = 0; b < 2; b++)
+        {
+            RETURN_IF_DIST_HIP_ERROR(
+                hipEventCreateWithFlags(&g->received[b], hipEventDisableTiming));
+            RETURN_IF_DIST_HIP_ERROR(
+                hipEventCreateWithFlags(&g->consumed[b], hipEventDisableTiming));
+        }
+
+        *grid = g.release();
+        return rocblas_status_success;
+    }
+}
+
+/*******************************************************************************
+ * Distributed APIs
+ ******************************************************************************/
+extern "C" {
+
+rocblas_status rocblas_dist_grid_create(rocblas_dist_grid* grid,
+                                        rocblas_int        nprow,
+                                        rocblas_int        npcol,
+                                        ncclComm_t         row_comm,
+                                        ncclComm_t         col_comm)
+try
+{
+    return rocblas_dist_grid_create_impl(grid, nprow, npcol, row_comm, col_comm);
+}
+catch(const std::bad_alloc&)
+{
+    return rocblas_status_memory_error;
+}
+catch(...)
+{
+    return rocblas_status_internal_error;
+}
+
+rocblas_status rocblas_dist_grid_destroy(rocblas_dist_grid grid)
+{
+    delete grid;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_dist_grid_get_coords(rocblas_dist_grid grid,
+                                            rocblas_int*      myrow,
+                                            rocblas_int*      mycol)
+{
+    if(!grid || !myrow || !mycol)
+        return rocblas_status_invalid_pointer;
+    *myrow = grid->myrow;
+    *mycol = grid->mycol;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_dist_local_size(
+    rocblas_int n, rocblas_int nb, rocblas_int iproc, rocblas_int nprocs, rocblas_int* size)
+{
+    if(!size)
+        return rocblas_status_invalid_pointer;
+    if(n < 0 || nb <= 0 || nprocs <= 0 || iproc < 0 || iproc >= nprocs)
+        return rocblas_status_invalid_size;
+    *size = rocblas_dist_numroc(n, nb, iproc, nprocs);
+    return rocblas_status_success;
+}
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                      \
+    rocblas_status routine_name_(rocblas_handle    handle,                           \
+                                 rocblas_dist_grid grid,                             \
+                                 rocblas_int       m,                                \
+                                 rocblas_int       n,                                \
+                                 rocblas_int       k,                                \
+                                 rocblas_int       mb,                               \
+                                 rocblas_int       nb,                               \
+                                 rocblas_int       kb,                               \
+                                 const T_*         alpha,                            \
+                                 const T_*         A,                                \
+                                 rocblas_int       lda,                              \
+                                 const T_*         B,                                \
+                                 rocblas_int       ldb,                              \
+                                 const T_*         beta,                             \
+                                 T_*               C,                                \
+                                 rocblas_int       ldc)                              \
+    try                                                                              \
+    {                                                                                \
+        return rocblas_dist_gemm_impl(                                               \
+            handle, grid, m, n, k, mb, nb, kb, alpha, A, lda, B, ldb, beta, C, ldc); \
+    }                                                                                \
+    catch(const std::bad_alloc&)                                                     \
+    {                                                                                \
+        return rocblas_status_memory_error;                                          \
+    }                                                                                \
+    catch(...)                                                                       \
+    {                                                                                \
+        return rocblas_status_internal_error;                                        \
+    }
+
+IMPL(rocblas_dist_sgemm, float);
+IMPL(rocblas_dist_dgemm, double);
+IMPL(rocblas_dist_cgemm, rocblas_float_complex);
+IMPL(rocblas_dist_zgemm, rocblas_double_complex);
+
+#undef IMPL
+
+#define IMPL(routine_name_, T_)                                             \
+    rocblas_status routine_name_(rocblas_handle    handle,                  \
+                                 rocblas_dist_grid grid,                    \
+                                 rocblas_fill      uplo,                    \
+                                 rocblas_int       n,                       \
+                                 rocblas_int       k,                       \
+                                 rocblas_int       nb,                      \
+                                 rocblas_int       kb,                      \
+                                 const T_*         alpha,                   \
+                                 const T_*         A,                       \
+                                 rocblas_int       lda,                     \
+                                 const T_*         beta,                    \
+                                 T_*               C,                       \
+                                 rocblas_int       ldc)                     \
+    try                                                                     \
+    {                                                                       \
+        return rocblas_dist_syrk_impl(                                      \
+            handle, grid, uplo, n, k, nb, kb, alpha, A, lda, beta, C, ldc); \
+    }                                                                       \
+    catch(const std::bad_alloc&)                                            \
+    {                                                                       \
+        return rocblas_status_memory_error;                                 \
+    }                                                                       \
+    catch(...)                                                              \
+    {                                                                       \
+        return rocblas_status_internal_error;                               \
+    }
+
+IMPL(rocblas_dist_ssyrk, float);
+IMPL(rocblas_dist_dsyrk, double);
+IMPL(rocblas_dist_csyrk, rocblas_float_complex);
+IMPL(rocblas_dist_zsyrk, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
@@ -446,6 +446,8341 @@ ROCBLAS_EXPORT rocblas_status
                                                   rocblas_int*      list_array,
                                                   rocblas_int*      list_size);
 
+/*! \brief Statistics describing the solution selection cache held in a rocblas_handle */
+typedef struct rocblas_solution_cache_info_
+{
+    size_t capacity; /**< maximum number of cached problems; 0 if the cache is disabled */
+    size_t entries; /**< number of problems currently cached */
+    size_t hits; /**< number of lookups which skipped solution selection */
+    size_t misses; /**< number of lookups which required solution selection */
+    size_t evictions; /**< number of entries replaced to make room for new problems */
+} rocblas_solution_cache_info;
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_solution_cache_info returns statistics for the handle's solution selection cache.
+    The cache maps GEMM problem descriptors (types, transposes, sizes, leading dimensions, strides,
+    batch count, gemm flags and modes of the handle) to the Tensile solution selected for them,
+    so that repeated calls with the same problem skip solution selection. The default capacity
+    is 1024 problems and can be set with the ROCBLAS_SOLUTION_CACHE_SIZE environment variable.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    info      [rocblas_solution_cache_info*]
+              pointer to where the statistics will be stored.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_solution_cache_info(rocblas_handle               handle,
+                                                              rocblas_solution_cache_info* info);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_solution_cache_capacity sets the maximum number of problems held in the handle's
+    solution selection cache. All cached entries are discarded. A capacity of 0 disables the cache.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    capacity  [size_t]
+              maximum number of cached problems; rounded up to a power of 2.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_solution_cache_capacity(rocblas_handle handle,
+                                                                  size_t         capacity);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_clear_solution_cache evicts all entries from the handle's solution selection cache and
+    resets its statistics. The cache is also cleared implicitly by rocblas_set_performance_metric
+    and rocblas_set_solution_fitness_query.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_clear_solution_cache(rocblas_handle handle);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_cu_count sets the number of compute units for which the GEMM solutions of the
+    handle are selected, so that the tiles and grids chosen fit a partition of the device which
+    the application restricts its kernels to, instead of oversubscribing it. The kernels are not
+    restricted by rocBLAS; streams created with hipExtStreamCreateWithCUMask are, and a handle
+    whose stream is CU-masked selects solutions for the compute units enabled by the mask. The
+    smaller of the two counts is used. Solutions selected for fewer compute units are cached apart
+    from the others.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    cu_count  [rocblas_int]
+              number of compute units; 0, the default, or a count of at least the number of
+              compute units of the device selects solutions for the whole device.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_cu_count(rocblas_handle handle, rocblas_int cu_count);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_cu_count returns the number of compute units for which the GEMM solutions of the
+    handle are selected: the count set with rocblas_set_cu_count or enabled by the CU mask of the
+    handle's stream, if smaller than the number of compute units of the device, which is returned
+    otherwise.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    cu_count  [rocblas_int*]
+              pointer to where the number of compute units will be stored.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_cu_count(rocblas_handle handle, rocblas_int* cu_count);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_log_sampling samples the calls logged with rocblas_layer_mode_log_trace and
+    rocblas_layer_mode_log_bench on the handle: one call in every sample_every calls of each
+    function is logged on each thread, and of those at most max_per_second calls of each function
+    are logged per second. The arguments of the calls which are not logged are not formatted.
+    The defaults are read from the environment variables ROCBLAS_LOG_SAMPLE_EVERY and
+    ROCBLAS_LOG_SAMPLE_MAX_PER_SECOND; profile logging is not sampled.
+
+    @param[in]
+    handle          [rocblas_handle]
+                    handle to the rocblas library context queue.
+    @param[in]
+    sample_every    [rocblas_int]
+                    number of calls of each function per logged call; 0 or 1 logs every call.
+    @param[in]
+    max_per_second  [rocblas_int]
+                    maximum number of logged calls of each function per second; 0 for no limit.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_log_sampling(rocblas_handle handle,
+                                                       rocblas_int    sample_every,
+                                                       rocblas_int    max_per_second);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_log_sampling returns the sampling of the trace and bench logging of the handle.
+
+    @param[in]
+    handle          [rocblas_handle]
+                    handle to the rocblas library context queue.
+    @param[out]
+    sample_every    [rocblas_int*]
+                    pointer to where the number of calls per logged call will be stored.
+    @param[out]
+    max_per_second  [rocblas_int*]
+                    pointer to where the maximum number of logged calls per second will be stored.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_log_sampling(rocblas_handle handle,
+                                                       rocblas_int*   sample_every,
+                                                       rocblas_int*   max_per_second);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_pointer_array writes the device array of batch_count pointers
+    ptr_array[i] = base + i * stride, in elements of elem_size bytes, which the batched functions
+    take, with a kernel on the stream of the handle. The array of a strided allocation is built on
+    the device, without an array of pointers on the host or a copy to the device, so that it can be
+    rebuilt before each batched call without synchronizing the stream, also while the stream is
+    captured in a HIP graph, and from languages such as Fortran which build pointer arrays with
+    c_loc.
+
+    @param[in]
+    handle       [rocblas_handle]
+                 handle to the rocblas library context queue.
+    @param[in]
+    elem_size    [rocblas_int]
+                 number of bytes per element.
+    @param[in]
+    base         device pointer to the first element of the first batch.
+    @param[in]
+    stride       [rocblas_stride]
+                 number of elements from the first element of a batch to that of the next one.
+    @param[in]
+    batch_count  [rocblas_int]
+                 number of pointers to write.
+    @param[out]
+    ptr_array    device array of batch_count pointers.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_pointer_array(rocblas_handle handle,
+                                                        rocblas_int    elem_size,
+                                                        void*          base,
+                                                        rocblas_stride stride,
+                                                        rocblas_int    batch_count,
+                                                        void**         ptr_array);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_pointer_array returns the device array of batch_count pointers
+    base + i * stride, in elements of elem_size bytes, from a cache kept by the handle. The array is
+    allocated and written with a kernel on the stream of the handle by the first call for a given
+    base, stride in bytes and batch_count, and later calls return it without any work, so that
+    batched calls repeated on the same strided allocation neither build nor upload their pointer
+    arrays. The array belongs to the handle and must not be written. The handle keeps 64 arrays,
+    and frees the least recently used one to make room. Allocating and freeing synchronize the
+    device, so in graph safe mode only arrays already cached are returned, and
+    rocblas_status_not_implemented otherwise.
+
+    @param[in]
+    handle       [rocblas_handle]
+                 handle to the rocblas library context queue.
+    @param[in]
+    elem_size    [rocblas_int]
+                 number of bytes per element.
+    @param[in]
+    base         device pointer to the first element of the first batch.
+    @param[in]
+    stride       [rocblas_stride]
+                 number of elements from the first element of a batch to that of the next one.
+    @param[in]
+    batch_count  [rocblas_int]
+                 number of pointers.
+    @param[out]
+    ptr_array    pointer to the device array of batch_count pointers, valid until the handle is
+                 destroyed or 64 other arrays are requested; nullptr if batch_count is 0.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_pointer_array(rocblas_handle handle,
+                                                        rocblas_int    elem_size,
+                                                        void*          base,
+                                                        rocblas_stride stride,
+                                                        rocblas_int    batch_count,
+                                                        void* const**  ptr_array);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_matrix_ex copies a matrix from host memory to device memory, converting its
+    elements from a_type to the narrower b_type. The elements are converted on the host as they
+    are staged in pinned buffers, so only b_type elements are transferred and no temporary device
+    matrix is used. The conversions from rocblas_datatype_f32_r to rocblas_datatype_f16_r or
+    rocblas_datatype_bf16_r round to nearest even, as do those from rocblas_datatype_f64_r to
+    rocblas_datatype_f32_r; other pairs of different types return rocblas_status_not_implemented.
+    With a_type equal to b_type it is rocblas_set_matrix. It returns once the copy has completed.
+
+    @param[in]
+    rows      [rocblas_int]
+              number of rows in matrices.
+    @param[in]
+    cols      [rocblas_int]
+              number of columns in matrices.
+    @param[in]
+    a_h       pointer to matrix on the host.
+    @param[in]
+    a_type    [rocblas_datatype]
+              datatype of the host matrix.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, lda >= rows.
+    @param[out]
+    b_d       pointer to matrix on the GPU.
+    @param[in]
+    b_type    [rocblas_datatype]
+              datatype of the device matrix.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B, ldb >= rows.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_matrix_ex(rocblas_int      rows,
+                                                    rocblas_int      cols,
+                                                    const void*      a_h,
+                                                    rocblas_datatype a_type,
+                                                    rocblas_int      lda,
+                                                    void*            b_d,
+                                                    rocblas_datatype b_type,
+                                                    rocblas_int      ldb);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_matrix_ex copies a matrix from device memory to host memory, converting its
+    elements from a_type to the wider b_type. Only a_type elements are transferred, and they are
+    converted on the host as they leave the pinned staging buffers. The conversions are those of
+    rocblas_set_matrix_ex in the other direction, which are exact.
+    With a_type equal to b_type it is rocblas_get_matrix. It returns once the copy has completed.
+
+    @param[in]
+    rows      [rocblas_int]
+              number of rows in matrices.
+    @param[in]
+    cols      [rocblas_int]
+              number of columns in matrices.
+    @param[in]
+    a_d       pointer to matrix on the GPU.
+    @param[in]
+    a_type    [rocblas_datatype]
+              datatype of the device matrix.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, lda >= rows.
+    @param[out]
+    b_h       pointer to matrix on the host.
+    @param[in]
+    b_type    [rocblas_datatype]
+              datatype of the host matrix.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B, ldb >= rows.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_matrix_ex(rocblas_int      rows,
+                                                    rocblas_int      cols,
+                                                    const void*      a_d,
+                                                    rocblas_datatype a_type,
+                                                    rocblas_int      lda,
+                                                    void*            b_h,
+                                                    rocblas_datatype b_type,
+                                                    rocblas_int      ldb);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_matrix_batched_async copies batch_count matrices from host memory to device
+    memory. Consecutive matrices which are adjacent in both host and device memory are copied
+    together with a single asynchronous 2D copy on stream. Small matrices which are not are
+    packed together in pinned staging buffers, each buffer is copied at once and a kernel on
+    stream scatters its matrices to their device addresses, so that a batch of small matrices
+    costs a few operations per staging buffer instead of one copy per matrix. The function
+    returns once the staged matrices have been copied; the other copies are asynchronous when
+    the host memory is allocated with hipHostMalloc.
+
+    @param[in]
+    rows        [rocblas_int]
+                number of rows in matrices.
+    @param[in]
+    cols        [rocblas_int]
+                number of columns in matrices.
+    @param[in]
+    elem_size   [rocblas_int]
+                number of bytes per element in the matrices.
+    @param[in]
+    a_h         host array of batch_count pointers to matrices on the host.
+    @param[in]
+    lda         [rocblas_int]
+                specifies the leading dimension of the matrices a_h[i], lda >= rows.
+    @param[out]
+    b_d         host array of batch_count pointers to matrices on the GPU.
+    @param[in]
+    ldb         [rocblas_int]
+                specifies the leading dimension of the matrices b_d[i], ldb >= rows.
+    @param[in]
+    batch_count [rocblas_int]
+                number of matrices in the batch.
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_matrix_batched_async(rocblas_int       rows,
+                                                               rocblas_int       cols,
+                                                               rocblas_int       elem_size,
+                                                               const void* const a_h[],
+                                                               rocblas_int       lda,
+                                                               void* const       b_d[],
+                                                               rocblas_int       ldb,
+                                                               rocblas_int       batch_count,
+                                                               hipStream_t       stream);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_matrix_batched_async copies batch_count matrices from device memory to host
+    memory, as rocblas_set_matrix_batched_async does in the other direction: small matrices are
+    gathered by a kernel into a staging buffer, which is copied to pinned host memory at once.
+    The function returns once the staged matrices have been copied.
+
+    @param[in]
+    rows        [rocblas_int]
+                number of rows in matrices.
+    @param[in]
+    cols        [rocblas_int]
+                number of columns in matrices.
+    @param[in]
+    elem_size   [rocblas_int]
+                number of bytes per element in the matrices.
+    @param[in]
+    a_d         host array of batch_count pointers to matrices on the GPU.
+    @param[in]
+    lda         [rocblas_int]
+                specifies the leading dimension of the matrices a_d[i], lda >= rows.
+    @param[out]
+    b_h         host array of batch_count pointers to matrices on the host.
+    @param[in]
+    ldb         [rocblas_int]
+                specifies the leading dimension of the matrices b_h[i], ldb >= rows.
+    @param[in]
+    batch_count [rocblas_int]
+                number of matrices in the batch.
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_matrix_batched_async(rocblas_int       rows,
+                                                               rocblas_int       cols,
+                                                               rocblas_int       elem_size,
+                                                               const void* const a_d[],
+                                                               rocblas_int       lda,
+                                                               void* const       b_h[],
+                                                               rocblas_int       ldb,
+                                                               rocblas_int       batch_count,
+                                                               hipStream_t       stream);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_matrix_strided_batched_async is rocblas_set_matrix_batched_async for matrices
+    a_h + i * stride_a and b_d + i * stride_b. With stride_a = lda * cols and
+    stride_b = ldb * cols the whole batch is a single copy.
+
+    @param[in]
+    rows        [rocblas_int]
+                number of rows in matrices.
+    @param[in]
+    cols        [rocblas_int]
+                number of columns in matrices.
+    @param[in]
+    elem_size   [rocblas_int]
+                number of bytes per element in the matrices.
+    @param[in]
+    a_h         pointer to the first matrix on the host.
+    @param[in]
+    lda         [rocblas_int]
+                specifies the leading dimension of the matrices on the host, lda >= rows.
+    @param[in]
+    stride_a    [rocblas_stride]
+                stride in elements from one matrix on the host to the next.
+    @param[out]
+    b_d         pointer to the first matrix on the GPU.
+    @param[in]
+    ldb         [rocblas_int]
+                specifies the leading dimension of the matrices on the GPU, ldb >= rows.
+    @param[in]
+    stride_b    [rocblas_stride]
+                stride in elements from one matrix on the GPU to the next.
+    @param[in]
+    batch_count [rocblas_int]
+                number of matrices in the batch.
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status
+    rocblas_set_matrix_strided_batched_async(rocblas_int    rows,
+                                             rocblas_int    cols,
+                                             rocblas_int    elem_size,
+                                             const void*    a_h,
+                                             rocblas_int    lda,
+                                             rocblas_stride stride_a,
+                                             void*          b_d,
+                                             rocblas_int    ldb,
+                                             rocblas_stride stride_b,
+                                             rocblas_int    batch_count,
+                                             hipStream_t    stream);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_matrix_strided_batched_async is rocblas_get_matrix_batched_async for matrices
+    a_d + i * stride_a and b_h + i * stride_b.
+
+    @param[in]
+    rows        [rocblas_int]
+                number of rows in matrices.
+    @param[in]
+    cols        [rocblas_int]
+                number of columns in matrices.
+    @param[in]
+    elem_size   [rocblas_int]
+                number of bytes per element in the matrices.
+    @param[in]
+    a_d         pointer to the first matrix on the GPU.
+    @param[in]
+    lda         [rocblas_int]
+                specifies the leading dimension of the matrices on the GPU, lda >= rows.
+    @param[in]
+    stride_a    [rocblas_stride]
+                stride in elements from one matrix on the GPU to the next.
+    @param[out]
+    b_h         pointer to the first matrix on the host.
+    @param[in]
+    ldb         [rocblas_int]
+                specifies the leading dimension of the matrices on the host, ldb >= rows.
+    @param[in]
+    stride_b    [rocblas_stride]
+                stride in elements from one matrix on the host to the next.
+    @param[in]
+    batch_count [rocblas_int]
+                number of matrices in the batch.
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status
+    rocblas_get_matrix_strided_batched_async(rocblas_int    rows,
+                                             rocblas_int    cols,
+                                             rocblas_int    elem_size,
+                                             const void*    a_d,
+                                             rocblas_int    lda,
+                                             rocblas_stride stride_a,
+                                             void*          b_h,
+                                             rocblas_int    ldb,
+                                             rocblas_stride stride_b,
+                                             rocblas_int    batch_count,
+                                             hipStream_t    stream);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_vector_batched_async copies batch_count vectors of n elements from host memory
+    to device memory, as rocblas_set_matrix_batched_async copies n x 1 matrices when
+    incx = incy = 1, or 1 x n matrices with leading dimensions incx and incy otherwise.
+
+    @param[in]
+    n           [rocblas_int]
+                number of elements in the vectors.
+    @param[in]
+    elem_size   [rocblas_int]
+                number of bytes per element in the vectors.
+    @param[in]
+    x_h         host array of batch_count pointers to vectors on the host.
+    @param[in]
+    incx        [rocblas_int]
+                specifies the increment for the elements of the vectors x_h[i].
+    @param[out]
+    y_d         host array of batch_count pointers to vectors on the GPU.
+    @param[in]
+    incy        [rocblas_int]
+                specifies the increment for the elements of the vectors y_d[i].
+    @param[in]
+    batch_count [rocblas_int]
+                number of vectors in the batch.
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_vector_batched_async(rocblas_int       n,
+                                                               rocblas_int       elem_size,
+                                                               const void* const x_h[],
+                                                               rocblas_int       incx,
+                                                               void* const       y_d[],
+                                                               rocblas_int       incy,
+                                                               rocblas_int       batch_count,
+                                                               hipStream_t       stream);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_vector_batched_async copies batch_count vectors of n elements from device
+    memory to host memory, as rocblas_set_vector_batched_async does in the other direction.
+
+    @param[in]
+    n           [rocblas_int]
+                number of elements in the vectors.
+    @param[in]
+    elem_size   [rocblas_int]
+                number of bytes per element in the vectors.
+    @param[in]
+    x_d         host array of batch_count pointers to vectors on the GPU.
+    @param[in]
+    incx        [rocblas_int]
+                specifies the increment for the elements of the vectors x_d[i].
+    @param[out]
+    y_h         host array of batch_count pointers to vectors on the host.
+    @param[in]
+    incy        [rocblas_int]
+                specifies the increment for the elements of the vectors y_h[i].
+    @param[in]
+    batch_count [rocblas_int]
+                number of vectors in the batch.
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_vector_batched_async(rocblas_int       n,
+                                                               rocblas_int       elem_size,
+                                                               const void* const x_d[],
+                                                               rocblas_int       incx,
+                                                               void* const       y_h[],
+                                                               rocblas_int       incy,
+                                                               rocblas_int       batch_count,
+                                                               hipStream_t       stream);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_vector_strided_batched_async is rocblas_set_vector_batched_async for vectors
+    x_h + i * stride_x and y_d + i * stride_y.
+
+    @param[in]
+    n           [rocblas_int]
+                number of elements in the vectors.
+    @param[in]
+    elem_size   [rocblas_int]
+                number of bytes per element in the vectors.
+    @param[in]
+    x_h         pointer to the first vector on the host.
+    @param[in]
+    incx        [rocblas_int]
+                specifies the increment for the elements of the vectors on the host.
+    @param[in]
+    stride_x    [rocblas_stride]
+                stride in elements from one vector on the host to the next.
+    @param[out]
+    y_d         pointer to the first vector on the GPU.
+    @param[in]
+    incy        [rocblas_int]
+                specifies the increment for the elements of the vectors on the GPU.
+    @param[in]
+    stride_y    [rocblas_stride]
+                stride in elements from one vector on the GPU to the next.
+    @param[in]
+    batch_count [rocblas_int]
+                number of vectors in the batch.
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status
+    rocblas_set_vector_strided_batched_async(rocblas_int    n,
+                                             rocblas_int    elem_size,
+                                             const void*    x_h,
+                                             rocblas_int    incx,
+                                             rocblas_stride stride_x,
+                                             void*          y_d,
+                                             rocblas_int    incy,
+                                             rocblas_stride stride_y,
+                                             rocblas_int    batch_count,
+                                             hipStream_t    stream);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_vector_strided_batched_async is rocblas_get_vector_batched_async for vectors
+    x_d + i * stride_x and y_h + i * stride_y.
+
+    @param[in]
+    n           [rocblas_int]
+                number of elements in the vectors.
+    @param[in]
+    elem_size   [rocblas_int]
+                number of bytes per element in the vectors.
+    @param[in]
+    x_d         pointer to the first vector on the GPU.
+    @param[in]
+    incx        [rocblas_int]
+                specifies the increment for the elements of the vectors on the GPU.
+    @param[in]
+    stride_x    [rocblas_stride]
+                stride in elements from one vector on the GPU to the next.
+    @param[out]
+    y_h         pointer to the first vector on the host.
+    @param[in]
+    incy        [rocblas_int]
+                specifies the increment for the elements of the vectors on the host.
+    @param[in]
+    stride_y    [rocblas_stride]
+                stride in elements from one vector on the host to the next.
+    @param[in]
+    batch_count [rocblas_int]
+                number of vectors in the batch.
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status
+    rocblas_get_vector_strided_batched_async(rocblas_int    n,
+                                             rocblas_int    elem_size,
+                                             const void*    x_d,
+                                             rocblas_int    incx,
+                                             rocblas_stride stride_x,
+                                             void*          y_h,
+                                             rocblas_int    incy,
+                                             rocblas_stride stride_y,
+                                             rocblas_int    batch_count,
+                                             hipStream_t    stream);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_convert_float_to_bfloat16 converts n floats in host memory to rocblas_bfloat16, as
+    the rocblas_bfloat16 constructors do: rounding to nearest even, or truncating, and preserving
+    signaling NaN. The bulk conversions of rocblas_convert_float_to_bfloat16,
+    rocblas_convert_bfloat16_to_float, rocblas_convert_float_to_half and
+    rocblas_convert_half_to_float use AVX2 and F16C when the CPU supports them, or NEON on
+    AArch64, with exactly the results of the element conversions.
+
+    @param[in]
+    n         [size_t]
+              number of elements.
+    @param[in]
+    x         [const float*]
+              host array of n floats.
+    @param[out]
+    y         [rocblas_bfloat16*]
+              host array of n rocblas_bfloat16.
+    @param[in]
+    truncate  [bool]
+              whether the mantissa is truncated instead of rounded to nearest even.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_convert_float_to_bfloat16(size_t            n,
+                                                                const float*      x,
+                                                                rocblas_bfloat16* y,
+                                                                bool              truncate);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_convert_bfloat16_to_float converts n rocblas_bfloat16 in host memory to float,
+    which is exact.
+
+    @param[in]
+    n         [size_t]
+              number of elements.
+    @param[in]
+    x         [const rocblas_bfloat16*]
+              host array of n rocblas_bfloat16.
+    @param[out]
+    y         [float*]
+              host array of n floats.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_convert_bfloat16_to_float(size_t                  n,
+                                                                const rocblas_bfloat16* x,
+                                                                float*                  y);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_convert_float_to_half converts n floats in host memory to rocblas_half, rounding to
+    nearest even.
+
+    @param[in]
+    n         [size_t]
+              number of elements.
+    @param[in]
+    x         [const float*]
+              host array of n floats.
+    @param[out]
+    y         [rocblas_half*]
+              host array of n rocblas_half.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_convert_float_to_half(size_t        n,
+                                                            const float*  x,
+                                                            rocblas_half* y);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_convert_half_to_float converts n rocblas_half in host memory to float, which is
+    exact.
+
+    @param[in]
+    n         [size_t]
+              number of elements.
+    @param[in]
+    x         [const rocblas_half*]
+              host array of n rocblas_half.
+    @param[out]
+    y         [float*]
+              host array of n floats.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_convert_half_to_float(size_t              n,
+                                                            const rocblas_half* x,
+                                                            float*              y);
+
+/*! \brief BLAS Auxiliary API
+
+    \details
+    rocblas_get_host_numa_node returns the NUMA node of the host memory nearest to the device
+    of the handle, read from the PCI topology of the device. The pinned staging buffers of
+    rocblas_set_matrix, rocblas_get_matrix, their _ex and _async variants and of the host
+    memory offload of gemm and trsm are allocated on this node, so that host to device
+    transfers do not cross the socket interconnect on multi-socket hosts.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    numa_node [int*]
+              NUMA node of the device, or -1 if the host does not report it, in which case
+              the staging buffers are allocated with the default policy of the process.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_host_numa_node(rocblas_handle handle, int* numa_node);
+
+/*! \brief Counts and host times of the GEMM problems run with Tensile on a rocblas_handle */
+typedef struct rocblas_tensile_host_stats_
+{
+    size_t calls; /**< number of GEMM problems run with Tensile */
+    size_t selections; /**< number of solution selections which missed the solution caches */
+    size_t launches; /**< number of GEMM problems whose kernels were launched */
+    double construct_us; /**< host time constructing the Tensile problems, in microseconds */
+    double select_us; /**< host time looking up and selecting solutions, in microseconds */
+    double solve_us; /**< host time packing the kernel arguments, in microseconds */
+    double launch_us; /**< host time launching the kernels, in microseconds */
+} rocblas_tensile_host_stats;
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_tensile_host_stats returns the number of GEMM problems run with Tensile on the
+    handle since it was created or since rocblas_reset_tensile_host_stats, how many of them
+    required a solution selection, and how many launched kernels. The host times of the stages
+    of these calls are only accumulated while timing is enabled with
+    rocblas_set_tensile_host_timing or with rocblas_layer_mode_log_profile, which logs the
+    statistics with the profile when the handle is destroyed.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    stats     [rocblas_tensile_host_stats*]
+              pointer to where the statistics will be stored.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_tensile_host_stats(rocblas_handle              handle,
+                                                             rocblas_tensile_host_stats* stats);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_tensile_host_timing enables or disables the timing of the host stages of the GEMM
+    problems run with Tensile on the handle. Timing is disabled by default.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    enable    [rocblas_int]
+              1 to enable timing, 0 to disable it.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_tensile_host_timing(rocblas_handle handle,
+                                                              rocblas_int    enable);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_reset_tensile_host_stats resets the counts and host times of the GEMM problems run with
+    Tensile on the handle.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_reset_tensile_host_stats(rocblas_handle handle);
+
+/*! \brief Counts and peak sizes of the device memory allocations made on a rocblas_handle */
+typedef struct rocblas_device_memory_stats_
+{
+    size_t allocations; /**< number of device memory allocations of a nonzero size */
+    size_t failures; /**< number of allocations which could not be satisfied */
+    size_t total_size; /**< sum of the allocation sizes in bytes */
+    size_t peak_size; /**< largest device memory in use at once, in bytes */
+} rocblas_device_memory_stats;
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_device_memory_stats returns the number and total size of the temporary device
+    memory allocations made by rocBLAS functions on the handle since it was created or since
+    rocblas_reset_device_memory_stats, and the largest device memory in use at once, which is
+    the smallest device memory size for which none of these allocations would have failed.
+    Failed allocations are counted with their requested size.
+
+    With a function name such as "rocblas_strsm", only the allocations of the calls of that
+    function are counted. Calls are only attributed to functions with
+    rocblas_layer_mode_log_profile, which also logs the statistics of every function with the
+    profile when the handle is destroyed; the statistics of a function which made no
+    allocations are 0.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    function  [const char*]
+              name of the rocBLAS function, or nullptr for all allocations.
+    @param[out]
+    stats     [rocblas_device_memory_stats*]
+              pointer to where the statistics will be stored.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_device_memory_stats(rocblas_handle               handle,
+                                                              const char*                  function,
+                                                              rocblas_device_memory_stats* stats);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_reset_device_memory_stats resets the counts and peak sizes of the device memory
+    allocations made on the handle.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_reset_device_memory_stats(rocblas_handle handle);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_load_tuning_db maps a tuning database file written by rocblas_save_tuning_db.
+    For every GEMM problem found in the database for the current GPU architecture, the stored
+    solution index is used instead of the default Tensile solution selection, for every handle
+    in the process. A database named by the ROCBLAS_TUNING_DB environment variable is loaded
+    automatically. Loading a database replaces the previously loaded one. A database written
+    by a rocBLAS version with a different database format is rejected with
+    rocblas_status_invalid_value, and must be tuned again.
+
+    @param[in]
+    path      [const char*]
+              path of the database file; nullptr unloads the current database.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_load_tuning_db(const char* path);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_save_tuning_db writes the loaded tuning database, merged with all entries recorded
+    since it was loaded, to a file. Recorded entries replace loaded entries for the same problem.
+
+    @param[in]
+    path      [const char*]
+              path of the database file; may be the path of the loaded database.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_save_tuning_db(const char* path);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_tuning_db_record enables or disables recording on a handle. While enabled,
+    each successful GEMM run with rocblas_gemm_algo_solution_index and a positive solution
+    index records that index as the tuned solution for the problem in the process tuning
+    database. rocblas-bench uses this with the --tune option.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    record    [bool]
+              whether to record tuned solutions.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_tuning_db_record(rocblas_handle handle, bool record);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_gemm_autotune enables or disables GEMM autotuning on a handle. While enabled,
+    the first time a GEMM problem which is not in the tuning database or the solution cache is
+    run with rocblas_gemm_algo_standard, the solution selected by Tensile and up to
+    candidates - 1 other solutions which can solve it are each run and timed on the problem's
+    data, with D written to device memory workspace, and the fastest is cached and used from
+    then on. The first call synchronizes the stream; autotuning is not done in graph safe mode,
+    for batched GEMMs with arrays of pointers, or when querying the device memory size.
+    If tuning database recording is enabled with rocblas_set_tuning_db_record, the fastest
+    solution is also recorded in the tuning database, and can be saved with
+    rocblas_save_tuning_db.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    candidates [rocblas_int]
+              number of solutions to time; 0 or 1 disables autotuning.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_gemm_autotune(rocblas_handle handle,
+                                                        rocblas_int    candidates);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_gemm_autotune returns the number of solutions timed by GEMM autotuning on a
+    handle.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    candidates [rocblas_int*]
+              number of solutions timed; 0 or 1 if autotuning is disabled.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_gemm_autotune(rocblas_handle handle,
+                                                        rocblas_int*   candidates);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_gemm_workgroup_mapping sets the workgroup mapping (WGM) hint of a handle, which
+    controls the order in which the workgroups of a GEMM visit the tiles of C. Workgroups
+    running together then share more of the tiles of A and B they load, which can improve L2
+    and MALL hit rates on large GEMMs.
+
+    With the hint wgm > 0, the Tensile solution selected for a GEMM is replaced by one with the
+    same macro tile and a workgroup mapping of wgm, if the library has one which can solve the
+    problem; without Tensile, the source kernels compute C in strips of wgm tile rows.
+    Solutions from the tuning database or chosen with rocblas_gemm_algo_solution_index are not
+    changed. The hint applies to all GEMMs run with the handle, including rocblas_gemm_ext2.
+
+    With the hint 0, the default, a workgroup mapping recorded for the problem in the tuning
+    database is used instead. The hint of a handle is recorded with the tuned solutions while
+    recording is enabled with rocblas_set_tuning_db_record.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    wgm       [rocblas_int]
+              workgroup mapping; 0 selects the default.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_gemm_workgroup_mapping(rocblas_handle handle,
+                                                                 rocblas_int    wgm);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_gemm_workgroup_mapping returns the workgroup mapping hint of a handle.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    wgm       [rocblas_int*]
+              workgroup mapping; 0 if the default is used.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_gemm_workgroup_mapping(rocblas_handle handle,
+                                                                 rocblas_int*   wgm);
+
+/*! \brief Implementation of the GEMMs of a handle, set with rocblas_set_gemm_backend */
+typedef enum rocblas_gemm_backend_
+{
+    /*! the kernels for degenerate, tall and skinny and small batched shapes, then Tensile, or
+        the source kernels when rocBLAS is built without Tensile */
+    rocblas_gemm_backend_default = 0,
+    rocblas_gemm_backend_tensile = 1, /**< Tensile only */
+    rocblas_gemm_backend_source  = 2, /**< source kernels only */
+} rocblas_gemm_backend;
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_gemm_backend selects the implementation of the GEMMs of a handle, so that a
+    problem can be run through each of them with the same timing, e.g. with the --backend
+    option of rocblas-bench, and compared. rocblas_gemm_backend_tensile and
+    rocblas_gemm_backend_source skip the kernels for special shapes which the default selection
+    uses before Tensile. The backend applies to rocblas_Xgemm, rocblas_Xgemm_batched,
+    rocblas_Xgemm_strided_batched and the GEMMs of the Level 3 functions built on them.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    backend   [rocblas_gemm_backend]
+              implementation of the GEMMs. rocblas_gemm_backend_tensile returns
+              rocblas_status_not_implemented when rocBLAS is built without Tensile.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_gemm_backend(rocblas_handle       handle,
+                                                       rocblas_gemm_backend backend);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_gemm_backend returns the implementation of the GEMMs of a handle.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    backend   [rocblas_gemm_backend*]
+              implementation of the GEMMs.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_gemm_backend(rocblas_handle        handle,
+                                                       rocblas_gemm_backend* backend);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_device_memory_pool_attributes configures the memory pool from which a handle
+    makes stream-ordered device memory allocations. At least reserve_size bytes are allocated
+    from the device into the pool, and at synchronization points unused memory above
+    release_threshold bytes is released to the device. Returns rocblas_status_not_implemented
+    if the handle does not use stream-ordered allocation.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    reserve_size [size_t]
+              number of bytes to reserve in the pool.
+    @param[in]
+    release_threshold [uint64_t]
+              number of bytes the pool keeps allocated from the device.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_device_memory_pool_attributes(rocblas_handle handle,
+                                                                        size_t         reserve_size,
+                                                                        uint64_t release_threshold);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_device_memory_pool_attributes queries the memory pool from which a handle
+    makes stream-ordered device memory allocations. Returns rocblas_status_not_implemented
+    if the handle does not use stream-ordered allocation.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    reserved_size [size_t*]
+              number of bytes currently allocated from the device by the pool; may be nullptr.
+    @param[out]
+    used_size [size_t*]
+              number of bytes of the pool currently in use; may be nullptr.
+    @param[out]
+    release_threshold [uint64_t*]
+              release threshold of the pool in bytes; may be nullptr.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_device_memory_pool_attributes(rocblas_handle handle,
+                                                                        size_t*        reserved_size,
+                                                                        size_t*        used_size,
+                                                                        uint64_t* release_threshold);
+
+/*! \brief Device memory pool from which several rocblas_handle make their workspace allocations */
+typedef struct _rocblas_workspace_pool* rocblas_workspace_pool;
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_create_workspace_pool creates a workspace pool on the current device, which keeps
+    max_size bytes allocated from the device. The handles attached to the pool with
+    rocblas_set_workspace_pool make their stream-ordered workspace allocations from it, so that
+    handles running on different streams share the same memory: memory freed on one stream is
+    reused on another once the free has completed, or when the stream depends on it through an
+    event. The workspaces held at once by all attached handles are limited to max_size bytes; a
+    rocBLAS function whose workspace would exceed it returns rocblas_status_memory_error.
+    Returns rocblas_status_not_implemented if the device does not support memory pools.
+
+    @param[out]
+    pool      [rocblas_workspace_pool*]
+              pointer to where the created pool will be stored.
+    @param[in]
+    max_size  [size_t]
+              number of bytes of the pool.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_create_workspace_pool(rocblas_workspace_pool* pool,
+                                                            size_t                  max_size);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_destroy_workspace_pool releases a workspace pool created with
+    rocblas_create_workspace_pool. The pool is destroyed once no handle is attached to it.
+
+    @param[in]
+    pool      [rocblas_workspace_pool]
+              the pool to release.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_destroy_workspace_pool(rocblas_workspace_pool pool);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_workspace_pool attaches the handle to a workspace pool of the same device, from
+    which the workspaces of the rocBLAS functions called with the handle are allocated in stream
+    order instead of from the handle's own memory pool, which releases its memory to the device.
+    A nullptr pool detaches the handle. It must not be called while functions are running with
+    the handle on another thread.
+
+    Returns rocblas_status_not_implemented if the handle does not use stream-ordered allocation,
+    and rocblas_status_invalid_value if the pool is on another device or the handle's device
+    memory is set with rocblas_set_device_memory_size, rocblas_set_workspace or the
+    ROCBLAS_DEVICE_MEMORY_SIZE environment variable.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    pool      [rocblas_workspace_pool]
+              the pool to attach, or nullptr.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_workspace_pool(rocblas_handle         handle,
+                                                         rocblas_workspace_pool pool);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_handle_pool_acquire returns a handle of the current device bound to stream, from the
+    library's pool of idle handles of the device, or a newly created handle if there is none. A
+    handle of the pool keeps its workspace from one use to the next. If it was last used on
+    another stream, stream waits for the work enqueued with the handle before it was released,
+    without host synchronization. The handle must be returned with rocblas_handle_pool_release
+    instead of being destroyed with rocblas_destroy_handle.
+
+    @param[out]
+    handle    [rocblas_handle*]
+              pointer to where the acquired handle will be stored.
+    @param[in]
+    stream    [hipStream_t]
+              the stream of the functions called with the handle.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_handle_pool_acquire(rocblas_handle* handle,
+                                                          hipStream_t     stream);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_handle_pool_release returns a handle acquired with rocblas_handle_pool_acquire to the
+    pool. The pointer mode, atomics mode, performance metric, graph safe, reproducible,
+    compensated summation and deferred host results modes, int8 type, tuning database recording,
+    start and stop events and solution fitness query of the handle are restored to their values
+    when it was acquired. A workspace set with rocblas_set_workspace and a workspace pool set
+    with rocblas_set_workspace_pool are detached from the handle. The work enqueued with the
+    handle is not waited for. Returns rocblas_status_invalid_handle if the handle was not
+    acquired from the pool.
+
+    @param[in]
+    handle    [rocblas_handle]
+              the handle to release.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_handle_pool_release(rocblas_handle handle);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_handle_pool_reserve creates handles of the current device in the library's pool of
+    idle handles until it holds count of them, so that the next count calls to
+    rocblas_handle_pool_acquire on the device do not create handles.
+
+    @param[in]
+    count     [rocblas_int]
+              number of idle handles of the current device to keep in the pool.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_handle_pool_reserve(rocblas_int count);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_handle_pool_clear destroys the idle handles of all devices in the library's pool,
+    releasing their device memory. Acquired handles are not affected. The pool is also cleared
+    by rocblas_shutdown and at process exit.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_handle_pool_clear();
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_thread_handle returns the calling thread's handle for a handle shared by several
+    host threads, which is created on the first call of the thread. The thread handle starts
+    with the stream and the settings of the shared handle, and is attached to its workspace pool
+    set with rocblas_set_workspace_pool, so that the threads share the workspace memory. A
+    workspace pool is required for this sharing and should be set on the shared handle before
+    its thread handles are created: without one, each thread handle allocates and keeps its own
+    workspace, so the device memory held grows with the number of threads. The stream, pointer
+    mode and other settings of a thread handle belong to the thread, so that the threads can
+    call rocBLAS functions with their thread handles concurrently. Later changes to the shared
+    handle do not affect the thread handles already created.
+
+    Thread handles are destroyed with the shared handle by rocblas_destroy_handle, or when their
+    thread exits; they must not be destroyed with rocblas_destroy_handle, which returns
+    rocblas_status_invalid_handle for them. The later calls of a thread return its thread handle
+    without locking.
+
+    @param[in]
+    handle        [rocblas_handle]
+                  the shared handle.
+    @param[out]
+    thread_handle [rocblas_handle*]
+                  pointer to where the calling thread's handle will be stored.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_thread_handle(rocblas_handle  handle,
+                                                        rocblas_handle* thread_handle);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_<type>trsm_workspace_size returns the device memory size needed by rocblas_<type>trsm.
+
+    The size is the device memory the corresponding rocBLAS function requests for the given
+    arguments, the same value which would be returned by enclosing a call to that function in
+    rocblas_start_device_memory_size_query() and rocblas_stop_device_memory_size_query().
+    The sizes of several functions may be added to size a single workspace with
+    rocblas_set_device_memory_size() or rocblas_set_workspace(). These functions do not access
+    device memory and may be called while a device memory size query is in progress.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    side      [rocblas_side]
+              rocblas_side_left or rocblas_side_right.
+    @param[in]
+    uplo      [rocblas_fill]
+              rocblas_fill_upper or rocblas_fill_lower.
+    @param[in]
+    transA    [rocblas_operation]
+              transpose operation op(A).
+    @param[in]
+    diag      [rocblas_diagonal]
+              rocblas_diagonal_unit or rocblas_diagonal_non_unit.
+    @param[in]
+    m         [rocblas_int]
+              number of rows of B. m >= 0.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of B. n >= 0.
+    @param[in]
+    lda       [rocblas_int]
+              leading dimension of A.
+    @param[in]
+    ldb       [rocblas_int]
+              leading dimension of B.
+    @param[out]
+    size      [size_t*]
+              device memory size in bytes; 0 if no device memory is needed.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_strsm_workspace_size(rocblas_handle    handle,
+                                                           rocblas_side      side,
+                                                           rocblas_fill      uplo,
+                                                           rocblas_operation transA,
+                                                           rocblas_diagonal  diag,
+                                                           rocblas_int       m,
+                                                           rocblas_int       n,
+                                                           rocblas_int       lda,
+                                                           rocblas_int       ldb,
+                                                           size_t*           size);
+ROCBLAS_EXPORT rocblas_status rocblas_dtrsm_workspace_size(rocblas_handle    handle,
+                                                           rocblas_side      side,
+                                                           rocblas_fill      uplo,
+                                                           rocblas_operation transA,
+                                                           rocblas_diagonal  diag,
+                                                           rocblas_int       m,
+                                                           rocblas_int       n,
+                                                           rocblas_int       lda,
+                                                           rocblas_int       ldb,
+                                                           size_t*           size);
+ROCBLAS_EXPORT rocblas_status rocblas_ctrsm_workspace_size(rocblas_handle    handle,
+                                                           rocblas_side      side,
+                                                           rocblas_fill      uplo,
+                                                           rocblas_operation transA,
+                                                           rocblas_diagonal  diag,
+                                                           rocblas_int       m,
+                                                           rocblas_int       n,
+                                                           rocblas_int       lda,
+                                                           rocblas_int       ldb,
+                                                           size_t*           size);
+ROCBLAS_EXPORT rocblas_status rocblas_ztrsm_workspace_size(rocblas_handle    handle,
+                                                           rocblas_side      side,
+                                                           rocblas_fill      uplo,
+                                                           rocblas_operation transA,
+                                                           rocblas_diagonal  diag,
+                                                           rocblas_int       m,
+                                                           rocblas_int       n,
+                                                           rocblas_int       lda,
+                                                           rocblas_int       ldb,
+                                                           size_t*           size);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_<type>trtri_workspace_size returns the device memory size needed by rocblas_<type>trtri.
+
+    The size is the device memory the corresponding rocBLAS function requests for the given
+    arguments, the same value which would be returned by enclosing a call to that function in
+    rocblas_start_device_memory_size_query() and rocblas_stop_device_memory_size_query().
+    The sizes of several functions may be added to size a single workspace with
+    rocblas_set_device_memory_size() or rocblas_set_workspace(). These functions do not access
+    device memory and may be called while a device memory size query is in progress.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              rocblas_fill_upper or rocblas_fill_lower.
+    @param[in]
+    diag      [rocblas_diagonal]
+              rocblas_diagonal_unit or rocblas_diagonal_non_unit.
+    @param[in]
+    n         [rocblas_int]
+              size of matrix A. n >= 0.
+    @param[in]
+    lda       [rocblas_int]
+              leading dimension of A.
+    @param[in]
+    ldinvA    [rocblas_int]
+              leading dimension of invA.
+    @param[out]
+    size      [size_t*]
+              device memory size in bytes; 0 if no device memory is needed.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_strtri_workspace_size(rocblas_handle   handle,
+                                                            rocblas_fill     uplo,
+                                                            rocblas_diagonal diag,
+                                                            rocblas_int      n,
+                                                            rocblas_int      lda,
+                                                            rocblas_int      ldinvA,
+                                                            size_t*          size);
+ROCBLAS_EXPORT rocblas_status rocblas_dtrtri_workspace_size(rocblas_handle   handle,
+                                                            rocblas_fill     uplo,
+                                                            rocblas_diagonal diag,
+                                                            rocblas_int      n,
+                                                            rocblas_int      lda,
+                                                            rocblas_int      ldinvA,
+                                                            size_t*          size);
+ROCBLAS_EXPORT rocblas_status rocblas_ctrtri_workspace_size(rocblas_handle   handle,
+                                                            rocblas_fill     uplo,
+                                                            rocblas_diagonal diag,
+                                                            rocblas_int      n,
+                                                            rocblas_int      lda,
+                                                            rocblas_int      ldinvA,
+                                                            size_t*          size);
+ROCBLAS_EXPORT rocblas_status rocblas_ztrtri_workspace_size(rocblas_handle   handle,
+                                                            rocblas_fill     uplo,
+                                                            rocblas_diagonal diag,
+                                                            rocblas_int      n,
+                                                            rocblas_int      lda,
+                                                            rocblas_int      ldinvA,
+                                                            size_t*          size);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_<type>trsv_workspace_size returns the device memory size needed by rocblas_<type>trsv.
+
+    The size is the device memory the corresponding rocBLAS function requests for the given
+    arguments, the same value which would be returned by enclosing a call to that function in
+    rocblas_start_device_memory_size_query() and rocblas_stop_device_memory_size_query().
+    The sizes of several functions may be added to size a single workspace with
+    rocblas_set_device_memory_size() or rocblas_set_workspace(). These functions do not access
+    device memory and may be called while a device memory size query is in progress.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              rocblas_fill_upper or rocblas_fill_lower.
+    @param[in]
+    transA    [rocblas_operation]
+              transpose operation op(A).
+    @param[in]
+    diag      [rocblas_diagonal]
+              rocblas_diagonal_unit or rocblas_diagonal_non_unit.
+    @param[in]
+    m         [rocblas_int]
+              size of matrix A. m >= 0.
+    @param[in]
+    lda       [rocblas_int]
+              leading dimension of A.
+    @param[in]
+    incx      [rocblas_int]
+              stride between consecutive elements of x.
+    @param[out]
+    size      [size_t*]
+              device memory size in bytes; 0 if no device memory is needed.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_strsv_workspace_size(rocblas_handle    handle,
+                                                           rocblas_fill      uplo,
+                                                           rocblas_operation transA,
+                                                           rocblas_diagonal  diag,
+                                                           rocblas_int       m,
+                                                           rocblas_int       lda,
+                                                           rocblas_int       incx,
+                                                           size_t*           size);
+ROCBLAS_EXPORT rocblas_status rocblas_dtrsv_workspace_size(rocblas_handle    handle,
+                                                           rocblas_fill      uplo,
+                                                           rocblas_operation transA,
+                                                           rocblas_diagonal  diag,
+                                                           rocblas_int       m,
+                                                           rocblas_int       lda,
+                                                           rocblas_int       incx,
+                                                           size_t*           size);
+ROCBLAS_EXPORT rocblas_status rocblas_ctrsv_workspace_size(rocblas_handle    handle,
+                                                           rocblas_fill      uplo,
+                                                           rocblas_operation transA,
+                                                           rocblas_diagonal  diag,
+                                                           rocblas_int       m,
+                                                           rocblas_int       lda,
+                                                           rocblas_int       incx,
+                                                           size_t*           size);
+ROCBLAS_EXPORT rocblas_status rocblas_ztrsv_workspace_size(rocblas_handle    handle,
+                                                           rocblas_fill      uplo,
+                                                           rocblas_operation transA,
+                                                           rocblas_diagonal  diag,
+                                                           rocblas_int       m,
+                                                           rocblas_int       lda,
+                                                           rocblas_int       incx,
+                                                           size_t*           size);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_<type>asum_workspace_size returns the device memory size needed by rocblas_<type>asum.
+
+    The size is the device memory the corresponding rocBLAS function requests for the given
+    arguments, the same value which would be returned by enclosing a call to that function in
+    rocblas_start_device_memory_size_query() and rocblas_stop_device_memory_size_query().
+    The sizes of several functions may be added to size a single workspace with
+    rocblas_set_device_memory_size() or rocblas_set_workspace(). These functions do not access
+    device memory and may be called while a device memory size query is in progress.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              number of elements in x.
+    @param[in]
+    incx      [rocblas_int]
+              stride between consecutive elements of x.
+    @param[out]
+    size      [size_t*]
+              device memory size in bytes; 0 if no device memory is needed.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sasum_workspace_size(rocblas_handle handle,
+                                                           rocblas_int    n,
+                                                           rocblas_int    incx,
+                                                           size_t*        size);
+ROCBLAS_EXPORT rocblas_status rocblas_dasum_workspace_size(rocblas_handle handle,
+                                                           rocblas_int    n,
+                                                           rocblas_int    incx,
+                                                           size_t*        size);
+ROCBLAS_EXPORT rocblas_status rocblas_scasum_workspace_size(rocblas_handle handle,
+                                                            rocblas_int    n,
+                                                            rocblas_int    incx,
+                                                            size_t*        size);
+ROCBLAS_EXPORT rocblas_status rocblas_dzasum_workspace_size(rocblas_handle handle,
+                                                            rocblas_int    n,
+                                                            rocblas_int    incx,
+                                                            size_t*        size);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_<type>nrm2_workspace_size returns the device memory size needed by rocblas_<type>nrm2.
+
+    The size is the device memory the corresponding rocBLAS function requests for the given
+    arguments, the same value which would be returned by enclosing a call to that function in
+    rocblas_start_device_memory_size_query() and rocblas_stop_device_memory_size_query().
+    The sizes of several functions may be added to size a single workspace with
+    rocblas_set_device_memory_size() or rocblas_set_workspace(). These functions do not access
+    device memory and may be called while a device memory size query is in progress.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              number of elements in x.
+    @param[in]
+    incx      [rocblas_int]
+              stride between consecutive elements of x.
+    @param[out]
+    size      [size_t*]
+              device memory size in bytes; 0 if no device memory is needed.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_snrm2_workspace_size(rocblas_handle handle,
+                                                           rocblas_int    n,
+                                                           rocblas_int    incx,
+                                                           size_t*        size);
+ROCBLAS_EXPORT rocblas_status rocblas_dnrm2_workspace_size(rocblas_handle handle,
+                                                           rocblas_int    n,
+                                                           rocblas_int    incx,
+                                                           size_t*        size);
+ROCBLAS_EXPORT rocblas_status rocblas_scnrm2_workspace_size(rocblas_handle handle,
+                                                            rocblas_int    n,
+                                                            rocblas_int    incx,
+                                                            size_t*        size);
+ROCBLAS_EXPORT rocblas_status rocblas_dznrm2_workspace_size(rocblas_handle handle,
+                                                            rocblas_int    n,
+                                                            rocblas_int    incx,
+                                                            size_t*        size);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_<type>dot_workspace_size, rocblas_<type>dotu_workspace_size and
+    rocblas_<type>dotc_workspace_size return the device memory size needed by the corresponding
+    dot product functions.
+
+    The size is the device memory the corresponding rocBLAS function requests for the given
+    arguments, the same value which would be returned by enclosing a call to that function in
+    rocblas_start_device_memory_size_query() and rocblas_stop_device_memory_size_query().
+    The sizes of several functions may be added to size a single workspace with
+    rocblas_set_device_memory_size() or rocblas_set_workspace(). These functions do not access
+    device memory and may be called while a device memory size query is in progress.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              number of elements in x and y.
+    @param[in]
+    incx      [rocblas_int]
+              stride between consecutive elements of x.
+    @param[in]
+    incy      [rocblas_int]
+              stride between consecutive elements of y.
+    @param[out]
+    size      [size_t*]
+              device memory size in bytes; 0 if no device memory is needed.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sdot_workspace_size(rocblas_handle handle,
+                                                          rocblas_int    n,
+                                                          rocblas_int    incx,
+                                                          rocblas_int    incy,
+                                                          size_t*        size);
+ROCBLAS_EXPORT rocblas_status rocblas_ddot_workspace_size(rocblas_handle handle,
+                                                          rocblas_int    n,
+                                                          rocblas_int    incx,
+                                                          rocblas_int    incy,
+                                                          size_t*        size);
+ROCBLAS_EXPORT rocblas_status rocblas_hdot_workspace_size(rocblas_handle handle,
+                                                          rocblas_int    n,
+                                                          rocblas_int    incx,
+                                                          rocblas_int    incy,
+                                                          size_t*        size);
+ROCBLAS_EXPORT rocblas_status rocblas_bfdot_workspace_size(rocblas_handle handle,
+                                                           rocblas_int    n,
+                                                           rocblas_int    incx,
+                                                           rocblas_int    incy,
+                                                           size_t*        size);
+ROCBLAS_EXPORT rocblas_status rocblas_cdotu_workspace_size(rocblas_handle handle,
+                                                           rocblas_int    n,
+                                                           rocblas_int    incx,
+                                                           rocblas_int    incy,
+                                                           size_t*        size);
+ROCBLAS_EXPORT rocblas_status rocblas_zdotu_workspace_size(rocblas_handle handle,
+                                                           rocblas_int    n,
+                                                           rocblas_int    incx,
+                                                           rocblas_int    incy,
+                                                           size_t*        size);
+ROCBLAS_EXPORT rocblas_status rocblas_cdotc_workspace_size(rocblas_handle handle,
+                                                           rocblas_int    n,
+                                                           rocblas_int    incx,
+                                                           rocblas_int    incy,
+                                                           size_t*        size);
+ROCBLAS_EXPORT rocblas_status rocblas_zdotc_workspace_size(rocblas_handle handle,
+                                                           rocblas_int    n,
+                                                           rocblas_int    incx,
+                                                           rocblas_int    incy,
+                                                           size_t*        size);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_i<type>amax_workspace_size returns the device memory size needed by rocblas_i<type>amax.
+
+    The size is the device memory the corresponding rocBLAS function requests for the given
+    arguments, the same value which would be returned by enclosing a call to that function in
+    rocblas_start_device_memory_size_query() and rocblas_stop_device_memory_size_query().
+    The sizes of several functions may be added to size a single workspace with
+    rocblas_set_device_memory_size() or rocblas_set_workspace(). These functions do not access
+    device memory and may be called while a device memory size query is in progress.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              number of elements in x.
+    @param[in]
+    incx      [rocblas_int]
+              stride between consecutive elements of x.
+    @param[out]
+    size      [size_t*]
+              device memory size in bytes; 0 if no device memory is needed.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_isamax_workspace_size(rocblas_handle handle,
+                                                            rocblas_int    n,
+                                                            rocblas_int    incx,
+                                                            size_t*        size);
+ROCBLAS_EXPORT rocblas_status rocblas_idamax_workspace_size(rocblas_handle handle,
+                                                            rocblas_int    n,
+                                                            rocblas_int    incx,
+                                                            size_t*        size);
+ROCBLAS_EXPORT rocblas_status rocblas_icamax_workspace_size(rocblas_handle handle,
+                                                            rocblas_int    n,
+                                                            rocblas_int    incx,
+                                                            size_t*        size);
+ROCBLAS_EXPORT rocblas_status rocblas_izamax_workspace_size(rocblas_handle handle,
+                                                            rocblas_int    n,
+                                                            rocblas_int    incx,
+                                                            size_t*        size);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_ex_workspace_size returns the device memory size needed by rocblas_gemm_ex.
+    alpha and beta are assumed to be nonzero.
+
+    The size is the device memory the corresponding rocBLAS function requests for the given
+    arguments, the same value which would be returned by enclosing a call to that function in
+    rocblas_start_device_memory_size_query() and rocblas_stop_device_memory_size_query().
+    The sizes of several functions may be added to size a single workspace with
+    rocblas_set_device_memory_size() or rocblas_set_workspace(). These functions do not access
+    device memory and may be called while a device memory size query is in progress.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans_a   [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    trans_b   [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              matrix dimension m.
+    @param[in]
+    n         [rocblas_int]
+              matrix dimension n.
+    @param[in]
+    k         [rocblas_int]
+              matrix dimension k.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the datatype of matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B.
+    @param[in]
+    c_type    [rocblas_datatype]
+              specifies the datatype of matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C.
+    @param[in]
+    d_type    [rocblas_datatype]
+              specifies the datatype of matrix D.
+    @param[in]
+    ldd       [rocblas_int]
+              specifies the leading dimension of D.
+    @param[in]
+    compute_type [rocblas_datatype]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [rocblas_gemm_algo]
+              enumerant specifying the algorithm type.
+    @param[in]
+    solution_index [int32_t]
+              reserved.
+    @param[in]
+    flags     [uint32_t]
+              optional gemm flags.
+    @param[out]
+    size      [size_t*]
+              device memory size in bytes; 0 if no device memory is needed.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex_workspace_size(rocblas_handle    handle,
+                                                             rocblas_operation trans_a,
+                                                             rocblas_operation trans_b,
+                                                             rocblas_int       m,
+                                                             rocblas_int       n,
+                                                             rocblas_int       k,
+                                                             rocblas_datatype  a_type,
+                                                             rocblas_int       lda,
+                                                             rocblas_datatype  b_type,
+                                                             rocblas_int       ldb,
+                                                             rocblas_datatype  c_type,
+                                                             rocblas_int       ldc,
+                                                             rocblas_datatype  d_type,
+                                                             rocblas_int       ldd,
+                                                             rocblas_datatype  compute_type,
+                                                             rocblas_gemm_algo algo,
+                                                             int32_t           solution_index,
+                                                             uint32_t          flags,
+                                                             size_t*           size);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_deferred_host_results enables or disables deferred host results on a handle.
+    While enabled, reduction functions (asum, nrm2, dot, iamax, iamin and their batched and
+    strided batched variants) called in rocblas_pointer_mode_host return without waiting
+    for their results. The results are written to host memory once the work on the handle's
+    stream has completed, so they may only be read after synchronizing the stream, for example
+    with hipStreamSynchronize() or an event recorded after the call. The result memory must
+    remain valid until then. Results in pinned memory are copied directly, other results are
+    staged through pinned buffers owned by the handle. Disabled by default.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    deferred  [bool]
+              whether host results are deferred.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_deferred_host_results(rocblas_handle handle,
+                                                                bool           deferred);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_deferred_host_results returns whether deferred host results are enabled on a
+    handle.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    deferred  [bool*]
+              whether host results are deferred.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_deferred_host_results(rocblas_handle handle,
+                                                                bool*          deferred);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_graph_safe_mode enables or disables graph safe mode on a handle. In graph safe
+    mode, and whenever the handle's stream is being captured into a graph, rocBLAS functions do
+    not synchronize the host with the device, do not reallocate the handle's device memory, and
+    make only stream ordered copies, so that they can be captured into a graph with
+    hipStreamBeginCapture() and replayed with hipGraphLaunch(). A function which cannot run this
+    way returns rocblas_status_not_implemented instead of breaking the capture. Such functions
+    are:
+    - functions which read device pointer mode scalars on the host, such as gemm, the GEMM
+      based Level-3 functions, gemv with 64-bit sizes and trsm; use host pointer mode scalars
+    - results in host pointer mode which are not in pinned memory; results in pinned memory
+      are written once the stream reaches them, as with deferred host results
+    - numerical checking with rocblas_check_numerics_mode other than no_check
+    - functions whose device memory does not fit in the handle's device memory when the
+      memory is reallocated on demand; set a large enough size with
+      rocblas_set_device_memory_size() before capturing, use a stream order memory pool or
+      pass a workspace with rocblas_set_workspace() instead. These functions return
+      rocblas_status_memory_error.
+    Disabled by default.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    graph_safe [bool]
+              whether graph safe mode is enabled.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_graph_safe_mode(rocblas_handle handle, bool graph_safe);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_graph_safe_mode returns whether graph safe mode is enabled on a handle.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    graph_safe [bool*]
+              whether graph safe mode is enabled.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_graph_safe_mode(rocblas_handle handle, bool* graph_safe);
+
+/*! \brief Sequence of rocBLAS calls recorded into a HIP graph for replay */
+typedef struct _rocblas_recording* rocblas_recording;
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_begin_recording starts recording the rocBLAS calls made with the handle, which are
+    captured into a HIP graph instead of being run, until rocblas_end_recording. The calls
+    behave as in graph safe mode. If the handle is on the null stream, which cannot be
+    captured, a stream is created for the recording, and the handle is returned to the null
+    stream when recording ends.
+
+    The recorded calls take their workspace from workspace_size bytes of device memory
+    allocated here and owned by the recording, so that the graph makes no allocations and
+    every replay reuses the same workspace. The size needed can be found by running the calls
+    in a device memory size query (see rocblas_start_device_memory_size_query); a size of 0
+    selects the default size of the handle's workspace. Calls needing more workspace fail
+    with rocblas_status_memory_error.
+
+    Returns rocblas_status_invalid_value if the handle is already recording, its stream is
+    being captured, or its workspace is in use or being sized.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    workspace_size [size_t]
+              bytes of workspace of the recorded calls, or 0 for the default.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_begin_recording(rocblas_handle handle,
+                                                      size_t         workspace_size);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_end_recording ends the recording begun with rocblas_begin_recording and restores
+    the stream and workspace of the handle. If *recording is nullptr, a new recording is
+    returned in it, and must be released with rocblas_destroy_recording. Otherwise the calls
+    replace those of the existing *recording: when they are the same functions with the same
+    sizes, only their arguments, such as pointers and host scalars, are updated in place,
+    which is much cheaper than making a new recording; otherwise *recording is replaced.
+    Scalars passed in device memory with rocblas_pointer_mode_device are read at each replay,
+    so they can be changed between replays without recording again.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[inout]
+    recording [rocblas_recording*]
+              pointer to nullptr, or to a recording to update.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_end_recording(rocblas_handle     handle,
+                                                    rocblas_recording* recording);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_launch_recording replays a recording on a stream of the device it was recorded on.
+    Replays of the same recording must not run concurrently, as they share its workspace.
+
+    @param[in]
+    recording [rocblas_recording]
+              the recording to replay.
+    @param[in]
+    stream    [hipStream_t]
+              stream on which to replay the recording.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_launch_recording(rocblas_recording recording,
+                                                       hipStream_t       stream);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_destroy_recording releases a recording returned by rocblas_end_recording. Its
+    replays must have completed.
+
+    @param[in]
+    recording [rocblas_recording]
+              the recording to release; may be nullptr.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_destroy_recording(rocblas_recording recording);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_batched_stride_detection enables or disables the detection of evenly strided
+    pointer arrays by rocblas_Xgemm_batched and rocblas_gemm_batched_ex. While enabled, a
+    kernel checks whether the pointers of each array are an arithmetic progression, with a
+    stride of whole elements, and the host reads the result after synchronizing the stream.
+    When all arrays are, the strided batched implementation runs on the first pointer of each
+    array, which avoids loading a pointer in each workgroup and can select Tensile solutions
+    which only exist for strided batches. The check is made at each call, so the arrays may
+    change between calls; it pays off for batches of large enough matrices. It is skipped
+    in graph safe mode and for a single batch. Disabled by default.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    detect    [bool]
+              whether strided pointer arrays are detected.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_batched_stride_detection(rocblas_handle handle,
+                                                                   bool           detect);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_batched_stride_detection returns whether the batched gemm functions detect
+    evenly strided pointer arrays on a handle.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    detect    [bool*]
+              whether strided pointer arrays are detected.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_batched_stride_detection(rocblas_handle handle,
+                                                                   bool*          detect);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_reproducible_mode enables or disables reproducible mode on a handle. In
+    reproducible mode the reductions of dot, dotc, asum, nrm2 and gemv, including their batched,
+    strided batched and _ex variants, use pre-rounded summation, whose result is independent of
+    the order of the additions. Their results are then bitwise identical from run to run and
+    on all devices, whatever the number of compute units, the wavefront size or the atomics
+    mode. The terms are summed in double with about 3 * (53 - log2(n)) bits of accuracy below
+    the largest term, so the results are usually at least as accurate as the default ones, but
+    each vector, or each element of y for gemv, is reduced by a single workgroup which reads the
+    vector twice, so the functions are slower, in particular for a few long vectors.
+    Disabled by default.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    reproducible [bool]
+              whether reproducible mode is enabled.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_reproducible_mode(rocblas_handle handle,
+                                                            bool           reproducible);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_reproducible_mode returns whether reproducible mode is enabled on a handle.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    reproducible [bool*]
+              whether reproducible mode is enabled.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_reproducible_mode(rocblas_handle handle,
+                                                            bool*          reproducible);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_compensated_summation_mode enables or disables compensated summation on a handle.
+    In compensated summation mode dot, dotc, asum and nrm2, including their batched, strided
+    batched and _ex variants, keep the rounding errors of their additions, and of the real
+    products of dot, in a second accumulator of the execution type which is added to the sum at
+    the end. Their float results are then about as accurate as those of a summation in double,
+    without converting the vectors to double. The reductions of other execution types, such as
+    f16_r, use the default summation. The reductions read the vectors once as usual, but do
+    about four times as many floating point operations, and nrm2 does not use its single pass
+    kernel. Reproducible mode takes precedence when both are enabled. Disabled by default.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    compensated [bool]
+              whether compensated summation mode is enabled.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_compensated_summation_mode(rocblas_handle handle,
+                                                                     bool           compensated);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_compensated_summation_mode returns whether compensated summation mode is enabled
+    on a handle.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    compensated [bool*]
+              whether compensated summation mode is enabled.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_compensated_summation_mode(rocblas_handle handle,
+                                                                     bool*          compensated);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_stochastic_rounding_mode enables or disables stochastic rounding on a handle.
+    In stochastic rounding mode the bf16_r and f16_r results with f32_r execution type of
+    axpy_ex and scal_ex, including their batched and strided batched variants, and of gemm_ex
+    and gemm_strided_batched_ex, are rounded up or down with probabilities proportional to the
+    distance of the f32_r result to the two nearest values, instead of to nearest. Updates
+    smaller than half a unit in the last place are then kept on average, such as the small
+    weight updates of low precision training.
+
+    The random bits of each element come from a counter-based generator, so the same seed and
+    offset give the same results. The element i of batch b of axpy_ex and scal_ex uses the
+    counter offset + b * n + i, and the element (i, j) of batch b of gemm uses the counter
+    offset + (b * n + j) * m + i. The offset should be advanced past the elements of a call, or
+    the seed changed, before calls whose rounding must be independent.
+
+    gemm_ex computes the product in f32_r workspace of m * n * batch_count elements, widening C
+    into it if beta is not zero, before rounding it into D. Disabled by default.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    stochastic [bool]
+              whether stochastic rounding mode is enabled.
+    @param[in]
+    seed      [uint64_t]
+              seed of the random bits.
+    @param[in]
+    offset    [uint64_t]
+              counter of the first element of the next calls.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_stochastic_rounding_mode(rocblas_handle handle,
+                                                                   bool           stochastic,
+                                                                   uint64_t       seed,
+                                                                   uint64_t       offset);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_stochastic_rounding_mode returns whether stochastic rounding mode is enabled on a
+    handle, and its seed and offset.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    stochastic [bool*]
+              whether stochastic rounding mode is enabled.
+    @param[out]
+    seed      [uint64_t*]
+              seed of the random bits.
+    @param[out]
+    offset    [uint64_t*]
+              counter of the first element of the next calls.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_stochastic_rounding_mode(rocblas_handle handle,
+                                                                   bool*          stochastic,
+                                                                   uint64_t*      seed,
+                                                                   uint64_t*      offset);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_trsm_refinement enables or disables mixed precision trsm with iterative
+    refinement on a handle. While enabled, rocblas_trsm_ex with compute_type
+    rocblas_datatype_f64_r or rocblas_datatype_f64_c solves the system with a copy of A and B in
+    single precision, then refines the solution with up to max_steps corrections: each computes
+    the residual alpha * B - op(A) * X, or alpha * B - X * op(A), in double precision and solves
+    for the correction in single precision. The result is returned once the largest element of
+    the residual is at most sqrt(k) * eps times the product of the largest elements of A and X,
+    where k is the order of A and eps the double precision machine epsilon. If it does not
+    converge within max_steps corrections, if A or alpha * B do not fit in single precision, or if
+    the additional device memory is not available, B is solved in double precision as usual.
+
+    The refinement needs device memory for two double and one single precision copy of B, a
+    single precision copy of A and the single precision solve, which rocblas_trsm_ex device
+    memory size queries include while enabled. It reads its convergence on the host after each
+    residual, so it is not used in graph safe mode or while the stream is captured, nor when a
+    supplied invA is used. Disabled by default, with max_steps 0.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    max_steps [rocblas_int]
+              maximum number of refinement steps, 0 to disable the refinement.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_trsm_refinement(rocblas_handle handle,
+                                                          rocblas_int    max_steps);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_trsm_refinement returns the maximum number of refinement steps of mixed precision
+    trsm on a handle, 0 when it is disabled.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    max_steps [rocblas_int*]
+              maximum number of refinement steps.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_trsm_refinement(rocblas_handle handle,
+                                                          rocblas_int*   max_steps);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_managed_prefetch enables or disables the prefetching of managed memory operands
+    on a handle. While enabled, rocblas_Xgemm, rocblas_Xgemm_strided_batched, rocblas_gemm_ex
+    and rocblas_gemm_strided_batched_ex check whether each of their matrices is managed memory,
+    allocated by hipMallocManaged or with HMM, and if so advise that the device of the handle
+    accesses it and prefetch it to the device with hipMemPrefetchAsync on the handle stream,
+    before the kernels. The kernels then run on resident pages instead of faulting them in on
+    first touch. Ranges below 64 KiB, device memory, host memory and calls made while the
+    stream is captured are left as they are. The advice persists after the call, as advice
+    does. Disabled by default.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    prefetch  [bool]
+              whether managed memory operands are prefetched.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_managed_prefetch(rocblas_handle handle, bool prefetch);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_managed_prefetch returns whether managed memory operands are prefetched on a
+    handle.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    prefetch  [bool*]
+              whether managed memory operands are prefetched.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_managed_prefetch(rocblas_handle handle, bool* prefetch);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_add_persisting_range marks the device memory range [ptr, ptr + size) as reused
+    across calls on a handle, such as the weight matrix of a sequence of gemv calls, so that it
+    can stay in the L2 cache and the MI300 Infinity Cache (MALL). While any range is marked,
+    the general kernels of rocblas_Xgemv and rocblas_Xgemv_strided_batched read a matrix A which
+    does not overlap any of them with nontemporal loads, so that streaming it through the caches
+    does not evict the persisting data, and read an A within a marked range with ordinary cached
+    loads. x and y are always read with cached loads. HIP has no stream access policy for these
+    caches on AMD devices, so the hint only changes the loads of the rocBLAS source kernels; the
+    Tensile kernels of the level 3 functions, and the batched functions whose matrices are given
+    by pointer arrays, are not affected. The ranges are kept until
+    rocblas_clear_persisting_ranges; a size of 0 adds no range.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    ptr       [const void*]
+              device pointer to the start of the range.
+    @param[in]
+    size      [size_t]
+              size of the range in bytes.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_add_persisting_range(rocblas_handle handle,
+                                                           const void*    ptr,
+                                                           size_t         size);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_clear_persisting_ranges removes the ranges marked by rocblas_add_persisting_range on
+    a handle, after which all operands are read with cached loads again.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_clear_persisting_ranges(rocblas_handle handle);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_batched_scalar_stride sets the strides between the alpha, and between the beta,
+    of consecutive batches, so that each batch of a batched call is computed with its own scalars.
+    With a nonzero stride, batch i of rocblas_Xaxpy_batched, rocblas_Xaxpy_strided_batched,
+    rocblas_Xscal_batched, rocblas_Xscal_strided_batched, rocblas_Xgemv_batched and
+    rocblas_Xgemv_strided_batched uses alpha[i * alpha_stride] and beta[i * beta_stride], in a
+    single launch. The strides only apply in rocblas_pointer_mode_device, the scalars of all the
+    batches being in one device array; in rocblas_pointer_mode_host and in the other functions
+    all the batches use alpha[0] and beta[0]. Both strides are 0 by default.
+
+    @param[in]
+    handle        [rocblas_handle]
+                  handle to the rocblas library context queue.
+    @param[in]
+    alpha_stride  [rocblas_stride]
+                  number of elements between the alpha of consecutive batches.
+    @param[in]
+    beta_stride   [rocblas_stride]
+                  number of elements between the beta of consecutive batches.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_batched_scalar_stride(rocblas_handle handle,
+                                                                rocblas_stride alpha_stride,
+                                                                rocblas_stride beta_stride);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_batched_scalar_stride returns the strides between the alpha, and between the
+    beta, of consecutive batches set on a handle.
+
+    @param[in]
+    handle        [rocblas_handle]
+                  handle to the rocblas library context queue.
+    @param[out]
+    alpha_stride  [rocblas_stride*]
+                  number of elements between the alpha of consecutive batches.
+    @param[out]
+    beta_stride   [rocblas_stride*]
+                  number of elements between the beta of consecutive batches.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_batched_scalar_stride(rocblas_handle  handle,
+                                                                rocblas_stride* alpha_stride,
+                                                                rocblas_stride* beta_stride);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_async_status_mode enables or disables the asynchronous error status of a handle.
+    Numerical checks of device data can only return their failure by waiting for the stream. In
+    async status mode, each check made with rocblas_check_numerics_mode_deferred and
+    rocblas_check_numerics_mode_fail is followed on the handle stream by a kernel which records
+    rocblas_status_check_numerics_fail in the status of the handle if the check found a NaN, Inf
+    or denormal value. The status is in pinned host memory, and is read with
+    rocblas_get_async_status after a synchronization point chosen by the user, such as
+    hipStreamSynchronize or hipEventSynchronize, without any further copy or wait. The deferred
+    checks are still reported by rocblas_report_check_numerics. Disabled by default; enabling
+    it the first time allocates the status.
+
+    @param[in]
+    handle        [rocblas_handle]
+                  handle to the rocblas library context queue.
+    @param[in]
+    async_status  [bool]
+                  whether the asynchronous error status is recorded.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_async_status_mode(rocblas_handle handle,
+                                                            bool           async_status);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_async_status_mode returns whether the asynchronous error status of a handle is
+    recorded.
+
+    @param[in]
+    handle        [rocblas_handle]
+                  handle to the rocblas library context queue.
+    @param[out]
+    async_status  [bool*]
+                  whether the asynchronous error status is recorded.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_async_status_mode(rocblas_handle handle,
+                                                            bool*          async_status);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_async_status returns the first error recorded asynchronously on a handle since
+    the last call, and clears it. It returns rocblas_status_success if no error was recorded, or
+    if async status mode was never enabled. It does not wait for the stream: errors recorded by
+    work which has not completed yet are returned by a later call.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_async_status(rocblas_handle handle);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_grouped_ex performs a group of matrix-matrix operations, where each group g_i
+    can have a different size and leading dimensions:
+
+        D_i = alpha*op( A_i )*op( B_i ) + beta*C_i, for i = 1, ..., group_count.
+
+    op( X ) is one of op( X ) = X, op( X ) = X**T or op( X ) = X**H. alpha and beta are scalars
+    shared by all groups. op( A_i ) is an m_i by k_i matrix, op( B_i ) is a k_i by n_i matrix,
+    and C_i and D_i are m_i by n_i matrices.
+
+    The sizes, leading dimensions and matrix pointers of the groups are given in device arrays of
+    group_count elements, so that they can be produced on the device, for example by the router
+    of a mixture-of-experts layer. Sizes and leading dimensions are validated as in
+    rocblas_gemm_batched_ex, and a, b, c and d must not be nullptr.
+
+    When rocBLAS is built with Tensile, the sizes are copied to the host, which synchronizes the
+    handle's stream, and all the groups with equal sizes and leading dimensions are computed by
+    a single batched Tensile kernel, in the order of their first group. If this reorders the
+    groups, their matrix pointers are gathered into the handle's device memory, so no D_i may
+    overlap another group's A_j, B_j, C_j or D_j. All types supported by
+    rocblas_gemm_batched_ex are supported.
+
+    When rocBLAS is built without Tensile, or when the handle's stream is being captured into a
+    graph, all groups are computed by a single kernel launch that reads the sizes on the device,
+    without synchronization. In that case a_type, b_type, c_type, d_type and compute_type must be
+    equal and one of rocblas_datatype_f32_r, rocblas_datatype_f64_r, rocblas_datatype_f32_c or
+    rocblas_datatype_f64_c, otherwise rocblas_status_not_implemented is returned, and groups with
+    invalid sizes are skipped rather than reported.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans_a   [rocblas_operation]
+              specifies the form of op( A_i ).
+    @param[in]
+    trans_b   [rocblas_operation]
+              specifies the form of op( B_i ).
+    @param[in]
+    m         [const rocblas_int*]
+              device array of group_count elements; m_i is the number of rows of op( A_i ), C_i
+              and D_i.
+    @param[in]
+    n         [const rocblas_int*]
+              device array of group_count elements; n_i is the number of columns of op( B_i ),
+              C_i and D_i.
+    @param[in]
+    k         [const rocblas_int*]
+              device array of group_count elements; k_i is the number of columns of op( A_i )
+              and rows of op( B_i ).
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as compute_type.
+    @param[in]
+    a         [void * const []]
+              device array of device pointers storing each matrix A_i.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of each matrix A_i.
+    @param[in]
+    lda       [const rocblas_int*]
+              device array of the leading dimensions of each A_i.
+    @param[in]
+    b         [void * const []]
+              device array of device pointers storing each matrix B_i.
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldb       [const rocblas_int*]
+              device array of the leading dimensions of each B_i.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as compute_type.
+    @param[in]
+    c         [void * const []]
+              device array of device pointers storing each matrix C_i.
+    @param[in]
+    c_type    [rocblas_datatype]
+              specifies the datatype of each matrix C_i.
+    @param[in]
+    ldc       [const rocblas_int*]
+              device array of the leading dimensions of each C_i.
+    @param[out]
+    d         [void * const []]
+              device array of device pointers storing each matrix D_i.
+              If d and c are the same array then d_type must equal c_type and ldd must equal ldc.
+    @param[in]
+    d_type    [rocblas_datatype]
+              specifies the datatype of each matrix D_i.
+    @param[in]
+    ldd       [const rocblas_int*]
+              device array of the leading dimensions of each D_i.
+    @param[in]
+    group_count
+              [rocblas_int]
+              number of groups.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [rocblas_gemm_algo]
+              enumerant specifying the algorithm type.
+    @param[in]
+    solution_index
+              [int32_t]
+              if algo is rocblas_gemm_algo_solution_index, this controls which solution is used
+              by the Tensile kernels.
+    @param[in]
+    flags     [uint32_t]
+              optional gemm flags.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_grouped_ex(rocblas_handle     handle,
+                                                      rocblas_operation  trans_a,
+                                                      rocblas_operation  trans_b,
+                                                      const rocblas_int* m,
+                                                      const rocblas_int* n,
+                                                      const rocblas_int* k,
+                                                      const void*        alpha,
+                                                      const void* const  a[],
+                                                      rocblas_datatype   a_type,
+                                                      const rocblas_int* lda,
+                                                      const void* const  b[],
+                                                      rocblas_datatype   b_type,
+                                                      const rocblas_int* ldb,
+                                                      const void*        beta,
+                                                      const void* const  c[],
+                                                      rocblas_datatype   c_type,
+                                                      const rocblas_int* ldc,
+                                                      void* const        d[],
+                                                      rocblas_datatype   d_type,
+                                                      const rocblas_int* ldd,
+                                                      rocblas_int        group_count,
+                                                      rocblas_datatype   compute_type,
+                                                      rocblas_gemm_algo  algo,
+                                                      int32_t            solution_index,
+                                                      uint32_t           flags);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_grouped_trans_ex is rocblas_gemm_grouped_ex with the operations op( A_i ) and
+    op( B_i ) given per group in device arrays, for groups mixing transposed and non-transposed
+    problems:
+
+        D_i = alpha*op_a_i( A_i )*op_b_i( B_i ) + beta*C_i, for i = 1, ..., group_count.
+
+    When rocBLAS is built with Tensile, the operations are copied to the host with the sizes, and
+    all the groups with equal operations, sizes and leading dimensions are computed by a single
+    batched Tensile kernel, as in rocblas_gemm_grouped_ex. Invalid operations are reported as
+    rocblas_status_invalid_value before any group is computed.
+
+    Otherwise one kernel is launched for each combination of operations, each computing the groups
+    of its combination, without synchronization, and groups with invalid operations are skipped.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans_a   [const rocblas_operation*]
+              device array of group_count elements specifying the form of each op( A_i ).
+    @param[in]
+    trans_b   [const rocblas_operation*]
+              device array of group_count elements specifying the form of each op( B_i ).
+
+    The other parameters are those of rocblas_gemm_grouped_ex.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_grouped_trans_ex(rocblas_handle           handle,
+                                                            const rocblas_operation* trans_a,
+                                                            const rocblas_operation* trans_b,
+                                                            const rocblas_int*       m,
+                                                            const rocblas_int*       n,
+                                                            const rocblas_int*       k,
+                                                            const void*              alpha,
+                                                            const void* const        a[],
+                                                            rocblas_datatype         a_type,
+                                                            const rocblas_int*       lda,
+                                                            const void* const        b[],
+                                                            rocblas_datatype         b_type,
+                                                            const rocblas_int*       ldb,
+                                                            const void*              beta,
+                                                            const void* const        c[],
+                                                            rocblas_datatype         c_type,
+                                                            const rocblas_int*       ldc,
+                                                            void* const              d[],
+                                                            rocblas_datatype         d_type,
+                                                            const rocblas_int*       ldd,
+                                                            rocblas_int              group_count,
+                                                            rocblas_datatype         compute_type,
+                                                            rocblas_gemm_algo        algo,
+                                                            int32_t                  solution_index,
+                                                            uint32_t                 flags);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_contract_ex performs a general tensor contraction:
+
+        D[i, j, l] = alpha*sum_k( A[i, k, l]*B[j, k, l] ) + beta*C[i, j, l],
+
+    where i is a multi-index of num_free_a free indices of A, j of num_free_b free indices of B,
+    k of num_bound bound (summed) indices and l of num_batch batch indices. Each tensor is
+    described by the strides, in elements, of its indices, so that no transposition is needed to
+    bring a contraction to the shape of a GEMM.
+
+    The indices of each kind are sorted by their strides, and consecutive indices which continue
+    each other in all the tensors, as in packed tensors, are folded into one. The first free,
+    bound and batch indices are then computed as a strided batched GEMM through Tensile, with the
+    transpositions given by the tensors with a unit stride along them. The remaining indices, if
+    any, are looped over on the host, one GEMM per iteration, the remaining bound indices
+    accumulating into D. Strides of 0 broadcast a tensor along an index. D must not overlap A, B,
+    or C other than C equal to D with the same strides.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    num_free_a
+              [rocblas_int]
+              number of free indices of A, which are also indices of C and D.
+    @param[in]
+    num_free_b
+              [rocblas_int]
+              number of free indices of B, which are also indices of C and D.
+    @param[in]
+    num_bound [rocblas_int]
+              number of bound indices, summed over, of A and B.
+    @param[in]
+    num_batch [rocblas_int]
+              number of batch indices, of all the tensors.
+    @param[in]
+    sizes     [const int64_t*]
+              host array of the sizes of the free indices of A, then the free indices of B, the
+              bound indices and the batch indices.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as compute_type.
+    @param[in]
+    a         [void *]
+              device pointer storing tensor A.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of tensor A.
+    @param[in]
+    strides_a [const rocblas_stride*]
+              host array of the strides of A along its free, bound and batch indices, in the
+              order of sizes.
+    @param[in]
+    b         [void *]
+              device pointer storing tensor B.
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the datatype of tensor B.
+    @param[in]
+    strides_b [const rocblas_stride*]
+              host array of the strides of B along its free, bound and batch indices, in the
+              order of sizes.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as compute_type.
+    @param[in]
+    c         [void *]
+              device pointer storing tensor C. It may be nullptr if beta is zero.
+    @param[in]
+    c_type    [rocblas_datatype]
+              specifies the datatype of tensor C.
+    @param[in]
+    strides_c [const rocblas_stride*]
+              host array of the strides of C along the free indices of A, the free indices of B
+              and the batch indices, in the order of sizes.
+    @param[out]
+    d         [void *]
+              device pointer storing tensor D.
+    @param[in]
+    d_type    [rocblas_datatype]
+              specifies the datatype of tensor D.
+    @param[in]
+    strides_d [const rocblas_stride*]
+              host array of the strides of D, in the order of strides_c.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [rocblas_gemm_algo]
+              enumerant specifying the algorithm type.
+    @param[in]
+    solution_index
+              [int32_t]
+              if algo is rocblas_gemm_algo_solution_index, this controls which solution is used
+              by the Tensile kernels.
+    @param[in]
+    flags     [uint32_t]
+              optional gemm flags.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_contract_ex(rocblas_handle        handle,
+                                                  rocblas_int           num_free_a,
+                                                  rocblas_int           num_free_b,
+                                                  rocblas_int           num_bound,
+                                                  rocblas_int           num_batch,
+                                                  const int64_t*        sizes,
+                                                  const void*           alpha,
+                                                  const void*           a,
+                                                  rocblas_datatype      a_type,
+                                                  const rocblas_stride* strides_a,
+                                                  const void*           b,
+                                                  rocblas_datatype      b_type,
+                                                  const rocblas_stride* strides_b,
+                                                  const void*           beta,
+                                                  const void*           c,
+                                                  rocblas_datatype      c_type,
+                                                  const rocblas_stride* strides_c,
+                                                  void*                 d,
+                                                  rocblas_datatype      d_type,
+                                                  const rocblas_stride* strides_d,
+                                                  rocblas_datatype      compute_type,
+                                                  rocblas_gemm_algo     algo,
+                                                  int32_t               solution_index,
+                                                  uint32_t              flags);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_block_sparse_ex multiplies a block sparse matrix A by a dense matrix:
+
+        D = alpha*A*op( B ) + beta*C,
+
+    where A is an mb*block_dim by kb*block_dim matrix in block compressed sparse row (BSR)
+    format, with nnzb nonzero blocks of block_dim x block_dim elements, and op( B ),
+    C and D are dense matrices of kb*block_dim by n, mb*block_dim by n and mb*block_dim by n
+    elements. A block diagonal matrix is a block sparse matrix with one block per block row.
+
+    Only the products of the nonzero blocks are computed, each as one block_dim x n x block_dim
+    gemm. Step s of the sum is a single batched gemm of the s-th block of every block row with
+    more than s blocks, so that the blocks of a block row accumulate into D one after the other
+    and the blocks of different block rows are computed together. The number of steps is the
+    largest number of blocks in a block row. Block rows without blocks are scaled by beta.
+
+    The block row pointers and block column indices are read back to the host to form the
+    batches, which synchronizes the stream, so rocblas_status_not_implemented is returned in
+    graph safe mode. The batched gemms take their pointer arrays, 4*(nnzb + mb) pointers, from
+    device memory workspace.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans_b   [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    mb        [rocblas_int]
+              number of block rows of A, C and D.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of op( B ), C and D.
+    @param[in]
+    kb        [rocblas_int]
+              number of block columns of A, and block rows of op( B ).
+    @param[in]
+    nnzb      [rocblas_int]
+              number of nonzero blocks of A.
+    @param[in]
+    block_dim [rocblas_int]
+              number of rows and columns of a block.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as compute_type.
+    @param[in]
+    bsr_row_ptr
+              [const rocblas_int*]
+              device array of mb + 1 elements, the zero based index in bsr_col_ind of the first
+              block of each block row, and nnzb.
+    @param[in]
+    bsr_col_ind
+              [const rocblas_int*]
+              device array of the nnzb block column indices, zero based, of the blocks.
+    @param[in]
+    bsr_val   [void *]
+              device pointer storing the nnzb blocks of A, each in column major order with
+              block_dim*block_dim elements.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of matrix A.
+    @param[in]
+    b         [void *]
+              device pointer storing matrix B.
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the datatype of matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as compute_type.
+    @param[in]
+    c         [void *]
+              device pointer storing matrix C. It may be nullptr if beta is zero.
+    @param[in]
+    c_type    [rocblas_datatype]
+              specifies the datatype of matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C.
+    @param[out]
+    d         [void *]
+              device pointer storing matrix D. It may be c, with ldd equal to ldc.
+    @param[in]
+    d_type    [rocblas_datatype]
+              specifies the datatype of matrix D.
+    @param[in]
+    ldd       [rocblas_int]
+              specifies the leading dimension of D.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [rocblas_gemm_algo]
+              enumerant specifying the algorithm type.
+    @param[in]
+    solution_index
+              [int32_t]
+              if algo is rocblas_gemm_algo_solution_index, this controls which solution is used
+              by the Tensile kernels.
+    @param[in]
+    flags     [uint32_t]
+              optional gemm flags.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_block_sparse_ex(rocblas_handle     handle,
+                                                           rocblas_operation  trans_b,
+                                                           rocblas_int        mb,
+                                                           rocblas_int        n,
+                                                           rocblas_int        kb,
+                                                           rocblas_int        nnzb,
+                                                           rocblas_int        block_dim,
+                                                           const void*        alpha,
+                                                           const rocblas_int* bsr_row_ptr,
+                                                           const rocblas_int* bsr_col_ind,
+                                                           const void*        bsr_val,
+                                                           rocblas_datatype   a_type,
+                                                           const void*        b,
+                                                           rocblas_datatype   b_type,
+                                                           rocblas_int        ldb,
+                                                           const void*        beta,
+                                                           const void*        c,
+                                                           rocblas_datatype   c_type,
+                                                           rocblas_int        ldc,
+                                                           void*              d,
+                                                           rocblas_datatype   d_type,
+                                                           rocblas_int        ldd,
+                                                           rocblas_datatype   compute_type,
+                                                           rocblas_gemm_algo  algo,
+                                                           int32_t            solution_index,
+                                                           uint32_t           flags);
+
+/*! \brief Elementwise activation applied by a rocblas_gemm_epilogue */
+typedef enum rocblas_gemm_activation_
+{
+    rocblas_gemm_activation_none = 0, /**< identity */
+    rocblas_gemm_activation_relu = 1, /**< max(x, 0) */
+    rocblas_gemm_activation_gelu = 2, /**< tanh approximation of the Gaussian error linear unit */
+} rocblas_gemm_activation;
+
+/*! \brief Operations applied by rocblas_gemm_ex3 to the result of the matrix product */
+typedef struct rocblas_gemm_epilogue_
+{
+    const void*             bias; /**< device vector of m d_type values added to each column */
+    rocblas_gemm_activation activation; /**< activation applied after the bias */
+    const void*             scale; /**< compute_type scalar multiplying the result */
+    void*                   aux; /**< device d_type matrix receiving the pre-activation result */
+    rocblas_int             ldaux; /**< leading dimension of aux */
+    const void*             scale_a; /**< f32_r scalar multiplying A, e.g. to dequantize FP8 */
+    const void*             scale_b; /**< f32_r scalar multiplying B, e.g. to dequantize FP8 */
+    void*                   amax; /**< device f32_r scalar receiving max |activation( t )| */
+    const float*            quant_scale; /**< device f32_r scales requantizing an i8_r D */
+    rocblas_int             quant_scale_count; /**< 1 per tensor, or m for one per row */
+    int32_t                 quant_zero_point; /**< zero point added to the requantized D */
+    const void*             row_scale; /**< device vector of m compute_type row scales */
+    const void*             col_scale; /**< device vector of n compute_type column scales */
+} rocblas_gemm_epilogue;
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_ex3 performs rocblas_gemm_ex followed by an epilogue applied in a single pass
+    over the result, so that bias, activation and scaling do not each re-read and re-write D
+
+        t = alpha*scale_a*scale_b*diag( row_scale )*op( A )*op( B )*diag( col_scale ) + beta*C + bias
+        D = scale*activation( t )
+
+    where bias is broadcast along the columns. bias, scale, aux, scale_a, scale_b, amax, row_scale
+    and col_scale may be nullptr, in which case no bias is added, the scales are 1, and no
+    auxiliary output or amax is written. A residual add is expressed through beta and C.
+    The row and column scales, e.g. per channel and per token dequantization scales, scale the
+    product only, in place of rocblas_dgmm passes over D. With them and a nonzero beta the gemm
+    runs with beta 0 and beta*C is added in the epilogue; when c is d the product is then kept in
+    m*n d_type elements of device memory workspace.
+    If epilogue->aux is not nullptr, t is also written to aux, e.g. for the backward pass of the
+    activation. If epilogue->amax is not nullptr, the largest magnitude of activation( t ) is
+    written to it, as needed by the delayed scaling recipe for FP8 training.
+    Arguments other than epilogue are the same as in rocblas_gemm_ex.
+
+    The epilogue is supported for real d_type rocblas_datatype_f16_r, rocblas_datatype_bf16_r,
+    rocblas_datatype_f32_r and rocblas_datatype_f64_r; other types return
+    rocblas_status_not_implemented unless the epilogue is empty. The bias and aux vectors have
+    d_type. scale has compute_type and, like alpha and beta, is in host or device memory
+    according to the pointer mode. scale_a, scale_b and amax require compute_type
+    rocblas_datatype_f32_r; scale_a and scale_b are in host or device memory according to the
+    pointer mode, and amax is always in device memory.
+
+    a_type and b_type may be rocblas_datatype_f8_r or rocblas_datatype_bf8_r, in any combination,
+    with compute_type rocblas_datatype_f32_r and c_type equal to d_type, one of
+    rocblas_datatype_f16_r, rocblas_datatype_bf16_r or rocblas_datatype_f32_r. The FP8 operands
+    are widened exactly to 16 bits in device memory workspace and multiplied with the
+    corresponding mixed precision gemm, so their throughput is that of 16-bit inputs.
+    rocblas_gemm_ex accepts the same FP8 types and forwards them to rocblas_gemm_ex3 with no
+    epilogue.
+
+    d_type may be rocblas_datatype_i8_r with a_type and b_type rocblas_datatype_i8_r and c_type
+    and compute_type rocblas_datatype_i32_r, for quantized inference. The i32_r result t is kept
+    in device memory workspace and requantized in the same pass as the bias and activation
+
+        D = clamp( rint( quant_scale*activation( t ) ) + quant_zero_point, -128, 127 )
+
+    where quant_scale is epilogue->quant_scale[0], or epilogue->quant_scale[i] for row i when
+    epilogue->quant_scale_count is m (per output channel scales), and 1 for a nullptr. The bias
+    then has i32_r, quant_scale is always in device memory, and scale, aux, scale_a, scale_b,
+    amax, row_scale and col_scale must be nullptr. c may be nullptr when beta is 0. The workspace flags
+    rocblas_gemm_flags_split_k, rocblas_gemm_flags_complex_3m and
+    rocblas_gemm_flags_fp64_emulation are ignored.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans_a   [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    trans_b   [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              matrix dimension m.
+    @param[in]
+    n         [rocblas_int]
+              matrix dimension n.
+    @param[in]
+    k         [rocblas_int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as compute_type.
+    @param[in]
+    a         [void *]
+              device pointer storing matrix A.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    b         [void *]
+              device pointer storing matrix B.
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the datatype of matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as compute_type.
+    @param[in]
+    c         [void *]
+              device pointer storing matrix C.
+    @param[in]
+    c_type    [rocblas_datatype]
+              specifies the datatype of matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C.
+    @param[out]
+    d         [void *]
+              device pointer storing matrix D.
+    @param[in]
+    d_type    [rocblas_datatype]
+              specifies the datatype of matrix D.
+    @param[in]
+    ldd       [rocblas_int]
+              specifies the leading dimension of D.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [rocblas_gemm_algo]
+              enumerant specifying the algorithm type.
+    @param[in]
+    solution_index
+              [int32_t]
+              reserved for future use.
+    @param[in]
+    flags     [uint32_t]
+              optional gemm flags.
+    @param[in]
+    epilogue  [const rocblas_gemm_epilogue *]
+              host pointer to the epilogue descriptor, or nullptr for no epilogue.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex3(rocblas_handle               handle,
+                                               rocblas_operation            trans_a,
+                                               rocblas_operation            trans_b,
+                                               rocblas_int                  m,
+                                               rocblas_int                  n,
+                                               rocblas_int                  k,
+                                               const void*                  alpha,
+                                               const void*                  a,
+                                               rocblas_datatype             a_type,
+                                               rocblas_int                  lda,
+                                               const void*                  b,
+                                               rocblas_datatype             b_type,
+                                               rocblas_int                  ldb,
+                                               const void*                  beta,
+                                               const void*                  c,
+                                               rocblas_datatype             c_type,
+                                               rocblas_int                  ldc,
+                                               void*                        d,
+                                               rocblas_datatype             d_type,
+                                               rocblas_int                  ldd,
+                                               rocblas_datatype             compute_type,
+                                               rocblas_gemm_algo            algo,
+                                               int32_t                      solution_index,
+                                               uint32_t                     flags,
+                                               const rocblas_gemm_epilogue* epilogue);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_chain_ex computes two chained matrix products with an elementwise operation
+    between them
+
+        T = activation( alpha*op( A )*op( B ) + bias )
+        E = T*op( D ) + beta*E
+
+    where op( A ) is m by k, op( B ) is k by n, op( D ) is n by l, T is m by n and E is m by l,
+    and bias, which may be nullptr, is a vector of m values broadcast along the columns of T, as
+    in rocblas_gemm_ex3. This is the pattern of two consecutive layers of a multilayer perceptron
+    or of the score and value products of attention.
+
+    When n is at most 64 the products are computed by a single kernel which keeps each tile of
+    rows of T on chip, so that T is never written to or read from device memory. For larger n,
+    T is held in device memory workspace between a rocblas_gemm_ex3 with the bias and activation
+    as its epilogue and a rocblas_gemm_ex.
+
+    A, B, D, E and bias have the same datatype, one of rocblas_datatype_f16_r,
+    rocblas_datatype_bf16_r or rocblas_datatype_f32_r with compute_type rocblas_datatype_f32_r,
+    or rocblas_datatype_f64_r with compute_type rocblas_datatype_f64_r. alpha and beta have
+    compute_type.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans_a   [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    trans_b   [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    trans_d   [rocblas_operation]
+              specifies the form of op( D ).
+    @param[in]
+    m         [rocblas_int]
+              number of rows of T and E.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of T, the inner dimension of the second product.
+    @param[in]
+    k         [rocblas_int]
+              inner dimension of the first product.
+    @param[in]
+    l         [rocblas_int]
+              number of columns of E.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    a         [void *]
+              device pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    b         [void *]
+              device pointer storing matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B.
+    @param[in]
+    bias      [void *]
+              device pointer storing the vector of m bias values, or nullptr for no bias.
+    @param[in]
+    activation
+              [rocblas_gemm_activation]
+              activation applied to the first product plus bias.
+    @param[in]
+    d         [void *]
+              device pointer storing matrix D.
+    @param[in]
+    ldd       [rocblas_int]
+              specifies the leading dimension of D.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta.
+    @param[inout]
+    e         [void *]
+              device pointer storing matrix E.
+    @param[in]
+    lde       [rocblas_int]
+              specifies the leading dimension of E.
+    @param[in]
+    type      [rocblas_datatype]
+              specifies the datatype of the matrices and bias.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              specifies the datatype of computation.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_chain_ex(rocblas_handle          handle,
+                                                    rocblas_operation       trans_a,
+                                                    rocblas_operation       trans_b,
+                                                    rocblas_operation       trans_d,
+                                                    rocblas_int             m,
+                                                    rocblas_int             n,
+                                                    rocblas_int             k,
+                                                    rocblas_int             l,
+                                                    const void*             alpha,
+                                                    const void*             a,
+                                                    rocblas_int             lda,
+                                                    const void*             b,
+                                                    rocblas_int             ldb,
+                                                    const void*             bias,
+                                                    rocblas_gemm_activation activation,
+                                                    const void*             d,
+                                                    rocblas_int             ldd,
+                                                    const void*             beta,
+                                                    void*                   e,
+                                                    rocblas_int             lde,
+                                                    rocblas_datatype        type,
+                                                    rocblas_datatype        compute_type);
+
+/*! \brief B matrix of rocblas_gemm_packed_ex, packed once with rocblas_gemm_pack_b */
+typedef struct _rocblas_gemm_packed_b* rocblas_gemm_packed_b;
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_pack_b copies op( B ), a k by n matrix, into a packed B for
+    rocblas_gemm_packed_ex, for a B which is multiplied many times, such as the weights of an
+    inference model. The packed B is op( B ) in column major order with its columns aligned in
+    device memory, so that every product with it uses the same, fastest Tensile problem layout,
+    whatever trans_b and ldb are; conjugate transpose is applied once while packing.
+    The packed B has packed_type, which is b_type, or rocblas_datatype_f16_r or
+    rocblas_datatype_bf16_r for b_type rocblas_datatype_f8_r or rocblas_datatype_bf8_r: the FP8
+    values are widened exactly once instead of in every gemm.
+    packed_type may be rocblas_datatype_f16_r, rocblas_datatype_bf16_r, rocblas_datatype_f32_r,
+    rocblas_datatype_f64_r, rocblas_datatype_f32_c, rocblas_datatype_f64_c or
+    rocblas_datatype_i8_r; other types return rocblas_status_not_implemented.
+
+    The packed B is allocated on the device of the handle with hipMalloc, and its copy is
+    enqueued on the stream of the handle, so this function returns rocblas_status_not_implemented
+    in graph safe mode. It must be released with rocblas_destroy_gemm_packed_b.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans_b   [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    k         [rocblas_int]
+              number of rows of op( B ).
+    @param[in]
+    n         [rocblas_int]
+              number of columns of op( B ).
+    @param[in]
+    b         [const void *]
+              device pointer storing matrix B.
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the datatype of matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B.
+    @param[in]
+    packed_type
+              [rocblas_datatype]
+              specifies the datatype of the packed B.
+    @param[out]
+    packed    [rocblas_gemm_packed_b*]
+              pointer to where the packed B will be stored.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_pack_b(rocblas_handle         handle,
+                                                  rocblas_operation      trans_b,
+                                                  rocblas_int            k,
+                                                  rocblas_int            n,
+                                                  const void*            b,
+                                                  rocblas_datatype       b_type,
+                                                  rocblas_int            ldb,
+                                                  rocblas_datatype       packed_type,
+                                                  rocblas_gemm_packed_b* packed);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_destroy_gemm_packed_b releases a packed B created with rocblas_gemm_pack_b, once the
+    functions using it have completed.
+
+    @param[in]
+    packed    [rocblas_gemm_packed_b]
+              the packed B to release; may be nullptr.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_destroy_gemm_packed_b(rocblas_gemm_packed_b packed);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_packed_ex performs rocblas_gemm_ex with op( B ) read from a packed B
+
+        D = alpha*op( A )*packed_b + beta*C
+
+    packed_b must have been packed with k rows and n columns, on the device of the handle, and
+    a_type must be its packed_type; otherwise rocblas_status_invalid_size or
+    rocblas_status_invalid_value is returned. Other arguments are the same as in
+    rocblas_gemm_ex. Calls with the same sizes and A layout make the same Tensile problem, which
+    after the first call is found in the solution cache of the handle.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans_a   [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    m         [rocblas_int]
+              matrix dimension m.
+    @param[in]
+    n         [rocblas_int]
+              matrix dimension n.
+    @param[in]
+    k         [rocblas_int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as compute_type.
+    @param[in]
+    a         [void *]
+              device pointer storing matrix A.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    packed_b  [rocblas_gemm_packed_b]
+              the packed B.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as compute_type.
+    @param[in]
+    c         [void *]
+              device pointer storing matrix C.
+    @param[in]
+    c_type    [rocblas_datatype]
+              specifies the datatype of matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C.
+    @param[out]
+    d         [void *]
+              device pointer storing matrix D.
+    @param[in]
+    d_type    [rocblas_datatype]
+              specifies the datatype of matrix D.
+    @param[in]
+    ldd       [rocblas_int]
+              specifies the leading dimension of D.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [rocblas_gemm_algo]
+              enumerant specifying the algorithm type.
+    @param[in]
+    flags     [uint32_t]
+              optional gemm flags.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_packed_ex(rocblas_handle        handle,
+                                                     rocblas_operation     trans_a,
+                                                     rocblas_int           m,
+                                                     rocblas_int           n,
+                                                     rocblas_int           k,
+                                                     const void*           alpha,
+                                                     const void*           a,
+                                                     rocblas_datatype      a_type,
+                                                     rocblas_int           lda,
+                                                     rocblas_gemm_packed_b packed_b,
+                                                     const void*           beta,
+                                                     const void*           c,
+                                                     rocblas_datatype      c_type,
+                                                     rocblas_int           ldc,
+                                                     void*                 d,
+                                                     rocblas_datatype      d_type,
+                                                     rocblas_int           ldd,
+                                                     rocblas_datatype      compute_type,
+                                                     rocblas_gemm_algo     algo,
+                                                     uint32_t              flags);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    gemm_multi_device performs the matrix-matrix operation
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    distributed over the devices of an array of handles. A, B and C are in the memory of the
+    device of handles[0], and every handle must belong to a different device. C is partitioned
+    into a grid of tiles, one per device, shaped to minimize the panels of A and B each device
+    needs. handles[0] computes its tile in place. Every other device receives panels of op( A )
+    and op( B ) by peer-to-peer copies on a separate stream, double buffered so that the copy
+    of the next panel overlaps the GEMM on the current one, and its tile of C is copied back.
+
+    The call is asynchronous with respect to the host. The work on all devices is ordered after
+    prior work on the stream of handles[0], and later work on that stream is ordered after it.
+    alpha and beta follow the pointer mode of handles[0]. Each handle other than handles[0]
+    uses its device memory for the panels and the tile, and reports that size in device memory
+    size query mode.
+
+    @param[in]
+    handles   [const rocblas_handle*]
+              host array of handle_count handles, each on a different device.
+    @param[in]
+    handle_count
+              [rocblas_int]
+              number of handles.
+    @param[in]
+    trans_a   [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    trans_b   [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              number of rows of matrices op( A ) and C.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of matrices op( B ) and C.
+    @param[in]
+    k         [rocblas_int]
+              number of columns of matrix op( A ) and number of rows of matrix op( B ).
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    A         device pointer storing matrix A on the device of handles[0].
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    B         device pointer storing matrix B on the device of handles[0].
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[in, out]
+    C         device pointer storing matrix C on the device of handles[0].
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_multi_device(const rocblas_handle* handles,
+                                                         rocblas_int           handle_count,
+                                                         rocblas_operation     trans_a,
+                                                         rocblas_operation     trans_b,
+                                                         rocblas_int           m,
+                                                         rocblas_int           n,
+                                                         rocblas_int           k,
+                                                         const float*          alpha,
+                                                         const float*          A,
+                                                         rocblas_int           lda,
+                                                         const float*          B,
+                                                         rocblas_int           ldb,
+                                                         const float*          beta,
+                                                         float*                C,
+                                                         rocblas_int           ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_multi_device(const rocblas_handle* handles,
+                                                         rocblas_int           handle_count,
+                                                         rocblas_operation     trans_a,
+                                                         rocblas_operation     trans_b,
+                                                         rocblas_int           m,
+                                                         rocblas_int           n,
+                                                         rocblas_int           k,
+                                                         const double*         alpha,
+                                                         const double*         A,
+                                                         rocblas_int           lda,
+                                                         const double*         B,
+                                                         rocblas_int           ldb,
+                                                         const double*         beta,
+                                                         double*               C,
+                                                         rocblas_int           ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemm_multi_device(const rocblas_handle*        handles,
+                                                         rocblas_int                  handle_count,
+                                                         rocblas_operation            trans_a,
+                                                         rocblas_operation            trans_b,
+                                                         rocblas_int                  m,
+                                                         rocblas_int                  n,
+                                                         rocblas_int                  k,
+                                                         const rocblas_float_complex* alpha,
+                                                         const rocblas_float_complex* A,
+                                                         rocblas_int                  lda,
+                                                         const rocblas_float_complex* B,
+                                                         rocblas_int                  ldb,
+                                                         const rocblas_float_complex* beta,
+                                                         rocblas_float_complex*       C,
+                                                         rocblas_int                  ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemm_multi_device(const rocblas_handle*         handles,
+                                                         rocblas_int                   handle_count,
+                                                         rocblas_operation             trans_a,
+                                                         rocblas_operation             trans_b,
+                                                         rocblas_int                   m,
+                                                         rocblas_int                   n,
+                                                         rocblas_int                   k,
+                                                         const rocblas_double_complex* alpha,
+                                                         const rocblas_double_complex* A,
+                                                         rocblas_int                   lda,
+                                                         const rocblas_double_complex* B,
+                                                         rocblas_int                   ldb,
+                                                         const rocblas_double_complex* beta,
+                                                         rocblas_double_complex*       C,
+                                                         rocblas_int                   ldc);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    gemm_offload performs the matrix-matrix operation
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    on matrices in host memory. alpha and beta are scalars, and A, B and C are matrices, with
+    op( A ) an m by k matrix, op( B ) a k by n matrix and C an m by n matrix.
+
+    The call is synchronous: it returns once the results are in host memory. The problem is
+    split into tiles which are copied to the device through pinned staging buffers, computed
+    with the rocBLAS kernels and copied back, pipelined over three tiles so that the upload of
+    a tile, the computation of the previous one and the download of the one before overlap on
+    separate streams, while the host packs and unpacks the staging buffers. The tiles are
+    sized to fit in the device memory the handle may use, so the matrices may be larger than
+    device memory. The computation is ordered after prior work on the stream of the handle.
+    alpha and beta are host pointers, whatever the pointer mode. In device memory size query
+    mode the device memory of the tiles is reported. rocblas_status_not_implemented is
+    returned in graph safe mode or during stream capture.
+
+    When A, B and C are all in pinned host memory, allocated with hipHostMalloc or registered
+    with hipHostRegister, or in device memory, also of another device, the copy engines access
+    them directly and the product is computed out of core instead: tiles of C stay in device
+    memory while they are accumulated over k, panel by panel of op( A ) and op( B ), with the
+    next panels copied while the current ones are multiplied. The tiles are as large as the
+    device memory allows, up to 16384 x 16384, so that the copies of the panels take less time
+    than their multiplication whenever k is large enough. Otherwise each tile of C is copied
+    through the staging buffers with its panels of op( A ) and op( B ). C is not copied to the
+    device when beta is zero.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans_a   [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    trans_b   [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              number of rows of matrices op( A ) and C.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of matrices op( B ) and C.
+    @param[in]
+    k         [rocblas_int]
+              number of columns of matrix op( A ) and number of rows of matrix op( B ).
+    @param[in]
+    alpha     host pointer specifying the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A, in host memory or the memory of a device.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    B         pointer storing matrix B, in host memory or the memory of a device.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      host pointer specifying the scalar beta.
+    @param[in, out]
+    C         pointer storing matrix C, in host memory or the memory of a device.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_offload(rocblas_handle    handle,
+                                                    rocblas_operation trans_a,
+                                                    rocblas_operation trans_b,
+                                                    rocblas_int       m,
+                                                    rocblas_int       n,
+                                                    rocblas_int       k,
+                                                    const float*      alpha,
+                                                    const float*      A,
+                                                    rocblas_int       lda,
+                                                    const float*      B,
+                                                    rocblas_int       ldb,
+                                                    const float*      beta,
+                                                    float*            C,
+                                                    rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_offload(rocblas_handle    handle,
+                                                    rocblas_operation trans_a,
+                                                    rocblas_operation trans_b,
+                                                    rocblas_int       m,
+                                                    rocblas_int       n,
+                                                    rocblas_int       k,
+                                                    const double*     alpha,
+                                                    const double*     A,
+                                                    rocblas_int       lda,
+                                                    const double*     B,
+                                                    rocblas_int       ldb,
+                                                    const double*     beta,
+                                                    double*           C,
+                                                    rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemm_offload(rocblas_handle               handle,
+                                                    rocblas_operation            trans_a,
+                                                    rocblas_operation            trans_b,
+                                                    rocblas_int                  m,
+                                                    rocblas_int                  n,
+                                                    rocblas_int                  k,
+                                                    const rocblas_float_complex* alpha,
+                                                    const rocblas_float_complex* A,
+                                                    rocblas_int                  lda,
+                                                    const rocblas_float_complex* B,
+                                                    rocblas_int                  ldb,
+                                                    const rocblas_float_complex* beta,
+                                                    rocblas_float_complex*       C,
+                                                    rocblas_int                  ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemm_offload(rocblas_handle                handle,
+                                                    rocblas_operation             trans_a,
+                                                    rocblas_operation             trans_b,
+                                                    rocblas_int                   m,
+                                                    rocblas_int                   n,
+                                                    rocblas_int                   k,
+                                                    const rocblas_double_complex* alpha,
+                                                    const rocblas_double_complex* A,
+                                                    rocblas_int                   lda,
+                                                    const rocblas_double_complex* B,
+                                                    rocblas_int                   ldb,
+                                                    const rocblas_double_complex* beta,
+                                                    rocblas_double_complex*       C,
+                                                    rocblas_int                   ldc);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    trsm_offload solves
+
+        op(A)*X = alpha*B or  X*op(A) = alpha*B,
+
+    on matrices in host memory, with X and B m by n matrices, A a triangular matrix and op(A)
+    one of op( A ) = A or op( A ) = A^T or op( A ) = A^H. The matrix X overwrites B.
+
+    Tiling, synchronization and device memory are as for gemm_offload.
+    op( A ) is solved by blocked substitution over its diagonal blocks. Each step solves the
+    block rows (side left) or block columns (side right) of B of one diagonal block with trsm,
+    in chunks copied together with the diagonal block, and subtracts their contribution from
+    the blocks of B not solved yet with the tiles of a GEMM.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    side      [rocblas_side]
+              rocblas_side_left:  op(A)*X = alpha*B.
+              rocblas_side_right: X*op(A) = alpha*B.
+    @param[in]
+    uplo      [rocblas_fill]
+              rocblas_fill_upper:  A is an upper triangular matrix.
+              rocblas_fill_lower:  A is a lower triangular matrix.
+    @param[in]
+    trans_a   [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    diag      [rocblas_diagonal]
+              rocblas_diagonal_unit:     A is assumed to be unit triangular.
+              rocblas_diagonal_non_unit: A is not assumed to be unit triangular.
+    @param[in]
+    m         [rocblas_int]
+              number of rows of B.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of B.
+    @param[in]
+    alpha     host pointer specifying the scalar alpha. When alpha is zero, A is not
+              referenced and B need not be set before entry.
+    @param[in]
+    A         host pointer storing matrix A, of dimension ( lda, k ), where k is m when
+              side is rocblas_side_left and n when it is rocblas_side_right.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in,out]
+    B         host pointer storing matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_strsm_offload(rocblas_handle    handle,
+                                                    rocblas_side      side,
+                                                    rocblas_fill      uplo,
+                                                    rocblas_operation trans_a,
+                                                    rocblas_diagonal  diag,
+                                                    rocblas_int       m,
+                                                    rocblas_int       n,
+                                                    const float*      alpha,
+                                                    const float*      A,
+                                                    rocblas_int       lda,
+                                                    float*            B,
+                                                    rocblas_int       ldb);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrsm_offload(rocblas_handle    handle,
+                                                    rocblas_side      side,
+                                                    rocblas_fill      uplo,
+                                                    rocblas_operation trans_a,
+                                                    rocblas_diagonal  diag,
+                                                    rocblas_int       m,
+                                                    rocblas_int       n,
+                                                    const double*     alpha,
+                                                    const double*     A,
+                                                    rocblas_int       lda,
+                                                    double*           B,
+                                                    rocblas_int       ldb);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ctrsm_offload(rocblas_handle               handle,
+                                                    rocblas_side                 side,
+                                                    rocblas_fill                 uplo,
+                                                    rocblas_operation            trans_a,
+                                                    rocblas_diagonal             diag,
+                                                    rocblas_int                  m,
+                                                    rocblas_int                  n,
+                                                    const rocblas_float_complex* alpha,
+                                                    const rocblas_float_complex* A,
+                                                    rocblas_int                  lda,
+                                                    rocblas_float_complex*       B,
+                                                    rocblas_int                  ldb);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ztrsm_offload(rocblas_handle                handle,
+                                                    rocblas_side                  side,
+                                                    rocblas_fill                  uplo,
+                                                    rocblas_operation             trans_a,
+                                                    rocblas_diagonal              diag,
+                                                    rocblas_int                   m,
+                                                    rocblas_int                   n,
+                                                    const rocblas_double_complex* alpha,
+                                                    const rocblas_double_complex* A,
+                                                    rocblas_int                   lda,
+                                                    rocblas_double_complex*       B,
+                                                    rocblas_int                   ldb);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    syrk_offload performs the matrix-matrix operation
+
+        C = alpha*op( A )*op( A )^T + beta*C,
+
+    on matrices in host memory, with op( A ) = A or op( A ) = A^T, op( A ) an n by k matrix
+    and C a symmetric n by n matrix of which only the uplo triangle is updated.
+
+    Tiling, synchronization and device memory are as for gemm_offload.
+    The square tiles of the triangle of C are copied with the panels of op( A ) of their rows
+    and columns; the diagonal tiles are computed with syrk and the others with GEMM.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              rocblas_fill_upper:  C is an upper triangular matrix.
+              rocblas_fill_lower:  C is a lower triangular matrix.
+    @param[in]
+    trans_a   [rocblas_operation]
+              rocblas_operation_none:      op( A ) = A.
+              rocblas_operation_transpose: op( A ) = A^T.
+              rocblas_operation_conjugate_transpose is op( A ) = A^T for real types, and
+              is not supported for complex types.
+    @param[in]
+    n         [rocblas_int]
+              number of rows and columns of C.
+    @param[in]
+    k         [rocblas_int]
+              number of columns of op( A ).
+    @param[in]
+    alpha     host pointer specifying the scalar alpha.
+    @param[in]
+    A         host pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    beta      host pointer specifying the scalar beta.
+    @param[in, out]
+    C         host pointer storing matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_ssyrk_offload(rocblas_handle    handle,
+                                                    rocblas_fill      uplo,
+                                                    rocblas_operation trans_a,
+                                                    rocblas_int       n,
+                                                    rocblas_int       k,
+                                                    const float*      alpha,
+                                                    const float*      A,
+                                                    rocblas_int       lda,
+                                                    const float*      beta,
+                                                    float*            C,
+                                                    rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyrk_offload(rocblas_handle    handle,
+                                                    rocblas_fill      uplo,
+                                                    rocblas_operation trans_a,
+                                                    rocblas_int       n,
+                                                    rocblas_int       k,
+                                                    const double*     alpha,
+                                                    const double*     A,
+                                                    rocblas_int       lda,
+                                                    const double*     beta,
+                                                    double*           C,
+                                                    rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyrk_offload(rocblas_handle               handle,
+                                                    rocblas_fill                 uplo,
+                                                    rocblas_operation            trans_a,
+                                                    rocblas_int                  n,
+                                                    rocblas_int                  k,
+                                                    const rocblas_float_complex* alpha,
+                                                    const rocblas_float_complex* A,
+                                                    rocblas_int                  lda,
+                                                    const rocblas_float_complex* beta,
+                                                    rocblas_float_complex*       C,
+                                                    rocblas_int                  ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zsyrk_offload(rocblas_handle                handle,
+                                                    rocblas_fill                  uplo,
+                                                    rocblas_operation             trans_a,
+                                                    rocblas_int                   n,
+                                                    rocblas_int                   k,
+                                                    const rocblas_double_complex* alpha,
+                                                    const rocblas_double_complex* A,
+                                                    rocblas_int                   lda,
+                                                    const rocblas_double_complex* beta,
+                                                    rocblas_double_complex*       C,
+                                                    rocblas_int                   ldc);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    The _64 Level-1 functions take 64-bit integer sizes and increments. They compute the same
+    results as the rocblas_int functions and are otherwise used in the same way.
+
+    A problem whose sizes and increments fit in rocblas_int runs exactly as it would with the
+    rocblas_int function. A larger problem is split into pieces which each fit, and which run
+    one after another on the stream of the handle.
+
+    rocblas_Xdot_64 returns the partial result of each piece to the host and sums them
+    there, so a problem which is split blocks the host until its result is available, also in
+    device pointer mode or with deferred host results enabled.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [int64_t]
+              the number of elements in x and y.
+    @param[in]
+    alpha     device pointer or host pointer for the scalar alpha (axpy and scal).
+    @param[in, out]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int64_t]
+              specifies the increment for the elements of x.
+    @param[in, out]
+    y         device pointer storing vector y (all but scal).
+    @param[in]
+    incy      [int64_t]
+              specifies the increment for the elements of y.
+    @param[in, out]
+    result    device pointer or host pointer to store the dot product (dot).
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_haxpy_64(rocblas_handle      handle,
+                                               int64_t             n,
+                                               const rocblas_half* alpha,
+                                               const rocblas_half* x,
+                                               int64_t             incx,
+                                               rocblas_half*       y,
+                                               int64_t             incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_64(rocblas_handle handle,
+                                               int64_t        n,
+                                               const float*   alpha,
+                                               const float*   x,
+                                               int64_t        incx,
+                                               float*         y,
+                                               int64_t        incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_64(rocblas_handle handle,
+                                               int64_t        n,
+                                               const double*  alpha,
+                                               const double*  x,
+                                               int64_t        incx,
+                                               double*        y,
+                                               int64_t        incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpy_64(rocblas_handle               handle,
+                                               int64_t                      n,
+                                               const rocblas_float_complex* alpha,
+                                               const rocblas_float_complex* x,
+                                               int64_t                      incx,
+                                               rocblas_float_complex*       y,
+                                               int64_t                      incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpy_64(rocblas_handle                handle,
+                                               int64_t                       n,
+                                               const rocblas_double_complex* alpha,
+                                               const rocblas_double_complex* x,
+                                               int64_t                       incx,
+                                               rocblas_double_complex*       y,
+                                               int64_t                       incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sscal_64(rocblas_handle handle,
+                                               int64_t        n,
+                                               const float*   alpha,
+                                               float*         x,
+                                               int64_t        incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dscal_64(rocblas_handle handle,
+                                               int64_t        n,
+                                               const double*  alpha,
+                                               double*        x,
+                                               int64_t        incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cscal_64(rocblas_handle               handle,
+                                               int64_t                      n,
+                                               const rocblas_float_complex* alpha,
+                                               rocblas_float_complex*       x,
+                                               int64_t                      incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zscal_64(rocblas_handle                handle,
+                                               int64_t                       n,
+                                               const rocblas_double_complex* alpha,
+                                               rocblas_double_complex*       x,
+                                               int64_t                       incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csscal_64(rocblas_handle         handle,
+                                                int64_t                n,
+                                                const float*           alpha,
+                                                rocblas_float_complex* x,
+                                                int64_t                incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdscal_64(rocblas_handle          handle,
+                                                int64_t                 n,
+                                                const double*           alpha,
+                                                rocblas_double_complex* x,
+                                                int64_t                 incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_scopy_64(rocblas_handle handle,
+                                               int64_t        n,
+                                               const float*   x,
+                                               int64_t        incx,
+                                               float*         y,
+                                               int64_t        incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dcopy_64(rocblas_handle handle,
+                                               int64_t        n,
+                                               const double*  x,
+                                               int64_t        incx,
+                                               double*        y,
+                                               int64_t        incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ccopy_64(rocblas_handle               handle,
+                                               int64_t                      n,
+                                               const rocblas_float_complex* x,
+                                               int64_t                      incx,
+                                               rocblas_float_complex*       y,
+                                               int64_t                      incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zcopy_64(rocblas_handle                handle,
+                                               int64_t                       n,
+                                               const rocblas_double_complex* x,
+                                               int64_t                       incx,
+                                               rocblas_double_complex*       y,
+                                               int64_t                       incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sswap_64(rocblas_handle handle,
+                                               int64_t        n,
+                                               float*         x,
+                                               int64_t        incx,
+                                               float*         y,
+                                               int64_t        incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dswap_64(rocblas_handle handle,
+                                               int64_t        n,
+                                               double*        x,
+                                               int64_t        incx,
+                                               double*        y,
+                                               int64_t        incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cswap_64(rocblas_handle         handle,
+                                               int64_t                n,
+                                               rocblas_float_complex* x,
+                                               int64_t                incx,
+                                               rocblas_float_complex* y,
+                                               int64_t                incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zswap_64(rocblas_handle          handle,
+                                               int64_t                 n,
+                                               rocblas_double_complex* x,
+                                               int64_t                 incx,
+                                               rocblas_double_complex* y,
+                                               int64_t                 incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sdot_64(rocblas_handle handle,
+                                              int64_t        n,
+                                              const float*   x,
+                                              int64_t        incx,
+                                              const float*   y,
+                                              int64_t        incy,
+                                              float*         result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ddot_64(rocblas_handle handle,
+                                              int64_t        n,
+                                              const double*  x,
+                                              int64_t        incx,
+                                              const double*  y,
+                                              int64_t        incy,
+                                              double*        result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cdotu_64(rocblas_handle               handle,
+                                               int64_t                      n,
+                                               const rocblas_float_complex* x,
+                                               int64_t                      incx,
+                                               const rocblas_float_complex* y,
+                                               int64_t                      incy,
+                                               rocblas_float_complex*       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdotu_64(rocblas_handle                handle,
+                                               int64_t                       n,
+                                               const rocblas_double_complex* x,
+                                               int64_t                       incx,
+                                               const rocblas_double_complex* y,
+                                               int64_t                       incy,
+                                               rocblas_double_complex*       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cdotc_64(rocblas_handle               handle,
+                                               int64_t                      n,
+                                               const rocblas_float_complex* x,
+                                               int64_t                      incx,
+                                               const rocblas_float_complex* y,
+                                               int64_t                      incy,
+                                               rocblas_float_complex*       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdotc_64(rocblas_handle                handle,
+                                               int64_t                       n,
+                                               const rocblas_double_complex* x,
+                                               int64_t                       incx,
+                                               const rocblas_double_complex* y,
+                                               int64_t                       incy,
+                                               rocblas_double_complex*       result);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_Xgemv_64 is rocblas_Xgemv with 64-bit integer sizes, leading dimension and
+    increments.
+
+    A problem whose arguments fit in rocblas_int runs exactly as it would with rocblas_Xgemv.
+    Otherwise A is split into tiles which the rocblas_int kernels can address, and the tiles
+    run one after another on the stream of the handle. In device pointer mode alpha and beta
+    are then copied to the host first, which synchronizes the stream.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              indicates whether matrix A is tranposed (conjugated) or not.
+    @param[in]
+    m         [int64_t]
+              number of rows of matrix A.
+    @param[in]
+    n         [int64_t]
+              number of columns of matrix A.
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha.
+    @param[in]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [int64_t]
+              specifies the leading dimension of A.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int64_t]
+              specifies the increment for the elements of x.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
+    @param[in, out]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [int64_t]
+              specifies the increment for the elements of y.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgemv_64(rocblas_handle    handle,
+                                               rocblas_operation transA,
+                                               int64_t           m,
+                                               int64_t           n,
+                                               const float*      alpha,
+                                               const float*      A,
+                                               int64_t           lda,
+                                               const float*      x,
+                                               int64_t           incx,
+                                               const float*      beta,
+                                               float*            y,
+                                               int64_t           incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemv_64(rocblas_handle    handle,
+                                               rocblas_operation transA,
+                                               int64_t           m,
+                                               int64_t           n,
+                                               const double*     alpha,
+                                               const double*     A,
+                                               int64_t           lda,
+                                               const double*     x,
+                                               int64_t           incx,
+                                               const double*     beta,
+                                               double*           y,
+                                               int64_t           incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemv_64(rocblas_handle               handle,
+                                               rocblas_operation            transA,
+                                               int64_t                      m,
+                                               int64_t                      n,
+                                               const rocblas_float_complex* alpha,
+                                               const rocblas_float_complex* A,
+                                               int64_t                      lda,
+                                               const rocblas_float_complex* x,
+                                               int64_t                      incx,
+                                               const rocblas_float_complex* beta,
+                                               rocblas_float_complex*       y,
+                                               int64_t                      incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemv_64(rocblas_handle                handle,
+                                               rocblas_operation             transA,
+                                               int64_t                       m,
+                                               int64_t                       n,
+                                               const rocblas_double_complex* alpha,
+                                               const rocblas_double_complex* A,
+                                               int64_t                       lda,
+                                               const rocblas_double_complex* x,
+                                               int64_t                       incx,
+                                               const rocblas_double_complex* beta,
+                                               rocblas_double_complex*       y,
+                                               int64_t                       incy);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_tune_level2_thresholds times the gemv (transpose) kernels which the Level 2
+    thresholds choose between on the device of the handle, and sets the thresholds of the
+    handle to where the faster kernel changes. The measured thresholds are also recorded for
+    the GPU architecture of the device, and are used by all handles created afterwards for
+    that architecture. The tuning takes several seconds and allocates up to 512 MB of device
+    memory.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_tune_level2_thresholds(rocblas_handle handle);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_load_level2_thresholds replaces the recorded Level 2 thresholds with those of a
+    file written by rocblas_save_level2_thresholds. Handles created afterwards use the
+    thresholds for the GPU architecture of their device, and the defaults for thresholds
+    which are not in the file. A file named by the ROCBLAS_LEVEL2_THRESHOLDS environment
+    variable is loaded automatically. Returns rocblas_status_invalid_value if the file cannot
+    be read or is malformed, in which case the recorded thresholds are unchanged.
+
+    @param[in]
+    path      [const char*]
+              path of the thresholds file; nullptr clears the recorded thresholds.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_load_level2_thresholds(const char* path);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_save_level2_thresholds writes the recorded Level 2 thresholds, loaded or measured
+    by rocblas_tune_level2_thresholds, to a file.
+
+    @param[in]
+    path      [const char*]
+              path of the thresholds file.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_save_level2_thresholds(const char* path);
+
+/*! \brief A GEMM problem whose code objects are preloaded by rocblas_gemm_warmup */
+typedef struct rocblas_gemm_warmup_problem_
+{
+    rocblas_operation trans_a; /**< specifies the form of op( A ) */
+    rocblas_operation trans_b; /**< specifies the form of op( B ) */
+    rocblas_int       m; /**< number of rows of op( A ) and C */
+    rocblas_int       n; /**< number of columns of op( B ) and C */
+    rocblas_int       k; /**< number of columns of op( A ) and rows of op( B ) */
+    rocblas_int       batch_count; /**< number of matrices in the batch */
+    rocblas_datatype  a_type; /**< type of the A and B matrices */
+    rocblas_datatype  c_type; /**< type of the C and D matrices */
+    rocblas_datatype  compute_type; /**< type of the computation */
+} rocblas_gemm_warmup_problem;
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_warmup preloads, in a background thread, the Tensile code objects of the
+    kernels which solve a list of GEMM problems on the device of the handle. When the Tensile
+    library is loaded lazily, a code object is otherwise loaded when one of its kernels is first
+    launched, which stalls the first GEMM call of each new family of problems.
+
+    The types of a problem are those of rocblas_gemm_ex, with b_type equal to a_type and d_type
+    equal to c_type; the same code objects are used by rocblas_Xgemm and the batched and strided
+    batched variants. Leading dimensions are taken as the number of rows of each matrix.
+    The function returns once the problems are checked; rocblas_gemm_warmup_wait waits for the
+    warm-up to complete. GEMM calls made in the meantime are correct, but may still load the
+    code objects themselves. Nothing is loaded if all code objects are loaded at initialization,
+    i.e. without lazy loading or after rocblas_initialize.
+
+    Loaded code objects stay resident on the device until the process exits: neither the
+    Tensile library nor the HIP runtime unloads the code objects of rocBLAS, so a warm-up
+    made once at startup keeps its kernels loaded for the lifetime of a service.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    count     [rocblas_int]
+              number of problems.
+    @param[in]
+    problems  [const rocblas_gemm_warmup_problem *]
+              host array of count problems, which is copied before the function returns.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_warmup(rocblas_handle                     handle,
+                                                  rocblas_int                        count,
+                                                  const rocblas_gemm_warmup_problem* problems);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_warmup_wait waits for all warm-up requests made by rocblas_gemm_warmup to
+    complete. Returns the status of the first problem which could not be preloaded, e.g.
+    rocblas_status_not_implemented for an unsupported combination of types.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_warmup_wait(void);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_initialize_devices initializes rocBLAS on a list of HIP devices, as
+    rocblas_initialize does for the current device, with one host thread per device. The
+    Tensile library of a GPU architecture is decoded once and shared by the listed devices of
+    that architecture, while each device loads its own code objects, so a node with many GPUs
+    pays about the startup cost of one device. A device is ready for use as soon as its own
+    initialization completes. The current HIP device of the calling thread is unchanged.
+    Returns once all listed devices are initialized.
+
+    @param[in]
+    ids       [const int *]
+              host array of n HIP device IDs; repeated IDs are initialized once.
+    @param[in]
+    n         [int]
+              number of device IDs.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_initialize_devices(const int* ids, int n);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_report_check_numerics reports the numerical checks made with the
+    rocblas_check_numerics_mode_deferred flag on the handle's stream since the last report.
+
+    In deferred mode the result of each check is recorded in device memory owned by the
+    handle, without synchronizing, and the checked functions return rocblas_status_success.
+    rocblas_report_check_numerics waits for the stream, then prints the results following
+    the other check_numerics flags and clears them, and returns rocblas_status_check_numerics_fail
+    if a check made with rocblas_check_numerics_mode_fail found a NaN, infinity or denormal value.
+
+    Pending checks are also reported when ROCBLAS_CHECK_NUMERICS_REPORT_INTERVAL checks
+    (1024 by default) have been recorded, by the checked function which would exceed the
+    interval, when rocblas_set_stream changes the handle's stream, and when the handle is
+    destroyed; the status of such a report is returned by that function.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_report_check_numerics(rocblas_handle handle);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    axpy_dot computes y := alpha*x + y and then the dot product of the updated y with z
+
+        result := y^T * z     (rocblas_saxpy_dot, rocblas_daxpy_dot)
+        result := y^H * z     (rocblas_caxpy_dotc, rocblas_zaxpy_dotc)
+
+    in a single pass over the vectors, reading x, y and z and writing y once, instead of a call
+    to rocblas_Xaxpy followed by rocblas_Xdot or rocblas_Xdotc. z may be the same vector as y
+    (the same pointer and increment), e.g. to compute the squared norm of an updated residual;
+    otherwise z must not overlap y.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x, y and z.
+    @param[in]
+    alpha     device pointer or host pointer for the scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in, out]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[in]
+    z         device pointer storing vector z.
+    @param[in]
+    incz      [rocblas_int]
+              specifies the increment for the elements of z.
+    @param[in, out]
+    result    device pointer or host pointer to store the dot product.
+              return is 0.0 if n <= 0.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_dot(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const float*   alpha,
+                                                const float*   x,
+                                                rocblas_int    incx,
+                                                float*         y,
+                                                rocblas_int    incy,
+                                                const float*   z,
+                                                rocblas_int    incz,
+                                                float*         result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_dot(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const double*  alpha,
+                                                const double*  x,
+                                                rocblas_int    incx,
+                                                double*        y,
+                                                rocblas_int    incy,
+                                                const double*  z,
+                                                rocblas_int    incz,
+                                                double*        result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpy_dotc(rocblas_handle               handle,
+                                                 rocblas_int                  n,
+                                                 const rocblas_float_complex* alpha,
+                                                 const rocblas_float_complex* x,
+                                                 rocblas_int                  incx,
+                                                 rocblas_float_complex*       y,
+                                                 rocblas_int                  incy,
+                                                 const rocblas_float_complex* z,
+                                                 rocblas_int                  incz,
+                                                 rocblas_float_complex*       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpy_dotc(rocblas_handle                handle,
+                                                 rocblas_int                   n,
+                                                 const rocblas_double_complex* alpha,
+                                                 const rocblas_double_complex* x,
+                                                 rocblas_int                   incx,
+                                                 rocblas_double_complex*       y,
+                                                 rocblas_int                   incy,
+                                                 const rocblas_double_complex* z,
+                                                 rocblas_int                   incz,
+                                                 rocblas_double_complex*       result);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    waxpby computes w := alpha*x + beta*y in a single pass, replacing a copy, a scal and an
+    axpy. x is not read when alpha is zero, and y is not read when beta is zero. w may be
+    the same vector as x or y (the same pointer and increment), e.g. for the direction
+    update p := r + beta*p of the conjugate gradient method; otherwise w must not overlap x
+    or y.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x, y and w.
+    @param[in]
+    alpha     device pointer or host pointer for the scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    beta      device pointer or host pointer for the scalar beta.
+    @param[in]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[out]
+    w         device pointer storing vector w.
+    @param[in]
+    incw      [rocblas_int]
+              specifies the increment for the elements of w.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_swaxpby(rocblas_handle handle,
+                                              rocblas_int    n,
+                                              const float*   alpha,
+                                              const float*   x,
+                                              rocblas_int    incx,
+                                              const float*   beta,
+                                              const float*   y,
+                                              rocblas_int    incy,
+                                              float*         w,
+                                              rocblas_int    incw);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dwaxpby(rocblas_handle handle,
+                                              rocblas_int    n,
+                                              const double*  alpha,
+                                              const double*  x,
+                                              rocblas_int    incx,
+                                              const double*  beta,
+                                              const double*  y,
+                                              rocblas_int    incy,
+                                              double*        w,
+                                              rocblas_int    incw);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cwaxpby(rocblas_handle               handle,
+                                              rocblas_int                  n,
+                                              const rocblas_float_complex* alpha,
+                                              const rocblas_float_complex* x,
+                                              rocblas_int                  incx,
+                                              const rocblas_float_complex* beta,
+                                              const rocblas_float_complex* y,
+                                              rocblas_int                  incy,
+                                              rocblas_float_complex*       w,
+                                              rocblas_int                  incw);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zwaxpby(rocblas_handle                handle,
+                                              rocblas_int                   n,
+                                              const rocblas_double_complex* alpha,
+                                              const rocblas_double_complex* x,
+                                              rocblas_int                   incx,
+                                              const rocblas_double_complex* beta,
+                                              const rocblas_double_complex* y,
+                                              rocblas_int                   incy,
+                                              rocblas_double_complex*       w,
+                                              rocblas_int                   incw);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    dot_nrm2 computes the dot product of x and y together with the Euclidean norm of x
+
+        dot_result  := x^T * y     (rocblas_sdot_nrm2, rocblas_ddot_nrm2)
+        dot_result  := x^H * y     (rocblas_cdotc_nrm2, rocblas_zdotc_nrm2)
+        nrm2_result := ||x||_2
+
+    in a single pass over x and y, instead of a call to rocblas_Xdot or rocblas_Xdotc
+    followed by rocblas_Xnrm2. The norm is computed as the square root of the sum of squares
+    of the elements, which can overflow or underflow for elements of very large or very small
+    magnitude.
+
+    @param[in]
+    handle      [rocblas_handle]
+                handle to the rocblas library context queue.
+    @param[in]
+    n           [rocblas_int]
+                the number of elements in x and y.
+    @param[in]
+    x           device pointer storing vector x.
+    @param[in]
+    incx        [rocblas_int]
+                specifies the increment for the elements of x.
+    @param[in]
+    y           device pointer storing vector y.
+    @param[in]
+    incy        [rocblas_int]
+                specifies the increment for the elements of y.
+    @param[in, out]
+    dot_result  device pointer or host pointer to store the dot product.
+                return is 0.0 if n <= 0.
+    @param[in, out]
+    nrm2_result device pointer or host pointer to store the norm of x.
+                return is 0.0 if n <= 0.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sdot_nrm2(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const float*   x,
+                                                rocblas_int    incx,
+                                                const float*   y,
+                                                rocblas_int    incy,
+                                                float*         dot_result,
+                                                float*         nrm2_result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ddot_nrm2(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const double*  x,
+                                                rocblas_int    incx,
+                                                const double*  y,
+                                                rocblas_int    incy,
+                                                double*        dot_result,
+                                                double*        nrm2_result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cdotc_nrm2(rocblas_handle               handle,
+                                                 rocblas_int                  n,
+                                                 const rocblas_float_complex* x,
+                                                 rocblas_int                  incx,
+                                                 const rocblas_float_complex* y,
+                                                 rocblas_int                  incy,
+                                                 rocblas_float_complex*       dot_result,
+                                                 float*                       nrm2_result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdotc_nrm2(rocblas_handle                handle,
+                                                 rocblas_int                   n,
+                                                 const rocblas_double_complex* x,
+                                                 rocblas_int                   incx,
+                                                 const rocblas_double_complex* y,
+                                                 rocblas_int                   incy,
+                                                 rocblas_double_complex*       dot_result,
+                                                 double*                       nrm2_result);
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    mdot_batched_ex computes the dot products of k vectors x_j with the same vector y,
+
+        result_j = x_j * y;
+
+    mdotc_batched_ex computes the dot products of the conjugates of k complex vectors x_j
+    with the complex vector y,
+
+        result_j = conjugate (x_j) * y;
+
+    for j = 1, ..., k. This is X^T y (X^H y) for the n by k matrix X of columns x_j held as
+    separate vectors, as in the orthogonalization step of Krylov methods. Each element of y
+    is read once for several x_j and the k products are reduced together, rather than with
+    k dot calls.
+
+    Currently supported datatypes are as follows:
+
+    --------------------------------------------------
+    | x_type | y_type | result_type | execution_type |
+    |--------|--------|-------------|----------------|
+    | f16_r  | f16_r  |    f16_r    |     f16_r      |
+    | f16_r  | f16_r  |    f16_r    |     f32_r      |
+    | bf16_r | bf16_r |    bf16_r   |     f32_r      |
+    | f32_r  | f32_r  |    f32_r    |     f32_r      |
+    | f64_r  | f64_r  |    f64_r    |     f64_r      |
+    | f32_c  | f32_c  |    f32_c    |     f32_c      |
+    | f64_c  | f64_c  |    f64_c    |     f64_c      |
+    --------------------------------------------------
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in each x_j and in y.
+    @param[in]
+    k         [rocblas_int]
+              the number of vectors x_j.
+    @param[in]
+    x         device array of k device pointers storing each vector x_j.
+    @param[in]
+    x_type [rocblas_datatype]
+           specifies the datatype of each vector x_j.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_j.
+    @param[in]
+    y         device pointer storing vector y.
+    @param[in]
+    y_type [rocblas_datatype]
+          specifies the datatype of vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[inout]
+    result
+              device array or host array of k elements to store the dot products.
+              return 0.0 for each element if n <= 0.
+    @param[in]
+    result_type [rocblas_datatype]
+                specifies the datatype of the result.
+    @param[in]
+    execution_type [rocblas_datatype]
+                  specifies the datatype of computation.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_mdot_batched_ex(rocblas_handle   handle,
+                                                      rocblas_int      n,
+                                                      rocblas_int      k,
+                                                      const void*      x,
+                                                      rocblas_datatype x_type,
+                                                      rocblas_int      incx,
+                                                      const void*      y,
+                                                      rocblas_datatype y_type,
+                                                      rocblas_int      incy,
+                                                      void*            result,
+                                                      rocblas_datatype result_type,
+                                                      rocblas_datatype execution_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_mdotc_batched_ex(rocblas_handle   handle,
+                                                       rocblas_int      n,
+                                                       rocblas_int      k,
+                                                       const void*      x,
+                                                       rocblas_datatype x_type,
+                                                       rocblas_int      incx,
+                                                       const void*      y,
+                                                       rocblas_datatype y_type,
+                                                       rocblas_int      incy,
+                                                       void*            result,
+                                                       rocblas_datatype result_type,
+                                                       rocblas_datatype execution_type);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    ger_multi (geru_multi for complex) applies k rank-1 updates to the matrix A,
+
+        A := A + alpha_1*x_1*y_1**T + ... + alpha_k*x_k*y_k**T,
+
+    gerc_multi applies k conjugated complex rank-1 updates,
+
+        A := A + alpha_1*x_1*y_1**H + ... + alpha_k*x_k*y_k**H,
+
+    where x_i is column i of the m by k matrix X and y_i column i of the n by k matrix Y. The
+    result is that of k ger calls, A := A + X*diag(alpha)*Y**T, but A is read and written
+    once for up to 16 updates instead of once per update. Larger k are computed with gemm,
+    which then needs m*k elements of device memory workspace.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    m         [rocblas_int]
+              the number of rows of the matrices A and X.
+    @param[in]
+    n         [rocblas_int]
+              the number of columns of A and rows of Y.
+    @param[in]
+    k         [rocblas_int]
+              the number of rank-1 updates, columns of X and of Y.
+    @param[in]
+    alpha
+              device pointer or host pointer to the array of the k scalars alpha_i.
+    @param[in]
+    X         device pointer storing the m by k matrix X.
+    @param[in]
+    ldx       [rocblas_int]
+              specifies the leading dimension of X, at least max(1, m).
+    @param[in]
+    Y         device pointer storing the n by k matrix Y.
+    @param[in]
+    ldy       [rocblas_int]
+              specifies the leading dimension of Y, at least max(1, n).
+    @param[inout]
+    A         device pointer storing the m by n matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, at least max(1, m).
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sger_multi(rocblas_handle handle,
+                                                 rocblas_int    m,
+                                                 rocblas_int    n,
+                                                 rocblas_int    k,
+                                                 const float*   alpha,
+                                                 const float*   X,
+                                                 rocblas_int    ldx,
+                                                 const float*   Y,
+                                                 rocblas_int    ldy,
+                                                 float*         A,
+                                                 rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dger_multi(rocblas_handle handle,
+                                                 rocblas_int    m,
+                                                 rocblas_int    n,
+                                                 rocblas_int    k,
+                                                 const double*  alpha,
+                                                 const double*  X,
+                                                 rocblas_int    ldx,
+                                                 const double*  Y,
+                                                 rocblas_int    ldy,
+                                                 double*        A,
+                                                 rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgeru_multi(rocblas_handle               handle,
+                                                  rocblas_int                  m,
+                                                  rocblas_int                  n,
+                                                  rocblas_int                  k,
+                                                  const rocblas_float_complex* alpha,
+                                                  const rocblas_float_complex* X,
+                                                  rocblas_int                  ldx,
+                                                  const rocblas_float_complex* Y,
+                                                  rocblas_int                  ldy,
+                                                  rocblas_float_complex*       A,
+                                                  rocblas_int                  lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgeru_multi(rocblas_handle                handle,
+                                                  rocblas_int                   m,
+                                                  rocblas_int                   n,
+                                                  rocblas_int                   k,
+                                                  const rocblas_double_complex* alpha,
+                                                  const rocblas_double_complex* X,
+                                                  rocblas_int                   ldx,
+                                                  const rocblas_double_complex* Y,
+                                                  rocblas_int                   ldy,
+                                                  rocblas_double_complex*       A,
+                                                  rocblas_int                   lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgerc_multi(rocblas_handle               handle,
+                                                  rocblas_int                  m,
+                                                  rocblas_int                  n,
+                                                  rocblas_int                  k,
+                                                  const rocblas_float_complex* alpha,
+                                                  const rocblas_float_complex* X,
+                                                  rocblas_int                  ldx,
+                                                  const rocblas_float_complex* Y,
+                                                  rocblas_int                  ldy,
+                                                  rocblas_float_complex*       A,
+                                                  rocblas_int                  lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgerc_multi(rocblas_handle                handle,
+                                                  rocblas_int                   m,
+                                                  rocblas_int                   n,
+                                                  rocblas_int                   k,
+                                                  const rocblas_double_complex* alpha,
+                                                  const rocblas_double_complex* X,
+                                                  rocblas_int                   ldx,
+                                                  const rocblas_double_complex* Y,
+                                                  rocblas_int                   ldy,
+                                                  rocblas_double_complex*       A,
+                                                  rocblas_int                   lda);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    geam_multi computes the linear combination of count matrices
+
+        C := alpha_0*op( A_0 ) + alpha_1*op( A_1 ) + ... + alpha_{count-1}*op( A_{count-1} ),
+
+    where op( A_i ) = A_i, A_i**T or A_i**H with an independent transpose for each operand, in
+    one pass: each element of the inputs is read once and C is written once for up to 8
+    operands, instead of once per rocblas_Xgeam call. Transposed operands are read through LDS
+    tiles with coalesced loads. Operands whose scalar is zero in host pointer mode are not read,
+    and with count 0 or all scalars zero C is set to zero.
+
+    C may be one of the operands, e.g. for C := alpha*op( A ) + beta*op( B ) + gamma*C, if that
+    operand is not transposed and has lda_i == ldc. More than 8 operands take a pass over C for
+    each further 8 operands.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    m         [rocblas_int]
+              the number of rows of op( A_i ) and C.
+    @param[in]
+    n         [rocblas_int]
+              the number of columns of op( A_i ) and C.
+    @param[in]
+    count     [rocblas_int]
+              the number of operands.
+    @param[in]
+    trans     host array of the count rocblas_operation of the operands.
+    @param[in]
+    alpha     device pointer or host pointer to the array of the count scalars alpha_i.
+    @param[in]
+    A         host array of the count device pointers of the matrices A_i.
+    @param[in]
+    lda       host array of the count leading dimensions of the A_i, lda_i >= max(1, m) if
+              trans_i is rocblas_operation_none, otherwise lda_i >= max(1, n).
+    @param[out]
+    C         device pointer storing the m by n matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C, at least max(1, m).
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgeam_multi(rocblas_handle           handle,
+                                                  rocblas_int              m,
+                                                  rocblas_int              n,
+                                                  rocblas_int              count,
+                                                  const rocblas_operation* trans,
+                                                  const float*             alpha,
+                                                  const float* const       A[],
+                                                  const rocblas_int*       lda,
+                                                  float*                   C,
+                                                  rocblas_int              ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgeam_multi(rocblas_handle           handle,
+                                                  rocblas_int              m,
+                                                  rocblas_int              n,
+                                                  rocblas_int              count,
+                                                  const rocblas_operation* trans,
+                                                  const double*            alpha,
+                                                  const double* const      A[],
+                                                  const rocblas_int*       lda,
+                                                  double*                  C,
+                                                  rocblas_int              ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgeam_multi(rocblas_handle                     handle,
+                                                  rocblas_int                        m,
+                                                  rocblas_int                        n,
+                                                  rocblas_int                        count,
+                                                  const rocblas_operation*           trans,
+                                                  const rocblas_float_complex*       alpha,
+                                                  const rocblas_float_complex* const A[],
+                                                  const rocblas_int*                 lda,
+                                                  rocblas_float_complex*             C,
+                                                  rocblas_int                        ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgeam_multi(rocblas_handle                      handle,
+                                                  rocblas_int                         m,
+                                                  rocblas_int                         n,
+                                                  rocblas_int                         count,
+                                                  const rocblas_operation*            trans,
+                                                  const rocblas_double_complex*       alpha,
+                                                  const rocblas_double_complex* const A[],
+                                                  const rocblas_int*                  lda,
+                                                  rocblas_double_complex*             C,
+                                                  rocblas_int                         ldc);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    gemm_dgmm performs the matrix-matrix operation
+
+        C := alpha*diag( x )*op( A )*op( B ) + beta*C,   if side == rocblas_side_left, or
+        C := alpha*op( A )*diag( x )*op( B ) + beta*C,   if side == rocblas_side_right,
+
+    where diag( x ) is the diagonal matrix of the vector x, op( X ) = X, X**T or X**H, alpha
+    and beta are scalars, and op( A ) an m by k, op( B ) a k by n and C an m by n matrix. It is
+    the gemm of the result of rocblas_Xdgmm: the diagonal scaling is applied to the elements of
+    op( A ) as they are loaded by the gemm kernel, so that the scaled copy of A is neither
+    written nor read back.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    side      [rocblas_side]
+              specifies the side of op( A ) multiplied by diag( x ): rocblas_side_left scales
+              the rows of op( A ), rocblas_side_right its columns.
+    @param[in]
+    m         [rocblas_int]
+              number of rows of op( A ) and C.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of op( B ) and C.
+    @param[in]
+    k         [rocblas_int]
+              number of columns of op( A ) and rows of op( B ).
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    x         device pointer storing the vector x, of m elements if side is rocblas_side_left
+              and of k elements otherwise.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment between values of x.
+    @param[in]
+    B         device pointer storing matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[in, out]
+    C         device pointer storing matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_dgmm(rocblas_handle    handle,
+                                                 rocblas_operation transA,
+                                                 rocblas_operation transB,
+                                                 rocblas_side      side,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 rocblas_int       k,
+                                                 const float*      alpha,
+                                                 const float*      A,
+                                                 rocblas_int       lda,
+                                                 const float*      x,
+                                                 rocblas_int       incx,
+                                                 const float*      B,
+                                                 rocblas_int       ldb,
+                                                 const float*      beta,
+                                                 float*            C,
+                                                 rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_dgmm(rocblas_handle    handle,
+                                                 rocblas_operation transA,
+                                                 rocblas_operation transB,
+                                                 rocblas_side      side,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 rocblas_int       k,
+                                                 const double*     alpha,
+                                                 const double*     A,
+                                                 rocblas_int       lda,
+                                                 const double*     x,
+                                                 rocblas_int       incx,
+                                                 const double*     B,
+                                                 rocblas_int       ldb,
+                                                 const double*     beta,
+                                                 double*           C,
+                                                 rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemm_dgmm(rocblas_handle               handle,
+                                                 rocblas_operation            transA,
+                                                 rocblas_operation            transB,
+                                                 rocblas_side                 side,
+                                                 rocblas_int                  m,
+                                                 rocblas_int                  n,
+                                                 rocblas_int                  k,
+                                                 const rocblas_float_complex* alpha,
+                                                 const rocblas_float_complex* A,
+                                                 rocblas_int                  lda,
+                                                 const rocblas_float_complex* x,
+                                                 rocblas_int                  incx,
+                                                 const rocblas_float_complex* B,
+                                                 rocblas_int                  ldb,
+                                                 const rocblas_float_complex* beta,
+                                                 rocblas_float_complex*       C,
+                                                 rocblas_int                  ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemm_dgmm(rocblas_handle                handle,
+                                                 rocblas_operation             transA,
+                                                 rocblas_operation             transB,
+                                                 rocblas_side                  side,
+                                                 rocblas_int                   m,
+                                                 rocblas_int                   n,
+                                                 rocblas_int                   k,
+                                                 const rocblas_double_complex* alpha,
+                                                 const rocblas_double_complex* A,
+                                                 rocblas_int                   lda,
+                                                 const rocblas_double_complex* x,
+                                                 rocblas_int                   incx,
+                                                 const rocblas_double_complex* B,
+                                                 rocblas_int                   ldb,
+                                                 const rocblas_double_complex* beta,
+                                                 rocblas_double_complex*       C,
+                                                 rocblas_int                   ldc);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    gemv_ex performs the matrix-vector operations
+
+        y := alpha*A*x    + beta*y,   or
+        y := alpha*A**T*x + beta*y,   or
+        y := alpha*A**H*x + beta*y,
+
+    where alpha and beta are scalars, x and y are vectors and A is an m by n matrix, with
+    independent datatypes for A, x and y, alpha and beta being of the compute type.
+    gemv_batched_ex and gemv_strided_batched_ex compute batch_count such operations, with
+    A, x and y given as device arrays of device pointers, or as strided batches.
+
+    For the f16_r and bf16_r types, A and x are read 128 bits at a time and converted in
+    registers, the products are accumulated in f32_r and y is rounded once. The other types
+    are computed as by the gemv functions of that type.
+
+    Currently supported datatypes are as follows:
+
+    ----------------------------------------------------
+    | a_type | x_type |     y_type      | compute_type |
+    |--------|--------|-----------------|--------------|
+    | f16_r  | f16_r  | f16_r or f32_r  |    f32_r     |
+    | bf16_r | bf16_r | bf16_r or f32_r |    f32_r     |
+    | f32_r  | f32_r  |      f32_r      |    f32_r     |
+    | f64_r  | f64_r  |      f64_r      |    f64_r     |
+    | f32_c  | f32_c  |      f32_c      |    f32_c     |
+    | f64_c  | f64_c  |      f64_c      |    f64_c     |
+    ----------------------------------------------------
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              indicates whether matrix A is tranposed (conjugated) or not.
+    @param[in]
+    m         [rocblas_int]
+              number of rows of matrix A.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of matrix A.
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha, of compute_type.
+    @param[in]
+    A         device pointer storing matrix A, or device array of batch_count device
+              pointers to each matrix A_i for gemv_batched_ex.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, at least max(1, m).
+    @param[in]
+    stride_a  [rocblas_stride]
+              stride from the start of one matrix A_i to the next, for
+              gemv_strided_batched_ex.
+    @param[in]
+    x         device pointer storing vector x, or device array of batch_count device
+              pointers to each vector x_i for gemv_batched_ex.
+    @param[in]
+    x_type    [rocblas_datatype]
+              specifies the datatype of vector x, the same as a_type.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one vector x_i to the next, for
+              gemv_strided_batched_ex.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta, of compute_type.
+    @param[inout]
+    y         device pointer storing vector y, or device array of batch_count device
+              pointers to each vector y_i for gemv_batched_ex.
+    @param[in]
+    y_type    [rocblas_datatype]
+              specifies the datatype of vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[in]
+    stride_y  [rocblas_stride]
+              stride from the start of one vector y_i to the next, for
+              gemv_strided_batched_ex.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch, for the batched functions.
+    @param[in]
+    compute_type [rocblas_datatype]
+              specifies the datatype of computation, and of alpha and beta.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemv_ex(rocblas_handle    handle,
+                                              rocblas_operation transA,
+                                              rocblas_int       m,
+                                              rocblas_int       n,
+                                              const void*       alpha,
+                                              const void*       A,
+                                              rocblas_datatype  a_type,
+                                              rocblas_int       lda,
+                                              const void*       x,
+                                              rocblas_datatype  x_type,
+                                              rocblas_int       incx,
+                                              const void*       beta,
+                                              void*             y,
+                                              rocblas_datatype  y_type,
+                                              rocblas_int       incy,
+                                              rocblas_datatype  compute_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_gemv_batched_ex(rocblas_handle    handle,
+                                                      rocblas_operation transA,
+                                                      rocblas_int       m,
+                                                      rocblas_int       n,
+                                                      const void*       alpha,
+                                                      const void*       A,
+                                                      rocblas_datatype  a_type,
+                                                      rocblas_int       lda,
+                                                      const void*       x,
+                                                      rocblas_datatype  x_type,
+                                                      rocblas_int       incx,
+                                                      const void*       beta,
+                                                      void*             y,
+                                                      rocblas_datatype  y_type,
+                                                      rocblas_int       incy,
+                                                      rocblas_int       batch_count,
+                                                      rocblas_datatype  compute_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_gemv_strided_batched_ex(rocblas_handle    handle,
+                                                              rocblas_operation transA,
+                                                              rocblas_int       m,
+                                                              rocblas_int       n,
+                                                              const void*       alpha,
+                                                              const void*       A,
+                                                              rocblas_datatype  a_type,
+                                                              rocblas_int       lda,
+                                                              rocblas_stride    stride_a,
+                                                              const void*       x,
+                                                              rocblas_datatype  x_type,
+                                                              rocblas_int       incx,
+                                                              rocblas_stride    stride_x,
+                                                              const void*       beta,
+                                                              void*             y,
+                                                              rocblas_datatype  y_type,
+                                                              rocblas_int       incy,
+                                                              rocblas_stride    stride_y,
+                                                              rocblas_int       batch_count,
+                                                              rocblas_datatype  compute_type);
+//! @}
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    gemv_quantized_ex performs the matrix-vector operation
+
+        y := alpha*dequant(A)**T*x + beta*y,
+
+    where alpha and beta are f32_r scalars, x and y are vectors and A is an m by n matrix of
+    8-bit or 4-bit integer weights, with one f16 scale and zero point per group of group_size
+    consecutive elements of a column:
+
+        dequant(A)(i, j) = scales[g + j * groups] * (A(i, j) - zeros[g + j * groups]),
+
+    with g = i / group_size and groups = ceil(m / group_size). The row-major weights W of a
+    linear layer y := W*x are such a matrix with lda the row length of W. A is read 128 bits
+    at a time and dequantized in registers, the products are accumulated in f32_r and y is
+    rounded once, so that A is read with a quarter (4-bit) or half (8-bit) of the traffic of
+    an f16_r gemv.
+
+    Currently supported datatypes are as follows:
+
+    --------------------------------------------------------------------
+    | a_bits | scales, zeros | x_type |     y_type      | compute_type |
+    |--------|---------------|--------|-----------------|--------------|
+    | 8 or 4 |      f16      | f16_r  | f16_r or f32_r  |    f32_r     |
+    | 8 or 4 |      f16      | bf16_r | bf16_r or f32_r |    f32_r     |
+    --------------------------------------------------------------------
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              rocblas_operation_transpose or rocblas_operation_conjugate_transpose, the only
+              supported operation.
+    @param[in]
+    m         [rocblas_int]
+              number of rows of matrix A, the length of x.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of matrix A, the length of y.
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha, of compute_type.
+    @param[in]
+    A         device pointer storing matrix A. With a_bits 8 its elements are int8_t values,
+              with a_bits 4 they are unsigned 4-bit values from 0 to 15 packed two to a byte,
+              the even row of each pair in the low 4 bits.
+    @param[in]
+    a_bits    [rocblas_int]
+              number of bits of the elements of A, 8 or 4.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A in elements, at least max(1, m) and even
+              for 4-bit elements. A is read 128 bits at a time when it is 16 byte aligned and
+              lda * a_bits is a multiple of 128.
+    @param[in]
+    scales    device pointer storing the groups * n scales of A.
+    @param[in]
+    zeros     device pointer storing the groups * n zero points of A, or nullptr for a zero
+              point of 0 for 8-bit elements and 8 for 4-bit elements.
+    @param[in]
+    group_size [rocblas_int]
+              number of consecutive elements of a column of A sharing a scale and zero point,
+              at least m for one group per column or a multiple of 128 / a_bits.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    x_type    [rocblas_datatype]
+              specifies the datatype of vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta, of compute_type.
+    @param[inout]
+    y         device pointer storing vector y.
+    @param[in]
+    y_type    [rocblas_datatype]
+              specifies the datatype of vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[in]
+    compute_type [rocblas_datatype]
+              specifies the datatype of computation, and of alpha and beta.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemv_quantized_ex(rocblas_handle      handle,
+                                                        rocblas_operation   transA,
+                                                        rocblas_int         m,
+                                                        rocblas_int         n,
+                                                        const void*         alpha,
+                                                        const void*         A,
+                                                        rocblas_int         a_bits,
+                                                        rocblas_int         lda,
+                                                        const rocblas_half* scales,
+                                                        const rocblas_half* zeros,
+                                                        rocblas_int         group_size,
+                                                        const void*         x,
+                                                        rocblas_datatype    x_type,
+                                                        rocblas_int         incx,
+                                                        const void*         beta,
+                                                        void*               y,
+                                                        rocblas_datatype    y_type,
+                                                        rocblas_int         incy,
+                                                        rocblas_datatype    compute_type);
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    gemv_vbatched performs a batch of matrix-vector operations of different sizes
+
+        y_i := alpha*A_i*x_i    + beta*y_i,   or
+        y_i := alpha*A_i**T*x_i + beta*y_i,   or
+        y_i := alpha*A_i**H*x_i + beta*y_i,
+
+    where (A_i, x_i, y_i) is the i-th instance of the batch, alpha and beta are scalars, x_i
+    and y_i are vectors and A_i is an m_i by n_i matrix, for i = 1, ..., batch_count. The sizes
+    m_i and n_i, the leading dimensions lda_i and the increments incx_i and incy_i are given in
+    device arrays, so that the problems need not be padded to a common size.
+
+    The problems are split into tiles, blocks of rows of y_i or single elements of y_i for the
+    transposed operations, which a single launch over a grid sized to the device distributes
+    to its compute units as they become free, so that large and small problems are balanced.
+    As the sizes are only read on the device, the instances with m_i or n_i at most 0, with
+    lda_i < m_i or with incx_i or incy_i of 0 are skipped, and leave y_i unchanged, instead of
+    returning an error. The functions need a device memory workspace of 8 * batch_count + 16
+    bytes, which is allocated from the handle.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              indicates whether the matrices A_i are tranposed (conjugated) or not.
+    @param[in]
+    m         device array of batch_count rocblas_int, the number of rows of each A_i.
+    @param[in]
+    n         device array of batch_count rocblas_int, the number of columns of each A_i.
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha.
+    @param[in]
+    A         device array of device pointers storing each matrix A_i.
+    @param[in]
+    lda       device array of batch_count rocblas_int, the leading dimension of each A_i,
+              at least max(1, m_i).
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      device array of batch_count rocblas_int, the increment of each x_i.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
+    @param[inout]
+    y         device array of device pointers storing each vector y_i.
+    @param[in]
+    incy      device array of batch_count rocblas_int, the increment of each y_i.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgemv_vbatched(rocblas_handle     handle,
+                                                     rocblas_operation  transA,
+                                                     const rocblas_int* m,
+                                                     const rocblas_int* n,
+                                                     const float*       alpha,
+                                                     const float* const A[],
+                                                     const rocblas_int* lda,
+                                                     const float* const x[],
+                                                     const rocblas_int* incx,
+                                                     const float*       beta,
+                                                     float* const       y[],
+                                                     const rocblas_int* incy,
+                                                     rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemv_vbatched(rocblas_handle      handle,
+                                                     rocblas_operation   transA,
+                                                     const rocblas_int*  m,
+                                                     const rocblas_int*  n,
+                                                     const double*       alpha,
+                                                     const double* const A[],
+                                                     const rocblas_int*  lda,
+                                                     const double* const x[],
+                                                     const rocblas_int*  incx,
+                                                     const double*       beta,
+                                                     double* const       y[],
+                                                     const rocblas_int*  incy,
+                                                     rocblas_int         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemv_vbatched(rocblas_handle                     handle,
+                                                     rocblas_operation                  transA,
+                                                     const rocblas_int*                 m,
+                                                     const rocblas_int*                 n,
+                                                     const rocblas_float_complex*       alpha,
+                                                     const rocblas_float_complex* const A[],
+                                                     const rocblas_int*                 lda,
+                                                     const rocblas_float_complex* const x[],
+                                                     const rocblas_int*                 incx,
+                                                     const rocblas_float_complex*       beta,
+                                                     rocblas_float_complex* const       y[],
+                                                     const rocblas_int*                 incy,
+                                                     rocblas_int                        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemv_vbatched(rocblas_handle                      handle,
+                                                     rocblas_operation                   transA,
+                                                     const rocblas_int*                  m,
+                                                     const rocblas_int*                  n,
+                                                     const rocblas_double_complex*       alpha,
+                                                     const rocblas_double_complex* const A[],
+                                                     const rocblas_int*                  lda,
+                                                     const rocblas_double_complex* const x[],
+                                                     const rocblas_int*                  incx,
+                                                     const rocblas_double_complex*       beta,
+                                                     rocblas_double_complex* const       y[],
+                                                     const rocblas_int*                  incy,
+                                                     rocblas_int                         batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    gemv_nt performs the two matrix-vector operations
+
+        y := alpha*A*x     + beta*y,   and
+        z := gamma*op(A)*w + delta*z,
+
+    with op(A) = A**T or A**H, reading A once, where alpha, beta, gamma and delta are scalars,
+    x and z are n element vectors, y and w are m element vectors and A is an m by n matrix.
+    The two products of each iteration of bi-conjugate gradient or Lanczos bidiagonalization
+    are computed with half the traffic of A of two gemv calls.
+
+    The partial sums of blocks of A are written to a device memory workspace allocated from
+    the handle, of m * ceil(n / c) + n * r elements with c = 16 (8 for double complex) and r
+    the number of row blocks, at most ceil(m / 256), and summed in a fixed order, so that the
+    results are reproducible.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans     [rocblas_operation]
+              op(A) of the second operation, rocblas_operation_transpose or
+              rocblas_operation_conjugate_transpose.
+    @param[in]
+    m         [rocblas_int]
+              number of rows of matrix A.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of matrix A.
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha.
+    @param[in]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, at least max(1, m).
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
+    @param[inout]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[in]
+    gamma     device pointer or host pointer to scalar gamma.
+    @param[in]
+    w         device pointer storing vector w.
+    @param[in]
+    incw      [rocblas_int]
+              specifies the increment for the elements of w.
+    @param[in]
+    delta     device pointer or host pointer to scalar delta.
+    @param[inout]
+    z         device pointer storing vector z.
+    @param[in]
+    incz      [rocblas_int]
+              specifies the increment for the elements of z.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgemv_nt(rocblas_handle    handle,
+                                               rocblas_operation trans,
+                                               rocblas_int       m,
+                                               rocblas_int       n,
+                                               const float*      alpha,
+                                               const float*      A,
+                                               rocblas_int       lda,
+                                               const float*      x,
+                                               rocblas_int       incx,
+                                               const float*      beta,
+                                               float*            y,
+                                               rocblas_int       incy,
+                                               const float*      gamma,
+                                               const float*      w,
+                                               rocblas_int       incw,
+                                               const float*      delta,
+                                               float*            z,
+                                               rocblas_int       incz);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemv_nt(rocblas_handle    handle,
+                                               rocblas_operation trans,
+                                               rocblas_int       m,
+                                               rocblas_int       n,
+                                               const double*     alpha,
+                                               const double*     A,
+                                               rocblas_int       lda,
+                                               const double*     x,
+                                               rocblas_int       incx,
+                                               const double*     beta,
+                                               double*           y,
+                                               rocblas_int       incy,
+                                               const double*     gamma,
+                                               const double*     w,
+                                               rocblas_int       incw,
+                                               const double*     delta,
+                                               double*           z,
+                                               rocblas_int       incz);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemv_nt(rocblas_handle               handle,
+                                               rocblas_operation            trans,
+                                               rocblas_int                  m,
+                                               rocblas_int                  n,
+                                               const rocblas_float_complex* alpha,
+                                               const rocblas_float_complex* A,
+                                               rocblas_int                  lda,
+                                               const rocblas_float_complex* x,
+                                               rocblas_int                  incx,
+                                               const rocblas_float_complex* beta,
+                                               rocblas_float_complex*       y,
+                                               rocblas_int                  incy,
+                                               const rocblas_float_complex* gamma,
+                                               const rocblas_float_complex* w,
+                                               rocblas_int                  incw,
+                                               const rocblas_float_complex* delta,
+                                               rocblas_float_complex*       z,
+                                               rocblas_int                  incz);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemv_nt(rocblas_handle                handle,
+                                               rocblas_operation             trans,
+                                               rocblas_int                   m,
+                                               rocblas_int                   n,
+                                               const rocblas_double_complex* alpha,
+                                               const rocblas_double_complex* A,
+                                               rocblas_int                   lda,
+                                               const rocblas_double_complex* x,
+                                               rocblas_int                   incx,
+                                               const rocblas_double_complex* beta,
+                                               rocblas_double_complex*       y,
+                                               rocblas_int                   incy,
+                                               const rocblas_double_complex* gamma,
+                                               const rocblas_double_complex* w,
+                                               rocblas_int                   incw,
+                                               const rocblas_double_complex* delta,
+                                               rocblas_double_complex*       z,
+                                               rocblas_int                   incz);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rot_sequence applies k plane rotations in order to the same pair of vectors x and y,
+
+        for j = 0, ..., k - 1:
+            (x_i, y_i) := (c_j * x_i + s_j * y_i, c_j * y_i - s_j * x_i)   for all i
+
+    as in the repeated rotations of a Jacobi or QR sweep. Each element of x and y is read and
+    written once for all the rotations, instead of once per rocblas_Xrot call. The cosines and
+    sines are real; rocblas_csrot_sequence and rocblas_zdrot_sequence rotate complex vectors.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              number of elements in the x and y vectors.
+    @param[in]
+    k         [rocblas_int]
+              number of rotations.
+    @param[in, out]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment between elements of x.
+    @param[in, out]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment between elements of y.
+    @param[in]
+    c         device pointer storing the k cosines c_j, in device memory whatever the pointer
+              mode.
+    @param[in]
+    s         device pointer storing the k sines s_j, in device memory whatever the pointer
+              mode.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_srot_sequence(rocblas_handle handle,
+                                                    rocblas_int    n,
+                                                    rocblas_int    k,
+                                                    float*         x,
+                                                    rocblas_int    incx,
+                                                    float*         y,
+                                                    rocblas_int    incy,
+                                                    const float*   c,
+                                                    const float*   s);
+
+ROCBLAS_EXPORT rocblas_status rocblas_drot_sequence(rocblas_handle handle,
+                                                    rocblas_int    n,
+                                                    rocblas_int    k,
+                                                    double*        x,
+                                                    rocblas_int    incx,
+                                                    double*        y,
+                                                    rocblas_int    incy,
+                                                    const double*  c,
+                                                    const double*  s);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csrot_sequence(rocblas_handle         handle,
+                                                     rocblas_int            n,
+                                                     rocblas_int            k,
+                                                     rocblas_float_complex* x,
+                                                     rocblas_int            incx,
+                                                     rocblas_float_complex* y,
+                                                     rocblas_int            incy,
+                                                     const float*           c,
+                                                     const float*           s);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdrot_sequence(rocblas_handle          handle,
+                                                     rocblas_int             n,
+                                                     rocblas_int             k,
+                                                     rocblas_double_complex* x,
+                                                     rocblas_int             incx,
+                                                     rocblas_double_complex* y,
+                                                     rocblas_int             incy,
+                                                     const double*           c,
+                                                     const double*           s);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rot_sweep applies the n - 1 plane rotations (c_j, s_j) in order to the adjacent columns
+    a_j and a_{j+1} of the m by n matrix A,
+
+        for j = 0, ..., n - 2:
+            (a_j, a_{j+1}) := (c_j * a_j + s_j * a_{j+1}, c_j * a_{j+1} - s_j * a_j)
+
+    as in the update of the eigenvectors or singular vectors by an implicit QR sweep (LAPACK
+    xLASR with side = 'R', pivot = 'V' and direct = 'F'). Each element of A is read and written
+    once, instead of twice per rocblas_Xrot call for each of the n - 1 rotations. The cosines
+    and sines are real; rocblas_csrot_sweep and rocblas_zdrot_sweep rotate complex matrices.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    m         [rocblas_int]
+              number of rows of A.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of A.
+    @param[in, out]
+    A         device pointer storing the matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, lda >= max(1, m).
+    @param[in]
+    c         device pointer storing the n - 1 cosines c_j, in device memory whatever the
+              pointer mode.
+    @param[in]
+    s         device pointer storing the n - 1 sines s_j, in device memory whatever the pointer
+              mode.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_srot_sweep(rocblas_handle handle,
+                                                 rocblas_int    m,
+                                                 rocblas_int    n,
+                                                 float*         A,
+                                                 rocblas_int    lda,
+                                                 const float*   c,
+                                                 const float*   s);
+
+ROCBLAS_EXPORT rocblas_status rocblas_drot_sweep(rocblas_handle handle,
+                                                 rocblas_int    m,
+                                                 rocblas_int    n,
+                                                 double*        A,
+                                                 rocblas_int    lda,
+                                                 const double*  c,
+                                                 const double*  s);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csrot_sweep(rocblas_handle         handle,
+                                                  rocblas_int            m,
+                                                  rocblas_int            n,
+                                                  rocblas_float_complex* A,
+                                                  rocblas_int            lda,
+                                                  const float*           c,
+                                                  const float*           s);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdrot_sweep(rocblas_handle          handle,
+                                                  rocblas_int             m,
+                                                  rocblas_int             n,
+                                                  rocblas_double_complex* A,
+                                                  rocblas_int             lda,
+                                                  const double*           c,
+                                                  const double*           s);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    axpyi adds a multiple of the sparse vector x to the dense vector y,
+
+        y[x_ind[i]] := y[x_ind[i]] + alpha * x_val[i]   for i = 0, ..., nnz - 1
+
+    on the handle's stream. The strided_batched variants run batch_count such updates.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    nnz       [rocblas_int]
+              number of nonzeros of the sparse vector x.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    x_val     device pointer storing the nnz values of x.
+    @param[in]
+    x_ind     device pointer storing the nnz distinct 0-based indices of the nonzeros of x in y.
+    @param[in, out]
+    y         device pointer storing the dense vector y.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one x_val to the next one, for the strided_batched
+              variant.
+    @param[in]
+    stride_ind [rocblas_stride]
+              stride from the start of one x_ind to the next one, for the strided_batched
+              variant; 0 shares the indices between the batches.
+    @param[in]
+    stride_y  [rocblas_stride]
+              stride from the start of one y to the next one, for the strided_batched variant.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch, for the strided_batched variant.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_saxpyi(rocblas_handle     handle,
+                                             rocblas_int        nnz,
+                                             const float*       alpha,
+                                             const float*       x_val,
+                                             const rocblas_int* x_ind,
+                                             float*             y);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpyi(rocblas_handle     handle,
+                                             rocblas_int        nnz,
+                                             const double*      alpha,
+                                             const double*      x_val,
+                                             const rocblas_int* x_ind,
+                                             double*            y);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpyi(rocblas_handle               handle,
+                                             rocblas_int                  nnz,
+                                             const rocblas_float_complex* alpha,
+                                             const rocblas_float_complex* x_val,
+                                             const rocblas_int*           x_ind,
+                                             rocblas_float_complex*       y);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpyi(rocblas_handle                handle,
+                                             rocblas_int                   nnz,
+                                             const rocblas_double_complex* alpha,
+                                             const rocblas_double_complex* x_val,
+                                             const rocblas_int*            x_ind,
+                                             rocblas_double_complex*       y);
+
+ROCBLAS_EXPORT rocblas_status rocblas_saxpyi_strided_batched(rocblas_handle     handle,
+                                                             rocblas_int        nnz,
+                                                             const float*       alpha,
+                                                             const float*       x_val,
+                                                             rocblas_stride     stride_x,
+                                                             const rocblas_int* x_ind,
+                                                             rocblas_stride     stride_ind,
+                                                             float*             y,
+                                                             rocblas_stride     stride_y,
+                                                             rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpyi_strided_batched(rocblas_handle     handle,
+                                                             rocblas_int        nnz,
+                                                             const double*      alpha,
+                                                             const double*      x_val,
+                                                             rocblas_stride     stride_x,
+                                                             const rocblas_int* x_ind,
+                                                             rocblas_stride     stride_ind,
+                                                             double*            y,
+                                                             rocblas_stride     stride_y,
+                                                             rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpyi_strided_batched(rocblas_handle               handle,
+                                                             rocblas_int                  nnz,
+                                                             const rocblas_float_complex* alpha,
+                                                             const rocblas_float_complex* x_val,
+                                                             rocblas_stride               stride_x,
+                                                             const rocblas_int*           x_ind,
+                                                             rocblas_stride         stride_ind,
+                                                             rocblas_float_complex* y,
+                                                             rocblas_stride         stride_y,
+                                                             rocblas_int            batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpyi_strided_batched(rocblas_handle                handle,
+                                                             rocblas_int                   nnz,
+                                                             const rocblas_double_complex* alpha,
+                                                             const rocblas_double_complex* x_val,
+                                                             rocblas_stride                stride_x,
+                                                             const rocblas_int*            x_ind,
+                                                             rocblas_stride          stride_ind,
+                                                             rocblas_double_complex* y,
+                                                             rocblas_stride          stride_y,
+                                                             rocblas_int             batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    doti computes the dot product of the sparse vector x and the dense vector y,
+
+        result := sum_i x_val[i] * y[x_ind[i]]
+
+    and dotci the dot product with x conjugated. The sums of the blocks of nonzeros are reduced
+    in a fixed order, so the results do not vary from run to run. The strided_batched variants
+    compute batch_count dot products.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    nnz       [rocblas_int]
+              number of nonzeros of the sparse vector x.
+    @param[in]
+    x_val     device pointer storing the nnz values of x.
+    @param[in]
+    x_ind     device pointer storing the nnz distinct 0-based indices of the nonzeros of x in y.
+    @param[in]
+    y         device pointer storing the dense vector y.
+    @param[inout]
+    result    device pointer or host pointer to store the dot product, or the batch_count dot
+              products of the strided_batched variants. The result is 0 when nnz is 0.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one x_val to the next one, for the strided_batched
+              variant.
+    @param[in]
+    stride_ind [rocblas_stride]
+              stride from the start of one x_ind to the next one, for the strided_batched
+              variant; 0 shares the indices between the batches.
+    @param[in]
+    stride_y  [rocblas_stride]
+              stride from the start of one y to the next one, for the strided_batched variant.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch, for the strided_batched variant.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sdoti(rocblas_handle     handle,
+                                            rocblas_int        nnz,
+                                            const float*       x_val,
+                                            const rocblas_int* x_ind,
+                                            const float*       y,
+                                            float*             result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ddoti(rocblas_handle     handle,
+                                            rocblas_int        nnz,
+                                            const double*      x_val,
+                                            const rocblas_int* x_ind,
+                                            const double*      y,
+                                            double*            result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cdoti(rocblas_handle               handle,
+                                            rocblas_int                  nnz,
+                                            const rocblas_float_complex* x_val,
+                                            const rocblas_int*           x_ind,
+                                            const rocblas_float_complex* y,
+                                            rocblas_float_complex*       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdoti(rocblas_handle                handle,
+                                            rocblas_int                   nnz,
+                                            const rocblas_double_complex* x_val,
+                                            const rocblas_int*            x_ind,
+                                            const rocblas_double_complex* y,
+                                            rocblas_double_complex*       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cdotci(rocblas_handle               handle,
+                                             rocblas_int                  nnz,
+                                             const rocblas_float_complex* x_val,
+                                             const rocblas_int*           x_ind,
+                                             const rocblas_float_complex* y,
+                                             rocblas_float_complex*       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdotci(rocblas_handle                handle,
+                                             rocblas_int                   nnz,
+                                             const rocblas_double_complex* x_val,
+                                             const rocblas_int*            x_ind,
+                                             const rocblas_double_complex* y,
+                                             rocblas_double_complex*       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sdoti_strided_batched(rocblas_handle     handle,
+                                                            rocblas_int        nnz,
+                                                            const float*       x_val,
+                                                            rocblas_stride     stride_x,
+                                                            const rocblas_int* x_ind,
+                                                            rocblas_stride     stride_ind,
+                                                            const float*       y,
+                                                            rocblas_stride     stride_y,
+                                                            rocblas_int        batch_count,
+                                                            float*             result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ddoti_strided_batched(rocblas_handle     handle,
+                                                            rocblas_int        nnz,
+                                                            const double*      x_val,
+                                                            rocblas_stride     stride_x,
+                                                            const rocblas_int* x_ind,
+                                                            rocblas_stride     stride_ind,
+                                                            const double*      y,
+                                                            rocblas_stride     stride_y,
+                                                            rocblas_int        batch_count,
+                                                            double*            result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cdoti_strided_batched(rocblas_handle               handle,
+                                                            rocblas_int                  nnz,
+                                                            const rocblas_float_complex* x_val,
+                                                            rocblas_stride               stride_x,
+                                                            const rocblas_int*           x_ind,
+                                                            rocblas_stride               stride_ind,
+                                                            const rocblas_float_complex* y,
+                                                            rocblas_stride               stride_y,
+                                                            rocblas_int            batch_count,
+                                                            rocblas_float_complex* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdoti_strided_batched(rocblas_handle                handle,
+                                                            rocblas_int                   nnz,
+                                                            const rocblas_double_complex* x_val,
+                                                            rocblas_stride                stride_x,
+                                                            const rocblas_int*            x_ind,
+                                                            rocblas_stride stride_ind,
+                                                            const rocblas_double_complex* y,
+                                                            rocblas_stride                stride_y,
+                                                            rocblas_int             batch_count,
+                                                            rocblas_double_complex* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cdotci_strided_batched(rocblas_handle               handle,
+                                                             rocblas_int                  nnz,
+                                                             const rocblas_float_complex* x_val,
+                                                             rocblas_stride               stride_x,
+                                                             const rocblas_int*           x_ind,
+                                                             rocblas_stride stride_ind,
+                                                             const rocblas_float_complex* y,
+                                                             rocblas_stride               stride_y,
+                                                             rocblas_int            batch_count,
+                                                             rocblas_float_complex* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdotci_strided_batched(rocblas_handle                handle,
+                                                             rocblas_int                   nnz,
+                                                             const rocblas_double_complex* x_val,
+                                                             rocblas_stride                stride_x,
+                                                             const rocblas_int*            x_ind,
+                                                             rocblas_stride stride_ind,
+                                                             const rocblas_double_complex* y,
+                                                             rocblas_stride                stride_y,
+                                                             rocblas_int             batch_count,
+                                                             rocblas_double_complex* result);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    gthr gathers the elements of the dense vector y at the indices of the sparse vector x,
+
+        x_val[i] := y[x_ind[i]]   for i = 0, ..., nnz - 1
+
+    The strided_batched variants run batch_count such gathers.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    nnz       [rocblas_int]
+              number of nonzeros of the sparse vector x.
+    @param[out]
+    x_val     device pointer storing the nnz values of x.
+    @param[in]
+    x_ind     device pointer storing the nnz distinct 0-based indices of the nonzeros of x in y.
+    @param[in]
+    y         device pointer storing the dense vector y.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one x_val to the next one, for the strided_batched
+              variant.
+    @param[in]
+    stride_ind [rocblas_stride]
+              stride from the start of one x_ind to the next one, for the strided_batched
+              variant; 0 shares the indices between the batches.
+    @param[in]
+    stride_y  [rocblas_stride]
+              stride from the start of one y to the next one, for the strided_batched variant.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch, for the strided_batched variant.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgthr(rocblas_handle     handle,
+                                            rocblas_int        nnz,
+                                            float*             x_val,
+                                            const rocblas_int* x_ind,
+                                            const float*       y);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgthr(rocblas_handle     handle,
+                                            rocblas_int        nnz,
+                                            double*            x_val,
+                                            const rocblas_int* x_ind,
+                                            const double*      y);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgthr(rocblas_handle               handle,
+                                            rocblas_int                  nnz,
+                                            rocblas_float_complex*       x_val,
+                                            const rocblas_int*           x_ind,
+                                            const rocblas_float_complex* y);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgthr(rocblas_handle                handle,
+                                            rocblas_int                   nnz,
+                                            rocblas_double_complex*       x_val,
+                                            const rocblas_int*            x_ind,
+                                            const rocblas_double_complex* y);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgthr_strided_batched(rocblas_handle     handle,
+                                                            rocblas_int        nnz,
+                                                            float*             x_val,
+                                                            rocblas_stride     stride_x,
+                                                            const rocblas_int* x_ind,
+                                                            rocblas_stride     stride_ind,
+                                                            const float*       y,
+                                                            rocblas_stride     stride_y,
+                                                            rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgthr_strided_batched(rocblas_handle     handle,
+                                                            rocblas_int        nnz,
+                                                            double*            x_val,
+                                                            rocblas_stride     stride_x,
+                                                            const rocblas_int* x_ind,
+                                                            rocblas_stride     stride_ind,
+                                                            const double*      y,
+                                                            rocblas_stride     stride_y,
+                                                            rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgthr_strided_batched(rocblas_handle               handle,
+                                                            rocblas_int                  nnz,
+                                                            rocblas_float_complex*       x_val,
+                                                            rocblas_stride               stride_x,
+                                                            const rocblas_int*           x_ind,
+                                                            rocblas_stride               stride_ind,
+                                                            const rocblas_float_complex* y,
+                                                            rocblas_stride               stride_y,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgthr_strided_batched(rocblas_handle          handle,
+                                                            rocblas_int             nnz,
+                                                            rocblas_double_complex* x_val,
+                                                            rocblas_stride          stride_x,
+                                                            const rocblas_int*      x_ind,
+                                                            rocblas_stride          stride_ind,
+                                                            const rocblas_double_complex* y,
+                                                            rocblas_stride                stride_y,
+                                                            rocblas_int batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    sctr scatters the sparse vector x into the dense vector y,
+
+        y[x_ind[i]] := x_val[i]   for i = 0, ..., nnz - 1
+
+    leaving the other elements of y unchanged. The strided_batched variants run batch_count
+    such scatters.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    nnz       [rocblas_int]
+              number of nonzeros of the sparse vector x.
+    @param[in]
+    x_val     device pointer storing the nnz values of x.
+    @param[in]
+    x_ind     device pointer storing the nnz distinct 0-based indices of the nonzeros of x in y.
+    @param[in, out]
+    y         device pointer storing the dense vector y.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one x_val to the next one, for the strided_batched
+              variant.
+    @param[in]
+    stride_ind [rocblas_stride]
+              stride from the start of one x_ind to the next one, for the strided_batched
+              variant; 0 shares the indices between the batches.
+    @param[in]
+    stride_y  [rocblas_stride]
+              stride from the start of one y to the next one, for the strided_batched variant.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch, for the strided_batched variant.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_ssctr(rocblas_handle     handle,
+                                            rocblas_int        nnz,
+                                            const float*       x_val,
+                                            const rocblas_int* x_ind,
+                                            float*             y);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsctr(rocblas_handle     handle,
+                                            rocblas_int        nnz,
+                                            const double*      x_val,
+                                            const rocblas_int* x_ind,
+                                            double*            y);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csctr(rocblas_handle               handle,
+                                            rocblas_int                  nnz,
+                                            const rocblas_float_complex* x_val,
+                                            const rocblas_int*           x_ind,
+                                            rocblas_float_complex*       y);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zsctr(rocblas_handle                handle,
+                                            rocblas_int                   nnz,
+                                            const rocblas_double_complex* x_val,
+                                            const rocblas_int*            x_ind,
+                                            rocblas_double_complex*       y);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssctr_strided_batched(rocblas_handle     handle,
+                                                            rocblas_int        nnz,
+                                                            const float*       x_val,
+                                                            rocblas_stride     stride_x,
+                                                            const rocblas_int* x_ind,
+                                                            rocblas_stride     stride_ind,
+                                                            float*             y,
+                                                            rocblas_stride     stride_y,
+                                                            rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsctr_strided_batched(rocblas_handle     handle,
+                                                            rocblas_int        nnz,
+                                                            const double*      x_val,
+                                                            rocblas_stride     stride_x,
+                                                            const rocblas_int* x_ind,
+                                                            rocblas_stride     stride_ind,
+                                                            double*            y,
+                                                            rocblas_stride     stride_y,
+                                                            rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csctr_strided_batched(rocblas_handle               handle,
+                                                            rocblas_int                  nnz,
+                                                            const rocblas_float_complex* x_val,
+                                                            rocblas_stride               stride_x,
+                                                            const rocblas_int*           x_ind,
+                                                            rocblas_stride               stride_ind,
+                                                            rocblas_float_complex*       y,
+                                                            rocblas_stride               stride_y,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zsctr_strided_batched(rocblas_handle                handle,
+                                                            rocblas_int                   nnz,
+                                                            const rocblas_double_complex* x_val,
+                                                            rocblas_stride                stride_x,
+                                                            const rocblas_int*            x_ind,
+                                                            rocblas_stride          stride_ind,
+                                                            rocblas_double_complex* y,
+                                                            rocblas_stride          stride_y,
+                                                            rocblas_int             batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    roti applies a plane rotation to the sparse vector x and the elements of the dense vector y
+    at its indices,
+
+        (x_val[i], y[x_ind[i]]) := (c * x_val[i] + s * y[x_ind[i]], c * y[x_ind[i]] - s * x_val[i])
+
+    for i = 0, ..., nnz - 1. The strided_batched variants apply the same rotation to
+    batch_count pairs of vectors.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    nnz       [rocblas_int]
+              number of nonzeros of the sparse vector x.
+    @param[in, out]
+    x_val     device pointer storing the nnz values of x.
+    @param[in]
+    x_ind     device pointer storing the nnz distinct 0-based indices of the nonzeros of x in y.
+    @param[in, out]
+    y         device pointer storing the dense vector y.
+    @param[in]
+    c         device pointer or host pointer storing the scalar cosine component of the rotation.
+    @param[in]
+    s         device pointer or host pointer storing the scalar sine component of the rotation.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one x_val to the next one, for the strided_batched
+              variant.
+    @param[in]
+    stride_ind [rocblas_stride]
+              stride from the start of one x_ind to the next one, for the strided_batched
+              variant; 0 shares the indices between the batches.
+    @param[in]
+    stride_y  [rocblas_stride]
+              stride from the start of one y to the next one, for the strided_batched variant.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch, for the strided_batched variant.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sroti(rocblas_handle     handle,
+                                            rocblas_int        nnz,
+                                            float*             x_val,
+                                            const rocblas_int* x_ind,
+                                            float*             y,
+                                            const float*       c,
+                                            const float*       s);
+
+ROCBLAS_EXPORT rocblas_status rocblas_droti(rocblas_handle     handle,
+                                            rocblas_int        nnz,
+                                            double*            x_val,
+                                            const rocblas_int* x_ind,
+                                            double*            y,
+                                            const double*      c,
+                                            const double*      s);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sroti_strided_batched(rocblas_handle     handle,
+                                                            rocblas_int        nnz,
+                                                            float*             x_val,
+                                                            rocblas_stride     stride_x,
+                                                            const rocblas_int* x_ind,
+                                                            rocblas_stride     stride_ind,
+                                                            float*             y,
+                                                            rocblas_stride     stride_y,
+                                                            const float*       c,
+                                                            const float*       s,
+                                                            rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_droti_strided_batched(rocblas_handle     handle,
+                                                            rocblas_int        nnz,
+                                                            double*            x_val,
+                                                            rocblas_stride     stride_x,
+                                                            const rocblas_int* x_ind,
+                                                            rocblas_stride     stride_ind,
+                                                            double*            y,
+                                                            rocblas_stride     stride_y,
+                                                            const double*      c,
+                                                            const double*      s,
+                                                            rocblas_int        batch_count);
+//! @}
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_level1_fusion enables or disables the deferred execution of Level 1 functions
+    on a handle, which fuses a sequence of them into one kernel. While enabled, rocblas_Xaxpy,
+    rocblas_Xscal and rocblas_Xcopy for float and double, with unit increments and, for axpy
+    and scal, in rocblas_pointer_mode_host, are queued on the handle instead of being run, as
+    long as they have the same length n. The queue runs as one kernel which reads each vector
+    once, applies the queued operations element by element, and writes each updated vector
+    once. A rocblas_Xdot or rocblas_snrm2 call with unit increments and the same n runs the
+    queue in the same kernel, its reduction reading the updated values of the vectors and
+    summing in double.
+
+    The queue also runs when rocblas_flush_level1_fusion is called, when the fusion is disabled,
+    when the stream of the handle is changed, when the handle is destroyed, and before any other
+    Level 1 function named above is run, such as one of another length or precision, or on a
+    vector which partially overlaps a queued one. Until then the queued operations have not
+    been enqueued on the stream: the queue must be flushed before the vectors are used by other
+    rocBLAS functions, by other libraries or by the host. At most 8 operations on at most 8
+    distinct vectors are queued. Scalars are read when the call is made. Calls are not deferred
+    with numerical checking, and reductions are not fused in reproducible or compensated
+    summation mode. Disabled by default.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    enable    [bool]
+              whether Level 1 calls are deferred for fusion.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_level1_fusion(rocblas_handle handle, bool enable);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_level1_fusion returns whether Level 1 calls are deferred for fusion on a handle.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    enabled   [bool*]
+              whether Level 1 calls are deferred for fusion.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_level1_fusion(rocblas_handle handle, bool* enabled);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_flush_level1_fusion enqueues the Level 1 operations deferred on a handle by
+    rocblas_set_level1_fusion on its stream, as one kernel. It does not synchronize the stream.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_flush_level1_fusion(rocblas_handle handle);
+
+/*! \brief Triangular matrix with the inverses of its diagonal blocks, created once with
+    rocblas_create_triangular_factor and reused by rocblas_trsm_factor and rocblas_trsv_factor */
+typedef struct _rocblas_triangular_factor* rocblas_triangular_factor;
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_create_triangular_factor inverts the diagonal blocks of each of batch_count
+    triangular matrices A of order k, for a factor which is solved with many times, such as the
+    Cholesky or LU factor of an iterative solver. rocblas_trsm, rocblas_trsv and their batched
+    forms invert the diagonal blocks on every call; rocblas_trsm_factor and rocblas_trsv_factor
+    only apply the inverses held by the factor. The inverses have the invA layout of
+    rocblas_trsm_ex, which rocblas_get_triangular_factor_inverse returns for use with the
+    rocblas_trsm_ex functions directly.
+
+    The factor refers to A, which must not be changed or freed while the factor is in use.
+    The inverses are allocated on the device of the handle with hipMalloc, and computed on the
+    stream of the handle, so this function returns rocblas_status_not_implemented in graph safe
+    mode. The factor must be released with rocblas_destroy_triangular_factor.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              - rocblas_fill_upper:  A is an upper triangular matrix.
+              - rocblas_fill_lower:  A is a lower triangular matrix.
+    @param[in]
+    diag      [rocblas_diagonal]
+              - rocblas_diagonal_unit:     A is assumed to be unit triangular.
+              - rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
+    @param[in]
+    k         [rocblas_int]
+              k specifies the order of A.
+    @param[in]
+    A         [const void *]
+              device pointer to the first matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    stride_A  [rocblas_stride]
+              stride from the start of one A matrix to the next.
+    @param[in]
+    batch_count
+              [rocblas_int]
+              number of matrices A; 1 for a single matrix.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              rocblas_datatype_f32_r, rocblas_datatype_f64_r, rocblas_datatype_f32_c or
+              rocblas_datatype_f64_c.
+    @param[out]
+    factor    [rocblas_triangular_factor*]
+              pointer to where the factor will be stored.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status
+    rocblas_create_triangular_factor(rocblas_handle             handle,
+                                     rocblas_fill               uplo,
+                                     rocblas_diagonal           diag,
+                                     rocblas_int                k,
+                                     const void*                A,
+                                     rocblas_int                lda,
+                                     rocblas_stride             stride_A,
+                                     rocblas_int                batch_count,
+                                     rocblas_datatype           compute_type,
+                                     rocblas_triangular_factor* factor);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_create_triangular_factor_batched is rocblas_create_triangular_factor for an array
+    of pointers to the matrices A. The array must not be changed or freed while the factor is
+    in use.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether A is upper or lower triangular.
+    @param[in]
+    diag      [rocblas_diagonal]
+              specifies whether A is unit triangular.
+    @param[in]
+    k         [rocblas_int]
+              k specifies the order of each A_i.
+    @param[in]
+    A         [const void * const]
+              device array of device pointers storing each matrix A_i.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    batch_count
+              [rocblas_int]
+              number of matrices A_i.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              rocblas_datatype_f32_r, rocblas_datatype_f64_r, rocblas_datatype_f32_c or
+              rocblas_datatype_f64_c.
+    @param[out]
+    factor    [rocblas_triangular_factor*]
+              pointer to where the factor will be stored.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status
+    rocblas_create_triangular_factor_batched(rocblas_handle             handle,
+                                             rocblas_fill               uplo,
+                                             rocblas_diagonal           diag,
+                                             rocblas_int                k,
+                                             const void* const          A[],
+                                             rocblas_int                lda,
+                                             rocblas_int                batch_count,
+                                             rocblas_datatype           compute_type,
+                                             rocblas_triangular_factor* factor);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_destroy_triangular_factor releases a factor created with
+    rocblas_create_triangular_factor or rocblas_create_triangular_factor_batched, once the
+    functions using it have completed.
+
+    @param[in]
+    factor    [rocblas_triangular_factor]
+              the factor to release; may be nullptr.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_destroy_triangular_factor(rocblas_triangular_factor factor);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_triangular_factor_inverse returns the inverted diagonal blocks of a factor as the
+    invA, invA_size and stride_invA arguments of rocblas_trsm_ex and
+    rocblas_trsm_strided_batched_ex, or, for a factor created with
+    rocblas_create_triangular_factor_batched, as the device array of pointers invA of
+    rocblas_trsm_batched_ex. They are valid until the factor is destroyed.
+
+    @param[in]
+    factor    [rocblas_triangular_factor]
+              the factor.
+    @param[out]
+    invA      [const void**]
+              the device pointer to the inverses.
+    @param[out]
+    invA_size [rocblas_int*]
+              the number of elements of the inverses of each matrix A.
+    @param[out]
+    stride_invA
+              [rocblas_stride*]
+              the stride from the start of the inverses of one matrix A to the next.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status
+    rocblas_get_triangular_factor_inverse(rocblas_triangular_factor factor,
+                                          const void**              invA,
+                                          rocblas_int*              invA_size,
+                                          rocblas_stride*           stride_invA);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_trsm_factor solves
+
+        op(A)*X = alpha*B or X*op(A) = alpha*B,
+
+    for each matrix A of a factor, with the diagonal block inverses computed when the factor
+    was created, as rocblas_trsm_ex with a supplied invA does. X is overwritten on B.
+    For a factor created with rocblas_create_triangular_factor_batched, B is a device array of
+    device pointers to the matrices B_i, and stride_B is unused.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    factor    [rocblas_triangular_factor]
+              the factor holding A.
+    @param[in]
+    side      [rocblas_side]
+              - rocblas_side_left:       op(A)*X = alpha*B, m must be the order k of A.
+              - rocblas_side_right:      X*op(A) = alpha*B, n must be the order k of A.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op(A).
+    @param[in]
+    m         [rocblas_int]
+              m specifies the number of rows of B.
+    @param[in]
+    n         [rocblas_int]
+              n specifies the number of columns of B.
+    @param[in]
+    alpha     [void *]
+              device pointer or host pointer specifying the scalar alpha, of the compute type
+              of the factor.
+    @param[inout]
+    B         [void *]
+              device pointer to the first matrix B, or device array of device pointers to the
+              matrices B_i.
+    @param[in]
+    ldb       [rocblas_int]
+              ldb specifies the leading dimension of B.
+    @param[in]
+    stride_B  [rocblas_stride]
+              stride from the start of one B matrix to the next.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_trsm_factor(rocblas_handle            handle,
+                                                  rocblas_triangular_factor factor,
+                                                  rocblas_side              side,
+                                                  rocblas_operation         transA,
+                                                  rocblas_int               m,
+                                                  rocblas_int               n,
+                                                  const void*               alpha,
+                                                  void*                     B,
+                                                  rocblas_int               ldb,
+                                                  rocblas_stride            stride_B);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_trsv_factor solves
+
+        op(A)*x = b,
+
+    for each matrix A of a factor, with the diagonal block inverses computed when the factor
+    was created. The solution x is overwritten on b. For a factor created with
+    rocblas_create_triangular_factor_batched, x is a device array of device pointers to the
+    vectors x_i, and stride_x is unused.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    factor    [rocblas_triangular_factor]
+              the factor holding A.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op(A).
+    @param[inout]
+    x         [void *]
+              device pointer to the first vector x, or device array of device pointers to the
+              vectors x_i, of k elements each.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one x vector to the next.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_trsv_factor(rocblas_handle            handle,
+                                                  rocblas_triangular_factor factor,
+                                                  rocblas_operation         transA,
+                                                  void*                     x,
+                                                  rocblas_int               incx,
+                                                  rocblas_stride            stride_x);
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    trttf copies the triangle uplo of the full matrix A to ARF, in Rectangular Full Packed
+    (RFP) format.
+
+    The RFP format stores the triangle uplo of an n by n symmetric, Hermitian or triangular
+    matrix in n*(n+1)/2 elements, as a full matrix with no wasted element so that the
+    routines on it are Level 3 BLAS calls. It is the LAPACK RFP format: if transr is
+    rocblas_operation_none, ARF is an (n+1) by n/2 matrix for even n, or n by (n+1)/2 for odd
+    n; otherwise it is its transpose (conjugate transpose for complex types).
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transr    [rocblas_operation]
+              rocblas_operation_none: ARF is in normal RFP format.
+              rocblas_operation_transpose (real types) or rocblas_operation_conjugate_transpose:
+              ARF is in transposed RFP format.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies the triangle of the matrix which is stored.
+    @param[in]
+    n         [rocblas_int]
+              order of the matrix.
+    @param[in]
+    A         device pointer storing the n by n matrix A; only its triangle uplo is read.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, lda >= max(1, n).
+    @param[out]
+    ARF       device pointer storing the triangle uplo of A in RFP format, n*(n+1)/2 elements.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_strttf(rocblas_handle    handle,
+                                             rocblas_operation transr,
+                                             rocblas_fill      uplo,
+                                             rocblas_int       n,
+                                             const float*      A,
+                                             rocblas_int       lda,
+                                             float*            ARF);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrttf(rocblas_handle    handle,
+                                             rocblas_operation transr,
+                                             rocblas_fill      uplo,
+                                             rocblas_int       n,
+                                             const double*     A,
+                                             rocblas_int       lda,
+                                             double*           ARF);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ctrttf(rocblas_handle               handle,
+                                             rocblas_operation            transr,
+                                             rocblas_fill                 uplo,
+                                             rocblas_int                  n,
+                                             const rocblas_float_complex* A,
+                                             rocblas_int                  lda,
+                                             rocblas_float_complex*       ARF);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ztrttf(rocblas_handle                handle,
+                                             rocblas_operation             transr,
+                                             rocblas_fill                  uplo,
+                                             rocblas_int                   n,
+                                             const rocblas_double_complex* A,
+                                             rocblas_int                   lda,
+                                             rocblas_double_complex*       ARF);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    tfttr copies the matrix ARF in Rectangular Full Packed (RFP) format to the triangle uplo
+    of the full matrix A, the other triangle of A is not referenced.
+
+    The RFP format stores the triangle uplo of an n by n symmetric, Hermitian or triangular
+    matrix in n*(n+1)/2 elements, as a full matrix with no wasted element so that the
+    routines on it are Level 3 BLAS calls. It is the LAPACK RFP format: if transr is
+    rocblas_operation_none, ARF is an (n+1) by n/2 matrix for even n, or n by (n+1)/2 for odd
+    n; otherwise it is its transpose (conjugate transpose for complex types).
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transr    [rocblas_operation]
+              rocblas_operation_none: ARF is in normal RFP format.
+              rocblas_operation_transpose (real types) or rocblas_operation_conjugate_transpose:
+              ARF is in transposed RFP format.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies the triangle of the matrix which is stored.
+    @param[in]
+    n         [rocblas_int]
+              order of the matrix.
+    @param[in]
+    ARF       device pointer storing the triangle uplo of A in RFP format, n*(n+1)/2 elements.
+    @param[out]
+    A         device pointer storing the n by n matrix A; only its triangle uplo is written.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, lda >= max(1, n).
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_stfttr(rocblas_handle    handle,
+                                             rocblas_operation transr,
+                                             rocblas_fill      uplo,
+                                             rocblas_int       n,
+                                             const float*      ARF,
+                                             float*            A,
+                                             rocblas_int       lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtfttr(rocblas_handle    handle,
+                                             rocblas_operation transr,
+                                             rocblas_fill      uplo,
+                                             rocblas_int       n,
+                                             const double*     ARF,
+                                             double*           A,
+                                             rocblas_int       lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ctfttr(rocblas_handle               handle,
+                                             rocblas_operation            transr,
+                                             rocblas_fill                 uplo,
+                                             rocblas_int                  n,
+                                             const rocblas_float_complex* ARF,
+                                             rocblas_float_complex*       A,
+                                             rocblas_int                  lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ztfttr(rocblas_handle                handle,
+                                             rocblas_operation             transr,
+                                             rocblas_fill                  uplo,
+                                             rocblas_int                   n,
+                                             const rocblas_double_complex* ARF,
+                                             rocblas_double_complex*       A,
+                                             rocblas_int                   lda);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    tpttf copies the triangle uplo of A in packed format to ARF, in Rectangular Full Packed
+    (RFP) format.
+
+    The RFP format stores the triangle uplo of an n by n symmetric, Hermitian or triangular
+    matrix in n*(n+1)/2 elements, as a full matrix with no wasted element so that the
+    routines on it are Level 3 BLAS calls. It is the LAPACK RFP format: if transr is
+    rocblas_operation_none, ARF is an (n+1) by n/2 matrix for even n, or n by (n+1)/2 for odd
+    n; otherwise it is its transpose (conjugate transpose for complex types).
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transr    [rocblas_operation]
+              rocblas_operation_none: ARF is in normal RFP format.
+              rocblas_operation_transpose (real types) or rocblas_operation_conjugate_transpose:
+              ARF is in transposed RFP format.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies the triangle of the matrix which is stored.
+    @param[in]
+    n         [rocblas_int]
+              order of the matrix.
+    @param[in]
+    AP        device pointer storing the triangle uplo of A in packed format, as in
+              rocblas_Xspmv, n*(n+1)/2 elements.
+    @param[out]
+    ARF       device pointer storing the triangle uplo of A in RFP format, n*(n+1)/2 elements.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_stpttf(rocblas_handle    handle,
+                                             rocblas_operation transr,
+                                             rocblas_fill      uplo,
+                                             rocblas_int       n,
+                                             const float*      AP,
+                                             float*            ARF);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtpttf(rocblas_handle    handle,
+                                             rocblas_operation transr,
+                                             rocblas_fill      uplo,
+                                             rocblas_int       n,
+                                             const double*     AP,
+                                             double*           ARF);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ctpttf(rocblas_handle               handle,
+                                             rocblas_operation            transr,
+                                             rocblas_fill                 uplo,
+                                             rocblas_int                  n,
+                                             const rocblas_float_complex* AP,
+                                             rocblas_float_complex*       ARF);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ztpttf(rocblas_handle                handle,
+                                             rocblas_operation             transr,
+                                             rocblas_fill                  uplo,
+                                             rocblas_int                   n,
+                                             const rocblas_double_complex* AP,
+                                             rocblas_double_complex*       ARF);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    tfttp copies the matrix ARF in Rectangular Full Packed (RFP) format to AP, in packed
+    format.
+
+    The RFP format stores the triangle uplo of an n by n symmetric, Hermitian or triangular
+    matrix in n*(n+1)/2 elements, as a full matrix with no wasted element so that the
+    routines on it are Level 3 BLAS calls. It is the LAPACK RFP format: if transr is
+    rocblas_operation_none, ARF is an (n+1) by n/2 matrix for even n, or n by (n+1)/2 for odd
+    n; otherwise it is its transpose (conjugate transpose for complex types).
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transr    [rocblas_operation]
+              rocblas_operation_none: ARF is in normal RFP format.
+              rocblas_operation_transpose (real types) or rocblas_operation_conjugate_transpose:
+              ARF is in transposed RFP format.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies the triangle of the matrix which is stored.
+    @param[in]
+    n         [rocblas_int]
+              order of the matrix.
+    @param[in]
+    ARF       device pointer storing the triangle uplo of A in RFP format, n*(n+1)/2 elements.
+    @param[out]
+    AP        device pointer storing the triangle uplo of A in packed format, as in
+              rocblas_Xspmv, n*(n+1)/2 elements.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_stfttp(rocblas_handle    handle,
+                                             rocblas_operation transr,
+                                             rocblas_fill      uplo,
+                                             rocblas_int       n,
+                                             const float*      ARF,
+                                             float*            AP);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtfttp(rocblas_handle    handle,
+                                             rocblas_operation transr,
+                                             rocblas_fill      uplo,
+                                             rocblas_int       n,
+                                             const double*     ARF,
+                                             double*           AP);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ctfttp(rocblas_handle               handle,
+                                             rocblas_operation            transr,
+                                             rocblas_fill                 uplo,
+                                             rocblas_int                  n,
+                                             const rocblas_float_complex* ARF,
+                                             rocblas_float_complex*       AP);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ztfttp(rocblas_handle                handle,
+                                             rocblas_operation             transr,
+                                             rocblas_fill                  uplo,
+                                             rocblas_int                   n,
+                                             const rocblas_double_complex* ARF,
+                                             rocblas_double_complex*       AP);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    sfrk (hfrk for complex types) performs the symmetric (Hermitian) rank k update
+
+        C := alpha*op( A )*op( A )**H + beta*C,
+
+    where alpha and beta are real scalars, op( A ) an n by k matrix and C an n by n symmetric
+    (Hermitian) matrix stored in Rectangular Full Packed (RFP) format, see rocblas_Xtrttf.
+    The update is two rocblas_Xsyrk (rocblas_Xherk) calls on the diagonal blocks of C and one
+    rocblas_Xgemm on its off-diagonal block.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transr    [rocblas_operation]
+              rocblas_operation_none: C is in normal RFP format.
+              rocblas_operation_transpose (real types) or rocblas_operation_conjugate_transpose:
+              C is in transposed RFP format.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies the triangle of C which is stored.
+    @param[in]
+    trans     [rocblas_operation]
+              rocblas_operation_none: op( A ) = A.
+              rocblas_operation_transpose (real types) or rocblas_operation_conjugate_transpose:
+              op( A ) = A**H.
+    @param[in]
+    n         [rocblas_int]
+              order of C.
+    @param[in]
+    k         [rocblas_int]
+              number of columns of op( A ).
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, lda >= max(1, n) if trans is
+              rocblas_operation_none and lda >= max(1, k) otherwise.
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[in, out]
+    C         device pointer storing C in RFP format, n*(n+1)/2 elements.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_ssfrk(rocblas_handle    handle,
+                                            rocblas_operation transr,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation trans,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            rocblas_int       lda,
+                                            const float*      beta,
+                                            float*            C);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsfrk(rocblas_handle    handle,
+                                            rocblas_operation transr,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation trans,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            const double*     beta,
+                                            double*           C);
+
+ROCBLAS_EXPORT rocblas_status rocblas_chfrk(rocblas_handle               handle,
+                                            rocblas_operation            transr,
+                                            rocblas_fill                 uplo,
+                                            rocblas_operation            trans,
+                                            rocblas_int                  n,
+                                            rocblas_int                  k,
+                                            const float*                 alpha,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
+                                            const float*                 beta,
+                                            rocblas_float_complex*       C);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zhfrk(rocblas_handle                handle,
+                                            rocblas_operation             transr,
+                                            rocblas_fill                  uplo,
+                                            rocblas_operation             trans,
+                                            rocblas_int                   n,
+                                            rocblas_int                   k,
+                                            const double*                 alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            const double*                 beta,
+                                            rocblas_double_complex*       C);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    tfsm solves
+
+        op( A )*X = alpha*B,   if side == rocblas_side_left, or
+        X*op( A ) = alpha*B,   if side == rocblas_side_right,
+
+    for X, where alpha is a scalar, B an m by n matrix and A a triangular matrix stored in
+    Rectangular Full Packed (RFP) format, see rocblas_Xtrttf. X overwrites B. The solve is two
+    rocblas_Xtrsm calls with the diagonal blocks of A and one rocblas_Xgemm with its
+    off-diagonal block.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transr    [rocblas_operation]
+              rocblas_operation_none: A is in normal RFP format.
+              rocblas_operation_transpose (real types) or rocblas_operation_conjugate_transpose:
+              A is in transposed RFP format.
+    @param[in]
+    side      [rocblas_side]
+              specifies the side of op( A ).
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether A is lower or upper triangular.
+    @param[in]
+    trans     [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    diag      [rocblas_diagonal]
+              specifies whether A is unit triangular.
+    @param[in]
+    m         [rocblas_int]
+              number of rows of B.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of B.
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    A         device pointer storing A in RFP format, of order m if side is rocblas_side_left
+              and n otherwise.
+    @param[in, out]
+    B         device pointer storing matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B, ldb >= max(1, m).
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_stfsm(rocblas_handle    handle,
+                                            rocblas_operation transr,
+                                            rocblas_side      side,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation trans,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            float*            B,
+                                            rocblas_int       ldb);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtfsm(rocblas_handle    handle,
+                                            rocblas_operation transr,
+                                            rocblas_side      side,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation trans,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            double*           B,
+                                            rocblas_int       ldb);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ctfsm(rocblas_handle               handle,
+                                            rocblas_operation            transr,
+                                            rocblas_side                 side,
+                                            rocblas_fill                 uplo,
+                                            rocblas_operation            trans,
+                                            rocblas_diagonal             diag,
+                                            rocblas_int                  m,
+                                            rocblas_int                  n,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* A,
+                                            rocblas_float_complex*       B,
+                                            rocblas_int                  ldb);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ztfsm(rocblas_handle                handle,
+                                            rocblas_operation             transr,
+                                            rocblas_side                  side,
+                                            rocblas_fill                  uplo,
+                                            rocblas_operation             trans,
+                                            rocblas_diagonal              diag,
+                                            rocblas_int                   m,
+                                            rocblas_int                   n,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_double_complex*       B,
+                                            rocblas_int                   ldb);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    symv_ex performs the matrix-vector operation
+
+        y := alpha*A*x + beta*y,
+
+    where alpha and beta are scalars, x and y are n element vectors and A is an n by n
+    symmetric matrix, of which the uplo triangle is stored, with independent datatypes for
+    A and x and for y, alpha and beta being of the compute type. symv_batched_ex and
+    symv_strided_batched_ex compute batch_count such operations, with A, x and y given as
+    device arrays of device pointers, or as strided batches.
+
+    For the f16_r and bf16_r types, each element of the stored triangle is read once, 128 bits
+    at a time where possible, and used for both triangles; the products are accumulated in
+    f32_r in device memory allocated from the handle and y is rounded once. The other types
+    are computed as by the symv functions of that type.
+
+    Currently supported datatypes are as follows:
+
+    ----------------------------------------------------
+    | a_type | x_type |     y_type      | compute_type |
+    |--------|--------|-----------------|--------------|
+    | f16_r  | f16_r  | f16_r or f32_r  |    f32_r     |
+    | bf16_r | bf16_r | bf16_r or f32_r |    f32_r     |
+    | f32_r  | f32_r  |      f32_r      |    f32_r     |
+    | f64_r  | f64_r  |      f64_r      |    f64_r     |
+    | f32_c  | f32_c  |      f32_c      |    f32_c     |
+    | f64_c  | f64_c  |      f64_c      |    f64_c     |
+    ----------------------------------------------------
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper (rocblas_fill_upper) or lower (rocblas_fill_lower)
+              triangle of A is referenced.
+    @param[in]
+    n         [rocblas_int]
+              number of rows and columns of matrix A.
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha, of compute_type.
+    @param[in]
+    A         device pointer storing matrix A, or device array of batch_count device
+              pointers to each matrix A_i for symv_batched_ex.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, at least max(1, n).
+    @param[in]
+    stride_a  [rocblas_stride]
+              stride from the start of one matrix A_i to the next, for
+              symv_strided_batched_ex.
+    @param[in]
+    x         device pointer storing vector x, or device array of batch_count device
+              pointers to each vector x_i for symv_batched_ex.
+    @param[in]
+    x_type    [rocblas_datatype]
+              specifies the datatype of vector x, the same as a_type.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one vector x_i to the next, for
+              symv_strided_batched_ex.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta, of compute_type.
+    @param[inout]
+    y         device pointer storing vector y, or device array of batch_count device
+              pointers to each vector y_i for symv_batched_ex.
+    @param[in]
+    y_type    [rocblas_datatype]
+              specifies the datatype of vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[in]
+    stride_y  [rocblas_stride]
+              stride from the start of one vector y_i to the next, for
+              symv_strided_batched_ex.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch, for the batched functions.
+    @param[in]
+    compute_type [rocblas_datatype]
+              specifies the datatype of computation, and of alpha and beta.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_symv_ex(rocblas_handle   handle,
+                                              rocblas_fill     uplo,
+                                              rocblas_int      n,
+                                              const void*      alpha,
+                                              const void*      A,
+                                              rocblas_datatype a_type,
+                                              rocblas_int      lda,
+                                              const void*      x,
+                                              rocblas_datatype x_type,
+                                              rocblas_int      incx,
+                                              const void*      beta,
+                                              void*            y,
+                                              rocblas_datatype y_type,
+                                              rocblas_int      incy,
+                                              rocblas_datatype compute_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_symv_batched_ex(rocblas_handle   handle,
+                                                      rocblas_fill     uplo,
+                                                      rocblas_int      n,
+                                                      const void*      alpha,
+                                                      const void*      A,
+                                                      rocblas_datatype a_type,
+                                                      rocblas_int      lda,
+                                                      const void*      x,
+                                                      rocblas_datatype x_type,
+                                                      rocblas_int      incx,
+                                                      const void*      beta,
+                                                      void*            y,
+                                                      rocblas_datatype y_type,
+                                                      rocblas_int      incy,
+                                                      rocblas_int      batch_count,
+                                                      rocblas_datatype compute_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_symv_strided_batched_ex(rocblas_handle   handle,
+                                                              rocblas_fill     uplo,
+                                                              rocblas_int      n,
+                                                              const void*      alpha,
+                                                              const void*      A,
+                                                              rocblas_datatype a_type,
+                                                              rocblas_int      lda,
+                                                              rocblas_stride   stride_a,
+                                                              const void*      x,
+                                                              rocblas_datatype x_type,
+                                                              rocblas_int      incx,
+                                                              rocblas_stride   stride_x,
+                                                              const void*      beta,
+                                                              void*            y,
+                                                              rocblas_datatype y_type,
+                                                              rocblas_int      incy,
+                                                              rocblas_stride   stride_y,
+                                                              rocblas_int      batch_count,
+                                                              rocblas_datatype compute_type);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    ger_ex performs the rank 1 update
+
+        A := A + alpha*x*y**T,
+
+    and syr2_ex the symmetric rank 2 update of the uplo triangle of A
+
+        A := A + alpha*x*y**T + alpha*y*x**T,
+
+    where alpha is a scalar, x and y are vectors and A is an m by n matrix, n by n for
+    syr2_ex, with alpha being of the compute type. The batched and strided batched functions
+    compute batch_count such operations, with A, x and y given as device arrays of device
+    pointers, or as strided batches.
+
+    For the f16_r and bf16_r types, A is read and written 128 bits at a time where possible
+    and updated in f32_r, so that each element is rounded once. The other types are computed
+    as by the ger (geru) and syr2 functions of that type.
+
+    Currently supported datatypes are as follows:
+
+    -------------------------------------------
+    | x_type | y_type | a_type | compute_type |
+    |--------|--------|--------|--------------|
+    | f16_r  | f16_r  | f16_r  |    f32_r     |
+    | bf16_r | bf16_r | bf16_r |    f32_r     |
+    | f32_r  | f32_r  | f32_r  |    f32_r     |
+    | f64_r  | f64_r  | f64_r  |    f64_r     |
+    | f32_c  | f32_c  | f32_c  |    f32_c     |
+    | f64_c  | f64_c  | f64_c  |    f64_c     |
+    -------------------------------------------
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper (rocblas_fill_upper) or lower (rocblas_fill_lower)
+              triangle of A is updated, for syr2_ex.
+    @param[in]
+    m         [rocblas_int]
+              number of rows of matrix A, for ger_ex.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of matrix A.
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha, of compute_type.
+    @param[in]
+    x         device pointer storing vector x, or device array of batch_count device
+              pointers to each vector x_i for the batched functions.
+    @param[in]
+    x_type    [rocblas_datatype]
+              specifies the datatype of vector x, the same as a_type.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one vector x_i to the next, for the strided batched
+              functions.
+    @param[in]
+    y         device pointer storing vector y, or device array of batch_count device
+              pointers to each vector y_i for the batched functions.
+    @param[in]
+    y_type    [rocblas_datatype]
+              specifies the datatype of vector y, the same as a_type.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[in]
+    stride_y  [rocblas_stride]
+              stride from the start of one vector y_i to the next, for the strided batched
+              functions.
+    @param[inout]
+    A         device pointer storing matrix A, or device array of batch_count device
+              pointers to each matrix A_i for the batched functions.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, at least max(1, m), max(1, n) for
+              syr2_ex.
+    @param[in]
+    stride_a  [rocblas_stride]
+              stride from the start of one matrix A_i to the next, for the strided batched
+              functions.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch, for the batched functions.
+    @param[in]
+    compute_type [rocblas_datatype]
+              specifies the datatype of computation, and of alpha.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_ger_ex(rocblas_handle   handle,
+                                             rocblas_int      m,
+                                             rocblas_int      n,
+                                             const void*      alpha,
+                                             const void*      x,
+                                             rocblas_datatype x_type,
+                                             rocblas_int      incx,
+                                             const void*      y,
+                                             rocblas_datatype y_type,
+                                             rocblas_int      incy,
+                                             void*            A,
+                                             rocblas_datatype a_type,
+                                             rocblas_int      lda,
+                                             rocblas_datatype compute_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ger_batched_ex(rocblas_handle   handle,
+                                                     rocblas_int      m,
+                                                     rocblas_int      n,
+                                                     const void*      alpha,
+                                                     const void*      x,
+                                                     rocblas_datatype x_type,
+                                                     rocblas_int      incx,
+                                                     const void*      y,
+                                                     rocblas_datatype y_type,
+                                                     rocblas_int      incy,
+                                                     void*            A,
+                                                     rocblas_datatype a_type,
+                                                     rocblas_int      lda,
+                                                     rocblas_int      batch_count,
+                                                     rocblas_datatype compute_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ger_strided_batched_ex(rocblas_handle   handle,
+                                                             rocblas_int      m,
+                                                             rocblas_int      n,
+                                                             const void*      alpha,
+                                                             const void*      x,
+                                                             rocblas_datatype x_type,
+                                                             rocblas_int      incx,
+                                                             rocblas_stride   stride_x,
+                                                             const void*      y,
+                                                             rocblas_datatype y_type,
+                                                             rocblas_int      incy,
+                                                             rocblas_stride   stride_y,
+                                                             void*            A,
+                                                             rocblas_datatype a_type,
+                                                             rocblas_int      lda,
+                                                             rocblas_stride   stride_a,
+                                                             rocblas_int      batch_count,
+                                                             rocblas_datatype compute_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_syr2_ex(rocblas_handle   handle,
+                                              rocblas_fill     uplo,
+                                              rocblas_int      n,
+                                              const void*      alpha,
+                                              const void*      x,
+                                              rocblas_datatype x_type,
+                                              rocblas_int      incx,
+                                              const void*      y,
+                                              rocblas_datatype y_type,
+                                              rocblas_int      incy,
+                                              void*            A,
+                                              rocblas_datatype a_type,
+                                              rocblas_int      lda,
+                                              rocblas_datatype compute_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_syr2_batched_ex(rocblas_handle   handle,
+                                                      rocblas_fill     uplo,
+                                                      rocblas_int      n,
+                                                      const void*      alpha,
+                                                      const void*      x,
+                                                      rocblas_datatype x_type,
+                                                      rocblas_int      incx,
+                                                      const void*      y,
+                                                      rocblas_datatype y_type,
+                                                      rocblas_int      incy,
+                                                      void*            A,
+                                                      rocblas_datatype a_type,
+                                                      rocblas_int      lda,
+                                                      rocblas_int      batch_count,
+                                                      rocblas_datatype compute_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_syr2_strided_batched_ex(rocblas_handle   handle,
+                                                              rocblas_fill     uplo,
+                                                              rocblas_int      n,
+                                                              const void*      alpha,
+                                                              const void*      x,
+                                                              rocblas_datatype x_type,
+                                                              rocblas_int      incx,
+                                                              rocblas_stride   stride_x,
+                                                              const void*      y,
+                                                              rocblas_datatype y_type,
+                                                              rocblas_int      incy,
+                                                              rocblas_stride   stride_y,
+                                                              void*            A,
+                                                              rocblas_datatype a_type,
+                                                              rocblas_int      lda,
+                                                              rocblas_stride   stride_a,
+                                                              rocblas_int      batch_count,
+                                                              rocblas_datatype compute_type);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    trmv_ex performs the matrix-vector operations
+
+        x := A*x,   or   x := A**T*x,   or   x := A**H*x,
+
+    where x is an n element vector and A is an n by n unit or non-unit, upper or lower
+    triangular matrix, with the compute type of the products. The batched and strided
+    batched functions compute batch_count such operations, with A and x given as device
+    arrays of device pointers, or as strided batches.
+
+    For the f16_r and bf16_r types, A is read 128 bits at a time where possible, the products
+    are accumulated in f32_r in device memory allocated from the handle and x is rounded once.
+    The other types are computed as by the trmv functions of that type.
+
+    Currently supported datatypes are as follows:
+
+    ----------------------------------
+    | a_type | x_type | compute_type |
+    |--------|--------|--------------|
+    | f16_r  | f16_r  |    f32_r     |
+    | bf16_r | bf16_r |    f32_r     |
+    | f32_r  | f32_r  |    f32_r     |
+    | f64_r  | f64_r  |    f64_r     |
+    | f32_c  | f32_c  |    f32_c     |
+    | f64_c  | f64_c  |    f64_c     |
+    ----------------------------------
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether A is upper (rocblas_fill_upper) or lower (rocblas_fill_lower)
+              triangular.
+    @param[in]
+    transA    [rocblas_operation]
+              indicates whether matrix A is tranposed (conjugated) or not.
+    @param[in]
+    diag      [rocblas_diagonal]
+              specifies whether A is unit triangular (rocblas_diagonal_unit), its diagonal
+              then not being referenced, or not (rocblas_diagonal_non_unit).
+    @param[in]
+    n         [rocblas_int]
+              number of rows and columns of matrix A.
+    @param[in]
+    A         device pointer storing matrix A, or device array of batch_count device
+              pointers to each matrix A_i for trmv_batched_ex.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, at least max(1, n).
+    @param[in]
+    stride_a  [rocblas_stride]
+              stride from the start of one matrix A_i to the next, for
+              trmv_strided_batched_ex.
+    @param[inout]
+    x         device pointer storing vector x, or device array of batch_count device
+              pointers to each vector x_i for trmv_batched_ex.
+    @param[in]
+    x_type    [rocblas_datatype]
+              specifies the datatype of vector x, the same as a_type.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one vector x_i to the next, for
+              trmv_strided_batched_ex.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch, for the batched functions.
+    @param[in]
+    compute_type [rocblas_datatype]
+              specifies the datatype of computation.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_trmv_ex(rocblas_handle    handle,
+                                              rocblas_fill      uplo,
+                                              rocblas_operation transA,
+                                              rocblas_diagonal  diag,
+                                              rocblas_int       n,
+                                              const void*       A,
+                                              rocblas_datatype  a_type,
+                                              rocblas_int       lda,
+                                              void*             x,
+                                              rocblas_datatype  x_type,
+                                              rocblas_int       incx,
+                                              rocblas_datatype  compute_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_trmv_batched_ex(rocblas_handle    handle,
+                                                      rocblas_fill      uplo,
+                                                      rocblas_operation transA,
+                                                      rocblas_diagonal  diag,
+                                                      rocblas_int       n,
+                                                      const void*       A,
+                                                      rocblas_datatype  a_type,
+                                                      rocblas_int       lda,
+                                                      void*             x,
+                                                      rocblas_datatype  x_type,
+                                                      rocblas_int       incx,
+                                                      rocblas_int       batch_count,
+                                                      rocblas_datatype  compute_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_trmv_strided_batched_ex(rocblas_handle    handle,
+                                                              rocblas_fill      uplo,
+                                                              rocblas_operation transA,
+                                                              rocblas_diagonal  diag,
+                                                              rocblas_int       n,
+                                                              const void*       A,
+                                                              rocblas_datatype  a_type,
+                                                              rocblas_int       lda,
+                                                              rocblas_stride    stride_a,
+                                                              void*             x,
+                                                              rocblas_datatype  x_type,
+                                                              rocblas_int       incx,
+                                                              rocblas_stride    stride_x,
+                                                              rocblas_int       batch_count,
+                                                              rocblas_datatype  compute_type);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    imatcopy performs the in-place matrix scaling and transposition
+
+        A := alpha*op(A),
+
+    where op(A) = A, A**T or A**H, A is an m by n matrix with leading dimension lda on input
+    and op(A) has leading dimension ldb on output, in the same memory. The batched and strided
+    batched functions compute batch_count such operations.
+
+    A square matrix whose leading dimension is unchanged is transposed in place, one pair of
+    tiles at a time. A rectangular transpose or a change of leading dimension is computed through
+    device memory of m*n*batch_count elements allocated from the handle, which may be queried
+    with rocblas_start_device_memory_size_query.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans     [rocblas_operation]
+              specifies the form of op(A).
+    @param[in]
+    m         [rocblas_int]
+              number of rows of A on input.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of A on input.
+    @param[in]
+    alpha     device pointer or host pointer to the scalar alpha.
+    @param[inout]
+    A         device pointer storing matrix A, or device array of batch_count device
+              pointers to each matrix A_i for imatcopy_batched.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A on input, at least max(1, m).
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of op(A) on output, at least max(1, m) when
+              trans is rocblas_operation_none and max(1, n) otherwise.
+    @param[in]
+    stride_a  [rocblas_stride]
+              stride from the start of one matrix A_i to the next, for
+              imatcopy_strided_batched.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch, for the batched functions.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_simatcopy(rocblas_handle    handle,
+                                                rocblas_operation trans,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                const float*      alpha,
+                                                float*            A,
+                                                rocblas_int       lda,
+                                                rocblas_int       ldb);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dimatcopy(rocblas_handle    handle,
+                                                rocblas_operation trans,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                const double*     alpha,
+                                                double*           A,
+                                                rocblas_int       lda,
+                                                rocblas_int       ldb);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cimatcopy(rocblas_handle               handle,
+                                                rocblas_operation            trans,
+                                                rocblas_int                  m,
+                                                rocblas_int                  n,
+                                                const rocblas_float_complex* alpha,
+                                                rocblas_float_complex*       A,
+                                                rocblas_int                  lda,
+                                                rocblas_int                  ldb);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zimatcopy(rocblas_handle                handle,
+                                                rocblas_operation             trans,
+                                                rocblas_int                   m,
+                                                rocblas_int                   n,
+                                                const rocblas_double_complex* alpha,
+                                                rocblas_double_complex*       A,
+                                                rocblas_int                   lda,
+                                                rocblas_int                   ldb);
+
+ROCBLAS_EXPORT rocblas_status rocblas_simatcopy_batched(rocblas_handle    handle,
+                                                        rocblas_operation trans,
+                                                        rocblas_int       m,
+                                                        rocblas_int       n,
+                                                        const float*      alpha,
+                                                        float* const      A[],
+                                                        rocblas_int       lda,
+                                                        rocblas_int       ldb,
+                                                        rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dimatcopy_batched(rocblas_handle    handle,
+                                                        rocblas_operation trans,
+                                                        rocblas_int       m,
+                                                        rocblas_int       n,
+                                                        const double*     alpha,
+                                                        double* const     A[],
+                                                        rocblas_int       lda,
+                                                        rocblas_int       ldb,
+                                                        rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cimatcopy_batched(rocblas_handle               handle,
+                                                        rocblas_operation            trans,
+                                                        rocblas_int                  m,
+                                                        rocblas_int                  n,
+                                                        const rocblas_float_complex* alpha,
+                                                        rocblas_float_complex* const A[],
+                                                        rocblas_int                  lda,
+                                                        rocblas_int                  ldb,
+                                                        rocblas_int                  batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zimatcopy_batched(rocblas_handle                handle,
+                                                        rocblas_operation             trans,
+                                                        rocblas_int                   m,
+                                                        rocblas_int                   n,
+                                                        const rocblas_double_complex* alpha,
+                                                        rocblas_double_complex* const A[],
+                                                        rocblas_int                   lda,
+                                                        rocblas_int                   ldb,
+                                                        rocblas_int                   batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_simatcopy_strided_batched(rocblas_handle    handle,
+                                                                rocblas_operation trans,
+                                                                rocblas_int       m,
+                                                                rocblas_int       n,
+                                                                const float*      alpha,
+                                                                float*            A,
+                                                                rocblas_int       lda,
+                                                                rocblas_int       ldb,
+                                                                rocblas_stride    stride_a,
+                                                                rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dimatcopy_strided_batched(rocblas_handle    handle,
+                                                                rocblas_operation trans,
+                                                                rocblas_int       m,
+                                                                rocblas_int       n,
+                                                                const double*     alpha,
+                                                                double*           A,
+                                                                rocblas_int       lda,
+                                                                rocblas_int       ldb,
+                                                                rocblas_stride    stride_a,
+                                                                rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_cimatcopy_strided_batched(rocblas_handle               handle,
+                                      rocblas_operation            trans,
+                                      rocblas_int                  m,
+                                      rocblas_int                  n,
+                                      const rocblas_float_complex* alpha,
+                                      rocblas_float_complex*       A,
+                                      rocblas_int                  lda,
+                                      rocblas_int                  ldb,
+                                      rocblas_stride               stride_a,
+                                      rocblas_int                  batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_zimatcopy_strided_batched(rocblas_handle                handle,
+                                      rocblas_operation             trans,
+                                      rocblas_int                   m,
+                                      rocblas_int                   n,
+                                      const rocblas_double_complex* alpha,
+                                      rocblas_double_complex*       A,
+                                      rocblas_int                   lda,
+                                      rocblas_int                   ldb,
+                                      rocblas_stride                stride_a,
+                                      rocblas_int                   batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    omatcopy_ex performs the out-of-place matrix scaling, transposition and conversion
+
+        B := alpha*op(A),
+
+    where op(A) = A, A**T or A**H, A is an m by n matrix and B is the matrix op(A), converted
+    to b_type. alpha and the products have compute_type. The batched and strided batched
+    functions compute batch_count such operations.
+
+    The transposes are computed through tiles in shared memory, as by geam, so that both A and
+    B are accessed in contiguous columns.
+
+    Currently supported datatypes are as follows:
+
+    ----------------------------------
+    | a_type | b_type | compute_type |
+    |--------|--------|--------------|
+    | f16_r  | f16_r  |    f32_r     |
+    | bf16_r | bf16_r |    f32_r     |
+    | f32_r  | f16_r  |    f32_r     |
+    | f16_r  | f32_r  |    f32_r     |
+    | f32_r  | bf16_r |    f32_r     |
+    | bf16_r | f32_r  |    f32_r     |
+    | f32_r  | f32_r  |    f32_r     |
+    | f64_r  | f32_r  |    f64_r     |
+    | f32_r  | f64_r  |    f64_r     |
+    | f64_r  | f64_r  |    f64_r     |
+    | f32_c  | f32_c  |    f32_c     |
+    | f64_c  | f64_c  |    f64_c     |
+    ----------------------------------
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans     [rocblas_operation]
+              specifies the form of op(A).
+    @param[in]
+    m         [rocblas_int]
+              number of rows of A.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of A.
+    @param[in]
+    alpha     device pointer or host pointer to the scalar alpha, of compute_type.
+    @param[in]
+    A         device pointer storing matrix A, or device array of batch_count device
+              pointers to each matrix A_i for omatcopy_batched_ex.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, at least max(1, m).
+    @param[in]
+    stride_a  [rocblas_stride]
+              stride from the start of one matrix A_i to the next, for
+              omatcopy_strided_batched_ex.
+    @param[out]
+    B         device pointer storing matrix B, or device array of batch_count device
+              pointers to each matrix B_i for omatcopy_batched_ex.
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the datatype of matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B, at least max(1, m) when trans is
+              rocblas_operation_none and max(1, n) otherwise.
+    @param[in]
+    stride_b  [rocblas_stride]
+              stride from the start of one matrix B_i to the next, for
+              omatcopy_strided_batched_ex.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch, for the batched functions.
+    @param[in]
+    compute_type [rocblas_datatype]
+              specifies the datatype of computation.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_omatcopy_ex(rocblas_handle    handle,
+                                                  rocblas_operation trans,
+                                                  rocblas_int       m,
+                                                  rocblas_int       n,
+                                                  const void*       alpha,
+                                                  const void*       A,
+                                                  rocblas_datatype  a_type,
+                                                  rocblas_int       lda,
+                                                  void*             B,
+                                                  rocblas_datatype  b_type,
+                                                  rocblas_int       ldb,
+                                                  rocblas_datatype  compute_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_omatcopy_batched_ex(rocblas_handle    handle,
+                                                          rocblas_operation trans,
+                                                          rocblas_int       m,
+                                                          rocblas_int       n,
+                                                          const void*       alpha,
+                                                          const void*       A,
+                                                          rocblas_datatype  a_type,
+                                                          rocblas_int       lda,
+                                                          void*             B,
+                                                          rocblas_datatype  b_type,
+                                                          rocblas_int       ldb,
+                                                          rocblas_int       batch_count,
+                                                          rocblas_datatype  compute_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_omatcopy_strided_batched_ex(rocblas_handle    handle,
+                                                                  rocblas_operation trans,
+                                                                  rocblas_int       m,
+                                                                  rocblas_int       n,
+                                                                  const void*       alpha,
+                                                                  const void*       A,
+                                                                  rocblas_datatype  a_type,
+                                                                  rocblas_int       lda,
+                                                                  rocblas_stride    stride_a,
+                                                                  void*             B,
+                                                                  rocblas_datatype  b_type,
+                                                                  rocblas_int       ldb,
+                                                                  rocblas_stride    stride_b,
+                                                                  rocblas_int       batch_count,
+                                                                  rocblas_datatype  compute_type);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    axpby_ex computes in one pass over the vectors
+
+        y := alpha * x + beta * y,
+
+    instead of scaling y by beta and then adding alpha * x. y is not read when beta is zero.
+    alpha and beta have alpha_type. The batched and strided batched functions compute
+    batch_count such operations.
+
+    Vectors of unit increments are accessed 128 bits at a time where possible.
+
+    Currently supported datatypes are those of axpy_ex:
+
+    -------------------------------------------------
+    | alpha_type | x_type | y_type | execution_type |
+    |------------|--------|--------|----------------|
+    |  bf16_r    | bf16_r |  bf16_r|      f32_r     |
+    |  f32_r     | bf16_r |  bf16_r|      f32_r     |
+    |  f16_r     | f16_r  |  f16_r |      f16_r     |
+    |  f16_r     | f16_r  |  f16_r |      f32_r     |
+    |  f32_r     | f16_r  |  f16_r |      f32_r     |
+    |  f32_r     | f32_r  |  f32_r |      f32_r     |
+    |  f64_r     | f64_r  |  f64_r |      f64_r     |
+    |  f32_c     | f32_c  |  f32_c |      f32_c     |
+    |  f64_c     | f64_c  |  f64_c |      f64_c     |
+    -------------------------------------------------
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x and y.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    alpha_type [rocblas_datatype]
+              specifies the datatype of alpha and beta.
+    @param[in]
+    x         device pointer storing vector x, or device array of batch_count device
+              pointers to each vector x_i for axpby_batched_ex.
+    @param[in]
+    x_type    [rocblas_datatype]
+              specifies the datatype of vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one vector x_i to the next, for
+              axpby_strided_batched_ex.
+    @param[in]
+    beta      device pointer or host pointer to specify the scalar beta.
+    @param[inout]
+    y         device pointer storing vector y, or device array of batch_count device
+              pointers to each vector y_i for axpby_batched_ex.
+    @param[in]
+    y_type    [rocblas_datatype]
+              specifies the datatype of vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[in]
+    stride_y  [rocblas_stride]
+              stride from the start of one vector y_i to the next, for
+              axpby_strided_batched_ex.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch, for the batched functions.
+    @param[in]
+    execution_type [rocblas_datatype]
+              specifies the datatype of computation.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_axpby_ex(rocblas_handle   handle,
+                                               rocblas_int      n,
+                                               const void*      alpha,
+                                               rocblas_datatype alpha_type,
+                                               const void*      x,
+                                               rocblas_datatype x_type,
+                                               rocblas_int      incx,
+                                               const void*      beta,
+                                               void*            y,
+                                               rocblas_datatype y_type,
+                                               rocblas_int      incy,
+                                               rocblas_datatype execution_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_axpby_batched_ex(rocblas_handle   handle,
+                                                       rocblas_int      n,
+                                                       const void*      alpha,
+                                                       rocblas_datatype alpha_type,
+                                                       const void*      x,
+                                                       rocblas_datatype x_type,
+                                                       rocblas_int      incx,
+                                                       const void*      beta,
+                                                       void*            y,
+                                                       rocblas_datatype y_type,
+                                                       rocblas_int      incy,
+                                                       rocblas_int      batch_count,
+                                                       rocblas_datatype execution_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_axpby_strided_batched_ex(rocblas_handle   handle,
+                                                               rocblas_int      n,
+                                                               const void*      alpha,
+                                                               rocblas_datatype alpha_type,
+                                                               const void*      x,
+                                                               rocblas_datatype x_type,
+                                                               rocblas_int      incx,
+                                                               rocblas_stride   stride_x,
+                                                               const void*      beta,
+                                                               void*            y,
+                                                               rocblas_datatype y_type,
+                                                               rocblas_int      incy,
+                                                               rocblas_stride   stride_y,
+                                                               rocblas_int      batch_count,
+                                                               rocblas_datatype execution_type);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    copy_scal_ex computes in one pass over the vectors
+
+        y := alpha * x,
+
+    instead of copying x to y and then scaling y, converting the elements of x to y_type. y is
+    not read. The batched and strided batched functions compute batch_count such operations.
+
+    Vectors of unit increments with elements of the same size are accessed 128 bits at a time
+    where possible.
+
+    Currently supported datatypes are those of axpy_ex, and the following conversions:
+
+    -------------------------------------------------
+    | alpha_type | x_type | y_type | execution_type |
+    |------------|--------|--------|----------------|
+    |  f32_r     | f32_r  |  f16_r |      f32_r     |
+    |  f32_r     | f16_r  |  f32_r |      f32_r     |
+    |  f32_r     | f32_r  |  bf16_r|      f32_r     |
+    |  f32_r     | bf16_r |  f32_r |      f32_r     |
+    |  f64_r     | f64_r  |  f32_r |      f64_r     |
+    |  f64_r     | f32_r  |  f64_r |      f64_r     |
+    -------------------------------------------------
+
+    The arguments are those of axpby_ex, without beta; y is only an output.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_copy_scal_ex(rocblas_handle   handle,
+                                                   rocblas_int      n,
+                                                   const void*      alpha,
+                                                   rocblas_datatype alpha_type,
+                                                   const void*      x,
+                                                   rocblas_datatype x_type,
+                                                   rocblas_int      incx,
+                                                   void*            y,
+                                                   rocblas_datatype y_type,
+                                                   rocblas_int      incy,
+                                                   rocblas_datatype execution_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_copy_scal_batched_ex(rocblas_handle   handle,
+                                                           rocblas_int      n,
+                                                           const void*      alpha,
+                                                           rocblas_datatype alpha_type,
+                                                           const void*      x,
+                                                           rocblas_datatype x_type,
+                                                           rocblas_int      incx,
+                                                           void*            y,
+                                                           rocblas_datatype y_type,
+                                                           rocblas_int      incy,
+                                                           rocblas_int      batch_count,
+                                                           rocblas_datatype execution_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_copy_scal_strided_batched_ex(rocblas_handle   handle,
+                                                                   rocblas_int      n,
+                                                                   const void*      alpha,
+                                                                   rocblas_datatype alpha_type,
+                                                                   const void*      x,
+                                                                   rocblas_datatype x_type,
+                                                                   rocblas_int      incx,
+                                                                   rocblas_stride   stride_x,
+                                                                   void*            y,
+                                                                   rocblas_datatype y_type,
+                                                                   rocblas_int      incy,
+                                                                   rocblas_stride   stride_y,
+                                                                   rocblas_int      batch_count,
+                                                                   rocblas_datatype execution_type);
+//! @}
+
+/*! \brief Coalescer of the same-shape rocblas_gemm_coalesced_ex calls of several threads */
+typedef struct _rocblas_gemm_coalescer* rocblas_gemm_coalescer;
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_coalescer_create creates a coalescer on the current device, with its own handle
+    and stream. rocblas_gemm_coalesced_ex calls made through it by several threads with the same
+    arguments, other than the matrix pointers and the stream, within window_us microseconds of
+    the first one are computed as one rocblas_gemm_batched_ex on the coalescer's stream, so that
+    many small same-shape gemms fill the device in a single launch.
+
+    @param[out]
+    coalescer [rocblas_gemm_coalescer*]
+              pointer to where the created coalescer will be stored.
+    @param[in]
+    window_us [rocblas_int]
+              longest time in microseconds a call waits for others to join its batch.
+    @param[in]
+    max_batch [rocblas_int]
+              largest number of calls in a batch, which is launched as soon as it is full.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_coalescer_create(rocblas_gemm_coalescer* coalescer,
+                                                            rocblas_int             window_us,
+                                                            rocblas_int             max_batch);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_coalescer_destroy waits for the batches launched by the coalescer and destroys
+    it. No rocblas_gemm_coalesced_ex call may be in progress with the coalescer.
+
+    @param[in]
+    coalescer [rocblas_gemm_coalescer]
+              the coalescer to destroy.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_coalescer_destroy(rocblas_gemm_coalescer coalescer);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_coalesced_ex computes rocblas_gemm_ex on stream, batched with the calls of other
+    threads through the same coalescer which have the same trans_a, trans_b, m, n, k, values of
+    alpha and beta, types, leading dimensions, algo, solution_index and flags.
+
+    The first call of a batch waits up to the window of the coalescer, or until max_batch calls
+    have joined, and launches the batch on the coalescer's stream, after events recorded on the
+    streams of its calls. The streams of the calls then wait for the batch, so that, as with
+    rocblas_gemm_ex, the function returns before the result is computed and later work on stream
+    is ordered after it, without host synchronization. The calling thread is blocked until its
+    batch is launched, at most for the window of the coalescer plus the launch.
+
+    alpha and beta are always in host memory, and have compute_type. c may be nullptr when beta
+    is 0. The status of the batch, the same for all its calls, is returned.
+
+    @param[in]
+    coalescer [rocblas_gemm_coalescer]
+              the coalescer collecting the calls.
+    @param[in]
+    stream    [hipStream_t]
+              the stream of the caller, which must be of the coalescer's device.
+
+    The other arguments are those of rocblas_gemm_ex.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_coalesced_ex(rocblas_gemm_coalescer coalescer,
+                                                        hipStream_t            stream,
+                                                        rocblas_operation      trans_a,
+                                                        rocblas_operation      trans_b,
+                                                        rocblas_int            m,
+                                                        rocblas_int            n,
+                                                        rocblas_int            k,
+                                                        const void*            alpha,
+                                                        const void*            a,
+                                                        rocblas_datatype       a_type,
+                                                        rocblas_int            lda,
+                                                        const void*            b,
+                                                        rocblas_datatype       b_type,
+                                                        rocblas_int            ldb,
+                                                        const void*            beta,
+                                                        const void*            c,
+                                                        rocblas_datatype       c_type,
+                                                        rocblas_int            ldc,
+                                                        void*                  d,
+                                                        rocblas_datatype       d_type,
+                                                        rocblas_int            ldd,
+                                                        rocblas_datatype       compute_type,
+                                                        rocblas_gemm_algo      algo,
+                                                        int32_t                solution_index,
+                                                        uint32_t               flags);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_planar_ex performs rocblas_gemm_ex on planar complex matrices
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    where the real and imaginary parts of each complex matrix are held in two separate real
+    arrays, a_real and a_imag, with the same leading dimension. The product is computed by four
+    real gemms on the planar arrays, with no interleaving into complex buffers. A real alpha
+    accumulates the products into C in place, after scaling C by a complex beta; a complex alpha
+    needs 2*m*n real elements of device memory workspace for op( A )*op( B ).
+
+    a_type, b_type, c_type and compute_type must all be rocblas_datatype_f32_c or
+    rocblas_datatype_f64_c, and the arrays are then float or double; other types return
+    rocblas_status_not_implemented. alpha and beta point to complex values of compute_type, in
+    host or device memory according to the pointer mode.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans_a   [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    trans_b   [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              matrix dimension m.
+    @param[in]
+    n         [rocblas_int]
+              matrix dimension n.
+    @param[in]
+    k         [rocblas_int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    a_real    [const void *]
+              device pointer storing the real part of matrix A.
+    @param[in]
+    a_imag    [const void *]
+              device pointer storing the imaginary part of matrix A.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the complex datatype of matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of a_real and a_imag.
+    @param[in]
+    b_real    [const void *]
+              device pointer storing the real part of matrix B.
+    @param[in]
+    b_imag    [const void *]
+              device pointer storing the imaginary part of matrix B.
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the complex datatype of matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of b_real and b_imag.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta.
+    @param[in, out]
+    c_real    [void *]
+              device pointer storing the real part of matrix C.
+    @param[in, out]
+    c_imag    [void *]
+              device pointer storing the imaginary part of matrix C.
+    @param[in]
+    c_type    [rocblas_datatype]
+              specifies the complex datatype of matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of c_real and c_imag.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              specifies the complex datatype of computation.
+    @param[in]
+    flags     [uint32_t]
+              optional gemm flags, passed to the real gemms.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_planar_ex(rocblas_handle    handle,
+                                                     rocblas_operation trans_a,
+                                                     rocblas_operation trans_b,
+                                                     rocblas_int       m,
+                                                     rocblas_int       n,
+                                                     rocblas_int       k,
+                                                     const void*       alpha,
+                                                     const void*       a_real,
+                                                     const void*       a_imag,
+                                                     rocblas_datatype  a_type,
+                                                     rocblas_int       lda,
+                                                     const void*       b_real,
+                                                     const void*       b_imag,
+                                                     rocblas_datatype  b_type,
+                                                     rocblas_int       ldb,
+                                                     const void*       beta,
+                                                     void*             c_real,
+                                                     void*             c_imag,
+                                                     rocblas_datatype  c_type,
+                                                     rocblas_int       ldc,
+                                                     rocblas_datatype  compute_type,
+                                                     uint32_t          flags);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_strided_batched_planar_ex performs rocblas_gemm_planar_ex on batch_count
+    planar complex problems, the real and imaginary arrays of problem i starting
+    i*stride_a, i*stride_b and i*stride_c elements after those of the first one. A complex
+    alpha needs 2*m*n*batch_count real elements of device memory workspace.
+
+    @param[in]
+    stride_a  [rocblas_stride]
+              stride from the start of one A_i to the next, in a_real and in a_imag.
+    @param[in]
+    stride_b  [rocblas_stride]
+              stride from the start of one B_i to the next, in b_real and in b_imag.
+    @param[in]
+    stride_c  [rocblas_stride]
+              stride from the start of one C_i to the next, in c_real and in c_imag.
+    @param[in]
+    batch_count [rocblas_int]
+              number of gemm operations in the batch.
+
+    The other arguments are those of rocblas_gemm_planar_ex.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_strided_batched_planar_ex(rocblas_handle    handle,
+                                                                     rocblas_operation trans_a,
+                                                                     rocblas_operation trans_b,
+                                                                     rocblas_int       m,
+                                                                     rocblas_int       n,
+                                                                     rocblas_int       k,
+                                                                     const void*       alpha,
+                                                                     const void*       a_real,
+                                                                     const void*       a_imag,
+                                                                     rocblas_datatype  a_type,
+                                                                     rocblas_int       lda,
+                                                                     rocblas_stride    stride_a,
+                                                                     const void*       b_real,
+                                                                     const void*       b_imag,
+                                                                     rocblas_datatype  b_type,
+                                                                     rocblas_int       ldb,
+                                                                     rocblas_stride    stride_b,
+                                                                     const void*       beta,
+                                                                     void*             c_real,
+                                                                     void*             c_imag,
+                                                                     rocblas_datatype  c_type,
+                                                                     rocblas_int       ldc,
+                                                                     rocblas_stride    stride_c,
+                                                                     rocblas_int       batch_count,
+                                                                     rocblas_datatype  compute_type,
+                                                                     uint32_t          flags);
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    axpy_planar computes y := alpha * x + y for the complex vectors x and y held in planar
+    storage, their real and imaginary parts in separate real arrays with the same increment,
+    with the complex scalar alpha. The strided_batched variants run batch_count such updates.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x and y.
+    @param[in]
+    alpha     device pointer or host pointer to specify the complex scalar alpha.
+    @param[in]
+    x_real    device pointer storing the real parts of x.
+    @param[in]
+    x_imag    device pointer storing the imaginary parts of x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in, out]
+    y_real    device pointer storing the real parts of y.
+    @param[in, out]
+    y_imag    device pointer storing the imaginary parts of y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one x_i to the next, for the strided_batched variant.
+    @param[in]
+    stride_y  [rocblas_stride]
+              stride from the start of one y_i to the next, for the strided_batched variant.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch, for the strided_batched variant.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_caxpy_planar(rocblas_handle               handle,
+                                                   rocblas_int                  n,
+                                                   const rocblas_float_complex* alpha,
+                                                   const float*                 x_real,
+                                                   const float*                 x_imag,
+                                                   rocblas_int                  incx,
+                                                   float*                       y_real,
+                                                   float*                       y_imag,
+                                                   rocblas_int                  incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpy_planar(rocblas_handle                handle,
+                                                   rocblas_int                   n,
+                                                   const rocblas_double_complex* alpha,
+                                                   const double*                 x_real,
+                                                   const double*                 x_imag,
+                                                   rocblas_int                   incx,
+                                                   double*                       y_real,
+                                                   double*                       y_imag,
+                                                   rocblas_int                   incy);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_caxpy_planar_strided_batched(rocblas_handle               handle,
+                                         rocblas_int                  n,
+                                         const rocblas_float_complex* alpha,
+                                         const float*                 x_real,
+                                         const float*                 x_imag,
+                                         rocblas_int                  incx,
+                                         rocblas_stride               stride_x,
+                                         float*                       y_real,
+                                         float*                       y_imag,
+                                         rocblas_int                  incy,
+                                         rocblas_stride               stride_y,
+                                         rocblas_int                  batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_zaxpy_planar_strided_batched(rocblas_handle                handle,
+                                         rocblas_int                   n,
+                                         const rocblas_double_complex* alpha,
+                                         const double*                 x_real,
+                                         const double*                 x_imag,
+                                         rocblas_int                   incx,
+                                         rocblas_stride                stride_x,
+                                         double*                       y_real,
+                                         double*                       y_imag,
+                                         rocblas_int                   incy,
+                                         rocblas_stride                stride_y,
+                                         rocblas_int                   batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    scal_planar computes x := alpha * x for the complex vector x held in planar storage, its
+    real and imaginary parts in separate real arrays with the same increment, with the complex
+    scalar alpha. The strided_batched variants run batch_count such updates.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x.
+    @param[in]
+    alpha     device pointer or host pointer to specify the complex scalar alpha.
+    @param[in, out]
+    x_real    device pointer storing the real parts of x.
+    @param[in, out]
+    x_imag    device pointer storing the imaginary parts of x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x. incx <= 0 returns immediately,
+              as for scal.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one x_i to the next, for the strided_batched variant.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch, for the strided_batched variant.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_cscal_planar(rocblas_handle               handle,
+                                                   rocblas_int                  n,
+                                                   const rocblas_float_complex* alpha,
+                                                   float*                       x_real,
+                                                   float*                       x_imag,
+                                                   rocblas_int                  incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zscal_planar(rocblas_handle                handle,
+                                                   rocblas_int                   n,
+                                                   const rocblas_double_complex* alpha,
+                                                   double*                       x_real,
+                                                   double*                       x_imag,
+                                                   rocblas_int                   incx);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_cscal_planar_strided_batched(rocblas_handle               handle,
+                                         rocblas_int                  n,
+                                         const rocblas_float_complex* alpha,
+                                         float*                       x_real,
+                                         float*                       x_imag,
+                                         rocblas_int                  incx,
+                                         rocblas_stride               stride_x,
+                                         rocblas_int                  batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_zscal_planar_strided_batched(rocblas_handle                handle,
+                                         rocblas_int                   n,
+                                         const rocblas_double_complex* alpha,
+                                         double*                       x_real,
+                                         double*                       x_imag,
+                                         rocblas_int                   incx,
+                                         rocblas_stride                stride_x,
+                                         rocblas_int                   batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    dotu_planar and dotc_planar compute the dot product of the complex vectors x and y held in
+    planar storage, their real and imaginary parts in separate real arrays with the same
+    increment,
+
+        result = sum_i x[i] * y[i]          (dotu_planar)
+        result = sum_i conj(x[i]) * y[i]    (dotc_planar)
+
+    The products are reduced per block, and the block sums in a fixed order. The result is
+    complex, in host or device memory according to the pointer mode, and is 0 for n <= 0. The
+    strided_batched variants write batch_count results.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x and y.
+    @param[in]
+    x_real    device pointer storing the real parts of x.
+    @param[in]
+    x_imag    device pointer storing the imaginary parts of x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    y_real    device pointer storing the real parts of y.
+    @param[in]
+    y_imag    device pointer storing the imaginary parts of y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one x_i to the next, for the strided_batched variant.
+    @param[in]
+    stride_y  [rocblas_stride]
+              stride from the start of one y_i to the next, for the strided_batched variant.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch, for the strided_batched variant.
+    @param[inout]
+    result    device pointer or host pointer to store the batch_count complex results.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_cdotu_planar(rocblas_handle         handle,
+                                                   rocblas_int            n,
+                                                   const float*           x_real,
+                                                   const float*           x_imag,
+                                                   rocblas_int            incx,
+                                                   const float*           y_real,
+                                                   const float*           y_imag,
+                                                   rocblas_int            incy,
+                                                   rocblas_float_complex* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdotu_planar(rocblas_handle          handle,
+                                                   rocblas_int             n,
+                                                   const double*           x_real,
+                                                   const double*           x_imag,
+                                                   rocblas_int             incx,
+                                                   const double*           y_real,
+                                                   const double*           y_imag,
+                                                   rocblas_int             incy,
+                                                   rocblas_double_complex* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cdotc_planar(rocblas_handle         handle,
+                                                   rocblas_int            n,
+                                                   const float*           x_real,
+                                                   const float*           x_imag,
+                                                   rocblas_int            incx,
+                                                   const float*           y_real,
+                                                   const float*           y_imag,
+                                                   rocblas_int            incy,
+                                                   rocblas_float_complex* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdotc_planar(rocblas_handle          handle,
+                                                   rocblas_int             n,
+                                                   const double*           x_real,
+                                                   const double*           x_imag,
+                                                   rocblas_int             incx,
+                                                   const double*           y_real,
+                                                   const double*           y_imag,
+                                                   rocblas_int             incy,
+                                                   rocblas_double_complex* result);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_cdotu_planar_strided_batched(rocblas_handle         handle,
+                                         rocblas_int            n,
+                                         const float*           x_real,
+                                         const float*           x_imag,
+                                         rocblas_int            incx,
+                                         rocblas_stride         stride_x,
+                                         const float*           y_real,
+                                         const float*           y_imag,
+                                         rocblas_int            incy,
+                                         rocblas_stride         stride_y,
+                                         rocblas_int            batch_count,
+                                         rocblas_float_complex* result);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_zdotu_planar_strided_batched(rocblas_handle          handle,
+                                         rocblas_int             n,
+                                         const double*           x_real,
+                                         const double*           x_imag,
+                                         rocblas_int             incx,
+                                         rocblas_stride          stride_x,
+                                         const double*           y_real,
+                                         const double*           y_imag,
+                                         rocblas_int             incy,
+                                         rocblas_stride          stride_y,
+                                         rocblas_int             batch_count,
+                                         rocblas_double_complex* result);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_cdotc_planar_strided_batched(rocblas_handle         handle,
+                                         rocblas_int            n,
+                                         const float*           x_real,
+                                         const float*           x_imag,
+                                         rocblas_int            incx,
+                                         rocblas_stride         stride_x,
+                                         const float*           y_real,
+                                         const float*           y_imag,
+                                         rocblas_int            incy,
+                                         rocblas_stride         stride_y,
+                                         rocblas_int            batch_count,
+                                         rocblas_float_complex* result);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_zdotc_planar_strided_batched(rocblas_handle          handle,
+                                         rocblas_int             n,
+                                         const double*           x_real,
+                                         const double*           x_imag,
+                                         rocblas_int             incx,
+                                         rocblas_stride          stride_x,
+                                         const double*           y_real,
+                                         const double*           y_imag,
+                                         rocblas_int             incy,
+                                         rocblas_stride          stride_y,
+                                         rocblas_int             batch_count,
+                                         rocblas_double_complex* result);
+//! @}
+
 #ifdef __cplusplus
 }
 #endif
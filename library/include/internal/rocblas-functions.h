@@ -15690,6 +15690,14 @@ ROCBLAS_EXPORT rocblas_status rocblas_zgeam_strided_batched(rocblas_handle
    compute_type
         - rocblas_datatype_f32_c  = a_type = b_type = c_type = d_type = compute_type
         - rocblas_datatype_f64_c  = a_type = b_type = c_type = d_type = compute_type
+        - rocblas_datatype_f32_r = a_type; rocblas_datatype_f32_c = b_type = c_type = d_type =
+   compute_type
+        - rocblas_datatype_f64_r = a_type; rocblas_datatype_f64_c = b_type = c_type = d_type =
+   compute_type
+
+   A real A by a complex B is computed without promoting A to complex, by one real gemm of A
+   by the real and imaginary parts of B, which are split with the product into device memory
+   workspace.
 
    Two int8 datatypes are supported: int8_t and rocblas_int8x4. int8_t is the C99 signed
    8 bit integer. The default is int8_t and it is recommended int8_t be used. rocblas_int8x4
@@ -16139,6 +16147,14 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_batched_ex(rocblas_handle    handle,
    compute_type
         - rocblas_datatype_f32_c  = a_type = b_type = c_type = d_type = compute_type
         - rocblas_datatype_f64_c  = a_type = b_type = c_type = d_type = compute_type
+        - rocblas_datatype_f32_r = a_type; rocblas_datatype_f32_c = b_type = c_type = d_type =
+   compute_type
+        - rocblas_datatype_f64_r = a_type; rocblas_datatype_f64_c = b_type = c_type = d_type =
+   compute_type
+
+   A real A by a complex B is computed without promoting A to complex, by one real gemm of A
+   by the real and imaginary parts of B, which are split with the product into device memory
+   workspace.
 
    Two int8 datatypes are supported: int8_t and rocblas_int8x4. int8_t is the C99 signed
    8 bit integer. The default is int8_t and it is recommended int8_t be used. rocblas_int8x4
@@ -16520,6 +16536,8 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_ext2(rocblas_handle    handle,
 
         Dij = min(alpha * (Aik + Bkj), beta * Cij)
         Dij = min(alpha * Aik, alpha * Bkj) + beta * Cij
+        Dij = max(alpha * (Aik + Bkj), beta * Cij)
+        Dij = max(min(alpha * Aik, alpha * Bkj), beta * Cij)
 
     alpha and beta are scalars, and A, B, C, and D are matrices, with
     op( A ) an m by k matrix, op( B ) a k by n matrix and C and D are m by n matrices.
@@ -16608,7 +16626,8 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_ext2(rocblas_handle    handle,
               specifies the datatype of computation.
     @param[in]
     geam_ex_op [rocblas_geam_ex_operation]
-              enumerant specifying the operation type, support for rocblas_geam_ex_operation_min_plus and rocblas_geam_ex_operation_plus_min.
+              enumerant specifying the operation type, support for rocblas_geam_ex_operation_min_plus, rocblas_geam_ex_operation_plus_min,
+              rocblas_geam_ex_operation_max_plus and rocblas_geam_ex_operation_max_min.
 
     ********************************************************************/
 ROCBLAS_EXPORT rocblas_status rocblas_geam_ex(rocblas_handle            handle,
@@ -18367,6 +18386,54 @@ ROCBLAS_EXPORT rocblas_status rocblas_device_malloc_get(struct rocblas_device_ma
 ROCBLAS_EXPORT rocblas_status rocblas_device_malloc_free(struct rocblas_device_malloc_base* ptr);
 ROCBLAS_EXPORT void           rocblas_device_malloc_set_default_memory_size(size_t size);
 
+/*! \brief
+    \details
+    Opens a workspace scope, for libraries calling rocBLAS from algorithms which keep device
+    memory of the handle across several rocBLAS calls. reserved_size bytes of the device memory
+    of the handle are reserved for the caller, and nested_size more bytes are made available
+    for the rocBLAS calls made until the scope is closed by rocblas_pop_workspace_scope. These
+    calls, and the scopes nested in this one, take their memory from the rest of the device
+    memory of the handle, without allocating any, and fail with rocblas_status_memory_error
+    instead of reallocating it when it is too small. The outermost scope of a handle whose
+    device memory is managed by rocBLAS may allocate it, once.
+
+    During a device memory size query nothing is reserved, and reserved_size is added to the
+    sizes collected from the calls made until the scope is closed, so that a query of a whole
+    algorithm returns the size of the single block it needs.
+
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_pointer
+    if reserved is nullptr; rocblas_status_memory_error if the device memory cannot hold
+    reserved_size + nested_size bytes; rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+    @param[in]
+    reserved_size   size in bytes of the region reserved for the caller
+    @param[in]
+    nested_size     size in bytes needed by the rocBLAS calls made in the scope, for example
+                    from a device memory size query of these calls
+    @param[out]
+    reserved        address of the reserved region, nullptr during a size query or if
+                    reserved_size is 0
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_push_workspace_scope(rocblas_handle handle,
+                                                           size_t         reserved_size,
+                                                           size_t         nested_size,
+                                                           void**         reserved);
+
+/*! \brief
+    \details
+    Closes the innermost workspace scope opened by rocblas_push_workspace_scope and releases
+    its reserved region. The memory taken by the rocBLAS calls made in the scope must have
+    been released.
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_value if
+    no scope is open; rocblas_status_size_query_mismatch if the scope was opened in a device
+    memory size query and the query has stopped since, or the reverse;
+    rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_pop_workspace_scope(rocblas_handle handle);
+
 /*! \brief
     \details
     Gets the current device memory size for the handle.
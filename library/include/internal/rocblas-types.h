@@ -192,6 +192,8 @@ typedef enum rocblas_datatype_
     rocblas_datatype_u32_c   = 167, /**< 32-bit unsigned integer, complex */
     rocblas_datatype_bf16_r  = 168, /**< 16-bit bfloat, real */
     rocblas_datatype_bf16_c  = 169, /**< 16-bit bfloat, complex */
+    rocblas_datatype_f8_r    = 252, /**< 8-bit float E4M3, bias 8, no infinity, beta feature */
+    rocblas_datatype_bf8_r   = 253, /**< 8-bit float E5M2, bias 16, no infinity, beta feature */
     rocblas_datatype_invalid = 255, /**< Invalid datatype value, do not use */
 } rocblas_datatype;
 
@@ -248,7 +250,15 @@ typedef enum rocblas_performance_metric_
     rocblas_device_efficiency_performance_metric = 1,
     /*! \brief Select the solution with the highest GFlops per compute unit it uses. This
      * may be useful when running multiple small gemm problems simultaneously  */
-    rocblas_cu_efficiency_performance_metric = 2
+    rocblas_cu_efficiency_performance_metric = 2,
+    /*! \brief BETA: Select the solution expected to finish first, with the fewest waves of
+     * the shortest workgroups, for latency-critical gemm problems running next to other work.
+     * On high-priority streams, splitting k across workgroups is also considered */
+    rocblas_latency_performance_metric = 3,
+    /*! \brief BETA: Select the solution using the least energy, measured with the power
+     * counters of the device by GEMM autotuning the first time each problem is run. This
+     * may be useful on power-capped systems */
+    rocblas_energy_efficiency_performance_metric = 4
 } rocblas_performance_metric;
 
 /*! \brief Indicates if layer is active with bitmask*/
@@ -262,6 +272,10 @@ typedef enum rocblas_layer_mode_
     rocblas_layer_mode_log_bench = 0x2,
     /*! \brief Outputs a YAML description of each rocBLAS function called, along with its arguments and number of times it was called. */
     rocblas_layer_mode_log_profile = 0x4,
+    /*! \brief Adds the GPU execution time of the calls made with each set of arguments to the profile logging output, and enables profile logging. */
+    rocblas_layer_mode_log_profile_time = 0x8,
+    /*! \brief Pushes a ROCTX range, named by the trace logging line, around each rocBLAS function call, when rocBLAS is built with BUILD_WITH_ROCTX. */
+    rocblas_layer_mode_roctx = 0x10,
 } rocblas_layer_mode;
 
 /*! \brief Indicates if layer is active with bitmask*/
@@ -276,6 +290,8 @@ typedef enum rocblas_geam_ex_operation_
 {
     rocblas_geam_ex_operation_min_plus = 0x0, // Cij = min(Aik + Bkj, Cij)
     rocblas_geam_ex_operation_plus_min = 0x1, // Cij = min(Aik, Bkj) + Cij
+    rocblas_geam_ex_operation_max_plus = 0x2, // Cij = max(Aik + Bkj, Cij)
+    rocblas_geam_ex_operation_max_min  = 0x3, // Cij = max(min(Aik, Bkj), Cij)
 } rocblas_geam_ex_operation;
 
 /*! \brief Control flags passed into gemm algorithms invoked by Tensile Host */
@@ -297,9 +313,66 @@ typedef enum rocblas_gemm_flags_
     * input/output data to zero. See the "MI200 (gfx90a) Considerations"
     * section for more details. */
     rocblas_gemm_flags_fp16_alt_impl        = 0x4,
-    rocblas_gemm_flags_check_solution_index = 0x8
+    rocblas_gemm_flags_check_solution_index = 0x8,
+    /*! \brief <b> BETA FEATURE </b> Split the k dimension of rocblas_gemm_ex and
+    * rocblas_gemm_strided_batched_ex into chunks whose partial products are computed
+    * concurrently into device workspace in compute precision, then summed. Useful when m * n is
+    * small and k is large. The number of chunks is taken from ROCBLAS_GEMM_FLAGS_SPLIT_K_FACTOR,
+    * or chosen from the problem size when it is 0. Ignored by rocblas_gemm_batched_ex.
+    * The chosen number of chunks is reported with rocblas_layer_mode_log_trace. */
+    rocblas_gemm_flags_split_k = 0x10,
+    /*! \brief <b> BETA FEATURE </b> Compute the single and double precision complex
+    * rocblas_gemm_ex and rocblas_gemm_strided_batched_ex as three real gemms of the real parts,
+    * the imaginary parts and their sums of op(A) and op(B) (3M method), instead of four, in device
+    * workspace. This saves a quarter of the multiplications, but the imaginary part of the product
+    * is a difference of larger sums, so that its error is bounded relative to
+    * (|Re(A)| + |Im(A)|) (|Re(B)| + |Im(B)|) rather than |A| |B|: it may lose accuracy when the
+    * imaginary parts are much smaller than the real parts. Takes precedence over
+    * rocblas_gemm_flags_split_k, and is ignored by rocblas_gemm_batched_ex and other precisions. */
+    rocblas_gemm_flags_complex_3m = 0x20,
+    /*! \brief <b> BETA FEATURE </b> Emulate the double precision rocblas_gemm_ex and
+    * rocblas_gemm_strided_batched_ex with int8 gemms (Ozaki scheme), for devices whose double
+    * precision throughput is much lower than their int8 throughput. The rows of op(A) and the
+    * columns of op(B) are scaled by a power of two and split in device workspace into slices of
+    * 7 bits, whose products are exact int8 gemms with int32 accumulation, then summed in double
+    * precision. The number of slices is taken from ROCBLAS_GEMM_FLAGS_FP64_EMULATION_SLICES, or
+    * is 8 when it is 0, and slices * (slices + 1) / 2 int8 gemms are computed. The error grows as
+    * 2^(-7 * slices) relative to the largest elements of the rows of op(A) and of the columns of
+    * op(B), so that rows or columns with elements of very different magnitudes lose accuracy, and
+    * A and B must be finite. Ignored by rocblas_gemm_batched_ex and other precisions. */
+    rocblas_gemm_flags_fp64_emulation = 0x40,
+    /*! \brief <b> BETA FEATURE </b> Allow the single precision gemm_ex functions, with
+    * rocblas_datatype_f32_r inputs, output and compute type, to use the xf32 matrix instructions
+    * of gfx940, gfx941 and gfx942, which round A and B to a 10-bit mantissa before the products
+    * are accumulated in single precision. This is several times faster than single precision
+    * matrix instructions, with about the accuracy of half precision products. Ignored, without
+    * error, on other devices, for other precisions and where no xf32 kernel is available. */
+    rocblas_gemm_flags_xf32 = 0x80
 } rocblas_gemm_flags;
 
+/*! \brief Bits of the flags of gemm_ex holding the number of chunks for rocblas_gemm_flags_split_k */
+#define ROCBLAS_GEMM_FLAGS_SPLIT_K_FACTOR_SHIFT 16
+#define ROCBLAS_GEMM_FLAGS_SPLIT_K_FACTOR_MASK (0xffu << ROCBLAS_GEMM_FLAGS_SPLIT_K_FACTOR_SHIFT)
+
+/*! \brief Flags of gemm_ex requesting k to be split into factor chunks, 1 <= factor <= 255 */
+#define ROCBLAS_GEMM_FLAGS_SPLIT_K_FACTOR(factor)                           \
+    (rocblas_gemm_flags_split_k                                             \
+     | (((uint32_t)(factor) << ROCBLAS_GEMM_FLAGS_SPLIT_K_FACTOR_SHIFT)     \
+        & ROCBLAS_GEMM_FLAGS_SPLIT_K_FACTOR_MASK))
+
+/*! \brief Bits of the flags of gemm_ex holding the number of slices for
+ * rocblas_gemm_flags_fp64_emulation */
+#define ROCBLAS_GEMM_FLAGS_FP64_EMULATION_SLICES_SHIFT 24
+#define ROCBLAS_GEMM_FLAGS_FP64_EMULATION_SLICES_MASK \
+    (0xfu << ROCBLAS_GEMM_FLAGS_FP64_EMULATION_SLICES_SHIFT)
+
+/*! \brief Flags of gemm_ex requesting the emulation of double precision with slices int8 slices,
+ * 1 <= slices <= 15 */
+#define ROCBLAS_GEMM_FLAGS_FP64_EMULATION_SLICES(slices)                          \
+    (rocblas_gemm_flags_fp64_emulation                                            \
+     | (((uint32_t)(slices) << ROCBLAS_GEMM_FLAGS_FP64_EMULATION_SLICES_SHIFT)    \
+        & ROCBLAS_GEMM_FLAGS_FP64_EMULATION_SLICES_MASK))
+
 // rocblas_int8_type_for_hipblas enum will be removed in a future release.
 // This enum is used by hipBLAS and support for pack_int8x4 datatype will be removed from hipBLAS.
 typedef enum rocblas_int8_type_for_hipblas_
@@ -335,6 +408,16 @@ typedef enum rocblas_check_numerics_mode_
     //Return 'rocblas_status_check_numeric_fail' status if there is NaN/Inf/denormal value
     rocblas_check_numerics_mode_fail = 0x4,
 
+    //Defer the reporting of checks until rocblas_report_check_numerics (beta API) is called
+    //or ROCBLAS_CHECK_NUMERICS_REPORT_INTERVAL checks are pending, instead of synchronizing
+    //in every checked function; combined with the modes above
+    rocblas_check_numerics_mode_deferred = 0x8,
+
+    //Check only the outputs of functions; axpy, scal and ger detect NaN/Inf/denormal values
+    //in their compute kernels as they write them, instead of rereading the outputs in separate
+    //checking kernels; combined with the modes above
+    rocblas_check_numerics_mode_fused = 0x10,
+
 } rocblas_check_numerics_mode;
 
 #endif /* ROCBLAS_TYPES_H */
@@ -36,10 +36,16 @@
 #define ROCBLAS_IAMAX_NB 1024
 #define ROCBLAS_NRM2_NB 512
 #define ROCBLAS_ROT_NB 512
+#define ROCBLAS_ROTG_NB 64
 #define ROCBLAS_ROTM_NB 512
+#define ROCBLAS_ROTMG_NB 64
 #define ROCBLAS_SCAL_NB 256
 #define ROCBLAS_SWAP_NB 256
 
+// L1 NB of the wave32 instantiations, which the handle selects at run time on RDNA architectures
+#define ROCBLAS_DOT_NB_WAVE32 256
+#define ROCBLAS_IAMAX_NB_WAVE32 256
+
 // L2 NB
 #define ROCBLAS_TPMV_NB 512
 #define ROCBLAS_SDCTRSV_NB 64
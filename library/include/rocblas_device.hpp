@@ -0,0 +1,310 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*!\file
+ * \brief rocblas_device.hpp provides header-only device functions, callable from
+ * user kernels compiled with hipcc, for the building blocks of the rocBLAS
+ * kernels: wavefront and block sums, dot products, gemv tiles and gemm tiles.
+ *
+ * The functions are collective: they must be called with the same arguments by
+ * all the threads of the group named in their description, the wavefront or the
+ * thread block, all of which must be active, and those which synchronize the
+ * block must be reached by every thread of the block. Thread blocks are one
+ * dimensional. Nothing is launched, allocated or synchronized with the host.
+ *
+ * WF is the wavefront size the kernel is compiled for, which the functions do not
+ * check: rocblas_device::wavefront_size on the device side, 64 on CDNA and 32 or
+ * 64 on RDNA devices, as given by hipDeviceProp_t::warpSize on the host side.
+ *
+ * The supported types are float, double, rocblas_float_complex and
+ * rocblas_double_complex. Register use is given per thread, and LDS use, which
+ * the caller allocates as __shared__ memory and may reuse between calls, in
+ * elements of the type T.
+ */
+
+#ifndef ROCBLAS_DEVICE_HPP
+#define ROCBLAS_DEVICE_HPP
+
+#include "rocblas.h"
+#include <cstddef>
+#include <hip/hip_runtime.h>
+#include <type_traits>
+
+namespace rocblas_device
+{
+#if defined(__AMDGCN_WAVEFRONT_SIZE)
+    constexpr int wavefront_size = __AMDGCN_WAVEFRONT_SIZE;
+#else
+    constexpr int wavefront_size = 64;
+#endif
+
+    namespace detail
+    {
+        template <typename T>
+        __device__ inline T shfl_xor(T val, int mask)
+        {
+            return __shfl_xor(val, mask);
+        }
+
+        template <typename T>
+        __device__ inline rocblas_complex_num<T> shfl_xor(rocblas_complex_num<T> val, int mask)
+        {
+            return {__shfl_xor(val.real(), mask), __shfl_xor(val.imag(), mask)};
+        }
+
+        // Conjugates complex values when CONJ is true
+        template <typename T, bool CONJ>
+        __device__ inline T conj_if(T val, std::integral_constant<bool, CONJ>)
+        {
+            return val;
+        }
+
+        template <typename T>
+        __device__ inline rocblas_complex_num<T> conj_if(rocblas_complex_num<T> val,
+                                                         std::true_type)
+        {
+            return std::conj(val);
+        }
+    }
+
+    /*! \brief Sum over a wavefront.
+     *  Returns to every lane of the wavefront the sum of val over its WF lanes.
+     *  Registers: 2 values of T. LDS: none.
+     */
+    template <int WF, typename T>
+    __device__ inline T wavefront_sum(T val)
+    {
+        static_assert(WF == 32 || WF == 64, "WF must be the wavefront size, 32 or 64");
+#pragma unroll
+        for(int mask = WF / 2; mask > 0; mask /= 2)
+            val += detail::shfl_xor(val, mask);
+        return val;
+    }
+
+    /*! \brief Sum over a thread block of NB threads.
+     *  Returns to every thread of the block the sum of val over the block. Synchronizes
+     *  the block twice.
+     *  Registers: 2 values of T. LDS: lds holds NB / WF elements.
+     */
+    template <int NB, int WF, typename T>
+    __device__ inline T block_sum(T val, T* lds)
+    {
+        static_assert(NB % WF == 0 && NB / WF <= WF, "NB must be a multiple of WF up to WF * WF");
+        constexpr int n_waves = NB / WF;
+
+        int wave = threadIdx.x / WF;
+        int lane = threadIdx.x % WF;
+
+        val = wavefront_sum<WF>(val);
+        if(lane == 0)
+            lds[wave] = val;
+        __syncthreads();
+
+        val = lane < n_waves ? lds[lane] : T(0);
+        val = wavefront_sum<WF>(val);
+        __syncthreads(); // lds may be reused on return
+        return val;
+    }
+
+    /*! \brief Dot product by a wavefront.
+     *  Returns to every lane of the wavefront the sum over i < n of x[i * incx] * y[i * incy],
+     *  with x conjugated when CONJ is true. Consecutive lanes read consecutive elements.
+     *  Increments may be negative, x and y then pointing to the elements of index 0.
+     *  Registers: 3 values of T. LDS: none.
+     */
+    template <int WF, bool CONJ = false, typename T>
+    __device__ inline T
+        dot_wavefront(int n, const T* x, ptrdiff_t incx, const T* y, ptrdiff_t incy)
+    {
+        int lane = threadIdx.x % WF;
+        T   sum  = T(0);
+        for(int i = lane; i < n; i += WF)
+            sum += detail::conj_if(x[i * incx], std::integral_constant<bool, CONJ>{})
+                   * y[i * incy];
+        return wavefront_sum<WF>(sum);
+    }
+
+    /*! \brief Dot product by a thread block of NB threads.
+     *  Returns to every thread of the block the dot product of dot_wavefront, summed by
+     *  block_sum.
+     *  Registers: 3 values of T. LDS: lds holds NB / WF elements.
+     */
+    template <int NB, int WF, bool CONJ = false, typename T>
+    __device__ inline T
+        dot_block(int n, const T* x, ptrdiff_t incx, const T* y, ptrdiff_t incy, T* lds)
+    {
+        T sum = T(0);
+        for(int i = threadIdx.x; i < n; i += NB)
+            sum += detail::conj_if(x[i * incx], std::integral_constant<bool, CONJ>{})
+                   * y[i * incy];
+        return block_sum<NB, WF>(sum, lds);
+    }
+
+    /*! \brief Non-transposed gemv by a thread block of NB threads.
+     *  y := alpha * A * x + beta * y for the m by n column major matrix A. Each thread
+     *  computes the rows of y congruent to its index modulo NB, so that consecutive threads
+     *  read consecutive elements of a column of A. y is not read when beta is 0.
+     *  Registers: 2 + 4 values of T. LDS: none.
+     */
+    template <int NB, typename T>
+    __device__ inline void gemv_tile(int       m,
+                                     int       n,
+                                     T         alpha,
+                                     const T*  A,
+                                     ptrdiff_t lda,
+                                     const T*  x,
+                                     ptrdiff_t incx,
+                                     T         beta,
+                                     T*        y,
+                                     ptrdiff_t incy)
+    {
+        for(int i = threadIdx.x; i < m; i += NB)
+        {
+            T   sum = T(0);
+            int j   = 0;
+            for(; j + 4 <= n; j += 4)
+            {
+                T a0 = A[i + (j + 0) * lda], a1 = A[i + (j + 1) * lda];
+                T a2 = A[i + (j + 2) * lda], a3 = A[i + (j + 3) * lda];
+                sum += a0 * x[(j + 0) * incx] + a1 * x[(j + 1) * incx]
+                       + a2 * x[(j + 2) * incx] + a3 * x[(j + 3) * incx];
+            }
+            for(; j < n; j++)
+                sum += A[i + j * lda] * x[j * incx];
+
+            y[i * incy] = beta == T(0) ? alpha * sum : alpha * sum + beta * y[i * incy];
+        }
+    }
+
+    /*! \brief Transposed gemv by a thread block of NB threads.
+     *  y := alpha * op(A) * x + beta * y for the m by n column major matrix A, where op(A) is
+     *  A^T, or A^H when CONJ is true, and y has n elements. Each wavefront computes the
+     *  elements of y congruent to its index modulo NB / WF with dot_wavefront over a column.
+     *  y is not read when beta is 0.
+     *  Registers: 3 values of T. LDS: none.
+     */
+    template <int NB, int WF, bool CONJ = false, typename T>
+    __device__ inline void gemv_t_tile(int       m,
+                                       int       n,
+                                       T         alpha,
+                                       const T*  A,
+                                       ptrdiff_t lda,
+                                       const T*  x,
+                                       ptrdiff_t incx,
+                                       T         beta,
+                                       T*        y,
+                                       ptrdiff_t incy)
+    {
+        static_assert(NB % WF == 0, "NB must be a multiple of WF");
+        int wave = threadIdx.x / WF;
+        int lane = threadIdx.x % WF;
+        for(int j = wave; j < n; j += NB / WF)
+        {
+            T sum = dot_wavefront<WF, CONJ>(m, A + j * lda, 1, x, incx);
+            if(lane == 0)
+                y[j * incy] = beta == T(0) ? alpha * sum : alpha * sum + beta * y[j * incy];
+        }
+    }
+
+    //! @brief Elements of T of the LDS of gemm_tile<M, N, K, ...>.
+    template <int M, int N, int K>
+    constexpr int gemm_tile_lds_elements = (M + N) * K;
+
+    /*! \brief Gemm tile by a thread block of NT threads.
+     *  C := alpha * op(A) * op(B) + beta * C for an m by n tile of C, with m <= M and n <= N,
+     *  and op(A) m by k and op(B) k by n. op(X) is X, or X^T when TRANS_X is true, of column
+     *  major matrices. Blocks of K columns of op(A) and K rows of op(B) are staged through
+     *  LDS, zero padded to the M by K and K by N tiles, and each thread accumulates
+     *  M * N / NT elements of C, those of index threadIdx.x modulo NT in the column major
+     *  M by N tile. C is not read when beta is 0. Synchronizes the block twice per K columns.
+     *  Registers: M * N / NT + 2 values of T. LDS: lds holds gemm_tile_lds_elements<M, N, K>.
+     */
+    template <int  M,
+              int  N,
+              int  K,
+              int  NT,
+              bool TRANS_A = false,
+              bool TRANS_B = false,
+              typename T>
+    __device__ inline void gemm_tile(int       m,
+                                     int       n,
+                                     int       k,
+                                     T         alpha,
+                                     const T*  A,
+                                     ptrdiff_t lda,
+                                     const T*  B,
+                                     ptrdiff_t ldb,
+                                     T         beta,
+                                     T*        C,
+                                     ptrdiff_t ldc,
+                                     T*        lds)
+    {
+        static_assert((M * N) % NT == 0, "NT must divide M * N");
+        constexpr int R = M * N / NT;
+
+        T* sA = lds; // M by K
+        T* sB = lds + M * K; // K by N
+
+        T acc[R];
+#pragma unroll
+        for(int r = 0; r < R; r++)
+            acc[r] = T(0);
+
+        for(int k0 = 0; k0 < k; k0 += K)
+        {
+            for(int e = threadIdx.x; e < M * K; e += NT)
+            {
+                int i = e % M, l = k0 + e / M;
+                sA[e] = i < m && l < k ? (TRANS_A ? A[l + i * lda] : A[i + l * lda]) : T(0);
+            }
+            for(int e = threadIdx.x; e < K * N; e += NT)
+            {
+                int l = k0 + e % K, j = e / K;
+                sB[e] = l < k && j < n ? (TRANS_B ? B[j + l * ldb] : B[l + j * ldb]) : T(0);
+            }
+            __syncthreads();
+
+#pragma unroll
+            for(int r = 0; r < R; r++)
+            {
+                int e = threadIdx.x + r * NT, i = e % M, j = e / M;
+#pragma unroll
+                for(int l = 0; l < K; l++)
+                    acc[r] += sA[i + l * M] * sB[l + j * K];
+            }
+            __syncthreads(); // lds is refilled, or may be reused on return
+        }
+
+#pragma unroll
+        for(int r = 0; r < R; r++)
+        {
+            int e = threadIdx.x + r * NT, i = e % M, j = e / M;
+            if(i < m && j < n)
+            {
+                T& c = C[i + j * ldc];
+                c    = beta == T(0) ? alpha * acc[r] : alpha * acc[r] + beta * c;
+            }
+        }
+    }
+}
+
+#endif /* ROCBLAS_DEVICE_HPP */
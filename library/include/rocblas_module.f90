@@ -97,6 +97,8 @@ module rocblas_enums
     enum, bind(c)
         enumerator :: rocblas_geam_ex_operation_min_plus = 0
         enumerator :: rocblas_geam_ex_operation_plus_min = 1
+        enumerator :: rocblas_geam_ex_operation_max_plus = 2
+        enumerator :: rocblas_geam_ex_operation_max_min = 3
     end enum
 
 end module rocblas_enums
@@ -13028,4 +13030,543 @@ module rocblas
         end function rocblas_trsm_strided_batched_ex
     end interface
 
+    !!!!!!!!!!!!!!!!!!!!!!!
+    !   rocblas-beta.h    !
+    !!!!!!!!!!!!!!!!!!!!!!!
+
+    ! Device array of pointers of a strided allocation, built on the stream of the handle for
+    ! the batched functions without a host array of c_loc pointers
+    interface
+        function rocblas_set_pointer_array(handle, elem_size, base, stride, batch_count, ptr_array) &
+            bind(c, name='rocblas_set_pointer_array')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_set_pointer_array
+            type(c_ptr), value :: handle
+            integer(c_int), value :: elem_size
+            type(c_ptr), value :: base
+            integer(c_int64_t), value :: stride
+            integer(c_int), value :: batch_count
+            type(c_ptr), value :: ptr_array
+        end function rocblas_set_pointer_array
+    end interface
+
+    ! The same array of pointers, kept in a cache of the handle and built only once
+    interface
+        function rocblas_get_pointer_array(handle, elem_size, base, stride, batch_count, ptr_array) &
+            bind(c, name='rocblas_get_pointer_array')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_get_pointer_array
+            type(c_ptr), value :: handle
+            integer(c_int), value :: elem_size
+            type(c_ptr), value :: base
+            integer(c_int64_t), value :: stride
+            integer(c_int), value :: batch_count
+            type(c_ptr), value :: ptr_array
+        end function rocblas_get_pointer_array
+    end interface
+
+    ! 64-bit integer sizes and increments
+    ! scal_64
+    interface
+        function rocblas_sscal_64(handle, n, alpha, x, incx) &
+            bind(c, name='rocblas_sscal_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_sscal_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+        end function rocblas_sscal_64
+    end interface
+
+    interface
+        function rocblas_dscal_64(handle, n, alpha, x, incx) &
+            bind(c, name='rocblas_dscal_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_dscal_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+        end function rocblas_dscal_64
+    end interface
+
+    interface
+        function rocblas_cscal_64(handle, n, alpha, x, incx) &
+            bind(c, name='rocblas_cscal_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_cscal_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+        end function rocblas_cscal_64
+    end interface
+
+    interface
+        function rocblas_zscal_64(handle, n, alpha, x, incx) &
+            bind(c, name='rocblas_zscal_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_zscal_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+        end function rocblas_zscal_64
+    end interface
+
+    interface
+        function rocblas_csscal_64(handle, n, alpha, x, incx) &
+            bind(c, name='rocblas_csscal_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_csscal_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+        end function rocblas_csscal_64
+    end interface
+
+    interface
+        function rocblas_zdscal_64(handle, n, alpha, x, incx) &
+            bind(c, name='rocblas_zdscal_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_zdscal_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+        end function rocblas_zdscal_64
+    end interface
+
+    ! copy_64
+    interface
+        function rocblas_scopy_64(handle, n, x, incx, y, incy) &
+            bind(c, name='rocblas_scopy_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_scopy_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function rocblas_scopy_64
+    end interface
+
+    interface
+        function rocblas_dcopy_64(handle, n, x, incx, y, incy) &
+            bind(c, name='rocblas_dcopy_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_dcopy_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function rocblas_dcopy_64
+    end interface
+
+    interface
+        function rocblas_ccopy_64(handle, n, x, incx, y, incy) &
+            bind(c, name='rocblas_ccopy_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_ccopy_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function rocblas_ccopy_64
+    end interface
+
+    interface
+        function rocblas_zcopy_64(handle, n, x, incx, y, incy) &
+            bind(c, name='rocblas_zcopy_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_zcopy_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function rocblas_zcopy_64
+    end interface
+
+    ! dot_64
+    interface
+        function rocblas_sdot_64(handle, n, x, incx, y, incy, result) &
+            bind(c, name='rocblas_sdot_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_sdot_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+            type(c_ptr), value :: result
+        end function rocblas_sdot_64
+    end interface
+
+    interface
+        function rocblas_ddot_64(handle, n, x, incx, y, incy, result) &
+            bind(c, name='rocblas_ddot_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_ddot_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+            type(c_ptr), value :: result
+        end function rocblas_ddot_64
+    end interface
+
+    interface
+        function rocblas_cdotu_64(handle, n, x, incx, y, incy, result) &
+            bind(c, name='rocblas_cdotu_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_cdotu_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+            type(c_ptr), value :: result
+        end function rocblas_cdotu_64
+    end interface
+
+    interface
+        function rocblas_zdotu_64(handle, n, x, incx, y, incy, result) &
+            bind(c, name='rocblas_zdotu_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_zdotu_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+            type(c_ptr), value :: result
+        end function rocblas_zdotu_64
+    end interface
+
+    interface
+        function rocblas_cdotc_64(handle, n, x, incx, y, incy, result) &
+            bind(c, name='rocblas_cdotc_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_cdotc_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+            type(c_ptr), value :: result
+        end function rocblas_cdotc_64
+    end interface
+
+    interface
+        function rocblas_zdotc_64(handle, n, x, incx, y, incy, result) &
+            bind(c, name='rocblas_zdotc_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_zdotc_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+            type(c_ptr), value :: result
+        end function rocblas_zdotc_64
+    end interface
+
+    ! swap_64
+    interface
+        function rocblas_sswap_64(handle, n, x, incx, y, incy) &
+            bind(c, name='rocblas_sswap_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_sswap_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function rocblas_sswap_64
+    end interface
+
+    interface
+        function rocblas_dswap_64(handle, n, x, incx, y, incy) &
+            bind(c, name='rocblas_dswap_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_dswap_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function rocblas_dswap_64
+    end interface
+
+    interface
+        function rocblas_cswap_64(handle, n, x, incx, y, incy) &
+            bind(c, name='rocblas_cswap_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_cswap_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function rocblas_cswap_64
+    end interface
+
+    interface
+        function rocblas_zswap_64(handle, n, x, incx, y, incy) &
+            bind(c, name='rocblas_zswap_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_zswap_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function rocblas_zswap_64
+    end interface
+
+    ! axpy_64
+    interface
+        function rocblas_haxpy_64(handle, n, alpha, x, incx, y, incy) &
+            bind(c, name='rocblas_haxpy_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_haxpy_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function rocblas_haxpy_64
+    end interface
+
+    interface
+        function rocblas_saxpy_64(handle, n, alpha, x, incx, y, incy) &
+            bind(c, name='rocblas_saxpy_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_saxpy_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function rocblas_saxpy_64
+    end interface
+
+    interface
+        function rocblas_daxpy_64(handle, n, alpha, x, incx, y, incy) &
+            bind(c, name='rocblas_daxpy_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_daxpy_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function rocblas_daxpy_64
+    end interface
+
+    interface
+        function rocblas_caxpy_64(handle, n, alpha, x, incx, y, incy) &
+            bind(c, name='rocblas_caxpy_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_caxpy_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function rocblas_caxpy_64
+    end interface
+
+    interface
+        function rocblas_zaxpy_64(handle, n, alpha, x, incx, y, incy) &
+            bind(c, name='rocblas_zaxpy_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_zaxpy_64
+            type(c_ptr), value :: handle
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function rocblas_zaxpy_64
+    end interface
+
+    ! gemv_64
+    interface
+        function rocblas_sgemv_64(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy) &
+            bind(c, name='rocblas_sgemv_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_sgemv_64
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: transA
+            integer(c_int64_t), value :: m
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int64_t), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function rocblas_sgemv_64
+    end interface
+
+    interface
+        function rocblas_dgemv_64(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy) &
+            bind(c, name='rocblas_dgemv_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_dgemv_64
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: transA
+            integer(c_int64_t), value :: m
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int64_t), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function rocblas_dgemv_64
+    end interface
+
+    interface
+        function rocblas_cgemv_64(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy) &
+            bind(c, name='rocblas_cgemv_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_cgemv_64
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: transA
+            integer(c_int64_t), value :: m
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int64_t), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function rocblas_cgemv_64
+    end interface
+
+    interface
+        function rocblas_zgemv_64(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy) &
+            bind(c, name='rocblas_zgemv_64')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_zgemv_64
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: transA
+            integer(c_int64_t), value :: m
+            integer(c_int64_t), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int64_t), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function rocblas_zgemv_64
+    end interface
+
 end module rocblas
@@ -0,0 +1,59 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "async_status.hpp"
+
+rocblas_status rocblas_async_status::init()
+{
+    if(h_status)
+        return rocblas_status_success;
+
+    RETURN_IF_HIP_ERROR(hipHostMalloc(
+        &h_status, sizeof(rocblas_status), hipHostMallocCoherent | hipHostMallocMapped));
+    *h_status = rocblas_status_success;
+
+    hipError_t hip_status = hipHostGetDevicePointer((void**)&d_status, h_status, 0);
+    if(hip_status != hipSuccess)
+    {
+        (void)hipHostFree(h_status);
+        h_status = nullptr;
+        d_status = nullptr;
+        return get_rocblas_status_for_hip_status(hip_status);
+    }
+    return rocblas_status_success;
+}
+
+ROCBLAS_KERNEL(1)
+rocblas_check_numerics_async_status_kernel(const rocblas_check_numerics_t* record,
+                                           rocblas_status*                 status)
+{
+    if(record->has_NaN || record->has_Inf || record->has_denorm)
+        rocblas_set_async_status_device(status, rocblas_status_check_numerics_fail);
+}
+
+void rocblas_check_numerics_set_async_status(hipStream_t                     stream,
+                                             const rocblas_check_numerics_t* record,
+                                             rocblas_status*                 status)
+{
+    hipLaunchKernelGGL(
+        rocblas_check_numerics_async_status_kernel, dim3(1), dim3(1), 0, stream, record, status);
+}
@@ -0,0 +1,196 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "binary_log.hpp"
+#include <chrono>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+constexpr char rocblas_binary_log::MAGIC[8];
+
+namespace
+{
+    uint64_t rocblas_binary_log_ticks()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    // Replace each "%p" in path by the process id
+    std::string rocblas_binary_log_path(const char* path)
+    {
+        std::string result;
+        for(const char* p = path; *p; ++p)
+        {
+            if(p[0] == '%' && p[1] == 'p')
+            {
+#ifdef WIN32
+                result += std::to_string(_getpid());
+#else
+                result += std::to_string(getpid());
+#endif
+                ++p;
+            }
+            else
+                result += *p;
+        }
+        return result;
+    }
+}
+
+rocblas_binary_log::rocblas_binary_log(header_t* header)
+    : header(header)
+    , strings(reinterpret_cast<char*>(header) + header->strings_offset)
+    , records(reinterpret_cast<record_t*>(reinterpret_cast<char*>(header) + header->records_offset))
+{
+}
+
+rocblas_binary_log* rocblas_binary_log::open(const char* path, size_t capacity)
+{
+    static rocblas_binary_log* log = [=]() -> rocblas_binary_log* {
+#ifdef WIN32
+        // Memory-mapped logging is not supported on Windows; the text log is used instead
+        return nullptr;
+#else
+        size_t n_records = capacity ? capacity : DEFAULT_CAPACITY;
+
+        size_t strings_offset = (sizeof(header_t) + 4095) & ~size_t(4095);
+        size_t records_offset = strings_offset + STRINGS_SIZE;
+        size_t mapped_size    = records_offset + n_records * sizeof(record_t);
+
+        std::string filename = rocblas_binary_log_path(path);
+        int fd = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if(fd < 0)
+            return nullptr;
+
+        void* mapping = MAP_FAILED;
+        if(ftruncate(fd, mapped_size) == 0)
+            mapping = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if(mapping == MAP_FAILED)
+            return nullptr;
+
+        // The file is zero filled, so every record starts out incomplete
+        auto* header = static_cast<header_t*>(mapping);
+        header->version        = VERSION;
+        header->record_size    = sizeof(record_t);
+        header->capacity       = n_records;
+        header->strings_offset = strings_offset;
+        header->strings_size   = STRINGS_SIZE;
+        header->records_offset = records_offset;
+        header->start_time     = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::system_clock::now().time_since_epoch())
+                                 .count();
+        header->start_ticks    = rocblas_binary_log_ticks();
+
+        // The magic number is written last, so that a partial header is not recognized
+        memcpy(header->magic, MAGIC, sizeof(MAGIC));
+
+        return new rocblas_binary_log(header);
+#endif
+    }();
+    return log;
+}
+
+rocblas_binary_log::record_t* rocblas_binary_log::begin_record(uint64_t& index)
+{
+    index            = __atomic_fetch_add(&header->next_record, 1, __ATOMIC_RELAXED);
+    record_t* record = &records[index % header->capacity];
+
+    __atomic_store_n(&record->sequence, 0, __ATOMIC_RELAXED);
+    record->timestamp = rocblas_binary_log_ticks();
+    record->count     = 0;
+    record->flags     = 0;
+    return record;
+}
+
+void rocblas_binary_log::end_record(record_t* record, uint64_t index)
+{
+    __atomic_store_n(&record->sequence, index + 1, __ATOMIC_RELEASE);
+}
+
+uint32_t rocblas_binary_log::intern(const char* s)
+{
+    // Most strings are literals, so each thread caches their offsets by address. The
+    // contents are compared too, since an address may be reused for another string.
+    thread_local std::unordered_map<const char*, uint32_t> cache;
+
+    auto it = cache.find(s);
+    if(it != cache.end() && !strcmp(string_at(it->second), s))
+        return it->second;
+
+    uint32_t offset = add_string(s, strlen(s));
+    if(offset != NO_STRING)
+    {
+        if(cache.size() >= MAX_CACHED_STRINGS)
+            cache.clear();
+        cache[s] = offset;
+    }
+    return offset;
+}
+
+uint32_t rocblas_binary_log::intern(const std::string& s)
+{
+    thread_local std::unordered_map<std::string, uint32_t> cache;
+
+    auto it = cache.find(s);
+    if(it != cache.end())
+        return it->second;
+
+    uint32_t offset = add_string(s.c_str(), s.size());
+    if(offset != NO_STRING)
+    {
+        if(cache.size() >= MAX_CACHED_STRINGS)
+            cache.clear();
+        cache.emplace(s, offset);
+    }
+    return offset;
+}
+
+uint32_t rocblas_binary_log::add_string(const char* s, size_t length)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    std::string key(s, length);
+    auto        it = string_offsets.find(key);
+    if(it != string_offsets.end())
+        return it->second;
+
+    uint64_t used = header->strings_used;
+    size_t   size = sizeof(uint32_t) + length + 1;
+    if(used + size > header->strings_size)
+        return NO_STRING;
+
+    uint32_t length32 = uint32_t(length);
+    memcpy(strings + used, &length32, sizeof(length32));
+    memcpy(strings + used + sizeof(length32), s, length);
+    strings[used + sizeof(length32) + length] = '\0';
+    __atomic_store_n(&header->strings_used, used + size, __ATOMIC_RELEASE);
+
+    string_offsets.emplace(std::move(key), uint32_t(used));
+    return uint32_t(used);
+}
@@ -20,6 +20,9 @@
  *
  * ************************************************************************ */
 #include "rocblas_axpy.hpp"
+#include "check_numerics_vector.hpp"
+#include "int64_helpers.hpp"
+#include "level1_fusion.hpp"
 #include "logging.hpp"
 #include "rocblas_block_sizes.h"
 
@@ -55,7 +58,7 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, name, n, LOG_TRACE_SCALAR_VALUE(handle, alpha), x, incx, y, incy);
@@ -97,6 +100,10 @@ namespace
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
+        rocblas_status fusion_status = rocblas_level1_fusion_axpy(handle, n, alpha, x, incx, y, incy);
+        if(fusion_status != rocblas_status_continue)
+            return fusion_status;
+
         if(check_numerics)
         {
             bool           is_input = true;
@@ -119,6 +126,9 @@ namespace
                 return axpy_check_numerics_status;
         }
 
+        rocblas_fused_check_numerics fused_check(handle, rocblas_axpy_name<T>, check_numerics);
+        RETURN_IF_ROCBLAS_ERROR(fused_check.begin());
+
         rocblas_status status = rocblas_internal_axpy_template<NB, T>(handle,
                                                                       n,
                                                                       alpha,
@@ -135,6 +145,10 @@ namespace
         if(status != rocblas_status_success)
             return status;
 
+        // The outputs were checked by the compute kernels
+        if(fused_check.is_active())
+            return fused_check.end();
+
         if(check_numerics)
         {
             bool           is_input = false;
@@ -159,6 +173,38 @@ namespace
         return status;
     }
 
+    template <int NB, typename T>
+    rocblas_status rocblas_axpy_64_impl(rocblas_handle handle,
+                                        int64_t        n,
+                                        const T*       alpha,
+                                        const T*       x,
+                                        int64_t        incx,
+                                        T*             y,
+                                        int64_t        incy,
+                                        const char*    name,
+                                        const char*    bench_name)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        auto axpy_chunk = [&](int64_t     offset_x,
+                              int64_t     offset_y,
+                              rocblas_int n_c,
+                              rocblas_int incx_c,
+                              rocblas_int incy_c) {
+            return rocblas_axpy_impl<NB>(handle,
+                                         n_c,
+                                         alpha,
+                                         rocblas_chunk_ptr_64(x, offset_x),
+                                         incx_c,
+                                         rocblas_chunk_ptr_64(y, offset_y),
+                                         incy_c,
+                                         name,
+                                         bench_name);
+        };
+        return rocblas_chunk_vectors_64(handle, n, incx, incy, axpy_chunk);
+    }
+
 }
 
 /*
@@ -199,4 +245,34 @@ IMPL(rocblas_haxpy, rocblas_half);
 
 #undef IMPL
 
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                             \
+    rocblas_status routine_name_(rocblas_handle handle,                     \
+                                 int64_t        n,                          \
+                                 const T_*      alpha,                      \
+                                 const T_*      x,                          \
+                                 int64_t        incx,                       \
+                                 T_*            y,                          \
+                                 int64_t        incy)                       \
+    try                                                                     \
+    {                                                                       \
+        return rocblas_axpy_64_impl<ROCBLAS_AXPY_NB>(                       \
+            handle, n, alpha, x, incx, y, incy, #routine_name_, "axpy_64"); \
+    }                                                                       \
+    catch(...)                                                              \
+    {                                                                       \
+        return exception_to_rocblas_status();                               \
+    }
+
+IMPL(rocblas_saxpy_64, float);
+IMPL(rocblas_daxpy_64, double);
+IMPL(rocblas_caxpy_64, rocblas_float_complex);
+IMPL(rocblas_zaxpy_64, rocblas_double_complex);
+IMPL(rocblas_haxpy_64, rocblas_half);
+
+#undef IMPL
+
 } // extern "C"
@@ -91,3 +91,25 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                    rocblas_int    incy,
                                    rocblas_stride stride_y,
                                    rocblas_int    batch_count);
+
+//!
+//! @brief General template to compute y = alpha * x + beta * y in one pass, or y = alpha * x
+//!        without reading y when beta is nullptr or a host zero.
+//!
+template <int NB, typename Tex, typename Ta, typename Tx, typename Ty>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_axpby_template(rocblas_handle handle,
+                                    rocblas_int    n,
+                                    const Ta*      alpha,
+                                    rocblas_stride stride_alpha,
+                                    Tx             x,
+                                    rocblas_stride offset_x,
+                                    rocblas_int    incx,
+                                    rocblas_stride stride_x,
+                                    const Ta*      beta,
+                                    rocblas_stride stride_beta,
+                                    Ty             y,
+                                    rocblas_stride offset_y,
+                                    rocblas_int    incy,
+                                    rocblas_stride stride_y,
+                                    rocblas_int    batch_count);
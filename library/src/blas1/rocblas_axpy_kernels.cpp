@@ -24,23 +24,27 @@
 #include "handle.hpp"
 #include "logging.hpp"
 #include "rocblas_axpy.hpp"
+#include "rocblas_dwordx4.hpp"
+#include "rocblas_level1_launch.hpp"
 
 //!
-//! @brief General kernel (batched, strided batched) of axpy.
+//! @brief General kernel (batched, strided batched) of axpy, looping over the elements with the
+//!        stride of the grid.
 //!
-template <rocblas_int NB, typename Tex, typename Ta, typename Tx, typename Ty>
+template <rocblas_int NB, typename Tex, bool CHECK_NUMERICS, typename Ta, typename Tx, typename Ty>
 ROCBLAS_KERNEL(NB)
-rocblas_axpy_kernel(rocblas_int    n,
-                    Ta             alpha_device_host,
-                    rocblas_stride stride_alpha,
+rocblas_axpy_kernel(rocblas_int               n,
+                    Ta                        alpha_device_host,
+                    rocblas_stride            stride_alpha,
                     Tx __restrict__ x,
-                    rocblas_stride offset_x,
-                    rocblas_int    incx,
-                    rocblas_stride stride_x,
+                    rocblas_stride            offset_x,
+                    rocblas_int               incx,
+                    rocblas_stride            stride_x,
                     Ty __restrict__ y,
-                    rocblas_stride offset_y,
-                    rocblas_int    incy,
-                    rocblas_stride stride_y)
+                    rocblas_stride            offset_y,
+                    rocblas_int               incy,
+                    rocblas_stride            stride_y,
+                    rocblas_check_numerics_t* abnormal)
 {
     auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
     if(!alpha)
@@ -48,31 +52,35 @@ rocblas_axpy_kernel(rocblas_int    n,
         return;
     }
 
-    ptrdiff_t tid = blockIdx.x * blockDim.x + threadIdx.x;
-    if(tid < n)
+    for(ptrdiff_t tid = blockIdx.x * blockDim.x + threadIdx.x; tid < n;
+        tid += ptrdiff_t(gridDim.x) * blockDim.x)
     {
         auto tx = load_ptr_batch(x, blockIdx.y, offset_x + tid * incx, stride_x);
         auto ty = load_ptr_batch(y, blockIdx.y, offset_y + tid * incy, stride_y);
 
         *ty = (*ty) + Tex(alpha) * (*tx);
+        rocblas_check_numerics_output<CHECK_NUMERICS>(*ty, abnormal);
     }
 }
 
 //!
-//! @brief Optimized kernel for the AXPY floating points.
+//! @brief Optimized kernel (batched, strided batched) of axpy with unit increments, using 128-bit
+//!        loads and stores for the aligned part of the vectors, nontemporal if nontemporal.
 //! @remark Increment are required to be equal to one, that's why they are unspecified.
 //!
-template <rocblas_int NB, typename Tex, typename Ta, typename Tx, typename Ty>
+template <rocblas_int NB, typename Tex, bool CHECK_NUMERICS, typename Ta, typename Tx, typename Ty>
 ROCBLAS_KERNEL(NB)
-rocblas_saxpy_2_kernel(rocblas_int    n,
-                       Ta             alpha_device_host,
-                       rocblas_stride stride_alpha,
-                       Tx __restrict__ x,
-                       rocblas_stride offset_x,
-                       rocblas_stride stride_x,
-                       Ty __restrict__ y,
-                       rocblas_stride offset_y,
-                       rocblas_stride stride_y)
+rocblas_axpy_dwordx4_kernel(rocblas_int               n,
+                            bool                      nontemporal,
+                            Ta                        alpha_device_host,
+                            rocblas_stride            stride_alpha,
+                            Tx __restrict__ x,
+                            rocblas_stride            offset_x,
+                            rocblas_stride            stride_x,
+                            Ty __restrict__ y,
+                            rocblas_stride            offset_y,
+                            rocblas_stride            stride_y,
+                            rocblas_check_numerics_t* abnormal)
 {
     auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
     if(!alpha)
@@ -82,41 +90,44 @@ rocblas_saxpy_2_kernel(rocblas_int    n,
     auto* tx = load_ptr_batch(x, blockIdx.y, offset_x, stride_x);
     auto* ty = load_ptr_batch(y, blockIdx.y, offset_y, stride_y);
 
-    ptrdiff_t tid = (blockIdx.x * blockDim.x + threadIdx.x) * 2;
-
-    if(tid < n - 1)
-    {
-        // Each thread access contiguous elements for example Thread '0' access indices '0' and '1' of the vectors `x` and `y`
-        for(rocblas_int j = 0; j < 2; ++j)
-        {
-            ty[tid + j] = ty[tid + j] + Tex(alpha) * tx[tid + j];
-        }
-    }
-
-    // If `n` is odd then the computation of last element in the vectors is covered below.
-    if(n % 2 != 0 && tid == n - 1)
-    {
-        ty[tid] = ty[tid] + Tex(alpha) * tx[tid];
-    }
+    Tex ex_alph = Tex(alpha);
+    rocblas_dwordx4_apply<true, false>(blockIdx.x * blockDim.x + threadIdx.x,
+                                       ptrdiff_t(gridDim.x) * blockDim.x,
+                                       n,
+                                       nontemporal,
+                                       tx,
+                                       ty,
+                                       [=](auto xi, auto& yi) {
+                                           yi = yi + ex_alph * xi;
+                                           rocblas_check_numerics_output<CHECK_NUMERICS>(
+                                               yi, abnormal);
+                                       });
 }
 
 //!
 //! @brief Large batch size kernel (batched, strided batched) of axpy.
 //!
-template <int DIM_X, int DIM_Y, typename Tex, typename Ta, typename Tx, typename Ty>
+template <int DIM_X,
+          int DIM_Y,
+          typename Tex,
+          bool CHECK_NUMERICS,
+          typename Ta,
+          typename Tx,
+          typename Ty>
 ROCBLAS_KERNEL(DIM_X* DIM_Y)
-rocblas_axpy_kernel_batched(rocblas_int    n,
-                            Ta             alpha_device_host,
-                            rocblas_stride stride_alpha,
-                            Tx             x,
-                            rocblas_stride offset_x,
-                            rocblas_int    incx,
-                            rocblas_stride stride_x,
-                            Ty             y,
-                            rocblas_stride offset_y,
-                            rocblas_int    incy,
-                            rocblas_stride stride_y,
-                            rocblas_int    batch_count)
+rocblas_axpy_kernel_batched(rocblas_int               n,
+                            Ta                        alpha_device_host,
+                            rocblas_stride            stride_alpha,
+                            Tx                        x,
+                            rocblas_stride            offset_x,
+                            rocblas_int               incx,
+                            rocblas_stride            stride_x,
+                            Ty                        y,
+                            rocblas_stride            offset_y,
+                            rocblas_int               incy,
+                            rocblas_stride            stride_y,
+                            rocblas_int               batch_count,
+                            rocblas_check_numerics_t* abnormal)
 {
     auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
     if(!alpha)
@@ -140,6 +151,7 @@ rocblas_axpy_kernel_batched(rocblas_int    n,
                 auto ty = load_ptr_batch(y, bid + i, offset_y, stride_y);
 
                 *ty = (*ty) + ex_alph * (*tx);
+                rocblas_check_numerics_output<CHECK_NUMERICS>(*ty, abnormal);
             }
         }
     }
@@ -149,17 +161,18 @@ rocblas_axpy_kernel_batched(rocblas_int    n,
 //! @brief Optimized kernel for the remaining part of 8 half floating points.
 //! @remark Increment are required to be equal to one, that's why they are unspecified.
 //!
-template <rocblas_int NB, typename Ta, typename Tx, typename Ty>
+template <rocblas_int NB, bool CHECK_NUMERICS, typename Ta, typename Tx, typename Ty>
 ROCBLAS_KERNEL(NB)
-rocblas_haxpy_mod_8_kernel(rocblas_int    n_mod_8,
-                           Ta             alpha_device_host,
-                           rocblas_stride stride_alpha,
-                           Tx             x,
-                           ptrdiff_t      offset_x,
-                           rocblas_stride stride_x,
-                           Ty             y,
-                           ptrdiff_t      offset_y,
-                           rocblas_stride stride_y)
+rocblas_haxpy_mod_8_kernel(rocblas_int               n_mod_8,
+                           Ta                        alpha_device_host,
+                           rocblas_stride            stride_alpha,
+                           Tx                        x,
+                           ptrdiff_t                 offset_x,
+                           rocblas_stride            stride_x,
+                           Ty                        y,
+                           ptrdiff_t                 offset_y,
+                           rocblas_stride            stride_y,
+                           rocblas_check_numerics_t* abnormal)
 {
     auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
     if(!alpha)
@@ -171,23 +184,25 @@ rocblas_haxpy_mod_8_kernel(rocblas_int    n_mod_8,
         auto tx = load_ptr_batch(x, blockIdx.y, offset_x + tid, stride_x);
         auto ty = load_ptr_batch(y, blockIdx.y, offset_y + tid, stride_y);
         *ty += alpha * (*tx);
+        rocblas_check_numerics_output<CHECK_NUMERICS>(*ty, abnormal);
     }
 }
 
 //!
 //! @brief Optimized kernel for the groups of 8 half floating points.
 //!
-template <rocblas_int NB, typename Ta, typename Tx, typename Ty>
+template <rocblas_int NB, bool CHECK_NUMERICS, typename Ta, typename Tx, typename Ty>
 ROCBLAS_KERNEL(NB)
-rocblas_haxpy_mlt_8_kernel(rocblas_int    n_mlt_8,
-                           Ta             alpha_device_host,
-                           rocblas_stride stride_alpha,
-                           Tx             x,
-                           rocblas_stride offset_x,
-                           rocblas_stride stride_x,
-                           Ty             y,
-                           rocblas_stride offset_y,
-                           rocblas_stride stride_y)
+rocblas_haxpy_mlt_8_kernel(rocblas_int               n_mlt_8,
+                           Ta                        alpha_device_host,
+                           rocblas_stride            stride_alpha,
+                           Tx                        x,
+                           rocblas_stride            offset_x,
+                           rocblas_stride            stride_x,
+                           Ty                        y,
+                           rocblas_stride            offset_y,
+                           rocblas_stride            stride_y,
+                           rocblas_check_numerics_t* abnormal)
 {
     // Load alpha into both sides of a rocblas_half2 for fma instructions.
     auto alpha_value = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
@@ -253,6 +268,12 @@ rocblas_haxpy_mlt_8_kernel(rocblas_int    n_mlt_8,
         (*ay)[5] = z2[1];
         (*ay)[6] = z3[0];
         (*ay)[7] = z3[1];
+
+        if constexpr(CHECK_NUMERICS)
+        {
+            for(int i = 0; i < 8; i++)
+                rocblas_check_numerics_value(rocblas_half((*ay)[i]), abnormal);
+        }
     }
 }
 
@@ -285,142 +306,351 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         //cppcheck-suppress duplicateExpression
         = std::is_same<Ta, rocblas_half>::value && std::is_same<Tex, rocblas_half>::value;
 
-    // Using float ?
-    static constexpr bool using_rocblas_float
-        = std::is_same<Ty, rocblas_float*>{} || std::is_same<Ty, rocblas_float* const*>{};
-
     static constexpr rocblas_stride stride_0 = 0;
 
-    //  unit_inc is True only if incx == 1  && incy == 1.
-    bool unit_inc = (incx == 1 && incy == 1);
+    // The kernels check the values they write with rocblas_check_numerics_mode_fused
+    rocblas_check_numerics_t* abnormal = handle->fused_check_numerics;
 
-    if(using_rocblas_half && unit_inc)
-    {
-        //
-        // Optimized version of rocblas_half, where incx == 1 and incy == 1.
-        // TODO: always use an optimized version.
-        //
-        //
-        // Note: Do not use pointer arithmetic with x and y when passing parameters.
-        // The kernel will do the cast if needed.
-        //
-        rocblas_int n_mod_8 = n & 7; // n mod 8
-        rocblas_int n_mlt_8 = n & ~(rocblas_int)7; // multiple of 8
-        int         blocks  = (n / 8 - 1) / NB + 1;
-        dim3        grid(blocks, batch_count);
-        dim3        threads(NB);
-        if(handle->pointer_mode == rocblas_pointer_mode_device)
+    auto launch_axpy = [&](auto fused) {
+        constexpr bool CHECK_NUMERICS = decltype(fused)::value;
+
+        //  unit_inc is True only if incx == 1  && incy == 1.
+        bool unit_inc = (incx == 1 && incy == 1);
+
+        if(using_rocblas_half && unit_inc)
         {
-            // clang-format off
-            hipLaunchKernelGGL((rocblas_haxpy_mlt_8_kernel<NB>), grid, threads, 0, handle->get_stream(), n_mlt_8,
-                               (const rocblas_half*)alpha, stride_alpha, x, offset_x, stride_x, y, offset_y, stride_y);
-            // clang-format on
-            if(n_mod_8)
+            //
+            // Optimized version of rocblas_half, where incx == 1 and incy == 1.
+            // TODO: always use an optimized version.
+            //
+            //
+            // Note: Do not use pointer arithmetic with x and y when passing parameters.
+            // The kernel will do the cast if needed.
+            //
+            rocblas_int n_mod_8 = n & 7; // n mod 8
+            rocblas_int n_mlt_8 = n & ~(rocblas_int)7; // multiple of 8
+            int         blocks  = (n / 8 - 1) / NB + 1;
+            dim3        grid(blocks, batch_count);
+            dim3        threads(NB);
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+            {
+                // clang-format off
+                hipLaunchKernelGGL((rocblas_haxpy_mlt_8_kernel<NB, CHECK_NUMERICS>), grid, threads, 0, handle->get_stream(), n_mlt_8,
+                                   (const rocblas_half*)alpha, stride_alpha, x, offset_x, stride_x, y, offset_y, stride_y, abnormal);
+                // clang-format on
+                if(n_mod_8)
+                {
+                    //
+                    // cleanup non-multiple of 8
+                    //
+                    // clang-format off
+                    hipLaunchKernelGGL((rocblas_haxpy_mod_8_kernel<NB, CHECK_NUMERICS>), dim3(1, batch_count), n_mod_8, 0, handle->get_stream(), n_mod_8,
+                                        alpha, stride_alpha, x, n_mlt_8 + offset_x, stride_x, y, n_mlt_8 + offset_y, stride_y, abnormal);
+                    // clang-format on
+                }
+            }
+            else
             {
-                //
-                // cleanup non-multiple of 8
-                //
+                // Note: We do not support batched alpha on host.
                 // clang-format off
-                hipLaunchKernelGGL((rocblas_haxpy_mod_8_kernel<NB>), dim3(1, batch_count), n_mod_8, 0, handle->get_stream(), n_mod_8,
-                                    alpha, stride_alpha, x, n_mlt_8 + offset_x, stride_x, y, n_mlt_8 + offset_y, stride_y);
+                hipLaunchKernelGGL((rocblas_haxpy_mlt_8_kernel<NB, CHECK_NUMERICS>), grid, threads, 0, handle->get_stream(),
+                                    n_mlt_8,load_scalar((const rocblas_half*)alpha), stride_0, x, offset_x, stride_x, y, offset_y, stride_y, abnormal);
                 // clang-format on
+
+                if(n_mod_8)
+                {
+                    // clang-format off
+                    hipLaunchKernelGGL((rocblas_haxpy_mod_8_kernel<NB, CHECK_NUMERICS>), dim3(1, batch_count), n_mod_8, 0, handle->get_stream(), n_mod_8,
+                                       *alpha, stride_0, x, n_mlt_8 + offset_x, stride_x, y, n_mlt_8 + offset_y, stride_y, abnormal);
+                    // clang-format on
+                }
             }
         }
-        else
+
+        else if(unit_inc && !(batch_count > 8192 && std::is_same<Ta, float>::value))
         {
-            // Note: We do not support batched alpha on host.
-            // clang-format off
-            hipLaunchKernelGGL((rocblas_haxpy_mlt_8_kernel<NB>), grid, threads, 0, handle->get_stream(),
-                                n_mlt_8,load_scalar((const rocblas_half*)alpha), stride_0, x, offset_x, stride_x, y, offset_y, stride_y);
-            // clang-format on
+            // Optimized kernel when incx==1 && incy==1, using 128-bit loads and stores of the
+            // aligned part of x and y, nontemporal beyond the L2. Float batch_count > 8192 uses
+            // the large batch size kernel below.
+            rocblas_level1_launch<NB> launch(handle, rocblas_dwordx4_count<Ty>(n), batch_count);
+            dim3                      blocks  = launch.grid;
+            dim3                      threads = launch.threads;
+
+            bool nontemporal = rocblas_level1_nontemporal<Ty>(handle, n, 2, batch_count);
 
-            if(n_mod_8)
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
             {
                 // clang-format off
-                hipLaunchKernelGGL((rocblas_haxpy_mod_8_kernel<NB>), dim3(1, batch_count), n_mod_8, 0, handle->get_stream(), n_mod_8,
-                                   *alpha, stride_0, x, n_mlt_8 + offset_x, stride_x, y, n_mlt_8 + offset_y, stride_y);
+                hipLaunchKernelGGL((rocblas_axpy_dwordx4_kernel<NB, Tex, CHECK_NUMERICS>), blocks, threads, 0, handle->get_stream(), n, nontemporal,
+                                   alpha, stride_alpha, x, offset_x, stride_x, y, offset_y, stride_y, abnormal);
                 // clang-format on
             }
-        }
-    }
 
-    else if(using_rocblas_float && unit_inc && batch_count <= 8192)
-    {
-        // Optimized kernel for float Datatype when incx==1 && incy==1 && batch_count <= 8192
-        dim3 blocks(1 + ((n - 1) / (NB * 2)), batch_count);
-        dim3 threads(NB);
+            else
+            {
+                // Note: We do not support batched alpha on host.
+                // clang-format off
+                hipLaunchKernelGGL((rocblas_axpy_dwordx4_kernel<NB, Tex, CHECK_NUMERICS>), blocks, threads, 0, handle->get_stream(), n, nontemporal,
+                                   *alpha, stride_0, x, offset_x, stride_x, y, offset_y, stride_y, abnormal);
+                // clang-format on
+            }
+        }
 
-        if(rocblas_pointer_mode_device == handle->pointer_mode)
+        else if(batch_count > 8192 && std::is_same<Ta, float>::value)
         {
-            // clang-format off
-            hipLaunchKernelGGL((rocblas_saxpy_2_kernel<NB, Tex>), blocks, threads, 0, handle->get_stream(), n, alpha,
-                               stride_alpha, x, offset_x, stride_x, y, offset_y, stride_y);
-            // clang-format on
+            // Optimized kernel for float Datatype when batch_count > 8192
+            ptrdiff_t shift_x = offset_x + ((incx < 0) ? ptrdiff_t(incx) * (1 - n) : 0);
+            ptrdiff_t shift_y = offset_y + ((incy < 0) ? ptrdiff_t(incy) * (1 - n) : 0);
+
+            constexpr int DIM_X = 128;
+            constexpr int DIM_Y = 8;
+
+            dim3 blocks((n - 1) / (DIM_X) + 1, (batch_count - 1) / (DIM_Y * 4) + 1);
+            dim3 threads(DIM_X, DIM_Y);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+            {
+                // clang-format off
+                hipLaunchKernelGGL((rocblas_axpy_kernel_batched<DIM_X, DIM_Y, Tex, CHECK_NUMERICS>), blocks, threads, 0, handle->get_stream(), n, alpha,
+                                   stride_alpha, x, shift_x, incx, stride_x, y, shift_y, incy, stride_y, batch_count, abnormal);
+                // clang-format on
+            }
+            else
+            {
+                // Note: We do not support batched alpha on host.
+                // clang-format off
+                hipLaunchKernelGGL((rocblas_axpy_kernel_batched<DIM_X, DIM_Y, Tex, CHECK_NUMERICS>), blocks, threads, 0, handle->get_stream(), n, *alpha,
+                                   stride_0, x, shift_x, incx, stride_x, y, shift_y, incy, stride_y, batch_count, abnormal);
+                // clang-format on
+            }
         }
 
         else
         {
-            // Note: We do not support batched alpha on host.
-            // clang-format off
-            hipLaunchKernelGGL((rocblas_saxpy_2_kernel<NB, Tex>), blocks, threads, 0, handle->get_stream(), n, *alpha,
-                               stride_0, x, offset_x, stride_x, y, offset_y, stride_y);
-            // clang-format on
+            // Default kernel for AXPY
+            ptrdiff_t shift_x = offset_x + ((incx < 0) ? ptrdiff_t(incx) * (1 - n) : 0);
+            ptrdiff_t shift_y = offset_y + ((incy < 0) ? ptrdiff_t(incy) * (1 - n) : 0);
+
+            rocblas_level1_launch<NB> launch(handle, n, batch_count);
+            dim3                      blocks  = launch.grid;
+            dim3                      threads = launch.threads;
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+            {
+                // clang-format off
+                hipLaunchKernelGGL((rocblas_axpy_kernel<NB, Tex, CHECK_NUMERICS>), blocks, threads, 0, handle->get_stream(), n, alpha,
+                                   stride_alpha, x, shift_x, incx, stride_x, y,shift_y, incy, stride_y, abnormal);
+                // clang-format on
+            }
+            else
+            {
+                // Note: We do not support batched alpha on host.
+                // clang-format off
+                hipLaunchKernelGGL((rocblas_axpy_kernel<NB, Tex, CHECK_NUMERICS>), blocks, threads, 0, handle->get_stream(), n, *alpha,
+                                   stride_0, x, shift_x, incx, stride_x, y, shift_y, incy, stride_y, abnormal);
+                // clang-format on
+            }
         }
-    }
+    };
 
-    else if(batch_count > 8192 && std::is_same<Ta, float>::value)
-    {
-        // Optimized kernel for float Datatype when batch_count > 8192
-        ptrdiff_t shift_x = offset_x + ((incx < 0) ? ptrdiff_t(incx) * (1 - n) : 0);
-        ptrdiff_t shift_y = offset_y + ((incy < 0) ? ptrdiff_t(incy) * (1 - n) : 0);
+    if(abnormal)
+        launch_axpy(std::true_type{});
+    else
+        launch_axpy(std::false_type{});
+    return rocblas_status_success;
+}
 
-        constexpr int DIM_X = 128;
-        constexpr int DIM_Y = 8;
+//!
+//! @brief General kernel (batched, strided batched) of axpby, looping over the elements with the
+//!        stride of the grid. y is not read unless READ_Y and beta is not zero.
+//!
+template <rocblas_int NB,
+          typename Tex,
+          bool READ_Y,
+          bool CHECK_NUMERICS,
+          typename Ta,
+          typename Tx,
+          typename Ty>
+ROCBLAS_KERNEL(NB)
+rocblas_axpby_kernel(rocblas_int               n,
+                     Ta                        alpha_device_host,
+                     rocblas_stride            stride_alpha,
+                     Tx __restrict__ x,
+                     rocblas_stride            offset_x,
+                     rocblas_int               incx,
+                     rocblas_stride            stride_x,
+                     Ta                        beta_device_host,
+                     rocblas_stride            stride_beta,
+                     Ty __restrict__ y,
+                     rocblas_stride            offset_y,
+                     rocblas_int               incy,
+                     rocblas_stride            stride_y,
+                     rocblas_check_numerics_t* abnormal)
+{
+    Tex alpha = Tex(load_scalar(alpha_device_host, blockIdx.y, stride_alpha));
+    Tex beta  = Tex(0);
+    if constexpr(READ_Y)
+    {
+        beta = Tex(load_scalar(beta_device_host, blockIdx.y, stride_beta));
+        if(alpha == Tex(0) && beta == Tex(1))
+            return;
+    }
 
-        dim3 blocks((n - 1) / (DIM_X) + 1, (batch_count - 1) / (DIM_Y * 4) + 1);
-        dim3 threads(DIM_X, DIM_Y);
+    for(ptrdiff_t tid = blockIdx.x * blockDim.x + threadIdx.x; tid < n;
+        tid += ptrdiff_t(gridDim.x) * blockDim.x)
+    {
+        auto tx = load_ptr_batch(x, blockIdx.y, offset_x + tid * incx, stride_x);
+        auto ty = load_ptr_batch(y, blockIdx.y, offset_y + tid * incy, stride_y);
 
-        if(handle->pointer_mode == rocblas_pointer_mode_device)
-        {
-            // clang-format off
-            hipLaunchKernelGGL((rocblas_axpy_kernel_batched<DIM_X, DIM_Y, Tex>), blocks, threads, 0, handle->get_stream(), n, alpha,
-                               stride_alpha, x, shift_x, incx, stride_x, y, shift_y, incy, stride_y, batch_count);
-            // clang-format on
-        }
-        else
-        {
-            // Note: We do not support batched alpha on host.
-            // clang-format off
-            hipLaunchKernelGGL((rocblas_axpy_kernel_batched<DIM_X, DIM_Y, Tex>), blocks, threads, 0, handle->get_stream(), n, *alpha,
-                               stride_0, x, shift_x, incx, stride_x, y, shift_y, incy, stride_y, batch_count);
-            // clang-format on
-        }
+        Tex value = alpha * Tex(*tx);
+        if(READ_Y && beta != Tex(0))
+            value += beta * Tex(*ty);
+        *ty = std::remove_reference_t<decltype(*ty)>(value);
+        rocblas_check_numerics_output<CHECK_NUMERICS>(*ty, abnormal);
     }
+}
 
-    else
+//!
+//! @brief Optimized kernel (batched, strided batched) of axpby with unit increments and elements
+//!        of x and y of the same size, using 128-bit loads and stores for the aligned part of the
+//!        vectors. y is not loaded unless READ_Y.
+//!
+template <rocblas_int NB,
+          typename Tex,
+          bool READ_Y,
+          bool CHECK_NUMERICS,
+          typename Ta,
+          typename Tx,
+          typename Ty>
+ROCBLAS_KERNEL(NB)
+rocblas_axpby_dwordx4_kernel(rocblas_int               n,
+                             bool                      nontemporal,
+                             Ta                        alpha_device_host,
+                             rocblas_stride            stride_alpha,
+                             Tx __restrict__ x,
+                             rocblas_stride            offset_x,
+                             rocblas_stride            stride_x,
+                             Ta                        beta_device_host,
+                             rocblas_stride            stride_beta,
+                             Ty __restrict__ y,
+                             rocblas_stride            offset_y,
+                             rocblas_stride            stride_y,
+                             rocblas_check_numerics_t* abnormal)
+{
+    Tex alpha = Tex(load_scalar(alpha_device_host, blockIdx.y, stride_alpha));
+    Tex beta  = Tex(0);
+    if constexpr(READ_Y)
     {
-        // Default kernel for AXPY
-        ptrdiff_t shift_x = offset_x + ((incx < 0) ? ptrdiff_t(incx) * (1 - n) : 0);
-        ptrdiff_t shift_y = offset_y + ((incy < 0) ? ptrdiff_t(incy) * (1 - n) : 0);
+        beta = Tex(load_scalar(beta_device_host, blockIdx.y, stride_beta));
+        if(alpha == Tex(0) && beta == Tex(1))
+            return;
+    }
+
+    auto* tx = load_ptr_batch(x, blockIdx.y, offset_x, stride_x);
+    auto* ty = load_ptr_batch(y, blockIdx.y, offset_y, stride_y);
+
+    rocblas_dwordx4_apply<READ_Y, false>(blockIdx.x * blockDim.x + threadIdx.x,
+                                         ptrdiff_t(gridDim.x) * blockDim.x,
+                                         n,
+                                         nontemporal,
+                                         tx,
+                                         ty,
+                                         [=](auto xi, auto& yi) {
+                                             Tex value = alpha * Tex(xi);
+                                             if(READ_Y && beta != Tex(0))
+                                                 value += beta * Tex(yi);
+                                             yi = std::decay_t<decltype(yi)>(value);
+                                             rocblas_check_numerics_output<CHECK_NUMERICS>(
+                                                 yi, abnormal);
+                                         });
+}
+
+//!
+//! @brief General template to compute y = alpha * x + beta * y in one pass, or y = alpha * x
+//!        without reading y when beta is nullptr or a host zero.
+//!
+template <int NB, typename Tex, typename Ta, typename Tx, typename Ty>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_axpby_template(rocblas_handle handle,
+                                    rocblas_int    n,
+                                    const Ta*      alpha,
+                                    rocblas_stride stride_alpha,
+                                    Tx             x,
+                                    rocblas_stride offset_x,
+                                    rocblas_int    incx,
+                                    rocblas_stride stride_x,
+                                    const Ta*      beta,
+                                    rocblas_stride stride_beta,
+                                    Ty             y,
+                                    rocblas_stride offset_y,
+                                    rocblas_int    incy,
+                                    rocblas_stride stride_y,
+                                    rocblas_int    batch_count)
+{
+    if(n <= 0 || batch_count <= 0) // Quick return if possible. Not Argument error
+        return rocblas_status_success;
 
-        dim3 blocks((n - 1) / (NB) + 1, batch_count);
-        dim3 threads(NB);
-        if(handle->pointer_mode == rocblas_pointer_mode_device)
+    using TxElem
+        = std::remove_cv_t<std::remove_pointer_t<std::remove_cv_t<std::remove_pointer_t<Tx>>>>;
+    using TyElem
+        = std::remove_cv_t<std::remove_pointer_t<std::remove_cv_t<std::remove_pointer_t<Ty>>>>;
+
+    bool host_mode = handle->pointer_mode == rocblas_pointer_mode_host;
+    bool read_y    = beta && !(host_mode && *beta == 0);
+
+    ptrdiff_t shift_x = offset_x + ((incx < 0) ? ptrdiff_t(incx) * (1 - n) : 0);
+    ptrdiff_t shift_y = offset_y + ((incy < 0) ? ptrdiff_t(incy) * (1 - n) : 0);
+
+    // The kernels check the values they write with rocblas_check_numerics_mode_fused
+    rocblas_check_numerics_t* abnormal = handle->fused_check_numerics;
+
+    auto launch_axpby = [&](auto fused, auto read, auto alpha_arg, auto beta_arg) {
+        constexpr bool CHECK_NUMERICS = decltype(fused)::value;
+        constexpr bool READ_Y         = decltype(read)::value;
+
+        // Note: We do not support batched alpha and beta on host.
+        rocblas_stride stride_a = host_mode ? 0 : stride_alpha;
+        rocblas_stride stride_b = host_mode ? 0 : stride_beta;
+
+        // The 128-bit kernel loads x and y in vectors of the same number of elements
+        if constexpr(sizeof(TxElem) == sizeof(TyElem))
         {
-            // clang-format off
-            hipLaunchKernelGGL((rocblas_axpy_kernel<NB, Tex>), blocks, threads, 0, handle->get_stream(), n, alpha,
-                               stride_alpha, x, shift_x, incx, stride_x, y,shift_y, incy, stride_y);
-            // clang-format on
+            if(incx == 1 && incy == 1)
+            {
+                rocblas_level1_launch<NB> launch(handle, rocblas_dwordx4_count<Ty>(n), batch_count);
+                bool nontemporal = rocblas_level1_nontemporal<Ty>(handle, n, 2, batch_count);
+                // clang-format off
+                hipLaunchKernelGGL((rocblas_axpby_dwordx4_kernel<NB, Tex, READ_Y, CHECK_NUMERICS>), launch.grid, launch.threads, 0, handle->get_stream(), n,
+                                   nontemporal, alpha_arg, stride_a, x, offset_x, stride_x, beta_arg, stride_b, y, offset_y, stride_y, abnormal);
+                // clang-format on
+                return;
+            }
         }
+
+        rocblas_level1_launch<NB> launch(handle, n, batch_count);
+        // clang-format off
+        hipLaunchKernelGGL((rocblas_axpby_kernel<NB, Tex, READ_Y, CHECK_NUMERICS>), launch.grid, launch.threads, 0, handle->get_stream(), n,
+                           alpha_arg, stride_a, x, shift_x, incx, stride_x, beta_arg, stride_b, y, shift_y, incy, stride_y, abnormal);
+        // clang-format on
+    };
+
+    auto launch_mode = [&](auto fused, auto read) {
+        if(host_mode)
+            launch_axpby(fused, read, *alpha, decltype(read)::value ? *beta : Ta(0));
         else
-        {
-            // Note: We do not support batched alpha on host.
-            // clang-format off
-            hipLaunchKernelGGL((rocblas_axpy_kernel<NB, Tex>), blocks, threads, 0, handle->get_stream(), n, *alpha,
-                               stride_0, x, shift_x, incx, stride_x, y, shift_y, incy, stride_y);
-            // clang-format on
-        }
-    }
+            launch_axpby(fused, read, alpha, beta);
+    };
+
+    auto launch_read = [&](auto fused) {
+        if(read_y)
+            launch_mode(fused, std::true_type{});
+        else
+            launch_mode(fused, std::false_type{});
+    };
+
+    if(abnormal)
+        launch_read(std::true_type{});
+    else
+        launch_read(std::false_type{});
     return rocblas_status_success;
 }
 
@@ -526,6 +756,69 @@ INSTANTIATE_AXPY_TEMPLATE(256, float, float, rocblas_bfloat16 const* const*, roc
 
 #undef INSTANTIATE_AXPY_TEMPLATE
 
+#ifdef INSTANTIATE_AXPBY_TEMPLATE
+#error INSTANTIATE_AXPBY_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_AXPBY_TEMPLATE(NB_, Tex_, Ta_, Tx_, Ty_)                \
+template ROCBLAS_INTERNAL_EXPORT_NOINLINE                                   \
+rocblas_status rocblas_internal_axpby_template<NB_, Tex_, Ta_, Tx_, Ty_>    \
+                                              (rocblas_handle handle,       \
+                                               rocblas_int    n,            \
+                                               const Ta_*     alpha,        \
+                                               rocblas_stride stride_alpha, \
+                                               Tx_            x,            \
+                                               rocblas_stride offset_x,     \
+                                               rocblas_int    incx,         \
+                                               rocblas_stride stride_x,     \
+                                               const Ta_*     beta,         \
+                                               rocblas_stride stride_beta,  \
+                                               Ty_            y,            \
+                                               rocblas_stride offset_y,     \
+                                               rocblas_int    incy,         \
+                                               rocblas_stride stride_y,     \
+                                               rocblas_int    batch_count);
+
+// rocblas_axpby_ex and rocblas_copy_scal_ex
+INSTANTIATE_AXPBY_TEMPLATE(256, float, float, float const*, float*)
+INSTANTIATE_AXPBY_TEMPLATE(256, double, double, double const*, double*)
+INSTANTIATE_AXPBY_TEMPLATE(256, rocblas_half, rocblas_half, rocblas_half const*, rocblas_half*)
+INSTANTIATE_AXPBY_TEMPLATE(256, rocblas_float_complex, rocblas_float_complex, rocblas_float_complex const*, rocblas_float_complex*)
+INSTANTIATE_AXPBY_TEMPLATE(256, rocblas_double_complex, rocblas_double_complex, rocblas_double_complex const*, rocblas_double_complex*)
+INSTANTIATE_AXPBY_TEMPLATE(256, float, rocblas_half, rocblas_half const*, rocblas_half*)
+INSTANTIATE_AXPBY_TEMPLATE(256, float, float, rocblas_half const*, rocblas_half*)
+INSTANTIATE_AXPBY_TEMPLATE(256, float, rocblas_bfloat16, rocblas_bfloat16 const*, rocblas_bfloat16*)
+INSTANTIATE_AXPBY_TEMPLATE(256, float, float, rocblas_bfloat16 const*, rocblas_bfloat16*)
+
+// rocblas_copy_scal_ex converting x to the type of y
+INSTANTIATE_AXPBY_TEMPLATE(256, float, float, float const*, rocblas_half*)
+INSTANTIATE_AXPBY_TEMPLATE(256, float, float, rocblas_half const*, float*)
+INSTANTIATE_AXPBY_TEMPLATE(256, float, float, float const*, rocblas_bfloat16*)
+INSTANTIATE_AXPBY_TEMPLATE(256, float, float, rocblas_bfloat16 const*, float*)
+INSTANTIATE_AXPBY_TEMPLATE(256, double, double, double const*, float*)
+INSTANTIATE_AXPBY_TEMPLATE(256, double, double, float const*, double*)
+
+// rocblas_axpby_batched_ex and rocblas_copy_scal_batched_ex
+INSTANTIATE_AXPBY_TEMPLATE(256, float, float, float const* const*, float* const*)
+INSTANTIATE_AXPBY_TEMPLATE(256, double, double, double const* const*, double* const*)
+INSTANTIATE_AXPBY_TEMPLATE(256, rocblas_half, rocblas_half, rocblas_half const* const*, rocblas_half* const*)
+INSTANTIATE_AXPBY_TEMPLATE(256, rocblas_float_complex, rocblas_float_complex, rocblas_float_complex const* const*, rocblas_float_complex* const*)
+INSTANTIATE_AXPBY_TEMPLATE(256, rocblas_double_complex, rocblas_double_complex, rocblas_double_complex const* const*, rocblas_double_complex* const*)
+INSTANTIATE_AXPBY_TEMPLATE(256, float, rocblas_half, rocblas_half const* const*, rocblas_half* const*)
+INSTANTIATE_AXPBY_TEMPLATE(256, float, float, rocblas_half const* const*, rocblas_half* const*)
+INSTANTIATE_AXPBY_TEMPLATE(256, float, rocblas_bfloat16, rocblas_bfloat16 const* const*, rocblas_bfloat16* const*)
+INSTANTIATE_AXPBY_TEMPLATE(256, float, float, rocblas_bfloat16 const* const*, rocblas_bfloat16* const*)
+
+// rocblas_copy_scal_batched_ex converting x to the type of y
+INSTANTIATE_AXPBY_TEMPLATE(256, float, float, float const* const*, rocblas_half* const*)
+INSTANTIATE_AXPBY_TEMPLATE(256, float, float, rocblas_half const* const*, float* const*)
+INSTANTIATE_AXPBY_TEMPLATE(256, float, float, float const* const*, rocblas_bfloat16* const*)
+INSTANTIATE_AXPBY_TEMPLATE(256, float, float, rocblas_bfloat16 const* const*, float* const*)
+INSTANTIATE_AXPBY_TEMPLATE(256, double, double, double const* const*, float* const*)
+INSTANTIATE_AXPBY_TEMPLATE(256, double, double, float const* const*, double* const*)
+
+#undef INSTANTIATE_AXPBY_TEMPLATE
+
 #ifdef INSTANTIATE_AXPY_CHECK_NUMERICS
 #error INSTANTIATE_AXPY_CHECK_NUMERICS already defined
 #endif
@@ -21,6 +21,8 @@
  * ************************************************************************ */
 #include "rocblas_copy.hpp"
 #include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "level1_fusion.hpp"
 #include "logging.hpp"
 #include "rocblas.h"
 #include "rocblas_block_sizes.h"
@@ -50,7 +52,7 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_copy_name<T>, n, x, incx, y, incy);
@@ -74,6 +76,10 @@ namespace
         if(!x || !y)
             return rocblas_status_invalid_pointer;
 
+        rocblas_status fusion_status = rocblas_level1_fusion_copy(handle, n, x, incx, y, incy);
+        if(fusion_status != rocblas_status_continue)
+            return fusion_status;
+
         if(check_numerics)
         {
             bool           is_input = true;
@@ -125,6 +131,28 @@ namespace
         return status;
     }
 
+    template <rocblas_int NB, typename T>
+    rocblas_status rocblas_copy_64_impl(
+        rocblas_handle handle, int64_t n, const T* x, int64_t incx, T* y, int64_t incy)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        auto copy_chunk = [&](int64_t     offset_x,
+                              int64_t     offset_y,
+                              rocblas_int n_c,
+                              rocblas_int incx_c,
+                              rocblas_int incy_c) {
+            return rocblas_copy_impl<NB>(handle,
+                                         n_c,
+                                         rocblas_chunk_ptr_64(x, offset_x),
+                                         incx_c,
+                                         rocblas_chunk_ptr_64(y, offset_y),
+                                         incy_c);
+        };
+        return rocblas_chunk_vectors_64(handle, n, incx, incy, copy_chunk);
+    }
+
 } // namespace
 
 /* ============================================================================================ */
@@ -212,4 +240,27 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                           \
+    rocblas_status routine_name_(                                                         \
+        rocblas_handle handle, int64_t n, const T_* x, int64_t incx, T_* y, int64_t incy) \
+    try                                                                                   \
+    {                                                                                     \
+        return rocblas_copy_64_impl<ROCBLAS_COPY_NB>(handle, n, x, incx, y, incy);        \
+    }                                                                                     \
+    catch(...)                                                                            \
+    {                                                                                     \
+        return exception_to_rocblas_status();                                             \
+    }
+
+IMPL(rocblas_scopy_64, float);
+IMPL(rocblas_dcopy_64, double);
+IMPL(rocblas_ccopy_64, rocblas_float_complex);
+IMPL(rocblas_zcopy_64, rocblas_double_complex);
+
+#undef IMPL
+
 } // extern "C"
@@ -55,7 +55,7 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_copy_batched_name<T>, n, x, incx, y, incy, batch_count);
@@ -23,6 +23,20 @@
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "rocblas_copy.hpp"
+#include "rocblas_dwordx4.hpp"
+#include "rocblas_level1_launch.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <type_traits>
+
+static const size_t rocblas_internal_copy_dma_min_bytes = [] {
+    // Size in bytes of each vector from which copies with unit increments are made by
+    // hipMemcpyAsync or hipMemcpy2DAsync, which may use the DMA engines and leave the compute
+    // units to concurrent kernels. 0 disables the memcpy path.
+    size_t      min_bytes;
+    const char* env = getenv("ROCBLAS_INTERNAL_COPY_DMA_MIN_BYTES");
+    return env && sscanf(env, "%zu", &min_bytes) == 1 ? min_bytes : 0;
+}();
 
 template <bool CONJ, typename T, typename U>
 ROCBLAS_KERNEL_NO_BOUNDS rocblas_copy_kernel(rocblas_int    n,
@@ -35,40 +49,39 @@ ROCBLAS_KERNEL_NO_BOUNDS rocblas_copy_kernel(rocblas_int    n,
                                              rocblas_int    incy,
                                              rocblas_stride stridey)
 {
-    ptrdiff_t   tid = blockIdx.x * blockDim.x + threadIdx.x;
-    const auto* x   = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
-    auto*       y   = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
-    if(tid < n)
+    const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+    auto*       y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+    for(ptrdiff_t tid = blockIdx.x * blockDim.x + threadIdx.x; tid < n;
+        tid += ptrdiff_t(gridDim.x) * blockDim.x)
     {
-
         y[tid * incy] = CONJ ? conj(x[tid * incx]) : x[tid * incx];
     }
 }
 
-//! @brief Optimized kernel for the floating points.
+//! @brief Optimized kernel (batched, strided batched) of copy with unit increments, using 128-bit
+//!        loads and stores for the aligned part of the vectors, nontemporal if nontemporal.
 //!
-template <rocblas_int NB, typename T, typename U>
+template <bool CONJ, rocblas_int NB, typename T, typename U>
 ROCBLAS_KERNEL(NB)
-rocblas_scopy_2_kernel(rocblas_int n,
-                       const T __restrict xa,
-                       rocblas_stride shiftx,
-                       rocblas_stride stridex,
-                       U __restrict ya,
-                       rocblas_stride shifty,
-                       rocblas_stride stridey)
+rocblas_copy_dwordx4_kernel(rocblas_int n,
+                            bool        nontemporal,
+                            const T __restrict xa,
+                            rocblas_stride shiftx,
+                            rocblas_stride stridex,
+                            U __restrict ya,
+                            rocblas_stride shifty,
+                            rocblas_stride stridey)
 {
-    ptrdiff_t   tid = (blockIdx.x * blockDim.x + threadIdx.x) * 2;
-    const auto* x   = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
-    auto*       y   = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
-    if(tid < n - 1)
-    {
-        for(rocblas_int j = 0; j < 2; ++j)
-        {
-            y[tid + j] = x[tid + j];
-        }
-    }
-    if(n % 2 != 0 && tid == n - 1)
-        y[tid] = x[tid];
+    const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+    auto*       y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    rocblas_dwordx4_apply<false, false>(blockIdx.x * blockDim.x + threadIdx.x,
+                                        ptrdiff_t(gridDim.x) * blockDim.x,
+                                        n,
+                                        nontemporal,
+                                        x,
+                                        y,
+                                        [](auto xi, auto& yi) { yi = CONJ ? conj(xi) : xi; });
 }
 
 template <bool CONJ, rocblas_int NB, typename T, typename U>
@@ -91,18 +104,15 @@ rocblas_status rocblas_copy_template(rocblas_handle handle,
     if(!x || !y)
         return rocblas_status_invalid_pointer;
 
-    static constexpr bool using_rocblas_float
-        = std::is_same<U, rocblas_float*>{} || std::is_same<U, rocblas_float* const*>{};
-
-    if(!using_rocblas_float || incx != 1 || incy != 1)
+    if(incx != 1 || incy != 1)
     {
         // In case of negative inc shift pointer to end of data for negative indexing tid*inc
         ptrdiff_t shiftx = offsetx - ((incx < 0) ? ptrdiff_t(incx) * (n - 1) : 0);
         ptrdiff_t shifty = offsety - ((incy < 0) ? ptrdiff_t(incy) * (n - 1) : 0);
 
-        int  blocks = (n - 1) / NB + 1;
-        dim3 grid(blocks, batch_count);
-        dim3 threads(NB);
+        rocblas_level1_launch<NB> launch(handle, n, batch_count);
+        dim3                      grid    = launch.grid;
+        dim3                      threads = launch.threads;
 
         hipLaunchKernelGGL(rocblas_copy_kernel<CONJ>,
                            grid,
@@ -121,28 +131,63 @@ rocblas_status rocblas_copy_template(rocblas_handle handle,
     }
     else
     {
-        // Kernel function for improving the performance of SCOPY when incx==1 and incy==1
+        // Contiguous vectors, or batches of them at regular strides, of the same type are copied
+        // by memcpy when large enough; pointer arrays are in device memory and use the kernel
+        if constexpr(!CONJ && !std::is_pointer_v<std::remove_pointer_t<U>>)
+        {
+            constexpr size_t elem_size = sizeof(*y);
+            const size_t     bytes     = elem_size * n;
+
+            if(rocblas_internal_copy_dma_min_bytes > 0
+               && bytes >= rocblas_internal_copy_dma_min_bytes)
+            {
+                const auto* x_start = x + offsetx;
+                auto*       y_start = y + offsety;
+
+                if(batch_count == 1 || (stridex == n && stridey == n))
+                {
+                    RETURN_IF_HIP_ERROR(hipMemcpyAsync(y_start,
+                                                       x_start,
+                                                       bytes * batch_count,
+                                                       hipMemcpyDeviceToDevice,
+                                                       handle->get_stream()));
+                    return rocblas_status_success;
+                }
+                else if(stridex >= n && stridey >= n)
+                {
+                    RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(y_start,
+                                                         elem_size * stridey,
+                                                         x_start,
+                                                         elem_size * stridex,
+                                                         bytes,
+                                                         batch_count,
+                                                         hipMemcpyDeviceToDevice,
+                                                         handle->get_stream()));
+                    return rocblas_status_success;
+                }
+            }
+        }
 
-        // In case of negative inc shift pointer to end of data for negative indexing tid*inc
-        ptrdiff_t shiftx = offsetx - 0;
-        ptrdiff_t shifty = offsety - 0;
+        // Kernel function for improving the performance of COPY when incx==1 and incy==1, using
+        // 128-bit loads and stores of the aligned part of x and y, nontemporal beyond the L2
+        rocblas_level1_launch<NB> launch(handle, rocblas_dwordx4_count<U>(n), batch_count);
+        dim3                      grid    = launch.grid;
+        dim3                      threads = launch.threads;
 
-        int         blocks = 1 + ((n - 1) / (NB * 2));
-        dim3        grid(blocks, batch_count);
-        dim3        threads(NB);
-        hipStream_t scopy_stream = handle->get_stream();
+        bool nontemporal = rocblas_level1_nontemporal<U>(handle, n, 2, batch_count);
 
-        hipLaunchKernelGGL(rocblas_scopy_2_kernel<NB>,
+        hipLaunchKernelGGL((rocblas_copy_dwordx4_kernel<CONJ, NB>),
                            grid,
                            threads,
                            0,
-                           scopy_stream,
+                           handle->get_stream(),
                            n,
+                           nontemporal,
                            x,
-                           shiftx,
+                           offsetx,
                            stridex,
                            y,
-                           shifty,
+                           offsety,
                            stridey);
     }
     return rocblas_status_success;
@@ -21,6 +21,8 @@
  * ************************************************************************ */
 #include "rocblas_dot.hpp"
 #include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "level1_fusion.hpp"
 #include "logging.hpp"
 #include "rocblas.h"
 #include "rocblas_block_sizes.h"
@@ -75,7 +77,7 @@ namespace
                 return handle->set_optimal_device_memory_size(dev_bytes);
         }
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_dot_name<CONJ, T>, n, x, incx, y, incy);
@@ -110,6 +112,10 @@ namespace
         if(!x || !y || !result)
             return rocblas_status_invalid_pointer;
 
+        rocblas_status fusion_status = rocblas_level1_fusion_dot(handle, n, x, incx, y, incy, result);
+        if(fusion_status != rocblas_status_continue)
+            return fusion_status;
+
         auto w_mem = handle->device_malloc(dev_bytes);
         if(!w_mem)
             return rocblas_status_memory_error;
@@ -165,6 +171,77 @@ namespace
         return status;
     }
 
+    template <bool CONJ, typename T>
+    rocblas_status rocblas_dot_64_impl(rocblas_handle handle,
+                                       int64_t        n,
+                                       const T*       x,
+                                       int64_t        incx,
+                                       const T*       y,
+                                       int64_t        incy,
+                                       T*             result)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // A problem which fits, or a size query, needs no partial results
+        if(handle->is_device_memory_size_query()
+           || (n <= c_i32_max && rocblas_fits_int32(incx) && rocblas_fits_int32(incy)))
+        {
+            auto dot_chunk = [&](int64_t     offset_x,
+                                 int64_t     offset_y,
+                                 rocblas_int n_c,
+                                 rocblas_int incx_c,
+                                 rocblas_int incy_c) {
+                return rocblas_dot_impl<CONJ>(handle,
+                                              n_c,
+                                              rocblas_chunk_ptr_64(x, offset_x),
+                                              incx_c,
+                                              rocblas_chunk_ptr_64(y, offset_y),
+                                              incy_c,
+                                              result);
+            };
+            return rocblas_chunk_vectors_64(handle, n, incx, incy, dot_chunk);
+        }
+
+        if(!x || !y || !result)
+            return rocblas_status_invalid_pointer;
+
+        // The partial result of each chunk is returned to the host and accumulated there
+        bool device_result  = handle->pointer_mode == rocblas_pointer_mode_device;
+        auto saved_mode     = handle->push_pointer_mode(rocblas_pointer_mode_host);
+        auto saved_deferred = handle->push_deferred_host_results(false);
+
+        T    sum{0};
+        auto dot_chunk = [&](int64_t     offset_x,
+                             int64_t     offset_y,
+                             rocblas_int n_c,
+                             rocblas_int incx_c,
+                             rocblas_int incy_c) {
+            T partial;
+            RETURN_IF_ROCBLAS_ERROR(rocblas_dot_impl<CONJ>(
+                handle, n_c, x + offset_x, incx_c, y + offset_y, incy_c, &partial));
+            sum += partial;
+            return rocblas_status_success;
+        };
+        RETURN_IF_ROCBLAS_ERROR(rocblas_chunk_vectors_64(handle, n, incx, incy, dot_chunk));
+
+        if(device_result)
+        {
+            // The sum of the chunks is on the host, and the copy from it must be waited for
+            if(handle->is_graph_safe())
+                return rocblas_status_not_implemented;
+
+            hipStream_t stream = handle->get_stream();
+            RETURN_IF_HIP_ERROR(
+                hipMemcpyAsync(result, &sum, sizeof(T), hipMemcpyHostToDevice, stream));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        }
+        else
+            *result = sum;
+
+        return rocblas_status_success;
+    }
+
 } // namespace
 
 /*
@@ -303,4 +380,70 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+#ifdef IMPL
+#error IMPL IS ALREADY DEFINED
+#endif
+
+// Workspace size queries run the function as a device memory size query, which does not
+// access the vectors or the result
+#define IMPL(name_, conj_, T_, T2_)                                                             \
+    rocblas_status name_(                                                                       \
+        rocblas_handle handle, rocblas_int n, rocblas_int incx, rocblas_int incy, size_t* size) \
+    try                                                                                         \
+    {                                                                                           \
+        if(!handle)                                                                             \
+            return rocblas_status_invalid_handle;                                               \
+                                                                                                \
+        T_ dummy{};                                                                             \
+        return handle->query_device_memory_size(size, [&] {                                     \
+            return rocblas_dot_impl<conj_, T_, T2_>(                                            \
+                handle, n, &dummy, incx, &dummy, incy, &dummy);                                 \
+        });                                                                                     \
+    }                                                                                           \
+    catch(...)                                                                                  \
+    {                                                                                           \
+        return exception_to_rocblas_status();                                                   \
+    }
+
+IMPL(rocblas_sdot_workspace_size, false, float, float);
+IMPL(rocblas_ddot_workspace_size, false, double, double);
+IMPL(rocblas_hdot_workspace_size, false, rocblas_half, rocblas_half);
+IMPL(rocblas_bfdot_workspace_size, false, rocblas_bfloat16, float);
+IMPL(rocblas_cdotu_workspace_size, false, rocblas_float_complex, rocblas_float_complex);
+IMPL(rocblas_zdotu_workspace_size, false, rocblas_double_complex, rocblas_double_complex);
+IMPL(rocblas_cdotc_workspace_size, true, rocblas_float_complex, rocblas_float_complex);
+IMPL(rocblas_zdotc_workspace_size, true, rocblas_double_complex, rocblas_double_complex);
+
+#undef IMPL
+
+#ifdef IMPL
+#error IMPL IS ALREADY DEFINED
+#endif
+
+#define IMPL(name_, conj_, T_)                                                  \
+    rocblas_status name_(rocblas_handle handle,                                 \
+                         int64_t        n,                                      \
+                         const T_*      x,                                      \
+                         int64_t        incx,                                   \
+                         const T_*      y,                                      \
+                         int64_t        incy,                                   \
+                         T_*            result)                                 \
+    try                                                                         \
+    {                                                                           \
+        return rocblas_dot_64_impl<conj_>(handle, n, x, incx, y, incy, result); \
+    }                                                                           \
+    catch(...)                                                                  \
+    {                                                                           \
+        return exception_to_rocblas_status();                                   \
+    }
+
+IMPL(rocblas_sdot_64, false, float);
+IMPL(rocblas_ddot_64, false, double);
+IMPL(rocblas_cdotu_64, false, rocblas_float_complex);
+IMPL(rocblas_zdotu_64, false, rocblas_double_complex);
+IMPL(rocblas_cdotc_64, true, rocblas_float_complex);
+IMPL(rocblas_zdotc_64, true, rocblas_double_complex);
+
+#undef IMPL
+
 } // extern "C"
@@ -68,6 +68,25 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                   T* __restrict__ results,
                                   V* __restrict__ workspace);
 
+// Number of x vectors whose dot products with y are reduced together by the mdot kernel
+constexpr int ROCBLAS_MDOT_K_TILE = 8;
+
+// Computes results[j] = dot(x[j], y), j < k, reading each element of y once per
+// ROCBLAS_MDOT_K_TILE x vectors. The workspace is that of a batched dot with batch_count k.
+template <rocblas_int NB, bool CONJ, typename T, typename U, typename V = T>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_mdot_template(rocblas_handle __restrict__ handle,
+                                   rocblas_int n,
+                                   rocblas_int k,
+                                   const U __restrict__ x,
+                                   rocblas_stride offsetx,
+                                   rocblas_int    incx,
+                                   const T* __restrict__ y,
+                                   rocblas_stride offsety,
+                                   rocblas_int    incy,
+                                   T* __restrict__ results,
+                                   V* __restrict__ workspace);
+
 template <typename T>
 rocblas_status rocblas_dot_check_numerics(const char*    function_name,
                                           rocblas_handle handle,
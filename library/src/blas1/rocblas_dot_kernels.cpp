@@ -24,6 +24,7 @@
 #include "logging.hpp"
 #include "rocblas_block_sizes.h"
 #include "rocblas_dot.hpp"
+#include "rocblas_reproducible.hpp"
 
 template <bool ONE_BLOCK, typename V, typename T>
 __inline__ __device__ void
@@ -266,6 +267,58 @@ rocblas_dot_kernel_reduce(rocblas_int n_sums, V* __restrict__ in, T* __restrict_
         out[blockIdx.y] = T(sum);
 }
 
+// Dot product in the handle's compensated summation mode, with the rounding errors of the real
+// products and of the sums accumulated apart. The block sums are written to workspace, or to
+// out for a single block, as by the default kernels.
+template <rocblas_int NB, rocblas_int WIN, bool CONJ, typename T, typename U, typename V>
+ROCBLAS_KERNEL(NB)
+rocblas_dot_compensated_kernel(rocblas_int n,
+                               const U __restrict__ xa,
+                               rocblas_stride shiftx,
+                               rocblas_int    incx,
+                               rocblas_stride stridex,
+                               const U __restrict__ ya,
+                               rocblas_stride shifty,
+                               rocblas_int    incy,
+                               rocblas_stride stridey,
+                               V* __restrict__ workspace,
+                               T* __restrict__ out)
+{
+    const T* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+    const T* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    int i = blockIdx.x * blockDim.x + threadIdx.x;
+
+    rocblas_compensated<V> sum{V(0), V(0)};
+
+    // sum WIN elements per thread
+    int inc = blockDim.x * gridDim.x;
+    for(int j = 0; j < WIN && i < n; j++, i += inc)
+    {
+        const T xi = x[i * int64_t(incx)];
+        rocblas_compensated_add_product(sum, V(y[i * int64_t(incy)]), V(CONJ ? conj(xi) : xi));
+    }
+
+    sum = rocblas_compensated_block_reduce<NB>(sum);
+
+    rocblas_dot_save_sum<false>(sum.sum + sum.err, workspace, out);
+}
+
+template <rocblas_int NB, typename V, typename T>
+ROCBLAS_KERNEL(NB)
+rocblas_dot_compensated_kernel_reduce(rocblas_int n_sums, V* __restrict__ in, T* __restrict__ out)
+{
+    rocblas_compensated<V> sum{V(0), V(0)};
+
+    in += size_t(blockIdx.y) * n_sums;
+    for(int i = threadIdx.x; i < n_sums; i += NB)
+        rocblas_compensated_add(sum, in[i]);
+
+    sum = rocblas_compensated_block_reduce<NB>(sum);
+    if(threadIdx.x == 0)
+        out[blockIdx.y] = T(sum.sum + sum.err);
+}
+
 // assume workspace has already been allocated, recommended for repeated calling of dot_strided_batched product
 // routine
 template <rocblas_int NB, bool CONJ, typename T, typename U, typename V>
@@ -316,6 +369,79 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     auto shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
     auto shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
 
+    if(handle->reproducible)
+    {
+        T* output = results;
+        if(handle->pointer_mode != rocblas_pointer_mode_device)
+            output = (T*)workspace;
+
+        hipLaunchKernelGGL((rocblas_reproducible_dot_kernel<ROCBLAS_REPRODUCIBLE_NB, CONJ, V>),
+                           dim3(1, batch_count),
+                           dim3(ROCBLAS_REPRODUCIBLE_NB),
+                           0,
+                           handle->get_stream(),
+                           n,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           output);
+
+        if(handle->pointer_mode != rocblas_pointer_mode_device)
+            RETURN_IF_ROCBLAS_ERROR(
+                handle->copy_results_to_host(&results[0], output, sizeof(T) * batch_count));
+        return rocblas_status_success;
+    }
+
+    if constexpr(rocblas_is_compensated_type<V>)
+    {
+        if(handle->compensated_summation)
+        {
+            rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
+            dim3        grid(blocks, batch_count);
+            dim3        threads(NB);
+            T*          output = results;
+            if(handle->pointer_mode != rocblas_pointer_mode_device)
+                output = (T*)(workspace + size_t(batch_count) * blocks);
+
+            hipLaunchKernelGGL((rocblas_dot_compensated_kernel<NB, WIN, CONJ, T>),
+                               grid,
+                               threads,
+                               0,
+                               handle->get_stream(),
+                               n,
+                               x,
+                               shiftx,
+                               incx,
+                               stridex,
+                               y,
+                               shifty,
+                               incy,
+                               stridey,
+                               workspace,
+                               output);
+
+            if(blocks > 1) // if single block first kernel did all work
+                hipLaunchKernelGGL((rocblas_dot_compensated_kernel_reduce<NB>),
+                                   dim3(1, batch_count),
+                                   threads,
+                                   0,
+                                   handle->get_stream(),
+                                   blocks,
+                                   workspace,
+                                   output);
+
+            if(handle->pointer_mode != rocblas_pointer_mode_device)
+                RETURN_IF_ROCBLAS_ERROR(
+                    handle->copy_results_to_host(&results[0], output, sizeof(T) * batch_count));
+            return rocblas_status_success;
+        }
+    }
+
     int single_block_threshold = 32768;
     if(std::is_same<T, float>{})
         single_block_threshold = 31000;
@@ -404,48 +530,76 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 
         if(handle->pointer_mode != rocblas_pointer_mode_device)
         {
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&results[0],
-                                               output,
-                                               sizeof(T) * batch_count,
-                                               hipMemcpyDeviceToHost,
-                                               handle->get_stream()));
+            if(handle->deferred_host_results || handle->is_graph_safe())
+                RETURN_IF_ROCBLAS_ERROR(
+                    handle->copy_results_to_host(&results[0], output, sizeof(T) * batch_count));
+            else
+                RETURN_IF_HIP_ERROR(hipMemcpyAsync(&results[0],
+                                                   output,
+                                                   sizeof(T) * batch_count,
+                                                   hipMemcpyDeviceToHost,
+                                                   handle->get_stream()));
         }
     }
     else
     {
-        static constexpr bool ONE_BLOCK = false;
-        rocblas_int           blocks    = rocblas_reduction_kernel_block_count(n, NB * WIN);
-        dim3                  grid(blocks, batch_count);
-        dim3                  threads(NB);
-        size_t                offset = size_t(batch_count) * blocks;
-        T*                    output = results;
-        if(handle->pointer_mode != rocblas_pointer_mode_device)
-        {
-            output = (T*)(workspace + offset);
-        }
+        auto dot_blocks = [&](auto nb, auto win) {
+            static constexpr int NB_  = decltype(nb)::value;
+            static constexpr int WIN_ = decltype(win)::value;
+
+            static constexpr bool ONE_BLOCK = false;
+            rocblas_int           blocks    = rocblas_reduction_kernel_block_count(n, NB_ * WIN_);
+            dim3                  grid(blocks, batch_count);
+            dim3                  threads(NB_);
+            size_t                offset = size_t(batch_count) * blocks;
+            T*                    output = results;
+            if(handle->pointer_mode != rocblas_pointer_mode_device)
+            {
+                output = (T*)(workspace + offset);
+            }
 
-        if(x != y || incx != incy || offsetx != offsety || stridex != stridey)
-        {
-            if(incx == 1 && incy == 1)
+            if(x != y || incx != incy || offsetx != offsety || stridex != stridey)
             {
-                hipLaunchKernelGGL((rocblas_dot_kernel_inc1<ONE_BLOCK, NB, WIN, CONJ, T>),
-                                   grid,
-                                   threads,
-                                   0,
-                                   handle->get_stream(),
-                                   n,
-                                   x,
-                                   shiftx,
-                                   stridex,
-                                   y,
-                                   shifty,
-                                   stridey,
-                                   workspace,
-                                   output);
+                if(incx == 1 && incy == 1)
+                {
+                    hipLaunchKernelGGL((rocblas_dot_kernel_inc1<ONE_BLOCK, NB_, WIN_, CONJ, T>),
+                                       grid,
+                                       threads,
+                                       0,
+                                       handle->get_stream(),
+                                       n,
+                                       x,
+                                       shiftx,
+                                       stridex,
+                                       y,
+                                       shifty,
+                                       stridey,
+                                       workspace,
+                                       output);
+                }
+                else
+                {
+                    hipLaunchKernelGGL((rocblas_dot_kernel<ONE_BLOCK, NB_, WIN_, CONJ, T>),
+                                       grid,
+                                       threads,
+                                       0,
+                                       handle->get_stream(),
+                                       n,
+                                       x,
+                                       shiftx,
+                                       incx,
+                                       stridex,
+                                       y,
+                                       shifty,
+                                       incy,
+                                       stridey,
+                                       workspace,
+                                       output);
+                }
             }
-            else
+            else // x dot x
             {
-                hipLaunchKernelGGL((rocblas_dot_kernel<ONE_BLOCK, NB, WIN, CONJ, T>),
+                hipLaunchKernelGGL((rocblas_dot_kernel_magsq<ONE_BLOCK, NB_, WIN_, CONJ, T>),
                                    grid,
                                    threads,
                                    0,
@@ -455,60 +609,208 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                    shiftx,
                                    incx,
                                    stridex,
-                                   y,
-                                   shifty,
-                                   incy,
-                                   stridey,
                                    workspace,
                                    output);
             }
-        }
-        else // x dot x
+
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+            {
+                if(blocks > 1) // if single block first kernel did all work
+                    hipLaunchKernelGGL((rocblas_dot_kernel_reduce<NB_, WIN_>),
+                                       dim3(1, batch_count),
+                                       threads,
+                                       0,
+                                       handle->get_stream(),
+                                       blocks,
+                                       workspace,
+                                       results);
+            }
+            else
+            {
+                if(blocks > 1) // if single block first kernel did all work
+                    hipLaunchKernelGGL((rocblas_dot_kernel_reduce<NB_, WIN_>),
+                                       dim3(1, batch_count),
+                                       threads,
+                                       0,
+                                       handle->get_stream(),
+                                       blocks,
+                                       workspace,
+                                       output);
+
+                if(handle->deferred_host_results || handle->is_graph_safe())
+                    RETURN_IF_ROCBLAS_ERROR(
+                        handle->copy_results_to_host(&results[0], output, sizeof(T) * batch_count));
+                else
+                    RETURN_IF_HIP_ERROR(hipMemcpyAsync(&results[0],
+                                                       output,
+                                                       sizeof(T) * batch_count,
+                                                       hipMemcpyDeviceToHost,
+                                                       handle->get_stream()));
+            }
+            return rocblas_status_success;
+        };
+
+        // The wave32 instantiation has fewer threads per block, each with more elements, so that
+        // the block count and the workspace sized by the caller are those of NB and WIN
+        static constexpr int NB_W32  = ROCBLAS_DOT_NB_WAVE32;
+        static constexpr int WIN_W32 = NB * WIN / NB_W32;
+        if constexpr(NB > NB_W32 && NB * WIN % NB_W32 == 0)
+            if(handle->dot_nb == NB_W32)
+                return dot_blocks(std::integral_constant<int, NB_W32>{},
+                                  std::integral_constant<int, WIN_W32>{});
+
+        return dot_blocks(std::integral_constant<int, NB>{}, std::integral_constant<int, WIN>{});
+    }
+    return rocblas_status_success;
+}
+
+// Dot products of K_TILE x vectors with the same y, which is read once for all of them
+template <rocblas_int NB,
+          rocblas_int WIN,
+          rocblas_int K_TILE,
+          bool        CONJ,
+          typename T,
+          typename U,
+          typename V = T>
+ROCBLAS_KERNEL(NB)
+rocblas_mdot_kernel(rocblas_int n,
+                    rocblas_int k,
+                    const U __restrict__ xa,
+                    rocblas_stride shiftx,
+                    rocblas_int    incx,
+                    const T* __restrict__ y,
+                    rocblas_int incy,
+                    V* __restrict__ workspace,
+                    T* __restrict__ out)
+{
+    rocblas_int k0 = blockIdx.y * K_TILE;
+
+    const T* x[K_TILE];
+    V        sum[K_TILE];
+#pragma unroll
+    for(rocblas_int kk = 0; kk < K_TILE; kk++)
+    {
+        x[kk]   = k0 + kk < k ? load_ptr_batch(xa, k0 + kk, shiftx, 0) : nullptr;
+        sum[kk] = 0;
+    }
+
+    ptrdiff_t i   = blockIdx.x * blockDim.x + threadIdx.x;
+    ptrdiff_t inc = ptrdiff_t(blockDim.x) * gridDim.x;
+
+    // sum WIN elements per thread for each x vector
+    for(int j = 0; j < WIN && i < n; j++, i += inc)
+    {
+        V yi = V(y[i * incy]);
+#pragma unroll
+        for(rocblas_int kk = 0; kk < K_TILE; kk++)
+            if(k0 + kk < k)
+                sum[kk] += yi * V(conj_if_true<CONJ>(x[kk][i * incx]));
+    }
+
+#pragma unroll
+    for(rocblas_int kk = 0; kk < K_TILE; kk++)
+    {
+        V s = rocblas_dot_block_reduce<NB>(sum[kk]);
+        if(threadIdx.x == 0 && k0 + kk < k)
         {
-            hipLaunchKernelGGL((rocblas_dot_kernel_magsq<ONE_BLOCK, NB, WIN, CONJ, T>),
-                               grid,
-                               threads,
-                               0,
-                               handle->get_stream(),
-                               n,
-                               x,
-                               shiftx,
-                               incx,
-                               stridex,
-                               workspace,
-                               output);
+            if(gridDim.x == 1) // small N avoid second kernel
+                out[k0 + kk] = T(s);
+            else
+                workspace[blockIdx.x + size_t(k0 + kk) * gridDim.x] = s;
         }
+    }
+}
 
-        if(handle->pointer_mode == rocblas_pointer_mode_device)
+template <rocblas_int NB, bool CONJ, typename T, typename U, typename V>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_mdot_template(rocblas_handle __restrict__ handle,
+                                   rocblas_int n,
+                                   rocblas_int k,
+                                   const U __restrict__ x,
+                                   rocblas_stride offsetx,
+                                   rocblas_int    incx,
+                                   const T* __restrict__ y,
+                                   rocblas_stride offsety,
+                                   rocblas_int    incy,
+                                   T* __restrict__ results,
+                                   V* __restrict__ workspace)
+{
+    // The first kernel writes the partial results of each thread block for each x vector
+    // in workspace, laid out as for a batched dot with batch_count k, so that the second
+    // kernel of dot reduces them when there is more than one block
+    static constexpr int WIN    = rocblas_dot_WIN<T>();
+    static constexpr int K_TILE = ROCBLAS_MDOT_K_TILE;
+
+    // Quick return if possible.
+    if(n <= 0 || k <= 0)
+    {
+        if(handle->is_device_memory_size_query())
+            return rocblas_status_size_unchanged;
+        else if(rocblas_pointer_mode_device == handle->pointer_mode && k > 0)
         {
-            if(blocks > 1) // if single block first kernel did all work
-                hipLaunchKernelGGL((rocblas_dot_kernel_reduce<NB, WIN>),
-                                   dim3(1, batch_count),
-                                   threads,
-                                   0,
-                                   handle->get_stream(),
-                                   blocks,
-                                   workspace,
-                                   results);
+            RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(&results[0], 0, k * sizeof(T), handle->get_stream()));
         }
         else
         {
-            if(blocks > 1) // if single block first kernel did all work
-                hipLaunchKernelGGL((rocblas_dot_kernel_reduce<NB, WIN>),
-                                   dim3(1, batch_count),
-                                   threads,
-                                   0,
-                                   handle->get_stream(),
-                                   blocks,
-                                   workspace,
-                                   output);
+            for(int i = 0; i < k; i++)
+            {
+                results[i] = T(0);
+            }
+        }
+
+        return rocblas_status_success;
+    }
+
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    auto shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
+    auto shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
+
+    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
+    dim3        grid(blocks, (k - 1) / K_TILE + 1);
+    dim3        threads(NB);
+    T*          output = results;
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+    {
+        output = (T*)(workspace + size_t(k) * blocks);
+    }
 
+    hipLaunchKernelGGL((rocblas_mdot_kernel<NB, WIN, K_TILE, CONJ, T>),
+                       grid,
+                       threads,
+                       0,
+                       handle->get_stream(),
+                       n,
+                       k,
+                       x,
+                       shiftx,
+                       incx,
+                       y + shifty,
+                       incy,
+                       workspace,
+                       output);
+
+    if(blocks > 1) // if single block first kernel did all work
+        hipLaunchKernelGGL((rocblas_dot_kernel_reduce<NB, WIN>),
+                           dim3(1, k),
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           blocks,
+                           workspace,
+                           output);
+
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+    {
+        if(handle->deferred_host_results || handle->is_graph_safe())
+            RETURN_IF_ROCBLAS_ERROR(
+                handle->copy_results_to_host(&results[0], output, sizeof(T) * k));
+        else
             RETURN_IF_HIP_ERROR(hipMemcpyAsync(&results[0],
                                                output,
-                                               sizeof(T) * batch_count,
+                                               sizeof(T) * k,
                                                hipMemcpyDeviceToHost,
                                                handle->get_stream()));
-        }
     }
     return rocblas_status_success;
 }
@@ -613,6 +915,41 @@ INSTANTIATE_DOT_TEMPLATE(ROCBLAS_DOT_NB, true, rocblas_double_complex, rocblas_d
 
 #undef INSTANTIATE_DOT_TEMPLATE
 
+#ifdef INSTANTIATE_MDOT_TEMPLATE
+#error INSTANTIATE_MDOT_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_MDOT_TEMPLATE(NB_, CONJ_, T_, V_) \
+template ROCBLAS_INTERNAL_EXPORT_NOINLINE \
+rocblas_status rocblas_internal_mdot_template<NB_, CONJ_, T_, T_ const* const*, V_>(rocblas_handle __restrict__ handle, \
+    rocblas_int n, \
+    rocblas_int k, \
+    T_ const* const* __restrict__ x, \
+    rocblas_stride offsetx, \
+    rocblas_int    incx, \
+    T_ const* __restrict__ y, \
+    rocblas_stride offsety, \
+    rocblas_int    incy, \
+    T_* __restrict__ results, \
+    V_* __restrict__ workspace);
+
+INSTANTIATE_MDOT_TEMPLATE(ROCBLAS_DOT_NB, false, _Float16, _Float16)
+INSTANTIATE_MDOT_TEMPLATE(ROCBLAS_DOT_NB, true, _Float16, _Float16)
+INSTANTIATE_MDOT_TEMPLATE(ROCBLAS_DOT_NB, false, _Float16, float)
+INSTANTIATE_MDOT_TEMPLATE(ROCBLAS_DOT_NB, true, _Float16, float)
+INSTANTIATE_MDOT_TEMPLATE(ROCBLAS_DOT_NB, false, rocblas_bfloat16, float)
+INSTANTIATE_MDOT_TEMPLATE(ROCBLAS_DOT_NB, true, rocblas_bfloat16, float)
+INSTANTIATE_MDOT_TEMPLATE(ROCBLAS_DOT_NB, false, float, float)
+INSTANTIATE_MDOT_TEMPLATE(ROCBLAS_DOT_NB, true, float, float)
+INSTANTIATE_MDOT_TEMPLATE(ROCBLAS_DOT_NB, false, double, double)
+INSTANTIATE_MDOT_TEMPLATE(ROCBLAS_DOT_NB, true, double, double)
+INSTANTIATE_MDOT_TEMPLATE(ROCBLAS_DOT_NB, false, rocblas_float_complex, rocblas_float_complex)
+INSTANTIATE_MDOT_TEMPLATE(ROCBLAS_DOT_NB, true, rocblas_float_complex, rocblas_float_complex)
+INSTANTIATE_MDOT_TEMPLATE(ROCBLAS_DOT_NB, false, rocblas_double_complex, rocblas_double_complex)
+INSTANTIATE_MDOT_TEMPLATE(ROCBLAS_DOT_NB, true, rocblas_double_complex, rocblas_double_complex)
+
+#undef INSTANTIATE_MDOT_TEMPLATE
+
 #ifdef INSTANTIATE_DOT_CHECK_NUMERICS
 #error INSTANTIATE_DOT_CHECK_NUMERICS already defined
 #endif
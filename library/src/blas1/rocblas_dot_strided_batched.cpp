@@ -19,6 +19,7 @@
  * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  *
  * ************************************************************************ */
+#include "../blas2/rocblas_gemv.hpp"
 #include "handle.hpp"
 #include "logging.hpp"
 #include "rocblas.h"
@@ -33,6 +34,123 @@ namespace
     // setting to 512 for gfx803.
     constexpr int NB = ROCBLAS_DOT_NB;
 
+    const rocblas_int rocblas_internal_dot_gemv_min_batch = [] {
+        // Batch count from which strided batched dot products sharing y, or x for dotu, run as
+        // one transposed gemv. 0 disables the gemv.
+        constexpr rocblas_int DOT_GEMV_MIN_BATCH = 4;
+        rocblas_int           min_batch;
+        const char*           env = getenv("ROCBLAS_INTERNAL_DOT_GEMV_MIN_BATCH");
+        return env && sscanf(env, "%d", &min_batch) == 1 ? min_batch : DOT_GEMV_MIN_BATCH;
+    }();
+
+    template <typename T>
+    constexpr bool rocblas_dot_gemv_types
+        = std::is_same<T, float>{} || std::is_same<T, double>{}
+          || std::is_same<T, rocblas_float_complex>{} || std::is_same<T, rocblas_double_complex>{};
+
+    // The dot products of batch_count vectors with a shared vector are the transposed gemv of
+    // the n x batch_count matrix whose columns are the other vectors, which need unit increments
+    // and a stride of at least n. dotc conjugates x, so only y may be shared.
+    template <bool CONJ, typename T>
+    bool rocblas_dot_use_gemv(rocblas_handle handle,
+                              rocblas_int    n,
+                              rocblas_int    incx,
+                              rocblas_stride stridex,
+                              rocblas_int    incy,
+                              rocblas_stride stridey,
+                              rocblas_int    batch_count)
+    {
+        if constexpr(!rocblas_dot_gemv_types<T>)
+            return false;
+        else
+        {
+            if(rocblas_internal_dot_gemv_min_batch <= 0
+               || batch_count < rocblas_internal_dot_gemv_min_batch || n <= 0
+               || handle->reproducible || handle->compensated_summation)
+                return false;
+
+            auto columns = [n](rocblas_int inc, rocblas_stride stride) {
+                return inc == 1 && stride >= n && stride <= std::numeric_limits<rocblas_int>::max();
+            };
+            return (!stridey && columns(incx, stridex))
+                   || (!CONJ && !stridex && columns(incy, stridey));
+        }
+    }
+
+    // The results on the device, then the workspace of the gemv
+    template <typename T>
+    size_t rocblas_dot_gemv_workspace_size(rocblas_int n, rocblas_int batch_count)
+    {
+        if constexpr(!rocblas_dot_gemv_types<T>)
+            return 0;
+        else
+            return sizeof(T) * batch_count
+                   + rocblas_internal_gemv_kernel_workspace_size<T>(
+                       rocblas_operation_transpose, n, batch_count);
+    }
+
+    template <bool CONJ, typename T>
+    rocblas_status rocblas_dot_gemv_template(rocblas_handle handle,
+                                             rocblas_int    n,
+                                             const T*       x,
+                                             rocblas_int    incx,
+                                             rocblas_stride stridex,
+                                             const T*       y,
+                                             rocblas_int    incy,
+                                             rocblas_stride stridey,
+                                             rocblas_int    batch_count,
+                                             T*             results,
+                                             T*             workspace)
+    {
+        if constexpr(!rocblas_dot_gemv_types<T>)
+            return rocblas_status_not_implemented;
+        else
+        {
+            // the columns of A are the vectors which are not shared, read once each with v
+            bool        shared_y = !stridey;
+            const T*    A        = shared_y ? x : y;
+            rocblas_int lda      = rocblas_int(shared_y ? stridex : stridey);
+            const T*    v        = shared_y ? y : x;
+            rocblas_int incv     = shared_y ? incy : incx;
+
+            bool device = handle->pointer_mode == rocblas_pointer_mode_device;
+            T*   output = device ? results : workspace;
+
+            static const T one = T(1), zero = T(0);
+            {
+                auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+                RETURN_IF_ROCBLAS_ERROR(rocblas_internal_gemv_template<T>(
+                    handle,
+                    CONJ ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose,
+                    n,
+                    batch_count,
+                    &one,
+                    0,
+                    A,
+                    0,
+                    lda,
+                    0,
+                    v,
+                    0,
+                    incv,
+                    0,
+                    &zero,
+                    0,
+                    output,
+                    0,
+                    1,
+                    0,
+                    1,
+                    workspace + batch_count));
+            }
+
+            if(!device)
+                RETURN_IF_ROCBLAS_ERROR(
+                    handle->copy_results_to_host(results, output, sizeof(T) * batch_count));
+            return rocblas_status_success;
+        }
+    }
+
     template <bool, typename>
     constexpr char rocblas_dot_strided_batched_name[] = "unknown";
     template <bool CONJ>
@@ -77,7 +195,11 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
-        size_t dev_bytes = rocblas_reduction_kernel_workspace_size<NB * WIN, T2>(n, batch_count);
+        bool use_gemv = rocblas_dot_use_gemv<CONJ, T>(
+            handle, n, incx, stridex, incy, stridey, batch_count);
+        size_t dev_bytes
+            = use_gemv ? rocblas_dot_gemv_workspace_size<T>(n, batch_count)
+                       : rocblas_reduction_kernel_workspace_size<NB * WIN, T2>(n, batch_count);
         if(handle->is_device_memory_size_query())
         {
             if(n <= 0 || batch_count <= 0)
@@ -86,7 +208,7 @@ namespace
                 return handle->set_optimal_device_memory_size(dev_bytes);
         }
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
@@ -178,8 +300,24 @@ namespace
                 return dot_check_numerics_status;
         }
 
-        rocblas_status status = rocblas_internal_dot_template<NB, CONJ, T>(
-            handle, n, x, 0, incx, stridex, y, 0, incy, stridey, batch_count, results, (T2*)w_mem);
+        rocblas_status status;
+        if(use_gemv)
+            status = rocblas_dot_gemv_template<CONJ>(
+                handle, n, x, incx, stridex, y, incy, stridey, batch_count, results, (T*)w_mem);
+        else
+            status = rocblas_internal_dot_template<NB, CONJ, T>(handle,
+                                                                n,
+                                                                x,
+                                                                0,
+                                                                incx,
+                                                                stridex,
+                                                                y,
+                                                                0,
+                                                                incy,
+                                                                stridey,
+                                                                batch_count,
+                                                                results,
+                                                                (T2*)w_mem);
         if(status != rocblas_status_success)
             return status;
 
@@ -0,0 +1,216 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * ===========================================================================
+ *    Device functions for unit stride Level-1 kernels using 128-bit
+ *    (dwordx4) global memory accesses
+ * ===========================================================================
+ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <cstdint>
+#include <type_traits>
+
+//! @brief Number of elements of type T in one 128-bit access, 1 if 16 bytes is not a multiple of T.
+template <typename T>
+constexpr rocblas_int rocblas_dwordx4_length
+    = (sizeof(T) < 16 && 16 % sizeof(T) == 0) ? rocblas_int(16 / sizeof(T)) : 1;
+
+template <typename T>
+struct alignas(16) rocblas_dwordx4
+{
+    T data[rocblas_dwordx4_length<T>];
+};
+
+//! @brief Element type T of the vector argument type U of a kernel, T* or T* const* if batched.
+template <typename U>
+using rocblas_dwordx4_elem_t
+    = std::remove_cv_t<std::remove_pointer_t<std::remove_cv_t<std::remove_pointer_t<U>>>>;
+
+//! @brief Number of 128-bit work items of a unit stride dwordx4 kernel of n elements, the
+//!        threads needed for one vector per thread. U is the vector argument type, T* or
+//!        T* const* if batched.
+template <typename U>
+constexpr int64_t rocblas_dwordx4_count(rocblas_int n)
+{
+    return (n - 1) / rocblas_dwordx4_length<rocblas_dwordx4_elem_t<U>> + 1;
+}
+
+//! @brief Number of leading elements of p before p is 16 byte aligned, -1 if p is not aligned
+//!        to the size of T so that it can never be.
+template <typename T>
+__device__ __host__ inline rocblas_int rocblas_dwordx4_peel(const T* p)
+{
+    size_t misalign = reinterpret_cast<uintptr_t>(p) % 16;
+    return misalign % sizeof(T) ? -1 : rocblas_int(((16 - misalign) % 16) / sizeof(T));
+}
+
+//! @brief Loads the 128-bit vector at p, with a nontemporal load if nontemporal, which does not
+//!        keep the vector in the cache for reuse.
+template <typename T>
+__device__ inline rocblas_dwordx4<T> rocblas_dwordx4_load(const rocblas_dwordx4<T>* p,
+                                                          bool                      nontemporal)
+{
+    using U = uint32_t __attribute__((ext_vector_type(4)));
+    if constexpr(sizeof(rocblas_dwordx4<T>) == sizeof(U))
+    {
+        if(nontemporal)
+        {
+            U                  u = __builtin_nontemporal_load((const U*)p);
+            rocblas_dwordx4<T> v;
+            __builtin_memcpy(&v, &u, sizeof(U));
+            return v;
+        }
+    }
+    return *p;
+}
+
+//! @brief Stores v to the 128-bit vector at p, with a nontemporal store if nontemporal.
+template <typename T>
+__device__ inline void
+    rocblas_dwordx4_store(rocblas_dwordx4<T>* p, const rocblas_dwordx4<T>& v, bool nontemporal)
+{
+    using U = uint32_t __attribute__((ext_vector_type(4)));
+    if constexpr(sizeof(rocblas_dwordx4<T>) == sizeof(U))
+    {
+        if(nontemporal)
+        {
+            U u;
+            __builtin_memcpy(&u, &v, sizeof(U));
+            __builtin_nontemporal_store(u, (U*)p);
+            return;
+        }
+    }
+    *p = v;
+}
+
+//! @brief Applies op(x[i]) in place to the n unit stride elements of x.
+//!
+//! The elements before x is 16 byte aligned and the tail of fewer than rocblas_dwordx4_length
+//! elements are processed one at a time by the first threads, the aligned body one 128-bit
+//! vector per thread. tid is the thread index in the grid, of at least rocblas_dwordx4_length
+//! threads; the threads loop over the vectors with the stride of the grid, nthreads. The body
+//! uses nontemporal loads and stores if nontemporal, for vectors too large to stay cached.
+template <typename T, typename F>
+__device__ void rocblas_dwordx4_apply(
+    ptrdiff_t tid, ptrdiff_t nthreads, rocblas_int n, bool nontemporal, T* __restrict__ x, F op)
+{
+    constexpr rocblas_int VEC  = rocblas_dwordx4_length<T>;
+    rocblas_int           peel = rocblas_dwordx4_peel(x);
+
+    if(peel < 0)
+    {
+        for(ptrdiff_t c = tid * VEC; c < n; c += nthreads * VEC)
+            for(ptrdiff_t i = c; i < n && i < c + VEC; i++)
+                op(x[i]);
+        return;
+    }
+
+    peel           = peel < n ? peel : n;
+    ptrdiff_t body = (n - peel) / VEC;
+    ptrdiff_t tail = peel + body * VEC;
+
+    for(ptrdiff_t v = tid; v < body; v += nthreads)
+    {
+        auto* xv = (rocblas_dwordx4<T>*)(x + peel + v * VEC);
+
+        rocblas_dwordx4<T> vx = rocblas_dwordx4_load(xv, nontemporal);
+        for(rocblas_int j = 0; j < VEC; j++)
+            op(vx.data[j]);
+        rocblas_dwordx4_store(xv, vx, nontemporal);
+    }
+
+    if(tid < peel)
+        op(x[tid]);
+    if(tid < n - tail)
+        op(x[tail + tid]);
+}
+
+//! @brief Applies op(x[i], y[i]) to the n unit stride elements of x and y, storing y[i], and x[i]
+//!        if WRITE_X. y[i] is not loaded before op unless READ_Y.
+//!
+//! When x and y have the same alignment modulo 16 bytes the elements are processed as by the
+//! in place rocblas_dwordx4_apply. Otherwise both cannot be accessed with 128-bit vectors, and
+//! each thread processes chunks of rocblas_dwordx4_length consecutive elements one at a time.
+template <bool READ_Y, bool WRITE_X, typename Tx, typename Ty, typename F>
+__device__ void rocblas_dwordx4_apply(ptrdiff_t   tid,
+                                      ptrdiff_t   nthreads,
+                                      rocblas_int n,
+                                      bool        nontemporal,
+                                      Tx* __restrict__ x,
+                                      Ty* __restrict__ y,
+                                      F op)
+{
+    using T = std::remove_cv_t<Tx>;
+    static_assert(sizeof(T) == sizeof(Ty), "x and y must have the same element size");
+
+    constexpr rocblas_int VEC = rocblas_dwordx4_length<Ty>;
+
+    auto element = [&](ptrdiff_t i) {
+        T  xi = x[i];
+        Ty yi;
+        if constexpr(READ_Y)
+            yi = y[i];
+        op(xi, yi);
+        y[i] = yi;
+        if constexpr(WRITE_X)
+            x[i] = xi;
+    };
+
+    rocblas_int peel = rocblas_dwordx4_peel(y);
+    if(peel < 0 || peel != rocblas_dwordx4_peel(x))
+    {
+        for(ptrdiff_t c = tid * VEC; c < n; c += nthreads * VEC)
+            for(ptrdiff_t i = c; i < n && i < c + VEC; i++)
+                element(i);
+        return;
+    }
+
+    peel           = peel < n ? peel : n;
+    ptrdiff_t body = (n - peel) / VEC;
+    ptrdiff_t tail = peel + body * VEC;
+
+    for(ptrdiff_t v = tid; v < body; v += nthreads)
+    {
+        ptrdiff_t i  = peel + v * VEC;
+        auto*     xv = (rocblas_dwordx4<T>*)(x + i);
+        auto*     yv = (rocblas_dwordx4<Ty>*)(y + i);
+
+        rocblas_dwordx4<T>  vx = rocblas_dwordx4_load(xv, nontemporal);
+        rocblas_dwordx4<Ty> vy;
+        if constexpr(READ_Y)
+            vy = rocblas_dwordx4_load(yv, nontemporal);
+        for(rocblas_int j = 0; j < VEC; j++)
+            op(vx.data[j], vy.data[j]);
+        rocblas_dwordx4_store(yv, vy, nontemporal);
+        if constexpr(WRITE_X)
+            rocblas_dwordx4_store(xv, vx, nontemporal);
+    }
+
+    if(tid < peel)
+        element(tid);
+    if(tid < n - tail)
+        element(tail + tid);
+}
@@ -0,0 +1,714 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "check_numerics_vector.hpp"
+#include "fetch_template.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_block_sizes.h"
+#include "rocblas_dot.hpp"
+#include "rocblas_reduction.hpp"
+#include "utility.hpp"
+
+/*
+ * ===========================================================================
+ *    Fused Level 1 operations, which make one pass over the vectors of two
+ *    back to back Level 1 calls of an iterative solver:
+ *    axpy_dot:  y := alpha * x + y, result := y^T z (conjugated y for complex)
+ *    waxpby:    w := alpha * x + beta * y
+ *    dot_nrm2:  dot := x^T y (conjugated x for complex), nrm2 := ||x||_2
+ *    The reductions use the dot block reduction and workspace layout of
+ *    rocblas_reduction.hpp: one partial sum per thread block, reduced by a
+ *    second kernel when there is more than one block.
+ * ===========================================================================
+ */
+
+namespace
+{
+    constexpr int NB = ROCBLAS_DOT_NB;
+
+    template <typename T>
+    constexpr char rocblas_axpy_dot_name[] = "unknown";
+    template <>
+    constexpr char rocblas_axpy_dot_name<float>[] = "rocblas_saxpy_dot";
+    template <>
+    constexpr char rocblas_axpy_dot_name<double>[] = "rocblas_daxpy_dot";
+    template <>
+    constexpr char rocblas_axpy_dot_name<rocblas_float_complex>[] = "rocblas_caxpy_dotc";
+    template <>
+    constexpr char rocblas_axpy_dot_name<rocblas_double_complex>[] = "rocblas_zaxpy_dotc";
+
+    template <typename T>
+    constexpr char rocblas_waxpby_name[] = "unknown";
+    template <>
+    constexpr char rocblas_waxpby_name<float>[] = "rocblas_swaxpby";
+    template <>
+    constexpr char rocblas_waxpby_name<double>[] = "rocblas_dwaxpby";
+    template <>
+    constexpr char rocblas_waxpby_name<rocblas_float_complex>[] = "rocblas_cwaxpby";
+    template <>
+    constexpr char rocblas_waxpby_name<rocblas_double_complex>[] = "rocblas_zwaxpby";
+
+    template <typename T>
+    constexpr char rocblas_dot_nrm2_name[] = "unknown";
+    template <>
+    constexpr char rocblas_dot_nrm2_name<float>[] = "rocblas_sdot_nrm2";
+    template <>
+    constexpr char rocblas_dot_nrm2_name<double>[] = "rocblas_ddot_nrm2";
+    template <>
+    constexpr char rocblas_dot_nrm2_name<rocblas_float_complex>[] = "rocblas_cdotc_nrm2";
+    template <>
+    constexpr char rocblas_dot_nrm2_name<rocblas_double_complex>[] = "rocblas_zdotc_nrm2";
+
+    // Saves the sum of a thread block, or the result when there is only one block
+    template <typename T>
+    __device__ void rocblas_fused_save_sum(T sum, T* __restrict__ workspace, T* __restrict__ out)
+    {
+        if(threadIdx.x == 0)
+        {
+            if(gridDim.x == 1)
+                *out = sum;
+            else
+                workspace[blockIdx.x] = sum;
+        }
+    }
+
+    // y := alpha * x + y, and the partial sums of y^T z. z may be the same vector as y,
+    // which is then read only once.
+    template <rocblas_int NB, rocblas_int WIN, bool CONJ, typename T, typename Ta>
+    ROCBLAS_KERNEL(NB)
+    rocblas_axpy_dot_kernel(rocblas_int n,
+                            Ta          alpha_device_host,
+                            const T*    x,
+                            rocblas_int incx,
+                            T*          y,
+                            rocblas_int incy,
+                            const T*    z,
+                            rocblas_int incz,
+                            bool        z_is_y,
+                            T* __restrict__ workspace,
+                            T* __restrict__ out)
+    {
+        auto alpha = load_scalar(alpha_device_host);
+
+        ptrdiff_t i   = blockIdx.x * blockDim.x + threadIdx.x;
+        ptrdiff_t inc = ptrdiff_t(blockDim.x) * gridDim.x;
+
+        T sum = 0;
+        for(int j = 0; j < WIN && i < n; j++, i += inc)
+        {
+            T yi        = y[i * incy] + alpha * x[i * incx];
+            y[i * incy] = yi;
+            T zi        = z_is_y ? yi : z[i * incz];
+            sum += conj_if_true<CONJ>(yi) * zi;
+        }
+
+        sum = rocblas_dot_block_reduce<NB>(sum);
+        rocblas_fused_save_sum(sum, workspace, out);
+    }
+
+    // Partial sums of x^T y and of |x_i|^2
+    template <rocblas_int NB, rocblas_int WIN, bool CONJ, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_dot_nrm2_kernel(rocblas_int n,
+                            const T* __restrict__ x,
+                            rocblas_int incx,
+                            const T* __restrict__ y,
+                            rocblas_int incy,
+                            T* __restrict__ workspace_dot,
+                            T* __restrict__ out_dot,
+                            real_t<T>* __restrict__ workspace_nrm2,
+                            real_t<T>* __restrict__ out_nrm2)
+    {
+        ptrdiff_t i   = blockIdx.x * blockDim.x + threadIdx.x;
+        ptrdiff_t inc = ptrdiff_t(blockDim.x) * gridDim.x;
+
+        T         dot  = 0;
+        real_t<T> nrm2 = 0;
+        for(int j = 0; j < WIN && i < n; j++, i += inc)
+        {
+            T xi = x[i * incx];
+            dot += conj_if_true<CONJ>(xi) * y[i * incy];
+            nrm2 += fetch_abs2(xi);
+        }
+
+        dot  = rocblas_dot_block_reduce<NB>(dot);
+        nrm2 = rocblas_dot_block_reduce<NB>(nrm2);
+        if(gridDim.x == 1)
+            nrm2 = sqrt(nrm2);
+        rocblas_fused_save_sum(dot, workspace_dot, out_dot);
+        rocblas_fused_save_sum(nrm2, workspace_nrm2, out_nrm2);
+    }
+
+    // Sums the partial sums of the thread blocks of the first kernel, optionally
+    // finishing a 2-norm
+    template <rocblas_int NB, bool SQRT, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_fused_reduce_kernel(rocblas_int n_sums,
+                                const T* __restrict__ workspace,
+                                T* __restrict__ out)
+    {
+        T sum = 0;
+        for(rocblas_int i = threadIdx.x; i < n_sums; i += NB)
+            sum += workspace[i];
+
+        sum = rocblas_dot_block_reduce<NB>(sum);
+        if(threadIdx.x == 0)
+            *out = SQRT ? T(sqrt(sum)) : sum;
+    }
+
+    // w := alpha * x + beta * y; x is not read when alpha is 0, nor y when beta is 0
+    template <rocblas_int NB, typename T, typename Ta>
+    ROCBLAS_KERNEL(NB)
+    rocblas_waxpby_kernel(rocblas_int n,
+                          Ta          alpha_device_host,
+                          const T*    x,
+                          rocblas_int incx,
+                          Ta          beta_device_host,
+                          const T*    y,
+                          rocblas_int incy,
+                          T*          w,
+                          rocblas_int incw)
+    {
+        auto alpha = load_scalar(alpha_device_host);
+        auto beta  = load_scalar(beta_device_host);
+
+        ptrdiff_t tid = blockIdx.x * blockDim.x + threadIdx.x;
+        if(tid < n)
+        {
+            T wi = alpha ? alpha * x[tid * incx] : T(0);
+            if(beta)
+                wi += beta * y[tid * incy];
+            w[tid * incw] = wi;
+        }
+    }
+
+    // Copy results computed in the workspace to host memory
+    template <typename T>
+    rocblas_status rocblas_fused_copy_result(rocblas_handle handle, T* result, const T* output)
+    {
+        if(handle->deferred_host_results || handle->is_graph_safe())
+            return handle->copy_results_to_host(result, output, sizeof(T));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            result, output, sizeof(T), hipMemcpyDeviceToHost, handle->get_stream()));
+        return rocblas_status_success;
+    }
+
+    // Check numerics of vectors given as (vector, increment) pairs
+    template <typename T>
+    using rocblas_fused_vectors = std::initializer_list<std::pair<const T*, rocblas_int>>;
+
+    template <typename T>
+    rocblas_status rocblas_fused_check_numerics(const char*              name,
+                                                rocblas_handle           handle,
+                                                rocblas_int              n,
+                                                int                      check_numerics,
+                                                bool                     is_input,
+                                                rocblas_fused_vectors<T> vectors)
+    {
+        for(auto& v : vectors)
+        {
+            rocblas_status status = rocblas_internal_check_numerics_vector_template(
+                name, handle, n, v.first, 0, v.second, 0, 1, check_numerics, is_input);
+            if(status != rocblas_status_success)
+                return status;
+        }
+        return rocblas_status_success;
+    }
+
+    // Pointer to the first element accessed with a negative increment
+    template <typename T>
+    T* rocblas_fused_shift(T* x, rocblas_int n, rocblas_int inc)
+    {
+        return inc < 0 ? x - ptrdiff_t(inc) * (n - 1) : x;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_axpy_dot_impl(rocblas_handle handle,
+                                         rocblas_int    n,
+                                         const T*       alpha,
+                                         const T*       x,
+                                         rocblas_int    incx,
+                                         T*             y,
+                                         rocblas_int    incy,
+                                         const T*       z,
+                                         rocblas_int    incz,
+                                         T*             result)
+    {
+        static constexpr int  WIN  = rocblas_dot_WIN<T>();
+        static constexpr bool CONJ = rocblas_is_complex<T>;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes = rocblas_reduction_kernel_workspace_size<NB * WIN, T>(n);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_axpy_dot_name<T>,
+                      n,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      x,
+                      incx,
+                      y,
+                      incy,
+                      z,
+                      incz);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(
+                handle, rocblas_axpy_dot_name<T>, "N", n, "incx", incx, "incy", incy, "incz", incz);
+
+        if(!result)
+            return rocblas_status_invalid_pointer;
+
+        // Quick return if possible.
+        if(n <= 0)
+        {
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+                RETURN_IF_HIP_ERROR(
+                    hipMemsetAsync(result, 0, sizeof(*result), handle->get_stream()));
+            else
+                *result = T(0);
+            return rocblas_status_success;
+        }
+
+        if(!alpha || !x || !y || !z)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        if(check_numerics)
+        {
+            rocblas_status status
+                = rocblas_fused_check_numerics<T>(rocblas_axpy_dot_name<T>,
+                                                  handle,
+                                                  n,
+                                                  check_numerics,
+                                                  true,
+                                                  {{x, incx}, {y, incy}, {z, incz}});
+            if(status != rocblas_status_success)
+                return status;
+        }
+
+        rocblas_int blocks    = rocblas_reduction_kernel_block_count(n, NB * WIN);
+        T*          workspace = (T*)w_mem;
+        T*          output
+            = handle->pointer_mode == rocblas_pointer_mode_device ? result : workspace + blocks;
+
+        bool     z_is_y = z == y && incz == incy;
+        const T* x_s    = rocblas_fused_shift(x, n, incx);
+        T*       y_s    = rocblas_fused_shift(y, n, incy);
+        const T* z_s    = rocblas_fused_shift(z, n, incz);
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            hipLaunchKernelGGL((rocblas_axpy_dot_kernel<NB, WIN, CONJ, T>),
+                               dim3(blocks),
+                               dim3(NB),
+                               0,
+                               handle->get_stream(),
+                               n,
+                               alpha,
+                               x_s,
+                               incx,
+                               y_s,
+                               incy,
+                               z_s,
+                               incz,
+                               z_is_y,
+                               workspace,
+                               output);
+        else
+            hipLaunchKernelGGL((rocblas_axpy_dot_kernel<NB, WIN, CONJ, T>),
+                               dim3(blocks),
+                               dim3(NB),
+                               0,
+                               handle->get_stream(),
+                               n,
+                               *alpha,
+                               x_s,
+                               incx,
+                               y_s,
+                               incy,
+                               z_s,
+                               incz,
+                               z_is_y,
+                               workspace,
+                               output);
+
+        if(blocks > 1)
+            hipLaunchKernelGGL((rocblas_fused_reduce_kernel<NB, false, T>),
+                               dim3(1),
+                               dim3(NB),
+                               0,
+                               handle->get_stream(),
+                               blocks,
+                               workspace,
+                               output);
+
+        if(handle->pointer_mode != rocblas_pointer_mode_device)
+            RETURN_IF_ROCBLAS_ERROR(rocblas_fused_copy_result(handle, result, output));
+
+        if(check_numerics)
+        {
+            rocblas_status status = rocblas_fused_check_numerics<T>(
+                rocblas_axpy_dot_name<T>, handle, n, check_numerics, false, {{y, incy}});
+            if(status != rocblas_status_success)
+                return status;
+        }
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_waxpby_impl(rocblas_handle handle,
+                                       rocblas_int    n,
+                                       const T*       alpha,
+                                       const T*       x,
+                                       rocblas_int    incx,
+                                       const T*       beta,
+                                       const T*       y,
+                                       rocblas_int    incy,
+                                       T*             w,
+                                       rocblas_int    incw)
+    {
+        static constexpr int WAXPBY_NB = ROCBLAS_AXPY_NB;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_waxpby_name<T>,
+                      n,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      x,
+                      incx,
+                      LOG_TRACE_SCALAR_VALUE(handle, beta),
+                      y,
+                      incy,
+                      w,
+                      incw);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(
+                handle, rocblas_waxpby_name<T>, "N", n, "incx", incx, "incy", incy, "incw", incw);
+
+        // Quick return if possible.
+        if(n <= 0)
+            return rocblas_status_success;
+
+        if(!alpha || !beta || !x || !y || !w)
+            return rocblas_status_invalid_pointer;
+
+        if(check_numerics)
+        {
+            rocblas_status status = rocblas_fused_check_numerics<T>(
+                rocblas_waxpby_name<T>, handle, n, check_numerics, true, {{x, incx}, {y, incy}});
+            if(status != rocblas_status_success)
+                return status;
+        }
+
+        rocblas_int blocks = (n - 1) / WAXPBY_NB + 1;
+        const T*    x_s    = rocblas_fused_shift(x, n, incx);
+        const T*    y_s    = rocblas_fused_shift(y, n, incy);
+        T*          w_s    = rocblas_fused_shift(w, n, incw);
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            hipLaunchKernelGGL((rocblas_waxpby_kernel<WAXPBY_NB, T>),
+                               dim3(blocks),
+                               dim3(WAXPBY_NB),
+                               0,
+                               handle->get_stream(),
+                               n,
+                               alpha,
+                               x_s,
+                               incx,
+                               beta,
+                               y_s,
+                               incy,
+                               w_s,
+                               incw);
+        else
+            hipLaunchKernelGGL((rocblas_waxpby_kernel<WAXPBY_NB, T>),
+                               dim3(blocks),
+                               dim3(WAXPBY_NB),
+                               0,
+                               handle->get_stream(),
+                               n,
+                               *alpha,
+                               x_s,
+                               incx,
+                               *beta,
+                               y_s,
+                               incy,
+                               w_s,
+                               incw);
+
+        if(check_numerics)
+        {
+            rocblas_status status = rocblas_fused_check_numerics<T>(
+                rocblas_waxpby_name<T>, handle, n, check_numerics, false, {{w, incw}});
+            if(status != rocblas_status_success)
+                return status;
+        }
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_dot_nrm2_impl(rocblas_handle handle,
+                                         rocblas_int    n,
+                                         const T*       x,
+                                         rocblas_int    incx,
+                                         const T*       y,
+                                         rocblas_int    incy,
+                                         T*             dot_result,
+                                         real_t<T>*     nrm2_result)
+    {
+        static constexpr int  WIN  = rocblas_dot_WIN<T>();
+        static constexpr bool CONJ = rocblas_is_complex<T>;
+        using Tr                   = real_t<T>;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dot_bytes = rocblas_reduction_kernel_workspace_size<NB * WIN, T>(n);
+        size_t dev_bytes = dot_bytes + rocblas_reduction_kernel_workspace_size<NB * WIN, Tr>(n);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, rocblas_dot_nrm2_name<T>, n, x, incx, y, incy);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, rocblas_dot_nrm2_name<T>, "N", n, "incx", incx, "incy", incy);
+
+        if(!dot_result || !nrm2_result)
+            return rocblas_status_invalid_pointer;
+
+        // Quick return if possible.
+        if(n <= 0)
+        {
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+            {
+                RETURN_IF_HIP_ERROR(
+                    hipMemsetAsync(dot_result, 0, sizeof(*dot_result), handle->get_stream()));
+                RETURN_IF_HIP_ERROR(
+                    hipMemsetAsync(nrm2_result, 0, sizeof(*nrm2_result), handle->get_stream()));
+            }
+            else
+            {
+                *dot_result  = T(0);
+                *nrm2_result = Tr(0);
+            }
+            return rocblas_status_success;
+        }
+
+        if(!x || !y)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        if(check_numerics)
+        {
+            rocblas_status status = rocblas_fused_check_numerics<T>(
+                rocblas_dot_nrm2_name<T>, handle, n, check_numerics, true, {{x, incx}, {y, incy}});
+            if(status != rocblas_status_success)
+                return status;
+        }
+
+        // The partial sums of the dot product are followed by the partial sums of squares
+        rocblas_int blocks         = rocblas_reduction_kernel_block_count(n, NB * WIN);
+        bool        device_results = handle->pointer_mode == rocblas_pointer_mode_device;
+        T*          workspace_dot  = (T*)w_mem;
+        Tr*         workspace_nrm2 = (Tr*)((char*)w_mem + dot_bytes);
+        T*          output_dot     = device_results ? dot_result : workspace_dot + blocks;
+        Tr*         output_nrm2    = device_results ? nrm2_result : workspace_nrm2 + blocks;
+
+        hipLaunchKernelGGL((rocblas_dot_nrm2_kernel<NB, WIN, CONJ, T>),
+                           dim3(blocks),
+                           dim3(NB),
+                           0,
+                           handle->get_stream(),
+                           n,
+                           rocblas_fused_shift(x, n, incx),
+                           incx,
+                           rocblas_fused_shift(y, n, incy),
+                           incy,
+                           workspace_dot,
+                           output_dot,
+                           workspace_nrm2,
+                           output_nrm2);
+
+        if(blocks > 1)
+        {
+            hipLaunchKernelGGL((rocblas_fused_reduce_kernel<NB, false, T>),
+                               dim3(1),
+                               dim3(NB),
+                               0,
+                               handle->get_stream(),
+                               blocks,
+                               workspace_dot,
+                               output_dot);
+            hipLaunchKernelGGL((rocblas_fused_reduce_kernel<NB, true, Tr>),
+                               dim3(1),
+                               dim3(NB),
+                               0,
+                               handle->get_stream(),
+                               blocks,
+                               workspace_nrm2,
+                               output_nrm2);
+        }
+
+        if(!device_results)
+        {
+            RETURN_IF_ROCBLAS_ERROR(rocblas_fused_copy_result(handle, dot_result, output_dot));
+            RETURN_IF_ROCBLAS_ERROR(rocblas_fused_copy_result(handle, nrm2_result, output_nrm2));
+        }
+        return rocblas_status_success;
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                            \
+    rocblas_status routine_name_(rocblas_handle handle,                                    \
+                                 rocblas_int    n,                                         \
+                                 const T_*      alpha,                                     \
+                                 const T_*      x,                                         \
+                                 rocblas_int    incx,                                      \
+                                 T_*            y,                                         \
+                                 rocblas_int    incy,                                      \
+                                 const T_*      z,                                         \
+                                 rocblas_int    incz,                                      \
+                                 T_*            result)                                    \
+    try                                                                                    \
+    {                                                                                      \
+        return rocblas_axpy_dot_impl(handle, n, alpha, x, incx, y, incy, z, incz, result); \
+    }                                                                                      \
+    catch(...)                                                                             \
+    {                                                                                      \
+        return exception_to_rocblas_status();                                              \
+    }
+
+IMPL(rocblas_saxpy_dot, float);
+IMPL(rocblas_daxpy_dot, double);
+IMPL(rocblas_caxpy_dotc, rocblas_float_complex);
+IMPL(rocblas_zaxpy_dotc, rocblas_double_complex);
+
+#undef IMPL
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                        \
+    rocblas_status routine_name_(rocblas_handle handle,                                \
+                                 rocblas_int    n,                                     \
+                                 const T_*      alpha,                                 \
+                                 const T_*      x,                                     \
+                                 rocblas_int    incx,                                  \
+                                 const T_*      beta,                                  \
+                                 const T_*      y,                                     \
+                                 rocblas_int    incy,                                  \
+                                 T_*            w,                                     \
+                                 rocblas_int    incw)                                  \
+    try                                                                                \
+    {                                                                                  \
+        return rocblas_waxpby_impl(handle, n, alpha, x, incx, beta, y, incy, w, incw); \
+    }                                                                                  \
+    catch(...)                                                                         \
+    {                                                                                  \
+        return exception_to_rocblas_status();                                          \
+    }
+
+IMPL(rocblas_swaxpby, float);
+IMPL(rocblas_dwaxpby, double);
+IMPL(rocblas_cwaxpby, rocblas_float_complex);
+IMPL(rocblas_zwaxpby, rocblas_double_complex);
+
+#undef IMPL
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_, Tr_)                                                        \
+    rocblas_status routine_name_(rocblas_handle handle,                                     \
+                                 rocblas_int    n,                                          \
+                                 const T_*      x,                                          \
+                                 rocblas_int    incx,                                       \
+                                 const T_*      y,                                          \
+                                 rocblas_int    incy,                                       \
+                                 T_*            dot_result,                                 \
+                                 Tr_*           nrm2_result)                                \
+    try                                                                                     \
+    {                                                                                       \
+        return rocblas_dot_nrm2_impl(handle, n, x, incx, y, incy, dot_result, nrm2_result); \
+    }                                                                                       \
+    catch(...)                                                                              \
+    {                                                                                       \
+        return exception_to_rocblas_status();                                               \
+    }
+
+IMPL(rocblas_sdot_nrm2, float, float);
+IMPL(rocblas_ddot_nrm2, double, double);
+IMPL(rocblas_cdotc_nrm2, rocblas_float_complex, float);
+IMPL(rocblas_zdotc_nrm2, rocblas_double_complex, double);
+
+#undef IMPL
+
+} // extern "C"
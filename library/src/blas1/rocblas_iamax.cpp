@@ -161,4 +161,31 @@ IMPL(rocblas_izamax, rocblas_double_complex, double);
 
 #undef IMPL
 
+// Workspace size queries run the function as a device memory size query, which does not
+// access the vector or the results
+#define IMPL(name_, typei_, typew_)                                                            \
+    rocblas_status name_(rocblas_handle handle, rocblas_int n, rocblas_int incx, size_t* size) \
+    try                                                                                        \
+    {                                                                                          \
+        if(!handle)                                                                            \
+            return rocblas_status_invalid_handle;                                              \
+                                                                                               \
+        typei_      x{};                                                                       \
+        rocblas_int results{};                                                                 \
+        return handle->query_device_memory_size(size, [&] {                                    \
+            return rocblas_iamax_impl<typew_>(handle, n, &x, incx, &results);                  \
+        });                                                                                    \
+    }                                                                                          \
+    catch(...)                                                                                 \
+    {                                                                                          \
+        return exception_to_rocblas_status();                                                  \
+    }
+
+IMPL(rocblas_isamax_workspace_size, float, float);
+IMPL(rocblas_idamax_workspace_size, double, double);
+IMPL(rocblas_icamax_workspace_size, rocblas_float_complex, float);
+IMPL(rocblas_izamax_workspace_size, rocblas_double_complex, double);
+
+#undef IMPL
+
 } // extern "C"
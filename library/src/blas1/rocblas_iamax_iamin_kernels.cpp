@@ -130,12 +130,257 @@ rocblas_iamax_iamin_kernel_part2(rocblas_int nblocks, To* workspace, Tr* result)
         result[blockIdx.y] = Tr(FINALIZE{}(sum));
 }
 
+// The single pass kernel finds the index of each vector in one launch. Every thread block
+// reduces its part of the vector to an index value pair and stores it in the workspace, and
+// the block that finishes last, as counted by an atomic counter per vector, reduces the
+// pairs of all blocks. As ties are broken by the smaller index, the result does not depend
+// on the order in which the blocks complete.
+//
+// Pairs with a float value are reduced across a block as a single 64 bit key, the value bits
+// in the high word and the index in the low word, so that each step of the wavefront
+// reduction is one shuffle and one integer comparison. Absolute values are non-negative, so
+// their bits are ordered as the values are.
+
+// Number of elements handled by each thread
+static constexpr rocblas_int ROCBLAS_IAMAX_IAMIN_SINGLE_PASS_WIN = 4;
+
+// The pair kept by rocblas_reduce_amax or rocblas_reduce_amin has the largest key: for amax
+// the index is complemented so that ties keep the smaller index, for amin the value is
+// complemented as well. The default value, index -1, packs to 0 and loses to every pair.
+// NaN sorts above infinity.
+template <bool AMAX>
+__device__ __forceinline__ uint64_t rocblas_iamax_iamin_pack(rocblas_index_value_t<float> x)
+{
+    if(x.index == -1)
+        return 0;
+    uint32_t bits = __float_as_uint(x.value);
+    return uint64_t(AMAX ? bits : ~bits) << 32 | ~uint32_t(x.index);
+}
+
+template <bool AMAX>
+__device__ __forceinline__ rocblas_index_value_t<float> rocblas_iamax_iamin_unpack(uint64_t key)
+{
+    if(!key)
+        return rocblas_default_value<rocblas_index_value_t<float>>{}();
+    uint32_t                     bits = uint32_t(key >> 32);
+    rocblas_index_value_t<float> x;
+    x.index = rocblas_int(~uint32_t(key));
+    x.value = __uint_as_float(AMAX ? bits : ~bits);
+    return x;
+}
+
+template <int N>
+__inline__ __device__ uint64_t rocblas_wavefront_reduce_key(uint64_t key)
+{
+    constexpr int WFBITS = rocblas_log2ui(N);
+    int           offset = 1 << (WFBITS - 1);
+    for(int i = 0; i < WFBITS; i++)
+    {
+        uint64_t y = __shfl_down(key, offset);
+        key        = y > key ? y : key;
+        offset >>= 1;
+    }
+    return key;
+}
+
+template <rocblas_int NB>
+__inline__ __device__ uint64_t rocblas_shuffle_block_reduce_key(uint64_t key)
+{
+    __shared__ uint64_t pkeys[warpSize];
+
+    rocblas_int wavefront = threadIdx.x / warpSize;
+    rocblas_int wavelet   = threadIdx.x % warpSize;
+
+    if(wavefront == 0)
+        pkeys[wavelet] = 0;
+    __syncthreads();
+
+    key = rocblas_wavefront_reduce_key<warpSize>(key);
+    if(wavelet == 0)
+        pkeys[wavefront] = key;
+
+    __syncthreads();
+
+    static constexpr rocblas_int num_wavefronts = NB / warpSize;
+    key = (threadIdx.x < num_wavefronts) ? pkeys[wavelet] : 0;
+    if(wavefront == 0)
+        key = rocblas_wavefront_reduce_key<num_wavefronts>(key);
+
+    return key;
+}
+
+// Block reduction of the pairs, valid in thread 0
+template <rocblas_int NB, typename REDUCE, typename To>
+__inline__ __device__ To rocblas_iamax_iamin_block_reduce(To x)
+{
+    if constexpr(std::is_same<To, rocblas_index_value_t<float>>{})
+    {
+        constexpr bool AMAX = std::is_same<REDUCE, rocblas_reduce_amax>{};
+        return rocblas_iamax_iamin_unpack<AMAX>(
+            rocblas_shuffle_block_reduce_key<NB>(rocblas_iamax_iamin_pack<AMAX>(x)));
+    }
+    else
+    {
+        return rocblas_shuffle_block_reduce_method<NB, REDUCE>(x);
+    }
+}
+
+// If nblocks is 1 the block writes the index to result directly and counters is unused.
+// Otherwise workspace holds nblocks partial pairs per vector, and counters must be zero on
+// entry; they are left at zero on exit.
+template <rocblas_int NB,
+          rocblas_int WIN,
+          typename FETCH,
+          typename REDUCE,
+          typename FINALIZE,
+          typename TPtrX,
+          typename To,
+          typename Tr>
+ROCBLAS_KERNEL(NB)
+rocblas_iamax_iamin_single_pass_kernel(rocblas_int    n,
+                                       rocblas_int    nblocks,
+                                       TPtrX          xvec,
+                                       rocblas_stride shiftx,
+                                       rocblas_int    incx,
+                                       rocblas_stride stridex,
+                                       To*            workspace,
+                                       uint32_t*      counters,
+                                       Tr*            result)
+{
+    __shared__ bool is_last;
+
+    const auto* x = load_ptr_batch(xvec, blockIdx.y, shiftx, stridex);
+
+    // the elements of a thread are in increasing index order
+    To        val = rocblas_default_value<To>{}();
+    ptrdiff_t tid = ptrdiff_t(blockIdx.x) * NB * WIN + threadIdx.x;
+    for(rocblas_int j = 0; j < WIN; j++, tid += NB)
+        if(tid < n)
+            REDUCE{}(val, FETCH{}(x[tid * incx], tid));
+
+    val = rocblas_iamax_iamin_block_reduce<NB, REDUCE>(val);
+
+    if(nblocks == 1)
+    {
+        if(threadIdx.x == 0)
+            result[blockIdx.y] = Tr(FINALIZE{}(val));
+        return;
+    }
+
+    if(threadIdx.x == 0)
+    {
+        workspace[size_t(blockIdx.y) * nblocks + blockIdx.x] = val;
+
+        // make the partial pair visible to the last block before counting this block
+        __threadfence();
+        uint32_t done = atomicAdd(&counters[blockIdx.y], 1u);
+        is_last       = done == uint32_t(nblocks - 1);
+    }
+    __syncthreads();
+
+    if(!is_last)
+        return;
+
+    // Pairs of the other blocks are read through volatile so that they are fetched from
+    // memory rather than from a stale cache line
+    __threadfence();
+    const volatile To* work = workspace + size_t(blockIdx.y) * nblocks;
+
+    To total = rocblas_default_value<To>{}();
+    for(rocblas_int i = threadIdx.x; i < nblocks; i += NB)
+    {
+        To y;
+        y.index = work[i].index;
+        y.value = work[i].value;
+        REDUCE{}(total, y);
+    }
+
+    total = rocblas_iamax_iamin_block_reduce<NB, REDUCE>(total);
+
+    if(threadIdx.x == 0)
+    {
+        result[blockIdx.y]   = Tr(FINALIZE{}(total));
+        counters[blockIdx.y] = 0;
+    }
+}
+
+/*! \brief
+
+    \details
+    rocblas_iamax_iamin_single_pass_template computes the index reduction of multiple vectors
+              x_i with a single kernel, plus a memset of its counters for vectors of more than
+              NB * WIN_SCALE * ROCBLAS_IAMAX_IAMIN_SINGLE_PASS_WIN elements. It uses an atomic
+              counter, so it is only used when the handle allows atomics. The workspace
+              requirement fits within that of the two kernel reduction with NB * WIN_SCALE
+              threads per block.
+              Layout: blocks partial pairs per batch, then batch_count results of type Tr
+              (in slots of size To) for host pointer mode, then batch_count uint32_t counters.
+    ********************************************************************/
+template <rocblas_int NB,
+          typename FETCH,
+          typename REDUCE,
+          typename FINALIZE,
+          rocblas_int WIN_SCALE = 1,
+          typename TPtrX,
+          typename To,
+          typename Tr>
+rocblas_status rocblas_iamax_iamin_single_pass_template(rocblas_handle handle,
+                                                        rocblas_int    n,
+                                                        TPtrX          x,
+                                                        rocblas_stride shiftx,
+                                                        rocblas_int    incx,
+                                                        rocblas_stride stridex,
+                                                        rocblas_int    batch_count,
+                                                        To*            workspace,
+                                                        Tr*            result)
+{
+    static constexpr rocblas_int WIN = ROCBLAS_IAMAX_IAMIN_SINGLE_PASS_WIN * WIN_SCALE;
+    static_assert(sizeof(To) >= sizeof(uint32_t) && sizeof(To) >= sizeof(Tr),
+                  "workspace layout requires To at least as large as uint32_t and Tr");
+
+    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
+
+    // blocks partial pairs, results, counters
+    Tr*       dev_result = (Tr*)(workspace + size_t(batch_count) * blocks);
+    uint32_t* counters   = (uint32_t*)(workspace + size_t(batch_count) * (blocks + 1));
+
+    bool host_result = handle->pointer_mode == rocblas_pointer_mode_host;
+    if(!host_result)
+        dev_result = result;
+
+    if(blocks > 1)
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(
+            counters, 0, sizeof(uint32_t) * batch_count, handle->get_stream()));
+
+    hipLaunchKernelGGL((rocblas_iamax_iamin_single_pass_kernel<NB, WIN, FETCH, REDUCE, FINALIZE>),
+                       dim3(blocks, batch_count),
+                       NB,
+                       0,
+                       handle->get_stream(),
+                       n,
+                       blocks,
+                       x,
+                       shiftx,
+                       incx,
+                       stridex,
+                       workspace,
+                       counters,
+                       dev_result);
+
+    if(host_result)
+        RETURN_IF_ROCBLAS_ERROR(
+            handle->copy_results_to_host(result, dev_result, batch_count * sizeof(Tr)));
+
+    return rocblas_status_success;
+}
+
 /*! \brief
 
     \details
     rocblas_internal_iamax_iamin_template computes a reduction over multiple vectors x_i
               Template parameters allow threads per block, data, and specific phase kernel overrides
-              At least two kernels are needed to finish the reduction
+              When the handle allows atomics a single kernel does the reduction, see
+              rocblas_iamax_iamin_single_pass_template. Otherwise two kernels are needed:
               kernel 1 write partial result per thread block in workspace, blocks partial results
               kernel 2 gathers all the partial result in workspace and finishes the final reduction.
     @param[in]
@@ -186,6 +431,26 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                           To*            workspace,
                                           Tr*            result)
 {
+    // The single pass kernel uses an atomic counter to find the last thread block of each
+    // vector; without atomics the two kernel reduction is used. Both give the same index.
+    if(handle->atomics_mode == rocblas_atomics_allowed)
+    {
+        // The wave32 instantiation has fewer threads per block, each with more elements, so
+        // that the block count and the workspace sized by the caller are those of NB
+        static constexpr rocblas_int NB_W32 = ROCBLAS_IAMAX_NB_WAVE32;
+        if constexpr(NB > NB_W32 && NB % NB_W32 == 0)
+            if(handle->iamax_nb == NB_W32)
+                return rocblas_iamax_iamin_single_pass_template<NB_W32,
+                                                                FETCH,
+                                                                REDUCE,
+                                                                FINALIZE,
+                                                                NB / NB_W32>(
+                    handle, n, x, shiftx, incx, stridex, batch_count, workspace, result);
+
+        return rocblas_iamax_iamin_single_pass_template<NB, FETCH, REDUCE, FINALIZE>(
+            handle, n, x, shiftx, incx, stridex, batch_count, workspace, result);
+    }
+
     rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB);
 
     hipLaunchKernelGGL((rocblas_iamax_iamin_kernel_part1<NB, FETCH, REDUCE>),
@@ -219,7 +484,12 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         // it must be a standard layout type and its first member must be of type Tr.
         static_assert(std::is_standard_layout<To>{}, "To must be a standard layout type");
 
-        bool reduceKernel = blocks > 1 || batch_count > 1;
+        // Deferred host results, and host results in graph safe mode, are finalized on the
+        // device, so that the copy to the host does not have to be waited for
+        bool reduceKernel
+            = blocks > 1 || batch_count > 1
+              || ((handle->deferred_host_results || handle->is_graph_safe())
+                  && !std::is_same<FINALIZE, rocblas_finalize_identity>{});
         if(reduceKernel)
         {
             hipLaunchKernelGGL((rocblas_iamax_iamin_kernel_part2<NB, REDUCE, FINALIZE>),
@@ -236,8 +506,8 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
             // If FINALIZE is trivial or kernel part2 was called, result is in the
             // beginning of workspace[0]+offset, and can be copied directly.
             size_t offset = reduceKernel ? size_t(batch_count) * blocks : 0;
-            RETURN_IF_HIP_ERROR(hipMemcpy(
-                result, workspace + offset, batch_count * sizeof(Tr), hipMemcpyDeviceToHost));
+            RETURN_IF_ROCBLAS_ERROR(handle->copy_results_to_host(
+                result, workspace + offset, batch_count * sizeof(Tr)));
         }
         else
         {
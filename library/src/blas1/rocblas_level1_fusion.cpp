@@ -0,0 +1,448 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "level1_fusion.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_block_sizes.h"
+#include "rocblas_dot.hpp"
+#include "rocblas_reduction.hpp"
+#include "utility.hpp"
+
+/*
+ * ===========================================================================
+ *    Level 1 fusion mode: the axpy, scal and copy calls queued on the handle
+ *    are run by one kernel, optionally ending with the dot product or 2-norm
+ *    which flushed them, reduced with the dot block reduction and workspace
+ *    layout of rocblas_reduction.hpp.
+ * ===========================================================================
+ */
+
+int _rocblas_level1_fusion::slot(const void* x, size_t elem_size)
+{
+    auto begin = static_cast<const char*>(x);
+    auto end   = begin + elem_size * n;
+    for(int s = 0; s < n_vectors; s++)
+    {
+        if(vectors[s] == x)
+            return s;
+        auto v = static_cast<const char*>(vectors[s]);
+        if(begin < v + elem_size * n && v < end)
+            return -1;
+    }
+    if(n_vectors == MAX_VECTORS)
+        return -1;
+    vectors[n_vectors] = const_cast<void*>(x);
+    return n_vectors++;
+}
+
+namespace
+{
+    constexpr int NB          = ROCBLAS_DOT_NB;
+    constexpr int MAX_OPS     = _rocblas_level1_fusion::MAX_OPS;
+    constexpr int MAX_VECTORS = _rocblas_level1_fusion::MAX_VECTORS;
+
+    using op_kind = _rocblas_level1_fusion::op_kind;
+
+    // The queue as passed to the kernel
+    template <typename T>
+    struct rocblas_level1_fused_args
+    {
+        T*       vectors[MAX_VECTORS];
+        T        alpha[MAX_OPS];
+        op_kind  kind[MAX_OPS];
+        int8_t   dst[MAX_OPS];
+        int8_t   src[MAX_OPS];
+        int      n_ops;
+        uint32_t load_mask;
+        uint32_t store_mask;
+        int      reduce_x; // slots of the reduction, reduce_y < 0 for a 2-norm
+        int      reduce_y;
+    };
+
+    // Slot s of the element, selected without indexing so that the slots stay in registers
+    template <typename T>
+    __device__ T rocblas_level1_fused_get(const T (&v)[MAX_VECTORS], int s)
+    {
+        T r = v[0];
+#pragma unroll
+        for(int j = 1; j < MAX_VECTORS; j++)
+            if(j == s)
+                r = v[j];
+        return r;
+    }
+
+    template <typename T>
+    __device__ void rocblas_level1_fused_set(T (&v)[MAX_VECTORS], int s, T value)
+    {
+#pragma unroll
+        for(int j = 0; j < MAX_VECTORS; j++)
+            if(j == s)
+                v[j] = value;
+    }
+
+    // Applies the queued operations to WIN elements per thread, and with REDUCE saves the
+    // partial sum of the thread block of the dot product or sum of squares, accumulated in
+    // double so that the squares of float values neither overflow nor underflow
+    template <rocblas_int NB, rocblas_int WIN, bool REDUCE, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_level1_fused_kernel(rocblas_int                  n,
+                                rocblas_level1_fused_args<T> args,
+                                double* __restrict__ workspace,
+                                T* __restrict__ out)
+    {
+        ptrdiff_t i   = blockIdx.x * blockDim.x + threadIdx.x;
+        ptrdiff_t inc = ptrdiff_t(blockDim.x) * gridDim.x;
+
+        double sum = 0;
+        for(int j = 0; j < WIN && i < n; j++, i += inc)
+        {
+            T v[MAX_VECTORS] = {};
+#pragma unroll
+            for(int s = 0; s < MAX_VECTORS; s++)
+                if(args.load_mask & (1u << s))
+                    v[s] = args.vectors[s][i];
+
+            for(int k = 0; k < args.n_ops; k++)
+            {
+                T src = rocblas_level1_fused_get(v, args.src[k]);
+                T dst = rocblas_level1_fused_get(v, args.dst[k]);
+                T r   = args.kind[k] == op_kind::axpy   ? args.alpha[k] * src + dst
+                        : args.kind[k] == op_kind::scal ? args.alpha[k] * dst
+                                                        : src;
+                rocblas_level1_fused_set(v, args.dst[k], r);
+            }
+
+#pragma unroll
+            for(int s = 0; s < MAX_VECTORS; s++)
+                if(args.store_mask & (1u << s))
+                    args.vectors[s][i] = v[s];
+
+            if(REDUCE)
+            {
+                double xi = rocblas_level1_fused_get(v, args.reduce_x);
+                sum += xi * (args.reduce_y < 0 ? xi : rocblas_level1_fused_get(v, args.reduce_y));
+            }
+        }
+
+        if(REDUCE)
+        {
+            sum = rocblas_dot_block_reduce<NB>(sum);
+            if(threadIdx.x == 0)
+            {
+                if(gridDim.x == 1)
+                    *out = T(args.reduce_y < 0 ? sqrt(sum) : sum);
+                else
+                    workspace[blockIdx.x] = sum;
+            }
+        }
+    }
+
+    // Sums the partial sums of the thread blocks, finishing a 2-norm with SQRT
+    template <rocblas_int NB, bool SQRT, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_level1_fused_reduce_kernel(rocblas_int n_sums,
+                                       const double* __restrict__ workspace,
+                                       T* __restrict__ out)
+    {
+        double sum = 0;
+        for(rocblas_int i = threadIdx.x; i < n_sums; i += NB)
+            sum += workspace[i];
+
+        sum = rocblas_dot_block_reduce<NB>(sum);
+        if(threadIdx.x == 0)
+            *out = T(SQRT ? sqrt(sum) : sum);
+    }
+
+    // Runs the queue, followed by the reduction of slots reduce_x and reduce_y when
+    // reduce_x >= 0
+    template <typename T>
+    rocblas_status rocblas_level1_fusion_launch(rocblas_handle handle,
+                                                int            reduce_x,
+                                                int            reduce_y,
+                                                T*             result)
+    {
+        static constexpr int WIN = rocblas_dot_WIN<T>();
+
+        auto&       queue  = *handle->level1_fusion;
+        rocblas_int n      = queue.n;
+        bool        reduce = reduce_x >= 0;
+
+        rocblas_level1_fused_args<T> args{};
+        for(int s = 0; s < queue.n_vectors; s++)
+            args.vectors[s] = static_cast<T*>(queue.vectors[s]);
+        for(int k = 0; k < queue.n_ops; k++)
+        {
+            args.alpha[k] = T(queue.ops[k].alpha);
+            args.kind[k]  = queue.ops[k].kind;
+            args.dst[k]   = queue.ops[k].dst;
+            args.src[k]   = queue.ops[k].src;
+        }
+        args.n_ops      = queue.n_ops;
+        args.load_mask  = queue.load_mask;
+        args.store_mask = queue.store_mask;
+        args.reduce_x   = reduce_x;
+        args.reduce_y   = reduce_y;
+
+        // The queue is run at most once, whatever the outcome of the launch
+        queue.clear();
+
+        auto launch_elementwise = [&] {
+            args.reduce_x      = -1;
+            rocblas_int blocks = (n - 1) / NB + 1;
+            hipLaunchKernelGGL((rocblas_level1_fused_kernel<NB, 1, false, T>),
+                               dim3(blocks),
+                               dim3(NB),
+                               0,
+                               handle->get_stream(),
+                               n,
+                               args,
+                               nullptr,
+                               nullptr);
+        };
+
+        if(!reduce)
+        {
+            launch_elementwise();
+            return rocblas_status_success;
+        }
+
+        // Without workspace the reduction runs on its own, which reports the error
+        auto w_mem
+            = handle->device_malloc(rocblas_reduction_kernel_workspace_size<NB * WIN, double>(n));
+        if(!w_mem)
+        {
+            launch_elementwise();
+            return rocblas_status_continue;
+        }
+
+        rocblas_int blocks         = rocblas_reduction_kernel_block_count(n, NB * WIN);
+        bool        device_results = handle->pointer_mode == rocblas_pointer_mode_device;
+        double*     workspace      = (double*)w_mem;
+        T*          output         = device_results ? result : (T*)(workspace + blocks);
+
+        hipLaunchKernelGGL((rocblas_level1_fused_kernel<NB, WIN, true, T>),
+                           dim3(blocks),
+                           dim3(NB),
+                           0,
+                           handle->get_stream(),
+                           n,
+                           args,
+                           workspace,
+                           output);
+
+        if(blocks > 1)
+        {
+            if(reduce_y < 0)
+                hipLaunchKernelGGL((rocblas_level1_fused_reduce_kernel<NB, true, T>),
+                                   dim3(1),
+                                   dim3(NB),
+                                   0,
+                                   handle->get_stream(),
+                                   blocks,
+                                   workspace,
+                                   output);
+            else
+                hipLaunchKernelGGL((rocblas_level1_fused_reduce_kernel<NB, false, T>),
+                                   dim3(1),
+                                   dim3(NB),
+                                   0,
+                                   handle->get_stream(),
+                                   blocks,
+                                   workspace,
+                                   output);
+        }
+
+        if(!device_results)
+        {
+            if(handle->deferred_host_results || handle->is_graph_safe())
+                return handle->copy_results_to_host(result, output, sizeof(T));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                result, output, sizeof(T), hipMemcpyDeviceToHost, handle->get_stream()));
+        }
+        return rocblas_status_success;
+    }
+
+    rocblas_status rocblas_level1_fusion_launch(rocblas_handle handle,
+                                                int            reduce_x = -1,
+                                                int            reduce_y = -1,
+                                                void*          result   = nullptr)
+    {
+        switch(handle->level1_fusion->type)
+        {
+        case rocblas_datatype_f32_r:
+            return rocblas_level1_fusion_launch(handle, reduce_x, reduce_y, (float*)result);
+        case rocblas_datatype_f64_r:
+            return rocblas_level1_fusion_launch(handle, reduce_x, reduce_y, (double*)result);
+        default:
+            return rocblas_status_internal_error;
+        }
+    }
+}
+
+rocblas_status rocblas_level1_fusion_flush(rocblas_handle handle)
+{
+    auto queue = handle->level1_fusion;
+    if(!queue || !queue->n_ops)
+        return rocblas_status_success;
+    return rocblas_level1_fusion_launch(handle);
+}
+
+rocblas_status rocblas_level1_fusion_record(rocblas_handle   handle,
+                                            rocblas_datatype type,
+                                            rocblas_int      n,
+                                            op_kind          kind,
+                                            double           alpha,
+                                            const void*      x,
+                                            void*            y)
+{
+    auto&  queue     = *handle->level1_fusion;
+    size_t elem_size = rocblas_sizeof_datatype(type);
+
+    // Slots of the operation, or -1 when it cannot join the queue
+    auto find_slots = [&](int& src, int& dst) {
+        if(queue.n_ops == MAX_OPS || queue.type != type || queue.n != n)
+            return false;
+        int n_vectors = queue.n_vectors;
+        src           = queue.slot(x, elem_size);
+        dst           = src < 0 ? -1 : queue.slot(y, elem_size);
+        if(dst < 0)
+            queue.n_vectors = n_vectors;
+        return dst >= 0;
+    };
+
+    int src, dst;
+    if(!queue.n_ops || !find_slots(src, dst))
+    {
+        RETURN_IF_ROCBLAS_ERROR(rocblas_level1_fusion_flush(handle));
+        queue.type = type;
+        queue.n    = n;
+        if(!find_slots(src, dst))
+        {
+            // x and y partially overlap, which only the Level 1 kernels handle
+            queue.clear();
+            return rocblas_status_continue;
+        }
+    }
+
+    if(kind != op_kind::copy)
+        queue.read(dst);
+    if(kind != op_kind::scal)
+        queue.read(src);
+    queue.store_mask |= 1u << dst;
+    queue.ops[queue.n_ops++] = {kind, int8_t(dst), int8_t(src), alpha};
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_level1_fusion_reduce(rocblas_handle   handle,
+                                            rocblas_datatype type,
+                                            rocblas_int      n,
+                                            const void*      x,
+                                            const void*      y,
+                                            void*            result)
+{
+    auto&  queue     = *handle->level1_fusion;
+    size_t elem_size = rocblas_sizeof_datatype(type);
+
+    // Without deferred operations of the same shape, the reduction has nothing to fuse with
+    if(!queue.n_ops || queue.type != type || queue.n != n)
+        return rocblas_level1_fusion_no_defer(handle);
+
+    int n_vectors = queue.n_vectors;
+    int reduce_x  = queue.slot(x, elem_size);
+    int reduce_y  = y && reduce_x >= 0 ? queue.slot(y, elem_size) : -1;
+    if(reduce_x < 0 || (y && reduce_y < 0))
+    {
+        queue.n_vectors = n_vectors;
+        return rocblas_level1_fusion_no_defer(handle);
+    }
+
+    queue.read(reduce_x);
+    if(y)
+        queue.read(reduce_y);
+    return rocblas_level1_fusion_launch(handle, reduce_x, reduce_y, result);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_set_level1_fusion(rocblas_handle handle, bool enable)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_level1_fusion", enable);
+
+    if(enable)
+    {
+        if(!handle->level1_fusion)
+            handle->level1_fusion = new _rocblas_level1_fusion;
+        return rocblas_status_success;
+    }
+
+    rocblas_status status = rocblas_level1_fusion_flush(handle);
+    delete handle->level1_fusion;
+    handle->level1_fusion = nullptr;
+    return status;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_level1_fusion(rocblas_handle handle, bool* enabled)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!enabled)
+        return rocblas_status_invalid_pointer;
+
+    *enabled = handle->level1_fusion != nullptr;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_flush_level1_fusion(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_flush_level1_fusion");
+
+    return rocblas_level1_fusion_flush(handle);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
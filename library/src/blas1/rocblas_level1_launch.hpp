@@ -0,0 +1,81 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * ===========================================================================
+ *    Launch sizing of the grid-stride Level-1 kernels
+ * ===========================================================================
+ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas_dwordx4.hpp"
+#include <algorithm>
+
+//! @brief Grid and block of a grid-stride Level 1 kernel of `work` items per batch, with at most
+//!        NB threads per block and batch_count batches in the y dimension of the grid.
+//!
+//! By default the grid has one thread per item, in blocks of NB threads. When the handle's
+//! level1_blocks_per_cu is set the block size is the one for the device architecture, and the
+//! grid is capped at level1_blocks_per_cu blocks per compute unit over all batches, so that
+//! the kernels loop over the items with the stride of the grid.
+template <rocblas_int NB>
+struct rocblas_level1_launch
+{
+    dim3 grid;
+    dim3 threads;
+
+    rocblas_level1_launch(rocblas_handle handle, int64_t work, rocblas_int batch_count)
+    {
+        int64_t block = NB;
+        int64_t cap   = 0;
+        if(handle->level1_blocks_per_cu > 0)
+        {
+            block = std::min<int64_t>(NB, handle->level1_block_size);
+            cap   = std::max<int64_t>(
+                1, int64_t(handle->getCUCount()) * handle->level1_blocks_per_cu / batch_count);
+        }
+
+        int64_t blocks = (work - 1) / block + 1;
+        if(cap)
+            blocks = std::min(blocks, cap);
+
+        grid    = dim3(blocks, batch_count);
+        threads = dim3(block);
+    }
+};
+
+//! @brief Whether a unit stride dwordx4 kernel accessing `vectors` vectors of n elements per batch
+//!        should use nontemporal loads and stores, which is when the vectors of all batch_count
+//!        batches exceed the handle's level1_nontemporal_bytes, by default the size of the L2
+//!        cache. U is the vector argument type, T* or T* const* if batched.
+template <typename U>
+inline bool rocblas_level1_nontemporal(rocblas_handle handle,
+                                       rocblas_int    n,
+                                       int            vectors,
+                                       rocblas_int    batch_count)
+{
+    size_t threshold = handle->level1_nontemporal_bytes;
+    size_t bytes     = size_t(n) * sizeof(rocblas_dwordx4_elem_t<U>) * vectors * batch_count;
+    return threshold && bytes > threshold;
+}
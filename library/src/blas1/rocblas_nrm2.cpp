@@ -22,6 +22,7 @@
 
 #include "rocblas_nrm2.hpp"
 #include "check_numerics_vector.hpp"
+#include "level1_fusion.hpp"
 #include "rocblas_block_sizes.h"
 #include "rocblas_reduction_setup.hpp"
 
@@ -68,6 +69,10 @@ namespace
             return checks_status;
         }
 
+        rocblas_status fusion_status = rocblas_level1_fusion_nrm2(handle, n, x, incx, results);
+        if(fusion_status != rocblas_status_continue)
+            return fusion_status;
+
         auto check_numerics = handle->check_numerics;
         if(check_numerics)
         {
@@ -152,4 +157,31 @@ IMPL(rocblas_dznrm2, rocblas_double_complex, double);
 
 #undef IMPL
 
+// Workspace size queries run the function as a device memory size query, which does not
+// access the vector or the results
+#define IMPL(name_, typei_, typeo_)                                                            \
+    rocblas_status name_(rocblas_handle handle, rocblas_int n, rocblas_int incx, size_t* size) \
+    try                                                                                        \
+    {                                                                                          \
+        if(!handle)                                                                            \
+            return rocblas_status_invalid_handle;                                              \
+                                                                                               \
+        typei_ x{};                                                                            \
+        typeo_ results{};                                                                      \
+        return handle->query_device_memory_size(size, [&] {                                    \
+            return rocblas_nrm2_impl<ROCBLAS_NRM2_NB>(handle, n, &x, incx, &results);          \
+        });                                                                                    \
+    }                                                                                          \
+    catch(...)                                                                                 \
+    {                                                                                          \
+        return exception_to_rocblas_status();                                                  \
+    }
+
+IMPL(rocblas_snrm2_workspace_size, float, float);
+IMPL(rocblas_dnrm2_workspace_size, double, double);
+IMPL(rocblas_scnrm2_workspace_size, rocblas_float_complex, float);
+IMPL(rocblas_dznrm2_workspace_size, rocblas_double_complex, double);
+
+#undef IMPL
+
 } // extern "C"
@@ -59,6 +59,17 @@ rocblas_status rocblas_reduction_template(rocblas_handle handle,
                                           To*            workspace,
                                           Tr*            result);
 
+template <rocblas_int NB, typename TPtrX, typename To, typename Tr>
+rocblas_status rocblas_nrm2_single_pass_template(rocblas_handle handle,
+                                                 rocblas_int    n,
+                                                 TPtrX          x,
+                                                 rocblas_stride shiftx,
+                                                 rocblas_int    incx,
+                                                 rocblas_stride stridex,
+                                                 rocblas_int    batch_count,
+                                                 To*            workspace,
+                                                 Tr*            result);
+
 template <rocblas_int NB, typename Ti, typename To, typename Tex = To>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     rocblas_internal_nrm2_template(rocblas_handle handle,
@@ -71,6 +82,14 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                    Tex*           workspace,
                                    To*            results)
 {
+    // The single pass kernel uses an atomic counter to find the last thread block
+    // of each vector; without atomics, and in reproducible or compensated summation mode, the
+    // two kernel reduction template is used
+    if(handle->atomics_mode == rocblas_atomics_allowed && !handle->reproducible
+       && !handle->compensated_summation)
+        return rocblas_nrm2_single_pass_template<NB>(
+            handle, n, x, shiftx, incx, stridex, batch_count, workspace, results);
+
     return rocblas_reduction_template<NB, rocblas_fetch_nrm2<To>, rocblas_finalize_nrm2>(
         handle, n, x, shiftx, incx, stridex, batch_count, workspace, results);
 }
@@ -0,0 +1,318 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "../blas1/rocblas_nrm2.hpp"
+#include "../blas1/rocblas_reduction.hpp"
+#include "rocblas_block_sizes.h"
+
+// The single pass nrm2 kernel reduces each vector in one launch. Every thread block
+// computes the norm of its part of the vector and stores it in the workspace. The
+// block that finishes last, as counted by an atomic counter per vector, computes
+// the norm of the partial norms. The partial norms are always combined in the same
+// order, so the result does not depend on the order in which the blocks complete.
+//
+// Sums of squares are accumulated with Blue's algorithm, as in the reference BLAS
+// (LAPACK 3.10 dnrm2): elements that are very small or very large are scaled into
+// separate accumulators, so that neither the squares nor the partial norms
+// underflow or overflow unless the norm itself does.
+
+// Number of elements handled by each thread
+static constexpr rocblas_int ROCBLAS_NRM2_SINGLE_PASS_WIN = 4;
+
+// Blue's constants for radix 2 (la_constants.f90 tsml, tbig, ssml, sbig)
+template <typename T>
+struct rocblas_nrm2_blue_constants;
+
+template <>
+struct rocblas_nrm2_blue_constants<float>
+{
+    static constexpr float tsml = 0x1p-63f;
+    static constexpr float tbig = 0x1p52f;
+    static constexpr float ssml = 0x1p75f;
+    static constexpr float sbig = 0x1p-76f;
+};
+
+template <>
+struct rocblas_nrm2_blue_constants<double>
+{
+    static constexpr double tsml = 0x1p-511;
+    static constexpr double tbig = 0x1p486;
+    static constexpr double ssml = 0x1p537;
+    static constexpr double sbig = 0x1p-538;
+};
+
+template <typename T>
+struct rocblas_nrm2_blue_accumulator
+{
+    using C = rocblas_nrm2_blue_constants<T>;
+
+    T asml = 0;
+    T amed = 0;
+    T abig = 0;
+
+    __device__ void add(T ax)
+    {
+        // NaN falls through to amed and propagates to the result
+        if(ax > C::tbig)
+        {
+            ax *= C::sbig;
+            abig += ax * ax;
+        }
+        else if(ax < C::tsml)
+        {
+            ax *= C::ssml;
+            asml += ax * ax;
+        }
+        else
+        {
+            amed += ax * ax;
+        }
+    }
+
+    template <typename U, std::enable_if_t<!rocblas_is_complex<U>, int> = 0>
+    __device__ void add_element(const U& x)
+    {
+        T ax = T(x);
+        add(ax < 0 ? -ax : ax);
+    }
+
+    template <typename U, std::enable_if_t<rocblas_is_complex<U>, int> = 0>
+    __device__ void add_element(const U& x)
+    {
+        T re = std::real(x);
+        T im = std::imag(x);
+        add(re < 0 ? -re : re);
+        add(im < 0 ? -im : im);
+    }
+
+    template <rocblas_int NB>
+    __device__ void block_reduce()
+    {
+        asml = rocblas_dot_block_reduce<NB, T>(asml);
+        amed = rocblas_dot_block_reduce<NB, T>(amed);
+        abig = rocblas_dot_block_reduce<NB, T>(abig);
+    }
+
+    __device__ T finalize() const
+    {
+        T scl, sumsq;
+        if(abig > 0)
+        {
+            T big = abig;
+            if(amed > 0 || amed != amed)
+                big += (amed * C::sbig) * C::sbig;
+            scl   = 1 / C::sbig;
+            sumsq = big;
+        }
+        else if(asml > 0)
+        {
+            if(amed > 0 || amed != amed)
+            {
+                T med  = sqrt(amed);
+                T sml  = sqrt(asml) / C::ssml;
+                T ymin = sml > med ? med : sml;
+                T ymax = sml > med ? sml : med;
+                scl    = 1;
+                T r    = ymin / ymax;
+                sumsq  = ymax * ymax * (1 + r * r);
+            }
+            else
+            {
+                scl   = 1 / C::ssml;
+                sumsq = asml;
+            }
+        }
+        else
+        {
+            scl   = 1;
+            sumsq = amed;
+        }
+        return scl * sqrt(sumsq);
+    }
+};
+
+// If nblocks is 1 the block writes the norm to result directly and counters is unused.
+// Otherwise workspace holds nblocks partial norms per vector, and counters must be
+// zero on entry; they are left at zero on exit.
+template <rocblas_int NB, rocblas_int WIN, typename TPtrX, typename To, typename Tr>
+ROCBLAS_KERNEL(NB)
+rocblas_nrm2_single_pass_kernel(rocblas_int    n,
+                                rocblas_int    nblocks,
+                                TPtrX          xvec,
+                                rocblas_stride shiftx,
+                                rocblas_int    incx,
+                                rocblas_stride stridex,
+                                To*            workspace,
+                                uint32_t*      counters,
+                                Tr*            result)
+{
+    __shared__ bool is_last;
+
+    const auto* x = load_ptr_batch(xvec, blockIdx.y, shiftx, stridex);
+
+    rocblas_nrm2_blue_accumulator<To> acc;
+
+    ptrdiff_t tid = ptrdiff_t(blockIdx.x) * NB * WIN + threadIdx.x;
+    for(rocblas_int j = 0; j < WIN; j++, tid += NB)
+        if(tid < n)
+            acc.add_element(x[tid * incx]);
+
+    acc.template block_reduce<NB>();
+
+    if(nblocks == 1)
+    {
+        if(threadIdx.x == 0)
+            result[blockIdx.y] = Tr(acc.finalize());
+        return;
+    }
+
+    if(threadIdx.x == 0)
+    {
+        workspace[size_t(blockIdx.y) * nblocks + blockIdx.x] = acc.finalize();
+
+        // make the partial norm visible to the last block before counting this block
+        __threadfence();
+        uint32_t done = atomicAdd(&counters[blockIdx.y], 1u);
+        is_last       = done == uint32_t(nblocks - 1);
+    }
+    __syncthreads();
+
+    if(!is_last)
+        return;
+
+    // Partial norms of the other blocks are read through volatile so that they are
+    // fetched from memory rather than from a stale cache line
+    __threadfence();
+    const volatile To* work = workspace + size_t(blockIdx.y) * nblocks;
+
+    rocblas_nrm2_blue_accumulator<To> total;
+    for(rocblas_int i = threadIdx.x; i < nblocks; i += NB)
+        total.add(work[i]);
+
+    total.template block_reduce<NB>();
+
+    if(threadIdx.x == 0)
+    {
+        result[blockIdx.y]  = Tr(total.finalize());
+        counters[blockIdx.y] = 0;
+    }
+}
+
+/*! \brief
+
+    \details
+    rocblas_nrm2_single_pass_template computes the Euclidean norm of multiple vectors x_i
+              with a single reduction kernel. It uses an atomic counter, so it is only
+              used when the handle allows atomics, see rocblas_internal_nrm2_template.
+              The workspace requirement fits within that of rocblas_reduction_template,
+              rocblas_reduction_kernel_workspace_size<NB, To>(n, batch_count).
+              Layout: blocks partial norms per batch, then batch_count results of type Tr
+              (in slots of size To) for host pointer mode, then batch_count uint32_t counters.
+    ********************************************************************/
+template <rocblas_int NB, typename TPtrX, typename To, typename Tr>
+rocblas_status rocblas_nrm2_single_pass_template(rocblas_handle handle,
+                                                 rocblas_int    n,
+                                                 TPtrX          x,
+                                                 rocblas_stride shiftx,
+                                                 rocblas_int    incx,
+                                                 rocblas_stride stridex,
+                                                 rocblas_int    batch_count,
+                                                 To*            workspace,
+                                                 Tr*            result)
+{
+    static constexpr rocblas_int WIN = ROCBLAS_NRM2_SINGLE_PASS_WIN;
+    static_assert(sizeof(To) >= sizeof(uint32_t) && sizeof(To) >= sizeof(Tr),
+                  "workspace layout requires To at least as large as uint32_t and Tr");
+
+    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
+
+    // blocks partial norms, results, counters
+    Tr*       dev_result = (Tr*)(workspace + size_t(batch_count) * blocks);
+    uint32_t* counters   = (uint32_t*)(workspace + size_t(batch_count) * (blocks + 1));
+
+    bool host_result = handle->pointer_mode == rocblas_pointer_mode_host;
+    if(!host_result)
+        dev_result = result;
+
+    if(blocks > 1)
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(
+            counters, 0, sizeof(uint32_t) * batch_count, handle->get_stream()));
+
+    hipLaunchKernelGGL((rocblas_nrm2_single_pass_kernel<NB, WIN>),
+                       dim3(blocks, batch_count),
+                       NB,
+                       0,
+                       handle->get_stream(),
+                       n,
+                       blocks,
+                       x,
+                       shiftx,
+                       incx,
+                       stridex,
+                       workspace,
+                       counters,
+                       dev_result);
+
+    if(host_result)
+        RETURN_IF_ROCBLAS_ERROR(
+            handle->copy_results_to_host(result, dev_result, batch_count * sizeof(Tr)));
+
+    return rocblas_status_success;
+}
+
+// clang-format off
+#ifdef INSTANTIATE_ROCBLAS_NRM2_SINGLE_PASS_TEMPLATE
+#error INSTANTIATE_ROCBLAS_NRM2_SINGLE_PASS_TEMPLATE IS ALREADY DEFINED
+#endif
+
+#define INSTANTIATE_ROCBLAS_NRM2_SINGLE_PASS_TEMPLATE(NB_, T_, U_, V_)                            \
+    template rocblas_status rocblas_nrm2_single_pass_template<NB_, T_, U_, V_>(rocblas_handle handle, \
+                                                                 rocblas_int    n,                \
+                                                                 T_             x,                \
+                                                                 rocblas_stride shiftx,           \
+                                                                 rocblas_int    incx,             \
+                                                                 rocblas_stride stridex,          \
+                                                                 rocblas_int    batch_count,      \
+                                                                 U_*            workspace,        \
+                                                                 V_*            result);
+
+INSTANTIATE_ROCBLAS_NRM2_SINGLE_PASS_TEMPLATE(ROCBLAS_NRM2_NB, float const*, float, float)
+INSTANTIATE_ROCBLAS_NRM2_SINGLE_PASS_TEMPLATE(ROCBLAS_NRM2_NB, float const* const*, float, float)
+
+INSTANTIATE_ROCBLAS_NRM2_SINGLE_PASS_TEMPLATE(ROCBLAS_NRM2_NB, double const*, double, double)
+INSTANTIATE_ROCBLAS_NRM2_SINGLE_PASS_TEMPLATE(ROCBLAS_NRM2_NB, double const* const*, double, double)
+
+INSTANTIATE_ROCBLAS_NRM2_SINGLE_PASS_TEMPLATE(ROCBLAS_NRM2_NB, rocblas_float_complex const*, float, float)
+INSTANTIATE_ROCBLAS_NRM2_SINGLE_PASS_TEMPLATE(ROCBLAS_NRM2_NB, rocblas_float_complex const* const*, float, float)
+
+INSTANTIATE_ROCBLAS_NRM2_SINGLE_PASS_TEMPLATE(ROCBLAS_NRM2_NB, rocblas_double_complex const*, double, double)
+INSTANTIATE_ROCBLAS_NRM2_SINGLE_PASS_TEMPLATE(ROCBLAS_NRM2_NB, rocblas_double_complex const* const*, double, double)
+
+INSTANTIATE_ROCBLAS_NRM2_SINGLE_PASS_TEMPLATE(ROCBLAS_NRM2_NB, _Float16 const*, float, _Float16)
+INSTANTIATE_ROCBLAS_NRM2_SINGLE_PASS_TEMPLATE(ROCBLAS_NRM2_NB, _Float16 const* const*, float, _Float16)
+
+INSTANTIATE_ROCBLAS_NRM2_SINGLE_PASS_TEMPLATE(ROCBLAS_NRM2_NB, rocblas_bfloat16 const*, float, rocblas_bfloat16)
+INSTANTIATE_ROCBLAS_NRM2_SINGLE_PASS_TEMPLATE(ROCBLAS_NRM2_NB, rocblas_bfloat16 const* const*, float, rocblas_bfloat16)
+
+#undef INSTANTIATE_ROCBLAS_NRM2_SINGLE_PASS_TEMPLATE
+
+// clang-format on
@@ -0,0 +1,666 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_block_sizes.h"
+#include "rocblas_reduction.hpp"
+#include "utility.hpp"
+
+/*
+ * ===========================================================================
+ *    Planar complex level 1: the real and imaginary parts of the complex
+ *    vectors x and y are held in separate real arrays with the same increment
+ *    and stride, and the scalars are complex.
+ *    axpy: y := alpha * x + y
+ *    scal: x := alpha * x
+ *    dotu: result = sum_i x[i] * y[i], dotc conjugating x
+ *    One thread per element, and one grid row per batch. The dot products are
+ *    reduced per block, and the block sums by a second kernel, in a fixed order.
+ * ===========================================================================
+ */
+
+namespace
+{
+    constexpr rocblas_int NB     = ROCBLAS_AXPY_NB;
+    constexpr rocblas_int DOT_NB = ROCBLAS_DOT_NB;
+
+    // Shift of a vector of n elements with a negative increment so that element i is at i * inc
+    inline rocblas_stride rocblas_planar_shift(rocblas_int n, rocblas_int inc)
+    {
+        return inc < 0 ? -rocblas_stride(inc) * (n - 1) : 0;
+    }
+
+    template <rocblas_int NB, typename Ta, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_axpy_planar_kernel(rocblas_int n,
+                               Ta          alpha_device_host,
+                               const T* __restrict__ x_real,
+                               const T* __restrict__ x_imag,
+                               rocblas_int    incx,
+                               rocblas_stride stride_x,
+                               T* __restrict__ y_real,
+                               T* __restrict__ y_imag,
+                               rocblas_int    incy,
+                               rocblas_stride stride_y)
+    {
+        auto        alpha = load_scalar(alpha_device_host);
+        rocblas_int i     = blockIdx.x * NB + threadIdx.x;
+        if(!alpha || i >= n)
+            return;
+
+        int64_t ix = i * int64_t(incx) + blockIdx.y * stride_x;
+        int64_t iy = i * int64_t(incy) + blockIdx.y * stride_y;
+
+        T xr = x_real[ix], xi = x_imag[ix];
+        y_real[iy] += alpha.real() * xr - alpha.imag() * xi;
+        y_imag[iy] += alpha.real() * xi + alpha.imag() * xr;
+    }
+
+    template <rocblas_int NB, typename Ta, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_scal_planar_kernel(rocblas_int n,
+                               Ta          alpha_device_host,
+                               T* __restrict__ x_real,
+                               T* __restrict__ x_imag,
+                               rocblas_int    incx,
+                               rocblas_stride stride_x)
+    {
+        auto        alpha = load_scalar(alpha_device_host);
+        rocblas_int i     = blockIdx.x * NB + threadIdx.x;
+        if(i >= n)
+            return;
+
+        int64_t ix = i * int64_t(incx) + blockIdx.y * stride_x;
+
+        T xr = x_real[ix], xi = x_imag[ix];
+        x_real[ix] = alpha.real() * xr - alpha.imag() * xi;
+        x_imag[ix] = alpha.real() * xi + alpha.imag() * xr;
+    }
+
+    // Partial sums of the products per block, written to workspace, or to out when a single
+    // block covers the vectors
+    template <rocblas_int NB, bool CONJ, typename T, typename Tc>
+    ROCBLAS_KERNEL(NB)
+    rocblas_dot_planar_kernel(rocblas_int n,
+                              const T* __restrict__ x_real,
+                              const T* __restrict__ x_imag,
+                              rocblas_int    incx,
+                              rocblas_stride stride_x,
+                              const T* __restrict__ y_real,
+                              const T* __restrict__ y_imag,
+                              rocblas_int    incy,
+                              rocblas_stride stride_y,
+                              Tc* __restrict__ workspace,
+                              Tc* __restrict__ out)
+    {
+        rocblas_int i   = blockIdx.x * NB + threadIdx.x;
+        Tc          sum = 0;
+        if(i < n)
+        {
+            int64_t ix = i * int64_t(incx) + blockIdx.y * stride_x;
+            int64_t iy = i * int64_t(incy) + blockIdx.y * stride_y;
+
+            T xr = x_real[ix], xi = CONJ ? -x_imag[ix] : x_imag[ix];
+            T yr = y_real[iy], yi = y_imag[iy];
+            sum  = Tc(xr * yr - xi * yi, xr * yi + xi * yr);
+        }
+
+        sum = rocblas_dot_block_reduce<NB>(sum);
+
+        if(threadIdx.x == 0)
+        {
+            if(gridDim.x == 1)
+                out[blockIdx.y] = sum;
+            else
+                workspace[blockIdx.x + size_t(blockIdx.y) * gridDim.x] = sum;
+        }
+    }
+
+    template <rocblas_int NB, typename Tc>
+    ROCBLAS_KERNEL(NB)
+    rocblas_dot_planar_kernel_reduce(rocblas_int n_sums,
+                                     const Tc* __restrict__ workspace,
+                                     Tc* __restrict__ out)
+    {
+        workspace += size_t(blockIdx.y) * n_sums;
+
+        Tc sum = 0;
+        for(rocblas_int i = threadIdx.x; i < n_sums; i += NB)
+            sum += workspace[i];
+
+        sum = rocblas_dot_block_reduce<NB>(sum);
+        if(threadIdx.x == 0)
+            out[blockIdx.y] = sum;
+    }
+
+    template <typename T, typename Tc>
+    rocblas_status rocblas_axpy_planar_impl(const char*    name,
+                                            rocblas_handle handle,
+                                            rocblas_int    n,
+                                            const Tc*      alpha,
+                                            const T*       x_real,
+                                            const T*       x_imag,
+                                            rocblas_int    incx,
+                                            rocblas_stride stride_x,
+                                            T*             y_real,
+                                            T*             y_imag,
+                                            rocblas_int    incy,
+                                            rocblas_stride stride_y,
+                                            rocblas_int    batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      name,
+                      n,
+                      alpha,
+                      x_real,
+                      x_imag,
+                      incx,
+                      stride_x,
+                      y_real,
+                      y_imag,
+                      incy,
+                      stride_y,
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        name,
+                        "N",
+                        n,
+                        "incx",
+                        incx,
+                        "incy",
+                        incy,
+                        "batch_count",
+                        batch_count);
+
+        // Quick return if possible.
+        if(n <= 0 || batch_count <= 0)
+            return rocblas_status_success;
+
+        if(!alpha)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host && !*alpha)
+            return rocblas_status_success;
+
+        if(!x_real || !x_imag || !y_real || !y_imag)
+            return rocblas_status_invalid_pointer;
+
+        x_real += rocblas_planar_shift(n, incx);
+        x_imag += rocblas_planar_shift(n, incx);
+        y_real += rocblas_planar_shift(n, incy);
+        y_imag += rocblas_planar_shift(n, incy);
+
+        dim3 grid((n - 1) / NB + 1, batch_count);
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            hipLaunchKernelGGL((rocblas_axpy_planar_kernel<NB>),
+                               grid,
+                               dim3(NB),
+                               0,
+                               handle->get_stream(),
+                               n,
+                               alpha,
+                               x_real,
+                               x_imag,
+                               incx,
+                               stride_x,
+                               y_real,
+                               y_imag,
+                               incy,
+                               stride_y);
+        else
+            hipLaunchKernelGGL((rocblas_axpy_planar_kernel<NB>),
+                               grid,
+                               dim3(NB),
+                               0,
+                               handle->get_stream(),
+                               n,
+                               *alpha,
+                               x_real,
+                               x_imag,
+                               incx,
+                               stride_x,
+                               y_real,
+                               y_imag,
+                               incy,
+                               stride_y);
+
+        return rocblas_status_success;
+    }
+
+    template <typename T, typename Tc>
+    rocblas_status rocblas_scal_planar_impl(const char*    name,
+                                            rocblas_handle handle,
+                                            rocblas_int    n,
+                                            const Tc*      alpha,
+                                            T*             x_real,
+                                            T*             x_imag,
+                                            rocblas_int    incx,
+                                            rocblas_stride stride_x,
+                                            rocblas_int    batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, name, n, alpha, x_real, x_imag, incx, stride_x, batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, name, "N", n, "incx", incx, "batch_count", batch_count);
+
+        // Quick return if possible, as for scal
+        if(n <= 0 || incx <= 0 || batch_count <= 0)
+            return rocblas_status_success;
+
+        if(!alpha)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host && *alpha == 1)
+            return rocblas_status_success;
+
+        if(!x_real || !x_imag)
+            return rocblas_status_invalid_pointer;
+
+        dim3 grid((n - 1) / NB + 1, batch_count);
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            hipLaunchKernelGGL((rocblas_scal_planar_kernel<NB>),
+                               grid,
+                               dim3(NB),
+                               0,
+                               handle->get_stream(),
+                               n,
+                               alpha,
+                               x_real,
+                               x_imag,
+                               incx,
+                               stride_x);
+        else
+            hipLaunchKernelGGL((rocblas_scal_planar_kernel<NB>),
+                               grid,
+                               dim3(NB),
+                               0,
+                               handle->get_stream(),
+                               n,
+                               *alpha,
+                               x_real,
+                               x_imag,
+                               incx,
+                               stride_x);
+
+        return rocblas_status_success;
+    }
+
+    template <bool CONJ, typename T, typename Tc>
+    rocblas_status rocblas_dot_planar_impl(const char*    name,
+                                           rocblas_handle handle,
+                                           rocblas_int    n,
+                                           const T*       x_real,
+                                           const T*       x_imag,
+                                           rocblas_int    incx,
+                                           rocblas_stride stride_x,
+                                           const T*       y_real,
+                                           const T*       y_imag,
+                                           rocblas_int    incy,
+                                           rocblas_stride stride_y,
+                                           rocblas_int    batch_count,
+                                           Tc*            result)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes = rocblas_reduction_kernel_workspace_size<DOT_NB, Tc>(n, batch_count);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0 || batch_count <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      name,
+                      n,
+                      x_real,
+                      x_imag,
+                      incx,
+                      stride_x,
+                      y_real,
+                      y_imag,
+                      incy,
+                      stride_y,
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        name,
+                        "N",
+                        n,
+                        "incx",
+                        incx,
+                        "incy",
+                        incy,
+                        "batch_count",
+                        batch_count);
+
+        // Quick return if possible.
+        if(batch_count <= 0)
+            return rocblas_status_success;
+
+        if(!result)
+            return rocblas_status_invalid_pointer;
+
+        if(n <= 0)
+        {
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(
+                    result, 0, sizeof(Tc) * batch_count, handle->get_stream()));
+            else
+                for(rocblas_int b = 0; b < batch_count; b++)
+                    result[b] = Tc(0);
+            return rocblas_status_success;
+        }
+
+        if(!x_real || !x_imag || !y_real || !y_imag)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        x_real += rocblas_planar_shift(n, incx);
+        x_imag += rocblas_planar_shift(n, incx);
+        y_real += rocblas_planar_shift(n, incy);
+        y_imag += rocblas_planar_shift(n, incy);
+
+        rocblas_int blocks    = rocblas_reduction_kernel_block_count(n, DOT_NB);
+        Tc*         workspace = (Tc*)w_mem;
+        Tc*         output    = result;
+        if(handle->pointer_mode != rocblas_pointer_mode_device)
+            output = workspace + size_t(batch_count) * blocks;
+
+        hipLaunchKernelGGL((rocblas_dot_planar_kernel<DOT_NB, CONJ>),
+                           dim3(blocks, batch_count),
+                           dim3(DOT_NB),
+                           0,
+                           handle->get_stream(),
+                           n,
+                           x_real,
+                           x_imag,
+                           incx,
+                           stride_x,
+                           y_real,
+                           y_imag,
+                           incy,
+                           stride_y,
+                           workspace,
+                           output);
+
+        if(blocks > 1) // if single block first kernel did all work
+            hipLaunchKernelGGL((rocblas_dot_planar_kernel_reduce<DOT_NB>),
+                               dim3(1, batch_count),
+                               dim3(DOT_NB),
+                               0,
+                               handle->get_stream(),
+                               blocks,
+                               workspace,
+                               output);
+
+        if(handle->pointer_mode != rocblas_pointer_mode_device)
+        {
+            if(handle->deferred_host_results || handle->is_graph_safe())
+                RETURN_IF_ROCBLAS_ERROR(
+                    handle->copy_results_to_host(result, output, sizeof(Tc) * batch_count));
+            else
+                RETURN_IF_HIP_ERROR(hipMemcpyAsync(result,
+                                                   output,
+                                                   sizeof(Tc) * batch_count,
+                                                   hipMemcpyDeviceToHost,
+                                                   handle->get_stream()));
+        }
+
+        return rocblas_status_success;
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_, Tc_)                                                          \
+    rocblas_status routine_name_(rocblas_handle handle,                                       \
+                                 rocblas_int    n,                                            \
+                                 const Tc_*     alpha,                                        \
+                                 const T_*      x_real,                                       \
+                                 const T_*      x_imag,                                       \
+                                 rocblas_int    incx,                                         \
+                                 T_*            y_real,                                       \
+                                 T_*            y_imag,                                       \
+                                 rocblas_int    incy)                                         \
+    try                                                                                       \
+    {                                                                                         \
+        return rocblas_axpy_planar_impl(#routine_name_,                                       \
+                                        handle,                                               \
+                                        n,                                                    \
+                                        alpha,                                                \
+                                        x_real,                                               \
+                                        x_imag,                                               \
+                                        incx,                                                 \
+                                        0,                                                    \
+                                        y_real,                                               \
+                                        y_imag,                                               \
+                                        incy,                                                 \
+                                        0,                                                    \
+                                        1);                                                   \
+    }                                                                                         \
+    catch(...)                                                                                \
+    {                                                                                         \
+        return exception_to_rocblas_status();                                                 \
+    }                                                                                         \
+                                                                                              \
+    rocblas_status routine_name_##_strided_batched(rocblas_handle handle,                     \
+                                                   rocblas_int    n,                          \
+                                                   const Tc_*     alpha,                      \
+                                                   const T_*      x_real,                     \
+                                                   const T_*      x_imag,                     \
+                                                   rocblas_int    incx,                       \
+                                                   rocblas_stride stride_x,                   \
+                                                   T_*            y_real,                     \
+                                                   T_*            y_imag,                     \
+                                                   rocblas_int    incy,                       \
+                                                   rocblas_stride stride_y,                   \
+                                                   rocblas_int    batch_count)                \
+    try                                                                                       \
+    {                                                                                         \
+        return rocblas_axpy_planar_impl(#routine_name_ "_strided_batched",                    \
+                                        handle,                                               \
+                                        n,                                                    \
+                                        alpha,                                                \
+                                        x_real,                                               \
+                                        x_imag,                                               \
+                                        incx,                                                 \
+                                        stride_x,                                             \
+                                        y_real,                                               \
+                                        y_imag,                                               \
+                                        incy,                                                 \
+                                        stride_y,                                             \
+                                        batch_count);                                         \
+    }                                                                                         \
+    catch(...)                                                                                \
+    {                                                                                         \
+        return exception_to_rocblas_status();                                                 \
+    }
+
+IMPL(rocblas_caxpy_planar, float, rocblas_float_complex);
+IMPL(rocblas_zaxpy_planar, double, rocblas_double_complex);
+
+#undef IMPL
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_, Tc_)                                                          \
+    rocblas_status routine_name_(rocblas_handle handle,                                       \
+                                 rocblas_int    n,                                            \
+                                 const Tc_*     alpha,                                        \
+                                 T_*            x_real,                                       \
+                                 T_*            x_imag,                                       \
+                                 rocblas_int    incx)                                         \
+    try                                                                                       \
+    {                                                                                         \
+        return rocblas_scal_planar_impl(                                                      \
+            #routine_name_, handle, n, alpha, x_real, x_imag, incx, 0, 1);                    \
+    }                                                                                         \
+    catch(...)                                                                                \
+    {                                                                                         \
+        return exception_to_rocblas_status();                                                 \
+    }                                                                                         \
+                                                                                              \
+    rocblas_status routine_name_##_strided_batched(rocblas_handle handle,                     \
+                                                   rocblas_int    n,                          \
+                                                   const Tc_*     alpha,                      \
+                                                   T_*            x_real,                     \
+                                                   T_*            x_imag,                     \
+                                                   rocblas_int    incx,                       \
+                                                   rocblas_stride stride_x,                   \
+                                                   rocblas_int    batch_count)                \
+    try                                                                                       \
+    {                                                                                         \
+        return rocblas_scal_planar_impl(#routine_name_ "_strided_batched",                    \
+                                        handle,                                               \
+                                        n,                                                    \
+                                        alpha,                                                \
+                                        x_real,                                               \
+                                        x_imag,                                               \
+                                        incx,                                                 \
+                                        stride_x,                                             \
+                                        batch_count);                                         \
+    }                                                                                         \
+    catch(...)                                                                                \
+    {                                                                                         \
+        return exception_to_rocblas_status();                                                 \
+    }
+
+IMPL(rocblas_cscal_planar, float, rocblas_float_complex);
+IMPL(rocblas_zscal_planar, double, rocblas_double_complex);
+
+#undef IMPL
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, CONJ_, T_, Tc_)                                                   \
+    rocblas_status routine_name_(rocblas_handle handle,                                       \
+                                 rocblas_int    n,                                            \
+                                 const T_*      x_real,                                       \
+                                 const T_*      x_imag,                                       \
+                                 rocblas_int    incx,                                         \
+                                 const T_*      y_real,                                       \
+                                 const T_*      y_imag,                                       \
+                                 rocblas_int    incy,                                         \
+                                 Tc_*           result)                                       \
+    try                                                                                       \
+    {                                                                                         \
+        return rocblas_dot_planar_impl<CONJ_>(#routine_name_,                                 \
+                                              handle,                                         \
+                                              n,                                              \
+                                              x_real,                                         \
+                                              x_imag,                                         \
+                                              incx,                                           \
+                                              0,                                              \
+                                              y_real,                                         \
+                                              y_imag,                                         \
+                                              incy,                                           \
+                                              0,                                              \
+                                              1,                                              \
+                                              result);                                        \
+    }                                                                                         \
+    catch(...)                                                                                \
+    {                                                                                         \
+        return exception_to_rocblas_status();                                                 \
+    }                                                                                         \
+                                                                                              \
+    rocblas_status routine_name_##_strided_batched(rocblas_handle handle,                     \
+                                                   rocblas_int    n,                          \
+                                                   const T_*      x_real,                     \
+                                                   const T_*      x_imag,                     \
+                                                   rocblas_int    incx,                       \
+                                                   rocblas_stride stride_x,                   \
+                                                   const T_*      y_real,                     \
+                                                   const T_*      y_imag,                     \
+                                                   rocblas_int    incy,                       \
+                                                   rocblas_stride stride_y,                   \
+                                                   rocblas_int    batch_count,                \
+                                                   Tc_*           result)                     \
+    try                                                                                       \
+    {                                                                                         \
+        return rocblas_dot_planar_impl<CONJ_>(#routine_name_ "_strided_batched",              \
+                                              handle,                                         \
+                                              n,                                              \
+                                              x_real,                                         \
+                                              x_imag,                                         \
+                                              incx,                                           \
+                                              stride_x,                                       \
+                                              y_real,                                         \
+                                              y_imag,                                         \
+                                              incy,                                           \
+                                              stride_y,                                       \
+                                              batch_count,                                    \
+                                              result);                                        \
+    }                                                                                         \
+    catch(...)                                                                                \
+    {                                                                                         \
+        return exception_to_rocblas_status();                                                 \
+    }
+
+IMPL(rocblas_cdotu_planar, false, float, rocblas_float_complex);
+IMPL(rocblas_zdotu_planar, false, double, rocblas_double_complex);
+IMPL(rocblas_cdotc_planar, true, float, rocblas_float_complex);
+IMPL(rocblas_zdotc_planar, true, double, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
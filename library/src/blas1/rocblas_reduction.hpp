@@ -144,6 +144,130 @@ __inline__ __device__ T rocblas_dot_block_reduce(T val)
     return val;
 }
 
+/*
+ * ===========================================================================
+ *    Compensated summation, used when the handle is in compensated summation mode
+ * ===========================================================================
+ */
+
+// A sum is kept as a pair whose err holds the rounding errors of the additions made to sum, as
+// given exactly by two_sum (Knuth). Adding the pairs of two threads is the pairwise step of the
+// block reduction, sums of pairs across blocks are Neumaier's; the final rounding of sum + err
+// is then correct to about 2 ulps whatever the number of terms, without a wider type.
+// The operations of complex types are componentwise, so the same code applies to them.
+
+//! @brief Types of the compensated reductions; other types use the default summation.
+template <typename T>
+constexpr bool rocblas_is_compensated_type
+    = std::is_same<T, float>{} || std::is_same<T, double>{}
+      || std::is_same<T, rocblas_float_complex>{} || std::is_same<T, rocblas_double_complex>{};
+
+template <typename T>
+struct rocblas_compensated
+{
+    T sum;
+    T err;
+};
+
+//! @brief s + e = a + b exactly, with s the rounded sum.
+template <typename T>
+__device__ __host__ inline void rocblas_two_sum(T a, T b, T& s, T& e)
+{
+    s         = a + b;
+    T b_round = s - a;
+    e         = (a - (s - b_round)) + (b - b_round);
+}
+
+template <typename T>
+__device__ __host__ inline void rocblas_compensated_add(rocblas_compensated<T>& acc, T val)
+{
+    T sum, err;
+    rocblas_two_sum(acc.sum, val, sum, err);
+    acc.sum = sum;
+    acc.err += err;
+}
+
+template <typename T>
+__device__ __host__ inline void rocblas_compensated_add(rocblas_compensated<T>&       acc,
+                                                        const rocblas_compensated<T>& val)
+{
+    rocblas_compensated_add(acc, val.sum);
+    acc.err += val.err;
+}
+
+//! @brief Adds a * b to acc, with the rounding error of the real product given exactly by an FMA.
+template <typename T>
+__device__ inline void rocblas_compensated_add_product(rocblas_compensated<T>& acc, T a, T b)
+{
+    if constexpr(rocblas_is_complex<T>)
+    {
+        rocblas_compensated_add(acc, a * b);
+    }
+    else
+    {
+        T prod = a * b;
+        rocblas_compensated_add(acc, prod);
+        acc.err += fma(a, b, -prod);
+    }
+}
+
+template <typename T>
+__device__ inline T rocblas_compensated_shfl_down(T val, int offset)
+{
+    if constexpr(rocblas_is_complex<T>)
+        return T(__shfl_down(val.real(), offset), __shfl_down(val.imag(), offset));
+    else
+        return __shfl_down(val, offset);
+}
+
+template <int N, typename T>
+__inline__ __device__ rocblas_compensated<T>
+    rocblas_compensated_wavefront_reduce(rocblas_compensated<T> val)
+{
+    constexpr int WFBITS = rocblas_log2ui(N);
+    int           offset = 1 << (WFBITS - 1);
+    for(int i = 0; i < WFBITS; i++)
+    {
+        rocblas_compensated<T> other;
+        other.sum = rocblas_compensated_shfl_down(val.sum, offset);
+        other.err = rocblas_compensated_shfl_down(val.err, offset);
+        rocblas_compensated_add(val, other);
+        offset >>= 1;
+    }
+    return val;
+}
+
+//! @brief Compensated sum of val over the NB threads of the block, valid in thread 0.
+template <rocblas_int NB, typename T>
+__inline__ __device__ rocblas_compensated<T>
+    rocblas_compensated_block_reduce(rocblas_compensated<T> val)
+{
+    __shared__ T psums[warpSize];
+    __shared__ T perrs[warpSize];
+
+    rocblas_int wavefront = threadIdx.x / warpSize;
+    rocblas_int wavelet   = threadIdx.x % warpSize;
+
+    val = rocblas_compensated_wavefront_reduce<warpSize>(val);
+    if(wavelet == 0)
+    {
+        psums[wavefront] = val.sum;
+        perrs[wavefront] = val.err;
+    }
+
+    __syncthreads();
+
+    static constexpr rocblas_int num_wavefronts = NB / warpSize;
+    if(wavefront == 0)
+    {
+        val.sum = threadIdx.x < num_wavefronts ? psums[wavelet] : T(0);
+        val.err = threadIdx.x < num_wavefronts ? perrs[wavelet] : T(0);
+        val     = rocblas_compensated_wavefront_reduce<num_wavefronts>(val);
+    }
+
+    return val;
+}
+
 inline size_t rocblas_reduction_kernel_block_count(rocblas_int n, rocblas_int NB)
 {
     if(n <= 0)
@@ -23,6 +23,7 @@
 #include "../blas1/rocblas_asum.hpp"
 #include "../blas1/rocblas_nrm2.hpp"
 #include "../blas1/rocblas_reduction.hpp"
+#include "../blas1/rocblas_reproducible.hpp"
 #include "rocblas_block_sizes.h"
 
 /*
@@ -131,6 +132,48 @@ rocblas_reduction_kernel_part2(rocblas_int nblocks, To* workspace, Tr* result)
         result[blockIdx.y] = Tr(FINALIZE{}(sum));
 }
 
+// Compensated kernels 1 and 2 of the handle's compensated summation mode, with the same
+// workspace as the default ones: each block sum is rounded once when it is written.
+template <rocblas_int NB, typename FETCH, typename TPtrX, typename To>
+ROCBLAS_KERNEL(NB)
+rocblas_reduction_compensated_kernel_part1(rocblas_int    n,
+                                           rocblas_int    nblocks,
+                                           TPtrX          xvec,
+                                           rocblas_stride shiftx,
+                                           rocblas_int    incx,
+                                           rocblas_stride stridex,
+                                           To*            workspace)
+{
+    ptrdiff_t               tid = blockIdx.x * blockDim.x + threadIdx.x;
+    rocblas_compensated<To> sum{To(0), To(0)};
+
+    const auto* x = load_ptr_batch(xvec, blockIdx.y, shiftx, stridex);
+
+    if(tid < n)
+        sum.sum = FETCH{}(x[tid * incx]);
+
+    sum = rocblas_compensated_block_reduce<NB>(sum);
+
+    if(threadIdx.x == 0)
+        workspace[blockIdx.y * nblocks + blockIdx.x] = sum.sum + sum.err;
+}
+
+template <rocblas_int NB, typename FINALIZE, typename To, typename Tr>
+ROCBLAS_KERNEL(NB)
+rocblas_reduction_compensated_kernel_part2(rocblas_int nblocks, To* workspace, Tr* result)
+{
+    rocblas_compensated<To> sum{To(0), To(0)};
+
+    const To* work = workspace + blockIdx.y * nblocks;
+    for(rocblas_int i = threadIdx.x; i < nblocks; i += NB)
+        rocblas_compensated_add(sum, work[i]);
+
+    sum = rocblas_compensated_block_reduce<NB>(sum);
+
+    if(threadIdx.x == 0)
+        result[blockIdx.y] = Tr(FINALIZE{}(sum.sum + sum.err));
+}
+
 /*! \brief
 
     \details
@@ -187,8 +230,73 @@ rocblas_status rocblas_reduction_template(rocblas_handle handle,
 {
     // param REDUCE is always SUM for these kernels so not passed on
 
+    if(handle->reproducible)
+    {
+        // the reductions are asum, and nrm2 whose FINALIZE is the square root
+        static constexpr bool NRM2 = std::is_same<FINALIZE, rocblas_finalize_nrm2>{};
+
+        Tr* output = result;
+        if(handle->pointer_mode != rocblas_pointer_mode_device)
+            output = (Tr*)workspace;
+
+        hipLaunchKernelGGL((rocblas_reproducible_asum_nrm2_kernel<ROCBLAS_REPRODUCIBLE_NB, NRM2, To>),
+                           dim3(1, batch_count),
+                           dim3(ROCBLAS_REPRODUCIBLE_NB),
+                           0,
+                           handle->get_stream(),
+                           n,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           output);
+
+        if(handle->pointer_mode != rocblas_pointer_mode_device)
+            RETURN_IF_ROCBLAS_ERROR(
+                handle->copy_results_to_host(result, output, batch_count * sizeof(Tr)));
+        return rocblas_status_success;
+    }
+
     rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB);
 
+    if constexpr(rocblas_is_compensated_type<To>)
+    {
+        if(handle->compensated_summation)
+        {
+            hipLaunchKernelGGL((rocblas_reduction_compensated_kernel_part1<NB, FETCH>),
+                               dim3(blocks, batch_count),
+                               NB,
+                               0,
+                               handle->get_stream(),
+                               n,
+                               blocks,
+                               x,
+                               shiftx,
+                               incx,
+                               stridex,
+                               workspace);
+
+            // The results follow the block sums in workspace in host pointer mode
+            Tr* output = result;
+            if(handle->pointer_mode != rocblas_pointer_mode_device)
+                output = (Tr*)(workspace + size_t(batch_count) * blocks);
+
+            hipLaunchKernelGGL((rocblas_reduction_compensated_kernel_part2<NB, FINALIZE>),
+                               dim3(1, batch_count),
+                               NB,
+                               0,
+                               handle->get_stream(),
+                               blocks,
+                               workspace,
+                               output);
+
+            if(handle->pointer_mode != rocblas_pointer_mode_device)
+                RETURN_IF_ROCBLAS_ERROR(
+                    handle->copy_results_to_host(result, output, batch_count * sizeof(Tr)));
+            return rocblas_status_success;
+        }
+    }
+
     hipLaunchKernelGGL((rocblas_reduction_kernel_part1<NB, FETCH>),
                        dim3(blocks, batch_count),
                        NB,
@@ -220,7 +328,12 @@ rocblas_status rocblas_reduction_template(rocblas_handle handle,
         // it must be a standard layout type and its first member must be of type Tr.
         static_assert(std::is_standard_layout<To>{}, "To must be a standard layout type");
 
-        bool reduceKernel = blocks > 1 || batch_count > 1;
+        // Deferred host results, and host results in graph safe mode, are finalized on the
+        // device, so that the copy to the host does not have to be waited for
+        bool reduceKernel
+            = blocks > 1 || batch_count > 1
+              || ((handle->deferred_host_results || handle->is_graph_safe())
+                  && !std::is_same<FINALIZE, rocblas_finalize_identity>{});
         if(reduceKernel)
         {
             hipLaunchKernelGGL((rocblas_reduction_kernel_part2<NB, FINALIZE>),
@@ -238,8 +351,8 @@ rocblas_status rocblas_reduction_template(rocblas_handle handle,
             // If FINALIZE is trivial or kernel part2 was called, result is in the
             // beginning of workspace[0]+offset, and can be copied directly.
             size_t offset = reduceKernel ? size_t(batch_count) * blocks : 0;
-            RETURN_IF_HIP_ERROR(hipMemcpy(
-                result, workspace + offset, batch_count * sizeof(Tr), hipMemcpyDeviceToHost));
+            RETURN_IF_ROCBLAS_ERROR(handle->copy_results_to_host(
+                result, workspace + offset, batch_count * sizeof(Tr)));
         }
         else
         {
@@ -187,7 +187,7 @@ inline rocblas_status rocblas_reduction_setup(rocblas_handle handle,
         }
     }
 
-    auto layer_mode = handle->layer_mode;
+    auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
     if(layer_mode & rocblas_layer_mode_log_trace)
     {
         rocblas_reduction_log_trace<ISBATCHED>(handle, n, x, incx, stridex, batch_count, name);
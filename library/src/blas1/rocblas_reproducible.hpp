@@ -0,0 +1,305 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * ===========================================================================
+ *    Reproducible reductions, used instead of the tuned reduction kernels when
+ *    the handle is in reproducible mode
+ * ===========================================================================
+ */
+
+// The tuned reductions sum in an order which depends on the block size, the number of blocks,
+// the wavefront size and, for nrm2, on the order in which atomics complete, so their results
+// may differ in the last bits from one device to another. The reproducible reductions use
+// pre-rounded summation: each term is split, in double, into ROCBLAS_REPRODUCIBLE_FOLDS parts
+// which are multiples of fixed powers of two derived from the maximum term and the number of
+// terms, so that the sums of the parts are exact and do not depend on the order of the
+// additions. The result only depends on the terms, and is the same for any launch
+// configuration, device or run.
+//
+// Each vector is reduced by one block of ROCBLAS_REPRODUCIBLE_NB threads, which reads it
+// twice, once for the maximum term and once for the sum.
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas.h"
+#include <cfloat>
+
+constexpr rocblas_int ROCBLAS_REPRODUCIBLE_NB = 256;
+
+// Number of parts each term is split into; the sum is accurate to about
+// ROCBLAS_REPRODUCIBLE_FOLDS * (53 - log2(terms)) bits below the maximum term
+constexpr int ROCBLAS_REPRODUCIBLE_FOLDS = 3;
+
+// Exponent of the first part of the scaled terms, below the overflow threshold of double
+constexpr int ROCBLAS_REPRODUCIBLE_EMAX = 1020;
+
+enum : int
+{
+    rocblas_reproducible_nan     = 1,
+    rocblas_reproducible_pos_inf = 2,
+    rocblas_reproducible_neg_inf = 4,
+};
+
+//! @brief Reduction of v over the NB threads of the block with op, a shared memory tree.
+template <rocblas_int NB, typename OP>
+__device__ double rocblas_reproducible_block_reduce(double v, double* shared, OP op)
+{
+    shared[threadIdx.x] = v;
+    __syncthreads();
+    for(rocblas_int k = NB / 2; k > 0; k /= 2)
+    {
+        if(threadIdx.x < k)
+            shared[threadIdx.x] = op(shared[threadIdx.x], shared[threadIdx.x + k]);
+        __syncthreads();
+    }
+    double r = shared[0];
+    __syncthreads();
+    return r;
+}
+
+//! @brief Reproducible sums of R components of the n items of a vector, over the NB threads
+//!        of the block.
+//!
+//! term(i, t) writes the P terms t[r][0..P-1] of item i for each component r, in double; the
+//! terms must be computed without fused multiply-add so that they are the same on every
+//! device. sum[r] is the sum of the n * P terms of component r, the same in every thread,
+//! NaN if a term is NaN or if terms are both +inf and -inf, and +-inf if a term is +-inf.
+template <rocblas_int NB, int R, int P, typename F>
+__device__ void rocblas_reproducible_block_sum(int64_t n, F term, double (&sum)[R])
+{
+#pragma clang fp contract(off)
+    constexpr int K = ROCBLAS_REPRODUCIBLE_FOLDS;
+
+    __shared__ double shared[NB];
+
+    double t[R][P];
+    double amax[R];
+    int    flags[R];
+    for(int r = 0; r < R; r++)
+    {
+        amax[r]  = 0;
+        flags[r] = 0;
+    }
+
+    // pass 1: maximum finite term of each component, and its non-finite terms
+    for(int64_t i = threadIdx.x; i < n; i += NB)
+    {
+        term(i, t);
+        for(int r = 0; r < R; r++)
+            for(int p = 0; p < P; p++)
+            {
+                double a = fabs(t[r][p]);
+                if(a <= DBL_MAX)
+                    amax[r] = a > amax[r] ? a : amax[r];
+                else if(a != a)
+                    flags[r] |= rocblas_reproducible_nan;
+                else
+                    flags[r] |= t[r][p] > 0 ? rocblas_reproducible_pos_inf
+                                            : rocblas_reproducible_neg_inf;
+            }
+    }
+
+    for(int r = 0; r < R; r++)
+    {
+        amax[r]  = rocblas_reproducible_block_reduce<NB>(
+            amax[r], shared, [](double a, double b) { return a > b ? a : b; });
+        flags[r] = int(rocblas_reproducible_block_reduce<NB>(
+            double(flags[r]), shared, [](double a, double b) { return double(int(a) | int(b)); }));
+    }
+
+    // n * P terms of magnitude below 2^e sum to less than 2^(e + c); with the first part a
+    // multiple of 2^(EMAX - 52) and the terms scaled below 2^(EMAX - c), the partial sums of the
+    // parts are multiples of their ulp below 2^(EMAX + 1), and so are exact
+    int c = 1;
+    while((int64_t(1) << c) < n * P)
+        c++;
+
+    double fold[K];
+    for(int l = 0; l < K; l++)
+        fold[l] = ldexp(1.5, ROCBLAS_REPRODUCIBLE_EMAX - l * (53 - c));
+
+    int  scale[R];
+    bool finite[R];
+    for(int r = 0; r < R; r++)
+    {
+        int e;
+        frexp(amax[r], &e);
+        scale[r]  = ROCBLAS_REPRODUCIBLE_EMAX - (e + c);
+        finite[r] = !flags[r] && amax[r] > 0;
+    }
+
+    // pass 2: split the scaled terms into their parts and sum the parts
+    double acc[R][K];
+    for(int r = 0; r < R; r++)
+        for(int l = 0; l < K; l++)
+            acc[r][l] = 0;
+
+    for(int64_t i = threadIdx.x; i < n; i += NB)
+    {
+        term(i, t);
+        for(int r = 0; r < R; r++)
+        {
+            if(!finite[r])
+                continue;
+            for(int p = 0; p < P; p++)
+            {
+                double x = ldexp(t[r][p], scale[r]);
+                for(int l = 0; l < K; l++)
+                {
+                    double q = (fold[l] + x) - fold[l];
+                    acc[r][l] += q;
+                    x -= q;
+                }
+            }
+        }
+    }
+
+    for(int r = 0; r < R; r++)
+    {
+        if(flags[r])
+        {
+            bool nan = (flags[r] & rocblas_reproducible_nan)
+                       || (flags[r] & rocblas_reproducible_pos_inf
+                           && flags[r] & rocblas_reproducible_neg_inf);
+            sum[r]   = nan ? __builtin_nan("")
+                           : (flags[r] & rocblas_reproducible_pos_inf ? __builtin_inf()
+                                                                        : -__builtin_inf());
+        }
+        else if(!finite[r])
+        {
+            sum[r] = 0;
+        }
+        else
+        {
+            for(int l = 0; l < K; l++)
+                acc[r][l] = rocblas_reproducible_block_reduce<NB>(
+                    acc[r][l], shared, [](double a, double b) { return a + b; });
+
+            double s = acc[r][0];
+            for(int l = 1; l < K; l++)
+                s += acc[r][l];
+            sum[r] = ldexp(s, -scale[r]);
+        }
+    }
+}
+
+//! @brief Reproducible dot product of the n elements a(i) and b(i) of type T, over the NB
+//!        threads of the block. The real products are computed in double, and the result is
+//!        rounded to the compute type V before its conversion to T.
+template <rocblas_int NB, typename V, typename T, typename FA, typename FB>
+__device__ T rocblas_reproducible_block_dot(int64_t n, FA a, FB b)
+{
+#pragma clang fp contract(off)
+    if constexpr(rocblas_is_complex<T>)
+    {
+        // re = ar * br - ai * bi and im = ar * bi + ai * br, two terms for each component
+        double sum[2];
+        rocblas_reproducible_block_sum<NB, 2, 2>(
+            n,
+            [=](int64_t i, double(&t)[2][2]) {
+                T      ai = a(i);
+                T      bi = b(i);
+                double ar = std::real(ai), aim = std::imag(ai);
+                double br = std::real(bi), bim = std::imag(bi);
+                t[0][0]   = ar * br;
+                t[0][1]   = -(aim * bim);
+                t[1][0]   = ar * bim;
+                t[1][1]   = aim * br;
+            },
+            sum);
+        return T(real_t<T>(sum[0]), real_t<T>(sum[1]));
+    }
+    else
+    {
+        double sum[1];
+        rocblas_reproducible_block_sum<NB, 1, 1>(
+            n,
+            [=](int64_t i, double(&t)[1][1]) { t[0][0] = double(V(a(i))) * double(V(b(i))); },
+            sum);
+        return T(V(sum[0]));
+    }
+}
+
+//! @brief Reproducible dot product of x and y, conj(x) if CONJ, one block per batch.
+template <rocblas_int NB, bool CONJ, typename V, typename T, typename U>
+ROCBLAS_KERNEL(NB)
+rocblas_reproducible_dot_kernel(rocblas_int    n,
+                                const U __restrict__ xa,
+                                rocblas_stride shiftx,
+                                rocblas_int    incx,
+                                rocblas_stride stridex,
+                                const U __restrict__ ya,
+                                rocblas_stride shifty,
+                                rocblas_int    incy,
+                                rocblas_stride stridey,
+                                T* __restrict__ out)
+{
+    const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+    const auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    T sum = rocblas_reproducible_block_dot<NB, V, T>(
+        n,
+        [=](int64_t i) { return conj_if_true<CONJ>(T(x[i * incx])); },
+        [=](int64_t i) { return T(y[i * incy]); });
+
+    if(threadIdx.x == 0)
+        out[blockIdx.y] = sum;
+}
+
+//! @brief Reproducible sum of |x_i|, or of |x_i|^2 followed by a square root if NRM2, one block
+//!        per batch. The result is rounded to To before its conversion to Tr.
+template <rocblas_int NB, bool NRM2, typename To, typename TPtrX, typename Tr>
+ROCBLAS_KERNEL(NB)
+rocblas_reproducible_asum_nrm2_kernel(rocblas_int    n,
+                                      TPtrX          xa,
+                                      rocblas_stride shiftx,
+                                      rocblas_int    incx,
+                                      rocblas_stride stridex,
+                                      Tr* __restrict__ out)
+{
+#pragma clang fp contract(off)
+    const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+    using Ti      = std::remove_cv_t<std::remove_reference_t<decltype(*x)>>;
+
+    auto fetch = [](double v) { return NRM2 ? v * v : fabs(v); };
+
+    double sum[1];
+    if constexpr(rocblas_is_complex<Ti>)
+        rocblas_reproducible_block_sum<NB, 1, 2>(
+            n,
+            [=](int64_t i, double(&t)[1][2]) {
+                Ti xi   = x[i * incx];
+                t[0][0] = fetch(std::real(xi));
+                t[0][1] = fetch(std::imag(xi));
+            },
+            sum);
+    else
+        rocblas_reproducible_block_sum<NB, 1, 1>(
+            n,
+            [=](int64_t i, double(&t)[1][1]) { t[0][0] = fetch(double(To(x[i * incx]))); },
+            sum);
+
+    if(threadIdx.x == 0)
+        out[blockIdx.y] = Tr(To(NRM2 ? sqrt(sum[0]) : sum[0]));
+}
@@ -0,0 +1,382 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "check_numerics_matrix.hpp"
+#include "check_numerics_vector.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_block_sizes.h"
+#include "utility.hpp"
+
+/*
+ * ===========================================================================
+ *    Sequences of plane rotations applied in one pass:
+ *    rot_sequence: k rotations (c_j, s_j) applied in order to the same pair of
+ *                  vectors x and y, each thread keeping its x_i and y_i in
+ *                  registers for all of them.
+ *    rot_sweep:    the n - 1 rotations (c_j, s_j) applied in order to the
+ *                  adjacent columns j and j + 1 of an m x n matrix A, as in a
+ *                  QR sweep; each thread carries column j of its row in a
+ *                  register to the next rotation, so that A is read and
+ *                  written once.
+ *    The rotations are staged through LDS NB at a time.
+ * ===========================================================================
+ */
+
+namespace
+{
+    constexpr rocblas_int NB = ROCBLAS_ROT_NB;
+
+    template <typename T, typename U>
+    constexpr char rocblas_rot_sequence_name[] = "unknown";
+    template <>
+    constexpr char rocblas_rot_sequence_name<float, float>[] = "rocblas_srot_sequence";
+    template <>
+    constexpr char rocblas_rot_sequence_name<double, double>[] = "rocblas_drot_sequence";
+    template <>
+    constexpr char rocblas_rot_sequence_name<rocblas_float_complex, float>[]
+        = "rocblas_csrot_sequence";
+    template <>
+    constexpr char rocblas_rot_sequence_name<rocblas_double_complex, double>[]
+        = "rocblas_zdrot_sequence";
+
+    template <typename T, typename U>
+    constexpr char rocblas_rot_sweep_name[] = "unknown";
+    template <>
+    constexpr char rocblas_rot_sweep_name<float, float>[] = "rocblas_srot_sweep";
+    template <>
+    constexpr char rocblas_rot_sweep_name<double, double>[] = "rocblas_drot_sweep";
+    template <>
+    constexpr char rocblas_rot_sweep_name<rocblas_float_complex, float>[] = "rocblas_csrot_sweep";
+    template <>
+    constexpr char rocblas_rot_sweep_name<rocblas_double_complex, double>[]
+        = "rocblas_zdrot_sweep";
+
+    // (x, y) := (c * x + s * y, c * y - s * x), as in rot with a real s
+    template <typename T, typename U>
+    __device__ __forceinline__ void rocblas_rot_sequence_apply(U c, U s, T& x, T& y)
+    {
+        T tx = c * x + s * y;
+        y    = c * y - s * x;
+        x    = tx;
+    }
+
+    template <rocblas_int NB, typename T, typename U>
+    ROCBLAS_KERNEL(NB)
+    rocblas_rot_sequence_kernel(rocblas_int n,
+                                rocblas_int k,
+                                T*          x,
+                                rocblas_int incx,
+                                T*          y,
+                                rocblas_int incy,
+                                const U* __restrict__ c,
+                                const U* __restrict__ s)
+    {
+        __shared__ U sc[NB];
+        __shared__ U ss[NB];
+
+        ptrdiff_t tid = ptrdiff_t(blockIdx.x) * NB + threadIdx.x;
+        T         xi{}, yi{};
+        if(tid < n)
+        {
+            xi = x[tid * incx];
+            yi = y[tid * incy];
+        }
+
+        for(rocblas_int j0 = 0; j0 < k; j0 += NB)
+        {
+            rocblas_int kc = k - j0 < NB ? k - j0 : NB;
+            if(threadIdx.x < kc)
+            {
+                sc[threadIdx.x] = c[j0 + threadIdx.x];
+                ss[threadIdx.x] = s[j0 + threadIdx.x];
+            }
+            __syncthreads();
+
+            for(rocblas_int j = 0; j < kc; j++)
+                rocblas_rot_sequence_apply(sc[j], ss[j], xi, yi);
+            __syncthreads();
+        }
+
+        if(tid < n)
+        {
+            x[tid * incx] = xi;
+            y[tid * incy] = yi;
+        }
+    }
+
+    // One row of A per thread, so that the accesses to each column are coalesced
+    template <rocblas_int NB, typename T, typename U>
+    ROCBLAS_KERNEL(NB)
+    rocblas_rot_sweep_kernel(rocblas_int m,
+                             rocblas_int n,
+                             T*          A,
+                             rocblas_int lda,
+                             const U* __restrict__ c,
+                             const U* __restrict__ s)
+    {
+        __shared__ U sc[NB];
+        __shared__ U ss[NB];
+
+        rocblas_int row = blockIdx.x * NB + threadIdx.x;
+        T*          a   = A + row;
+        T           aj  = row < m ? a[0] : T(0);
+
+        for(rocblas_int j0 = 0; j0 < n - 1; j0 += NB)
+        {
+            rocblas_int kc = n - 1 - j0 < NB ? n - 1 - j0 : NB;
+            if(threadIdx.x < kc)
+            {
+                sc[threadIdx.x] = c[j0 + threadIdx.x];
+                ss[threadIdx.x] = s[j0 + threadIdx.x];
+            }
+            __syncthreads();
+
+            if(row < m)
+            {
+                for(rocblas_int j = j0; j < j0 + kc; j++)
+                {
+                    T aj1 = a[size_t(lda) * (j + 1)];
+                    rocblas_rot_sequence_apply(sc[j - j0], ss[j - j0], aj, aj1);
+                    a[size_t(lda) * j] = aj;
+                    aj                 = aj1;
+                }
+            }
+            __syncthreads();
+        }
+
+        if(row < m)
+            a[size_t(lda) * (n - 1)] = aj;
+    }
+
+    // Pointer to the first element accessed with a negative increment
+    template <typename T>
+    T* rocblas_rot_sequence_shift(T* x, rocblas_int n, rocblas_int inc)
+    {
+        return inc < 0 ? x - ptrdiff_t(inc) * (n - 1) : x;
+    }
+
+    template <typename T, typename U>
+    rocblas_status rocblas_rot_sequence_impl(rocblas_handle handle,
+                                             rocblas_int    n,
+                                             rocblas_int    k,
+                                             T*             x,
+                                             rocblas_int    incx,
+                                             T*             y,
+                                             rocblas_int    incy,
+                                             const U*       c,
+                                             const U*       s)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto name           = rocblas_rot_sequence_name<T, U>;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, name, n, k, x, incx, y, incy, c, s);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, name, "N", n, "K", k, "incx", incx, "incy", incy);
+
+        if(k < 0)
+            return rocblas_status_invalid_size;
+
+        // Quick return if possible.
+        if(n <= 0 || !k)
+            return rocblas_status_success;
+
+        if(!x || !y || !c || !s)
+            return rocblas_status_invalid_pointer;
+
+        auto check_vectors = [&](bool is_input) {
+            rocblas_status status = rocblas_internal_check_numerics_vector_template(
+                name, handle, n, x, 0, incx, 0, 1, check_numerics, is_input);
+            if(status != rocblas_status_success)
+                return status;
+            return rocblas_internal_check_numerics_vector_template(
+                name, handle, n, y, 0, incy, 0, 1, check_numerics, is_input);
+        };
+
+        if(check_numerics)
+            RETURN_IF_ROCBLAS_ERROR(check_vectors(true));
+
+        hipLaunchKernelGGL((rocblas_rot_sequence_kernel<NB>),
+                           dim3((n - 1) / NB + 1),
+                           dim3(NB),
+                           0,
+                           handle->get_stream(),
+                           n,
+                           k,
+                           rocblas_rot_sequence_shift(x, n, incx),
+                           incx,
+                           rocblas_rot_sequence_shift(y, n, incy),
+                           incy,
+                           c,
+                           s);
+
+        if(check_numerics)
+            return check_vectors(false);
+        return rocblas_status_success;
+    }
+
+    template <typename T, typename U>
+    rocblas_status rocblas_rot_sweep_impl(rocblas_handle handle,
+                                          rocblas_int    m,
+                                          rocblas_int    n,
+                                          T*             A,
+                                          rocblas_int    lda,
+                                          const U*       c,
+                                          const U*       s)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto name           = rocblas_rot_sweep_name<T, U>;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, name, m, n, A, lda, c, s);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, name, "M", m, "N", n, "lda", lda);
+
+        if(m < 0 || n < 0 || lda < m || lda < 1)
+            return rocblas_status_invalid_size;
+
+        // Quick return if possible.
+        if(!m || n < 2)
+            return rocblas_status_success;
+
+        if(!A || !c || !s)
+            return rocblas_status_invalid_pointer;
+
+        auto check_matrix = [&](bool is_input) {
+            return rocblas_internal_check_numerics_matrix_template(name,
+                                                                   handle,
+                                                                   rocblas_operation_none,
+                                                                   rocblas_fill_full,
+                                                                   rocblas_client_general_matrix,
+                                                                   m,
+                                                                   n,
+                                                                   A,
+                                                                   0,
+                                                                   lda,
+                                                                   0,
+                                                                   1,
+                                                                   check_numerics,
+                                                                   is_input);
+        };
+
+        if(check_numerics)
+            RETURN_IF_ROCBLAS_ERROR(check_matrix(true));
+
+        hipLaunchKernelGGL((rocblas_rot_sweep_kernel<NB>),
+                           dim3((m - 1) / NB + 1),
+                           dim3(NB),
+                           0,
+                           handle->get_stream(),
+                           m,
+                           n,
+                           A,
+                           lda,
+                           c,
+                           s);
+
+        if(check_numerics)
+            return check_matrix(false);
+        return rocblas_status_success;
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_, U_)                                             \
+    rocblas_status routine_name_(rocblas_handle handle,                         \
+                                 rocblas_int    n,                              \
+                                 rocblas_int    k,                              \
+                                 T_*            x,                              \
+                                 rocblas_int    incx,                           \
+                                 T_*            y,                              \
+                                 rocblas_int    incy,                           \
+                                 const U_*      c,                              \
+                                 const U_*      s)                              \
+    try                                                                         \
+    {                                                                           \
+        return rocblas_rot_sequence_impl(handle, n, k, x, incx, y, incy, c, s); \
+    }                                                                           \
+    catch(...)                                                                  \
+    {                                                                           \
+        return exception_to_rocblas_status();                                   \
+    }
+
+IMPL(rocblas_srot_sequence, float, float);
+IMPL(rocblas_drot_sequence, double, double);
+IMPL(rocblas_csrot_sequence, rocblas_float_complex, float);
+IMPL(rocblas_zdrot_sequence, rocblas_double_complex, double);
+
+#undef IMPL
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_, U_)                                \
+    rocblas_status routine_name_(rocblas_handle handle,            \
+                                 rocblas_int    m,                 \
+                                 rocblas_int    n,                 \
+                                 T_*            A,                 \
+                                 rocblas_int    lda,               \
+                                 const U_*      c,                 \
+                                 const U_*      s)                 \
+    try                                                            \
+    {                                                              \
+        return rocblas_rot_sweep_impl(handle, m, n, A, lda, c, s); \
+    }                                                              \
+    catch(...)                                                     \
+    {                                                              \
+        return exception_to_rocblas_status();                      \
+    }
+
+IMPL(rocblas_srot_sweep, float, float);
+IMPL(rocblas_drot_sweep, double, double);
+IMPL(rocblas_csrot_sweep, rocblas_float_complex, float);
+IMPL(rocblas_zdrot_sweep, rocblas_double_complex, double);
+
+#undef IMPL
+
+} // extern "C"
@@ -26,21 +26,22 @@
 #include "handle.hpp"
 #include "logging.hpp"
 
-template <typename T, typename U>
-ROCBLAS_KERNEL_NO_BOUNDS
-    rocblas_rotg_check_numerics_vector_kernel(T                         a_in,
-                                              rocblas_stride            offset_a,
-                                              rocblas_stride            stride_a,
-                                              T                         b_in,
-                                              rocblas_stride            offset_b,
-                                              rocblas_stride            stride_b,
-                                              U                         c_in,
-                                              rocblas_stride            offset_c,
-                                              rocblas_stride            stride_c,
-                                              T                         s_in,
-                                              rocblas_stride            offset_s,
-                                              rocblas_stride            stride_s,
-                                              rocblas_check_numerics_t* abnormal);
+template <rocblas_int NB, typename T, typename U>
+ROCBLAS_KERNEL(NB)
+rocblas_rotg_check_numerics_vector_kernel(T                         a_in,
+                                          rocblas_stride            offset_a,
+                                          rocblas_stride            stride_a,
+                                          T                         b_in,
+                                          rocblas_stride            offset_b,
+                                          rocblas_stride            stride_b,
+                                          U                         c_in,
+                                          rocblas_stride            offset_c,
+                                          rocblas_stride            stride_c,
+                                          T                         s_in,
+                                          rocblas_stride            offset_s,
+                                          rocblas_stride            stride_s,
+                                          rocblas_int               batch_count,
+                                          rocblas_check_numerics_t* abnormal);
 
 template <typename T, typename U>
 rocblas_status rocblas_rotg_check_numerics_template(const char*    function_name,
@@ -77,3 +78,24 @@ rocblas_status rocblas_rotg_template(rocblas_handle handle,
                                      rocblas_stride offset_s,
                                      rocblas_stride stride_s,
                                      rocblas_int    batch_count);
+
+//! @brief rotg of batch_count batches with the checks of its inputs and outputs when
+//!        check_numerics is set; in deferred mode on device memory the checks are made by the
+//!        rotg kernel itself.
+template <typename T, typename U>
+rocblas_status rocblas_rotg_checked_template(const char*    function_name,
+                                             rocblas_handle handle,
+                                             T              a_in,
+                                             rocblas_stride offset_a,
+                                             rocblas_stride stride_a,
+                                             T              b_in,
+                                             rocblas_stride offset_b,
+                                             rocblas_stride stride_b,
+                                             U              c_in,
+                                             rocblas_stride offset_c,
+                                             rocblas_stride stride_c,
+                                             T              s_in,
+                                             rocblas_stride offset_s,
+                                             rocblas_stride stride_s,
+                                             rocblas_int    batch_count,
+                                             const int      check_numerics);
@@ -23,6 +23,7 @@
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "logging.hpp"
+#include "rocblas_block_sizes.h"
 #include "rocblas_rotg.hpp"
 
 template <typename T, typename U, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
@@ -77,43 +78,76 @@ __device__ __host__ void rocblas_rotg_calc(T& a, T& b, U& c, T& s)
     }
 }
 
+//! @brief Records a zero/NaN/Inf/denormal value among a, b, c and s in abnormal.
+template <typename T, typename U>
+__device__ __host__ void rocblas_rotg_check_numerics_values(
+    const T& a, const T& b, const U& c, const T& s, rocblas_check_numerics_t* abnormal)
+{
+    if(rocblas_iszero(a) || rocblas_iszero(b) || rocblas_iszero(c) || rocblas_iszero(s))
+        abnormal->has_zero = true;
+    if(rocblas_isnan(a) || rocblas_isnan(b) || rocblas_isnan(c) || rocblas_isnan(s))
+        abnormal->has_NaN = true;
+    if(rocblas_isinf(a) || rocblas_isinf(b) || rocblas_isinf(c) || rocblas_isinf(s))
+        abnormal->has_Inf = true;
+    if(rocblas_isdenorm(a) || rocblas_isdenorm(b) || rocblas_isdenorm(c) || rocblas_isdenorm(s))
+        abnormal->has_denorm = true;
+}
+
+// One thread per batch. The inputs are checked into abnormal_in and the outputs into
+// abnormal_out when they are not null, so that a checked rotg is a single launch.
 template <rocblas_int NB, typename T, typename U>
 ROCBLAS_KERNEL(NB)
-rocblas_rotg_kernel(T              a_in,
-                    rocblas_stride offset_a,
-                    rocblas_stride stride_a,
-                    T              b_in,
-                    rocblas_stride offset_b,
-                    rocblas_stride stride_b,
-                    U              c_in,
-                    rocblas_stride offset_c,
-                    rocblas_stride stride_c,
-                    T              s_in,
-                    rocblas_stride offset_s,
-                    rocblas_stride stride_s)
+rocblas_rotg_kernel(T                         a_in,
+                    rocblas_stride            offset_a,
+                    rocblas_stride            stride_a,
+                    T                         b_in,
+                    rocblas_stride            offset_b,
+                    rocblas_stride            stride_b,
+                    U                         c_in,
+                    rocblas_stride            offset_c,
+                    rocblas_stride            stride_c,
+                    T                         s_in,
+                    rocblas_stride            offset_s,
+                    rocblas_stride            stride_s,
+                    rocblas_int               batch_count,
+                    rocblas_check_numerics_t* abnormal_in,
+                    rocblas_check_numerics_t* abnormal_out)
 {
-    auto a = load_ptr_batch(a_in, blockIdx.x, offset_a, stride_a);
-    auto b = load_ptr_batch(b_in, blockIdx.x, offset_b, stride_b);
-    auto c = load_ptr_batch(c_in, blockIdx.x, offset_c, stride_c);
-    auto s = load_ptr_batch(s_in, blockIdx.x, offset_s, stride_s);
+    rocblas_int batch = blockIdx.x * NB + threadIdx.x;
+    if(batch >= batch_count)
+        return;
+
+    auto a = load_ptr_batch(a_in, batch, offset_a, stride_a);
+    auto b = load_ptr_batch(b_in, batch, offset_b, stride_b);
+    auto c = load_ptr_batch(c_in, batch, offset_c, stride_c);
+    auto s = load_ptr_batch(s_in, batch, offset_s, stride_s);
+
+    if(abnormal_in)
+        rocblas_rotg_check_numerics_values(*a, *b, *c, *s, abnormal_in);
+
     rocblas_rotg_calc(*a, *b, *c, *s);
+
+    if(abnormal_out)
+        rocblas_rotg_check_numerics_values(*a, *b, *c, *s, abnormal_out);
 }
 
 template <typename T, typename U>
-rocblas_status rocblas_rotg_template(rocblas_handle handle,
-                                     T              a_in,
-                                     rocblas_stride offset_a,
-                                     rocblas_stride stride_a,
-                                     T              b_in,
-                                     rocblas_stride offset_b,
-                                     rocblas_stride stride_b,
-                                     U              c_in,
-                                     rocblas_stride offset_c,
-                                     rocblas_stride stride_c,
-                                     T              s_in,
-                                     rocblas_stride offset_s,
-                                     rocblas_stride stride_s,
-                                     rocblas_int    batch_count)
+rocblas_status rocblas_rotg_launcher(rocblas_handle            handle,
+                                     T                         a_in,
+                                     rocblas_stride            offset_a,
+                                     rocblas_stride            stride_a,
+                                     T                         b_in,
+                                     rocblas_stride            offset_b,
+                                     rocblas_stride            stride_b,
+                                     U                         c_in,
+                                     rocblas_stride            offset_c,
+                                     rocblas_stride            stride_c,
+                                     T                         s_in,
+                                     rocblas_stride            offset_s,
+                                     rocblas_stride            stride_s,
+                                     rocblas_int               batch_count,
+                                     rocblas_check_numerics_t* abnormal_in,
+                                     rocblas_check_numerics_t* abnormal_out)
 {
     if(!batch_count)
         return rocblas_status_success;
@@ -122,9 +156,11 @@ rocblas_status rocblas_rotg_template(rocblas_handle handle,
 
     if(rocblas_pointer_mode_device == handle->pointer_mode)
     {
-        hipLaunchKernelGGL(rocblas_rotg_kernel<1>,
-                           batch_count,
-                           1,
+        static constexpr rocblas_int NB = ROCBLAS_ROTG_NB;
+
+        hipLaunchKernelGGL(rocblas_rotg_kernel<NB>,
+                           (batch_count - 1) / NB + 1,
+                           NB,
                            0,
                            rocblas_stream,
                            a_in,
@@ -138,11 +174,14 @@ rocblas_status rocblas_rotg_template(rocblas_handle handle,
                            stride_c,
                            s_in,
                            offset_s,
-                           stride_s);
+                           stride_s,
+                           batch_count,
+                           abnormal_in,
+                           abnormal_out);
     }
     else
     {
-        // TODO: make this faster for a large number of batches.
+        // The scalars are in host memory, a device launch would need a copy each way
         for(int i = 0; i < batch_count; i++)
         {
             auto a = load_ptr_batch(a_in, i, offset_a, stride_a);
@@ -158,35 +197,67 @@ rocblas_status rocblas_rotg_template(rocblas_handle handle,
 }
 
 template <typename T, typename U>
-ROCBLAS_KERNEL_NO_BOUNDS
-    rocblas_rotg_check_numerics_vector_kernel(T                         a_in,
-                                              rocblas_stride            offset_a,
-                                              rocblas_stride            stride_a,
-                                              T                         b_in,
-                                              rocblas_stride            offset_b,
-                                              rocblas_stride            stride_b,
-                                              U                         c_in,
-                                              rocblas_stride            offset_c,
-                                              rocblas_stride            stride_c,
-                                              T                         s_in,
-                                              rocblas_stride            offset_s,
-                                              rocblas_stride            stride_s,
-                                              rocblas_check_numerics_t* abnormal)
+rocblas_status rocblas_rotg_template(rocblas_handle handle,
+                                     T              a_in,
+                                     rocblas_stride offset_a,
+                                     rocblas_stride stride_a,
+                                     T              b_in,
+                                     rocblas_stride offset_b,
+                                     rocblas_stride stride_b,
+                                     U              c_in,
+                                     rocblas_stride offset_c,
+                                     rocblas_stride stride_c,
+                                     T              s_in,
+                                     rocblas_stride offset_s,
+                                     rocblas_stride stride_s,
+                                     rocblas_int    batch_count)
+{
+    return rocblas_rotg_launcher(handle,
+                                 a_in,
+                                 offset_a,
+                                 stride_a,
+                                 b_in,
+                                 offset_b,
+                                 stride_b,
+                                 c_in,
+                                 offset_c,
+                                 stride_c,
+                                 s_in,
+                                 offset_s,
+                                 stride_s,
+                                 batch_count,
+                                 nullptr,
+                                 nullptr);
+}
+
+template <rocblas_int NB, typename T, typename U>
+ROCBLAS_KERNEL(NB)
+rocblas_rotg_check_numerics_vector_kernel(T                         a_in,
+                                          rocblas_stride            offset_a,
+                                          rocblas_stride            stride_a,
+                                          T                         b_in,
+                                          rocblas_stride            offset_b,
+                                          rocblas_stride            stride_b,
+                                          U                         c_in,
+                                          rocblas_stride            offset_c,
+                                          rocblas_stride            stride_c,
+                                          T                         s_in,
+                                          rocblas_stride            offset_s,
+                                          rocblas_stride            stride_s,
+                                          rocblas_int               batch_count,
+                                          rocblas_check_numerics_t* abnormal)
 {
-    auto a = load_ptr_batch(a_in, blockIdx.x, offset_a, stride_a);
-    auto b = load_ptr_batch(b_in, blockIdx.x, offset_b, stride_b);
-    auto c = load_ptr_batch(c_in, blockIdx.x, offset_c, stride_c);
-    auto s = load_ptr_batch(s_in, blockIdx.x, offset_s, stride_s);
+    rocblas_int batch = blockIdx.x * NB + threadIdx.x;
+    if(batch >= batch_count)
+        return;
+
+    auto a = load_ptr_batch(a_in, batch, offset_a, stride_a);
+    auto b = load_ptr_batch(b_in, batch, offset_b, stride_b);
+    auto c = load_ptr_batch(c_in, batch, offset_c, stride_c);
+    auto s = load_ptr_batch(s_in, batch, offset_s, stride_s);
 
     //Check every element of the vectors a, b, c, s for a zero/NaN/Inf/denormal value
-    if(rocblas_iszero(*a) || rocblas_iszero(*b) || rocblas_iszero(*c) || rocblas_iszero(*s))
-        abnormal->has_zero = true;
-    if(rocblas_isnan(*a) || rocblas_isnan(*b) || rocblas_isnan(*c) || rocblas_isnan(*s))
-        abnormal->has_NaN = true;
-    if(rocblas_isinf(*a) || rocblas_isinf(*b) || rocblas_isinf(*c) || rocblas_isinf(*s))
-        abnormal->has_Inf = true;
-    if(rocblas_isdenorm(*a) || rocblas_isdenorm(*b) || rocblas_isdenorm(*c) || rocblas_isdenorm(*s))
-        abnormal->has_denorm = true;
+    rocblas_rotg_check_numerics_values(*a, *b, *c, *s, abnormal);
 }
 
 template <typename T, typename U>
@@ -217,19 +288,39 @@ rocblas_status rocblas_rotg_check_numerics_template(const char*    function_name
 
     if(rocblas_pointer_mode_device == handle->pointer_mode)
     {
-        hipStream_t rocblas_stream = handle->get_stream();
+        //The results of the check are read on the host, which graph safe mode does not allow
+        if(handle->is_graph_safe())
+            return rocblas_status_not_implemented;
 
-        auto d_abnormal = handle->device_malloc(sizeof(rocblas_check_numerics_t));
+        hipStream_t               rocblas_stream = handle->get_stream();
+        rocblas_check_numerics_t* d_abnormal     = nullptr;
+        rocblas_status            status         = rocblas_status_success;
 
-        //Transferring the rocblas_check_numerics_t structure from host to the device
-        RETURN_IF_HIP_ERROR(hipMemcpy((rocblas_check_numerics_t*)d_abnormal,
-                                      &h_abnormal,
-                                      sizeof(rocblas_check_numerics_t),
-                                      hipMemcpyHostToDevice));
+        //In deferred mode the result is recorded in the handle and reported later
+        bool deferred = (check_numerics & rocblas_check_numerics_mode_deferred) != 0;
 
-        hipLaunchKernelGGL(rocblas_rotg_check_numerics_vector_kernel,
-                           batch_count,
-                           1,
+        auto w_abnormal = handle->device_malloc(deferred ? 0 : sizeof(rocblas_check_numerics_t));
+
+        if(deferred)
+        {
+            status = handle->get_deferred_check_numerics_record(
+                function_name, check_numerics, is_input, &d_abnormal);
+            if(status != rocblas_status_success && status != rocblas_status_check_numerics_fail)
+                return status;
+        }
+        else
+        {
+            //All the flags of the structure are false, it is cleared in stream order
+            d_abnormal = (rocblas_check_numerics_t*)w_abnormal;
+            RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(d_abnormal, 0, sizeof(rocblas_check_numerics_t), rocblas_stream));
+        }
+
+        static constexpr rocblas_int NB = ROCBLAS_ROTG_NB;
+
+        hipLaunchKernelGGL(rocblas_rotg_check_numerics_vector_kernel<NB>,
+                           (batch_count - 1) / NB + 1,
+                           NB,
                            0,
                            rocblas_stream,
                            a_in,
@@ -244,13 +335,18 @@ rocblas_status rocblas_rotg_check_numerics_template(const char*    function_name
                            s_in,
                            offset_s,
                            stride_s,
-                           (rocblas_check_numerics_t*)d_abnormal);
+                           batch_count,
+                           d_abnormal);
+
+        if(deferred)
+        {
+            handle->set_async_status_for_check(d_abnormal, check_numerics);
+            return status;
+        }
 
         //Transferring the rocblas_check_numerics_t structure from device to the host
-        RETURN_IF_HIP_ERROR(hipMemcpy(&h_abnormal,
-                                      (rocblas_check_numerics_t*)d_abnormal,
-                                      sizeof(rocblas_check_numerics_t),
-                                      hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            &h_abnormal, d_abnormal, sizeof(rocblas_check_numerics_t), hipMemcpyDeviceToHost));
     }
     else
     {
@@ -262,21 +358,146 @@ rocblas_status rocblas_rotg_check_numerics_template(const char*    function_name
             auto s = load_ptr_batch(s_in, i, offset_s, stride_s);
 
             //Check every element of the x vector for a NaN/zero/Inf/denormal value
-            if(rocblas_iszero(*a) || rocblas_iszero(*b) || rocblas_iszero(*c) || rocblas_iszero(*s))
-                h_abnormal.has_zero = true;
-            if(rocblas_isnan(*a) || rocblas_isnan(*b) || rocblas_isnan(*c) || rocblas_isnan(*s))
-                h_abnormal.has_NaN = true;
-            if(rocblas_isinf(*a) || rocblas_isinf(*b) || rocblas_isinf(*c) || rocblas_isinf(*s))
-                h_abnormal.has_Inf = true;
-            if(rocblas_isdenorm(*a) || rocblas_isdenorm(*b) || rocblas_isdenorm(*c)
-               || rocblas_isdenorm(*s))
-                h_abnormal.has_denorm = true;
+            rocblas_rotg_check_numerics_values(*a, *b, *c, *s, &h_abnormal);
         }
     }
     return rocblas_check_numerics_abnormal_struct(
         function_name, check_numerics, is_input, &h_abnormal);
 }
 
+template <typename T, typename U>
+rocblas_status rocblas_rotg_checked_template(const char*    function_name,
+                                             rocblas_handle handle,
+                                             T              a_in,
+                                             rocblas_stride offset_a,
+                                             rocblas_stride stride_a,
+                                             T              b_in,
+                                             rocblas_stride offset_b,
+                                             rocblas_stride stride_b,
+                                             U              c_in,
+                                             rocblas_stride offset_c,
+                                             rocblas_stride stride_c,
+                                             T              s_in,
+                                             rocblas_stride offset_s,
+                                             rocblas_stride stride_s,
+                                             rocblas_int    batch_count,
+                                             const int      check_numerics)
+{
+    // In deferred mode on device memory both checks are made by the rotg kernel itself, with
+    // the results reported later
+    bool fused = (check_numerics & rocblas_check_numerics_mode_deferred)
+                 && rocblas_pointer_mode_device == handle->pointer_mode && batch_count > 0;
+
+    if(fused)
+    {
+        //The deferred records may be reported on the host, which graph safe mode does not allow
+        if(handle->is_graph_safe())
+            return rocblas_status_not_implemented;
+
+        rocblas_check_numerics_t* d_abnormal_in  = nullptr;
+        rocblas_check_numerics_t* d_abnormal_out = nullptr;
+
+        //A failure of an earlier deferred check does not stop this rotg, as for a separate check
+        rocblas_status status = handle->get_deferred_check_numerics_record(
+            function_name, check_numerics, true, &d_abnormal_in);
+        if(status != rocblas_status_success && status != rocblas_status_check_numerics_fail)
+            return status;
+
+        rocblas_status status_out = handle->get_deferred_check_numerics_record(
+            function_name, check_numerics, false, &d_abnormal_out);
+        if(status_out != rocblas_status_success)
+        {
+            if(status_out != rocblas_status_check_numerics_fail)
+                return status_out;
+            status = status_out;
+        }
+
+        rocblas_status launch_status = rocblas_rotg_launcher(handle,
+                                                             a_in,
+                                                             offset_a,
+                                                             stride_a,
+                                                             b_in,
+                                                             offset_b,
+                                                             stride_b,
+                                                             c_in,
+                                                             offset_c,
+                                                             stride_c,
+                                                             s_in,
+                                                             offset_s,
+                                                             stride_s,
+                                                             batch_count,
+                                                             d_abnormal_in,
+                                                             d_abnormal_out);
+        if(launch_status != rocblas_status_success)
+            return launch_status;
+
+        handle->set_async_status_for_check(d_abnormal_in, check_numerics);
+        handle->set_async_status_for_check(d_abnormal_out, check_numerics);
+        return status;
+    }
+
+    rocblas_status status;
+    if(check_numerics)
+    {
+        status = rocblas_rotg_check_numerics_template(function_name,
+                                                      handle,
+                                                      1,
+                                                      a_in,
+                                                      offset_a,
+                                                      stride_a,
+                                                      b_in,
+                                                      offset_b,
+                                                      stride_b,
+                                                      c_in,
+                                                      offset_c,
+                                                      stride_c,
+                                                      s_in,
+                                                      offset_s,
+                                                      stride_s,
+                                                      batch_count,
+                                                      check_numerics,
+                                                      true);
+        if(status != rocblas_status_success)
+            return status;
+    }
+
+    status = rocblas_rotg_template(handle,
+                                   a_in,
+                                   offset_a,
+                                   stride_a,
+                                   b_in,
+                                   offset_b,
+                                   stride_b,
+                                   c_in,
+                                   offset_c,
+                                   stride_c,
+                                   s_in,
+                                   offset_s,
+                                   stride_s,
+                                   batch_count);
+    if(status != rocblas_status_success || !check_numerics)
+        return status;
+
+    return rocblas_rotg_check_numerics_template(function_name,
+                                                handle,
+                                                1,
+                                                a_in,
+                                                offset_a,
+                                                stride_a,
+                                                b_in,
+                                                offset_b,
+                                                stride_b,
+                                                c_in,
+                                                offset_c,
+                                                stride_c,
+                                                s_in,
+                                                offset_s,
+                                                stride_s,
+                                                batch_count,
+                                                check_numerics,
+                                                false);
+}
+
 // If there are any changes in template parameters in the files *rotg*.cpp
 // instantiations below will need to be manually updated to match the changes.
 
@@ -355,4 +576,41 @@ INSTANTIATE_ROTG_CHECK_NUMERICS(rocblas_double_complex* const*, double* const*)
 
 #undef INSTANTIATE_ROTG_CHECK_NUMERICS
 
+#ifdef INSTANTIATE_ROTG_CHECKED_TEMPLATE
+#error INSTANTIATE_ROTG_CHECKED_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_ROTG_CHECKED_TEMPLATE(T_, U_)                                   \
+template rocblas_status rocblas_rotg_checked_template<T_, U_>                       \
+                                                     (const char*    function_name, \
+                                                      rocblas_handle handle,        \
+                                                      T_             a_in,          \
+                                                      rocblas_stride offset_a,      \
+                                                      rocblas_stride stride_a,      \
+                                                      T_             b_in,          \
+                                                      rocblas_stride offset_b,      \
+                                                      rocblas_stride stride_b,      \
+                                                      U_             c_in,          \
+                                                      rocblas_stride offset_c,      \
+                                                      rocblas_stride stride_c,      \
+                                                      T_             s_in,          \
+                                                      rocblas_stride offset_s,      \
+                                                      rocblas_stride stride_s,      \
+                                                      rocblas_int    batch_count,   \
+                                                      const int      check_numerics);
+
+// instantiate for rocblas_Xrotg and rocblas_Xrotg_strided_batched
+INSTANTIATE_ROTG_CHECKED_TEMPLATE(float*, float*)
+INSTANTIATE_ROTG_CHECKED_TEMPLATE(double*, double*)
+INSTANTIATE_ROTG_CHECKED_TEMPLATE(rocblas_float_complex*, float*)
+INSTANTIATE_ROTG_CHECKED_TEMPLATE(rocblas_double_complex*, double*)
+
+// instantiate for rocblas_Xrotg_batched
+INSTANTIATE_ROTG_CHECKED_TEMPLATE(float* const*, float* const*)
+INSTANTIATE_ROTG_CHECKED_TEMPLATE(double* const*, double* const*)
+INSTANTIATE_ROTG_CHECKED_TEMPLATE(rocblas_float_complex* const*, float* const*)
+INSTANTIATE_ROTG_CHECKED_TEMPLATE(rocblas_double_complex* const*, double* const*)
+
+#undef INSTANTIATE_ROTG_CHECKED_TEMPLATE
+
 // clang-format off
@@ -55,7 +55,7 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
@@ -105,63 +105,22 @@ namespace
         if(!a || !b || !c || !s)
             return rocblas_status_invalid_pointer;
 
-        if(check_numerics)
-        {
-            bool           is_input = true;
-            rocblas_status rotg_check_numerics_status
-                = rocblas_rotg_check_numerics_template(rocblas_rotg_name<T>,
-                                                       handle,
-                                                       1,
-                                                       a,
-                                                       0,
-                                                       stride_a,
-                                                       b,
-                                                       0,
-                                                       stride_b,
-                                                       c,
-                                                       0,
-                                                       stride_c,
-                                                       s,
-                                                       0,
-                                                       stride_s,
-                                                       batch_count,
-                                                       check_numerics,
-                                                       is_input);
-            if(rotg_check_numerics_status != rocblas_status_success)
-                return rotg_check_numerics_status;
-        }
-
-        rocblas_status status = rocblas_rotg_template(
-            handle, a, 0, stride_a, b, 0, stride_b, c, 0, stride_c, s, 0, stride_s, batch_count);
-        if(status != rocblas_status_success)
-            return status;
-
-        if(check_numerics)
-        {
-            bool           is_input = false;
-            rocblas_status rotg_check_numerics_status
-                = rocblas_rotg_check_numerics_template(rocblas_rotg_name<T>,
-                                                       handle,
-                                                       1,
-                                                       a,
-                                                       0,
-                                                       stride_a,
-                                                       b,
-                                                       0,
-                                                       stride_b,
-                                                       c,
-                                                       0,
-                                                       stride_c,
-                                                       s,
-                                                       0,
-                                                       stride_s,
-                                                       batch_count,
-                                                       check_numerics,
-                                                       is_input);
-            if(rotg_check_numerics_status != rocblas_status_success)
-                return rotg_check_numerics_status;
-        }
-        return status;
+        return rocblas_rotg_checked_template(rocblas_rotg_name<T>,
+                                             handle,
+                                             a,
+                                             0,
+                                             stride_a,
+                                             b,
+                                             0,
+                                             stride_b,
+                                             c,
+                                             0,
+                                             stride_c,
+                                             s,
+                                             0,
+                                             stride_s,
+                                             batch_count,
+                                             check_numerics);
     }
 
 } // namespace
@@ -64,3 +64,27 @@ rocblas_status rocblas_rotmg_check_numerics_template(const char*    function_nam
                                                      rocblas_int    batch_count,
                                                      const int      check_numerics,
                                                      bool           is_input);
+
+//! @brief rotmg of batch_count batches with the checks of its inputs and outputs when
+//!        check_numerics is set; in deferred mode on device memory the checks are made by the
+//!        rotmg kernel itself.
+template <typename T, typename U>
+rocblas_status rocblas_rotmg_checked_template(const char*    function_name,
+                                              rocblas_handle handle,
+                                              T              d1_in,
+                                              rocblas_stride offset_d1,
+                                              rocblas_stride stride_d1,
+                                              T              d2_in,
+                                              rocblas_stride offset_d2,
+                                              rocblas_stride stride_d2,
+                                              T              x1_in,
+                                              rocblas_stride offset_x1,
+                                              rocblas_stride stride_x1,
+                                              U              y1_in,
+                                              rocblas_stride offset_y1,
+                                              rocblas_stride stride_y1,
+                                              T              param,
+                                              rocblas_stride offset_param,
+                                              rocblas_stride stride_param,
+                                              rocblas_int    batch_count,
+                                              const int      check_numerics);
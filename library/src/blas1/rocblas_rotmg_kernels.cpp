@@ -23,6 +23,8 @@
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "logging.hpp"
+#include "rocblas_block_sizes.h"
+#include "rocblas_rotmg.hpp"
 
 template <typename T>
 __device__ __host__ void rocblas_rotmg_calc(T& d1, T& d2, T& x1, const T& y1, T* param)
@@ -165,51 +167,83 @@ __device__ __host__ void rocblas_rotmg_calc(T& d1, T& d2, T& x1, const T& y1, T*
     param[0] = flag;
 }
 
+//! @brief Records a zero/NaN/Inf/denormal value among d1, d2, x1 and y1 in abnormal.
+template <typename T>
+__device__ __host__ void rocblas_rotmg_check_numerics_values(
+    const T& d1, const T& d2, const T& x1, const T& y1, rocblas_check_numerics_t* abnormal)
+{
+    if(rocblas_iszero(d1) || rocblas_iszero(d2) || rocblas_iszero(x1) || rocblas_iszero(y1))
+        abnormal->has_zero = true;
+    if(rocblas_isnan(d1) || rocblas_isnan(d2) || rocblas_isnan(x1) || rocblas_isnan(y1))
+        abnormal->has_NaN = true;
+    if(rocblas_isinf(d1) || rocblas_isinf(d2) || rocblas_isinf(x1) || rocblas_isinf(y1))
+        abnormal->has_Inf = true;
+    if(rocblas_isdenorm(d1) || rocblas_isdenorm(d2) || rocblas_isdenorm(x1) || rocblas_isdenorm(y1))
+        abnormal->has_denorm = true;
+}
+
+// One thread per batch. The inputs are checked into abnormal_in and the outputs into
+// abnormal_out when they are not null, so that a checked rotmg is a single launch.
 template <rocblas_int NB, typename T, typename U>
 ROCBLAS_KERNEL(NB)
-rocblas_rotmg_kernel(T              d1_in,
-                     rocblas_stride offset_d1,
-                     rocblas_stride stride_d1,
-                     T              d2_in,
-                     rocblas_stride offset_d2,
-                     rocblas_stride stride_d2,
-                     T              x1_in,
-                     rocblas_stride offset_x1,
-                     rocblas_stride stride_x1,
-                     U              y1_in,
-                     rocblas_stride offset_y1,
-                     rocblas_stride stride_y1,
-                     T              param,
-                     rocblas_stride offset_param,
-                     rocblas_stride stride_param,
-                     rocblas_int    batch_count)
+rocblas_rotmg_kernel(T                         d1_in,
+                     rocblas_stride            offset_d1,
+                     rocblas_stride            stride_d1,
+                     T                         d2_in,
+                     rocblas_stride            offset_d2,
+                     rocblas_stride            stride_d2,
+                     T                         x1_in,
+                     rocblas_stride            offset_x1,
+                     rocblas_stride            stride_x1,
+                     U                         y1_in,
+                     rocblas_stride            offset_y1,
+                     rocblas_stride            stride_y1,
+                     T                         param,
+                     rocblas_stride            offset_param,
+                     rocblas_stride            stride_param,
+                     rocblas_int               batch_count,
+                     rocblas_check_numerics_t* abnormal_in,
+                     rocblas_check_numerics_t* abnormal_out)
 {
-    auto d1 = load_ptr_batch(d1_in, blockIdx.x, offset_d1, stride_d1);
-    auto d2 = load_ptr_batch(d2_in, blockIdx.x, offset_d2, stride_d2);
-    auto x1 = load_ptr_batch(x1_in, blockIdx.x, offset_x1, stride_x1);
-    auto y1 = load_ptr_batch(y1_in, blockIdx.x, offset_y1, stride_y1);
-    auto p  = load_ptr_batch(param, blockIdx.x, offset_param, stride_param);
+    rocblas_int batch = blockIdx.x * NB + threadIdx.x;
+    if(batch >= batch_count)
+        return;
+
+    auto d1 = load_ptr_batch(d1_in, batch, offset_d1, stride_d1);
+    auto d2 = load_ptr_batch(d2_in, batch, offset_d2, stride_d2);
+    auto x1 = load_ptr_batch(x1_in, batch, offset_x1, stride_x1);
+    auto y1 = load_ptr_batch(y1_in, batch, offset_y1, stride_y1);
+    auto p  = load_ptr_batch(param, batch, offset_param, stride_param);
+
+    if(abnormal_in)
+        rocblas_rotmg_check_numerics_values(*d1, *d2, *x1, *y1, abnormal_in);
+
     rocblas_rotmg_calc(*d1, *d2, *x1, *y1, p);
+
+    if(abnormal_out)
+        rocblas_rotmg_check_numerics_values(*d1, *d2, *x1, *y1, abnormal_out);
 }
 
 template <typename T, typename U>
-rocblas_status rocblas_rotmg_template(rocblas_handle handle,
-                                      T              d1_in,
-                                      rocblas_stride offset_d1,
-                                      rocblas_stride stride_d1,
-                                      T              d2_in,
-                                      rocblas_stride offset_d2,
-                                      rocblas_stride stride_d2,
-                                      T              x1_in,
-                                      rocblas_stride offset_x1,
-                                      rocblas_stride stride_x1,
-                                      U              y1_in,
-                                      rocblas_stride offset_y1,
-                                      rocblas_stride stride_y1,
-                                      T              param,
-                                      rocblas_stride offset_param,
-                                      rocblas_stride stride_param,
-                                      rocblas_int    batch_count)
+rocblas_status rocblas_rotmg_launcher(rocblas_handle            handle,
+                                      T                         d1_in,
+                                      rocblas_stride            offset_d1,
+                                      rocblas_stride            stride_d1,
+                                      T                         d2_in,
+                                      rocblas_stride            offset_d2,
+                                      rocblas_stride            stride_d2,
+                                      T                         x1_in,
+                                      rocblas_stride            offset_x1,
+                                      rocblas_stride            stride_x1,
+                                      U                         y1_in,
+                                      rocblas_stride            offset_y1,
+                                      rocblas_stride            stride_y1,
+                                      T                         param,
+                                      rocblas_stride            offset_param,
+                                      rocblas_stride            stride_param,
+                                      rocblas_int               batch_count,
+                                      rocblas_check_numerics_t* abnormal_in,
+                                      rocblas_check_numerics_t* abnormal_out)
 {
     if(batch_count <= 0)
         return rocblas_status_success;
@@ -217,9 +251,11 @@ rocblas_status rocblas_rotmg_template(rocblas_handle handle,
     hipStream_t rocblas_stream = handle->get_stream();
     if(rocblas_pointer_mode_device == handle->pointer_mode)
     {
-        hipLaunchKernelGGL(rocblas_rotmg_kernel<1>,
-                           batch_count,
-                           1,
+        static constexpr rocblas_int NB = ROCBLAS_ROTMG_NB;
+
+        hipLaunchKernelGGL(rocblas_rotmg_kernel<NB>,
+                           (batch_count - 1) / NB + 1,
+                           NB,
                            0,
                            rocblas_stream,
                            d1_in,
@@ -237,11 +273,13 @@ rocblas_status rocblas_rotmg_template(rocblas_handle handle,
                            param,
                            offset_param,
                            stride_param,
-                           batch_count);
+                           batch_count,
+                           abnormal_in,
+                           abnormal_out);
     }
     else
     {
-        // TODO: make this faster for a large number of batches.
+        // The scalars are in host memory, a device launch would need a copy each way
         for(int i = 0; i < batch_count; i++)
         {
             auto d1 = load_ptr_batch(d1_in, i, offset_d1, stride_d1);
@@ -257,36 +295,73 @@ rocblas_status rocblas_rotmg_template(rocblas_handle handle,
 }
 
 template <typename T, typename U>
-ROCBLAS_KERNEL_NO_BOUNDS
-    rocblas_rotmg_check_numerics_vector_kernel(T                         d1_in,
-                                               rocblas_int               offset_d1,
-                                               rocblas_stride            stride_d1,
-                                               T                         d2_in,
-                                               rocblas_int               offset_d2,
-                                               rocblas_stride            stride_d2,
-                                               T                         x1_in,
-                                               rocblas_int               offset_x1,
-                                               rocblas_stride            stride_x1,
-                                               U                         y1_in,
-                                               rocblas_int               offset_y1,
-                                               rocblas_stride            stride_y1,
-                                               rocblas_check_numerics_t* abnormal)
+rocblas_status rocblas_rotmg_template(rocblas_handle handle,
+                                      T              d1_in,
+                                      rocblas_stride offset_d1,
+                                      rocblas_stride stride_d1,
+                                      T              d2_in,
+                                      rocblas_stride offset_d2,
+                                      rocblas_stride stride_d2,
+                                      T              x1_in,
+                                      rocblas_stride offset_x1,
+                                      rocblas_stride stride_x1,
+                                      U              y1_in,
+                                      rocblas_stride offset_y1,
+                                      rocblas_stride stride_y1,
+                                      T              param,
+                                      rocblas_stride offset_param,
+                                      rocblas_stride stride_param,
+                                      rocblas_int    batch_count)
 {
-    auto d1 = load_ptr_batch(d1_in, blockIdx.x, offset_d1, stride_d1);
-    auto d2 = load_ptr_batch(d2_in, blockIdx.x, offset_d2, stride_d2);
-    auto x1 = load_ptr_batch(x1_in, blockIdx.x, offset_x1, stride_x1);
-    auto y1 = load_ptr_batch(y1_in, blockIdx.x, offset_y1, stride_y1);
+    return rocblas_rotmg_launcher(handle,
+                                  d1_in,
+                                  offset_d1,
+                                  stride_d1,
+                                  d2_in,
+                                  offset_d2,
+                                  stride_d2,
+                                  x1_in,
+                                  offset_x1,
+                                  stride_x1,
+                                  y1_in,
+                                  offset_y1,
+                                  stride_y1,
+                                  param,
+                                  offset_param,
+                                  stride_param,
+                                  batch_count,
+                                  nullptr,
+                                  nullptr);
+}
+
+template <rocblas_int NB, typename T, typename U>
+ROCBLAS_KERNEL(NB)
+rocblas_rotmg_check_numerics_vector_kernel(T                         d1_in,
+                                           rocblas_stride            offset_d1,
+                                           rocblas_stride            stride_d1,
+                                           T                         d2_in,
+                                           rocblas_stride            offset_d2,
+                                           rocblas_stride            stride_d2,
+                                           T                         x1_in,
+                                           rocblas_stride            offset_x1,
+                                           rocblas_stride            stride_x1,
+                                           U                         y1_in,
+                                           rocblas_stride            offset_y1,
+                                           rocblas_stride            stride_y1,
+                                           rocblas_int               batch_count,
+                                           rocblas_check_numerics_t* abnormal)
+{
+    rocblas_int batch = blockIdx.x * NB + threadIdx.x;
+    if(batch >= batch_count)
+        return;
+
+    auto d1 = load_ptr_batch(d1_in, batch, offset_d1, stride_d1);
+    auto d2 = load_ptr_batch(d2_in, batch, offset_d2, stride_d2);
+    auto x1 = load_ptr_batch(x1_in, batch, offset_x1, stride_x1);
+    auto y1 = load_ptr_batch(y1_in, batch, offset_y1, stride_y1);
 
     //Check every element of the x vector for a NaN/zero/Inf/denormal value
-    if(rocblas_iszero(*d1) || rocblas_iszero(*d2) || rocblas_iszero(*x1) || rocblas_iszero(*y1))
-        abnormal->has_zero = true;
-    if(rocblas_isnan(*d1) || rocblas_isnan(*d2) || rocblas_isnan(*x1) || rocblas_isnan(*y1))
-        abnormal->has_NaN = true;
-    if(rocblas_isinf(*d1) || rocblas_isinf(*d2) || rocblas_isinf(*x1) || rocblas_isinf(*y1))
-        abnormal->has_Inf = true;
-    if(rocblas_isdenorm(*d1) || rocblas_isdenorm(*d2) || rocblas_isdenorm(*x1)
-       || rocblas_isdenorm(*y1))
-        abnormal->has_denorm = true;
+    rocblas_rotmg_check_numerics_values(*d1, *d2, *x1, *y1, abnormal);
 }
 
 template <typename T, typename U>
@@ -317,18 +392,39 @@ rocblas_status rocblas_rotmg_check_numerics_template(const char*    function_nam
 
     if(rocblas_pointer_mode_device == handle->pointer_mode)
     {
-        hipStream_t rocblas_stream = handle->get_stream();
+        //The results of the check are read on the host, which graph safe mode does not allow
+        if(handle->is_graph_safe())
+            return rocblas_status_not_implemented;
 
-        auto d_abnormal = handle->device_malloc(sizeof(rocblas_check_numerics_t));
+        hipStream_t               rocblas_stream = handle->get_stream();
+        rocblas_check_numerics_t* d_abnormal     = nullptr;
+        rocblas_status            status         = rocblas_status_success;
 
-        //Transferring the rocblas_check_numerics_t structure from host to the device
-        RETURN_IF_HIP_ERROR(hipMemcpy((rocblas_check_numerics_t*)d_abnormal,
-                                      &h_abnormal,
-                                      sizeof(rocblas_check_numerics_t),
-                                      hipMemcpyHostToDevice));
-        hipLaunchKernelGGL(rocblas_rotmg_check_numerics_vector_kernel,
-                           batch_count,
-                           1,
+        //In deferred mode the result is recorded in the handle and reported later
+        bool deferred = (check_numerics & rocblas_check_numerics_mode_deferred) != 0;
+
+        auto w_abnormal = handle->device_malloc(deferred ? 0 : sizeof(rocblas_check_numerics_t));
+
+        if(deferred)
+        {
+            status = handle->get_deferred_check_numerics_record(
+                function_name, check_numerics, is_input, &d_abnormal);
+            if(status != rocblas_status_success && status != rocblas_status_check_numerics_fail)
+                return status;
+        }
+        else
+        {
+            //All the flags of the structure are false, it is cleared in stream order
+            d_abnormal = (rocblas_check_numerics_t*)w_abnormal;
+            RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(d_abnormal, 0, sizeof(rocblas_check_numerics_t), rocblas_stream));
+        }
+
+        static constexpr rocblas_int NB = ROCBLAS_ROTMG_NB;
+
+        hipLaunchKernelGGL(rocblas_rotmg_check_numerics_vector_kernel<NB>,
+                           (batch_count - 1) / NB + 1,
+                           NB,
                            0,
                            rocblas_stream,
                            d1_in,
@@ -343,13 +439,18 @@ rocblas_status rocblas_rotmg_check_numerics_template(const char*    function_nam
                            y1_in,
                            offset_y1,
                            stride_y1,
-                           (rocblas_check_numerics_t*)d_abnormal);
+                           batch_count,
+                           d_abnormal);
+
+        if(deferred)
+        {
+            handle->set_async_status_for_check(d_abnormal, check_numerics);
+            return status;
+        }
 
         //Transferring the rocblas_check_numerics_t structure from device to the host
-        RETURN_IF_HIP_ERROR(hipMemcpy(&h_abnormal,
-                                      (rocblas_check_numerics_t*)d_abnormal,
-                                      sizeof(rocblas_check_numerics_t),
-                                      hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            &h_abnormal, d_abnormal, sizeof(rocblas_check_numerics_t), hipMemcpyDeviceToHost));
     }
     else
     {
@@ -361,22 +462,155 @@ rocblas_status rocblas_rotmg_check_numerics_template(const char*    function_nam
             auto y1 = load_ptr_batch(y1_in, i, offset_y1, stride_y1);
 
             //Check every element of the vectors d1, d2, x1, y1 for a zero/NaN/Inf/denormal value
-            if(rocblas_iszero(*d1) || rocblas_iszero(*d2) || rocblas_iszero(*x1)
-               || rocblas_iszero(*y1))
-                h_abnormal.has_zero = true;
-            if(rocblas_isnan(*d1) || rocblas_isnan(*d2) || rocblas_isnan(*x1) || rocblas_isnan(*y1))
-                h_abnormal.has_NaN = true;
-            if(rocblas_isinf(*d1) || rocblas_isinf(*d2) || rocblas_isinf(*x1) || rocblas_isinf(*y1))
-                h_abnormal.has_Inf = true;
-            if(rocblas_isdenorm(*d1) || rocblas_isdenorm(*d2) || rocblas_isdenorm(*x1)
-               || rocblas_isdenorm(*y1))
-                h_abnormal.has_denorm = true;
+            rocblas_rotmg_check_numerics_values(*d1, *d2, *x1, *y1, &h_abnormal);
         }
     }
     return rocblas_check_numerics_abnormal_struct(
         function_name, check_numerics, is_input, &h_abnormal);
 }
 
+template <typename T, typename U>
+rocblas_status rocblas_rotmg_checked_template(const char*    function_name,
+                                              rocblas_handle handle,
+                                              T              d1_in,
+                                              rocblas_stride offset_d1,
+                                              rocblas_stride stride_d1,
+                                              T              d2_in,
+                                              rocblas_stride offset_d2,
+                                              rocblas_stride stride_d2,
+                                              T              x1_in,
+                                              rocblas_stride offset_x1,
+                                              rocblas_stride stride_x1,
+                                              U              y1_in,
+                                              rocblas_stride offset_y1,
+                                              rocblas_stride stride_y1,
+                                              T              param,
+                                              rocblas_stride offset_param,
+                                              rocblas_stride stride_param,
+                                              rocblas_int    batch_count,
+                                              const int      check_numerics)
+{
+    // In deferred mode on device memory both checks are made by the rotmg kernel itself, with
+    // the results reported later
+    bool fused = (check_numerics & rocblas_check_numerics_mode_deferred)
+                 && rocblas_pointer_mode_device == handle->pointer_mode && batch_count > 0;
+
+    if(fused)
+    {
+        //The deferred records may be reported on the host, which graph safe mode does not allow
+        if(handle->is_graph_safe())
+            return rocblas_status_not_implemented;
+
+        rocblas_check_numerics_t* d_abnormal_in  = nullptr;
+        rocblas_check_numerics_t* d_abnormal_out = nullptr;
+
+        //A failure of an earlier deferred check does not stop this rotmg, as for a separate check
+        rocblas_status status = handle->get_deferred_check_numerics_record(
+            function_name, check_numerics, true, &d_abnormal_in);
+        if(status != rocblas_status_success && status != rocblas_status_check_numerics_fail)
+            return status;
+
+        rocblas_status status_out = handle->get_deferred_check_numerics_record(
+            function_name, check_numerics, false, &d_abnormal_out);
+        if(status_out != rocblas_status_success)
+        {
+            if(status_out != rocblas_status_check_numerics_fail)
+                return status_out;
+            status = status_out;
+        }
+
+        rocblas_status launch_status = rocblas_rotmg_launcher(handle,
+                                                              d1_in,
+                                                              offset_d1,
+                                                              stride_d1,
+                                                              d2_in,
+                                                              offset_d2,
+                                                              stride_d2,
+                                                              x1_in,
+                                                              offset_x1,
+                                                              stride_x1,
+                                                              y1_in,
+                                                              offset_y1,
+                                                              stride_y1,
+                                                              param,
+                                                              offset_param,
+                                                              stride_param,
+                                                              batch_count,
+                                                              d_abnormal_in,
+                                                              d_abnormal_out);
+        if(launch_status != rocblas_status_success)
+            return launch_status;
+
+        handle->set_async_status_for_check(d_abnormal_in, check_numerics);
+        handle->set_async_status_for_check(d_abnormal_out, check_numerics);
+        return status;
+    }
+
+    rocblas_status status;
+    if(check_numerics)
+    {
+        status = rocblas_rotmg_check_numerics_template(function_name,
+                                                       handle,
+                                                       1,
+                                                       d1_in,
+                                                       offset_d1,
+                                                       stride_d1,
+                                                       d2_in,
+                                                       offset_d2,
+                                                       stride_d2,
+                                                       x1_in,
+                                                       offset_x1,
+                                                       stride_x1,
+                                                       y1_in,
+                                                       offset_y1,
+                                                       stride_y1,
+                                                       batch_count,
+                                                       check_numerics,
+                                                       true);
+        if(status != rocblas_status_success)
+            return status;
+    }
+
+    status = rocblas_rotmg_template(handle,
+                                    d1_in,
+                                    offset_d1,
+                                    stride_d1,
+                                    d2_in,
+                                    offset_d2,
+                                    stride_d2,
+                                    x1_in,
+                                    offset_x1,
+                                    stride_x1,
+                                    y1_in,
+                                    offset_y1,
+                                    stride_y1,
+                                    param,
+                                    offset_param,
+                                    stride_param,
+                                    batch_count);
+    if(status != rocblas_status_success || !check_numerics)
+        return status;
+
+    return rocblas_rotmg_check_numerics_template(function_name,
+                                                 handle,
+                                                 1,
+                                                 d1_in,
+                                                 offset_d1,
+                                                 stride_d1,
+                                                 d2_in,
+                                                 offset_d2,
+                                                 stride_d2,
+                                                 x1_in,
+                                                 offset_x1,
+                                                 stride_x1,
+                                                 y1_in,
+                                                 offset_y1,
+                                                 stride_y1,
+                                                 batch_count,
+                                                 check_numerics,
+                                                 false);
+}
+
 // If there are any changes in template parameters in the files *rotmg*.cpp
 // instantiations below will need to be manually updated to match the changes.
 
@@ -449,3 +683,39 @@ INSTANTIATE_ROTMG_CHECK_NUMERICS(float* const*, float const* const*)
 INSTANTIATE_ROTMG_CHECK_NUMERICS(double* const*, double const* const*)
 
 #undef INSTANTIATE_ROTMG_CHECK_NUMERICS
+
+#ifdef INSTANTIATE_ROTMG_CHECKED_TEMPLATE
+#error INSTANTIATE_ROTMG_CHECKED_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_ROTMG_CHECKED_TEMPLATE(T_, U_)                                   \
+template rocblas_status rocblas_rotmg_checked_template<T_, U_>                       \
+                                                      (const char*    function_name, \
+                                                       rocblas_handle handle,        \
+                                                       T_             d1_in,         \
+                                                       rocblas_stride offset_d1,     \
+                                                       rocblas_stride stride_d1,     \
+                                                       T_             d2_in,         \
+                                                       rocblas_stride offset_d2,     \
+                                                       rocblas_stride stride_d2,     \
+                                                       T_             x1_in,         \
+                                                       rocblas_stride offset_x1,     \
+                                                       rocblas_stride stride_x1,     \
+                                                       U_             y1_in,         \
+                                                       rocblas_stride offset_y1,     \
+                                                       rocblas_stride stride_y1,     \
+                                                       T_             param,         \
+                                                       rocblas_stride offset_param,  \
+                                                       rocblas_stride stride_param,  \
+                                                       rocblas_int    batch_count,   \
+                                                       const int      check_numerics);
+
+// instantiate for rocblas_Xrotmg and rocblas_Xrotmg_strided_batched
+INSTANTIATE_ROTMG_CHECKED_TEMPLATE(float*, float const*)
+INSTANTIATE_ROTMG_CHECKED_TEMPLATE(double*, double const*)
+
+// instantiate for rocblas_Xrotmg_batched
+INSTANTIATE_ROTMG_CHECKED_TEMPLATE(float* const*, float const* const*)
+INSTANTIATE_ROTMG_CHECKED_TEMPLATE(double* const*, double const* const*)
+
+#undef INSTANTIATE_ROTMG_CHECKED_TEMPLATE
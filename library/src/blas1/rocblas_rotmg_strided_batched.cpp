@@ -53,7 +53,7 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
@@ -106,76 +106,25 @@ namespace
         if(!d1 || !d2 || !x1 || !y1 || !param)
             return rocblas_status_invalid_pointer;
 
-        if(check_numerics)
-        {
-            bool           is_input = true;
-            rocblas_status rotmg_check_numerics_status
-                = rocblas_rotmg_check_numerics_template(rocblas_rotmg_name<T>,
-                                                        handle,
-                                                        1,
-                                                        d1,
-                                                        0,
-                                                        stride_d1,
-                                                        d2,
-                                                        0,
-                                                        stride_d2,
-                                                        x1,
-                                                        0,
-                                                        stride_x1,
-                                                        y1,
-                                                        0,
-                                                        stride_y1,
-                                                        batch_count,
-                                                        check_numerics,
-                                                        is_input);
-            if(rotmg_check_numerics_status != rocblas_status_success)
-                return rotmg_check_numerics_status;
-        }
-        rocblas_status status = rocblas_rotmg_template(handle,
-                                                       d1,
-                                                       0,
-                                                       stride_d1,
-                                                       d2,
-                                                       0,
-                                                       stride_d2,
-                                                       x1,
-                                                       0,
-                                                       stride_x1,
-                                                       y1,
-                                                       0,
-                                                       stride_y1,
-                                                       param,
-                                                       0,
-                                                       stride_param,
-                                                       batch_count);
-        if(status != rocblas_status_success)
-            return status;
-        if(check_numerics)
-        {
-            bool           is_input = false;
-            rocblas_status rotm_check_numerics_status
-                = rocblas_rotmg_check_numerics_template(rocblas_rotmg_name<T>,
-                                                        handle,
-                                                        1,
-                                                        d1,
-                                                        0,
-                                                        stride_d1,
-                                                        d2,
-                                                        0,
-                                                        stride_d2,
-                                                        x1,
-                                                        0,
-                                                        stride_x1,
-                                                        y1,
-                                                        0,
-                                                        stride_y1,
-                                                        batch_count,
-                                                        check_numerics,
-                                                        is_input);
-            if(rotm_check_numerics_status != rocblas_status_success)
-                return rotm_check_numerics_status;
-        }
-        return status;
+        return rocblas_rotmg_checked_template(rocblas_rotmg_name<T>,
+                                              handle,
+                                              d1,
+                                              0,
+                                              stride_d1,
+                                              d2,
+                                              0,
+                                              stride_d2,
+                                              x1,
+                                              0,
+                                              stride_x1,
+                                              y1,
+                                              0,
+                                              stride_y1,
+                                              param,
+                                              0,
+                                              stride_param,
+                                              batch_count,
+                                              check_numerics);
     }
 
 } // namespace
@@ -22,6 +22,8 @@
 #include "rocblas_scal.hpp"
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "level1_fusion.hpp"
 #include "logging.hpp"
 #include "rocblas.h"
 #include "rocblas_block_sizes.h"
@@ -53,7 +55,7 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
 
         if(layer_mode & rocblas_layer_mode_log_trace)
@@ -92,6 +94,10 @@ namespace
                 return rocblas_status_success;
         }
 
+        rocblas_status fusion_status = rocblas_level1_fusion_scal(handle, n, alpha, x, incx);
+        if(fusion_status != rocblas_status_continue)
+            return fusion_status;
+
         if(check_numerics)
         {
             bool           is_input              = true;
@@ -101,11 +107,18 @@ namespace
                 return check_numerics_status;
         }
 
+        rocblas_fused_check_numerics fused_check(handle, rocblas_scal_name<T>, check_numerics);
+        RETURN_IF_ROCBLAS_ERROR(fused_check.begin());
+
         rocblas_status status
             = rocblas_internal_scal_template<NB, T>(handle, n, alpha, 0, x, 0, incx, 0, 1);
         if(status != rocblas_status_success)
             return status;
 
+        // The outputs were checked by the compute kernels
+        if(fused_check.is_active())
+            return fused_check.end();
+
         if(check_numerics)
         {
             bool           is_input              = false;
@@ -117,6 +130,25 @@ namespace
 
         return status;
     }
+
+    template <rocblas_int NB, typename T, typename U>
+    rocblas_status
+        rocblas_scal_64_impl(rocblas_handle handle, int64_t n, const U* alpha, T* x, int64_t incx)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // x is the only vector, so its increment is passed for both
+        auto scal_chunk = [&](int64_t offset_x,
+                              int64_t,
+                              rocblas_int n_c,
+                              rocblas_int incx_c,
+                              rocblas_int) {
+            return rocblas_scal_impl<NB>(
+                handle, n_c, alpha, rocblas_chunk_ptr_64(x, offset_x), incx_c);
+        };
+        return rocblas_chunk_vectors_64(handle, n, incx, incx, scal_chunk);
+    }
 }
 
 /*
@@ -206,4 +238,29 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_, U_)                                              \
+    rocblas_status routine_name_(                                                \
+        rocblas_handle handle, int64_t n, const U_* alpha, T_* x, int64_t incx)  \
+    try                                                                          \
+    {                                                                            \
+        return rocblas_scal_64_impl<ROCBLAS_SCAL_NB>(handle, n, alpha, x, incx); \
+    }                                                                            \
+    catch(...)                                                                   \
+    {                                                                            \
+        return exception_to_rocblas_status();                                    \
+    }
+
+IMPL(rocblas_sscal_64, float, float);
+IMPL(rocblas_dscal_64, double, double);
+IMPL(rocblas_cscal_64, rocblas_float_complex, rocblas_float_complex);
+IMPL(rocblas_zscal_64, rocblas_double_complex, rocblas_double_complex);
+IMPL(rocblas_csscal_64, rocblas_float_complex, float);
+IMPL(rocblas_zdscal_64, rocblas_double_complex, double);
+
+#undef IMPL
+
 } // extern "C"
@@ -20,19 +20,23 @@
  *
  * ************************************************************************ */
 
+#include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "rocblas.h"
+#include "rocblas_dwordx4.hpp"
+#include "rocblas_level1_launch.hpp"
 #include "rocblas_scal.hpp"
 
-template <rocblas_int NB, typename T, typename Tex, typename Ta, typename Tx>
+template <rocblas_int NB, typename T, typename Tex, bool CHECK_NUMERICS, typename Ta, typename Tx>
 ROCBLAS_KERNEL(NB)
-rocblas_scal_kernel(rocblas_int    n,
-                    Ta             alpha_device_host,
-                    rocblas_stride stride_alpha,
-                    Tx             xa,
-                    rocblas_stride offset_x,
-                    rocblas_int    incx,
-                    rocblas_stride stride_x)
+rocblas_scal_kernel(rocblas_int               n,
+                    Ta                        alpha_device_host,
+                    rocblas_stride            stride_alpha,
+                    Tx                        xa,
+                    rocblas_stride            offset_x,
+                    rocblas_int               incx,
+                    rocblas_stride            stride_x,
+                    rocblas_check_numerics_t* abnormal)
 {
     auto* x     = load_ptr_batch(xa, blockIdx.y, offset_x, stride_x);
     auto  alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
@@ -40,28 +44,30 @@ rocblas_scal_kernel(rocblas_int    n,
     if(alpha == 1)
         return;
 
-    ptrdiff_t tid = blockIdx.x * blockDim.x + threadIdx.x;
-
-    // bound
-    if(tid < n)
+    for(ptrdiff_t tid = blockIdx.x * blockDim.x + threadIdx.x; tid < n;
+        tid += ptrdiff_t(gridDim.x) * blockDim.x)
     {
         Tex res       = (Tex)x[tid * incx] * alpha;
         x[tid * incx] = (T)res;
+        rocblas_check_numerics_output<CHECK_NUMERICS>(T(res), abnormal);
     }
 }
 
 //!
-//! @brief Optimized kernel for the SCAL floating points.
+//! @brief Optimized kernel (batched, strided batched) of scal with unit increment, using 128-bit
+//!        loads and stores for the aligned part of the vector, nontemporal if nontemporal.
 //! @remark Increment are required to be equal to one, that's why they are unspecified.
 //!
-template <rocblas_int NB, typename T, typename Tex, typename Ta, typename Tx>
+template <rocblas_int NB, typename T, typename Tex, bool CHECK_NUMERICS, typename Ta, typename Tx>
 ROCBLAS_KERNEL(NB)
-rocblas_sscal_2_kernel(rocblas_int    n,
-                       Ta             alpha_device_host,
-                       rocblas_stride stride_alpha,
-                       Tx __restrict__ xa,
-                       rocblas_stride offset_x,
-                       rocblas_stride stride_x)
+rocblas_scal_dwordx4_kernel(rocblas_int               n,
+                            bool                      nontemporal,
+                            Ta                        alpha_device_host,
+                            rocblas_stride            stride_alpha,
+                            Tx __restrict__ xa,
+                            rocblas_stride            offset_x,
+                            rocblas_stride            stride_x,
+                            rocblas_check_numerics_t* abnormal)
 {
     auto* x     = load_ptr_batch(xa, blockIdx.y, offset_x, stride_x);
     auto  alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
@@ -69,84 +75,16 @@ rocblas_sscal_2_kernel(rocblas_int    n,
     if(alpha == 1)
         return;
 
-    ptrdiff_t tid = (blockIdx.x * blockDim.x + threadIdx.x) * 2;
-
-    if(tid < n - 1)
-    {
-        // Each thread access contiguous elements for example Thread '0' access indices '0' and '1' of the vector `x`
-        for(rocblas_int j = 0; j < 2; ++j)
-        {
-            Tex res    = (Tex)x[tid + j] * alpha;
-            x[tid + j] = (T)res;
-        }
-    }
-
-    // If `n` is odd then the computation of last element in the vector `x` is covered below.
-    if(n % 2 != 0 && tid == n - 1)
-    {
-        Tex res = (Tex)x[tid] * alpha;
-        x[tid]  = (T)res;
-    }
-}
-
-//!
-//! @brief Optimized kernel for the SCAL when the compute and alpha type is half precision.
-//! @remark Increments are required to be equal to one, that's why they are unspecified.
-//!
-template <rocblas_int NB, typename Ta, typename Tx>
-ROCBLAS_KERNEL(NB)
-rocblas_hscal_mlt_4_kernel(rocblas_int    n,
-                           rocblas_int    n_mod_4,
-                           rocblas_int    n_mlt_4,
-                           Ta             alpha_device_host,
-                           rocblas_stride stride_alpha,
-                           Tx __restrict__ xa,
-                           rocblas_stride offset_x,
-                           rocblas_stride stride_x)
-{
-    auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
-
-    if(alpha == 1)
-        return;
-
-    rocblas_half2 x0, x1;
-    rocblas_half2 z0, z1;
-
-    ptrdiff_t tid = (blockIdx.x * blockDim.x + threadIdx.x) * 4;
-
-    if(tid < n - 3)
-    {
-        rocblas_half4* x = (rocblas_half4*)load_ptr_batch(xa, blockIdx.y, offset_x + tid, stride_x);
-
-        x0[0] = (*x)[0];
-        x0[1] = (*x)[1];
-        x1[0] = (*x)[2];
-        x1[1] = (*x)[3];
-
-        z0[0] = alpha * x0[0];
-        z0[1] = alpha * x0[1];
-        z1[0] = alpha * x1[0];
-        z1[1] = alpha * x1[1];
-
-        (*x)[0] = z0[0];
-        (*x)[1] = z0[1];
-        (*x)[2] = z1[0];
-        (*x)[3] = z1[1];
-    }
-
-    // If `n_mod_4` is true then the computation of last few element in the vector `x` is covered below.
-    if(n_mod_4)
-    {
-        //The last ThreadID which is a multiple of 4 should complete the computation of last few elements of vector `x`
-        if(tid == n_mlt_4)
-        {
-            auto* x = load_ptr_batch(xa, blockIdx.y, offset_x, stride_x);
-            for(rocblas_int j = 0; j < n_mod_4; ++j)
-            {
-                x[tid + j] = x[tid + j] * alpha;
-            }
-        }
-    }
+    rocblas_dwordx4_apply(blockIdx.x * blockDim.x + threadIdx.x,
+                          ptrdiff_t(gridDim.x) * blockDim.x,
+                          n,
+                          nontemporal,
+                          x,
+                          [=](T& xi) {
+                              Tex res = (Tex)xi * alpha;
+                              xi      = (T)res;
+                              rocblas_check_numerics_output<CHECK_NUMERICS>(xi, abnormal);
+                          });
 }
 
 template <rocblas_int NB, typename T, typename Tex, typename Ta, typename Tx>
@@ -167,119 +105,92 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         return rocblas_status_success;
     }
 
-    static constexpr bool using_rocblas_float
-        = std::is_same<Tx, rocblas_float*>{} || std::is_same<Tx, rocblas_float* const*>{};
+    // The kernels check the values they write with rocblas_check_numerics_mode_fused
+    rocblas_check_numerics_t* abnormal = handle->fused_check_numerics;
 
-    // Using rocblas_half ?
-    static constexpr bool using_rocblas_half
-        = std::is_same<Ta, rocblas_half>{} && std::is_same<Tex, rocblas_half>{};
+    auto launch_scal = [&](auto fused) {
+        constexpr bool CHECK_NUMERICS = decltype(fused)::value;
 
-    if(using_rocblas_float && incx == 1)
-    {
-        // Kernel function for improving the performance of SSCAL when incx==1
-        int  blocks = 1 + ((n - 1) / (NB * 2));
-        dim3 grid(blocks, batch_count);
-        dim3 threads(NB);
+        if(incx == 1)
+        {
+            // Kernel function for improving the performance of SCAL when incx==1, using 128-bit
+            // loads and stores of the aligned part of x, nontemporal if x is larger than the L2
+            rocblas_level1_launch<NB> launch(handle, rocblas_dwordx4_count<Tx>(n), batch_count);
+            dim3                      grid    = launch.grid;
+            dim3                      threads = launch.threads;
 
-        if(rocblas_pointer_mode_device == handle->pointer_mode)
-            hipLaunchKernelGGL((rocblas_sscal_2_kernel<NB, T, Tex>),
-                               grid,
-                               threads,
-                               0,
-                               handle->get_stream(),
-                               n,
-                               alpha,
-                               stride_alpha,
-                               x,
-                               offset_x,
-                               stride_x);
-        else // single alpha is on host
-            hipLaunchKernelGGL((rocblas_sscal_2_kernel<NB, T, Tex>),
-                               grid,
-                               threads,
-                               0,
-                               handle->get_stream(),
-                               n,
-                               *alpha,
-                               stride_alpha,
-                               x,
-                               offset_x,
-                               stride_x);
-    }
-    else if(using_rocblas_half && incx == 1)
-    {
-        // Kernel function for improving the performance of HSCAL when incx==1
-        rocblas_int n_mod_4 = n & 3; // n mod 4
-        rocblas_int n_mlt_4 = n & ~(rocblas_int)3; // multiple of 4
-        int         blocks  = 1 + ((n - 1) / (NB * 4));
-        dim3        grid(blocks, batch_count);
-        dim3        threads(NB);
+            bool nontemporal = rocblas_level1_nontemporal<Tx>(handle, n, 1, batch_count);
 
-        if constexpr(using_rocblas_half)
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+                hipLaunchKernelGGL((rocblas_scal_dwordx4_kernel<NB, T, Tex, CHECK_NUMERICS>),
+                                   grid,
+                                   threads,
+                                   0,
+                                   handle->get_stream(),
+                                   n,
+                                   nontemporal,
+                                   alpha,
+                                   stride_alpha,
+                                   x,
+                                   offset_x,
+                                   stride_x,
+                                   abnormal);
+            else // single alpha is on host
+                hipLaunchKernelGGL((rocblas_scal_dwordx4_kernel<NB, T, Tex, CHECK_NUMERICS>),
+                                   grid,
+                                   threads,
+                                   0,
+                                   handle->get_stream(),
+                                   n,
+                                   nontemporal,
+                                   *alpha,
+                                   stride_alpha,
+                                   x,
+                                   offset_x,
+                                   stride_x,
+                                   abnormal);
+        }
+        else
         {
+            rocblas_level1_launch<NB> launch(handle, n, batch_count);
+            dim3                      grid    = launch.grid;
+            dim3                      threads = launch.threads;
+
             if(rocblas_pointer_mode_device == handle->pointer_mode)
-                hipLaunchKernelGGL((rocblas_hscal_mlt_4_kernel<NB>),
+                hipLaunchKernelGGL((rocblas_scal_kernel<NB, T, Tex, CHECK_NUMERICS>),
                                    grid,
                                    threads,
                                    0,
                                    handle->get_stream(),
                                    n,
-                                   n_mod_4,
-                                   n_mlt_4,
-                                   (const rocblas_half*)alpha,
+                                   alpha,
                                    stride_alpha,
                                    x,
                                    offset_x,
-                                   stride_x);
+                                   incx,
+                                   stride_x,
+                                   abnormal);
             else // single alpha is on host
-                hipLaunchKernelGGL((rocblas_hscal_mlt_4_kernel<NB>),
+                hipLaunchKernelGGL((rocblas_scal_kernel<NB, T, Tex, CHECK_NUMERICS>),
                                    grid,
                                    threads,
                                    0,
                                    handle->get_stream(),
                                    n,
-                                   n_mod_4,
-                                   n_mlt_4,
-                                   load_scalar((const rocblas_half*)alpha),
+                                   *alpha,
                                    stride_alpha,
                                    x,
                                    offset_x,
-                                   stride_x);
+                                   incx,
+                                   stride_x,
+                                   abnormal);
         }
-    }
-    else
-    {
-        int  blocks = (n - 1) / NB + 1;
-        dim3 grid(blocks, batch_count);
-        dim3 threads(NB);
+    };
 
-        if(rocblas_pointer_mode_device == handle->pointer_mode)
-            hipLaunchKernelGGL((rocblas_scal_kernel<NB, T, Tex>),
-                               grid,
-                               threads,
-                               0,
-                               handle->get_stream(),
-                               n,
-                               alpha,
-                               stride_alpha,
-                               x,
-                               offset_x,
-                               incx,
-                               stride_x);
-        else // single alpha is on host
-            hipLaunchKernelGGL((rocblas_scal_kernel<NB, T, Tex>),
-                               grid,
-                               threads,
-                               0,
-                               handle->get_stream(),
-                               n,
-                               *alpha,
-                               stride_alpha,
-                               x,
-                               offset_x,
-                               incx,
-                               stride_x);
-    }
+    if(abnormal)
+        launch_scal(std::true_type{});
+    else
+        launch_scal(std::false_type{});
     return rocblas_status_success;
 }
 
@@ -61,7 +61,7 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
 
         if(layer_mode & rocblas_layer_mode_log_trace)
@@ -136,11 +136,21 @@ namespace
             if(check_numerics_status != rocblas_status_success)
                 return check_numerics_status;
         }
+        rocblas_fused_check_numerics fused_check(handle, rocblas_scal_name<T>, check_numerics);
+        RETURN_IF_ROCBLAS_ERROR(fused_check.begin());
+
+        // Device alpha may differ per batch, see rocblas_set_batched_scalar_stride
+        rocblas_stride stride_alpha = handle->get_alpha_batch_stride();
+
         rocblas_status status = rocblas_internal_scal_template<NB, T>(
-            handle, n, alpha, 0, x, 0, incx, stridex, batch_count);
+            handle, n, alpha, stride_alpha, x, 0, incx, stridex, batch_count);
         if(status != rocblas_status_success)
             return status;
 
+        // The outputs were checked by the compute kernels
+        if(fused_check.is_active())
+            return fused_check.end();
+
         if(check_numerics)
         {
             bool           is_input = false;
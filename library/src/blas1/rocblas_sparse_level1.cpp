@@ -0,0 +1,830 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "check_numerics_vector.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_block_sizes.h"
+#include "rocblas_reduction.hpp"
+#include "utility.hpp"
+
+/*
+ * ===========================================================================
+ *    Sparse level 1: a sparse vector is given by its nnz values x_val and their
+ *    0-based indices x_ind in the dense vector y.
+ *    axpyi: y[x_ind[i]] += alpha * x_val[i]
+ *    doti:  result = sum_i x_val[i] * y[x_ind[i]], dotci conjugating x_val
+ *    gthr:  x_val[i] = y[x_ind[i]]
+ *    sctr:  y[x_ind[i]] = x_val[i]
+ *    roti:  (x_val[i], y[x_ind[i]]) := (c * x_val[i] + s * y[x_ind[i]],
+ *                                       c * y[x_ind[i]] - s * x_val[i])
+ *    One thread per nonzero, and one grid row per batch. The indices of a sparse
+ *    vector are distinct, so the updates of y do not race. The doti sums are
+ *    reduced per block, and the block sums by a second kernel, in a fixed order.
+ * ===========================================================================
+ */
+
+namespace
+{
+    constexpr rocblas_int NB     = ROCBLAS_AXPY_NB;
+    constexpr rocblas_int DOT_NB = ROCBLAS_DOT_NB;
+
+    template <rocblas_int NB, typename Ta, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_axpyi_kernel(rocblas_int nnz,
+                         Ta          alpha_device_host,
+                         const T* __restrict__ x_val,
+                         rocblas_stride stride_x,
+                         const rocblas_int* __restrict__ x_ind,
+                         rocblas_stride stride_ind,
+                         T* __restrict__ y,
+                         rocblas_stride stride_y)
+    {
+        auto        alpha = load_scalar(alpha_device_host);
+        rocblas_int i     = blockIdx.x * NB + threadIdx.x;
+        if(!alpha || i >= nnz)
+            return;
+
+        x_val += blockIdx.y * stride_x;
+        x_ind += blockIdx.y * stride_ind;
+        y += blockIdx.y * stride_y;
+
+        y[x_ind[i]] += alpha * x_val[i];
+    }
+
+    template <rocblas_int NB, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_gthr_kernel(rocblas_int nnz,
+                        T* __restrict__ x_val,
+                        rocblas_stride stride_x,
+                        const rocblas_int* __restrict__ x_ind,
+                        rocblas_stride stride_ind,
+                        const T* __restrict__ y,
+                        rocblas_stride stride_y)
+    {
+        rocblas_int i = blockIdx.x * NB + threadIdx.x;
+        if(i >= nnz)
+            return;
+
+        x_val += blockIdx.y * stride_x;
+        x_ind += blockIdx.y * stride_ind;
+        y += blockIdx.y * stride_y;
+
+        x_val[i] = y[x_ind[i]];
+    }
+
+    template <rocblas_int NB, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_sctr_kernel(rocblas_int nnz,
+                        const T* __restrict__ x_val,
+                        rocblas_stride stride_x,
+                        const rocblas_int* __restrict__ x_ind,
+                        rocblas_stride stride_ind,
+                        T* __restrict__ y,
+                        rocblas_stride stride_y)
+    {
+        rocblas_int i = blockIdx.x * NB + threadIdx.x;
+        if(i >= nnz)
+            return;
+
+        x_val += blockIdx.y * stride_x;
+        x_ind += blockIdx.y * stride_ind;
+        y += blockIdx.y * stride_y;
+
+        y[x_ind[i]] = x_val[i];
+    }
+
+    template <rocblas_int NB, typename Ts, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_roti_kernel(rocblas_int nnz,
+                        T* __restrict__ x_val,
+                        rocblas_stride stride_x,
+                        const rocblas_int* __restrict__ x_ind,
+                        rocblas_stride stride_ind,
+                        T* __restrict__ y,
+                        rocblas_stride stride_y,
+                        Ts             c_device_host,
+                        Ts             s_device_host)
+    {
+        auto        c = load_scalar(c_device_host);
+        auto        s = load_scalar(s_device_host);
+        rocblas_int i = blockIdx.x * NB + threadIdx.x;
+        if(i >= nnz)
+            return;
+
+        x_val += blockIdx.y * stride_x;
+        x_ind += blockIdx.y * stride_ind;
+        y += blockIdx.y * stride_y;
+
+        T  xi = x_val[i];
+        T& yi = y[x_ind[i]];
+        x_val[i] = c * xi + s * yi;
+        yi       = c * yi - s * xi;
+    }
+
+    // Partial sums of the products per block, written to workspace, or to out when a single
+    // block covers the nonzeros
+    template <rocblas_int NB, bool CONJ, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_doti_kernel(rocblas_int nnz,
+                        const T* __restrict__ x_val,
+                        rocblas_stride stride_x,
+                        const rocblas_int* __restrict__ x_ind,
+                        rocblas_stride stride_ind,
+                        const T* __restrict__ y,
+                        rocblas_stride stride_y,
+                        T* __restrict__ workspace,
+                        T* __restrict__ out)
+    {
+        x_val += blockIdx.y * stride_x;
+        x_ind += blockIdx.y * stride_ind;
+        y += blockIdx.y * stride_y;
+
+        rocblas_int i   = blockIdx.x * NB + threadIdx.x;
+        T           sum = 0;
+        if(i < nnz)
+            sum = y[x_ind[i]] * (CONJ ? conj(x_val[i]) : x_val[i]);
+
+        sum = rocblas_dot_block_reduce<NB>(sum);
+
+        if(threadIdx.x == 0)
+        {
+            if(gridDim.x == 1)
+                out[blockIdx.y] = sum;
+            else
+                workspace[blockIdx.x + size_t(blockIdx.y) * gridDim.x] = sum;
+        }
+    }
+
+    template <rocblas_int NB, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_doti_kernel_reduce(rocblas_int n_sums,
+                               const T* __restrict__ workspace,
+                               T* __restrict__ out)
+    {
+        workspace += size_t(blockIdx.y) * n_sums;
+
+        T sum = 0;
+        for(rocblas_int i = threadIdx.x; i < n_sums; i += NB)
+            sum += workspace[i];
+
+        sum = rocblas_dot_block_reduce<NB>(sum);
+        if(threadIdx.x == 0)
+            out[blockIdx.y] = sum;
+    }
+
+    // Checks the values of the sparse vectors, the dense vector y only being accessed at the
+    // indices
+    template <typename T>
+    rocblas_status rocblas_sparse_level1_check_numerics(const char*    name,
+                                                        rocblas_handle handle,
+                                                        rocblas_int    nnz,
+                                                        const T*       x_val,
+                                                        rocblas_stride stride_x,
+                                                        rocblas_int    batch_count,
+                                                        bool           is_input)
+    {
+        return rocblas_internal_check_numerics_vector_template(name,
+                                                               handle,
+                                                               nnz,
+                                                               x_val,
+                                                               0,
+                                                               1,
+                                                               stride_x,
+                                                               batch_count,
+                                                               handle->check_numerics,
+                                                               is_input);
+    }
+
+    template <typename T>
+    rocblas_status rocblas_axpyi_impl(const char*        name,
+                                      rocblas_handle     handle,
+                                      rocblas_int        nnz,
+                                      const T*           alpha,
+                                      const T*           x_val,
+                                      rocblas_stride     stride_x,
+                                      const rocblas_int* x_ind,
+                                      rocblas_stride     stride_ind,
+                                      T*                 y,
+                                      rocblas_stride     stride_y,
+                                      rocblas_int        batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      name,
+                      nnz,
+                      alpha,
+                      x_val,
+                      stride_x,
+                      x_ind,
+                      stride_ind,
+                      y,
+                      stride_y,
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, name, "nnz", nnz, "batch_count", batch_count);
+
+        if(nnz < 0 || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        // Quick return if possible.
+        if(!nnz || !batch_count)
+            return rocblas_status_success;
+
+        if(!alpha)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host && !*alpha)
+            return rocblas_status_success;
+
+        if(!x_val || !x_ind || !y)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->check_numerics)
+            RETURN_IF_ROCBLAS_ERROR(rocblas_sparse_level1_check_numerics(
+                name, handle, nnz, x_val, stride_x, batch_count, true));
+
+        dim3 grid((nnz - 1) / NB + 1, batch_count);
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            hipLaunchKernelGGL((rocblas_axpyi_kernel<NB>),
+                               grid,
+                               dim3(NB),
+                               0,
+                               handle->get_stream(),
+                               nnz,
+                               alpha,
+                               x_val,
+                               stride_x,
+                               x_ind,
+                               stride_ind,
+                               y,
+                               stride_y);
+        else
+            hipLaunchKernelGGL((rocblas_axpyi_kernel<NB>),
+                               grid,
+                               dim3(NB),
+                               0,
+                               handle->get_stream(),
+                               nnz,
+                               *alpha,
+                               x_val,
+                               stride_x,
+                               x_ind,
+                               stride_ind,
+                               y,
+                               stride_y);
+
+        return rocblas_status_success;
+    }
+
+    template <bool CONJ, typename T>
+    rocblas_status rocblas_doti_impl(const char*        name,
+                                     rocblas_handle     handle,
+                                     rocblas_int        nnz,
+                                     const T*           x_val,
+                                     rocblas_stride     stride_x,
+                                     const rocblas_int* x_ind,
+                                     rocblas_stride     stride_ind,
+                                     const T*           y,
+                                     rocblas_stride     stride_y,
+                                     rocblas_int        batch_count,
+                                     T*                 result)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes = rocblas_reduction_kernel_workspace_size<DOT_NB, T>(nnz, batch_count);
+        if(handle->is_device_memory_size_query())
+        {
+            if(nnz <= 0 || batch_count <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(
+                handle, name, nnz, x_val, stride_x, x_ind, stride_ind, y, stride_y, batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, name, "nnz", nnz, "batch_count", batch_count);
+
+        if(nnz < 0 || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        // Quick return if possible.
+        if(!batch_count)
+            return rocblas_status_success;
+
+        if(!result)
+            return rocblas_status_invalid_pointer;
+
+        if(!nnz)
+        {
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(
+                    result, 0, sizeof(T) * batch_count, handle->get_stream()));
+            else
+                for(rocblas_int b = 0; b < batch_count; b++)
+                    result[b] = T(0);
+            return rocblas_status_success;
+        }
+
+        if(!x_val || !x_ind || !y)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        if(handle->check_numerics)
+            RETURN_IF_ROCBLAS_ERROR(rocblas_sparse_level1_check_numerics(
+                name, handle, nnz, x_val, stride_x, batch_count, true));
+
+        rocblas_int blocks    = rocblas_reduction_kernel_block_count(nnz, DOT_NB);
+        T*          workspace = (T*)w_mem;
+        T*          output    = result;
+        if(handle->pointer_mode != rocblas_pointer_mode_device)
+            output = workspace + size_t(batch_count) * blocks;
+
+        hipLaunchKernelGGL((rocblas_doti_kernel<DOT_NB, CONJ>),
+                           dim3(blocks, batch_count),
+                           dim3(DOT_NB),
+                           0,
+                           handle->get_stream(),
+                           nnz,
+                           x_val,
+                           stride_x,
+                           x_ind,
+                           stride_ind,
+                           y,
+                           stride_y,
+                           workspace,
+                           output);
+
+        if(blocks > 1) // if single block first kernel did all work
+            hipLaunchKernelGGL((rocblas_doti_kernel_reduce<DOT_NB>),
+                               dim3(1, batch_count),
+                               dim3(DOT_NB),
+                               0,
+                               handle->get_stream(),
+                               blocks,
+                               workspace,
+                               output);
+
+        if(handle->pointer_mode != rocblas_pointer_mode_device)
+        {
+            if(handle->deferred_host_results || handle->is_graph_safe())
+                RETURN_IF_ROCBLAS_ERROR(
+                    handle->copy_results_to_host(result, output, sizeof(T) * batch_count));
+            else
+                RETURN_IF_HIP_ERROR(hipMemcpyAsync(result,
+                                                   output,
+                                                   sizeof(T) * batch_count,
+                                                   hipMemcpyDeviceToHost,
+                                                   handle->get_stream()));
+        }
+
+        return rocblas_status_success;
+    }
+
+    // gthr (GATHER true) writes x_val from y, sctr (GATHER false) writes y from x_val
+    template <bool GATHER, typename T>
+    rocblas_status rocblas_gthr_sctr_impl(const char*        name,
+                                          rocblas_handle     handle,
+                                          rocblas_int        nnz,
+                                          T*                 x_val,
+                                          rocblas_stride     stride_x,
+                                          const rocblas_int* x_ind,
+                                          rocblas_stride     stride_ind,
+                                          T*                 y,
+                                          rocblas_stride     stride_y,
+                                          rocblas_int        batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(
+                handle, name, nnz, x_val, stride_x, x_ind, stride_ind, y, stride_y, batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, name, "nnz", nnz, "batch_count", batch_count);
+
+        if(nnz < 0 || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        // Quick return if possible.
+        if(!nnz || !batch_count)
+            return rocblas_status_success;
+
+        if(!x_val || !x_ind || !y)
+            return rocblas_status_invalid_pointer;
+
+        dim3 grid((nnz - 1) / NB + 1, batch_count);
+        if constexpr(GATHER)
+        {
+            hipLaunchKernelGGL((rocblas_gthr_kernel<NB>),
+                               grid,
+                               dim3(NB),
+                               0,
+                               handle->get_stream(),
+                               nnz,
+                               x_val,
+                               stride_x,
+                               x_ind,
+                               stride_ind,
+                               (const T*)y,
+                               stride_y);
+
+            if(handle->check_numerics)
+                return rocblas_sparse_level1_check_numerics(
+                    name, handle, nnz, (const T*)x_val, stride_x, batch_count, false);
+        }
+        else
+        {
+            if(handle->check_numerics)
+                RETURN_IF_ROCBLAS_ERROR(rocblas_sparse_level1_check_numerics(
+                    name, handle, nnz, (const T*)x_val, stride_x, batch_count, true));
+
+            hipLaunchKernelGGL((rocblas_sctr_kernel<NB>),
+                               grid,
+                               dim3(NB),
+                               0,
+                               handle->get_stream(),
+                               nnz,
+                               (const T*)x_val,
+                               stride_x,
+                               x_ind,
+                               stride_ind,
+                               y,
+                               stride_y);
+        }
+
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_roti_impl(const char*        name,
+                                     rocblas_handle     handle,
+                                     rocblas_int        nnz,
+                                     T*                 x_val,
+                                     rocblas_stride     stride_x,
+                                     const rocblas_int* x_ind,
+                                     rocblas_stride     stride_ind,
+                                     T*                 y,
+                                     rocblas_stride     stride_y,
+                                     const T*           c,
+                                     const T*           s,
+                                     rocblas_int        batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      name,
+                      nnz,
+                      x_val,
+                      stride_x,
+                      x_ind,
+                      stride_ind,
+                      y,
+                      stride_y,
+                      c,
+                      s,
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, name, "nnz", nnz, "batch_count", batch_count);
+
+        if(nnz < 0 || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        // Quick return if possible.
+        if(!nnz || !batch_count)
+            return rocblas_status_success;
+
+        if(!x_val || !x_ind || !y || !c || !s)
+            return rocblas_status_invalid_pointer;
+
+        auto check_x = [&](bool is_input) {
+            return rocblas_sparse_level1_check_numerics(
+                name, handle, nnz, (const T*)x_val, stride_x, batch_count, is_input);
+        };
+
+        if(handle->check_numerics)
+            RETURN_IF_ROCBLAS_ERROR(check_x(true));
+
+        dim3 grid((nnz - 1) / NB + 1, batch_count);
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            hipLaunchKernelGGL((rocblas_roti_kernel<NB>),
+                               grid,
+                               dim3(NB),
+                               0,
+                               handle->get_stream(),
+                               nnz,
+                               x_val,
+                               stride_x,
+                               x_ind,
+                               stride_ind,
+                               y,
+                               stride_y,
+                               c,
+                               s);
+        else
+            hipLaunchKernelGGL((rocblas_roti_kernel<NB>),
+                               grid,
+                               dim3(NB),
+                               0,
+                               handle->get_stream(),
+                               nnz,
+                               x_val,
+                               stride_x,
+                               x_ind,
+                               stride_ind,
+                               y,
+                               stride_y,
+                               *c,
+                               *s);
+
+        if(handle->check_numerics)
+            return check_x(false);
+        return rocblas_status_success;
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                                \
+    rocblas_status routine_name_(rocblas_handle     handle,                                    \
+                                 rocblas_int        nnz,                                       \
+                                 const T_*          alpha,                                     \
+                                 const T_*          x_val,                                     \
+                                 const rocblas_int* x_ind,                                     \
+                                 T_*                y)                                         \
+    try                                                                                        \
+    {                                                                                          \
+        return rocblas_axpyi_impl(                                                             \
+            #routine_name_, handle, nnz, alpha, x_val, 0, x_ind, 0, y, 0, 1);                  \
+    }                                                                                          \
+    catch(...)                                                                                 \
+    {                                                                                          \
+        return exception_to_rocblas_status();                                                  \
+    }                                                                                          \
+                                                                                               \
+    rocblas_status routine_name_##_strided_batched(rocblas_handle     handle,                  \
+                                                   rocblas_int        nnz,                     \
+                                                   const T_*          alpha,                   \
+                                                   const T_*          x_val,                   \
+                                                   rocblas_stride     stride_x,                \
+                                                   const rocblas_int* x_ind,                   \
+                                                   rocblas_stride     stride_ind,              \
+                                                   T_*                y,                       \
+                                                   rocblas_stride     stride_y,                \
+                                                   rocblas_int        batch_count)             \
+    try                                                                                        \
+    {                                                                                          \
+        return rocblas_axpyi_impl(#routine_name_ "_strided_batched",                           \
+                                  handle,                                                      \
+                                  nnz,                                                         \
+                                  alpha,                                                       \
+                                  x_val,                                                       \
+                                  stride_x,                                                    \
+                                  x_ind,                                                       \
+                                  stride_ind,                                                  \
+                                  y,                                                           \
+                                  stride_y,                                                    \
+                                  batch_count);                                                \
+    }                                                                                          \
+    catch(...)                                                                                 \
+    {                                                                                          \
+        return exception_to_rocblas_status();                                                  \
+    }
+
+IMPL(rocblas_saxpyi, float);
+IMPL(rocblas_daxpyi, double);
+IMPL(rocblas_caxpyi, rocblas_float_complex);
+IMPL(rocblas_zaxpyi, rocblas_double_complex);
+
+#undef IMPL
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, CONJ_, T_)                                                    \
+    rocblas_status routine_name_(rocblas_handle     handle,                               \
+                                 rocblas_int        nnz,                                  \
+                                 const T_*          x_val,                                \
+                                 const rocblas_int* x_ind,                                \
+                                 const T_*          y,                                    \
+                                 T_*                result)                               \
+    try                                                                                   \
+    {                                                                                     \
+        return rocblas_doti_impl<CONJ_>(                                                  \
+            #routine_name_, handle, nnz, x_val, 0, x_ind, 0, y, 0, 1, result);            \
+    }                                                                                     \
+    catch(...)                                                                            \
+    {                                                                                     \
+        return exception_to_rocblas_status();                                             \
+    }                                                                                     \
+                                                                                          \
+    rocblas_status routine_name_##_strided_batched(rocblas_handle     handle,             \
+                                                   rocblas_int        nnz,                \
+                                                   const T_*          x_val,              \
+                                                   rocblas_stride     stride_x,           \
+                                                   const rocblas_int* x_ind,              \
+                                                   rocblas_stride     stride_ind,         \
+                                                   const T_*          y,                  \
+                                                   rocblas_stride     stride_y,           \
+                                                   rocblas_int        batch_count,        \
+                                                   T_*                result)             \
+    try                                                                                   \
+    {                                                                                     \
+        return rocblas_doti_impl<CONJ_>(#routine_name_ "_strided_batched",                \
+                                        handle,                                           \
+                                        nnz,                                              \
+                                        x_val,                                            \
+                                        stride_x,                                         \
+                                        x_ind,                                            \
+                                        stride_ind,                                       \
+                                        y,                                                \
+                                        stride_y,                                         \
+                                        batch_count,                                      \
+                                        result);                                          \
+    }                                                                                     \
+    catch(...)                                                                            \
+    {                                                                                     \
+        return exception_to_rocblas_status();                                             \
+    }
+
+IMPL(rocblas_sdoti, false, float);
+IMPL(rocblas_ddoti, false, double);
+IMPL(rocblas_cdoti, false, rocblas_float_complex);
+IMPL(rocblas_zdoti, false, rocblas_double_complex);
+IMPL(rocblas_cdotci, true, rocblas_float_complex);
+IMPL(rocblas_zdotci, true, rocblas_double_complex);
+
+#undef IMPL
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, GATHER_, XCONST_, YCONST_, T_)                                \
+    rocblas_status routine_name_(rocblas_handle     handle,                               \
+                                 rocblas_int        nnz,                                  \
+                                 XCONST_ T_*        x_val,                                \
+                                 const rocblas_int* x_ind,                                \
+                                 YCONST_ T_*        y)                                    \
+    try                                                                                   \
+    {                                                                                     \
+        return rocblas_gthr_sctr_impl<GATHER_>(                                           \
+            #routine_name_, handle, nnz, (T_*)x_val, 0, x_ind, 0, (T_*)y, 0, 1);          \
+    }                                                                                     \
+    catch(...)                                                                            \
+    {                                                                                     \
+        return exception_to_rocblas_status();                                             \
+    }                                                                                     \
+                                                                                          \
+    rocblas_status routine_name_##_strided_batched(rocblas_handle     handle,             \
+                                                   rocblas_int        nnz,                \
+                                                   XCONST_ T_*        x_val,              \
+                                                   rocblas_stride     stride_x,           \
+                                                   const rocblas_int* x_ind,              \
+                                                   rocblas_stride     stride_ind,         \
+                                                   YCONST_ T_*        y,                  \
+                                                   rocblas_stride     stride_y,           \
+                                                   rocblas_int        batch_count)        \
+    try                                                                                   \
+    {                                                                                     \
+        return rocblas_gthr_sctr_impl<GATHER_>(#routine_name_ "_strided_batched",         \
+                                               handle,                                    \
+                                               nnz,                                       \
+                                               (T_*)x_val,                                \
+                                               stride_x,                                  \
+                                               x_ind,                                     \
+                                               stride_ind,                                \
+                                               (T_*)y,                                    \
+                                               stride_y,                                  \
+                                               batch_count);                              \
+    }                                                                                     \
+    catch(...)                                                                            \
+    {                                                                                     \
+        return exception_to_rocblas_status();                                             \
+    }
+
+IMPL(rocblas_sgthr, true, , const, float);
+IMPL(rocblas_dgthr, true, , const, double);
+IMPL(rocblas_cgthr, true, , const, rocblas_float_complex);
+IMPL(rocblas_zgthr, true, , const, rocblas_double_complex);
+IMPL(rocblas_ssctr, false, const, , float);
+IMPL(rocblas_dsctr, false, const, , double);
+IMPL(rocblas_csctr, false, const, , rocblas_float_complex);
+IMPL(rocblas_zsctr, false, const, , rocblas_double_complex);
+
+#undef IMPL
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                                 \
+    rocblas_status routine_name_(rocblas_handle     handle,                                     \
+                                 rocblas_int        nnz,                                        \
+                                 T_*                x_val,                                      \
+                                 const rocblas_int* x_ind,                                      \
+                                 T_*                y,                                          \
+                                 const T_*          c,                                          \
+                                 const T_*          s)                                          \
+    try                                                                                         \
+    {                                                                                           \
+        return rocblas_roti_impl(#routine_name_, handle, nnz, x_val, 0, x_ind, 0, y, 0, c, s, 1); \
+    }                                                                                           \
+    catch(...)                                                                                  \
+    {                                                                                           \
+        return exception_to_rocblas_status();                                                   \
+    }                                                                                           \
+                                                                                                \
+    rocblas_status routine_name_##_strided_batched(rocblas_handle     handle,                   \
+                                                   rocblas_int        nnz,                      \
+                                                   T_*                x_val,                    \
+                                                   rocblas_stride     stride_x,                 \
+                                                   const rocblas_int* x_ind,                    \
+                                                   rocblas_stride     stride_ind,               \
+                                                   T_*                y,                        \
+                                                   rocblas_stride     stride_y,                 \
+                                                   const T_*          c,                        \
+                                                   const T_*          s,                        \
+                                                   rocblas_int        batch_count)              \
+    try                                                                                         \
+    {                                                                                           \
+        return rocblas_roti_impl(#routine_name_ "_strided_batched",                             \
+                                 handle,                                                        \
+                                 nnz,                                                           \
+                                 x_val,                                                         \
+                                 stride_x,                                                      \
+                                 x_ind,                                                         \
+                                 stride_ind,                                                    \
+                                 y,                                                             \
+                                 stride_y,                                                      \
+                                 c,                                                             \
+                                 s,                                                             \
+                                 batch_count);                                                  \
+    }                                                                                           \
+    catch(...)                                                                                  \
+    {                                                                                           \
+        return exception_to_rocblas_status();                                                   \
+    }
+
+IMPL(rocblas_sroti, float);
+IMPL(rocblas_droti, double);
+
+#undef IMPL
+
+} // extern "C"
@@ -20,6 +20,7 @@
  *
  * ************************************************************************ */
 #include "rocblas_swap.hpp"
+#include "int64_helpers.hpp"
 #include "logging.hpp"
 #include "rocblas_block_sizes.h"
 #include "utility.hpp"
@@ -48,7 +49,7 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_swap_name<T>, n, x, incx, y, incy);
@@ -122,6 +123,28 @@ namespace
         return status;
     }
 
+    template <rocblas_int NB, typename T>
+    rocblas_status rocblas_swap_64_impl(
+        rocblas_handle handle, int64_t n, T* x, int64_t incx, T* y, int64_t incy)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        auto swap_chunk = [&](int64_t     offset_x,
+                              int64_t     offset_y,
+                              rocblas_int n_c,
+                              rocblas_int incx_c,
+                              rocblas_int incy_c) {
+            return rocblas_swap_impl<NB>(handle,
+                                         n_c,
+                                         rocblas_chunk_ptr_64(x, offset_x),
+                                         incx_c,
+                                         rocblas_chunk_ptr_64(y, offset_y),
+                                         incy_c);
+        };
+        return rocblas_chunk_vectors_64(handle, n, incx, incy, swap_chunk);
+    }
+
 } // namespace
 
 /* ============================================================================================ */
@@ -186,4 +209,27 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                     \
+    rocblas_status routine_name_(                                                   \
+        rocblas_handle handle, int64_t n, T_* x, int64_t incx, T_* y, int64_t incy) \
+    try                                                                             \
+    {                                                                               \
+        return rocblas_swap_64_impl<ROCBLAS_SWAP_NB>(handle, n, x, incx, y, incy);  \
+    }                                                                               \
+    catch(...)                                                                      \
+    {                                                                               \
+        return exception_to_rocblas_status();                                       \
+    }
+
+IMPL(rocblas_sswap_64, float);
+IMPL(rocblas_dswap_64, double);
+IMPL(rocblas_cswap_64, rocblas_float_complex);
+IMPL(rocblas_zswap_64, rocblas_double_complex);
+
+#undef IMPL
+
 } // extern "C"
@@ -22,6 +22,8 @@
 
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
+#include "rocblas_dwordx4.hpp"
+#include "rocblas_level1_launch.hpp"
 #include "rocblas_swap.hpp"
 
 template <typename T>
@@ -44,42 +46,40 @@ rocblas_swap_kernel(rocblas_int    n,
                     rocblas_int    incy,
                     rocblas_stride stridey)
 {
-    auto*     x   = load_ptr_batch(xa, blockIdx.y, offsetx, stridex);
-    auto*     y   = load_ptr_batch(ya, blockIdx.y, offsety, stridey);
-    ptrdiff_t tid = blockIdx.x * blockDim.x + threadIdx.x;
+    auto* x = load_ptr_batch(xa, blockIdx.y, offsetx, stridex);
+    auto* y = load_ptr_batch(ya, blockIdx.y, offsety, stridey);
 
-    if(tid < n)
+    for(ptrdiff_t tid = blockIdx.x * blockDim.x + threadIdx.x; tid < n;
+        tid += ptrdiff_t(gridDim.x) * blockDim.x)
     {
         rocblas_swap_vals(x + tid * incx, y + tid * incy);
     }
 }
 
-//! @brief Optimized kernel for the floating points.
+//! @brief Optimized kernel (batched, strided batched) of swap with unit increments, using 128-bit
+//!        loads and stores for the aligned part of the vectors, nontemporal if nontemporal.
 //!
 template <rocblas_int NB, typename UPtr>
 ROCBLAS_KERNEL(NB)
-rocblas_sswap_2_kernel(rocblas_int n,
-                       UPtr __restrict__ xa,
-                       rocblas_stride offsetx,
-                       rocblas_stride stridex,
-                       UPtr __restrict__ ya,
-                       rocblas_stride offsety,
-                       rocblas_stride stridey)
+rocblas_swap_dwordx4_kernel(rocblas_int n,
+                            bool        nontemporal,
+                            UPtr __restrict__ xa,
+                            rocblas_stride offsetx,
+                            rocblas_stride stridex,
+                            UPtr __restrict__ ya,
+                            rocblas_stride offsety,
+                            rocblas_stride stridey)
 {
-    ptrdiff_t tid = (blockIdx.x * blockDim.x + threadIdx.x) * 2;
-    auto*     x   = load_ptr_batch(xa, blockIdx.y, offsetx, stridex);
-    auto*     y   = load_ptr_batch(ya, blockIdx.y, offsety, stridey);
-    if(tid < n - 1)
-    {
-        for(rocblas_int j = 0; j < 2; ++j)
-        {
-            rocblas_swap_vals(x + tid + j, y + tid + j);
-        }
-    }
-    if(n % 2 != 0 && tid == n - 1)
-    {
-        rocblas_swap_vals(x + tid, y + tid);
-    }
+    auto* x = load_ptr_batch(xa, blockIdx.y, offsetx, stridex);
+    auto* y = load_ptr_batch(ya, blockIdx.y, offsety, stridey);
+
+    rocblas_dwordx4_apply<true, true>(blockIdx.x * blockDim.x + threadIdx.x,
+                                      ptrdiff_t(gridDim.x) * blockDim.x,
+                                      n,
+                                      nontemporal,
+                                      x,
+                                      y,
+                                      [](auto& xi, auto& yi) { rocblas_swap_vals(&xi, &yi); });
 }
 
 template <rocblas_int NB, typename T>
@@ -99,17 +99,15 @@ rocblas_status rocblas_swap_template(rocblas_handle handle,
     if(n <= 0 || batch_count <= 0)
         return rocblas_status_success;
 
-    static constexpr bool using_rocblas_float
-        = std::is_same<T, rocblas_float*>{} || std::is_same<T, rocblas_float* const*>{};
-
-    if(!using_rocblas_float || incx != 1 || incy != 1)
+    if(incx != 1 || incy != 1)
     {
         // in case of negative inc shift pointer to end of data for negative indexing tid*inc
         ptrdiff_t shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
         ptrdiff_t shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
 
-        dim3 blocks((n - 1) / NB + 1, batch_count);
-        dim3 threads(NB);
+        rocblas_level1_launch<NB> launch(handle, n, batch_count);
+        dim3                      blocks  = launch.grid;
+        dim3                      threads = launch.threads;
 
         hipLaunchKernelGGL((rocblas_swap_kernel<NB>),
                            blocks,
@@ -128,25 +126,26 @@ rocblas_status rocblas_swap_template(rocblas_handle handle,
     }
     else
     {
-        // Kernel function for improving the performance of SSWAP when incx==1 and incy==1
-        ptrdiff_t shiftx = offsetx - 0;
-        ptrdiff_t shifty = offsety - 0;
+        // Kernel function for improving the performance of SWAP when incx==1 and incy==1, using
+        // 128-bit loads and stores of the aligned part of x and y, nontemporal beyond the L2
+        rocblas_level1_launch<NB> launch(handle, rocblas_dwordx4_count<T>(n), batch_count);
+        dim3                      grid    = launch.grid;
+        dim3                      threads = launch.threads;
 
-        int  blocks = 1 + ((n - 1) / (NB * 2));
-        dim3 grid(blocks, batch_count);
-        dim3 threads(NB);
+        bool nontemporal = rocblas_level1_nontemporal<T>(handle, n, 2, batch_count);
 
-        hipLaunchKernelGGL((rocblas_sswap_2_kernel<NB>),
+        hipLaunchKernelGGL((rocblas_swap_dwordx4_kernel<NB>),
                            grid,
                            threads,
                            0,
                            handle->get_stream(),
                            n,
+                           nontemporal,
                            x,
-                           shiftx,
+                           offsetx,
                            stridex,
                            y,
-                           shifty,
+                           offsety,
                            stridey);
     }
     return rocblas_status_success;
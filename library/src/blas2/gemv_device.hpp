@@ -55,6 +55,63 @@
 #include "../blas1/rocblas_reduction.hpp"
 // uses recursive folding reduction
 #include "../blas1/reduction.hpp"
+// uses reproducible block sums
+#include "../blas1/rocblas_reproducible.hpp"
+// uses 128-bit loads of the mixed precision matrices
+#include "../blas1/rocblas_dwordx4.hpp"
+
+// Reproducible gemv: one block of NB threads per element of y computes the dot product of its
+// row of op(A) with x with the reproducible block sum, so that y does not depend on the device.
+template <rocblas_int NB, bool TRANS, bool CONJ, typename T, typename U, typename V, typename W>
+ROCBLAS_KERNEL(NB)
+rocblas_gemv_reproducible_kernel(rocblas_int    m,
+                                 rocblas_int    n,
+                                 U              alpha_device_host,
+                                 rocblas_stride stride_alpha,
+                                 const V*       Aa,
+                                 rocblas_stride shifta,
+                                 rocblas_int    lda,
+                                 rocblas_stride strideA,
+                                 const V*       xa,
+                                 rocblas_stride shiftx,
+                                 rocblas_int    incx,
+                                 rocblas_stride stridex,
+                                 U              beta_device_host,
+                                 rocblas_stride stride_beta,
+                                 W*             ya,
+                                 rocblas_stride shifty,
+                                 rocblas_int    incy,
+                                 rocblas_stride stridey)
+{
+#pragma clang fp contract(off)
+    auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
+    auto beta  = load_scalar(beta_device_host, blockIdx.y, stride_beta);
+    if(!alpha && beta == 1)
+        return;
+
+    const auto* A = load_ptr_batch(Aa, blockIdx.y, shifta, strideA);
+    const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+    auto*       y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    ptrdiff_t row = blockIdx.x;
+
+    T dot = 0;
+    if(alpha)
+        dot = rocblas_reproducible_block_dot<NB, T, T>(
+            TRANS ? m : n,
+            [=](int64_t k) {
+                return conj_if_true<CONJ>(T(TRANS ? A[row * lda + k] : A[row + k * lda]));
+            },
+            [=](int64_t k) { return T(x[k * incx]); });
+
+    if(threadIdx.x == 0)
+    {
+        if(beta == 0)
+            y[row * incy] = alpha * dot;
+        else
+            y[row * incy] = alpha * dot + beta * y[row * incy];
+    }
+}
 
 template <rocblas_int NB, typename T, typename Ta, typename Tx>
 ROCBLAS_KERNEL(NB)
@@ -85,6 +142,37 @@ rocblas_gemv_scal_kernel(rocblas_int    n,
     }
 }
 
+// Deterministic reduction of the n_sums partial sums per element of y written to the workspace
+// by the double buffered gemvt kernel when atomics are not allowed, with y = beta * y + sum
+template <rocblas_int NB, typename T, typename Ta, typename Tx>
+ROCBLAS_KERNEL(NB)
+rocblas_gemvt_double_buffered_reduce(rocblas_int    n,
+                                     rocblas_int    n_sums,
+                                     Ta             beta_device_host,
+                                     rocblas_stride stride_beta,
+                                     Tx             ya,
+                                     rocblas_stride offset_y,
+                                     rocblas_int    incy,
+                                     rocblas_stride stride_y,
+                                     const T* __restrict__ workspace)
+{
+    ptrdiff_t tid = blockIdx.x * blockDim.x + threadIdx.x;
+    if(tid >= n)
+        return;
+
+    auto* __restrict__ y = load_ptr_batch(ya, blockIdx.y, offset_y, stride_y);
+    auto beta            = load_scalar(beta_device_host, blockIdx.y, stride_beta);
+
+    // partial sums of batch blockIdx.y, one row of n per workgroup of the block column
+    workspace += size_t(n_sums) * n * blockIdx.y + tid;
+
+    T sum{0};
+    for(rocblas_int i = 0; i < n_sums; i++)
+        sum += workspace[size_t(i) * n];
+
+    y[tid * incy] = beta ? y[tid * incy] * beta + sum : sum;
+}
+
 template <int DIM_X,
           int DIM_Y,
           int elements_per_thread,
@@ -217,7 +305,8 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_double_buffered_kernel_calc(rocblas_int ro
                                                                   const T* __restrict__ x,
                                                                   rocblas_int incx,
                                                                   T* __restrict__ y,
-                                                                  rocblas_int incy)
+                                                                  rocblas_int incy,
+                                                                  T* __restrict__ workspace)
 {
     const int tx  = threadIdx.x;
     const int ty  = threadIdx.y;
@@ -249,7 +338,12 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_double_buffered_kernel_calc(rocblas_int ro
     }
 
     if(count == 0)
+    {
+        // the reduction of the partial sums still reads those of this workgroup
+        if(workspace && ty == 0)
+            workspace[size_t(by) * cols + bx * DIM_X + tx] = T(0);
         return;
+    }
 
     const int j = ty_ * elements_per_thread * lda + tx_;
 
@@ -302,7 +396,10 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_double_buffered_kernel_calc(rocblas_int ro
         for(int k = tx; k < tx + (DIM_X / 2); k++)
             treg[0] += la[tx * (DIM_X / 2) + (k % (DIM_X / 2))];
 
-        atomicAdd(&y[tx * incy], (treg[0] * alpha));
+        if(workspace)
+            workspace[size_t(by) * cols + bx * DIM_X + tx] = treg[0] * alpha;
+        else
+            atomicAdd(&y[tx * incy], (treg[0] * alpha));
     }
 }
 
@@ -319,7 +416,8 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_double_buffered_kernel_calc(rocblas_int ro
                                                                   const T* __restrict__ x,
                                                                   rocblas_int incx,
                                                                   T* __restrict__ y,
-                                                                  rocblas_int incy)
+                                                                  rocblas_int incy,
+                                                                  T* __restrict__ workspace)
 {
 }
 
@@ -338,7 +436,9 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int m,
                                                   rocblas_int incx,
                                                   U           beta,
                                                   T*          y,
-                                                  rocblas_int incy)
+                                                  rocblas_int incy,
+                                                  rocblas_int block,
+                                                  bool        stream_A = false)
 {
     rocblas_int thread_id = threadIdx.x + threadIdx.y * blockDim.x;
 
@@ -346,13 +446,16 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int m,
     {
         if(thread_id < DIM_X * 4)
         {
-            rocblas_int ind = blockIdx.x * DIM_X * 4 + thread_id;
+            rocblas_int ind = block * DIM_X * 4 + thread_id;
             if(ind < m)
                 y[ind * incy] = beta ? beta * y[ind * incy] : 0;
         }
         return;
     }
 
+    // A is read with nontemporal loads when it is streamed past persisting data
+    auto load_A = [&](auto i) { return load_nontemporal_if(stream_A, A + i); };
+
     // threads are all configurated locally
     rocblas_int tx = threadIdx.x;
     rocblas_int ty = threadIdx.y;
@@ -366,7 +469,7 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int m,
 
     res_A[0] = res_A[1] = res_A[2] = res_A[3] = T{0};
 
-    ind = blockIdx.x * DIM_X * 4 + tx;
+    ind = block * DIM_X * 4 + tx;
 
     rocblas_int n_tail = n % (4 * DIM_Y);
     rocblas_int col;
@@ -380,31 +483,31 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int m,
 
         if(ind < m)
         {
-            res_A[0] += A[ind + (col + 0) * lda] * res_x[0];
-            res_A[0] += A[ind + (col + 1) * lda] * res_x[1];
-            res_A[0] += A[ind + (col + 2) * lda] * res_x[2];
-            res_A[0] += A[ind + (col + 3) * lda] * res_x[3];
+            res_A[0] += load_A(ind + (col + 0) * lda) * res_x[0];
+            res_A[0] += load_A(ind + (col + 1) * lda) * res_x[1];
+            res_A[0] += load_A(ind + (col + 2) * lda) * res_x[2];
+            res_A[0] += load_A(ind + (col + 3) * lda) * res_x[3];
 
             if(ind + DIM_X < m)
             {
-                res_A[1] += A[ind + DIM_X + (col + 0) * lda] * res_x[0];
-                res_A[1] += A[ind + DIM_X + (col + 1) * lda] * res_x[1];
-                res_A[1] += A[ind + DIM_X + (col + 2) * lda] * res_x[2];
-                res_A[1] += A[ind + DIM_X + (col + 3) * lda] * res_x[3];
+                res_A[1] += load_A(ind + DIM_X + (col + 0) * lda) * res_x[0];
+                res_A[1] += load_A(ind + DIM_X + (col + 1) * lda) * res_x[1];
+                res_A[1] += load_A(ind + DIM_X + (col + 2) * lda) * res_x[2];
+                res_A[1] += load_A(ind + DIM_X + (col + 3) * lda) * res_x[3];
 
                 if(ind + 2 * DIM_X < m)
                 {
-                    res_A[2] += A[ind + 2 * DIM_X + (col + 0) * lda] * res_x[0];
-                    res_A[2] += A[ind + 2 * DIM_X + (col + 1) * lda] * res_x[1];
-                    res_A[2] += A[ind + 2 * DIM_X + (col + 2) * lda] * res_x[2];
-                    res_A[2] += A[ind + 2 * DIM_X + (col + 3) * lda] * res_x[3];
+                    res_A[2] += load_A(ind + 2 * DIM_X + (col + 0) * lda) * res_x[0];
+                    res_A[2] += load_A(ind + 2 * DIM_X + (col + 1) * lda) * res_x[1];
+                    res_A[2] += load_A(ind + 2 * DIM_X + (col + 2) * lda) * res_x[2];
+                    res_A[2] += load_A(ind + 2 * DIM_X + (col + 3) * lda) * res_x[3];
 
                     if(ind + 3 * DIM_X < m)
                     {
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 0) * lda] * res_x[0];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 1) * lda] * res_x[1];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 2) * lda] * res_x[2];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 3) * lda] * res_x[3];
+                        res_A[3] += load_A(ind + 3 * DIM_X + (col + 0) * lda) * res_x[0];
+                        res_A[3] += load_A(ind + 3 * DIM_X + (col + 1) * lda) * res_x[1];
+                        res_A[3] += load_A(ind + 3 * DIM_X + (col + 2) * lda) * res_x[2];
+                        res_A[3] += load_A(ind + 3 * DIM_X + (col + 3) * lda) * res_x[3];
                     }
                 }
             }
@@ -436,31 +539,39 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int m,
 
         if(ind < m)
         {
-            res_A[0] += A[ind + (col + 0) * lda * (col + 0 < n)] * res_x[0];
-            res_A[0] += A[ind + (col + 1) * lda * (col + 1 < n)] * res_x[1];
-            res_A[0] += A[ind + (col + 2) * lda * (col + 2 < n)] * res_x[2];
-            res_A[0] += A[ind + (col + 3) * lda * (col + 3 < n)] * res_x[3];
+            res_A[0] += load_A(ind + (col + 0) * lda * (col + 0 < n)) * res_x[0];
+            res_A[0] += load_A(ind + (col + 1) * lda * (col + 1 < n)) * res_x[1];
+            res_A[0] += load_A(ind + (col + 2) * lda * (col + 2 < n)) * res_x[2];
+            res_A[0] += load_A(ind + (col + 3) * lda * (col + 3 < n)) * res_x[3];
 
             if(ind + DIM_X < m)
             {
-                res_A[1] += A[ind + DIM_X + (col + 0) * lda * (col + 0 < n)] * res_x[0];
-                res_A[1] += A[ind + DIM_X + (col + 1) * lda * (col + 1 < n)] * res_x[1];
-                res_A[1] += A[ind + DIM_X + (col + 2) * lda * (col + 2 < n)] * res_x[2];
-                res_A[1] += A[ind + DIM_X + (col + 3) * lda * (col + 3 < n)] * res_x[3];
+                res_A[1] += load_A(ind + DIM_X + (col + 0) * lda * (col + 0 < n)) * res_x[0];
+                res_A[1] += load_A(ind + DIM_X + (col + 1) * lda * (col + 1 < n)) * res_x[1];
+                res_A[1] += load_A(ind + DIM_X + (col + 2) * lda * (col + 2 < n)) * res_x[2];
+                res_A[1] += load_A(ind + DIM_X + (col + 3) * lda * (col + 3 < n)) * res_x[3];
 
                 if(ind + 2 * DIM_X < m)
                 {
-                    res_A[2] += A[ind + 2 * DIM_X + (col + 0) * lda * (col + 0 < n)] * res_x[0];
-                    res_A[2] += A[ind + 2 * DIM_X + (col + 1) * lda * (col + 1 < n)] * res_x[1];
-                    res_A[2] += A[ind + 2 * DIM_X + (col + 2) * lda * (col + 2 < n)] * res_x[2];
-                    res_A[2] += A[ind + 2 * DIM_X + (col + 3) * lda * (col + 3 < n)] * res_x[3];
+                    res_A[2]
+                        += load_A(ind + 2 * DIM_X + (col + 0) * lda * (col + 0 < n)) * res_x[0];
+                    res_A[2]
+                        += load_A(ind + 2 * DIM_X + (col + 1) * lda * (col + 1 < n)) * res_x[1];
+                    res_A[2]
+                        += load_A(ind + 2 * DIM_X + (col + 2) * lda * (col + 2 < n)) * res_x[2];
+                    res_A[2]
+                        += load_A(ind + 2 * DIM_X + (col + 3) * lda * (col + 3 < n)) * res_x[3];
 
                     if(ind + 3 * DIM_X < m)
                     {
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 0) * lda * (col + 0 < n)] * res_x[0];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 1) * lda * (col + 1 < n)] * res_x[1];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 2) * lda * (col + 2 < n)] * res_x[2];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 3) * lda * (col + 3 < n)] * res_x[3];
+                        res_A[3]
+                            += load_A(ind + 3 * DIM_X + (col + 0) * lda * (col + 0 < n)) * res_x[0];
+                        res_A[3]
+                            += load_A(ind + 3 * DIM_X + (col + 1) * lda * (col + 1 < n)) * res_x[1];
+                        res_A[3]
+                            += load_A(ind + 3 * DIM_X + (col + 2) * lda * (col + 2 < n)) * res_x[2];
+                        res_A[3]
+                            += load_A(ind + 3 * DIM_X + (col + 3) * lda * (col + 3 < n)) * res_x[3];
                     }
                 }
             }
@@ -479,7 +590,7 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int m,
         for(rocblas_int i = 1; i < DIM_Y; i++)
             sdata[thread_id] += sdata[thread_id + DIM_X * 4 * i];
 
-        ind = blockIdx.x * DIM_X * 4 + thread_id;
+        ind = block * DIM_X * 4 + thread_id;
 
         if(ind < m)
             y[ind * incy]
@@ -499,7 +610,9 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int
                                                   rocblas_int                   incx,
                                                   U                             beta,
                                                   rocblas_double_complex*       y,
-                                                  rocblas_int                   incy)
+                                                  rocblas_int                   incy,
+                                                  rocblas_int                   block,
+                                                  bool                          stream_A = false)
 {
     rocblas_int thread_id = threadIdx.x + threadIdx.y * blockDim.x;
 
@@ -507,18 +620,21 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int
     {
         if(thread_id < DIM_X)
         {
-            rocblas_int ind = blockIdx.x * DIM_X + thread_id;
+            rocblas_int ind = block * DIM_X + thread_id;
             if(ind < m)
                 y[ind * incy] = beta ? beta * y[ind * incy] : 0;
         }
         return;
     }
 
+    // A is read with nontemporal loads when it is streamed past persisting data
+    auto load_A = [&](auto i) { return load_nontemporal_if(stream_A, A + i); };
+
     // threads are all configurated locally
     rocblas_int tx = thread_id % DIM_X;
     rocblas_int ty = thread_id / DIM_X;
 
-    rocblas_int ind = blockIdx.x * DIM_X + tx;
+    rocblas_int ind = block * DIM_X + tx;
 
     __shared__ rocblas_double_complex sdata[DIM_X * DIM_Y];
 
@@ -535,7 +651,7 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int
 
         if(ind < m)
         {
-            res_A += A[ind + col * lda] * x[col * incx];
+            res_A += load_A(ind + col * lda) * x[col * incx];
         }
     }
 
@@ -549,7 +665,7 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int
 
         if(ind < m)
         {
-            res_A += A[ind + (col)*lda * (col < n)] * res_x;
+            res_A += load_A(ind + (col)*lda * (col < n)) * res_x;
         }
     }
 
@@ -563,7 +679,7 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int
         for(rocblas_int i = 1; i < DIM_Y; i++)
             sdata[thread_id] += sdata[thread_id + DIM_X * i];
 
-        ind = blockIdx.x * DIM_X + thread_id;
+        ind = block * DIM_X + thread_id;
 
         if(ind < m)
         {
@@ -583,10 +699,12 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_kernel_calc(rocblas_int m,
                                                   rocblas_int incx,
                                                   U           beta,
                                                   T*          y,
-                                                  rocblas_int incy)
+                                                  rocblas_int incy,
+                                                  rocblas_int block,
+                                                  bool        stream_A = false)
 {
     rocblas_int tx  = threadIdx.x;
-    rocblas_int col = blockIdx.x;
+    rocblas_int col = block;
 
     if(!alpha)
     {
@@ -600,6 +718,9 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_kernel_calc(rocblas_int m,
 
     A += col * size_t(lda);
 
+    // A is read with nontemporal loads when it is streamed past persisting data
+    auto load_A = [&](auto i) { return load_nontemporal_if(stream_A, A + i); };
+
     T res = 0;
 
     __shared__ T sdata[NB_X];
@@ -608,10 +729,10 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_kernel_calc(rocblas_int m,
     rocblas_int m_full = (m / NB_X) * NB_X;
 
     for(rocblas_int i = 0; i < m_full; i += NB_X)
-        res += (CONJ ? conj(A[i]) : A[i]) * x[(tx + i) * incx];
+        res += (CONJ ? conj(load_A(i)) : load_A(i)) * x[(tx + i) * incx];
 
     if(tx + m_full < m)
-        res += (CONJ ? conj(A[m_full]) : A[m_full]) * x[(tx + m_full) * incx];
+        res += (CONJ ? conj(load_A(m_full)) : load_A(m_full)) * x[(tx + m_full) * incx];
 
     sdata[tx] = res;
 
@@ -651,7 +772,8 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_warp_reduce_kernel_calc(rocblas_int m,
                                                               rocblas_int incx,
                                                               U           beta,
                                                               T* __restrict__ y,
-                                                              rocblas_int incy)
+                                                              rocblas_int incy,
+                                                              bool        stream_A = false)
 {
     rocblas_int tx  = threadIdx.x;
     rocblas_int col = blockIdx.x;
@@ -669,6 +791,9 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_warp_reduce_kernel_calc(rocblas_int m,
     //Each BlockIdx.x takes care of each column of matrix A
     A += col * size_t(lda);
 
+    // A is read with nontemporal loads when it is streamed past persisting data
+    auto load_A = [&](auto i) { return load_nontemporal_if(stream_A, A + i); };
+
     T res = 0;
 
     // partial sums
@@ -677,10 +802,10 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_warp_reduce_kernel_calc(rocblas_int m,
     //Each column of Matrix A is multiplied with vector x and the resultant value is stored in res.
     //If m > NB_X, then the threads are reused and the multiplied values will be accumalated.
     for(rocblas_int i = 0; tx + i < m_full; i += NB_X)
-        res += (CONJ ? conj(A[i]) : A[i]) * x[(tx + i) * incx];
+        res += (CONJ ? conj(load_A(i)) : load_A(i)) * x[(tx + i) * incx];
 
     if(tx + m_full < m)
-        res += (CONJ ? conj(A[m_full]) : A[m_full]) * x[(tx + m_full) * incx];
+        res += (CONJ ? conj(load_A(m_full)) : load_A(m_full)) * x[(tx + m_full) * incx];
 
     if(NB_X <= warpSize)
     {
@@ -970,12 +1095,21 @@ rocblas_gemvt_double_buffered_kernel(rocblas_int    m,
                                      W*             ya,
                                      rocblas_stride shifty,
                                      rocblas_int    incy,
-                                     rocblas_stride stridey)
+                                     rocblas_stride stridey,
+                                     T*             workspace)
 {
     auto alpha = load_scalar(alpha_device_host, blockIdx.z, stride_alpha);
 
+    // partial sums of batch blockIdx.z, only written when atomics are not allowed
+    if(workspace)
+        workspace += size_t(gridDim.y) * n * blockIdx.z;
+
     if(!alpha)
+    {
+        if(workspace && threadIdx.y == 0)
+            workspace[size_t(blockIdx.y) * n + blockIdx.x * DIM_X + threadIdx.x] = T(0);
         return;
+    }
 
     const T* A = cond_load_ptr_batch(alpha, Aa, blockIdx.z, shifta, strideA);
     const T* x = cond_load_ptr_batch(alpha, xa, blockIdx.z, shiftx, stridex);
@@ -983,7 +1117,7 @@ rocblas_gemvt_double_buffered_kernel(rocblas_int    m,
     T* y = load_ptr_batch(ya, blockIdx.z, shifty, stridey);
 
     rocblas_gemvt_double_buffered_kernel_calc<CONJ, DIM_X, elements_per_thread, T>(
-        m, n, alpha, A, lda, x, incx, y, incy);
+        m, n, alpha, A, lda, x, incx, y, incy, workspace);
 }
 
 template <rocblas_int DIM_X,
@@ -1011,7 +1145,8 @@ rocblas_gemvn_kernel(rocblas_int    m,
                      W*             ya,
                      rocblas_stride shifty,
                      rocblas_int    incy,
-                     rocblas_stride stridey)
+                     rocblas_stride stridey,
+                     bool           stream_A)
 {
     rocblas_int num_threads = blockDim.x * blockDim.y * blockDim.z;
     if(DIM_X * DIM_Y != num_threads)
@@ -1028,7 +1163,8 @@ rocblas_gemvn_kernel(rocblas_int    m,
 
     T* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
 
-    rocblas_gemvn_kernel_calc<DIM_X, DIM_Y, T_lda>(m, n, alpha, A, lda, x, incx, beta, y, incy);
+    rocblas_gemvn_kernel_calc<DIM_X, DIM_Y, T_lda>(
+        m, n, alpha, A, lda, x, incx, beta, y, incy, blockIdx.x, stream_A);
 }
 
 // lda always cast to size_t so single kernel
@@ -1051,7 +1187,8 @@ rocblas_gemvt_kernel(rocblas_int    m,
                      W*             ya,
                      rocblas_stride shifty,
                      rocblas_int    incy,
-                     rocblas_stride stridey)
+                     rocblas_stride stridey,
+                     bool           stream_A)
 {
     auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
     auto beta  = load_scalar(beta_device_host, blockIdx.y, stride_beta);
@@ -1064,7 +1201,8 @@ rocblas_gemvt_kernel(rocblas_int    m,
 
     T* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
 
-    rocblas_gemvt_kernel_calc<CONJ, NB_X>(m, n, alpha, A, lda, x, incx, beta, y, incy);
+    rocblas_gemvt_kernel_calc<CONJ, NB_X>(
+        m, n, alpha, A, lda, x, incx, beta, y, incy, blockIdx.x, stream_A);
 }
 
 //Optimized kernel for GEMV transpose case when m or n is less than 6000
@@ -1087,7 +1225,8 @@ rocblas_gemvt_warp_reduce_kernel(rocblas_int    m,
                                  W*             ya,
                                  rocblas_stride shifty,
                                  rocblas_int    incy,
-                                 rocblas_stride stridey)
+                                 rocblas_stride stridey,
+                                 bool           stream_A)
 {
     auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
     auto beta  = load_scalar(beta_device_host, blockIdx.y, stride_beta);
@@ -1100,7 +1239,8 @@ rocblas_gemvt_warp_reduce_kernel(rocblas_int    m,
 
     T* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
 
-    rocblas_gemvt_warp_reduce_kernel_calc<CONJ, NB_X>(m, n, alpha, A, lda, x, incx, beta, y, incy);
+    rocblas_gemvt_warp_reduce_kernel_calc<CONJ, NB_X>(
+        m, n, alpha, A, lda, x, incx, beta, y, incy, stream_A);
 }
 
 template <bool        CONJ,
@@ -1273,3 +1413,907 @@ rocblas_gemvn_sm_mn_batched_kernel(rocblas_int    m,
 
 #endif
 }
+
+// Persistent batched gemvn for many small matrices. The grid is sized to the device rather
+// than to batch_count, and each group of DIM_X threads computes y of batches
+// b, b + groups, b + 2 * groups, ... so that small problems don't each pay for a workgroup.
+template <rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          typename T,
+          typename U,
+          typename V,
+          typename W>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_gemvn_persistent_batched_kernel(rocblas_int    m,
+                                        rocblas_int    n,
+                                        U              alpha_device_host,
+                                        rocblas_stride stride_alpha,
+                                        const V*       Aa,
+                                        rocblas_stride shifta,
+                                        rocblas_int    lda,
+                                        rocblas_stride strideA,
+                                        const V*       xa,
+                                        rocblas_stride shiftx,
+                                        rocblas_int    incx,
+                                        rocblas_stride stridex,
+                                        U              beta_device_host,
+                                        rocblas_stride stride_beta,
+                                        W*             ya,
+                                        rocblas_stride shifty,
+                                        rocblas_int    incy,
+                                        rocblas_stride stridey,
+                                        rocblas_int    batch_count)
+{
+    const rocblas_int groups = gridDim.x * DIM_Y;
+
+    for(rocblas_int b = blockIdx.x * DIM_Y + threadIdx.y; b < batch_count; b += groups)
+    {
+        auto alpha = load_scalar(alpha_device_host, b, stride_alpha);
+        auto beta  = load_scalar(beta_device_host, b, stride_beta);
+
+        if(!alpha && beta == 1)
+            continue;
+
+        const T* A = cond_load_ptr_batch(alpha, Aa, b, shifta, strideA);
+        const T* x = cond_load_ptr_batch(alpha, xa, b, shiftx, stridex);
+
+        T* y = load_ptr_batch(ya, b, shifty, stridey);
+
+        for(rocblas_int i = threadIdx.x; i < m; i += DIM_X)
+        {
+            T res = 0;
+            if(alpha)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                    res += A[i + j * size_t(lda)] * x[j * int64_t(incx)];
+                res *= alpha;
+            }
+
+            T& yi = y[i * int64_t(incy)];
+            yi    = beta ? res + beta * yi : res;
+        }
+    }
+}
+
+// Mixed precision gemv of gemv_ex: A and x of type Ta and Tx, usually half or bfloat16, are
+// loaded 128 bits at a time and converted in registers to the compute type Tex, in which the
+// products are accumulated, and y of type Ty is only rounded once.
+
+//! @brief y = alpha * A * x + beta * y for the DIM_X * rocblas_dwordx4_length<Ta> rows of block
+//!        blockIdx.x; each thread accumulates consecutive rows of every DIM_Y-th column.
+template <rocblas_int DIM_X, rocblas_int DIM_Y, typename Tex, typename Ta, typename Tx, typename Ty>
+ROCBLAS_KERNEL_ILF void rocblas_gemvn_ex_kernel_calc(rocblas_int m,
+                                                     rocblas_int n,
+                                                     Tex         alpha,
+                                                     const Ta* __restrict__ A,
+                                                     rocblas_int lda,
+                                                     const Tx* __restrict__ x,
+                                                     rocblas_int incx,
+                                                     Tex         beta,
+                                                     Ty* __restrict__ y,
+                                                     rocblas_int incy)
+{
+    constexpr rocblas_int VEC  = rocblas_dwordx4_length<Ta>;
+    constexpr rocblas_int ROWS = DIM_X * VEC;
+
+    const rocblas_int thread_id = threadIdx.x + threadIdx.y * DIM_X;
+    const rocblas_int row0      = blockIdx.x * ROWS;
+
+    if(!alpha)
+    {
+        for(rocblas_int r = thread_id; r < ROWS; r += DIM_X * DIM_Y)
+        {
+            if(row0 + r < m)
+            {
+                Ty& yi = y[(row0 + r) * int64_t(incy)];
+                yi     = beta ? Ty(beta * Tex(yi)) : Ty(0);
+            }
+        }
+        return;
+    }
+
+    __shared__ Tex sdata[DIM_Y][ROWS];
+
+    const rocblas_int row = row0 + threadIdx.x * VEC;
+
+    // the columns of the block are 16 byte aligned if A and lda are
+    const bool aligned = rocblas_dwordx4_peel(A) == 0 && (size_t(lda) * sizeof(Ta)) % 16 == 0;
+
+    Tex res[VEC];
+    for(rocblas_int j = 0; j < VEC; j++)
+        res[j] = 0;
+
+    for(rocblas_int col = threadIdx.y; col < n; col += DIM_Y)
+    {
+        const Tex xc = Tex(x[col * int64_t(incx)]);
+        const Ta* Ac = A + col * size_t(lda) + row;
+
+        if(aligned && row + VEC <= m)
+        {
+            rocblas_dwordx4<Ta> va = *(const rocblas_dwordx4<Ta>*)Ac;
+            for(rocblas_int j = 0; j < VEC; j++)
+                res[j] += Tex(va.data[j]) * xc;
+        }
+        else
+        {
+            for(rocblas_int j = 0; j < VEC && row + j < m; j++)
+                res[j] += Tex(Ac[j]) * xc;
+        }
+    }
+
+    for(rocblas_int j = 0; j < VEC; j++)
+        sdata[threadIdx.y][threadIdx.x * VEC + j] = res[j];
+
+    __syncthreads();
+
+    for(rocblas_int r = thread_id; r < ROWS; r += DIM_X * DIM_Y)
+    {
+        if(row0 + r < m)
+        {
+            Tex sum = sdata[0][r];
+            for(rocblas_int i = 1; i < DIM_Y; i++)
+                sum += sdata[i][r];
+
+            Ty& yi = y[(row0 + r) * int64_t(incy)];
+            yi     = beta ? Ty(alpha * sum + beta * Tex(yi)) : Ty(alpha * sum);
+        }
+    }
+}
+
+//! @brief y[col] = alpha * dot(A[:, col], x) + beta * y[col] for the column A of m elements,
+//!        by the NB threads of the block. The aligned body of the column is loaded 128 bits at a
+//!        time, its unaligned head and tail one element per thread.
+template <rocblas_int NB, typename Tex, typename Ta, typename Tx, typename Ty>
+ROCBLAS_KERNEL_ILF void rocblas_gemvt_ex_kernel_calc(rocblas_int m,
+                                                     Tex         alpha,
+                                                     const Ta* __restrict__ A,
+                                                     const Tx* __restrict__ x,
+                                                     rocblas_int incx,
+                                                     Tex         beta,
+                                                     Ty* __restrict__ y)
+{
+    constexpr rocblas_int VEC = rocblas_dwordx4_length<Ta>;
+
+    const rocblas_int tx = threadIdx.x;
+
+    if(!alpha)
+    {
+        if(tx == 0)
+            *y = beta ? Ty(beta * Tex(*y)) : Ty(0);
+        return;
+    }
+
+    Tex res = 0;
+
+    rocblas_int peel = rocblas_dwordx4_peel(A);
+    if(peel < 0)
+    {
+        for(rocblas_int i = tx; i < m; i += NB)
+            res += Tex(A[i]) * Tex(x[i * int64_t(incx)]);
+    }
+    else
+    {
+        peel                   = peel < m ? peel : m;
+        const rocblas_int body = (m - peel) / VEC;
+        const rocblas_int tail = peel + body * VEC;
+
+        for(rocblas_int v = tx; v < body; v += NB)
+        {
+            const rocblas_int   i  = peel + v * VEC;
+            rocblas_dwordx4<Ta> va = *(const rocblas_dwordx4<Ta>*)(A + i);
+            for(rocblas_int j = 0; j < VEC; j++)
+                res += Tex(va.data[j]) * Tex(x[(i + j) * int64_t(incx)]);
+        }
+
+        if(tx < peel)
+            res += Tex(A[tx]) * Tex(x[tx * int64_t(incx)]);
+        if(tx < m - tail)
+            res += Tex(A[tail + tx]) * Tex(x[(tail + tx) * int64_t(incx)]);
+    }
+
+    res = rocblas_dot_block_reduce<NB>(res);
+
+    if(tx == 0)
+        *y = beta ? Ty(alpha * res + beta * Tex(*y)) : Ty(alpha * res);
+}
+
+template <rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          typename Tex,
+          typename U,
+          typename TConstPtrA,
+          typename TConstPtrX,
+          typename TPtrY>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_gemvn_ex_kernel(rocblas_int    m,
+                        rocblas_int    n,
+                        U              alpha_device_host,
+                        rocblas_stride stride_alpha,
+                        TConstPtrA     Aa,
+                        rocblas_stride shifta,
+                        rocblas_int    lda,
+                        rocblas_stride strideA,
+                        TConstPtrX     xa,
+                        rocblas_stride shiftx,
+                        rocblas_int    incx,
+                        rocblas_stride stridex,
+                        U              beta_device_host,
+                        rocblas_stride stride_beta,
+                        TPtrY          ya,
+                        rocblas_stride shifty,
+                        rocblas_int    incy,
+                        rocblas_stride stridey)
+{
+    Tex alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
+    Tex beta  = load_scalar(beta_device_host, blockIdx.y, stride_beta);
+
+    if(!alpha && beta == 1)
+        return;
+
+    const auto* A = cond_load_ptr_batch(alpha, Aa, blockIdx.y, shifta, strideA);
+    const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.y, shiftx, stridex);
+
+    auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    rocblas_gemvn_ex_kernel_calc<DIM_X, DIM_Y>(m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <rocblas_int NB,
+          typename Tex,
+          typename U,
+          typename TConstPtrA,
+          typename TConstPtrX,
+          typename TPtrY>
+ROCBLAS_KERNEL(NB)
+rocblas_gemvt_ex_kernel(rocblas_int    m,
+                        U              alpha_device_host,
+                        rocblas_stride stride_alpha,
+                        TConstPtrA     Aa,
+                        rocblas_stride shifta,
+                        rocblas_int    lda,
+                        rocblas_stride strideA,
+                        TConstPtrX     xa,
+                        rocblas_stride shiftx,
+                        rocblas_int    incx,
+                        rocblas_stride stridex,
+                        U              beta_device_host,
+                        rocblas_stride stride_beta,
+                        TPtrY          ya,
+                        rocblas_stride shifty,
+                        rocblas_int    incy,
+                        rocblas_stride stridey)
+{
+    Tex alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
+    Tex beta  = load_scalar(beta_device_host, blockIdx.y, stride_beta);
+
+    if(!alpha && beta == 1)
+        return;
+
+    const rocblas_int col = blockIdx.x;
+
+    const auto* A = cond_load_ptr_batch(alpha, Aa, blockIdx.y, shifta, strideA);
+    const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.y, shiftx, stridex);
+
+    auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    rocblas_gemvt_ex_kernel_calc<NB>(
+        m, alpha, A ? A + col * size_t(lda) : A, x, incx, beta, y + col * int64_t(incy));
+}
+
+// Quantized gemv of gemv_quantized_ex: the transposed gemv of the mixed precision gemvt with
+// 8-bit or packed 4-bit integer elements of A, dequantized in registers with one half scale
+// and zero point per group of group_size elements of a column.
+
+//! @brief Element i of the column A of BITS-bit elements, int8_t if BITS is 8 and unsigned
+//!        packed two to a byte, the even element in the low 4 bits, if BITS is 4.
+template <int BITS>
+__device__ __forceinline__ float rocblas_gemv_quantized_element(const uint8_t* __restrict__ A,
+                                                                rocblas_int i)
+{
+    if constexpr(BITS == 8)
+        return float(int8_t(A[i]));
+    else
+        return float((A[i / 2] >> ((i & 1) * 4)) & 15);
+}
+
+//! @brief y[col] = alpha * dot(dequant(A[:, col]), x) + beta * y[col] for the column A of m
+//!        BITS-bit elements, by the NB threads of the block.
+//!
+//! Element i is dequantized as scales[g] * (A[i] - zeros[g]) with g = i / group_size, and
+//! zero_point for all the groups if zeros is nullptr. When A is 16 byte aligned, each thread
+//! loads 128 bits of the column at a time, which lie in a single group as group_size is at
+//! least m or a multiple of 128 / BITS, and accumulates scale * (dot(A, x) - zero * sum(x))
+//! for them; the tail of the column is loaded one element per thread.
+template <rocblas_int NB, int BITS, typename Tx, typename Ty>
+ROCBLAS_KERNEL_ILF void rocblas_gemvt_quantized_kernel_calc(rocblas_int m,
+                                                            float       alpha,
+                                                            const uint8_t* __restrict__ A,
+                                                            const rocblas_half* __restrict__ scales,
+                                                            const rocblas_half* __restrict__ zeros,
+                                                            float       zero_point,
+                                                            rocblas_int group_size,
+                                                            const Tx* __restrict__ x,
+                                                            rocblas_int incx,
+                                                            float       beta,
+                                                            Ty* __restrict__ y)
+{
+    constexpr rocblas_int VEC = 128 / BITS;
+
+    const rocblas_int tx = threadIdx.x;
+
+    if(!alpha)
+    {
+        if(tx == 0)
+            *y = beta ? Ty(beta * float(*y)) : Ty(0);
+        return;
+    }
+
+    float res = 0;
+
+    const rocblas_int body = rocblas_dwordx4_peel(A) == 0 ? m / VEC : 0;
+    for(rocblas_int v = tx; v < body; v += NB)
+    {
+        const rocblas_int        i  = v * VEC;
+        const rocblas_int        g  = i / group_size;
+        rocblas_dwordx4<uint8_t> va = *(const rocblas_dwordx4<uint8_t>*)(A + i * BITS / 8);
+
+        float dot = 0, sum = 0;
+        for(rocblas_int j = 0; j < 16; j++)
+        {
+            if constexpr(BITS == 8)
+            {
+                const float xj = float(x[(i + j) * int64_t(incx)]);
+                dot += float(int8_t(va.data[j])) * xj;
+                sum += xj;
+            }
+            else
+            {
+                const float x0 = float(x[(i + 2 * j) * int64_t(incx)]);
+                const float x1 = float(x[(i + 2 * j + 1) * int64_t(incx)]);
+                dot += float(va.data[j] & 15) * x0 + float(va.data[j] >> 4) * x1;
+                sum += x0 + x1;
+            }
+        }
+
+        const float zero = zeros ? float(zeros[g]) : zero_point;
+        res += float(scales[g]) * (dot - zero * sum);
+    }
+
+    for(rocblas_int i = body * VEC + tx; i < m; i += NB)
+    {
+        const rocblas_int g    = i / group_size;
+        const float       zero = zeros ? float(zeros[g]) : zero_point;
+        res += float(scales[g]) * (rocblas_gemv_quantized_element<BITS>(A, i) - zero)
+               * float(x[i * int64_t(incx)]);
+    }
+
+    res = rocblas_dot_block_reduce<NB>(res);
+
+    if(tx == 0)
+        *y = beta ? Ty(alpha * res + beta * float(*y)) : Ty(alpha * res);
+}
+
+template <rocblas_int NB, int BITS, typename U, typename Tx, typename Ty>
+ROCBLAS_KERNEL(NB)
+rocblas_gemvt_quantized_kernel(rocblas_int m,
+                               U           alpha_device_host,
+                               const uint8_t* __restrict__ A,
+                               rocblas_int lda,
+                               const rocblas_half* __restrict__ scales,
+                               const rocblas_half* __restrict__ zeros,
+                               rocblas_int group_size,
+                               const Tx* __restrict__ x,
+                               rocblas_int incx,
+                               U           beta_device_host,
+                               Ty* __restrict__ y,
+                               rocblas_int incy)
+{
+    float alpha = load_scalar(alpha_device_host);
+    float beta  = load_scalar(beta_device_host);
+
+    if(!alpha && beta == 1)
+        return;
+
+    const rocblas_int col    = blockIdx.x;
+    const size_t      groups = (m - 1) / group_size + 1;
+
+    rocblas_gemvt_quantized_kernel_calc<NB, BITS>(m,
+                                                  alpha,
+                                                  A + col * size_t(lda) * BITS / 8,
+                                                  scales + col * groups,
+                                                  zeros ? zeros + col * groups : zeros,
+                                                  BITS == 4 ? 8.0f : 0.0f,
+                                                  group_size,
+                                                  x,
+                                                  incx,
+                                                  beta,
+                                                  y + col * int64_t(incy));
+}
+
+// Variable size batched gemv of gemv_vbatched: each problem of the batch is split into tiles,
+// the row blocks of rocblas_gemvn_kernel_calc or the columns of rocblas_gemvt_kernel_calc,
+// which are numbered across the batch by a prefix sum of their counts. A grid sized to the
+// device loops over the tiles, each workgroup fetching its next tile from an atomic counter, so
+// that the problems of any size are spread over all the compute units with a single launch.
+// Each tile is computed by one workgroup, so the results do not depend on the schedule.
+
+//! @brief tile_start[b] = number of tiles of the problems before b, with tile_start[batch_count]
+//!        the total, by one block of NB threads; also resets the tile counter.
+//!
+//! A problem has ceil(m / ROWS) tiles if not TRANS and n tiles if TRANS, and none if m or n is
+//! not positive or if its lda, incx or incy is invalid, so that invalid problems are skipped.
+template <rocblas_int NB, rocblas_int ROWS, bool TRANS>
+ROCBLAS_KERNEL(NB)
+rocblas_gemv_vbatched_tiles_kernel(const rocblas_int* __restrict__ m,
+                                   const rocblas_int* __restrict__ n,
+                                   const rocblas_int* __restrict__ lda,
+                                   const rocblas_int* __restrict__ incx,
+                                   const rocblas_int* __restrict__ incy,
+                                   rocblas_int batch_count,
+                                   int64_t* __restrict__ tile_start,
+                                   unsigned long long* __restrict__ counter)
+{
+    __shared__ int64_t sums[NB];
+
+    const rocblas_int tid   = threadIdx.x;
+    int64_t           carry = 0;
+    for(rocblas_int base = 0; base < batch_count; base += NB)
+    {
+        const rocblas_int b     = base + tid;
+        int64_t           tiles = 0;
+        if(b < batch_count && m[b] > 0 && n[b] > 0 && lda[b] >= m[b] && incx[b] && incy[b])
+            tiles = TRANS ? n[b] : (m[b] - 1) / ROWS + 1;
+
+        // inclusive scan of the tiles of the NB problems
+        sums[tid] = tiles;
+        __syncthreads();
+        for(rocblas_int offset = 1; offset < NB; offset *= 2)
+        {
+            int64_t v = tid >= offset ? sums[tid - offset] : 0;
+            __syncthreads();
+            sums[tid] += v;
+            __syncthreads();
+        }
+
+        if(b < batch_count)
+            tile_start[b] = carry + sums[tid] - tiles;
+        carry += sums[NB - 1];
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        tile_start[batch_count] = carry;
+        *counter                = 0;
+    }
+}
+
+//! @brief Calls f(b, tile) for the tiles fetched by the workgroup, tile being the index of the
+//!        tile within problem b, until the tile_start[batch_count] tiles are all fetched.
+template <typename F>
+__device__ void rocblas_gemv_vbatched_for_each_tile(rocblas_int batch_count,
+                                                    const int64_t* __restrict__ tile_start,
+                                                    unsigned long long* __restrict__ counter,
+                                                    F f)
+{
+    __shared__ int64_t next;
+
+    const bool    first = threadIdx.x == 0 && threadIdx.y == 0;
+    const int64_t total = tile_start[batch_count];
+    while(true)
+    {
+        if(first)
+            next = atomicAdd(counter, 1ull);
+        __syncthreads();
+        const int64_t t = next;
+        __syncthreads();
+
+        if(t >= total)
+            return;
+
+        // the last problem starting at or before t, which has tiles
+        rocblas_int lo = 0, hi = batch_count - 1;
+        while(lo < hi)
+        {
+            rocblas_int mid = (lo + hi + 1) / 2;
+            if(tile_start[mid] <= t)
+                lo = mid;
+            else
+                hi = mid - 1;
+        }
+
+        f(lo, rocblas_int(t - tile_start[lo]));
+
+        // the shared memory of the tile is reused by the next one
+        __syncthreads();
+    }
+}
+
+template <rocblas_int DIM_X, rocblas_int DIM_Y, typename T, typename U>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_gemvn_vbatched_kernel(const rocblas_int* __restrict__ m,
+                              const rocblas_int* __restrict__ n,
+                              U alpha_device_host,
+                              const T* const* __restrict__ A,
+                              const rocblas_int* __restrict__ lda,
+                              const T* const* __restrict__ x,
+                              const rocblas_int* __restrict__ incx,
+                              U beta_device_host,
+                              T* const* __restrict__ y,
+                              const rocblas_int* __restrict__ incy,
+                              rocblas_int batch_count,
+                              const int64_t* __restrict__ tile_start,
+                              unsigned long long* __restrict__ counter)
+{
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+
+    if(!alpha && beta == 1)
+        return;
+
+    rocblas_gemv_vbatched_for_each_tile(
+        batch_count, tile_start, counter, [&](rocblas_int b, rocblas_int block) {
+            const rocblas_int mb = m[b], nb = n[b], incxb = incx[b], incyb = incy[b];
+
+            // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+            const T* xb = alpha ? x[b] - (incxb < 0 ? ptrdiff_t(incxb) * (nb - 1) : 0) : nullptr;
+            T*       yb = y[b] - (incyb < 0 ? ptrdiff_t(incyb) * (mb - 1) : 0);
+
+            rocblas_gemvn_kernel_calc<DIM_X, DIM_Y, size_t>(mb,
+                                                            nb,
+                                                            alpha,
+                                                            alpha ? A[b] : nullptr,
+                                                            size_t(lda[b]),
+                                                            xb,
+                                                            incxb,
+                                                            beta,
+                                                            yb,
+                                                            incyb,
+                                                            block);
+        });
+}
+
+template <bool CONJ, rocblas_int NB_X, typename T, typename U>
+ROCBLAS_KERNEL(NB_X)
+rocblas_gemvt_vbatched_kernel(const rocblas_int* __restrict__ m,
+                              const rocblas_int* __restrict__ n,
+                              U alpha_device_host,
+                              const T* const* __restrict__ A,
+                              const rocblas_int* __restrict__ lda,
+                              const T* const* __restrict__ x,
+                              const rocblas_int* __restrict__ incx,
+                              U beta_device_host,
+                              T* const* __restrict__ y,
+                              const rocblas_int* __restrict__ incy,
+                              rocblas_int batch_count,
+                              const int64_t* __restrict__ tile_start,
+                              unsigned long long* __restrict__ counter)
+{
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+
+    if(!alpha && beta == 1)
+        return;
+
+    rocblas_gemv_vbatched_for_each_tile(
+        batch_count, tile_start, counter, [&](rocblas_int b, rocblas_int col) {
+            const rocblas_int mb = m[b], nb = n[b], incxb = incx[b], incyb = incy[b];
+
+            // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+            const T* xb = alpha ? x[b] - (incxb < 0 ? ptrdiff_t(incxb) * (mb - 1) : 0) : nullptr;
+            T*       yb = y[b] - (incyb < 0 ? ptrdiff_t(incyb) * (nb - 1) : 0);
+
+            rocblas_gemvt_kernel_calc<CONJ, NB_X>(mb,
+                                                  nb,
+                                                  alpha,
+                                                  alpha ? A[b] : nullptr,
+                                                  lda[b],
+                                                  xb,
+                                                  incxb,
+                                                  beta,
+                                                  yb,
+                                                  incyb,
+                                                  col);
+        });
+}
+
+// Fused gemv of gemv_nt: y := alpha * A * x + beta * y and z := gamma * op(A) * w + delta * z
+// with op(A) = A**T or A**H, reading A once. A is split into blocks of rows_per_block rows and
+// COLS columns, one workgroup each. As in rocblas_gemvn_kernel_calc each thread accumulates the
+// products of its row with x, and as in rocblas_gemvt_kernel_calc the column products with w
+// are summed over the threads of the workgroup. The partial sums of the column blocks for y and
+// of the row blocks for z are written to workspace, and summed in a fixed order by
+// rocblas_gemv_nt_finish_kernel, so that the results do not depend on the schedule.
+
+//! @brief Partial sums y_part[row + m * blockIdx.y] of A * x over the columns of column block
+//!        blockIdx.y, and z_part[col + n * blockIdx.x] of op(A) * w over the rows of row block
+//!        blockIdx.x.
+template <rocblas_int NB, rocblas_int COLS, bool CONJ, typename T>
+ROCBLAS_KERNEL(NB)
+rocblas_gemv_nt_kernel(rocblas_int m,
+                       rocblas_int n,
+                       const T* __restrict__ A,
+                       rocblas_int lda,
+                       const T* __restrict__ x,
+                       rocblas_int incx,
+                       const T* __restrict__ w,
+                       rocblas_int incw,
+                       rocblas_int rows_per_block,
+                       T* __restrict__ y_part,
+                       T* __restrict__ z_part)
+{
+    const rocblas_int tx        = threadIdx.x;
+    const rocblas_int col0      = blockIdx.y * COLS;
+    const rocblas_int cols      = n - col0 < COLS ? n - col0 : COLS;
+    const rocblas_int row_begin = blockIdx.x * rows_per_block;
+    const rocblas_int row_end   = m - row_begin < rows_per_block ? m : row_begin + rows_per_block;
+
+    T xc[COLS];
+    T zc[COLS];
+    for(rocblas_int c = 0; c < COLS; c++)
+    {
+        xc[c] = c < cols ? x[(col0 + c) * int64_t(incx)] : T(0);
+        zc[c] = T(0);
+    }
+
+    A += col0 * size_t(lda);
+    for(rocblas_int row = row_begin + tx; row < row_end; row += NB)
+    {
+        const T* Ar = A + row;
+        const T  wr = w[row * int64_t(incw)];
+
+        T yr = 0;
+        if(cols == COLS)
+        {
+#pragma unroll
+            for(rocblas_int c = 0; c < COLS; c++)
+            {
+                const T a = Ar[c * size_t(lda)];
+                yr += a * xc[c];
+                zc[c] += (CONJ ? conj(a) : a) * wr;
+            }
+        }
+        else
+        {
+            for(rocblas_int c = 0; c < cols; c++)
+            {
+                const T a = Ar[c * size_t(lda)];
+                yr += a * xc[c];
+                zc[c] += (CONJ ? conj(a) : a) * wr;
+            }
+        }
+
+        y_part[row + blockIdx.y * size_t(m)] = yr;
+    }
+
+    for(rocblas_int c = 0; c < COLS; c++)
+    {
+        T sum = rocblas_dot_block_reduce<NB>(zc[c]);
+        if(tx == 0 && c < cols)
+            z_part[col0 + c + blockIdx.x * size_t(n)] = sum;
+    }
+}
+
+//! @brief y := alpha * (sum of the y_parts partial sums) + beta * y for the m elements of y,
+//!        and likewise z with gamma and delta for the n elements of z, one thread per element.
+template <rocblas_int NB, typename T, typename U>
+ROCBLAS_KERNEL(NB)
+rocblas_gemv_nt_finish_kernel(rocblas_int m,
+                              rocblas_int n,
+                              U           alpha_device_host,
+                              U           beta_device_host,
+                              const T* __restrict__ y_part,
+                              rocblas_int y_parts,
+                              T* __restrict__ y,
+                              rocblas_int incy,
+                              U           gamma_device_host,
+                              U           delta_device_host,
+                              const T* __restrict__ z_part,
+                              rocblas_int z_parts,
+                              T* __restrict__ z,
+                              rocblas_int incz)
+{
+    const int64_t tid = blockIdx.x * int64_t(NB) + threadIdx.x;
+
+    if(tid >= int64_t(m) + n)
+        return;
+
+    const bool        is_y  = tid < m;
+    const rocblas_int i     = is_y ? rocblas_int(tid) : rocblas_int(tid - m);
+    const rocblas_int len   = is_y ? m : n;
+    const rocblas_int parts = is_y ? y_parts : z_parts;
+    const T*          part  = is_y ? y_part : z_part;
+    T&                out   = is_y ? y[i * int64_t(incy)] : z[i * int64_t(incz)];
+
+    auto alpha = load_scalar(is_y ? alpha_device_host : gamma_device_host);
+    auto beta  = load_scalar(is_y ? beta_device_host : delta_device_host);
+
+    if(!alpha && beta == 1)
+        return;
+
+    T res = 0;
+    if(alpha)
+    {
+        for(rocblas_int p = 0; p < parts; p++)
+            res += part[i + p * size_t(len)];
+        res *= alpha;
+    }
+
+    out = beta ? res + beta * out : res;
+}
+
+// Multi-vector gemv of gemm with a few columns: Y := alpha * op(A) * X + beta * Y for the nv
+// columns of X and Y, reading A once instead of once per column. Element (i, j) of X is
+// x[i * incx + j * ldx] and of Y is y[i * incy + j * ldy], so that the vectors are the columns of
+// op(B) and C of a gemm with a small n, or the rows of op(A) and C of a gemm with a small m. As in
+// rocblas_gemvn_kernel_calc and rocblas_gemvt_kernel_calc each thread computes the products of
+// its row, or of its part of a column, of A, here with the nv vectors at once. The sums are kept
+// in registers for NV >= nv vectors, and the loops over them are unrolled for NV with nv as a
+// bound that is uniform over the workgroup.
+
+//! @brief Y := alpha * A * X + beta * Y for the DIM_X rows of workgroup blockIdx.x, whose DIM_Y
+//!        threads of a row sum over interleaved columns of A before a reduction in LDS.
+template <rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          rocblas_int NV,
+          typename T,
+          typename U,
+          typename TConstPtr,
+          typename TPtr>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_gemvn_multi_kernel(rocblas_int    m,
+                           rocblas_int    n,
+                           rocblas_int    nv,
+                           U              alpha_device_host,
+                           TConstPtr      Aa,
+                           rocblas_stride shifta,
+                           rocblas_int    lda,
+                           rocblas_stride strideA,
+                           TConstPtr      xa,
+                           rocblas_stride shiftx,
+                           rocblas_int    incx,
+                           rocblas_int    ldx,
+                           rocblas_stride stridex,
+                           U              beta_device_host,
+                           TPtr           ya,
+                           rocblas_stride shifty,
+                           rocblas_int    incy,
+                           rocblas_int    ldy,
+                           rocblas_stride stridey)
+{
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+
+    if(!alpha && beta == 1)
+        return;
+
+    const auto* A = cond_load_ptr_batch(alpha, Aa, blockIdx.y, shifta, strideA);
+    const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.y, shiftx, stridex);
+
+    auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    const rocblas_int tx  = threadIdx.x;
+    const rocblas_int ty  = threadIdx.y;
+    const rocblas_int row = blockIdx.x * DIM_X + tx;
+
+    T res[NV];
+#pragma unroll
+    for(rocblas_int j = 0; j < NV; j++)
+        res[j] = T(0);
+
+    if(alpha && row < m)
+    {
+        for(rocblas_int col = ty; col < n; col += DIM_Y)
+        {
+            const T  a  = A[row + col * size_t(lda)];
+            const T* xc = x + col * int64_t(incx);
+#pragma unroll
+            for(rocblas_int j = 0; j < NV; j++)
+                if(j < nv)
+                    res[j] += a * xc[j * int64_t(ldx)];
+        }
+    }
+
+    __shared__ T sdata[DIM_X * DIM_Y];
+
+#pragma unroll
+    for(rocblas_int j = 0; j < NV; j++)
+    {
+        if(j < nv)
+        {
+            sdata[tx + ty * DIM_X] = res[j];
+
+            __syncthreads();
+
+            if(ty == 0 && row < m)
+            {
+                T sum = sdata[tx];
+                for(rocblas_int i = 1; i < DIM_Y; i++)
+                    sum += sdata[tx + i * DIM_X];
+
+                T& yj = y[row * int64_t(incy) + j * int64_t(ldy)];
+                yj    = beta ? alpha * sum + beta * yj : alpha * sum;
+            }
+
+            __syncthreads();
+        }
+    }
+}
+
+//! @brief Y := alpha * op(A) * X + beta * Y for the element blockIdx.x of the nv vectors of Y,
+//!        the products with column blockIdx.x of A being summed over the NB threads.
+template <bool        CONJ,
+          rocblas_int NB,
+          rocblas_int NV,
+          typename T,
+          typename U,
+          typename TConstPtr,
+          typename TPtr>
+ROCBLAS_KERNEL(NB)
+rocblas_gemvt_multi_kernel(rocblas_int    m,
+                           rocblas_int    n,
+                           rocblas_int    nv,
+                           U              alpha_device_host,
+                           TConstPtr      Aa,
+                           rocblas_stride shifta,
+                           rocblas_int    lda,
+                           rocblas_stride strideA,
+                           TConstPtr      xa,
+                           rocblas_stride shiftx,
+                           rocblas_int    incx,
+                           rocblas_int    ldx,
+                           rocblas_stride stridex,
+                           U              beta_device_host,
+                           TPtr           ya,
+                           rocblas_stride shifty,
+                           rocblas_int    incy,
+                           rocblas_int    ldy,
+                           rocblas_stride stridey)
+{
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+
+    if(!alpha && beta == 1)
+        return;
+
+    const auto* A = cond_load_ptr_batch(alpha, Aa, blockIdx.y, shifta, strideA);
+    const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.y, shiftx, stridex);
+
+    auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    const rocblas_int tx  = threadIdx.x;
+    const rocblas_int col = blockIdx.x;
+
+    T res[NV];
+#pragma unroll
+    for(rocblas_int j = 0; j < NV; j++)
+        res[j] = T(0);
+
+    if(alpha)
+    {
+        const T* Ac = A + col * size_t(lda);
+        for(rocblas_int row = tx; row < m; row += NB)
+        {
+            const T  a  = CONJ ? conj(Ac[row]) : Ac[row];
+            const T* xr = x + row * int64_t(incx);
+#pragma unroll
+            for(rocblas_int j = 0; j < NV; j++)
+                if(j < nv)
+                    res[j] += a * xr[j * int64_t(ldx)];
+        }
+    }
+
+#pragma unroll
+    for(rocblas_int j = 0; j < NV; j++)
+    {
+        if(j < nv)
+        {
+            T sum = rocblas_dot_block_reduce<NB>(res[j]);
+            if(tx == 0)
+            {
+                T& yj = y[col * int64_t(incy) + j * int64_t(ldy)];
+                yj    = beta ? alpha * sum + beta * yj : alpha * sum;
+            }
+        }
+    }
+}
@@ -255,6 +255,218 @@ rocblas_gbmvx_kernel(rocblas_operation transA,
         transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
 }
 
+// Largest kl + ku + 1 of the narrow band kernels, so that the LDS tile of a 64 row strip fits
+// in 32 KiB
+template <typename T>
+constexpr rocblas_int rocblas_gbmvx_narrow_max_band = sizeof(T) > 8 ? 16 : 32;
+
+/**
+  *  Narrow band kernel, for kl + ku + 1 <= BAND.
+  *
+  *  Each group of NB threads computes NB consecutive elements of y of one system, and SYS
+  *  systems of a batch are packed in a workgroup of NB x SYS threads. The columns of banded
+  *  storage referenced by the NB elements are contiguous in memory, and are loaded into LDS
+  *  by consecutive threads reading consecutive elements. From the tile each thread then reads
+  *  the band of its row, one diagonal of the tile, or of its column if transposed.
+  *
+  *  With a single system per workgroup the tile holds the NB + kl + ku columns of a strip of
+  *  rows, or the NB columns of a strip of columns if transposed. Packed systems have at most
+  *  NB rows and columns, and the tile holds all the columns of each.
+  */
+template <rocblas_int NB, rocblas_int SYS, rocblas_int BAND, typename U, typename V, typename W>
+ROCBLAS_KERNEL(NB* SYS)
+rocblas_gbmvx_narrow_kernel(rocblas_operation transA,
+                            rocblas_int       m,
+                            rocblas_int       n,
+                            rocblas_int       kl,
+                            rocblas_int       ku,
+                            U                 alphaa,
+                            V                 Aa,
+                            rocblas_stride    shifta,
+                            rocblas_int       lda,
+                            rocblas_stride    strideA,
+                            V                 xa,
+                            rocblas_stride    shiftx,
+                            rocblas_int       incx,
+                            rocblas_stride    stridex,
+                            U                 betaa,
+                            W                 ya,
+                            rocblas_stride    shifty,
+                            rocblas_int       incy,
+                            rocblas_stride    stridey,
+                            rocblas_int       batch_count)
+{
+    constexpr rocblas_int TC = SYS == 1 ? NB + BAND : NB;
+    constexpr rocblas_int LD = BAND + 1; // padded to avoid bank conflicts on the diagonals
+
+    auto alpha = load_scalar(alphaa, blockIdx.y, 0);
+    auto beta  = load_scalar(betaa, blockIdx.y, 0);
+
+    if(!alpha && beta == 1)
+        return;
+
+    using T = decltype(alpha);
+    __shared__ T sA[SYS][TC * LD];
+
+    const rocblas_int tx     = threadIdx.x;
+    const rocblas_int s      = threadIdx.y;
+    const rocblas_int batch  = blockIdx.y * SYS + s;
+    const bool        active = batch < batch_count;
+    const bool        trans  = transA != rocblas_operation_none;
+
+    const rocblas_int kb   = kl + ku + 1;
+    const rocblas_int p0   = blockIdx.x * NB;
+    const rocblas_int ind  = p0 + tx;
+    const rocblas_int cbeg = trans || SYS > 1 ? p0 : p0 - kl;
+    const rocblas_int tc   = trans || SYS > 1 ? NB : NB + kb - 1;
+
+    // column j of banded storage holds A(j + k - ku, j) in its row k
+    if(active && alpha)
+    {
+        const auto* A = load_ptr_batch(Aa, batch, shifta, strideA);
+        for(rocblas_int l = tx; l < tc * kb; l += NB)
+        {
+            rocblas_int c = l / kb;
+            rocblas_int k = l - c * kb;
+            rocblas_int j = cbeg + c;
+            rocblas_int i = j + k - ku;
+
+            sA[s][c * LD + k] = j >= 0 && j < n && i >= 0 && i < m ? A[k + j * lda] : T(0);
+        }
+    }
+
+    __syncthreads();
+
+    rocblas_int max_ind = trans ? n : m;
+    if(!active || ind >= max_ind)
+        return;
+
+    T res_A = 0;
+    if(alpha)
+    {
+        const auto* x = load_ptr_batch(xa, batch, shiftx, stridex);
+        if(!trans)
+        {
+            // A(ind, j) for j = ind - kl + d is in row kb - 1 - d of column j
+            for(rocblas_int d = 0; d < kb; d++)
+            {
+                rocblas_int j = ind - kl + d;
+                if(j >= 0 && j < n)
+                    res_A += sA[s][(j - cbeg) * LD + kb - 1 - d] * x[j * incx];
+            }
+        }
+        else
+        {
+            bool is_conj = transA == rocblas_operation_conjugate_transpose;
+            for(rocblas_int k = 0; k < kb; k++)
+            {
+                rocblas_int i = ind + k - ku;
+                if(i >= 0 && i < m)
+                {
+                    T a = sA[s][tx * LD + k];
+                    res_A += (is_conj ? conj(a) : a) * x[i * incx];
+                }
+            }
+        }
+    }
+
+    auto* y = load_ptr_batch(ya, batch, shifty, stridey);
+    if(beta != 0)
+        y[ind * incy] = alpha ? alpha * res_A + beta * y[ind * incy] : beta * y[ind * incy];
+    else
+        y[ind * incy] = alpha ? alpha * res_A : 0;
+}
+
+template <rocblas_int NB, rocblas_int SYS, rocblas_int BAND, typename T, typename U, typename V>
+rocblas_status rocblas_gbmvx_narrow_launch(rocblas_handle    handle,
+                                           rocblas_operation transA,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       kl,
+                                           rocblas_int       ku,
+                                           const T*          alpha,
+                                           U                 A,
+                                           rocblas_stride    offseta,
+                                           rocblas_int       lda,
+                                           rocblas_stride    strideA,
+                                           U                 x,
+                                           rocblas_stride    shiftx,
+                                           rocblas_int       incx,
+                                           rocblas_stride    stridex,
+                                           const T*          beta,
+                                           V                 y,
+                                           rocblas_stride    shifty,
+                                           rocblas_int       incy,
+                                           rocblas_stride    stridey,
+                                           rocblas_int       batch_count)
+{
+    rocblas_int block_dim = transA == rocblas_operation_none ? m : n;
+    dim3        grid((block_dim - 1) / NB + 1, (batch_count - 1) / SYS + 1);
+    dim3        threads(NB, SYS);
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((rocblas_gbmvx_narrow_kernel<NB, SYS, BAND>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           transA,
+                           m,
+                           n,
+                           kl,
+                           ku,
+                           alpha,
+                           A,
+                           offseta,
+                           lda,
+                           strideA,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           beta,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           batch_count);
+    }
+    else
+    {
+        if(!*alpha && *beta == 1)
+            return rocblas_status_success;
+
+        hipLaunchKernelGGL((rocblas_gbmvx_narrow_kernel<NB, SYS, BAND>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           transA,
+                           m,
+                           n,
+                           kl,
+                           ku,
+                           *alpha,
+                           A,
+                           offseta,
+                           lda,
+                           strideA,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           *beta,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           batch_count);
+    }
+
+    return rocblas_status_success;
+}
+
 /**
   *  Here, U is either a `const T* const*` or a `const T*`
   *  V is either a `T*` or a `T* const*`
@@ -294,6 +506,34 @@ rocblas_status rocblas_gbmv_template(rocblas_handle    handle,
         = incy < 0 ? offsety - ptrdiff_t(incy) * (transA == rocblas_operation_none ? m - 1 : n - 1)
                    : offsety;
 
+    // Narrow bands are computed from coalesced loads of the band into LDS, with small systems
+    // of a batch packed in each workgroup
+    rocblas_int band_size = kl + ku + 1;
+    if(band_size <= rocblas_gbmvx_narrow_max_band<T>)
+    {
+        static constexpr int GBMVX_PACKED_NB = 16;
+        bool packed = batch_count > 1 && m <= GBMVX_PACKED_NB && n <= GBMVX_PACKED_NB;
+
+#define GBMVX_NARROW_ARGS                                                                         \
+    handle, transA, m, n, kl, ku, alpha, A, offseta, lda, strideA, x, shiftx, incx, stridex, beta, \
+        y, shifty, incy, stridey, batch_count
+#define GBMVX_NARROW_LAUNCH(BAND_)                                                            \
+    return packed ? rocblas_gbmvx_narrow_launch<GBMVX_PACKED_NB, 4, BAND_>(GBMVX_NARROW_ARGS) \
+                  : rocblas_gbmvx_narrow_launch<64, 1, BAND_>(GBMVX_NARROW_ARGS)
+
+        if(band_size <= 4)
+            GBMVX_NARROW_LAUNCH(4);
+        else if(band_size <= 8)
+            GBMVX_NARROW_LAUNCH(8);
+        else if(band_size <= 16)
+            GBMVX_NARROW_LAUNCH(16);
+        else if constexpr(rocblas_gbmvx_narrow_max_band<T> > 16)
+            GBMVX_NARROW_LAUNCH(32);
+
+#undef GBMVX_NARROW_LAUNCH
+#undef GBMVX_NARROW_ARGS
+    }
+
     // (gemv) GBMVX_DIM_Y must be at least 4, 8 * 8 is very slow only 40Gflop/s
     rocblas_int          block_dim   = transA == rocblas_operation_none ? m : n;
     static constexpr int GBMVX_DIM_X = 64;
@@ -20,6 +20,7 @@
  *
  * ************************************************************************ */
 #include "rocblas_gemv.hpp"
+#include "int64_helpers.hpp"
 #include "logging.hpp"
 
 namespace
@@ -56,7 +57,7 @@ namespace
         if(handle->is_device_memory_size_query())
             return handle->set_optimal_device_memory_size(dev_bytes);
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
@@ -209,6 +210,116 @@ namespace
         return status;
     }
 
+    template <typename T>
+    rocblas_status rocblas_gemv_64_impl(rocblas_handle    handle,
+                                        rocblas_operation transA,
+                                        int64_t           m,
+                                        int64_t           n,
+                                        const T*          alpha,
+                                        const T*          A,
+                                        int64_t           lda,
+                                        const T*          x,
+                                        int64_t           incx,
+                                        const T*          beta,
+                                        T*                y,
+                                        int64_t           incy)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        if(rocblas_fits_int32(m) && rocblas_fits_int32(n) && rocblas_fits_int32(lda)
+           && rocblas_fits_int32(incx) && rocblas_fits_int32(incy))
+            return rocblas_gemv_impl(handle,
+                                     transA,
+                                     rocblas_int(m),
+                                     rocblas_int(n),
+                                     alpha,
+                                     A,
+                                     rocblas_int(lda),
+                                     x,
+                                     incx,
+                                     beta,
+                                     y,
+                                     incy);
+
+        // Rows and columns of A are split into tiles, each of which the 32-bit kernels can
+        // address from its first element. The vector lengths are the y and x dimensions.
+        bool    trans     = transA != rocblas_operation_none;
+        int64_t x_len     = trans ? m : n;
+        int64_t y_len     = trans ? n : m;
+        int64_t row_chunk = std::min(c_i32_max, rocblas_chunk_size_64(trans ? incx : incy));
+        int64_t col_chunk = std::min(rocblas_chunk_size_64(trans ? incy : incx),
+                                     lda > 0 ? std::max<int64_t>(1, c_i32_max / lda) : 1);
+
+        // The first tile is the largest
+        if(handle->is_device_memory_size_query())
+        {
+            rocblas_int m_0 = rocblas_int(std::min(m, row_chunk));
+            rocblas_int n_0 = rocblas_int(std::min(n, col_chunk));
+            return handle->set_optimal_device_memory_size(
+                rocblas_internal_gemv_kernel_workspace_size<T>(transA, m_0, n_0));
+        }
+
+        if(transA != rocblas_operation_none && transA != rocblas_operation_transpose
+           && transA != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+        if(m < 0 || n < 0 || lda < m || lda < 1 || !incx || !incy)
+            return rocblas_status_invalid_size;
+        if(!alpha || !beta || !A || !x || !y)
+            return rocblas_status_invalid_pointer;
+
+        // Later tiles along the reduction dimension accumulate into y with beta = 1
+        T alpha_h, beta_h;
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            if(handle->is_graph_safe())
+                return rocblas_status_not_implemented;
+
+            hipStream_t stream = handle->get_stream();
+            RETURN_IF_HIP_ERROR(
+                hipMemcpyAsync(&alpha_h, alpha, sizeof(T), hipMemcpyDeviceToHost, stream));
+            RETURN_IF_HIP_ERROR(
+                hipMemcpyAsync(&beta_h, beta, sizeof(T), hipMemcpyDeviceToHost, stream));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+            alpha = &alpha_h;
+            beta  = &beta_h;
+        }
+        auto    saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+        const T one{1};
+
+        for(int64_t c0 = 0; c0 < n; c0 += col_chunk)
+        {
+            int64_t n_c = std::min(col_chunk, n - c0);
+            for(int64_t r0 = 0; r0 < m; r0 += row_chunk)
+            {
+                int64_t m_c = std::min(row_chunk, m - r0);
+
+                // A single column tile never steps by lda
+                rocblas_int lda_c = n_c == 1 ? rocblas_int(std::max<int64_t>(m_c, 1))
+                                             : rocblas_int(lda);
+
+                int64_t x_i0 = trans ? r0 : c0, x_c = trans ? m_c : n_c;
+                int64_t y_i0 = trans ? c0 : r0, y_c = trans ? n_c : m_c;
+                bool    first = (trans ? r0 : c0) == 0;
+
+                RETURN_IF_ROCBLAS_ERROR(
+                    rocblas_gemv_impl(handle,
+                                      transA,
+                                      rocblas_int(m_c),
+                                      rocblas_int(n_c),
+                                      alpha,
+                                      A + r0 + c0 * lda,
+                                      lda_c,
+                                      x + rocblas_chunk_offset_64(x_len, x_i0, x_c, incx),
+                                      rocblas_chunk_inc_64(incx),
+                                      first ? beta : &one,
+                                      y + rocblas_chunk_offset_64(y_len, y_i0, y_c, incy),
+                                      rocblas_chunk_inc_64(incy)));
+            }
+        }
+        return rocblas_status_success;
+    }
+
 } // namespace
 
 /*
@@ -303,4 +414,37 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                                   \
+    rocblas_status routine_name_(rocblas_handle    handle,                                        \
+                                 rocblas_operation transA,                                        \
+                                 int64_t           m,                                             \
+                                 int64_t           n,                                             \
+                                 const T_*         alpha,                                         \
+                                 const T_*         A,                                             \
+                                 int64_t           lda,                                           \
+                                 const T_*         x,                                             \
+                                 int64_t           incx,                                          \
+                                 const T_*         beta,                                          \
+                                 T_*               y,                                             \
+                                 int64_t           incy)                                          \
+    try                                                                                           \
+    {                                                                                             \
+        return rocblas_gemv_64_impl(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy); \
+    }                                                                                             \
+    catch(...)                                                                                    \
+    {                                                                                             \
+        return exception_to_rocblas_status();                                                     \
+    }
+
+IMPL(rocblas_sgemv_64, float);
+IMPL(rocblas_dgemv_64, double);
+IMPL(rocblas_cgemv_64, rocblas_float_complex);
+IMPL(rocblas_zgemv_64, rocblas_double_complex);
+
+#undef IMPL
+
 } // extern "C"
@@ -105,6 +105,36 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                    rocblas_int       batch_count,
                                    T*                workspace = nullptr);
 
+// Largest number of vectors of rocblas_internal_gemv_multi_template
+constexpr rocblas_int ROCBLAS_GEMV_MULTI_MAX_VECTORS = 16;
+
+/*! \brief Y := alpha * op(A) * X + beta * Y for nv <= ROCBLAS_GEMV_MULTI_MAX_VECTORS vectors,
+    reading A once. Element (i, j) of X is x[i * incx + j * ldx] and of Y is y[i * incy + j * ldy],
+    and m and n are the dimensions of A as in gemv. incx and incy are positive. */
+template <typename T, typename V, typename W>
+rocblas_status rocblas_internal_gemv_multi_template(rocblas_handle    handle,
+                                                    rocblas_operation transA,
+                                                    rocblas_int       m,
+                                                    rocblas_int       n,
+                                                    rocblas_int       nv,
+                                                    const T*          alpha,
+                                                    const V*          A,
+                                                    rocblas_stride    offseta,
+                                                    rocblas_int       lda,
+                                                    rocblas_stride    strideA,
+                                                    const V*          x,
+                                                    rocblas_stride    offsetx,
+                                                    rocblas_int       incx,
+                                                    rocblas_int       ldx,
+                                                    rocblas_stride    stridex,
+                                                    const T*          beta,
+                                                    W*                y,
+                                                    rocblas_stride    offsety,
+                                                    rocblas_int       incy,
+                                                    rocblas_int       ldy,
+                                                    rocblas_stride    stridey,
+                                                    rocblas_int       batch_count);
+
 template <typename T, typename U>
 rocblas_status rocblas_gemv_check_numerics(const char*       function_name,
                                            rocblas_handle    handle,
@@ -58,7 +58,7 @@ namespace
         if(handle->is_device_memory_size_query())
             return handle->set_optimal_device_memory_size(dev_bytes);
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
 
         if(layer_mode
@@ -180,12 +180,16 @@ namespace
                 return gemv_check_numerics_status;
         }
 
+        // Device alpha and beta may differ per batch, see rocblas_set_batched_scalar_stride
+        rocblas_stride stride_alpha = handle->get_alpha_batch_stride();
+        rocblas_stride stride_beta  = handle->get_beta_batch_stride();
+
         rocblas_status status = rocblas_internal_gemv_template<T>(handle,
                                                                   transA,
                                                                   m,
                                                                   n,
                                                                   alpha,
-                                                                  0,
+                                                                  stride_alpha,
                                                                   A,
                                                                   0,
                                                                   lda,
@@ -195,7 +199,7 @@ namespace
                                                                   incx,
                                                                   0,
                                                                   beta,
-                                                                  0,
+                                                                  stride_beta,
                                                                   y,
                                                                   0,
                                                                   incy,
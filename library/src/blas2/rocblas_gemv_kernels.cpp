@@ -27,6 +27,10 @@
 #include "rocblas_gemv.hpp"
 #include "rocblas_level2_threshold.hpp"
 
+#ifdef BUILD_WITH_TENSILE
+#include "../blas3/Tensile/gemm.hpp"
+#endif
+
 // The warpSize * 2 corresponds to the number of x-dimension threads per block optimized for better performance in the double_buffered_kernels.
 constexpr int rocblas_gemv_bx()
 {
@@ -73,18 +77,40 @@ inline size_t rocblas_gemvt_sn_crossover<rocblas_double_complex>()
 }
 
 template <typename T>
-inline bool rocblas_gemvt_skinny_n(rocblas_operation transA, rocblas_int m, rocblas_int n)
+inline bool rocblas_gemvt_skinny_n(rocblas_operation transA,
+                                   rocblas_int       m,
+                                   rocblas_int       n,
+                                   int               skinny_ratio = gemvt_skinny_ratio_threshold)
 {
-    size_t    cross_over_n    = rocblas_gemvt_sn_crossover<T>();
-    const int skinny_constant = 2048;
-    if(transA != rocblas_operation_none && n < cross_over_n && m >= skinny_constant * n)
+    size_t cross_over_n = rocblas_gemvt_sn_crossover<T>();
+    if(transA != rocblas_operation_none && n < cross_over_n && m >= int64_t(skinny_ratio) * n)
         return true;
     else
         return false;
 }
 
+// Number of workgroups between which the double buffered gemvt kernel splits the rows of each
+// block column of A
+template <typename T>
+constexpr int rocblas_gemvt_double_buffered_block_y()
+{
+    return std::is_same<T, float>{} ? 8 : 16;
+}
+
+// Without atomics the double buffered gemvt kernel writes the partial sums of its workgroups to
+// the workspace, and a second kernel reduces them in a fixed order
+template <typename T>
+inline bool rocblas_gemvt_double_buffered_partials(rocblas_operation transA,
+                                                   rocblas_int       m,
+                                                   rocblas_int       n)
+{
+    return (std::is_same<T, float>{} || std::is_same<T, double>{})
+           && transA != rocblas_operation_none && m == n && m % rocblas_gemv_bx() == 0;
+}
+
 /*! \brief rocblas_internal_gemv_kernel_workspace_size
-    Currently only transpose/conj skinny n matrices use workspace memory, so usually returns 0
+    Currently only transpose/conj skinny n matrices and square real matrices use workspace memory,
+    so usually returns 0
     Work buffer for column reductions: number of blocks * cols * batch_count
 
     @param[in]
@@ -107,6 +133,9 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE size_t rocblas_internal_gemv_kernel_workspace_s
     if(m <= 0 || n <= 0 || batch_count <= 0)
         return 0;
 
+    if(rocblas_gemvt_double_buffered_partials<To>(transA, m, n))
+        return sizeof(To) * rocblas_gemvt_double_buffered_block_y<To>() * n * batch_count;
+
     if(!rocblas_gemvt_skinny_n<To>(transA, m, n))
         return 0; // workspace only used for skinny n kernel transpose/conj. transpose
 
@@ -114,6 +143,57 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE size_t rocblas_internal_gemv_kernel_workspace_s
     return sizeof(To) * blocks * n * batch_count;
 }
 
+static const rocblas_int rocblas_internal_gemvn_persistent_min_batch = [] {
+    // Batch count from which batched gemvn with m and n at most 128 runs the persistent kernel,
+    // whose grid fills the device once instead of having a workgroup per problem.
+    // 0 disables the persistent kernel.
+    constexpr rocblas_int GEMVN_PERSISTENT_MIN_BATCH = 8192;
+    rocblas_int           min_batch;
+    const char*           env = getenv("ROCBLAS_INTERNAL_GEMVN_PERSISTENT_MIN_BATCH");
+    return env && sscanf(env, "%d", &min_batch) == 1 ? min_batch : GEMVN_PERSISTENT_MIN_BATCH;
+}();
+
+static const rocblas_int rocblas_internal_gemv_gemm_min_batch = [] {
+    // Batch count from which a strided batched gemv sharing A runs as a single gemm.
+    // 0 disables the gemm.
+    constexpr rocblas_int GEMV_GEMM_MIN_BATCH = 16;
+    rocblas_int           min_batch;
+    const char*           env = getenv("ROCBLAS_INTERNAL_GEMV_GEMM_MIN_BATCH");
+    return env && sscanf(env, "%d", &min_batch) == 1 ? min_batch : GEMV_GEMM_MIN_BATCH;
+}();
+
+// Whether a strided batched gemv is the single gemm Y = alpha * op(A) * X + beta * Y: the batches
+// share A and their scalars, and their x and y are the columns of the matrices X and Y. The gemm
+// reads A once instead of once per batch, and runs on the matrix cores instead of at the
+// bandwidth of reading A. Reproducible mode keeps the gemv reductions.
+inline bool rocblas_gemv_use_gemm(rocblas_handle    handle,
+                                  rocblas_operation transA,
+                                  rocblas_int       m,
+                                  rocblas_int       n,
+                                  rocblas_stride    stride_alpha,
+                                  rocblas_stride    strideA,
+                                  rocblas_int       incx,
+                                  rocblas_stride    stridex,
+                                  rocblas_stride    stride_beta,
+                                  rocblas_int       incy,
+                                  rocblas_stride    stridey,
+                                  rocblas_int       batch_count)
+{
+#ifdef BUILD_WITH_TENSILE
+    rocblas_int x_len = transA == rocblas_operation_none ? n : m;
+    rocblas_int y_len = transA == rocblas_operation_none ? m : n;
+
+    return rocblas_internal_gemv_gemm_min_batch > 0
+           && batch_count >= rocblas_internal_gemv_gemm_min_batch && !handle->reproducible
+           && strideA == 0 && !stride_alpha && !stride_beta && incx == 1 && incy == 1
+           && y_len > 1 && stridex >= x_len && stridey >= y_len
+           && stridex <= std::numeric_limits<rocblas_int>::max()
+           && stridey <= std::numeric_limits<rocblas_int>::max();
+#else
+    return false;
+#endif
+}
+
 template <typename T, typename U, typename V, typename W>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     rocblas_internal_gemv_template(rocblas_handle    handle,
@@ -143,6 +223,52 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     if(!m || !n || !batch_count)
         return rocblas_status_success;
 
+#ifdef BUILD_WITH_TENSILE
+    // Only strided batches have the matrix layout of X and Y
+    if constexpr(std::is_same<V, T>{} && std::is_same<W, T>{})
+    {
+        if(rocblas_gemv_use_gemm(handle,
+                                 transA,
+                                 m,
+                                 n,
+                                 stride_alpha,
+                                 strideA,
+                                 incx,
+                                 stridex,
+                                 stride_beta,
+                                 incy,
+                                 stridey,
+                                 batch_count))
+        {
+            handle->log_kernel("rocblas_gemv_gemm");
+
+            rocblas_int x_len = transA == rocblas_operation_none ? n : m;
+            rocblas_int y_len = transA == rocblas_operation_none ? m : n;
+            return rocblas_internal_gemm_template<false>(handle,
+                                                         transA,
+                                                         rocblas_operation_none,
+                                                         y_len,
+                                                         batch_count,
+                                                         x_len,
+                                                         alpha,
+                                                         A,
+                                                         offseta,
+                                                         lda,
+                                                         rocblas_stride(0),
+                                                         x,
+                                                         offsetx,
+                                                         rocblas_int(stridex),
+                                                         rocblas_stride(0),
+                                                         beta,
+                                                         y,
+                                                         offsety,
+                                                         rocblas_int(stridey),
+                                                         rocblas_stride(0),
+                                                         1);
+        }
+    }
+#endif
+
     hipStream_t rocblas_stream = handle->get_stream();
 
     // in case of negative inc shift pointer to end of data for negative indexing tid*inc
@@ -154,6 +280,53 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                    : offsety;
     bool i64_indices = n * size_t(lda) > std::numeric_limits<rocblas_int>::max();
 
+    // While persisting ranges are set on the handle, A is streamed with nontemporal loads
+    // unless it is one of them. The matrices of batched calls are not looked up.
+    bool stream_A = false;
+    if constexpr(std::is_same<V, T>{})
+        stream_A = handle->is_streamed(
+            A + offseta,
+            sizeof(T) * (size_t(lda) * (n - 1) + m + size_t(batch_count - 1) * strideA));
+
+    if(handle->reproducible)
+    {
+        handle->log_kernel("rocblas_gemv_reproducible_kernel");
+
+        dim3 gemv_reproducible_grid(transA == rocblas_operation_none ? m : n, batch_count);
+        dim3 gemv_reproducible_threads(ROCBLAS_REPRODUCIBLE_NB);
+
+        auto gemv_reproducible = [&](auto alpha_, auto beta_) {
+#define gemv_reproducible_KARGS                                                             \
+    gemv_reproducible_grid, gemv_reproducible_threads, 0, rocblas_stream, m, n, alpha_,     \
+        stride_alpha, A, offseta, lda, strideA, x, shiftx, incx, stridex, beta_, stride_beta, \
+        y, shifty, incy, stridey
+
+            if(transA == rocblas_operation_none)
+                hipLaunchKernelGGL(
+                    (rocblas_gemv_reproducible_kernel<ROCBLAS_REPRODUCIBLE_NB, false, false, T>),
+                    gemv_reproducible_KARGS);
+            else if(transA == rocblas_operation_transpose)
+                hipLaunchKernelGGL(
+                    (rocblas_gemv_reproducible_kernel<ROCBLAS_REPRODUCIBLE_NB, true, false, T>),
+                    gemv_reproducible_KARGS);
+            else
+                hipLaunchKernelGGL(
+                    (rocblas_gemv_reproducible_kernel<ROCBLAS_REPRODUCIBLE_NB, true, true, T>),
+                    gemv_reproducible_KARGS);
+#undef gemv_reproducible_KARGS
+        };
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            gemv_reproducible(alpha, beta);
+        else
+        {
+            if(!*alpha && *beta == 1)
+                return rocblas_status_success;
+            gemv_reproducible(*alpha, *beta);
+        }
+        return rocblas_status_success;
+    }
+
     //Identifying the precision to have an appropriate optimization
     static constexpr bool is_float          = std::is_same<T, float>{};
     static constexpr bool is_double         = std::is_same<T, double>{};
@@ -168,14 +341,19 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     bool is_gfx906        = handle->getArch() == 906 ? true : false;
     bool is_gfx90a        = handle->getArch() == 910 ? true : false;
 
+    // Thresholds shared by the architectures, which may have been tuned for this one
+    const rocblas_level2_thresholds& thresholds = handle->level2_thresholds;
+
     if(transA == rocblas_operation_none)
     {
-#define gemvn_KARGS(alpha_, beta_)                                                             \
-    gemvn_grid, gemvn_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
-        strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy, stridey
+#define gemvn_KARGS(alpha_, beta_)                                                                \
+    gemvn_grid, gemvn_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda,    \
+        strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy, stridey, stream_A
 
         if(is_gfx90a && m <= 32 && n <= 32 && batch_count >= 256)
         {
+            handle->log_kernel("rocblas_gemvn_sm_mn_batched_kernel");
+
 #define gemvn_sm_mn_batched_KARGS(alpha_, beta_)                                                 \
     gemvn_sm_mn_batched_grid, gemvn_sm_mn_batched_threads, 0, rocblas_stream, m, n, alpha_,      \
         stride_alpha, A, offseta, lda, strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, \
@@ -209,9 +387,52 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                     gemvn_sm_mn_batched_KARGS(*alpha, *beta));
             }
 #undef gemvn_sm_mn_batched_KARGS
+        }
+        else if(m <= 128 && n <= 128 && rocblas_internal_gemvn_persistent_min_batch > 0
+                && batch_count >= rocblas_internal_gemvn_persistent_min_batch)
+        {
+            handle->log_kernel("rocblas_gemvn_persistent_batched_kernel");
+
+#define gemvn_persistent_KARGS(alpha_, beta_)                                                   \
+    gemvn_persistent_grid, gemvn_persistent_threads, 0, rocblas_stream, m, n, alpha_,           \
+        stride_alpha, A, offseta, lda, strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, \
+        shifty, incy, stridey, batch_count
+
+            // DIM_X threads per matrix, DIM_Y matrices per workgroup at a time
+            static constexpr int GEMVN_PERSISTENT_DIM_X         = 64;
+            static constexpr int GEMVN_PERSISTENT_DIM_Y         = 4;
+            static constexpr int GEMVN_PERSISTENT_BLOCKS_PER_CU = 8;
+
+            rocblas_int blocks = std::min((batch_count - 1) / GEMVN_PERSISTENT_DIM_Y + 1,
+                                          handle->getCUCount() * GEMVN_PERSISTENT_BLOCKS_PER_CU);
+            dim3        gemvn_persistent_grid(std::max(blocks, 1));
+            dim3        gemvn_persistent_threads(GEMVN_PERSISTENT_DIM_X, GEMVN_PERSISTENT_DIM_Y);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+            {
+                hipLaunchKernelGGL(
+                    (rocblas_gemvn_persistent_batched_kernel<GEMVN_PERSISTENT_DIM_X,
+                                                             GEMVN_PERSISTENT_DIM_Y,
+                                                             T>),
+                    gemvn_persistent_KARGS(alpha, beta));
+            }
+            else
+            {
+                if(!*alpha && *beta == 1)
+                    return rocblas_status_success;
+
+                hipLaunchKernelGGL(
+                    (rocblas_gemvn_persistent_batched_kernel<GEMVN_PERSISTENT_DIM_X,
+                                                             GEMVN_PERSISTENT_DIM_Y,
+                                                             T>),
+                    gemvn_persistent_KARGS(*alpha, *beta));
+            }
+#undef gemvn_persistent_KARGS
         }
         else if(n <= 128 && m >= 2048 * n)
         {
+            handle->log_kernel("rocblas_gemvn_kernel skinny");
+
             // skinny tuned block size
 
             static constexpr int GEMVN_DIM_X = 64;
@@ -250,6 +471,8 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         else if(is_atomics_allowed && is_gfx90a && (is_float || is_double) && (m == n)
                 && (m % rocblas_gemv_bx() == 0))
         {
+            handle->log_kernel("rocblas_gemvn_double_buffered_kernel");
+
             // The following rocblas_gemv_scal_kernel does the `y = y*beta` computation
             static constexpr int NB               = 256;
             const int            gemv_scal_blocks = (m - 1) / NB + 1;
@@ -339,6 +562,8 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                 || (m <= dgemvn_gfx906_upper_threshold
                                     && n <= dgemvn_gfx906_upper_threshold))))))
         {
+            handle->log_kernel("rocblas_gemvn_kernel gfx906_gfx908");
+
             static constexpr int GEMVN_DIM_X = 32;
             static constexpr int GEMVN_DIM_Y = 16;
             rocblas_int          blocks      = (m - 1) / (GEMVN_DIM_X * 4) + 1;
@@ -373,6 +598,8 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         }
         else // non-skinny
         {
+            handle->log_kernel("rocblas_gemvn_kernel");
+
             // GEMVN_DIM_Y must be at least 4, 8 * 8 is very slow only 40Gflop/s
             static constexpr int GEMVN_DIM_X = 64;
             static constexpr int GEMVN_DIM_Y = 16;
@@ -415,6 +642,8 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 
         if(m <= 64 && batch_count > 8) // few rows, e.g. qmcpack
         {
+            handle->log_kernel("rocblas_gemvtsm_kernel");
+
             // number of columns on the y-dim of the grid
             static constexpr int NB = 256;
             dim3                 gemvtsm_grid(batch_count);
@@ -475,8 +704,11 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                    stridey);
             }
         }
-        else if(workspace && rocblas_gemvt_skinny_n<T>(transA, m, n))
+        else if(workspace
+                && rocblas_gemvt_skinny_n<T>(transA, m, n, thresholds.gemvt_skinny_ratio))
         {
+            handle->log_kernel("rocblas_gemvt_sn_kernel");
+
             static constexpr int NB     = rocblas_gemvt_sn_NB();
             static constexpr int WIN    = rocblas_gemvt_sn_WIN();
             int                  blocks = rocblas_gemvt_sn_kernel_block_count(m);
@@ -539,18 +771,26 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 
 #undef gemvt_sn_KARGS
         }
-        //optimized gemvt kernel with double buffered loads for gfx908.
-        else if(is_atomics_allowed && (m == n) && (m % rocblas_gemv_bx() == 0)
-                && (is_gfx908
-                    && ((is_float && m > sgemvt_gfx908_lower_threshold)
-                        || (is_double && m > dgemvt_gfx908_lower_threshold))))
+        //optimized gemvt kernel with double buffered loads, enabled on gfx908 unless tuned.
+        //Without atomics the partial sums of its workgroups are reduced from the workspace.
+        else if((is_atomics_allowed
+                 || (workspace && rocblas_gemvt_double_buffered_partials<T>(transA, m, n)))
+                && (m == n) && (m % rocblas_gemv_bx() == 0)
+                && ((is_float && m > thresholds.sgemvt_double_buffered)
+                    || (is_double && m > thresholds.dgemvt_double_buffered)))
         {
-            // The following rocblas_gemv_scal_kernel does the `y = y*beta` computation
+            T* partials = is_atomics_allowed ? nullptr : workspace;
+
+            handle->log_kernel(partials ? "rocblas_gemvt_double_buffered_kernel partials"
+                                        : "rocblas_gemvt_double_buffered_kernel");
+
+            // The following rocblas_gemv_scal_kernel does the `y = y*beta` computation, which the
+            // reduction of the partial sums does otherwise
             static constexpr int NB               = 256;
             const int            gemv_scal_blocks = (n - 1) / NB + 1;
             dim3                 grid(gemv_scal_blocks, batch_count);
             dim3                 threads(NB);
-            if(handle->pointer_mode == rocblas_pointer_mode_device)
+            if(!partials && handle->pointer_mode == rocblas_pointer_mode_device)
             {
                 hipLaunchKernelGGL((rocblas_gemv_scal_kernel<NB, T>),
                                    grid,
@@ -565,7 +805,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                    incy,
                                    stridey);
             }
-            else
+            else if(!partials)
             {
                 if(*beta != 1)
                     hipLaunchKernelGGL((rocblas_gemv_scal_kernel<NB, T>),
@@ -583,7 +823,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
             }
             // The following kernel does the `y += A * x` computation
             static constexpr int thread_x            = rocblas_gemv_bx();
-            static constexpr int block_y             = is_float ? 8 : 16;
+            static constexpr int block_y             = rocblas_gemvt_double_buffered_block_y<T>();
             static constexpr int thread_y            = is_float ? 8 : 4;
             static constexpr int elements_per_thread = thread_x / (2 * thread_y);
 
@@ -593,7 +833,11 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 
 #define gemvt_double_buffered_KARGS(alpha_)                                                    \
     gemvt_grid, gemvt_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
-        strideA, x, shiftx, incx, stridex, y, shifty, incy, stridey
+        strideA, x, shiftx, incx, stridex, y, shifty, incy, stridey, partials
+
+#define gemvt_double_buffered_reduce_KARGS(beta_)                                               \
+    grid, threads, 0, rocblas_stream, n, block_y, beta_, stride_beta, y, shifty, incy, stridey, \
+        partials
 
             if(handle->pointer_mode == rocblas_pointer_mode_device)
             {
@@ -603,10 +847,14 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                                                          elements_per_thread,
                                                                          T>),
                                    gemvt_double_buffered_KARGS(alpha));
+
+                if(partials)
+                    hipLaunchKernelGGL((rocblas_gemvt_double_buffered_reduce<NB, T>),
+                                       gemvt_double_buffered_reduce_KARGS(beta));
             }
             else
             {
-                if(!*alpha)
+                if(!*alpha && !partials)
                     return rocblas_status_success;
 
                 hipLaunchKernelGGL((rocblas_gemvt_double_buffered_kernel<CONJ,
@@ -615,21 +863,28 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                                                          elements_per_thread,
                                                                          T>),
                                    gemvt_double_buffered_KARGS(*alpha));
+
+                if(partials)
+                    hipLaunchKernelGGL((rocblas_gemvt_double_buffered_reduce<NB, T>),
+                                       gemvt_double_buffered_reduce_KARGS(*beta));
             }
+#undef gemvt_double_buffered_reduce_KARGS
 #undef gemvt_double_buffered_KARGS
         }
 
-#define gemvt_KARGS(alpha_, beta_)                                                             \
-    gemvt_grid, gemvt_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
-        strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy, stridey
+#define gemvt_KARGS(alpha_, beta_)                                                                \
+    gemvt_grid, gemvt_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda,    \
+        strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy, stridey, stream_A
 
         //Using kernel code with warp reduction for gfx1030.
         else if(is_arch_10_or_11
                 && (is_double || is_complex_float
                     || (is_float
-                        && (m < sgemvt_gfx_arch_10_11_threshold
-                            || n < sgemvt_gfx_arch_10_11_threshold))))
+                        && (m < thresholds.sgemvt_warp_reduce
+                            || n < thresholds.sgemvt_warp_reduce))))
         {
+            handle->log_kernel("rocblas_gemvt_warp_reduce_kernel");
+
             //Number of threads per block
             static constexpr int NB = 256;
             dim3                 gemvt_grid(n, batch_count);
@@ -649,10 +904,12 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                    gemvt_KARGS(*alpha, *beta));
             }
         }
-        //Using kernel code with shared memory reduction for single precision as well as for other precisions when m or n is less than 6000 and for complex double in gfx1030.
-        else if((is_float || m < gemvt_threshold || n < gemvt_threshold)
+        //Using kernel code with shared memory reduction for single precision as well as for other precisions when m or n is less than the gemvt threshold (6000 unless tuned) and for complex double in gfx1030.
+        else if((is_float || m < thresholds.gemvt || n < thresholds.gemvt)
                 || (is_arch_10_or_11 && is_complex_double))
         {
+            handle->log_kernel("rocblas_gemvt_kernel");
+
             //Number of threads per block
             static constexpr int NB = 256;
             dim3                 gemvt_grid(n, batch_count);
@@ -675,6 +932,8 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         //Having 1024 threads per block for double, complex-float and complex-double precision GEMV (transpose) for better performance.
         else
         {
+            handle->log_kernel("rocblas_gemvt_warp_reduce_kernel");
+
             //Number of threads per block
             static constexpr int NB = 1024;
             dim3                 gemvt_grid(n, batch_count);
@@ -703,6 +962,8 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 
         if(m <= 64 && batch_count > 8) // few rows, e.g. qmcpack
         {
+            handle->log_kernel("rocblas_gemvtsm_kernel");
+
             // number of columns on the y-dim of the grid
             static constexpr int NB = 256;
             dim3                 gemvtsm_grid(batch_count);
@@ -763,8 +1024,11 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                    stridey);
             }
         }
-        else if(workspace && rocblas_gemvt_skinny_n<T>(transA, m, n))
+        else if(workspace
+                && rocblas_gemvt_skinny_n<T>(transA, m, n, thresholds.gemvt_skinny_ratio))
         {
+            handle->log_kernel("rocblas_gemvt_sn_kernel");
+
             static constexpr int NB     = rocblas_gemvt_sn_NB();
             static constexpr int WIN    = rocblas_gemvt_sn_WIN();
             int                  blocks = rocblas_gemvt_sn_kernel_block_count(m);
@@ -827,18 +1091,26 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 
 #undef gemvt_sn_KARGS
         }
-        //optimized gemvt kernel with double buffered loads for gfx908.
-        else if(is_atomics_allowed && (m == n) && (m % rocblas_gemv_bx() == 0)
-                && (is_gfx908
-                    && ((is_float && m > sgemvt_gfx908_lower_threshold)
-                        || (is_double && m > dgemvt_gfx908_lower_threshold))))
+        //optimized gemvt kernel with double buffered loads, enabled on gfx908 unless tuned.
+        //Without atomics the partial sums of its workgroups are reduced from the workspace.
+        else if((is_atomics_allowed
+                 || (workspace && rocblas_gemvt_double_buffered_partials<T>(transA, m, n)))
+                && (m == n) && (m % rocblas_gemv_bx() == 0)
+                && ((is_float && m > thresholds.sgemvt_double_buffered)
+                    || (is_double && m > thresholds.dgemvt_double_buffered)))
         {
-            // The following rocblas_gemv_scal_kernel does the `y = y*beta` computation
+            T* partials = is_atomics_allowed ? nullptr : workspace;
+
+            handle->log_kernel(partials ? "rocblas_gemvt_double_buffered_kernel partials"
+                                        : "rocblas_gemvt_double_buffered_kernel");
+
+            // The following rocblas_gemv_scal_kernel does the `y = y*beta` computation, which the
+            // reduction of the partial sums does otherwise
             static constexpr int NB               = 256;
             const int            gemv_scal_blocks = (n - 1) / NB + 1;
             dim3                 grid(gemv_scal_blocks, batch_count);
             dim3                 threads(NB);
-            if(handle->pointer_mode == rocblas_pointer_mode_device)
+            if(!partials && handle->pointer_mode == rocblas_pointer_mode_device)
             {
                 hipLaunchKernelGGL((rocblas_gemv_scal_kernel<NB, T>),
                                    grid,
@@ -853,7 +1125,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                    incy,
                                    stridey);
             }
-            else
+            else if(!partials)
             {
                 if(*beta != 1)
                     hipLaunchKernelGGL((rocblas_gemv_scal_kernel<NB, T>),
@@ -871,7 +1143,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
             }
             // The following kernel does the `y += A * x` computation
             static constexpr int thread_x            = rocblas_gemv_bx();
-            static constexpr int block_y             = is_float ? 8 : 16;
+            static constexpr int block_y             = rocblas_gemvt_double_buffered_block_y<T>();
             static constexpr int thread_y            = is_float ? 8 : 4;
             static constexpr int elements_per_thread = thread_x / (2 * thread_y);
 
@@ -881,7 +1153,11 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 
 #define gemvt_double_buffered_KARGS(alpha_)                                                    \
     gemvt_grid, gemvt_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
-        strideA, x, shiftx, incx, stridex, y, shifty, incy, stridey
+        strideA, x, shiftx, incx, stridex, y, shifty, incy, stridey, partials
+
+#define gemvt_double_buffered_reduce_KARGS(beta_)                                               \
+    grid, threads, 0, rocblas_stream, n, block_y, beta_, stride_beta, y, shifty, incy, stridey, \
+        partials
 
             if(handle->pointer_mode == rocblas_pointer_mode_device)
             {
@@ -891,10 +1167,14 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                                                          elements_per_thread,
                                                                          T>),
                                    gemvt_double_buffered_KARGS(alpha));
+
+                if(partials)
+                    hipLaunchKernelGGL((rocblas_gemvt_double_buffered_reduce<NB, T>),
+                                       gemvt_double_buffered_reduce_KARGS(beta));
             }
             else
             {
-                if(!*alpha)
+                if(!*alpha && !partials)
                     return rocblas_status_success;
 
                 hipLaunchKernelGGL((rocblas_gemvt_double_buffered_kernel<CONJ,
@@ -903,16 +1183,23 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                                                          elements_per_thread,
                                                                          T>),
                                    gemvt_double_buffered_KARGS(*alpha));
+
+                if(partials)
+                    hipLaunchKernelGGL((rocblas_gemvt_double_buffered_reduce<NB, T>),
+                                       gemvt_double_buffered_reduce_KARGS(*beta));
             }
+#undef gemvt_double_buffered_reduce_KARGS
 #undef gemvt_double_buffered_KARGS
         }
 
-#define gemvt_KARGS(alpha_, beta_)                                                             \
-    gemvt_grid, gemvt_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
-        strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy, stridey
+#define gemvt_KARGS(alpha_, beta_)                                                                \
+    gemvt_grid, gemvt_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda,    \
+        strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy, stridey, stream_A
         //Using kernel code with shared memory reduction for single precision and all other precision when m or n is less than 6000.
         else if(is_float || m < 6000 || n < 6000)
         {
+            handle->log_kernel("rocblas_gemvt_kernel");
+
             //Number of threads per block
             static constexpr int NB = 256;
             dim3                 gemvt_grid(n, batch_count);
@@ -933,6 +1220,8 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         //Having 1024 threads per block for double, complex-float and complex-double precision GEMV (transpose) for better performance.
         else
         {
+            handle->log_kernel("rocblas_gemvt_warp_reduce_kernel");
+
             //Number of threads per block
             static constexpr int NB = 1024;
             dim3                 gemvt_grid(n, batch_count);
@@ -956,6 +1245,95 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     return rocblas_status_success;
 }
 
+template <typename T, typename V, typename W>
+rocblas_status rocblas_internal_gemv_multi_template(rocblas_handle    handle,
+                                                    rocblas_operation transA,
+                                                    rocblas_int       m,
+                                                    rocblas_int       n,
+                                                    rocblas_int       nv,
+                                                    const T*          alpha,
+                                                    const V*          A,
+                                                    rocblas_stride    offseta,
+                                                    rocblas_int       lda,
+                                                    rocblas_stride    strideA,
+                                                    const V*          x,
+                                                    rocblas_stride    offsetx,
+                                                    rocblas_int       incx,
+                                                    rocblas_int       ldx,
+                                                    rocblas_stride    stridex,
+                                                    const T*          beta,
+                                                    W*                y,
+                                                    rocblas_stride    offsety,
+                                                    rocblas_int       incy,
+                                                    rocblas_int       ldy,
+                                                    rocblas_stride    stridey,
+                                                    rocblas_int       batch_count)
+{
+    // quick return
+    if(!m || !n || !nv || !batch_count)
+        return rocblas_status_success;
+
+    if(nv > ROCBLAS_GEMV_MULTI_MAX_VECTORS)
+        return rocblas_status_invalid_size;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host && !*alpha && *beta == 1)
+        return rocblas_status_success;
+
+    hipStream_t rocblas_stream = handle->get_stream();
+
+    static constexpr int GEMVN_DIM_X = 64;
+    static constexpr int GEMVN_DIM_Y = 4;
+    static constexpr int GEMVT_NB    = 256;
+
+    // The sums of NV vectors are kept for nv rounded up to 4, 8 or 16, so that nv of 2 to 4 does
+    // not pay for the registers of 16
+    auto launch = [&](auto nv_max, auto alpha_, auto beta_) {
+        static constexpr rocblas_int NV = decltype(nv_max)::value;
+#define gemv_multi_KARGS(grid_, threads_)                                                     \
+    grid_, threads_, 0, rocblas_stream, m, n, nv, alpha_, A, offseta, lda, strideA, x, offsetx, \
+        incx, ldx, stridex, beta_, y, offsety, incy, ldy, stridey
+
+        if(transA == rocblas_operation_none)
+        {
+            dim3 grid((m - 1) / GEMVN_DIM_X + 1, batch_count);
+            dim3 threads(GEMVN_DIM_X, GEMVN_DIM_Y);
+            hipLaunchKernelGGL((rocblas_gemvn_multi_kernel<GEMVN_DIM_X, GEMVN_DIM_Y, NV, T>),
+                               gemv_multi_KARGS(grid, threads));
+        }
+        else
+        {
+            dim3 grid(n, batch_count);
+            dim3 threads(GEMVT_NB);
+            if(transA == rocblas_operation_transpose)
+                hipLaunchKernelGGL((rocblas_gemvt_multi_kernel<false, GEMVT_NB, NV, T>),
+                                   gemv_multi_KARGS(grid, threads));
+            else
+                hipLaunchKernelGGL((rocblas_gemvt_multi_kernel<true, GEMVT_NB, NV, T>),
+                                   gemv_multi_KARGS(grid, threads));
+        }
+#undef gemv_multi_KARGS
+    };
+
+    auto dispatch = [&](auto alpha_, auto beta_) {
+        if(nv <= 4)
+            launch(std::integral_constant<rocblas_int, 4>{}, alpha_, beta_);
+        else if(nv <= 8)
+            launch(std::integral_constant<rocblas_int, 8>{}, alpha_, beta_);
+        else
+            launch(std::integral_constant<rocblas_int, 16>{}, alpha_, beta_);
+    };
+
+    handle->log_kernel(transA == rocblas_operation_none ? "rocblas_gemvn_multi_kernel"
+                                                        : "rocblas_gemvt_multi_kernel");
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+        dispatch(alpha, beta);
+    else
+        dispatch(*alpha, *beta);
+
+    return rocblas_status_success;
+}
+
 template <typename T, typename U>
 rocblas_status rocblas_gemv_check_numerics(const char*       function_name,
                                            rocblas_handle    handle,
@@ -1093,6 +1471,46 @@ INSTANTIATE_GEMV_TEMPLATE(rocblas_double_complex, rocblas_double_complex, rocbla
 
 #undef INSTANTIATE_GEMV_TEMPLATE
 
+#ifdef INSTANTIATE_GEMV_MULTI_TEMPLATE
+#error INSTANTIATE_GEMV_MULTI_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_GEMV_MULTI_TEMPLATE(T_, V_, W_)                                   \
+template rocblas_status rocblas_internal_gemv_multi_template<T_, V_, W_>              \
+                                                   (rocblas_handle    handle,        \
+                                                    rocblas_operation transA,        \
+                                                    rocblas_int       m,             \
+                                                    rocblas_int       n,             \
+                                                    rocblas_int       nv,            \
+                                                    T_ const*         alpha,         \
+                                                    V_ const*         A,             \
+                                                    rocblas_stride    offseta,       \
+                                                    rocblas_int       lda,           \
+                                                    rocblas_stride    strideA,       \
+                                                    V_ const*         x,             \
+                                                    rocblas_stride    offsetx,       \
+                                                    rocblas_int       incx,          \
+                                                    rocblas_int       ldx,           \
+                                                    rocblas_stride    stridex,       \
+                                                    T_ const*         beta,          \
+                                                    W_*               y,             \
+                                                    rocblas_stride    offsety,       \
+                                                    rocblas_int       incy,          \
+                                                    rocblas_int       ldy,           \
+                                                    rocblas_stride    stridey,       \
+                                                    rocblas_int       batch_count);
+
+INSTANTIATE_GEMV_MULTI_TEMPLATE(float, float, float)
+INSTANTIATE_GEMV_MULTI_TEMPLATE(double, double, double)
+INSTANTIATE_GEMV_MULTI_TEMPLATE(rocblas_float_complex, rocblas_float_complex, rocblas_float_complex)
+INSTANTIATE_GEMV_MULTI_TEMPLATE(rocblas_double_complex, rocblas_double_complex, rocblas_double_complex)
+INSTANTIATE_GEMV_MULTI_TEMPLATE(float, float const*, float* const)
+INSTANTIATE_GEMV_MULTI_TEMPLATE(double, double const*, double* const)
+INSTANTIATE_GEMV_MULTI_TEMPLATE(rocblas_float_complex, rocblas_float_complex const*, rocblas_float_complex* const)
+INSTANTIATE_GEMV_MULTI_TEMPLATE(rocblas_double_complex, rocblas_double_complex const*, rocblas_double_complex* const)
+
+#undef INSTANTIATE_GEMV_MULTI_TEMPLATE
+
 #ifdef INSTANTIATE_GEMV_NUMERICS
 #error INSTANTIATE_GEMV_NUMERICS already defined
 #endif
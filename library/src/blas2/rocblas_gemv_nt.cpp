@@ -0,0 +1,424 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "check_numerics_matrix.hpp"
+#include "check_numerics_vector.hpp"
+#include "gemv_device.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+/*
+ * ===========================================================================
+ *    gemv_nt: y := alpha * A * x + beta * y and z := gamma * op(A) * w + delta * z
+ *    with op(A) = A**T or A**H, the two products of bi-conjugate gradient and
+ *    Lanczos bidiagonalization iterations, computed with a single pass over A.
+ * ===========================================================================
+ */
+
+namespace
+{
+    constexpr rocblas_int ROCBLAS_GEMV_NT_NB        = 256;
+    constexpr rocblas_int ROCBLAS_GEMV_NT_CU_BLOCKS = 8;
+
+    // columns of a block of A, each with an accumulator of z in every thread
+    template <typename T>
+    constexpr rocblas_int rocblas_gemv_nt_cols = std::is_same_v<T, rocblas_double_complex> ? 8 : 16;
+
+    template <typename T>
+    constexpr char rocblas_gemv_nt_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemv_nt_name<float>[] = "rocblas_sgemv_nt";
+    template <>
+    constexpr char rocblas_gemv_nt_name<double>[] = "rocblas_dgemv_nt";
+    template <>
+    constexpr char rocblas_gemv_nt_name<rocblas_float_complex>[] = "rocblas_cgemv_nt";
+    template <>
+    constexpr char rocblas_gemv_nt_name<rocblas_double_complex>[] = "rocblas_zgemv_nt";
+
+    //! @brief Splits A into row_blocks blocks of rows_per_block rows and col_blocks blocks of
+    //!        columns, with enough blocks to fill the device, and returns the bytes of the
+    //!        partial sums of y and z.
+    template <typename T>
+    size_t rocblas_gemv_nt_blocks(rocblas_handle handle,
+                                  rocblas_int    m,
+                                  rocblas_int    n,
+                                  rocblas_int&   row_blocks,
+                                  rocblas_int&   rows_per_block,
+                                  rocblas_int&   col_blocks)
+    {
+        constexpr rocblas_int NB     = ROCBLAS_GEMV_NT_NB;
+        const rocblas_int     chunks = (m - 1) / NB + 1;
+        const rocblas_int     target = handle->getCUCount() * ROCBLAS_GEMV_NT_CU_BLOCKS;
+
+        col_blocks     = (n - 1) / rocblas_gemv_nt_cols<T> + 1;
+        row_blocks     = std::max(1, std::min(chunks, target / col_blocks));
+        rows_per_block = ((chunks - 1) / row_blocks + 1) * NB;
+        row_blocks     = (m - 1) / rows_per_block + 1;
+
+        return sizeof(T) * (size_t(m) * col_blocks + size_t(n) * row_blocks);
+    }
+
+    template <typename T>
+    rocblas_status rocblas_gemv_nt_template(rocblas_handle    handle,
+                                            rocblas_operation trans,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const T*          alpha,
+                                            const T*          A,
+                                            rocblas_int       lda,
+                                            const T*          x,
+                                            rocblas_int       incx,
+                                            const T*          beta,
+                                            T*                y,
+                                            rocblas_int       incy,
+                                            const T*          gamma,
+                                            const T*          w,
+                                            rocblas_int       incw,
+                                            const T*          delta,
+                                            T*                z,
+                                            rocblas_int       incz,
+                                            T*                workspace)
+    {
+        hipStream_t rocblas_stream = handle->get_stream();
+
+        rocblas_int row_blocks, rows_per_block, col_blocks;
+        rocblas_gemv_nt_blocks<T>(handle, m, n, row_blocks, rows_per_block, col_blocks);
+
+        T* y_part = workspace;
+        T* z_part = workspace + size_t(m) * col_blocks;
+
+        // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+        x -= incx < 0 ? ptrdiff_t(incx) * (n - 1) : 0;
+        y -= incy < 0 ? ptrdiff_t(incy) * (m - 1) : 0;
+        w -= incw < 0 ? ptrdiff_t(incw) * (m - 1) : 0;
+        z -= incz < 0 ? ptrdiff_t(incz) * (n - 1) : 0;
+
+        // in host pointer mode A is not read if both products have zero scalars
+        bool read_a = handle->pointer_mode == rocblas_pointer_mode_device || *alpha != 0
+                      || *gamma != 0;
+        if(read_a)
+        {
+            constexpr rocblas_int COLS = rocblas_gemv_nt_cols<T>;
+            dim3                  grid(row_blocks, col_blocks);
+            dim3                  threads(ROCBLAS_GEMV_NT_NB);
+            if(trans == rocblas_operation_conjugate_transpose)
+                hipLaunchKernelGGL((rocblas_gemv_nt_kernel<ROCBLAS_GEMV_NT_NB, COLS, true>),
+                                   grid,
+                                   threads,
+                                   0,
+                                   rocblas_stream,
+                                   m,
+                                   n,
+                                   A,
+                                   lda,
+                                   x,
+                                   incx,
+                                   w,
+                                   incw,
+                                   rows_per_block,
+                                   y_part,
+                                   z_part);
+            else
+                hipLaunchKernelGGL((rocblas_gemv_nt_kernel<ROCBLAS_GEMV_NT_NB, COLS, false>),
+                                   grid,
+                                   threads,
+                                   0,
+                                   rocblas_stream,
+                                   m,
+                                   n,
+                                   A,
+                                   lda,
+                                   x,
+                                   incx,
+                                   w,
+                                   incw,
+                                   rows_per_block,
+                                   y_part,
+                                   z_part);
+        }
+
+        auto gemv_nt_finish = [&](auto alpha_, auto beta_, auto gamma_, auto delta_) {
+            dim3 grid((int64_t(m) + n - 1) / ROCBLAS_GEMV_NT_NB + 1);
+            dim3 threads(ROCBLAS_GEMV_NT_NB);
+            hipLaunchKernelGGL((rocblas_gemv_nt_finish_kernel<ROCBLAS_GEMV_NT_NB>),
+                               grid,
+                               threads,
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               alpha_,
+                               beta_,
+                               (const T*)y_part,
+                               col_blocks,
+                               y,
+                               incy,
+                               gamma_,
+                               delta_,
+                               (const T*)z_part,
+                               row_blocks,
+                               z,
+                               incz);
+        };
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            gemv_nt_finish(alpha, beta, gamma, delta);
+        else
+            gemv_nt_finish(*alpha, *beta, *gamma, *delta);
+
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_gemv_nt_impl(rocblas_handle    handle,
+                                        rocblas_operation trans,
+                                        rocblas_int       m,
+                                        rocblas_int       n,
+                                        const T*          alpha,
+                                        const T*          A,
+                                        rocblas_int       lda,
+                                        const T*          x,
+                                        rocblas_int       incx,
+                                        const T*          beta,
+                                        T*                y,
+                                        rocblas_int       incy,
+                                        const T*          gamma,
+                                        const T*          w,
+                                        rocblas_int       incw,
+                                        const T*          delta,
+                                        T*                z,
+                                        rocblas_int       incz)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        auto name = rocblas_gemv_nt_name<T>;
+
+        rocblas_int row_blocks, rows_per_block, col_blocks;
+        size_t      dev_bytes = 0;
+        if(m > 0 && n > 0)
+            dev_bytes = rocblas_gemv_nt_blocks<T>(
+                handle, m, n, row_blocks, rows_per_block, col_blocks);
+        if(handle->is_device_memory_size_query())
+        {
+            if(!dev_bytes)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      name,
+                      trans,
+                      m,
+                      n,
+                      alpha,
+                      A,
+                      lda,
+                      x,
+                      incx,
+                      beta,
+                      y,
+                      incy,
+                      gamma,
+                      w,
+                      incw,
+                      delta,
+                      z,
+                      incz);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        name,
+                        "trans",
+                        rocblas_transpose_letter(trans),
+                        "M",
+                        m,
+                        "N",
+                        n,
+                        "lda",
+                        lda,
+                        "incx",
+                        incx,
+                        "incy",
+                        incy,
+                        "incw",
+                        incw,
+                        "incz",
+                        incz);
+
+        if(trans != rocblas_operation_transpose && trans != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        if(m < 0 || n < 0 || lda < m || lda < 1 || !incx || !incy || !incw || !incz)
+            return rocblas_status_invalid_size;
+
+        // Quick return if possible.
+        if(!m || !n)
+            return rocblas_status_success;
+
+        if(!alpha || !beta || !gamma || !delta)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            if(*alpha == 0 && *beta == 1 && *gamma == 0 && *delta == 1)
+                return rocblas_status_success;
+
+            // pointers are validated if they need to be dereferenced
+            if(!y || !z || ((*alpha != 0 || *gamma != 0) && (!A || !x || !w)))
+                return rocblas_status_invalid_pointer;
+        }
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        auto check_vector = [&](rocblas_int len, const T* v, rocblas_int inc, bool is_input) {
+            return rocblas_internal_check_numerics_vector_template(
+                name, handle, len, v, 0, inc, 0, 1, check_numerics, is_input);
+        };
+
+        if(check_numerics)
+        {
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_internal_check_numerics_matrix_template(name,
+                                                                handle,
+                                                                rocblas_operation_none,
+                                                                rocblas_fill_full,
+                                                                rocblas_client_general_matrix,
+                                                                m,
+                                                                n,
+                                                                A,
+                                                                0,
+                                                                lda,
+                                                                0,
+                                                                1,
+                                                                check_numerics,
+                                                                true));
+            RETURN_IF_ROCBLAS_ERROR(check_vector(n, x, incx, true));
+            RETURN_IF_ROCBLAS_ERROR(check_vector(m, y, incy, true));
+            RETURN_IF_ROCBLAS_ERROR(check_vector(m, w, incw, true));
+            RETURN_IF_ROCBLAS_ERROR(check_vector(n, z, incz, true));
+        }
+
+        rocblas_status status = rocblas_gemv_nt_template(handle,
+                                                         trans,
+                                                         m,
+                                                         n,
+                                                         alpha,
+                                                         A,
+                                                         lda,
+                                                         x,
+                                                         incx,
+                                                         beta,
+                                                         y,
+                                                         incy,
+                                                         gamma,
+                                                         w,
+                                                         incw,
+                                                         delta,
+                                                         z,
+                                                         incz,
+                                                         (T*)w_mem[0]);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            RETURN_IF_ROCBLAS_ERROR(check_vector(m, y, incy, false));
+            RETURN_IF_ROCBLAS_ERROR(check_vector(n, z, incz, false));
+        }
+        return status;
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                            \
+    rocblas_status routine_name_(rocblas_handle    handle, \
+                                 rocblas_operation trans,  \
+                                 rocblas_int       m,      \
+                                 rocblas_int       n,      \
+                                 const T_*         alpha,  \
+                                 const T_*         A,      \
+                                 rocblas_int       lda,    \
+                                 const T_*         x,      \
+                                 rocblas_int       incx,   \
+                                 const T_*         beta,   \
+                                 T_*               y,      \
+                                 rocblas_int       incy,   \
+                                 const T_*         gamma,  \
+                                 const T_*         w,      \
+                                 rocblas_int       incw,   \
+                                 const T_*         delta,  \
+                                 T_*               z,      \
+                                 rocblas_int       incz)   \
+    try                                                    \
+    {                                                      \
+        return rocblas_gemv_nt_impl(handle,                \
+                                    trans,                 \
+                                    m,                     \
+                                    n,                     \
+                                    alpha,                 \
+                                    A,                     \
+                                    lda,                   \
+                                    x,                     \
+                                    incx,                  \
+                                    beta,                  \
+                                    y,                     \
+                                    incy,                  \
+                                    gamma,                 \
+                                    w,                     \
+                                    incw,                  \
+                                    delta,                 \
+                                    z,                     \
+                                    incz);                 \
+    }                                                      \
+    catch(...)                                             \
+    {                                                      \
+        return exception_to_rocblas_status();              \
+    }
+
+IMPL(rocblas_sgemv_nt, float);
+IMPL(rocblas_dgemv_nt, double);
+IMPL(rocblas_cgemv_nt, rocblas_float_complex);
+IMPL(rocblas_zgemv_nt, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
@@ -0,0 +1,293 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gemv_device.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+/*
+ * ===========================================================================
+ *    gemv_vbatched: y_i := alpha * op(A_i) * x_i + beta * y_i for a batch of
+ *    problems of different sizes, with m_i, n_i, lda_i, incx_i and incy_i in
+ *    device arrays. The tiles of all the problems are computed by a single
+ *    launch of the gemvn or gemvt tile kernels over a device sized grid.
+ * ===========================================================================
+ */
+
+namespace
+{
+    constexpr rocblas_int ROCBLAS_GEMV_VBATCHED_DIM_X     = 64;
+    constexpr rocblas_int ROCBLAS_GEMV_VBATCHED_DIM_Y     = 4;
+    constexpr rocblas_int ROCBLAS_GEMV_VBATCHED_NB        = 256;
+    constexpr rocblas_int ROCBLAS_GEMV_VBATCHED_SCAN_NB   = 256;
+    constexpr rocblas_int ROCBLAS_GEMV_VBATCHED_CU_BLOCKS = 8;
+
+    // rows of a tile of rocblas_gemvn_kernel_calc, which has a single row per thread for
+    // double complex
+    template <typename T>
+    constexpr rocblas_int rocblas_gemvn_vbatched_rows
+        = std::is_same_v<T, rocblas_double_complex> ? ROCBLAS_GEMV_VBATCHED_DIM_X
+                                                    : ROCBLAS_GEMV_VBATCHED_DIM_X * 4;
+
+    template <typename T>
+    constexpr char rocblas_gemv_vbatched_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemv_vbatched_name<float>[] = "rocblas_sgemv_vbatched";
+    template <>
+    constexpr char rocblas_gemv_vbatched_name<double>[] = "rocblas_dgemv_vbatched";
+    template <>
+    constexpr char rocblas_gemv_vbatched_name<rocblas_float_complex>[] = "rocblas_cgemv_vbatched";
+    template <>
+    constexpr char rocblas_gemv_vbatched_name<rocblas_double_complex>[] = "rocblas_zgemv_vbatched";
+
+    // tile offsets of the problems and the tile counter
+    inline size_t rocblas_gemv_vbatched_workspace_size(rocblas_int batch_count)
+    {
+        return sizeof(int64_t) * (batch_count + 1) + sizeof(unsigned long long);
+    }
+
+    template <typename T>
+    rocblas_status rocblas_gemv_vbatched_template(rocblas_handle     handle,
+                                                  rocblas_operation  transA,
+                                                  const rocblas_int* m,
+                                                  const rocblas_int* n,
+                                                  const T*           alpha,
+                                                  const T* const     A[],
+                                                  const rocblas_int* lda,
+                                                  const T* const     x[],
+                                                  const rocblas_int* incx,
+                                                  const T*           beta,
+                                                  T* const           y[],
+                                                  const rocblas_int* incy,
+                                                  rocblas_int        batch_count,
+                                                  void*              workspace)
+    {
+        hipStream_t rocblas_stream = handle->get_stream();
+
+        auto tile_start = (int64_t*)workspace;
+        auto counter    = (unsigned long long*)(tile_start + batch_count + 1);
+
+        const bool trans = transA != rocblas_operation_none;
+        if(trans)
+            hipLaunchKernelGGL(
+                (rocblas_gemv_vbatched_tiles_kernel<ROCBLAS_GEMV_VBATCHED_SCAN_NB, 1, true>),
+                dim3(1),
+                dim3(ROCBLAS_GEMV_VBATCHED_SCAN_NB),
+                0,
+                rocblas_stream,
+                m,
+                n,
+                lda,
+                incx,
+                incy,
+                batch_count,
+                tile_start,
+                counter);
+        else
+            hipLaunchKernelGGL((rocblas_gemv_vbatched_tiles_kernel<ROCBLAS_GEMV_VBATCHED_SCAN_NB,
+                                                                   rocblas_gemvn_vbatched_rows<T>,
+                                                                   false>),
+                               dim3(1),
+                               dim3(ROCBLAS_GEMV_VBATCHED_SCAN_NB),
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               lda,
+                               incx,
+                               incy,
+                               batch_count,
+                               tile_start,
+                               counter);
+
+        // enough workgroups to fill the device, each looping over the tiles
+        dim3 grid(handle->getCUCount() * ROCBLAS_GEMV_VBATCHED_CU_BLOCKS);
+
+#define gemv_vbatched_KARGS(alpha_, beta_)                                                        \
+    grid, threads, 0, rocblas_stream, m, n, alpha_, A, lda, x, incx, beta_, y, incy, batch_count, \
+        tile_start, counter
+
+        auto gemv_vbatched = [&](auto alpha_, auto beta_) {
+            if(!trans)
+            {
+                dim3 threads(ROCBLAS_GEMV_VBATCHED_DIM_X, ROCBLAS_GEMV_VBATCHED_DIM_Y);
+                hipLaunchKernelGGL((rocblas_gemvn_vbatched_kernel<ROCBLAS_GEMV_VBATCHED_DIM_X,
+                                                                  ROCBLAS_GEMV_VBATCHED_DIM_Y,
+                                                                  T>),
+                                   gemv_vbatched_KARGS(alpha_, beta_));
+            }
+            else
+            {
+                dim3 threads(ROCBLAS_GEMV_VBATCHED_NB);
+                if(transA == rocblas_operation_conjugate_transpose)
+                    hipLaunchKernelGGL(
+                        (rocblas_gemvt_vbatched_kernel<true, ROCBLAS_GEMV_VBATCHED_NB, T>),
+                        gemv_vbatched_KARGS(alpha_, beta_));
+                else
+                    hipLaunchKernelGGL(
+                        (rocblas_gemvt_vbatched_kernel<false, ROCBLAS_GEMV_VBATCHED_NB, T>),
+                        gemv_vbatched_KARGS(alpha_, beta_));
+            }
+        };
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            gemv_vbatched(alpha, beta);
+        else
+            gemv_vbatched(*alpha, *beta);
+
+#undef gemv_vbatched_KARGS
+
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_gemv_vbatched_impl(rocblas_handle     handle,
+                                              rocblas_operation  transA,
+                                              const rocblas_int* m,
+                                              const rocblas_int* n,
+                                              const T*           alpha,
+                                              const T* const     A[],
+                                              const rocblas_int* lda,
+                                              const T* const     x[],
+                                              const rocblas_int* incx,
+                                              const T*           beta,
+                                              T* const           y[],
+                                              const rocblas_int* incy,
+                                              rocblas_int        batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        auto name = rocblas_gemv_vbatched_name<T>;
+
+        size_t dev_bytes = batch_count > 0 ? rocblas_gemv_vbatched_workspace_size(batch_count) : 0;
+        if(handle->is_device_memory_size_query())
+        {
+            if(!dev_bytes)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(
+                handle, name, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        name,
+                        "transA",
+                        rocblas_transpose_letter(transA),
+                        "batch_count",
+                        batch_count);
+
+        if(transA != rocblas_operation_none && transA != rocblas_operation_transpose
+           && transA != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        if(batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        // Quick return if possible; the sizes of the problems are only known on the device
+        if(!batch_count)
+            return rocblas_status_success;
+
+        if(!m || !n || !lda || !incx || !incy || !alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            if(*alpha == 0 && *beta == 1)
+                return rocblas_status_success;
+
+            if(!y || (*alpha != 0 && (!A || !x)))
+                return rocblas_status_invalid_pointer;
+        }
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        return rocblas_gemv_vbatched_template(handle,
+                                              transA,
+                                              m,
+                                              n,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              x,
+                                              incx,
+                                              beta,
+                                              y,
+                                              incy,
+                                              batch_count,
+                                              (void*)w_mem);
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                        \
+    rocblas_status routine_name_(rocblas_handle     handle,                            \
+                                 rocblas_operation  transA,                            \
+                                 const rocblas_int* m,                                 \
+                                 const rocblas_int* n,                                 \
+                                 const T_*          alpha,                             \
+                                 const T_* const    A[],                               \
+                                 const rocblas_int* lda,                               \
+                                 const T_* const    x[],                               \
+                                 const rocblas_int* incx,                              \
+                                 const T_*          beta,                              \
+                                 T_* const          y[],                               \
+                                 const rocblas_int* incy,                              \
+                                 rocblas_int        batch_count)                       \
+    try                                                                                \
+    {                                                                                  \
+        return rocblas_gemv_vbatched_impl(                                             \
+            handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count); \
+    }                                                                                  \
+    catch(...)                                                                         \
+    {                                                                                  \
+        return exception_to_rocblas_status();                                          \
+    }
+
+IMPL(rocblas_sgemv_vbatched, float);
+IMPL(rocblas_dgemv_vbatched, double);
+IMPL(rocblas_cgemv_vbatched, rocblas_float_complex);
+IMPL(rocblas_zgemv_vbatched, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
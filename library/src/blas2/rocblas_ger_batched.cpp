@@ -78,7 +78,7 @@ namespace
             return rocblas_status_invalid_handle;
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
@@ -161,12 +161,19 @@ namespace
             if(ger_check_numerics_status != rocblas_status_success)
                 return ger_check_numerics_status;
         }
+        rocblas_fused_check_numerics fused_check(handle, rocblas_ger_batched_name<CONJ, T>, check_numerics);
+        RETURN_IF_ROCBLAS_ERROR(fused_check.begin());
+
         rocblas_status status = rocblas_internal_ger_template<CONJ, T>(
             handle, m, n, alpha, 0, x, 0, incx, 0, y, 0, incy, 0, A, 0, lda, 0, batch_count);
 
         if(status != rocblas_status_success)
             return status;
 
+        // The outputs were checked by the compute kernels
+        if(fused_check.is_active())
+            return fused_check.end();
+
         if(check_numerics)
         {
             bool           is_input = false;
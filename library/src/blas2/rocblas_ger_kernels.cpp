@@ -30,26 +30,28 @@ template <rocblas_int DIM_X,
           rocblas_int WIN,
           bool        CONJ,
           typename T,
+          bool        CHECK_NUMERICS,
           typename V,
           typename U,
           typename W>
 ROCBLAS_KERNEL(DIM_X* DIM_Y)
-rocblas_ger_kernel(rocblas_int    m,
-                   rocblas_int    n,
-                   V              alpha_device_host,
-                   rocblas_stride stride_alpha,
+rocblas_ger_kernel(rocblas_int               m,
+                   rocblas_int               n,
+                   V                         alpha_device_host,
+                   rocblas_stride            stride_alpha,
                    const U __restrict__ xa,
-                   rocblas_stride shiftx,
-                   rocblas_int    incx,
-                   rocblas_stride stridex,
+                   rocblas_stride            shiftx,
+                   rocblas_int               incx,
+                   rocblas_stride            stridex,
                    const U __restrict__ ya,
-                   rocblas_stride shifty,
-                   rocblas_int    incy,
-                   rocblas_stride stridey,
+                   rocblas_stride            shifty,
+                   rocblas_int               incy,
+                   rocblas_stride            stridey,
                    W __restrict__ Aa,
-                   rocblas_stride shifta,
-                   rocblas_int    lda,
-                   rocblas_stride strideA)
+                   rocblas_stride            shifta,
+                   rocblas_int               lda,
+                   rocblas_stride            strideA,
+                   rocblas_check_numerics_t* abnormal)
 {
     __shared__ T xdata[DIM_X];
     __shared__ T ydata[DIM_Y * WIN];
@@ -91,31 +93,35 @@ rocblas_ger_kernel(rocblas_int    m,
         {
             int yi = ty + i;
             if(yi < n)
-                A[tx + size_t(lda) * yi]
-                    += x_value * (CONJ ? conj(ydata[tyi + i]) : ydata[tyi + i]);
+            {
+                T& a = A[tx + size_t(lda) * yi];
+                a += x_value * (CONJ ? conj(ydata[tyi + i]) : ydata[tyi + i]);
+                rocblas_check_numerics_output<CHECK_NUMERICS>(a, abnormal);
+            }
         }
     }
 }
 
 //optimized kernel for SGER
-template <rocblas_int DIM_X, typename T, typename V, typename U, typename W>
+template <rocblas_int DIM_X, typename T, bool CHECK_NUMERICS, typename V, typename U, typename W>
 ROCBLAS_KERNEL(DIM_X)
-rocblas_sger_kernel(rocblas_int    m,
-                    rocblas_int    n,
-                    V              alpha_device_host,
-                    rocblas_stride stride_alpha,
+rocblas_sger_kernel(rocblas_int               m,
+                    rocblas_int               n,
+                    V                         alpha_device_host,
+                    rocblas_stride            stride_alpha,
                     const U __restrict__ xa,
-                    rocblas_stride shiftx,
-                    rocblas_int    incx,
-                    rocblas_stride stridex,
+                    rocblas_stride            shiftx,
+                    rocblas_int               incx,
+                    rocblas_stride            stridex,
                     const U __restrict__ ya,
-                    rocblas_stride shifty,
-                    rocblas_int    incy,
-                    rocblas_stride stridey,
+                    rocblas_stride            shifty,
+                    rocblas_int               incy,
+                    rocblas_stride            stridey,
                     W __restrict__ Aa,
-                    rocblas_stride shifta,
-                    rocblas_int    lda,
-                    rocblas_stride strideA)
+                    rocblas_stride            shifta,
+                    rocblas_int               lda,
+                    rocblas_stride            strideA,
+                    rocblas_check_numerics_t* abnormal)
 {
     rocblas_int tx  = threadIdx.x;
     rocblas_int col = blockIdx.x;
@@ -144,6 +150,7 @@ rocblas_sger_kernel(rocblas_int    m,
     for(rocblas_int i = 0; tx + i < m; i += DIM_X)
     {
         A[i] += res_y * x[(tx + i) * incx];
+        rocblas_check_numerics_output<CHECK_NUMERICS>(A[i], abnormal);
     }
 }
 
@@ -153,27 +160,29 @@ template <bool        CONJ,
           rocblas_int DIM_Y,
           rocblas_int elements_per_thread,
           typename T,
+          bool        CHECK_NUMERICS,
           typename TStruct,
           typename U,
           typename W>
 ROCBLAS_KERNEL(DIM_X* DIM_Y)
-rocblas_ger_double_buffered_kernel(bool           host_ptr_mode,
-                                   rocblas_int    m,
-                                   rocblas_int    n,
-                                   TStruct        alpha_device_host,
-                                   rocblas_stride stride_alpha,
+rocblas_ger_double_buffered_kernel(bool                      host_ptr_mode,
+                                   rocblas_int               m,
+                                   rocblas_int               n,
+                                   TStruct                   alpha_device_host,
+                                   rocblas_stride            stride_alpha,
                                    const U __restrict__ xa,
-                                   rocblas_stride shiftx,
-                                   rocblas_int    incx,
-                                   rocblas_stride stridex,
+                                   rocblas_stride            shiftx,
+                                   rocblas_int               incx,
+                                   rocblas_stride            stridex,
                                    const U __restrict__ ya,
-                                   rocblas_stride shifty,
-                                   rocblas_int    incy,
-                                   rocblas_stride stridey,
+                                   rocblas_stride            shifty,
+                                   rocblas_int               incy,
+                                   rocblas_stride            stridey,
                                    W __restrict__ Aa,
-                                   rocblas_stride shifta,
-                                   rocblas_int    lda,
-                                   rocblas_stride strideA)
+                                   rocblas_stride            shifta,
+                                   rocblas_int               lda,
+                                   rocblas_stride            strideA,
+                                   rocblas_check_numerics_t* abnormal)
 {
     auto alpha              = host_ptr_mode ? alpha_device_host.value
                                             : load_scalar(alpha_device_host.ptr, blockIdx.z, stride_alpha);
@@ -230,7 +239,10 @@ rocblas_ger_double_buffered_kernel(bool           host_ptr_mode,
 // compute upper
 #pragma unroll
     for(int k = 0; k < elements_per_thread; k++)
+    {
         areg_upper[k] += x_reg_upper * (CONJ ? conj(y_reg[k]) : y_reg[k]);
+        rocblas_check_numerics_output<CHECK_NUMERICS>(areg_upper[k], abnormal);
+    }
 
 // store upper
 #pragma unroll
@@ -240,7 +252,10 @@ rocblas_ger_double_buffered_kernel(bool           host_ptr_mode,
 // compute lower
 #pragma unroll
     for(int k = 0; k < elements_per_thread; k++)
+    {
         areg_lower[k] += x_reg_lower * (CONJ ? conj(y_reg[k]) : y_reg[k]);
+        rocblas_check_numerics_output<CHECK_NUMERICS>(areg_lower[k], abnormal);
+    }
 
 // store lower
 #pragma unroll
@@ -286,86 +301,112 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 
     bool is_gfx90a = handle->getArch() == 910 ? true : false;
 
+    // The kernels check the values they write with rocblas_check_numerics_mode_fused
+    rocblas_check_numerics_t* abnormal = handle->fused_check_numerics;
+
 #define ger_KARGS(alpha_)                                                                  \
     ger_grid, ger_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, x, shiftx, incx, \
-        stridex, y, shifty, incy, stridey, A, offsetA, lda, strideA
+        stridex, y, shifty, incy, stridey, A, offsetA, lda, strideA, abnormal
 
-    //optimized double buffered loads kernel for float, double and float_complex precisions in gfx90a
-    if(is_gfx90a && (m > 2000) && (m == n)
-       && ((m % 64 == 0 && (is_double || is_complex_float)) || ((m % 128 == 0) && is_float)))
-    {
-        //The following rocblas_ger_double_buffered_kernel is only valid for the multiples of DIM_X
-        static constexpr int DIM_X               = is_float ? 128 : 64;
-        static constexpr int DIM_Y               = is_float ? 8 : 16;
-        static constexpr int elements_per_thread = DIM_X / (2 * DIM_Y);
-
-        const int block_x = m / DIM_X;
-        const int block_y = n / DIM_X;
-        dim3      ger_threads(DIM_X, DIM_Y);
-        dim3      ger_grid(block_x, block_y, batch_count);
-
-        bool host_ptr_mode = handle->pointer_mode == rocblas_pointer_mode_host;
-        rocblas_internal_val_ptr<V> alpha_device_host(host_ptr_mode, alpha);
-
-        hipLaunchKernelGGL(
-            (rocblas_ger_double_buffered_kernel<CONJ, DIM_X, DIM_Y, elements_per_thread, T>),
-            ger_grid,
-            ger_threads,
-            0,
-            rocblas_stream,
-            host_ptr_mode,
-            m,
-            n,
-            alpha_device_host,
-            stride_alpha,
-            x,
-            shiftx,
-            incx,
-            stridex,
-            y,
-            shifty,
-            incy,
-            stridey,
-            A,
-            offsetA,
-            lda,
-            strideA);
-    }
-    else if(is_float && m > 1024)
-    {
-        static constexpr int DIM_X = 1024;
-        dim3                 ger_grid(n, batch_count);
-        dim3                 ger_threads(DIM_X);
+    auto launch_ger = [&](auto fused) {
+        constexpr bool CHECK_NUMERICS = decltype(fused)::value;
 
-        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        //optimized double buffered loads kernel for float, double and float_complex precisions
+        //in gfx90a
+        if(is_gfx90a && (m > 2000) && (m == n)
+           && ((m % 64 == 0 && (is_double || is_complex_float)) || ((m % 128 == 0) && is_float)))
         {
-            hipLaunchKernelGGL((rocblas_sger_kernel<DIM_X, T>), ger_KARGS(alpha));
+            //The following rocblas_ger_double_buffered_kernel is only valid for the multiples of
+            //DIM_X
+            static constexpr int DIM_X               = is_float ? 128 : 64;
+            static constexpr int DIM_Y               = is_float ? 8 : 16;
+            static constexpr int elements_per_thread = DIM_X / (2 * DIM_Y);
+
+            const int block_x = m / DIM_X;
+            const int block_y = n / DIM_X;
+            dim3      ger_threads(DIM_X, DIM_Y);
+            dim3      ger_grid(block_x, block_y, batch_count);
+
+            bool host_ptr_mode = handle->pointer_mode == rocblas_pointer_mode_host;
+            rocblas_internal_val_ptr<V> alpha_device_host(host_ptr_mode, alpha);
+
+            hipLaunchKernelGGL(
+                (rocblas_ger_double_buffered_kernel<CONJ,
+                                                    DIM_X,
+                                                    DIM_Y,
+                                                    elements_per_thread,
+                                                    T,
+                                                    CHECK_NUMERICS>),
+                ger_grid,
+                ger_threads,
+                0,
+                rocblas_stream,
+                host_ptr_mode,
+                m,
+                n,
+                alpha_device_host,
+                stride_alpha,
+                x,
+                shiftx,
+                incx,
+                stridex,
+                y,
+                shifty,
+                incy,
+                stridey,
+                A,
+                offsetA,
+                lda,
+                strideA,
+                abnormal);
         }
-        else
+        else if(is_float && m > 1024)
         {
-            hipLaunchKernelGGL((rocblas_sger_kernel<DIM_X, T>), ger_KARGS(*alpha));
-        }
-    }
-    else
-    {
-        static constexpr int DIM_X   = 32;
-        static constexpr int DIM_Y   = 32;
-        static constexpr int WIN     = 2; // work item number of elements to process
-        rocblas_int          blocksX = (m - 1) / DIM_X + 1;
-        rocblas_int          blocksY = (n - 1) / (DIM_Y * WIN) + 1; // WIN columns/work item
-
-        dim3 ger_grid(blocksX, blocksY, batch_count);
-        dim3 ger_threads(DIM_X, DIM_Y);
-
-        if(handle->pointer_mode == rocblas_pointer_mode_device)
-        {
-            hipLaunchKernelGGL((rocblas_ger_kernel<DIM_X, DIM_Y, WIN, CONJ, T>), ger_KARGS(alpha));
+            static constexpr int DIM_X = 1024;
+            dim3                 ger_grid(n, batch_count);
+            dim3                 ger_threads(DIM_X);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+            {
+                hipLaunchKernelGGL((rocblas_sger_kernel<DIM_X, T, CHECK_NUMERICS>),
+                                   ger_KARGS(alpha));
+            }
+            else
+            {
+                hipLaunchKernelGGL((rocblas_sger_kernel<DIM_X, T, CHECK_NUMERICS>),
+                                   ger_KARGS(*alpha));
+            }
         }
         else
         {
-            hipLaunchKernelGGL((rocblas_ger_kernel<DIM_X, DIM_Y, WIN, CONJ, T>), ger_KARGS(*alpha));
+            static constexpr int DIM_X   = 32;
+            static constexpr int DIM_Y   = 32;
+            static constexpr int WIN     = 2; // work item number of elements to process
+            rocblas_int          blocksX = (m - 1) / DIM_X + 1;
+            rocblas_int          blocksY = (n - 1) / (DIM_Y * WIN) + 1; // WIN columns/work item
+
+            dim3 ger_grid(blocksX, blocksY, batch_count);
+            dim3 ger_threads(DIM_X, DIM_Y);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+            {
+                hipLaunchKernelGGL(
+                    (rocblas_ger_kernel<DIM_X, DIM_Y, WIN, CONJ, T, CHECK_NUMERICS>),
+                    ger_KARGS(alpha));
+            }
+            else
+            {
+                hipLaunchKernelGGL(
+                    (rocblas_ger_kernel<DIM_X, DIM_Y, WIN, CONJ, T, CHECK_NUMERICS>),
+                    ger_KARGS(*alpha));
+            }
         }
-    }
+    };
+
+    if(abnormal)
+        launch_ger(std::true_type{});
+    else
+        launch_ger(std::false_type{});
 #undef ger_KARGS
     return rocblas_status_success;
 }
@@ -23,6 +23,7 @@
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "rocblas_hbmv.hpp"
+#include "rocblas_sbmv_tiled.hpp"
 
 /**
   *  Helper for the non-transpose case. Iterates through each diagonal
@@ -226,6 +227,56 @@ rocblas_status rocblas_hbmv_template(rocblas_handle handle,
     auto shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
     auto shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
 
+    if(rocblas_sbmv_use_tiled(k))
+    {
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            rocblas_sbmv_tiled_launch<true>(handle,
+                                            uplo,
+                                            n,
+                                            k,
+                                            alpha,
+                                            0,
+                                            A,
+                                            offseta,
+                                            lda,
+                                            strideA,
+                                            x,
+                                            shiftx,
+                                            incx,
+                                            stridex,
+                                            beta,
+                                            0,
+                                            y,
+                                            shifty,
+                                            incy,
+                                            stridey,
+                                            batch_count);
+        else if(*alpha || *beta != 1)
+            rocblas_sbmv_tiled_launch<true>(handle,
+                                            uplo,
+                                            n,
+                                            k,
+                                            *alpha,
+                                            0,
+                                            A,
+                                            offseta,
+                                            lda,
+                                            strideA,
+                                            x,
+                                            shiftx,
+                                            incx,
+                                            stridex,
+                                            *beta,
+                                            0,
+                                            y,
+                                            shifty,
+                                            incy,
+                                            stridey,
+                                            batch_count);
+
+        return rocblas_status_success;
+    }
+
     // hbmvN_DIM_Y must be at least 4, 8 * 8 is very slow only 40Gflop/s
     static constexpr int hbmvN_DIM_X = 64;
     static constexpr int hbmvN_DIM_Y = 16;
@@ -53,7 +53,7 @@ namespace
         auto check_numerics = handle->check_numerics;
         if(!handle->is_device_memory_size_query())
         {
-            auto layer_mode = handle->layer_mode;
+            auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
             if(layer_mode
                & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
                   | rocblas_layer_mode_log_profile))
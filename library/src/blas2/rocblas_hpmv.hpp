@@ -24,6 +24,7 @@
 
 #include "../blas1/rocblas_copy.hpp"
 #include "check_numerics_vector.hpp"
+#include "rocblas_spmv_hpmv_tiled.hpp"
 
 template <typename TScal, typename TConstPtr, typename TPtr>
 inline rocblas_status rocblas_hpmv_arg_check(rocblas_handle handle,
@@ -73,8 +74,9 @@ inline rocblas_status rocblas_hpmv_arg_check(rocblas_handle handle,
   *  TScal     is always: const T* (either host or device)
   *  TConstPtr is either: const T* OR const T* const*
   *  TPtr      is either:       T* OR       T* const*
+  *  W         is always:       T*, the workspace of the tiled kernels
   */
-template <typename TScal, typename TConstPtr, typename TPtr>
+template <typename TScal, typename TConstPtr, typename TPtr, typename W>
 rocblas_status rocblas_hpmv_template(rocblas_handle handle,
                                      rocblas_fill   uplo,
                                      rocblas_int    n,
@@ -91,7 +93,8 @@ rocblas_status rocblas_hpmv_template(rocblas_handle handle,
                                      rocblas_stride offsety,
                                      rocblas_int    incy,
                                      rocblas_stride stridey,
-                                     rocblas_int    batch_count);
+                                     rocblas_int    batch_count,
+                                     W              workspace);
 
 //TODO :-Add rocblas_check_numerics_hp_matrix_template for checking Matrix `AP` which is a Hermitian Packed matrix
 template <typename T, typename U>
@@ -156,8 +156,9 @@ rocblas_hpmv_kernel(bool           is_upper,
   *  TScal     is always: const T* (either host or device)
   *  TConstPtr is either: const T* OR const T* const*
   *  TPtr      is either:       T* OR       T* const*
+  *  W         is always:       T*, the workspace of the tiled kernels
   */
-template <typename TScal, typename TConstPtr, typename TPtr>
+template <typename TScal, typename TConstPtr, typename TPtr, typename W>
 rocblas_status rocblas_hpmv_template(rocblas_handle handle,
                                      rocblas_fill   uplo,
                                      rocblas_int    n,
@@ -174,7 +175,8 @@ rocblas_status rocblas_hpmv_template(rocblas_handle handle,
                                      rocblas_stride offsety,
                                      rocblas_int    incy,
                                      rocblas_stride stridey,
-                                     rocblas_int    batch_count)
+                                     rocblas_int    batch_count,
+                                     W              workspace)
 {
     // quick return
     if(!n || !batch_count)
@@ -184,6 +186,55 @@ rocblas_status rocblas_hpmv_template(rocblas_handle handle,
     offsetx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
     offsety = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
 
+    // large matrices are read once by the tiled kernels, with partial results in workspace
+    if(workspace && rocblas_spmv_hpmv_use_tiled(n))
+    {
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            rocblas_spmv_hpmv_tiled_launch<true>(handle,
+                                                 uplo == rocblas_fill_upper,
+                                                 n,
+                                                 alpha,
+                                                 0,
+                                                 AP,
+                                                 offseta,
+                                                 strideA,
+                                                 x,
+                                                 offsetx,
+                                                 incx,
+                                                 stridex,
+                                                 beta,
+                                                 0,
+                                                 y,
+                                                 offsety,
+                                                 incy,
+                                                 stridey,
+                                                 batch_count,
+                                                 workspace);
+        else if(*alpha || *beta != 1)
+            rocblas_spmv_hpmv_tiled_launch<true>(handle,
+                                                 uplo == rocblas_fill_upper,
+                                                 n,
+                                                 *alpha,
+                                                 0,
+                                                 AP,
+                                                 offseta,
+                                                 strideA,
+                                                 x,
+                                                 offsetx,
+                                                 incx,
+                                                 stridex,
+                                                 *beta,
+                                                 0,
+                                                 y,
+                                                 offsety,
+                                                 incy,
+                                                 stridey,
+                                                 batch_count,
+                                                 workspace);
+
+        return rocblas_status_success;
+    }
+
     static constexpr int HPMV_DIM_X = 64;
     static constexpr int HPMV_DIM_Y = 16;
     rocblas_int          blocks     = (n - 1) / (HPMV_DIM_X) + 1;
@@ -302,8 +353,8 @@ rocblas_status rocblas_hpmv_check_numerics(const char*    function_name,
 #error INSTANTIATE_HPMV_TEMPLATE already defined
 #endif
 
-#define INSTANTIATE_HPMV_TEMPLATE(TScal_, TConstPtr_, TPtr_)             \
-template rocblas_status rocblas_hpmv_template<TScal_, TConstPtr_, TPtr_> \
+#define INSTANTIATE_HPMV_TEMPLATE(TScal_, TConstPtr_, TPtr_, W_)            \
+template rocblas_status rocblas_hpmv_template<TScal_, TConstPtr_, TPtr_, W_> \
                                     (rocblas_handle handle,              \
                                      rocblas_fill   uplo,                \
                                      rocblas_int    n,                   \
@@ -320,12 +371,13 @@ template rocblas_status rocblas_hpmv_template<TScal_, TConstPtr_, TPtr_> \
                                      rocblas_stride offsety,             \
                                      rocblas_int    incy,                \
                                      rocblas_stride stridey,             \
-                                     rocblas_int    batch_count);
+                                     rocblas_int    batch_count,         \
+                                     W_             workspace);
 
-INSTANTIATE_HPMV_TEMPLATE(rocblas_float_complex const*, rocblas_float_complex const*, rocblas_float_complex*)
-INSTANTIATE_HPMV_TEMPLATE(rocblas_double_complex const*, rocblas_double_complex const*, rocblas_double_complex*)
-INSTANTIATE_HPMV_TEMPLATE(rocblas_float_complex const*, rocblas_float_complex const* const*, rocblas_float_complex* const*)
-INSTANTIATE_HPMV_TEMPLATE(rocblas_double_complex const*, rocblas_double_complex const* const*, rocblas_double_complex* const*)
+INSTANTIATE_HPMV_TEMPLATE(rocblas_float_complex const*, rocblas_float_complex const*, rocblas_float_complex*, rocblas_float_complex*)
+INSTANTIATE_HPMV_TEMPLATE(rocblas_double_complex const*, rocblas_double_complex const*, rocblas_double_complex*, rocblas_double_complex*)
+INSTANTIATE_HPMV_TEMPLATE(rocblas_float_complex const*, rocblas_float_complex const* const*, rocblas_float_complex* const*, rocblas_float_complex*)
+INSTANTIATE_HPMV_TEMPLATE(rocblas_double_complex const*, rocblas_double_complex const* const*, rocblas_double_complex* const*, rocblas_double_complex*)
 
 #undef INSTANTIATE_HPMV_TEMPLATE
 
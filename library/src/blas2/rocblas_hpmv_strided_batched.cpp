@@ -49,9 +49,7 @@ namespace
     {
         if(!handle)
             return rocblas_status_invalid_handle;
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
-
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
@@ -142,6 +140,14 @@ namespace
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
+        size_t dev_bytes = rocblas_internal_spmv_hpmv_workspace_size<T>(n, batch_count);
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(dev_bytes);
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
         if(check_numerics)
         {
             bool           is_input = true;
@@ -183,7 +189,8 @@ namespace
                                                       offset_y,
                                                       incy,
                                                       stride_y,
-                                                      batch_count);
+                                                      batch_count,
+                                                      (T*)w_mem[0]);
         if(status != rocblas_status_success)
             return status;
 
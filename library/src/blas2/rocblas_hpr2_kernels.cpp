@@ -23,6 +23,7 @@
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "rocblas_hpr2.hpp"
+#include "rocblas_triangular_tiles.hpp"
 
 template <typename T>
 __device__ void rocblas_hpr2_kernel_calc(bool        is_upper,
@@ -32,19 +33,19 @@ __device__ void rocblas_hpr2_kernel_calc(bool        is_upper,
                                          rocblas_int incx,
                                          const T*    y,
                                          rocblas_int incy,
-                                         T*          AP)
+                                         T*          AP,
+                                         rocblas_int tx,
+                                         rocblas_int ty)
 {
-    rocblas_int tx = blockIdx.x * blockDim.x + threadIdx.x;
-    rocblas_int ty = blockIdx.y * blockDim.y + threadIdx.y;
+    size_t index = is_upper ? ((size_t(ty) * (ty + 1)) / 2) + tx
+                            : ((size_t(ty) * (2 * size_t(n) - ty + 1)) / 2) + (tx - ty);
 
-    int index = is_upper ? ((ty * (ty + 1)) / 2) + tx : ((ty * (2 * n - ty + 1)) / 2) + (tx - ty);
-
-    if(is_upper ? ty < n && tx < ty : tx < n && ty < tx)
+    if(tx != ty)
     {
         AP[index] += alpha * x[tx * incx] * conj(y[ty * incy])
                      + conj(alpha) * y[tx * incy] * conj(x[ty * incx]);
     }
-    else if(tx == ty && tx < n)
+    else
     {
         AP[index] = std::real(AP[index]) + alpha * x[tx * incx] * conj(y[ty * incy])
                     + conj(alpha) * y[tx * incy] * conj(x[ty * incx]);
@@ -80,7 +81,9 @@ rocblas_hpr2_kernel(bool           is_upper,
     const auto* x  = load_ptr_batch(xa, blockIdx.z, shift_x, stride_x);
     const auto* y  = load_ptr_batch(ya, blockIdx.z, shift_y, stride_y);
 
-    rocblas_hpr2_kernel_calc(is_upper, n, alpha, x, incx, y, incy, AP);
+    rocblas_triangular_tile_apply<DIM_X, DIM_Y>(is_upper, n, [=](rocblas_int tx, rocblas_int ty) {
+        rocblas_hpr2_kernel_calc(is_upper, n, alpha, x, incx, y, incy, AP, tx, ty);
+    });
 }
 
 /**
@@ -115,12 +118,10 @@ rocblas_status rocblas_hpr2_template(rocblas_handle handle,
     ptrdiff_t shift_x = incx < 0 ? offset_x - ptrdiff_t(incx) * (n - 1) : offset_x;
     ptrdiff_t shift_y = incy < 0 ? offset_y - ptrdiff_t(incy) * (n - 1) : offset_y;
 
-    static constexpr int HPR2_DIM_X = 128;
-    static constexpr int HPR2_DIM_Y = 8;
-    rocblas_int          blocksX    = (n - 1) / HPR2_DIM_X + 1;
-    rocblas_int          blocksY    = (n - 1) / HPR2_DIM_Y + 1;
+    static constexpr int HPR2_DIM_X = 64;
+    static constexpr int HPR2_DIM_Y = 16;
 
-    dim3 hpr2_grid(blocksX, blocksY, batch_count);
+    dim3 hpr2_grid(rocblas_triangular_tile_count<HPR2_DIM_X>(n), 1, batch_count);
     dim3 hpr2_threads(HPR2_DIM_X, HPR2_DIM_Y);
 
     if(rocblas_pointer_mode_device == handle->pointer_mode)
@@ -23,19 +23,24 @@
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "rocblas_hpr.hpp"
+#include "rocblas_triangular_tiles.hpp"
 
 template <typename T, typename U>
-__device__ void rocblas_hpr_kernel_calc(
-    bool is_upper, rocblas_int n, U alpha, const T* x, rocblas_int incx, T* AP)
+__device__ void rocblas_hpr_kernel_calc(bool        is_upper,
+                                        rocblas_int n,
+                                        U           alpha,
+                                        const T*    x,
+                                        rocblas_int incx,
+                                        T*          AP,
+                                        rocblas_int tx,
+                                        rocblas_int ty)
 {
-    rocblas_int tx = blockIdx.x * blockDim.x + threadIdx.x;
-    rocblas_int ty = blockIdx.y * blockDim.y + threadIdx.y;
+    size_t index = is_upper ? ((size_t(ty) * (ty + 1)) / 2) + tx
+                            : ((size_t(ty) * (2 * size_t(n) - ty + 1)) / 2) + (tx - ty);
 
-    int index = is_upper ? ((ty * (ty + 1)) / 2) + tx : ((ty * (2 * n - ty + 1)) / 2) + (tx - ty);
-
-    if(is_upper ? ty < n && tx < ty : tx < n && ty < tx)
+    if(tx != ty)
         AP[index] += alpha * x[tx * incx] * conj(x[ty * incx]);
-    else if(tx == ty && tx < n)
+    else
     {
         U x_real  = std::real(x[tx * incx]);
         U x_imag  = std::imag(x[tx * incx]);
@@ -67,7 +72,9 @@ rocblas_hpr_kernel(bool           is_upper,
     auto*       AP = load_ptr_batch(APa, blockIdx.z, shift_A, stride_A);
     const auto* x  = load_ptr_batch(xa, blockIdx.z, shift_x, stride_x);
 
-    rocblas_hpr_kernel_calc(is_upper, n, alpha, x, incx, AP);
+    rocblas_triangular_tile_apply<DIM_X, DIM_Y>(is_upper, n, [=](rocblas_int tx, rocblas_int ty) {
+        rocblas_hpr_kernel_calc(is_upper, n, alpha, x, incx, AP, tx, ty);
+    });
 }
 
 /**
@@ -98,12 +105,10 @@ rocblas_status rocblas_hpr_template(rocblas_handle handle,
     // in case of negative inc, shift pointer to end of data for negative indexing tid*inc
     ptrdiff_t shift_x = incx < 0 ? offset_x - ptrdiff_t(incx) * (n - 1) : offset_x;
 
-    static constexpr int HPR_DIM_X = 128;
-    static constexpr int HPR_DIM_Y = 8;
-    rocblas_int          blocksX   = (n - 1) / HPR_DIM_X + 1;
-    rocblas_int          blocksY   = (n - 1) / HPR_DIM_Y + 1;
+    static constexpr int HPR_DIM_X = 64;
+    static constexpr int HPR_DIM_Y = 16;
 
-    dim3 hpr_grid(blocksX, blocksY, batch_count);
+    dim3 hpr_grid(rocblas_triangular_tile_count<HPR_DIM_X>(n), 1, batch_count);
     dim3 hpr_threads(HPR_DIM_X, HPR_DIM_Y);
 
     if(rocblas_pointer_mode_device == handle->pointer_mode)
@@ -40,6 +40,9 @@ constexpr int sgemvt_gfx_arch_10_11_threshold = 4000;
 constexpr int sgemvt_gfx908_lower_threshold = 7000;
 constexpr int dgemvt_gfx908_lower_threshold = 3000;
 
+// Ratio of m to n from which the skinny n kernel is used for gemv (transpose)
+constexpr int gemvt_skinny_ratio_threshold = 2048;
+
 /*********************************************************************symv**********************************************************************/
 
 // Double buffered load optimized for single and double precision for symv (upper)
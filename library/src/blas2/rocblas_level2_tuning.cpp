@@ -0,0 +1,354 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "level2_tuning.hpp"
+#include "rocblas_gemv.hpp"
+#include "utility.hpp"
+#include <iterator>
+#include <vector>
+
+/*******************************************************************************
+ * rocblas_tune_level2_thresholds measures the gemv (transpose) kernels which the
+ * Level 2 thresholds choose between, on the device of a handle. For each threshold
+ * the kernels on either side of it are timed over a range of sizes, and the
+ * threshold is placed where the faster kernel changes. A kernel whose results
+ * differ from the other one is never selected.
+ ******************************************************************************/
+
+namespace
+{
+    // Square sizes at which the square matrix kernels are compared
+    constexpr rocblas_int rocblas_level2_tuning_sizes[] = {1024, 2048, 3072, 4096, 6144, 8192};
+
+    // Ratios of m to n, and n, at which the skinny n kernel is compared
+    constexpr rocblas_int rocblas_level2_tuning_ratios[] = {2048, 4096, 8192, 16384};
+    constexpr rocblas_int rocblas_level2_tuning_skinny_n = 16;
+
+    constexpr int rocblas_level2_tuning_warmup     = 1;
+    constexpr int rocblas_level2_tuning_iterations = 5;
+
+    // Small integers keep every sum exact, so that all kernels compute identical results
+    template <int NB, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_level2_tuning_fill_kernel(size_t size, T* data)
+    {
+        size_t i = blockIdx.x * size_t(blockDim.x) + threadIdx.x;
+        if(i < size)
+            data[i] = T(i % 3);
+    }
+
+    // Device memory and events used to time gemv (transpose), released on destruction
+    template <typename T>
+    struct rocblas_gemvt_tuning_problem
+    {
+        T*         A         = nullptr;
+        T*         x         = nullptr;
+        T*         y         = nullptr;
+        T*         workspace = nullptr;
+        hipEvent_t start     = nullptr;
+        hipEvent_t stop      = nullptr;
+
+        rocblas_gemvt_tuning_problem() = default;
+
+        ~rocblas_gemvt_tuning_problem()
+        {
+            (void)(hipFree)(A);
+            (void)(hipFree)(x);
+            (void)(hipFree)(y);
+            (void)(hipFree)(workspace);
+            if(start)
+                (void)hipEventDestroy(start);
+            if(stop)
+                (void)hipEventDestroy(stop);
+        }
+
+        rocblas_gemvt_tuning_problem(const rocblas_gemvt_tuning_problem&) = delete;
+        rocblas_gemvt_tuning_problem& operator=(const rocblas_gemvt_tuning_problem&) = delete;
+
+        // Allocate for matrices of up to size_A elements with m rows and n columns at most
+        rocblas_status init(rocblas_handle handle, size_t size_A, size_t m, size_t n, size_t size_w)
+        {
+            static constexpr int NB     = 256;
+            hipStream_t          stream = handle->get_stream();
+
+            if((hipMalloc)(&A, size_A * sizeof(T)) != hipSuccess
+               || (hipMalloc)(&x, m * sizeof(T)) != hipSuccess
+               || (hipMalloc)(&y, n * sizeof(T)) != hipSuccess
+               || (size_w && (hipMalloc)(&workspace, size_w) != hipSuccess))
+                return rocblas_status_memory_error;
+
+            RETURN_IF_HIP_ERROR(hipEventCreate(&start));
+            RETURN_IF_HIP_ERROR(hipEventCreate(&stop));
+
+            hipLaunchKernelGGL((rocblas_level2_tuning_fill_kernel<NB, T>),
+                               dim3((size_A - 1) / NB + 1),
+                               dim3(NB),
+                               0,
+                               stream,
+                               size_A,
+                               A);
+            hipLaunchKernelGGL((rocblas_level2_tuning_fill_kernel<NB, T>),
+                               dim3((m - 1) / NB + 1),
+                               dim3(NB),
+                               0,
+                               stream,
+                               m,
+                               x);
+            return rocblas_status_success;
+        }
+
+        // Time y = A^T * x with the given thresholds, returning the result in result
+        rocblas_status time(rocblas_handle                   handle,
+                            const rocblas_level2_thresholds& thresholds,
+                            rocblas_int                      m,
+                            rocblas_int                      n,
+                            float&                           ms,
+                            std::vector<T>&                  result)
+        {
+            const T     alpha = 1, beta = 0;
+            hipStream_t stream = handle->get_stream();
+
+            handle->level2_thresholds = thresholds;
+
+            for(int i = 0; i < rocblas_level2_tuning_warmup + rocblas_level2_tuning_iterations; i++)
+            {
+                if(i == rocblas_level2_tuning_warmup)
+                    RETURN_IF_HIP_ERROR(hipEventRecord(start, stream));
+
+                RETURN_IF_ROCBLAS_ERROR(rocblas_internal_gemv_template(handle,
+                                                                       rocblas_operation_transpose,
+                                                                       m,
+                                                                       n,
+                                                                       &alpha,
+                                                                       0,
+                                                                       (const T*)A,
+                                                                       0,
+                                                                       m,
+                                                                       0,
+                                                                       (const T*)x,
+                                                                       0,
+                                                                       1,
+                                                                       0,
+                                                                       &beta,
+                                                                       0,
+                                                                       y,
+                                                                       0,
+                                                                       1,
+                                                                       0,
+                                                                       1,
+                                                                       workspace));
+            }
+            RETURN_IF_HIP_ERROR(hipEventRecord(stop, stream));
+            RETURN_IF_HIP_ERROR(hipEventSynchronize(stop));
+            RETURN_IF_HIP_ERROR(hipEventElapsedTime(&ms, start, stop));
+            ms /= rocblas_level2_tuning_iterations;
+
+            result.resize(n);
+            RETURN_IF_HIP_ERROR(
+                hipMemcpyAsync(result.data(), y, n * sizeof(T), hipMemcpyDeviceToHost, stream));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+            return rocblas_status_success;
+        }
+    };
+
+    /***************************************************************************
+     * Compare the kernel selected by setting threshold to fast_value, against
+     * the kernel selected by slow_value, for each of the sizes from the largest.
+     * Returns the smallest size at which the first kernel is faster and gives
+     * the same result, if that holds for all larger sizes, or -1 otherwise.
+     ***************************************************************************/
+    template <typename T, size_t N, typename F>
+    rocblas_status rocblas_level2_tuning_crossover(rocblas_handle                   handle,
+                                                   const rocblas_level2_thresholds& base,
+                                                   int rocblas_level2_thresholds::*threshold,
+                                                   int                              fast_value,
+                                                   int                              slow_value,
+                                                   const rocblas_int (&sizes)[N],
+                                                   F&&                              shape,
+                                                   rocblas_gemvt_tuning_problem<T>& problem,
+                                                   rocblas_int&                     crossover)
+    {
+        rocblas_level2_thresholds fast = base, slow = base;
+        fast.*threshold                = fast_value;
+        slow.*threshold                = slow_value;
+
+        crossover = -1;
+        for(size_t i = N; i-- > 0;)
+        {
+            rocblas_int m, n;
+            shape(sizes[i], m, n);
+
+            float          fast_ms, slow_ms;
+            std::vector<T> fast_y, slow_y;
+            RETURN_IF_ROCBLAS_ERROR(problem.time(handle, fast, m, n, fast_ms, fast_y));
+            RETURN_IF_ROCBLAS_ERROR(problem.time(handle, slow, m, n, slow_ms, slow_y));
+
+            if(fast_y != slow_y || fast_ms >= slow_ms)
+                break;
+            crossover = sizes[i];
+        }
+        return rocblas_status_success;
+    }
+
+    rocblas_status rocblas_tune_level2(rocblas_handle handle, rocblas_level2_thresholds& tuned)
+    {
+        auto square = [](rocblas_int size, rocblas_int& m, rocblas_int& n) { m = n = size; };
+        auto skinny = [](rocblas_int ratio, rocblas_int& m, rocblas_int& n) {
+            n = rocblas_level2_tuning_skinny_n;
+            m = ratio * n;
+        };
+
+        // The double buffered kernels are compared with all other thresholds at their
+        // defaults; the others with the double buffered kernels disabled
+        rocblas_level2_thresholds base = tuned;
+        base.sgemvt_double_buffered    = c_level2_threshold_disabled;
+        base.dgemvt_double_buffered    = c_level2_threshold_disabled;
+
+        const size_t max_size
+            = rocblas_level2_tuning_sizes[std::size(rocblas_level2_tuning_sizes) - 1];
+        rocblas_int crossover;
+        {
+            rocblas_gemvt_tuning_problem<float> problem;
+            RETURN_IF_ROCBLAS_ERROR(
+                problem.init(handle, max_size * max_size, max_size, max_size, 0));
+
+            RETURN_IF_ROCBLAS_ERROR(rocblas_level2_tuning_crossover(
+                handle,
+                tuned,
+                &rocblas_level2_thresholds::sgemvt_double_buffered,
+                0,
+                c_level2_threshold_disabled,
+                rocblas_level2_tuning_sizes,
+                square,
+                problem,
+                crossover));
+            tuned.sgemvt_double_buffered
+                = crossover < 0 ? c_level2_threshold_disabled : crossover - 1;
+
+            // The warp reduction kernel for single precision is only used on gfx10 and gfx11
+            int arch_major = handle->getArchMajor();
+            if(arch_major == 10 || arch_major == 11)
+            {
+                RETURN_IF_ROCBLAS_ERROR(rocblas_level2_tuning_crossover(
+                    handle,
+                    base,
+                    &rocblas_level2_thresholds::sgemvt_warp_reduce,
+                    0,
+                    c_level2_threshold_disabled,
+                    rocblas_level2_tuning_sizes,
+                    square,
+                    problem,
+                    crossover));
+                tuned.sgemvt_warp_reduce
+                    = crossover < 0 ? c_level2_threshold_disabled : crossover;
+            }
+        }
+        {
+            rocblas_gemvt_tuning_problem<double> problem;
+            RETURN_IF_ROCBLAS_ERROR(
+                problem.init(handle, max_size * max_size, max_size, max_size, 0));
+
+            RETURN_IF_ROCBLAS_ERROR(rocblas_level2_tuning_crossover(
+                handle,
+                tuned,
+                &rocblas_level2_thresholds::dgemvt_double_buffered,
+                0,
+                c_level2_threshold_disabled,
+                rocblas_level2_tuning_sizes,
+                square,
+                problem,
+                crossover));
+            tuned.dgemvt_double_buffered
+                = crossover < 0 ? c_level2_threshold_disabled : crossover - 1;
+
+            // gfx10 and gfx11 use the warp reduction kernel for double precision regardless
+            int arch_major = handle->getArchMajor();
+            if(arch_major != 10 && arch_major != 11)
+            {
+                RETURN_IF_ROCBLAS_ERROR(rocblas_level2_tuning_crossover(
+                    handle,
+                    base,
+                    &rocblas_level2_thresholds::gemvt,
+                    0,
+                    c_level2_threshold_disabled,
+                    rocblas_level2_tuning_sizes,
+                    square,
+                    problem,
+                    crossover));
+                tuned.gemvt = crossover < 0 ? c_level2_threshold_disabled : crossover;
+            }
+        }
+        {
+            const rocblas_int max_ratio
+                = rocblas_level2_tuning_ratios[std::size(rocblas_level2_tuning_ratios) - 1];
+            const size_t m      = size_t(max_ratio) * rocblas_level2_tuning_skinny_n;
+            const size_t n      = rocblas_level2_tuning_skinny_n;
+            size_t       size_w = rocblas_internal_gemv_kernel_workspace_size<float>(
+                rocblas_operation_transpose, rocblas_int(m), rocblas_int(n), 1);
+
+            rocblas_gemvt_tuning_problem<float> problem;
+            RETURN_IF_ROCBLAS_ERROR(problem.init(handle, m * n, m, n, size_w));
+
+            RETURN_IF_ROCBLAS_ERROR(rocblas_level2_tuning_crossover(
+                handle,
+                base,
+                &rocblas_level2_thresholds::gemvt_skinny_ratio,
+                gemvt_skinny_ratio_threshold,
+                c_level2_threshold_disabled,
+                rocblas_level2_tuning_ratios,
+                skinny,
+                problem,
+                crossover));
+            tuned.gemvt_skinny_ratio = crossover < 0 ? c_level2_threshold_disabled : crossover;
+        }
+        return rocblas_status_success;
+    }
+}
+
+extern "C" rocblas_status rocblas_tune_level2_thresholds(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    auto saved_device_id = handle->push_device_id();
+
+    // The double buffered kernels require atomics
+    rocblas_atomics_mode      saved_atomics_mode = handle->atomics_mode;
+    rocblas_level2_thresholds original           = handle->level2_thresholds;
+    rocblas_level2_thresholds tuned              = original;
+    handle->atomics_mode                         = rocblas_atomics_allowed;
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    rocblas_status status = rocblas_tune_level2(handle, tuned);
+
+    handle->atomics_mode      = saved_atomics_mode;
+    handle->level2_thresholds = status == rocblas_status_success ? tuned : original;
+    if(status == rocblas_status_success)
+        rocblas_level2_tuning::instance().record(rocblas_internal_get_arch_name(), tuned);
+    return status;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
@@ -23,6 +23,7 @@
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "rocblas_sbmv.hpp"
+#include "rocblas_sbmv_tiled.hpp"
 
 /**
   *  create partial sums for each ty.
@@ -205,6 +206,56 @@ rocblas_status rocblas_sbmv_template(rocblas_handle handle,
     auto shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
     auto shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
 
+    if(rocblas_sbmv_use_tiled(k))
+    {
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            rocblas_sbmv_tiled_launch<false>(handle,
+                                             uplo,
+                                             n,
+                                             k,
+                                             alpha,
+                                             stride_alpha,
+                                             A,
+                                             offseta,
+                                             lda,
+                                             strideA,
+                                             x,
+                                             shiftx,
+                                             incx,
+                                             stridex,
+                                             beta,
+                                             stride_beta,
+                                             y,
+                                             shifty,
+                                             incy,
+                                             stridey,
+                                             batch_count);
+        else if(batch_count > 1 || *alpha || *beta != 1)
+            rocblas_sbmv_tiled_launch<false>(handle,
+                                             uplo,
+                                             n,
+                                             k,
+                                             *alpha,
+                                             stride_alpha,
+                                             A,
+                                             offseta,
+                                             lda,
+                                             strideA,
+                                             x,
+                                             shiftx,
+                                             incx,
+                                             stridex,
+                                             *beta,
+                                             stride_beta,
+                                             y,
+                                             shifty,
+                                             incy,
+                                             stridey,
+                                             batch_count);
+
+        return rocblas_status_success;
+    }
+
     static constexpr int sbmv_DIM_X = 64;
     static constexpr int sbmv_DIM_Y = 16;
     rocblas_int          blocks     = (n - 1) / (sbmv_DIM_X) + 1;
@@ -0,0 +1,290 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * ===========================================================================
+ *    Band-tiled sbmv and hbmv, y = alpha * A * x + beta * y for a narrow band
+ *    symmetric or Hermitian matrix
+ * ===========================================================================
+ */
+
+// Block blk of the grid computes NB elements of y, rows r0 = blk * NB to r0 + NB - 1. The stored
+// band columns holding the elements of these rows, r0 to r0 + NB + k - 1 for the upper triangle
+// or r0 - k to r0 + NB - 1 for the lower, are loaded into LDS once with consecutive threads
+// reading consecutive band rows of a column, together with x[r0 - k] to x[r0 + NB + k - 1].
+// Element A(i, j) of the stored triangle is then read from LDS both as A(i, j) for row i of y
+// and as its symmetric counterpart A(j, i), conjugated for hbmv, for row j, instead of each
+// thread walking the full length of its row of A in global memory.
+//
+// With several small problems, n <= NB / 2, the packed kernel holds NB / n whole problems of the
+// batch in a block, so that the narrow band systems of a batch fill the workgroup.
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <type_traits>
+
+//! @brief Rows of y of a block of the band-tiled sbmv and hbmv, so that the band strip fits in LDS.
+template <typename T>
+constexpr rocblas_int rocblas_sbmv_tiled_nb()
+{
+    return sizeof(T) > 8 ? 32 : 64;
+}
+
+constexpr rocblas_int ROCBLAS_SBMV_TILED_THREADS = 256;
+
+// widest band, k + 1 band rows, of the strip held in LDS
+constexpr rocblas_int ROCBLAS_SBMV_TILED_MAX_K = 31;
+
+static const rocblas_int rocblas_internal_sbmv_tiled_max_k = [] {
+    // k up to which sbmv and hbmv use the band-tiled kernel instead of one thread per element of
+    // y walking the full length of a row. Limited to ROCBLAS_SBMV_TILED_MAX_K, negative disables.
+    rocblas_int max_k;
+    const char* env = getenv("ROCBLAS_INTERNAL_SBMV_TILED_MAX_K");
+    return env && sscanf(env, "%d", &max_k) == 1 ? std::min(max_k, ROCBLAS_SBMV_TILED_MAX_K)
+                                                 : ROCBLAS_SBMV_TILED_MAX_K;
+}();
+
+inline bool rocblas_sbmv_use_tiled(rocblas_int k)
+{
+    return k <= rocblas_internal_sbmv_tiled_max_k;
+}
+
+//! @brief y = alpha * A * x + beta * y for the n x n symmetric, or Hermitian if HERM, matrix A
+//! of bandwidth k <= ROCBLAS_SBMV_TILED_MAX_K, with NB / n problems per block if PACKED.
+template <rocblas_int NB,
+          bool        UPPER,
+          bool        HERM,
+          bool        PACKED,
+          typename T,
+          typename TScal,
+          typename TConstPtr,
+          typename TPtr>
+ROCBLAS_KERNEL(ROCBLAS_SBMV_TILED_THREADS)
+rocblas_sbmv_tiled_kernel(rocblas_int    n,
+                          rocblas_int    k,
+                          TScal          alpha_device_host,
+                          rocblas_stride stride_alpha,
+                          TConstPtr      Aa,
+                          rocblas_stride shifta,
+                          rocblas_int    lda,
+                          rocblas_stride strideA,
+                          TConstPtr      xa,
+                          rocblas_stride shiftx,
+                          rocblas_int    incx,
+                          rocblas_stride stridex,
+                          TScal          beta_device_host,
+                          rocblas_stride stride_beta,
+                          TPtr           ya,
+                          rocblas_stride shifty,
+                          rocblas_int    incy,
+                          rocblas_stride stridey,
+                          rocblas_int    batch_count)
+{
+    constexpr rocblas_int DIM_Y = ROCBLAS_SBMV_TILED_THREADS / NB;
+    constexpr rocblas_int KMAX  = ROCBLAS_SBMV_TILED_MAX_K;
+
+    // sA[b][p * width + c] is band row b of stored column c0 + c of problem p of the block, and
+    // sx[p * xw + c] is element x0 + c of its x
+    __shared__ T sA[KMAX + 1][NB + KMAX];
+    __shared__ T sx[NB + 2 * KMAX];
+    __shared__ T sum[DIM_Y][NB];
+
+    const rocblas_int tx  = threadIdx.x;
+    const rocblas_int ty  = threadIdx.y;
+    const rocblas_int tid = tx + ty * NB;
+
+    const rocblas_int P      = PACKED ? NB / n : 1;
+    const rocblas_int rows   = PACKED ? n : NB;
+    const rocblas_int r0     = PACKED ? 0 : blockIdx.x * NB;
+    const rocblas_int batch0 = PACKED ? blockIdx.x * P : blockIdx.y;
+    const rocblas_int c0     = PACKED ? 0 : (UPPER ? r0 : r0 - k);
+    const rocblas_int width  = PACKED ? n : NB + k;
+    const rocblas_int x0     = PACKED ? 0 : r0 - k;
+    const rocblas_int xw     = PACKED ? n : NB + 2 * k;
+
+    // A and x are not referenced, and may be null, when alpha is zero
+    for(rocblas_int e = tid; e < P * (k + 1) * width; e += ROCBLAS_SBMV_TILED_THREADS)
+    {
+        const rocblas_int p     = e / ((k + 1) * width);
+        const rocblas_int b     = e % (k + 1);
+        const rocblas_int c     = e % ((k + 1) * width) / (k + 1);
+        const rocblas_int col   = c0 + c;
+        const rocblas_int batch = batch0 + p;
+
+        T val = 0;
+        if(batch < batch_count && col >= 0 && col < n
+           && (UPPER ? col - k + b >= 0 : col + b < n)
+           && load_scalar(alpha_device_host, batch, stride_alpha))
+        {
+            const auto* A = load_ptr_batch(Aa, batch, shifta, strideA);
+            val           = A[b + int64_t(col) * lda];
+        }
+        sA[b][p * width + c] = val;
+    }
+
+    for(rocblas_int e = tid; e < P * xw; e += ROCBLAS_SBMV_TILED_THREADS)
+    {
+        const rocblas_int p     = e / xw;
+        const rocblas_int j     = x0 + e % xw;
+        const rocblas_int batch = batch0 + p;
+
+        T val = 0;
+        if(batch < batch_count && j >= 0 && j < n
+           && load_scalar(alpha_device_host, batch, stride_alpha))
+        {
+            const auto* x = load_ptr_batch(xa, batch, shiftx, stridex);
+            val           = x[j * int64_t(incx)];
+        }
+        sx[e] = val;
+    }
+
+    __syncthreads();
+
+    const rocblas_int p     = tx / rows;
+    const rocblas_int i     = PACKED ? tx % rows : r0 + tx;
+    const rocblas_int batch = batch0 + p;
+
+    T res = 0;
+    if(p < P && i < n)
+    {
+        for(rocblas_int d = ty - k; d <= k; d += DIM_Y)
+        {
+            const rocblas_int j = i + d;
+            if(j < 0 || j >= n)
+                continue;
+
+            // A(i, j) is in stored column j of the triangle, else A(j, i) is in stored column i
+            const bool        stored = UPPER ? d >= 0 : d <= 0;
+            const rocblas_int col    = stored ? j : i;
+            const rocblas_int b      = UPPER ? k - (d < 0 ? -d : d) : (d < 0 ? -d : d);
+
+            T a = sA[b][p * width + col - c0];
+            if constexpr(HERM)
+            {
+                // the imaginary part of the diagonal is assumed to be zero
+                if(d == 0)
+                    a = std::real(a);
+                else if(!stored)
+                    a = conj(a);
+            }
+            res += a * sx[p * xw + j - x0];
+        }
+    }
+
+    sum[ty][tx] = res;
+    __syncthreads();
+
+    if(ty == 0 && p < P && i < n && batch < batch_count)
+    {
+        for(rocblas_int s = 1; s < DIM_Y; s++)
+            res += sum[s][tx];
+
+        auto alpha = load_scalar(alpha_device_host, batch, stride_alpha);
+        auto beta  = load_scalar(beta_device_host, batch, stride_beta);
+        if(!alpha && beta == 1)
+            return;
+
+        auto*         y  = load_ptr_batch(ya, batch, shifty, stridey);
+        const int64_t iy = i * int64_t(incy);
+        y[iy]            = beta ? T(alpha * res + beta * y[iy]) : T(alpha * res);
+    }
+}
+
+//! @brief Launches the band-tiled kernel computing y = alpha * A * x + beta * y, packing the
+//! problems of a batch into blocks when n <= NB / 2.
+template <bool HERM, typename TScal, typename TConstPtr, typename TPtr>
+inline void rocblas_sbmv_tiled_launch(rocblas_handle handle,
+                                      rocblas_fill   uplo,
+                                      rocblas_int    n,
+                                      rocblas_int    k,
+                                      TScal          alpha,
+                                      rocblas_stride stride_alpha,
+                                      TConstPtr      A,
+                                      rocblas_stride shifta,
+                                      rocblas_int    lda,
+                                      rocblas_stride strideA,
+                                      TConstPtr      x,
+                                      rocblas_stride shiftx,
+                                      rocblas_int    incx,
+                                      rocblas_stride stridex,
+                                      TScal          beta,
+                                      rocblas_stride stride_beta,
+                                      TPtr           y,
+                                      rocblas_stride shifty,
+                                      rocblas_int    incy,
+                                      rocblas_stride stridey,
+                                      rocblas_int    batch_count)
+{
+    using T = std::remove_cv_t<
+        std::remove_pointer_t<std::remove_cv_t<std::remove_pointer_t<TPtr>>>>;
+
+    constexpr rocblas_int NB     = rocblas_sbmv_tiled_nb<T>();
+    const bool            packed = batch_count > 1 && n <= NB / 2;
+    dim3                  grid = packed ? dim3((batch_count - 1) / (NB / n) + 1)
+                                        : dim3((n - 1) / NB + 1, batch_count);
+    dim3                  threads(NB, ROCBLAS_SBMV_TILED_THREADS / NB);
+
+    auto launch = [&](auto upper, auto pack) {
+        constexpr bool UPPER  = decltype(upper)::value;
+        constexpr bool PACKED = decltype(pack)::value;
+
+        hipLaunchKernelGGL((rocblas_sbmv_tiled_kernel<NB, UPPER, HERM, PACKED, T>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           n,
+                           k,
+                           alpha,
+                           stride_alpha,
+                           A,
+                           shifta,
+                           lda,
+                           strideA,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           beta,
+                           stride_beta,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           batch_count);
+    };
+
+    bool upper = uplo == rocblas_fill_upper;
+    if(upper && packed)
+        launch(std::true_type{}, std::true_type{});
+    else if(upper)
+        launch(std::true_type{}, std::false_type{});
+    else if(packed)
+        launch(std::false_type{}, std::true_type{});
+    else
+        launch(std::false_type{}, std::false_type{});
+}
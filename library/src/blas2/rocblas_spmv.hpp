@@ -25,6 +25,7 @@
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "rocblas.h"
+#include "rocblas_spmv_hpmv_tiled.hpp"
 
 /**
   *  match rocblas_spmv_template parameters for easy calling
@@ -98,7 +99,8 @@ rocblas_status rocblas_spmv_template(rocblas_handle handle,
                                      rocblas_stride offsety,
                                      rocblas_int    incy,
                                      rocblas_stride stridey,
-                                     rocblas_int    batch_count);
+                                     rocblas_int    batch_count,
+                                     T*             workspace);
 
 //TODO :-Add rocblas_check_numerics_sp_matrix_template for checking Matrix `A` which is a Symmetric Packed Matrix
 template <typename T, typename U>
@@ -47,9 +47,7 @@ namespace
     {
         if(!handle)
             return rocblas_status_invalid_handle;
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
-
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
@@ -108,6 +106,14 @@ namespace
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
+        size_t dev_bytes = rocblas_internal_spmv_hpmv_workspace_size<T>(n, batch_count);
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(dev_bytes);
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
         if(check_numerics)
         {
             bool           is_input = true;
@@ -133,8 +139,26 @@ namespace
                 return spmv_check_numerics_status;
         }
 
-        rocblas_status status = rocblas_spmv_template<T>(
-            handle, uplo, n, alpha, 0, A, 0, 0, x, 0, incx, 0, beta, 0, y, 0, incy, 0, batch_count);
+        rocblas_status status = rocblas_spmv_template<T>(handle,
+                                                         uplo,
+                                                         n,
+                                                         alpha,
+                                                         0,
+                                                         A,
+                                                         0,
+                                                         0,
+                                                         x,
+                                                         0,
+                                                         incx,
+                                                         0,
+                                                         beta,
+                                                         0,
+                                                         y,
+                                                         0,
+                                                         incy,
+                                                         0,
+                                                         batch_count,
+                                                         (T*)w_mem[0]);
         if(status != rocblas_status_success)
             return status;
 
@@ -0,0 +1,310 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * ===========================================================================
+ *    Tiled spmv and hpmv, reading each element of the packed matrix once
+ * ===========================================================================
+ */
+
+// The matrix is viewed as its upper triangle of NB x NB tiles. Block blk of the grid loads the
+// tiles of block row blk of the upper triangle into LDS one at a time, and uses each tile for
+// both its contributions to A*x: the tile times x of its block column is accumulated for the
+// rows of block row blk, and the transposed (conjugate transposed for hpmv) tile times x of
+// block row blk gives the partial result of the rows of its block column. Diagonal tiles are
+// completed to full symmetric or Hermitian tiles in LDS.
+//
+// As for hemv and symv, the partial results are stored to workspace(ind, blk) of size
+// blocks * n per batch, defined for blk <= ind / NB, and a second kernel sums them into y.
+// For a lower packed matrix the tiles of the upper triangle are the transposed (conjugate
+// transposed) stored tiles, loaded so that consecutive threads read consecutive elements.
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas.h"
+#include <cstdio>
+#include <cstdlib>
+
+//! @brief Tile size of the tiled spmv and hpmv, so that a tile of T fits in LDS.
+template <typename T>
+constexpr rocblas_int rocblas_spmv_hpmv_tiled_nb()
+{
+    return sizeof(T) > 8 ? 32 : 64;
+}
+
+constexpr rocblas_int ROCBLAS_SPMV_HPMV_TILED_THREADS = 256;
+
+static const rocblas_int rocblas_internal_spmv_hpmv_tiled_min_size = [] {
+    // n from which spmv and hpmv use the tiled kernels reading each packed element once,
+    // instead of reading the elements of the opposite triangle a second time. 0 disables them.
+    constexpr rocblas_int SPMV_HPMV_TILED_MIN_SIZE = 512;
+    rocblas_int           min_size;
+    const char*           env = getenv("ROCBLAS_INTERNAL_SPMV_HPMV_TILED_MIN_SIZE");
+    return env && sscanf(env, "%d", &min_size) == 1 ? min_size : SPMV_HPMV_TILED_MIN_SIZE;
+}();
+
+inline bool rocblas_spmv_hpmv_use_tiled(rocblas_int n)
+{
+    return rocblas_internal_spmv_hpmv_tiled_min_size > 0
+           && n >= rocblas_internal_spmv_hpmv_tiled_min_size;
+}
+
+/*! \brief Workspace in bytes of the partial results of the tiled spmv and hpmv, the number of
+    block rows * n * batch_count elements of the compute type T, 0 if they are not used. */
+template <typename T>
+inline size_t rocblas_internal_spmv_hpmv_workspace_size(rocblas_int n, rocblas_int batch_count)
+{
+    if(!rocblas_spmv_hpmv_use_tiled(n))
+        return 0;
+
+    constexpr rocblas_int NB     = rocblas_spmv_hpmv_tiled_nb<T>();
+    size_t                blocks = (n - 1) / NB + 1;
+    return sizeof(T) * blocks * n * batch_count;
+}
+
+template <rocblas_int NB,
+          bool        HERM,
+          bool        UPPER,
+          typename T,
+          typename TScal,
+          typename TConstPtr>
+ROCBLAS_KERNEL(ROCBLAS_SPMV_HPMV_TILED_THREADS)
+rocblas_spmv_hpmv_tiled_kernel(rocblas_int    n,
+                               TScal          alpha_device_host,
+                               rocblas_stride stride_alpha,
+                               TConstPtr      APa,
+                               rocblas_stride shifta,
+                               rocblas_stride strideA,
+                               TConstPtr      xa,
+                               rocblas_stride shiftx,
+                               rocblas_int    incx,
+                               rocblas_stride stridex,
+                               T* __restrict__ workspace)
+{
+    constexpr rocblas_int DIM_Y = ROCBLAS_SPMV_HPMV_TILED_THREADS / NB;
+
+    auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
+    if(!alpha)
+        return;
+
+    const auto* AP = load_ptr_batch(APa, blockIdx.y, shifta, strideA);
+    const auto* x  = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+
+    // sA[r][c] is element (row0 + r, col0 + c) of the upper triangle of the current tile
+    __shared__ T sA[NB][NB + 1];
+    __shared__ T sxI[NB];
+    __shared__ T sxJ[NB];
+    __shared__ T sum[DIM_Y][NB];
+
+    const rocblas_int tx     = threadIdx.x;
+    const rocblas_int ty     = threadIdx.y;
+    const rocblas_int blk    = blockIdx.x;
+    const rocblas_int blocks = gridDim.x;
+    const int64_t     row0   = int64_t(blk) * NB;
+
+    // workspace is workspace(0, blk) of the batch
+    workspace += (size_t(blocks) * blockIdx.y + blk) * n;
+
+    if(ty == 0)
+        sxI[tx] = row0 + tx < n ? T(x[(row0 + tx) * incx]) : T(0);
+
+    T row_sum = 0;
+    for(rocblas_int J = blk; J < blocks; J++)
+    {
+        const int64_t col0 = int64_t(J) * NB;
+
+        // the previous tile and partial sums have been used
+        __syncthreads();
+
+        for(rocblas_int k = ty; k < NB; k += DIM_Y)
+        {
+            // consecutive threads read consecutive elements of a column of the stored triangle
+            const rocblas_int r = UPPER ? tx : k;
+            const rocblas_int c = UPPER ? k : tx;
+            const int64_t     i = row0 + r;
+            const int64_t     j = col0 + c;
+
+            T val = 0;
+            if(i <= j && j < n)
+            {
+                if(UPPER)
+                    val = AP[j * (j + 1) / 2 + i];
+                else
+                {
+                    val = AP[i * (2 * int64_t(n) - i + 1) / 2 + (j - i)];
+                    if(HERM)
+                        val = conj(val);
+                }
+                if constexpr(HERM)
+                {
+                    if(i == j)
+                        val = std::real(val);
+                }
+            }
+            sA[r][c] = val;
+        }
+
+        if(ty == 0)
+            sxJ[tx] = col0 + tx < n ? T(x[(col0 + tx) * incx]) : T(0);
+
+        __syncthreads();
+
+        if(J == blk)
+        {
+            // complete the diagonal tile from its upper triangle
+            for(rocblas_int k = ty; k < NB; k += DIM_Y)
+                if(tx > k)
+                    sA[tx][k] = HERM ? conj(sA[k][tx]) : sA[k][tx];
+
+            __syncthreads();
+        }
+
+        // tile times x of its block column, for the rows of block row blk
+        for(rocblas_int k = ty; k < NB; k += DIM_Y)
+            row_sum += sA[tx][k] * sxJ[k];
+
+        // transposed tile times x of block row blk, for the rows of block column J
+        if(J > blk)
+        {
+            T col_sum = 0;
+            for(rocblas_int k = ty; k < NB; k += DIM_Y)
+                col_sum += (HERM ? conj(sA[k][tx]) : sA[k][tx]) * sxI[k];
+
+            sum[ty][tx] = col_sum;
+            __syncthreads();
+
+            if(ty == 0 && col0 + tx < n)
+            {
+                for(rocblas_int k = 1; k < DIM_Y; k++)
+                    col_sum += sum[k][tx];
+                workspace[col0 + tx] = col_sum;
+            }
+        }
+    }
+
+    __syncthreads();
+    sum[ty][tx] = row_sum;
+    __syncthreads();
+
+    if(ty == 0 && row0 + tx < n)
+    {
+        for(rocblas_int k = 1; k < DIM_Y; k++)
+            row_sum += sum[k][tx];
+        workspace[row0 + tx] = row_sum;
+    }
+}
+
+//! @brief y = alpha * A*x + beta * y, with A*x the sum of the partial results in workspace.
+template <rocblas_int NB, typename T, typename TScal, typename TPtr>
+ROCBLAS_KERNEL(NB)
+rocblas_spmv_hpmv_tiled_sum_kernel(rocblas_int    n,
+                                   TScal          alpha_device_host,
+                                   rocblas_stride stride_alpha,
+                                   TScal          beta_device_host,
+                                   rocblas_stride stride_beta,
+                                   const T* __restrict__ workspace,
+                                   TPtr           ya,
+                                   rocblas_stride shifty,
+                                   rocblas_int    incy,
+                                   rocblas_stride stridey)
+{
+    auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
+    auto beta  = load_scalar(beta_device_host, blockIdx.y, stride_beta);
+    if(!alpha && beta == 1)
+        return;
+
+    const rocblas_int ind = blockIdx.x * NB + threadIdx.x;
+    if(ind >= n)
+        return;
+
+    auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    T Ax = 0;
+    if(alpha)
+    {
+        // workspace is workspace(ind, 0) of the batch
+        workspace += size_t(gridDim.x) * n * blockIdx.y + ind;
+        for(rocblas_int blk = 0; blk <= ind / NB; blk++)
+            Ax += workspace[size_t(blk) * n];
+    }
+
+    y[ind * int64_t(incy)] = beta ? alpha * Ax + beta * y[ind * int64_t(incy)] : alpha * Ax;
+}
+
+//! @brief Launches the tiled spmv or hpmv of one uplo, with alpha and beta values or pointers.
+template <bool HERM, typename T, typename TScal, typename TConstPtr, typename TPtr>
+inline void rocblas_spmv_hpmv_tiled_launch(rocblas_handle handle,
+                                           bool           is_upper,
+                                           rocblas_int    n,
+                                           TScal          alpha,
+                                           rocblas_stride stride_alpha,
+                                           TConstPtr      AP,
+                                           rocblas_stride shifta,
+                                           rocblas_stride strideA,
+                                           TConstPtr      x,
+                                           rocblas_stride shiftx,
+                                           rocblas_int    incx,
+                                           rocblas_stride stridex,
+                                           TScal          beta,
+                                           rocblas_stride stride_beta,
+                                           TPtr           y,
+                                           rocblas_stride shifty,
+                                           rocblas_int    incy,
+                                           rocblas_stride stridey,
+                                           rocblas_int    batch_count,
+                                           T*             workspace)
+{
+    constexpr rocblas_int NB     = rocblas_spmv_hpmv_tiled_nb<T>();
+    rocblas_int           blocks = (n - 1) / NB + 1;
+    dim3                  grid(blocks, batch_count);
+    dim3                  threads(NB, ROCBLAS_SPMV_HPMV_TILED_THREADS / NB);
+
+#define SPMV_HPMV_TILED_PARAMS                                                                \
+    grid, threads, 0, handle->get_stream(), n, alpha, stride_alpha, AP, shifta, strideA, x, \
+        shiftx, incx, stridex, workspace
+
+    if(is_upper)
+        hipLaunchKernelGGL((rocblas_spmv_hpmv_tiled_kernel<NB, HERM, true>),
+                           SPMV_HPMV_TILED_PARAMS);
+    else
+        hipLaunchKernelGGL((rocblas_spmv_hpmv_tiled_kernel<NB, HERM, false>),
+                           SPMV_HPMV_TILED_PARAMS);
+
+#undef SPMV_HPMV_TILED_PARAMS
+
+    hipLaunchKernelGGL((rocblas_spmv_hpmv_tiled_sum_kernel<NB>),
+                       grid,
+                       dim3(NB),
+                       0,
+                       handle->get_stream(),
+                       n,
+                       alpha,
+                       stride_alpha,
+                       beta,
+                       stride_beta,
+                       (const T*)workspace,
+                       y,
+                       shifty,
+                       incy,
+                       stridey);
+}
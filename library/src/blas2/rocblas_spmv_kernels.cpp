@@ -24,6 +24,7 @@
 #include "handle.hpp"
 #include "rocblas.h"
 #include "rocblas_spmv.hpp"
+#include "rocblas_spmv_hpmv_tiled.hpp"
 
 /**
   *  Computes y := alpha*A*x + beta*y where A is a symmetric matrix.
@@ -163,7 +164,8 @@ rocblas_status rocblas_spmv_template(rocblas_handle handle,
                                      rocblas_stride offsety,
                                      rocblas_int    incy,
                                      rocblas_stride stridey,
-                                     rocblas_int    batch_count)
+                                     rocblas_int    batch_count,
+                                     T*             workspace)
 {
     //quick return
     if(!n || !batch_count)
@@ -175,6 +177,55 @@ rocblas_status rocblas_spmv_template(rocblas_handle handle,
     auto shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
     auto shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
 
+    // large matrices are read once by the tiled kernels, with partial results in workspace
+    if(workspace && rocblas_spmv_hpmv_use_tiled(n))
+    {
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            rocblas_spmv_hpmv_tiled_launch<false>(handle,
+                                                  uplo == rocblas_fill_upper,
+                                                  n,
+                                                  alpha,
+                                                  stride_alpha,
+                                                  A,
+                                                  offseta,
+                                                  strideA,
+                                                  x,
+                                                  shiftx,
+                                                  incx,
+                                                  stridex,
+                                                  beta,
+                                                  stride_beta,
+                                                  y,
+                                                  shifty,
+                                                  incy,
+                                                  stridey,
+                                                  batch_count,
+                                                  workspace);
+        else if(batch_count > 1 || *alpha || *beta != 1)
+            rocblas_spmv_hpmv_tiled_launch<false>(handle,
+                                                  uplo == rocblas_fill_upper,
+                                                  n,
+                                                  *alpha,
+                                                  stride_alpha,
+                                                  A,
+                                                  offseta,
+                                                  strideA,
+                                                  x,
+                                                  shiftx,
+                                                  incx,
+                                                  stridex,
+                                                  *beta,
+                                                  stride_beta,
+                                                  y,
+                                                  shifty,
+                                                  incy,
+                                                  stridey,
+                                                  batch_count,
+                                                  workspace);
+
+        return rocblas_status_success;
+    }
+
     static constexpr int spmv_DIM_X = 64;
     static constexpr int spmv_DIM_Y = 16;
     rocblas_int          blocks     = (n - 1) / (spmv_DIM_X) + 1;
@@ -316,7 +367,8 @@ template rocblas_status rocblas_spmv_template<T_, U_, V_, W_>         \
                                      rocblas_stride offsety,          \
                                      rocblas_int    incy,             \
                                      rocblas_stride stridey,          \
-                                     rocblas_int    batch_count);
+                                     rocblas_int    batch_count,      \
+                                     T_*            workspace);
 
 INSTANTIATE_SPMV_TEMPLATE(float, float, float, float)
 INSTANTIATE_SPMV_TEMPLATE(double, double, double, double)
@@ -23,6 +23,7 @@
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "rocblas_spr2.hpp"
+#include "rocblas_triangular_tiles.hpp"
 
 template <typename T>
 __device__ void rocblas_spr2_kernel_calc(bool        is_upper,
@@ -32,15 +33,14 @@ __device__ void rocblas_spr2_kernel_calc(bool        is_upper,
                                          rocblas_int incx,
                                          const T*    y,
                                          rocblas_int incy,
-                                         T*          AP)
+                                         T*          AP,
+                                         rocblas_int tx,
+                                         rocblas_int ty)
 {
-    rocblas_int tx = blockIdx.x * blockDim.x + threadIdx.x;
-    rocblas_int ty = blockIdx.y * blockDim.y + threadIdx.y;
+    size_t index = is_upper ? ((size_t(ty) * (ty + 1)) / 2) + tx
+                            : ((size_t(ty) * (2 * size_t(n) - ty + 1)) / 2) + (tx - ty);
 
-    int index = is_upper ? ((ty * (ty + 1)) / 2) + tx : ((ty * (2 * n - ty + 1)) / 2) + (tx - ty);
-
-    if(is_upper ? ty < n && tx <= ty : tx < n && ty <= tx)
-        AP[index] += alpha * x[tx * incx] * y[ty * incy] + alpha * y[tx * incy] * x[ty * incx];
+    AP[index] += alpha * x[tx * incx] * y[ty * incy] + alpha * y[tx * incy] * x[ty * incx];
 }
 
 template <rocblas_int DIM_X, rocblas_int DIM_Y, typename TStruct, typename TConstPtr, typename TPtr>
@@ -69,7 +69,9 @@ rocblas_spr2_kernel(bool           host_ptr_mode,
     const auto* x  = load_ptr_batch(xa, blockIdx.z, shift_x, stride_x);
     const auto* y  = load_ptr_batch(ya, blockIdx.z, shift_y, stride_y);
 
-    rocblas_spr2_kernel_calc(is_upper, n, alpha, x, incx, y, incy, AP);
+    rocblas_triangular_tile_apply<DIM_X, DIM_Y>(is_upper, n, [=](rocblas_int tx, rocblas_int ty) {
+        rocblas_spr2_kernel_calc(is_upper, n, alpha, x, incx, y, incy, AP, tx, ty);
+    });
 }
 
 /**
@@ -104,12 +106,10 @@ rocblas_status rocblas_spr2_template(rocblas_handle handle,
     ptrdiff_t shift_x = incx < 0 ? offset_x - ptrdiff_t(incx) * (n - 1) : offset_x;
     ptrdiff_t shift_y = incy < 0 ? offset_y - ptrdiff_t(incy) * (n - 1) : offset_y;
 
-    static constexpr int SPR2_DIM_X = 128;
-    static constexpr int SPR2_DIM_Y = 8;
-    rocblas_int          blocksX    = (n - 1) / SPR2_DIM_X + 1;
-    rocblas_int          blocksY    = (n - 1) / SPR2_DIM_Y + 1;
+    static constexpr int SPR2_DIM_X = 64;
+    static constexpr int SPR2_DIM_Y = 16;
 
-    dim3 spr2_grid(blocksX, blocksY, batch_count);
+    dim3 spr2_grid(rocblas_triangular_tile_count<SPR2_DIM_X>(n), 1, batch_count);
     dim3 spr2_threads(SPR2_DIM_X, SPR2_DIM_Y);
 
     bool                            host_mode = handle->pointer_mode == rocblas_pointer_mode_host;
@@ -23,6 +23,7 @@
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "rocblas.h"
+#include "rocblas_triangular_tiles.hpp"
 #include "rocblas_syr2.hpp"
 
 template <typename T>
@@ -34,14 +35,12 @@ __device__ void rocblas_syr2_kernel_calc(bool        is_upper,
                                          const T*    y,
                                          rocblas_int incy,
                                          T*          A,
-                                         rocblas_int lda)
+                                         rocblas_int lda,
+                                         rocblas_int tx,
+                                         rocblas_int ty)
 {
-    rocblas_int tx = blockIdx.x * blockDim.x + threadIdx.x;
-    rocblas_int ty = blockIdx.y * blockDim.y + threadIdx.y;
-
-    if(is_upper ? ty < n && tx <= ty : tx < n && ty <= tx)
-        A[tx + ty * lda]
-            += alpha * x[tx * incx] * y[ty * incy] + alpha * y[tx * incy] * x[ty * incx];
+    A[tx + size_t(ty) * lda]
+        += alpha * x[tx * incx] * y[ty * incy] + alpha * y[tx * incy] * x[ty * incx];
 }
 
 template <rocblas_int DIM_X, rocblas_int DIM_Y, typename TScal, typename TConstPtr, typename TPtr>
@@ -74,7 +73,9 @@ rocblas_syr2_kernel(bool           is_upper,
     const auto* x = load_ptr_batch(xa, blockIdx.z, shift_x, stride_x);
     const auto* y = load_ptr_batch(ya, blockIdx.z, shift_y, stride_y);
 
-    rocblas_syr2_kernel_calc(is_upper, n, alpha, x, incx, y, incy, A, lda);
+    rocblas_triangular_tile_apply<DIM_X, DIM_Y>(is_upper, n, [=](rocblas_int tx, rocblas_int ty) {
+        rocblas_syr2_kernel_calc(is_upper, n, alpha, x, incx, y, incy, A, lda, tx, ty);
+    });
 }
 
 /**
@@ -111,12 +112,10 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     ptrdiff_t shift_x = incx < 0 ? offset_x - ptrdiff_t(incx) * (n - 1) : offset_x;
     ptrdiff_t shift_y = incy < 0 ? offset_y - ptrdiff_t(incy) * (n - 1) : offset_y;
 
-    static constexpr int SYR2_DIM_X = 128;
-    static constexpr int SYR2_DIM_Y = 8;
-    rocblas_int          blocksX    = (n - 1) / SYR2_DIM_X + 1;
-    rocblas_int          blocksY    = (n - 1) / SYR2_DIM_Y + 1;
+    static constexpr int SYR2_DIM_X = 64;
+    static constexpr int SYR2_DIM_Y = 16;
 
-    dim3 syr2_grid(blocksX, blocksY, batch_count);
+    dim3 syr2_grid(rocblas_triangular_tile_count<SYR2_DIM_X>(n), 1, batch_count);
     dim3 syr2_threads(SYR2_DIM_X, SYR2_DIM_Y);
 
     if(rocblas_pointer_mode_device == handle->pointer_mode)
@@ -24,6 +24,7 @@
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "rocblas_tbmv.hpp"
+#include "rocblas_trmv_tiled.hpp"
 
 /**
   *  Helper for the non-transpose case. Iterates through each diagonal
@@ -323,6 +324,34 @@ rocblas_status rocblas_tbmv_template(rocblas_handle    handle,
     // in case of negative inc shift pointer to end of data for negative indexing tid*inc
     ptrdiff_t shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (m - 1) : offsetx;
 
+    if(rocblas_trmv_use_tiled(m))
+    {
+        // Tiles of the band of A times the copy of x
+        static constexpr rocblas_int offsetw = 0;
+        static constexpr rocblas_int incw    = 1;
+        rocblas_stride               stridew = m;
+        rocblas_trmv_tiled_launch<rocblas_trmv_storage::banded>(handle,
+                                                                uplo,
+                                                                transA,
+                                                                diag,
+                                                                m,
+                                                                k,
+                                                                A,
+                                                                offseta,
+                                                                lda,
+                                                                strideA,
+                                                                (U)w_x_copy,
+                                                                offsetw,
+                                                                incw,
+                                                                stridew,
+                                                                x,
+                                                                shiftx,
+                                                                incx,
+                                                                stridex,
+                                                                batch_count);
+        return rocblas_status_success;
+    }
+
     // (gemv) TBMVX_DIM_Y must be at least 4, 8 * 8 is very slow only 40Gflop/s
     static constexpr int TBMVX_DIM_X = 64;
     static constexpr int TBMVX_DIM_Y = 16;
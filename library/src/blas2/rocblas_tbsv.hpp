@@ -24,6 +24,7 @@
 
 #include "../blas1/rocblas_copy.hpp"
 #include "check_numerics_vector.hpp"
+#include "rocblas_tsv_blocked.hpp"
 
 template <typename U, typename V>
 inline rocblas_status rocblas_tbsv_arg_check(rocblas_handle    handle,
@@ -36,7 +37,8 @@ inline rocblas_status rocblas_tbsv_arg_check(rocblas_handle    handle,
                                              rocblas_int       lda,
                                              V                 x,
                                              rocblas_int       incx,
-                                             rocblas_int       batch_count)
+                                             rocblas_int       batch_count,
+                                             size_t&           dev_bytes)
 {
     if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
         return rocblas_status_invalid_value;
@@ -52,12 +54,20 @@ inline rocblas_status rocblas_tbsv_arg_check(rocblas_handle    handle,
         return rocblas_status_invalid_size;
 
     if(!n || !batch_count)
+    {
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
         return rocblas_status_success;
+    }
 
     // pointers are validated if they need to be dereferenced
     if(!A || !x)
         return rocblas_status_invalid_pointer;
 
+    // completion flags of the blocked solve of large systems
+    dev_bytes = rocblas_tsv_blocked_workspace_size(n, batch_count);
+    if(handle->is_device_memory_size_query())
+        return handle->set_optimal_device_memory_size(dev_bytes);
+
     return rocblas_status_continue;
 }
 
@@ -76,7 +86,8 @@ rocblas_status rocblas_tbsv_template(rocblas_handle    handle,
                                      rocblas_stride    offset_x,
                                      rocblas_int       incx,
                                      rocblas_stride    stride_x,
-                                     rocblas_int       batch_count);
+                                     rocblas_int       batch_count,
+                                     rocblas_int*      w_completed_sec);
 
 //TODO :-Add rocblas_check_numerics_tb_matrix_template for checking Matrix `A` which is a Triangular Band Matrix
 template <typename T, typename U>
@@ -58,9 +58,7 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
-
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
@@ -127,11 +125,28 @@ namespace
                             batch_count);
         }
 
-        rocblas_status arg_status = rocblas_tbsv_arg_check(
-            handle, uplo, transA, diag, n, k, A, lda, x, incx, batch_count);
+        size_t         dev_bytes;
+        rocblas_status arg_status = rocblas_tbsv_arg_check(handle,
+                                                           uplo,
+                                                           transA,
+                                                           diag,
+                                                           n,
+                                                           k,
+                                                           A,
+                                                           lda,
+                                                           x,
+                                                           incx,
+                                                           batch_count,
+                                                           dev_bytes);
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        auto w_completed_sec = w_mem[0];
+
         if(check_numerics)
         {
             bool           is_input = true;
@@ -154,8 +169,22 @@ namespace
                 return tbsv_check_numerics_status;
         }
 
-        rocblas_status status = rocblas_tbsv_template<BLOCK>(
-            handle, uplo, transA, diag, n, k, A, 0, lda, 0, x, 0, incx, 0, batch_count);
+        rocblas_status status = rocblas_tbsv_template<BLOCK>(handle,
+                                                             uplo,
+                                                             transA,
+                                                             diag,
+                                                             n,
+                                                             k,
+                                                             A,
+                                                             0,
+                                                             lda,
+                                                             0,
+                                                             x,
+                                                             0,
+                                                             incx,
+                                                             0,
+                                                             batch_count,
+                                                             (rocblas_int*)w_completed_sec);
         if(status != rocblas_status_success)
             return status;
 
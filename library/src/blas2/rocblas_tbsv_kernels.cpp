@@ -23,6 +23,7 @@
 #include "../blas1/rocblas_copy.hpp"
 #include "check_numerics_vector.hpp"
 #include "rocblas_tbsv.hpp"
+#include "rocblas_tsv_blocked.hpp"
 
 template <bool UPPER, bool TRANS>
 ROCBLAS_KERNEL_ILF inline rocblas_int rocblas_banded_matrix_index(
@@ -251,6 +252,56 @@ rocblas_tbsv_kernel(rocblas_operation transA,
             is_unit_diag, n, k, A, lda, x, incx);
 }
 
+// Blocked multi-workgroup solve of large systems, one workgroup per block row of DIM_X rows,
+// applying only the off-diagonal blocks within the band. op(A) is upper triangular, and solved
+// backwards as the reversed forward system, when exactly one of UPPER and TRANS is set.
+template <rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          bool        UPPER,
+          bool        TRANS,
+          bool        CONJ,
+          typename TConstPtr,
+          typename TPtr>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_tbsv_blocked_kernel(bool           is_unit_diag,
+                            rocblas_int    n,
+                            rocblas_int    k,
+                            TConstPtr      Aa,
+                            rocblas_stride shift_A,
+                            rocblas_int    lda,
+                            rocblas_stride stride_A,
+                            TPtr           xa,
+                            rocblas_stride shift_x,
+                            rocblas_int    incx,
+                            rocblas_stride stride_x,
+                            rocblas_int*   w_completed_sec)
+{
+    constexpr bool BACKWARD = UPPER != TRANS;
+
+    const auto*   A    = load_ptr_batch(Aa, blockIdx.y, shift_A, stride_A);
+    auto*         x    = load_ptr_batch(xa, blockIdx.y, shift_x, stride_x);
+    const int64_t last = n - 1;
+
+    auto a = [=](rocblas_int row, rocblas_int col) {
+        const int64_t r = BACKWARD ? last - row : row;
+        const int64_t c = BACKWARD ? last - col : col;
+
+        // element (i, j) of A in band storage
+        const int64_t i   = TRANS ? c : r;
+        const int64_t j   = TRANS ? r : c;
+        const int64_t idx = j * lda + (UPPER ? k + i - j : i - j);
+        return CONJ ? conj(A[idx]) : A[idx];
+    };
+
+    rocblas_tsv_blocked_substitution<DIM_X, DIM_Y>(n,
+                                                   k,
+                                                   is_unit_diag,
+                                                   a,
+                                                   BACKWARD ? x + last * incx : x,
+                                                   BACKWARD ? -int64_t(incx) : int64_t(incx),
+                                                   w_completed_sec + blockIdx.y);
+}
+
 template <rocblas_int BLOCK, typename TConstPtr, typename TPtr>
 rocblas_status rocblas_tbsv_template(rocblas_handle    handle,
                                      rocblas_fill      uplo,
@@ -266,7 +317,8 @@ rocblas_status rocblas_tbsv_template(rocblas_handle    handle,
                                      rocblas_stride    offset_x,
                                      rocblas_int       incx,
                                      rocblas_stride    stride_x,
-                                     rocblas_int       batch_count)
+                                     rocblas_int       batch_count,
+                                     rocblas_int*      w_completed_sec)
 {
     if(batch_count == 0 || n == 0)
         return rocblas_status_success;
@@ -278,6 +330,56 @@ rocblas_status rocblas_tbsv_template(rocblas_handle    handle,
     ptrdiff_t shift_x = incx < 0 ? offset_x - ptrdiff_t(incx) * (n - 1) : offset_x;
     ptrdiff_t shift_A = offset_A;
 
+    if(rocblas_tsv_use_blocked(n, batch_count))
+    {
+        constexpr rocblas_int DIM_X = ROCBLAS_TSV_BLOCKED_DIM_X;
+        constexpr rocblas_int DIM_Y = ROCBLAS_TSV_BLOCKED_DIM_Y;
+        constexpr rocblas_int NB    = 256;
+
+        hipLaunchKernelGGL(rocblas_tsv_blocked_init<NB>,
+                           dim3((batch_count - 1) / NB + 1),
+                           dim3(NB),
+                           0,
+                           handle->get_stream(),
+                           batch_count,
+                           w_completed_sec);
+
+        dim3 grid((n - 1) / DIM_X + 1, batch_count);
+        dim3 threads(DIM_X, DIM_Y);
+
+#define TBSV_BLOCKED_PARAMS                                                                \
+    grid, threads, 0, handle->get_stream(), diag == rocblas_diagonal_unit, n, k, A, shift_A, \
+        lda, stride_A, x, shift_x, incx, stride_x, w_completed_sec
+
+        if(uplo == rocblas_fill_upper)
+        {
+            if(transA == rocblas_operation_none)
+                hipLaunchKernelGGL((rocblas_tbsv_blocked_kernel<DIM_X, DIM_Y, true, false, false>),
+                                   TBSV_BLOCKED_PARAMS);
+            else if(transA == rocblas_operation_transpose)
+                hipLaunchKernelGGL((rocblas_tbsv_blocked_kernel<DIM_X, DIM_Y, true, true, false>),
+                                   TBSV_BLOCKED_PARAMS);
+            else
+                hipLaunchKernelGGL((rocblas_tbsv_blocked_kernel<DIM_X, DIM_Y, true, true, true>),
+                                   TBSV_BLOCKED_PARAMS);
+        }
+        else
+        {
+            if(transA == rocblas_operation_none)
+                hipLaunchKernelGGL((rocblas_tbsv_blocked_kernel<DIM_X, DIM_Y, false, false, false>),
+                                   TBSV_BLOCKED_PARAMS);
+            else if(transA == rocblas_operation_transpose)
+                hipLaunchKernelGGL((rocblas_tbsv_blocked_kernel<DIM_X, DIM_Y, false, true, false>),
+                                   TBSV_BLOCKED_PARAMS);
+            else
+                hipLaunchKernelGGL((rocblas_tbsv_blocked_kernel<DIM_X, DIM_Y, false, true, true>),
+                                   TBSV_BLOCKED_PARAMS);
+        }
+#undef TBSV_BLOCKED_PARAMS
+
+        return rocblas_status_success;
+    }
+
     dim3 grid(batch_count);
     dim3 threads(BLOCK);
 
@@ -384,7 +486,8 @@ template rocblas_status rocblas_tbsv_template<BLOCK_, TConstPtr_, TPtr_> \
                                      rocblas_stride       offset_x,         \
                                      rocblas_int       incx,             \
                                      rocblas_stride    stride_x,         \
-                                     rocblas_int       batch_count);
+                                     rocblas_int       batch_count,      \
+                                     rocblas_int*      w_completed_sec);
 
 INSTANTIATE_TBSV_TEMPLATE(512, float const*, float*)
 INSTANTIATE_TBSV_TEMPLATE(512, double const*, double*)
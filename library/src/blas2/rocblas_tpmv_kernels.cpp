@@ -23,6 +23,7 @@
 #include "../blas1/rocblas_copy.hpp"
 #include "check_numerics_vector.hpp"
 #include "rocblas_tpmv.hpp"
+#include "rocblas_trmv_tiled.hpp"
 
 #include "utility.hpp"
 
@@ -273,77 +274,105 @@ rocblas_status rocblas_tpmv_template(rocblas_handle    handle,
 
     ptrdiff_t shiftx = incx < 0 ? offsetx + ptrdiff_t(incx) * (1 - m) : offsetx;
 
-    dim3 tpmv_grid((m - 1) / NB + 1, batch_count);
-    dim3 tpmv_threads(NB);
-
-    switch(transa)
-    {
-    case rocblas_operation_none:
+    if(rocblas_trmv_use_tiled(m))
     {
-        hipLaunchKernelGGL(rocblas_tpmvn_kernel<NB>,
-                           tpmv_grid,
-                           tpmv_threads,
-                           0,
-                           rocblas_stream,
-                           uplo == rocblas_fill_upper,
-                           diag == rocblas_diagonal_unit,
-                           m,
-                           a,
-                           offseta,
-                           stridea,
-                           x,
-                           shiftx,
-                           incx,
-                           stridex,
-                           workspace,
-                           stridew);
-        break;
+        static constexpr rocblas_int offsetw = 0;
+        static constexpr rocblas_int incw    = 1;
+        static constexpr rocblas_int lda     = 0;
+        rocblas_trmv_tiled_launch<rocblas_trmv_storage::packed>(handle,
+                                                                uplo,
+                                                                transa,
+                                                                diag,
+                                                                m,
+                                                                m - 1,
+                                                                a,
+                                                                offseta,
+                                                                lda,
+                                                                stridea,
+                                                                x,
+                                                                shiftx,
+                                                                incx,
+                                                                stridex,
+                                                                workspace,
+                                                                offsetw,
+                                                                incw,
+                                                                stridew,
+                                                                batch_count);
     }
-
-    case rocblas_operation_transpose:
+    else
     {
-        hipLaunchKernelGGL(rocblas_tpmvt_kernel<NB>,
-                           tpmv_grid,
-                           tpmv_threads,
-                           0,
-                           rocblas_stream,
-                           uplo == rocblas_fill_upper,
-                           diag == rocblas_diagonal_unit,
-                           m,
-                           a,
-                           offseta,
-                           stridea,
-                           x,
-                           shiftx,
-                           incx,
-                           stridex,
-                           workspace,
-                           stridew);
-        break;
-    }
+        dim3 tpmv_grid((m - 1) / NB + 1, batch_count);
+        dim3 tpmv_threads(NB);
 
-    case rocblas_operation_conjugate_transpose:
-    {
-        hipLaunchKernelGGL(rocblas_tpmvc_kernel<NB>,
-                           tpmv_grid,
-                           tpmv_threads,
-                           0,
-                           rocblas_stream,
-                           uplo == rocblas_fill_upper,
-                           diag == rocblas_diagonal_unit,
-                           m,
-                           a,
-                           offseta,
-                           stridea,
-                           x,
-                           shiftx,
-                           incx,
-                           stridex,
-                           workspace,
-                           stridew);
-
-        break;
-    }
+        switch(transa)
+        {
+        case rocblas_operation_none:
+        {
+            hipLaunchKernelGGL(rocblas_tpmvn_kernel<NB>,
+                               tpmv_grid,
+                               tpmv_threads,
+                               0,
+                               rocblas_stream,
+                               uplo == rocblas_fill_upper,
+                               diag == rocblas_diagonal_unit,
+                               m,
+                               a,
+                               offseta,
+                               stridea,
+                               x,
+                               shiftx,
+                               incx,
+                               stridex,
+                               workspace,
+                               stridew);
+            break;
+        }
+
+        case rocblas_operation_transpose:
+        {
+            hipLaunchKernelGGL(rocblas_tpmvt_kernel<NB>,
+                               tpmv_grid,
+                               tpmv_threads,
+                               0,
+                               rocblas_stream,
+                               uplo == rocblas_fill_upper,
+                               diag == rocblas_diagonal_unit,
+                               m,
+                               a,
+                               offseta,
+                               stridea,
+                               x,
+                               shiftx,
+                               incx,
+                               stridex,
+                               workspace,
+                               stridew);
+            break;
+        }
+
+        case rocblas_operation_conjugate_transpose:
+        {
+            hipLaunchKernelGGL(rocblas_tpmvc_kernel<NB>,
+                               tpmv_grid,
+                               tpmv_threads,
+                               0,
+                               rocblas_stream,
+                               uplo == rocblas_fill_upper,
+                               diag == rocblas_diagonal_unit,
+                               m,
+                               a,
+                               offseta,
+                               stridea,
+                               x,
+                               shiftx,
+                               incx,
+                               stridex,
+                               workspace,
+                               stridew);
+
+            break;
+        }
+        }
     }
 
     //
@@ -55,9 +55,7 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
-
-        auto layer_mode = handle->layer_mode;
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_tpsv_name<T>, uplo, transA, diag, n, AP, x, incx);
 
@@ -100,11 +98,18 @@ namespace
                             incx);
         }
 
+        size_t         dev_bytes;
         rocblas_status arg_status
-            = rocblas_tpsv_arg_check(handle, uplo, transA, diag, n, AP, x, incx, 1);
+            = rocblas_tpsv_arg_check(handle, uplo, transA, diag, n, AP, x, incx, 1, dev_bytes);
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        auto w_completed_sec = w_mem[0];
+
         auto check_numerics = handle->check_numerics;
         if(check_numerics)
         {
@@ -127,8 +132,20 @@ namespace
                 return tpsv_check_numerics_status;
         }
 
-        rocblas_status status = rocblas_tpsv_template<BLOCK>(
-            handle, uplo, transA, diag, n, AP, 0, 0, x, 0, incx, 0, 1);
+        rocblas_status status = rocblas_tpsv_template<BLOCK>(handle,
+                                                             uplo,
+                                                             transA,
+                                                             diag,
+                                                             n,
+                                                             AP,
+                                                             0,
+                                                             0,
+                                                             x,
+                                                             0,
+                                                             incx,
+                                                             0,
+                                                             1,
+                                                             (rocblas_int*)w_completed_sec);
         if(status != rocblas_status_success)
             return status;
 
@@ -60,7 +60,7 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
-        auto layer_mode = handle->layer_mode;
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
                       rocblas_tpsv_strided_batched_name<T>,
@@ -126,11 +126,26 @@ namespace
                             batch_count);
         }
 
-        rocblas_status arg_status
-            = rocblas_tpsv_arg_check(handle, uplo, transA, diag, n, AP, x, incx, batch_count);
+        size_t         dev_bytes;
+        rocblas_status arg_status = rocblas_tpsv_arg_check(handle,
+                                                           uplo,
+                                                           transA,
+                                                           diag,
+                                                           n,
+                                                           AP,
+                                                           x,
+                                                           incx,
+                                                           batch_count,
+                                                           dev_bytes);
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        auto w_completed_sec = w_mem[0];
+
         auto check_numerics = handle->check_numerics;
         if(check_numerics)
         {
@@ -153,8 +168,20 @@ namespace
                 return tpsv_check_numerics_status;
         }
 
-        rocblas_status status = rocblas_tpsv_template<BLOCK>(
-            handle, uplo, transA, diag, n, AP, 0, stride_A, x, 0, incx, stride_x, batch_count);
+        rocblas_status status = rocblas_tpsv_template<BLOCK>(handle,
+                                                             uplo,
+                                                             transA,
+                                                             diag,
+                                                             n,
+                                                             AP,
+                                                             0,
+                                                             stride_A,
+                                                             x,
+                                                             0,
+                                                             incx,
+                                                             stride_x,
+                                                             batch_count,
+                                                             (rocblas_int*)w_completed_sec);
         if(status != rocblas_status_success)
             return status;
 
@@ -0,0 +1,94 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * ===========================================================================
+ *    Enumeration of the tiles of a triangle, used by the symmetric and
+ *    hermitian rank updates which only update the stored triangle
+ * ===========================================================================
+ */
+
+// The n x n matrix is split into square tiles of DIM_X rows and columns, and only the
+// t * (t + 1) / 2 tiles of the stored triangle are launched, one workgroup each, instead of a
+// full grid of which half the workgroups have nothing to update. Tile b is the one at
+// (row, col) = (i, k) of the upper triangle, with k the largest integer such that
+// k * (k + 1) / 2 <= b and i = b - k * (k + 1) / 2; the lower triangle uses the transposed
+// tile (t - 1 - i, t - 1 - k), so that its last workgroups also have the smallest tiles. Only
+// the diagonal tiles are masked to the triangle.
+
+#pragma once
+
+#include "rocblas.h"
+
+//! @brief Number of DIM_X x DIM_X tiles of the triangle of an n x n matrix, the grid size of
+//!        rocblas_triangular_tile_apply.
+template <rocblas_int DIM_X>
+constexpr rocblas_int rocblas_triangular_tile_count(rocblas_int n)
+{
+    rocblas_int tiles = (n - 1) / DIM_X + 1;
+    return rocblas_int((int64_t(tiles) * (tiles + 1)) / 2);
+}
+
+//! @brief Calls f(row, col) for each element of the DIM_X x DIM_X tile blockIdx.x of the upper
+//!        (row <= col) or lower (row >= col) triangle of the n x n matrix.
+//!
+//! Each thread handles the row threadIdx.x of the tile and every DIM_Y-th column from
+//! threadIdx.y, so that consecutive threads access consecutive rows of a column.
+template <rocblas_int DIM_X, rocblas_int DIM_Y, typename F>
+__device__ void rocblas_triangular_tile_apply(bool is_upper, rocblas_int n, F f)
+{
+    static_assert(DIM_X % DIM_Y == 0, "DIM_Y must divide the tile size");
+
+    const rocblas_int tiles = (n - 1) / DIM_X + 1;
+    const int64_t     b     = blockIdx.x;
+
+    // correct the floating point square root, which may be off by one for large b
+    int64_t k = int64_t((sqrt(8.0 * double(b) + 1.0) - 1.0) / 2.0);
+    while(k * (k + 1) / 2 > b)
+        k--;
+    while((k + 1) * (k + 2) / 2 <= b)
+        k++;
+    const int64_t i = b - k * (k + 1) / 2;
+
+    const rocblas_int row_tile = is_upper ? rocblas_int(i) : rocblas_int(tiles - 1 - i);
+    const rocblas_int col_tile = is_upper ? rocblas_int(k) : rocblas_int(tiles - 1 - k);
+
+    const rocblas_int row = row_tile * DIM_X + threadIdx.x;
+    if(row >= n)
+        return;
+
+    const rocblas_int col0 = col_tile * DIM_X;
+    if(row_tile != col_tile)
+    {
+        for(rocblas_int j = threadIdx.y; j < DIM_X && col0 + j < n; j += DIM_Y)
+            f(row, col0 + j);
+    }
+    else
+    {
+        for(rocblas_int j = threadIdx.y; j < DIM_X && col0 + j < n; j += DIM_Y)
+        {
+            const rocblas_int col = col0 + j;
+            if(is_upper ? row <= col : col <= row)
+                f(row, col);
+        }
+    }
+}
@@ -24,6 +24,7 @@
 #include "../blas1/rocblas_reduction.hpp"
 #include "rocblas.h"
 #include "rocblas_trmv.hpp"
+#include "rocblas_trmv_tiled.hpp"
 #include <cstddef>
 
 template <rocblas_int DIM_X, rocblas_int DIM_Y, bool LOWER, bool UNIT, typename T>
@@ -210,7 +211,31 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 #define TRMV_TEMPLATE_PARAMS \
     0, rocblas_stream, m, a, offseta, lda, stridea, x, shiftx, incx, stridex, workspace, stridew
 
-    if(uplo == rocblas_fill_upper)
+    if(rocblas_trmv_use_tiled(m))
+    {
+        static constexpr rocblas_int offsetw = 0;
+        static constexpr rocblas_int incw    = 1;
+        rocblas_trmv_tiled_launch<rocblas_trmv_storage::full>(handle,
+                                                              uplo,
+                                                              transA,
+                                                              diag,
+                                                              m,
+                                                              m - 1,
+                                                              a,
+                                                              offseta,
+                                                              lda,
+                                                              stridea,
+                                                              x,
+                                                              shiftx,
+                                                              incx,
+                                                              stridex,
+                                                              workspace,
+                                                              offsetw,
+                                                              incw,
+                                                              stridew,
+                                                              batch_count);
+    }
+    else if(uplo == rocblas_fill_upper)
     {
         if(diag == rocblas_diagonal_unit)
         {
@@ -0,0 +1,264 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * ===========================================================================
+ *    Tiled trmv, tpmv and tbmv, y = op(A) * x for a full, packed or banded
+ *    triangular matrix
+ * ===========================================================================
+ */
+
+// The matrix is viewed as NB x NB tiles. Block blk of the grid computes the NB elements of y of
+// block row blk of op(A), looping over the tiles of that block row which intersect the stored
+// triangle, and its band for tbmv: the tiles of the opposite triangle and those beyond the band
+// are skipped. Each tile is loaded into LDS with consecutive threads reading consecutive rows of
+// a stored column, the elements outside the triangle or band of the diagonal and band edge tiles
+// are masked to zero, and a unit diagonal is not read.
+//
+// With op(A) = A each thread sums along a row of the tile. The transposed and conjugate
+// transposed cases, whose columns are uncoalesced for one thread per element of y, sum along a
+// column of the tile from LDS instead, conjugating as the tile is loaded.
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas.h"
+#include <cstdio>
+#include <cstdlib>
+#include <type_traits>
+
+//! @brief Storage of the triangular matrix of the tiled kernel.
+enum class rocblas_trmv_storage
+{
+    full,
+    packed,
+    banded
+};
+
+//! @brief Tile size of the tiled trmv, tpmv and tbmv, so that a tile of T fits in LDS.
+template <typename T>
+constexpr rocblas_int rocblas_trmv_tiled_nb()
+{
+    return sizeof(T) > 8 ? 32 : 64;
+}
+
+constexpr rocblas_int ROCBLAS_TRMV_TILED_THREADS = 256;
+
+static const rocblas_int rocblas_internal_trmv_tiled_min_size = [] {
+    // n from which trmv, tpmv and tbmv use the tiled kernel instead of one thread per element
+    // walking the full length of a row or column. 0 disables it.
+    constexpr rocblas_int TRMV_TILED_MIN_SIZE = 512;
+    rocblas_int           min_size;
+    const char*           env = getenv("ROCBLAS_INTERNAL_TRMV_TILED_MIN_SIZE");
+    return env && sscanf(env, "%d", &min_size) == 1 ? min_size : TRMV_TILED_MIN_SIZE;
+}();
+
+inline bool rocblas_trmv_use_tiled(rocblas_int n)
+{
+    return rocblas_internal_trmv_tiled_min_size > 0 && n >= rocblas_internal_trmv_tiled_min_size;
+}
+
+//! @brief Offset of element (i, j) of the stored triangle of A.
+template <rocblas_trmv_storage S, bool UPPER>
+__device__ inline int64_t
+    rocblas_trmv_tiled_offset(int64_t i, int64_t j, rocblas_int n, rocblas_int k, int64_t lda)
+{
+    if constexpr(S == rocblas_trmv_storage::full)
+        return i + j * lda;
+    else if constexpr(S == rocblas_trmv_storage::packed)
+        return UPPER ? j * (j + 1) / 2 + i : j * (2 * int64_t(n) - j + 1) / 2 + (i - j);
+    else
+        return (UPPER ? k + i - j : i - j) + j * lda;
+}
+
+//! @brief y = op(A) * x for the n x n triangular matrix A of bandwidth k, n - 1 unless banded.
+template <rocblas_int          NB,
+          rocblas_trmv_storage S,
+          bool                 UPPER,
+          bool                 TRANS,
+          bool                 CONJ,
+          bool                 UNIT,
+          typename TConstPtr,
+          typename TXPtr,
+          typename TYPtr>
+ROCBLAS_KERNEL(ROCBLAS_TRMV_TILED_THREADS)
+rocblas_trmv_tiled_kernel(rocblas_int    n,
+                          rocblas_int    k,
+                          TConstPtr      Aa,
+                          rocblas_stride shifta,
+                          rocblas_int    lda,
+                          rocblas_stride strideA,
+                          TXPtr          xa,
+                          rocblas_stride shiftx,
+                          rocblas_int    incx,
+                          rocblas_stride stridex,
+                          TYPtr          ya,
+                          rocblas_stride shifty,
+                          rocblas_int    incy,
+                          rocblas_stride stridey)
+{
+    constexpr rocblas_int DIM_Y = ROCBLAS_TRMV_TILED_THREADS / NB;
+
+    const auto* A = load_ptr_batch(Aa, blockIdx.y, shifta, strideA);
+    const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+    auto*       y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    using T = std::decay_t<decltype(*y)>;
+
+    // sA[r][c] is element (R * NB + r, C * NB + c) of A for the current tile (R, C)
+    __shared__ T sA[NB][NB + 1];
+    __shared__ T sx[NB];
+    __shared__ T sum[DIM_Y][NB];
+
+    const rocblas_int tx     = threadIdx.x;
+    const rocblas_int ty     = threadIdx.y;
+    const rocblas_int blk    = blockIdx.x;
+    const rocblas_int blocks = gridDim.x;
+
+    // The tiles of block row blk of op(A) intersecting the band are at most D tiles from the
+    // diagonal, to the right of it for the upper triangle of A or the lower triangle of A^T
+    const rocblas_int D     = rocblas_int((int64_t(k) + NB - 1) / NB);
+    const rocblas_int first = UPPER != TRANS ? blk : (blk > D ? blk - D : 0);
+    const rocblas_int last  = UPPER != TRANS ? (blocks - 1 - blk > D ? blk + D : blocks - 1) : blk;
+
+    T res = 0;
+    for(rocblas_int J = first; J <= last; J++)
+    {
+        const int64_t row0 = int64_t(TRANS ? J : blk) * NB;
+        const int64_t col0 = int64_t(TRANS ? blk : J) * NB;
+
+        // the previous tile has been used
+        __syncthreads();
+
+        for(rocblas_int c = ty; c < NB; c += DIM_Y)
+        {
+            const int64_t i = row0 + tx;
+            const int64_t j = col0 + c;
+
+            T val = 0;
+            if(i < n && j < n && (UPPER ? i <= j && j - i <= k : j <= i && i - j <= k))
+            {
+                if(UNIT && i == j)
+                    val = T(1);
+                else
+                {
+                    val = A[rocblas_trmv_tiled_offset<S, UPPER>(i, j, n, k, lda)];
+                    if(CONJ)
+                        val = conj(val);
+                }
+            }
+            sA[tx][c] = val;
+        }
+
+        if(ty == 0)
+        {
+            const int64_t ind = int64_t(J) * NB + tx;
+            sx[tx]            = ind < n ? T(x[ind * incx]) : T(0);
+        }
+
+        __syncthreads();
+
+        if(TRANS)
+        {
+            for(rocblas_int r = ty; r < NB; r += DIM_Y)
+                res += sA[r][tx] * sx[r];
+        }
+        else
+        {
+            for(rocblas_int c = ty; c < NB; c += DIM_Y)
+                res += sA[tx][c] * sx[c];
+        }
+    }
+
+    sum[ty][tx] = res;
+    __syncthreads();
+
+    const int64_t ind = int64_t(blk) * NB + tx;
+    if(ty == 0 && ind < n)
+    {
+        for(rocblas_int i = 1; i < DIM_Y; i++)
+            res += sum[i][tx];
+        y[ind * incy] = res;
+    }
+}
+
+//! @brief Launches the tiled kernel computing y = op(A) * x, for x and y distinct vectors.
+template <rocblas_trmv_storage S, typename TConstPtr, typename TXPtr, typename TYPtr>
+inline void rocblas_trmv_tiled_launch(rocblas_handle    handle,
+                                      rocblas_fill      uplo,
+                                      rocblas_operation transA,
+                                      rocblas_diagonal  diag,
+                                      rocblas_int       n,
+                                      rocblas_int       k,
+                                      TConstPtr         A,
+                                      rocblas_stride    shifta,
+                                      rocblas_int       lda,
+                                      rocblas_stride    strideA,
+                                      TXPtr             x,
+                                      rocblas_stride    shiftx,
+                                      rocblas_int       incx,
+                                      rocblas_stride    stridex,
+                                      TYPtr             y,
+                                      rocblas_stride    shifty,
+                                      rocblas_int       incy,
+                                      rocblas_stride    stridey,
+                                      rocblas_int       batch_count)
+{
+    using T = std::remove_cv_t<
+        std::remove_pointer_t<std::remove_cv_t<std::remove_pointer_t<TYPtr>>>>;
+
+    constexpr rocblas_int NB = rocblas_trmv_tiled_nb<T>();
+    dim3                  grid((n - 1) / NB + 1, batch_count);
+    dim3                  threads(NB, ROCBLAS_TRMV_TILED_THREADS / NB);
+
+    auto launch = [&](auto upper, auto unit) {
+        constexpr bool UPPER = decltype(upper)::value;
+        constexpr bool UNIT  = decltype(unit)::value;
+
+#define TRMV_TILED_PARAMS                                                                   \
+    grid, threads, 0, handle->get_stream(), n, k, A, shifta, lda, strideA, x, shiftx, incx, \
+        stridex, y, shifty, incy, stridey
+
+        if(transA == rocblas_operation_none)
+            hipLaunchKernelGGL((rocblas_trmv_tiled_kernel<NB, S, UPPER, false, false, UNIT>),
+                               TRMV_TILED_PARAMS);
+        else if(transA == rocblas_operation_transpose)
+            hipLaunchKernelGGL((rocblas_trmv_tiled_kernel<NB, S, UPPER, true, false, UNIT>),
+                               TRMV_TILED_PARAMS);
+        else
+            hipLaunchKernelGGL((rocblas_trmv_tiled_kernel<NB, S, UPPER, true, true, UNIT>),
+                               TRMV_TILED_PARAMS);
+
+#undef TRMV_TILED_PARAMS
+    };
+
+    bool upper = uplo == rocblas_fill_upper;
+    bool unit  = diag == rocblas_diagonal_unit;
+    if(upper && unit)
+        launch(std::true_type{}, std::true_type{});
+    else if(upper)
+        launch(std::true_type{}, std::false_type{});
+    else if(unit)
+        launch(std::false_type{}, std::true_type{});
+    else
+        launch(std::false_type{}, std::false_type{});
+}
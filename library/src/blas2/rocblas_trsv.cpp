@@ -55,7 +55,7 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
-        auto layer_mode = handle->layer_mode;
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_trsv_name<T>, uplo, transA, diag, m, A, lda, B, incx);
 
@@ -270,4 +270,42 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+#ifdef IMPL
+#error IMPL IS ALREADY DEFINED
+#endif
+
+// Workspace size queries run the function as a device memory size query, which validates
+// the pointer arguments but does not access them
+#define IMPL(name_, T_, BLOCK_)                                            \
+    rocblas_status name_(rocblas_handle    handle,                         \
+                         rocblas_fill      uplo,                           \
+                         rocblas_operation transA,                         \
+                         rocblas_diagonal  diag,                           \
+                         rocblas_int       m,                              \
+                         rocblas_int       lda,                            \
+                         rocblas_int       incx,                           \
+                         size_t*           size)                           \
+    try                                                                    \
+    {                                                                      \
+        if(!handle)                                                        \
+            return rocblas_status_invalid_handle;                          \
+                                                                           \
+        T_ dummy{};                                                        \
+        return handle->query_device_memory_size(size, [&] {                \
+            return rocblas_trsv_impl<BLOCK_>(                              \
+                handle, uplo, transA, diag, m, &dummy, lda, &dummy, incx); \
+        });                                                                \
+    }                                                                      \
+    catch(...)                                                             \
+    {                                                                      \
+        return exception_to_rocblas_status();                              \
+    }
+
+IMPL(rocblas_strsv_workspace_size, float, ROCBLAS_SDCTRSV_NB);
+IMPL(rocblas_dtrsv_workspace_size, double, ROCBLAS_SDCTRSV_NB);
+IMPL(rocblas_ctrsv_workspace_size, rocblas_float_complex, ROCBLAS_SDCTRSV_NB);
+IMPL(rocblas_ztrsv_workspace_size, rocblas_double_complex, ROCBLAS_ZTRSV_NB);
+
+#undef IMPL
+
 } // extern "C"
@@ -26,6 +26,45 @@
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 
+// Largest triangular system, and most right hand sides, solved by
+// rocblas_internal_trsm_small_batched_template. Each thread keeps one right hand side
+// in registers, and several systems share a thread block.
+constexpr rocblas_int ROCBLAS_TRSM_SMALL_BATCHED_MAX_K   = 16;
+constexpr rocblas_int ROCBLAS_TRSM_SMALL_BATCHED_MAX_RHS = 64;
+
+inline bool rocblas_trsm_use_small_batched(rocblas_side side, rocblas_int m, rocblas_int n)
+{
+    rocblas_int k   = side == rocblas_side_left ? m : n;
+    rocblas_int rhs = side == rocblas_side_left ? n : m;
+    return k <= ROCBLAS_TRSM_SMALL_BATCHED_MAX_K && rhs <= ROCBLAS_TRSM_SMALL_BATCHED_MAX_RHS;
+}
+
+/*! \brief Solves op(A) X = alpha B or X op(A) = alpha B for a batch of small triangular A with
+    at most ROCBLAS_TRSM_SMALL_BATCHED_MAX_K rows and at most ROCBLAS_TRSM_SMALL_BATCHED_MAX_RHS
+    right hand sides, without workspace. Element (i, j) of B is B[i * incb + j * ldb], so that
+    trsv is the left case with n = 1 and incb = incx.
+    ********************************************************************/
+template <typename T, typename SCAL, typename ATYPE, typename BTYPE>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_trsm_small_batched_template(rocblas_handle    handle,
+                                                 rocblas_side      side,
+                                                 rocblas_fill      uplo,
+                                                 rocblas_operation transA,
+                                                 rocblas_diagonal  diag,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 SCAL              alpha,
+                                                 ATYPE             dA,
+                                                 rocblas_stride    offset_A,
+                                                 rocblas_int       lda,
+                                                 rocblas_stride    stride_A,
+                                                 BTYPE             dB,
+                                                 rocblas_stride    offset_B,
+                                                 rocblas_int       incb,
+                                                 rocblas_int       ldb,
+                                                 rocblas_stride    stride_B,
+                                                 rocblas_int       batch_count);
+
 template <typename U, typename V>
 inline rocblas_status rocblas_trsv_arg_check(rocblas_handle    handle,
                                              rocblas_fill      uplo,
@@ -63,8 +102,11 @@ inline rocblas_status rocblas_trsv_arg_check(rocblas_handle    handle,
     if(!A || !B)
         return rocblas_status_invalid_pointer;
 
-    // Need one int worth of global memory to keep track of completed sections
-    dev_bytes = sizeof(rocblas_int) * batch_count;
+    // Need one int worth of global memory to keep track of completed sections,
+    // except for small systems which are solved by one thread each
+    dev_bytes = rocblas_trsm_use_small_batched(rocblas_side_left, m, 1)
+                    ? 0
+                    : sizeof(rocblas_int) * batch_count;
     if(handle->is_device_memory_size_query())
     {
         return handle->set_optimal_device_memory_size(dev_bytes);
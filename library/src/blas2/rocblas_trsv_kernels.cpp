@@ -516,6 +516,9 @@ rocblas_trsv_device(rocblas_int    m,
     // Each thread stores DIM_X / DIM_Y elements in the same row
     T sAoff[DIM_X / DIM_Y];
 
+    // The block of A of the block column being applied, in the same layout
+    T sAcol[DIM_X / DIM_Y];
+
     const rocblas_int num_blocks = gridDim.x;
     const ptrdiff_t   tid        = blockDim.x * threadIdx.y + threadIdx.x;
     const rocblas_int tx         = threadIdx.x;
@@ -652,6 +655,27 @@ rocblas_trsv_device(rocblas_int    m,
         const size_t      A_idx     = local_col * size_t(lda) + local_row;
         const rocblas_int x_idx     = (block_col * DIM_X) * incx;
 
+        // Use shared memory if previous col since we cached this earlier
+        const bool cached
+            = !first_row
+              && (backwards_sub ? block_col == block_row + 1 : block_col == block_row - 1);
+
+        // The square block of A doesn't depend on the solve, so load it before waiting for the
+        // block column to be solved: the loads are in flight while this block spins on the flag
+        // and then only the x values of the block column are read on the critical path.
+        if(!cached)
+        {
+            for(rocblas_int i = 0; i < DIM_X; i += DIM_Y)
+            {
+                const size_t i_idx = TRANS ? i : i * size_t(lda);
+                if(TRANS ? (local_row + i < m && local_col < m)
+                         : (local_row < m && local_col + i < m))
+                    sAcol[i / DIM_Y] = A[A_idx + i_idx];
+                else
+                    sAcol[i / DIM_Y] = 0.0;
+            }
+        }
+
         if(tid == 0)
         {
             // Wait until the previous column is done. Use global memory to
@@ -682,22 +706,13 @@ rocblas_trsv_device(rocblas_int    m,
 
         __syncthreads();
 
-        // Update val with result of previous block
+        // Update val with result of previous block, out of range elements of A are zero
         for(rocblas_int i = 0; i < DIM_X; i += DIM_Y)
         {
-            // Use shared memory if previous col since we cached this earlier
-            const size_t i_idx = TRANS ? i : i * size_t(lda);
-            const bool   cached
-                = !first_row
-                  && (backwards_sub ? block_col == block_row + 1 : block_col == block_row - 1);
-
-            if(TRANS ? (local_row + i < m && local_col < m) : (local_row < m && local_col + i < m))
-            {
-                auto A_val = cached ? sAoff[i / DIM_Y] : A[A_idx + i_idx];
-                if(CONJ)
-                    A_val = conj(A_val);
-                val += A_val * sx[i + ty];
-            }
+            auto A_val = cached ? sAoff[i / DIM_Y] : sAcol[i / DIM_Y];
+            if(CONJ)
+                A_val = conj(A_val);
+            val += A_val * sx[i + ty];
         }
     }
 
@@ -775,6 +790,187 @@ rocblas_trsv_device(rocblas_int    m,
     __threadfence();
 }
 
+// Threads per block, and LDS bytes for the matrices of a block, of the small batched solve
+constexpr rocblas_int ROCBLAS_TRSM_SMALL_BATCHED_THREADS = 256;
+constexpr size_t      ROCBLAS_TRSM_SMALL_BATCHED_LDS     = 32768;
+
+// Solves M x = alpha b for small triangular M and several systems per block. threadIdx.y is the
+// system in the block and threadIdx.x the right hand side, which each thread solves in registers.
+// M is op(A) for the left side, and op(A)^T for the right side, where row threadIdx.x of B is
+// the right hand side.
+template <rocblas_int NB, typename T, typename SCAL, typename ATYPE, typename BTYPE>
+ROCBLAS_KERNEL(ROCBLAS_TRSM_SMALL_BATCHED_THREADS)
+rocblas_trsm_small_batched_device(rocblas_side      side,
+                                  rocblas_fill      uplo,
+                                  rocblas_operation transA,
+                                  rocblas_diagonal  diag,
+                                  rocblas_int       m,
+                                  rocblas_int       n,
+                                  SCAL              alpha_dev_host,
+                                  ATYPE             Aa,
+                                  rocblas_stride    offset_A,
+                                  rocblas_int       lda,
+                                  rocblas_stride    stride_A,
+                                  BTYPE             Ba,
+                                  rocblas_stride    offset_B,
+                                  rocblas_int       incb,
+                                  rocblas_int       ldb,
+                                  rocblas_stride    stride_B,
+                                  rocblas_int       batch_count)
+{
+    const int  tx      = threadIdx.x;
+    const int  batchid = blockIdx.x * blockDim.y + threadIdx.y;
+    const bool LEFT    = side == rocblas_side_left;
+    const bool TRANSM  = LEFT ? transA != rocblas_operation_none : transA == rocblas_operation_none;
+    const bool CONJ    = transA == rocblas_operation_conjugate_transpose;
+    const bool LOWERM  = (uplo == rocblas_fill_lower) != TRANSM;
+    const bool UNIT    = diag == rocblas_diagonal_unit;
+    const int  k       = LEFT ? m : n;
+    const int  nrhs    = LEFT ? n : m;
+
+    // passing as extern shared memory to avoid templating the number of systems per block
+    extern __shared__ rocblas_double_complex smem[];
+    T* sM = reinterpret_cast<T*>(smem) + threadIdx.y * NB * NB;
+
+    // the threads of a system load M(i, j) to sM[i + j * NB], reading A column by column
+    if(batchid < batch_count)
+    {
+        auto A = load_ptr_batch(Aa, batchid, offset_A, stride_A);
+        for(int idx = tx; idx < k * k; idx += blockDim.x)
+        {
+            int i = idx % k;
+            int j = idx / k;
+            T   a = A[i + size_t(j) * lda];
+            if(CONJ)
+                a = conj(a);
+            sM[TRANSM ? j + i * NB : i + j * NB] = a;
+        }
+    }
+    __syncthreads();
+
+    if(batchid >= batch_count || tx >= nrhs)
+        return;
+
+    auto      B     = load_ptr_batch(Ba, batchid, offset_B, stride_B);
+    auto      alpha = load_scalar(alpha_dev_host);
+    ptrdiff_t inc   = LEFT ? incb : ldb;
+    B += LEFT ? ptrdiff_t(tx) * ldb : ptrdiff_t(tx) * incb;
+
+    T x[NB];
+#pragma unroll
+    for(int i = 0; i < NB; i++)
+        if(i < k)
+            x[i] = alpha * B[i * inc];
+
+    if(LOWERM)
+    {
+#pragma unroll
+        for(int i = 0; i < NB; i++)
+            if(i < k)
+            {
+                T s = x[i];
+#pragma unroll
+                for(int j = 0; j < i; j++)
+                    s -= sM[i + j * NB] * x[j];
+                x[i] = UNIT ? s : s / sM[i + i * NB];
+            }
+    }
+    else
+    {
+#pragma unroll
+        for(int i = NB - 1; i >= 0; i--)
+            if(i < k)
+            {
+                T s = x[i];
+#pragma unroll
+                for(int j = i + 1; j < NB; j++)
+                    if(j < k)
+                        s -= sM[i + j * NB] * x[j];
+                x[i] = UNIT ? s : s / sM[i + i * NB];
+            }
+    }
+
+#pragma unroll
+    for(int i = 0; i < NB; i++)
+        if(i < k)
+            B[i * inc] = x[i];
+}
+
+template <typename T, typename SCAL, typename ATYPE, typename BTYPE>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_trsm_small_batched_template(rocblas_handle    handle,
+                                                 rocblas_side      side,
+                                                 rocblas_fill      uplo,
+                                                 rocblas_operation transA,
+                                                 rocblas_diagonal  diag,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 SCAL              alpha,
+                                                 ATYPE             dA,
+                                                 rocblas_stride    offset_A,
+                                                 rocblas_int       lda,
+                                                 rocblas_stride    stride_A,
+                                                 BTYPE             dB,
+                                                 rocblas_stride    offset_B,
+                                                 rocblas_int       incb,
+                                                 rocblas_int       ldb,
+                                                 rocblas_stride    stride_B,
+                                                 rocblas_int       batch_count)
+{
+    if(!m || !n || !batch_count)
+        return rocblas_status_success;
+
+    if(!rocblas_trsm_use_small_batched(side, m, n))
+        return rocblas_status_not_implemented;
+
+    rocblas_int k    = side == rocblas_side_left ? m : n;
+    rocblas_int nrhs = side == rocblas_side_left ? n : m;
+
+    // batches share a block until it has ROCBLAS_TRSM_SMALL_BATCHED_THREADS threads or its
+    // triangular matrices fill ROCBLAS_TRSM_SMALL_BATCHED_LDS
+#define TRSM_SMALL_BATCHED_LAUNCH(NB_)                                                         \
+    do                                                                                         \
+    {                                                                                          \
+        rocblas_int sys = std::min<size_t>(ROCBLAS_TRSM_SMALL_BATCHED_THREADS / nrhs,          \
+                                           ROCBLAS_TRSM_SMALL_BATCHED_LDS                      \
+                                               / (sizeof(T) * NB_ * NB_));                     \
+        sys             = std::max(1, std::min(sys, batch_count));                             \
+        hipLaunchKernelGGL((rocblas_trsm_small_batched_device<NB_, T>),                        \
+                           dim3((batch_count - 1) / sys + 1),                                  \
+                           dim3(nrhs, sys),                                                    \
+                           sizeof(T) * NB_ * NB_ * sys,                                        \
+                           handle->get_stream(),                                               \
+                           side,                                                               \
+                           uplo,                                                               \
+                           transA,                                                             \
+                           diag,                                                               \
+                           m,                                                                  \
+                           n,                                                                  \
+                           alpha,                                                              \
+                           dA,                                                                 \
+                           offset_A,                                                           \
+                           lda,                                                                \
+                           stride_A,                                                           \
+                           dB,                                                                 \
+                           offset_B,                                                           \
+                           incb,                                                               \
+                           ldb,                                                                \
+                           stride_B,                                                           \
+                           batch_count);                                                       \
+    } while(0)
+
+    if(k <= 4)
+        TRSM_SMALL_BATCHED_LAUNCH(4);
+    else if(k <= 8)
+        TRSM_SMALL_BATCHED_LAUNCH(8);
+    else
+        TRSM_SMALL_BATCHED_LAUNCH(16);
+
+#undef TRSM_SMALL_BATCHED_LAUNCH
+
+    return rocblas_status_success;
+}
+
 template <rocblas_int DIM_X, typename T, typename ATYPE, typename XTYPE>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     rocblas_internal_trsv_substitution_template(rocblas_handle    handle,
@@ -803,6 +999,50 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 
     offset_x = incx < 0 ? offset_x + ptrdiff_t(incx) * (1 - m) : offset_x;
 
+    // small systems are solved by one thread each, several systems per block
+    if(rocblas_trsm_use_small_batched(rocblas_side_left, m, 1))
+    {
+        T alpha_local = alpha && handle->pointer_mode == rocblas_pointer_mode_host ? *alpha : T(1);
+        if(alpha && handle->pointer_mode == rocblas_pointer_mode_device)
+            return rocblas_internal_trsm_small_batched_template<T>(handle,
+                                                                   rocblas_side_left,
+                                                                   uplo,
+                                                                   transA,
+                                                                   diag,
+                                                                   m,
+                                                                   1,
+                                                                   alpha,
+                                                                   dA,
+                                                                   offset_A,
+                                                                   lda,
+                                                                   stride_A,
+                                                                   dx,
+                                                                   offset_x,
+                                                                   incx,
+                                                                   1,
+                                                                   stride_x,
+                                                                   batch_count);
+        else
+            return rocblas_internal_trsm_small_batched_template<T>(handle,
+                                                                   rocblas_side_left,
+                                                                   uplo,
+                                                                   transA,
+                                                                   diag,
+                                                                   m,
+                                                                   1,
+                                                                   alpha_local,
+                                                                   dA,
+                                                                   offset_A,
+                                                                   lda,
+                                                                   stride_A,
+                                                                   dx,
+                                                                   offset_x,
+                                                                   incx,
+                                                                   1,
+                                                                   stride_x,
+                                                                   batch_count);
+    }
+
     constexpr rocblas_int DIM_Y  = 16;
     rocblas_int           blocks = (m + DIM_X - 1) / DIM_X;
     dim3                  threads(DIM_X, DIM_Y, 1);
@@ -1105,4 +1345,44 @@ INSTANTIATE_TRSV_TEMPLATE(32, rocblas_double_complex, rocblas_double_complex con
 
 #undef INSTANTIATE_TRSV_TEMPLATE
 
+#ifdef INSTANTIATE_TRSM_SMALL_BATCHED_TEMPLATE
+#error INSTANTIATE_TRSM_SMALL_BATCHED_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_TRSM_SMALL_BATCHED_TEMPLATE(T_, SCAL_, ATYPE_, BTYPE_)                                   \
+template ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status rocblas_internal_trsm_small_batched_template    \
+                                               <T_, SCAL_, ATYPE_, BTYPE_>                              \
+                                               (rocblas_handle    handle,                               \
+                                                rocblas_side      side,                                 \
+                                                rocblas_fill      uplo,                                 \
+                                                rocblas_operation transA,                               \
+                                                rocblas_diagonal  diag,                                 \
+                                                rocblas_int       m,                                    \
+                                                rocblas_int       n,                                    \
+                                                SCAL_             alpha,                                \
+                                                ATYPE_            dA,                                   \
+                                                rocblas_stride    offset_A,                             \
+                                                rocblas_int       lda,                                  \
+                                                rocblas_stride    stride_A,                             \
+                                                BTYPE_            dB,                                   \
+                                                rocblas_stride    offset_B,                             \
+                                                rocblas_int       incb,                                 \
+                                                rocblas_int       ldb,                                  \
+                                                rocblas_stride    stride_B,                             \
+                                                rocblas_int       batch_count);
+
+#define INSTANTIATE_TRSM_SMALL_BATCHED_TYPE(T_)                                                   \
+INSTANTIATE_TRSM_SMALL_BATCHED_TEMPLATE(T_, T_, T_ const*, T_*)                                    \
+INSTANTIATE_TRSM_SMALL_BATCHED_TEMPLATE(T_, T_ const*, T_ const*, T_*)                             \
+INSTANTIATE_TRSM_SMALL_BATCHED_TEMPLATE(T_, T_, T_ const* const*, T_* const*)                      \
+INSTANTIATE_TRSM_SMALL_BATCHED_TEMPLATE(T_, T_ const*, T_ const* const*, T_* const*)
+
+INSTANTIATE_TRSM_SMALL_BATCHED_TYPE(float)
+INSTANTIATE_TRSM_SMALL_BATCHED_TYPE(double)
+INSTANTIATE_TRSM_SMALL_BATCHED_TYPE(rocblas_float_complex)
+INSTANTIATE_TRSM_SMALL_BATCHED_TYPE(rocblas_double_complex)
+
+#undef INSTANTIATE_TRSM_SMALL_BATCHED_TYPE
+#undef INSTANTIATE_TRSM_SMALL_BATCHED_TEMPLATE
+
 // clang-format on
@@ -0,0 +1,204 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * ===========================================================================
+ *    Blocked multi-workgroup triangular solve of a single right hand side,
+ *    used by tpsv and tbsv for large n
+ * ===========================================================================
+ */
+
+// The solve is split into block rows of ROCBLAS_TSV_BLOCKED_DIM_X rows, one workgroup per block
+// row, all launched at once. Each workgroup loads and inverts the diagonal of its diagonal block
+// into LDS, then applies the off-diagonal blocks of its block row, a gemv, as soon as the block
+// rows they multiply are solved, and finally solves its diagonal block in LDS. A device memory
+// flag per batch holds the last block row which has been solved; the flags are only advanced in
+// block row order, so that a workgroup waiting for block row j may read all of x above it.
+// Workgroups only wait for lower block indices, which are dispatched before them, as in the
+// trsv substitution kernel.
+//
+// The matrix is accessed through a(row, col), element (row, col) of the lower triangular op(A)
+// of the forward solve. Backward solves are forward solves of the reversed system, with
+// a(row, col) = op(A)(n - 1 - row, n - 1 - col) and x reversed.
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas.h"
+#include <cstdio>
+#include <cstdlib>
+
+constexpr rocblas_int ROCBLAS_TSV_BLOCKED_DIM_X = 64;
+constexpr rocblas_int ROCBLAS_TSV_BLOCKED_DIM_Y = 16;
+
+static const rocblas_int rocblas_internal_tsv_blocked_min_size = [] {
+    // n from which tpsv and tbsv use the blocked multi-workgroup solve instead of a single
+    // workgroup per system. 0 disables the blocked solve.
+    constexpr rocblas_int TSV_BLOCKED_MIN_SIZE = 2048;
+    rocblas_int           min_size;
+    const char*           env = getenv("ROCBLAS_INTERNAL_TSV_BLOCKED_MIN_SIZE");
+    return env && sscanf(env, "%d", &min_size) == 1 ? min_size : TSV_BLOCKED_MIN_SIZE;
+}();
+
+//! @brief True if tpsv and tbsv of size n use the blocked solve; the batches are in the y
+//!        dimension of its grid.
+inline bool rocblas_tsv_use_blocked(rocblas_int n, rocblas_int batch_count)
+{
+    return rocblas_internal_tsv_blocked_min_size > 0 && n >= rocblas_internal_tsv_blocked_min_size
+           && batch_count <= 65535;
+}
+
+//! @brief Device memory in bytes of the completion flags of the blocked solve, 0 if not used.
+inline size_t rocblas_tsv_blocked_workspace_size(rocblas_int n, rocblas_int batch_count)
+{
+    return rocblas_tsv_use_blocked(n, batch_count) ? sizeof(rocblas_int) * batch_count : 0;
+}
+
+template <rocblas_int NB>
+ROCBLAS_KERNEL(NB)
+rocblas_tsv_blocked_init(rocblas_int batch_count, rocblas_int* w_completed_sec)
+{
+    // No block row has been solved yet
+    rocblas_int batch = blockIdx.x * NB + threadIdx.x;
+    if(batch < batch_count)
+        w_completed_sec[batch] = -1;
+}
+
+//! @brief Forward substitution of block row blockIdx.x of the lower triangular system
+//!        a(row, col) x = b of size n, with x overwriting b.
+//!
+//! Only the elements with row - col <= band are referenced; band is n - 1 for dense triangles.
+//! w_completed_sec is the completion flag of the batch, initialized to -1.
+template <rocblas_int DIM_X, rocblas_int DIM_Y, typename T, typename FA>
+ROCBLAS_KERNEL_ILF void rocblas_tsv_blocked_substitution(rocblas_int  n,
+                                                         rocblas_int  band,
+                                                         bool         is_unit_diag,
+                                                         FA           a,
+                                                         T*           x,
+                                                         int64_t      incx,
+                                                         rocblas_int* w_completed_sec)
+{
+    __shared__ T sA[DIM_X * DIM_X];
+    __shared__ T sx[DIM_X];
+    __shared__ T sum[DIM_X * DIM_Y];
+
+    volatile rocblas_int* completed = w_completed_sec;
+
+    const rocblas_int tx        = threadIdx.x;
+    const rocblas_int ty        = threadIdx.y;
+    const rocblas_int tid       = ty * DIM_X + tx;
+    const rocblas_int block_row = blockIdx.x;
+    const rocblas_int row0      = block_row * DIM_X;
+    const rocblas_int rows      = n - row0 < DIM_X ? n - row0 : DIM_X;
+    const rocblas_int row       = row0 + tx;
+
+    // Lower triangle of the diagonal block, with its inverted diagonal so that the solve
+    // only multiplies. Loaded while the previous block rows are being solved.
+    for(rocblas_int j = ty; j < DIM_X; j += DIM_Y)
+    {
+        T val = 0;
+        if(tx < rows && j <= tx && tx - j <= band)
+        {
+            if(tx != j)
+                val = a(row, row0 + j);
+            else
+                val = is_unit_diag ? T(1) : T(1) / a(row, row);
+        }
+        sA[j * DIM_X + tx] = val;
+    }
+
+    // Off-diagonal blocks within the band, each applied once its block row of x is solved
+    T                 val       = 0;
+    rocblas_int       col_done  = -1;
+    const rocblas_int first_col = (row0 - band > 0 ? row0 - band : 0) / DIM_X;
+    for(rocblas_int block_col = first_col; block_col < block_row; block_col++)
+    {
+        if(tid == 0 && col_done < block_col)
+        {
+            while((col_done = *completed) < block_col)
+                __threadfence();
+        }
+
+        __threadfence();
+        __syncthreads();
+
+        // block rows above block_row are full
+        const rocblas_int col0 = block_col * DIM_X;
+        if(tid < DIM_X)
+            sx[tid] = x[(col0 + tid) * incx];
+
+        __syncthreads();
+
+        if(tx < rows)
+        {
+            for(rocblas_int j = ty; j < DIM_X; j += DIM_Y)
+            {
+                const rocblas_int col = col0 + j;
+                if(row - col <= band)
+                    val += a(row, col) * sx[j];
+            }
+        }
+
+        __syncthreads();
+    }
+
+    sum[tid] = val;
+    __syncthreads();
+
+    // Right hand side of the diagonal block, and its solve by the first DIM_X threads
+    T rhs = 0;
+    if(ty == 0 && tx < rows)
+    {
+        rhs = x[row * incx];
+        for(rocblas_int i = 0; i < DIM_Y; i++)
+            rhs -= sum[i * DIM_X + tx];
+    }
+
+    for(rocblas_int i = 0; i < rows; i++)
+    {
+        if(ty == 0 && tx == i)
+            sx[i] = rhs * sA[i * DIM_X + i];
+
+        __syncthreads();
+
+        if(ty == 0 && tx > i)
+            rhs -= sA[i * DIM_X + tx] * sx[i];
+    }
+
+    if(ty == 0 && tx < rows)
+        x[row * incx] = sx[tx];
+
+    // ensure solved x values are saved before the block row is marked as solved
+    __threadfence();
+    __syncthreads();
+
+    if(tid == 0)
+    {
+        // the flag only advances in block row order: outside the band this block row may have
+        // been solved before the previous one
+        while(*completed < block_row - 1)
+            __threadfence();
+        *completed = block_row;
+    }
+
+    __threadfence();
+}
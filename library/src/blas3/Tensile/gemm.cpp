@@ -22,6 +22,7 @@
 
 #include "gemm.hpp"
 #include "logging.hpp"
+#include "managed_prefetch.hpp"
 
 namespace
 {
@@ -69,7 +70,7 @@ namespace
         auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
 
         // Perform logging
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
@@ -151,6 +152,12 @@ namespace
         if(validArgs != rocblas_status_continue)
             return validArgs;
 
+        // clang-format off
+        rocblas_prefetch_managed_gemm(handle, trans_a, trans_b, m, n, k,
+                                      A, sizeof(T), lda, 0, B, sizeof(T), ldb, 0,
+                                      C, sizeof(T), ldc, 0, C, sizeof(T), ldc, 0, 1);
+        // clang-format on
+
         if(check_numerics)
         {
             bool           is_input = true;
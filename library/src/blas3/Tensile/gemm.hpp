@@ -23,21 +23,27 @@
 #pragma once
 
 #include <cstring> // std::memcpy for graph capture use cases
+#include <limits>
 
 #ifdef BUILD_WITH_TENSILE
 #include "gemm_tensile.hpp"
-#else
-#include "gemm_source.hpp"
 #endif
+#include "gemm_source.hpp"
 
 #include "check_numerics_matrix.hpp"
+#include "gemm_degenerate.hpp"
+#include "gemm_small_batched.hpp"
+#include "gemm_tall_skinny.hpp"
 #include "handle.hpp"
 
 /*********************************************************************************
  * Right now Tensile requires alpha and beta to be passed by value on host.      *
  * If in device pointer mode, copy alpha and beta to host.                       *
  * If k == 0, we set alpha = 0 instead of copying from device.                   *
- * TODO: Make this asynchronous, putting synchronization closer to Tensile call. *
+ * The copies are ordered on the handle's stream, so that scalars produced by    *
+ * earlier work on that stream are observed, and a single stream synchronize     *
+ * waits for both of them instead of a device-wide hipMemcpy for each scalar.    *
+ * That synchronization is not allowed in graph safe mode.                       *
  *********************************************************************************/
 template <typename Ta, typename Tac, typename Tb, typename Tbc>
 rocblas_status rocblas_copy_alpha_beta_to_host_if_on_device(rocblas_handle handle,
@@ -49,19 +55,32 @@ rocblas_status rocblas_copy_alpha_beta_to_host_if_on_device(rocblas_handle handl
 {
     if(handle->pointer_mode == rocblas_pointer_mode_device)
     {
+        if((beta || (alpha && k != 0)) && handle->is_graph_safe())
+            return rocblas_status_not_implemented;
+
+        hipStream_t stream = handle->get_stream();
+        bool        copied = false;
         if(alpha)
         {
             if(k == 0)
                 alpha_h = 0;
             else
-                RETURN_IF_HIP_ERROR(hipMemcpy(&alpha_h, alpha, sizeof(Tac), hipMemcpyDeviceToHost));
+            {
+                RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                    &alpha_h, alpha, sizeof(Tac), hipMemcpyDeviceToHost, stream));
+                copied = true;
+            }
             alpha = &alpha_h;
         }
         if(beta)
         {
-            RETURN_IF_HIP_ERROR(hipMemcpy(&beta_h, beta, sizeof(Tbc), hipMemcpyDeviceToHost));
-            beta = &beta_h;
+            RETURN_IF_HIP_ERROR(
+                hipMemcpyAsync(&beta_h, beta, sizeof(Tbc), hipMemcpyDeviceToHost, stream));
+            copied = true;
+            beta   = &beta_h;
         }
+        if(copied)
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
     }
     return rocblas_status_success;
 }
@@ -144,6 +163,34 @@ inline rocblas_status rocblas_validateArgs(rocblas_handle    handle,
     return rocblas_status_continue;
 }
 
+/*******************************************************************************
+ * Strided batched gemm whose batches share A (stride_a == 0) and whose batches *
+ * of op(B) = B, C and D are consecutive columns, is one gemm with              *
+ * n * batch_count columns. Returns true after changing n and batch_count to    *
+ * those of the single gemm.                                                    *
+ ******************************************************************************/
+inline bool rocblas_gemm_collapse_shared_a(rocblas_operation trans_b,
+                                           rocblas_int&      n,
+                                           rocblas_stride    stride_a,
+                                           rocblas_int       ldb,
+                                           rocblas_stride    stride_b,
+                                           rocblas_int       ldc,
+                                           rocblas_stride    stride_c,
+                                           rocblas_int       ldd,
+                                           rocblas_stride    stride_d,
+                                           rocblas_int&      batch_count)
+{
+    if(batch_count <= 1 || stride_a != 0 || trans_b != rocblas_operation_none
+       || stride_b != rocblas_stride(ldb) * n || stride_c != rocblas_stride(ldc) * n
+       || stride_d != rocblas_stride(ldd) * n
+       || int64_t(n) * batch_count > std::numeric_limits<rocblas_int>::max())
+        return false;
+
+    n *= batch_count;
+    batch_count = 1;
+    return true;
+}
+
 /*
  * ===========================================================================
  *    template interface
@@ -178,62 +225,176 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     if(!m || !n || !batch_count)
         return rocblas_status_success;
 
-    TScal alpha_h, beta_h;
-    RETURN_IF_ROCBLAS_ERROR(
-        rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
+    // Batches sharing A form a single gemm with better tile efficiency
+    if(!BATCHED)
+        rocblas_gemm_collapse_shared_a(
+            trans_b, n, stride_a, ldb, stride_b, ldc, stride_c, ldc, stride_c, batch_count);
 
-#ifdef BUILD_WITH_TENSILE
-    if(BATCHED)
+    // The Tensile and source backends skip the kernels for special shapes, so that a problem
+    // can be compared across the implementations
+    bool special_shapes = handle->gemm_backend == rocblas_gemm_backend_default;
+
+    // Matrix-vector and rank-1 update shapes, of which the gemm tiles would compute one row or
+    // column, or a single step of k
+    rocblas_status degenerate_status = rocblas_status_continue;
+    if(special_shapes)
+        degenerate_status = rocblas_gemm_degenerate_solution(handle,
+                                                             trans_a,
+                                                             trans_b,
+                                                             m,
+                                                             n,
+                                                             k,
+                                                             alpha,
+                                                             A,
+                                                             offset_a,
+                                                             lda,
+                                                             stride_a,
+                                                             B,
+                                                             offset_b,
+                                                             ldb,
+                                                             stride_b,
+                                                             beta,
+                                                             C,
+                                                             offset_c,
+                                                             ldc,
+                                                             stride_c,
+                                                             batch_count);
+    if(degenerate_status != rocblas_status_continue)
+        return degenerate_status;
+
+    // Extreme aspect ratios and large batches of tiny matrices, which the tiles of Tensile and
+    // of the source gemm under-utilize. Their kernels take alpha and beta on the host, which
+    // graph safe mode cannot copy. Both are only used for the types of the atomic adds of the
+    // tall and skinny reduction, so that half precision keeps the accumulation of Tensile.
+    if constexpr(rocblas_gemm_tall_skinny_types<TScal>)
     {
-        return rocblas_call_tensile(handle,
-                                    alpha,
-                                    beta,
-                                    A,
-                                    B,
-                                    C,
-                                    trans_a,
-                                    trans_b,
-                                    ldc,
-                                    stride_c,
-                                    offset_c,
-                                    lda,
-                                    stride_a,
-                                    offset_a,
-                                    ldb,
-                                    stride_b,
-                                    offset_b,
-                                    m,
-                                    n,
-                                    k,
-                                    batch_count);
+        bool small_batched = rocblas_gemm_use_small_batched(m, n, k, batch_count);
+        bool tall_skinny   = rocblas_gemm_use_tall_skinny_outer(m, n, k)
+                           || rocblas_gemm_use_tall_skinny_inner(handle, m, n, k, batch_count);
+        if((small_batched || tall_skinny) && special_shapes
+           && !(handle->pointer_mode == rocblas_pointer_mode_device && handle->is_graph_safe()))
+        {
+            const TScal* alpha_p = alpha;
+            const TScal* beta_p  = beta;
+            TScal        alpha_v, beta_v;
+            RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+                handle, alpha_p, beta_p, alpha_v, beta_v, k));
+
+            // clang-format off
+            if(*alpha_p != TScal(0))
+                return small_batched
+                    ? rocblas_gemm_small_batched_solution(handle, trans_a, trans_b, m, n, k,
+                                                          *alpha_p, A, offset_a, lda, stride_a,
+                                                          B, offset_b, ldb, stride_b,
+                                                          *beta_p, C, offset_c, ldc, stride_c,
+                                                          batch_count)
+                    : rocblas_gemm_tall_skinny_solution(handle, trans_a, trans_b, m, n, k,
+                                                        *alpha_p, A, offset_a, lda, stride_a,
+                                                        B, offset_b, ldb, stride_b,
+                                                        *beta_p, C, offset_c, ldc, stride_c,
+                                                        batch_count);
+            // clang-format on
+        }
     }
-    else
+
+#ifdef BUILD_WITH_TENSILE
+    // Tensile takes alpha and beta by value, so device scalars are copied to the host, which
+    // synchronizes the stream. In graph safe mode and during stream capture, which cannot
+    // synchronize, device scalars are given to the source kernels instead.
+    bool keep_device_scalars
+        = handle->pointer_mode == rocblas_pointer_mode_device && handle->is_graph_safe();
+    if(handle->gemm_backend != rocblas_gemm_backend_source && !keep_device_scalars)
     {
-        return rocblas_call_tensile(handle,
-                                    alpha,
-                                    beta,
-                                    A + offset_a,
-                                    B + offset_b,
-                                    C + offset_c,
-                                    trans_a,
-                                    trans_b,
-                                    ldc,
-                                    stride_c,
-                                    0,
-                                    lda,
-                                    stride_a,
-                                    0,
-                                    ldb,
-                                    stride_b,
-                                    0,
-                                    m,
-                                    n,
-                                    k,
-                                    batch_count);
+        TScal alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(
+            rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
+
+        if(BATCHED)
+        {
+            return rocblas_call_tensile(handle,
+                                        alpha,
+                                        beta,
+                                        A,
+                                        B,
+                                        C,
+                                        trans_a,
+                                        trans_b,
+                                        ldc,
+                                        stride_c,
+                                        offset_c,
+                                        lda,
+                                        stride_a,
+                                        offset_a,
+                                        ldb,
+                                        stride_b,
+                                        offset_b,
+                                        m,
+                                        n,
+                                        k,
+                                        batch_count);
+        }
+        else
+        {
+            return rocblas_call_tensile(handle,
+                                        alpha,
+                                        beta,
+                                        A + offset_a,
+                                        B + offset_b,
+                                        C + offset_c,
+                                        trans_a,
+                                        trans_b,
+                                        ldc,
+                                        stride_c,
+                                        0,
+                                        lda,
+                                        stride_a,
+                                        0,
+                                        ldb,
+                                        stride_b,
+                                        0,
+                                        m,
+                                        n,
+                                        k,
+                                        batch_count);
+        }
     }
-#else // BUILD_WITH_TENSILE
+#endif // BUILD_WITH_TENSILE
+
     hipStream_t rocblas_stream = handle->get_stream();
 
+    // The source kernels load device scalars themselves, so in device pointer mode
+    // alpha and beta are passed straight through without a host round-trip
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        if(k == 0)
+            return rocblas_gemm_scale_template(
+                m, n, beta, C, offset_c, ldc, stride_c, batch_count, rocblas_stream);
+
+        rocblas_gemm_source_solution_device_scalars<BATCHED>(trans_a,
+                                                             trans_b,
+                                                             m,
+                                                             n,
+                                                             k,
+                                                             alpha,
+                                                             A,
+                                                             lda,
+                                                             stride_a,
+                                                             offset_a,
+                                                             B,
+                                                             ldb,
+                                                             stride_b,
+                                                             offset_b,
+                                                             beta,
+                                                             C,
+                                                             ldc,
+                                                             stride_c,
+                                                             offset_c,
+                                                             batch_count,
+                                                             handle->gemm_workgroup_mapping,
+                                                             rocblas_stream);
+        return rocblas_status_success;
+    }
+
     if(k == 0 || (alpha && *alpha == 0))
     {
         return rocblas_gemm_scale_template(
@@ -260,9 +421,9 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                           stride_c,
                                           offset_c,
                                           batch_count,
+                                          handle->gemm_workgroup_mapping,
                                           rocblas_stream);
     return rocblas_status_success;
-#endif // BUILD_WITH_TENSILE
 }
 
 template <typename TConstPtr, typename TPtr>
@@ -69,7 +69,7 @@ namespace
         auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
 
         // Perform logging
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
@@ -185,27 +185,56 @@ namespace
         rocblas_int a_n2 = rocblas_operation_none == trans_a ? k : m;
         rocblas_int b_n2 = rocblas_operation_none == trans_b ? n : k;
 
-        status = rocblas_internal_gemm_template<true>(handle,
-                                                      trans_a,
-                                                      trans_b,
-                                                      m,
-                                                      n,
-                                                      k,
-                                                      alpha,
-                                                      A,
-                                                      0,
-                                                      lda,
-                                                      0,
-                                                      B,
-                                                      0,
-                                                      ldb,
-                                                      0,
-                                                      beta,
-                                                      C,
-                                                      0,
-                                                      ldc,
-                                                      0,
-                                                      batch_count);
+        // Pointer arrays which are evenly strided run the strided batched gemm
+        const void*    arrays[]     = {A, B, C};
+        const size_t   elem_sizes[] = {sizeof(T), sizeof(T), sizeof(T)};
+        void*          bases[3];
+        rocblas_stride strides[3];
+        if(rocblas_internal_detect_pointer_array_strides(
+               handle, batch_count, 3, arrays, elem_sizes, bases, strides))
+            status = rocblas_internal_gemm_template<false>(handle,
+                                                           trans_a,
+                                                           trans_b,
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           alpha,
+                                                           (const T*)bases[0],
+                                                           0,
+                                                           lda,
+                                                           strides[0],
+                                                           (const T*)bases[1],
+                                                           0,
+                                                           ldb,
+                                                           strides[1],
+                                                           beta,
+                                                           (T*)bases[2],
+                                                           0,
+                                                           ldc,
+                                                           strides[2],
+                                                           batch_count);
+        else
+            status = rocblas_internal_gemm_template<true>(handle,
+                                                          trans_a,
+                                                          trans_b,
+                                                          m,
+                                                          n,
+                                                          k,
+                                                          alpha,
+                                                          A,
+                                                          0,
+                                                          lda,
+                                                          0,
+                                                          B,
+                                                          0,
+                                                          ldb,
+                                                          0,
+                                                          beta,
+                                                          C,
+                                                          0,
+                                                          ldc,
+                                                          0,
+                                                          batch_count);
 
         if(status != rocblas_status_success)
             return status;
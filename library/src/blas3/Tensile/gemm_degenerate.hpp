@@ -0,0 +1,277 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * ===========================================================================
+ *    Dispatch of gemm with a unit or small dimension to the Level 2 kernels, from
+ *    rocblas_internal_gemm_template and gemm_ex
+ * ===========================================================================
+ */
+
+// With n == 1, C is a vector and op(A) * op(B) a matrix-vector product of op(A) with the
+// column of op(B), which gemv computes at the bandwidth of reading A. With m == 1, the row of C
+// is the product of op(B)^T with the row of op(A), which is a gemv with B as the matrix.
+// m == n == 1 takes the n == 1 path: dot would compute the product, but not alpha and beta.
+// With k == 1 and beta == 1, C += alpha * op(A) * op(B) is the rank-1 update of ger, or of gerc
+// for a conjugated op(B). For other beta, C would be read and written by a scaling kernel as well
+// as by ger, so the gemm kernels are kept.
+//
+// With 2 <= n <= 16, as in block Krylov and multiple right hand side solvers, the gemm tiles are
+// mostly padding and separate gemvs would read A once per column of C. The multi-vector gemv
+// reads op(A) once and keeps the sums of all the columns of op(B) in registers; likewise with
+// 2 <= m <= 16 and B as the matrix. It is only used when the matrix is large enough in both of
+// its dimensions for the bandwidth of reading it to dominate, which leaves the smaller shapes to
+// the small batched and tall and skinny kernels.
+//
+// The Level 2 kernels cannot conjugate the vectors, so that a conjugated op(B) with small n, or
+// a conjugated op(B) or op(A) with small m, and a conjugated op(A) with k == 1, keep the gemm
+// kernels.
+
+#pragma once
+
+#include "../../blas2/rocblas_gemv.hpp"
+#include "../../blas2/rocblas_ger.hpp"
+#include "handle.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+static const bool rocblas_internal_gemm_degenerate_shapes = [] {
+    // Whether gemm with m, n or k of 1 uses gemv and ger. 0 disables them.
+    int         enabled;
+    const char* env = getenv("ROCBLAS_INTERNAL_GEMM_DEGENERATE_SHAPES");
+    return !(env && sscanf(env, "%d", &enabled) == 1 && !enabled);
+}();
+
+static const rocblas_int rocblas_internal_gemm_multi_vector_max_n = [] {
+    // Largest n, or m, of gemm that runs as a multi-vector gemv, at most 16. 0 disables it.
+    constexpr rocblas_int GEMM_MULTI_VECTOR_MAX_N = ROCBLAS_GEMV_MULTI_MAX_VECTORS;
+    rocblas_int           max_n;
+    const char*           env = getenv("ROCBLAS_INTERNAL_GEMM_MULTI_VECTOR_MAX_N");
+    return env && sscanf(env, "%d", &max_n) == 1
+               ? std::min(max_n, ROCBLAS_GEMV_MULTI_MAX_VECTORS)
+               : GEMM_MULTI_VECTOR_MAX_N;
+}();
+
+namespace
+{
+    // Smallest dimensions of the matrix of the multi-vector gemv of gemm
+    constexpr rocblas_int ROCBLAS_GEMM_MULTI_VECTOR_MIN_DIM = 128;
+
+    // Types of the gemv and ger kernels
+    template <typename T>
+    constexpr bool rocblas_gemm_degenerate_types
+        = std::is_same<T, float>{} || std::is_same<T, double>{}
+          || std::is_same<T, rocblas_float_complex>{} || std::is_same<T, rocblas_double_complex>{};
+
+    //! @brief Computes C = alpha * op(A) * op(B) + beta * C with gemv when n or m is 1, with the
+    //!        multi-vector gemv when n or m is small, or with ger when k is 1 and beta is 1 on the
+    //!        host. Returns rocblas_status_continue when the shape or operations are not handled,
+    //!        so that the caller runs gemm.
+    template <typename TScal, typename TConstPtr, typename TPtr>
+    rocblas_status rocblas_gemm_degenerate_solution(rocblas_handle    handle,
+                                                    rocblas_operation trans_a,
+                                                    rocblas_operation trans_b,
+                                                    rocblas_int       m,
+                                                    rocblas_int       n,
+                                                    rocblas_int       k,
+                                                    const TScal*      alpha,
+                                                    const TConstPtr*  A,
+                                                    rocblas_stride    offset_a,
+                                                    rocblas_int       lda,
+                                                    rocblas_stride    stride_a,
+                                                    const TConstPtr*  B,
+                                                    rocblas_stride    offset_b,
+                                                    rocblas_int       ldb,
+                                                    rocblas_stride    stride_b,
+                                                    const TScal*      beta,
+                                                    TPtr*             C,
+                                                    rocblas_stride    offset_c,
+                                                    rocblas_int       ldc,
+                                                    rocblas_stride    stride_c,
+                                                    rocblas_int       batch_count)
+    {
+        if constexpr(rocblas_gemm_degenerate_types<TScal>)
+        {
+            if(!rocblas_internal_gemm_degenerate_shapes || !k)
+                return rocblas_status_continue;
+
+            // For real types the conjugate transpose is the transpose
+            constexpr bool is_complex = rocblas_is_complex<TScal>;
+            const bool     conj_a = is_complex && trans_a == rocblas_operation_conjugate_transpose;
+            const bool     conj_b = is_complex && trans_b == rocblas_operation_conjugate_transpose;
+
+            if(n == 1 && !conj_b)
+            {
+                // C(:, 0) = alpha * op(A) * op(B)(:, 0) + beta * C(:, 0)
+                return rocblas_internal_gemv_template(
+                    handle,
+                    trans_a,
+                    trans_a == rocblas_operation_none ? m : k,
+                    trans_a == rocblas_operation_none ? k : m,
+                    alpha,
+                    0,
+                    A,
+                    offset_a,
+                    lda,
+                    stride_a,
+                    B,
+                    offset_b,
+                    trans_b == rocblas_operation_none ? 1 : ldb,
+                    stride_b,
+                    beta,
+                    0,
+                    C,
+                    offset_c,
+                    1,
+                    stride_c,
+                    batch_count,
+                    (TScal*)nullptr);
+            }
+
+            if(m == 1 && !conj_a && !conj_b)
+            {
+                // C(0, :)^T = alpha * op(B)^T * op(A)(0, :)^T + beta * C(0, :)^T
+                return rocblas_internal_gemv_template(
+                    handle,
+                    trans_b == rocblas_operation_none ? rocblas_operation_transpose
+                                                      : rocblas_operation_none,
+                    trans_b == rocblas_operation_none ? k : n,
+                    trans_b == rocblas_operation_none ? n : k,
+                    alpha,
+                    0,
+                    B,
+                    offset_b,
+                    ldb,
+                    stride_b,
+                    A,
+                    offset_a,
+                    trans_a == rocblas_operation_none ? lda : 1,
+                    stride_a,
+                    beta,
+                    0,
+                    C,
+                    offset_c,
+                    ldc,
+                    stride_c,
+                    batch_count,
+                    (TScal*)nullptr);
+            }
+
+            auto multi_vector = [&](rocblas_int nv, rocblas_int dim) {
+                return nv >= 2 && nv <= rocblas_internal_gemm_multi_vector_max_n
+                       && dim >= ROCBLAS_GEMM_MULTI_VECTOR_MIN_DIM
+                       && k >= ROCBLAS_GEMM_MULTI_VECTOR_MIN_DIM;
+            };
+
+            if(multi_vector(n, m) && !conj_b)
+            {
+                // C(:, j) = alpha * op(A) * op(B)(:, j) + beta * C(:, j) for the n columns
+                return rocblas_internal_gemv_multi_template(
+                    handle,
+                    trans_a,
+                    trans_a == rocblas_operation_none ? m : k,
+                    trans_a == rocblas_operation_none ? k : m,
+                    n,
+                    alpha,
+                    A,
+                    offset_a,
+                    lda,
+                    stride_a,
+                    B,
+                    offset_b,
+                    trans_b == rocblas_operation_none ? 1 : ldb,
+                    trans_b == rocblas_operation_none ? ldb : 1,
+                    stride_b,
+                    beta,
+                    C,
+                    offset_c,
+                    1,
+                    ldc,
+                    stride_c,
+                    batch_count);
+            }
+
+            if(multi_vector(m, n) && !conj_a && !conj_b)
+            {
+                // C(i, :)^T = alpha * op(B)^T * op(A)(i, :)^T + beta * C(i, :)^T for the m rows
+                return rocblas_internal_gemv_multi_template(
+                    handle,
+                    trans_b == rocblas_operation_none ? rocblas_operation_transpose
+                                                      : rocblas_operation_none,
+                    trans_b == rocblas_operation_none ? k : n,
+                    trans_b == rocblas_operation_none ? n : k,
+                    m,
+                    alpha,
+                    B,
+                    offset_b,
+                    ldb,
+                    stride_b,
+                    A,
+                    offset_a,
+                    trans_a == rocblas_operation_none ? lda : 1,
+                    trans_a == rocblas_operation_none ? 1 : lda,
+                    stride_a,
+                    beta,
+                    C,
+                    offset_c,
+                    ldc,
+                    1,
+                    stride_c,
+                    batch_count);
+            }
+
+            if(k == 1 && !conj_a && handle->pointer_mode == rocblas_pointer_mode_host
+               && *beta == TScal(1))
+            {
+                // C += alpha * op(A)(:, 0) * op(B)(0, :)
+                handle->log_kernel("rocblas_gemm_degenerate_ger");
+                auto ger = [&](auto conj) {
+                    return rocblas_internal_ger_template<decltype(conj)::value, TScal>(
+                        handle,
+                        m,
+                        n,
+                        alpha,
+                        0,
+                        A,
+                        offset_a,
+                        trans_a == rocblas_operation_none ? 1 : lda,
+                        stride_a,
+                        B,
+                        offset_b,
+                        trans_b == rocblas_operation_none ? ldb : 1,
+                        stride_b,
+                        C,
+                        offset_c,
+                        ldc,
+                        stride_c,
+                        batch_count);
+                };
+                if constexpr(is_complex)
+                    if(conj_b)
+                        return ger(std::true_type{});
+                return ger(std::false_type{});
+            }
+        }
+        return rocblas_status_continue;
+    }
+}
@@ -0,0 +1,223 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * ===========================================================================
+ *    Source gemm kernels with compile time sizes for large batches of tiny
+ *    matrices, dispatched from rocblas_internal_gemm_template
+ * ===========================================================================
+ */
+
+// m, n and k of at most 32 are rounded up to the compile time size S in 4, 8, 16 or 32. Each
+// workgroup computes NB = 256 / (S * S) products, or one for S = 32, with a thread per element of
+// C: op(A) and op(B) are loaded once into zero padded S x S tiles of LDS, and the dot products
+// are fully unrolled over S, so that the kernels have neither loops over k nor bounds checks
+// outside of the loads and stores.
+
+#pragma once
+
+#include "handle.hpp"
+#include <cstdio>
+#include <cstdlib>
+
+static const rocblas_int rocblas_internal_gemm_small_batched_min_batch = [] {
+    // batch count from which gemm with m, n and k of at most 32 uses the small batched kernels.
+    // 0 disables them.
+    constexpr rocblas_int GEMM_SMALL_BATCHED_MIN_BATCH = 1024;
+    rocblas_int           min_batch;
+    const char*           env = getenv("ROCBLAS_INTERNAL_GEMM_SMALL_BATCHED_MIN_BATCH");
+    return env && sscanf(env, "%d", &min_batch) == 1 ? min_batch : GEMM_SMALL_BATCHED_MIN_BATCH;
+}();
+
+namespace
+{
+    // Largest m, n and k of the small batched kernels
+    constexpr rocblas_int ROCBLAS_GEMM_SMALL_BATCHED_MAX_DIM = 32;
+
+    //! @brief True if gemm of size m x n x k with batch_count matrices uses the small batched
+    //!        kernels
+    inline bool rocblas_gemm_use_small_batched(rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_int k,
+                                               rocblas_int batch_count)
+    {
+        return rocblas_internal_gemm_small_batched_min_batch > 0
+               && batch_count >= rocblas_internal_gemm_small_batched_min_batch && k >= 1
+               && m <= ROCBLAS_GEMM_SMALL_BATCHED_MAX_DIM && n <= ROCBLAS_GEMM_SMALL_BATCHED_MAX_DIM
+               && k <= ROCBLAS_GEMM_SMALL_BATCHED_MAX_DIM;
+    }
+
+    // C = alpha * op(A) * op(B) + beta * C for the batches NB * blockIdx.x + threadIdx.z, with
+    // thread (threadIdx.x, threadIdx.y) computing the element (i, j) of C
+    template <int S, int NB, typename T, typename TConstPtr, typename TPtr>
+    ROCBLAS_KERNEL(S* S* NB)
+    rocblas_gemm_small_batched_kernel(rocblas_int       m,
+                                      rocblas_int       n,
+                                      rocblas_int       k,
+                                      T                 alpha,
+                                      rocblas_operation trans_a,
+                                      TConstPtr         dA,
+                                      rocblas_stride    offset_a,
+                                      rocblas_int       lda,
+                                      rocblas_stride    stride_a,
+                                      rocblas_operation trans_b,
+                                      TConstPtr         dB,
+                                      rocblas_stride    offset_b,
+                                      rocblas_int       ldb,
+                                      rocblas_stride    stride_b,
+                                      T                 beta,
+                                      TPtr              dC,
+                                      rocblas_stride    offset_c,
+                                      rocblas_int       ldc,
+                                      rocblas_stride    stride_c,
+                                      rocblas_int       batch_count)
+    {
+        __shared__ T sA[NB][S][S]; // op(A)(i, l) at sA[z][l][i]
+        __shared__ T sB[NB][S][S + 1]; // op(B)(l, j) at sB[z][j][l], padded for the column reads
+
+        const int         tx    = threadIdx.x;
+        const int         ty    = threadIdx.y;
+        const int         tz    = threadIdx.z;
+        const rocblas_int batch = blockIdx.x * NB + tz;
+
+        // the workgroup synchronizes once, so that threads of missing batches only skip memory
+        const bool valid = batch < batch_count;
+
+        T a = T(0), b = T(0);
+        if(valid)
+        {
+            const auto* A = load_ptr_batch(dA, batch, offset_a, stride_a);
+            const auto* B = load_ptr_batch(dB, batch, offset_b, stride_b);
+
+            // thread (tx, ty) loads op(A)(tx, ty) and op(B)(tx, ty), contiguous in tx when not
+            // transposed
+            if(tx < m && ty < k)
+            {
+                if(trans_a == rocblas_operation_none)
+                    a = A[tx + ty * size_t(lda)];
+                else
+                    a = trans_a == rocblas_operation_conjugate_transpose
+                            ? conj(A[ty + tx * size_t(lda)])
+                            : A[ty + tx * size_t(lda)];
+            }
+            if(tx < k && ty < n)
+            {
+                if(trans_b == rocblas_operation_none)
+                    b = B[tx + ty * size_t(ldb)];
+                else
+                    b = trans_b == rocblas_operation_conjugate_transpose
+                            ? conj(B[ty + tx * size_t(ldb)])
+                            : B[ty + tx * size_t(ldb)];
+            }
+        }
+
+        sA[tz][ty][tx] = a;
+        sB[tz][ty][tx] = b;
+
+        __syncthreads();
+
+        if(!valid || tx >= m || ty >= n)
+            return;
+
+        T sum = T(0);
+#pragma unroll
+        for(int l = 0; l < S; l++)
+            sum += sA[tz][l][tx] * sB[tz][ty][l];
+
+        auto* C = load_ptr_batch(dC, batch, offset_c, stride_c);
+        T*    c = C + tx + ty * size_t(ldc);
+        *c      = beta == T(0) ? alpha * sum : alpha * sum + beta * *c;
+    }
+
+    //! @brief Launches the small batched kernel of C = alpha * op(A) * op(B) + beta * C with the
+    //!        smallest compile time size for m, n and k, with alpha and beta on the host.
+    template <typename T, typename TConstPtr, typename TPtr>
+    rocblas_status rocblas_gemm_small_batched_solution(rocblas_handle    handle,
+                                                       rocblas_operation trans_a,
+                                                       rocblas_operation trans_b,
+                                                       rocblas_int       m,
+                                                       rocblas_int       n,
+                                                       rocblas_int       k,
+                                                       T                 alpha,
+                                                       TConstPtr         A,
+                                                       rocblas_stride    offset_a,
+                                                       rocblas_int       lda,
+                                                       rocblas_stride    stride_a,
+                                                       TConstPtr         B,
+                                                       rocblas_stride    offset_b,
+                                                       rocblas_int       ldb,
+                                                       rocblas_stride    stride_b,
+                                                       T                 beta,
+                                                       TPtr              C,
+                                                       rocblas_stride    offset_c,
+                                                       rocblas_int       ldc,
+                                                       rocblas_stride    stride_c,
+                                                       rocblas_int       batch_count)
+    {
+        hipStream_t stream = handle->get_stream();
+        rocblas_int size   = std::max(m, std::max(n, k));
+
+#define ROCBLAS_GEMM_SMALL_BATCHED_LAUNCH(S_)                                                 \
+    do                                                                                        \
+    {                                                                                         \
+        static constexpr int NB = S_ * S_ >= 256 ? 1 : 256 / (S_ * S_);                       \
+        hipLaunchKernelGGL((rocblas_gemm_small_batched_kernel<S_, NB>),                       \
+                           dim3((batch_count - 1) / NB + 1),                                  \
+                           dim3(S_, S_, NB),                                                  \
+                           0,                                                                 \
+                           stream,                                                            \
+                           m,                                                                 \
+                           n,                                                                 \
+                           k,                                                                 \
+                           alpha,                                                             \
+                           trans_a,                                                           \
+                           A,                                                                 \
+                           offset_a,                                                          \
+                           lda,                                                               \
+                           stride_a,                                                          \
+                           trans_b,                                                           \
+                           B,                                                                 \
+                           offset_b,                                                          \
+                           ldb,                                                               \
+                           stride_b,                                                          \
+                           beta,                                                              \
+                           C,                                                                 \
+                           offset_c,                                                          \
+                           ldc,                                                               \
+                           stride_c,                                                          \
+                           batch_count);                                                      \
+    } while(0)
+
+        if(size <= 4)
+            ROCBLAS_GEMM_SMALL_BATCHED_LAUNCH(4);
+        else if(size <= 8)
+            ROCBLAS_GEMM_SMALL_BATCHED_LAUNCH(8);
+        else if(size <= 16)
+            ROCBLAS_GEMM_SMALL_BATCHED_LAUNCH(16);
+        else
+            ROCBLAS_GEMM_SMALL_BATCHED_LAUNCH(32);
+
+#undef ROCBLAS_GEMM_SMALL_BATCHED_LAUNCH
+
+        return rocblas_status_success;
+    }
+}
@@ -26,8 +26,34 @@
 
 namespace
 {
-    // large index support is not needed for lda, ldb, ldc as this kernel is only intended for small m, n, k
-    // general alpha, beta, m, n, k
+    // Loads the elements of op(A) unchanged
+    struct rocblas_gemm_load_identity
+    {
+        template <typename T>
+        __device__ T operator()(int, int, T a) const
+        {
+            return a;
+        }
+    };
+
+    // Loads the element (i, j) of op(A) scaled by x[i * incx] if scale_rows (diag(x) * op(A))
+    // or by x[j * incx] (op(A) * diag(x)), so that no scaled copy of A is written
+    template <typename T>
+    struct rocblas_gemm_load_diagonal_scaled
+    {
+        const T* x;
+        int64_t  incx;
+        bool     scale_rows;
+
+        __device__ T operator()(int i, int j, T a) const
+        {
+            return a * x[(scale_rows ? i : j) * incx];
+        }
+    };
+
+    // Computes the tile (blx, bly) of D = alpha * op(A) * op(B) + beta * C for general
+    // m, n, k. C and D may be the same matrix. The elements of op(A) are passed through
+    // load_a(i, j, a) as they are loaded into LDS.
     template <typename T,
               int  DIM_M,
               int  DIM_N,
@@ -41,40 +67,32 @@ namespace
               bool BETA_EQ_ZERO,
               char TRANS_A,
               char TRANS_B,
-              typename TConstPtr,
-              typename TPtr>
-    ROCBLAS_KERNEL(DIM_M* DIM_N)
-    rocblas_gemm_batched_general_kernel(rocblas_int    M,
-                                        rocblas_int    N,
-                                        rocblas_int    K,
-                                        const T        alpha,
-                                        TConstPtr*     dA_input,
-                                        rocblas_int    lda,
-                                        rocblas_stride a_st_or_of,
-                                        TConstPtr*     dB_input,
-                                        rocblas_int    ldb,
-                                        rocblas_stride b_st_or_of,
-                                        const T        beta,
-                                        TPtr*          dC_input,
-                                        rocblas_int    ldc,
-                                        rocblas_stride c_st_or_of,
-                                        rocblas_int    batch_count)
+              typename FA = rocblas_gemm_load_identity>
+    ROCBLAS_KERNEL_ILF void rocblas_gemm_general_tile(rocblas_int M,
+                                                      rocblas_int N,
+                                                      rocblas_int K,
+                                                      const T     alpha,
+                                                      const T*    dA,
+                                                      rocblas_int lda,
+                                                      const T*    dB,
+                                                      rocblas_int ldb,
+                                                      const T     beta,
+                                                      const T*    dC,
+                                                      rocblas_int ldc,
+                                                      T*          dD,
+                                                      rocblas_int ldd,
+                                                      int         blx,
+                                                      int         bly,
+                                                      FA          load_a = FA{})
     {
         int thx  = threadIdx.x; // thread's m position in C
         int thy  = threadIdx.y; // thread's n position in C
         int idt  = DIM_M * thy + thx; // thread's number
-        int blx  = blockIdx.x; // block's m position
-        int bly  = blockIdx.y; // block's n position
-        int blz  = blockIdx.z; // block's matrix in the batch
         int thxA = idt % DIM_M_A; // thread's m position for loading A
         int thyA = idt / DIM_M_A; // thread's n position for loading A
         int thxB = idt % DIM_M_B; // thread's m position for loading B
         int thyB = idt / DIM_M_B; // thread's n position for loading B
 
-        auto* dA = load_ptr_batch(dA_input, blz, a_st_or_of);
-        auto* dB = load_ptr_batch(dB_input, blz, b_st_or_of);
-        auto* dC = load_ptr_batch(dC_input, blz, c_st_or_of);
-
         __shared__ T sA[BLK_K][BLK_M]; // shared memory for A
         __shared__ T sB[BLK_N][BLK_K]; // shared memory for B
         T            rC[BLK_N / DIM_N][BLK_M / DIM_M]; // registers for C
@@ -101,15 +119,15 @@ namespace
                     {
                         if(TRANS_A == 'N')
                         {
-                            sA[n + thyA][m + thxA] = dA[i + j * lda];
+                            sA[n + thyA][m + thxA] = load_a(i, j, dA[i + j * lda]);
                         }
                         else if(TRANS_A == 'T')
                         {
-                            sA[n + thyA][m + thxA] = dA[i * lda + j];
+                            sA[n + thyA][m + thxA] = load_a(i, j, dA[i * lda + j]);
                         }
                         else if(TRANS_A == 'C')
                         {
-                            sA[n + thyA][m + thxA] = conj(dA[i * lda + j]);
+                            sA[n + thyA][m + thxA] = load_a(i, j, conj(dA[i * lda + j]));
                         }
                     }
                     else
@@ -165,13 +183,13 @@ namespace
                 int coord_dCn = bly * BLK_N + n * DIM_N + thy;
                 if(coord_dCn < N && coord_dCm < M)
                 {
-                    if(BETA_EQ_ZERO)
+                    if(BETA_EQ_ZERO || beta == 0)
                     {
-                        dC[coord_dCn * ldc + coord_dCm] = alpha * rC[n][m];
+                        dD[coord_dCn * ldd + coord_dCm] = alpha * rC[n][m];
                     }
                     else
                     {
-                        dC[coord_dCn * ldc + coord_dCm]
+                        dD[coord_dCn * ldd + coord_dCm]
                             = alpha * rC[n][m] + beta * dC[coord_dCn * ldc + coord_dCm];
                     }
                 }
@@ -179,6 +197,95 @@ namespace
         }
     }
 
+    // Remaps the block's tile (blx, bly) so that the grid visits C in strips of wgm tile rows,
+    // each strip walked down its tiles of a column before moving to the next column. Blocks
+    // running together then share the tiles of A and B they load, improving L2 hit rates on
+    // large matrices. wgm <= 1 keeps the launch order.
+    ROCBLAS_KERNEL_ILF void rocblas_gemm_swizzle_block(rocblas_int wgm, int& blx, int& bly)
+    {
+        if(wgm <= 1)
+            return;
+
+        int grid_m  = gridDim.x;
+        int grid_n  = gridDim.y;
+        int id      = bly * grid_m + blx;
+        int first_m = id / (wgm * grid_n) * wgm;
+        int strip_m = min(grid_m - first_m, wgm);
+        int local   = id - first_m * grid_n;
+
+        blx = first_m + local % strip_m;
+        bly = local / strip_m;
+    }
+
+    // large index support is not needed for lda, ldb, ldc as this kernel is only intended for small m, n, k
+    // general alpha, beta, m, n, k
+    template <typename T,
+              int  DIM_M,
+              int  DIM_N,
+              int  BLK_M,
+              int  BLK_N,
+              int  BLK_K,
+              int  DIM_M_A,
+              int  DIM_N_A,
+              int  DIM_M_B,
+              int  DIM_N_B,
+              bool BETA_EQ_ZERO,
+              char TRANS_A,
+              char TRANS_B,
+              typename TScal,
+              typename TConstPtr,
+              typename TPtr>
+    ROCBLAS_KERNEL(DIM_M* DIM_N)
+    rocblas_gemm_batched_general_kernel(rocblas_int    M,
+                                        rocblas_int    N,
+                                        rocblas_int    K,
+                                        TScal          alpha_device_host,
+                                        TConstPtr*     dA_input,
+                                        rocblas_int    lda,
+                                        rocblas_stride a_st_or_of,
+                                        TConstPtr*     dB_input,
+                                        rocblas_int    ldb,
+                                        rocblas_stride b_st_or_of,
+                                        TScal          beta_device_host,
+                                        TPtr*          dC_input,
+                                        rocblas_int    ldc,
+                                        rocblas_stride c_st_or_of,
+                                        rocblas_int    batch_count,
+                                        rocblas_int    wgm)
+    {
+        const T alpha = load_scalar(alpha_device_host);
+        const T beta  = load_scalar(beta_device_host);
+
+        // With host scalars alpha == 0 and beta == 0 are resolved before launch;
+        // with device scalars they are only known here
+        if(alpha == 0)
+            K = 0;
+
+        int blx = blockIdx.x; // block's m position
+        int bly = blockIdx.y; // block's n position
+        int blz = blockIdx.z; // block's matrix in the batch
+        rocblas_gemm_swizzle_block(wgm, blx, bly);
+
+        auto* dA = load_ptr_batch(dA_input, blz, a_st_or_of);
+        auto* dB = load_ptr_batch(dB_input, blz, b_st_or_of);
+        auto* dC = load_ptr_batch(dC_input, blz, c_st_or_of);
+
+        rocblas_gemm_general_tile<T,
+                                  DIM_M,
+                                  DIM_N,
+                                  BLK_M,
+                                  BLK_N,
+                                  BLK_K,
+                                  DIM_M_A,
+                                  DIM_N_A,
+                                  DIM_M_B,
+                                  DIM_N_B,
+                                  BETA_EQ_ZERO,
+                                  TRANS_A,
+                                  TRANS_B>(
+            M, N, K, alpha, dA, lda, dB, ldb, beta, dC, ldc, dC, ldc, blx, bly);
+    }
+
     // large index support is not needed for lda, ldb, ldc as this kernel is only intended for small m, n, k
     // general alpha, beta, restricted m, n, k
     template <typename T,
@@ -211,7 +318,8 @@ namespace
                                 TPtr*          dC_input,
                                 rocblas_int    ldc,
                                 rocblas_stride c_st_or_of,
-                                rocblas_int    batch_count)
+                                rocblas_int    batch_count,
+                                rocblas_int    wgm)
     {
         int thx  = threadIdx.x; // thread's m position in C
         int thy  = threadIdx.y; // thread's n position in C
@@ -219,6 +327,7 @@ namespace
         int blx  = blockIdx.x; // block's m position
         int bly  = blockIdx.y; // block's n position
         int blz  = blockIdx.z; // block's matrix in the batch
+        rocblas_gemm_swizzle_block(wgm, blx, bly);
         int thxA = idt % DIM_M_A; // thread's m position for loading A
         int thyA = idt / DIM_M_A; // thread's n position for loading A
         int thxB = idt % DIM_M_B; // thread's m position for loading B
@@ -351,7 +460,8 @@ namespace
                                 TPtr*          dC_input,
                                 rocblas_int    ldc,
                                 rocblas_stride c_st_or_of,
-                                rocblas_int    batch_count)
+                                rocblas_int    batch_count,
+                                rocblas_int    wgm)
     {
         int thx  = threadIdx.x; // thread's m position in C
         int thy  = threadIdx.y; // thread's n position in C
@@ -359,6 +469,7 @@ namespace
         int blx  = blockIdx.x; // block's m position
         int bly  = blockIdx.y; // block's n position
         int blz  = blockIdx.z; // block's matrix in the batch
+        rocblas_gemm_swizzle_block(wgm, blx, bly);
         int thxA = idt % DIM_M_A; // thread's m position for loading A
         int thyA = idt / DIM_M_A; // thread's n position for loading A
         int thxB = idt % DIM_M_B; // thread's m position for loading B
@@ -544,6 +655,7 @@ namespace
                                       rocblas_stride    stride_c,
                                       rocblas_stride    offset_c,
                                       rocblas_int       batch_count,
+                                      rocblas_int       wgm,
                                       hipStream_t       stream)
     {
         // gemm has same behavior for alpha == 0 and k == 0. Special code is needed
@@ -595,47 +707,47 @@ namespace
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'N', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 else if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'T', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 else if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'N', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 else if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'T', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'C', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'C', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'C', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 else if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'N', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 else if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'T', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 // clang-format on
             }
             else if(alpha == 1.0 && beta == -1.0)
@@ -645,47 +757,47 @@ namespace
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'N', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 else if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'T', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 else if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'N', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 else if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'T', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'C', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'C', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'C', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 else if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'N', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 else if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'T', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 // clang-format on
             }
             else if(alpha == 1.0 && beta == 0.0)
@@ -695,47 +807,47 @@ namespace
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'N', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'T', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'N', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'T', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'C', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'C', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'C', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'N', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'T', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 // clang-format on
             }
             else if(alpha == -1.0 && beta == 0.0)
@@ -745,47 +857,47 @@ namespace
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'N', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'T', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'N', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'T', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'C', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'C', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'C', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'N', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'T', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 // clang-format on
             }
             else if(beta == 0)
@@ -796,47 +908,47 @@ namespace
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'N', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'T' , 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'N', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'T', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'C', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'C', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'C', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'N', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'T', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 // clang-format on
             }
             else
@@ -847,47 +959,47 @@ namespace
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'N', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'T', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'N', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'T', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'C', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'C', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'C', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'N', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'T', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 // clang-format on
             }
         }
@@ -908,47 +1020,47 @@ namespace
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'N', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'T', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'N', 'T' >),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'T', 'T' >),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'C', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'C', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'C', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'N', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 1, 'T', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 // clang-format on
             }
             else if(alpha == 1.0 && beta == -1.0)
@@ -958,47 +1070,47 @@ namespace
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'N', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'T', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'N', 'T' >),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'T', 'T' >),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'C', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'C', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'C', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'N', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, -1, 'T', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 // clang-format on
             }
             else if(alpha == 1.0 && beta == 0.0)
@@ -1008,47 +1120,47 @@ namespace
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'N', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'T', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'N', 'T' >),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'T', 'T' >),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'C', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'C', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'C', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'N', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 1, 0, 'T', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 // clang-format on
             }
             else if(alpha == -1.0 && beta == 0.0)
@@ -1058,47 +1170,47 @@ namespace
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'N', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'T', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'N', 'T' >),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'T', 'T' >),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'C', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'C', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'C', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'N', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, -1, 0, 'T', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 // clang-format on
             }
             else if(beta == 0)
@@ -1109,47 +1221,47 @@ namespace
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'N', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'T', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'N', 'T' >),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'T', 'T' >),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'C', 'C' >),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'C', 'N' >),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'C', 'T' >),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'N', 'C' >),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'T', 'C' >),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 // clang-format on
             }
             else
@@ -1160,47 +1272,47 @@ namespace
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'N', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'T', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'N', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'T', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'C', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'C', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'C', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'N', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'T', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 // clang-format on
             }
         }
@@ -1221,47 +1333,47 @@ namespace
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'N', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'T', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true,'N', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'T', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'C', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'C', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'C', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'N', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, true, 'T', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 // clang-format on
             }
             else
@@ -1272,49 +1384,528 @@ namespace
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'N', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'T', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'N', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'T', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'C', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'C', 'N'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'C', 'T'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'N', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
                     hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel
                     <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, false, 'T', 'C'>),
                     dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of,
-                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count);
+                    dB_krn, ldb, b_st_or_of, beta, dC_krn, ldc, c_st_or_of, batch_count, wgm);
                 // clang-format on
             }
         }
     }
+
+    // Launch the general kernel for the given transposes; alpha and beta may be device pointers
+    template <typename T,
+              int  DIM_M,
+              int  DIM_N,
+              int  BLK_M,
+              int  BLK_N,
+              int  BLK_K,
+              typename TScal,
+              typename TConstPtr,
+              typename TPtr>
+    void rocblas_gemm_source_general_launcher(rocblas_operation trans_a,
+                                              rocblas_operation trans_b,
+                                              dim3              dimGrid,
+                                              hipStream_t       stream,
+                                              rocblas_int       m,
+                                              rocblas_int       n,
+                                              rocblas_int       k,
+                                              TScal             alpha,
+                                              TConstPtr*        dA_krn,
+                                              rocblas_int       lda,
+                                              rocblas_stride    a_st_or_of,
+                                              TConstPtr*        dB_krn,
+                                              rocblas_int       ldb,
+                                              rocblas_stride    b_st_or_of,
+                                              TScal             beta,
+                                              TPtr*             dC_krn,
+                                              rocblas_int       ldc,
+                                              rocblas_stride    c_st_or_of,
+                                              rocblas_int       batch_count,
+                                              rocblas_int       wgm)
+    {
+        dim3 dimBlock(DIM_M, DIM_N, 1);
+
+#define ROCBLAS_GEMM_SOURCE_GENERAL_LAUNCH(TRANS_A_, TRANS_B_)                                  \
+    hipLaunchKernelGGL((rocblas_gemm_batched_general_kernel<T,                                  \
+                                                            DIM_M,                              \
+                                                            DIM_N,                              \
+                                                            BLK_M,                              \
+                                                            BLK_N,                              \
+                                                            BLK_K,                              \
+                                                            BLK_M,                              \
+                                                            BLK_K,                              \
+                                                            BLK_K,                              \
+                                                            BLK_N,                              \
+                                                            false,                              \
+                                                            TRANS_A_,                           \
+                                                            TRANS_B_>),                         \
+                       dimGrid,                                                                 \
+                       dimBlock,                                                                \
+                       0,                                                                       \
+                       stream,                                                                  \
+                       m,                                                                       \
+                       n,                                                                       \
+                       k,                                                                       \
+                       alpha,                                                                   \
+                       dA_krn,                                                                  \
+                       lda,                                                                     \
+                       a_st_or_of,                                                              \
+                       dB_krn,                                                                  \
+                       ldb,                                                                     \
+                       b_st_or_of,                                                              \
+                       beta,                                                                    \
+                       dC_krn,                                                                  \
+                       ldc,                                                                     \
+                       c_st_or_of,                                                              \
+                       batch_count,                                                             \
+                       wgm)
+
+        char ta = rocblas_transpose_letter(trans_a);
+        char tb = rocblas_transpose_letter(trans_b);
+
+        // clang-format off
+        if(ta == 'N' && tb == 'N') ROCBLAS_GEMM_SOURCE_GENERAL_LAUNCH('N', 'N');
+        else if(ta == 'N' && tb == 'T') ROCBLAS_GEMM_SOURCE_GENERAL_LAUNCH('N', 'T');
+        else if(ta == 'N' && tb == 'C') ROCBLAS_GEMM_SOURCE_GENERAL_LAUNCH('N', 'C');
+        else if(ta == 'T' && tb == 'N') ROCBLAS_GEMM_SOURCE_GENERAL_LAUNCH('T', 'N');
+        else if(ta == 'T' && tb == 'T') ROCBLAS_GEMM_SOURCE_GENERAL_LAUNCH('T', 'T');
+        else if(ta == 'T' && tb == 'C') ROCBLAS_GEMM_SOURCE_GENERAL_LAUNCH('T', 'C');
+        else if(ta == 'C' && tb == 'N') ROCBLAS_GEMM_SOURCE_GENERAL_LAUNCH('C', 'N');
+        else if(ta == 'C' && tb == 'T') ROCBLAS_GEMM_SOURCE_GENERAL_LAUNCH('C', 'T');
+        else if(ta == 'C' && tb == 'C') ROCBLAS_GEMM_SOURCE_GENERAL_LAUNCH('C', 'C');
+        // clang-format on
+
+#undef ROCBLAS_GEMM_SOURCE_GENERAL_LAUNCH
+    }
+
+    // Source gemm with alpha and beta in device memory. The values are unknown on the host,
+    // so the specialized alpha/beta kernels cannot be selected; the general kernel loads the
+    // scalars on the device and handles alpha == 0 and beta == 0 itself, avoiding any
+    // host synchronization.
+    template <bool BATCHED, typename T, typename TConstPtr, typename TPtr>
+    void rocblas_gemm_source_solution_device_scalars(rocblas_operation trans_a,
+                                                     rocblas_operation trans_b,
+                                                     rocblas_int       m,
+                                                     rocblas_int       n,
+                                                     rocblas_int       k,
+                                                     const T*          alpha,
+                                                     TConstPtr*        dA,
+                                                     rocblas_int       lda,
+                                                     rocblas_stride    stride_a,
+                                                     rocblas_stride    offset_a,
+                                                     TConstPtr*        dB,
+                                                     rocblas_int       ldb,
+                                                     rocblas_stride    stride_b,
+                                                     rocblas_stride    offset_b,
+                                                     const T*          beta,
+                                                     TPtr*             dC,
+                                                     rocblas_int       ldc,
+                                                     rocblas_stride    stride_c,
+                                                     rocblas_stride    offset_c,
+                                                     rocblas_int       batch_count,
+                                                     rocblas_int       wgm,
+                                                     hipStream_t       stream)
+    {
+        TConstPtr*     dA_krn     = BATCHED ? dA : dA + offset_a;
+        TConstPtr*     dB_krn     = BATCHED ? dB : dB + offset_b;
+        TPtr*          dC_krn     = BATCHED ? dC : dC + offset_c;
+        rocblas_stride a_st_or_of = BATCHED ? offset_a : stride_a;
+        rocblas_stride b_st_or_of = BATCHED ? offset_b : stride_b;
+        rocblas_stride c_st_or_of = BATCHED ? offset_c : stride_c;
+
+        if((m % 64 == 0) && (n % 64 == 0) && (k % 4 == 0))
+        {
+            constexpr int blk_m = 64, blk_n = 64, blk_k = 4;
+            dim3          dimGrid(m / blk_m, n / blk_n, batch_count);
+            rocblas_gemm_source_general_launcher<T, 16, 16, blk_m, blk_n, blk_k>(trans_a,
+                                                                                 trans_b,
+                                                                                 dimGrid,
+                                                                                 stream,
+                                                                                 m,
+                                                                                 n,
+                                                                                 k,
+                                                                                 alpha,
+                                                                                 dA_krn,
+                                                                                 lda,
+                                                                                 a_st_or_of,
+                                                                                 dB_krn,
+                                                                                 ldb,
+                                                                                 b_st_or_of,
+                                                                                 beta,
+                                                                                 dC_krn,
+                                                                                 ldc,
+                                                                                 c_st_or_of,
+                                                                                 batch_count,
+                                                                                 wgm);
+        }
+        else
+        {
+            constexpr int blk_m = 32, blk_n = 32, blk_k = 8;
+            dim3 dimGrid(((m - 1) / blk_m) + 1, ((n - 1) / blk_n) + 1, batch_count);
+            rocblas_gemm_source_general_launcher<T, 16, 16, blk_m, blk_n, blk_k>(trans_a,
+                                                                                 trans_b,
+                                                                                 dimGrid,
+                                                                                 stream,
+                                                                                 m,
+                                                                                 n,
+                                                                                 k,
+                                                                                 alpha,
+                                                                                 dA_krn,
+                                                                                 lda,
+                                                                                 a_st_or_of,
+                                                                                 dB_krn,
+                                                                                 ldb,
+                                                                                 b_st_or_of,
+                                                                                 beta,
+                                                                                 dC_krn,
+                                                                                 ldc,
+                                                                                 c_st_or_of,
+                                                                                 batch_count,
+                                                                                 wgm);
+        }
+    }
+
+    // Grouped gemm: blockIdx.z selects the group, whose sizes, leading dimensions and matrix
+    // pointers are read from device arrays. The sizes are not known on the host, so each
+    // block loops over the tiles of its group with a stride of the grid size.
+    // Groups with m <= 0 or n <= 0 are skipped, and k < 0 is treated as k == 0.
+    // If trans_a_array and trans_b_array are not null, only the groups whose operations are
+    // TRANS_A and TRANS_B are computed.
+    template <typename T,
+              int  DIM_M,
+              int  DIM_N,
+              int  BLK_M,
+              int  BLK_N,
+              int  BLK_K,
+              char TRANS_A,
+              char TRANS_B,
+              typename TScal>
+    ROCBLAS_KERNEL(DIM_M* DIM_N)
+    rocblas_gemm_grouped_general_kernel(const rocblas_int*       m_array,
+                                        const rocblas_int*       n_array,
+                                        const rocblas_int*       k_array,
+                                        TScal                    alpha_device_host,
+                                        const T* const*          a_array,
+                                        const rocblas_int*       lda_array,
+                                        const T* const*          b_array,
+                                        const rocblas_int*       ldb_array,
+                                        TScal                    beta_device_host,
+                                        const T* const*          c_array,
+                                        const rocblas_int*       ldc_array,
+                                        T* const*                d_array,
+                                        const rocblas_int*       ldd_array,
+                                        const rocblas_operation* trans_a_array,
+                                        const rocblas_operation* trans_b_array)
+    {
+        int g = blockIdx.z; // block's group
+        if(trans_a_array
+           && (rocblas_transpose_letter(trans_a_array[g]) != TRANS_A
+               || rocblas_transpose_letter(trans_b_array[g]) != TRANS_B))
+            return;
+
+        rocblas_int M = m_array[g];
+        rocblas_int N = n_array[g];
+        rocblas_int K = k_array[g];
+        if(M <= 0 || N <= 0)
+            return;
+
+        const T alpha = load_scalar(alpha_device_host);
+        const T beta  = load_scalar(beta_device_host);
+        if(alpha == 0 || K < 0)
+            K = 0;
+
+        // A and B are not read if K == 0, and C is not read if beta == 0
+        const T*    dA  = K ? a_array[g] : nullptr;
+        const T*    dB  = K ? b_array[g] : nullptr;
+        rocblas_int lda = K ? lda_array[g] : 0;
+        rocblas_int ldb = K ? ldb_array[g] : 0;
+        const T*    dC  = beta != 0 ? c_array[g] : nullptr;
+        rocblas_int ldc = beta != 0 ? ldc_array[g] : 0;
+        T*          dD  = d_array[g];
+        rocblas_int ldd = ldd_array[g];
+
+        int tiles_m = (M - 1) / BLK_M + 1;
+        int tiles_n = (N - 1) / BLK_N + 1;
+
+        // the loop bounds are uniform across the block, as required by the tile's barriers
+        for(int bly = blockIdx.y; bly < tiles_n; bly += gridDim.y)
+            for(int blx = blockIdx.x; blx < tiles_m; blx += gridDim.x)
+                rocblas_gemm_general_tile<T,
+                                          DIM_M,
+                                          DIM_N,
+                                          BLK_M,
+                                          BLK_N,
+                                          BLK_K,
+                                          BLK_M,
+                                          BLK_K,
+                                          BLK_K,
+                                          BLK_N,
+                                          false,
+                                          TRANS_A,
+                                          TRANS_B>(
+                    M, N, K, alpha, dA, lda, dB, ldb, beta, dC, ldc, dD, ldd, blx, bly);
+    }
+
+    // Number of blocks per group in each of the m and n dimensions of the grouped gemm grid
+    constexpr int ROCBLAS_GEMM_GROUPED_GRID_DIM = 8;
+
+    // Source grouped gemm. All per-group arguments are device arrays of group_count elements,
+    // and alpha and beta are either host values or device pointers. The whole group is computed
+    // with a single kernel launch, without host synchronization. If the operations vary per
+    // group, trans_a_array and trans_b_array are their device arrays, trans_a and trans_b are
+    // ignored, and one launch is made for each of the combinations of operations, which skips
+    // the groups of the other combinations.
+    template <typename T, typename TScal>
+    void rocblas_gemm_source_grouped_solution(rocblas_operation        trans_a,
+                                              rocblas_operation        trans_b,
+                                              rocblas_int              group_count,
+                                              const rocblas_int*       m,
+                                              const rocblas_int*       n,
+                                              const rocblas_int*       k,
+                                              TScal                    alpha,
+                                              const T* const*          dA,
+                                              const rocblas_int*       lda,
+                                              const T* const*          dB,
+                                              const rocblas_int*       ldb,
+                                              TScal                    beta,
+                                              const T* const*          dC,
+                                              const rocblas_int*       ldc,
+                                              T* const*                dD,
+                                              const rocblas_int*       ldd,
+                                              hipStream_t              stream,
+                                              const rocblas_operation* trans_a_array = nullptr,
+                                              const rocblas_operation* trans_b_array = nullptr)
+    {
+        constexpr int blk_m = 32, blk_n = 32, blk_k = 8;
+        dim3          dimBlock(16, 16, 1);
+        dim3          dimGrid(
+            ROCBLAS_GEMM_GROUPED_GRID_DIM, ROCBLAS_GEMM_GROUPED_GRID_DIM, group_count);
+
+#define ROCBLAS_GEMM_SOURCE_GROUPED_LAUNCH(TRANS_A_, TRANS_B_)                                  \
+    hipLaunchKernelGGL(                                                                         \
+        (rocblas_gemm_grouped_general_kernel<T,                                                 \
+                                             16,                                                \
+                                             16,                                                \
+                                             blk_m,                                             \
+                                             blk_n,                                             \
+                                             blk_k,                                             \
+                                             TRANS_A_,                                          \
+                                             TRANS_B_>),                                        \
+        dimGrid,                                                                                \
+        dimBlock,                                                                               \
+        0,                                                                                      \
+        stream,                                                                                 \
+        m,                                                                                      \
+        n,                                                                                      \
+        k,                                                                                      \
+        alpha,                                                                                  \
+        dA,                                                                                     \
+        lda,                                                                                    \
+        dB,                                                                                     \
+        ldb,                                                                                    \
+        beta,                                                                                   \
+        dC,                                                                                     \
+        ldc,                                                                                    \
+        dD,                                                                                     \
+        ldd,                                                                                    \
+        trans_a_array,                                                                          \
+        trans_b_array)
+
+        auto launch = [&](char ta, char tb) {
+            // clang-format off
+            if(ta == 'N' && tb == 'N') ROCBLAS_GEMM_SOURCE_GROUPED_LAUNCH('N', 'N');
+            else if(ta == 'N' && tb == 'T') ROCBLAS_GEMM_SOURCE_GROUPED_LAUNCH('N', 'T');
+            else if(ta == 'N' && tb == 'C') ROCBLAS_GEMM_SOURCE_GROUPED_LAUNCH('N', 'C');
+            else if(ta == 'T' && tb == 'N') ROCBLAS_GEMM_SOURCE_GROUPED_LAUNCH('T', 'N');
+            else if(ta == 'T' && tb == 'T') ROCBLAS_GEMM_SOURCE_GROUPED_LAUNCH('T', 'T');
+            else if(ta == 'T' && tb == 'C') ROCBLAS_GEMM_SOURCE_GROUPED_LAUNCH('T', 'C');
+            else if(ta == 'C' && tb == 'N') ROCBLAS_GEMM_SOURCE_GROUPED_LAUNCH('C', 'N');
+            else if(ta == 'C' && tb == 'T') ROCBLAS_GEMM_SOURCE_GROUPED_LAUNCH('C', 'T');
+            else if(ta == 'C' && tb == 'C') ROCBLAS_GEMM_SOURCE_GROUPED_LAUNCH('C', 'C');
+            // clang-format on
+        };
+
+        if(trans_a_array)
+        {
+            for(char ta : {'N', 'T', 'C'})
+                for(char tb : {'N', 'T', 'C'})
+                    launch(ta, tb);
+        }
+        else
+            launch(rocblas_transpose_letter(trans_a), rocblas_transpose_letter(trans_b));
+
+#undef ROCBLAS_GEMM_SOURCE_GROUPED_LAUNCH
+    }
+
+    // Gemm with a diagonal scaling of op(A) fused into the load of its tiles:
+    // C = alpha * diag(x) * op(A) * op(B) + beta * C if scale_rows, otherwise
+    // C = alpha * op(A) * diag(x) * op(B) + beta * C.
+    template <typename T,
+              int  DIM_M,
+              int  DIM_N,
+              int  BLK_M,
+              int  BLK_N,
+              int  BLK_K,
+              char TRANS_A,
+              char TRANS_B,
+              typename TScal>
+    ROCBLAS_KERNEL(DIM_M* DIM_N)
+    rocblas_gemm_dgmm_general_kernel(rocblas_int M,
+                                     rocblas_int N,
+                                     rocblas_int K,
+                                     TScal       alpha_device_host,
+                                     const T*    dA,
+                                     rocblas_int lda,
+                                     bool        scale_rows,
+                                     const T*    x,
+                                     int64_t     incx,
+                                     const T*    dB,
+                                     rocblas_int ldb,
+                                     TScal       beta_device_host,
+                                     T*          dC,
+                                     rocblas_int ldc)
+    {
+        const T alpha = load_scalar(alpha_device_host);
+        const T beta  = load_scalar(beta_device_host);
+
+        // neither A, B nor x is read if alpha == 0
+        if(alpha == 0)
+            K = 0;
+
+        rocblas_gemm_load_diagonal_scaled<T> load_a{x, incx, scale_rows};
+
+        rocblas_gemm_general_tile<T,
+                                  DIM_M,
+                                  DIM_N,
+                                  BLK_M,
+                                  BLK_N,
+                                  BLK_K,
+                                  BLK_M,
+                                  BLK_K,
+                                  BLK_K,
+                                  BLK_N,
+                                  false,
+                                  TRANS_A,
+                                  TRANS_B>(M,
+                                           N,
+                                           K,
+                                           alpha,
+                                           dA,
+                                           lda,
+                                           dB,
+                                           ldb,
+                                           beta,
+                                           dC,
+                                           ldc,
+                                           dC,
+                                           ldc,
+                                           blockIdx.x,
+                                           blockIdx.y,
+                                           load_a);
+    }
+
+    // Source gemm with a row (side left) or column (side right) diagonal scaling of op(A).
+    // x points to the element of the diagonal with index 0, also for negative incx; alpha and
+    // beta are either host values or device pointers.
+    template <typename T, typename TScal>
+    void rocblas_gemm_source_dgmm_solution(rocblas_operation trans_a,
+                                           rocblas_operation trans_b,
+                                           rocblas_side      side,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           TScal             alpha,
+                                           const T*          dA,
+                                           rocblas_int       lda,
+                                           const T*          x,
+                                           int64_t           incx,
+                                           const T*          dB,
+                                           rocblas_int       ldb,
+                                           TScal             beta,
+                                           T*                dC,
+                                           rocblas_int       ldc,
+                                           hipStream_t       stream)
+    {
+        constexpr int blk_m = 64, blk_n = 64, blk_k = 8;
+        dim3          dimBlock(16, 16, 1);
+        dim3          dimGrid((m - 1) / blk_m + 1, (n - 1) / blk_n + 1, 1);
+        bool          scale_rows = side == rocblas_side_left;
+
+#define ROCBLAS_GEMM_SOURCE_DGMM_LAUNCH(TRANS_A_, TRANS_B_)                                     \
+    hipLaunchKernelGGL(                                                                         \
+        (rocblas_gemm_dgmm_general_kernel<T, 16, 16, blk_m, blk_n, blk_k, TRANS_A_, TRANS_B_>), \
+        dimGrid,                                                                                \
+        dimBlock,                                                                               \
+        0,                                                                                      \
+        stream,                                                                                 \
+        m,                                                                                      \
+        n,                                                                                      \
+        k,                                                                                      \
+        alpha,                                                                                  \
+        dA,                                                                                     \
+        lda,                                                                                    \
+        scale_rows,                                                                             \
+        x,                                                                                      \
+        incx,                                                                                   \
+        dB,                                                                                     \
+        ldb,                                                                                    \
+        beta,                                                                                   \
+        dC,                                                                                     \
+        ldc)
+
+        char ta = rocblas_transpose_letter(trans_a);
+        char tb = rocblas_transpose_letter(trans_b);
+
+        // clang-format off
+        if(ta == 'N' && tb == 'N') ROCBLAS_GEMM_SOURCE_DGMM_LAUNCH('N', 'N');
+        else if(ta == 'N' && tb == 'T') ROCBLAS_GEMM_SOURCE_DGMM_LAUNCH('N', 'T');
+        else if(ta == 'N' && tb == 'C') ROCBLAS_GEMM_SOURCE_DGMM_LAUNCH('N', 'C');
+        else if(ta == 'T' && tb == 'N') ROCBLAS_GEMM_SOURCE_DGMM_LAUNCH('T', 'N');
+        else if(ta == 'T' && tb == 'T') ROCBLAS_GEMM_SOURCE_DGMM_LAUNCH('T', 'T');
+        else if(ta == 'T' && tb == 'C') ROCBLAS_GEMM_SOURCE_DGMM_LAUNCH('T', 'C');
+        else if(ta == 'C' && tb == 'N') ROCBLAS_GEMM_SOURCE_DGMM_LAUNCH('C', 'N');
+        else if(ta == 'C' && tb == 'T') ROCBLAS_GEMM_SOURCE_DGMM_LAUNCH('C', 'T');
+        else if(ta == 'C' && tb == 'C') ROCBLAS_GEMM_SOURCE_DGMM_LAUNCH('C', 'C');
+        // clang-format on
+
+#undef ROCBLAS_GEMM_SOURCE_DGMM_LAUNCH
+    }
 }
@@ -22,6 +22,7 @@
 
 #include "gemm.hpp"
 #include "logging.hpp"
+#include "managed_prefetch.hpp"
 
 namespace
 {
@@ -80,7 +81,7 @@ namespace
             rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
         auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
@@ -184,6 +185,13 @@ namespace
         if(validArgs != rocblas_status_continue)
             return validArgs;
 
+        // clang-format off
+        rocblas_prefetch_managed_gemm(handle, trans_a, trans_b, m, n, k,
+                                      A, sizeof(T), lda, stride_a, B, sizeof(T), ldb, stride_b,
+                                      C, sizeof(T), ldc, stride_c, C, sizeof(T), ldc, stride_c,
+                                      batch_count);
+        // clang-format on
+
         if(check_numerics)
         {
             bool           is_input = true;
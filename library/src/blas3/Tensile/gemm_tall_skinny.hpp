@@ -0,0 +1,311 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * ===========================================================================
+ *    Source gemm kernels for the extreme aspect ratios of tall and skinny
+ *    factorizations, dispatched from rocblas_internal_gemm_template
+ * ===========================================================================
+ */
+
+// The streaming (outer product) shape has a large m and n, k <= 64, as in the update of a tall
+// matrix m x k by a small k x n one: each workgroup computes the DIM_X rows of all of the n
+// columns of C, so that A and C are read and written once and op(B) is reloaded from cache.
+// The reduction (inner product) shape has m, n <= 64 and a large k, as in the Gram matrix of a
+// tall matrix: the k dimension is split into chunks, one workgroup each, whose products are
+// atomically added into C after it has been scaled by beta. It is only used when atomics are
+// allowed.
+
+#pragma once
+
+#include "gemm_source.hpp"
+#include "handle.hpp"
+#include <cstdio>
+#include <cstdlib>
+
+static const rocblas_int rocblas_internal_gemm_tall_skinny_min_size = [] {
+    // m of the streaming shape, or k of the reduction shape, from which gemm uses the tall and
+    // skinny kernels. 0 disables them.
+    constexpr rocblas_int GEMM_TALL_SKINNY_MIN_SIZE = 262144;
+    rocblas_int           min_size;
+    const char*           env = getenv("ROCBLAS_INTERNAL_GEMM_TALL_SKINNY_MIN_SIZE");
+    return env && sscanf(env, "%d", &min_size) == 1 ? min_size : GEMM_TALL_SKINNY_MIN_SIZE;
+}();
+
+namespace
+{
+    // Largest small dimensions of the tall and skinny shapes
+    constexpr rocblas_int ROCBLAS_GEMM_TALL_SKINNY_MAX_DIM = 64;
+
+    // Types of the tall and skinny kernels, which need atomic adds
+    template <typename T>
+    constexpr bool rocblas_gemm_tall_skinny_types
+        = std::is_same<T, float>{} || std::is_same<T, double>{}
+          || std::is_same<T, rocblas_float_complex>{} || std::is_same<T, rocblas_double_complex>{};
+
+    //! @brief True if gemm of size m x n x k uses the streaming kernel
+    inline bool rocblas_gemm_use_tall_skinny_outer(rocblas_int m, rocblas_int n, rocblas_int k)
+    {
+        return rocblas_internal_gemm_tall_skinny_min_size > 0
+               && m >= rocblas_internal_gemm_tall_skinny_min_size
+               && n <= ROCBLAS_GEMM_TALL_SKINNY_MAX_DIM && k >= 1
+               && k <= ROCBLAS_GEMM_TALL_SKINNY_MAX_DIM;
+    }
+
+    //! @brief True if gemm of size m x n x k uses the reduction kernel
+    inline bool rocblas_gemm_use_tall_skinny_inner(rocblas_handle handle,
+                                                   rocblas_int    m,
+                                                   rocblas_int    n,
+                                                   rocblas_int    k,
+                                                   rocblas_int    batch_count)
+    {
+        return rocblas_internal_gemm_tall_skinny_min_size > 0
+               && k >= rocblas_internal_gemm_tall_skinny_min_size
+               && m <= ROCBLAS_GEMM_TALL_SKINNY_MAX_DIM && n <= ROCBLAS_GEMM_TALL_SKINNY_MAX_DIM
+               && handle->atomics_mode == rocblas_atomics_allowed && batch_count <= 65535;
+    }
+
+    // Element (row, col) of op(X)
+    template <typename T>
+    __device__ T rocblas_gemm_tall_skinny_load(
+        rocblas_operation trans, const T* X, rocblas_int ldx, rocblas_int row, rocblas_int col)
+    {
+        if(trans == rocblas_operation_none)
+            return X[row + col * size_t(ldx)];
+        T x = X[col + row * size_t(ldx)];
+        return trans == rocblas_operation_conjugate_transpose ? conj(x) : x;
+    }
+
+    template <typename T>
+    __device__ void rocblas_gemm_tall_skinny_atomic_add(T* c, T val)
+    {
+        atomicAdd(c, val);
+    }
+
+    template <typename T>
+    __device__ void rocblas_gemm_tall_skinny_atomic_add(rocblas_complex_num<T>* c,
+                                                        rocblas_complex_num<T>  val)
+    {
+        atomicAdd((T*)c, val.real());
+        atomicAdd((T*)c + 1, val.imag());
+    }
+
+    // C = alpha * op(A) * op(B) + beta * C over the rows DIM_X * blockIdx.x of C for the
+    // streaming shape, or C += alpha * op(A) * op(B) over the chunk blockIdx.x of k, atomically,
+    // for the reduction shape (REDUCTION). Thread (tx, ty) computes the columns ty + DIM_Y * t of
+    // row tx of the tile.
+    template <int  DIM_X,
+              int  DIM_Y,
+              int  BLK_K,
+              bool REDUCTION,
+              typename T,
+              typename TConstPtr,
+              typename TPtr>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_gemm_tall_skinny_kernel(rocblas_int       m,
+                                    rocblas_int       n,
+                                    rocblas_int       k,
+                                    rocblas_int       k_chunk,
+                                    T                 alpha,
+                                    rocblas_operation trans_a,
+                                    TConstPtr         dA,
+                                    rocblas_stride    offset_a,
+                                    rocblas_int       lda,
+                                    rocblas_stride    stride_a,
+                                    rocblas_operation trans_b,
+                                    TConstPtr         dB,
+                                    rocblas_stride    offset_b,
+                                    rocblas_int       ldb,
+                                    rocblas_stride    stride_b,
+                                    T                 beta,
+                                    TPtr              dC,
+                                    rocblas_stride    offset_c,
+                                    rocblas_int       ldc,
+                                    rocblas_stride    stride_c)
+    {
+        static_assert(DIM_X == ROCBLAS_GEMM_TALL_SKINNY_MAX_DIM, "a tile has all the rows of C");
+        static constexpr int MAX_N   = ROCBLAS_GEMM_TALL_SKINNY_MAX_DIM;
+        static constexpr int THREADS = DIM_X * DIM_Y;
+
+        __shared__ T sA[BLK_K][DIM_X]; // op(A)(row0 + i, l0 + l) at sA[l][i]
+        __shared__ T sB[MAX_N][BLK_K]; // op(B)(l0 + l, j) at sB[j][l]
+        T            rC[MAX_N / DIM_Y];
+
+        const auto* A = load_ptr_batch(dA, blockIdx.z, offset_a, stride_a);
+        const auto* B = load_ptr_batch(dB, blockIdx.z, offset_b, stride_b);
+        auto*       C = load_ptr_batch(dC, blockIdx.z, offset_c, stride_c);
+
+        const rocblas_int tx      = threadIdx.x;
+        const rocblas_int ty      = threadIdx.y;
+        const rocblas_int tid     = ty * DIM_X + tx;
+        const rocblas_int row0    = REDUCTION ? 0 : blockIdx.x * DIM_X;
+        const rocblas_int k_begin = REDUCTION ? blockIdx.x * k_chunk : 0;
+        const rocblas_int k_end   = REDUCTION && k - k_begin > k_chunk ? k_begin + k_chunk : k;
+
+        for(int t = 0; t < MAX_N / DIM_Y; t++)
+            rC[t] = T(0);
+
+        for(rocblas_int l0 = k_begin; l0 < k_end; l0 += BLK_K)
+        {
+            // consecutive threads load consecutive elements of A in memory
+            for(int t = tid; t < DIM_X * BLK_K; t += THREADS)
+            {
+                int i = trans_a == rocblas_operation_none ? t % DIM_X : t / BLK_K;
+                int l = trans_a == rocblas_operation_none ? t / DIM_X : t % BLK_K;
+
+                sA[l][i] = row0 + i < m && l0 + l < k_end
+                               ? rocblas_gemm_tall_skinny_load(trans_a, A, lda, row0 + i, l0 + l)
+                               : T(0);
+            }
+
+            for(int t = tid; t < BLK_K * MAX_N; t += THREADS)
+            {
+                int l = trans_b == rocblas_operation_none ? t % BLK_K : t / MAX_N;
+                int j = trans_b == rocblas_operation_none ? t / BLK_K : t % MAX_N;
+
+                sB[j][l] = j < n && l0 + l < k_end
+                               ? rocblas_gemm_tall_skinny_load(trans_b, B, ldb, l0 + l, j)
+                               : T(0);
+            }
+
+            __syncthreads();
+
+            for(int l = 0; l < BLK_K; l++)
+            {
+                T a = sA[l][tx];
+                for(int t = 0; t < MAX_N / DIM_Y; t++)
+                    rC[t] += a * sB[ty + t * DIM_Y][l];
+            }
+
+            __syncthreads();
+        }
+
+        const rocblas_int row = row0 + tx;
+        if(row >= m)
+            return;
+
+        for(int t = 0; t < MAX_N / DIM_Y; t++)
+        {
+            const rocblas_int col = ty + t * DIM_Y;
+            if(col < n)
+            {
+                T* c = C + row + col * size_t(ldc);
+                if(REDUCTION)
+                    rocblas_gemm_tall_skinny_atomic_add(c, alpha * rC[t]);
+                else
+                    *c = beta == T(0) ? alpha * rC[t] : alpha * rC[t] + beta * *c;
+            }
+        }
+    }
+
+    //! @brief Launches the streaming or the reduction kernel of
+    //!        C = alpha * op(A) * op(B) + beta * C for the shapes of
+    //!        rocblas_gemm_use_tall_skinny_outer and rocblas_gemm_use_tall_skinny_inner, with
+    //!        alpha and beta on the host.
+    template <typename T, typename TConstPtr, typename TPtr>
+    rocblas_status rocblas_gemm_tall_skinny_solution(rocblas_handle    handle,
+                                                     rocblas_operation trans_a,
+                                                     rocblas_operation trans_b,
+                                                     rocblas_int       m,
+                                                     rocblas_int       n,
+                                                     rocblas_int       k,
+                                                     T                 alpha,
+                                                     TConstPtr         A,
+                                                     rocblas_stride    offset_a,
+                                                     rocblas_int       lda,
+                                                     rocblas_stride    stride_a,
+                                                     TConstPtr         B,
+                                                     rocblas_stride    offset_b,
+                                                     rocblas_int       ldb,
+                                                     rocblas_stride    stride_b,
+                                                     T                 beta,
+                                                     TPtr              C,
+                                                     rocblas_stride    offset_c,
+                                                     rocblas_int       ldc,
+                                                     rocblas_stride    stride_c,
+                                                     rocblas_int       batch_count)
+    {
+        static constexpr int TALL_SKINNY_DIM_X = ROCBLAS_GEMM_TALL_SKINNY_MAX_DIM;
+        static constexpr int TALL_SKINNY_DIM_Y = 4;
+        static constexpr int TALL_SKINNY_BLK_K = 16;
+
+        hipStream_t stream = handle->get_stream();
+        dim3        threads(TALL_SKINNY_DIM_X, TALL_SKINNY_DIM_Y);
+
+#define ROCBLAS_GEMM_TALL_SKINNY_LAUNCH(REDUCTION_, grid_, k_chunk_)                       \
+    hipLaunchKernelGGL((rocblas_gemm_tall_skinny_kernel<TALL_SKINNY_DIM_X,                 \
+                                                        TALL_SKINNY_DIM_Y,                 \
+                                                        TALL_SKINNY_BLK_K,                 \
+                                                        REDUCTION_>),                      \
+                       grid_,                                                              \
+                       threads,                                                            \
+                       0,                                                                  \
+                       stream,                                                             \
+                       m,                                                                  \
+                       n,                                                                  \
+                       k,                                                                  \
+                       k_chunk_,                                                           \
+                       alpha,                                                              \
+                       trans_a,                                                            \
+                       A,                                                                  \
+                       offset_a,                                                           \
+                       lda,                                                                \
+                       stride_a,                                                           \
+                       trans_b,                                                            \
+                       B,                                                                  \
+                       offset_b,                                                           \
+                       ldb,                                                                \
+                       stride_b,                                                           \
+                       beta,                                                               \
+                       C,                                                                  \
+                       offset_c,                                                           \
+                       ldc,                                                                \
+                       stride_c)
+
+        if(rocblas_gemm_use_tall_skinny_outer(m, n, k))
+        {
+            dim3 grid((m - 1) / TALL_SKINNY_DIM_X + 1, 1, batch_count);
+            ROCBLAS_GEMM_TALL_SKINNY_LAUNCH(false, grid, k);
+        }
+        else
+        {
+            // about 4 workgroups per compute unit, each with a chunk of at least 1024
+            static constexpr rocblas_int MIN_CHUNK = 1024;
+            int64_t chunks = std::max(int64_t(1), 4 * int64_t(handle->getCUCount()) / batch_count);
+            int64_t k_chunk = std::max(int64_t(MIN_CHUNK), (k - 1) / chunks + 1);
+
+            // whole BLK_K steps
+            k_chunk = ((k_chunk - 1) / TALL_SKINNY_BLK_K + 1) * TALL_SKINNY_BLK_K;
+
+            if(beta != T(1))
+                RETURN_IF_ROCBLAS_ERROR(rocblas_gemm_scale_template(
+                    m, n, beta, C, offset_c, ldc, stride_c, batch_count, stream));
+
+            dim3 grid((k - 1) / k_chunk + 1, 1, batch_count);
+            ROCBLAS_GEMM_TALL_SKINNY_LAUNCH(true, grid, rocblas_int(k_chunk));
+        }
+
+#undef ROCBLAS_GEMM_TALL_SKINNY_LAUNCH
+
+        return rocblas_status_success;
+    }
+}
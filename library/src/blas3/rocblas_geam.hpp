@@ -123,3 +123,62 @@ rocblas_status rocblas_geam_check_numerics(const char*       function_name,
                                            rocblas_int       batch_count,
                                            const int         check_numerics,
                                            bool              is_input);
+
+/**
+ * B := alpha * op(A), with the m x n matrix B and the element types of A and B possibly
+ * different: the kernels of geam with a single contributing matrix, the transpose staged
+ * through LDS tiles, compute in the type of alpha and convert the results to the type of B.
+ * TScal     is either: const Tex* (either host or device) OR Tex, a host value
+ * TConstPtr is either: const Ta* OR const Ta* const*
+ * TPtr      is either:       Tb* OR       Tb* const*
+ */
+template <typename TScal, typename TConstPtr, typename TPtr>
+rocblas_status rocblas_internal_matcopy_template(rocblas_handle    handle,
+                                                 rocblas_operation trans,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 TScal             alpha,
+                                                 TConstPtr         A,
+                                                 rocblas_stride    offset_a,
+                                                 rocblas_int       lda,
+                                                 rocblas_stride    stride_a,
+                                                 TPtr              B,
+                                                 rocblas_stride    offset_b,
+                                                 rocblas_int       ldb,
+                                                 rocblas_stride    stride_b,
+                                                 rocblas_int       batch_count);
+
+//! @brief Workspace of rocblas_internal_imatcopy_template, 0 when the matrices are transformed
+//!        in place without it.
+template <typename T>
+size_t rocblas_imatcopy_workspace_size(rocblas_operation trans,
+                                       rocblas_int       m,
+                                       rocblas_int       n,
+                                       rocblas_int       lda,
+                                       rocblas_int       ldb,
+                                       rocblas_int       batch_count)
+{
+    if(!m || !n || (trans == rocblas_operation_none ? lda == ldb : m == n && lda == ldb))
+        return 0;
+    return sizeof(T) * m * n * batch_count;
+}
+
+/**
+ * A := alpha * op(A) in place, the m x n matrix A with leading dimension lda becoming op(A)
+ * with leading dimension ldb. Square transposes swap pairs of LDS tiles, and scalings keeping
+ * the leading dimension are element-wise; the other cases go through the workspace.
+ * TPtr is either: T* OR T* const*
+ */
+template <typename T, typename TPtr>
+rocblas_status rocblas_internal_imatcopy_template(rocblas_handle    handle,
+                                                  rocblas_operation trans,
+                                                  rocblas_int       m,
+                                                  rocblas_int       n,
+                                                  const T*          alpha,
+                                                  TPtr              A,
+                                                  rocblas_stride    offset_a,
+                                                  rocblas_int       lda,
+                                                  rocblas_int       ldb,
+                                                  rocblas_stride    stride_a,
+                                                  rocblas_int       batch_count,
+                                                  T*                workspace);
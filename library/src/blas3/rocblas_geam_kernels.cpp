@@ -134,12 +134,16 @@ rocblas_geam_2matrix_device(rocblas_operation transA,
     {
         auto alpha = load_scalar(alpha_device_host);
 
+        // alpha is of the element type of C for geam, and of the compute type for omatcopy_ex
+        using Tex = decltype(alpha);
+        using Tc  = std::decay_t<decltype(*load_ptr_batch(Ca, 0, 0, 0))>;
+
         auto* C = load_ptr_batch(Ca, blockIdx.z, offset_c, stride_c);
 
         size_t c_index = tx + size_t(ldc) * ty;
         if(alpha == 0)
         {
-            C[c_index] = 0;
+            C[c_index] = Tc(Tex(0));
         }
         else
         {
@@ -156,14 +160,75 @@ rocblas_geam_2matrix_device(rocblas_operation transA,
                 a_index = tx * size_t(lda) + ty;
             }
 
-            auto a_val = A[a_index];
+            auto a_val = Tex(A[a_index]);
             if(transA == rocblas_operation_conjugate_transpose)
                 a_val = conj(a_val);
-            C[c_index] = alpha * a_val;
+            C[c_index] = Tc(alpha * a_val);
         }
     }
 }
 
+//  special case:
+//  only one matrix contributes because   0 == alpha || 0 == beta, and it is transposed
+//  C is computed in DIM_X x DIM_X tiles. A tile of A is read along its columns into LDS,
+//  padded by one column to avoid bank conflicts, and C is written along its columns from the
+//  transposed tile, so that both the reads and the writes are coalesced. Each thread handles
+//  DIM_X / DIM_Y elements. The tile is kept in the type of alpha, which is the compute type of
+//  the conversions of omatcopy_ex.
+template <int DIM_X, int DIM_Y, typename TScal, typename TConstPtr, typename TPtr>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_geam_2matrix_transpose_device(rocblas_operation transA,
+                                      rocblas_int       m,
+                                      rocblas_int       n,
+                                      TScal             alpha_device_host,
+                                      TConstPtr         Aa,
+                                      rocblas_stride    offset_a,
+                                      rocblas_int       lda,
+                                      rocblas_stride    stride_a,
+                                      TPtr              Ca,
+                                      rocblas_stride    offset_c,
+                                      rocblas_int       ldc,
+                                      rocblas_stride    stride_c)
+{
+    static_assert(DIM_X % DIM_Y == 0, "DIM_Y must divide the tile size");
+
+    auto alpha = load_scalar(alpha_device_host);
+
+    using Tex = decltype(alpha);
+    using Tc  = std::decay_t<decltype(*load_ptr_batch(Ca, 0, 0, 0))>;
+    __shared__ Tex sA[DIM_X][DIM_X + 1];
+
+    auto* A = load_ptr_batch(Aa, blockIdx.z, offset_a, stride_a);
+    auto* C = load_ptr_batch(Ca, blockIdx.z, offset_c, stride_c);
+
+    rocblas_int row0 = blockIdx.x * DIM_X;
+    rocblas_int col0 = blockIdx.y * DIM_X;
+
+    // C(i, j) = alpha * A(j, i): sA[r][c] is element (r, c) of the tile of C, read along the
+    // columns of A
+    for(rocblas_int r = threadIdx.y; r < DIM_X; r += DIM_Y)
+    {
+        rocblas_int a_row = col0 + threadIdx.x;
+        rocblas_int a_col = row0 + r;
+        if(a_row < n && a_col < m)
+            sA[r][threadIdx.x] = Tex(A[a_row + size_t(lda) * a_col]);
+    }
+
+    __syncthreads();
+
+    rocblas_int row = row0 + threadIdx.x;
+    if(row >= m)
+        return;
+
+    for(rocblas_int c = threadIdx.y; c < DIM_X && col0 + c < n; c += DIM_Y)
+    {
+        auto a_val = sA[threadIdx.x][c];
+        if(transA == rocblas_operation_conjugate_transpose)
+            a_val = conj(a_val);
+        C[row + size_t(ldc) * (col0 + c)] = Tc(alpha * a_val);
+    }
+}
+
 // special cases where: lda=ldb=ldc=m && transA==transB=none so matrices
 // are contiguous, there are no transposes, and therefore matrices
 // can be treated as contiguous vectors
@@ -506,10 +571,41 @@ rocblas_status rocblas_geam_template(rocblas_handle    handle,
                                offset_c,
                                stride_c);
         }
+        else if(transA != rocblas_operation_none)
+        {
+            // beta == 0
+            // transpose of A, for any lda, ldc
+            static constexpr int GEAM_DIM_X = 32;
+            static constexpr int GEAM_DIM_Y = 8;
+
+            rocblas_int blocksX = (m - 1) / GEAM_DIM_X + 1;
+            rocblas_int blocksY = (n - 1) / GEAM_DIM_X + 1;
+
+            dim3 geam_grid(blocksX, blocksY, batch_count);
+            dim3 geam_threads(GEAM_DIM_X, GEAM_DIM_Y);
+
+            hipLaunchKernelGGL((rocblas_geam_2matrix_transpose_device<GEAM_DIM_X, GEAM_DIM_Y>),
+                               geam_grid,
+                               geam_threads,
+                               0,
+                               rocblas_stream,
+                               transA,
+                               m,
+                               n,
+                               *alpha,
+                               A,
+                               offset_a,
+                               lda,
+                               stride_a,
+                               C,
+                               offset_c,
+                               ldc,
+                               stride_c);
+        }
         else
         {
             // beta == 0
-            // general case for any transA, lda, ldc
+            // general case for any lda, ldc
             static constexpr int GEAM_DIM_X = 16;
             static constexpr int GEAM_DIM_Y = 16;
             rocblas_int          blocksX    = (m - 1) / GEAM_DIM_X + 1;
@@ -565,10 +661,41 @@ rocblas_status rocblas_geam_template(rocblas_handle    handle,
                                offset_c,
                                stride_c);
         }
+        else if(transB != rocblas_operation_none)
+        {
+            // alpha == 0
+            // transpose of B, for any ldb, ldc
+            static constexpr int GEAM_DIM_X = 32;
+            static constexpr int GEAM_DIM_Y = 8;
+
+            rocblas_int blocksX = (m - 1) / GEAM_DIM_X + 1;
+            rocblas_int blocksY = (n - 1) / GEAM_DIM_X + 1;
+
+            dim3 geam_grid(blocksX, blocksY, batch_count);
+            dim3 geam_threads(GEAM_DIM_X, GEAM_DIM_Y);
+
+            hipLaunchKernelGGL((rocblas_geam_2matrix_transpose_device<GEAM_DIM_X, GEAM_DIM_Y>),
+                               geam_grid,
+                               geam_threads,
+                               0,
+                               rocblas_stream,
+                               transB,
+                               m,
+                               n,
+                               *beta,
+                               B,
+                               offset_b,
+                               ldb,
+                               stride_b,
+                               C,
+                               offset_c,
+                               ldc,
+                               stride_c);
+        }
         else
         {
             // alpha == 0
-            // general case for any transB, ldb, ldc
+            // general case for any ldb, ldc
             static constexpr int GEAM_DIM_X = 16;
             static constexpr int GEAM_DIM_Y = 16;
 
@@ -720,6 +847,279 @@ rocblas_status rocblas_geam_template(rocblas_handle    handle,
     return rocblas_status_success;
 }
 
+//  In-place transpose of square n x n matrices, A := alpha * op(A). The block of the tile pair
+//  (blockIdx.x, blockIdx.y), blockIdx.x <= blockIdx.y, reads both tiles into LDS and writes each
+//  transposed in place of the other, so that every element is read and written once.
+template <int DIM_X, int DIM_Y, typename TScal, typename TPtr>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_imatcopy_square_device(rocblas_operation trans,
+                               rocblas_int       n,
+                               TScal             alpha_device_host,
+                               TPtr              Aa,
+                               rocblas_stride    offset_a,
+                               rocblas_int       lda,
+                               rocblas_stride    stride_a)
+{
+    static_assert(DIM_X % DIM_Y == 0, "DIM_Y must divide the tile size");
+
+    if(blockIdx.x > blockIdx.y)
+        return;
+
+    auto alpha = load_scalar(alpha_device_host);
+
+    using T = decltype(alpha);
+    __shared__ T sU[DIM_X][DIM_X + 1];
+    __shared__ T sL[DIM_X][DIM_X + 1];
+
+    auto* A = load_ptr_batch(Aa, blockIdx.z, offset_a, stride_a);
+
+    // The tile U has its rows from r0 and its columns from c0, the tile L the converse
+    rocblas_int r0 = blockIdx.x * DIM_X;
+    rocblas_int c0 = blockIdx.y * DIM_X;
+    rocblas_int i  = threadIdx.x;
+
+    for(rocblas_int j = threadIdx.y; j < DIM_X; j += DIM_Y)
+    {
+        if(r0 + i < n && c0 + j < n)
+            sU[j][i] = A[(r0 + i) + size_t(lda) * (c0 + j)];
+        if(c0 + i < n && r0 + j < n)
+            sL[j][i] = A[(c0 + i) + size_t(lda) * (r0 + j)];
+    }
+
+    __syncthreads();
+
+    // A(r0 + i, c0 + j) := alpha * A(c0 + j, r0 + i)
+    // A(c0 + i, r0 + j) := alpha * A(r0 + j, c0 + i)
+    for(rocblas_int j = threadIdx.y; j < DIM_X; j += DIM_Y)
+    {
+        if(r0 + i < n && c0 + j < n)
+        {
+            auto a_val = sL[i][j];
+            if(trans == rocblas_operation_conjugate_transpose)
+                a_val = conj(a_val);
+            A[(r0 + i) + size_t(lda) * (c0 + j)] = alpha * a_val;
+        }
+        if(c0 + i < n && r0 + j < n)
+        {
+            auto a_val = sU[i][j];
+            if(trans == rocblas_operation_conjugate_transpose)
+                a_val = conj(a_val);
+            A[(c0 + i) + size_t(lda) * (r0 + j)] = alpha * a_val;
+        }
+    }
+}
+
+template <typename TScal, typename TConstPtr, typename TPtr>
+rocblas_status rocblas_internal_matcopy_template(rocblas_handle    handle,
+                                                 rocblas_operation trans,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 TScal             alpha,
+                                                 TConstPtr         A,
+                                                 rocblas_stride    offset_a,
+                                                 rocblas_int       lda,
+                                                 rocblas_stride    stride_a,
+                                                 TPtr              B,
+                                                 rocblas_stride    offset_b,
+                                                 rocblas_int       ldb,
+                                                 rocblas_stride    stride_b,
+                                                 rocblas_int       batch_count)
+{
+    if(!m || !n || !batch_count)
+        return rocblas_status_success;
+
+    hipStream_t rocblas_stream = handle->get_stream();
+
+    auto launch = [&](auto alpha_device_host) {
+        if(trans != rocblas_operation_none)
+        {
+            static constexpr int GEAM_DIM_X = 32;
+            static constexpr int GEAM_DIM_Y = 8;
+
+            rocblas_int blocksX = (m - 1) / GEAM_DIM_X + 1;
+            rocblas_int blocksY = (n - 1) / GEAM_DIM_X + 1;
+
+            dim3 geam_grid(blocksX, blocksY, batch_count);
+            dim3 geam_threads(GEAM_DIM_X, GEAM_DIM_Y);
+
+            hipLaunchKernelGGL((rocblas_geam_2matrix_transpose_device<GEAM_DIM_X, GEAM_DIM_Y>),
+                               geam_grid,
+                               geam_threads,
+                               0,
+                               rocblas_stream,
+                               trans,
+                               m,
+                               n,
+                               alpha_device_host,
+                               A,
+                               offset_a,
+                               lda,
+                               stride_a,
+                               B,
+                               offset_b,
+                               ldb,
+                               stride_b);
+        }
+        else
+        {
+            static constexpr int GEAM_DIM_X = 16;
+            static constexpr int GEAM_DIM_Y = 16;
+
+            rocblas_int blocksX = (m - 1) / GEAM_DIM_X + 1;
+            rocblas_int blocksY = (n - 1) / GEAM_DIM_Y + 1;
+
+            dim3 geam_grid(blocksX, blocksY, batch_count);
+            dim3 geam_threads(GEAM_DIM_X, GEAM_DIM_Y);
+
+            hipLaunchKernelGGL((rocblas_geam_2matrix_device<GEAM_DIM_X, GEAM_DIM_Y>),
+                               geam_grid,
+                               geam_threads,
+                               0,
+                               rocblas_stream,
+                               trans,
+                               m,
+                               n,
+                               alpha_device_host,
+                               A,
+                               offset_a,
+                               lda,
+                               stride_a,
+                               B,
+                               offset_b,
+                               ldb,
+                               stride_b);
+        }
+    };
+
+    if constexpr(std::is_pointer<TScal>{})
+    {
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+            launch(*alpha);
+        else
+            launch(alpha);
+    }
+    else
+        launch(alpha);
+
+    return rocblas_status_success;
+}
+
+template <typename T, typename TPtr>
+rocblas_status rocblas_internal_imatcopy_template(rocblas_handle    handle,
+                                                  rocblas_operation trans,
+                                                  rocblas_int       m,
+                                                  rocblas_int       n,
+                                                  const T*          alpha,
+                                                  TPtr              A,
+                                                  rocblas_stride    offset_a,
+                                                  rocblas_int       lda,
+                                                  rocblas_int       ldb,
+                                                  rocblas_stride    stride_a,
+                                                  rocblas_int       batch_count,
+                                                  T*                workspace)
+{
+    if(!m || !n || !batch_count)
+        return rocblas_status_success;
+
+    // The rows and columns of op(A)
+    rocblas_int rows = trans == rocblas_operation_none ? m : n;
+    rocblas_int cols = trans == rocblas_operation_none ? n : m;
+
+    if(trans == rocblas_operation_none && lda == ldb)
+    {
+        // Each element is read and written by the same thread
+        if(handle->pointer_mode == rocblas_pointer_mode_host && *alpha == T(1))
+            return rocblas_status_success;
+
+        return rocblas_internal_matcopy_template(handle,
+                                                 trans,
+                                                 m,
+                                                 n,
+                                                 alpha,
+                                                 A,
+                                                 offset_a,
+                                                 lda,
+                                                 stride_a,
+                                                 A,
+                                                 offset_a,
+                                                 lda,
+                                                 stride_a,
+                                                 batch_count);
+    }
+
+    if(m == n && lda == ldb)
+    {
+        static constexpr int GEAM_DIM_X = 32;
+        static constexpr int GEAM_DIM_Y = 8;
+
+        rocblas_int blocks = (n - 1) / GEAM_DIM_X + 1;
+
+        dim3 geam_grid(blocks, blocks, batch_count);
+        dim3 geam_threads(GEAM_DIM_X, GEAM_DIM_Y);
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+            hipLaunchKernelGGL((rocblas_imatcopy_square_device<GEAM_DIM_X, GEAM_DIM_Y>),
+                               geam_grid,
+                               geam_threads,
+                               0,
+                               handle->get_stream(),
+                               trans,
+                               n,
+                               *alpha,
+                               A,
+                               offset_a,
+                               lda,
+                               stride_a);
+        else
+            hipLaunchKernelGGL((rocblas_imatcopy_square_device<GEAM_DIM_X, GEAM_DIM_Y>),
+                               geam_grid,
+                               geam_threads,
+                               0,
+                               handle->get_stream(),
+                               trans,
+                               n,
+                               alpha,
+                               A,
+                               offset_a,
+                               lda,
+                               stride_a);
+        return rocblas_status_success;
+    }
+
+    // op(A) is written to the workspace, packed with the leading dimension rows, and copied back
+    // with the leading dimension ldb
+    rocblas_stride stride_w = rocblas_stride(rows) * cols;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_internal_matcopy_template(handle,
+                                                              trans,
+                                                              rows,
+                                                              cols,
+                                                              alpha,
+                                                              A,
+                                                              offset_a,
+                                                              lda,
+                                                              stride_a,
+                                                              workspace,
+                                                              0,
+                                                              rows,
+                                                              stride_w,
+                                                              batch_count));
+
+    return rocblas_internal_matcopy_template(handle,
+                                             rocblas_operation_none,
+                                             rows,
+                                             cols,
+                                             T(1),
+                                             (const T*)workspace,
+                                             0,
+                                             rows,
+                                             stride_w,
+                                             A,
+                                             offset_a,
+                                             ldb,
+                                             stride_a,
+                                             batch_count);
+}
+
 template <typename TConstPtr, typename TPtr>
 rocblas_status rocblas_geam_check_numerics(const char*       function_name,
                                            rocblas_handle    handle,
@@ -883,4 +1283,88 @@ INSTANTIATE_GEAM_NUMERICS(rocblas_float_complex const* const*,  rocblas_float_co
 INSTANTIATE_GEAM_NUMERICS(rocblas_double_complex const* const*, rocblas_double_complex* const*)
 
 #undef INSTANTIATE_GEAM_NUMERICS
+
+#ifdef INSTANTIATE_MATCOPY_TEMPLATE
+#error INSTANTIATE_MATCOPY_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_MATCOPY_TEMPLATE(TScal_, TConstPtr_, TPtr_)                      \
+template rocblas_status rocblas_internal_matcopy_template<TScal_, TConstPtr_, TPtr_>  \
+                                    (rocblas_handle    handle,                       \
+                                     rocblas_operation trans,                        \
+                                     rocblas_int       m,                            \
+                                     rocblas_int       n,                            \
+                                     TScal_            alpha,                        \
+                                     TConstPtr_        A,                            \
+                                     rocblas_stride    offset_a,                     \
+                                     rocblas_int       lda,                          \
+                                     rocblas_stride    stride_a,                     \
+                                     TPtr_             B,                            \
+                                     rocblas_stride    offset_b,                     \
+                                     rocblas_int       ldb,                          \
+                                     rocblas_stride    stride_b,                     \
+                                     rocblas_int       batch_count);
+
+// instantiate for rocblas_omatcopy_ex and rocblas_omatcopy_strided_batched_ex
+INSTANTIATE_MATCOPY_TEMPLATE(float const*, float const*, float*)
+INSTANTIATE_MATCOPY_TEMPLATE(double const*, double const*, double*)
+INSTANTIATE_MATCOPY_TEMPLATE(rocblas_float_complex const*, rocblas_float_complex const*, rocblas_float_complex*)
+INSTANTIATE_MATCOPY_TEMPLATE(rocblas_double_complex const*, rocblas_double_complex const*, rocblas_double_complex*)
+INSTANTIATE_MATCOPY_TEMPLATE(float const*, rocblas_half const*, rocblas_half*)
+INSTANTIATE_MATCOPY_TEMPLATE(float const*, rocblas_bfloat16 const*, rocblas_bfloat16*)
+INSTANTIATE_MATCOPY_TEMPLATE(float const*, float const*, rocblas_half*)
+INSTANTIATE_MATCOPY_TEMPLATE(float const*, rocblas_half const*, float*)
+INSTANTIATE_MATCOPY_TEMPLATE(float const*, float const*, rocblas_bfloat16*)
+INSTANTIATE_MATCOPY_TEMPLATE(float const*, rocblas_bfloat16 const*, float*)
+INSTANTIATE_MATCOPY_TEMPLATE(double const*, double const*, float*)
+INSTANTIATE_MATCOPY_TEMPLATE(double const*, float const*, double*)
+
+// instantiate for rocblas_omatcopy_batched_ex
+INSTANTIATE_MATCOPY_TEMPLATE(float const*, float const* const*, float* const*)
+INSTANTIATE_MATCOPY_TEMPLATE(double const*, double const* const*, double* const*)
+INSTANTIATE_MATCOPY_TEMPLATE(rocblas_float_complex const*, rocblas_float_complex const* const*, rocblas_float_complex* const*)
+INSTANTIATE_MATCOPY_TEMPLATE(rocblas_double_complex const*, rocblas_double_complex const* const*, rocblas_double_complex* const*)
+INSTANTIATE_MATCOPY_TEMPLATE(float const*, rocblas_half const* const*, rocblas_half* const*)
+INSTANTIATE_MATCOPY_TEMPLATE(float const*, rocblas_bfloat16 const* const*, rocblas_bfloat16* const*)
+INSTANTIATE_MATCOPY_TEMPLATE(float const*, float const* const*, rocblas_half* const*)
+INSTANTIATE_MATCOPY_TEMPLATE(float const*, rocblas_half const* const*, float* const*)
+INSTANTIATE_MATCOPY_TEMPLATE(float const*, float const* const*, rocblas_bfloat16* const*)
+INSTANTIATE_MATCOPY_TEMPLATE(float const*, rocblas_bfloat16 const* const*, float* const*)
+INSTANTIATE_MATCOPY_TEMPLATE(double const*, double const* const*, float* const*)
+INSTANTIATE_MATCOPY_TEMPLATE(double const*, float const* const*, double* const*)
+
+#undef INSTANTIATE_MATCOPY_TEMPLATE
+
+#ifdef INSTANTIATE_IMATCOPY_TEMPLATE
+#error INSTANTIATE_IMATCOPY_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_IMATCOPY_TEMPLATE(T_, TPtr_)                            \
+template rocblas_status rocblas_internal_imatcopy_template<T_, TPtr_>       \
+                                    (rocblas_handle    handle,             \
+                                     rocblas_operation trans,              \
+                                     rocblas_int       m,                  \
+                                     rocblas_int       n,                  \
+                                     const T_*         alpha,              \
+                                     TPtr_             A,                  \
+                                     rocblas_stride    offset_a,           \
+                                     rocblas_int       lda,                \
+                                     rocblas_int       ldb,                \
+                                     rocblas_stride    stride_a,           \
+                                     rocblas_int       batch_count,        \
+                                     T_*               workspace);
+
+// instantiate for rocblas_Ximatcopy and rocblas_Ximatcopy_strided_batched
+INSTANTIATE_IMATCOPY_TEMPLATE(float, float*)
+INSTANTIATE_IMATCOPY_TEMPLATE(double, double*)
+INSTANTIATE_IMATCOPY_TEMPLATE(rocblas_float_complex, rocblas_float_complex*)
+INSTANTIATE_IMATCOPY_TEMPLATE(rocblas_double_complex, rocblas_double_complex*)
+
+// instantiate for rocblas_Ximatcopy_batched
+INSTANTIATE_IMATCOPY_TEMPLATE(float, float* const*)
+INSTANTIATE_IMATCOPY_TEMPLATE(double, double* const*)
+INSTANTIATE_IMATCOPY_TEMPLATE(rocblas_float_complex, rocblas_float_complex* const*)
+INSTANTIATE_IMATCOPY_TEMPLATE(rocblas_double_complex, rocblas_double_complex* const*)
+
+#undef INSTANTIATE_IMATCOPY_TEMPLATE
 // clang-format on
@@ -0,0 +1,397 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "check_numerics_matrix.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+#include <algorithm>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    geam_multi: C := alpha_0 * op(A_0) + ... + alpha_{k-1} * op(A_{k-1}),
+ *    the linear combination of k matrices with independent transposes.
+ *    Up to ROCBLAS_GEAM_MULTI_MAX_COUNT operands are summed in one pass:
+ *    each thread block computes a tile of C in registers, reading the tiles
+ *    of the untransposed operands directly and the tiles of the transposed
+ *    operands through LDS, so that both are read with coalesced loads. Each
+ *    input is read once and C is written once.
+ * ===========================================================================
+ */
+
+namespace
+{
+    constexpr rocblas_int ROCBLAS_GEAM_MULTI_DIM_X     = 32;
+    constexpr rocblas_int ROCBLAS_GEAM_MULTI_DIM_Y     = 8;
+    constexpr rocblas_int ROCBLAS_GEAM_MULTI_MAX_COUNT = 8;
+
+    template <typename T>
+    constexpr char rocblas_geam_multi_name[] = "unknown";
+    template <>
+    constexpr char rocblas_geam_multi_name<float>[] = "rocblas_sgeam_multi";
+    template <>
+    constexpr char rocblas_geam_multi_name<double>[] = "rocblas_dgeam_multi";
+    template <>
+    constexpr char rocblas_geam_multi_name<rocblas_float_complex>[] = "rocblas_cgeam_multi";
+    template <>
+    constexpr char rocblas_geam_multi_name<rocblas_double_complex>[] = "rocblas_zgeam_multi";
+
+    // Operands of one pass, passed by value
+    template <typename T>
+    struct rocblas_geam_multi_operands
+    {
+        const T*          A[ROCBLAS_GEAM_MULTI_MAX_COUNT];
+        rocblas_int       lda[ROCBLAS_GEAM_MULTI_MAX_COUNT];
+        rocblas_operation trans[ROCBLAS_GEAM_MULTI_MAX_COUNT];
+        rocblas_int       alpha_index[ROCBLAS_GEAM_MULTI_MAX_COUNT];
+    };
+
+    // Host pointer mode scalars of one pass, passed by value
+    template <typename T>
+    struct rocblas_geam_multi_scalars
+    {
+        T value[ROCBLAS_GEAM_MULTI_MAX_COUNT];
+    };
+
+    template <typename T>
+    __device__ T rocblas_geam_multi_alpha(const T* alpha, const rocblas_int* alpha_index, int i)
+    {
+        return alpha[alpha_index[i]];
+    }
+
+    template <typename T>
+    __device__ T rocblas_geam_multi_alpha(const rocblas_geam_multi_scalars<T>& alpha,
+                                          const rocblas_int*,
+                                          int i)
+    {
+        return alpha.value[i];
+    }
+
+    // C := sum_i alpha_i * op(A_i) (+ C if ACCUMULATE) for count <= ROCBLAS_GEAM_MULTI_MAX_COUNT.
+    // Each thread block computes a DIM_X x DIM_X tile of C, each thread one row of DIM_X / DIM_Y
+    // columns. An operand which is C itself must be untransposed with lda == ldc, then each
+    // element is read and written by the same thread.
+    template <rocblas_int DIM_X, rocblas_int DIM_Y, bool ACCUMULATE, typename T, typename V>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_geam_multi_kernel(rocblas_int                    m,
+                              rocblas_int                    n,
+                              rocblas_int                    count,
+                              V                              alpha,
+                              rocblas_geam_multi_operands<T> operands,
+                              T*                             C,
+                              rocblas_int                    ldc)
+    {
+        static_assert(DIM_X % DIM_Y == 0, "DIM_Y must divide the tile size");
+        constexpr rocblas_int WIN = DIM_X / DIM_Y;
+
+        __shared__ T sA[DIM_X][DIM_X + 1];
+
+        const rocblas_int tx   = threadIdx.x;
+        const rocblas_int ty   = threadIdx.y;
+        const rocblas_int row0 = blockIdx.x * DIM_X;
+        const rocblas_int col0 = blockIdx.y * DIM_X;
+        const rocblas_int row  = row0 + tx;
+
+        T sum[WIN];
+        for(rocblas_int w = 0; w < WIN; w++)
+        {
+            const rocblas_int col = col0 + ty + w * DIM_Y;
+            const bool        in  = row < m && col < n;
+            sum[w]                = ACCUMULATE && in ? C[row + size_t(ldc) * col] : T(0);
+        }
+
+        for(rocblas_int i = 0; i < count; i++)
+        {
+            // alpha and the operand are the same for all threads of the block
+            const T a = rocblas_geam_multi_alpha(alpha, operands.alpha_index, i);
+            if(a == T(0))
+                continue;
+
+            const T*                A     = operands.A[i];
+            const size_t            lda   = operands.lda[i];
+            const rocblas_operation trans = operands.trans[i];
+
+            if(trans == rocblas_operation_none)
+            {
+                for(rocblas_int w = 0; w < WIN; w++)
+                {
+                    const rocblas_int col = col0 + ty + w * DIM_Y;
+                    if(row < m && col < n)
+                        sum[w] += a * A[row + lda * col];
+                }
+            }
+            else
+            {
+                // the tile of A is read along its columns, the rows of op(A), then transposed
+                // in LDS; the previous transposed operand must have been read from it
+                __syncthreads();
+                for(rocblas_int w = 0; w < WIN; w++)
+                {
+                    const rocblas_int r    = row0 + ty + w * DIM_Y;
+                    const rocblas_int c    = col0 + tx;
+                    sA[ty + w * DIM_Y][tx] = r < m && c < n ? A[c + lda * r] : T(0);
+                }
+                __syncthreads();
+
+                for(rocblas_int w = 0; w < WIN; w++)
+                {
+                    T val = sA[tx][ty + w * DIM_Y];
+                    if(trans == rocblas_operation_conjugate_transpose)
+                        val = conj(val);
+                    sum[w] += a * val;
+                }
+            }
+        }
+
+        if(row < m)
+        {
+            for(rocblas_int w = 0; w < WIN; w++)
+            {
+                const rocblas_int col = col0 + ty + w * DIM_Y;
+                if(col < n)
+                    C[row + size_t(ldc) * col] = sum[w];
+            }
+        }
+    }
+
+    template <typename T>
+    rocblas_status rocblas_geam_multi_template(rocblas_handle           handle,
+                                               rocblas_int              m,
+                                               rocblas_int              n,
+                                               rocblas_int              count,
+                                               const rocblas_operation* trans,
+                                               const T*                 alpha,
+                                               const T* const*          A,
+                                               const rocblas_int*       lda,
+                                               T*                       C,
+                                               rocblas_int              ldc)
+    {
+        constexpr rocblas_int DIM_X = ROCBLAS_GEAM_MULTI_DIM_X;
+        constexpr rocblas_int DIM_Y = ROCBLAS_GEAM_MULTI_DIM_Y;
+
+        bool host_mode = handle->pointer_mode == rocblas_pointer_mode_host;
+
+        // Operands in the order of the passes. Operands with a zero scalar on the host are not
+        // read, and C itself is summed in the first pass, before C is overwritten.
+        std::vector<rocblas_int> order;
+        for(rocblas_int i = 0; i < count; i++)
+            if(A[i] == C && (!host_mode || alpha[i] != T(0)))
+                order.push_back(i);
+        for(rocblas_int i = 0; i < count; i++)
+            if(A[i] != C && (!host_mode || alpha[i] != T(0)))
+                order.push_back(i);
+
+        dim3 geam_grid((m - 1) / DIM_X + 1, (n - 1) / DIM_X + 1);
+        dim3 geam_threads(DIM_X, DIM_Y);
+
+        // Each pass after the first adds to C; with all the scalars zero the first pass zeroes C
+        size_t passes
+            = order.empty() ? 1 : (order.size() - 1) / ROCBLAS_GEAM_MULTI_MAX_COUNT + 1;
+        for(size_t p = 0; p < passes; p++)
+        {
+            size_t      first      = p * ROCBLAS_GEAM_MULTI_MAX_COUNT;
+            rocblas_int pass_count = rocblas_int(
+                std::min<size_t>(order.size() - first, ROCBLAS_GEAM_MULTI_MAX_COUNT));
+
+            rocblas_geam_multi_operands<T> operands;
+            rocblas_geam_multi_scalars<T>  alpha_h;
+            for(rocblas_int i = 0; i < pass_count; i++)
+            {
+                rocblas_int l           = order[first + i];
+                operands.A[i]           = A[l];
+                operands.lda[i]         = lda[l];
+                operands.trans[i]       = trans[l];
+                operands.alpha_index[i] = l;
+                if(host_mode)
+                    alpha_h.value[i] = alpha[l];
+            }
+
+#define LAUNCH_GEAM_MULTI_KERNEL(ACCUMULATE_, alpha_)                                             \
+    hipLaunchKernelGGL((rocblas_geam_multi_kernel<DIM_X, DIM_Y, ACCUMULATE_>),                    \
+                       geam_grid,                                                                 \
+                       geam_threads,                                                              \
+                       0,                                                                         \
+                       handle->get_stream(),                                                      \
+                       m,                                                                         \
+                       n,                                                                         \
+                       pass_count,                                                                \
+                       alpha_,                                                                    \
+                       operands,                                                                  \
+                       C,                                                                         \
+                       ldc)
+
+            if(host_mode)
+            {
+                if(p)
+                    LAUNCH_GEAM_MULTI_KERNEL(true, alpha_h);
+                else
+                    LAUNCH_GEAM_MULTI_KERNEL(false, alpha_h);
+            }
+            else
+            {
+                if(p)
+                    LAUNCH_GEAM_MULTI_KERNEL(true, alpha);
+                else
+                    LAUNCH_GEAM_MULTI_KERNEL(false, alpha);
+            }
+
+#undef LAUNCH_GEAM_MULTI_KERNEL
+        }
+
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_geam_multi_impl(rocblas_handle           handle,
+                                           rocblas_int              m,
+                                           rocblas_int              n,
+                                           rocblas_int              count,
+                                           const rocblas_operation* trans,
+                                           const T*                 alpha,
+                                           const T* const*          A,
+                                           const rocblas_int*       lda,
+                                           T*                       C,
+                                           rocblas_int              ldc)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto name           = rocblas_geam_multi_name<T>;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, name, m, n, count, alpha, C, ldc);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, name, "M", m, "N", n, "count", count, "ldc", ldc);
+
+        if(m < 0 || n < 0 || count < 0 || ldc < m || ldc < 1)
+            return rocblas_status_invalid_size;
+
+        if(count && (!trans || !A || !lda))
+            return rocblas_status_invalid_pointer;
+
+        for(rocblas_int i = 0; i < count; i++)
+        {
+            if(trans[i] != rocblas_operation_none && trans[i] != rocblas_operation_transpose
+               && trans[i] != rocblas_operation_conjugate_transpose)
+                return rocblas_status_invalid_value;
+
+            if(lda[i] < (trans[i] == rocblas_operation_none ? m : n) || lda[i] < 1)
+                return rocblas_status_invalid_size;
+
+            if(A[i] == C && (lda[i] != ldc || trans[i] != rocblas_operation_none))
+                return rocblas_status_invalid_size;
+        }
+
+        // Quick return if possible.
+        if(!m || !n)
+            return rocblas_status_success;
+
+        if(!C || (count && !alpha))
+            return rocblas_status_invalid_pointer;
+
+        // pointers are validated if they need to be dereferenced
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+            for(rocblas_int i = 0; i < count; i++)
+                if(alpha[i] != T(0) && !A[i])
+                    return rocblas_status_invalid_pointer;
+
+        auto check_matrix = [&](rocblas_operation op, const T* P, rocblas_int ld, bool in) {
+            return rocblas_internal_check_numerics_matrix_template(name,
+                                                                   handle,
+                                                                   op,
+                                                                   rocblas_fill_full,
+                                                                   rocblas_client_general_matrix,
+                                                                   m,
+                                                                   n,
+                                                                   P,
+                                                                   0,
+                                                                   ld,
+                                                                   0,
+                                                                   1,
+                                                                   check_numerics,
+                                                                   in);
+        };
+
+        if(check_numerics)
+        {
+            for(rocblas_int i = 0; i < count; i++)
+                if(A[i])
+                    RETURN_IF_ROCBLAS_ERROR(check_matrix(trans[i], A[i], lda[i], true));
+        }
+
+        rocblas_status status
+            = rocblas_geam_multi_template(handle, m, n, count, trans, alpha, A, lda, C, ldc);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+            status = check_matrix(rocblas_operation_none, C, ldc, false);
+        return status;
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                            \
+    rocblas_status routine_name_(rocblas_handle           handle,                          \
+                                 rocblas_int              m,                               \
+                                 rocblas_int              n,                               \
+                                 rocblas_int              count,                           \
+                                 const rocblas_operation* trans,                           \
+                                 const T_*                alpha,                           \
+                                 const T_* const          A[],                             \
+                                 const rocblas_int*       lda,                             \
+                                 T_*                      C,                               \
+                                 rocblas_int              ldc)                             \
+    try                                                                                    \
+    {                                                                                      \
+        return rocblas_geam_multi_impl(handle, m, n, count, trans, alpha, A, lda, C, ldc); \
+    }                                                                                      \
+    catch(...)                                                                             \
+    {                                                                                      \
+        return exception_to_rocblas_status();                                              \
+    }
+
+IMPL(rocblas_sgeam_multi, float);
+IMPL(rocblas_dgeam_multi, double);
+IMPL(rocblas_cgeam_multi, rocblas_float_complex);
+IMPL(rocblas_zgeam_multi, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
@@ -0,0 +1,346 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "check_numerics_matrix.hpp"
+#include "check_numerics_vector.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+#include "Tensile/gemm_source.hpp"
+
+/*
+ * ===========================================================================
+ *    gemm_dgmm: C := alpha * diag(x) * op(A) * op(B) + beta * C (side left) or
+ *    C := alpha * op(A) * diag(x) * op(B) + beta * C (side right), the gemm of
+ *    the result of dgmm. The diagonal scaling is applied to the elements of
+ *    op(A) as its tiles are loaded, so that the scaled copy of A is neither
+ *    written nor read again.
+ * ===========================================================================
+ */
+
+namespace
+{
+    template <typename T>
+    constexpr char rocblas_gemm_dgmm_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemm_dgmm_name<float>[] = "rocblas_sgemm_dgmm";
+    template <>
+    constexpr char rocblas_gemm_dgmm_name<double>[] = "rocblas_dgemm_dgmm";
+    template <>
+    constexpr char rocblas_gemm_dgmm_name<rocblas_float_complex>[] = "rocblas_cgemm_dgmm";
+    template <>
+    constexpr char rocblas_gemm_dgmm_name<rocblas_double_complex>[] = "rocblas_zgemm_dgmm";
+
+    template <typename T>
+    rocblas_status rocblas_gemm_dgmm_template(rocblas_handle    handle,
+                                              rocblas_operation trans_a,
+                                              rocblas_operation trans_b,
+                                              rocblas_side      side,
+                                              rocblas_int       m,
+                                              rocblas_int       n,
+                                              rocblas_int       k,
+                                              const T*          alpha,
+                                              const T*          A,
+                                              rocblas_int       lda,
+                                              const T*          x,
+                                              rocblas_int       incx,
+                                              const T*          B,
+                                              rocblas_int       ldb,
+                                              const T*          beta,
+                                              T*                C,
+                                              rocblas_int       ldc)
+    {
+        // in case of negative incx shift pointer to end of data for negative indexing
+        rocblas_int dim_x = side == rocblas_side_left ? m : k;
+        if(x && incx < 0)
+            x -= int64_t(incx) * (dim_x - 1);
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+            rocblas_gemm_source_dgmm_solution(trans_a,
+                                              trans_b,
+                                              side,
+                                              m,
+                                              n,
+                                              k,
+                                              *alpha,
+                                              A,
+                                              lda,
+                                              x,
+                                              incx,
+                                              B,
+                                              ldb,
+                                              *beta,
+                                              C,
+                                              ldc,
+                                              handle->get_stream());
+        else
+            rocblas_gemm_source_dgmm_solution(trans_a,
+                                              trans_b,
+                                              side,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              x,
+                                              incx,
+                                              B,
+                                              ldb,
+                                              beta,
+                                              C,
+                                              ldc,
+                                              handle->get_stream());
+
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_gemm_dgmm_impl(rocblas_handle    handle,
+                                          rocblas_operation trans_a,
+                                          rocblas_operation trans_b,
+                                          rocblas_side      side,
+                                          rocblas_int       m,
+                                          rocblas_int       n,
+                                          rocblas_int       k,
+                                          const T*          alpha,
+                                          const T*          A,
+                                          rocblas_int       lda,
+                                          const T*          x,
+                                          rocblas_int       incx,
+                                          const T*          B,
+                                          rocblas_int       ldb,
+                                          const T*          beta,
+                                          T*                C,
+                                          rocblas_int       ldc)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto name           = rocblas_gemm_dgmm_name<T>;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      name,
+                      trans_a,
+                      trans_b,
+                      side,
+                      m,
+                      n,
+                      k,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      A,
+                      lda,
+                      x,
+                      incx,
+                      B,
+                      ldb,
+                      LOG_TRACE_SCALAR_VALUE(handle, beta),
+                      C,
+                      ldc);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        name,
+                        "transA",
+                        rocblas_transpose_letter(trans_a),
+                        "transB",
+                        rocblas_transpose_letter(trans_b),
+                        "side",
+                        rocblas_side_letter(side),
+                        "M",
+                        m,
+                        "N",
+                        n,
+                        "K",
+                        k,
+                        "lda",
+                        lda,
+                        "incx",
+                        incx,
+                        "ldb",
+                        ldb,
+                        "ldc",
+                        ldc);
+
+        if(trans_a != rocblas_operation_none && trans_a != rocblas_operation_transpose
+           && trans_a != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+        if(trans_b != rocblas_operation_none && trans_b != rocblas_operation_transpose
+           && trans_b != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+        if(side != rocblas_side_left && side != rocblas_side_right)
+            return rocblas_status_invalid_value;
+
+        rocblas_int num_rows_a = trans_a == rocblas_operation_none ? m : k;
+        rocblas_int num_rows_b = trans_b == rocblas_operation_none ? k : n;
+        if(m < 0 || n < 0 || k < 0 || lda < num_rows_a || ldb < num_rows_b || ldc < m || lda < 1
+           || ldb < 1 || ldc < 1)
+            return rocblas_status_invalid_size;
+
+        // Quick return if possible. k == 0 is not a quick return, C must be scaled by beta
+        if(!m || !n)
+            return rocblas_status_success;
+
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        // pointers are validated if they need to be dereferenced
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            if(*beta == 1 && (!k || *alpha == 0))
+                return rocblas_status_success;
+
+            if(!C || (k && *alpha != 0 && (!A || !B || !x)))
+                return rocblas_status_invalid_pointer;
+        }
+        else if(!C || (k && (!A || !B || !x)))
+            return rocblas_status_invalid_pointer;
+
+        auto check_inputs = [&](bool is_input) -> rocblas_status {
+            if(k && A && B && x)
+            {
+                RETURN_IF_ROCBLAS_ERROR(
+                    rocblas_internal_check_numerics_matrix_template(name,
+                                                                    handle,
+                                                                    trans_a,
+                                                                    rocblas_fill_full,
+                                                                    rocblas_client_general_matrix,
+                                                                    m,
+                                                                    k,
+                                                                    A,
+                                                                    0,
+                                                                    lda,
+                                                                    0,
+                                                                    1,
+                                                                    check_numerics,
+                                                                    is_input));
+                RETURN_IF_ROCBLAS_ERROR(
+                    rocblas_internal_check_numerics_matrix_template(name,
+                                                                    handle,
+                                                                    trans_b,
+                                                                    rocblas_fill_full,
+                                                                    rocblas_client_general_matrix,
+                                                                    k,
+                                                                    n,
+                                                                    B,
+                                                                    0,
+                                                                    ldb,
+                                                                    0,
+                                                                    1,
+                                                                    check_numerics,
+                                                                    is_input));
+                RETURN_IF_ROCBLAS_ERROR(rocblas_internal_check_numerics_vector_template(
+                    name,
+                    handle,
+                    side == rocblas_side_left ? m : k,
+                    x,
+                    0,
+                    incx,
+                    0,
+                    1,
+                    check_numerics,
+                    is_input));
+            }
+            return rocblas_internal_check_numerics_matrix_template(name,
+                                                                   handle,
+                                                                   rocblas_operation_none,
+                                                                   rocblas_fill_full,
+                                                                   rocblas_client_general_matrix,
+                                                                   m,
+                                                                   n,
+                                                                   C,
+                                                                   0,
+                                                                   ldc,
+                                                                   0,
+                                                                   1,
+                                                                   check_numerics,
+                                                                   is_input);
+        };
+
+        if(check_numerics)
+            RETURN_IF_ROCBLAS_ERROR(check_inputs(true));
+
+        rocblas_status status = rocblas_gemm_dgmm_template(
+            handle, trans_a, trans_b, side, m, n, k, alpha, A, lda, x, incx, B, ldb, beta, C, ldc);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+            status = check_inputs(false);
+        return status;
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                                   \
+    rocblas_status routine_name_(rocblas_handle    handle,                                        \
+                                 rocblas_operation transA,                                        \
+                                 rocblas_operation transB,                                        \
+                                 rocblas_side      side,                                          \
+                                 rocblas_int       m,                                             \
+                                 rocblas_int       n,                                             \
+                                 rocblas_int       k,                                             \
+                                 const T_*         alpha,                                         \
+                                 const T_*         A,                                             \
+                                 rocblas_int       lda,                                           \
+                                 const T_*         x,                                             \
+                                 rocblas_int       incx,                                          \
+                                 const T_*         B,                                             \
+                                 rocblas_int       ldb,                                           \
+                                 const T_*         beta,                                          \
+                                 T_*               C,                                             \
+                                 rocblas_int       ldc)                                           \
+    try                                                                                           \
+    {                                                                                             \
+        return rocblas_gemm_dgmm_impl(                                                            \
+            handle, transA, transB, side, m, n, k, alpha, A, lda, x, incx, B, ldb, beta, C, ldc); \
+    }                                                                                             \
+    catch(...)                                                                                    \
+    {                                                                                             \
+        return exception_to_rocblas_status();                                                     \
+    }
+
+IMPL(rocblas_sgemm_dgmm, float);
+IMPL(rocblas_dgemm_dgmm, double);
+IMPL(rocblas_cgemm_dgmm, rocblas_float_complex);
+IMPL(rocblas_zgemm_dgmm, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
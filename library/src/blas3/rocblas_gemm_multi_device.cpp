@@ -0,0 +1,554 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "Tensile/gemm.hpp"
+#include "logging.hpp"
+#include <vector>
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemm_multi_device_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemm_multi_device_name<float>[] = "rocblas_sgemm_multi_device";
+    template <>
+    constexpr char rocblas_gemm_multi_device_name<double>[] = "rocblas_dgemm_multi_device";
+    template <>
+    constexpr char rocblas_gemm_multi_device_name<rocblas_float_complex>[]
+        = "rocblas_cgemm_multi_device";
+    template <>
+    constexpr char rocblas_gemm_multi_device_name<rocblas_double_complex>[]
+        = "rocblas_zgemm_multi_device";
+
+    // Depth of the A and B panels copied to a device per step. Two panels are in flight,
+    // so the copy of the next panel overlaps the GEMM on the current one.
+    constexpr rocblas_int ROCBLAS_GEMM_MULTI_DEVICE_KB = 1024;
+
+    /*******************************************************************************
+     * Choose a rows x cols grid of C tiles, rows * cols == count, which minimizes
+     * the A and B panel volume m/rows + n/cols copied to each device.
+     ******************************************************************************/
+    void rocblas_gemm_multi_device_grid(
+        rocblas_int count, rocblas_int m, rocblas_int n, rocblas_int& rows, rocblas_int& cols)
+    {
+        rows        = 1;
+        cols        = count;
+        double best = -1;
+        for(rocblas_int r = 1; r <= count; r++)
+        {
+            if(count % r)
+                continue;
+            rocblas_int c    = count / r;
+            double      cost = double(m) / r + double(n) / c;
+            if(best < 0 || cost < best)
+            {
+                best = cost;
+                rows = r;
+                cols = c;
+            }
+        }
+    }
+
+    // Tile this device computes, and the panel depth it is fed with
+    struct rocblas_gemm_multi_device_tile
+    {
+        rocblas_int r0, mi, c0, nj, kb;
+
+        size_t a_panel_size(size_t elem) const
+        {
+            return size_t(mi) * kb * elem;
+        }
+        size_t b_panel_size(size_t elem) const
+        {
+            return size_t(kb) * nj * elem;
+        }
+        size_t c_tile_size(size_t elem) const
+        {
+            return size_t(mi) * nj * elem;
+        }
+    };
+
+    rocblas_gemm_multi_device_tile rocblas_gemm_multi_device_get_tile(
+        rocblas_int d, rocblas_int count, rocblas_int m, rocblas_int n, rocblas_int k)
+    {
+        rocblas_int rows, cols;
+        rocblas_gemm_multi_device_grid(count, m, n, rows, cols);
+
+        rocblas_int i = d / cols, j = d % cols;
+
+        rocblas_gemm_multi_device_tile tile;
+        tile.r0 = rocblas_int(int64_t(m) * i / rows);
+        tile.mi = rocblas_int(int64_t(m) * (i + 1) / rows) - tile.r0;
+        tile.c0 = rocblas_int(int64_t(n) * j / cols);
+        tile.nj = rocblas_int(int64_t(n) * (j + 1) / cols) - tile.c0;
+        tile.kb = std::min(k, ROCBLAS_GEMM_MULTI_DEVICE_KB);
+        return tile;
+    }
+
+    // Streams and events created for one call, destroyed on return. The runtime
+    // defers releasing them until the work enqueued on them has completed.
+    struct rocblas_gemm_multi_device_resources
+    {
+        std::vector<hipStream_t> streams;
+        std::vector<hipEvent_t>  events;
+
+        rocblas_gemm_multi_device_resources() = default;
+
+        ~rocblas_gemm_multi_device_resources()
+        {
+            for(auto e : events)
+                (void)hipEventDestroy(e);
+            for(auto s : streams)
+                (void)hipStreamDestroy(s);
+        }
+
+        rocblas_gemm_multi_device_resources(const rocblas_gemm_multi_device_resources&) = delete;
+        rocblas_gemm_multi_device_resources& operator=(const rocblas_gemm_multi_device_resources&)
+            = delete;
+
+        hipError_t create_stream(hipStream_t& stream)
+        {
+            hipError_t status = hipStreamCreateWithFlags(&stream, hipStreamNonBlocking);
+            if(status == hipSuccess)
+                streams.push_back(stream);
+            return status;
+        }
+
+        hipError_t create_event(hipEvent_t& event)
+        {
+            hipError_t status = hipEventCreateWithFlags(&event, hipEventDisableTiming);
+            if(status == hipSuccess)
+                events.push_back(event);
+            return status;
+        }
+    };
+
+    // Arguments of the GEMM being distributed, with alpha and beta on the host
+    template <typename T>
+    struct rocblas_gemm_multi_device_args
+    {
+        rocblas_operation trans_a, trans_b;
+        rocblas_int       m, n, k;
+        const T*          alpha;
+        const T*          A;
+        rocblas_int       lda;
+        const T*          B;
+        rocblas_int       ldb;
+        const T*          beta;
+        T*                C;
+        rocblas_int       ldc;
+    };
+
+    /*******************************************************************************
+     * Compute the tile of a device other than the home device holding A, B and C.
+     * Panels of op(A) and op(B) are copied peer-to-peer on a copy stream, double
+     * buffered, and consumed by GEMMs on the handle's stream; the tile of C is then
+     * copied back. All work on the device is ordered after start and before done.
+     ******************************************************************************/
+    template <typename T>
+    rocblas_status
+        rocblas_gemm_multi_device_remote(rocblas_handle                           handle,
+                                         rocblas_gemm_multi_device_resources&     resources,
+                                         const rocblas_gemm_multi_device_tile&    tile,
+                                         const rocblas_gemm_multi_device_args<T>& args,
+                                         int                                      home,
+                                         hipEvent_t                               start,
+                                         hipEvent_t                               done)
+    {
+        auto saved_device_id    = handle->push_device_id();
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        // Peer access is optional; without it the copies are staged by the runtime
+        if(hipDeviceEnablePeerAccess(home, 0) != hipSuccess)
+            (void)hipGetLastError();
+
+        const size_t elem  = sizeof(T);
+        const auto   kb    = tile.kb;
+        auto         w_mem = handle->device_malloc(tile.a_panel_size(elem),
+                                           tile.a_panel_size(elem),
+                                           tile.b_panel_size(elem),
+                                           tile.b_panel_size(elem),
+                                           tile.c_tile_size(elem));
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        T* a_panel[2] = {(T*)w_mem[0], (T*)w_mem[1]};
+        T* b_panel[2] = {(T*)w_mem[2], (T*)w_mem[3]};
+        T* c_tile     = (T*)w_mem[4];
+
+        hipStream_t compute_stream = handle->get_stream();
+        hipStream_t copy_stream;
+        hipEvent_t  copied[2], consumed[2];
+        RETURN_IF_HIP_ERROR(resources.create_stream(copy_stream));
+        for(int b = 0; b < 2; b++)
+        {
+            RETURN_IF_HIP_ERROR(resources.create_event(copied[b]));
+            RETURN_IF_HIP_ERROR(resources.create_event(consumed[b]));
+        }
+
+        RETURN_IF_HIP_ERROR(hipStreamWaitEvent(copy_stream, start, 0));
+        RETURN_IF_HIP_ERROR(hipStreamWaitEvent(compute_stream, start, 0));
+
+        const T*    A = args.A;
+        const T*    B = args.B;
+        T*          C = args.C;
+        rocblas_int lda = args.lda, ldb = args.ldb, ldc = args.ldc, k = args.k;
+
+        if(*args.beta != 0)
+            RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(c_tile,
+                                                 tile.mi * elem,
+                                                 C + tile.r0 + size_t(tile.c0) * ldc,
+                                                 ldc * elem,
+                                                 tile.mi * elem,
+                                                 tile.nj,
+                                                 hipMemcpyDeviceToDevice,
+                                                 compute_stream));
+
+        const T     one    = 1;
+        rocblas_int panels = k ? (k - 1) / kb + 1 : 1;
+
+        for(rocblas_int p = 0; p < panels; p++)
+        {
+            int         b  = p % 2;
+            rocblas_int k0 = p * kb;
+            rocblas_int kp = std::min(kb, k - k0);
+
+            // op(A) rows r0..r0+mi, columns k0..k0+kp; op(B) rows k0..k0+kp, columns c0..c0+nj
+            rocblas_int lda_p = args.trans_a == rocblas_operation_none ? tile.mi : kp;
+            rocblas_int ldb_p = args.trans_b == rocblas_operation_none ? kp : tile.nj;
+
+            if(kp)
+            {
+                // The buffer is reused once the GEMM two panels back has consumed it
+                if(p >= 2)
+                    RETURN_IF_HIP_ERROR(hipStreamWaitEvent(copy_stream, consumed[b], 0));
+
+                if(args.trans_a == rocblas_operation_none)
+                    RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(a_panel[b],
+                                                         lda_p * elem,
+                                                         A + tile.r0 + size_t(k0) * lda,
+                                                         lda * elem,
+                                                         tile.mi * elem,
+                                                         kp,
+                                                         hipMemcpyDeviceToDevice,
+                                                         copy_stream));
+                else
+                    RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(a_panel[b],
+                                                         lda_p * elem,
+                                                         A + k0 + size_t(tile.r0) * lda,
+                                                         lda * elem,
+                                                         kp * elem,
+                                                         tile.mi,
+                                                         hipMemcpyDeviceToDevice,
+                                                         copy_stream));
+
+                if(args.trans_b == rocblas_operation_none)
+                    RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(b_panel[b],
+                                                         ldb_p * elem,
+                                                         B + k0 + size_t(tile.c0) * ldb,
+                                                         ldb * elem,
+                                                         kp * elem,
+                                                         tile.nj,
+                                                         hipMemcpyDeviceToDevice,
+                                                         copy_stream));
+                else
+                    RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(b_panel[b],
+                                                         ldb_p * elem,
+                                                         B + tile.c0 + size_t(k0) * ldb,
+                                                         ldb * elem,
+                                                         tile.nj * elem,
+                                                         kp,
+                                                         hipMemcpyDeviceToDevice,
+                                                         copy_stream));
+
+                RETURN_IF_HIP_ERROR(hipEventRecord(copied[b], copy_stream));
+                RETURN_IF_HIP_ERROR(hipStreamWaitEvent(compute_stream, copied[b], 0));
+            }
+
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_internal_gemm_template<false>(handle,
+                                                      args.trans_a,
+                                                      args.trans_b,
+                                                      tile.mi,
+                                                      tile.nj,
+                                                      kp,
+                                                      args.alpha,
+                                                      (const T*)a_panel[b],
+                                                      0,
+                                                      std::max(lda_p, 1),
+                                                      0,
+                                                      (const T*)b_panel[b],
+                                                      0,
+                                                      std::max(ldb_p, 1),
+                                                      0,
+                                                      p ? &one : args.beta,
+                                                      c_tile,
+                                                      0,
+                                                      tile.mi,
+                                                      0,
+                                                      1));
+
+            RETURN_IF_HIP_ERROR(hipEventRecord(consumed[b], compute_stream));
+        }
+
+        RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(C + tile.r0 + size_t(tile.c0) * ldc,
+                                             ldc * elem,
+                                             c_tile,
+                                             tile.mi * elem,
+                                             tile.mi * elem,
+                                             tile.nj,
+                                             hipMemcpyDeviceToDevice,
+                                             compute_stream));
+        RETURN_IF_HIP_ERROR(hipEventRecord(done, compute_stream));
+
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_gemm_multi_device_impl(const rocblas_handle* handles,
+                                                  rocblas_int           handle_count,
+                                                  rocblas_operation     trans_a,
+                                                  rocblas_operation     trans_b,
+                                                  rocblas_int           m,
+                                                  rocblas_int           n,
+                                                  rocblas_int           k,
+                                                  const T*              alpha,
+                                                  const T*              A,
+                                                  rocblas_int           lda,
+                                                  const T*              B,
+                                                  rocblas_int           ldb,
+                                                  const T*              beta,
+                                                  T*                    C,
+                                                  rocblas_int           ldc)
+    {
+        if(!handles || handle_count <= 0)
+            return rocblas_status_invalid_handle;
+        for(rocblas_int d = 0; d < handle_count; d++)
+            if(!handles[d])
+                return rocblas_status_invalid_handle;
+
+        // Devices beyond the larger dimension of C would get empty tiles
+        rocblas_int count = std::max(1, std::min(handle_count, std::max(m, n)));
+
+        // Each handle in device memory size query mode is told the workspace of its tile.
+        // The home handle works in place and needs none.
+        bool           any_query    = false;
+        rocblas_status query_status = rocblas_status_size_unchanged;
+        for(rocblas_int d = 0; d < handle_count; d++)
+        {
+            if(!handles[d]->is_device_memory_size_query())
+                continue;
+            any_query = true;
+            if(d == 0 || d >= count)
+                continue;
+
+            auto   tile = rocblas_gemm_multi_device_get_tile(d, count, m, n, k);
+            size_t elem = sizeof(T);
+            if(tile.mi > 0 && tile.nj > 0
+               && handles[d]->set_optimal_device_memory_size(tile.a_panel_size(elem),
+                                                              tile.a_panel_size(elem),
+                                                              tile.b_panel_size(elem),
+                                                              tile.b_panel_size(elem),
+                                                              tile.c_tile_size(elem))
+                      == rocblas_status_size_increased)
+                query_status = rocblas_status_size_increased;
+        }
+        if(any_query)
+            return query_status;
+
+        rocblas_handle home_handle = handles[0];
+        int            home        = home_handle->getDevice();
+        for(rocblas_int d = 0; d < handle_count; d++)
+            for(rocblas_int e = 0; e < d; e++)
+                if(handles[d]->getDevice() == handles[e]->getDevice())
+                    return rocblas_status_invalid_value;
+
+        auto saved_device_id = home_handle->push_device_id();
+
+        // Copy alpha and beta to host if on device
+        T alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+            home_handle, alpha, beta, alpha_h, beta_h, k));
+        auto saved_pointer_mode = home_handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(home_handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(home_handle,
+                      rocblas_gemm_multi_device_name<T>,
+                      handle_count,
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      LOG_TRACE_SCALAR_VALUE(home_handle, alpha),
+                      A,
+                      lda,
+                      B,
+                      ldb,
+                      LOG_TRACE_SCALAR_VALUE(home_handle, beta),
+                      C,
+                      ldc);
+
+        auto validArgs = rocblas_validateArgs(
+            home_handle, trans_a, trans_b, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        if(validArgs != rocblas_status_continue)
+            return validArgs;
+
+        // A single device, or a product too small to split, is an ordinary GEMM
+        if(count == 1)
+            return rocblas_internal_gemm_template<false>(home_handle,
+                                                         trans_a,
+                                                         trans_b,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         alpha,
+                                                         A,
+                                                         0,
+                                                         lda,
+                                                         0,
+                                                         B,
+                                                         0,
+                                                         ldb,
+                                                         0,
+                                                         beta,
+                                                         C,
+                                                         0,
+                                                         ldc,
+                                                         0,
+                                                         1);
+
+        rocblas_gemm_multi_device_args<T> args{
+            trans_a, trans_b, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc};
+        rocblas_gemm_multi_device_resources resources;
+        std::vector<hipEvent_t>             done;
+
+        hipStream_t home_stream = home_handle->get_stream();
+        hipEvent_t  start;
+        RETURN_IF_HIP_ERROR(resources.create_event(start));
+        RETURN_IF_HIP_ERROR(hipEventRecord(start, home_stream));
+
+        rocblas_status status = rocblas_status_success;
+        for(rocblas_int d = 1; d < count && status == rocblas_status_success; d++)
+        {
+            auto tile = rocblas_gemm_multi_device_get_tile(d, count, m, n, k);
+            if(tile.mi <= 0 || tile.nj <= 0)
+                continue;
+
+            hipEvent_t tile_done;
+            {
+                auto saved_device_id = handles[d]->push_device_id();
+                RETURN_IF_HIP_ERROR(resources.create_event(tile_done));
+            }
+            done.push_back(tile_done);
+
+            status = rocblas_gemm_multi_device_remote(
+                handles[d], resources, tile, args, home, start, tile_done);
+        }
+
+        // The home device computes its tile in place
+        if(status == rocblas_status_success)
+        {
+            auto tile = rocblas_gemm_multi_device_get_tile(0, count, m, n, k);
+            status    = rocblas_internal_gemm_template<false>(home_handle,
+                                                           trans_a,
+                                                           trans_b,
+                                                           tile.mi,
+                                                           tile.nj,
+                                                           k,
+                                                           alpha,
+                                                           A,
+                                                           trans_a == rocblas_operation_none
+                                                               ? tile.r0
+                                                               : size_t(tile.r0) * lda,
+                                                           lda,
+                                                           0,
+                                                           B,
+                                                           trans_b == rocblas_operation_none
+                                                               ? size_t(tile.c0) * ldb
+                                                               : tile.c0,
+                                                           ldb,
+                                                           0,
+                                                           beta,
+                                                           C,
+                                                           tile.r0 + size_t(tile.c0) * ldc,
+                                                           ldc,
+                                                           0,
+                                                           1);
+        }
+
+        // Join the other devices back into the home stream, even after an error, so
+        // that no tile is written after this call's work on the home stream
+        for(auto e : done)
+        {
+            hipError_t err = hipStreamWaitEvent(home_stream, e, 0);
+            if(err != hipSuccess && status == rocblas_status_success)
+                status = get_rocblas_status_for_hip_status(err);
+        }
+
+        return status;
+    }
+}
+
+/*******************************************************************************
+ * Multi-device GEMM APIs
+ ******************************************************************************/
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                                     \
+    rocblas_status routine_name_(const rocblas_handle* handles,                                     \
+                                 rocblas_int           handle_count,                                \
+                                 rocblas_operation     trans_a,                                     \
+                                 rocblas_operation     trans_b,                                     \
+                                 rocblas_int           m,                                           \
+                                 rocblas_int           n,                                           \
+                                 rocblas_int           k,                                           \
+                                 const T_*             alpha,                                       \
+                                 const T_*             A,                                           \
+                                 rocblas_int           lda,                                         \
+                                 const T_*             B,                                           \
+                                 rocblas_int           ldb,                                         \
+                                 const T_*             beta,                                        \
+                                 T_*                   C,                                           \
+                                 rocblas_int           ldc)                                         \
+    try                                                                                             \
+    {                                                                                               \
+        return rocblas_gemm_multi_device_impl(                                                      \
+            handles, handle_count, trans_a, trans_b, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc); \
+    }                                                                                               \
+    catch(...)                                                                                      \
+    {                                                                                               \
+        return exception_to_rocblas_status();                                                       \
+    }
+
+IMPL(rocblas_sgemm_multi_device, float);
+IMPL(rocblas_dgemm_multi_device, double);
+IMPL(rocblas_cgemm_multi_device, rocblas_float_complex);
+IMPL(rocblas_zgemm_multi_device, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
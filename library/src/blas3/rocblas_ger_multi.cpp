@@ -0,0 +1,476 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "Tensile/gemm.hpp"
+#include "check_numerics_matrix.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+/*
+ * ===========================================================================
+ *    ger_multi: A := A + sum_i alpha_i * x_i * y_i^T (y_i^H for gerc), the
+ *    k rank-1 updates of the columns x_i of X and y_i of Y.
+ *    Up to ROCBLAS_GER_MULTI_K_TILE updates are fused into one pass over A:
+ *    each thread block loads its rows of alpha_i * x_i and its columns of y_i
+ *    into LDS, and each element of A is read and written once for all of
+ *    them. Larger k are computed as the gemm A := (X * diag(alpha)) * Y^T + A,
+ *    with X * diag(alpha) in device memory workspace.
+ * ===========================================================================
+ */
+
+namespace
+{
+    constexpr rocblas_int ROCBLAS_GER_MULTI_DIM_X    = 64;
+    constexpr rocblas_int ROCBLAS_GER_MULTI_DIM_Y    = 16;
+    constexpr rocblas_int ROCBLAS_GER_MULTI_WIN      = 4;
+    constexpr rocblas_int ROCBLAS_GER_MULTI_K_TILE   = 16;
+    constexpr rocblas_int ROCBLAS_GER_MULTI_SCALE_NB = 256;
+
+    const rocblas_int rocblas_internal_ger_multi_gemm_min_k = [] {
+        // k from which ger_multi uses gemm. Below it the fused kernel reads A once for each
+        // ROCBLAS_GER_MULTI_K_TILE updates. 0 disables gemm.
+        constexpr rocblas_int GER_MULTI_GEMM_MIN_K = ROCBLAS_GER_MULTI_K_TILE + 1;
+        rocblas_int           min_k;
+        const char*           env = getenv("ROCBLAS_INTERNAL_GER_MULTI_GEMM_MIN_K");
+        return env && sscanf(env, "%d", &min_k) == 1 ? min_k : GER_MULTI_GEMM_MIN_K;
+    }();
+
+    inline bool rocblas_ger_multi_use_gemm(rocblas_int k)
+    {
+        return rocblas_internal_ger_multi_gemm_min_k > 0
+               && k >= rocblas_internal_ger_multi_gemm_min_k;
+    }
+
+    template <bool CONJ, typename T>
+    constexpr char rocblas_ger_multi_name[] = "unknown";
+    template <>
+    constexpr char rocblas_ger_multi_name<false, float>[] = "rocblas_sger_multi";
+    template <>
+    constexpr char rocblas_ger_multi_name<false, double>[] = "rocblas_dger_multi";
+    template <>
+    constexpr char rocblas_ger_multi_name<false, rocblas_float_complex>[] = "rocblas_cgeru_multi";
+    template <>
+    constexpr char rocblas_ger_multi_name<false, rocblas_double_complex>[] = "rocblas_zgeru_multi";
+    template <>
+    constexpr char rocblas_ger_multi_name<true, rocblas_float_complex>[] = "rocblas_cgerc_multi";
+    template <>
+    constexpr char rocblas_ger_multi_name<true, rocblas_double_complex>[] = "rocblas_zgerc_multi";
+
+    // Host pointer mode scalars of up to ROCBLAS_GER_MULTI_K_TILE updates, passed by value
+    template <typename T>
+    struct rocblas_ger_multi_scalars
+    {
+        T value[ROCBLAS_GER_MULTI_K_TILE];
+    };
+
+    template <typename T>
+    __device__ T rocblas_ger_multi_alpha(const T* alpha, rocblas_int i)
+    {
+        return alpha[i];
+    }
+
+    template <typename T>
+    __device__ T rocblas_ger_multi_alpha(const rocblas_ger_multi_scalars<T>& alpha, rocblas_int i)
+    {
+        return alpha.value[i];
+    }
+
+    // A := A + sum_i alpha_i * x_i * y_i^T for k <= ROCBLAS_GER_MULTI_K_TILE. Each thread block
+    // updates DIM_X rows and DIM_Y * WIN columns of A, each thread one row of WIN columns.
+    template <rocblas_int DIM_X,
+              rocblas_int DIM_Y,
+              rocblas_int WIN,
+              bool        CONJ,
+              typename T,
+              typename V>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_ger_multi_kernel(rocblas_int m,
+                             rocblas_int n,
+                             rocblas_int k,
+                             V           alpha,
+                             const T* __restrict__ X,
+                             rocblas_int ldx,
+                             const T* __restrict__ Y,
+                             rocblas_int ldy,
+                             T* __restrict__ A,
+                             rocblas_int lda)
+    {
+        constexpr rocblas_int NY = DIM_Y * WIN;
+
+        __shared__ T sx[ROCBLAS_GER_MULTI_K_TILE][DIM_X];
+        __shared__ T sy[ROCBLAS_GER_MULTI_K_TILE][NY];
+
+        const rocblas_int tx   = threadIdx.x;
+        const rocblas_int ty   = threadIdx.y;
+        const rocblas_int tid  = ty * DIM_X + tx;
+        const rocblas_int row0 = blockIdx.x * DIM_X;
+        const rocblas_int col0 = blockIdx.y * NY;
+
+        for(rocblas_int l = tid; l < k * DIM_X; l += DIM_X * DIM_Y)
+        {
+            rocblas_int i   = l / DIM_X;
+            rocblas_int row = row0 + l % DIM_X;
+
+            sx[i][l % DIM_X]
+                = row < m ? rocblas_ger_multi_alpha(alpha, i) * X[row + size_t(ldx) * i] : T(0);
+        }
+
+        for(rocblas_int l = tid; l < k * NY; l += DIM_X * DIM_Y)
+        {
+            rocblas_int i   = l / NY;
+            rocblas_int col = col0 + l % NY;
+            T           y   = col < n ? Y[col + size_t(ldy) * i] : T(0);
+
+            sy[i][l % NY] = CONJ ? conj(y) : y;
+        }
+
+        __syncthreads();
+
+        const rocblas_int row = row0 + tx;
+        if(row >= m)
+            return;
+
+        for(rocblas_int w = 0; w < WIN; w++)
+        {
+            const rocblas_int c   = ty + w * DIM_Y;
+            const rocblas_int col = col0 + c;
+            if(col < n)
+            {
+                T* a   = A + row + size_t(lda) * col;
+                T  sum = *a;
+                for(rocblas_int i = 0; i < k; i++)
+                    sum += sx[i][tx] * sy[i][c];
+                *a = sum;
+            }
+        }
+    }
+
+    // W := X * diag(alpha) for k <= ROCBLAS_GER_MULTI_K_TILE columns, one per blockIdx.y
+    template <rocblas_int NB, typename T, typename V>
+    ROCBLAS_KERNEL(NB)
+    rocblas_ger_multi_scale_kernel(rocblas_int m,
+                                   V           alpha,
+                                   const T* __restrict__ X,
+                                   rocblas_int ldx,
+                                   T* __restrict__ W,
+                                   rocblas_int ldw)
+    {
+        rocblas_int row = blockIdx.x * NB + threadIdx.x;
+        rocblas_int i   = blockIdx.y;
+        if(row < m)
+            W[row + size_t(ldw) * i] = rocblas_ger_multi_alpha(alpha, i) * X[row + size_t(ldx) * i];
+    }
+
+    template <bool CONJ, typename T>
+    rocblas_status rocblas_ger_multi_template(rocblas_handle handle,
+                                              rocblas_int    m,
+                                              rocblas_int    n,
+                                              rocblas_int    k,
+                                              const T*       alpha,
+                                              const T*       X,
+                                              rocblas_int    ldx,
+                                              const T*       Y,
+                                              rocblas_int    ldy,
+                                              T*             A,
+                                              rocblas_int    lda,
+                                              T*             workspace)
+    {
+        constexpr rocblas_int DIM_X = ROCBLAS_GER_MULTI_DIM_X;
+        constexpr rocblas_int DIM_Y = ROCBLAS_GER_MULTI_DIM_Y;
+        constexpr rocblas_int WIN   = ROCBLAS_GER_MULTI_WIN;
+        constexpr rocblas_int NB    = ROCBLAS_GER_MULTI_SCALE_NB;
+
+        bool        use_gemm = rocblas_ger_multi_use_gemm(k);
+        dim3        ger_grid((m - 1) / DIM_X + 1, (n - 1) / (DIM_Y * WIN) + 1);
+        dim3        ger_threads(DIM_X, DIM_Y);
+        rocblas_int scale_blocks = (m - 1) / NB + 1;
+
+        // Updates are applied ROCBLAS_GER_MULTI_K_TILE at a time, or scaled into the workspace
+        for(rocblas_int i0 = 0; i0 < k; i0 += ROCBLAS_GER_MULTI_K_TILE)
+        {
+            rocblas_int kc = std::min(k - i0, ROCBLAS_GER_MULTI_K_TILE);
+            const T*    Xc = X + size_t(ldx) * i0;
+
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+            {
+                if(use_gemm)
+                    hipLaunchKernelGGL((rocblas_ger_multi_scale_kernel<NB>),
+                                       dim3(scale_blocks, kc),
+                                       dim3(NB),
+                                       0,
+                                       handle->get_stream(),
+                                       m,
+                                       alpha + i0,
+                                       Xc,
+                                       ldx,
+                                       workspace + size_t(m) * i0,
+                                       m);
+                else
+                    hipLaunchKernelGGL((rocblas_ger_multi_kernel<DIM_X, DIM_Y, WIN, CONJ>),
+                                       ger_grid,
+                                       ger_threads,
+                                       0,
+                                       handle->get_stream(),
+                                       m,
+                                       n,
+                                       kc,
+                                       alpha + i0,
+                                       Xc,
+                                       ldx,
+                                       Y + size_t(ldy) * i0,
+                                       ldy,
+                                       A,
+                                       lda);
+            }
+            else
+            {
+                rocblas_ger_multi_scalars<T> alpha_h;
+                bool                         all_zero = true;
+                for(rocblas_int i = 0; i < kc; i++)
+                {
+                    alpha_h.value[i] = alpha[i0 + i];
+                    all_zero         = all_zero && alpha_h.value[i] == T(0);
+                }
+
+                if(use_gemm)
+                    hipLaunchKernelGGL((rocblas_ger_multi_scale_kernel<NB>),
+                                       dim3(scale_blocks, kc),
+                                       dim3(NB),
+                                       0,
+                                       handle->get_stream(),
+                                       m,
+                                       alpha_h,
+                                       Xc,
+                                       ldx,
+                                       workspace + size_t(m) * i0,
+                                       m);
+                else if(!all_zero)
+                    hipLaunchKernelGGL((rocblas_ger_multi_kernel<DIM_X, DIM_Y, WIN, CONJ>),
+                                       ger_grid,
+                                       ger_threads,
+                                       0,
+                                       handle->get_stream(),
+                                       m,
+                                       n,
+                                       kc,
+                                       alpha_h,
+                                       Xc,
+                                       ldx,
+                                       Y + size_t(ldy) * i0,
+                                       ldy,
+                                       A,
+                                       lda);
+            }
+        }
+
+        if(!use_gemm)
+            return rocblas_status_success;
+
+        // A := W * Y^T + A, with alpha and beta of 1 on the host
+        static const T one              = T(1);
+        auto           saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        rocblas_operation trans_y
+            = CONJ ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose;
+
+        return rocblas_internal_gemm_template<false>(handle,
+                                                     rocblas_operation_none,
+                                                     trans_y,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     &one,
+                                                     (const T*)workspace,
+                                                     0,
+                                                     m,
+                                                     0,
+                                                     Y,
+                                                     0,
+                                                     ldy,
+                                                     0,
+                                                     &one,
+                                                     A,
+                                                     0,
+                                                     lda,
+                                                     0,
+                                                     1);
+    }
+
+    template <bool CONJ, typename T>
+    rocblas_status rocblas_ger_multi_impl(rocblas_handle handle,
+                                          rocblas_int    m,
+                                          rocblas_int    n,
+                                          rocblas_int    k,
+                                          const T*       alpha,
+                                          const T*       X,
+                                          rocblas_int    ldx,
+                                          const T*       Y,
+                                          rocblas_int    ldy,
+                                          T*             A,
+                                          rocblas_int    lda)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        auto name = rocblas_ger_multi_name<CONJ, T>;
+
+        size_t dev_bytes = m > 0 && n > 0 && rocblas_ger_multi_use_gemm(k) ? sizeof(T) * m * k : 0;
+        if(handle->is_device_memory_size_query())
+        {
+            if(!dev_bytes)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, name, m, n, k, alpha, X, ldx, Y, ldy, A, lda);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        name,
+                        "M",
+                        m,
+                        "N",
+                        n,
+                        "K",
+                        k,
+                        "ldx",
+                        ldx,
+                        "ldy",
+                        ldy,
+                        "lda",
+                        lda);
+
+        if(m < 0 || n < 0 || k < 0 || ldx < m || ldx < 1 || ldy < n || ldy < 1 || lda < m
+           || lda < 1)
+            return rocblas_status_invalid_size;
+
+        // Quick return if possible.
+        if(!m || !n || !k)
+            return rocblas_status_success;
+
+        if(!alpha)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            bool all_zero = true;
+            for(rocblas_int i = 0; i < k && all_zero; i++)
+                all_zero = alpha[i] == T(0);
+            if(all_zero)
+                return rocblas_status_success;
+
+            // pointers are validated if they need to be dereferenced
+            if(!A || !X || !Y)
+                return rocblas_status_invalid_pointer;
+        }
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        auto check_matrix = [&](rocblas_int r, rocblas_int c, const T* P, rocblas_int ld, bool in) {
+            return rocblas_internal_check_numerics_matrix_template(name,
+                                                                   handle,
+                                                                   rocblas_operation_none,
+                                                                   rocblas_fill_full,
+                                                                   rocblas_client_general_matrix,
+                                                                   r,
+                                                                   c,
+                                                                   P,
+                                                                   0,
+                                                                   ld,
+                                                                   0,
+                                                                   1,
+                                                                   check_numerics,
+                                                                   in);
+        };
+
+        if(check_numerics)
+        {
+            RETURN_IF_ROCBLAS_ERROR(check_matrix(m, n, A, lda, true));
+            RETURN_IF_ROCBLAS_ERROR(check_matrix(m, k, X, ldx, true));
+            RETURN_IF_ROCBLAS_ERROR(check_matrix(n, k, Y, ldy, true));
+        }
+
+        rocblas_status status = rocblas_ger_multi_template<CONJ>(
+            handle, m, n, k, alpha, X, ldx, Y, ldy, A, lda, (T*)w_mem[0]);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+            status = check_matrix(m, n, A, lda, false);
+        return status;
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, CONJ_, T_)                                                         \
+    rocblas_status routine_name_(rocblas_handle handle,                                        \
+                                 rocblas_int    m,                                             \
+                                 rocblas_int    n,                                             \
+                                 rocblas_int    k,                                             \
+                                 const T_*      alpha,                                         \
+                                 const T_*      X,                                             \
+                                 rocblas_int    ldx,                                           \
+                                 const T_*      Y,                                             \
+                                 rocblas_int    ldy,                                           \
+                                 T_*            A,                                             \
+                                 rocblas_int    lda)                                           \
+    try                                                                                        \
+    {                                                                                          \
+        return rocblas_ger_multi_impl<CONJ_>(handle, m, n, k, alpha, X, ldx, Y, ldy, A, lda); \
+    }                                                                                          \
+    catch(...)                                                                                 \
+    {                                                                                          \
+        return exception_to_rocblas_status();                                                  \
+    }
+
+IMPL(rocblas_sger_multi, false, float);
+IMPL(rocblas_dger_multi, false, double);
+IMPL(rocblas_cgeru_multi, false, rocblas_float_complex);
+IMPL(rocblas_zgeru_multi, false, rocblas_double_complex);
+IMPL(rocblas_cgerc_multi, true, rocblas_float_complex);
+IMPL(rocblas_zgerc_multi, true, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
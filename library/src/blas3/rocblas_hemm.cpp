@@ -50,9 +50,11 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+        size_t dev_bytes = rocblas_internal_symm_expand_workspace_size<T>(side, m, n, 1);
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(dev_bytes);
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
@@ -145,6 +147,15 @@ namespace
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
+        // the full expansion of A is optional, the block-recursive method needs no workspace
+        rocblas_status perf_status = rocblas_status_success;
+        auto           w_mem       = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+        {
+            perf_status = rocblas_status_perf_degraded;
+            dev_bytes   = 0;
+        }
+
         static constexpr bool HERMITIAN = true;
         static constexpr bool BATCHED   = false;
 
@@ -176,26 +187,45 @@ namespace
         }
 
         rocblas_status status = rocblas_status_success;
-        status                = rocblas_internal_symm_template<BATCHED, HERMITIAN, T>(handle,
-                                                                       side,
-                                                                       uplo,
-                                                                       m,
-                                                                       n,
-                                                                       alpha,
-                                                                       A,
-                                                                       offset_A,
-                                                                       lda,
-                                                                       stride_A,
-                                                                       B,
-                                                                       offset_B,
-                                                                       ldb,
-                                                                       stride_B,
-                                                                       beta,
-                                                                       C,
-                                                                       offset_C,
-                                                                       ldc,
-                                                                       stride_C,
-                                                                       batch_count);
+        if(dev_bytes)
+            status = rocblas_internal_symm_expand_template<HERMITIAN, T>(handle,
+                                                                          side,
+                                                                          uplo,
+                                                                          m,
+                                                                          n,
+                                                                          alpha,
+                                                                          A,
+                                                                          offset_A,
+                                                                          lda,
+                                                                          B,
+                                                                          offset_B,
+                                                                          ldb,
+                                                                          beta,
+                                                                          C,
+                                                                          offset_C,
+                                                                          ldc,
+                                                                          (T*)w_mem);
+        else
+            status = rocblas_internal_symm_template<BATCHED, HERMITIAN, T>(handle,
+                                                                           side,
+                                                                           uplo,
+                                                                           m,
+                                                                           n,
+                                                                           alpha,
+                                                                           A,
+                                                                           offset_A,
+                                                                           lda,
+                                                                           stride_A,
+                                                                           B,
+                                                                           offset_B,
+                                                                           ldb,
+                                                                           stride_B,
+                                                                           beta,
+                                                                           C,
+                                                                           offset_C,
+                                                                           ldc,
+                                                                           stride_C,
+                                                                           batch_count);
         if(status != rocblas_status_success)
             return status;
 
@@ -225,7 +255,7 @@ namespace
             if(hemm_check_numerics_status != rocblas_status_success)
                 return hemm_check_numerics_status;
         }
-        return status;
+        return perf_status;
     }
 }
 /*
@@ -52,7 +52,9 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+        size_t dev_bytes = rocblas_internal_syr2k_concat_workspace_size<T>(n, k, 1);
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(dev_bytes);
 
         // Copy alpha and beta to host if on device. This is because gemm is called and it
         // requires alpha and beta to be on host
@@ -62,7 +64,7 @@ namespace
             rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
         auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
@@ -155,6 +157,15 @@ namespace
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
+        // the concatenation of A and B is optional, the two rank-k updates need no workspace
+        rocblas_status perf_status = rocblas_status_success;
+        auto           w_mem       = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+        {
+            perf_status = rocblas_status_perf_degraded;
+            dev_bytes   = 0;
+        }
+
         static constexpr bool Hermetian = true;
         if(check_numerics)
         {
@@ -188,26 +199,46 @@ namespace
         static constexpr bool HERK    = true;
         rocblas_status        status  = rocblas_status_success;
 
-        status = rocblas_internal_syr2k_her2k_template<MIN_NB, BATCHED, is2K, HERK, T>(handle,
-                                                                                       uplo,
-                                                                                       trans,
-                                                                                       n,
-                                                                                       k,
-                                                                                       alpha,
-                                                                                       A,
-                                                                                       offset_A,
-                                                                                       lda,
-                                                                                       stride_A,
-                                                                                       B,
-                                                                                       offset_B,
-                                                                                       ldb,
-                                                                                       stride_B,
-                                                                                       beta,
-                                                                                       C,
-                                                                                       offset_C,
-                                                                                       ldc,
-                                                                                       stride_C,
-                                                                                       batch_count);
+        if(dev_bytes && *alpha != T(0))
+            status = rocblas_internal_syr2k_her2k_concat_template<HERK>(handle,
+                                                                        uplo,
+                                                                        trans,
+                                                                        n,
+                                                                        k,
+                                                                        alpha,
+                                                                        A,
+                                                                        offset_A,
+                                                                        lda,
+                                                                        B,
+                                                                        offset_B,
+                                                                        ldb,
+                                                                        beta,
+                                                                        C,
+                                                                        offset_C,
+                                                                        ldc,
+                                                                        (T*)w_mem);
+        else
+            status = rocblas_internal_syr2k_her2k_template<MIN_NB, BATCHED, is2K, HERK, T>(
+                handle,
+                uplo,
+                trans,
+                n,
+                k,
+                alpha,
+                A,
+                offset_A,
+                lda,
+                stride_A,
+                B,
+                offset_B,
+                ldb,
+                stride_B,
+                beta,
+                C,
+                offset_C,
+                ldc,
+                stride_C,
+                batch_count);
 
         if(status != rocblas_status_success)
             return status;
@@ -238,7 +269,7 @@ namespace
             if(her2k_check_numerics_status != rocblas_status_success)
                 return her2k_check_numerics_status;
         }
-        return status;
+        return perf_status;
     }
 
 }
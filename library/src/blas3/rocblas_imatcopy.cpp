@@ -0,0 +1,235 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "check_numerics_matrix.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_geam.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    // imatcopy, imatcopy_batched and imatcopy_strided_batched, the stride being 0 and
+    // batch_count 1 for imatcopy
+    template <typename T, typename TPtr>
+    rocblas_status rocblas_imatcopy_impl(const char*       name,
+                                         rocblas_handle    handle,
+                                         rocblas_operation trans,
+                                         rocblas_int       m,
+                                         rocblas_int       n,
+                                         const T*          alpha,
+                                         TPtr              A,
+                                         rocblas_int       lda,
+                                         rocblas_int       ldb,
+                                         rocblas_stride    stride_a,
+                                         rocblas_int       batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes = rocblas_imatcopy_workspace_size<T>(trans, m, n, lda, ldb, batch_count);
+        if(handle->is_device_memory_size_query())
+        {
+            if(!dev_bytes || m <= 0 || n <= 0 || batch_count <= 0)
+                return rocblas_status_size_unchanged;
+            return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      name,
+                      trans,
+                      m,
+                      n,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      A,
+                      lda,
+                      ldb,
+                      stride_a,
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        name,
+                        "trans",
+                        rocblas_transpose_letter(trans),
+                        "M",
+                        m,
+                        "N",
+                        n,
+                        "lda",
+                        lda,
+                        "ldb",
+                        ldb,
+                        "stride_a",
+                        stride_a,
+                        "batch_count",
+                        batch_count);
+
+        if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+           && trans != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        rocblas_int rows = trans == rocblas_operation_none ? m : n;
+        if(m < 0 || n < 0 || batch_count < 0 || lda < m || lda < 1 || ldb < rows || ldb < 1)
+            return rocblas_status_invalid_size;
+
+        // Quick return if possible.
+        if(!m || !n || !batch_count)
+            return rocblas_status_success;
+
+        if(!alpha || !A)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        auto check_matrix = [&](bool is_input) {
+            return rocblas_internal_check_numerics_matrix_template(
+                name,
+                handle,
+                rocblas_operation_none,
+                rocblas_fill_full,
+                rocblas_client_general_matrix,
+                is_input ? m : rows,
+                is_input ? n : (trans == rocblas_operation_none ? n : m),
+                A,
+                0,
+                is_input ? lda : ldb,
+                stride_a,
+                batch_count,
+                check_numerics,
+                is_input);
+        };
+
+        if(check_numerics)
+            RETURN_IF_ROCBLAS_ERROR(check_matrix(true));
+
+        RETURN_IF_ROCBLAS_ERROR(rocblas_internal_imatcopy_template(
+            handle, trans, m, n, alpha, A, 0, lda, ldb, stride_a, batch_count, (T*)w_mem));
+
+        if(check_numerics)
+            return check_matrix(false);
+        return rocblas_status_success;
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                           \
+    rocblas_status routine_name_(rocblas_handle    handle,                                \
+                                 rocblas_operation trans,                                 \
+                                 rocblas_int       m,                                     \
+                                 rocblas_int       n,                                     \
+                                 const T_*         alpha,                                 \
+                                 T_*               A,                                     \
+                                 rocblas_int       lda,                                   \
+                                 rocblas_int       ldb)                                   \
+    try                                                                                   \
+    {                                                                                     \
+        return rocblas_imatcopy_impl(                                                     \
+            #routine_name_, handle, trans, m, n, alpha, A, lda, ldb, 0, 1);               \
+    }                                                                                     \
+    catch(...)                                                                            \
+    {                                                                                     \
+        return exception_to_rocblas_status();                                             \
+    }                                                                                     \
+                                                                                          \
+    rocblas_status routine_name_##_batched(rocblas_handle    handle,                      \
+                                           rocblas_operation trans,                       \
+                                           rocblas_int       m,                           \
+                                           rocblas_int       n,                           \
+                                           const T_*         alpha,                       \
+                                           T_* const         A[],                         \
+                                           rocblas_int       lda,                         \
+                                           rocblas_int       ldb,                         \
+                                           rocblas_int       batch_count)                 \
+    try                                                                                   \
+    {                                                                                     \
+        return rocblas_imatcopy_impl(#routine_name_ "_batched",                           \
+                                     handle,                                              \
+                                     trans,                                               \
+                                     m,                                                   \
+                                     n,                                                   \
+                                     alpha,                                               \
+                                     A,                                                   \
+                                     lda,                                                 \
+                                     ldb,                                                 \
+                                     0,                                                   \
+                                     batch_count);                                        \
+    }                                                                                     \
+    catch(...)                                                                            \
+    {                                                                                     \
+        return exception_to_rocblas_status();                                             \
+    }                                                                                     \
+                                                                                          \
+    rocblas_status routine_name_##_strided_batched(rocblas_handle    handle,              \
+                                                   rocblas_operation trans,               \
+                                                   rocblas_int       m,                   \
+                                                   rocblas_int       n,                   \
+                                                   const T_*         alpha,               \
+                                                   T_*               A,                   \
+                                                   rocblas_int       lda,                 \
+                                                   rocblas_int       ldb,                 \
+                                                   rocblas_stride    stride_a,            \
+                                                   rocblas_int       batch_count)         \
+    try                                                                                   \
+    {                                                                                     \
+        return rocblas_imatcopy_impl(#routine_name_ "_strided_batched",                   \
+                                     handle,                                              \
+                                     trans,                                               \
+                                     m,                                                   \
+                                     n,                                                   \
+                                     alpha,                                               \
+                                     A,                                                   \
+                                     lda,                                                 \
+                                     ldb,                                                 \
+                                     stride_a,                                            \
+                                     batch_count);                                        \
+    }                                                                                     \
+    catch(...)                                                                            \
+    {                                                                                     \
+        return exception_to_rocblas_status();                                             \
+    }
+
+IMPL(rocblas_simatcopy, float);
+IMPL(rocblas_dimatcopy, double);
+IMPL(rocblas_cimatcopy, rocblas_float_complex);
+IMPL(rocblas_zimatcopy, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
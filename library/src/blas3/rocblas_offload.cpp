@@ -0,0 +1,1471 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "Tensile/gemm.hpp"
+#include "host_numa.hpp"
+#include "logging.hpp"
+#include "rocblas_block_sizes.h"
+#include "rocblas_syrk_herk.hpp"
+#include "rocblas_trsm.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+static const size_t rocblas_internal_offload_slot_bytes = [] {
+    // Pinned host memory, and device memory, of each of the tiles in flight
+    constexpr size_t OFFLOAD_SLOT_MB = 128;
+    size_t           slot_mb;
+    const char*      env = getenv("ROCBLAS_INTERNAL_OFFLOAD_SLOT_MB");
+    return (env && sscanf(env, "%zu", &slot_mb) == 1 && slot_mb ? slot_mb : OFFLOAD_SLOT_MB) << 20;
+}();
+
+static const rocblas_int rocblas_internal_offload_gemm_tile = [] {
+    // Largest order of the square tiles of C kept in device memory by the out-of-core GEMM.
+    // The panels multiplied into a t x t tile carry t / sizeof(T) flops per byte copied, which
+    // with the default is above the ratio of compute to host link bandwidth of current devices.
+    constexpr rocblas_int OFFLOAD_GEMM_TILE = 16384;
+    rocblas_int           tile;
+    const char*           env = getenv("ROCBLAS_INTERNAL_OFFLOAD_GEMM_TILE");
+    return env && sscanf(env, "%d", &tile) == 1 && tile > 0 ? tile : OFFLOAD_GEMM_TILE;
+}();
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemm_offload_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemm_offload_name<float>[] = "rocblas_sgemm_offload";
+    template <>
+    constexpr char rocblas_gemm_offload_name<double>[] = "rocblas_dgemm_offload";
+    template <>
+    constexpr char rocblas_gemm_offload_name<rocblas_float_complex>[] = "rocblas_cgemm_offload";
+    template <>
+    constexpr char rocblas_gemm_offload_name<rocblas_double_complex>[] = "rocblas_zgemm_offload";
+
+    template <typename>
+    constexpr char rocblas_trsm_offload_name[] = "unknown";
+    template <>
+    constexpr char rocblas_trsm_offload_name<float>[] = "rocblas_strsm_offload";
+    template <>
+    constexpr char rocblas_trsm_offload_name<double>[] = "rocblas_dtrsm_offload";
+    template <>
+    constexpr char rocblas_trsm_offload_name<rocblas_float_complex>[] = "rocblas_ctrsm_offload";
+    template <>
+    constexpr char rocblas_trsm_offload_name<rocblas_double_complex>[] = "rocblas_ztrsm_offload";
+
+    template <typename>
+    constexpr char rocblas_syrk_offload_name[] = "unknown";
+    template <>
+    constexpr char rocblas_syrk_offload_name<float>[] = "rocblas_ssyrk_offload";
+    template <>
+    constexpr char rocblas_syrk_offload_name<double>[] = "rocblas_dsyrk_offload";
+    template <>
+    constexpr char rocblas_syrk_offload_name<rocblas_float_complex>[] = "rocblas_csyrk_offload";
+    template <>
+    constexpr char rocblas_syrk_offload_name<rocblas_double_complex>[] = "rocblas_zsyrk_offload";
+
+    // Tiles in flight: the upload of a tile, the computation of the previous one and the
+    // download of the one before that overlap, each on its own stream
+    constexpr int ROCBLAS_OFFLOAD_SLOTS = 3;
+
+    // Host blocks copied to the device per tile, at most
+    constexpr int ROCBLAS_OFFLOAD_BLOCKS = 3;
+
+    // Order of the diagonal blocks of op( A ) solved per step of trsm
+    constexpr rocblas_int ROCBLAS_OFFLOAD_TRSM_NB = 1024;
+
+    // Blocks start at multiples of this number of elements of their slot
+    constexpr size_t ROCBLAS_OFFLOAD_ALIGN = 64;
+
+    // Depth of the panels of op( A ) and op( B ) multiplied per GEMM by the out-of-core GEMM
+    constexpr rocblas_int ROCBLAS_OFFLOAD_GEMM_KB = 1024;
+
+    // Panels in flight in the out-of-core GEMM: the copies of the next panels overlap the
+    // GEMM of the current one
+    constexpr int ROCBLAS_OFFLOAD_GEMM_PANELS = 3;
+
+    /*******************************************************************************
+     * A rows x cols block of a host column major matrix, packed with leading dimension
+     * rows in the staging and device memory of its tile. Blocks with upload are copied
+     * to the device before the tile is computed, and blocks with download are copied
+     * back to the host matrix after.
+     ******************************************************************************/
+    template <typename T>
+    struct rocblas_offload_block
+    {
+        T*          host     = nullptr;
+        rocblas_int rows     = 0;
+        rocblas_int cols     = 0;
+        rocblas_int ld       = 0;
+        bool        upload   = false;
+        bool        download = false;
+
+        size_t count() const
+        {
+            return size_t(rows) * cols;
+        }
+
+        // Elements this block takes in its slot
+        size_t slot_count() const
+        {
+            return (count() + ROCBLAS_OFFLOAD_ALIGN - 1) / ROCBLAS_OFFLOAD_ALIGN
+                   * ROCBLAS_OFFLOAD_ALIGN;
+        }
+
+        rocblas_int device_ld() const
+        {
+            return std::max(rows, 1);
+        }
+
+        void pack(T* staging) const
+        {
+            if(rows == ld)
+                memcpy(staging, host, count() * sizeof(T));
+            else
+                for(rocblas_int j = 0; j < cols; j++)
+                    memcpy(staging + size_t(j) * rows, host + size_t(j) * ld, rows * sizeof(T));
+        }
+
+        void unpack(const T* staging) const
+        {
+            if(rows == ld)
+                memcpy(host, staging, count() * sizeof(T));
+            else
+                for(rocblas_int j = 0; j < cols; j++)
+                    memcpy(host + size_t(j) * ld, staging + size_t(j) * rows, rows * sizeof(T));
+        }
+    };
+
+    // Read only host matrices are only ever packed
+    template <typename T>
+    rocblas_offload_block<T>
+        rocblas_offload_input(const T* host, rocblas_int rows, rocblas_int cols, rocblas_int ld)
+    {
+        rocblas_offload_block<T> block;
+        block.host   = const_cast<T*>(host);
+        block.rows   = rows;
+        block.cols   = cols;
+        block.ld     = ld;
+        block.upload = rows > 0 && cols > 0;
+        return block;
+    }
+
+    // The blocks of a tile, and the sizes of the operation computing it on the device
+    template <typename T>
+    struct rocblas_offload_tile
+    {
+        rocblas_offload_block<T> blocks[ROCBLAS_OFFLOAD_BLOCKS];
+        rocblas_int              m = 0, n = 0, k = 0;
+        bool                     diagonal = false;
+
+        size_t slot_count() const
+        {
+            size_t total = 0;
+            for(auto& block : blocks)
+                total += block.slot_count();
+            return total;
+        }
+    };
+
+    template <typename T>
+    size_t rocblas_offload_slot_count(const std::vector<rocblas_offload_tile<T>>& tiles)
+    {
+        size_t total = 0;
+        for(auto& tile : tiles)
+            total = std::max(total, tile.slot_count());
+        return total;
+    }
+
+    /*******************************************************************************
+     * Device memory in bytes the handle may use besides reserved_bytes. A handle managed
+     * by rocBLAS may grow into three quarters of the free device memory.
+     ******************************************************************************/
+    size_t rocblas_offload_device_budget(rocblas_handle handle, size_t reserved_bytes)
+    {
+        size_t device_bytes = handle->get_available_workspace();
+        size_t free_bytes, total_bytes;
+        if(handle->is_device_memory_managed())
+        {
+            if(hipMemGetInfo(&free_bytes, &total_bytes) == hipSuccess)
+                device_bytes += free_bytes / 4 * 3;
+            else
+                (void)hipGetLastError();
+        }
+        return device_bytes > reserved_bytes ? device_bytes - reserved_bytes : 0;
+    }
+
+    /*******************************************************************************
+     * Elements available to the tiles of each slot: at most
+     * rocblas_internal_offload_slot_bytes, and outside of device memory size queries a
+     * share of the device memory the handle may use besides reserved_bytes.
+     ******************************************************************************/
+    template <typename T>
+    size_t rocblas_offload_slot_budget(rocblas_handle handle, size_t reserved_bytes)
+    {
+        size_t bytes = rocblas_internal_offload_slot_bytes;
+        if(!handle->is_device_memory_size_query())
+        {
+            size_t device_bytes = rocblas_offload_device_budget(handle, reserved_bytes);
+            bytes               = std::min(bytes, device_bytes / ROCBLAS_OFFLOAD_SLOTS);
+        }
+
+        // room for the alignment of the blocks
+        size_t elements = bytes / sizeof(T);
+        size_t align    = ROCBLAS_OFFLOAD_BLOCKS * ROCBLAS_OFFLOAD_ALIGN;
+        return elements > align ? elements - align : 0;
+    }
+
+    // Tile size x in [1, max_size], rounded down to a multiple of 64 unless it is max_size
+    rocblas_int rocblas_offload_round(int64_t x, rocblas_int max_size)
+    {
+        x = std::min(x, int64_t(max_size));
+        return rocblas_int(x >= 64 && x < max_size ? x / 64 * 64 : x);
+    }
+
+    /*******************************************************************************
+     * Sizes mb x nb of the tiles of C of a product of depth k, such that a tile and its
+     * panels of op( A ) and op( B ) fit in slot_elems elements. Tiles are square unless m or
+     * n is smaller than the square, which lets the other dimension grow. Returns false if
+     * not even a 1 x 1 tile fits.
+     ******************************************************************************/
+    bool rocblas_offload_gemm_tile_sizes(size_t       slot_elems,
+                                         rocblas_int  m,
+                                         rocblas_int  n,
+                                         rocblas_int  k,
+                                         rocblas_int& mb,
+                                         rocblas_int& nb)
+    {
+        // the largest t with t * t + 2 * k * t <= slot_elems
+        const int64_t slot = slot_elems;
+        const double  kd   = k;
+        int64_t       t    = int64_t(std::sqrt(kd * kd + double(slot)) - kd);
+        while(t > 0 && t * t + 2 * k * t > slot)
+            t--;
+        if(t <= 0)
+            return false;
+
+        // the other size of tiles with a fixed size
+        auto fit = [&](int64_t fixed) { return (slot - fixed * k) / (k + fixed); };
+
+        if(m <= t)
+        {
+            mb = m;
+            nb = rocblas_offload_round(fit(m), n);
+        }
+        else if(n <= t)
+        {
+            nb = n;
+            mb = rocblas_offload_round(fit(n), m);
+        }
+        else
+        {
+            mb = rocblas_offload_round(t, m);
+            nb = rocblas_offload_round(t, n);
+        }
+        return mb > 0 && nb > 0;
+    }
+
+    /*******************************************************************************
+     * Sizes of the out-of-core GEMM: mb x nb of the tiles of C and kb of the depth of the
+     * panels, such that two tiles, and ROCBLAS_OFFLOAD_GEMM_PANELS panels of op( A ) of
+     * mb x kb and of op( B ) of kb x nb, fit in budget elements. Tiles are square, of order
+     * at most rocblas_internal_offload_gemm_tile, unless m or n is smaller than the square,
+     * which lets the other dimension grow up to the same area. Returns false if not even a
+     * 1 x 1 tile fits.
+     ******************************************************************************/
+    bool rocblas_offload_gemm_resident_sizes(int64_t      budget,
+                                             rocblas_int  m,
+                                             rocblas_int  n,
+                                             rocblas_int  k,
+                                             rocblas_int& mb,
+                                             rocblas_int& nb,
+                                             rocblas_int& kb)
+    {
+        kb = std::min(k, ROCBLAS_OFFLOAD_GEMM_KB);
+
+        const int64_t panels   = int64_t(ROCBLAS_OFFLOAD_GEMM_PANELS) * kb;
+        const int64_t max_tile = rocblas_internal_offload_gemm_tile;
+        auto          fits     = [&](int64_t rows, int64_t cols) {
+            return 2 * rows * cols + panels * (rows + cols) <= budget;
+        };
+
+        // the largest t with 2 * t * t + 2 * panels * t <= budget
+        const double pd = panels;
+        int64_t      t  = int64_t((std::sqrt(pd * pd + 2 * double(budget)) - pd) / 2);
+        t               = std::min(t, max_tile);
+        while(t > 0 && !fits(t, t))
+            t--;
+        if(t <= 0)
+            return false;
+
+        // the other size of tiles with a fixed size
+        auto fit = [&](int64_t fixed) {
+            return std::min((budget - panels * fixed) / (2 * fixed + panels),
+                            max_tile * max_tile / fixed);
+        };
+
+        if(m <= t)
+        {
+            mb = m;
+            nb = rocblas_offload_round(fit(m), n);
+        }
+        else if(n <= t)
+        {
+            nb = n;
+            mb = rocblas_offload_round(fit(n), m);
+        }
+        else
+        {
+            mb = rocblas_offload_round(t, m);
+            nb = rocblas_offload_round(t, n);
+        }
+        return mb > 0 && nb > 0;
+    }
+
+    /*******************************************************************************
+     * Tiles of C = alpha*op( A )*op( B ) + beta*C on host matrices, each with its panels
+     * of op( A ) and op( B ). C is only uploaded if upload_c, i.e. beta is not zero. Empty if
+     * no tile fits in slot_elems elements.
+     ******************************************************************************/
+    template <typename T>
+    std::vector<rocblas_offload_tile<T>> rocblas_offload_gemm_tiles(size_t            slot_elems,
+                                                                    rocblas_operation trans_a,
+                                                                    rocblas_operation trans_b,
+                                                                    rocblas_int       m,
+                                                                    rocblas_int       n,
+                                                                    rocblas_int       k,
+                                                                    const T*          A,
+                                                                    rocblas_int       lda,
+                                                                    const T*          B,
+                                                                    rocblas_int       ldb,
+                                                                    bool              upload_c,
+                                                                    T*                C,
+                                                                    rocblas_int       ldc)
+    {
+        std::vector<rocblas_offload_tile<T>> tiles;
+        rocblas_int                          mb, nb;
+        if(!rocblas_offload_gemm_tile_sizes(slot_elems, m, n, k, mb, nb))
+            return tiles;
+
+        for(rocblas_int c0 = 0; c0 < n; c0 += nb)
+        {
+            for(rocblas_int r0 = 0; r0 < m; r0 += mb)
+            {
+                rocblas_offload_tile<T> tile;
+                tile.m = std::min(mb, m - r0);
+                tile.n = std::min(nb, n - c0);
+                tile.k = k;
+
+                // op( A ) rows r0..r0+m, op( B ) columns c0..c0+n
+                tile.blocks[0] = trans_a == rocblas_operation_none
+                                     ? rocblas_offload_input(A + r0, tile.m, k, lda)
+                                     : rocblas_offload_input(A + size_t(r0) * lda, k, tile.m, lda);
+                tile.blocks[1] = trans_b == rocblas_operation_none
+                                     ? rocblas_offload_input(B + size_t(c0) * ldb, k, tile.n, ldb)
+                                     : rocblas_offload_input(B + c0, tile.n, k, ldb);
+
+                auto& c    = tile.blocks[2];
+                c.host     = C + r0 + size_t(c0) * ldc;
+                c.rows     = tile.m;
+                c.cols     = tile.n;
+                c.ld       = ldc;
+                c.upload   = upload_c;
+                c.download = true;
+
+                tiles.push_back(tile);
+            }
+        }
+        return tiles;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_offload_gemm_compute(rocblas_handle                 handle,
+                                                rocblas_operation              trans_a,
+                                                rocblas_operation              trans_b,
+                                                const T*                       alpha,
+                                                const T*                       beta,
+                                                const rocblas_offload_tile<T>& tile,
+                                                T* const*                      dev)
+    {
+        return rocblas_internal_gemm_template<false>(handle,
+                                                     trans_a,
+                                                     trans_b,
+                                                     tile.m,
+                                                     tile.n,
+                                                     tile.k,
+                                                     alpha,
+                                                     (const T*)dev[0],
+                                                     0,
+                                                     tile.blocks[0].device_ld(),
+                                                     0,
+                                                     (const T*)dev[1],
+                                                     0,
+                                                     tile.blocks[1].device_ld(),
+                                                     0,
+                                                     beta,
+                                                     dev[2],
+                                                     0,
+                                                     tile.blocks[2].device_ld(),
+                                                     0,
+                                                     1);
+    }
+
+    /*******************************************************************************
+     * Streams, events and pinned staging memory of one call. The destructor waits for
+     * the copies still in flight on the streams, so that neither the staging memory nor
+     * the device memory of the handle is released while a copy may access it.
+     ******************************************************************************/
+    struct rocblas_offload_resources
+    {
+        std::vector<hipStream_t> streams;
+        std::vector<hipEvent_t>  events;
+        void*                    pinned = nullptr;
+
+        rocblas_offload_resources() = default;
+
+        ~rocblas_offload_resources()
+        {
+            for(auto stream : streams)
+                (void)hipStreamSynchronize(stream);
+            if(pinned)
+                (void)hipHostFree(pinned);
+            for(auto e : events)
+                (void)hipEventDestroy(e);
+            for(auto stream : streams)
+                (void)hipStreamDestroy(stream);
+        }
+
+        rocblas_offload_resources(const rocblas_offload_resources&) = delete;
+        rocblas_offload_resources& operator=(const rocblas_offload_resources&) = delete;
+
+        hipError_t create_stream(hipStream_t& stream)
+        {
+            hipError_t status = hipStreamCreateWithFlags(&stream, hipStreamNonBlocking);
+            if(status == hipSuccess)
+                streams.push_back(stream);
+            return status;
+        }
+
+        hipError_t create_event(hipEvent_t& event)
+        {
+            hipError_t status = hipEventCreateWithFlags(&event, hipEventDisableTiming);
+            if(status == hipSuccess)
+                events.push_back(event);
+            return status;
+        }
+
+        // Order stream after the work already enqueued on the compute stream, which may
+        // still use the device memory
+        hipError_t wait_for(hipStream_t stream, hipStream_t compute_stream)
+        {
+            hipEvent_t start;
+            hipError_t status = create_event(start);
+            if(status == hipSuccess)
+                status = hipEventRecord(start, compute_stream);
+            if(status == hipSuccess)
+                status = hipStreamWaitEvent(stream, start, 0);
+            return status;
+        }
+    };
+
+    // Copy streams, events and pinned staging memory of the slots of the tile pipeline
+    struct rocblas_offload_pipeline
+    {
+        hipStream_t upload_stream   = nullptr;
+        hipStream_t download_stream = nullptr;
+        hipEvent_t  uploaded[ROCBLAS_OFFLOAD_SLOTS]   = {};
+        hipEvent_t  computed[ROCBLAS_OFFLOAD_SLOTS]   = {};
+        hipEvent_t  downloaded[ROCBLAS_OFFLOAD_SLOTS] = {};
+        void*       pinned                            = nullptr;
+
+        hipError_t init(rocblas_offload_resources& resources,
+                        hipStream_t                compute_stream,
+                        size_t                     pinned_bytes,
+                        int                        device)
+        {
+            hipError_t status = resources.create_stream(upload_stream);
+            if(status == hipSuccess)
+                status = resources.create_stream(download_stream);
+            for(int s = 0; s < ROCBLAS_OFFLOAD_SLOTS && status == hipSuccess; s++)
+            {
+                status = resources.create_event(uploaded[s]);
+                if(status == hipSuccess)
+                    status = resources.create_event(computed[s]);
+                if(status == hipSuccess)
+                    status = resources.create_event(downloaded[s]);
+            }
+            if(status == hipSuccess)
+                status = rocblas_host_malloc_near(&resources.pinned, pinned_bytes, device);
+            if(status == hipSuccess)
+                status = resources.wait_for(upload_stream, compute_stream);
+            pinned = resources.pinned;
+            return status;
+        }
+    };
+
+    /*******************************************************************************
+     * Compute the tiles in order, pipelined over ROCBLAS_OFFLOAD_SLOTS slots of
+     * slot_elems elements of pinned staging memory and of device memory. The host packs
+     * the blocks of a tile into the staging memory of its slot, they are uploaded on the
+     * upload stream, compute(tile, dev) enqueues the computation on the handle's stream
+     * with dev the device copies of the blocks, and the results are downloaded on the
+     * download stream. A slot is reused once the host has unpacked the results of its
+     * previous tile, so the host packs and unpacks while the device works on the other
+     * slots. Returns once all results are in the host matrices.
+     ******************************************************************************/
+    template <typename T, typename F>
+    rocblas_status rocblas_offload_run(rocblas_handle                              handle,
+                                       const rocblas_offload_pipeline&             pipeline,
+                                       T*                                          device,
+                                       size_t                                      slot_elems,
+                                       const std::vector<rocblas_offload_tile<T>>& tiles,
+                                       F&&                                         compute)
+    {
+        hipStream_t  compute_stream = handle->get_stream();
+        T*           pinned         = (T*)pipeline.pinned;
+        const size_t count          = tiles.size();
+
+        auto retire = [&](size_t t) -> rocblas_status {
+            const int s = t % ROCBLAS_OFFLOAD_SLOTS;
+            RETURN_IF_HIP_ERROR(hipEventSynchronize(pipeline.downloaded[s]));
+
+            size_t offset = s * slot_elems;
+            for(auto& block : tiles[t].blocks)
+            {
+                if(block.download)
+                    block.unpack(pinned + offset);
+                offset += block.slot_count();
+            }
+            return rocblas_status_success;
+        };
+
+        for(size_t t = 0; t < count; t++)
+        {
+            const int s = t % ROCBLAS_OFFLOAD_SLOTS;
+            if(t >= ROCBLAS_OFFLOAD_SLOTS)
+                RETURN_IF_ROCBLAS_ERROR(retire(t - ROCBLAS_OFFLOAD_SLOTS));
+
+            T*     dev[ROCBLAS_OFFLOAD_BLOCKS];
+            size_t offset = s * slot_elems;
+            for(int b = 0; b < ROCBLAS_OFFLOAD_BLOCKS; b++)
+            {
+                auto& block = tiles[t].blocks[b];
+                dev[b]      = device + offset;
+                if(block.upload)
+                {
+                    block.pack(pinned + offset);
+                    RETURN_IF_HIP_ERROR(hipMemcpyAsync(dev[b],
+                                                       pinned + offset,
+                                                       block.count() * sizeof(T),
+                                                       hipMemcpyHostToDevice,
+                                                       pipeline.upload_stream));
+                }
+                offset += block.slot_count();
+            }
+            RETURN_IF_HIP_ERROR(hipEventRecord(pipeline.uploaded[s], pipeline.upload_stream));
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(compute_stream, pipeline.uploaded[s], 0));
+
+            RETURN_IF_ROCBLAS_ERROR(compute(tiles[t], dev));
+
+            RETURN_IF_HIP_ERROR(hipEventRecord(pipeline.computed[s], compute_stream));
+            RETURN_IF_HIP_ERROR(
+                hipStreamWaitEvent(pipeline.download_stream, pipeline.computed[s], 0));
+
+            offset = s * slot_elems;
+            for(int b = 0; b < ROCBLAS_OFFLOAD_BLOCKS; b++)
+            {
+                auto& block = tiles[t].blocks[b];
+                if(block.download)
+                    RETURN_IF_HIP_ERROR(hipMemcpyAsync(pinned + offset,
+                                                       dev[b],
+                                                       block.count() * sizeof(T),
+                                                       hipMemcpyDeviceToHost,
+                                                       pipeline.download_stream));
+                offset += block.slot_count();
+            }
+            RETURN_IF_HIP_ERROR(
+                hipEventRecord(pipeline.downloaded[s], pipeline.download_stream));
+        }
+
+        for(size_t t = count > ROCBLAS_OFFLOAD_SLOTS ? count - ROCBLAS_OFFLOAD_SLOTS : 0;
+            t < count;
+            t++)
+            RETURN_IF_ROCBLAS_ERROR(retire(t));
+
+        return rocblas_status_success;
+    }
+
+    /*******************************************************************************
+     * Allocate the slots of slot_elems elements, and the device workspaces of the
+     * routine, create the pipeline and call run(pipeline, slots, workspaces). In device
+     * memory size query mode only the size is reported.
+     ******************************************************************************/
+    template <typename T, typename F>
+    rocblas_status rocblas_offload_execute(rocblas_handle handle,
+                                           size_t         slot_elems,
+                                           size_t         w_x_temp_size,
+                                           size_t         w_invA_size,
+                                           F&&            run)
+    {
+        const size_t slots_size = ROCBLAS_OFFLOAD_SLOTS * slot_elems * sizeof(T);
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(slots_size, w_x_temp_size, w_invA_size);
+
+        // The host waits for the device, which cannot be captured into a graph
+        if(handle->is_graph_safe())
+            return rocblas_status_not_implemented;
+
+        auto w_mem = handle->device_malloc(slots_size, w_x_temp_size, w_invA_size);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        rocblas_offload_resources resources;
+        rocblas_offload_pipeline  pipeline;
+        RETURN_IF_HIP_ERROR(
+            pipeline.init(resources, handle->get_stream(), slots_size, handle->getDevice()));
+
+        return run(pipeline, (T*)w_mem[0], (void*)w_mem[1], (void*)w_mem[2]);
+    }
+
+    // Quick returns of the argument checks are unchanged sizes in device memory size queries
+    rocblas_status rocblas_offload_quick_return(rocblas_handle handle, rocblas_status status)
+    {
+        return status == rocblas_status_success && handle->is_device_memory_size_query()
+                   ? rocblas_status_size_unchanged
+                   : status;
+    }
+
+    /*******************************************************************************
+     * True if the copy engines access ptr directly: pinned host memory, or device memory
+     * of any device. Peer access to another device is enabled from the current device when
+     * possible; without it the copies are staged by the runtime. Pageable host memory is
+     * unknown to HIP.
+     ******************************************************************************/
+    bool rocblas_offload_is_direct(const void* ptr, int device)
+    {
+        hipPointerAttribute_t attribute;
+        if(hipPointerGetAttributes(&attribute, ptr) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return false;
+        }
+        if(attribute.hostPointer == ptr)
+            return true;
+        if(attribute.devicePointer != ptr)
+            return false;
+
+        if(attribute.device != device
+           && hipDeviceEnablePeerAccess(attribute.device, 0) != hipSuccess)
+            (void)hipGetLastError();
+        return true;
+    }
+
+    /*******************************************************************************
+     * Out-of-core GEMM of matrices the copy engines access directly. C is computed in
+     * tiles resident in device memory, each accumulated over k by a GEMM per panel of
+     * op( A ) and op( B ). The panels are copied straight from the matrices on the upload
+     * stream, up to ROCBLAS_OFFLOAD_GEMM_PANELS - 1 ahead of the GEMM consuming them. Two
+     * tiles alternate, so that the results of a tile are downloaded on the download stream
+     * while the next one is computed. Nothing is staged by the host, which only waits for
+     * the last download.
+     ******************************************************************************/
+    template <typename T>
+    rocblas_status rocblas_offload_gemm_resident(rocblas_handle    handle,
+                                                 rocblas_operation trans_a,
+                                                 rocblas_operation trans_b,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 rocblas_int       k,
+                                                 const T*          alpha,
+                                                 const T*          A,
+                                                 rocblas_int       lda,
+                                                 const T*          B,
+                                                 rocblas_int       ldb,
+                                                 const T*          beta,
+                                                 T*                C,
+                                                 rocblas_int       ldc)
+    {
+        // Device memory size queries report the largest tiles. Otherwise leave room for the
+        // alignment of the tiles and panels.
+        const bool query  = handle->is_device_memory_size_query();
+        int64_t    budget = std::numeric_limits<int64_t>::max() / 4;
+        if(!query)
+        {
+            int64_t elements = rocblas_offload_device_budget(handle, 0) / sizeof(T);
+            int64_t align    = (2 + 2 * ROCBLAS_OFFLOAD_GEMM_PANELS) * ROCBLAS_OFFLOAD_ALIGN;
+            budget           = std::max(elements - align, int64_t(0));
+        }
+
+        rocblas_int mb, nb, kb;
+        if(!rocblas_offload_gemm_resident_sizes(budget, m, n, k, mb, nb, kb))
+            return rocblas_status_memory_error;
+
+        // Tiles and panels start at multiples of ROCBLAS_OFFLOAD_ALIGN elements
+        auto aligned = [](size_t count) {
+            return (count + ROCBLAS_OFFLOAD_ALIGN - 1) / ROCBLAS_OFFLOAD_ALIGN
+                   * ROCBLAS_OFFLOAD_ALIGN;
+        };
+        const size_t c_elems = aligned(size_t(mb) * nb);
+        const size_t a_elems = aligned(size_t(mb) * kb);
+        const size_t b_elems = aligned(size_t(kb) * nb);
+        const size_t size
+            = (2 * c_elems + ROCBLAS_OFFLOAD_GEMM_PANELS * (a_elems + b_elems)) * sizeof(T);
+        if(query)
+            return handle->set_optimal_device_memory_size(size);
+
+        // The host waits for the device, which cannot be captured into a graph
+        if(handle->is_graph_safe())
+            return rocblas_status_not_implemented;
+
+        auto w_mem = handle->device_malloc(size);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        T* c_tile[2];
+        T* a_panel[ROCBLAS_OFFLOAD_GEMM_PANELS];
+        T* b_panel[ROCBLAS_OFFLOAD_GEMM_PANELS];
+        T* next = (T*)w_mem[0];
+        for(auto& c : c_tile)
+        {
+            c = next;
+            next += c_elems;
+        }
+        for(int b = 0; b < ROCBLAS_OFFLOAD_GEMM_PANELS; b++)
+        {
+            a_panel[b] = next;
+            b_panel[b] = next + a_elems;
+            next += a_elems + b_elems;
+        }
+
+        rocblas_offload_resources resources;
+        hipStream_t               compute_stream = handle->get_stream();
+        hipStream_t               upload_stream, download_stream;
+        hipEvent_t                copied[ROCBLAS_OFFLOAD_GEMM_PANELS];
+        hipEvent_t                consumed[ROCBLAS_OFFLOAD_GEMM_PANELS];
+        hipEvent_t                uploaded[2], computed[2], downloaded[2];
+        RETURN_IF_HIP_ERROR(resources.create_stream(upload_stream));
+        RETURN_IF_HIP_ERROR(resources.create_stream(download_stream));
+        for(int b = 0; b < ROCBLAS_OFFLOAD_GEMM_PANELS; b++)
+        {
+            RETURN_IF_HIP_ERROR(resources.create_event(copied[b]));
+            RETURN_IF_HIP_ERROR(resources.create_event(consumed[b]));
+        }
+        for(int c = 0; c < 2; c++)
+        {
+            RETURN_IF_HIP_ERROR(resources.create_event(uploaded[c]));
+            RETURN_IF_HIP_ERROR(resources.create_event(computed[c]));
+            RETURN_IF_HIP_ERROR(resources.create_event(downloaded[c]));
+        }
+        RETURN_IF_HIP_ERROR(resources.wait_for(upload_stream, compute_stream));
+
+        // Copy the rows x cols block at src of a column major matrix to the packed dst
+        const size_t elem = sizeof(T);
+        auto         copy = [&](T*          dst,
+                        const T*    src,
+                        rocblas_int ld,
+                        rocblas_int rows,
+                        rocblas_int cols,
+                        hipStream_t stream) {
+            return hipMemcpy2DAsync(
+                dst, rows * elem, src, ld * elem, rows * elem, cols, hipMemcpyDefault, stream);
+        };
+
+        const T           one    = 1;
+        const rocblas_int panels = k ? (k - 1) / kb + 1 : 1;
+        size_t            tile   = 0;
+        size_t            step   = 0;
+
+        for(rocblas_int c0 = 0; c0 < n; c0 += nb)
+        {
+            for(rocblas_int r0 = 0; r0 < m; r0 += mb, tile++)
+            {
+                const int         c      = tile % 2;
+                const rocblas_int mi     = std::min(mb, m - r0);
+                const rocblas_int nj     = std::min(nb, n - c0);
+                T*                c_host = C + r0 + size_t(c0) * ldc;
+
+                // The tile is reused once the results of the tile two back are downloaded
+                if(*beta != 0)
+                {
+                    if(tile >= 2)
+                        RETURN_IF_HIP_ERROR(hipStreamWaitEvent(upload_stream, downloaded[c], 0));
+                    RETURN_IF_HIP_ERROR(copy(c_tile[c], c_host, ldc, mi, nj, upload_stream));
+                    RETURN_IF_HIP_ERROR(hipEventRecord(uploaded[c], upload_stream));
+                    RETURN_IF_HIP_ERROR(hipStreamWaitEvent(compute_stream, uploaded[c], 0));
+                }
+                else if(tile >= 2)
+                    RETURN_IF_HIP_ERROR(hipStreamWaitEvent(compute_stream, downloaded[c], 0));
+
+                for(rocblas_int p = 0; p < panels; p++, step++)
+                {
+                    const int         b  = step % ROCBLAS_OFFLOAD_GEMM_PANELS;
+                    const rocblas_int k0 = p * kb;
+                    const rocblas_int kp = std::min(kb, k - k0);
+
+                    // op( A ) rows r0..r0+mi, columns k0..k0+kp; op( B ) rows k0..k0+kp,
+                    // columns c0..c0+nj
+                    const bool        a_none = trans_a == rocblas_operation_none;
+                    const bool        b_none = trans_b == rocblas_operation_none;
+                    const rocblas_int lda_p  = a_none ? mi : kp;
+                    const rocblas_int ldb_p  = b_none ? kp : nj;
+
+                    if(kp)
+                    {
+                        // The panels are reused once the GEMM ROCBLAS_OFFLOAD_GEMM_PANELS
+                        // steps back has consumed them
+                        if(step >= ROCBLAS_OFFLOAD_GEMM_PANELS)
+                            RETURN_IF_HIP_ERROR(
+                                hipStreamWaitEvent(upload_stream, consumed[b], 0));
+
+                        if(a_none)
+                            RETURN_IF_HIP_ERROR(copy(
+                                a_panel[b], A + r0 + size_t(k0) * lda, lda, mi, kp, upload_stream));
+                        else
+                            RETURN_IF_HIP_ERROR(copy(
+                                a_panel[b], A + k0 + size_t(r0) * lda, lda, kp, mi, upload_stream));
+
+                        if(b_none)
+                            RETURN_IF_HIP_ERROR(copy(
+                                b_panel[b], B + k0 + size_t(c0) * ldb, ldb, kp, nj, upload_stream));
+                        else
+                            RETURN_IF_HIP_ERROR(copy(
+                                b_panel[b], B + c0 + size_t(k0) * ldb, ldb, nj, kp, upload_stream));
+
+                        RETURN_IF_HIP_ERROR(hipEventRecord(copied[b], upload_stream));
+                        RETURN_IF_HIP_ERROR(hipStreamWaitEvent(compute_stream, copied[b], 0));
+                    }
+
+                    RETURN_IF_ROCBLAS_ERROR(
+                        rocblas_internal_gemm_template<false>(handle,
+                                                              trans_a,
+                                                              trans_b,
+                                                              mi,
+                                                              nj,
+                                                              kp,
+                                                              alpha,
+                                                              (const T*)a_panel[b],
+                                                              0,
+                                                              std::max(lda_p, 1),
+                                                              0,
+                                                              (const T*)b_panel[b],
+                                                              0,
+                                                              std::max(ldb_p, 1),
+                                                              0,
+                                                              p ? &one : beta,
+                                                              c_tile[c],
+                                                              0,
+                                                              mi,
+                                                              0,
+                                                              1));
+
+                    RETURN_IF_HIP_ERROR(hipEventRecord(consumed[b], compute_stream));
+                }
+
+                RETURN_IF_HIP_ERROR(hipEventRecord(computed[c], compute_stream));
+                RETURN_IF_HIP_ERROR(hipStreamWaitEvent(download_stream, computed[c], 0));
+                RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(c_host,
+                                                     ldc * elem,
+                                                     c_tile[c],
+                                                     mi * elem,
+                                                     mi * elem,
+                                                     nj,
+                                                     hipMemcpyDefault,
+                                                     download_stream));
+                RETURN_IF_HIP_ERROR(hipEventRecord(downloaded[c], download_stream));
+            }
+        }
+
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(download_stream));
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_gemm_offload_impl(rocblas_handle    handle,
+                                             rocblas_operation trans_a,
+                                             rocblas_operation trans_b,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             rocblas_int       k,
+                                             const T*          alpha,
+                                             const T*          A,
+                                             rocblas_int       lda,
+                                             const T*          B,
+                                             rocblas_int       ldb,
+                                             const T*          beta,
+                                             T*                C,
+                                             rocblas_int       ldc)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // alpha and beta are always on the host
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(!handle->is_device_memory_size_query()
+           && (handle->layer_mode & rocblas_layer_mode_log_trace))
+            log_trace(handle,
+                      rocblas_gemm_offload_name<T>,
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      A,
+                      lda,
+                      B,
+                      ldb,
+                      LOG_TRACE_SCALAR_VALUE(handle, beta),
+                      C,
+                      ldc);
+
+        auto validArgs = rocblas_validateArgs(
+            handle, trans_a, trans_b, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        if(validArgs != rocblas_status_continue)
+            return rocblas_offload_quick_return(handle, validArgs);
+
+        auto saved_device_id = handle->push_device_id();
+
+        // Without alpha*op( A )*op( B ) the panels are neither copied nor multiplied
+        rocblas_int k_used = *alpha != 0 ? k : 0;
+
+        // Matrices the copy engines access directly are computed out of core, with the tiles
+        // of C resident on the device; pageable host memory goes through the pinned staging of
+        // the tile pipeline
+        const int device = handle->getDevice();
+        if(rocblas_offload_is_direct(C, device)
+           && (!k_used
+               || (rocblas_offload_is_direct(A, device) && rocblas_offload_is_direct(B, device))))
+            return rocblas_offload_gemm_resident(
+                handle, trans_a, trans_b, m, n, k_used, alpha, A, lda, B, ldb, beta, C, ldc);
+
+        size_t slot_budget = rocblas_offload_slot_budget<T>(handle, 0);
+        auto        tiles       = rocblas_offload_gemm_tiles(
+            slot_budget, trans_a, trans_b, m, n, k_used, A, lda, B, ldb, *beta != 0, C, ldc);
+        if(tiles.empty())
+            return rocblas_status_memory_error;
+
+        auto compute = [&](const rocblas_offload_tile<T>& tile, T* const* dev) {
+            return rocblas_offload_gemm_compute(handle, trans_a, trans_b, alpha, beta, tile, dev);
+        };
+
+        size_t slot_elems = rocblas_offload_slot_count(tiles);
+        auto   run = [&](rocblas_offload_pipeline& pipeline, T* slots, void*, void*) {
+            return rocblas_offload_run(handle, pipeline, slots, slot_elems, tiles, compute);
+        };
+        return rocblas_offload_execute<T>(handle, slot_elems, 0, 0, run);
+    }
+
+    template <rocblas_int NB, typename T>
+    rocblas_status rocblas_syrk_offload_impl(rocblas_handle    handle,
+                                             rocblas_fill      uplo,
+                                             rocblas_operation trans_a,
+                                             rocblas_int       n,
+                                             rocblas_int       k,
+                                             const T*          alpha,
+                                             const T*          A,
+                                             rocblas_int       lda,
+                                             const T*          beta,
+                                             T*                C,
+                                             rocblas_int       ldc)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // alpha and beta are always on the host
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(!handle->is_device_memory_size_query()
+           && (handle->layer_mode & rocblas_layer_mode_log_trace))
+            log_trace(handle,
+                      rocblas_syrk_offload_name<T>,
+                      uplo,
+                      trans_a,
+                      n,
+                      k,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      A,
+                      lda,
+                      LOG_TRACE_SCALAR_VALUE(handle, beta),
+                      C,
+                      ldc);
+
+        rocblas_status arg_status = rocblas_syrk_arg_check(
+            handle, uplo, trans_a, n, k, alpha, A, 0, lda, 0, beta, C, 0, ldc, 0, 1);
+        if(arg_status != rocblas_status_continue)
+            return rocblas_offload_quick_return(handle, arg_status);
+
+        if(!rocblas_is_complex<T> && trans_a == rocblas_operation_conjugate_transpose)
+            trans_a = rocblas_operation_transpose;
+
+        auto saved_device_id = handle->push_device_id();
+
+        // Square tiles of the triangle of C, each with the panels of op( A ) of its rows and
+        // of its columns; diagonal tiles only need one panel
+        rocblas_int k_used = *alpha != 0 ? k : 0;
+        rocblas_int mb, nb;
+        if(!rocblas_offload_gemm_tile_sizes(
+               rocblas_offload_slot_budget<T>(handle, 0), n, n, k_used, mb, nb))
+            return rocblas_status_memory_error;
+        const rocblas_int tb = std::min(mb, nb);
+
+        auto panel = [&](rocblas_int r0, rocblas_int rows) {
+            return trans_a == rocblas_operation_none
+                       ? rocblas_offload_input(A + r0, rows, k_used, lda)
+                       : rocblas_offload_input(A + size_t(r0) * lda, k_used, rows, lda);
+        };
+
+        std::vector<rocblas_offload_tile<T>> tiles;
+        const bool                           upper = uplo == rocblas_fill_upper;
+        for(rocblas_int c0 = 0; c0 < n; c0 += tb)
+        {
+            for(rocblas_int r0 = upper ? 0 : c0; upper ? r0 <= c0 : r0 < n; r0 += tb)
+            {
+                rocblas_offload_tile<T> tile;
+                tile.m         = std::min(tb, n - r0);
+                tile.n         = std::min(tb, n - c0);
+                tile.k         = k_used;
+                tile.diagonal  = r0 == c0;
+                tile.blocks[0] = panel(r0, tile.m);
+                if(!tile.diagonal)
+                    tile.blocks[1] = panel(c0, tile.n);
+
+                auto& c    = tile.blocks[2];
+                c.host     = C + r0 + size_t(c0) * ldc;
+                c.rows     = tile.m;
+                c.cols     = tile.n;
+                c.ld       = ldc;
+                c.upload   = *beta != 0;
+                c.download = true;
+
+                tiles.push_back(tile);
+            }
+        }
+
+        // Tiles off the diagonal are op( A ) panel products, op( A )_i*op( A )_j^T
+        const rocblas_operation trans_i = trans_a == rocblas_operation_none
+                                              ? rocblas_operation_none
+                                              : rocblas_operation_transpose;
+        const rocblas_operation trans_j = trans_a == rocblas_operation_none
+                                              ? rocblas_operation_transpose
+                                              : rocblas_operation_none;
+
+        auto compute = [&](const rocblas_offload_tile<T>& tile, T* const* dev) {
+            if(!tile.diagonal)
+                return rocblas_offload_gemm_compute(
+                    handle, trans_i, trans_j, alpha, beta, tile, dev);
+
+            return rocblas_internal_syrk_template<NB, false, T>(handle,
+                                                                uplo,
+                                                                trans_a,
+                                                                tile.m,
+                                                                tile.k,
+                                                                alpha,
+                                                                (const T*)dev[0],
+                                                                0,
+                                                                tile.blocks[0].device_ld(),
+                                                                0,
+                                                                beta,
+                                                                dev[2],
+                                                                0,
+                                                                tile.blocks[2].device_ld(),
+                                                                0,
+                                                                1);
+        };
+
+        size_t slot_elems = rocblas_offload_slot_count(tiles);
+        auto   run = [&](rocblas_offload_pipeline& pipeline, T* slots, void*, void*) {
+            return rocblas_offload_run(handle, pipeline, slots, slot_elems, tiles, compute);
+        };
+        return rocblas_offload_execute<T>(handle, slot_elems, 0, 0, run);
+    }
+
+    /*******************************************************************************
+     * Blocked substitution over the diagonal blocks of op( A ), in the order of its
+     * dependencies: forward when the solution of a block only depends on the blocks before
+     * it. Each step solves the block rows (side left) or block columns (side right) of B
+     * of one diagonal block with trsm, streamed in chunks together with the diagonal block,
+     * and then subtracts their contribution from the blocks not solved yet with an offload
+     * GEMM. The first step applies alpha to all of B.
+     ******************************************************************************/
+    template <rocblas_int DIM_X, typename T>
+    rocblas_status rocblas_trsm_offload_impl(rocblas_handle    handle,
+                                             rocblas_side      side,
+                                             rocblas_fill      uplo,
+                                             rocblas_operation trans_a,
+                                             rocblas_diagonal  diag,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             const T*          alpha,
+                                             const T*          A,
+                                             rocblas_int       lda,
+                                             T*                B,
+                                             rocblas_int       ldb)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // alpha is always on the host
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(!handle->is_device_memory_size_query()
+           && (handle->layer_mode & rocblas_layer_mode_log_trace))
+            log_trace(handle,
+                      rocblas_trsm_offload_name<T>,
+                      side,
+                      uplo,
+                      trans_a,
+                      diag,
+                      m,
+                      n,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      A,
+                      lda,
+                      B,
+                      ldb);
+
+        rocblas_status arg_status = rocblas_trsm_arg_check(
+            handle, side, uplo, trans_a, diag, m, n, alpha, A, lda, B, ldb, 1);
+        if(arg_status != rocblas_status_continue)
+            return rocblas_offload_quick_return(handle, arg_status);
+
+        if(*alpha == 0)
+        {
+            if(handle->is_device_memory_size_query())
+                return rocblas_status_size_unchanged;
+            for(rocblas_int j = 0; j < n; j++)
+                std::fill_n(B + size_t(j) * ldb, m, T(0));
+            return rocblas_status_success;
+        }
+
+        if(!rocblas_is_complex<T> && trans_a == rocblas_operation_conjugate_transpose)
+            trans_a = rocblas_operation_transpose;
+
+        auto saved_device_id = handle->push_device_id();
+
+        // op( A ) is lower triangular when A is lower and not transposed, or upper and
+        // transposed. Block rows of X depend on the block rows before them for a lower op( A )
+        // on the left, and block columns before them for an upper op( A ) on the right.
+        const bool        left       = side == rocblas_side_left;
+        const bool        transposed = trans_a != rocblas_operation_none;
+        const bool        lower      = (uplo == rocblas_fill_lower) != transposed;
+        const bool        forward    = left == lower;
+        const rocblas_int ka         = left ? m : n;
+        const rocblas_int other      = left ? n : m;
+
+        // Diagonal block order nb, and the chunk of its block rows or columns of B solved per
+        // tile, with at least as many elements in the chunk as in the diagonal block
+        rocblas_int nb = 0, chunk = 0;
+        size_t      w_x_temp_size = 0, w_invA_size = 0, slot_budget = 0;
+        for(int pass = 0; pass < 2; pass++)
+        {
+            // The second pass leaves room for the trsm workspace sized in the first
+            slot_budget = rocblas_offload_slot_budget<T>(handle, w_x_temp_size + w_invA_size);
+            nb          = rocblas_int(std::min({int64_t(ROCBLAS_OFFLOAD_TRSM_NB),
+                                       int64_t(ka),
+                                       int64_t(std::sqrt(double(slot_budget) / 2))}));
+            if(nb <= 0)
+                return rocblas_status_memory_error;
+            chunk = rocblas_offload_round((int64_t(slot_budget) - int64_t(nb) * nb) / nb, other);
+
+            w_x_temp_size = w_invA_size = 0;
+            for(rocblas_int kb : {nb, ka % nb})
+            {
+                for(rocblas_int ob : {chunk, other % chunk})
+                {
+                    if(!kb || !ob)
+                        continue;
+                    size_t x_temp, x_temp_arr, invA, invA_arr, x_temp_backup;
+                    rocblas_status status
+                        = rocblas_internal_trsm_workspace_size<ROCBLAS_TRSM_NB, false, T>(
+                            side,
+                            trans_a,
+                            left ? kb : ob,
+                            left ? ob : kb,
+                            1,
+                            0,
+                            &x_temp,
+                            &x_temp_arr,
+                            &invA,
+                            &invA_arr,
+                            &x_temp_backup);
+                    if(status == rocblas_status_success)
+                    {
+                        w_x_temp_size = std::max(w_x_temp_size, x_temp);
+                        w_invA_size   = std::max(w_invA_size, invA);
+                    }
+                    else if(status != rocblas_status_continue)
+                        return status;
+                }
+            }
+        }
+
+        const rocblas_int blocks    = (ka - 1) / nb + 1;
+        const T           one       = 1;
+        const T           minus_one = -1;
+
+        // op( A ) element (r0, c0) of the host matrix
+        auto op_a = [&](rocblas_int r0, rocblas_int c0) {
+            return transposed ? A + c0 + size_t(r0) * lda : A + r0 + size_t(c0) * lda;
+        };
+
+        // Tiles of the solve of diagonal block blk: chunks of B with the diagonal block
+        auto solve_tiles = [&](rocblas_int blk) {
+            const rocblas_int i0 = blk * nb, ib = std::min(nb, ka - i0);
+
+            std::vector<rocblas_offload_tile<T>> tiles;
+            for(rocblas_int o0 = 0; o0 < other; o0 += chunk)
+            {
+                const rocblas_int ob = std::min(chunk, other - o0);
+
+                rocblas_offload_tile<T> tile;
+                tile.m         = left ? ib : ob;
+                tile.n         = left ? ob : ib;
+                tile.blocks[0] = rocblas_offload_input(A + i0 + size_t(i0) * lda, ib, ib, lda);
+
+                auto& b    = tile.blocks[2];
+                b.host     = left ? B + i0 + size_t(o0) * ldb : B + o0 + size_t(i0) * ldb;
+                b.rows     = tile.m;
+                b.cols     = tile.n;
+                b.ld       = ldb;
+                b.upload   = true;
+                b.download = true;
+
+                tiles.push_back(tile);
+            }
+            return tiles;
+        };
+
+        // Tiles of the update of the blocks not solved yet, B_rest -= op( A ) X_blk (side
+        // left) or X_blk op( A ) (side right), scaling them by alpha in the first step
+        auto update_tiles = [&](rocblas_int blk) {
+            const rocblas_int i0 = blk * nb, ib = std::min(nb, ka - i0);
+            const rocblas_int r0 = forward ? i0 + ib : 0;
+            const rocblas_int r1 = forward ? ka : i0;
+
+            if(r0 >= r1)
+                return std::vector<rocblas_offload_tile<T>>();
+            if(left)
+                return rocblas_offload_gemm_tiles(slot_budget,
+                                                  trans_a,
+                                                  rocblas_operation_none,
+                                                  r1 - r0,
+                                                  n,
+                                                  ib,
+                                                  op_a(r0, i0),
+                                                  lda,
+                                                  (const T*)B + i0,
+                                                  ldb,
+                                                  true,
+                                                  B + r0,
+                                                  ldb);
+            else
+                return rocblas_offload_gemm_tiles(slot_budget,
+                                                  rocblas_operation_none,
+                                                  trans_a,
+                                                  m,
+                                                  r1 - r0,
+                                                  ib,
+                                                  (const T*)B + size_t(i0) * ldb,
+                                                  ldb,
+                                                  op_a(i0, r0),
+                                                  lda,
+                                                  true,
+                                                  B + size_t(r0) * ldb,
+                                                  ldb);
+        };
+
+        // Both run through the same slots, sized for the largest tile of any step
+        size_t slot_elems = 0;
+        for(rocblas_int blk = 0; blk < blocks; blk++)
+        {
+            auto update = update_tiles(blk);
+            if(update.empty() && (forward ? blk < blocks - 1 : blk > 0))
+                return rocblas_status_memory_error;
+            slot_elems = std::max(slot_elems, rocblas_offload_slot_count(solve_tiles(blk)));
+            slot_elems = std::max(slot_elems, rocblas_offload_slot_count(update));
+        }
+
+        auto run = [&](rocblas_offload_pipeline& pipeline,
+                       T*                        slots,
+                       void*                     w_x_temp,
+                       void*                     w_invA) -> rocblas_status {
+            const T* step_alpha = alpha;
+
+            auto solve = [&](const rocblas_offload_tile<T>& tile, T* const* dev) {
+                return rocblas_internal_trsm_template<ROCBLAS_TRSM_NB, DIM_X, false, T>(
+                    handle,
+                    side,
+                    uplo,
+                    trans_a,
+                    diag,
+                    tile.m,
+                    tile.n,
+                    step_alpha,
+                    (const T*)dev[0],
+                    0,
+                    tile.blocks[0].device_ld(),
+                    0,
+                    dev[2],
+                    0,
+                    tile.blocks[2].device_ld(),
+                    0,
+                    1,
+                    true,
+                    w_x_temp,
+                    nullptr,
+                    w_invA,
+                    nullptr);
+            };
+
+            auto update = [&](const rocblas_offload_tile<T>& tile, T* const* dev) {
+                return rocblas_offload_gemm_compute(handle,
+                                                    left ? trans_a : rocblas_operation_none,
+                                                    left ? rocblas_operation_none : trans_a,
+                                                    &minus_one,
+                                                    step_alpha,
+                                                    tile,
+                                                    dev);
+            };
+
+            for(rocblas_int step = 0; step < blocks; step++)
+            {
+                const rocblas_int blk = forward ? step : blocks - 1 - step;
+                step_alpha            = step ? &one : alpha;
+
+                RETURN_IF_ROCBLAS_ERROR(rocblas_offload_run(
+                    handle, pipeline, slots, slot_elems, solve_tiles(blk), solve));
+                RETURN_IF_ROCBLAS_ERROR(rocblas_offload_run(
+                    handle, pipeline, slots, slot_elems, update_tiles(blk), update));
+            }
+            return rocblas_status_success;
+        };
+
+        return rocblas_offload_execute<T>(handle, slot_elems, w_x_temp_size, w_invA_size, run);
+    }
+}
+
+/*******************************************************************************
+ * Offload APIs
+ ******************************************************************************/
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                      \
+    rocblas_status routine_name_(rocblas_handle    handle,                           \
+                                 rocblas_operation trans_a,                          \
+                                 rocblas_operation trans_b,                          \
+                                 rocblas_int       m,                                \
+                                 rocblas_int       n,                                \
+                                 rocblas_int       k,                                \
+                                 const T_*         alpha,                            \
+                                 const T_*         A,                                \
+                                 rocblas_int       lda,                              \
+                                 const T_*         B,                                \
+                                 rocblas_int       ldb,                              \
+                                 const T_*         beta,                             \
+                                 T_*               C,                                \
+                                 rocblas_int       ldc)                              \
+    try                                                                              \
+    {                                                                                \
+        return rocblas_gemm_offload_impl(                                            \
+            handle, trans_a, trans_b, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc); \
+    }                                                                                \
+    catch(...)                                                                       \
+    {                                                                                \
+        return exception_to_rocblas_status();                                        \
+    }
+
+IMPL(rocblas_sgemm_offload, float);
+IMPL(rocblas_dgemm_offload, double);
+IMPL(rocblas_cgemm_offload, rocblas_float_complex);
+IMPL(rocblas_zgemm_offload, rocblas_double_complex);
+
+#undef IMPL
+
+#define IMPL(routine_name_, DIM_X_, T_)                                      \
+    rocblas_status routine_name_(rocblas_handle    handle,                   \
+                                 rocblas_side      side,                     \
+                                 rocblas_fill      uplo,                     \
+                                 rocblas_operation trans_a,                  \
+                                 rocblas_diagonal  diag,                     \
+                                 rocblas_int       m,                        \
+                                 rocblas_int       n,                        \
+                                 const T_*         alpha,                    \
+                                 const T_*         A,                        \
+                                 rocblas_int       lda,                      \
+                                 T_*               B,                        \
+                                 rocblas_int       ldb)                      \
+    try                                                                      \
+    {                                                                        \
+        return rocblas_trsm_offload_impl<DIM_X_>(                            \
+            handle, side, uplo, trans_a, diag, m, n, alpha, A, lda, B, ldb); \
+    }                                                                        \
+    catch(...)                                                               \
+    {                                                                        \
+        return exception_to_rocblas_status();                                \
+    }
+
+IMPL(rocblas_strsm_offload, ROCBLAS_SDCTRSV_NB, float);
+IMPL(rocblas_dtrsm_offload, ROCBLAS_SDCTRSV_NB, double);
+IMPL(rocblas_ctrsm_offload, ROCBLAS_SDCTRSV_NB, rocblas_float_complex);
+IMPL(rocblas_ztrsm_offload, ROCBLAS_ZTRSV_NB, rocblas_double_complex);
+
+#undef IMPL
+
+#define IMPL(routine_name_, NB_, T_)                                   \
+    rocblas_status routine_name_(rocblas_handle    handle,             \
+                                 rocblas_fill      uplo,               \
+                                 rocblas_operation trans_a,            \
+                                 rocblas_int       n,                  \
+                                 rocblas_int       k,                  \
+                                 const T_*         alpha,              \
+                                 const T_*         A,                  \
+                                 rocblas_int       lda,                \
+                                 const T_*         beta,               \
+                                 T_*               C,                  \
+                                 rocblas_int       ldc)                \
+    try                                                                \
+    {                                                                  \
+        return rocblas_syrk_offload_impl<NB_>(                         \
+            handle, uplo, trans_a, n, k, alpha, A, lda, beta, C, ldc); \
+    }                                                                  \
+    catch(...)                                                         \
+    {                                                                  \
+        return exception_to_rocblas_status();                          \
+    }
+
+IMPL(rocblas_ssyrk_offload, ROCBLAS_SDZSYRK_NB, float);
+IMPL(rocblas_dsyrk_offload, ROCBLAS_SDZSYRK_NB, double);
+IMPL(rocblas_csyrk_offload, ROCBLAS_CSYRK_NB, rocblas_float_complex);
+IMPL(rocblas_zsyrk_offload, ROCBLAS_SDZSYRK_NB, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
@@ -0,0 +1,830 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "Tensile/gemm.hpp"
+#include "check_numerics_matrix.hpp"
+#include "check_numerics_vector.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas_block_sizes.h"
+#include "rocblas_rfp.hpp"
+#include "rocblas_syrk_herk.hpp"
+#include "rocblas_trsm.hpp"
+#include "utility.hpp"
+
+/*******************************************************************************
+ * Conversions between RFP format and full or packed storage, one thread per
+ * element of the triangle
+ ******************************************************************************/
+constexpr rocblas_int RFP_DIM_X = 64;
+constexpr rocblas_int RFP_DIM_Y = 4;
+
+template <rocblas_int DIM_X, rocblas_int DIM_Y, bool TO_RFP, bool PACKED, typename T>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_rfp_convert_kernel(
+    rocblas_rfp_layout rfp, rocblas_fill uplo, rocblas_int n, T* A, rocblas_int lda, T* ARF)
+{
+    rocblas_int i = blockIdx.x * DIM_X + threadIdx.x;
+    rocblas_int j = blockIdx.y * DIM_Y + threadIdx.y;
+    if(i >= n || j >= n || (uplo == rocblas_fill_lower ? i < j : i > j))
+        return;
+
+    bool           conj_rfp;
+    rocblas_stride r = rfp.index(uplo, i, j, conj_rfp);
+    size_t         a = !PACKED                        ? i + size_t(j) * lda
+                       : uplo == rocblas_fill_lower ? i + size_t(j) * (2 * size_t(n) - j - 1) / 2
+                                                    : i + size_t(j) * (j + 1) / 2;
+    if(TO_RFP)
+        ARF[r] = conj_rfp ? conj(A[a]) : A[a];
+    else
+        A[a] = conj_rfp ? conj(ARF[r]) : ARF[r];
+}
+
+// Scalars of the gemm updates of chfrk and zhfrk with device pointer mode
+template <typename T, typename U>
+ROCBLAS_KERNEL(1)
+rocblas_rfp_complex_scalars_kernel(const U* alpha, const U* beta, T* scalars)
+{
+    scalars[0] = T(*alpha);
+    scalars[1] = T(*beta);
+}
+
+// Constants -1 and 1 of tfsm with device pointer mode
+template <typename T>
+ROCBLAS_KERNEL(1)
+rocblas_rfp_unit_scalars_kernel(T* scalars)
+{
+    scalars[0] = T(-1);
+    scalars[1] = T(1);
+}
+
+namespace
+{
+    // transr is rocblas_operation_none, or conjugate transpose for complex types; real types
+    // accept both transposes
+    template <typename T>
+    bool rocblas_rfp_valid_op(rocblas_operation op)
+    {
+        return op == rocblas_operation_none || op == rocblas_operation_conjugate_transpose
+               || (!rocblas_is_complex<T> && op == rocblas_operation_transpose);
+    }
+
+    template <bool TO_RFP, bool PACKED, typename>
+    constexpr char rocblas_rfp_convert_name[] = "unknown";
+#define NAME(to_rfp_, packed_, T_, name_) \
+    template <>                           \
+    constexpr char rocblas_rfp_convert_name<to_rfp_, packed_, T_>[] = name_
+    NAME(true, false, float, "rocblas_strttf");
+    NAME(true, false, double, "rocblas_dtrttf");
+    NAME(true, false, rocblas_float_complex, "rocblas_ctrttf");
+    NAME(true, false, rocblas_double_complex, "rocblas_ztrttf");
+    NAME(false, false, float, "rocblas_stfttr");
+    NAME(false, false, double, "rocblas_dtfttr");
+    NAME(false, false, rocblas_float_complex, "rocblas_ctfttr");
+    NAME(false, false, rocblas_double_complex, "rocblas_ztfttr");
+    NAME(true, true, float, "rocblas_stpttf");
+    NAME(true, true, double, "rocblas_dtpttf");
+    NAME(true, true, rocblas_float_complex, "rocblas_ctpttf");
+    NAME(true, true, rocblas_double_complex, "rocblas_ztpttf");
+    NAME(false, true, float, "rocblas_stfttp");
+    NAME(false, true, double, "rocblas_dtfttp");
+    NAME(false, true, rocblas_float_complex, "rocblas_ctfttp");
+    NAME(false, true, rocblas_double_complex, "rocblas_ztfttp");
+#undef NAME
+
+    template <typename>
+    constexpr char rocblas_sfrk_name[] = "unknown";
+    template <>
+    constexpr char rocblas_sfrk_name<float>[] = "rocblas_ssfrk";
+    template <>
+    constexpr char rocblas_sfrk_name<double>[] = "rocblas_dsfrk";
+    template <>
+    constexpr char rocblas_sfrk_name<rocblas_float_complex>[] = "rocblas_chfrk";
+    template <>
+    constexpr char rocblas_sfrk_name<rocblas_double_complex>[] = "rocblas_zhfrk";
+
+    template <typename>
+    constexpr char rocblas_tfsm_name[] = "unknown";
+    template <>
+    constexpr char rocblas_tfsm_name<float>[] = "rocblas_stfsm";
+    template <>
+    constexpr char rocblas_tfsm_name<double>[] = "rocblas_dtfsm";
+    template <>
+    constexpr char rocblas_tfsm_name<rocblas_float_complex>[] = "rocblas_ctfsm";
+    template <>
+    constexpr char rocblas_tfsm_name<rocblas_double_complex>[] = "rocblas_ztfsm";
+
+    /***************************************************************************
+     * Copy the triangle uplo of the full (lda) or packed (PACKED) matrix A to
+     * or from (TO_RFP) the RFP array ARF
+     **************************************************************************/
+    template <bool TO_RFP, bool PACKED, typename T>
+    rocblas_status rocblas_rfp_convert_impl(rocblas_handle    handle,
+                                            rocblas_operation transr,
+                                            rocblas_fill      uplo,
+                                            rocblas_int       n,
+                                            T*                A,
+                                            rocblas_int       lda,
+                                            T*                ARF)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto name       = rocblas_rfp_convert_name<TO_RFP, PACKED, T>;
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(layer_mode & rocblas_layer_mode_log_trace)
+        {
+            if(PACKED)
+                log_trace(handle, name, transr, uplo, n, A, ARF);
+            else
+                log_trace(handle, name, transr, uplo, n, A, lda, ARF);
+        }
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        name,
+                        "transR",
+                        rocblas_transpose_letter(transr),
+                        "uplo",
+                        rocblas_fill_letter(uplo),
+                        "N",
+                        n,
+                        "lda",
+                        lda);
+
+        if(!rocblas_rfp_valid_op<T>(transr))
+            return rocblas_status_invalid_value;
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+        if(n < 0 || (!PACKED && lda < std::max(1, n)))
+            return rocblas_status_invalid_size;
+        if(!n)
+            return rocblas_status_success;
+        if(!A || !ARF)
+            return rocblas_status_invalid_pointer;
+
+        dim3 grid((n - 1) / RFP_DIM_X + 1, (n - 1) / RFP_DIM_Y + 1);
+        dim3 threads(RFP_DIM_X, RFP_DIM_Y);
+        ROCBLAS_LAUNCH_KERNEL((rocblas_rfp_convert_kernel<RFP_DIM_X, RFP_DIM_Y, TO_RFP, PACKED, T>),
+                              grid,
+                              threads,
+                              0,
+                              handle->get_stream(),
+                              rocblas_rfp_layout(transr != rocblas_operation_none, uplo, n),
+                              uplo,
+                              n,
+                              A,
+                              lda,
+                              ARF);
+        return rocblas_status_success;
+    }
+
+    /***************************************************************************
+     * C = alpha op( A ) op( A )^H + beta C with C in RFP format, as two syrk
+     * (herk for complex types) and one gemm on the blocks of C
+     **************************************************************************/
+    template <rocblas_int NB, typename T, typename U>
+    rocblas_status rocblas_sfrk_impl(rocblas_handle    handle,
+                                     rocblas_operation transr,
+                                     rocblas_fill      uplo,
+                                     rocblas_operation trans,
+                                     rocblas_int       n,
+                                     rocblas_int       k,
+                                     const U*          alpha,
+                                     const T*          A,
+                                     rocblas_int       lda,
+                                     const U*          beta,
+                                     T*                C)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        auto name           = rocblas_sfrk_name<T>;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      name,
+                      transr,
+                      uplo,
+                      trans,
+                      n,
+                      k,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      A,
+                      lda,
+                      LOG_TRACE_SCALAR_VALUE(handle, beta),
+                      C);
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        name,
+                        "transR",
+                        rocblas_transpose_letter(transr),
+                        "uplo",
+                        rocblas_fill_letter(uplo),
+                        "transA",
+                        rocblas_transpose_letter(trans),
+                        "N",
+                        n,
+                        "K",
+                        k,
+                        "lda",
+                        lda);
+
+        if(!rocblas_rfp_valid_op<T>(transr) || !rocblas_rfp_valid_op<T>(trans))
+            return rocblas_status_invalid_value;
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+        if(n < 0 || k < 0 || lda < std::max(1, trans == rocblas_operation_none ? n : k))
+            return rocblas_status_invalid_size;
+
+        // the gemm update of complex types takes complex scalars
+        const bool   device_scalars = handle->pointer_mode == rocblas_pointer_mode_device;
+        const size_t scalars_size   = rocblas_is_complex<T> && device_scalars ? 2 * sizeof(T) : 0;
+        if(handle->is_device_memory_size_query())
+        {
+            if(!n || !scalars_size)
+                return rocblas_status_size_unchanged;
+            return handle->set_optimal_device_memory_size(scalars_size);
+        }
+
+        if(!n)
+            return rocblas_status_success;
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+        if(!device_scalars)
+        {
+            if(*beta == 1 && (!k || *alpha == 0))
+                return rocblas_status_success;
+            if(!C || (k && *alpha != 0 && !A))
+                return rocblas_status_invalid_pointer;
+        }
+        else if(!C || (k && !A))
+            return rocblas_status_invalid_pointer;
+
+        if(!rocblas_is_complex<T> && trans != rocblas_operation_none)
+            trans = rocblas_operation_transpose;
+
+        const rocblas_rfp_layout rfp(transr != rocblas_operation_none, uplo, n);
+        const rocblas_int        size_C = rocblas_int(int64_t(n) * (n + 1) / 2);
+
+        auto check_inputs = [&](bool is_input) -> rocblas_status {
+            if(k && A)
+                RETURN_IF_ROCBLAS_ERROR(
+                    rocblas_internal_check_numerics_matrix_template(name,
+                                                                    handle,
+                                                                    trans,
+                                                                    rocblas_fill_full,
+                                                                    rocblas_client_general_matrix,
+                                                                    n,
+                                                                    k,
+                                                                    A,
+                                                                    0,
+                                                                    lda,
+                                                                    0,
+                                                                    1,
+                                                                    check_numerics,
+                                                                    is_input));
+            return rocblas_internal_check_numerics_vector_template(
+                name, handle, size_C, C, 0, 1, 0, 1, check_numerics, is_input);
+        };
+        if(check_numerics)
+            RETURN_IF_ROCBLAS_ERROR(check_inputs(true));
+
+        auto w_mem = handle->device_malloc(scalars_size);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        const T* gemm_alpha;
+        const T* gemm_beta;
+        T        host_scalars[2];
+        if constexpr(rocblas_is_complex<T>)
+        {
+            if(device_scalars)
+            {
+                ROCBLAS_LAUNCH_KERNEL((rocblas_rfp_complex_scalars_kernel<T, U>),
+                                      dim3(1),
+                                      dim3(1),
+                                      0,
+                                      handle->get_stream(),
+                                      alpha,
+                                      beta,
+                                      (T*)w_mem[0]);
+                gemm_alpha = (const T*)w_mem[0];
+                gemm_beta  = gemm_alpha + 1;
+            }
+            else
+            {
+                host_scalars[0] = T(*alpha);
+                host_scalars[1] = T(*beta);
+                gemm_alpha      = host_scalars;
+                gemm_beta       = host_scalars + 1;
+            }
+        }
+        else
+        {
+            gemm_alpha = alpha;
+            gemm_beta  = beta;
+        }
+
+        auto syrk = [&](rocblas_fill   block_uplo,
+                        rocblas_int    block_n,
+                        rocblas_stride offset_A,
+                        rocblas_stride offset_C) {
+            if constexpr(rocblas_is_complex<T>)
+                return rocblas_internal_herk_template<NB, false, T>(handle,
+                                                                    block_uplo,
+                                                                    trans,
+                                                                    block_n,
+                                                                    k,
+                                                                    alpha,
+                                                                    A,
+                                                                    offset_A,
+                                                                    lda,
+                                                                    0,
+                                                                    beta,
+                                                                    C,
+                                                                    offset_C,
+                                                                    rfp.ld,
+                                                                    0,
+                                                                    1);
+            else
+                return rocblas_internal_syrk_template<NB, false, T>(handle,
+                                                                    block_uplo,
+                                                                    trans,
+                                                                    block_n,
+                                                                    k,
+                                                                    alpha,
+                                                                    A,
+                                                                    offset_A,
+                                                                    lda,
+                                                                    0,
+                                                                    beta,
+                                                                    C,
+                                                                    offset_C,
+                                                                    rfp.ld,
+                                                                    0,
+                                                                    1);
+        };
+
+        auto gemm = [&](rocblas_operation trans_p,
+                        rocblas_operation trans_q,
+                        rocblas_int       m,
+                        rocblas_int       block_n,
+                        rocblas_stride    offset_P,
+                        rocblas_stride    offset_Q,
+                        rocblas_stride    offset_C) {
+            return rocblas_internal_gemm_template<false>(handle,
+                                                         trans_p,
+                                                         trans_q,
+                                                         m,
+                                                         block_n,
+                                                         k,
+                                                         gemm_alpha,
+                                                         A,
+                                                         offset_P,
+                                                         lda,
+                                                         0,
+                                                         A,
+                                                         offset_Q,
+                                                         lda,
+                                                         0,
+                                                         gemm_beta,
+                                                         C,
+                                                         offset_C,
+                                                         rfp.ld,
+                                                         0,
+                                                         1);
+        };
+
+        RETURN_IF_ROCBLAS_ERROR(rocblas_rfp_sfrk_steps(
+            rfp, uplo, trans, rocblas_is_complex<T>, lda, syrk, gemm));
+
+        if(check_numerics)
+            RETURN_IF_ROCBLAS_ERROR(check_inputs(false));
+        return rocblas_status_success;
+    }
+
+    /***************************************************************************
+     * Solve op( A ) X = alpha B or X op( A ) = alpha B with A in RFP format, as
+     * two trsm with its diagonal blocks and one gemm with its off-diagonal block
+     **************************************************************************/
+    template <rocblas_int DIM_X, typename T>
+    rocblas_status rocblas_tfsm_impl(rocblas_handle    handle,
+                                     rocblas_operation transr,
+                                     rocblas_side      side,
+                                     rocblas_fill      uplo,
+                                     rocblas_operation trans,
+                                     rocblas_diagonal  diag,
+                                     rocblas_int       m,
+                                     rocblas_int       n,
+                                     const T*          alpha,
+                                     const T*          A,
+                                     T*                B,
+                                     rocblas_int       ldb)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        auto name           = rocblas_tfsm_name<T>;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      name,
+                      transr,
+                      side,
+                      uplo,
+                      trans,
+                      diag,
+                      m,
+                      n,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      A,
+                      B,
+                      ldb);
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        name,
+                        "transR",
+                        rocblas_transpose_letter(transr),
+                        "side",
+                        rocblas_side_letter(side),
+                        "uplo",
+                        rocblas_fill_letter(uplo),
+                        "transA",
+                        rocblas_transpose_letter(trans),
+                        "diag",
+                        rocblas_diag_letter(diag),
+                        "M",
+                        m,
+                        "N",
+                        n,
+                        "ldb",
+                        ldb);
+
+        if(!rocblas_rfp_valid_op<T>(transr) || !rocblas_rfp_valid_op<T>(trans))
+            return rocblas_status_invalid_value;
+        if(side != rocblas_side_left && side != rocblas_side_right)
+            return rocblas_status_invalid_value;
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+        if(diag != rocblas_diagonal_unit && diag != rocblas_diagonal_non_unit)
+            return rocblas_status_invalid_value;
+        if(m < 0 || n < 0 || ldb < std::max(1, m))
+            return rocblas_status_invalid_size;
+
+        if(!rocblas_is_complex<T> && trans != rocblas_operation_none)
+            trans = rocblas_operation_transpose;
+
+        const bool               left = side == rocblas_side_left;
+        const rocblas_int        k    = left ? m : n;
+        const rocblas_rfp_layout rfp(transr != rocblas_operation_none, uplo, k);
+
+        // trsm workspace for the larger of the solves with the diagonal blocks
+        size_t w_x_temp_size = 0, w_invA_size = 0;
+        for(auto block : {std::make_pair(rfp.a11, rfp.n1), std::make_pair(rfp.a22, rfp.n2)})
+        {
+            if(!block.second || !m || !n)
+                continue;
+            size_t         x_temp, x_temp_arr, invA, invA_arr, x_temp_backup;
+            rocblas_status status = rocblas_internal_trsm_workspace_size<ROCBLAS_TRSM_NB, false, T>(
+                side,
+                rocblas_rfp_block_op(block.first, trans, rocblas_is_complex<T>),
+                left ? block.second : m,
+                left ? n : block.second,
+                1,
+                0,
+                &x_temp,
+                &x_temp_arr,
+                &invA,
+                &invA_arr,
+                &x_temp_backup);
+            if(status == rocblas_status_success)
+            {
+                w_x_temp_size = std::max(w_x_temp_size, x_temp);
+                w_invA_size   = std::max(w_invA_size, invA);
+            }
+            else if(status != rocblas_status_continue)
+                return status;
+        }
+
+        // the gemm update and the second solve take the constants -1 and 1
+        const bool   device_scalars = handle->pointer_mode == rocblas_pointer_mode_device;
+        const size_t scalars_size   = device_scalars ? 2 * sizeof(T) : 0;
+        if(handle->is_device_memory_size_query())
+        {
+            if(!m || !n)
+                return rocblas_status_size_unchanged;
+            return handle->set_optimal_device_memory_size(
+                w_x_temp_size, w_invA_size, scalars_size);
+        }
+
+        if(!m || !n)
+            return rocblas_status_success;
+        if(!alpha || !A || !B)
+            return rocblas_status_invalid_pointer;
+
+        const rocblas_int size_A = rocblas_int(int64_t(k) * (k + 1) / 2);
+        auto              check_inputs = [&](bool is_input) -> rocblas_status {
+            if(is_input)
+                RETURN_IF_ROCBLAS_ERROR(rocblas_internal_check_numerics_vector_template(
+                    name, handle, size_A, A, 0, 1, 0, 1, check_numerics, is_input));
+            return rocblas_internal_check_numerics_matrix_template(name,
+                                                                   handle,
+                                                                   rocblas_operation_none,
+                                                                   rocblas_fill_full,
+                                                                   rocblas_client_general_matrix,
+                                                                   m,
+                                                                   n,
+                                                                   B,
+                                                                   0,
+                                                                   ldb,
+                                                                   0,
+                                                                   1,
+                                                                   check_numerics,
+                                                                   is_input);
+        };
+        if(check_numerics)
+            RETURN_IF_ROCBLAS_ERROR(check_inputs(true));
+
+        auto w_mem = handle->device_malloc(w_x_temp_size, w_invA_size, scalars_size);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        static const T host_scalars[2] = {T(-1), T(1)};
+        const T*       minus_one       = host_scalars;
+        if(device_scalars)
+        {
+            ROCBLAS_LAUNCH_KERNEL(rocblas_rfp_unit_scalars_kernel<T>,
+                                  dim3(1),
+                                  dim3(1),
+                                  0,
+                                  handle->get_stream(),
+                                  (T*)w_mem[2]);
+            minus_one = (const T*)w_mem[2];
+        }
+        const T* one = minus_one + 1;
+
+        auto trsm = [&](rocblas_fill      block_uplo,
+                        rocblas_operation block_trans,
+                        rocblas_int       block_m,
+                        rocblas_int       block_n,
+                        rocblas_stride    offset_A,
+                        rocblas_stride    offset_B,
+                        bool              scaled) {
+            return rocblas_internal_trsm_template<ROCBLAS_TRSM_NB, DIM_X, false, T>(
+                handle,
+                side,
+                block_uplo,
+                block_trans,
+                diag,
+                block_m,
+                block_n,
+                scaled ? alpha : one,
+                A,
+                offset_A,
+                rfp.ld,
+                0,
+                B,
+                offset_B,
+                ldb,
+                0,
+                1,
+                true,
+                w_mem[0],
+                nullptr,
+                w_mem[1],
+                nullptr);
+        };
+
+        // B = -op( S ) X + alpha B (side left) or B = -X op( S ) + alpha B (side right)
+        auto gemm = [&](rocblas_operation trans_s,
+                        rocblas_int       block_m,
+                        rocblas_int       block_n,
+                        rocblas_int       block_k,
+                        rocblas_stride    offset_S,
+                        rocblas_stride    offset_X,
+                        rocblas_stride    offset_B) {
+            return rocblas_internal_gemm_template<false>(handle,
+                                                         left ? trans_s : rocblas_operation_none,
+                                                         left ? rocblas_operation_none : trans_s,
+                                                         block_m,
+                                                         block_n,
+                                                         block_k,
+                                                         minus_one,
+                                                         left ? A : (const T*)B,
+                                                         left ? offset_S : offset_X,
+                                                         left ? rfp.ld : ldb,
+                                                         0,
+                                                         left ? (const T*)B : A,
+                                                         left ? offset_X : offset_S,
+                                                         left ? ldb : rfp.ld,
+                                                         0,
+                                                         alpha,
+                                                         B,
+                                                         offset_B,
+                                                         ldb,
+                                                         0,
+                                                         1);
+        };
+
+        RETURN_IF_ROCBLAS_ERROR(rocblas_rfp_tfsm_steps(
+            rfp, side, uplo, trans, rocblas_is_complex<T>, m, n, ldb, trsm, gemm));
+
+        if(check_numerics)
+            RETURN_IF_ROCBLAS_ERROR(check_inputs(false));
+        return rocblas_status_success;
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                             \
+    rocblas_status routine_name_(rocblas_handle    handle,                                  \
+                                 rocblas_operation transr,                                  \
+                                 rocblas_fill      uplo,                                    \
+                                 rocblas_int       n,                                       \
+                                 const T_*         A,                                       \
+                                 rocblas_int       lda,                                     \
+                                 T_*               ARF)                                     \
+    try                                                                                     \
+    {                                                                                       \
+        return rocblas_rfp_convert_impl<true, false>(                                       \
+            handle, transr, uplo, n, const_cast<T_*>(A), lda, ARF);                         \
+    }                                                                                       \
+    catch(...)                                                                              \
+    {                                                                                       \
+        return exception_to_rocblas_status();                                               \
+    }
+
+IMPL(rocblas_strttf, float);
+IMPL(rocblas_dtrttf, double);
+IMPL(rocblas_ctrttf, rocblas_float_complex);
+IMPL(rocblas_ztrttf, rocblas_double_complex);
+
+#undef IMPL
+
+#define IMPL(routine_name_, T_)                                                             \
+    rocblas_status routine_name_(rocblas_handle    handle,                                  \
+                                 rocblas_operation transr,                                  \
+                                 rocblas_fill      uplo,                                    \
+                                 rocblas_int       n,                                       \
+                                 const T_*         ARF,                                     \
+                                 T_*               A,                                       \
+                                 rocblas_int       lda)                                     \
+    try                                                                                     \
+    {                                                                                       \
+        return rocblas_rfp_convert_impl<false, false>(                                      \
+            handle, transr, uplo, n, A, lda, const_cast<T_*>(ARF));                         \
+    }                                                                                       \
+    catch(...)                                                                              \
+    {                                                                                       \
+        return exception_to_rocblas_status();                                               \
+    }
+
+IMPL(rocblas_stfttr, float);
+IMPL(rocblas_dtfttr, double);
+IMPL(rocblas_ctfttr, rocblas_float_complex);
+IMPL(rocblas_ztfttr, rocblas_double_complex);
+
+#undef IMPL
+
+#define IMPL(routine_name_, T_)                                                             \
+    rocblas_status routine_name_(rocblas_handle    handle,                                  \
+                                 rocblas_operation transr,                                  \
+                                 rocblas_fill      uplo,                                    \
+                                 rocblas_int       n,                                       \
+                                 const T_*         AP,                                      \
+                                 T_*               ARF)                                     \
+    try                                                                                     \
+    {                                                                                       \
+        return rocblas_rfp_convert_impl<true, true>(                                        \
+            handle, transr, uplo, n, const_cast<T_*>(AP), 1, ARF);                          \
+    }                                                                                       \
+    catch(...)                                                                              \
+    {                                                                                       \
+        return exception_to_rocblas_status();                                               \
+    }
+
+IMPL(rocblas_stpttf, float);
+IMPL(rocblas_dtpttf, double);
+IMPL(rocblas_ctpttf, rocblas_float_complex);
+IMPL(rocblas_ztpttf, rocblas_double_complex);
+
+#undef IMPL
+
+#define IMPL(routine_name_, T_)                                                             \
+    rocblas_status routine_name_(rocblas_handle    handle,                                  \
+                                 rocblas_operation transr,                                  \
+                                 rocblas_fill      uplo,                                    \
+                                 rocblas_int       n,                                       \
+                                 const T_*         ARF,                                     \
+                                 T_*               AP)                                      \
+    try                                                                                     \
+    {                                                                                       \
+        return rocblas_rfp_convert_impl<false, true>(                                       \
+            handle, transr, uplo, n, AP, 1, const_cast<T_*>(ARF));                          \
+    }                                                                                       \
+    catch(...)                                                                              \
+    {                                                                                       \
+        return exception_to_rocblas_status();                                               \
+    }
+
+IMPL(rocblas_stfttp, float);
+IMPL(rocblas_dtfttp, double);
+IMPL(rocblas_ctfttp, rocblas_float_complex);
+IMPL(rocblas_ztfttp, rocblas_double_complex);
+
+#undef IMPL
+
+#define IMPL(routine_name_, NB_, T_, U_)                                                    \
+    rocblas_status routine_name_(rocblas_handle    handle,                                  \
+                                 rocblas_operation transr,                                  \
+                                 rocblas_fill      uplo,                                    \
+                                 rocblas_operation trans,                                   \
+                                 rocblas_int       n,                                       \
+                                 rocblas_int       k,                                       \
+                                 const U_*         alpha,                                   \
+                                 const T_*         A,                                       \
+                                 rocblas_int       lda,                                     \
+                                 const U_*         beta,                                    \
+                                 T_*               C)                                       \
+    try                                                                                     \
+    {                                                                                       \
+        return rocblas_sfrk_impl<NB_>(                                                      \
+            handle, transr, uplo, trans, n, k, alpha, A, lda, beta, C);                     \
+    }                                                                                       \
+    catch(...)                                                                              \
+    {                                                                                       \
+        return exception_to_rocblas_status();                                               \
+    }
+
+IMPL(rocblas_ssfrk, ROCBLAS_SDZSYRK_NB, float, float);
+IMPL(rocblas_dsfrk, ROCBLAS_SDZSYRK_NB, double, double);
+IMPL(rocblas_chfrk, ROCBLAS_CHERK_NB, rocblas_float_complex, float);
+IMPL(rocblas_zhfrk, ROCBLAS_ZHERK_NB, rocblas_double_complex, double);
+
+#undef IMPL
+
+#define IMPL(routine_name_, DIM_X_, T_)                                                     \
+    rocblas_status routine_name_(rocblas_handle    handle,                                  \
+                                 rocblas_operation transr,                                  \
+                                 rocblas_side      side,                                    \
+                                 rocblas_fill      uplo,                                    \
+                                 rocblas_operation trans,                                   \
+                                 rocblas_diagonal  diag,                                    \
+                                 rocblas_int       m,                                       \
+                                 rocblas_int       n,                                       \
+                                 const T_*         alpha,                                   \
+                                 const T_*         A,                                       \
+                                 T_*               B,                                       \
+                                 rocblas_int       ldb)                                     \
+    try                                                                                     \
+    {                                                                                       \
+        return rocblas_tfsm_impl<DIM_X_>(                                                   \
+            handle, transr, side, uplo, trans, diag, m, n, alpha, A, B, ldb);               \
+    }                                                                                       \
+    catch(...)                                                                              \
+    {                                                                                       \
+        return exception_to_rocblas_status();                                               \
+    }
+
+IMPL(rocblas_stfsm, ROCBLAS_SDCTRSV_NB, float);
+IMPL(rocblas_dtfsm, ROCBLAS_SDCTRSV_NB, double);
+IMPL(rocblas_ctfsm, ROCBLAS_SDCTRSV_NB, rocblas_float_complex);
+IMPL(rocblas_ztfsm, ROCBLAS_ZTRSV_NB, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
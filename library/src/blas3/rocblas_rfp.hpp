@@ -0,0 +1,229 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "definitions.hpp"
+
+/*******************************************************************************
+ * Rectangular full packed (RFP) format, as in LAPACK. A triangular or
+ * symmetric matrix of order n is split into diagonal blocks A11 of order n1
+ * and A22 of order n2 and the off-diagonal block A21 (uplo lower, n2 x n1) or
+ * A12 (uplo upper, n1 x n2), which are stored in an array of n * (n + 1) / 2
+ * elements: A11 and A22 side by side with one of them transposed, so that
+ * their triangles fit together, and the off-diagonal block below them.
+ * With transr the whole array is transposed (conjugate transposed for complex
+ * types). Every block is a submatrix of the array with leading dimension ld,
+ * which the full storage Level 3 functions operate on directly.
+ ******************************************************************************/
+struct rocblas_rfp_block
+{
+    rocblas_stride offset; // of the block in the RFP array
+    bool           transposed; // whether the block is stored (conjugate) transposed
+};
+
+struct rocblas_rfp_layout
+{
+    rocblas_int       n1, n2; // orders of A11 and A22
+    rocblas_int       ld; // leading dimension of the RFP array
+    rocblas_rfp_block a11, a22, s; // s is A21 (uplo lower) or A12 (uplo upper)
+
+    __host__ __device__ rocblas_rfp_layout(bool transr, rocblas_fill uplo, rocblas_int n)
+    {
+        const bool        lower = uplo == rocblas_fill_lower;
+        const rocblas_int e     = n % 2 == 0; // even orders have an extra row
+        n1                      = lower ? n - n / 2 : n / 2;
+        n2                      = n - n1;
+
+        // rows and columns of the blocks in the RFP array with transr none
+        const rocblas_int ld_n = n + e;
+        auto block = [&](rocblas_int r, rocblas_int c, bool transposed) -> rocblas_rfp_block {
+            if(transr)
+                return {c + rocblas_stride(r) * ((n + 1 - e) / 2), !transposed};
+            return {r + rocblas_stride(c) * ld_n, transposed};
+        };
+        ld = transr ? (n + 1 - e) / 2 : ld_n;
+        if(lower)
+        {
+            a11 = block(e, 0, false);
+            a22 = block(0, 1 - e, true);
+            s   = block(n1 + e, 0, false);
+        }
+        else
+        {
+            a11 = block(n2 + e, 0, true);
+            a22 = block(n1, 0, false);
+            s   = block(0, 0, false);
+        }
+    }
+
+    // Index in the RFP array of element (i, j) in the triangle uplo, which is stored
+    // conjugated if conj is set
+    __host__ __device__ rocblas_stride
+        index(rocblas_fill uplo, rocblas_int i, rocblas_int j, bool& conj) const
+    {
+        const rocblas_rfp_block* b;
+        if(uplo == rocblas_fill_lower ? j >= n1 : i >= n1)
+        {
+            b = &a22;
+            i -= n1;
+            j -= n1;
+        }
+        else if(uplo == rocblas_fill_lower ? i >= n1 : j >= n1)
+        {
+            b = &s;
+            (uplo == rocblas_fill_lower ? i : j) -= n1;
+        }
+        else
+            b = &a11;
+
+        conj = b->transposed;
+        return b->offset
+               + (b->transposed ? j + rocblas_stride(i) * ld : i + rocblas_stride(j) * ld);
+    }
+};
+
+// Operation on the stored block which is op on the block of the matrix
+inline rocblas_operation
+    rocblas_rfp_block_op(const rocblas_rfp_block& b, rocblas_operation op, bool is_complex)
+{
+    if(!b.transposed)
+        return op;
+    if(op != rocblas_operation_none)
+        return rocblas_operation_none;
+    return is_complex ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose;
+}
+
+// Triangle of the stored diagonal block which holds the triangle uplo of the block
+inline rocblas_fill rocblas_rfp_block_fill(const rocblas_rfp_block& b, rocblas_fill uplo)
+{
+    if(!b.transposed)
+        return uplo;
+    return uplo == rocblas_fill_lower ? rocblas_fill_upper : rocblas_fill_lower;
+}
+
+/*******************************************************************************
+ * C = alpha op( A ) op( A )^H + beta C for C in RFP format, in three updates
+ * of its blocks: syrk(uplo, n, offset_A, offset_C) of a diagonal block of
+ * order n from the n rows (trans none) or columns of A at offset_A, and
+ * gemm(trans_p, trans_q, m, n, offset_P, offset_Q, offset_C) of the
+ * off-diagonal block, op_p( P ) op_q( Q ) with P and Q the m and n rows or
+ * columns of A at offset_P and offset_Q.
+ ******************************************************************************/
+template <typename SYRK, typename GEMM>
+rocblas_status rocblas_rfp_sfrk_steps(const rocblas_rfp_layout& rfp,
+                                      rocblas_fill              uplo,
+                                      rocblas_operation         trans,
+                                      bool                      is_complex,
+                                      rocblas_int               lda,
+                                      SYRK&&                    syrk,
+                                      GEMM&&                    gemm)
+{
+    const rocblas_operation op_h
+        = is_complex ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose;
+    const rocblas_stride offset_2
+        = trans == rocblas_operation_none ? rfp.n1 : rfp.n1 * rocblas_stride(lda);
+
+    if(rfp.n1)
+        RETURN_IF_ROCBLAS_ERROR(
+            syrk(rocblas_rfp_block_fill(rfp.a11, uplo), rfp.n1, 0, rfp.a11.offset));
+    if(rfp.n2)
+        RETURN_IF_ROCBLAS_ERROR(
+            syrk(rocblas_rfp_block_fill(rfp.a22, uplo), rfp.n2, offset_2, rfp.a22.offset));
+    if(!rfp.n1 || !rfp.n2)
+        return rocblas_status_success;
+
+    // C21 = A2 A1^H (lower) or C12 = A1 A2^H (upper), or their conjugate transposes
+    bool           second_first = (uplo == rocblas_fill_lower) != rfp.s.transposed;
+    rocblas_int    m            = second_first ? rfp.n2 : rfp.n1;
+    rocblas_int    n            = second_first ? rfp.n1 : rfp.n2;
+    rocblas_stride offset_p     = second_first ? offset_2 : 0;
+    rocblas_stride offset_q     = second_first ? 0 : offset_2;
+    if(trans == rocblas_operation_none)
+        return gemm(rocblas_operation_none, op_h, m, n, offset_p, offset_q, rfp.s.offset);
+    return gemm(op_h, rocblas_operation_none, m, n, offset_p, offset_q, rfp.s.offset);
+}
+
+/*******************************************************************************
+ * Solve op( A ) X = alpha B (side left) or X op( A ) = alpha B (side right)
+ * for A in RFP format of order k, by block substitution in three steps:
+ * trsm(uplo, trans, m, n, offset_A, offset_B, scaled) with a diagonal block,
+ * of which the first is scaled by alpha, then
+ * gemm(trans, m, n, k, offset_S, offset_X, offset_B), B = -op( S ) X + alpha B
+ * (side left) or B = -X op( S ) + alpha B (side right) with m x n B and the
+ * solved part X of k rows or columns, and the other diagonal block. m and n
+ * are those of B.
+ ******************************************************************************/
+template <typename TRSM, typename GEMM>
+rocblas_status rocblas_rfp_tfsm_steps(const rocblas_rfp_layout& rfp,
+                                      rocblas_side              side,
+                                      rocblas_fill              uplo,
+                                      rocblas_operation         trans,
+                                      bool                      is_complex,
+                                      rocblas_int               m,
+                                      rocblas_int               n,
+                                      rocblas_int               ldb,
+                                      TRSM&&                    trsm,
+                                      GEMM&&                    gemm)
+{
+    const bool left = side == rocblas_side_left;
+
+    // op( A ) is lower triangular when forward, and the block of order n1 is solved first
+    const bool forward = (uplo == rocblas_fill_lower) == (trans == rocblas_operation_none);
+    const bool first_1 = forward == left;
+
+    const rocblas_rfp_block& d_first  = first_1 ? rfp.a11 : rfp.a22;
+    const rocblas_rfp_block& d_second = first_1 ? rfp.a22 : rfp.a11;
+    const rocblas_int        k_first  = first_1 ? rfp.n1 : rfp.n2;
+    const rocblas_int        k_second = first_1 ? rfp.n2 : rfp.n1;
+
+    // B1 is the first n1 rows (side left) or columns of B, B2 the others
+    const rocblas_stride offset_b2     = left ? rfp.n1 : rfp.n1 * rocblas_stride(ldb);
+    const rocblas_stride offset_first  = first_1 ? 0 : offset_b2;
+    const rocblas_stride offset_second = first_1 ? offset_b2 : 0;
+
+    auto solve = [&](const rocblas_rfp_block& d,
+                     rocblas_int              kd,
+                     rocblas_stride           offset_b,
+                     bool                     scaled) {
+        if(!kd || !(left ? n : m))
+            return rocblas_status_success;
+        return trsm(rocblas_rfp_block_fill(d, uplo),
+                    rocblas_rfp_block_op(d, trans, is_complex),
+                    left ? kd : m,
+                    left ? n : kd,
+                    d.offset,
+                    offset_b,
+                    scaled);
+    };
+
+    RETURN_IF_ROCBLAS_ERROR(solve(d_first, k_first, offset_first, true));
+    if(k_second && (left ? n : m))
+        RETURN_IF_ROCBLAS_ERROR(gemm(rocblas_rfp_block_op(rfp.s, trans, is_complex),
+                                     left ? k_second : m,
+                                     left ? n : k_second,
+                                     k_first,
+                                     rfp.s.offset,
+                                     offset_first,
+                                     offset_second));
+    return solve(d_second, k_second, offset_second, false);
+}
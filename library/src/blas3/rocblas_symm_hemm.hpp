@@ -76,6 +76,54 @@ inline rocblas_status rocblas_symm_arg_check(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
+static const rocblas_int rocblas_internal_symm_expand_min_size = [] {
+    // Both m and n from which symm and hemm expand the symmetric matrix to a full matrix in
+    // workspace and compute the product with a single gemm, instead of the block-recursive
+    // method whose smallest sub-diagonal gemms run well below peak. 0 disables the expansion.
+    constexpr rocblas_int SYMM_EXPAND_MIN_SIZE = 2048;
+    rocblas_int           min_size;
+    const char*           env = getenv("ROCBLAS_INTERNAL_SYMM_EXPAND_MIN_SIZE");
+    return env && sscanf(env, "%d", &min_size) == 1 ? min_size : SYMM_EXPAND_MIN_SIZE;
+}();
+
+/*! \brief Workspace in bytes for the full expansion of the symmetric matrix, 0 when symm
+    and hemm use the block-recursive method. */
+template <typename T>
+inline size_t rocblas_internal_symm_expand_workspace_size(rocblas_side side,
+                                                          rocblas_int  m,
+                                                          rocblas_int  n,
+                                                          rocblas_int  batch_count)
+{
+    if(rocblas_internal_symm_expand_min_size <= 0 || batch_count != 1
+       || m < rocblas_internal_symm_expand_min_size || n < rocblas_internal_symm_expand_min_size)
+        return 0;
+
+    size_t ka = rocblas_side_left == side ? m : n;
+    return ka * ka * sizeof(T);
+}
+
+/*! \brief symm and hemm for a single matrix: expand the stored triangle of A into the
+    ka x ka matrix in workspace, then C = alpha * A * B + beta * C (left) or
+    C = alpha * B * A + beta * C (right) with one gemm. */
+template <bool HERM, typename T>
+rocblas_status rocblas_internal_symm_expand_template(rocblas_handle handle,
+                                                     rocblas_side   side,
+                                                     rocblas_fill   uplo,
+                                                     rocblas_int    m,
+                                                     rocblas_int    n,
+                                                     const T*       alpha,
+                                                     const T*       A,
+                                                     rocblas_stride offsetA,
+                                                     rocblas_int    lda,
+                                                     const T*       B,
+                                                     rocblas_stride offsetB,
+                                                     rocblas_int    ldb,
+                                                     const T*       beta,
+                                                     T*             C,
+                                                     rocblas_stride offsetC,
+                                                     rocblas_int    ldc,
+                                                     T*             workspace);
+
 template <bool BATCHED, bool HERM, typename T, typename TScal, typename TConstPtr, typename TPtr>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     rocblas_internal_symm_template(rocblas_handle handle,
@@ -34,6 +34,7 @@
 #include "definitions.hpp"
 #include "handle.hpp"
 #include "rocblas_symm_hemm.hpp"
+#include "rocblas_symm_syrk_small_batched.hpp"
 #include <type_traits>
 
 template <typename T>
@@ -691,6 +692,107 @@ rocblas_status rocblas_symm_template_non_batched(rocblas_handle handle,
     return rocblas_status_success;
 }
 
+/**
+  *  Writes the full ka x ka matrix of the symmetric or Hermitian matrix A, with only the
+  *  uplo triangle referenced, to W with leading dimension ka.
+  */
+template <bool HERM, int DIM_X, int DIM_Y, typename T>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_symm_expand_kernel(bool is_upper, rocblas_int ka, const T* A, rocblas_int lda, T* W)
+{
+    rocblas_int tx = blockIdx.x * blockDim.x + threadIdx.x;
+    rocblas_int ty = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if(tx < ka && ty < ka)
+    {
+        bool stored = is_upper ? tx <= ty : tx >= ty;
+        T    e      = stored ? A[ty * size_t(lda) + tx] : A[tx * size_t(lda) + ty];
+
+        if constexpr(HERM)
+        {
+            if(tx == ty)
+                e = std::real(e);
+            else if(!stored)
+                e = conj(e);
+        }
+
+        W[ty * size_t(ka) + tx] = e;
+    }
+}
+
+template <bool HERM, typename T>
+rocblas_status rocblas_internal_symm_expand_template(rocblas_handle handle,
+                                                     rocblas_side   side,
+                                                     rocblas_fill   uplo,
+                                                     rocblas_int    m,
+                                                     rocblas_int    n,
+                                                     const T*       alpha,
+                                                     const T*       A,
+                                                     rocblas_stride offsetA,
+                                                     rocblas_int    lda,
+                                                     const T*       B,
+                                                     rocblas_stride offsetB,
+                                                     rocblas_int    ldb,
+                                                     const T*       beta,
+                                                     T*             C,
+                                                     rocblas_stride offsetC,
+                                                     rocblas_int    ldc,
+                                                     T*             workspace)
+{
+    if(!m || !n)
+        return rocblas_status_success;
+
+    T alpha_h, beta_h;
+    RETURN_IF_ROCBLAS_ERROR(
+        rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, 1));
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    // only C is scaled, which the block-recursive method does without reading A
+    // clang-format off
+    if(*alpha == T(0))
+        return rocblas_symm_template_non_batched<false, HERM, T>(
+            handle, side, uplo, m, n, alpha,
+            A, offsetA, lda,
+            B, offsetB, ldb, beta,
+            C, offsetC, ldc);
+    // clang-format on
+
+    rocblas_int ka = rocblas_side_left == side ? m : n; // dimension of symmetric matrix a
+
+    static constexpr int symm_EXPAND_DIM_X = 128;
+    static constexpr int symm_EXPAND_DIM_Y = 8;
+    dim3 expand_grid((ka - 1) / symm_EXPAND_DIM_X + 1, (ka - 1) / symm_EXPAND_DIM_Y + 1);
+    dim3 expand_threads(symm_EXPAND_DIM_X, symm_EXPAND_DIM_Y);
+
+    hipLaunchKernelGGL((rocblas_symm_expand_kernel<HERM, symm_EXPAND_DIM_X, symm_EXPAND_DIM_Y>),
+                       expand_grid,
+                       expand_threads,
+                       0,
+                       handle->get_stream(),
+                       uplo == rocblas_fill_upper,
+                       ka,
+                       A + offsetA,
+                       lda,
+                       workspace);
+
+    const T* W = workspace;
+
+    // clang-format off
+    if(rocblas_side_left == side)
+        return rocblas_internal_gemm_template<false>(handle,
+                rocblas_operation_none, rocblas_operation_none, m, n, m, alpha,
+                W, 0,       ka,  0,
+                B, offsetB, ldb, 0, beta,
+                C, offsetC, ldc, 0, 1);
+    else
+        return rocblas_internal_gemm_template<false>(handle,
+                rocblas_operation_none, rocblas_operation_none, m, n, n, alpha,
+                B, offsetB, ldb, 0,
+                W, 0,       ka,  0, beta,
+                C, offsetC, ldc, 0, 1);
+    // clang-format on
+}
+
 template <bool HERM, typename TConstPtr, typename TPtr>
 rocblas_status rocblas_hemm_symm_check_numerics(const char*    function_name,
                                                 rocblas_handle handle,
@@ -818,6 +920,29 @@ rocblas_status rocblas_symm_template_batched(rocblas_handle handle,
     if (*alpha == T(0) && *beta == T(1.0))
         return rocblas_status_success;
 
+    // Large batches of tiny matrices, which the diagonal blocks and gemms below under-utilize
+    if(rocblas_symm_syrk_use_small_batched(m, n, batch_count))
+        return rocblas_symm_hemm_small_batched_solution<HERM>(handle,
+                                                              side,
+                                                              uplo,
+                                                              m,
+                                                              n,
+                                                              *alpha,
+                                                              a,
+                                                              offsetA,
+                                                              lda,
+                                                              strideA,
+                                                              b,
+                                                              offsetB,
+                                                              ldb,
+                                                              strideB,
+                                                              *beta,
+                                                              c,
+                                                              offsetC,
+                                                              ldc,
+                                                              strideC,
+                                                              batch_count);
+
     rocblas_int ka = rocblas_side_left == side ? m : n; // dimension of triangle matrix a
 
     rocblas_int n_nb   = ka / nb_diag; // number of diag blocks of matrix a of size nb_diag
@@ -1170,6 +1295,40 @@ INSTANTIATE_HEMM_SYMM_NUMERICS( true, rocblas_double_complex const* const*, rocb
 
 #undef INSTANTIATE_HEMM_SYMM_NUMERICS
 
+#ifdef INSTANTIATE_SYMM_EXPAND_TEMPLATE
+#error INSTANTIATE_SYMM_EXPAND_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_SYMM_EXPAND_TEMPLATE(HERM_, T_)                                      \
+template rocblas_status rocblas_internal_symm_expand_template<HERM_, T_>                \
+                                  (rocblas_handle handle,                               \
+                                   rocblas_side   side,                                 \
+                                   rocblas_fill   uplo,                                 \
+                                   rocblas_int    m,                                    \
+                                   rocblas_int    n,                                    \
+                                   const T_*      alpha,                                \
+                                   const T_*      A,                                    \
+                                   rocblas_stride offsetA,                              \
+                                   rocblas_int    lda,                                  \
+                                   const T_*      B,                                    \
+                                   rocblas_stride offsetB,                              \
+                                   rocblas_int    ldb,                                  \
+                                   const T_*      beta,                                 \
+                                   T_*            C,                                    \
+                                   rocblas_stride offsetC,                              \
+                                   rocblas_int    ldc,                                  \
+                                   T_*            workspace);
+
+// instantiate for rocblas_Xsymm and rocblas_Xhemm
+INSTANTIATE_SYMM_EXPAND_TEMPLATE(false, float)
+INSTANTIATE_SYMM_EXPAND_TEMPLATE(false, double)
+INSTANTIATE_SYMM_EXPAND_TEMPLATE(false, rocblas_float_complex)
+INSTANTIATE_SYMM_EXPAND_TEMPLATE( true, rocblas_float_complex)
+INSTANTIATE_SYMM_EXPAND_TEMPLATE(false, rocblas_double_complex)
+INSTANTIATE_SYMM_EXPAND_TEMPLATE( true, rocblas_double_complex)
+
+#undef INSTANTIATE_SYMM_EXPAND_TEMPLATE
+
 #undef INSTANTIATE_SYMM_TEMPLATE
 
 #undef SSYMM_MIN_NB
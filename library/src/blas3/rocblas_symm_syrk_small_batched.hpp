@@ -0,0 +1,359 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * ===========================================================================
+ *    symm, hemm, syrkx and herkx kernels with compile time sizes for large
+ *    batches of tiny matrices, dispatched from the batched symm and syrkx
+ *    templates
+ * ===========================================================================
+ */
+
+// As for the small batched gemm, the order of C, at most 32, is rounded up to the compile time
+// size S in 4, 8, 16 or 32, and each workgroup computes NB = 256 / (S * S) whole problems, or
+// one for S = 32, with a thread per element of C. symm and hemm load the symmetric or Hermitian
+// matrix, completed from its stored triangle, and B into zero padded S x S tiles of LDS once.
+// syrkx and herkx, whose k is not bounded, loop over k in chunks of S columns of op(A) and op(B)
+// and only store the referenced triangle of C. The dot products are fully unrolled over S.
+
+#pragma once
+
+#include "handle.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <type_traits>
+
+static const rocblas_int rocblas_internal_symm_syrk_small_batched_min_batch = [] {
+    // batch count from which symm, hemm, syrk, herk, syrkx and herkx with C of order at most 32
+    // use the small batched kernels. 0 disables them.
+    constexpr rocblas_int SYMM_SYRK_SMALL_BATCHED_MIN_BATCH = 1024;
+    rocblas_int           min_batch;
+    const char*           env = getenv("ROCBLAS_INTERNAL_SYMM_SYRK_SMALL_BATCHED_MIN_BATCH");
+    return env && sscanf(env, "%d", &min_batch) == 1 ? min_batch
+                                                      : SYMM_SYRK_SMALL_BATCHED_MIN_BATCH;
+}();
+
+namespace
+{
+    // Largest order of C of the small batched kernels
+    constexpr rocblas_int ROCBLAS_SYMM_SYRK_SMALL_BATCHED_MAX_DIM = 32;
+
+    //! @brief True if symm or syrk with C of size m x n and batch_count matrices uses the small
+    //!        batched kernels
+    inline bool
+        rocblas_symm_syrk_use_small_batched(rocblas_int m, rocblas_int n, rocblas_int batch_count)
+    {
+        return rocblas_internal_symm_syrk_small_batched_min_batch > 0
+               && batch_count >= rocblas_internal_symm_syrk_small_batched_min_batch
+               && m <= ROCBLAS_SYMM_SYRK_SMALL_BATCHED_MAX_DIM
+               && n <= ROCBLAS_SYMM_SYRK_SMALL_BATCHED_MAX_DIM;
+    }
+
+    // Launches KERNEL_ with the smallest compile time size S_ for size, and its batches per
+    // workgroup NB_, with the arguments following the template parameters
+#define ROCBLAS_SYMM_SYRK_SMALL_BATCHED_LAUNCH(size_, KERNEL_, ...)   \
+    do                                                                \
+    {                                                                 \
+        auto launch_ = [&](auto s_) {                                 \
+            constexpr int S_  = decltype(s_)::value;                  \
+            constexpr int NB_ = S_ * S_ >= 256 ? 1 : 256 / (S_ * S_); \
+            hipLaunchKernelGGL((KERNEL_<S_, NB_, __VA_ARGS__>),       \
+                               dim3((batch_count - 1) / NB_ + 1),     \
+                               dim3(S_, S_, NB_),                     \
+                               0,                                     \
+                               handle->get_stream(),                  \
+                               ROCBLAS_SYMM_SYRK_SMALL_BATCHED_ARGS); \
+        };                                                            \
+        if(size_ <= 4)                                                \
+            launch_(std::integral_constant<int, 4>{});                \
+        else if(size_ <= 8)                                           \
+            launch_(std::integral_constant<int, 8>{});                \
+        else if(size_ <= 16)                                          \
+            launch_(std::integral_constant<int, 16>{});               \
+        else                                                          \
+            launch_(std::integral_constant<int, 32>{});               \
+    } while(0)
+
+    // C = alpha * A * B + beta * C (left) or alpha * B * A + beta * C (right) for the batches
+    // NB * blockIdx.x + threadIdx.z, with thread (threadIdx.x, threadIdx.y) computing the element
+    // (i, j) of C
+    template <int S, int NB, bool HERM, bool RIGHT, typename T, typename TConstPtr, typename TPtr>
+    ROCBLAS_KERNEL(S* S* NB)
+    rocblas_symm_hemm_small_batched_kernel(bool           is_upper,
+                                           rocblas_int    m,
+                                           rocblas_int    n,
+                                           T              alpha,
+                                           TConstPtr      dA,
+                                           rocblas_stride offset_a,
+                                           rocblas_int    lda,
+                                           rocblas_stride stride_a,
+                                           TConstPtr      dB,
+                                           rocblas_stride offset_b,
+                                           rocblas_int    ldb,
+                                           rocblas_stride stride_b,
+                                           T              beta,
+                                           TPtr           dC,
+                                           rocblas_stride offset_c,
+                                           rocblas_int    ldc,
+                                           rocblas_stride stride_c,
+                                           rocblas_int    batch_count)
+    {
+        __shared__ T sA[NB][S][S + 1]; // A(i, l) at sA[z][l][i], completed from its triangle
+        __shared__ T sB[NB][S][S + 1]; // B(i, j) at sB[z][j][i]
+
+        const int         tx    = threadIdx.x;
+        const int         ty    = threadIdx.y;
+        const int         tz    = threadIdx.z;
+        const rocblas_int batch = blockIdx.x * NB + tz;
+        const rocblas_int ka    = RIGHT ? n : m;
+
+        // the workgroup synchronizes once, so that threads of missing batches only skip memory
+        const bool valid = batch < batch_count;
+
+        T a = T(0), b = T(0);
+        if(valid)
+        {
+            const auto* A = load_ptr_batch(dA, batch, offset_a, stride_a);
+            const auto* B = load_ptr_batch(dB, batch, offset_b, stride_b);
+
+            // thread (tx, ty) loads A(tx, ty) from the stored triangle, or its mirror
+            if(tx < ka && ty < ka)
+            {
+                bool stored = is_upper ? tx <= ty : tx >= ty;
+                a           = stored ? A[tx + ty * size_t(lda)] : A[ty + tx * size_t(lda)];
+                if constexpr(HERM)
+                {
+                    if(tx == ty)
+                        a = std::real(a);
+                    else if(!stored)
+                        a = conj(a);
+                }
+            }
+            if(tx < m && ty < n)
+                b = B[tx + ty * size_t(ldb)];
+        }
+
+        sA[tz][ty][tx] = a;
+        sB[tz][ty][tx] = b;
+
+        __syncthreads();
+
+        if(!valid || tx >= m || ty >= n)
+            return;
+
+        T sum = T(0);
+#pragma unroll
+        for(int l = 0; l < S; l++)
+            sum += RIGHT ? sB[tz][l][tx] * sA[tz][ty][l] : sA[tz][l][tx] * sB[tz][ty][l];
+
+        auto* C = load_ptr_batch(dC, batch, offset_c, stride_c);
+        T*    c = C + tx + ty * size_t(ldc);
+        *c      = beta == T(0) ? alpha * sum : alpha * sum + beta * *c;
+    }
+
+    //! @brief Launches the small batched kernel of symm or hemm with the smallest compile time
+    //!        size for m and n, with alpha and beta on the host.
+    template <bool HERM, typename T, typename TConstPtr, typename TPtr>
+    rocblas_status rocblas_symm_hemm_small_batched_solution(rocblas_handle handle,
+                                                            rocblas_side   side,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    m,
+                                                            rocblas_int    n,
+                                                            T              alpha,
+                                                            TConstPtr      A,
+                                                            rocblas_stride offset_a,
+                                                            rocblas_int    lda,
+                                                            rocblas_stride stride_a,
+                                                            TConstPtr      B,
+                                                            rocblas_stride offset_b,
+                                                            rocblas_int    ldb,
+                                                            rocblas_stride stride_b,
+                                                            T              beta,
+                                                            TPtr           C,
+                                                            rocblas_stride offset_c,
+                                                            rocblas_int    ldc,
+                                                            rocblas_stride stride_c,
+                                                            rocblas_int    batch_count)
+    {
+        bool        is_upper = uplo == rocblas_fill_upper;
+        rocblas_int size     = std::max(m, n);
+
+#define ROCBLAS_SYMM_SYRK_SMALL_BATCHED_ARGS                                                \
+    is_upper, m, n, alpha, A, offset_a, lda, stride_a, B, offset_b, ldb, stride_b, beta, C, \
+        offset_c, ldc, stride_c, batch_count
+
+        if(side == rocblas_side_left)
+            ROCBLAS_SYMM_SYRK_SMALL_BATCHED_LAUNCH(
+                size, rocblas_symm_hemm_small_batched_kernel, HERM, false);
+        else
+            ROCBLAS_SYMM_SYRK_SMALL_BATCHED_LAUNCH(
+                size, rocblas_symm_hemm_small_batched_kernel, HERM, true);
+
+#undef ROCBLAS_SYMM_SYRK_SMALL_BATCHED_ARGS
+
+        return rocblas_status_success;
+    }
+
+    // The referenced triangle of C = alpha * op(A) * op(B)^T + beta * C, or op(B)^H for herkx,
+    // for the batches NB * blockIdx.x + threadIdx.z, with thread (threadIdx.x, threadIdx.y)
+    // computing the element (i, j) of C
+    template <int S, int NB, bool HERK, typename T, typename TConstPtr, typename TPtr>
+    ROCBLAS_KERNEL(S* S* NB)
+    rocblas_syrkx_herkx_small_batched_kernel(bool              is_upper,
+                                             rocblas_operation trans,
+                                             rocblas_int       n,
+                                             rocblas_int       k,
+                                             T                 alpha,
+                                             TConstPtr         dA,
+                                             rocblas_stride    offset_a,
+                                             rocblas_int       lda,
+                                             rocblas_stride    stride_a,
+                                             TConstPtr         dB,
+                                             rocblas_stride    offset_b,
+                                             rocblas_int       ldb,
+                                             rocblas_stride    stride_b,
+                                             T                 beta,
+                                             TPtr              dC,
+                                             rocblas_stride    offset_c,
+                                             rocblas_int       ldc,
+                                             rocblas_stride    stride_c,
+                                             rocblas_int       batch_count)
+    {
+        __shared__ T sA[NB][S][S + 1]; // op(A)(i, l0 + l) at sA[z][l][i]
+        __shared__ T sB[NB][S][S + 1]; // op(B)(j, l0 + l) at sB[z][j][l], conjugated for herkx
+
+        const int         tx    = threadIdx.x;
+        const int         ty    = threadIdx.y;
+        const int         tz    = threadIdx.z;
+        const rocblas_int batch = blockIdx.x * NB + tz;
+        const bool        valid = batch < batch_count;
+
+        const T* A = nullptr;
+        const T* B = nullptr;
+        if(valid)
+        {
+            A = load_ptr_batch(dA, batch, offset_a, stride_a);
+            B = load_ptr_batch(dB, batch, offset_b, stride_b);
+        }
+
+        T sum = T(0);
+        for(rocblas_int l0 = 0; l0 < k; l0 += S)
+        {
+            // consecutive threads load consecutive elements of a column of A and B: without
+            // transpose thread (tx, ty) loads op(A)(tx, l0 + ty), otherwise op(A)(ty, l0 + tx)
+            T a = T(0), b = T(0);
+            if(valid)
+            {
+                if(trans == rocblas_operation_none)
+                {
+                    if(tx < n && l0 + ty < k)
+                    {
+                        a = A[tx + (l0 + ty) * size_t(lda)];
+                        b = B[tx + (l0 + ty) * size_t(ldb)];
+                        if constexpr(HERK)
+                            b = conj(b);
+                    }
+                }
+                else if(ty < n && l0 + tx < k)
+                {
+                    a = A[(l0 + tx) + ty * size_t(lda)];
+                    b = B[(l0 + tx) + ty * size_t(ldb)];
+                    if constexpr(HERK)
+                        a = conj(a);
+                }
+            }
+
+            // the previous chunk has been used
+            __syncthreads();
+
+            if(trans == rocblas_operation_none)
+            {
+                sA[tz][ty][tx] = a;
+                sB[tz][tx][ty] = b;
+            }
+            else
+            {
+                sA[tz][tx][ty] = a;
+                sB[tz][ty][tx] = b;
+            }
+
+            __syncthreads();
+
+#pragma unroll
+            for(int l = 0; l < S; l++)
+                sum += sA[tz][l][tx] * sB[tz][ty][l];
+        }
+
+        if(!valid || tx >= n || ty >= n || (is_upper ? tx > ty : tx < ty))
+            return;
+
+        auto* C = load_ptr_batch(dC, batch, offset_c, stride_c);
+        T*    c = C + tx + ty * size_t(ldc);
+        T     r = beta == T(0) ? alpha * sum : alpha * sum + beta * *c;
+        if constexpr(HERK)
+        {
+            if(tx == ty)
+                r = std::real(r);
+        }
+        *c = r;
+    }
+
+    //! @brief Launches the small batched kernel of syrkx or herkx, which syrk and herk call with
+    //!        B = A, with the smallest compile time size for n, with alpha and beta on the host.
+    template <bool HERK, typename T, typename TConstPtr, typename TPtr>
+    rocblas_status rocblas_syrkx_herkx_small_batched_solution(rocblas_handle    handle,
+                                                              rocblas_fill      uplo,
+                                                              rocblas_operation trans,
+                                                              rocblas_int       n,
+                                                              rocblas_int       k,
+                                                              T                 alpha,
+                                                              TConstPtr         A,
+                                                              rocblas_stride    offset_a,
+                                                              rocblas_int       lda,
+                                                              rocblas_stride    stride_a,
+                                                              TConstPtr         B,
+                                                              rocblas_stride    offset_b,
+                                                              rocblas_int       ldb,
+                                                              rocblas_stride    stride_b,
+                                                              T                 beta,
+                                                              TPtr              C,
+                                                              rocblas_stride    offset_c,
+                                                              rocblas_int       ldc,
+                                                              rocblas_stride    stride_c,
+                                                              rocblas_int       batch_count)
+    {
+        bool is_upper = uplo == rocblas_fill_upper;
+
+#define ROCBLAS_SYMM_SYRK_SMALL_BATCHED_ARGS                                                    \
+    is_upper, trans, n, k, alpha, A, offset_a, lda, stride_a, B, offset_b, ldb, stride_b, beta, \
+        C, offset_c, ldc, stride_c, batch_count
+
+        ROCBLAS_SYMM_SYRK_SMALL_BATCHED_LAUNCH(n, rocblas_syrkx_herkx_small_batched_kernel, HERK);
+
+#undef ROCBLAS_SYMM_SYRK_SMALL_BATCHED_ARGS
+
+        return rocblas_status_success;
+    }
+
+#undef ROCBLAS_SYMM_SYRK_SMALL_BATCHED_LAUNCH
+}
@@ -199,6 +199,53 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                           rocblas_stride    stride_c,
                                           rocblas_int       batch_count);
 
+static const rocblas_int rocblas_internal_syr2k_concat_min_size = [] {
+    // n from which syr2k and her2k copy [A B] and the scaled [B A] to workspace, so that each
+    // diagonal block is computed by the syrkx/herkx kernels and each off-diagonal block by a
+    // single gemm with 2k columns, instead of two gemms and two passes over C. 0 disables it.
+    constexpr rocblas_int SYR2K_CONCAT_MIN_SIZE = 2048;
+    rocblas_int           min_size;
+    const char*           env = getenv("ROCBLAS_INTERNAL_SYR2K_CONCAT_MIN_SIZE");
+    return env && sscanf(env, "%d", &min_size) == 1 ? min_size : SYR2K_CONCAT_MIN_SIZE;
+}();
+
+/*! \brief Workspace in bytes for the concatenation of A and B, 0 when syr2k and her2k compute
+    the two rank-k updates separately. */
+template <typename T>
+inline size_t rocblas_internal_syr2k_concat_workspace_size(rocblas_int n,
+                                                           rocblas_int k,
+                                                           rocblas_int batch_count)
+{
+    if(rocblas_internal_syr2k_concat_min_size <= 0 || batch_count != 1 || k <= 0
+       || n < rocblas_internal_syr2k_concat_min_size)
+        return 0;
+
+    // [A B] and [B A], of n x 2k elements each
+    return 4 * size_t(n) * k * sizeof(T);
+}
+
+/*! \brief syr2k and her2k for a single matrix as the syrkx or herkx of the n x 2k (or 2k x n)
+    matrices [A B] and [conj(alpha) B, alpha A] (or [alpha B, conj(alpha) A]) in workspace,
+    with alpha == 1. alpha and beta are on the host, with n > 0, k > 0 and alpha != 0. */
+template <bool HERK, typename T, typename U>
+rocblas_status rocblas_internal_syr2k_her2k_concat_template(rocblas_handle    handle,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation trans,
+                                                            rocblas_int       n,
+                                                            rocblas_int       k,
+                                                            const T*          alpha,
+                                                            const T*          A,
+                                                            rocblas_stride    offsetA,
+                                                            rocblas_int       lda,
+                                                            const T*          B,
+                                                            rocblas_stride    offsetB,
+                                                            rocblas_int       ldb,
+                                                            const U*          beta,
+                                                            T*                C,
+                                                            rocblas_stride    offsetC,
+                                                            rocblas_int       ldc,
+                                                            T*                workspace);
+
 template <bool HERM, typename TConstPtr, typename TPtr>
 rocblas_status rocblas_her2k_syr2k_check_numerics(const char*       function_name,
                                                   rocblas_handle    handle,
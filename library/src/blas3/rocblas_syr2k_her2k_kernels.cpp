@@ -536,6 +536,43 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
             ldc);
     }
 
+    // The block-recursive algorithm maps all off-diagonal tiles of one size to a single
+    // strided gemm and skips the unreferenced triangle, so it issues O(log(n / MIN_NB))
+    // gemm calls. The loop below issues O(n / MIN_NB) gemm calls, each over batch_count.
+    // For strided_batched with few large matrices run block-recursive once per batch.
+    if(!BATCHED)
+    {
+        rocblas_int n_levels = 0;
+        for(rocblas_int nb_l = MIN_NB; nb_l < n; nb_l *= 2)
+            n_levels++;
+
+        if(int64_t(batch_count) * (n_levels + 1) < n / MIN_NB)
+        {
+            for(rocblas_int b = 0; b < batch_count; b++)
+            {
+                RETURN_IF_ROCBLAS_ERROR(
+                    (rocblas_internal_syr2k_syrkx_block_recursive_template<MIN_NB, TWOK, HERK, T>(
+                        handle,
+                        uplo,
+                        trans,
+                        n,
+                        k,
+                        alpha,
+                        dA_in,
+                        offset_a + b * stride_a,
+                        lda,
+                        dB_in,
+                        offset_b + b * stride_b,
+                        ldb,
+                        beta,
+                        dC_in,
+                        offset_c + b * stride_c,
+                        ldc)));
+            }
+            return rocblas_status_success;
+        }
+    }
+
     rocblas_int a_s1 = rocblas_operation_none == trans ? 1 : lda;
     rocblas_int b_s1 = rocblas_operation_none == trans ? 1 : ldb;
     rocblas_int c_s1 = 1, c_s2 = ldc;
@@ -736,6 +773,118 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     return rocblas_status_success;
 }
 
+/**
+  *  Writes W1 = [A B] and W2 = [s_b * B, s_a * A], concatenated along the k dimension: the
+  *  columns if trans == rocblas_operation_none (A is n x k), otherwise the rows (A is k x n).
+  *  Each thread reads one element of A and of B, the element (tx, ty) of the rows_a x cols_a
+  *  matrices, and writes four elements of the workspace with leading dimension ldw.
+  */
+template <int DIM_X, int DIM_Y, typename T>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_syr2k_concat_kernel(rocblas_int rows_a,
+                            rocblas_int cols_a,
+                            T           s_a,
+                            T           s_b,
+                            const T*    A,
+                            rocblas_int lda,
+                            const T*    B,
+                            rocblas_int ldb,
+                            size_t      second_offset,
+                            T*          W1,
+                            T*          W2,
+                            rocblas_int ldw)
+{
+    rocblas_int tx = blockIdx.x * blockDim.x + threadIdx.x;
+    rocblas_int ty = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if(tx < rows_a && ty < cols_a)
+    {
+        T      a = A[tx + size_t(lda) * ty];
+        T      b = B[tx + size_t(ldb) * ty];
+        size_t w = tx + size_t(ldw) * ty;
+
+        W1[w]                 = a;
+        W1[w + second_offset] = b;
+        W2[w]                 = s_b * b;
+        W2[w + second_offset] = s_a * a;
+    }
+}
+
+template <bool HERK, typename T, typename U>
+rocblas_status rocblas_internal_syr2k_her2k_concat_template(rocblas_handle    handle,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation trans,
+                                                            rocblas_int       n,
+                                                            rocblas_int       k,
+                                                            const T*          alpha,
+                                                            const T*          A,
+                                                            rocblas_stride    offsetA,
+                                                            rocblas_int       lda,
+                                                            const T*          B,
+                                                            rocblas_stride    offsetB,
+                                                            rocblas_int       ldb,
+                                                            const U*          beta,
+                                                            T*                C,
+                                                            rocblas_stride    offsetC,
+                                                            rocblas_int       ldc,
+                                                            T*                workspace)
+{
+    static constexpr bool        SYRKX  = false;
+    static constexpr rocblas_int MIN_NB = HERK                        ? ROCBLAS_HERKX_NB
+                                          : std::is_same_v<T, float> ? ROCBLAS_SSYRKX_NB
+                                                                      : ROCBLAS_DCZSYRKX_NB;
+
+    // C += alpha * op(A) * op(B)**H + conj(alpha) * op(B) * op(A)**H == op(W1) * op(W2)**H,
+    // without the conjugates for syr2k
+    bool        trans_none = rocblas_operation_none == trans;
+    rocblas_int rows_a     = trans_none ? n : k;
+    rocblas_int cols_a     = trans_none ? k : n;
+    rocblas_int ldw        = trans_none ? n : 2 * k;
+    size_t      offset_w   = trans_none ? size_t(ldw) * k : size_t(k);
+    T           alpha_conj = HERK ? conj(*alpha) : *alpha;
+    T           s_a        = trans_none ? *alpha : alpha_conj;
+    T           s_b        = trans_none ? alpha_conj : *alpha;
+
+    T*      W1 = workspace;
+    T*      W2 = workspace + 2 * size_t(n) * k;
+    const T one(1);
+    const T beta_t(*beta); // herkx takes the real beta of her2k as T
+
+    static constexpr int syr2k_CONCAT_DIM_X = 128;
+    static constexpr int syr2k_CONCAT_DIM_Y = 8;
+    dim3 concat_grid((rows_a - 1) / syr2k_CONCAT_DIM_X + 1,
+                     (cols_a - 1) / syr2k_CONCAT_DIM_Y + 1);
+    dim3 concat_threads(syr2k_CONCAT_DIM_X, syr2k_CONCAT_DIM_Y);
+
+    hipLaunchKernelGGL((rocblas_syr2k_concat_kernel<syr2k_CONCAT_DIM_X, syr2k_CONCAT_DIM_Y>),
+                       concat_grid,
+                       concat_threads,
+                       0,
+                       handle->get_stream(),
+                       rows_a,
+                       cols_a,
+                       s_a,
+                       s_b,
+                       A + offsetA,
+                       lda,
+                       B + offsetB,
+                       ldb,
+                       offset_w,
+                       W1,
+                       W2,
+                       ldw);
+
+    // the diagonal blocks use the syrkx/herkx kernels and the off-diagonal ones a gemm of 2k
+    // columns, over the referenced triangle only
+    // clang-format off
+    return rocblas_internal_syr2k_syrkx_block_recursive_template<MIN_NB, SYRKX, HERK, T>(
+        handle, uplo, trans, n, 2 * k, &one,
+        (const T*)W1, 0,       ldw,
+        (const T*)W2, 0,       ldw, &beta_t,
+        C,            offsetC, ldc);
+    // clang-format on
+}
+
 template <bool HERM, typename TConstPtr, typename TPtr>
 rocblas_status rocblas_her2k_syr2k_check_numerics(const char*       function_name,
                                                   rocblas_handle    handle,
@@ -946,4 +1095,38 @@ INSTANTIATE_HER2K_SYR2K_NUMERICS(false, rocblas_double_complex const* const*, ro
 INSTANTIATE_HER2K_SYR2K_NUMERICS( true, rocblas_double_complex const* const*, rocblas_double_complex* const*)
 
 #undef INSTANTIATE_HER2K_SYR2K_NUMERICS
+
+#ifdef INSTANTIATE_SYR2K_HER2K_CONCAT_TEMPLATE
+#error INSTANTIATE_SYR2K_HER2K_CONCAT_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_SYR2K_HER2K_CONCAT_TEMPLATE(HERK_, T_, U_)                            \
+template rocblas_status rocblas_internal_syr2k_her2k_concat_template<HERK_, T_, U_>     \
+                                  (rocblas_handle    handle,                            \
+                                   rocblas_fill      uplo,                              \
+                                   rocblas_operation trans,                             \
+                                   rocblas_int       n,                                 \
+                                   rocblas_int       k,                                 \
+                                   const T_*         alpha,                             \
+                                   const T_*         A,                                 \
+                                   rocblas_stride    offsetA,                           \
+                                   rocblas_int       lda,                               \
+                                   const T_*         B,                                 \
+                                   rocblas_stride    offsetB,                           \
+                                   rocblas_int       ldb,                               \
+                                   const U_*         beta,                              \
+                                   T_*               C,                                 \
+                                   rocblas_stride    offsetC,                           \
+                                   rocblas_int       ldc,                               \
+                                   T_*               workspace);
+
+// instantiate for rocblas_Xsyr2k and rocblas_Xher2k
+INSTANTIATE_SYR2K_HER2K_CONCAT_TEMPLATE(false, float, float)
+INSTANTIATE_SYR2K_HER2K_CONCAT_TEMPLATE(false, double, double)
+INSTANTIATE_SYR2K_HER2K_CONCAT_TEMPLATE(false, rocblas_float_complex, rocblas_float_complex)
+INSTANTIATE_SYR2K_HER2K_CONCAT_TEMPLATE(false, rocblas_double_complex, rocblas_double_complex)
+INSTANTIATE_SYR2K_HER2K_CONCAT_TEMPLATE( true, rocblas_float_complex, float)
+INSTANTIATE_SYR2K_HER2K_CONCAT_TEMPLATE( true, rocblas_double_complex, double)
+
+#undef INSTANTIATE_SYR2K_HER2K_CONCAT_TEMPLATE
 // clang-format on
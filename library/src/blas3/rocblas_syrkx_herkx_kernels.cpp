@@ -23,6 +23,7 @@
 #include "Tensile/gemm.hpp"
 #include "definitions.hpp"
 #include "rocblas_block_sizes.h"
+#include "rocblas_symm_syrk_small_batched.hpp"
 #include "rocblas_syr2k_her2k.hpp"
 #include "rocblas_syrkx.hpp"
 
@@ -79,6 +80,29 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         return rocblas_status_internal_error; // always pushed host_mode prevalidation
     }
 
+    // Large batches of tiny matrices, which the blocks of the syr2k template under-utilize
+    if(rocblas_symm_syrk_use_small_batched(n, n, batch_count))
+        return rocblas_syrkx_herkx_small_batched_solution<HERK>(handle,
+                                                                uplo,
+                                                                trans,
+                                                                n,
+                                                                k,
+                                                                *alpha,
+                                                                da,
+                                                                offset_a,
+                                                                lda,
+                                                                stride_a,
+                                                                db,
+                                                                offset_b,
+                                                                ldb,
+                                                                stride_b,
+                                                                *beta,
+                                                                dc,
+                                                                offset_c,
+                                                                ldc,
+                                                                stride_c,
+                                                                batch_count);
+
     return rocblas_internal_syr2k_her2k_template<MIN_NB, BATCHED, TWOK, HERK>(handle,
                                                                               uplo,
                                                                               trans,
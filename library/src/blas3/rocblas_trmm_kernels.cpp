@@ -1506,6 +1506,9 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     if(!m || !n || !batch_count)
         return rocblas_status_success;
 
+    // In-place (dB == dC, as for rocblas_trmm) uses the block-recursive method without
+    // workspace: each half of B is overwritten only after the gemm that reads it for the
+    // off-diagonal update of the other half, and the leaf kernels stage B in shared memory.
     bool inplace = (dB == dC) || BATCHED || batch_count != 1;
 
     rocblas_int k = side == rocblas_side_left ? m : n;
@@ -1535,28 +1538,50 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 
     else
     {
-        return rocblas_internal_trmm_recursive_template<NB, BATCHED, T>(handle,
-                                                                        side,
-                                                                        uplo,
-                                                                        trans_a,
-                                                                        diag,
-                                                                        m,
-                                                                        n,
-                                                                        alpha,
-                                                                        stride_alpha,
-                                                                        dA,
-                                                                        offset_a,
-                                                                        lda,
-                                                                        stride_a,
-                                                                        dB,
-                                                                        offset_b,
-                                                                        ldb,
-                                                                        stride_b,
-                                                                        dC,
-                                                                        offset_c,
-                                                                        ldc,
-                                                                        stride_c,
-                                                                        batch_count);
+        // The columns of B for the left side, or its rows for the right side, are independent:
+        // with forked streams each stream computes a block of them, of at least
+        // ROCBLAS_TRMM_FORK_MIN_WIDTH, so that medium sizes are not limited to one stream
+        constexpr rocblas_int ROCBLAS_TRMM_FORK_MIN_WIDTH = 256;
+
+        bool        left   = side == rocblas_side_left;
+        rocblas_int width  = left ? n : m;
+        auto        forked = handle->fork_streams(width / ROCBLAS_TRMM_FORK_MIN_WIDTH);
+        rocblas_int blocks = forked.size();
+        rocblas_int bwidth = (width + blocks - 1) / blocks;
+
+        rocblas_status status = rocblas_status_success;
+        for(rocblas_int i = 0; i < blocks && status == rocblas_status_success; i++)
+        {
+            rocblas_int    first   = i * bwidth;
+            rocblas_stride shift_b = left ? first * rocblas_stride(ldb) : first;
+            rocblas_stride shift_c = left ? first * rocblas_stride(ldc) : first;
+
+            forked.select(i);
+            status = rocblas_internal_trmm_recursive_template<NB, BATCHED, T>(
+                handle,
+                side,
+                uplo,
+                trans_a,
+                diag,
+                left ? m : std::min(bwidth, m - first),
+                left ? std::min(bwidth, n - first) : n,
+                alpha,
+                stride_alpha,
+                dA,
+                offset_a,
+                lda,
+                stride_a,
+                dB,
+                offset_b + shift_b,
+                ldb,
+                stride_b,
+                dC,
+                offset_c + shift_c,
+                ldc,
+                stride_c,
+                batch_count);
+        }
+        return status;
     }
 
     return rocblas_status_success;
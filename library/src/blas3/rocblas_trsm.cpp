@@ -25,6 +25,7 @@
 #include "logging.hpp"
 #include "rocblas.h"
 #include "rocblas_block_sizes.h"
+#include "rocblas_trsm_refine.hpp"
 #include "trtri_trsm.hpp"
 #include "utility.hpp"
 
@@ -62,7 +63,8 @@ namespace
                                         T*                B,
                                         rocblas_int       ldb,
                                         const T*          supplied_invA      = nullptr,
-                                        rocblas_int       supplied_invA_size = 0)
+                                        rocblas_int       supplied_invA_size = 0,
+                                        bool              refine             = false)
     {
         if(!handle)
             return rocblas_status_invalid_handle;
@@ -73,7 +75,7 @@ namespace
         /////////////
         if(!handle->is_device_memory_size_query())
         {
-            auto layer_mode = handle->layer_mode;
+            auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
             if(layer_mode
                & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
                   | rocblas_layer_mode_log_profile))
@@ -178,11 +180,28 @@ namespace
                 return trsm_check_numerics_status;
         }
 
+        // Double precision systems of rocblas_trsm_ex are solved in single precision with iterative
+        // refinement when enabled, falling back to the double precision solve below
+        bool refined = false;
+        if constexpr(std::is_same_v<T, double> || std::is_same_v<T, rocblas_double_complex>)
+        {
+            if(refine && handle->trsm_refinement_steps > 0 && !supplied_invA)
+            {
+                rocblas_status refine_status = rocblas_trsm_refine_template<BLOCK>(
+                    handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+                if(refine_status != rocblas_status_success
+                   && refine_status != rocblas_status_continue)
+                    return refine_status;
+                refined = refine_status == rocblas_status_success;
+            }
+        }
+
         //////////////////////
         // MEMORY MANAGEMENT//
         //////////////////////
         rocblas_status status = rocblas_status_success;
         //kernel function is enclosed inside the brackets so that the handle device memory used by the kernel is released after the computation.
+        if(!refined)
         {
             // Proxy object holds the allocation. It must stay alive as long as mem_* pointers below are alive.
             auto           w_mem = handle->device_malloc(0);
@@ -398,7 +417,8 @@ try
             static_cast<double*>(B),
             ldb,
             static_cast<const double*>(invA),
-            invA_size);
+            invA_size,
+            true);
 
     case rocblas_datatype_f32_r:
         return rocblas_trsm_ex_impl<ROCBLAS_TRSM_NB, ROCBLAS_SDCTRSV_NB>(
@@ -449,7 +469,8 @@ try
             static_cast<rocblas_double_complex*>(B),
             ldb,
             static_cast<const rocblas_double_complex*>(invA),
-            invA_size);
+            invA_size,
+            true);
 
     default:
         return rocblas_status_not_implemented;
@@ -460,4 +481,45 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+#ifdef IMPL
+#error IMPL IS ALREADY DEFINED
+#endif
+
+// Workspace size queries run the function as a device memory size query, which validates
+// the pointer arguments but does not access them
+#define IMPL(name_, T_, DIM_X_)                                                          \
+    rocblas_status name_(rocblas_handle    handle,                                       \
+                         rocblas_side      side,                                         \
+                         rocblas_fill      uplo,                                         \
+                         rocblas_operation transA,                                       \
+                         rocblas_diagonal  diag,                                         \
+                         rocblas_int       m,                                            \
+                         rocblas_int       n,                                            \
+                         rocblas_int       lda,                                          \
+                         rocblas_int       ldb,                                          \
+                         size_t*           size)                                         \
+    try                                                                                  \
+    {                                                                                    \
+        if(!handle)                                                                      \
+            return rocblas_status_invalid_handle;                                        \
+                                                                                         \
+        const T_ one = T_(1);                                                            \
+        T_       dummy{};                                                                \
+        return handle->query_device_memory_size(size, [&] {                              \
+            return rocblas_trsm_ex_impl<ROCBLAS_TRSM_NB, DIM_X_>(                        \
+                handle, side, uplo, transA, diag, m, n, &one, &dummy, lda, &dummy, ldb); \
+        });                                                                              \
+    }                                                                                    \
+    catch(...)                                                                           \
+    {                                                                                    \
+        return exception_to_rocblas_status();                                            \
+    }
+
+IMPL(rocblas_strsm_workspace_size, float, ROCBLAS_SDCTRSV_NB);
+IMPL(rocblas_dtrsm_workspace_size, double, ROCBLAS_SDCTRSV_NB);
+IMPL(rocblas_ctrsm_workspace_size, rocblas_float_complex, ROCBLAS_SDCTRSV_NB);
+IMPL(rocblas_ztrsm_workspace_size, rocblas_double_complex, ROCBLAS_ZTRSV_NB);
+
+#undef IMPL
+
 } // extern "C"
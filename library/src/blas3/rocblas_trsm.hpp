@@ -1491,6 +1491,9 @@ inline bool
     return (side == rocblas_side_left && transA == rocblas_operation_none && m > n * 4 && m > 8192);
 }
 
+// Minimum number of columns of B solved by each forked stream of the left side
+constexpr rocblas_int ROCBLAS_TRSM_FORK_MIN_WIDTH = 256;
+
 static const size_t rocblas_internal_trsm_reg_kernel_mem_limit = [] {
     // 128 MB
     // How much memory to limit usage of regular trsm_left and trsm_right kernels,
@@ -1572,6 +1575,41 @@ inline bool rocblas_internal_trsm_use_substitution(rocblas_side side,
            && ((n <= 32 && batch_count >= 16 && m < 512) || (n > 32 && n <= 128 && m <= 340));
 }
 
+static const rocblas_int rocblas_internal_trsm_recursive_min_size = [] {
+    // Both m and n from which the recursive trsm is used instead of the inversion method.
+    // Its GEMMs are large enough to run near peak and it needs no workspace, which the
+    // inversion method needs m * n elements of when its special kernel can't be used.
+    // 0 disables the recursive trsm.
+    constexpr rocblas_int TRSM_RECURSIVE_MIN_SIZE = 8192;
+    rocblas_int           min_size;
+    const char*           env = getenv("ROCBLAS_INTERNAL_TRSM_RECURSIVE_MIN_SIZE");
+    return env && sscanf(env, "%d", &min_size) == 1 ? min_size : TRSM_RECURSIVE_MIN_SIZE;
+}();
+
+template <rocblas_int BLOCK, typename T>
+inline bool rocblas_internal_trsm_use_recursive(rocblas_side side,
+                                                rocblas_int  m,
+                                                rocblas_int  n,
+                                                rocblas_int  batch_count)
+{
+#ifndef BUILD_WITH_TENSILE
+    return false;
+#endif
+
+    if(rocblas_internal_trsm_recursive_min_size <= 0)
+        return false;
+
+    if(m >= rocblas_internal_trsm_recursive_min_size
+       && n >= rocblas_internal_trsm_recursive_min_size)
+        return true;
+
+    // The special kernel can't be used when k is not a multiple of BLOCK, so the regular kernels
+    // need m * n elements of workspace. Avoid this when it is more than the memory limit.
+    rocblas_int k = side == rocblas_side_left ? m : n;
+    return m > 64 && n > 64 && (k % BLOCK) != 0
+           && size_t(m) * n * sizeof(T) * batch_count > rocblas_internal_trsm_reg_kernel_mem_limit;
+}
+
 inline rocblas_int get_index(const rocblas_int* intervals, rocblas_int max, rocblas_int dim)
 {
     rocblas_int i;
@@ -1740,9 +1778,18 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         return rocblas_status_continue;
     }
 
-    // Whether size is an exact multiple of blocksize
-    const bool exact_blocks = (k % BLOCK) == 0;
-    const bool use_special  = trsm_use_special_kernel<BLOCK, BATCHED, T>(
+    // no memory needed for the recursive method
+    if(rocblas_internal_trsm_use_recursive<BLOCK, T>(side, m, n, batch_count))
+    {
+        *w_x_tmp_size        = 0;
+        *w_x_tmp_arr_size    = 0;
+        *w_invA_size         = 0;
+        *w_invA_arr_size     = 0;
+        *w_x_tmp_size_backup = 0;
+        return rocblas_status_continue;
+    }
+
+    const bool use_special = trsm_use_special_kernel<BLOCK, BATCHED, T>(
         side, transA, m, n, batch_count, supplied_invA_size);
 
     size_t invA_temp_bytes     = 0;
@@ -1755,18 +1802,10 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     {
         invA_temp_bytes = BLOCK * k * sizeof(T) * batch_count;
 
-        // When k < BLOCK, C is unnecessary for trtri
-        c_temp_bytes = ((k / BLOCK) * ((BLOCK / 2) * (BLOCK / 2))) * sizeof(T);
-
-        // For the TRTRI last diagonal block we need remainder space if k % BLOCK != 0
-        if(!exact_blocks)
-        {
-            // TODO: Make this more accurate -- right now it's much larger than necessary
-            size_t remainder_bytes = ROCBLAS_TRTRI_NB * BLOCK * 2 * sizeof(T);
-
-            // C is the maximum of the temporary space needed for TRTRI
-            c_temp_bytes = std::max(c_temp_bytes, remainder_bytes);
-        }
+        // C is the temporary space needed for TRTRI; batched trtri inverts all batches
+        // together, so each batch needs its own C
+        c_temp_bytes = rocblas_trtri_trsm_c_temp_els<BLOCK>(k) * sizeof(T)
+                       * (BATCHED ? batch_count : 1);
     }
 
     // non-special kernel (regular left/right kernel) when not exact blocks. Also used
@@ -3256,6 +3295,159 @@ void rocblas_trsm_small_64(rocblas_handle    handle,
 //////////////////////////////
 //////////////////////////////
 //////////////////////////////
+/* T = float, double, etc.
+ * ATYPE = const T* or const T* const *
+ * BTYPE = T* or T* const *
+ *
+ * Solves op(A) X = alpha B or X op(A) = alpha B by splitting A in two diagonal blocks and the
+ * off-diagonal block between them. The diagonal block solved first is solved recursively, the
+ * other part of B is updated with one GEMM, and the other diagonal block is solved recursively.
+ * Blocks of at most ROCBLAS_TRSM_RECURSIVE_LEAF columns are solved with the small kernels.
+ * X overwrites B and no workspace is needed.
+ */
+constexpr rocblas_int ROCBLAS_TRSM_RECURSIVE_LEAF = 32;
+
+template <bool BATCHED, typename T, typename ATYPE, typename BTYPE>
+rocblas_status rocblas_trsm_recursive(rocblas_handle    handle,
+                                      rocblas_side      side,
+                                      rocblas_fill      uplo,
+                                      rocblas_operation transA,
+                                      rocblas_diagonal  diag,
+                                      rocblas_int       m,
+                                      rocblas_int       n,
+                                      T                 alpha,
+                                      ATYPE             dA,
+                                      rocblas_stride    offset_A,
+                                      rocblas_int       lda,
+                                      rocblas_stride    stride_A,
+                                      BTYPE             dB,
+                                      rocblas_stride    offset_B,
+                                      rocblas_int       ldb,
+                                      rocblas_stride    stride_B,
+                                      rocblas_int       batch_count)
+{
+    const bool  LEFT = side == rocblas_side_left;
+    rocblas_int k    = LEFT ? m : n;
+
+    if(k <= ROCBLAS_TRSM_RECURSIVE_LEAF)
+    {
+#define TRSM_RECURSIVE_LEAF_LAUNCH(NB)                                                             \
+    rocblas_trsm_small<T, T, ATYPE, BTYPE, NB>(handle,                                             \
+                                               side,                                               \
+                                               uplo,                                               \
+                                               transA,                                             \
+                                               diag,                                               \
+                                               m,                                                  \
+                                               n,                                                  \
+                                               alpha,                                              \
+                                               dA,                                                 \
+                                               offset_A,                                           \
+                                               lda,                                                \
+                                               stride_A,                                           \
+                                               dB,                                                 \
+                                               offset_B,                                           \
+                                               ldb,                                                \
+                                               stride_B,                                           \
+                                               batch_count)
+
+        if(k <= 8)
+            TRSM_RECURSIVE_LEAF_LAUNCH(8);
+        else if(k <= 16)
+            TRSM_RECURSIVE_LEAF_LAUNCH(16);
+        else
+            TRSM_RECURSIVE_LEAF_LAUNCH(32);
+
+#undef TRSM_RECURSIVE_LEAF_LAUNCH
+
+        return rocblas_status_success;
+    }
+
+    // k1 is a multiple of the leaf size, so that all leaves but the last are full
+    rocblas_int k1 = ((k / 2 + ROCBLAS_TRSM_RECURSIVE_LEAF - 1) / ROCBLAS_TRSM_RECURSIVE_LEAF)
+                     * ROCBLAS_TRSM_RECURSIVE_LEAF;
+    rocblas_int k2 = k - k1;
+
+    // offsets of the diagonal blocks A11 (k1 x k1) and A22 (k2 x k2), of the off-diagonal
+    // block (A21 if lower, A12 if upper), and of the parts of B they apply to
+    rocblas_stride offset_A11 = offset_A;
+    rocblas_stride offset_A22 = offset_A + k1 + rocblas_stride(k1) * lda;
+    rocblas_stride offset_Aoff
+        = uplo == rocblas_fill_lower ? offset_A + k1 : offset_A + rocblas_stride(k1) * lda;
+    rocblas_stride offset_B1 = offset_B;
+    rocblas_stride offset_B2 = offset_B + (LEFT ? k1 : rocblas_stride(k1) * ldb);
+
+    // op(A) is lower triangular for lower non-transposed or upper transposed A.
+    // Left lower and right upper are solved from A11 to A22, the others from A22 to A11.
+    const bool     lower_op    = (uplo == rocblas_fill_lower) == (transA == rocblas_operation_none);
+    const bool     first_A11   = LEFT == lower_op;
+    rocblas_int    k_first     = first_A11 ? k1 : k2;
+    rocblas_int    k_second    = first_A11 ? k2 : k1;
+    rocblas_stride offA_first  = first_A11 ? offset_A11 : offset_A22;
+    rocblas_stride offA_second = first_A11 ? offset_A22 : offset_A11;
+    rocblas_stride offB_first  = first_A11 ? offset_B1 : offset_B2;
+    rocblas_stride offB_second = first_A11 ? offset_B2 : offset_B1;
+
+    RETURN_IF_ROCBLAS_ERROR((rocblas_trsm_recursive<BATCHED, T>(handle,
+                                                                side,
+                                                                uplo,
+                                                                transA,
+                                                                diag,
+                                                                LEFT ? k_first : m,
+                                                                LEFT ? n : k_first,
+                                                                alpha,
+                                                                dA,
+                                                                offA_first,
+                                                                lda,
+                                                                stride_A,
+                                                                dB,
+                                                                offB_first,
+                                                                ldb,
+                                                                stride_B,
+                                                                batch_count)));
+
+    // B_second = alpha * B_second - op(A_off) * X_first (left) or X_first * op(A_off) (right)
+    RETURN_IF_ROCBLAS_ERROR(
+        rocblas_internal_gemm_template<BATCHED>(handle,
+                                                LEFT ? transA : rocblas_operation_none,
+                                                LEFT ? rocblas_operation_none : transA,
+                                                LEFT ? k_second : m,
+                                                LEFT ? n : k_second,
+                                                k_first,
+                                                &alpha_negative_one<T>,
+                                                LEFT ? dA : (ATYPE)dB,
+                                                LEFT ? offset_Aoff : offB_first,
+                                                LEFT ? lda : ldb,
+                                                LEFT ? stride_A : stride_B,
+                                                LEFT ? (ATYPE)dB : dA,
+                                                LEFT ? offB_first : offset_Aoff,
+                                                LEFT ? ldb : lda,
+                                                LEFT ? stride_B : stride_A,
+                                                &alpha,
+                                                dB,
+                                                offB_second,
+                                                ldb,
+                                                stride_B,
+                                                batch_count));
+
+    return rocblas_trsm_recursive<BATCHED, T>(handle,
+                                              side,
+                                              uplo,
+                                              transA,
+                                              diag,
+                                              LEFT ? k_second : m,
+                                              LEFT ? n : k_second,
+                                              T(1),
+                                              dA,
+                                              offA_second,
+                                              lda,
+                                              stride_A,
+                                              dB,
+                                              offB_second,
+                                              ldb,
+                                              stride_B,
+                                              batch_count);
+}
+
 template <rocblas_int BLOCK, rocblas_int DIM_X, bool BATCHED, typename T, typename U, typename V>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     rocblas_internal_trsm_template(rocblas_handle    handle,
@@ -3325,7 +3517,15 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         if(saved_pointer_mode == rocblas_pointer_mode_host)
             alpha_h = *alpha;
         else
-            RETURN_IF_HIP_ERROR(hipMemcpy(&alpha_h, alpha, sizeof(T), hipMemcpyDeviceToHost));
+        {
+            if(handle->is_graph_safe())
+                return rocblas_status_not_implemented;
+
+            // Stream-ordered copy: only the handle's stream is synchronized
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                &alpha_h, alpha, sizeof(T), hipMemcpyDeviceToHost, handle->get_stream()));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+        }
 
         if(alpha_h == T(0.0))
         {
@@ -3337,6 +3537,32 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         bool is_small = (k <= 32) || (m <= 64 && n <= 64);
         if(is_small)
         {
+            // Tiny systems are solved by one thread per right hand side, several systems per block
+            if(rocblas_trsm_use_small_batched(side, m, n))
+            {
+                handle->log_kernel("rocblas_trsm_small_batched");
+                return rocblas_internal_trsm_small_batched_template<T>(handle,
+                                                                       side,
+                                                                       uplo,
+                                                                       transA,
+                                                                       diag,
+                                                                       m,
+                                                                       n,
+                                                                       alpha_h,
+                                                                       A,
+                                                                       offset_A,
+                                                                       lda,
+                                                                       stride_A,
+                                                                       B,
+                                                                       offset_B,
+                                                                       1,
+                                                                       ldb,
+                                                                       stride_B,
+                                                                       batch_count);
+            }
+
+            handle->log_kernel("rocblas_trsm_small");
+
             if(k <= 2)
                 rocblas_trsm_small<T, T, U, V, 2>(handle,
                                                   side,
@@ -3461,6 +3687,8 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 
             if(use_sub && blksize)
             {
+                handle->log_kernel("rocblas_trsm_small_substitution");
+
 #define TRSM_SUBSTITUTION_LAUNCH(T, LEFT, UPPER, TRANS, CONJ, DIAG, BATCHED)              \
     rocblas_trsm_small_substitution<T, T, U, V, LEFT, UPPER, TRANS, CONJ, DIAG, BATCHED>( \
         handle,                                                                           \
@@ -3571,6 +3799,28 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                 return rocblas_status_success;
             }
 
+            if(rocblas_internal_trsm_use_recursive<BLOCK, T>(side, m, n, batch_count))
+            {
+                handle->log_kernel("rocblas_trsm_recursive");
+                return rocblas_trsm_recursive<BATCHED, T>(handle,
+                                                          side,
+                                                          uplo,
+                                                          transA,
+                                                          diag,
+                                                          m,
+                                                          n,
+                                                          alpha_h,
+                                                          A,
+                                                          offset_A,
+                                                          lda,
+                                                          stride_A,
+                                                          B,
+                                                          offset_B,
+                                                          ldb,
+                                                          stride_B,
+                                                          batch_count);
+            }
+
             // perf_status indicates whether optimal performance is obtainable with available memory
             rocblas_status perf_status = rocblas_status_success;
 
@@ -3594,10 +3844,11 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                 stride_invA = BLOCK * k;
                 if(BATCHED)
                 {
-                    // for w_c_temp, we currently can use the same memory from each batch since
-                    // trtri_batched is naive (since gemm_batched is naive)
-                    setup_batched_array<BLOCK>(
-                        handle->get_stream(), (T*)w_c_temp, 0, (T**)w_x_temparr, batch_count);
+                    setup_batched_array<BLOCK>(handle->get_stream(),
+                                               (T*)w_c_temp,
+                                               rocblas_trtri_trsm_c_temp_els<BLOCK>(k),
+                                               (T**)w_x_temparr,
+                                               batch_count);
                     setup_batched_array<BLOCK>(
                         handle->get_stream(), (T*)invA, stride_invA, (T**)invAarr, batch_count);
                 }
@@ -3634,6 +3885,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 #ifdef BUILD_WITH_TENSILE
             if(use_special)
             {
+                handle->log_kernel("special_trsm");
                 status = special_trsm_template<BLOCK, BATCHED>(handle,
                                                                side,
                                                                uplo,
@@ -3661,6 +3913,62 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
             else
 #endif
             {
+                handle->log_kernel(side == rocblas_side_left ? "rocblas_trsm_left"
+                                                             : "rocblas_trsm_right");
+                if(!BATCHED && side == rocblas_side_left && n >= 2 * ROCBLAS_TRSM_FORK_MIN_WIDTH)
+                {
+                    // The columns of B are solved independently, each with the same columns of
+                    // x_temp, so that blocks of them can be solved on forked streams
+                    auto        forked = handle->fork_streams(n / ROCBLAS_TRSM_FORK_MIN_WIDTH);
+                    rocblas_int blocks = forked.size();
+                    rocblas_int bwidth = (n + blocks - 1) / blocks;
+
+                    for(rocblas_int i = 0; i < blocks && status == rocblas_status_success; i++)
+                    {
+                        rocblas_int    first    = i * bwidth;
+                        rocblas_int    width    = std::min(bwidth, n - first);
+                        rocblas_stride offset_X = rocblas_stride(first) * m;
+
+                        forked.select(i);
+                        status = rocblas_trsm_left<BLOCK, BATCHED, T>(
+                            handle,
+                            uplo,
+                            transA,
+                            m,
+                            width,
+                            &alpha_h,
+                            U(A),
+                            offset_A,
+                            lda,
+                            stride_A,
+                            V(B),
+                            offset_B + first * rocblas_stride(ldb),
+                            ldb,
+                            stride_B,
+                            batch_count,
+                            U(invA),
+                            offset_invA,
+                            stride_invA,
+                            V(w_x_temp) + offset_X,
+                            x_temp_els);
+
+                        if(status == rocblas_status_success)
+                            copy_block_unit<T>(handle,
+                                               m,
+                                               width,
+                                               U(w_x_temp),
+                                               m,
+                                               x_temp_els,
+                                               V(B),
+                                               ldb,
+                                               stride_B,
+                                               batch_count,
+                                               offset_X,
+                                               offset_B + first * rocblas_stride(ldb));
+                    }
+                    return status == rocblas_status_success ? perf_status : status;
+                }
+
                 if(side == rocblas_side_left)
                     status
                         = rocblas_trsm_left<BLOCK, BATCHED, T>(handle,
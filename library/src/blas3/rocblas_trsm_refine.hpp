@@ -0,0 +1,545 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * ===========================================================================
+ *    Mixed precision trsm with iterative refinement: the system is solved in
+ *    single precision and the solution is corrected from double precision
+ *    residuals, as in LAPACK dsgesv
+ * ===========================================================================
+ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas.h"
+#include "rocblas_block_sizes.h"
+#include "rocblas_trmm.hpp"
+#include "rocblas_trsm.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+//! @brief Single precision type of the refined solve of T.
+template <typename T>
+struct rocblas_trsm_refine_type;
+
+template <>
+struct rocblas_trsm_refine_type<double>
+{
+    using type = float;
+};
+
+template <>
+struct rocblas_trsm_refine_type<rocblas_double_complex>
+{
+    using type = rocblas_float_complex;
+};
+
+template <typename T>
+using rocblas_trsm_refine_t = typename rocblas_trsm_refine_type<T>::type;
+
+constexpr rocblas_int ROCBLAS_TRSM_REFINE_DIM_X = 64;
+constexpr rocblas_int ROCBLAS_TRSM_REFINE_DIM_Y = 4;
+
+// Largest elements tracked in workspace, as the bit patterns of non-negative doubles, which
+// are ordered like the doubles
+enum rocblas_trsm_refine_norm
+{
+    rocblas_trsm_refine_norm_A,
+    rocblas_trsm_refine_norm_R,
+    rocblas_trsm_refine_norm_X,
+    rocblas_trsm_refine_norms
+};
+
+//! @brief |re| + |im| of x, the magnitude of the complex elements compared for convergence.
+__device__ inline double rocblas_trsm_refine_abs1(double x)
+{
+    return fabs(x);
+}
+
+__device__ inline double rocblas_trsm_refine_abs1(rocblas_double_complex x)
+{
+    return fabs(x.real()) + fabs(x.imag());
+}
+
+//! @brief Reduces the thread values v of the block into norm with a single atomic.
+__device__ inline void rocblas_trsm_refine_max(double v, unsigned long long* norm)
+{
+    constexpr int NT = ROCBLAS_TRSM_REFINE_DIM_X * ROCBLAS_TRSM_REFINE_DIM_Y;
+
+    __shared__ double s_max[NT];
+    int               tid = threadIdx.x + threadIdx.y * ROCBLAS_TRSM_REFINE_DIM_X;
+    s_max[tid]            = v;
+    __syncthreads();
+    for(int i = NT / 2; i > 0; i /= 2)
+    {
+        // a NaN compares false and is kept, so that it propagates to the result
+        if(tid < i && !(s_max[tid] >= s_max[tid + i]))
+            s_max[tid] = s_max[tid + i];
+        __syncthreads();
+    }
+    if(tid == 0)
+        atomicMax(norm, (unsigned long long)__double_as_longlong(s_max[0]));
+}
+
+//! @brief Copies the referenced triangle of the k x k matrix A to single precision, tracking its
+//!        largest element.
+template <typename T, typename S>
+ROCBLAS_KERNEL(ROCBLAS_TRSM_REFINE_DIM_X* ROCBLAS_TRSM_REFINE_DIM_Y)
+rocblas_trsm_refine_convert_a_kernel(bool                upper,
+                                     bool                unit,
+                                     rocblas_int         k,
+                                     const T*            A,
+                                     rocblas_int         lda,
+                                     S*                  As,
+                                     unsigned long long* norms)
+{
+    int64_t i = blockIdx.x * int64_t(ROCBLAS_TRSM_REFINE_DIM_X) + threadIdx.x;
+    double  v = unit ? 1.0 : 0.0;
+
+    for(int64_t j = blockIdx.y * int64_t(ROCBLAS_TRSM_REFINE_DIM_Y) + threadIdx.y; j < k;
+        j += gridDim.y * int64_t(ROCBLAS_TRSM_REFINE_DIM_Y))
+    {
+        if(i < k && (i == j ? !unit : upper == (i < j)))
+        {
+            T a           = A[i + j * lda];
+            As[i + j * k] = S(a);
+            double a1     = rocblas_trsm_refine_abs1(a);
+            v             = v >= a1 ? v : a1;
+        }
+    }
+
+    rocblas_trsm_refine_max(v, norms + rocblas_trsm_refine_norm_A);
+}
+
+//! @brief Copies B to Bc and alpha * B to single precision in Rs, tracking the largest element
+//!        of alpha * B.
+template <typename T, typename S>
+ROCBLAS_KERNEL(ROCBLAS_TRSM_REFINE_DIM_X* ROCBLAS_TRSM_REFINE_DIM_Y)
+rocblas_trsm_refine_init_kernel(rocblas_int         m,
+                                rocblas_int         n,
+                                T                   alpha,
+                                const T*            B,
+                                rocblas_int         ldb,
+                                T*                  Bc,
+                                S*                  Rs,
+                                unsigned long long* norms)
+{
+    int64_t i = blockIdx.x * int64_t(ROCBLAS_TRSM_REFINE_DIM_X) + threadIdx.x;
+    double  v = 0;
+
+    for(int64_t j = blockIdx.y * int64_t(ROCBLAS_TRSM_REFINE_DIM_Y) + threadIdx.y; j < n;
+        j += gridDim.y * int64_t(ROCBLAS_TRSM_REFINE_DIM_Y))
+    {
+        if(i < m)
+        {
+            T b           = B[i + j * ldb];
+            Bc[i + j * m] = b;
+            T r           = alpha * b;
+            Rs[i + j * m] = S(r);
+            double r1     = rocblas_trsm_refine_abs1(r);
+            v             = v >= r1 ? v : r1;
+        }
+    }
+
+    rocblas_trsm_refine_max(v, norms + rocblas_trsm_refine_norm_R);
+}
+
+//! @brief Sets X to the single precision solution Rs, or adds the correction Rs to X, and copies
+//!        X to Y for the residual, tracking the largest element of X.
+template <bool FIRST, typename T, typename S>
+ROCBLAS_KERNEL(ROCBLAS_TRSM_REFINE_DIM_X* ROCBLAS_TRSM_REFINE_DIM_Y)
+rocblas_trsm_refine_update_kernel(rocblas_int         m,
+                                  rocblas_int         n,
+                                  const S*            Rs,
+                                  T*                  X,
+                                  rocblas_int         ldx,
+                                  T*                  Y,
+                                  unsigned long long* norms)
+{
+    int64_t i = blockIdx.x * int64_t(ROCBLAS_TRSM_REFINE_DIM_X) + threadIdx.x;
+    double  v = 0;
+
+    for(int64_t j = blockIdx.y * int64_t(ROCBLAS_TRSM_REFINE_DIM_Y) + threadIdx.y; j < n;
+        j += gridDim.y * int64_t(ROCBLAS_TRSM_REFINE_DIM_Y))
+    {
+        if(i < m)
+        {
+            T x = T(Rs[i + j * m]);
+            if(!FIRST)
+                x += X[i + j * ldx];
+            X[i + j * ldx] = x;
+            Y[i + j * m]   = x;
+            double x1      = rocblas_trsm_refine_abs1(x);
+            v              = v >= x1 ? v : x1;
+        }
+    }
+
+    rocblas_trsm_refine_max(v, norms + rocblas_trsm_refine_norm_X);
+}
+
+//! @brief Computes the residual alpha * Bc - Y, where Y holds the product of op(A) and X, in
+//!        single precision in Rs, tracking its largest element.
+template <typename T, typename S>
+ROCBLAS_KERNEL(ROCBLAS_TRSM_REFINE_DIM_X* ROCBLAS_TRSM_REFINE_DIM_Y)
+rocblas_trsm_refine_residual_kernel(rocblas_int         m,
+                                    rocblas_int         n,
+                                    T                   alpha,
+                                    const T*            Bc,
+                                    const T*            Y,
+                                    S*                  Rs,
+                                    unsigned long long* norms)
+{
+    int64_t i = blockIdx.x * int64_t(ROCBLAS_TRSM_REFINE_DIM_X) + threadIdx.x;
+    double  v = 0;
+
+    for(int64_t j = blockIdx.y * int64_t(ROCBLAS_TRSM_REFINE_DIM_Y) + threadIdx.y; j < n;
+        j += gridDim.y * int64_t(ROCBLAS_TRSM_REFINE_DIM_Y))
+    {
+        if(i < m)
+        {
+            T r           = alpha * Bc[i + j * m] - Y[i + j * m];
+            Rs[i + j * m] = S(r);
+            double r1     = rocblas_trsm_refine_abs1(r);
+            v             = v >= r1 ? v : r1;
+        }
+    }
+
+    rocblas_trsm_refine_max(v, norms + rocblas_trsm_refine_norm_R);
+}
+
+//! @brief Bytes of device memory of the refinement, besides the single precision solve.
+template <typename T>
+inline void rocblas_trsm_refine_workspace_size(rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_int k,
+                                               size_t*     w_b_size,
+                                               size_t*     w_a_size,
+                                               size_t*     w_r_size,
+                                               size_t*     w_norms_size)
+{
+    using S       = rocblas_trsm_refine_t<T>;
+    *w_b_size     = sizeof(T) * size_t(m) * n;
+    *w_a_size     = sizeof(S) * size_t(k) * k;
+    *w_r_size     = sizeof(S) * size_t(m) * n;
+    *w_norms_size = sizeof(unsigned long long) * rocblas_trsm_refine_norms;
+}
+
+/*! \brief Solves op(A) * X = alpha * B, or X * op(A) = alpha * B, for a double precision B in
+    single precision with iterative refinement.
+
+    A and alpha * B are copied to single precision, the single precision solution is computed by
+    rocblas_internal_trsm_template, and each refinement step computes the double precision
+    residual with rocblas_internal_trmm_template, whose gemms are in double precision, and adds
+    the single precision solution of op(A) * C = R to X.
+
+    @return rocblas_status_continue, with B unchanged, if the refinement does not apply or does
+    not converge within handle->trsm_refinement_steps steps, so that B is to be solved in double
+    precision. During a device memory size query, the size of the refinement is set and
+    rocblas_status_continue is returned.
+    ********************************************************************/
+template <rocblas_int BLOCK, typename T>
+rocblas_status rocblas_trsm_refine_template(rocblas_handle    handle,
+                                            rocblas_side      side,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const T*          alpha,
+                                            const T*          A,
+                                            rocblas_int       lda,
+                                            T*                B,
+                                            rocblas_int       ldb)
+{
+    using S = rocblas_trsm_refine_t<T>;
+
+    constexpr rocblas_int TRMM_NB = rocblas_is_complex<T> ? ROCBLAS_CZTRMM_NB : ROCBLAS_SDTRMM_NB;
+
+    rocblas_int k = side == rocblas_side_left ? m : n;
+
+    size_t w_b_size, w_a_size, w_r_size, w_norms_size;
+    rocblas_trsm_refine_workspace_size<T>(m, n, k, &w_b_size, &w_a_size, &w_r_size, &w_norms_size);
+
+    if(handle->is_device_memory_size_query())
+    {
+        size_t         x_tmp_size, x_tmp_arr_size, invA_size, invA_arr_size, x_tmp_size_backup;
+        rocblas_status status
+            = rocblas_internal_trsm_workspace_size<BLOCK, false, S>(side,
+                                                                    transA,
+                                                                    m,
+                                                                    n,
+                                                                    1,
+                                                                    0,
+                                                                    &x_tmp_size,
+                                                                    &x_tmp_arr_size,
+                                                                    &invA_size,
+                                                                    &invA_arr_size,
+                                                                    &x_tmp_size_backup);
+        if(status == rocblas_status_success)
+            handle->set_optimal_device_memory_size(w_b_size,
+                                                   w_b_size,
+                                                   w_a_size,
+                                                   w_r_size,
+                                                   w_norms_size,
+                                                   x_tmp_size,
+                                                   x_tmp_arr_size,
+                                                   invA_size,
+                                                   invA_arr_size);
+        else if(status == rocblas_status_continue)
+            handle->set_optimal_device_memory_size(
+                w_b_size, w_b_size, w_a_size, w_r_size, w_norms_size);
+        return rocblas_status_continue;
+    }
+
+    // The convergence is read on the host after each residual
+    if(handle->is_graph_safe() || handle->is_stream_in_capture_mode())
+        return rocblas_status_continue;
+
+    hipStream_t stream = handle->get_stream();
+
+    T h_alpha;
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(&h_alpha, alpha, sizeof(T), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+    else
+        h_alpha = *alpha;
+
+    // Proxy object holds the allocation of the refinement, which is released last
+    auto w_ref = handle->device_malloc(w_b_size, w_b_size, w_a_size, w_r_size, w_norms_size);
+    if(!w_ref)
+        return rocblas_status_continue;
+
+    T*    Bc    = (T*)w_ref[0];
+    T*    Y     = (T*)w_ref[1];
+    S*    As    = (S*)w_ref[2];
+    S*    Rs    = (S*)w_ref[3];
+    auto* norms = (unsigned long long*)w_ref[4];
+
+    auto  w_mem = handle->device_malloc(0);
+    void* w_mem_x_temp;
+    void* w_mem_x_temp_arr;
+    void* w_mem_invA;
+    void* w_mem_invA_arr;
+
+    rocblas_status perf_status
+        = rocblas_internal_trsm_template_mem<BLOCK, false, S, S>(handle,
+                                                                 side,
+                                                                 transA,
+                                                                 m,
+                                                                 n,
+                                                                 1,
+                                                                 w_mem,
+                                                                 w_mem_x_temp,
+                                                                 w_mem_x_temp_arr,
+                                                                 w_mem_invA,
+                                                                 w_mem_invA_arr);
+    if(perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+        return rocblas_status_continue;
+    bool optimal_mem = perf_status == rocblas_status_success;
+
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    // Grids of one block per strip of 64 rows and at most 1024 blocks along the columns
+    auto grid = [](rocblas_int rows, rocblas_int cols) {
+        rocblas_int blocks_y = (cols - 1) / ROCBLAS_TRSM_REFINE_DIM_Y + 1;
+        return dim3((rows - 1) / ROCBLAS_TRSM_REFINE_DIM_X + 1, std::min(blocks_y, 1024));
+    };
+    dim3 threads(ROCBLAS_TRSM_REFINE_DIM_X, ROCBLAS_TRSM_REFINE_DIM_Y);
+
+    unsigned long long h_norms[rocblas_trsm_refine_norms];
+    auto               read_norms = [&]() -> rocblas_status {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(h_norms, norms, w_norms_size, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        return rocblas_status_success;
+    };
+    auto norm = [&](rocblas_trsm_refine_norm i) {
+        double v;
+        memcpy(&v, &h_norms[i], sizeof(v));
+        return v;
+    };
+
+    // The triangle of As which is not referenced is zero
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(As, 0, w_a_size, stream));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(norms, 0, w_norms_size, stream));
+    hipLaunchKernelGGL((rocblas_trsm_refine_convert_a_kernel<T, S>),
+                       grid(k, k),
+                       threads,
+                       0,
+                       stream,
+                       uplo == rocblas_fill_upper,
+                       diag == rocblas_diagonal_unit,
+                       k,
+                       A,
+                       lda,
+                       As,
+                       norms);
+    hipLaunchKernelGGL((rocblas_trsm_refine_init_kernel<T, S>),
+                       grid(m, n),
+                       threads,
+                       0,
+                       stream,
+                       m,
+                       n,
+                       h_alpha,
+                       B,
+                       ldb,
+                       Bc,
+                       Rs,
+                       norms);
+    RETURN_IF_ROCBLAS_ERROR(read_norms());
+
+    // A and alpha * B must be finite and fit in single precision
+    double a_norm = norm(rocblas_trsm_refine_norm_A);
+    if(!(a_norm <= std::numeric_limits<float>::max())
+       || !(norm(rocblas_trsm_refine_norm_R) <= std::numeric_limits<float>::max()))
+        return rocblas_status_continue;
+
+    const double tolerance = a_norm * std::sqrt(double(k)) * std::numeric_limits<double>::epsilon();
+
+    handle->log_kernel("rocblas_trsm_refine");
+
+    static const S s_one = S(1);
+    static const T t_one = T(1);
+
+    for(rocblas_int step = 0;; step++)
+    {
+        // Rs = the single precision solution for alpha * B, or for the residual
+        rocblas_status status
+            = rocblas_internal_trsm_template<BLOCK, ROCBLAS_SDCTRSV_NB, false, S>(handle,
+                                                                                  side,
+                                                                                  uplo,
+                                                                                  transA,
+                                                                                  diag,
+                                                                                  m,
+                                                                                  n,
+                                                                                  &s_one,
+                                                                                  (const S*)As,
+                                                                                  0,
+                                                                                  k,
+                                                                                  0,
+                                                                                  Rs,
+                                                                                  0,
+                                                                                  m,
+                                                                                  0,
+                                                                                  1,
+                                                                                  optimal_mem,
+                                                                                  w_mem_x_temp,
+                                                                                  w_mem_x_temp_arr,
+                                                                                  w_mem_invA,
+                                                                                  w_mem_invA_arr);
+        if(status != rocblas_status_success)
+            return status;
+
+        // X = Rs, or X += Rs, with Y = X
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(norms, 0, w_norms_size, stream));
+        if(step)
+            hipLaunchKernelGGL((rocblas_trsm_refine_update_kernel<false, T, S>),
+                               grid(m, n),
+                               threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               Rs,
+                               B,
+                               ldb,
+                               Y,
+                               norms);
+        else
+            hipLaunchKernelGGL((rocblas_trsm_refine_update_kernel<true, T, S>),
+                               grid(m, n),
+                               threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               Rs,
+                               B,
+                               ldb,
+                               Y,
+                               norms);
+
+        // Y = op(A) * X, or X * op(A), in place, and the residual alpha * B - Y in Rs
+        RETURN_IF_ROCBLAS_ERROR((rocblas_internal_trmm_template<TRMM_NB, false, T>(handle,
+                                                                                 side,
+                                                                                 uplo,
+                                                                                 transA,
+                                                                                 diag,
+                                                                                 m,
+                                                                                 n,
+                                                                                 &t_one,
+                                                                                 0,
+                                                                                 A,
+                                                                                 0,
+                                                                                 lda,
+                                                                                 0,
+                                                                                 (const T*)Y,
+                                                                                 0,
+                                                                                 m,
+                                                                                 0,
+                                                                                 Y,
+                                                                                 0,
+                                                                                 m,
+                                                                                 0,
+                                                                                 1)));
+        hipLaunchKernelGGL((rocblas_trsm_refine_residual_kernel<T, S>),
+                           grid(m, n),
+                           threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           h_alpha,
+                           Bc,
+                           Y,
+                           Rs,
+                           norms);
+        RETURN_IF_ROCBLAS_ERROR(read_norms());
+
+        double r_norm = norm(rocblas_trsm_refine_norm_R);
+        double x_norm = norm(rocblas_trsm_refine_norm_X);
+        if(!std::isfinite(r_norm) || !std::isfinite(x_norm))
+            break;
+        if(r_norm <= x_norm * tolerance)
+            return rocblas_status_success;
+        if(step == handle->trsm_refinement_steps)
+            break;
+    }
+
+    // Not converged: B is restored, to be solved in double precision
+    RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(B,
+                                         sizeof(T) * size_t(ldb),
+                                         Bc,
+                                         sizeof(T) * size_t(m),
+                                         sizeof(T) * size_t(m),
+                                         n,
+                                         hipMemcpyDeviceToDevice,
+                                         stream));
+    return rocblas_status_continue;
+}
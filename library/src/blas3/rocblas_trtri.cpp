@@ -59,7 +59,7 @@ namespace
             return handle->set_optimal_device_memory_size(size);
         }
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
 
         if(layer_mode & rocblas_layer_mode_log_trace)
@@ -232,4 +232,46 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+#ifdef IMPL
+#error IMPL IS ALREADY DEFINED
+#endif
+
+// Workspace size queries run the function as a device memory size query, which does not
+// access the matrices
+#define IMPL(name_, T_)                                                                       \
+    rocblas_status name_(rocblas_handle   handle,                                             \
+                         rocblas_fill     uplo,                                               \
+                         rocblas_diagonal diag,                                               \
+                         rocblas_int      n,                                                  \
+                         rocblas_int      lda,                                                \
+                         rocblas_int      ldinvA,                                             \
+                         size_t*          size)                                               \
+    try                                                                                       \
+    {                                                                                         \
+        if(!handle)                                                                           \
+            return rocblas_status_invalid_handle;                                             \
+                                                                                              \
+        T_             dummy{};                                                               \
+        rocblas_status arg_status                                                             \
+            = rocblas_trtri_arg_check(handle, uplo, diag, n, &dummy, lda, &dummy, ldinvA, 1); \
+        if(arg_status != rocblas_status_continue && arg_status != rocblas_status_success)     \
+            return arg_status;                                                                \
+                                                                                              \
+        return handle->query_device_memory_size(size, [&] {                                   \
+            return rocblas_trtri_impl<ROCBLAS_TRTRI_NB>(                                      \
+                handle, uplo, diag, n, &dummy, lda, &dummy, ldinvA);                          \
+        });                                                                                   \
+    }                                                                                         \
+    catch(...)                                                                                \
+    {                                                                                         \
+        return exception_to_rocblas_status();                                                 \
+    }
+
+IMPL(rocblas_strtri_workspace_size, float);
+IMPL(rocblas_dtrtri_workspace_size, double);
+IMPL(rocblas_ctrtri_workspace_size, rocblas_float_complex);
+IMPL(rocblas_ztrtri_workspace_size, rocblas_double_complex);
+
+#undef IMPL
+
 } // extern "C"
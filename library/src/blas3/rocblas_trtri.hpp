@@ -24,6 +24,8 @@
 
 #include "check_numerics_matrix.hpp"
 #include "gemm.hpp"
+#include <cstdio>
+#include <cstdlib>
 
 template <typename U, typename V>
 inline rocblas_status rocblas_trtri_arg_check(rocblas_handle   handle,
@@ -590,66 +592,95 @@ rocblas_status rocblas_trtri_gemm_block(rocblas_handle handle,
                                         rocblas_int    batch_count,
                                         rocblas_int    sub_blocks,
                                         rocblas_stride offset_A       = 0,
-                                        rocblas_int    offset_invAg1  = 0,
-                                        rocblas_int    offset_invAg2a = 0,
-                                        rocblas_int    offset_invAg2c = 0,
+                                        rocblas_stride offset_invAg1  = 0,
+                                        rocblas_stride offset_invAg2a = 0,
+                                        rocblas_stride offset_invAg2c = 0,
                                         rocblas_stride offset_C       = 0)
 {
-    std::unique_ptr<T*[]> host_A;
-    std::unique_ptr<T*[]> host_invAg1;
-    std::unique_ptr<T*[]> host_invAg2a;
-    std::unique_ptr<T*[]> host_invAg2c;
-    std::unique_ptr<T*[]> host_C;
-
-    if(BATCHED)
-    {
-        host_A       = std::make_unique<T*[]>(batch_count);
-        host_invAg1  = std::make_unique<T*[]>(batch_count);
-        host_invAg2a = std::make_unique<T*[]>(batch_count);
-        host_invAg2c = std::make_unique<T*[]>(batch_count);
-        host_C       = std::make_unique<T*[]>(batch_count);
-
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(&host_A[0], A, batch_count * sizeof(T*), hipMemcpyDeviceToHost));
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(&host_invAg1[0], invAg1, batch_count * sizeof(T*), hipMemcpyDeviceToHost));
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(&host_invAg2a[0], invAg2a, batch_count * sizeof(T*), hipMemcpyDeviceToHost));
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(&host_invAg2c[0], invAg2c, batch_count * sizeof(T*), hipMemcpyDeviceToHost));
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(&host_C[0], C, batch_count * sizeof(T*), hipMemcpyDeviceToHost));
-    }
-
     rocblas_status status       = rocblas_status_success;
     static const T one          = T(1);
     static const T zero         = T(0);
     static const T negative_one = T(-1);
 
+    if constexpr(BATCHED)
+    {
+        // The pointer arrays stay on the device: each sub-block is one batched gemm over all
+        // batches, with the sub-block offset applied to every pointer. Each batch must have its
+        // own C, as the batches are no longer computed one after another.
+        for(int s = 0; s < sub_blocks; s++)
+        {
+            // first batched gemm compute C = A21*invA11 (lower) or C = A12*invA22 (upper)
+            status = rocblas_internal_gemm_template<true>(handle,
+                                                          rocblas_operation_none,
+                                                          rocblas_operation_none,
+                                                          M,
+                                                          N,
+                                                          N,
+                                                          &one,
+                                                          A,
+                                                          offset_A + s * sub_stride_A,
+                                                          ld_A,
+                                                          stride_A,
+                                                          invAg1,
+                                                          offset_invAg1 + s * sub_stride_invA,
+                                                          ld_invA,
+                                                          stride_invA,
+                                                          &zero,
+                                                          C,
+                                                          offset_C + s * sub_stride_C,
+                                                          ld_C,
+                                                          stride_C,
+                                                          batch_count);
+
+            if(status != rocblas_status_success)
+                break;
+
+            // second batched gemm compute invA21 = -invA22 * C (lower) or invA12 = -invA11 * C
+            // (upper)
+            status = rocblas_internal_gemm_template<true>(handle,
+                                                          rocblas_operation_none,
+                                                          rocblas_operation_none,
+                                                          M,
+                                                          N,
+                                                          M,
+                                                          &negative_one,
+                                                          invAg2a,
+                                                          offset_invAg2a + s * sub_stride_invA,
+                                                          ld_invA,
+                                                          stride_invA,
+                                                          (U)C,
+                                                          offset_C + s * sub_stride_C,
+                                                          ld_C,
+                                                          stride_C,
+                                                          &zero,
+                                                          invAg2c,
+                                                          offset_invAg2c + s * sub_stride_invA,
+                                                          ld_invA,
+                                                          stride_invA,
+                                                          batch_count);
+            if(status != rocblas_status_success)
+                break;
+        }
+
+        return status;
+    }
+
+    // The batches are independent when each has its own C, and are then distributed over the
+    // forked streams
+    auto forked = handle->fork_streams(stride_C ? batch_count : 1);
+
     // first batched gemm compute C = A21*invA11 (lower) or C = A12*invA22 (upper)
     // distance between each invA11 or invA22 is sub_stride_invA, sub_stride_A for each A21 or A12, C
     // of size IB * IB
     for(int b = 0; b < batch_count; b++)
     {
-        const T *aptr, *invAg1ptr, *invAg2ptr;
-        T *      cptr, *invAg2cptr;
+        forked.select(b % forked.size());
 
-        if(BATCHED)
-        {
-            aptr       = load_ptr_batch(&host_A[0], b, offset_A, stride_A);
-            invAg1ptr  = load_ptr_batch(&host_invAg1[0], b, offset_invAg1, stride_invA);
-            invAg2ptr  = load_ptr_batch(&host_invAg2a[0], b, offset_invAg2a, stride_invA);
-            cptr       = load_ptr_batch(&host_C[0], b, offset_C, stride_C);
-            invAg2cptr = load_ptr_batch(&host_invAg2c[0], b, offset_invAg2c, stride_invA);
-        }
-        else
-        {
-            aptr       = load_ptr_batch(A, b, offset_A, stride_A);
-            invAg1ptr  = load_ptr_batch(invAg1, b, offset_invAg1, stride_invA);
-            invAg2ptr  = load_ptr_batch(invAg2a, b, offset_invAg2a, stride_invA);
-            cptr       = load_ptr_batch(C, b, offset_C, stride_C);
-            invAg2cptr = load_ptr_batch(invAg2c, b, offset_invAg2c, stride_invA);
-        }
+        const T* aptr       = load_ptr_batch(A, b, offset_A, stride_A);
+        const T* invAg1ptr  = load_ptr_batch(invAg1, b, offset_invAg1, stride_invA);
+        const T* invAg2ptr  = load_ptr_batch(invAg2a, b, offset_invAg2a, stride_invA);
+        T*       cptr       = load_ptr_batch(C, b, offset_C, stride_C);
+        T*       invAg2cptr = load_ptr_batch(invAg2c, b, offset_invAg2c, stride_invA);
 
         // We are naively iterating through the batches, and uses sub-batches in a strided_batched style.
         status = rocblas_internal_gemm_template<false>(handle,
@@ -1057,6 +1088,176 @@ rocblas_status rocblas_trtri_large(rocblas_handle   handle,
     return rocblas_status_success;
 }
 
+static const rocblas_int rocblas_internal_trtri_recursive_min_size = [] {
+    // n from which trtri splits the matrix in two halves and computes the off-diagonal block
+    // with two large gemms, instead of doubling the inverted diagonal blocks from NB * 2 up.
+    // 0 disables the recursive split.
+    constexpr rocblas_int TRTRI_RECURSIVE_MIN_SIZE = 8192;
+    rocblas_int           min_size;
+    const char*           env = getenv("ROCBLAS_INTERNAL_TRTRI_RECURSIVE_MIN_SIZE");
+    return env && sscanf(env, "%d", &min_size) == 1 ? min_size : TRTRI_RECURSIVE_MIN_SIZE;
+}();
+
+//! @brief True if the inverse of order n is computed by rocblas_trtri_recursive.
+template <rocblas_int NB>
+inline bool rocblas_trtri_use_recursive(rocblas_int n)
+{
+    return rocblas_internal_trtri_recursive_min_size > 0
+           && n >= rocblas_internal_trtri_recursive_min_size && n > NB * 2;
+}
+
+//! @brief Order of the leading diagonal block of the recursive split, a multiple of NB * 2 close
+//!        to n / 2.
+template <rocblas_int NB>
+constexpr rocblas_int rocblas_trtri_recursive_split(rocblas_int n)
+{
+    constexpr rocblas_int IB = NB * 2;
+    return (n / 2 + IB - 1) / IB * IB;
+}
+
+/*! \brief Recursive blocked inverse of a single triangular matrix per batch.
+
+    A is split into diagonal blocks A11 of order n1, a multiple of NB * 2, and A22 of order
+    n2 = n - n1, which are inverted recursively, down to rocblas_trtri_large below
+    rocblas_internal_trtri_recursive_min_size. The off-diagonal block is then computed by two gemms
+    of the size of the whole block, so that nearly all the flops of a large inverse are in gemm:
+
+        lower: C = A21 * invA11 (n2 x n1), invA21 = -invA22 * C
+        upper: C = A12 * invA22 (n1 x n2), invA12 = -invA11 * C
+
+    C is w_C_tmp, of rocblas_internal_trtri_temp_size elements. The gemms read the inverted
+    diagonal blocks as full matrices, so the opposite triangle of invA must already be zero.
+    ********************************************************************/
+template <rocblas_int NB, bool BATCHED, bool STRIDED, typename T, typename U, typename V>
+rocblas_status rocblas_trtri_recursive(rocblas_handle   handle,
+                                       rocblas_fill     uplo,
+                                       rocblas_diagonal diag,
+                                       rocblas_int      n,
+                                       U                A,
+                                       rocblas_stride   offset_A,
+                                       rocblas_int      lda,
+                                       rocblas_stride   stride_A,
+                                       V                invA,
+                                       rocblas_stride   offset_invA,
+                                       rocblas_int      ldinvA,
+                                       rocblas_stride   stride_invA,
+                                       rocblas_int      batch_count,
+                                       V                w_C_tmp)
+{
+    if(!rocblas_trtri_use_recursive<NB>(n))
+    {
+        if(n <= NB)
+            return rocblas_trtri_small<NB, T>(handle,
+                                              uplo,
+                                              diag,
+                                              n,
+                                              A,
+                                              offset_A,
+                                              lda,
+                                              stride_A,
+                                              0,
+                                              invA,
+                                              offset_invA,
+                                              ldinvA,
+                                              stride_invA,
+                                              0,
+                                              batch_count,
+                                              1);
+
+        return rocblas_trtri_large<NB, BATCHED, STRIDED, T>(handle,
+                                                            uplo,
+                                                            diag,
+                                                            n,
+                                                            A,
+                                                            offset_A,
+                                                            lda,
+                                                            stride_A,
+                                                            0,
+                                                            invA,
+                                                            offset_invA,
+                                                            ldinvA,
+                                                            stride_invA,
+                                                            0,
+                                                            batch_count,
+                                                            1,
+                                                            w_C_tmp);
+    }
+
+    rocblas_int n1 = rocblas_trtri_recursive_split<NB>(n);
+    rocblas_int n2 = n - n1;
+
+    rocblas_stride offset_A22    = offset_A + n1 + rocblas_stride(n1) * lda;
+    rocblas_stride offset_invA22 = offset_invA + n1 + rocblas_stride(n1) * ldinvA;
+
+    // invA11 and invA22
+    rocblas_status status = rocblas_trtri_recursive<NB, BATCHED, STRIDED, T>(handle,
+                                                                             uplo,
+                                                                             diag,
+                                                                             n1,
+                                                                             A,
+                                                                             offset_A,
+                                                                             lda,
+                                                                             stride_A,
+                                                                             invA,
+                                                                             offset_invA,
+                                                                             ldinvA,
+                                                                             stride_invA,
+                                                                             batch_count,
+                                                                             w_C_tmp);
+    if(status != rocblas_status_success)
+        return status;
+
+    status = rocblas_trtri_recursive<NB, BATCHED, STRIDED, T>(handle,
+                                                              uplo,
+                                                              diag,
+                                                              n2,
+                                                              A,
+                                                              offset_A22,
+                                                              lda,
+                                                              stride_A,
+                                                              invA,
+                                                              offset_invA22,
+                                                              ldinvA,
+                                                              stride_invA,
+                                                              batch_count,
+                                                              w_C_tmp);
+    if(status != rocblas_status_success)
+        return status;
+
+    // invA21 (lower) or invA12 (upper)
+    bool           is_lower     = uplo == rocblas_fill_lower;
+    rocblas_stride offset_A21   = is_lower ? offset_A + n1 : offset_A + rocblas_stride(n1) * lda;
+    rocblas_stride offset_invA1 = is_lower ? offset_invA : offset_invA22;
+    rocblas_stride offset_invA2 = is_lower ? offset_invA22 : offset_invA;
+    rocblas_stride offset_invA3
+        = is_lower ? offset_invA + n1 : offset_invA + rocblas_stride(n1) * ldinvA;
+
+    return rocblas_trtri_gemm_block<BATCHED, STRIDED, T>(handle,
+                                                         is_lower ? n2 : n1,
+                                                         is_lower ? n1 : n2,
+                                                         (U)A,
+                                                         lda,
+                                                         stride_A,
+                                                         0,
+                                                         (U)invA,
+                                                         (U)invA,
+                                                         (V)invA,
+                                                         ldinvA,
+                                                         stride_invA,
+                                                         0,
+                                                         (V)w_C_tmp,
+                                                         is_lower ? n2 : n1,
+                                                         0,
+                                                         0,
+                                                         batch_count,
+                                                         1,
+                                                         offset_A21,
+                                                         offset_invA1,
+                                                         offset_invA2,
+                                                         offset_invA3,
+                                                         0);
+}
+
 template <rocblas_int NB>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE size_t rocblas_internal_trtri_temp_size(rocblas_int n,
                                                                          rocblas_int batch_count)
@@ -1096,6 +1297,19 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE size_t rocblas_internal_trtri_temp_size(rocblas
         if(sizeRemainder || sizeOdd)
             size = (sizeRemainder > sizeOdd ? sizeRemainder : sizeOdd) * batch_count;
     }
+
+    // the recursive split reuses C_tmp for its off-diagonal block and for both diagonal blocks
+    if(rocblas_trtri_use_recursive<NB>(n) && batch_count > 0)
+    {
+        rocblas_int n1        = rocblas_trtri_recursive_split<NB>(n);
+        size_t      size_C    = size_t(n1) * (n - n1) * batch_count;
+        size_t      size_A11  = rocblas_internal_trtri_temp_size<NB>(n1, batch_count);
+        size_t      size_A22  = rocblas_internal_trtri_temp_size<NB>(n - n1, batch_count);
+        size_t      size_diag = size_A11 > size_A22 ? size_A11 : size_A22;
+
+        size = size > size_C ? size : size_C;
+        size = size > size_diag ? size : size_diag;
+    }
     return size;
 }
 
@@ -1122,7 +1336,45 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     if(!n || !sub_batch_count)
         return rocblas_status_success;
 
-    if(n <= NB)
+    if(sub_batch_count == 1 && rocblas_trtri_use_recursive<NB>(n))
+    {
+        // zero the opposite triangle once, as the gemms of every level read it
+        static constexpr size_t sub_block_size       = 128;
+        size_t                  tri_elements_to_zero = rocblas_num_non_tri_elements(n);
+        size_t num_sub_blocks = (tri_elements_to_zero + sub_block_size - 1) / sub_block_size;
+
+        hipLaunchKernelGGL((rocblas_trtri_fill<sub_block_size, T>),
+                           dim3(num_sub_blocks, batch_count, 1),
+                           dim3(sub_block_size),
+                           0,
+                           handle->get_stream(),
+                           handle,
+                           uplo == rocblas_fill_lower ? rocblas_fill_upper : rocblas_fill_lower,
+                           n,
+                           rocblas_num_non_tri_elements(n),
+                           ldinvA,
+                           rocblas_stride(n) * ldinvA,
+                           invA,
+                           offset_invA,
+                           stride_invA,
+                           1);
+
+        return rocblas_trtri_recursive<NB, BATCHED, STRIDED, T>(handle,
+                                                                uplo,
+                                                                diag,
+                                                                n,
+                                                                A,
+                                                                offset_A,
+                                                                lda,
+                                                                stride_A,
+                                                                invA,
+                                                                offset_invA,
+                                                                ldinvA,
+                                                                stride_invA,
+                                                                batch_count,
+                                                                w_C_tmp);
+    }
+    else if(n <= NB)
     {
         return rocblas_trtri_small<NB, T>(handle,
                                           uplo,
@@ -64,7 +64,7 @@ namespace
             return handle->set_optimal_device_memory_size(size, sizep);
         }
 
-        auto layer_mode     = handle->layer_mode;
+        auto layer_mode     = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto check_numerics = handle->check_numerics;
 
         if(layer_mode & rocblas_layer_mode_log_trace)
@@ -132,17 +132,9 @@ namespace
             void* w_C_tmp     = w_mem[0];
             void* w_C_tmp_arr = w_mem[1];
 
-            auto w_C_tmp_host = std::make_unique<T*[]>(batch_count);
-            for(int b = 0; b < batch_count; b++)
-            {
-                w_C_tmp_host[b] = (T*)w_C_tmp + b * els;
-            }
-
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(w_C_tmp_arr,
-                                               &w_C_tmp_host[0],
-                                               batch_count * sizeof(T*),
-                                               hipMemcpyHostToDevice,
-                                               handle->get_stream()));
+            // each batch has its own C, the pointer array is set up on the device
+            setup_batched_array<NB>(
+                handle->get_stream(), (T*)w_C_tmp, els, (T**)w_C_tmp_arr, batch_count);
 
             status = rocblas_trtri_large<NB, true, false, T>(handle,
                                                              uplo,
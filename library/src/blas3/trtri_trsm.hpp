@@ -105,6 +105,21 @@ rocblas_trtri_trsm_kernel(rocblas_fill     uplo,
 
     ********************************************************************/
 
+// number of elements of C_tmp used by rocblas_trtri_trsm_template for each matrix of order n;
+// in the batched case every batch needs its own C_tmp of this size
+template <rocblas_int NB>
+constexpr size_t rocblas_trtri_trsm_c_temp_els(rocblas_int n)
+{
+    // When n < NB, C is unnecessary for trtri
+    size_t els = size_t(n / NB) * (NB / 2) * (NB / 2);
+
+    // For the TRTRI last diagonal block we need remainder space if n % NB != 0
+    if(n % NB)
+        els = std::max(els, size_t(ROCBLAS_TRTRI_NB) * NB * 2);
+
+    return els;
+}
+
 // assume invA has already been allocated, and leading dimension of invA is NB
 // assume IB is exactly half of NB
 template <rocblas_int NB, bool BATCHED, typename T, typename U, typename V>
@@ -26,23 +26,89 @@
 
 namespace
 {
+    /*
+     * The semirings of the geam_ex operations. The products of the elements of A and B are
+     * reduced with C: min_plus and max_plus add the elements and reduce with min and max,
+     * plus_min and max_min take the minimum of the elements and reduce with + and max.
+     */
+    constexpr bool geam_ex_op_adds_products(rocblas_geam_ex_operation op)
+    {
+        return op == rocblas_geam_ex_operation_min_plus || op == rocblas_geam_ex_operation_max_plus;
+    }
+
+    template <typename T>
+    __device__ T geam_ex_min(const T& a, const T& b)
+    {
+        return fminf(a, b);
+    }
+
+    template <>
+    __device__ double geam_ex_min(const double& a, const double& b)
+    {
+        return fmin(a, b);
+    }
+
+    template <typename T>
+    __device__ T geam_ex_max(const T& a, const T& b)
+    {
+        return fmaxf(a, b);
+    }
+
+    template <>
+    __device__ double geam_ex_max(const double& a, const double& b)
+    {
+        return fmax(a, b);
+    }
+
+    /*
+     * Sets x to the identity of the reduction of OP, which initializes the reductions and pads
+     * the out of bounds elements of A and B so that their products do not change them.
+     */
+    template <rocblas_geam_ex_operation OP, typename T>
+    __device__ void geam_ex_set_identity(T& x)
+    {
+        if constexpr(OP == rocblas_geam_ex_operation_min_plus)
+            rocblas_set_max_value(x);
+        else if constexpr(OP == rocblas_geam_ex_operation_plus_min)
+            x = 0;
+        else
+        {
+            rocblas_set_max_value(x);
+            x = -x;
+        }
+    }
+
+    /*
+     * Reduction of OP of two scalars
+     */
+    template <rocblas_geam_ex_operation OP, typename T>
+    __device__ T geam_ex_reduce(const T& a, const T& b)
+    {
+        if constexpr(OP == rocblas_geam_ex_operation_min_plus)
+            return geam_ex_min(a, b);
+        else if constexpr(OP == rocblas_geam_ex_operation_plus_min)
+            return a + b;
+        else
+            return geam_ex_max(a, b);
+    }
+
     /*
      * Copies data from d_a into a, and d_b into b. Intended to copy
      * global memory into local memory for the kernel.
      */
-    template <bool        TRANSA,
-              bool        TRANSB,
-              rocblas_int BUFA_N,
-              rocblas_int BUFA_M,
-              rocblas_int BUFB_N,
-              rocblas_int BUFB_M,
-              rocblas_int DIM_N_A,
-              rocblas_int DIM_M_A,
-              rocblas_int DIM_N_B,
-              rocblas_int DIM_M_B,
-              bool        ALPHA_ONE,
-              bool        MINPLUS,
-              bool        BOUNDS,
+    template <bool                      TRANSA,
+              bool                      TRANSB,
+              rocblas_int               BUFA_N,
+              rocblas_int               BUFA_M,
+              rocblas_int               BUFB_N,
+              rocblas_int               BUFB_M,
+              rocblas_int               DIM_N_A,
+              rocblas_int               DIM_M_A,
+              rocblas_int               DIM_N_B,
+              rocblas_int               DIM_M_B,
+              bool                      ALPHA_ONE,
+              rocblas_geam_ex_operation OP,
+              bool                      BOUNDS,
               typename T,
               typename U>
     __device__ void global_to_local(T        a[BUFA_M][BUFA_N],
@@ -90,12 +156,7 @@ namespace
                 }
 
                 if(BOUNDS && out_of_bounds)
-                {
-                    if constexpr(MINPLUS)
-                        rocblas_set_max_value(a[i][j]);
-                    else
-                        a[i][j] = 0;
-                }
+                    geam_ex_set_identity<OP>(a[i][j]);
                 else if(ALPHA_ONE)
                     a[i][j] = d_a[aj * lda + ai];
                 else
@@ -128,12 +189,7 @@ namespace
                 }
 
                 if(BOUNDS && out_of_bounds)
-                {
-                    if constexpr(MINPLUS)
-                        rocblas_set_max_value(b[i][j]);
-                    else
-                        b[i][j] = 0;
-                }
+                    geam_ex_set_identity<OP>(b[i][j]);
                 else if(ALPHA_ONE)
                     b[i][j] = d_b[bj * ldb + bi];
                 else
@@ -142,39 +198,33 @@ namespace
         }
     }
 
-    template <typename T, typename U, std::enable_if_t<!rocblas_is_array2<T>, int> = 0>
-    __device__ void vector2_min(const T& c_in, U& c_out)
-    {
-        c_out = c_in;
-    }
-
-    template <typename T, typename U, std::enable_if_t<rocblas_is_array2<T>, int> = 0>
-    __device__ void vector2_min(const T& c_in, U& c_out)
-    {
-        c_out = fminf(c_in.x, c_in.y);
-    }
-
-    template <typename T, typename U, std::enable_if_t<!rocblas_is_array2<T>, int> = 0>
-    __device__ void vector2_add(const T& c_in, U& c_out)
+    template <rocblas_geam_ex_operation OP,
+              typename T,
+              typename U,
+              std::enable_if_t<!rocblas_is_array2<T>, int> = 0>
+    __device__ void vector2_reduce(const T& c_in, U& c_out)
     {
         c_out = c_in;
     }
 
-    template <typename T, typename U, std::enable_if_t<rocblas_is_array2<T>, int> = 0>
-    __device__ void vector2_add(const T& c_in, U& c_out)
+    template <rocblas_geam_ex_operation OP,
+              typename T,
+              typename U,
+              std::enable_if_t<rocblas_is_array2<T>, int> = 0>
+    __device__ void vector2_reduce(const T& c_in, U& c_out)
     {
-        c_out = c_in.x + c_in.y;
+        c_out = geam_ex_reduce<OP, U>(c_in.x, c_in.y);
     }
 
     /*
      * Copies data from c into d_c, intended to copy local memory back to global memory.
      */
-    template <rocblas_int THR_N,
-              rocblas_int THR_M,
-              rocblas_int DIM_N,
-              rocblas_int DIM_M,
-              bool        MINPLUS,
-              bool        BOUNDS,
+    template <rocblas_int               THR_N,
+              rocblas_int               THR_M,
+              rocblas_int               DIM_N,
+              rocblas_int               DIM_M,
+              rocblas_geam_ex_operation OP,
+              bool                      BOUNDS,
               typename T,
               typename U>
     __device__ void local_to_global(const T* d_c,
@@ -197,30 +247,13 @@ namespace
                 int ci = c_i + i * DIM_M + idx;
                 int cj = c_j + j * DIM_N + idy;
 
-                T c_min;
-                if constexpr(MINPLUS)
-                    vector2_min(c[j][i], c_min);
-                else
-                    vector2_add(c[j][i], c_min);
+                T c_red;
+                vector2_reduce<OP>(c[j][i], c_red);
 
-                if(BOUNDS)
-                {
-                    if(ci < m && cj < n)
-                    {
-                        auto dc_scaled = beta ? beta * d_c[cj * ldc + ci] : 0;
-                        if constexpr(MINPLUS)
-                            d_d[cj * ldd + ci] = fminf(dc_scaled, c_min);
-                        else
-                            d_d[cj * ldd + ci] = dc_scaled + c_min;
-                    }
-                }
-                else
+                if(!BOUNDS || (ci < m && cj < n))
                 {
-                    auto dc_scaled = beta ? beta * d_c[cj * ldc + ci] : 0;
-                    if constexpr(MINPLUS)
-                        d_d[cj * ldd + ci] = fminf(dc_scaled, c_min);
-                    else
-                        d_d[cj * ldd + ci] = dc_scaled + c_min;
+                    T dc_scaled        = beta ? T(beta * d_c[cj * ldc + ci]) : T(0);
+                    d_d[cj * ldd + ci] = geam_ex_reduce<OP>(dc_scaled, c_red);
                 }
             }
         }
@@ -331,26 +364,21 @@ namespace
         }
     }
 
-    template <rocblas_int THR_N,
-              rocblas_int THR_M,
-              bool        MINPLUS,
+    template <rocblas_int               THR_N,
+              rocblas_int               THR_M,
+              rocblas_geam_ex_operation OP,
               typename T,
               std::enable_if_t<!rocblas_is_array2<T>, int> = 0>
     __device__ void initialize_local_output(T c[THR_N][THR_M])
     {
         for(int j = 0; j < THR_N; j++)
             for(int i = 0; i < THR_M; i++)
-            {
-                if constexpr(MINPLUS)
-                    rocblas_set_max_value(c[j][i]);
-                else
-                    c[j][i] = 0;
-            }
+                geam_ex_set_identity<OP>(c[j][i]);
     }
 
-    template <rocblas_int THR_N,
-              rocblas_int THR_M,
-              bool        MINPLUS,
+    template <rocblas_int               THR_N,
+              rocblas_int               THR_M,
+              rocblas_geam_ex_operation OP,
               typename T,
               std::enable_if_t<rocblas_is_array2<T>, int> = 0>
     __device__ void initialize_local_output(T c[THR_N][THR_M])
@@ -358,103 +386,104 @@ namespace
         for(int j = 0; j < THR_N; j++)
             for(int i = 0; i < THR_M; i++)
             {
-                if constexpr(MINPLUS)
-                {
-                    auto tmp = c[j][i].x;
-                    rocblas_set_max_value(tmp);
-                    c[j][i].x = tmp;
-                    c[j][i].y = tmp;
-                }
-                else
-                {
-                    c[j][i].x = 0;
-                    c[j][i].y = 0;
-                }
+                auto tmp = c[j][i].x;
+                geam_ex_set_identity<OP>(tmp);
+                c[j][i].x = tmp;
+                c[j][i].y = tmp;
             }
     }
 
-    template <typename T, typename T2>
-    __device__ void rocblas_geam_ex_min3(const T2& a, T& c)
-    {
-        c = fminf(fminf(a.x, a.y), c);
-    }
-
-    template <>
-    __device__ void rocblas_geam_ex_min3(const rocblas_half2& a, rocblas_half2& c)
-    {
-        // asm volatile("v_pk_min_f16 %0, %1, %2;" : "=v"(c) : "v"(c), "v"(a));
-        c.x = fminf(c.x, a.x);
-        c.y = fminf(c.y, a.y);
-    }
-
-    template <>
-    __device__ void rocblas_geam_ex_min3(const double& a, double& c)
-    {
-        // asm volatile("v_min_f64 %0, %1, %2;" : "=v"(c) : "v"(c), "v"(a));
-        c = fmin(a, c);
-    }
-
-    template <>
-    __device__ void rocblas_geam_ex_min3(const float2& a, float& c)
+    /*
+     * Product of OP of a and b, elementwise for vector2 types
+     */
+    template <rocblas_geam_ex_operation OP,
+              typename T2,
+              std::enable_if_t<!rocblas_is_array2<T2>, int> = 0>
+    __device__ T2 geam_ex_product(const T2& a, const T2& b)
     {
-        c = fminf(fminf(a.x, a.y), c);
+        if constexpr(geam_ex_op_adds_products(OP))
+            return a + b;
+        else
+            return geam_ex_min(a, b);
     }
 
-    template <typename T, typename T2>
-    __device__ void rocblas_geam_ex_minadd3(const T2& a, const T2& b, T& c)
+    template <rocblas_geam_ex_operation OP,
+              typename T2,
+              std::enable_if_t<rocblas_is_array2<T2>, int> = 0>
+    __device__ T2 geam_ex_product(const T2& a, const T2& b)
     {
-        T2 c2;
-        c2.x = fminf(a.x, b.x);
-        c2.y = fminf(a.y, b.y);
-        c += c2;
+        if constexpr(geam_ex_op_adds_products(OP))
+            return a + b;
+        else
+        {
+            T2 p;
+            p.x = geam_ex_min(a.x, b.x);
+            p.y = geam_ex_min(a.y, b.y);
+            return p;
+        }
     }
 
-    template <>
-    __device__ void rocblas_geam_ex_minadd3(const double& a, const double& b, double& c)
+    /*
+     * Reduces the product p into c with the reduction of OP. A vector2 product is reduced into
+     * a vector2 c elementwise, and both of its halves into a scalar c.
+     */
+    template <rocblas_geam_ex_operation OP,
+              typename T,
+              typename T2,
+              std::enable_if_t<!rocblas_is_array2<T2>, int> = 0>
+    __device__ void geam_ex_accumulate(const T2& p, T& c)
     {
-        // asm volatile("v_min_f64 %0, %1, %2;" : "=v"(tmp) : "v"(b), "v"(a));
-        c += fmin(a, b);
+        c = geam_ex_reduce<OP>(p, c);
     }
 
-    /*
-     * Computes the "minplus" operation Cij = min(Aik + Bkj, Cij)
-     */
-    template <rocblas_int THR_N, rocblas_int THR_M, typename T, typename T2>
-    __device__ void compute_minplus(T2 a[THR_M], T2 b[THR_N], T c[THR_N][THR_M])
+    template <rocblas_geam_ex_operation OP,
+              typename T,
+              typename T2,
+              std::enable_if_t<rocblas_is_array2<T2>, int> = 0>
+    __device__ void geam_ex_accumulate(const T2& p, T& c)
     {
-        for(int j = 0; j < THR_N; j++)
-            for(int i = 0; i < THR_M; i++)
-                rocblas_geam_ex_min3(a[i] + b[j], c[j][i]);
+        if constexpr(rocblas_is_array2<T>)
+        {
+            c.x = geam_ex_reduce<OP>(p.x, c.x);
+            c.y = geam_ex_reduce<OP>(p.y, c.y);
+        }
+        else
+            c = geam_ex_reduce<OP, T>(geam_ex_reduce<OP, T>(p.x, p.y), c);
     }
 
     /*
-     * Computes the "plusmin" operation Cij = min(Aik, Bkj) + Cij
+     * Computes the geam_ex operation OP on the local arrays, for example the "minplus"
+     * operation Cij = min(Aik + Bkj, Cij), or the "plusmin" operation Cij = min(Aik, Bkj) + Cij
      */
-    template <rocblas_int THR_N, rocblas_int THR_M, typename T, typename T2>
-    __device__ void compute_plusmin(T2 a[THR_M], T2 b[THR_N], T c[THR_N][THR_M])
+    template <rocblas_int               THR_N,
+              rocblas_int               THR_M,
+              rocblas_geam_ex_operation OP,
+              typename T,
+              typename T2>
+    __device__ void compute_semiring(T2 a[THR_M], T2 b[THR_N], T c[THR_N][THR_M])
     {
         for(int j = 0; j < THR_N; j++)
             for(int i = 0; i < THR_M; i++)
-                rocblas_geam_ex_minadd3(a[i], b[j], c[j][i]);
+                geam_ex_accumulate<OP>(geam_ex_product<OP>(a[i], b[j]), c[j][i]);
     }
 
     template <typename T,
               typename Tab,
               typename Tc,
-              int  DIM_M,
-              int  DIM_N,
-              int  BLK_M,
-              int  BLK_N,
-              int  BLK_K,
-              int  DIM_M_A,
-              int  DIM_N_A,
-              int  DIM_M_B,
-              int  DIM_N_B,
-              char TRANSA_C,
-              char TRANSB_C,
-              bool ALPHA_ONE,
-              bool BOUNDS,
-              bool MINPLUS,
+              int                       DIM_M,
+              int                       DIM_N,
+              int                       BLK_M,
+              int                       BLK_N,
+              int                       BLK_K,
+              int                       DIM_M_A,
+              int                       DIM_N_A,
+              int                       DIM_M_B,
+              int                       DIM_N_B,
+              char                      TRANSA_C,
+              char                      TRANSB_C,
+              bool                      ALPHA_ONE,
+              bool                      BOUNDS,
+              rocblas_geam_ex_operation OP,
               typename TScal,
               typename TConstPtr,
               typename TPtr>
@@ -541,7 +570,7 @@ namespace
 
         constexpr int k_add = rocblas_is_array2<Tab> ? 2 : 1;
 
-        initialize_local_output<THR_N, THR_M, MINPLUS>(c);
+        initialize_local_output<THR_N, THR_M, OP>(c);
 
         global_to_local<TRANSA,
                         TRANSB,
@@ -554,7 +583,7 @@ namespace
                         DIM_N_B,
                         DIM_M_B,
                         ALPHA_ONE,
-                        MINPLUS,
+                        OP,
                         BOUNDS>(
             a0, b0, alpha, d_a, lda, ai, aj, idx_a, idy_a, d_b, ldb, bi, bj, idx_b, idy_b, M, N, K);
 
@@ -578,7 +607,7 @@ namespace
                         DIM_N_B,
                         DIM_M_B,
                         ALPHA_ONE,
-                        MINPLUS,
+                        OP,
                         BOUNDS>(
             a1, b1, alpha, d_a, lda, ai, aj, idx_a, idy_a, d_b, ldb, bi, bj, idx_b, idy_b, M, N, K);
 
@@ -610,10 +639,7 @@ namespace
         {
             shared_to_local<THR_N, THR_M, BLK_N, BLK_M, BLK_K, DIM_N, DIM_M>(
                 a, b, s_a0, s_b0, k1, idx, idy);
-            if constexpr(MINPLUS)
-                compute_minplus<THR_N, THR_M>(a, b, c);
-            else
-                compute_plusmin<THR_N, THR_M>(a, b, c);
+            compute_semiring<THR_N, THR_M, OP>(a, b, c);
         }
 
         local_to_shared<TRANSA,
@@ -644,7 +670,7 @@ namespace
                             DIM_N_B,
                             DIM_M_B,
                             ALPHA_ONE,
-                            MINPLUS,
+                            OP,
                             BOUNDS>(a0,
                                     b0,
                                     alpha,
@@ -677,10 +703,7 @@ namespace
             {
                 shared_to_local<THR_N, THR_M, BLK_N, BLK_M, BLK_K, DIM_N, DIM_M>(
                     a, b, s_a1, s_b1, k1, idx, idy);
-                if constexpr(MINPLUS)
-                    compute_minplus<THR_N, THR_M>(a, b, c);
-                else
-                    compute_plusmin<THR_N, THR_M>(a, b, c);
+                compute_semiring<THR_N, THR_M, OP>(a, b, c);
             }
 
             local_to_shared<TRANSA,
@@ -709,7 +732,7 @@ namespace
                             DIM_N_B,
                             DIM_M_B,
                             ALPHA_ONE,
-                            MINPLUS,
+                            OP,
                             BOUNDS>(a1,
                                     b1,
                                     alpha,
@@ -741,10 +764,7 @@ namespace
             {
                 shared_to_local<THR_N, THR_M, BLK_N, BLK_M, BLK_K, DIM_N, DIM_M>(
                     a, b, s_a0, s_b0, k1, idx, idy);
-                if constexpr(MINPLUS)
-                    compute_minplus<THR_N, THR_M>(a, b, c);
-                else
-                    compute_plusmin<THR_N, THR_M>(a, b, c);
+                compute_semiring<THR_N, THR_M, OP>(a, b, c);
             }
 
             local_to_shared<TRANSA,
@@ -767,13 +787,10 @@ namespace
         {
             shared_to_local<THR_N, THR_M, BLK_N, BLK_M, BLK_K, DIM_N, DIM_M>(
                 a, b, s_a1, s_b1, k1, idx, idy);
-            if constexpr(MINPLUS)
-                compute_minplus<THR_N, THR_M>(a, b, c);
-            else
-                compute_plusmin<THR_N, THR_M>(a, b, c);
+            compute_semiring<THR_N, THR_M, OP>(a, b, c);
         }
 
-        local_to_global<THR_N, THR_M, DIM_N, DIM_M, MINPLUS, BOUNDS>(
+        local_to_global<THR_N, THR_M, DIM_N, DIM_M, OP, BOUNDS>(
             d_c, d_d, ldc, ldd, beta, ci, cj, idx, idy, c, M, N);
     }
 
@@ -806,17 +823,18 @@ namespace
 
     template <int DIM_X, int DIM_Y, typename T, typename TScal, typename TConstPtr, typename TPtr>
     ROCBLAS_KERNEL(DIM_X* DIM_Y)
-    geam_ex_round_kernel(rocblas_int    m,
-                         rocblas_int    n,
-                         TScal          beta_host_device,
-                         TConstPtr      dC,
-                         rocblas_stride offset_c,
-                         rocblas_int    ldc,
-                         rocblas_stride stride_c,
-                         TPtr           dD,
-                         rocblas_stride offset_d,
-                         rocblas_int    ldd,
-                         rocblas_stride stride_d)
+    geam_ex_round_kernel(rocblas_int               m,
+                         rocblas_int               n,
+                         TScal                     beta_host_device,
+                         TConstPtr                 dC,
+                         rocblas_stride            offset_c,
+                         rocblas_int               ldc,
+                         rocblas_stride            stride_c,
+                         TPtr                      dD,
+                         rocblas_stride            offset_d,
+                         rocblas_int               ldd,
+                         rocblas_stride            stride_d,
+                         rocblas_geam_ex_operation geam_ex_op)
     {
         auto beta = load_scalar(beta_host_device);
         auto C    = beta ? load_ptr_batch(dC, blockIdx.z, offset_c, stride_c) : nullptr;
@@ -827,8 +845,9 @@ namespace
 
         if(tx < m && ty < n)
         {
+            // the products of A and B are all 0, reduced with min for min_plus and max otherwise
             auto orig_val = beta ? beta * C[ty * size_t(ldc) + tx] : 0;
-            if(orig_val > 0)
+            if(geam_ex_op == rocblas_geam_ex_operation_min_plus ? orig_val > 0 : orig_val < 0)
                 D[ty * size_t(ldd) + tx] = 0;
             else
                 D[ty * size_t(ldd) + tx] = orig_val;
@@ -974,12 +993,13 @@ namespace
                                dD,
                                offset_d,
                                ldd,
-                               stride_d);
+                               stride_d,
+                               geam_ex_op);
             return;
         }
 
 #define LAUNCH_GEAM_SOURCE_KERNEL(                                               \
-    TRANSA_, TRANSB_, DIM_M_A_, DIM_N_A_, DIM_M_B_, DIM_N_B_, MINPLUS_)          \
+    TRANSA_, TRANSB_, DIM_M_A_, DIM_N_A_, DIM_M_B_, DIM_N_B_, OP_)               \
     if(m % BLK_M == 0 && n % BLK_N == 0 && k % BLK_K == 0)                       \
     {                                                                            \
         dim3 dimBlock(DIM_M, DIM_N, 1);                                          \
@@ -1002,7 +1022,7 @@ namespace
                                                      TRANSB_,                    \
                                                      false,                      \
                                                      false,                      \
-                                                     MINPLUS_>),                 \
+                                                     OP_>),                      \
                                dimGrid,                                          \
                                dimBlock,                                         \
                                0,                                                \
@@ -1045,7 +1065,7 @@ namespace
                                                      TRANSB_,                    \
                                                      true,                       \
                                                      false,                      \
-                                                     MINPLUS_>),                 \
+                                                     OP_>),                      \
                                dimGrid,                                          \
                                dimBlock,                                         \
                                0,                                                \
@@ -1088,7 +1108,7 @@ namespace
                                                      TRANSB_,                    \
                                                      false,                      \
                                                      false,                      \
-                                                     MINPLUS_>),                 \
+                                                     OP_>),                      \
                                dimGrid,                                          \
                                dimBlock,                                         \
                                0,                                                \
@@ -1136,7 +1156,7 @@ namespace
                                                      TRANSB_,                    \
                                                      false,                      \
                                                      true,                       \
-                                                     MINPLUS_>),                 \
+                                                     OP_>),                      \
                                dimGrid,                                          \
                                dimBlock,                                         \
                                0,                                                \
@@ -1179,7 +1199,7 @@ namespace
                                                      TRANSB_,                    \
                                                      true,                       \
                                                      true,                       \
-                                                     MINPLUS_>),                 \
+                                                     OP_>),                      \
                                dimGrid,                                          \
                                dimBlock,                                         \
                                0,                                                \
@@ -1222,7 +1242,7 @@ namespace
                                                      TRANSB_,                    \
                                                      false,                      \
                                                      true,                       \
-                                                     MINPLUS_>),                 \
+                                                     OP_>),                      \
                                dimGrid,                                          \
                                dimBlock,                                         \
                                0,                                                \
@@ -1249,11 +1269,45 @@ namespace
         }                                                                        \
     }
 
+    // min_plus, max_plus and max_min share the tile configurations
+#define LAUNCH_GEAM_SOURCE_KERNEL_MAX_OPS(                                                \
+    TRANSA_, TRANSB_, DIM_M_A_, DIM_N_A_, DIM_M_B_, DIM_N_B_)                             \
+    if(geam_ex_op == rocblas_geam_ex_operation_min_plus)                                  \
+    {                                                                                     \
+        LAUNCH_GEAM_SOURCE_KERNEL(TRANSA_,                                                \
+                                  TRANSB_,                                                \
+                                  DIM_M_A_,                                               \
+                                  DIM_N_A_,                                               \
+                                  DIM_M_B_,                                               \
+                                  DIM_N_B_,                                               \
+                                  rocblas_geam_ex_operation_min_plus);                    \
+    }                                                                                     \
+    else if(geam_ex_op == rocblas_geam_ex_operation_max_plus)                             \
+    {                                                                                     \
+        LAUNCH_GEAM_SOURCE_KERNEL(TRANSA_,                                                \
+                                  TRANSB_,                                                \
+                                  DIM_M_A_,                                               \
+                                  DIM_N_A_,                                               \
+                                  DIM_M_B_,                                               \
+                                  DIM_N_B_,                                               \
+                                  rocblas_geam_ex_operation_max_plus);                    \
+    }                                                                                     \
+    else                                                                                  \
+    {                                                                                     \
+        LAUNCH_GEAM_SOURCE_KERNEL(TRANSA_,                                                \
+                                  TRANSB_,                                                \
+                                  DIM_M_A_,                                               \
+                                  DIM_N_A_,                                               \
+                                  DIM_M_B_,                                               \
+                                  DIM_N_B_,                                               \
+                                  rocblas_geam_ex_operation_max_min);                     \
+    }
+
         constexpr rocblas_int DIM_M_A = 64;
         constexpr rocblas_int DIM_N_A = 4;
         constexpr rocblas_int DIM_M_B = 4;
         constexpr rocblas_int DIM_N_B = 64;
-        if(geam_ex_op == rocblas_geam_ex_operation_min_plus)
+        if(geam_ex_op != rocblas_geam_ex_operation_plus_min)
         {
             if(trans_a == rocblas_operation_none && trans_b == rocblas_operation_none)
             {
@@ -1267,19 +1321,19 @@ namespace
                 {
                     using Tc  = array2_t<T>;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL_MAX_OPS('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B);
                 }
                 else if constexpr(std::is_same<float, T>{})
                 {
                     using Tc  = T;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL_MAX_OPS('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B);
                 }
                 else
                 {
                     using Tc  = T;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL_MAX_OPS('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B);
                 }
             }
             else if(trans_a != rocblas_operation_none && trans_b == rocblas_operation_none)
@@ -1294,19 +1348,19 @@ namespace
                 {
                     using Tc  = array2_t<T>;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL_MAX_OPS('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B);
                 }
                 else if constexpr(std::is_same<float, T>{})
                 {
                     using Tc  = T;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL_MAX_OPS('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B);
                 }
                 else
                 {
                     using Tc  = T;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL_MAX_OPS('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B);
                 }
             }
             else if(trans_a == rocblas_operation_none && trans_b != rocblas_operation_none)
@@ -1321,19 +1375,19 @@ namespace
                 {
                     using Tc  = array2_t<T>;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL_MAX_OPS('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B);
                 }
                 else if constexpr(std::is_same<float, T>{})
                 {
                     using Tc  = T;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL_MAX_OPS('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B);
                 }
                 else
                 {
                     using Tc  = T;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL_MAX_OPS('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B);
                 }
             }
             else
@@ -1348,24 +1402,25 @@ namespace
                 {
                     using Tc  = array2_t<T>;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL_MAX_OPS('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B);
                 }
                 else if constexpr(std::is_same<float, T>{})
                 {
                     using Tc  = T;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL_MAX_OPS('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B);
                 }
                 else
                 {
                     using Tc  = T;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL_MAX_OPS('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B);
                 }
             }
         }
         else if(geam_ex_op == rocblas_geam_ex_operation_plus_min)
         {
+            constexpr rocblas_geam_ex_operation OP = rocblas_geam_ex_operation_plus_min;
             if constexpr(std::is_same<rocblas_half, T>{})
             {
                 using Tc                    = array2_t<T>;
@@ -1378,22 +1433,22 @@ namespace
                 if(trans_a == rocblas_operation_none && trans_b == rocblas_operation_none)
                 {
                     // NN
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, OP);
                 }
                 else if(trans_a != rocblas_operation_none && trans_b == rocblas_operation_none)
                 {
                     // TN
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, OP);
                 }
                 else if(trans_a == rocblas_operation_none && trans_b != rocblas_operation_none)
                 {
                     // NT
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, OP);
                 }
                 else
                 {
                     // TT
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, OP);
                 }
             }
             else if constexpr(std::is_same<float, T>{})
@@ -1408,22 +1463,22 @@ namespace
                 if(trans_a == rocblas_operation_none && trans_b == rocblas_operation_none)
                 {
                     // NN
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, OP);
                 }
                 else if(trans_a != rocblas_operation_none && trans_b == rocblas_operation_none)
                 {
                     // TN
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, OP);
                 }
                 else if(trans_a == rocblas_operation_none && trans_b != rocblas_operation_none)
                 {
                     // NT
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, OP);
                 }
                 else
                 {
                     // TT
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, OP);
                 }
             }
             else if(std::is_same<double, T>{})
@@ -1438,25 +1493,26 @@ namespace
                 if(trans_a == rocblas_operation_none && trans_b == rocblas_operation_none)
                 {
                     // NN
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, OP);
                 }
                 else if(trans_a != rocblas_operation_none && trans_b == rocblas_operation_none)
                 {
                     // TN
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, OP);
                 }
                 else if(trans_a == rocblas_operation_none && trans_b != rocblas_operation_none)
                 {
                     // NT
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, OP);
                 }
                 else
                 {
                     // TT
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, OP);
                 }
             }
         }
+#undef LAUNCH_GEAM_SOURCE_KERNEL_MAX_OPS
 #undef LAUNCH_GEAM_SOURCE_KERNEL
     }
 }
@@ -0,0 +1,583 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "../blas1/rocblas_axpy.hpp"
+#include "check_numerics_vector.hpp"
+#include "logging.hpp"
+#include "rocblas_block_sizes.h"
+
+namespace
+{
+    // y := alpha * x + beta * y, or y := alpha * x when beta is nullptr
+    template <int NB, bool BATCHED, typename Ta, typename Tx, typename Ty = Tx, typename Tex = Ty>
+    rocblas_status rocblas_axpby_ex_typecasting(const char*    name,
+                                                rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const void*    alpha,
+                                                const void*    x,
+                                                rocblas_int    incx,
+                                                rocblas_stride stride_x,
+                                                const void*    beta,
+                                                void*          y,
+                                                rocblas_int    incy,
+                                                rocblas_stride stride_y,
+                                                rocblas_int    batch_count)
+    {
+        using TConstPtr = std::conditional_t<BATCHED, const Tx* const*, const Tx*>;
+        using TPtr      = std::conditional_t<BATCHED, Ty* const*, Ty*>;
+
+        const Ta* alphat = (const Ta*)alpha;
+        const Ta* betat  = (const Ta*)beta;
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            if(betat && *alphat == 0 && *betat == 1)
+                return rocblas_status_success;
+
+            if(!x || !y)
+                return rocblas_status_invalid_pointer;
+        }
+
+        auto check_numerics = handle->check_numerics;
+        if(check_numerics)
+        {
+            RETURN_IF_ROCBLAS_ERROR(rocblas_internal_check_numerics_vector_template(name,
+                                                                                    handle,
+                                                                                    n,
+                                                                                    (TConstPtr)x,
+                                                                                    0,
+                                                                                    incx,
+                                                                                    stride_x,
+                                                                                    batch_count,
+                                                                                    check_numerics,
+                                                                                    true));
+
+            // y is only an input of axpby
+            if(betat)
+                RETURN_IF_ROCBLAS_ERROR(
+                    rocblas_internal_check_numerics_vector_template(name,
+                                                                    handle,
+                                                                    n,
+                                                                    (TPtr)y,
+                                                                    0,
+                                                                    incy,
+                                                                    stride_y,
+                                                                    batch_count,
+                                                                    check_numerics,
+                                                                    true));
+        }
+
+        static constexpr rocblas_stride stride_0 = 0;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_internal_axpby_template<NB, Tex>(handle,
+                                                                         n,
+                                                                         alphat,
+                                                                         stride_0,
+                                                                         (TConstPtr)x,
+                                                                         0,
+                                                                         incx,
+                                                                         stride_x,
+                                                                         betat,
+                                                                         stride_0,
+                                                                         (TPtr)y,
+                                                                         0,
+                                                                         incy,
+                                                                         stride_y,
+                                                                         batch_count));
+
+        if(check_numerics)
+            return rocblas_internal_check_numerics_vector_template(
+                name, handle, n, (TPtr)y, 0, incy, stride_y, batch_count, check_numerics, false);
+        return rocblas_status_success;
+    }
+
+    //! @brief axpby_ex and copy_scal_ex of the types of axpy_ex, copy_scal_ex also converting
+    //!        between f16_r, bf16_r and f32_r with f32_r, or f32_r and f64_r with f64_r.
+    template <int NB, bool BATCHED>
+    rocblas_status rocblas_axpby_ex_dispatch(const char*      name,
+                                             rocblas_handle   handle,
+                                             rocblas_int      n,
+                                             const void*      alpha,
+                                             rocblas_datatype alpha_type,
+                                             const void*      x,
+                                             rocblas_datatype x_type,
+                                             rocblas_int      incx,
+                                             rocblas_stride   stride_x,
+                                             const void*      beta,
+                                             void*            y,
+                                             rocblas_datatype y_type,
+                                             rocblas_int      incy,
+                                             rocblas_stride   stride_y,
+                                             rocblas_int      batch_count,
+                                             rocblas_datatype execution_type)
+    {
+#define rocblas_axpby_ex_typecasting_PARAM \
+    name, handle, n, alpha, x, incx, stride_x, beta, y, incy, stride_y, batch_count
+
+        auto is = [&](rocblas_datatype a,
+                      rocblas_datatype xt,
+                      rocblas_datatype yt,
+                      rocblas_datatype ex) {
+            return alpha_type == a && x_type == xt && y_type == yt && execution_type == ex;
+        };
+
+        constexpr auto f16 = rocblas_datatype_f16_r, bf16 = rocblas_datatype_bf16_r,
+                       f32 = rocblas_datatype_f32_r, f64 = rocblas_datatype_f64_r,
+                       c32 = rocblas_datatype_f32_c, c64 = rocblas_datatype_f64_c;
+
+        if(is(f16, f16, f16, f32))
+            return rocblas_axpby_ex_typecasting<NB,
+                                                BATCHED,
+                                                rocblas_half,
+                                                rocblas_half,
+                                                rocblas_half,
+                                                float>(rocblas_axpby_ex_typecasting_PARAM);
+        else if(is(f32, f16, f16, f32))
+            return rocblas_axpby_ex_typecasting<NB,
+                                                BATCHED,
+                                                float,
+                                                rocblas_half,
+                                                rocblas_half,
+                                                float>(rocblas_axpby_ex_typecasting_PARAM);
+        else if(is(bf16, bf16, bf16, f32))
+            return rocblas_axpby_ex_typecasting<NB,
+                                                BATCHED,
+                                                rocblas_bfloat16,
+                                                rocblas_bfloat16,
+                                                rocblas_bfloat16,
+                                                float>(rocblas_axpby_ex_typecasting_PARAM);
+        else if(is(f32, bf16, bf16, f32))
+            return rocblas_axpby_ex_typecasting<NB,
+                                                BATCHED,
+                                                float,
+                                                rocblas_bfloat16,
+                                                rocblas_bfloat16,
+                                                float>(rocblas_axpby_ex_typecasting_PARAM);
+        else if(is(f16, f16, f16, f16))
+            return rocblas_axpby_ex_typecasting<NB, BATCHED, rocblas_half>(
+                rocblas_axpby_ex_typecasting_PARAM);
+        else if(is(f32, f32, f32, f32))
+            return rocblas_axpby_ex_typecasting<NB, BATCHED, float>(
+                rocblas_axpby_ex_typecasting_PARAM);
+        else if(is(f64, f64, f64, f64))
+            return rocblas_axpby_ex_typecasting<NB, BATCHED, double>(
+                rocblas_axpby_ex_typecasting_PARAM);
+        else if(is(c32, c32, c32, c32))
+            return rocblas_axpby_ex_typecasting<NB, BATCHED, rocblas_float_complex>(
+                rocblas_axpby_ex_typecasting_PARAM);
+        else if(is(c64, c64, c64, c64))
+            return rocblas_axpby_ex_typecasting<NB, BATCHED, rocblas_double_complex>(
+                rocblas_axpby_ex_typecasting_PARAM);
+
+        // Conversions of x to the type of y, without reading y
+        if(beta)
+            return rocblas_status_not_implemented;
+
+        if(is(f32, f32, f16, f32))
+            return rocblas_axpby_ex_typecasting<NB, BATCHED, float, float, rocblas_half, float>(
+                rocblas_axpby_ex_typecasting_PARAM);
+        else if(is(f32, f16, f32, f32))
+            return rocblas_axpby_ex_typecasting<NB, BATCHED, float, rocblas_half, float, float>(
+                rocblas_axpby_ex_typecasting_PARAM);
+        else if(is(f32, f32, bf16, f32))
+            return rocblas_axpby_ex_typecasting<NB,
+                                                BATCHED,
+                                                float,
+                                                float,
+                                                rocblas_bfloat16,
+                                                float>(rocblas_axpby_ex_typecasting_PARAM);
+        else if(is(f32, bf16, f32, f32))
+            return rocblas_axpby_ex_typecasting<NB,
+                                                BATCHED,
+                                                float,
+                                                rocblas_bfloat16,
+                                                float,
+                                                float>(rocblas_axpby_ex_typecasting_PARAM);
+        else if(is(f64, f64, f32, f64))
+            return rocblas_axpby_ex_typecasting<NB, BATCHED, double, double, float, double>(
+                rocblas_axpby_ex_typecasting_PARAM);
+        else if(is(f64, f32, f64, f64))
+            return rocblas_axpby_ex_typecasting<NB, BATCHED, double, float, double, double>(
+                rocblas_axpby_ex_typecasting_PARAM);
+
+#undef rocblas_axpby_ex_typecasting_PARAM
+
+        return rocblas_status_not_implemented;
+    }
+
+    // axpby_ex and copy_scal_ex with their batched and strided batched forms, the strides being
+    // 0 and batch_count 1 for the non batched forms, and beta nullptr for copy_scal_ex
+    template <int NB, bool BATCHED, bool COPY>
+    rocblas_status rocblas_axpby_ex_impl(rocblas_handle   handle,
+                                         rocblas_int      n,
+                                         const void*      alpha,
+                                         rocblas_datatype alpha_type,
+                                         const void*      x,
+                                         rocblas_datatype x_type,
+                                         rocblas_int      incx,
+                                         rocblas_stride   stride_x,
+                                         const void*      beta,
+                                         void*            y,
+                                         rocblas_datatype y_type,
+                                         rocblas_int      incy,
+                                         rocblas_stride   stride_y,
+                                         rocblas_int      batch_count,
+                                         rocblas_datatype execution_type,
+                                         const char*      name)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(layer_mode & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_profile))
+        {
+            auto alpha_type_str = rocblas_datatype_string(alpha_type);
+            auto x_type_str     = rocblas_datatype_string(x_type);
+            auto y_type_str     = rocblas_datatype_string(y_type);
+            auto ex_type_str    = rocblas_datatype_string(execution_type);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+            {
+                rocblas_internal_ostream alphass, betass;
+                if(handle->pointer_mode == rocblas_pointer_mode_host
+                   && log_trace_alpha_beta_ex(alpha_type, alpha, beta, alphass, betass)
+                          == rocblas_status_success)
+                {
+                    log_trace(handle,
+                              name,
+                              n,
+                              alphass.str(),
+                              alpha_type_str,
+                              x,
+                              x_type_str,
+                              incx,
+                              stride_x,
+                              betass.str(),
+                              y,
+                              y_type_str,
+                              incy,
+                              stride_y,
+                              batch_count,
+                              ex_type_str);
+                }
+                else
+                {
+                    log_trace(handle,
+                              name,
+                              n,
+                              alpha_type_str,
+                              x,
+                              x_type_str,
+                              incx,
+                              stride_x,
+                              y,
+                              y_type_str,
+                              incy,
+                              stride_y,
+                              batch_count,
+                              ex_type_str);
+                }
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            name,
+                            "N",
+                            n,
+                            "a_type",
+                            alpha_type_str,
+                            "b_type",
+                            x_type_str,
+                            "incx",
+                            incx,
+                            "stride_x",
+                            stride_x,
+                            "c_type",
+                            y_type_str,
+                            "incy",
+                            incy,
+                            "stride_y",
+                            stride_y,
+                            "batch_count",
+                            batch_count,
+                            "compute_type",
+                            ex_type_str);
+        }
+
+        if(n <= 0 || batch_count <= 0) // Quick return if possible. Not Argument error
+            return rocblas_status_success;
+
+        if(!alpha || (!COPY && !beta))
+            return rocblas_status_invalid_pointer;
+
+        // Quick return (alpha == 0 and beta == 1) check and other nullptr checks will be done
+        // once we know the type (in rocblas_axpby_ex_typecasting).
+        return rocblas_axpby_ex_dispatch<NB, BATCHED>(name,
+                                                      handle,
+                                                      n,
+                                                      alpha,
+                                                      alpha_type,
+                                                      x,
+                                                      x_type,
+                                                      incx,
+                                                      stride_x,
+                                                      beta,
+                                                      y,
+                                                      y_type,
+                                                      incy,
+                                                      stride_y,
+                                                      batch_count,
+                                                      execution_type);
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_axpby_ex(rocblas_handle   handle,
+                                rocblas_int      n,
+                                const void*      alpha,
+                                rocblas_datatype alpha_type,
+                                const void*      x,
+                                rocblas_datatype x_type,
+                                rocblas_int      incx,
+                                const void*      beta,
+                                void*            y,
+                                rocblas_datatype y_type,
+                                rocblas_int      incy,
+                                rocblas_datatype execution_type)
+try
+{
+    return rocblas_axpby_ex_impl<ROCBLAS_AXPY_NB, false, false>(handle,
+                                                                n,
+                                                                alpha,
+                                                                alpha_type,
+                                                                x,
+                                                                x_type,
+                                                                incx,
+                                                                0,
+                                                                beta,
+                                                                y,
+                                                                y_type,
+                                                                incy,
+                                                                0,
+                                                                1,
+                                                                execution_type,
+                                                                "rocblas_axpby_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_axpby_batched_ex(rocblas_handle   handle,
+                                        rocblas_int      n,
+                                        const void*      alpha,
+                                        rocblas_datatype alpha_type,
+                                        const void*      x,
+                                        rocblas_datatype x_type,
+                                        rocblas_int      incx,
+                                        const void*      beta,
+                                        void*            y,
+                                        rocblas_datatype y_type,
+                                        rocblas_int      incy,
+                                        rocblas_int      batch_count,
+                                        rocblas_datatype execution_type)
+try
+{
+    return rocblas_axpby_ex_impl<ROCBLAS_AXPY_NB, true, false>(handle,
+                                                               n,
+                                                               alpha,
+                                                               alpha_type,
+                                                               x,
+                                                               x_type,
+                                                               incx,
+                                                               0,
+                                                               beta,
+                                                               y,
+                                                               y_type,
+                                                               incy,
+                                                               0,
+                                                               batch_count,
+                                                               execution_type,
+                                                               "rocblas_axpby_batched_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_axpby_strided_batched_ex(rocblas_handle   handle,
+                                                rocblas_int      n,
+                                                const void*      alpha,
+                                                rocblas_datatype alpha_type,
+                                                const void*      x,
+                                                rocblas_datatype x_type,
+                                                rocblas_int      incx,
+                                                rocblas_stride   stride_x,
+                                                const void*      beta,
+                                                void*            y,
+                                                rocblas_datatype y_type,
+                                                rocblas_int      incy,
+                                                rocblas_stride   stride_y,
+                                                rocblas_int      batch_count,
+                                                rocblas_datatype execution_type)
+try
+{
+    return rocblas_axpby_ex_impl<ROCBLAS_AXPY_NB, false, false>(handle,
+                                                                n,
+                                                                alpha,
+                                                                alpha_type,
+                                                                x,
+                                                                x_type,
+                                                                incx,
+                                                                stride_x,
+                                                                beta,
+                                                                y,
+                                                                y_type,
+                                                                incy,
+                                                                stride_y,
+                                                                batch_count,
+                                                                execution_type,
+                                                                "rocblas_axpby_strided_batched_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_copy_scal_ex(rocblas_handle   handle,
+                                    rocblas_int      n,
+                                    const void*      alpha,
+                                    rocblas_datatype alpha_type,
+                                    const void*      x,
+                                    rocblas_datatype x_type,
+                                    rocblas_int      incx,
+                                    void*            y,
+                                    rocblas_datatype y_type,
+                                    rocblas_int      incy,
+                                    rocblas_datatype execution_type)
+try
+{
+    return rocblas_axpby_ex_impl<ROCBLAS_AXPY_NB, false, true>(handle,
+                                                               n,
+                                                               alpha,
+                                                               alpha_type,
+                                                               x,
+                                                               x_type,
+                                                               incx,
+                                                               0,
+                                                               nullptr,
+                                                               y,
+                                                               y_type,
+                                                               incy,
+                                                               0,
+                                                               1,
+                                                               execution_type,
+                                                               "rocblas_copy_scal_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_copy_scal_batched_ex(rocblas_handle   handle,
+                                            rocblas_int      n,
+                                            const void*      alpha,
+                                            rocblas_datatype alpha_type,
+                                            const void*      x,
+                                            rocblas_datatype x_type,
+                                            rocblas_int      incx,
+                                            void*            y,
+                                            rocblas_datatype y_type,
+                                            rocblas_int      incy,
+                                            rocblas_int      batch_count,
+                                            rocblas_datatype execution_type)
+try
+{
+    return rocblas_axpby_ex_impl<ROCBLAS_AXPY_NB, true, true>(handle,
+                                                              n,
+                                                              alpha,
+                                                              alpha_type,
+                                                              x,
+                                                              x_type,
+                                                              incx,
+                                                              0,
+                                                              nullptr,
+                                                              y,
+                                                              y_type,
+                                                              incy,
+                                                              0,
+                                                              batch_count,
+                                                              execution_type,
+                                                              "rocblas_copy_scal_batched_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_copy_scal_strided_batched_ex(rocblas_handle   handle,
+                                                    rocblas_int      n,
+                                                    const void*      alpha,
+                                                    rocblas_datatype alpha_type,
+                                                    const void*      x,
+                                                    rocblas_datatype x_type,
+                                                    rocblas_int      incx,
+                                                    rocblas_stride   stride_x,
+                                                    void*            y,
+                                                    rocblas_datatype y_type,
+                                                    rocblas_int      incy,
+                                                    rocblas_stride   stride_y,
+                                                    rocblas_int      batch_count,
+                                                    rocblas_datatype execution_type)
+try
+{
+    return rocblas_axpby_ex_impl<ROCBLAS_AXPY_NB, false, true>(
+        handle,
+        n,
+        alpha,
+        alpha_type,
+        x,
+        x_type,
+        incx,
+        stride_x,
+        nullptr,
+        y,
+        y_type,
+        incy,
+        stride_y,
+        batch_count,
+        execution_type,
+        "rocblas_copy_scal_strided_batched_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -21,9 +21,105 @@
  * ************************************************************************ */
 
 #include "../blas1/rocblas_axpy.hpp"
+#include "../blas1/rocblas_level1_launch.hpp"
 #include "handle.hpp"
 #include "logging.hpp"
 #include "rocblas_axpy_ex.hpp"
+#include "rocblas_stochastic_rounding.hpp"
+
+// axpy with float execution whose results of type To are rounded stochastically, with the
+// counter offset + b * n + i of the element i of batch b
+template <rocblas_int NB, typename To, typename Ta, typename Tx, typename Ty>
+ROCBLAS_KERNEL(NB)
+rocblas_axpy_ex_stochastic_kernel(rocblas_int    n,
+                                  Ta             alpha_device_host,
+                                  rocblas_stride stride_alpha,
+                                  Tx __restrict__ x,
+                                  rocblas_stride offset_x,
+                                  rocblas_int    incx,
+                                  rocblas_stride stride_x,
+                                  Ty __restrict__ y,
+                                  rocblas_stride offset_y,
+                                  rocblas_int    incy,
+                                  rocblas_stride stride_y,
+                                  uint64_t       seed,
+                                  uint64_t       offset)
+{
+    auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
+    if(!alpha)
+    {
+        return;
+    }
+
+    uint64_t counter = offset + uint64_t(blockIdx.y) * n;
+    for(ptrdiff_t tid = blockIdx.x * blockDim.x + threadIdx.x; tid < n;
+        tid += ptrdiff_t(gridDim.x) * blockDim.x)
+    {
+        auto tx = load_ptr_batch(x, blockIdx.y, offset_x + tid * incx, stride_x);
+        auto ty = load_ptr_batch(y, blockIdx.y, offset_y + tid * incy, stride_y);
+
+        float    v    = float(*ty) + float(alpha) * float(*tx);
+        uint32_t bits = rocblas_stochastic_rounding_bits(seed, counter + tid);
+        *ty           = rocblas_stochastic_round<To>(v, bits);
+    }
+}
+
+// rocblas_internal_axpy_template, or the stochastic rounding kernel when the handle rounds the
+// results of type To stochastically
+template <int NB, typename Tex, typename To, typename Ta, typename Tx, typename Ty>
+rocblas_status rocblas_axpy_ex_launch(rocblas_handle handle,
+                                      rocblas_int    n,
+                                      const Ta*      alpha,
+                                      rocblas_stride stride_alpha,
+                                      Tx             x,
+                                      rocblas_stride offset_x,
+                                      rocblas_int    incx,
+                                      rocblas_stride stride_x,
+                                      Ty             y,
+                                      rocblas_stride offset_y,
+                                      rocblas_int    incy,
+                                      rocblas_stride stride_y,
+                                      rocblas_int    batch_count)
+{
+    if(!rocblas_use_stochastic_rounding<To, Tex>(handle))
+        return rocblas_internal_axpy_template<NB, Tex>(handle,
+                                                       n,
+                                                       alpha,
+                                                       stride_alpha,
+                                                       x,
+                                                       offset_x,
+                                                       incx,
+                                                       stride_x,
+                                                       y,
+                                                       offset_y,
+                                                       incy,
+                                                       stride_y,
+                                                       batch_count);
+
+    ptrdiff_t shift_x = offset_x + ((incx < 0) ? ptrdiff_t(incx) * (1 - n) : 0);
+    ptrdiff_t shift_y = offset_y + ((incy < 0) ? ptrdiff_t(incy) * (1 - n) : 0);
+
+    static constexpr rocblas_stride stride_0 = 0;
+
+    rocblas_level1_launch<NB> launch(handle, n, batch_count);
+    uint64_t                  seed   = handle->stochastic_rounding_seed;
+    uint64_t                  offset = handle->stochastic_rounding_offset;
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        // clang-format off
+        hipLaunchKernelGGL((rocblas_axpy_ex_stochastic_kernel<NB, To>), launch.grid, launch.threads, 0, handle->get_stream(), n, alpha,
+                           stride_alpha, x, shift_x, incx, stride_x, y, shift_y, incy, stride_y, seed, offset);
+        // clang-format on
+    }
+    else
+    {
+        // clang-format off
+        hipLaunchKernelGGL((rocblas_axpy_ex_stochastic_kernel<NB, To>), launch.grid, launch.threads, 0, handle->get_stream(), n, *alpha,
+                           stride_0, x, shift_x, incx, stride_x, y, shift_y, incy, stride_y, seed, offset);
+        // clang-format on
+    }
+    return rocblas_status_success;
+}
 
 template <int NB, bool BATCHED, typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty>
 rocblas_status rocblas_axpy_ex_typecasting(const char*    name,
@@ -78,19 +174,19 @@ rocblas_status rocblas_axpy_ex_typecasting(const char*    name,
                 return axpy_ex_check_numerics_status;
         }
 
-        rocblas_status status = rocblas_internal_axpy_template<NB, Tex>(handle,
-                                                                        n,
-                                                                        alphat,
-                                                                        stride_alpha,
-                                                                        (const Tx* const*)x,
-                                                                        offset_x,
-                                                                        incx,
-                                                                        stride_x,
-                                                                        (Ty* const*)y,
-                                                                        offset_y,
-                                                                        incy,
-                                                                        stride_y,
-                                                                        batch_count);
+        rocblas_status status = rocblas_axpy_ex_launch<NB, Tex, Ty>(handle,
+                                                                    n,
+                                                                    alphat,
+                                                                    stride_alpha,
+                                                                    (const Tx* const*)x,
+                                                                    offset_x,
+                                                                    incx,
+                                                                    stride_x,
+                                                                    (Ty* const*)y,
+                                                                    offset_y,
+                                                                    incy,
+                                                                    stride_y,
+                                                                    batch_count);
         if(status != rocblas_status_success)
             return status;
 
@@ -143,19 +239,19 @@ rocblas_status rocblas_axpy_ex_typecasting(const char*    name,
                 return axpy_ex_check_numerics_status;
         }
 
-        rocblas_status status = rocblas_internal_axpy_template<NB, Tex>(handle,
-                                                                        n,
-                                                                        alphat,
-                                                                        stride_alpha,
-                                                                        (const Tx*)x,
-                                                                        offset_x,
-                                                                        incx,
-                                                                        stride_x,
-                                                                        (Ty*)y,
-                                                                        offset_y,
-                                                                        incy,
-                                                                        stride_y,
-                                                                        batch_count);
+        rocblas_status status = rocblas_axpy_ex_launch<NB, Tex, Ty>(handle,
+                                                                    n,
+                                                                    alphat,
+                                                                    stride_alpha,
+                                                                    (const Tx*)x,
+                                                                    offset_x,
+                                                                    incx,
+                                                                    stride_x,
+                                                                    (Ty*)y,
+                                                                    offset_y,
+                                                                    incy,
+                                                                    stride_y,
+                                                                    batch_count);
 
         if(status != rocblas_status_success)
             return status;
@@ -0,0 +1,489 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_ex.hpp"
+#include "rocblas_gemm_ext2.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+namespace
+{
+    // Tensors of a contraction, indexing the strides of an index
+    enum rocblas_contraction_tensor
+    {
+        TENSOR_A,
+        TENSOR_B,
+        TENSOR_C,
+        TENSOR_D,
+        TENSORS
+    };
+
+    // An index of a contraction, with its stride in each tensor, 0 in the tensors without it
+    struct rocblas_contraction_index
+    {
+        int64_t        size;
+        rocblas_stride stride[TENSORS];
+    };
+
+    using rocblas_contraction_indices = std::vector<rocblas_contraction_index>;
+
+    // Drops the indices of size 1, sorts the others by their stride in tensor t, and folds
+    // each index into the previous one when it continues it in all the tensors, so that the
+    // indices of packed tensors become a single index
+    void rocblas_fold_contraction_indices(rocblas_contraction_indices& indices,
+                                          rocblas_contraction_tensor   t)
+    {
+        using index_t = rocblas_contraction_index;
+        indices.erase(std::remove_if(indices.begin(),
+                                     indices.end(),
+                                     [](const index_t& i) { return i.size == 1; }),
+                      indices.end());
+        std::stable_sort(
+            indices.begin(), indices.end(), [t](const index_t& i, const index_t& j) {
+                return i.stride[t] < j.stride[t];
+            });
+
+        rocblas_contraction_indices folded;
+        for(const auto& index : indices)
+        {
+            if(!folded.empty())
+            {
+                auto& prev      = folded.back();
+                bool  continues = true;
+                for(int s = 0; s < TENSORS; s++)
+                    continues = continues && index.stride[s] == prev.stride[s] * prev.size;
+                if(continues)
+                {
+                    prev.size *= index.size;
+                    continue;
+                }
+            }
+            folded.push_back(index);
+        }
+        indices.swap(folded);
+    }
+
+    // The first index of a class after folding, which is mapped onto a GEMM dimension, or a
+    // unit index if the class has none
+    rocblas_contraction_index rocblas_gemm_index(const rocblas_contraction_indices& indices)
+    {
+        return indices.empty() ? rocblas_contraction_index{1, {0, 0, 0, 0}} : indices[0];
+    }
+
+    rocblas_status rocblas_contract_ex_impl(rocblas_handle        handle,
+                                            rocblas_int           num_free_a,
+                                            rocblas_int           num_free_b,
+                                            rocblas_int           num_bound,
+                                            rocblas_int           num_batch,
+                                            const int64_t*        sizes,
+                                            const void*           alpha,
+                                            const void*           a,
+                                            rocblas_datatype      a_type,
+                                            const rocblas_stride* strides_a,
+                                            const void*           b,
+                                            rocblas_datatype      b_type,
+                                            const rocblas_stride* strides_b,
+                                            const void*           beta,
+                                            const void*           c,
+                                            rocblas_datatype      c_type,
+                                            const rocblas_stride* strides_c,
+                                            void*                 d,
+                                            rocblas_datatype      d_type,
+                                            const rocblas_stride* strides_d,
+                                            rocblas_datatype      compute_type,
+                                            rocblas_gemm_algo     algo,
+                                            int32_t               solution_index,
+                                            uint32_t              flags)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        const bool HPA = compute_type == rocblas_datatype_f32_r
+                         && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
+        if(!HPA)
+            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(!handle->is_device_memory_size_query() && (layer_mode & rocblas_layer_mode_log_trace))
+        {
+            rocblas_internal_ostream alphass, betass;
+            if(handle->pointer_mode == rocblas_pointer_mode_device
+               || log_trace_alpha_beta_ex(compute_type, alpha, beta, alphass, betass)
+                      != rocblas_status_success)
+            {
+                alphass << alpha;
+                betass << beta;
+            }
+
+            log_trace(handle,
+                      "rocblas_contract_ex",
+                      num_free_a,
+                      num_free_b,
+                      num_bound,
+                      num_batch,
+                      sizes,
+                      alphass.str(),
+                      a,
+                      rocblas_datatype_string(a_type),
+                      strides_a,
+                      b,
+                      rocblas_datatype_string(b_type),
+                      strides_b,
+                      betass.str(),
+                      c,
+                      rocblas_datatype_string(c_type),
+                      strides_c,
+                      d,
+                      rocblas_datatype_string(d_type),
+                      strides_d,
+                      rocblas_datatype_string(compute_type),
+                      algo,
+                      solution_index,
+                      rocblas_gemm_flags(flags));
+        }
+
+        if(num_free_a < 0 || num_free_b < 0 || num_bound < 0 || num_batch < 0)
+            return rocblas_status_invalid_size;
+
+        const rocblas_int num_a = num_free_a + num_bound + num_batch;
+        const rocblas_int num_b = num_free_b + num_bound + num_batch;
+        const rocblas_int num_d = num_free_a + num_free_b + num_batch;
+        if(((num_a || num_b) && !sizes) || (num_a && !strides_a) || (num_b && !strides_b)
+           || (num_d && (!strides_c || !strides_d)))
+            return rocblas_status_invalid_pointer;
+
+        rocblas_contraction_indices free_a, free_b, bound, batch;
+        for(rocblas_int i = 0; i < num_free_a; i++)
+            free_a.push_back({sizes[i], {strides_a[i], 0, strides_c[i], strides_d[i]}});
+        for(rocblas_int i = 0; i < num_free_b; i++)
+            free_b.push_back(
+                {sizes[num_free_a + i],
+                 {0, strides_b[i], strides_c[num_free_a + i], strides_d[num_free_a + i]}});
+        for(rocblas_int i = 0; i < num_bound; i++)
+            bound.push_back({sizes[num_free_a + num_free_b + i],
+                             {strides_a[num_free_a + i], strides_b[num_free_b + i], 0, 0}});
+        for(rocblas_int i = 0; i < num_batch; i++)
+            batch.push_back({sizes[num_free_a + num_free_b + num_bound + i],
+                             {strides_a[num_free_a + num_bound + i],
+                              strides_b[num_free_b + num_bound + i],
+                              strides_c[num_free_a + num_free_b + i],
+                              strides_d[num_free_a + num_free_b + i]}});
+
+        auto any_size = [](const rocblas_contraction_indices& indices, bool (*pred)(int64_t)) {
+            return std::any_of(indices.begin(), indices.end(), [pred](const auto& index) {
+                return pred(index.size);
+            });
+        };
+        auto negative = [](int64_t size) { return size < 0; };
+        auto zero     = [](int64_t size) { return size == 0; };
+        for(const auto* indices : {&free_a, &free_b, &bound, &batch})
+            if(any_size(*indices, negative))
+                return rocblas_status_invalid_size;
+
+        const bool empty_d   = any_size(free_a, zero) || any_size(free_b, zero)
+                             || any_size(batch, zero);
+        const bool empty_sum = any_size(bound, zero);
+
+        // Quick return if possible. An empty sum still scales C by beta.
+        if(empty_d)
+            return handle->is_device_memory_size_query() ? rocblas_status_size_unchanged
+                                                         : rocblas_status_success;
+        if(empty_sum)
+            bound.clear();
+
+        if(!alpha || !beta || !d || (!empty_sum && (!a || !b)))
+            return rocblas_status_invalid_pointer;
+
+        // Copy alpha and beta to host if on device
+        rocblas_union_t alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, empty_sum ? 0 : 1, compute_type));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(!c && value_category(beta, compute_type) != 0)
+            return rocblas_status_invalid_pointer;
+
+        rocblas_fold_contraction_indices(free_a, TENSOR_D);
+        rocblas_fold_contraction_indices(free_b, TENSOR_D);
+        rocblas_fold_contraction_indices(bound, TENSOR_A);
+        rocblas_fold_contraction_indices(batch, TENSOR_D);
+
+        // D is computed column-major. If its rows are strided and its columns are not,
+        // D**T = B**T * A**T is computed instead, exchanging A and B.
+        auto unit = [](const rocblas_contraction_index& i, rocblas_contraction_tensor t) {
+            return i.size <= 1 || i.stride[t] == 1;
+        };
+        if(!unit(rocblas_gemm_index(free_a), TENSOR_D)
+           && unit(rocblas_gemm_index(free_b), TENSOR_D))
+        {
+            for(auto* indices : {&free_a, &free_b, &bound, &batch})
+                for(auto& index : *indices)
+                    std::swap(index.stride[TENSOR_A], index.stride[TENSOR_B]);
+            std::swap(free_a, free_b);
+            std::swap(a, b);
+            std::swap(a_type, b_type);
+        }
+
+        const rocblas_contraction_index M = rocblas_gemm_index(free_a);
+        const rocblas_contraction_index N = rocblas_gemm_index(free_b);
+        const rocblas_contraction_index K = empty_sum ? rocblas_contraction_index{0, {0, 0, 0, 0}}
+                                                      : rocblas_gemm_index(bound);
+        const rocblas_contraction_index L = rocblas_gemm_index(batch);
+
+        // The remaining indices are looped over on the host. The sum over the remaining bound
+        // indices accumulates into D.
+        rocblas_contraction_indices outer, inner;
+        for(const auto* indices : {&free_a, &free_b, &batch})
+            if(indices->size() > 1)
+                outer.insert(outer.end(), indices->begin() + 1, indices->end());
+        if(bound.size() > 1)
+            inner.assign(bound.begin() + 1, bound.end());
+
+        // Leading dimension of a matrix of the given rows and columns, which is the stride of its
+        // columns, or its number of rows if it has at most one column
+        auto ld = [](const rocblas_contraction_index& rows,
+                     const rocblas_contraction_index& cols,
+                     rocblas_contraction_tensor       t) {
+            return cols.size <= 1 ? std::max<int64_t>(rows.size, 1) : cols.stride[t];
+        };
+
+        // A, B, C and D are GEMM operands if each has a unit stride along one of its dimensions;
+        // otherwise the general strides are passed to Tensile, which may not support them
+        const bool gemm_layout = (unit(M, TENSOR_A) || unit(K, TENSOR_A))
+                                 && (unit(K, TENSOR_B) || unit(N, TENSOR_B))
+                                 && unit(M, TENSOR_C) && unit(M, TENSOR_D);
+        const rocblas_operation trans_a
+            = unit(M, TENSOR_A) ? rocblas_operation_none : rocblas_operation_transpose;
+        const rocblas_operation trans_b
+            = unit(K, TENSOR_B) ? rocblas_operation_none : rocblas_operation_transpose;
+        const int64_t lda = trans_a == rocblas_operation_none ? ld(M, K, TENSOR_A)
+                                                              : ld(K, M, TENSOR_A);
+        const int64_t ldb = trans_b == rocblas_operation_none ? ld(K, N, TENSOR_B)
+                                                              : ld(N, K, TENSOR_B);
+        const int64_t ldc = ld(M, N, TENSOR_C);
+        const int64_t ldd = ld(M, N, TENSOR_D);
+
+        constexpr int64_t int_max = std::numeric_limits<rocblas_int>::max();
+        for(int64_t value : {M.size, N.size, K.size, L.size, lda, ldb, ldc, ldd})
+            if(value > int_max)
+                return rocblas_status_invalid_size;
+        if(!gemm_layout)
+            for(const auto& index : {M, N, K})
+                for(int s = 0; s < TENSORS; s++)
+                    if(std::abs(index.stride[s]) > int_max)
+                        return rocblas_status_invalid_size;
+
+        // beta is applied by the first step of the sum, the others accumulating into D
+        rocblas_union_t one;
+        switch(compute_type)
+        {
+        case rocblas_datatype_f16_r:
+            one.h = 1;
+            break;
+        case rocblas_datatype_f32_r:
+            one.s = 1;
+            break;
+        case rocblas_datatype_f64_r:
+            one.d = 1;
+            break;
+        case rocblas_datatype_i32_r:
+            one.i = 1;
+            break;
+        case rocblas_datatype_f32_c:
+            one.c = {1, 0};
+            break;
+        case rocblas_datatype_f64_c:
+            one.z = {1, 0};
+            break;
+        default:
+            return rocblas_status_not_implemented;
+        }
+
+        // One GEMM at the element offsets of the looped indices
+        auto gemm = [&](const rocblas_stride* offset, bool accumulate) {
+            const void*                gemm_beta = accumulate ? &one : beta;
+            const void*                gemm_c    = accumulate ? d : c;
+            rocblas_datatype           gemm_c_t  = accumulate ? d_type : c_type;
+            rocblas_contraction_tensor ct        = accumulate ? TENSOR_D : TENSOR_C;
+            rocblas_stride             offset_c  = offset[ct];
+
+            if(gemm_layout)
+                return rocblas_gemm_ex_template<false>(handle,
+                                                       trans_a,
+                                                       trans_b,
+                                                       rocblas_int(M.size),
+                                                       rocblas_int(N.size),
+                                                       rocblas_int(K.size),
+                                                       alpha,
+                                                       a,
+                                                       a_type,
+                                                       offset[TENSOR_A],
+                                                       rocblas_int(lda),
+                                                       L.stride[TENSOR_A],
+                                                       b,
+                                                       b_type,
+                                                       offset[TENSOR_B],
+                                                       rocblas_int(ldb),
+                                                       L.stride[TENSOR_B],
+                                                       gemm_beta,
+                                                       gemm_c,
+                                                       gemm_c_t,
+                                                       offset_c,
+                                                       rocblas_int(accumulate ? ldd : ldc),
+                                                       L.stride[ct],
+                                                       d,
+                                                       d_type,
+                                                       offset[TENSOR_D],
+                                                       rocblas_int(ldd),
+                                                       L.stride[TENSOR_D],
+                                                       rocblas_int(L.size),
+                                                       compute_type,
+                                                       algo,
+                                                       solution_index,
+                                                       flags);
+
+            return rocblas_gemm_ext2_template(handle,
+                                              rocblas_int(M.size),
+                                              rocblas_int(N.size),
+                                              rocblas_int(K.size),
+                                              alpha,
+                                              a,
+                                              a_type,
+                                              offset[TENSOR_A],
+                                              rocblas_int(M.stride[TENSOR_A]),
+                                              rocblas_int(K.stride[TENSOR_A]),
+                                              L.stride[TENSOR_A],
+                                              b,
+                                              b_type,
+                                              offset[TENSOR_B],
+                                              rocblas_int(K.stride[TENSOR_B]),
+                                              rocblas_int(N.stride[TENSOR_B]),
+                                              L.stride[TENSOR_B],
+                                              gemm_beta,
+                                              gemm_c,
+                                              gemm_c_t,
+                                              offset_c,
+                                              rocblas_int(M.stride[ct]),
+                                              rocblas_int(N.stride[ct]),
+                                              L.stride[ct],
+                                              d,
+                                              d_type,
+                                              offset[TENSOR_D],
+                                              rocblas_int(M.stride[TENSOR_D]),
+                                              rocblas_int(N.stride[TENSOR_D]),
+                                              L.stride[TENSOR_D],
+                                              rocblas_int(L.size),
+                                              compute_type,
+                                              flags);
+        };
+
+        // Iterate over the looped indices like an odometer, the sum being innermost
+        rocblas_contraction_indices loops(outer);
+        loops.insert(loops.end(), inner.begin(), inner.end());
+        std::vector<int64_t> position(loops.size());
+        const size_t         first_inner = outer.size();
+        for(;;)
+        {
+            rocblas_stride offset[TENSORS] = {};
+            bool           accumulate      = false;
+            for(size_t l = 0; l < loops.size(); l++)
+            {
+                for(int s = 0; s < TENSORS; s++)
+                    offset[s] += position[l] * loops[l].stride[s];
+                accumulate = accumulate || (l >= first_inner && position[l]);
+            }
+
+            // The GEMMs of a query are all the same problem
+            rocblas_status status = gemm(offset, accumulate);
+            if(handle->is_device_memory_size_query() || status != rocblas_status_success)
+                return status;
+
+            size_t l = loops.size();
+            while(l && ++position[l - 1] == loops[l - 1].size)
+                position[--l] = 0;
+            if(!l)
+                return rocblas_status_success;
+        }
+    }
+}
+
+extern "C" rocblas_status rocblas_contract_ex(rocblas_handle        handle,
+                                              rocblas_int           num_free_a,
+                                              rocblas_int           num_free_b,
+                                              rocblas_int           num_bound,
+                                              rocblas_int           num_batch,
+                                              const int64_t*        sizes,
+                                              const void*           alpha,
+                                              const void*           a,
+                                              rocblas_datatype      a_type,
+                                              const rocblas_stride* strides_a,
+                                              const void*           b,
+                                              rocblas_datatype      b_type,
+                                              const rocblas_stride* strides_b,
+                                              const void*           beta,
+                                              const void*           c,
+                                              rocblas_datatype      c_type,
+                                              const rocblas_stride* strides_c,
+                                              void*                 d,
+                                              rocblas_datatype      d_type,
+                                              const rocblas_stride* strides_d,
+                                              rocblas_datatype      compute_type,
+                                              rocblas_gemm_algo     algo,
+                                              int32_t               solution_index,
+                                              uint32_t              flags)
+try
+{
+    return rocblas_contract_ex_impl(handle,
+                                    num_free_a,
+                                    num_free_b,
+                                    num_bound,
+                                    num_batch,
+                                    sizes,
+                                    alpha,
+                                    a,
+                                    a_type,
+                                    strides_a,
+                                    b,
+                                    b_type,
+                                    strides_b,
+                                    beta,
+                                    c,
+                                    c_type,
+                                    strides_c,
+                                    d,
+                                    d_type,
+                                    strides_d,
+                                    compute_type,
+                                    algo,
+                                    solution_index,
+                                    flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
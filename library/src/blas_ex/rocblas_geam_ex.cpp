@@ -57,7 +57,7 @@ namespace
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         // Perform logging
-        auto layer_mode = handle->layer_mode;
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
               | rocblas_layer_mode_log_profile))
@@ -272,6 +272,12 @@ namespace
             return validArgs;
         }
 
+        if(geam_ex_op != rocblas_geam_ex_operation_min_plus
+           && geam_ex_op != rocblas_geam_ex_operation_plus_min
+           && geam_ex_op != rocblas_geam_ex_operation_max_plus
+           && geam_ex_op != rocblas_geam_ex_operation_max_min)
+            return rocblas_status_invalid_value;
+
         rocblas_stride stride_zero = 0;
         rocblas_stride offset_zero = 0;
         rocblas_int    batch_count = 1;
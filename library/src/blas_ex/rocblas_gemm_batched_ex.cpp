@@ -72,7 +72,7 @@ try
     if(!handle->is_device_memory_size_query())
     {
         // Perform logging
-        auto layer_mode = handle->layer_mode;
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
               | rocblas_layer_mode_log_profile))
@@ -255,6 +255,51 @@ try
     auto stride_c = rocblas_stride(ldc) * n;
     auto stride_d = rocblas_stride(ldd) * n;
 
+    // Pointer arrays which are evenly strided run the strided batched gemm_ex
+    const void*    arrays[]     = {a, b, c, d};
+    const size_t   elem_sizes[] = {rocblas_sizeof_datatype(a_type),
+                                 rocblas_sizeof_datatype(b_type),
+                                 rocblas_sizeof_datatype(c_type),
+                                 rocblas_sizeof_datatype(d_type)};
+    void*          bases[4];
+    rocblas_stride strides[4];
+    if(!(flags & rocblas_gemm_flags_pack_int8x4)
+       && rocblas_internal_detect_pointer_array_strides(
+           handle, batch_count, 4, arrays, elem_sizes, bases, strides))
+        return rocblas_gemm_ex_template<false>(handle,
+                                               trans_a,
+                                               trans_b,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha,
+                                               bases[0],
+                                               a_type,
+                                               0,
+                                               lda,
+                                               strides[0],
+                                               bases[1],
+                                               b_type,
+                                               0,
+                                               ldb,
+                                               strides[1],
+                                               beta,
+                                               bases[2],
+                                               c_type,
+                                               0,
+                                               ldc,
+                                               strides[2],
+                                               bases[3],
+                                               d_type,
+                                               0,
+                                               ldd,
+                                               strides[3],
+                                               batch_count,
+                                               compute_type,
+                                               algo,
+                                               solution_index,
+                                               flags);
+
     return rocblas_gemm_ex_template<true>(handle,
                                           trans_a,
                                           trans_b,
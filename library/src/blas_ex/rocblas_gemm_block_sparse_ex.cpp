@@ -0,0 +1,424 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+    // Matrices of the batched gemms, indexing their pointer arrays
+    enum rocblas_block_sparse_matrix
+    {
+        BLOCK_SPARSE_A,
+        BLOCK_SPARSE_B,
+        BLOCK_SPARSE_C,
+        BLOCK_SPARSE_D,
+        BLOCK_SPARSE_MATRICES
+    };
+
+    rocblas_status rocblas_gemm_block_sparse_ex_impl(rocblas_handle     handle,
+                                                     rocblas_operation  trans_b,
+                                                     rocblas_int        mb,
+                                                     rocblas_int        n,
+                                                     rocblas_int        kb,
+                                                     rocblas_int        nnzb,
+                                                     rocblas_int        block_dim,
+                                                     const void*        alpha,
+                                                     const rocblas_int* bsr_row_ptr,
+                                                     const rocblas_int* bsr_col_ind,
+                                                     const void*        bsr_val,
+                                                     rocblas_datatype   a_type,
+                                                     const void*        b,
+                                                     rocblas_datatype   b_type,
+                                                     rocblas_int        ldb,
+                                                     const void*        beta,
+                                                     const void*        c,
+                                                     rocblas_datatype   c_type,
+                                                     rocblas_int        ldc,
+                                                     void*              d,
+                                                     rocblas_datatype   d_type,
+                                                     rocblas_int        ldd,
+                                                     rocblas_datatype   compute_type,
+                                                     rocblas_gemm_algo  algo,
+                                                     int32_t            solution_index,
+                                                     uint32_t           flags)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(!handle->is_device_memory_size_query() && (layer_mode & rocblas_layer_mode_log_trace))
+        {
+            rocblas_internal_ostream alphass, betass;
+            if(handle->pointer_mode == rocblas_pointer_mode_device
+               || log_trace_alpha_beta_ex(compute_type, alpha, beta, alphass, betass)
+                      != rocblas_status_success)
+            {
+                alphass << alpha;
+                betass << beta;
+            }
+
+            log_trace(handle,
+                      "rocblas_gemm_block_sparse_ex",
+                      trans_b,
+                      mb,
+                      n,
+                      kb,
+                      nnzb,
+                      block_dim,
+                      alphass.str(),
+                      bsr_row_ptr,
+                      bsr_col_ind,
+                      bsr_val,
+                      rocblas_datatype_string(a_type),
+                      b,
+                      rocblas_datatype_string(b_type),
+                      ldb,
+                      betass.str(),
+                      c,
+                      rocblas_datatype_string(c_type),
+                      ldc,
+                      d,
+                      rocblas_datatype_string(d_type),
+                      ldd,
+                      rocblas_datatype_string(compute_type),
+                      algo,
+                      solution_index,
+                      rocblas_gemm_flags(flags));
+        }
+
+        if(trans_b != rocblas_operation_none && trans_b != rocblas_operation_transpose
+           && trans_b != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        if(mb < 0 || n < 0 || kb < 0 || nnzb < 0 || block_dim < 0)
+            return rocblas_status_invalid_size;
+
+        constexpr int64_t int_max = std::numeric_limits<rocblas_int>::max();
+        const int64_t     m       = int64_t(mb) * block_dim;
+        const int64_t     k       = int64_t(kb) * block_dim;
+        if(m > int_max || k > int_max || ldc < m || ldd < m
+           || ldb < (trans_b == rocblas_operation_none ? k : n))
+            return rocblas_status_invalid_size;
+
+        // Quick return if possible
+        if(!m || !n)
+            return handle->is_device_memory_size_query() ? rocblas_status_size_unchanged
+                                                         : rocblas_status_success;
+
+        if(!bsr_row_ptr || (nnzb && (!bsr_col_ind || !bsr_val || !b)))
+            return rocblas_status_invalid_pointer;
+
+        // The block structure is read on the host, which requires synchronizing the stream.
+        // The device memory depends on it, so it is read in a query too.
+        if(handle->is_graph_safe())
+            return rocblas_status_not_implemented;
+
+        // Copy alpha and beta to host if on device
+        rocblas_union_t alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, nnzb, compute_type));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        // The arguments of the gemm of one block
+        auto validArgs = rocblas_validateArgs(handle,
+                                              rocblas_operation_none,
+                                              trans_b,
+                                              block_dim,
+                                              n,
+                                              nnzb ? block_dim : 0,
+                                              alpha,
+                                              bsr_val,
+                                              block_dim,
+                                              b,
+                                              nnzb ? ldb : block_dim,
+                                              beta,
+                                              c,
+                                              c_type,
+                                              ldc,
+                                              d,
+                                              d_type,
+                                              ldd,
+                                              compute_type);
+        if(validArgs != rocblas_status_continue && validArgs != rocblas_status_success)
+            return validArgs;
+
+        hipStream_t              stream = handle->get_stream();
+        std::vector<rocblas_int> row_ptr(size_t(mb) + 1), col_ind(nnzb);
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(row_ptr.data(),
+                                           bsr_row_ptr,
+                                           sizeof(rocblas_int) * row_ptr.size(),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+        if(nnzb)
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(col_ind.data(),
+                                               bsr_col_ind,
+                                               sizeof(rocblas_int) * nnzb,
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(row_ptr[0] != 0 || row_ptr[mb] != nnzb)
+            return rocblas_status_invalid_value;
+        for(rocblas_int I = 0; I < mb; I++)
+            if(row_ptr[I + 1] < row_ptr[I])
+                return rocblas_status_invalid_value;
+        for(rocblas_int J : col_ind)
+            if(J < 0 || J >= kb)
+                return rocblas_status_invalid_value;
+
+        // Block rows by decreasing number of blocks, so that the block rows of step s of the
+        // sum, those with more than s blocks, come first. The block rows without blocks are last.
+        auto blocks = [&](rocblas_int I) { return row_ptr[I + 1] - row_ptr[I]; };
+
+        std::vector<rocblas_int> order(mb);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](rocblas_int I0, rocblas_int I1) {
+            return blocks(I0) > blocks(I1);
+        });
+
+        // The number of block rows of each step
+        const rocblas_int steps = blocks(order[0]);
+
+        std::vector<rocblas_int> batch(steps);
+        for(rocblas_int I = 0; I < mb; I++)
+            for(rocblas_int s = 0; s < blocks(I); s++)
+                batch[s]++;
+
+        const rocblas_int empty = rocblas_int(
+            std::count_if(order.begin(), order.end(), [&](rocblas_int I) { return !blocks(I); }));
+        const rocblas_int total = nnzb + empty;
+
+        // beta is applied by the first step of the sum, the others accumulating into D
+        rocblas_union_t one;
+        switch(compute_type)
+        {
+        case rocblas_datatype_f16_r:
+            one.h = 1;
+            break;
+        case rocblas_datatype_f32_r:
+            one.s = 1;
+            break;
+        case rocblas_datatype_f64_r:
+            one.d = 1;
+            break;
+        case rocblas_datatype_i32_r:
+            one.i = 1;
+            break;
+        case rocblas_datatype_f32_c:
+            one.c = {1, 0};
+            break;
+        case rocblas_datatype_f64_c:
+            one.z = {1, 0};
+            break;
+        default:
+            return rocblas_status_not_implemented;
+        }
+
+        // One batched gemm per step of the sum, and one with k = 0 scaling the block rows
+        // without blocks by beta, over consecutive positions of the pointer arrays
+        auto run_steps = [&](void** ptrs) {
+            bool size_increased = false;
+
+            auto gemm = [&](rocblas_int pos, rocblas_int count, rocblas_int kk, bool accumulate) {
+                rocblas_status status
+                    = rocblas_gemm_ex_template<true>(handle,
+                                                     rocblas_operation_none,
+                                                     trans_b,
+                                                     block_dim,
+                                                     n,
+                                                     kk,
+                                                     alpha,
+                                                     ptrs + BLOCK_SPARSE_A * size_t(total) + pos,
+                                                     a_type,
+                                                     0,
+                                                     block_dim,
+                                                     0,
+                                                     ptrs + BLOCK_SPARSE_B * size_t(total) + pos,
+                                                     b_type,
+                                                     0,
+                                                     ldb,
+                                                     0,
+                                                     accumulate ? &one : beta,
+                                                     ptrs + BLOCK_SPARSE_C * size_t(total) + pos,
+                                                     accumulate ? d_type : c_type,
+                                                     0,
+                                                     accumulate ? ldd : ldc,
+                                                     0,
+                                                     ptrs + BLOCK_SPARSE_D * size_t(total) + pos,
+                                                     d_type,
+                                                     0,
+                                                     ldd,
+                                                     0,
+                                                     count,
+                                                     compute_type,
+                                                     algo,
+                                                     solution_index,
+                                                     flags);
+                if(status == rocblas_status_size_increased)
+                    size_increased = true;
+                return status == rocblas_status_size_increased
+                               || status == rocblas_status_size_unchanged
+                           ? rocblas_status_success
+                           : status;
+            };
+
+            rocblas_int pos = 0;
+            for(rocblas_int s = 0; s < steps; pos += batch[s++])
+                RETURN_IF_ROCBLAS_ERROR(gemm(pos, batch[s], block_dim, s > 0));
+            if(empty)
+                RETURN_IF_ROCBLAS_ERROR(gemm(pos, empty, 0, false));
+
+            if(handle->is_device_memory_size_query())
+                return size_increased ? rocblas_status_size_increased
+                                      : rocblas_status_size_unchanged;
+            return rocblas_status_success;
+        };
+
+        // The pointer arrays are kept in device memory while the gemms are run. They are not
+        // dereferenced in a query, which is given the matrices instead.
+        size_t ptrs_bytes = sizeof(void*) * BLOCK_SPARSE_MATRICES * total;
+        if(handle->is_device_memory_size_query())
+        {
+            size_t steps_bytes;
+            RETURN_IF_ROCBLAS_ERROR(handle->query_device_memory_size(
+                &steps_bytes, [&] { return run_steps((void**)d); }));
+            return handle->set_optimal_device_memory_size(ptrs_bytes, steps_bytes);
+        }
+
+        auto w_mem = handle->device_malloc(ptrs_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        // C is not read when it is nullptr, beta being 0, so D is given in its place
+        const void*      c_base      = c ? c : d;
+        rocblas_datatype c_base_type = c ? c_type : d_type;
+
+        auto at = [](const void* base, size_t offset, rocblas_datatype type) {
+            return (void*)((const char*)base + offset * rocblas_sizeof_datatype(type));
+        };
+
+        // The pointers of position pos for block row I and its block blk, or -1 for none
+        std::vector<void*> ptrs_h(size_t(BLOCK_SPARSE_MATRICES) * total);
+        auto set = [&](size_t pos, rocblas_int I, rocblas_int blk, bool accumulate) {
+            size_t a_offset = 0, b_offset = 0;
+            if(blk >= 0)
+            {
+                a_offset = size_t(blk) * block_dim * block_dim;
+                b_offset = size_t(col_ind[blk]) * block_dim
+                           * (trans_b == rocblas_operation_none ? 1 : size_t(ldb));
+            }
+            size_t row = size_t(I) * block_dim;
+
+            void** p = ptrs_h.data() + pos;
+
+            p[BLOCK_SPARSE_A * size_t(total)] = at(bsr_val, a_offset, a_type);
+            p[BLOCK_SPARSE_B * size_t(total)] = at(b, b_offset, b_type);
+            p[BLOCK_SPARSE_C * size_t(total)]
+                = accumulate ? at(d, row, d_type) : at(c_base, row, c_base_type);
+            p[BLOCK_SPARSE_D * size_t(total)] = at(d, row, d_type);
+        };
+
+        size_t pos = 0;
+        for(rocblas_int s = 0; s < steps; s++)
+            for(rocblas_int p = 0; p < batch[s]; p++)
+                set(pos++, order[p], row_ptr[order[p]] + s, s > 0);
+        // The blocks of A and B are not read by the gemm with k = 0
+        for(rocblas_int p = mb - empty; p < mb; p++)
+            set(pos++, order[p], -1, false);
+
+        void** ptrs_d = (void**)w_mem;
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(ptrs_d, ptrs_h.data(), ptrs_bytes, hipMemcpyHostToDevice, stream));
+        // ptrs_h is released on return
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        return run_steps(ptrs_d);
+    }
+}
+
+extern "C" rocblas_status rocblas_gemm_block_sparse_ex(rocblas_handle     handle,
+                                                       rocblas_operation  trans_b,
+                                                       rocblas_int        mb,
+                                                       rocblas_int        n,
+                                                       rocblas_int        kb,
+                                                       rocblas_int        nnzb,
+                                                       rocblas_int        block_dim,
+                                                       const void*        alpha,
+                                                       const rocblas_int* bsr_row_ptr,
+                                                       const rocblas_int* bsr_col_ind,
+                                                       const void*        bsr_val,
+                                                       rocblas_datatype   a_type,
+                                                       const void*        b,
+                                                       rocblas_datatype   b_type,
+                                                       rocblas_int        ldb,
+                                                       const void*        beta,
+                                                       const void*        c,
+                                                       rocblas_datatype   c_type,
+                                                       rocblas_int        ldc,
+                                                       void*              d,
+                                                       rocblas_datatype   d_type,
+                                                       rocblas_int        ldd,
+                                                       rocblas_datatype   compute_type,
+                                                       rocblas_gemm_algo  algo,
+                                                       int32_t            solution_index,
+                                                       uint32_t           flags)
+try
+{
+    return rocblas_gemm_block_sparse_ex_impl(handle,
+                                             trans_b,
+                                             mb,
+                                             n,
+                                             kb,
+                                             nnzb,
+                                             block_dim,
+                                             alpha,
+                                             bsr_row_ptr,
+                                             bsr_col_ind,
+                                             bsr_val,
+                                             a_type,
+                                             b,
+                                             b_type,
+                                             ldb,
+                                             beta,
+                                             c,
+                                             c_type,
+                                             ldc,
+                                             d,
+                                             d_type,
+                                             ldd,
+                                             compute_type,
+                                             algo,
+                                             solution_index,
+                                             flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
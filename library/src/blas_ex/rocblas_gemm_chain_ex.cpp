@@ -0,0 +1,562 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_epilogue.hpp"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    // The fused kernel computes MT rows of E per workgroup, keeping the MT x n intermediate in
+    // LDS, so it is used when n is at most NT
+    constexpr int GEMM_CHAIN_THREADS = 256;
+    constexpr int GEMM_CHAIN_MT      = 32;
+    constexpr int GEMM_CHAIN_NT      = 64;
+    constexpr int GEMM_CHAIN_KT      = 16;
+
+    // Element (i, j) of op( X )
+    template <typename T>
+    __device__ T
+        gemm_chain_load(rocblas_operation trans, const T* X, rocblas_int ldx, int64_t i, int64_t j)
+    {
+        return trans == rocblas_operation_none ? X[i + j * ldx] : X[j + i * ldx];
+    }
+
+    // Each thread owns row tid % MT of the workgroup's rows, and the columns congruent to
+    // tid / MT modulo the number of column groups, of both the intermediate and E.
+    //     T = activation( alpha*op( A )*op( B ) + bias ) is accumulated over tiles of k
+    //     E = T*op( D ) + beta*E is computed in tiles of NT columns of E
+    template <int THREADS, int MT, int NT, int KT, typename T, typename Tc>
+    ROCBLAS_KERNEL(THREADS)
+    rocblas_gemm_chain_kernel(rocblas_operation       trans_a,
+                              rocblas_operation       trans_b,
+                              rocblas_operation       trans_d,
+                              rocblas_int             m,
+                              rocblas_int             n,
+                              rocblas_int             k,
+                              rocblas_int             l,
+                              Tc                      alpha,
+                              const T*                A,
+                              rocblas_int             lda,
+                              const T*                B,
+                              rocblas_int             ldb,
+                              const T*                bias,
+                              rocblas_gemm_activation activation,
+                              const T*                D,
+                              rocblas_int             ldd,
+                              Tc                      beta,
+                              T*                      E,
+                              rocblas_int             lde)
+    {
+        constexpr int GROUPS = THREADS / MT;
+        constexpr int COLS   = NT / GROUPS;
+
+        __shared__ Tc sA[KT][MT];
+        __shared__ Tc sB[KT][NT];
+        __shared__ Tc sT[NT][MT];
+        __shared__ Tc sD[NT][NT];
+
+        const int     tid   = threadIdx.x;
+        const int     row   = tid % MT;
+        const int     group = tid / MT;
+        const int64_t i0    = int64_t(blockIdx.x) * MT;
+        const int64_t i     = i0 + row;
+
+        Tc acc[COLS];
+        for(int c = 0; c < COLS; c++)
+            acc[c] = 0;
+
+        for(rocblas_int p0 = 0; p0 < k; p0 += KT)
+        {
+            for(int e = tid; e < MT * KT; e += THREADS)
+            {
+                int r = e % MT, p = e / MT;
+                sA[p][r] = i0 + r < m && p0 + p < k
+                               ? Tc(gemm_chain_load(trans_a, A, lda, i0 + r, p0 + p))
+                               : Tc(0);
+            }
+            for(int e = tid; e < KT * NT; e += THREADS)
+            {
+                int p = e % KT, j = e / KT;
+                sB[p][j] = p0 + p < k && j < n ? Tc(gemm_chain_load(trans_b, B, ldb, p0 + p, j))
+                                               : Tc(0);
+            }
+            __syncthreads();
+
+            for(int p = 0; p < KT; p++)
+                for(int c = 0; c < COLS; c++)
+                    acc[c] += sA[p][row] * sB[p][group + c * GROUPS];
+            __syncthreads();
+        }
+
+        const Tc b = bias && i < m ? Tc(bias[i]) : Tc(0);
+        for(int c = 0; c < COLS; c++)
+            sT[group + c * GROUPS][row]
+                = rocblas_gemm_epilogue_activation(alpha * acc[c] + b, activation);
+
+        for(rocblas_int j0 = 0; j0 < l; j0 += NT)
+        {
+            for(int e = tid; e < NT * NT; e += THREADS)
+            {
+                int p = e % NT, j = e / NT;
+                sD[p][j] = p < n && j0 + j < l ? Tc(gemm_chain_load(trans_d, D, ldd, p, j0 + j))
+                                               : Tc(0);
+            }
+            __syncthreads();
+
+            for(int c = 0; c < COLS; c++)
+                acc[c] = 0;
+            for(int p = 0; p < n; p++)
+                for(int c = 0; c < COLS; c++)
+                    acc[c] += sT[p][row] * sD[p][group + c * GROUPS];
+
+            for(int c = 0; c < COLS; c++)
+            {
+                int64_t j = j0 + group + c * GROUPS;
+                if(i < m && j < l)
+                {
+                    T& y = E[i + j * lde];
+                    y    = T(beta == 0 ? acc[c] : acc[c] + beta * Tc(y));
+                }
+            }
+            __syncthreads();
+        }
+    }
+
+    template <typename T, typename Tc>
+    rocblas_status rocblas_gemm_chain_fused_template(rocblas_handle          handle,
+                                                     rocblas_operation       trans_a,
+                                                     rocblas_operation       trans_b,
+                                                     rocblas_operation       trans_d,
+                                                     rocblas_int             m,
+                                                     rocblas_int             n,
+                                                     rocblas_int             k,
+                                                     rocblas_int             l,
+                                                     const void*             alpha,
+                                                     const void*             a,
+                                                     rocblas_int             lda,
+                                                     const void*             b,
+                                                     rocblas_int             ldb,
+                                                     const void*             bias,
+                                                     rocblas_gemm_activation activation,
+                                                     const void*             d,
+                                                     rocblas_int             ldd,
+                                                     const void*             beta,
+                                                     void*                   e,
+                                                     rocblas_int             lde)
+    {
+        dim3 grid((m - 1) / GEMM_CHAIN_MT + 1);
+        dim3 threads(GEMM_CHAIN_THREADS);
+
+        hipLaunchKernelGGL((rocblas_gemm_chain_kernel<GEMM_CHAIN_THREADS,
+                                                      GEMM_CHAIN_MT,
+                                                      GEMM_CHAIN_NT,
+                                                      GEMM_CHAIN_KT,
+                                                      T,
+                                                      Tc>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           trans_a,
+                           trans_b,
+                           trans_d,
+                           m,
+                           n,
+                           k,
+                           l,
+                           *(const Tc*)alpha,
+                           (const T*)a,
+                           lda,
+                           (const T*)b,
+                           ldb,
+                           (const T*)bias,
+                           activation,
+                           (const T*)d,
+                           ldd,
+                           *(const Tc*)beta,
+                           (T*)e,
+                           lde);
+
+        return rocblas_status_success;
+    }
+
+    rocblas_status rocblas_gemm_chain_fused_dispatch(rocblas_handle          handle,
+                                                     rocblas_operation       trans_a,
+                                                     rocblas_operation       trans_b,
+                                                     rocblas_operation       trans_d,
+                                                     rocblas_int             m,
+                                                     rocblas_int             n,
+                                                     rocblas_int             k,
+                                                     rocblas_int             l,
+                                                     const void*             alpha,
+                                                     const void*             a,
+                                                     rocblas_int             lda,
+                                                     const void*             b,
+                                                     rocblas_int             ldb,
+                                                     const void*             bias,
+                                                     rocblas_gemm_activation activation,
+                                                     const void*             d,
+                                                     rocblas_int             ldd,
+                                                     const void*             beta,
+                                                     void*                   e,
+                                                     rocblas_int             lde,
+                                                     rocblas_datatype        type)
+    {
+#define CHAIN_PARM                                                                             \
+    handle, trans_a, trans_b, trans_d, m, n, k, l, alpha, a, lda, b, ldb, bias, activation, d, \
+        ldd, beta, e, lde
+
+        switch(type)
+        {
+        case rocblas_datatype_f32_r:
+            return rocblas_gemm_chain_fused_template<float, float>(CHAIN_PARM);
+        case rocblas_datatype_f64_r:
+            return rocblas_gemm_chain_fused_template<double, double>(CHAIN_PARM);
+        case rocblas_datatype_f16_r:
+            return rocblas_gemm_chain_fused_template<rocblas_half, float>(CHAIN_PARM);
+        case rocblas_datatype_bf16_r:
+            return rocblas_gemm_chain_fused_template<rocblas_bfloat16, float>(CHAIN_PARM);
+        default:
+            return rocblas_status_not_implemented;
+        }
+
+#undef CHAIN_PARM
+    }
+
+    // The two gemms through an m x n intermediate in device memory workspace, the first with
+    // the bias and activation as its rocblas_gemm_ex3 epilogue
+    rocblas_status rocblas_gemm_chain_workspace(rocblas_handle          handle,
+                                                rocblas_operation       trans_a,
+                                                rocblas_operation       trans_b,
+                                                rocblas_operation       trans_d,
+                                                rocblas_int             m,
+                                                rocblas_int             n,
+                                                rocblas_int             k,
+                                                rocblas_int             l,
+                                                const void*             alpha,
+                                                const void*             a,
+                                                rocblas_int             lda,
+                                                const void*             b,
+                                                rocblas_int             ldb,
+                                                const void*             bias,
+                                                rocblas_gemm_activation activation,
+                                                const void*             d,
+                                                rocblas_int             ldd,
+                                                const void*             beta,
+                                                void*                   e,
+                                                rocblas_int             lde,
+                                                rocblas_datatype        type,
+                                                rocblas_datatype        compute_type)
+    {
+        rocblas_union_t one, zero;
+        if(compute_type == rocblas_datatype_f64_r)
+            one.d = 1, zero.d = 0;
+        else
+            one.s = 1, zero.s = 0;
+
+        rocblas_gemm_epilogue epilogue{};
+        epilogue.bias       = bias;
+        epilogue.activation = activation;
+
+        auto gemms = [&](void* t) {
+            rocblas_status status = rocblas_gemm_ex3(handle,
+                                                     trans_a,
+                                                     trans_b,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     a,
+                                                     type,
+                                                     lda,
+                                                     b,
+                                                     type,
+                                                     ldb,
+                                                     &zero,
+                                                     t,
+                                                     type,
+                                                     m,
+                                                     t,
+                                                     type,
+                                                     m,
+                                                     compute_type,
+                                                     rocblas_gemm_algo_standard,
+                                                     0,
+                                                     0,
+                                                     &epilogue);
+            if(status != rocblas_status_success && status != rocblas_status_size_unchanged
+               && status != rocblas_status_size_increased)
+                return status;
+
+            return rocblas_gemm_ex(handle,
+                                   rocblas_operation_none,
+                                   trans_d,
+                                   m,
+                                   l,
+                                   n,
+                                   &one,
+                                   t,
+                                   type,
+                                   m,
+                                   d,
+                                   type,
+                                   ldd,
+                                   beta,
+                                   e,
+                                   type,
+                                   lde,
+                                   e,
+                                   type,
+                                   lde,
+                                   compute_type,
+                                   rocblas_gemm_algo_standard,
+                                   0,
+                                   0);
+        };
+
+        size_t t_size = rocblas_sizeof_datatype(type) * m * n;
+        if(handle->is_device_memory_size_query())
+        {
+            // The workspace of the gemms is queried with E standing in for the intermediate,
+            // which is validated but not dereferenced
+            size_t gemms_size;
+            RETURN_IF_ROCBLAS_ERROR(
+                handle->query_device_memory_size(&gemms_size, [&] { return gemms(e); }));
+            return handle->set_optimal_device_memory_size(t_size, gemms_size);
+        }
+
+        auto w_mem = handle->device_malloc(t_size);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        return gemms((void*)w_mem);
+    }
+
+    bool rocblas_gemm_chain_type_supported(rocblas_datatype type, rocblas_datatype compute_type)
+    {
+        return (type == rocblas_datatype_f64_r && compute_type == rocblas_datatype_f64_r)
+               || (compute_type == rocblas_datatype_f32_r
+                   && (type == rocblas_datatype_f32_r || type == rocblas_datatype_f16_r
+                       || type == rocblas_datatype_bf16_r));
+    }
+
+    rocblas_status rocblas_gemm_chain_ex_impl(rocblas_handle          handle,
+                                              rocblas_operation       trans_a,
+                                              rocblas_operation       trans_b,
+                                              rocblas_operation       trans_d,
+                                              rocblas_int             m,
+                                              rocblas_int             n,
+                                              rocblas_int             k,
+                                              rocblas_int             l,
+                                              const void*             alpha,
+                                              const void*             a,
+                                              rocblas_int             lda,
+                                              const void*             b,
+                                              rocblas_int             ldb,
+                                              const void*             bias,
+                                              rocblas_gemm_activation activation,
+                                              const void*             d,
+                                              rocblas_int             ldd,
+                                              const void*             beta,
+                                              void*                   e,
+                                              rocblas_int             lde,
+                                              rocblas_datatype        type,
+                                              rocblas_datatype        compute_type)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        const bool fused = n <= GEMM_CHAIN_NT;
+        if(fused)
+            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(!handle->is_device_memory_size_query()
+           && handle->layer_mode & rocblas_layer_mode_log_trace)
+        {
+            rocblas_internal_ostream alphass, betass;
+            if(handle->pointer_mode == rocblas_pointer_mode_device
+               || log_trace_alpha_beta_ex(compute_type, alpha, beta, alphass, betass)
+                      != rocblas_status_success)
+            {
+                alphass << alpha;
+                betass << beta;
+            }
+            log_trace(handle,
+                      "rocblas_gemm_chain_ex",
+                      trans_a,
+                      trans_b,
+                      trans_d,
+                      m,
+                      n,
+                      k,
+                      l,
+                      alphass.str(),
+                      a,
+                      lda,
+                      b,
+                      ldb,
+                      bias,
+                      activation,
+                      d,
+                      ldd,
+                      betass.str(),
+                      e,
+                      lde,
+                      rocblas_datatype_string(type),
+                      rocblas_datatype_string(compute_type));
+        }
+
+        if(!rocblas_gemm_chain_type_supported(type, compute_type))
+            return rocblas_status_not_implemented;
+
+        if(activation != rocblas_gemm_activation_none && activation != rocblas_gemm_activation_relu
+           && activation != rocblas_gemm_activation_gelu)
+            return rocblas_status_invalid_value;
+
+        for(auto trans : {trans_a, trans_b, trans_d})
+            if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+               && trans != rocblas_operation_conjugate_transpose)
+                return rocblas_status_invalid_value;
+
+        rocblas_int a_rows = trans_a == rocblas_operation_none ? m : k;
+        rocblas_int b_rows = trans_b == rocblas_operation_none ? k : n;
+        rocblas_int d_rows = trans_d == rocblas_operation_none ? n : l;
+        if(m < 0 || n < 0 || k < 0 || l < 0 || lda < std::max(1, a_rows)
+           || ldb < std::max(1, b_rows) || ldd < std::max(1, d_rows) || lde < std::max(1, m))
+            return rocblas_status_invalid_size;
+
+        if(!m || !l)
+            return rocblas_status_success;
+
+        if(!alpha || !beta || !e || (n && !d) || (n && k && (!a || !b)))
+            return rocblas_status_invalid_pointer;
+
+        // Copy alpha and beta to host if on device
+        rocblas_union_t alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, k, compute_type));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(fused)
+            return rocblas_gemm_chain_fused_dispatch(handle,
+                                                     trans_a,
+                                                     trans_b,
+                                                     trans_d,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     l,
+                                                     alpha,
+                                                     a,
+                                                     lda,
+                                                     b,
+                                                     ldb,
+                                                     bias,
+                                                     activation,
+                                                     d,
+                                                     ldd,
+                                                     beta,
+                                                     e,
+                                                     lde,
+                                                     type);
+
+        return rocblas_gemm_chain_workspace(handle,
+                                            trans_a,
+                                            trans_b,
+                                            trans_d,
+                                            m,
+                                            n,
+                                            k,
+                                            l,
+                                            alpha,
+                                            a,
+                                            lda,
+                                            b,
+                                            ldb,
+                                            bias,
+                                            activation,
+                                            d,
+                                            ldd,
+                                            beta,
+                                            e,
+                                            lde,
+                                            type,
+                                            compute_type);
+    }
+}
+// namespace
+
+extern "C" rocblas_status rocblas_gemm_chain_ex(rocblas_handle          handle,
+                                                rocblas_operation       trans_a,
+                                                rocblas_operation       trans_b,
+                                                rocblas_operation       trans_d,
+                                                rocblas_int             m,
+                                                rocblas_int             n,
+                                                rocblas_int             k,
+                                                rocblas_int             l,
+                                                const void*             alpha,
+                                                const void*             a,
+                                                rocblas_int             lda,
+                                                const void*             b,
+                                                rocblas_int             ldb,
+                                                const void*             bias,
+                                                rocblas_gemm_activation activation,
+                                                const void*             d,
+                                                rocblas_int             ldd,
+                                                const void*             beta,
+                                                void*                   e,
+                                                rocblas_int             lde,
+                                                rocblas_datatype        type,
+                                                rocblas_datatype        compute_type)
+try
+{
+    return rocblas_gemm_chain_ex_impl(handle,
+                                      trans_a,
+                                      trans_b,
+                                      trans_d,
+                                      m,
+                                      n,
+                                      k,
+                                      l,
+                                      alpha,
+                                      a,
+                                      lda,
+                                      b,
+                                      ldb,
+                                      bias,
+                                      activation,
+                                      d,
+                                      ldd,
+                                      beta,
+                                      e,
+                                      lde,
+                                      type,
+                                      compute_type);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
@@ -0,0 +1,49 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <type_traits>
+
+// Epilogue arithmetic is done in float, or double for double results
+template <typename Td>
+using rocblas_gemm_epilogue_compute_t
+    = std::conditional_t<std::is_same<Td, double>{}, double, float>;
+
+template <typename T>
+__device__ T rocblas_gemm_epilogue_activation(T x, rocblas_gemm_activation activation)
+{
+    switch(activation)
+    {
+    case rocblas_gemm_activation_relu:
+        return x > 0 ? x : T(0);
+    case rocblas_gemm_activation_gelu:
+    {
+        // 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+        const T sqrt_2_over_pi = T(0.7978845608028654);
+        return T(0.5) * x * (T(1) + tanh(sqrt_2_over_pi * (x + T(0.044715) * x * x * x)));
+    }
+    default:
+        return x;
+    }
+}
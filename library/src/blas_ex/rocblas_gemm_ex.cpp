@@ -23,6 +23,7 @@
 #include "rocblas_gemm_ex.hpp"
 #include "handle.hpp"
 #include "logging.hpp"
+#include "managed_prefetch.hpp"
 #include "rocblas.h"
 #include "rocblas_gemm_ex_get_solutions.hpp"
 #include "utility.hpp"
@@ -58,9 +59,27 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // FP8 and BF8 inputs are widened in workspace by rocblas_gemm_ex3
+        if(a_type == rocblas_datatype_f8_r || a_type == rocblas_datatype_bf8_r
+           || b_type == rocblas_datatype_f8_r || b_type == rocblas_datatype_bf8_r)
+        {
+            // clang-format off
+            return rocblas_gemm_ex3(handle, trans_a, trans_b, m, n, k, alpha,
+                                    a, a_type, lda, b, b_type, ldb, beta, c, c_type, ldc,
+                                    d, d_type, ldd, compute_type, algo, solution_index, flags,
+                                    nullptr);
+            // clang-format on
+        }
+
         const bool HPA = compute_type == rocblas_datatype_f32_r
                          && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
 
+        if(((flags & rocblas_gemm_ex_workspace_flags)
+            || rocblas_gemm_ex_real_complex_types(a_type, compute_type))
+           && handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(
+                rocblas_gemm_ex_workspace_size(m, n, k, 1, a_type, compute_type, flags));
+
         if(!HPA)
             RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
@@ -77,7 +96,7 @@ namespace
         if(!handle->is_device_memory_size_query())
         {
             // Perform logging
-            auto layer_mode = handle->layer_mode;
+            auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
             if(layer_mode
                & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
                   | rocblas_layer_mode_log_profile))
@@ -251,6 +270,26 @@ namespace
             }
         }
 
+        // bf16_r and f16_r results are rounded stochastically from f32_r workspace
+        if(rocblas_gemm_ex_use_stochastic_rounding(
+               handle, a_type, b_type, c_type, d_type, compute_type))
+        {
+            // clang-format off
+            return rocblas_gemm_ex_stochastic_rounding(handle, trans_a, trans_b, m, n, k, alpha,
+                                                       a, a_type, lda, 0, b, ldb, 0,
+                                                       beta, c, ldc, 0, d, ldd, 0, 1,
+                                                       algo, solution_index, flags);
+            // clang-format on
+        }
+
+        // clang-format off
+        rocblas_prefetch_managed_gemm(handle, trans_a, trans_b, m, n, k,
+                                      a, rocblas_sizeof_datatype(a_type), lda, 0,
+                                      b, rocblas_sizeof_datatype(b_type), ldb, 0,
+                                      c, rocblas_sizeof_datatype(c_type), ldc, 0,
+                                      d, rocblas_sizeof_datatype(d_type), ldd, 0, 1);
+        // clang-format on
+
     solution_fitness_query:
         rocblas_int batch_count = 1;
 
@@ -350,6 +389,90 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+extern "C" rocblas_status rocblas_gemm_ex_workspace_size(rocblas_handle    handle,
+                                                         rocblas_operation trans_a,
+                                                         rocblas_operation trans_b,
+                                                         rocblas_int       m,
+                                                         rocblas_int       n,
+                                                         rocblas_int       k,
+                                                         rocblas_datatype  a_type,
+                                                         rocblas_int       lda,
+                                                         rocblas_datatype  b_type,
+                                                         rocblas_int       ldb,
+                                                         rocblas_datatype  c_type,
+                                                         rocblas_int       ldc,
+                                                         rocblas_datatype  d_type,
+                                                         rocblas_int       ldd,
+                                                         rocblas_datatype  compute_type,
+                                                         rocblas_gemm_algo algo,
+                                                         int32_t           solution_index,
+                                                         uint32_t          flags,
+                                                         size_t*           size)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // alpha and beta are read on the host by a size query; nonzero values select the
+    // general problem. The matrices are validated but not accessed.
+    rocblas_union_t one;
+    switch(compute_type)
+    {
+    case rocblas_datatype_f16_r:
+        one.h = 1;
+        break;
+    case rocblas_datatype_f32_r:
+        one.s = 1;
+        break;
+    case rocblas_datatype_f64_r:
+        one.d = 1;
+        break;
+    case rocblas_datatype_i32_r:
+        one.i = 1;
+        break;
+    case rocblas_datatype_f32_c:
+        one.c = {1, 0};
+        break;
+    case rocblas_datatype_f64_c:
+        one.z = {1, 0};
+        break;
+    default:
+        return rocblas_status_not_implemented;
+    }
+    rocblas_union_t dummy[4];
+
+    return handle->query_device_memory_size(size, [&] {
+        return rocblas_gemm_ex_impl(handle,
+                                    trans_a,
+                                    trans_b,
+                                    m,
+                                    n,
+                                    k,
+                                    &one,
+                                    &dummy[0],
+                                    a_type,
+                                    lda,
+                                    &dummy[1],
+                                    b_type,
+                                    ldb,
+                                    &one,
+                                    &dummy[2],
+                                    c_type,
+                                    ldc,
+                                    &dummy[3],
+                                    d_type,
+                                    ldd,
+                                    compute_type,
+                                    algo,
+                                    solution_index,
+                                    flags);
+    });
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 extern "C" rocblas_status rocblas_gemm_ex_get_solutions(rocblas_handle    handle,
                                                         rocblas_operation trans_a,
                                                         rocblas_operation trans_b,
@@ -29,11 +29,32 @@
 #include "gemm.hpp"
 #include "handle.hpp"
 #include "logging.hpp"
+#include "rocblas_stochastic_rounding.hpp"
 
 /////////////////
 // Device Side //
 /////////////////
 
+constexpr bool rocblas_is_f8_datatype(rocblas_datatype type)
+{
+    return type == rocblas_datatype_f8_r || type == rocblas_datatype_bf8_r;
+}
+
+// Value of an 8-bit float with WE exponent and WM mantissa bits, exponent bias 2^(WE-1),
+// no infinities, and 0x80 as its only NaN
+template <int WE, int WM>
+__device__ float rocblas_f8_to_float(uint8_t x)
+{
+    if(x == 0x80)
+        return __builtin_nanf("");
+
+    constexpr int bias = 1 << (WE - 1);
+    int           e    = (x >> WM) & ((1 << WE) - 1);
+    int           f    = x & ((1 << WM) - 1);
+    float v = e ? ldexpf(float(f | 1 << WM), e - bias - WM) : ldexpf(float(f), 1 - bias - WM);
+    return x & 0x80 ? -v : v;
+}
+
 template <typename T, typename U, typename V>
 ROCBLAS_KERNEL_ILF void gemm_ex_scale_device(
     rocblas_int m, rocblas_int n, T beta, U* C, rocblas_int ldc, V* D, rocblas_int ldd)
@@ -173,6 +194,70 @@ rocblas_status device_strided_batched_matrix_copy(rocblas_handle handle,
 ///////////////
 // Host Side //
 ///////////////
+/*! \brief gemm_ex with a unit or small m, n or k through rocblas_gemm_degenerate_solution, when
+    the types are those of gemv and ger and D is C. alpha and beta are on the host. Returns
+    rocblas_status_continue when gemm_ex runs the contraction. */
+template <typename Ti, typename To, typename Tc, typename TConstPtr, typename TPtr>
+rocblas_status gemm_ex_degenerate_template(rocblas_handle    handle,
+                                           rocblas_operation trans_a,
+                                           rocblas_operation trans_b,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           const Tc*         alpha,
+                                           const TConstPtr*  a,
+                                           rocblas_stride    offset_a,
+                                           rocblas_int       lda,
+                                           rocblas_stride    stride_a,
+                                           const TConstPtr*  b,
+                                           rocblas_stride    offset_b,
+                                           rocblas_int       ldb,
+                                           rocblas_stride    stride_b,
+                                           const Tc*         beta,
+                                           const void*       c,
+                                           rocblas_stride    offset_c,
+                                           rocblas_int       ldc,
+                                           rocblas_stride    stride_c,
+                                           TPtr*             d,
+                                           rocblas_stride    offset_d,
+                                           rocblas_int       ldd,
+                                           rocblas_stride    stride_d,
+                                           rocblas_int       batch_count,
+                                           rocblas_gemm_algo algo,
+                                           int32_t           solution_index)
+{
+    if constexpr(std::is_same<Ti, Tc>{} && std::is_same<To, Tc>{})
+    {
+        if(c == d && offset_c == offset_d && ldc == ldd && stride_c == stride_d
+           && !(algo == rocblas_gemm_algo_solution_index && solution_index > 0))
+        {
+            auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+            return rocblas_gemm_degenerate_solution(handle,
+                                                    trans_a,
+                                                    trans_b,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    alpha,
+                                                    a,
+                                                    offset_a,
+                                                    lda,
+                                                    stride_a,
+                                                    b,
+                                                    offset_b,
+                                                    ldb,
+                                                    stride_b,
+                                                    beta,
+                                                    d,
+                                                    offset_d,
+                                                    ldd,
+                                                    stride_d,
+                                                    batch_count);
+        }
+    }
+    return rocblas_status_continue;
+}
+
 template <typename Ti, typename To, typename Tc>
 rocblas_status gemm_ex_batched_template(rocblas_handle     handle,
                                         rocblas_operation  trans_a,
@@ -224,6 +309,36 @@ rocblas_status gemm_ex_batched_template(rocblas_handle     handle,
     }
 #endif
 
+    rocblas_status degenerate_status = gemm_ex_degenerate_template<Ti, To, Tc>(handle,
+                                                                               trans_a,
+                                                                               trans_b,
+                                                                               m,
+                                                                               n,
+                                                                               k,
+                                                                               alpha,
+                                                                               a,
+                                                                               offset_a,
+                                                                               lda,
+                                                                               stride_a,
+                                                                               b,
+                                                                               offset_b,
+                                                                               ldb,
+                                                                               stride_b,
+                                                                               beta,
+                                                                               c,
+                                                                               offset_c,
+                                                                               ldc,
+                                                                               stride_c,
+                                                                               d,
+                                                                               offset_d,
+                                                                               ldd,
+                                                                               stride_d,
+                                                                               batch_count,
+                                                                               algo,
+                                                                               solution_index);
+    if(degenerate_status != rocblas_status_continue)
+        return degenerate_status;
+
     RocblasContractionProblem<Ti, To, Tc> problem{
         handle,   trans_a, trans_b,  m,        n,           k,        alpha,    nullptr,
         a,        lda,     stride_a, offset_a, nullptr,     b,        ldb,      stride_b,
@@ -263,6 +378,36 @@ rocblas_status gemm_ex_batched_template(rocblas_handle     handle,
                                         int32_t            solution_index,
                                         rocblas_gemm_flags flags)
 {
+    rocblas_status degenerate_status = gemm_ex_degenerate_template<Ti, To, Tc>(handle,
+                                                                               trans_a,
+                                                                               trans_b,
+                                                                               m,
+                                                                               n,
+                                                                               k,
+                                                                               alpha,
+                                                                               a,
+                                                                               offset_a,
+                                                                               lda,
+                                                                               stride_a,
+                                                                               b,
+                                                                               offset_b,
+                                                                               ldb,
+                                                                               stride_b,
+                                                                               beta,
+                                                                               c,
+                                                                               offset_c,
+                                                                               ldc,
+                                                                               stride_c,
+                                                                               d,
+                                                                               offset_d,
+                                                                               ldd,
+                                                                               stride_d,
+                                                                               batch_count,
+                                                                               algo,
+                                                                               solution_index);
+    if(degenerate_status != rocblas_status_continue)
+        return degenerate_status;
+
     RocblasContractionProblem<Ti, To, Tc> problem{
         handle,   trans_a, trans_b,  m,        n,           k,        alpha,    a,
         nullptr,  lda,     stride_a, offset_a, b,           nullptr,  ldb,      stride_b,
@@ -272,6 +417,1174 @@ rocblas_status gemm_ex_batched_template(rocblas_handle     handle,
     return runContractionProblem(problem, algo, solution_index);
 }
 
+/*! \brief Number of chunks k is split into for rocblas_gemm_flags_split_k, 1 when not split.
+    The factor requested in flags is used when it is not 0. Otherwise, enough chunks are used for
+    about 256 output tiles of 128 x 128 to be in flight, with chunks of at least 256. */
+inline rocblas_int rocblas_gemm_ex_split_k_factor(
+    rocblas_int m, rocblas_int n, rocblas_int k, rocblas_int batch_count, uint32_t flags)
+{
+    if(!(flags & rocblas_gemm_flags_split_k) || m <= 0 || n <= 0 || k <= 0 || batch_count <= 0)
+        return 1;
+
+    int64_t factor = (flags & ROCBLAS_GEMM_FLAGS_SPLIT_K_FACTOR_MASK)
+                     >> ROCBLAS_GEMM_FLAGS_SPLIT_K_FACTOR_SHIFT;
+    if(!factor)
+    {
+        constexpr int64_t TILE = 128, TILES_IN_FLIGHT = 256, MIN_CHUNK = 256;
+        int64_t tiles = ((m - 1) / TILE + 1) * ((n - 1) / TILE + 1) * batch_count;
+        factor        = std::min(int64_t(k) / MIN_CHUNK, TILES_IN_FLIGHT / tiles);
+    }
+    return rocblas_int(std::max(int64_t(1), std::min(factor, int64_t(k))));
+}
+
+/*! \brief Workspace in bytes for the partial products of rocblas_gemm_flags_split_k */
+inline size_t rocblas_gemm_ex_split_k_workspace_size(rocblas_int      m,
+                                                     rocblas_int      n,
+                                                     rocblas_int      k,
+                                                     rocblas_int      batch_count,
+                                                     rocblas_datatype compute_type,
+                                                     uint32_t         flags)
+{
+    rocblas_int factor = rocblas_gemm_ex_split_k_factor(m, n, k, batch_count, flags);
+    return factor > 1 ? rocblas_sizeof_datatype(compute_type) * factor * m * n * batch_count : 0;
+}
+
+// D = alpha * (sum of the factor partial products in W) + beta * C
+template <int DIM_X, int DIM_Y, typename Tc, typename To>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+gemm_ex_split_k_reduce_kernel(rocblas_int    m,
+                              rocblas_int    n,
+                              rocblas_int    factor,
+                              Tc             alpha,
+                              const Tc*      W,
+                              Tc             beta,
+                              const To*      C,
+                              rocblas_int    ldc,
+                              rocblas_stride stride_c,
+                              To*            D,
+                              rocblas_int    ldd,
+                              rocblas_stride stride_d)
+{
+    rocblas_int tx = blockIdx.x * blockDim.x + threadIdx.x;
+    rocblas_int ty = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if(tx < m && ty < n)
+    {
+        size_t    mn  = size_t(m) * n;
+        const Tc* w   = W + blockIdx.z * mn * factor + ty * size_t(m) + tx;
+        Tc        sum = 0;
+        for(rocblas_int s = 0; s < factor; s++)
+            sum += w[s * mn];
+
+        Tc result = alpha * sum;
+        if(beta != Tc(0))
+            result += beta * Tc(C[blockIdx.z * stride_c + ty * size_t(ldc) + tx]);
+        D[blockIdx.z * stride_d + ty * size_t(ldd) + tx] = To(result);
+    }
+}
+
+/*! \brief gemm_ex and gemm_strided_batched_ex with k split into factor chunks. The partial
+    products of the chunks are computed in compute precision into workspace by strided batched
+    gemms, over the chunks or over the batches, and then summed with alpha and beta by one
+    kernel. Falls back to a single gemm when the workspace is not available. */
+template <typename Ti, typename To, typename Tc>
+rocblas_status gemm_ex_split_k_template(rocblas_handle     handle,
+                                        rocblas_operation  trans_a,
+                                        rocblas_operation  trans_b,
+                                        rocblas_int        m,
+                                        rocblas_int        n,
+                                        rocblas_int        k,
+                                        const Tc*          alpha,
+                                        const Ti*          a,
+                                        rocblas_stride     offset_a,
+                                        rocblas_int        lda,
+                                        rocblas_stride     stride_a,
+                                        const Ti*          b,
+                                        rocblas_stride     offset_b,
+                                        rocblas_int        ldb,
+                                        rocblas_stride     stride_b,
+                                        const Tc*          beta,
+                                        const To*          c,
+                                        rocblas_stride     offset_c,
+                                        rocblas_int        ldc,
+                                        rocblas_stride     stride_c,
+                                        To*                d,
+                                        rocblas_stride     offset_d,
+                                        rocblas_int        ldd,
+                                        rocblas_stride     stride_d,
+                                        rocblas_int        batch_count,
+                                        rocblas_gemm_algo  algo,
+                                        int32_t            solution_index,
+                                        rocblas_gemm_flags flags)
+{
+    // alpha and beta are on host here
+    rocblas_int factor
+        = *alpha == Tc(0) ? 1 : rocblas_gemm_ex_split_k_factor(m, n, k, batch_count, flags);
+
+    // the split is done here, Tensile solutions are selected as for any gemm
+    constexpr uint32_t split_k_flags
+        = rocblas_gemm_flags_split_k | ROCBLAS_GEMM_FLAGS_SPLIT_K_FACTOR_MASK;
+    flags = rocblas_gemm_flags(flags & ~split_k_flags);
+
+    rocblas_status perf_status = rocblas_status_success;
+    auto           w_mem       = handle->device_malloc(
+        factor > 1 ? sizeof(Tc) * size_t(factor) * m * n * batch_count : 0);
+    if(!w_mem)
+    {
+        perf_status = rocblas_status_perf_degraded;
+        factor      = 1;
+    }
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_gemm_ex_split_k", "factor", factor, "k", k / factor);
+
+    if(factor == 1)
+    {
+        RETURN_IF_ROCBLAS_ERROR(gemm_ex_batched_template(handle, trans_a, trans_b, m, n, k,
+            alpha, a, offset_a, lda, stride_a, b, offset_b, ldb, stride_b, beta,
+            c, offset_c, ldc, stride_c, d, offset_d, ldd, stride_d, batch_count,
+            algo, solution_index, flags));
+        return perf_status;
+    }
+
+    Tc*            w          = (Tc*)w_mem;
+    rocblas_int    k_chunk    = k / factor;
+    rocblas_int    k_rem      = k - k_chunk * factor;
+    rocblas_stride a_k_stride = trans_a == rocblas_operation_none ? lda : 1;
+    rocblas_stride b_k_stride = trans_b == rocblas_operation_none ? 1 : ldb;
+    rocblas_stride w_chunk    = rocblas_stride(m) * n;
+    rocblas_stride w_batch    = w_chunk * factor;
+
+    static const Tc one = Tc(1), zero = Tc(0);
+
+    // clang-format off
+    if(batch_count == 1)
+    {
+        // the chunks are the batches of one strided batched gemm
+        RETURN_IF_ROCBLAS_ERROR((gemm_ex_batched_template<Ti, Tc, Tc>(handle, trans_a, trans_b,
+            m, n, k_chunk, &one,
+            a, offset_a, lda, k_chunk * a_k_stride,
+            b, offset_b, ldb, k_chunk * b_k_stride, &zero,
+            w, 0,        m,   w_chunk,
+            w, 0,        m,   w_chunk, factor, algo, solution_index, flags)));
+    }
+    else
+    {
+        for(rocblas_int s = 0; s < factor; s++)
+            RETURN_IF_ROCBLAS_ERROR((gemm_ex_batched_template<Ti, Tc, Tc>(handle, trans_a, trans_b,
+                m, n, k_chunk, &one,
+                a, offset_a + s * k_chunk * a_k_stride, lda, stride_a,
+                b, offset_b + s * k_chunk * b_k_stride, ldb, stride_b, &zero,
+                w, s * w_chunk,                         m,   w_batch,
+                w, s * w_chunk,                         m,   w_batch, batch_count,
+                algo, solution_index, flags)));
+    }
+
+    // the remainder of k is accumulated into the first chunk
+    if(k_rem)
+        RETURN_IF_ROCBLAS_ERROR((gemm_ex_batched_template<Ti, Tc, Tc>(handle, trans_a, trans_b,
+            m, n, k_rem, &one,
+            a, offset_a + factor * k_chunk * a_k_stride, lda, stride_a,
+            b, offset_b + factor * k_chunk * b_k_stride, ldb, stride_b, &one,
+            w, 0,                                        m,   w_batch,
+            w, 0,                                        m,   w_batch, batch_count,
+            algo, solution_index, flags)));
+    // clang-format on
+
+    static constexpr int SPLIT_K_DIM_X = 64;
+    static constexpr int SPLIT_K_DIM_Y = 4;
+    dim3 grid((m - 1) / SPLIT_K_DIM_X + 1, (n - 1) / SPLIT_K_DIM_Y + 1, batch_count);
+    dim3 threads(SPLIT_K_DIM_X, SPLIT_K_DIM_Y);
+
+    hipLaunchKernelGGL((gemm_ex_split_k_reduce_kernel<SPLIT_K_DIM_X, SPLIT_K_DIM_Y>),
+                       grid,
+                       threads,
+                       0,
+                       handle->get_stream(),
+                       m,
+                       n,
+                       factor,
+                       *alpha,
+                       (const Tc*)w,
+                       *beta,
+                       c + offset_c,
+                       ldc,
+                       stride_c,
+                       d + offset_d,
+                       ldd,
+                       stride_d);
+
+    return perf_status;
+}
+
+/*! \brief True if rocblas_gemm_flags_complex_3m applies to the gemm_ex types */
+template <typename Ti, typename To, typename Tc>
+constexpr bool rocblas_gemm_ex_complex_3m_types
+    = rocblas_is_complex<Tc> && std::is_same<Ti, Tc>{} && std::is_same<To, Tc>{};
+
+/*! \brief Workspace in bytes for the planes and products of rocblas_gemm_flags_complex_3m, 0 when
+    the flag does not apply */
+inline size_t rocblas_gemm_ex_complex_3m_workspace_size(rocblas_int      m,
+                                                        rocblas_int      n,
+                                                        rocblas_int      k,
+                                                        rocblas_int      batch_count,
+                                                        rocblas_datatype a_type,
+                                                        rocblas_datatype compute_type,
+                                                        uint32_t         flags)
+{
+    if(!(flags & rocblas_gemm_flags_complex_3m) || m <= 0 || n <= 0 || k <= 0 || batch_count <= 0
+       || a_type != compute_type
+       || (compute_type != rocblas_datatype_f32_c && compute_type != rocblas_datatype_f64_c))
+        return 0;
+
+    // 3 real planes of op(A), op(B) and of their products per batch
+    size_t sizeof_real = rocblas_sizeof_datatype(compute_type) / 2;
+    return sizeof_real * 3 * (size_t(m) * k + size_t(k) * n + size_t(m) * n) * batch_count;
+}
+
+// Planes 3 * batch, 3 * batch + 1 and 3 * batch + 2 of W are the real parts, the imaginary parts
+// and their sums of the rows x cols matrix op(A), with op conjugating for conjugate transposes
+template <int DIM_X, int DIM_Y, typename T, typename U>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+gemm_ex_complex_3m_split_kernel(rocblas_int       rows,
+                                rocblas_int       cols,
+                                rocblas_operation trans,
+                                const T*          A,
+                                rocblas_int       lda,
+                                rocblas_stride    stride_a,
+                                U*                W)
+{
+    rocblas_int tx = blockIdx.x * blockDim.x + threadIdx.x;
+    rocblas_int ty = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if(tx < rows && ty < cols)
+    {
+        const T* a   = A + blockIdx.z * stride_a;
+        T        val = trans == rocblas_operation_none ? a[tx + ty * size_t(lda)]
+                                                       : a[ty + tx * size_t(lda)];
+        if(trans == rocblas_operation_conjugate_transpose)
+            val = std::conj(val);
+
+        size_t plane = size_t(rows) * cols;
+        U*     w     = W + 3 * blockIdx.z * plane + ty * size_t(rows) + tx;
+        w[0]         = val.real();
+        w[plane]     = val.imag();
+        w[2 * plane] = val.real() + val.imag();
+    }
+}
+
+// D = alpha * (T1 - T2 + i (T3 - T1 - T2)) + beta * C, with T1, T2 and T3 the products of the
+// real parts, of the imaginary parts and of the sums, consecutive m x n planes of W per batch
+template <int DIM_X, int DIM_Y, typename T, typename U>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+gemm_ex_complex_3m_combine_kernel(rocblas_int    m,
+                                  rocblas_int    n,
+                                  T              alpha,
+                                  const U*       W,
+                                  T              beta,
+                                  const T*       C,
+                                  rocblas_int    ldc,
+                                  rocblas_stride stride_c,
+                                  T*             D,
+                                  rocblas_int    ldd,
+                                  rocblas_stride stride_d)
+{
+    rocblas_int tx = blockIdx.x * blockDim.x + threadIdx.x;
+    rocblas_int ty = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if(tx < m && ty < n)
+    {
+        size_t   mn = size_t(m) * n;
+        const U* w  = W + 3 * blockIdx.z * mn + ty * size_t(m) + tx;
+        U        t1 = w[0], t2 = w[mn], t3 = w[2 * mn];
+
+        T result = alpha * T(t1 - t2, t3 - t1 - t2);
+        if(beta != T(0))
+            result += beta * C[blockIdx.z * stride_c + ty * size_t(ldc) + tx];
+        D[blockIdx.z * stride_d + ty * size_t(ldd) + tx] = result;
+    }
+}
+
+/*! \brief gemm_ex and gemm_strided_batched_ex with rocblas_gemm_flags_complex_3m, for the types
+    it does not apply to */
+template <typename Ti,
+          typename To,
+          typename Tc,
+          std::enable_if_t<!rocblas_gemm_ex_complex_3m_types<Ti, To, Tc>, int> = 0>
+rocblas_status gemm_ex_complex_3m_template(rocblas_handle     handle,
+                                           rocblas_operation  trans_a,
+                                           rocblas_operation  trans_b,
+                                           rocblas_int        m,
+                                           rocblas_int        n,
+                                           rocblas_int        k,
+                                           const Tc*          alpha,
+                                           const Ti*          a,
+                                           rocblas_stride     offset_a,
+                                           rocblas_int        lda,
+                                           rocblas_stride     stride_a,
+                                           const Ti*          b,
+                                           rocblas_stride     offset_b,
+                                           rocblas_int        ldb,
+                                           rocblas_stride     stride_b,
+                                           const Tc*          beta,
+                                           const To*          c,
+                                           rocblas_stride     offset_c,
+                                           rocblas_int        ldc,
+                                           rocblas_stride     stride_c,
+                                           To*                d,
+                                           rocblas_stride     offset_d,
+                                           rocblas_int        ldd,
+                                           rocblas_stride     stride_d,
+                                           rocblas_int        batch_count,
+                                           rocblas_gemm_algo  algo,
+                                           int32_t            solution_index,
+                                           rocblas_gemm_flags flags)
+{
+    // clang-format off
+    return gemm_ex_split_k_template(handle, trans_a, trans_b, m, n, k, alpha,
+                                    a, offset_a, lda, stride_a,
+                                    b, offset_b, ldb, stride_b, beta,
+                                    c, offset_c, ldc, stride_c,
+                                    d, offset_d, ldd, stride_d,
+                                    batch_count, algo, solution_index, flags);
+    // clang-format on
+}
+
+/*! \brief Complex gemm_ex and gemm_strided_batched_ex as three real gemms (3M method). The real
+    parts, the imaginary parts and their sums of op(A) and op(B) are split into planes in
+    workspace, their three products are computed by one strided batched real gemm over the planes
+    and the batches, and combined with alpha and beta by one kernel. Falls back to
+    gemm_ex_split_k_template when the workspace is not available. */
+template <typename Ti,
+          typename To,
+          typename Tc,
+          std::enable_if_t<rocblas_gemm_ex_complex_3m_types<Ti, To, Tc>, int> = 0>
+rocblas_status gemm_ex_complex_3m_template(rocblas_handle     handle,
+                                           rocblas_operation  trans_a,
+                                           rocblas_operation  trans_b,
+                                           rocblas_int        m,
+                                           rocblas_int        n,
+                                           rocblas_int        k,
+                                           const Tc*          alpha,
+                                           const Ti*          a,
+                                           rocblas_stride     offset_a,
+                                           rocblas_int        lda,
+                                           rocblas_stride     stride_a,
+                                           const Ti*          b,
+                                           rocblas_stride     offset_b,
+                                           rocblas_int        ldb,
+                                           rocblas_stride     stride_b,
+                                           const Tc*          beta,
+                                           const To*          c,
+                                           rocblas_stride     offset_c,
+                                           rocblas_int        ldc,
+                                           rocblas_stride     stride_c,
+                                           To*                d,
+                                           rocblas_stride     offset_d,
+                                           rocblas_int        ldd,
+                                           rocblas_stride     stride_d,
+                                           rocblas_int        batch_count,
+                                           rocblas_gemm_algo  algo,
+                                           int32_t            solution_index,
+                                           rocblas_gemm_flags flags)
+{
+    using U = real_t<Tc>;
+
+    // alpha and beta are on host here
+    size_t         plane_a     = size_t(m) * k;
+    size_t         plane_b     = size_t(k) * n;
+    size_t         plane_c     = size_t(m) * n;
+    rocblas_status perf_status = rocblas_status_success;
+    auto           w_mem       = handle->device_malloc(
+        *alpha == Tc(0) ? 0 : sizeof(U) * 3 * (plane_a + plane_b + plane_c) * batch_count);
+    if(!w_mem)
+        perf_status = rocblas_status_perf_degraded;
+
+    if(!w_mem || *alpha == Tc(0))
+    {
+        flags = rocblas_gemm_flags(flags & ~rocblas_gemm_flags_complex_3m);
+
+        // clang-format off
+        rocblas_status status = gemm_ex_split_k_template(handle, trans_a, trans_b, m, n, k, alpha,
+                                                         a, offset_a, lda, stride_a,
+                                                         b, offset_b, ldb, stride_b, beta,
+                                                         c, offset_c, ldc, stride_c,
+                                                         d, offset_d, ldd, stride_d,
+                                                         batch_count, algo, solution_index, flags);
+        // clang-format on
+        return status == rocblas_status_success ? perf_status : status;
+    }
+
+    // the real gemms use the default solution, which is not the one of the complex gemm, and
+    // keep the single precision accuracy of the complex gemm
+    constexpr uint32_t complex_3m_flags = rocblas_gemm_flags_complex_3m | rocblas_gemm_flags_split_k
+                                          | ROCBLAS_GEMM_FLAGS_SPLIT_K_FACTOR_MASK
+                                          | rocblas_gemm_flags_check_solution_index
+                                          | rocblas_gemm_flags_xf32;
+    flags = rocblas_gemm_flags(flags & ~complex_3m_flags);
+
+    U* wa = (U*)w_mem;
+    U* wb = wa + 3 * plane_a * batch_count;
+    U* wt = wb + 3 * plane_b * batch_count;
+
+    static constexpr int COMPLEX_3M_DIM_X = 64;
+    static constexpr int COMPLEX_3M_DIM_Y = 4;
+    dim3                 threads(COMPLEX_3M_DIM_X, COMPLEX_3M_DIM_Y);
+    dim3 grid_a((m - 1) / COMPLEX_3M_DIM_X + 1, (k - 1) / COMPLEX_3M_DIM_Y + 1, batch_count);
+    dim3 grid_b((k - 1) / COMPLEX_3M_DIM_X + 1, (n - 1) / COMPLEX_3M_DIM_Y + 1, batch_count);
+    dim3 grid_c((m - 1) / COMPLEX_3M_DIM_X + 1, (n - 1) / COMPLEX_3M_DIM_Y + 1, batch_count);
+
+    hipLaunchKernelGGL((gemm_ex_complex_3m_split_kernel<COMPLEX_3M_DIM_X, COMPLEX_3M_DIM_Y>),
+                       grid_a,
+                       threads,
+                       0,
+                       handle->get_stream(),
+                       m,
+                       k,
+                       trans_a,
+                       a + offset_a,
+                       lda,
+                       stride_a,
+                       wa);
+
+    hipLaunchKernelGGL((gemm_ex_complex_3m_split_kernel<COMPLEX_3M_DIM_X, COMPLEX_3M_DIM_Y>),
+                       grid_b,
+                       threads,
+                       0,
+                       handle->get_stream(),
+                       k,
+                       n,
+                       trans_b,
+                       b + offset_b,
+                       ldb,
+                       stride_b,
+                       wb);
+
+    static const U one = U(1), zero = U(0);
+
+    // clang-format off
+    RETURN_IF_ROCBLAS_ERROR((gemm_ex_batched_template<U, U, U>(handle,
+        rocblas_operation_none, rocblas_operation_none, m, n, k, &one,
+        wa, 0, m, plane_a,
+        wb, 0, k, plane_b, &zero,
+        wt, 0, m, plane_c,
+        wt, 0, m, plane_c, 3 * batch_count, algo, 0, flags)));
+    // clang-format on
+
+    hipLaunchKernelGGL((gemm_ex_complex_3m_combine_kernel<COMPLEX_3M_DIM_X, COMPLEX_3M_DIM_Y>),
+                       grid_c,
+                       threads,
+                       0,
+                       handle->get_stream(),
+                       m,
+                       n,
+                       *alpha,
+                       (const U*)wt,
+                       *beta,
+                       c + offset_c,
+                       ldc,
+                       stride_c,
+                       d + offset_d,
+                       ldd,
+                       stride_d);
+
+    return perf_status;
+}
+
+/*! \brief True if rocblas_gemm_flags_fp64_emulation applies to the gemm_ex types */
+template <typename Ti, typename To, typename Tc>
+constexpr bool rocblas_gemm_ex_fp64_emulation_types
+    = std::is_same<Ti, double>{} && std::is_same<To, double>{} && std::is_same<Tc, double>{};
+
+/*! \brief Number of int8 slices of rocblas_gemm_flags_fp64_emulation */
+inline rocblas_int rocblas_gemm_ex_fp64_emulation_slices(uint32_t flags)
+{
+    constexpr rocblas_int FP64_EMULATION_SLICES = 8;
+
+    rocblas_int slices = (flags & ROCBLAS_GEMM_FLAGS_FP64_EMULATION_SLICES_MASK)
+                         >> ROCBLAS_GEMM_FLAGS_FP64_EMULATION_SLICES_SHIFT;
+    return slices ? slices : FP64_EMULATION_SLICES;
+}
+
+/*! \brief Workspace in bytes of rocblas_gemm_flags_fp64_emulation, 0 when the flag does not
+    apply: the double accumulator and int32 products of each slice of op(A), the exponents of the
+    rows of op(A) and of the columns of op(B), and their int8 slices */
+inline size_t rocblas_gemm_ex_fp64_emulation_workspace_size(rocblas_int      m,
+                                                            rocblas_int      n,
+                                                            rocblas_int      k,
+                                                            rocblas_int      batch_count,
+                                                            rocblas_datatype a_type,
+                                                            rocblas_datatype compute_type,
+                                                            uint32_t         flags)
+{
+    if(!(flags & rocblas_gemm_flags_fp64_emulation) || m <= 0 || n <= 0 || k <= 0
+       || batch_count <= 0 || a_type != rocblas_datatype_f64_r
+       || compute_type != rocblas_datatype_f64_r)
+        return 0;
+
+    size_t slices = rocblas_gemm_ex_fp64_emulation_slices(flags);
+    size_t mn     = size_t(m) * n;
+    return (sizeof(double) * mn + sizeof(int32_t) * (slices * mn + m + n)
+            + slices * k * (size_t(m) + n))
+           * batch_count;
+}
+
+// E[row] is the exponent of the largest element of the row of the rows x k matrix X, with
+// X(row, l) = x[l + row * ldx] if contiguous and x[row + l * ldx] otherwise, so that
+// |X(row, l)| < 2^E[row]
+template <int NB>
+ROCBLAS_KERNEL(NB)
+gemm_ex_fp64_emulation_exponent_kernel(rocblas_int    rows,
+                                       rocblas_int    k,
+                                       bool           contiguous,
+                                       const double*  X,
+                                       rocblas_int    ldx,
+                                       rocblas_stride stride_x,
+                                       rocblas_int*   E)
+{
+    __shared__ double smax[NB];
+
+    const rocblas_int row = blockIdx.x;
+    const double* x   = X + blockIdx.z * stride_x + (contiguous ? row * size_t(ldx) : row);
+    const size_t  inc = contiguous ? 1 : ldx;
+
+    double amax = 0;
+    for(rocblas_int l = threadIdx.x; l < k; l += NB)
+        amax = max(amax, fabs(x[l * inc]));
+    smax[threadIdx.x] = amax;
+    __syncthreads();
+
+    for(int s = NB / 2; s > 0; s /= 2)
+    {
+        if(threadIdx.x < s)
+            smax[threadIdx.x] = max(smax[threadIdx.x], smax[threadIdx.x + s]);
+        __syncthreads();
+    }
+
+    if(threadIdx.x == 0)
+    {
+        int exponent = 0;
+        frexp(smax[0], &exponent);
+        E[blockIdx.z * size_t(rows) + row] = exponent;
+    }
+}
+
+// Planes p < slices of S are the int8 slices of the rows x k matrix X, indexed as in
+// gemm_ex_fp64_emulation_exponent_kernel, stored k x rows: X(row, l) is
+// 2^E[row] * (sum over p of S[p](l, row) * 2^(-7 * (p + 1))) up to the last slice
+template <int DIM_X, int DIM_Y>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+gemm_ex_fp64_emulation_slice_kernel(rocblas_int        rows,
+                                    rocblas_int        k,
+                                    rocblas_int        slices,
+                                    bool               contiguous,
+                                    const double*      X,
+                                    rocblas_int        ldx,
+                                    rocblas_stride     stride_x,
+                                    const rocblas_int* E,
+                                    int8_t*            S)
+{
+    rocblas_int l   = blockIdx.x * blockDim.x + threadIdx.x;
+    rocblas_int row = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if(l < k && row < rows)
+    {
+        const double* x   = X + blockIdx.z * stride_x;
+        double        val = contiguous ? x[l + row * size_t(ldx)] : x[row + l * size_t(ldx)];
+
+        // |r| < 1, and each slice is the next 7 bits of r, scaled and truncated exactly
+        double  r     = ldexp(val, -E[blockIdx.z * size_t(rows) + row]);
+        size_t  plane = size_t(k) * rows;
+        int8_t* s     = S + blockIdx.z * plane * slices + row * size_t(k) + l;
+        for(rocblas_int p = 0; p < slices; p++)
+        {
+            double t = r * 128.0;
+            double q = trunc(t);
+            s[p * plane] = int8_t(q);
+            r            = t - q;
+        }
+    }
+}
+
+// Exponents and int8 slices of the rows x k matrix X, indexed as in
+// gemm_ex_fp64_emulation_exponent_kernel
+inline void gemm_ex_fp64_emulation_split(rocblas_handle handle,
+                                         rocblas_int    rows,
+                                         rocblas_int    k,
+                                         rocblas_int    slices,
+                                         bool           contiguous,
+                                         const double*  x,
+                                         rocblas_int    ldx,
+                                         rocblas_stride stride_x,
+                                         rocblas_int    batch_count,
+                                         rocblas_int*   e,
+                                         int8_t*        s)
+{
+    static constexpr int EXPONENT_NB = 256;
+    hipLaunchKernelGGL((gemm_ex_fp64_emulation_exponent_kernel<EXPONENT_NB>),
+                       dim3(rows, 1, batch_count),
+                       dim3(EXPONENT_NB),
+                       0,
+                       handle->get_stream(),
+                       rows,
+                       k,
+                       contiguous,
+                       x,
+                       ldx,
+                       stride_x,
+                       e);
+
+    static constexpr int SLICE_DIM_X = 64;
+    static constexpr int SLICE_DIM_Y = 4;
+    dim3 grid((k - 1) / SLICE_DIM_X + 1, (rows - 1) / SLICE_DIM_Y + 1, batch_count);
+    hipLaunchKernelGGL((gemm_ex_fp64_emulation_slice_kernel<SLICE_DIM_X, SLICE_DIM_Y>),
+                       grid,
+                       dim3(SLICE_DIM_X, SLICE_DIM_Y),
+                       0,
+                       handle->get_stream(),
+                       rows,
+                       k,
+                       slices,
+                       contiguous,
+                       x,
+                       ldx,
+                       stride_x,
+                       (const rocblas_int*)e,
+                       s);
+}
+
+// Adds the products W of slice p of op(A) with the slices q < slices - p of op(B), m x n side by
+// side, to the accumulator, and on the last call writes D = alpha * 2^(E + F) acc + beta * C
+template <int DIM_X, int DIM_Y>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+gemm_ex_fp64_emulation_accumulate_kernel(rocblas_int        m,
+                                         rocblas_int        n,
+                                         rocblas_int        slices,
+                                         rocblas_int        p,
+                                         bool               first,
+                                         bool               last,
+                                         const int32_t*     W,
+                                         double*            acc,
+                                         const rocblas_int* E,
+                                         const rocblas_int* F,
+                                         double             alpha,
+                                         double             beta,
+                                         const double*      C,
+                                         rocblas_int        ldc,
+                                         rocblas_stride     stride_c,
+                                         double*            D,
+                                         rocblas_int        ldd,
+                                         rocblas_stride     stride_d)
+{
+    rocblas_int tx = blockIdx.x * blockDim.x + threadIdx.x;
+    rocblas_int ty = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if(tx < m && ty < n)
+    {
+        size_t         mn = size_t(m) * n;
+        const int32_t* w  = W + blockIdx.z * mn * slices + ty * size_t(m) + tx;
+        double*        a  = acc + blockIdx.z * mn + ty * size_t(m) + tx;
+
+        // smallest terms first
+        double sum = first ? 0 : *a;
+        for(rocblas_int q = slices - 1 - p; q >= 0; q--)
+            sum += ldexp(double(w[q * mn]), -7 * (p + q + 2));
+
+        if(!last)
+        {
+            *a = sum;
+            return;
+        }
+
+        double result
+            = alpha * ldexp(sum, E[blockIdx.z * size_t(m) + tx] + F[blockIdx.z * size_t(n) + ty]);
+        if(beta != 0)
+            result += beta * C[blockIdx.z * stride_c + ty * size_t(ldc) + tx];
+        D[blockIdx.z * stride_d + ty * size_t(ldd) + tx] = result;
+    }
+}
+
+/*! \brief gemm_ex and gemm_strided_batched_ex with rocblas_gemm_flags_fp64_emulation, for the
+    types it does not apply to */
+template <typename Ti,
+          typename To,
+          typename Tc,
+          std::enable_if_t<!rocblas_gemm_ex_fp64_emulation_types<Ti, To, Tc>, int> = 0>
+rocblas_status gemm_ex_fp64_emulation_template(rocblas_handle     handle,
+                                               rocblas_operation  trans_a,
+                                               rocblas_operation  trans_b,
+                                               rocblas_int        m,
+                                               rocblas_int        n,
+                                               rocblas_int        k,
+                                               const Tc*          alpha,
+                                               const Ti*          a,
+                                               rocblas_stride     offset_a,
+                                               rocblas_int        lda,
+                                               rocblas_stride     stride_a,
+                                               const Ti*          b,
+                                               rocblas_stride     offset_b,
+                                               rocblas_int        ldb,
+                                               rocblas_stride     stride_b,
+                                               const Tc*          beta,
+                                               const To*          c,
+                                               rocblas_stride     offset_c,
+                                               rocblas_int        ldc,
+                                               rocblas_stride     stride_c,
+                                               To*                d,
+                                               rocblas_stride     offset_d,
+                                               rocblas_int        ldd,
+                                               rocblas_stride     stride_d,
+                                               rocblas_int        batch_count,
+                                               rocblas_gemm_algo  algo,
+                                               int32_t            solution_index,
+                                               rocblas_gemm_flags flags)
+{
+    // clang-format off
+    return gemm_ex_split_k_template(handle, trans_a, trans_b, m, n, k, alpha,
+                                    a, offset_a, lda, stride_a,
+                                    b, offset_b, ldb, stride_b, beta,
+                                    c, offset_c, ldc, stride_c,
+                                    d, offset_d, ldd, stride_d,
+                                    batch_count, algo, solution_index, flags);
+    // clang-format on
+}
+
+/*! \brief Double precision gemm_ex and gemm_strided_batched_ex emulated with int8 gemms (Ozaki
+    scheme). The rows of op(A) and the columns of op(B) are scaled by the power of two of their
+    largest element and split into int8 slices of 7 bits in workspace. For each slice p of op(A),
+    one strided batched int8 gemm computes its exact int32 products with the slices q of op(B)
+    such that p + q < slices, side by side, over chunks of k short enough for int32 not to
+    overflow, and one kernel adds them to a double accumulator, the last one applying alpha and
+    beta. Falls back to gemm_ex_split_k_template when the workspace is not available. */
+template <typename Ti,
+          typename To,
+          typename Tc,
+          std::enable_if_t<rocblas_gemm_ex_fp64_emulation_types<Ti, To, Tc>, int> = 0>
+rocblas_status gemm_ex_fp64_emulation_template(rocblas_handle     handle,
+                                               rocblas_operation  trans_a,
+                                               rocblas_operation  trans_b,
+                                               rocblas_int        m,
+                                               rocblas_int        n,
+                                               rocblas_int        k,
+                                               const Tc*          alpha,
+                                               const Ti*          a,
+                                               rocblas_stride     offset_a,
+                                               rocblas_int        lda,
+                                               rocblas_stride     stride_a,
+                                               const Ti*          b,
+                                               rocblas_stride     offset_b,
+                                               rocblas_int        ldb,
+                                               rocblas_stride     stride_b,
+                                               const Tc*          beta,
+                                               const To*          c,
+                                               rocblas_stride     offset_c,
+                                               rocblas_int        ldc,
+                                               rocblas_stride     stride_c,
+                                               To*                d,
+                                               rocblas_stride     offset_d,
+                                               rocblas_int        ldd,
+                                               rocblas_stride     stride_d,
+                                               rocblas_int        batch_count,
+                                               rocblas_gemm_algo  algo,
+                                               int32_t            solution_index,
+                                               rocblas_gemm_flags flags)
+{
+    // alpha and beta are on host here
+    rocblas_int    slices      = rocblas_gemm_ex_fp64_emulation_slices(flags);
+    rocblas_status perf_status = rocblas_status_success;
+    size_t         dev_bytes   = rocblas_gemm_ex_fp64_emulation_workspace_size(
+        m, n, k, batch_count, rocblas_datatype_f64_r, rocblas_datatype_f64_r, flags);
+
+    auto w_mem = handle->device_malloc(*alpha == 0 ? 0 : dev_bytes);
+    if(!w_mem)
+        perf_status = rocblas_status_perf_degraded;
+
+    if(!w_mem || *alpha == 0 || !dev_bytes)
+    {
+        flags = rocblas_gemm_flags(flags & ~rocblas_gemm_flags_fp64_emulation);
+
+        // clang-format off
+        rocblas_status status = gemm_ex_split_k_template(handle, trans_a, trans_b, m, n, k, alpha,
+                                                         a, offset_a, lda, stride_a,
+                                                         b, offset_b, ldb, stride_b, beta,
+                                                         c, offset_c, ldc, stride_c,
+                                                         d, offset_d, ldd, stride_d,
+                                                         batch_count, algo, solution_index, flags);
+        // clang-format on
+        return status == rocblas_status_success ? perf_status : status;
+    }
+
+    // the int8 gemms are unpacked and use the default solution
+    flags = rocblas_gemm_flags(flags & rocblas_gemm_flags_use_cu_efficiency);
+
+    size_t       mn  = size_t(m) * n;
+    double*      acc = (double*)w_mem;
+    int32_t*     w   = (int32_t*)(acc + mn * batch_count);
+    rocblas_int* e   = (rocblas_int*)(w + mn * slices * batch_count);
+    rocblas_int* f   = e + size_t(m) * batch_count;
+    int8_t*      s_a = (int8_t*)(f + size_t(n) * batch_count);
+    int8_t*      s_b = s_a + size_t(k) * m * slices * batch_count;
+
+    // op(A)(i, l) is contiguous in l when transposed, op(B)(l, j) when not
+    // clang-format off
+    gemm_ex_fp64_emulation_split(handle, m, k, slices, trans_a != rocblas_operation_none,
+                                 a + offset_a, lda, stride_a, batch_count, e, s_a);
+    gemm_ex_fp64_emulation_split(handle, n, k, slices, trans_b == rocblas_operation_none,
+                                 b + offset_b, ldb, stride_b, batch_count, f, s_b);
+    // clang-format on
+
+    // k * 127 * 127 must fit in int32
+    static constexpr rocblas_int K_CHUNK = 131072;
+    static const int32_t         one = 1, zero = 0;
+
+    static constexpr int ACC_DIM_X = 64;
+    static constexpr int ACC_DIM_Y = 4;
+    dim3 grid((m - 1) / ACC_DIM_X + 1, (n - 1) / ACC_DIM_Y + 1, batch_count);
+    dim3 threads(ACC_DIM_X, ACC_DIM_Y);
+
+    for(rocblas_int l = 0; l < k; l += K_CHUNK)
+    {
+        rocblas_int k_chunk = std::min(K_CHUNK, k - l);
+
+        // smallest products first
+        for(rocblas_int p = slices - 1; p >= 0; p--)
+        {
+            // clang-format off
+            RETURN_IF_ROCBLAS_ERROR((gemm_ex_batched_template<int8_t, int32_t, int32_t>(handle,
+                rocblas_operation_transpose, rocblas_operation_none,
+                m, n * (slices - p), k_chunk, &one,
+                s_a, p * size_t(k) * m + l, k, size_t(k) * m * slices,
+                s_b, l,                     k, size_t(k) * n * slices, &zero,
+                w,   0,                     m, mn * slices,
+                w,   0,                     m, mn * slices, batch_count, algo, 0, flags)));
+            // clang-format on
+
+            hipLaunchKernelGGL((gemm_ex_fp64_emulation_accumulate_kernel<ACC_DIM_X, ACC_DIM_Y>),
+                               grid,
+                               threads,
+                               0,
+                               handle->get_stream(),
+                               m,
+                               n,
+                               slices,
+                               p,
+                               l == 0 && p == slices - 1,
+                               l + k_chunk == k && p == 0,
+                               (const int32_t*)w,
+                               acc,
+                               (const rocblas_int*)e,
+                               (const rocblas_int*)f,
+                               *alpha,
+                               *beta,
+                               c + offset_c,
+                               ldc,
+                               stride_c,
+                               d + offset_d,
+                               ldd,
+                               stride_d);
+        }
+    }
+
+    return perf_status;
+}
+
+/*! \brief True if gemm_ex multiplies a real A by complex B, C and D, a real a_type with the
+    complex compute_type of the same precision */
+constexpr bool rocblas_gemm_ex_real_complex_types(rocblas_datatype a_type,
+                                                  rocblas_datatype compute_type)
+{
+    return (a_type == rocblas_datatype_f32_r && compute_type == rocblas_datatype_f32_c)
+           || (a_type == rocblas_datatype_f64_r && compute_type == rocblas_datatype_f64_c);
+}
+
+/*! \brief Workspace in bytes for the real and imaginary planes of B and of the product of a real
+    A by a complex B, 0 for other types */
+inline size_t rocblas_gemm_ex_real_complex_workspace_size(rocblas_int      m,
+                                                          rocblas_int      n,
+                                                          rocblas_int      k,
+                                                          rocblas_int      batch_count,
+                                                          rocblas_datatype a_type,
+                                                          rocblas_datatype compute_type)
+{
+    if(!rocblas_gemm_ex_real_complex_types(a_type, compute_type) || m <= 0 || n <= 0 || k <= 0
+       || batch_count <= 0)
+        return 0;
+
+    return rocblas_sizeof_datatype(a_type) * 2 * (size_t(k) * n + size_t(m) * n) * batch_count;
+}
+
+// Element (i, j) of the rows x cols matrix B is split into W[i + j * ldw] for its real part and
+// W[i + j * ldw + offset_imag] for its imaginary part, conjugated for a conjugate transpose
+template <int DIM_X, int DIM_Y, typename T, typename U>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+gemm_ex_real_complex_split_kernel(rocblas_int    rows,
+                                  rocblas_int    cols,
+                                  bool           conj,
+                                  const T*       B,
+                                  rocblas_int    ldb,
+                                  rocblas_stride stride_b,
+                                  rocblas_int    ldw,
+                                  size_t         offset_imag,
+                                  size_t         plane,
+                                  U*             W)
+{
+    rocblas_int tx = blockIdx.x * blockDim.x + threadIdx.x;
+    rocblas_int ty = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if(tx < rows && ty < cols)
+    {
+        T  val         = B[blockIdx.z * stride_b + ty * size_t(ldb) + tx];
+        U* w           = W + blockIdx.z * plane + ty * size_t(ldw) + tx;
+        w[0]           = val.real();
+        w[offset_imag] = conj ? -val.imag() : val.imag();
+    }
+}
+
+// D = alpha * (P_re + i P_im) + beta * C, with P_re and P_im the first and last n columns of the
+// m x 2n real product in W
+template <int DIM_X, int DIM_Y, typename T, typename U>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+gemm_ex_real_complex_combine_kernel(rocblas_int    m,
+                                    rocblas_int    n,
+                                    T              alpha,
+                                    const U*       W,
+                                    T              beta,
+                                    const T*       C,
+                                    rocblas_int    ldc,
+                                    rocblas_stride stride_c,
+                                    T*             D,
+                                    rocblas_int    ldd,
+                                    rocblas_stride stride_d)
+{
+    rocblas_int tx = blockIdx.x * blockDim.x + threadIdx.x;
+    rocblas_int ty = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if(tx < m && ty < n)
+    {
+        size_t   mn = size_t(m) * n;
+        const U* w  = W + 2 * blockIdx.z * mn + ty * size_t(m) + tx;
+
+        T result = alpha * T(w[0], w[mn]);
+        if(beta != T(0))
+            result += beta * C[blockIdx.z * stride_c + ty * size_t(ldc) + tx];
+        D[blockIdx.z * stride_d + ty * size_t(ldd) + tx] = result;
+    }
+}
+
+/*! \brief gemm_ex and gemm_strided_batched_ex of a real A by a complex B, C and D, without
+    promoting A to complex. The real and imaginary parts of B are split into the left and right
+    halves of a k x 2n real matrix in workspace, one real gemm of A by it gives the real and
+    imaginary parts of the product with half the work of the complex gemm of the promoted A, and
+    one kernel combines them with alpha and beta into D. */
+template <typename T>
+rocblas_status gemm_ex_real_complex_template(rocblas_handle                handle,
+                                             rocblas_operation             trans_a,
+                                             rocblas_operation             trans_b,
+                                             rocblas_int                   m,
+                                             rocblas_int                   n,
+                                             rocblas_int                   k,
+                                             const rocblas_complex_num<T>* alpha,
+                                             const T*                      a,
+                                             rocblas_stride                offset_a,
+                                             rocblas_int                   lda,
+                                             rocblas_stride                stride_a,
+                                             const rocblas_complex_num<T>* b,
+                                             rocblas_stride                offset_b,
+                                             rocblas_int                   ldb,
+                                             rocblas_stride                stride_b,
+                                             const rocblas_complex_num<T>* beta,
+                                             const rocblas_complex_num<T>* c,
+                                             rocblas_stride                offset_c,
+                                             rocblas_int                   ldc,
+                                             rocblas_stride                stride_c,
+                                             rocblas_complex_num<T>*       d,
+                                             rocblas_stride                offset_d,
+                                             rocblas_int                   ldd,
+                                             rocblas_stride                stride_d,
+                                             rocblas_int                   batch_count,
+                                             rocblas_gemm_algo             algo,
+                                             rocblas_gemm_flags            flags)
+{
+    using Tc = rocblas_complex_num<T>;
+
+    // alpha and beta are on host here
+    if(!k || *alpha == Tc(0))
+        return rocblas_gemm_ex_scale_template(handle,
+                                              m,
+                                              n,
+                                              *beta,
+                                              c,
+                                              offset_c,
+                                              ldc,
+                                              stride_c,
+                                              d,
+                                              offset_d,
+                                              ldd,
+                                              stride_d,
+                                              batch_count);
+
+    size_t plane_b = 2 * size_t(k) * n;
+    size_t plane_p = 2 * size_t(m) * n;
+    auto   w_mem   = handle->device_malloc(sizeof(T) * (plane_b + plane_p) * batch_count);
+    if(!w_mem)
+        return rocblas_status_memory_error;
+
+    T* wb = (T*)w_mem;
+    T* wp = wb + plane_b * batch_count;
+
+    // op(B) is the product of the real matrix [B_re B_im], k x 2n, or its transpose [B_re; B_im],
+    // 2n x k, the imaginary parts negated for a conjugate transpose
+    bool        trans = trans_b != rocblas_operation_none;
+    rocblas_int rows  = trans ? n : k;
+    rocblas_int cols  = trans ? k : n;
+    rocblas_int ldw   = trans ? 2 * n : k;
+
+    static constexpr int REAL_COMPLEX_DIM_X = 64;
+    static constexpr int REAL_COMPLEX_DIM_Y = 4;
+    dim3                 threads(REAL_COMPLEX_DIM_X, REAL_COMPLEX_DIM_Y);
+    dim3                 grid_b(
+        (rows - 1) / REAL_COMPLEX_DIM_X + 1, (cols - 1) / REAL_COMPLEX_DIM_Y + 1, batch_count);
+    dim3 grid_c((m - 1) / REAL_COMPLEX_DIM_X + 1, (n - 1) / REAL_COMPLEX_DIM_Y + 1, batch_count);
+
+    hipLaunchKernelGGL((gemm_ex_real_complex_split_kernel<REAL_COMPLEX_DIM_X, REAL_COMPLEX_DIM_Y>),
+                       grid_b,
+                       threads,
+                       0,
+                       handle->get_stream(),
+                       rows,
+                       cols,
+                       trans_b == rocblas_operation_conjugate_transpose,
+                       b + offset_b,
+                       ldb,
+                       stride_b,
+                       ldw,
+                       trans ? size_t(n) : size_t(k) * n,
+                       plane_b,
+                       wb);
+
+    // the real gemm uses the default solution, which is not the one of the complex gemm
+    constexpr uint32_t real_complex_flags
+        = rocblas_gemm_flags_complex_3m | rocblas_gemm_flags_fp64_emulation
+          | rocblas_gemm_flags_split_k | ROCBLAS_GEMM_FLAGS_SPLIT_K_FACTOR_MASK
+          | rocblas_gemm_flags_check_solution_index;
+    flags = rocblas_gemm_flags(flags & ~real_complex_flags);
+
+    static const T one = T(1), zero = T(0);
+
+    // clang-format off
+    RETURN_IF_ROCBLAS_ERROR((gemm_ex_batched_template<T, T, T>(handle,
+        trans_a == rocblas_operation_none ? rocblas_operation_none : rocblas_operation_transpose,
+        trans ? rocblas_operation_transpose : rocblas_operation_none,
+        m, 2 * n, k, &one,
+        a,  offset_a, lda, stride_a,
+        wb, 0,        ldw, plane_b, &zero,
+        wp, 0,        m,   plane_p,
+        wp, 0,        m,   plane_p, batch_count, algo, 0, flags)));
+    // clang-format on
+
+    hipLaunchKernelGGL(
+        (gemm_ex_real_complex_combine_kernel<REAL_COMPLEX_DIM_X, REAL_COMPLEX_DIM_Y>),
+        grid_c,
+        threads,
+        0,
+        handle->get_stream(),
+        m,
+        n,
+        *alpha,
+        (const T*)wp,
+        *beta,
+        c + offset_c,
+        ldc,
+        stride_c,
+        d + offset_d,
+        ldd,
+        stride_d);
+
+    return rocblas_status_success;
+}
+
+/*! \brief Casts the arguments of gemm_ex and gemm_strided_batched_ex of a real A by a complex B,
+    C and D for gemm_ex_real_complex_template. Arrays of pointers are not supported. */
+template <bool BATCHED, typename T>
+rocblas_status gemm_ex_real_complex_typecasting(rocblas_handle     handle,
+                                                rocblas_operation  trans_a,
+                                                rocblas_operation  trans_b,
+                                                rocblas_int        m,
+                                                rocblas_int        n,
+                                                rocblas_int        k,
+                                                const void*        alpha,
+                                                const void*        a,
+                                                rocblas_stride     offsetAin,
+                                                rocblas_int        lda,
+                                                rocblas_stride     stride_a,
+                                                const void*        b,
+                                                rocblas_stride     offsetBin,
+                                                rocblas_int        ldb,
+                                                rocblas_stride     stride_b,
+                                                const void*        beta,
+                                                const void*        c,
+                                                rocblas_stride     offsetCin,
+                                                rocblas_int        ldc,
+                                                rocblas_stride     stride_c,
+                                                void*              d,
+                                                rocblas_stride     offsetDin,
+                                                rocblas_int        ldd,
+                                                rocblas_stride     stride_d,
+                                                rocblas_int        batch_count,
+                                                rocblas_gemm_algo  algo,
+                                                int32_t            solution_index,
+                                                rocblas_gemm_flags flags)
+{
+    using Tc = rocblas_complex_num<T>;
+
+    if(BATCHED)
+        return rocblas_status_not_implemented;
+
+    Tc alpha_h, beta_h;
+    RETURN_IF_ROCBLAS_ERROR(
+        rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
+
+    if(!isAligned(a, sizeof(T)) || !isAligned(b, sizeof(Tc)) || !isAligned(c, sizeof(Tc))
+       || !isAligned(d, sizeof(Tc)))
+        return rocblas_status_invalid_size;
+
+    // clang-format off
+    return gemm_ex_real_complex_template(handle, trans_a, trans_b, m, n, k, (const Tc*)alpha,
+                                         (const T*)a,  offsetAin, lda, stride_a,
+                                         (const Tc*)b, offsetBin, ldb, stride_b,
+                                         (const Tc*)beta,
+                                         (const Tc*)c, offsetCin, ldc, stride_c,
+                                         (Tc*)d,       offsetDin, ldd, stride_d,
+                                         batch_count, algo, flags);
+    // clang-format on
+}
+
+/*! \brief Flags for which gemm_ex and gemm_strided_batched_ex may use workspace */
+constexpr uint32_t rocblas_gemm_ex_workspace_flags = rocblas_gemm_flags_split_k
+                                                     | rocblas_gemm_flags_complex_3m
+                                                     | rocblas_gemm_flags_fp64_emulation;
+
+/*! \brief Workspace in bytes of gemm_ex and gemm_strided_batched_ex for their types and flags */
+inline size_t rocblas_gemm_ex_workspace_size(rocblas_int      m,
+                                             rocblas_int      n,
+                                             rocblas_int      k,
+                                             rocblas_int      batch_count,
+                                             rocblas_datatype a_type,
+                                             rocblas_datatype compute_type,
+                                             uint32_t         flags)
+{
+    size_t size
+        = rocblas_gemm_ex_real_complex_workspace_size(m, n, k, batch_count, a_type, compute_type);
+    if(!size)
+        size = rocblas_gemm_ex_complex_3m_workspace_size(
+            m, n, k, batch_count, a_type, compute_type, flags);
+    if(!size)
+        size = rocblas_gemm_ex_fp64_emulation_workspace_size(
+            m, n, k, batch_count, a_type, compute_type, flags);
+    return size ? size
+                : rocblas_gemm_ex_split_k_workspace_size(m, n, k, batch_count, compute_type, flags);
+}
+
 template <bool BATCHED, typename Ti, typename To = Ti, typename Tc = To>
 rocblas_status gemm_ex_typecasting(rocblas_handle     handle,
                                    rocblas_operation  trans_a,
@@ -440,35 +1753,44 @@ rocblas_status gemm_ex_typecasting(rocblas_handle     handle,
                 return gemm_ex_check_numerics_status;
         }
 
-        status = gemm_ex_batched_template(handle,
-                                          trans_a,
-                                          trans_b,
-                                          m,
-                                          n,
-                                          k,
-                                          (const Tc*)alpha,
-                                          (const Ti*)a,
-                                          offsetAin,
-                                          lda,
-                                          stride_a,
-                                          (const Ti*)b,
-                                          offsetBin,
-                                          ldb,
-                                          stride_b,
-                                          (const Tc*)beta,
-                                          (const To*)c,
-                                          offsetCin,
-                                          ldc,
-                                          stride_c,
-                                          (To*)d,
-                                          offsetDin,
-                                          ldd,
-                                          stride_d,
-                                          batch_count,
-                                          algo,
-                                          solution_index,
-                                          flags);
-        if(status != rocblas_status_success)
+        // clang-format off
+        if((flags & rocblas_gemm_flags_complex_3m) && rocblas_gemm_ex_complex_3m_types<Ti, To, Tc>)
+            status = gemm_ex_complex_3m_template(handle, trans_a, trans_b, m, n, k,
+                                                 (const Tc*)alpha,
+                                                 (const Ti*)a, offsetAin, lda, stride_a,
+                                                 (const Ti*)b, offsetBin, ldb, stride_b,
+                                                 (const Tc*)beta,
+                                                 (const To*)c, offsetCin, ldc, stride_c,
+                                                 (To*)d,       offsetDin, ldd, stride_d,
+                                                 batch_count, algo, solution_index, flags);
+        else if((flags & rocblas_gemm_flags_fp64_emulation)
+                && rocblas_gemm_ex_fp64_emulation_types<Ti, To, Tc>)
+            status = gemm_ex_fp64_emulation_template(handle, trans_a, trans_b, m, n, k,
+                                                     (const Tc*)alpha,
+                                                     (const Ti*)a, offsetAin, lda, stride_a,
+                                                     (const Ti*)b, offsetBin, ldb, stride_b,
+                                                     (const Tc*)beta,
+                                                     (const To*)c, offsetCin, ldc, stride_c,
+                                                     (To*)d,       offsetDin, ldd, stride_d,
+                                                     batch_count, algo, solution_index, flags);
+        else if(flags & rocblas_gemm_flags_split_k)
+            status = gemm_ex_split_k_template(handle, trans_a, trans_b, m, n, k, (const Tc*)alpha,
+                                              (const Ti*)a, offsetAin, lda, stride_a,
+                                              (const Ti*)b, offsetBin, ldb, stride_b,
+                                              (const Tc*)beta,
+                                              (const To*)c, offsetCin, ldc, stride_c,
+                                              (To*)d,       offsetDin, ldd, stride_d,
+                                              batch_count, algo, solution_index, flags);
+        else
+            status = gemm_ex_batched_template(handle, trans_a, trans_b, m, n, k, (const Tc*)alpha,
+                                              (const Ti*)a, offsetAin, lda, stride_a,
+                                              (const Ti*)b, offsetBin, ldb, stride_b,
+                                              (const Tc*)beta,
+                                              (const To*)c, offsetCin, ldc, stride_c,
+                                              (To*)d,       offsetDin, ldd, stride_d,
+                                              batch_count, algo, solution_index, flags);
+        // clang-format on
+        if(status != rocblas_status_success && status != rocblas_status_perf_degraded)
             return status;
 
         if(check_numerics && !std::is_same<Ti, rocblas_int8x4>{}
@@ -678,6 +2000,13 @@ rocblas_status rocblas_gemm_ex_template(rocblas_handle    handle,
         stride_c = rocblas_stride(ldc) * n;
         stride_d = rocblas_stride(ldd) * n;
     }
+    else
+    {
+        // Batches sharing A, as for shared weights, form a single gemm with better tile
+        // efficiency
+        rocblas_gemm_collapse_shared_a(
+            trans_b, n, stride_a, ldb, stride_b, ldc, stride_c, ldd, stride_d, batch_count);
+    }
 
     rocblas_status rb_status = rocblas_status_not_implemented;
 
@@ -789,6 +2118,14 @@ rocblas_status rocblas_gemm_ex_template(rocblas_handle    handle,
                                         rocblas_double_complex,
                                         rocblas_double_complex>(EX_TYPECASTING_PARM);
     }
+    else if(rocblas_gemm_ex_real_complex_types(a_type, compute_type) && b_type == compute_type
+            && c_type == compute_type && d_type == compute_type)
+    {
+        if(a_type == rocblas_datatype_f32_r)
+            rb_status = gemm_ex_real_complex_typecasting<BATCHED, float>(EX_TYPECASTING_PARM);
+        else
+            rb_status = gemm_ex_real_complex_typecasting<BATCHED, double>(EX_TYPECASTING_PARM);
+    }
     else
     {
         rb_status = rocblas_status_not_implemented;
@@ -833,3 +2170,231 @@ rocblas_status rocblas_copy_alpha_beta_to_host_if_on_device(rocblas_handle   han
         return rocblas_status_not_implemented;
     }
 }
+
+/*! \brief Whether gemm_ex rounds the results of a gemm of these types stochastically: A, B, C
+    and D of bf16_r or f16_r with f32_r compute_type, with the handle's stochastic rounding */
+inline bool rocblas_gemm_ex_use_stochastic_rounding(rocblas_handle   handle,
+                                                    rocblas_datatype a_type,
+                                                    rocblas_datatype b_type,
+                                                    rocblas_datatype c_type,
+                                                    rocblas_datatype d_type,
+                                                    rocblas_datatype compute_type)
+{
+    return handle->stochastic_rounding && compute_type == rocblas_datatype_f32_r
+           && (a_type == rocblas_datatype_bf16_r || a_type == rocblas_datatype_f16_r)
+           && b_type == a_type && c_type == a_type && d_type == a_type;
+}
+
+constexpr int GEMM_STOCHASTIC_DIM_X = 64;
+constexpr int GEMM_STOCHASTIC_DIM_Y = 4;
+
+// Widens the m x n matrices C of the batches into the packed float matrices W. The columns and
+// batches loop over the y and z dimensions of the grid.
+template <int DIM_X, int DIM_Y, typename T>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_gemm_ex_widen_kernel(rocblas_int    m,
+                             rocblas_int    n,
+                             const T*       C,
+                             rocblas_int    ldc,
+                             rocblas_stride stride_c,
+                             float*         W,
+                             rocblas_int    batch_count)
+{
+    auto tx = blockIdx.x * DIM_X + threadIdx.x;
+    if(tx >= m)
+        return;
+
+    for(rocblas_int batch = blockIdx.z; batch < batch_count; batch += gridDim.z)
+        for(rocblas_int ty = blockIdx.y * DIM_Y + threadIdx.y; ty < n; ty += gridDim.y * DIM_Y)
+            W[tx + ty * size_t(m) + batch * size_t(m) * n]
+                = float(C[tx + ty * size_t(ldc) + batch * stride_c]);
+}
+
+// Rounds the packed float matrices W stochastically into the matrices D of the batches, with
+// the counter offset + (b * n + j) * m + i of the element (i, j) of batch b
+template <int DIM_X, int DIM_Y, typename T>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_gemm_ex_stochastic_round_kernel(rocblas_int    m,
+                                        rocblas_int    n,
+                                        const float*   W,
+                                        T*             D,
+                                        rocblas_int    ldd,
+                                        rocblas_stride stride_d,
+                                        rocblas_int    batch_count,
+                                        uint64_t       seed,
+                                        uint64_t       offset)
+{
+    auto tx = blockIdx.x * DIM_X + threadIdx.x;
+    if(tx >= m)
+        return;
+
+    for(rocblas_int batch = blockIdx.z; batch < batch_count; batch += gridDim.z)
+    {
+        for(rocblas_int ty = blockIdx.y * DIM_Y + threadIdx.y; ty < n; ty += gridDim.y * DIM_Y)
+        {
+            size_t   idx  = tx + ty * size_t(m) + batch * size_t(m) * n;
+            uint32_t bits = rocblas_stochastic_rounding_bits(seed, offset + idx);
+            D[tx + ty * size_t(ldd) + batch * stride_d] = rocblas_stochastic_round<T>(W[idx], bits);
+        }
+    }
+}
+
+/*! \brief The strided batched gemm of bf16_r or f16_r A, B, C and D with f32_r compute_type and
+    host alpha and beta, computed into f32_r workspace by the mixed precision kernels with f32_r
+    output, and rounded stochastically into D. C is widened into the workspace if beta is not
+    zero. */
+template <typename T>
+rocblas_status rocblas_gemm_ex_stochastic_template(rocblas_handle    handle,
+                                                   rocblas_operation trans_a,
+                                                   rocblas_operation trans_b,
+                                                   rocblas_int       m,
+                                                   rocblas_int       n,
+                                                   rocblas_int       k,
+                                                   const float*      alpha,
+                                                   const T*          a,
+                                                   rocblas_int       lda,
+                                                   rocblas_stride    stride_a,
+                                                   const T*          b,
+                                                   rocblas_int       ldb,
+                                                   rocblas_stride    stride_b,
+                                                   const float*      beta,
+                                                   const T*          c,
+                                                   rocblas_int       ldc,
+                                                   rocblas_stride    stride_c,
+                                                   T*                d,
+                                                   rocblas_int       ldd,
+                                                   rocblas_stride    stride_d,
+                                                   rocblas_int       batch_count,
+                                                   rocblas_gemm_algo algo,
+                                                   int32_t           solution_index,
+                                                   uint32_t          flags)
+{
+    constexpr rocblas_datatype t_type = std::is_same<T, rocblas_bfloat16>{}
+                                            ? rocblas_datatype_bf16_r
+                                            : rocblas_datatype_f16_r;
+
+    if(!m || !n || !batch_count)
+        return handle->is_device_memory_size_query() ? rocblas_status_size_unchanged
+                                                     : rocblas_status_success;
+
+    size_t         w_size   = sizeof(float) * m * n * batch_count;
+    rocblas_stride stride_w = rocblas_stride(m) * n;
+
+    auto gemm = [&](float* W) {
+        // clang-format off
+        return rocblas_gemm_ex_template<false>(handle, trans_a, trans_b, m, n, k, alpha,
+                                               a, t_type, 0, lda, stride_a,
+                                               b, t_type, 0, ldb, stride_b,
+                                               beta, W, rocblas_datatype_f32_r, 0, m, stride_w,
+                                               W, rocblas_datatype_f32_r, 0, m, stride_w,
+                                               batch_count, rocblas_datatype_f32_r, algo,
+                                               solution_index, flags);
+        // clang-format on
+    };
+
+    // The workspace of the gemm is allocated while the f32_r workspace is held. The matrices are
+    // not dereferenced in a query, which is given D instead.
+    if(handle->is_device_memory_size_query())
+    {
+        size_t gemm_size;
+        RETURN_IF_ROCBLAS_ERROR(
+            handle->query_device_memory_size(&gemm_size, [&] { return gemm((float*)d); }));
+        return handle->set_optimal_device_memory_size(w_size, gemm_size);
+    }
+
+    auto w_mem = handle->device_malloc(w_size);
+    if(!w_mem)
+        return rocblas_status_memory_error;
+
+    auto W = (float*)w_mem;
+
+    // The columns and batches loop over the y and z dimensions of the grid, which are limited
+    // to 65535
+    dim3 grid((m - 1) / GEMM_STOCHASTIC_DIM_X + 1,
+              std::min((n - 1) / GEMM_STOCHASTIC_DIM_Y + 1, 65535),
+              std::min(batch_count, 65535));
+    dim3 threads(GEMM_STOCHASTIC_DIM_X, GEMM_STOCHASTIC_DIM_Y);
+
+    if(*beta != 0)
+        hipLaunchKernelGGL(
+            (rocblas_gemm_ex_widen_kernel<GEMM_STOCHASTIC_DIM_X, GEMM_STOCHASTIC_DIM_Y, T>),
+            grid,
+            threads,
+            0,
+            handle->get_stream(),
+            m,
+            n,
+            c,
+            ldc,
+            stride_c,
+            W,
+            batch_count);
+
+    RETURN_IF_ROCBLAS_ERROR(gemm(W));
+
+    hipLaunchKernelGGL(
+        (rocblas_gemm_ex_stochastic_round_kernel<GEMM_STOCHASTIC_DIM_X, GEMM_STOCHASTIC_DIM_Y, T>),
+        grid,
+        threads,
+        0,
+        handle->get_stream(),
+        m,
+        n,
+        W,
+        d,
+        ldd,
+        stride_d,
+        batch_count,
+        handle->stochastic_rounding_seed,
+        handle->stochastic_rounding_offset);
+
+    return rocblas_status_success;
+}
+
+/*! \brief rocblas_gemm_ex_stochastic_template of the type of a_type, with alpha and beta copied
+    to the host if they are on the device */
+inline rocblas_status rocblas_gemm_ex_stochastic_rounding(rocblas_handle    handle,
+                                                          rocblas_operation trans_a,
+                                                          rocblas_operation trans_b,
+                                                          rocblas_int       m,
+                                                          rocblas_int       n,
+                                                          rocblas_int       k,
+                                                          const void*       alpha,
+                                                          const void*       a,
+                                                          rocblas_datatype  a_type,
+                                                          rocblas_int       lda,
+                                                          rocblas_stride    stride_a,
+                                                          const void*       b,
+                                                          rocblas_int       ldb,
+                                                          rocblas_stride    stride_b,
+                                                          const void*       beta,
+                                                          const void*       c,
+                                                          rocblas_int       ldc,
+                                                          rocblas_stride    stride_c,
+                                                          void*             d,
+                                                          rocblas_int       ldd,
+                                                          rocblas_stride    stride_d,
+                                                          rocblas_int       batch_count,
+                                                          rocblas_gemm_algo algo,
+                                                          int32_t           solution_index,
+                                                          uint32_t          flags)
+{
+    // The scalars are read on the host, to skip widening C when beta is zero
+    rocblas_union_t alpha_h, beta_h;
+    if(!handle->is_device_memory_size_query())
+        RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, k, rocblas_datatype_f32_r));
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+#define STOCHASTIC_PARM(T_)                                                                        \
+    handle, trans_a, trans_b, m, n, k, (const float*)alpha, (const T_*)a, lda, stride_a,           \
+        (const T_*)b, ldb, stride_b, (const float*)beta, (const T_*)c, ldc, stride_c, (T_*)d, ldd, \
+        stride_d, batch_count, algo, solution_index, flags
+
+    if(a_type == rocblas_datatype_bf16_r)
+        return rocblas_gemm_ex_stochastic_template(STOCHASTIC_PARM(rocblas_bfloat16));
+    else
+        return rocblas_gemm_ex_stochastic_template(STOCHASTIC_PARM(rocblas_half));
+
+#undef STOCHASTIC_PARM
+}
@@ -0,0 +1,880 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_epilogue.hpp"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    constexpr int GEMM_EPILOGUE_DIM_X = 64;
+    constexpr int GEMM_EPILOGUE_DIM_Y = 4;
+
+    // Applies the row and column scales to the product P, adds beta * C, and applies bias,
+    // activation and scale into D, reading and writing each element once. P is D, and C is not
+    // read, unless there are row or column scales with a nonzero beta. The largest magnitude of
+    // the activation of the block is combined into amax.
+    template <int DIM_X, int DIM_Y, typename Td, typename TScal, typename Tc>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_gemm_epilogue_kernel(rocblas_int             m,
+                                 rocblas_int             n,
+                                 const Td*               P,
+                                 rocblas_int             ldp,
+                                 const Tc*               row_scale,
+                                 const Tc*               col_scale,
+                                 Tc                      beta,
+                                 const Td*               C,
+                                 rocblas_int             ldc,
+                                 Td*                     D,
+                                 rocblas_int             ldd,
+                                 const Td*               bias,
+                                 rocblas_gemm_activation activation,
+                                 TScal                   scale_host_device,
+                                 Td*                     aux,
+                                 rocblas_int             ldaux,
+                                 float*                  amax)
+    {
+        using T = rocblas_gemm_epilogue_compute_t<Td>;
+
+        auto tx = blockIdx.x * DIM_X + threadIdx.x;
+        auto ty = blockIdx.y * DIM_Y + threadIdx.y;
+
+        float abs_max = 0;
+        if(tx < m && ty < n)
+        {
+            T scale = T(load_scalar(scale_host_device));
+
+            size_t idx = tx + ty * size_t(ldd);
+            T      v   = T(P[tx + ty * size_t(ldp)]);
+            if(row_scale)
+                v *= T(row_scale[tx]);
+            if(col_scale)
+                v *= T(col_scale[ty]);
+            if(C)
+                v += T(beta) * T(C[tx + ty * size_t(ldc)]);
+            if(bias)
+                v += T(bias[tx]);
+            if(aux)
+                aux[tx + ty * size_t(ldaux)] = Td(v);
+            T a     = rocblas_gemm_epilogue_activation(v, activation);
+            D[idx]  = Td(scale * a);
+            abs_max = float(a < 0 ? -a : a);
+        }
+
+        if(amax)
+        {
+            __shared__ float s_max[DIM_X * DIM_Y];
+            int              tid = threadIdx.x + threadIdx.y * DIM_X;
+            s_max[tid]           = abs_max;
+            __syncthreads();
+            for(int i = DIM_X * DIM_Y / 2; i > 0; i /= 2)
+            {
+                if(tid < i)
+                    s_max[tid] = max(s_max[tid], s_max[tid + i]);
+                __syncthreads();
+            }
+            // non-negative floats are ordered like their bit patterns
+            if(tid == 0)
+                atomicMax((unsigned int*)amax, __float_as_uint(s_max[0]));
+        }
+    }
+
+    // p is the product, of leading dimension ldp, and beta is the host beta to add beta * C in
+    // the epilogue, or nullptr when C is already in p
+    template <typename Td, typename Tc>
+    rocblas_status rocblas_gemm_epilogue_template(rocblas_handle               handle,
+                                                  rocblas_int                  m,
+                                                  rocblas_int                  n,
+                                                  const void*                  p,
+                                                  rocblas_int                  ldp,
+                                                  const void*                  beta,
+                                                  const void*                  c,
+                                                  rocblas_int                  ldc,
+                                                  void*                        d,
+                                                  rocblas_int                  ldd,
+                                                  const rocblas_gemm_epilogue* epilogue,
+                                                  bool                         scale_on_device)
+    {
+        using T = rocblas_gemm_epilogue_compute_t<Td>;
+
+        dim3 grid((m - 1) / GEMM_EPILOGUE_DIM_X + 1, (n - 1) / GEMM_EPILOGUE_DIM_Y + 1);
+        dim3 threads(GEMM_EPILOGUE_DIM_X, GEMM_EPILOGUE_DIM_Y);
+
+        auto P         = (const Td*)p;
+        auto row_scale = (const Tc*)epilogue->row_scale;
+        auto col_scale = (const Tc*)epilogue->col_scale;
+        Tc   beta_c    = beta ? *(const Tc*)beta : Tc(0);
+        auto C         = beta && T(beta_c) != 0 ? (const Td*)c : nullptr;
+        auto D         = (Td*)d;
+        auto bias      = (const Td*)epilogue->bias;
+        auto aux       = (Td*)epilogue->aux;
+        auto scale     = (const Tc*)epilogue->scale;
+        auto amax      = (float*)epilogue->amax;
+
+        if(amax)
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(amax, 0, sizeof(float), handle->get_stream()));
+
+        if(scale && scale_on_device)
+            hipLaunchKernelGGL(
+                (rocblas_gemm_epilogue_kernel<GEMM_EPILOGUE_DIM_X, GEMM_EPILOGUE_DIM_Y, Td>),
+                grid,
+                threads,
+                0,
+                handle->get_stream(),
+                m,
+                n,
+                P,
+                ldp,
+                row_scale,
+                col_scale,
+                beta_c,
+                C,
+                ldc,
+                D,
+                ldd,
+                bias,
+                epilogue->activation,
+                scale,
+                aux,
+                epilogue->ldaux,
+                amax);
+        else
+            hipLaunchKernelGGL(
+                (rocblas_gemm_epilogue_kernel<GEMM_EPILOGUE_DIM_X, GEMM_EPILOGUE_DIM_Y, Td>),
+                grid,
+                threads,
+                0,
+                handle->get_stream(),
+                m,
+                n,
+                P,
+                ldp,
+                row_scale,
+                col_scale,
+                beta_c,
+                C,
+                ldc,
+                D,
+                ldd,
+                bias,
+                epilogue->activation,
+                scale ? *scale : Tc(1),
+                aux,
+                epilogue->ldaux,
+                amax);
+
+        return rocblas_status_success;
+    }
+
+    bool rocblas_gemm_epilogue_is_empty(const rocblas_gemm_epilogue* epilogue)
+    {
+        return !epilogue
+               || (!epilogue->bias && !epilogue->scale && !epilogue->aux && !epilogue->amax
+                   && !epilogue->row_scale && !epilogue->col_scale
+                   && epilogue->activation == rocblas_gemm_activation_none);
+    }
+
+    rocblas_status rocblas_gemm_epilogue_dispatch(rocblas_handle               handle,
+                                                  rocblas_int                  m,
+                                                  rocblas_int                  n,
+                                                  const void*                  p,
+                                                  rocblas_int                  ldp,
+                                                  const void*                  beta,
+                                                  const void*                  c,
+                                                  rocblas_int                  ldc,
+                                                  void*                        d,
+                                                  rocblas_datatype             d_type,
+                                                  rocblas_int                  ldd,
+                                                  rocblas_datatype             compute_type,
+                                                  const rocblas_gemm_epilogue* epilogue,
+                                                  bool                         scale_on_device)
+    {
+#define EPILOGUE_PARM handle, m, n, p, ldp, beta, c, ldc, d, ldd, epilogue, scale_on_device
+
+        if(d_type == rocblas_datatype_f32_r && compute_type == rocblas_datatype_f32_r)
+            return rocblas_gemm_epilogue_template<float, float>(EPILOGUE_PARM);
+        else if(d_type == rocblas_datatype_f64_r && compute_type == rocblas_datatype_f64_r)
+            return rocblas_gemm_epilogue_template<double, double>(EPILOGUE_PARM);
+        else if(d_type == rocblas_datatype_f16_r && compute_type == rocblas_datatype_f16_r)
+            return rocblas_gemm_epilogue_template<rocblas_half, rocblas_half>(EPILOGUE_PARM);
+        else if(d_type == rocblas_datatype_f16_r && compute_type == rocblas_datatype_f32_r)
+            return rocblas_gemm_epilogue_template<rocblas_half, float>(EPILOGUE_PARM);
+        else if(d_type == rocblas_datatype_bf16_r && compute_type == rocblas_datatype_f32_r)
+            return rocblas_gemm_epilogue_template<rocblas_bfloat16, float>(EPILOGUE_PARM);
+
+#undef EPILOGUE_PARM
+
+        return rocblas_status_not_implemented;
+    }
+
+    bool rocblas_gemm_epilogue_type_supported(rocblas_datatype d_type,
+                                              rocblas_datatype compute_type)
+    {
+        return (d_type == rocblas_datatype_f32_r && compute_type == rocblas_datatype_f32_r)
+               || (d_type == rocblas_datatype_f64_r && compute_type == rocblas_datatype_f64_r)
+               || (d_type == rocblas_datatype_f16_r
+                   && (compute_type == rocblas_datatype_f16_r
+                       || compute_type == rocblas_datatype_f32_r))
+               || (d_type == rocblas_datatype_bf16_r && compute_type == rocblas_datatype_f32_r);
+    }
+
+    // Widens the rows x cols FP8 matrix A into the packed matrix W. Every FP8 and BF8 value is
+    // exactly representable in rocblas_half and rocblas_bfloat16.
+    template <int DIM_X, int DIM_Y, typename Tw>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_gemm_f8_widen_kernel(rocblas_int    rows,
+                                 rocblas_int    cols,
+                                 bool           bf8,
+                                 const uint8_t* A,
+                                 rocblas_int    lda,
+                                 Tw*            W)
+    {
+        auto tx = blockIdx.x * DIM_X + threadIdx.x;
+        auto ty = blockIdx.y * DIM_Y + threadIdx.y;
+
+        if(tx < rows && ty < cols)
+        {
+            uint8_t x = A[tx + ty * size_t(lda)];
+            W[tx + ty * size_t(rows)]
+                = Tw(bf8 ? rocblas_f8_to_float<5, 2>(x) : rocblas_f8_to_float<4, 3>(x));
+        }
+    }
+
+    template <typename Tw>
+    void rocblas_gemm_f8_widen(rocblas_handle   handle,
+                               rocblas_int      rows,
+                               rocblas_int      cols,
+                               const void*      a,
+                               rocblas_datatype a_type,
+                               rocblas_int      lda,
+                               Tw*              w)
+    {
+        if(!rows || !cols)
+            return;
+
+        dim3 grid((rows - 1) / GEMM_EPILOGUE_DIM_X + 1, (cols - 1) / GEMM_EPILOGUE_DIM_Y + 1);
+        dim3 threads(GEMM_EPILOGUE_DIM_X, GEMM_EPILOGUE_DIM_Y);
+        hipLaunchKernelGGL(
+            (rocblas_gemm_f8_widen_kernel<GEMM_EPILOGUE_DIM_X, GEMM_EPILOGUE_DIM_Y, Tw>),
+            grid,
+            threads,
+            0,
+            handle->get_stream(),
+            rows,
+            cols,
+            a_type == rocblas_datatype_bf8_r,
+            (const uint8_t*)a,
+            lda,
+            w);
+    }
+
+    // The gemm of FP8 or BF8 A and B, widened in workspace to Tw, with f32_r compute_type.
+    // Tensile has no FP8 kernels in this library, so the 16-bit mixed precision kernels are used.
+    template <typename Tw>
+    rocblas_status rocblas_gemm_ex3_f8_template(rocblas_handle    handle,
+                                                rocblas_operation trans_a,
+                                                rocblas_operation trans_b,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                rocblas_int       k,
+                                                const void*       alpha,
+                                                const void*       a,
+                                                rocblas_datatype  a_type,
+                                                rocblas_int       lda,
+                                                const void*       b,
+                                                rocblas_datatype  b_type,
+                                                rocblas_int       ldb,
+                                                const void*       beta,
+                                                const void*       c,
+                                                rocblas_datatype  c_type,
+                                                rocblas_int       ldc,
+                                                void*             d,
+                                                rocblas_datatype  d_type,
+                                                rocblas_int       ldd,
+                                                rocblas_gemm_algo algo,
+                                                int32_t           solution_index,
+                                                uint32_t          flags)
+    {
+        constexpr rocblas_datatype w_type = std::is_same<Tw, rocblas_bfloat16>{}
+                                                ? rocblas_datatype_bf16_r
+                                                : rocblas_datatype_f16_r;
+
+        rocblas_int a_rows = trans_a == rocblas_operation_none ? m : k;
+        rocblas_int a_cols = trans_a == rocblas_operation_none ? k : m;
+        rocblas_int b_rows = trans_b == rocblas_operation_none ? k : n;
+        rocblas_int b_cols = trans_b == rocblas_operation_none ? n : k;
+        size_t      a_size = sizeof(Tw) * a_rows * a_cols;
+        size_t      b_size = sizeof(Tw) * b_rows * b_cols;
+
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(a_size, b_size);
+
+        auto w_mem = handle->device_malloc(a_size, b_size);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        auto w_a = (Tw*)w_mem[0];
+        auto w_b = (Tw*)w_mem[1];
+        rocblas_gemm_f8_widen(handle, a_rows, a_cols, a, a_type, lda, w_a);
+        rocblas_gemm_f8_widen(handle, b_rows, b_cols, b, b_type, ldb, w_b);
+
+        rocblas_stride stride_a{1}, stride_b{1}, stride_c{1}, stride_d{1};
+
+        // clang-format off
+        return rocblas_gemm_ex_template<false>(handle, trans_a, trans_b, m, n, k, alpha,
+                                               w_a, w_type, 0, std::max(a_rows, 1), stride_a,
+                                               w_b, w_type, 0, std::max(b_rows, 1), stride_b,
+                                               beta, c, c_type, 0, ldc, stride_c,
+                                               d, d_type, 0, ldd, stride_d, 1,
+                                               rocblas_datatype_f32_r, algo, solution_index,
+                                               flags);
+        // clang-format on
+    }
+
+    // Adds the bias to the i32_r result W, applies the activation and requantizes to the i8_r D,
+    // reading W and writing D once
+    template <int DIM_X, int DIM_Y>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_gemm_requantize_kernel(rocblas_int             m,
+                                   rocblas_int             n,
+                                   const int32_t*          W,
+                                   const int32_t*          bias,
+                                   rocblas_gemm_activation activation,
+                                   const float*            quant_scale,
+                                   bool                    per_channel,
+                                   int32_t                 zero_point,
+                                   int8_t*                 D,
+                                   rocblas_int             ldd)
+    {
+        auto tx = blockIdx.x * DIM_X + threadIdx.x;
+        auto ty = blockIdx.y * DIM_Y + threadIdx.y;
+
+        if(tx < m && ty < n)
+        {
+            int32_t t = W[tx + ty * size_t(m)];
+            if(bias)
+                t += bias[tx];
+            float a = rocblas_gemm_epilogue_activation(float(t), activation);
+            if(quant_scale)
+                a *= quant_scale[per_channel ? tx : 0];
+            float q = rintf(a) + float(zero_point);
+
+            D[tx + ty * size_t(ldd)] = int8_t(q < -128 ? -128 : q > 127 ? 127 : q);
+        }
+    }
+
+    // The gemm of i8_r A and B into i32_r workspace, requantized to the i8_r D. Tensile has no
+    // kernels with i8_r output in this library, so the requantization is a pass over the workspace
+    // in which bias and activation are also applied.
+    rocblas_status rocblas_gemm_ex3_i8_template(rocblas_handle               handle,
+                                                rocblas_operation            trans_a,
+                                                rocblas_operation            trans_b,
+                                                rocblas_int                  m,
+                                                rocblas_int                  n,
+                                                rocblas_int                  k,
+                                                const void*                  alpha,
+                                                const void*                  a,
+                                                rocblas_int                  lda,
+                                                const void*                  b,
+                                                rocblas_int                  ldb,
+                                                const void*                  beta,
+                                                const void*                  c,
+                                                rocblas_int                  ldc,
+                                                void*                        d,
+                                                rocblas_int                  ldd,
+                                                rocblas_gemm_algo            algo,
+                                                int32_t                      solution_index,
+                                                uint32_t                     flags,
+                                                const rocblas_gemm_epilogue* epilogue)
+    {
+        size_t w_size = sizeof(int32_t) * m * n;
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(w_size);
+
+        auto w_mem = handle->device_malloc(w_size);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        auto W = (int32_t*)w_mem;
+
+        // beta is 0 when there is no C, which is then not read
+        if(!c)
+        {
+            c   = W;
+            ldc = m;
+        }
+
+        rocblas_stride stride_a{1}, stride_b{1}, stride_c{1}, stride_d{1};
+
+        // clang-format off
+        RETURN_IF_ROCBLAS_ERROR(rocblas_gemm_ex_template<false>(
+            handle, trans_a, trans_b, m, n, k, alpha,
+            a, rocblas_datatype_i8_r, 0, lda, stride_a,
+            b, rocblas_datatype_i8_r, 0, ldb, stride_b,
+            beta, c, rocblas_datatype_i32_r, 0, ldc, stride_c,
+            W, rocblas_datatype_i32_r, 0, m, stride_d, 1,
+            rocblas_datatype_i32_r, algo, solution_index,
+            flags & ~rocblas_gemm_ex_workspace_flags));
+        // clang-format on
+
+        const bool per_channel = epilogue && epilogue->quant_scale_count > 1;
+
+        dim3 grid((m - 1) / GEMM_EPILOGUE_DIM_X + 1, (n - 1) / GEMM_EPILOGUE_DIM_Y + 1);
+        dim3 threads(GEMM_EPILOGUE_DIM_X, GEMM_EPILOGUE_DIM_Y);
+        hipLaunchKernelGGL(
+            (rocblas_gemm_requantize_kernel<GEMM_EPILOGUE_DIM_X, GEMM_EPILOGUE_DIM_Y>),
+            grid,
+            threads,
+            0,
+            handle->get_stream(),
+            m,
+            n,
+            W,
+            epilogue ? (const int32_t*)epilogue->bias : nullptr,
+            epilogue ? epilogue->activation : rocblas_gemm_activation_none,
+            epilogue ? epilogue->quant_scale : nullptr,
+            per_channel,
+            epilogue ? epilogue->quant_zero_point : 0,
+            (int8_t*)d,
+            ldd);
+
+        return rocblas_status_success;
+    }
+
+    // Whether the host scalar of compute_type is zero, for the types supported by the epilogue
+    bool rocblas_gemm_scalar_is_zero(const void* x, rocblas_datatype compute_type)
+    {
+        switch(compute_type)
+        {
+        case rocblas_datatype_f16_r:
+            return float(*(const rocblas_half*)x) == 0;
+        case rocblas_datatype_f32_r:
+            return *(const float*)x == 0;
+        case rocblas_datatype_f64_r:
+            return *(const double*)x == 0;
+        default:
+            return false;
+        }
+    }
+
+    // Reads a f32_r scale in host or device memory into scale_h, which is 1 for a nullptr scale
+    rocblas_status rocblas_gemm_scale_to_host(rocblas_handle handle,
+                                              const void*    scale,
+                                              bool           scale_on_device,
+                                              float&         scale_h)
+    {
+        scale_h = 1;
+        if(!scale)
+            return rocblas_status_success;
+
+        if(!scale_on_device)
+        {
+            scale_h = *(const float*)scale;
+            return rocblas_status_success;
+        }
+
+        if(handle->is_graph_safe())
+            return rocblas_status_not_implemented;
+
+        hipStream_t stream = handle->get_stream();
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(&scale_h, scale, sizeof(float), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        return rocblas_status_success;
+    }
+
+    rocblas_status rocblas_gemm_ex3_impl(rocblas_handle               handle,
+                                         rocblas_operation            trans_a,
+                                         rocblas_operation            trans_b,
+                                         rocblas_int                  m,
+                                         rocblas_int                  n,
+                                         rocblas_int                  k,
+                                         const void*                  alpha,
+                                         const void*                  a,
+                                         rocblas_datatype             a_type,
+                                         rocblas_int                  lda,
+                                         const void*                  b,
+                                         rocblas_datatype             b_type,
+                                         rocblas_int                  ldb,
+                                         const void*                  beta,
+                                         const void*                  c,
+                                         rocblas_datatype             c_type,
+                                         rocblas_int                  ldc,
+                                         void*                        d,
+                                         rocblas_datatype             d_type,
+                                         rocblas_int                  ldd,
+                                         rocblas_datatype             compute_type,
+                                         rocblas_gemm_algo            algo,
+                                         int32_t                      solution_index,
+                                         uint32_t                     flags,
+                                         const rocblas_gemm_epilogue* epilogue)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        const bool HPA = compute_type == rocblas_datatype_f32_r
+                         && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
+        const bool F8     = rocblas_is_f8_datatype(a_type) || rocblas_is_f8_datatype(b_type);
+        const bool I8_OUT = d_type == rocblas_datatype_i8_r;
+        const bool DIAG   = epilogue && (epilogue->row_scale || epilogue->col_scale);
+
+        // The product scaled by rows or columns is held in workspace when C is D
+        if(!HPA && !F8 && !I8_OUT && !(DIAG && c == d))
+            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        const bool has_epilogue    = !rocblas_gemm_epilogue_is_empty(epilogue);
+        const bool scale_on_device = handle->pointer_mode == rocblas_pointer_mode_device;
+
+        // Copy alpha and beta to host if on device
+        rocblas_union_t alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, k, compute_type));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(!handle->is_device_memory_size_query()
+           && handle->layer_mode & rocblas_layer_mode_log_trace)
+        {
+            rocblas_internal_ostream alphass, betass;
+            if(log_trace_alpha_beta_ex(compute_type, alpha, beta, alphass, betass)
+               == rocblas_status_success)
+            {
+                log_trace(handle,
+                          "rocblas_gemm_ex3",
+                          trans_a,
+                          trans_b,
+                          m,
+                          n,
+                          k,
+                          alphass.str(),
+                          a,
+                          rocblas_datatype_string(a_type),
+                          lda,
+                          b,
+                          rocblas_datatype_string(b_type),
+                          ldb,
+                          betass.str(),
+                          c,
+                          rocblas_datatype_string(c_type),
+                          ldc,
+                          d,
+                          rocblas_datatype_string(d_type),
+                          ldd,
+                          rocblas_datatype_string(compute_type),
+                          algo,
+                          solution_index,
+                          rocblas_gemm_flags(flags),
+                          epilogue ? epilogue->bias : nullptr,
+                          epilogue ? epilogue->activation : rocblas_gemm_activation_none,
+                          epilogue ? epilogue->scale : nullptr,
+                          epilogue ? epilogue->aux : nullptr,
+                          epilogue ? epilogue->ldaux : 0,
+                          epilogue ? epilogue->scale_a : nullptr,
+                          epilogue ? epilogue->scale_b : nullptr,
+                          epilogue ? epilogue->amax : nullptr,
+                          epilogue ? epilogue->quant_scale : nullptr,
+                          epilogue ? epilogue->quant_scale_count : 0,
+                          epilogue ? epilogue->quant_zero_point : 0,
+                          epilogue ? epilogue->row_scale : nullptr,
+                          epilogue ? epilogue->col_scale : nullptr);
+            }
+        }
+
+        if(has_epilogue)
+        {
+            if(epilogue->activation != rocblas_gemm_activation_none
+               && epilogue->activation != rocblas_gemm_activation_relu
+               && epilogue->activation != rocblas_gemm_activation_gelu)
+                return rocblas_status_invalid_value;
+
+            if(epilogue->aux && epilogue->ldaux < m)
+                return rocblas_status_invalid_size;
+
+            if(!I8_OUT && !rocblas_gemm_epilogue_type_supported(d_type, compute_type))
+                return rocblas_status_not_implemented;
+        }
+
+        if(I8_OUT)
+        {
+            if(a_type != rocblas_datatype_i8_r || b_type != rocblas_datatype_i8_r
+               || c_type != rocblas_datatype_i32_r || compute_type != rocblas_datatype_i32_r)
+                return rocblas_status_not_implemented;
+
+            if(epilogue
+               && (epilogue->scale || epilogue->aux || epilogue->scale_a || epilogue->scale_b
+                   || epilogue->amax || DIAG))
+                return rocblas_status_not_implemented;
+
+            if(epilogue && epilogue->quant_scale && epilogue->quant_scale_count != 1
+               && epilogue->quant_scale_count != m)
+                return rocblas_status_invalid_size;
+        }
+
+        if(epilogue && (epilogue->scale_a || epilogue->scale_b || epilogue->amax)
+           && compute_type != rocblas_datatype_f32_r)
+            return rocblas_status_not_implemented;
+
+        if(F8
+           && (!rocblas_is_f8_datatype(a_type) || !rocblas_is_f8_datatype(b_type)
+               || compute_type != rocblas_datatype_f32_r || c_type != d_type
+               || (d_type != rocblas_datatype_f16_r && d_type != rocblas_datatype_bf16_r
+                   && d_type != rocblas_datatype_f32_r)))
+            return rocblas_status_not_implemented;
+
+        {
+            auto validArgs = rocblas_validateArgs(handle,
+                                                  trans_a,
+                                                  trans_b,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  a,
+                                                  lda,
+                                                  b,
+                                                  ldb,
+                                                  beta,
+                                                  c,
+                                                  c_type,
+                                                  ldc,
+                                                  d,
+                                                  d_type,
+                                                  ldd,
+                                                  compute_type);
+
+            if(validArgs != rocblas_status_continue)
+            {
+                if(validArgs == rocblas_status_success)
+                    RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+                return validArgs;
+            }
+        }
+
+        if(I8_OUT)
+            return rocblas_gemm_ex3_i8_template(handle,
+                                                trans_a,
+                                                trans_b,
+                                                m,
+                                                n,
+                                                k,
+                                                alpha,
+                                                a,
+                                                lda,
+                                                b,
+                                                ldb,
+                                                beta,
+                                                c,
+                                                ldc,
+                                                d,
+                                                ldd,
+                                                algo,
+                                                solution_index,
+                                                flags,
+                                                epilogue);
+
+        // The scales of A and B are folded into alpha
+        float alpha_scaled;
+        if(epilogue && (epilogue->scale_a || epilogue->scale_b) && alpha
+           && !handle->is_device_memory_size_query())
+        {
+            float scale_a, scale_b;
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_gemm_scale_to_host(handle, epilogue->scale_a, scale_on_device, scale_a));
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_gemm_scale_to_host(handle, epilogue->scale_b, scale_on_device, scale_b));
+            alpha_scaled = *(const float*)alpha * scale_a * scale_b;
+            alpha        = &alpha_scaled;
+        }
+
+        // The row and column scales apply to the product only, so with a nonzero beta the gemm
+        // runs with a zero beta and the epilogue adds beta * C. When C is D the product is written
+        // to a workspace scope, which the workspace of the gemm is nested in.
+        const bool query      = handle->is_device_memory_size_query();
+        const bool defer_beta = DIAG && (query || !rocblas_gemm_scalar_is_zero(beta, compute_type));
+
+        const void* gemm_beta = beta;
+        void*       p         = d;
+        rocblas_int ldp       = ldd;
+        size_t      p_size    = defer_beta && c == d ? rocblas_sizeof_datatype(d_type) * m * n : 0;
+
+        rocblas_union_t beta_zero;
+        if(defer_beta)
+        {
+            memset(&beta_zero, 0, sizeof(beta_zero));
+            gemm_beta = &beta_zero;
+        }
+
+        void* scope_p = nullptr;
+        if(p_size)
+        {
+            RETURN_IF_ROCBLAS_ERROR(rocblas_push_workspace_scope(handle, p_size, 0, &scope_p));
+            if(!query)
+            {
+                p   = scope_p;
+                ldp = m;
+            }
+        }
+
+        rocblas_status status;
+        if(F8)
+        {
+#define F8_GEMM_PARM                                                                  \
+    handle, trans_a, trans_b, m, n, k, alpha, a, a_type, lda, b, b_type, ldb, gemm_beta, c, \
+        c_type, ldc, p, d_type, ldp, algo, solution_index, flags
+
+            if(d_type == rocblas_datatype_bf16_r)
+                status = rocblas_gemm_ex3_f8_template<rocblas_bfloat16>(F8_GEMM_PARM);
+            else
+                status = rocblas_gemm_ex3_f8_template<rocblas_half>(F8_GEMM_PARM);
+
+#undef F8_GEMM_PARM
+        }
+        else
+        {
+            rocblas_int batch_count = 1;
+
+            // TODO: These strides could be 0 ( {} ) instead of 1 ( {1} ) once Tensile is fixed
+            rocblas_stride stride_a{1}, stride_b{1}, stride_c{1}, stride_d{1};
+
+            status = rocblas_gemm_ex_template<false>(handle,
+                                                     trans_a,
+                                                     trans_b,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     a,
+                                                     a_type,
+                                                     0,
+                                                     lda,
+                                                     stride_a,
+                                                     b,
+                                                     b_type,
+                                                     0,
+                                                     ldb,
+                                                     stride_b,
+                                                     gemm_beta,
+                                                     c,
+                                                     c_type,
+                                                     0,
+                                                     ldc,
+                                                     stride_c,
+                                                     p,
+                                                     d_type,
+                                                     0,
+                                                     ldp,
+                                                     stride_d,
+                                                     batch_count,
+                                                     compute_type,
+                                                     algo,
+                                                     solution_index,
+                                                     flags);
+        }
+
+        // The epilogue needs no more workspace, so a size query is answered by the gemm
+        if(status == rocblas_status_success && !query && has_epilogue)
+            status = rocblas_gemm_epilogue_dispatch(handle,
+                                                    m,
+                                                    n,
+                                                    p,
+                                                    ldp,
+                                                    defer_beta ? beta : nullptr,
+                                                    c,
+                                                    ldc,
+                                                    d,
+                                                    d_type,
+                                                    ldd,
+                                                    compute_type,
+                                                    epilogue,
+                                                    scale_on_device);
+
+        if(p_size)
+        {
+            rocblas_status pop_status = rocblas_pop_workspace_scope(handle);
+            if(status == rocblas_status_success)
+                status = pop_status;
+        }
+
+        return status;
+    }
+}
+// namespace
+
+extern "C" rocblas_status rocblas_gemm_ex3(rocblas_handle               handle,
+                                           rocblas_operation            trans_a,
+                                           rocblas_operation            trans_b,
+                                           rocblas_int                  m,
+                                           rocblas_int                  n,
+                                           rocblas_int                  k,
+                                           const void*                  alpha,
+                                           const void*                  a,
+                                           rocblas_datatype             a_type,
+                                           rocblas_int                  lda,
+                                           const void*                  b,
+                                           rocblas_datatype             b_type,
+                                           rocblas_int                  ldb,
+                                           const void*                  beta,
+                                           const void*                  c,
+                                           rocblas_datatype             c_type,
+                                           rocblas_int                  ldc,
+                                           void*                        d,
+                                           rocblas_datatype             d_type,
+                                           rocblas_int                  ldd,
+                                           rocblas_datatype             compute_type,
+                                           rocblas_gemm_algo            algo,
+                                           int32_t                      solution_index,
+                                           uint32_t                     flags,
+                                           const rocblas_gemm_epilogue* epilogue)
+try
+{
+    return rocblas_gemm_ex3_impl(handle,
+                                 trans_a,
+                                 trans_b,
+                                 m,
+                                 n,
+                                 k,
+                                 alpha,
+                                 a,
+                                 a_type,
+                                 lda,
+                                 b,
+                                 b_type,
+                                 ldb,
+                                 beta,
+                                 c,
+                                 c_type,
+                                 ldc,
+                                 d,
+                                 d_type,
+                                 ldd,
+                                 compute_type,
+                                 algo,
+                                 solution_index,
+                                 flags,
+                                 epilogue);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
@@ -206,7 +206,7 @@ namespace
         if(!handle->is_device_memory_size_query())
         {
             // Perform logging
-            auto layer_mode = handle->layer_mode;
+            auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
             if(layer_mode
                & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
                   | rocblas_layer_mode_log_profile))
@@ -438,6 +438,10 @@ namespace
         }
         catch(...)
         {
+            // The on-host algorithm copies the matrices to and from the host
+            if(handle->is_graph_safe())
+                return rocblas_status_not_implemented;
+
             // Fall back on slow, naive algorithm if not implemented in Tensile
             static auto& once = rocblas_cerr
                                 << "\nWarning: Using slow on-host algorithm, because it "
@@ -0,0 +1,688 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+#include <algorithm>
+#include <array>
+#include <map>
+#include <numeric>
+#include <vector>
+
+#ifdef BUILD_WITH_TENSILE
+#include "rocblas_gemm_ex.hpp"
+#endif
+
+#include "../blas3/Tensile/gemm_source.hpp"
+
+namespace
+{
+    bool rocblas_gemm_grouped_source_supported(rocblas_datatype a_type,
+                                               rocblas_datatype b_type,
+                                               rocblas_datatype c_type,
+                                               rocblas_datatype d_type,
+                                               rocblas_datatype compute_type)
+    {
+        if(a_type != b_type || a_type != c_type || a_type != d_type || a_type != compute_type)
+            return false;
+        return a_type == rocblas_datatype_f32_r || a_type == rocblas_datatype_f64_r
+               || a_type == rocblas_datatype_f32_c || a_type == rocblas_datatype_f64_c;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_gemm_grouped_source_template(rocblas_handle           handle,
+                                                        rocblas_operation        trans_a,
+                                                        rocblas_operation        trans_b,
+                                                        const rocblas_int*       m,
+                                                        const rocblas_int*       n,
+                                                        const rocblas_int*       k,
+                                                        const void*              alpha,
+                                                        const void* const        a[],
+                                                        const rocblas_int*       lda,
+                                                        const void* const        b[],
+                                                        const rocblas_int*       ldb,
+                                                        const void*              beta,
+                                                        const void* const        c[],
+                                                        const rocblas_int*       ldc,
+                                                        void* const              d[],
+                                                        const rocblas_int*       ldd,
+                                                        rocblas_int              group_count,
+                                                        const rocblas_operation* trans_a_array,
+                                                        const rocblas_operation* trans_b_array)
+    {
+        // The source kernels load device scalars themselves
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            rocblas_gemm_source_grouped_solution(trans_a,
+                                                 trans_b,
+                                                 group_count,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 (const T*)alpha,
+                                                 (const T* const*)a,
+                                                 lda,
+                                                 (const T* const*)b,
+                                                 ldb,
+                                                 (const T*)beta,
+                                                 (const T* const*)c,
+                                                 ldc,
+                                                 (T* const*)d,
+                                                 ldd,
+                                                 handle->get_stream(),
+                                                 trans_a_array,
+                                                 trans_b_array);
+        else
+            rocblas_gemm_source_grouped_solution(trans_a,
+                                                 trans_b,
+                                                 group_count,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 *(const T*)alpha,
+                                                 (const T* const*)a,
+                                                 lda,
+                                                 (const T* const*)b,
+                                                 ldb,
+                                                 *(const T*)beta,
+                                                 (const T* const*)c,
+                                                 ldc,
+                                                 (T* const*)d,
+                                                 ldd,
+                                                 handle->get_stream(),
+                                                 trans_a_array,
+                                                 trans_b_array);
+        return rocblas_status_success;
+    }
+
+    // Single launch over all groups, or one per combination of operations if they vary per
+    // group, reading the sizes on the device
+    rocblas_status rocblas_gemm_grouped_source(rocblas_handle           handle,
+                                               rocblas_operation        trans_a,
+                                               rocblas_operation        trans_b,
+                                               const rocblas_int*       m,
+                                               const rocblas_int*       n,
+                                               const rocblas_int*       k,
+                                               const void*              alpha,
+                                               const void* const        a[],
+                                               rocblas_datatype         a_type,
+                                               const rocblas_int*       lda,
+                                               const void* const        b[],
+                                               const rocblas_int*       ldb,
+                                               const void*              beta,
+                                               const void* const        c[],
+                                               const rocblas_int*       ldc,
+                                               void* const              d[],
+                                               const rocblas_int*       ldd,
+                                               rocblas_int              group_count,
+                                               const rocblas_operation* trans_a_array,
+                                               const rocblas_operation* trans_b_array)
+    {
+#define GROUPED_SOURCE_PARM                                                                      \
+    handle, trans_a, trans_b, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, d, ldd, group_count, \
+        trans_a_array, trans_b_array
+
+        switch(a_type)
+        {
+        case rocblas_datatype_f32_r:
+            return rocblas_gemm_grouped_source_template<float>(GROUPED_SOURCE_PARM);
+        case rocblas_datatype_f64_r:
+            return rocblas_gemm_grouped_source_template<double>(GROUPED_SOURCE_PARM);
+        case rocblas_datatype_f32_c:
+            return rocblas_gemm_grouped_source_template<rocblas_float_complex>(
+                GROUPED_SOURCE_PARM);
+        case rocblas_datatype_f64_c:
+            return rocblas_gemm_grouped_source_template<rocblas_double_complex>(
+                GROUPED_SOURCE_PARM);
+        default:
+            return rocblas_status_not_implemented;
+        }
+
+#undef GROUPED_SOURCE_PARM
+    }
+
+#ifdef BUILD_WITH_TENSILE
+    // Number of per-group size arrays: m, n, k, lda, ldb, ldc, ldd
+    constexpr int GROUPED_DIMS = 7;
+
+    // Number of per-group matrix pointer arrays: a, b, c, d
+    constexpr int GROUPED_MATRICES = 4;
+
+    // Copies the sizes, the operations if they vary per group and the matrix pointers to the
+    // host, and runs all the groups with equal operations and sizes as one batched Tensile
+    // contraction problem, in the order of their first occurrence. When this reorders the
+    // groups, their matrix pointers are gathered in the new order into device memory.
+    rocblas_status rocblas_gemm_grouped_tensile(rocblas_handle           handle,
+                                                rocblas_operation        trans_a,
+                                                rocblas_operation        trans_b,
+                                                const rocblas_operation* trans_a_array,
+                                                const rocblas_operation* trans_b_array,
+                                                const rocblas_int*       m,
+                                                const rocblas_int*       n,
+                                                const rocblas_int*       k,
+                                                const void*              alpha,
+                                                const void* const        a[],
+                                                rocblas_datatype         a_type,
+                                                const rocblas_int*       lda,
+                                                const void* const        b[],
+                                                rocblas_datatype         b_type,
+                                                const rocblas_int*       ldb,
+                                                const void*              beta,
+                                                const void* const        c[],
+                                                rocblas_datatype         c_type,
+                                                const rocblas_int*       ldc,
+                                                void* const              d[],
+                                                rocblas_datatype         d_type,
+                                                const rocblas_int*       ldd,
+                                                rocblas_int              group_count,
+                                                rocblas_datatype         compute_type,
+                                                rocblas_gemm_algo        algo,
+                                                int32_t                  solution_index,
+                                                uint32_t                 flags)
+    {
+        hipStream_t          stream = handle->get_stream();
+        const rocblas_int*   dims_d[GROUPED_DIMS] = {m, n, k, lda, ldb, ldc, ldd};
+        std::vector<int32_t> dims_h(size_t(group_count) * GROUPED_DIMS);
+        for(int i = 0; i < GROUPED_DIMS; i++)
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&dims_h[size_t(i) * group_count],
+                                               dims_d[i],
+                                               sizeof(rocblas_int) * group_count,
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+
+        std::vector<rocblas_operation> ops_h(size_t(group_count) * 2, trans_a);
+        std::fill(ops_h.begin() + group_count, ops_h.end(), trans_b);
+        const rocblas_operation* ops_d[2] = {trans_a_array, trans_b_array};
+        for(int i = 0; i < 2; i++)
+            if(ops_d[i])
+                RETURN_IF_HIP_ERROR(hipMemcpyAsync(&ops_h[size_t(i) * group_count],
+                                                   ops_d[i],
+                                                   sizeof(rocblas_operation) * group_count,
+                                                   hipMemcpyDeviceToHost,
+                                                   stream));
+
+        const void* const* ptrs_d[GROUPED_MATRICES] = {a, b, c, (const void* const*)d};
+        std::vector<const void*> ptrs_h(size_t(group_count) * GROUPED_MATRICES);
+        for(int i = 0; i < GROUPED_MATRICES; i++)
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&ptrs_h[size_t(i) * group_count],
+                                               ptrs_d[i],
+                                               sizeof(void*) * group_count,
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+
+        // Copy alpha and beta to host if on device; they are shared by all groups
+        rocblas_union_t alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, 1, compute_type));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        auto dim = [&](int i, rocblas_int g) { return dims_h[size_t(i) * group_count + g]; };
+        auto op  = [&](int i, rocblas_int g) { return ops_h[size_t(i) * group_count + g]; };
+
+        // All groups are validated before any work is enqueued
+        for(rocblas_int g = 0; g < group_count; g++)
+        {
+            for(int i = 0; i < 2; i++)
+                if(op(i, g) != rocblas_operation_none && op(i, g) != rocblas_operation_transpose
+                   && op(i, g) != rocblas_operation_conjugate_transpose)
+                    return rocblas_status_invalid_value;
+
+            auto validArgs = rocblas_validateArgs(handle,
+                                                  op(0, g),
+                                                  op(1, g),
+                                                  dim(0, g),
+                                                  dim(1, g),
+                                                  dim(2, g),
+                                                  alpha,
+                                                  a,
+                                                  dim(3, g),
+                                                  b,
+                                                  dim(4, g),
+                                                  beta,
+                                                  c,
+                                                  c_type,
+                                                  dim(5, g),
+                                                  d,
+                                                  d_type,
+                                                  dim(6, g),
+                                                  compute_type);
+            if(validArgs != rocblas_status_continue && validArgs != rocblas_status_success)
+                return validArgs;
+        }
+
+        // Each distinct Tensile problem, numbered in the order of its first group, and the
+        // groups in the order of their problems, keeping their order within a problem
+        using problem_key = std::array<int32_t, GROUPED_DIMS + 2>;
+        auto key          = [&](rocblas_int g) {
+            problem_key value{int32_t(op(0, g)), int32_t(op(1, g))};
+            for(int i = 0; i < GROUPED_DIMS; i++)
+                value[i + 2] = dim(i, g);
+            return value;
+        };
+
+        std::map<problem_key, rocblas_int> problem_index;
+        std::vector<rocblas_int>           problem(group_count), order(group_count);
+        for(rocblas_int g = 0; g < group_count; g++)
+            problem[g] = problem_index.emplace(key(g), rocblas_int(problem_index.size()))
+                             .first->second;
+
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](rocblas_int g0, rocblas_int g1) {
+            return problem[g0] < problem[g1];
+        });
+        const bool reordered = !std::is_sorted(order.begin(), order.end());
+
+        // One batched gemm per problem, over the positions [p0, p1) of its groups in the
+        // pointer arrays
+        auto run_problems = [&](const void* const* a_sorted,
+                                const void* const* b_sorted,
+                                const void* const* c_sorted,
+                                void* const*       d_sorted) {
+            bool size_increased = false;
+            for(rocblas_int p0 = 0, p1; p0 < group_count; p0 = p1)
+            {
+                rocblas_int g0 = order[p0];
+                for(p1 = p0 + 1; p1 < group_count && problem[order[p1]] == problem[g0]; p1++)
+                    ;
+
+                rocblas_status status = rocblas_gemm_ex_template<true>(handle,
+                                                                       op(0, g0),
+                                                                       op(1, g0),
+                                                                       dim(0, g0),
+                                                                       dim(1, g0),
+                                                                       dim(2, g0),
+                                                                       alpha,
+                                                                       a_sorted + p0,
+                                                                       a_type,
+                                                                       0,
+                                                                       dim(3, g0),
+                                                                       0,
+                                                                       b_sorted + p0,
+                                                                       b_type,
+                                                                       0,
+                                                                       dim(4, g0),
+                                                                       0,
+                                                                       beta,
+                                                                       c_sorted + p0,
+                                                                       c_type,
+                                                                       0,
+                                                                       dim(5, g0),
+                                                                       0,
+                                                                       d_sorted + p0,
+                                                                       d_type,
+                                                                       0,
+                                                                       dim(6, g0),
+                                                                       0,
+                                                                       p1 - p0,
+                                                                       compute_type,
+                                                                       algo,
+                                                                       solution_index,
+                                                                       flags);
+                if(status == rocblas_status_size_increased)
+                    size_increased = true;
+                else if(status != rocblas_status_success
+                        && status != rocblas_status_size_unchanged)
+                    return status;
+            }
+
+            if(handle->is_device_memory_size_query())
+                return size_increased ? rocblas_status_size_increased
+                                      : rocblas_status_size_unchanged;
+            return rocblas_status_success;
+        };
+
+        if(!reordered)
+            return run_problems(a, b, c, d);
+
+        // The gathered pointers are kept in device memory while the problems are run
+        size_t gather_bytes = sizeof(void*) * GROUPED_MATRICES * group_count;
+        if(handle->is_device_memory_size_query())
+        {
+            size_t problems_bytes;
+            RETURN_IF_ROCBLAS_ERROR(handle->query_device_memory_size(
+                &problems_bytes, [&] { return run_problems(a, b, c, d); }));
+            return handle->set_optimal_device_memory_size(gather_bytes, problems_bytes);
+        }
+
+        auto w_mem = handle->device_malloc(gather_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        std::vector<const void*> sorted_h(ptrs_h.size());
+        for(int i = 0; i < GROUPED_MATRICES; i++)
+            for(rocblas_int p = 0; p < group_count; p++)
+                sorted_h[size_t(i) * group_count + p] = ptrs_h[size_t(i) * group_count + order[p]];
+
+        const void** sorted_d = (const void**)w_mem;
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(sorted_d, sorted_h.data(), gather_bytes, hipMemcpyHostToDevice, stream));
+        // sorted_h is released on return
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        return run_problems(sorted_d,
+                            sorted_d + group_count,
+                            sorted_d + size_t(2) * group_count,
+                            (void* const*)(sorted_d + size_t(3) * group_count));
+    }
+#endif // BUILD_WITH_TENSILE
+
+    // rocblas_gemm_grouped_ex, with trans_a_array and trans_b_array null, and
+    // rocblas_gemm_grouped_trans_ex (PER_GROUP_OPS), with the device arrays of the per-group
+    // operations, trans_a and trans_b being ignored
+    template <bool PER_GROUP_OPS>
+    rocblas_status rocblas_gemm_grouped_ex_impl(const char*              name,
+                                                rocblas_handle           handle,
+                                                rocblas_operation        trans_a,
+                                                rocblas_operation        trans_b,
+                                                const rocblas_operation* trans_a_array,
+                                                const rocblas_operation* trans_b_array,
+                                                const rocblas_int*       m,
+                                                const rocblas_int*       n,
+                                                const rocblas_int*       k,
+                                                const void*              alpha,
+                                                const void* const        a[],
+                                                rocblas_datatype         a_type,
+                                                const rocblas_int*       lda,
+                                                const void* const        b[],
+                                                rocblas_datatype         b_type,
+                                                const rocblas_int*       ldb,
+                                                const void*              beta,
+                                                const void* const        c[],
+                                                rocblas_datatype         c_type,
+                                                const rocblas_int*       ldc,
+                                                void* const              d[],
+                                                rocblas_datatype         d_type,
+                                                const rocblas_int*       ldd,
+                                                rocblas_int              group_count,
+                                                rocblas_datatype         compute_type,
+                                                rocblas_gemm_algo        algo,
+                                                int32_t                  solution_index,
+                                                uint32_t                 flags)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        const bool source = rocblas_gemm_grouped_source_supported(
+            a_type, b_type, c_type, d_type, compute_type);
+
+#ifdef BUILD_WITH_TENSILE
+        // The Tensile path needs the sizes on the host, which requires synchronizing the
+        // stream. That is not allowed in graph safe mode or while the stream is being captured
+        // into a graph. Its device memory depends on the sizes, so they are read in a query too.
+        const bool graph_safe = handle->is_graph_safe();
+        const bool use_source = source && graph_safe;
+        if(use_source)
+            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+#else
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+#endif
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(layer_mode & rocblas_layer_mode_log_trace)
+        {
+            rocblas_internal_ostream alphass, betass;
+            if(handle->pointer_mode == rocblas_pointer_mode_device
+               || log_trace_alpha_beta_ex(compute_type, alpha, beta, alphass, betass)
+                      != rocblas_status_success)
+            {
+                alphass << alpha;
+                betass << beta;
+            }
+
+            // The per-group operations are on the device, so their arrays are logged
+            auto log_ops = [&](auto ops_a, auto ops_b) {
+                log_trace(handle,
+                          name,
+                          ops_a,
+                          ops_b,
+                          m,
+                          n,
+                          k,
+                          alphass.str(),
+                          a,
+                          rocblas_datatype_string(a_type),
+                          lda,
+                          b,
+                          rocblas_datatype_string(b_type),
+                          ldb,
+                          betass.str(),
+                          c,
+                          rocblas_datatype_string(c_type),
+                          ldc,
+                          d,
+                          rocblas_datatype_string(d_type),
+                          ldd,
+                          group_count,
+                          rocblas_datatype_string(compute_type),
+                          algo,
+                          solution_index,
+                          rocblas_gemm_flags(flags));
+            };
+            if(PER_GROUP_OPS)
+                log_ops(trans_a_array, trans_b_array);
+            else
+                log_ops(trans_a, trans_b);
+        }
+
+        if(!PER_GROUP_OPS)
+        {
+            if(trans_a != rocblas_operation_none && trans_a != rocblas_operation_transpose
+               && trans_a != rocblas_operation_conjugate_transpose)
+                return rocblas_status_invalid_value;
+            if(trans_b != rocblas_operation_none && trans_b != rocblas_operation_transpose
+               && trans_b != rocblas_operation_conjugate_transpose)
+                return rocblas_status_invalid_value;
+        }
+
+        if(group_count < 0)
+            return rocblas_status_invalid_size;
+        if(!group_count)
+            return rocblas_status_success;
+
+        if(!m || !n || !k || !lda || !ldb || !ldc || !ldd || !alpha || !beta || !a || !b || !c
+           || !d || (PER_GROUP_OPS && (!trans_a_array || !trans_b_array)))
+            return rocblas_status_invalid_pointer;
+
+#ifdef BUILD_WITH_TENSILE
+        if(graph_safe && !use_source)
+            return rocblas_status_not_implemented;
+
+        if(!use_source)
+            return rocblas_gemm_grouped_tensile(handle,
+                                                trans_a,
+                                                trans_b,
+                                                trans_a_array,
+                                                trans_b_array,
+                                                m,
+                                                n,
+                                                k,
+                                                alpha,
+                                                a,
+                                                a_type,
+                                                lda,
+                                                b,
+                                                b_type,
+                                                ldb,
+                                                beta,
+                                                c,
+                                                c_type,
+                                                ldc,
+                                                d,
+                                                d_type,
+                                                ldd,
+                                                group_count,
+                                                compute_type,
+                                                algo,
+                                                solution_index,
+                                                flags);
+#endif
+
+        if(!source)
+            return rocblas_status_not_implemented;
+
+        return rocblas_gemm_grouped_source(handle,
+                                           trans_a,
+                                           trans_b,
+                                           m,
+                                           n,
+                                           k,
+                                           alpha,
+                                           a,
+                                           a_type,
+                                           lda,
+                                           b,
+                                           ldb,
+                                           beta,
+                                           c,
+                                           ldc,
+                                           d,
+                                           ldd,
+                                           group_count,
+                                           trans_a_array,
+                                           trans_b_array);
+    }
+}
+
+extern "C" rocblas_status rocblas_gemm_grouped_ex(rocblas_handle     handle,
+                                                  rocblas_operation  trans_a,
+                                                  rocblas_operation  trans_b,
+                                                  const rocblas_int* m,
+                                                  const rocblas_int* n,
+                                                  const rocblas_int* k,
+                                                  const void*        alpha,
+                                                  const void* const  a[],
+                                                  rocblas_datatype   a_type,
+                                                  const rocblas_int* lda,
+                                                  const void* const  b[],
+                                                  rocblas_datatype   b_type,
+                                                  const rocblas_int* ldb,
+                                                  const void*        beta,
+                                                  const void* const  c[],
+                                                  rocblas_datatype   c_type,
+                                                  const rocblas_int* ldc,
+                                                  void* const        d[],
+                                                  rocblas_datatype   d_type,
+                                                  const rocblas_int* ldd,
+                                                  rocblas_int        group_count,
+                                                  rocblas_datatype   compute_type,
+                                                  rocblas_gemm_algo  algo,
+                                                  int32_t            solution_index,
+                                                  uint32_t           flags)
+try
+{
+    return rocblas_gemm_grouped_ex_impl<false>("rocblas_gemm_grouped_ex",
+                                               handle,
+                                               trans_a,
+                                               trans_b,
+                                               nullptr,
+                                               nullptr,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha,
+                                               a,
+                                               a_type,
+                                               lda,
+                                               b,
+                                               b_type,
+                                               ldb,
+                                               beta,
+                                               c,
+                                               c_type,
+                                               ldc,
+                                               d,
+                                               d_type,
+                                               ldd,
+                                               group_count,
+                                               compute_type,
+                                               algo,
+                                               solution_index,
+                                               flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_gemm_grouped_trans_ex(rocblas_handle           handle,
+                                                        const rocblas_operation* trans_a,
+                                                        const rocblas_operation* trans_b,
+                                                        const rocblas_int*       m,
+                                                        const rocblas_int*       n,
+                                                        const rocblas_int*       k,
+                                                        const void*              alpha,
+                                                        const void* const        a[],
+                                                        rocblas_datatype         a_type,
+                                                        const rocblas_int*       lda,
+                                                        const void* const        b[],
+                                                        rocblas_datatype         b_type,
+                                                        const rocblas_int*       ldb,
+                                                        const void*              beta,
+                                                        const void* const        c[],
+                                                        rocblas_datatype         c_type,
+                                                        const rocblas_int*       ldc,
+                                                        void* const              d[],
+                                                        rocblas_datatype         d_type,
+                                                        const rocblas_int*       ldd,
+                                                        rocblas_int              group_count,
+                                                        rocblas_datatype         compute_type,
+                                                        rocblas_gemm_algo        algo,
+                                                        int32_t                  solution_index,
+                                                        uint32_t                 flags)
+try
+{
+    return rocblas_gemm_grouped_ex_impl<true>("rocblas_gemm_grouped_trans_ex",
+                                              handle,
+                                              rocblas_operation_none,
+                                              rocblas_operation_none,
+                                              trans_a,
+                                              trans_b,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              a,
+                                              a_type,
+                                              lda,
+                                              b,
+                                              b_type,
+                                              ldb,
+                                              beta,
+                                              c,
+                                              c_type,
+                                              ldc,
+                                              d,
+                                              d_type,
+                                              ldd,
+                                              group_count,
+                                              compute_type,
+                                              algo,
+                                              solution_index,
+                                              flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
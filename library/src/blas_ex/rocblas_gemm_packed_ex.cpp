@@ -0,0 +1,346 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+
+/*
+ * B of rocblas_gemm_packed_ex, held as op(B) in a k x n column major matrix of type,
+ * whose columns start on GEMM_PACK_ALIGN byte boundaries
+ */
+struct _rocblas_gemm_packed_b
+{
+    int              device;
+    rocblas_datatype type;
+    rocblas_int      k;
+    rocblas_int      n;
+    rocblas_int      ld;
+    void*            data = nullptr;
+
+    ~_rocblas_gemm_packed_b()
+    {
+        if(data)
+            (void)(hipFree)(data);
+    }
+};
+
+namespace
+{
+    constexpr int    GEMM_PACK_DIM_X = 64;
+    constexpr int    GEMM_PACK_DIM_Y = 4;
+    constexpr size_t GEMM_PACK_ALIGN = 128;
+
+    template <typename To, typename Ti>
+    __device__ To rocblas_gemm_pack_convert(Ti x, bool)
+    {
+        return To(x);
+    }
+
+    // FP8 and BF8 values are exactly representable in rocblas_half and rocblas_bfloat16
+    template <typename To>
+    __device__ To rocblas_gemm_pack_convert(uint8_t x, bool bf8)
+    {
+        return To(bf8 ? rocblas_f8_to_float<5, 2>(x) : rocblas_f8_to_float<4, 3>(x));
+    }
+
+    // P(row, col) = op(B)(row, col) for row < k, and 0 in the padding rows up to ldp
+    template <int DIM_X, int DIM_Y, typename Ti, typename To>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_gemm_pack_b_kernel(rocblas_int k,
+                               rocblas_int n,
+                               bool        trans,
+                               bool        conj_b,
+                               bool        bf8,
+                               const Ti*   B,
+                               rocblas_int ldb,
+                               To*         P,
+                               rocblas_int ldp)
+    {
+        auto tx = blockIdx.x * DIM_X + threadIdx.x;
+        auto ty = blockIdx.y * DIM_Y + threadIdx.y;
+
+        if(tx < ldp && ty < n)
+        {
+            To v = To(0);
+            if(tx < k)
+            {
+                v = rocblas_gemm_pack_convert<To>(
+                    B[trans ? ty + tx * size_t(ldb) : tx + ty * size_t(ldb)], bf8);
+                if(conj_b)
+                    v = conj(v);
+            }
+            P[tx + ty * size_t(ldp)] = v;
+        }
+    }
+
+    template <typename Ti, typename To>
+    rocblas_status rocblas_gemm_pack_b_template(rocblas_handle          handle,
+                                                rocblas_operation       trans_b,
+                                                const void*             b,
+                                                rocblas_datatype        b_type,
+                                                rocblas_int             ldb,
+                                                _rocblas_gemm_packed_b* packed)
+    {
+        dim3 grid((packed->ld - 1) / GEMM_PACK_DIM_X + 1, (packed->n - 1) / GEMM_PACK_DIM_Y + 1);
+        dim3 threads(GEMM_PACK_DIM_X, GEMM_PACK_DIM_Y);
+
+        hipLaunchKernelGGL((rocblas_gemm_pack_b_kernel<GEMM_PACK_DIM_X, GEMM_PACK_DIM_Y, Ti, To>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           packed->k,
+                           packed->n,
+                           trans_b != rocblas_operation_none,
+                           trans_b == rocblas_operation_conjugate_transpose,
+                           b_type == rocblas_datatype_bf8_r,
+                           (const Ti*)b,
+                           ldb,
+                           (To*)packed->data,
+                           packed->ld);
+
+        return rocblas_status_success;
+    }
+
+    bool rocblas_gemm_pack_b_type_supported(rocblas_datatype b_type, rocblas_datatype type)
+    {
+        if(rocblas_is_f8_datatype(b_type))
+            return type == rocblas_datatype_f16_r || type == rocblas_datatype_bf16_r;
+
+        return b_type == type
+               && (type == rocblas_datatype_f16_r || type == rocblas_datatype_bf16_r
+                   || type == rocblas_datatype_f32_r || type == rocblas_datatype_f64_r
+                   || type == rocblas_datatype_f32_c || type == rocblas_datatype_f64_c
+                   || type == rocblas_datatype_i8_r);
+    }
+
+    rocblas_status rocblas_gemm_pack_b_dispatch(rocblas_handle          handle,
+                                                rocblas_operation       trans_b,
+                                                const void*             b,
+                                                rocblas_datatype        b_type,
+                                                rocblas_int             ldb,
+                                                _rocblas_gemm_packed_b* packed)
+    {
+#define PACK_PARM handle, trans_b, b, b_type, ldb, packed
+
+        const rocblas_datatype type = packed->type;
+        if(rocblas_is_f8_datatype(b_type) && type == rocblas_datatype_f16_r)
+            return rocblas_gemm_pack_b_template<uint8_t, rocblas_half>(PACK_PARM);
+        else if(rocblas_is_f8_datatype(b_type) && type == rocblas_datatype_bf16_r)
+            return rocblas_gemm_pack_b_template<uint8_t, rocblas_bfloat16>(PACK_PARM);
+        else if(b_type != type)
+            return rocblas_status_not_implemented;
+        else if(type == rocblas_datatype_f16_r)
+            return rocblas_gemm_pack_b_template<rocblas_half, rocblas_half>(PACK_PARM);
+        else if(type == rocblas_datatype_bf16_r)
+            return rocblas_gemm_pack_b_template<rocblas_bfloat16, rocblas_bfloat16>(PACK_PARM);
+        else if(type == rocblas_datatype_f32_r)
+            return rocblas_gemm_pack_b_template<float, float>(PACK_PARM);
+        else if(type == rocblas_datatype_f64_r)
+            return rocblas_gemm_pack_b_template<double, double>(PACK_PARM);
+        else if(type == rocblas_datatype_f32_c)
+            return rocblas_gemm_pack_b_template<rocblas_float_complex, rocblas_float_complex>(
+                PACK_PARM);
+        else if(type == rocblas_datatype_f64_c)
+            return rocblas_gemm_pack_b_template<rocblas_double_complex, rocblas_double_complex>(
+                PACK_PARM);
+        else if(type == rocblas_datatype_i8_r)
+            return rocblas_gemm_pack_b_template<int8_t, int8_t>(PACK_PARM);
+
+#undef PACK_PARM
+
+        return rocblas_status_not_implemented;
+    }
+
+    rocblas_status rocblas_gemm_pack_b_impl(rocblas_handle          handle,
+                                            rocblas_operation       trans_b,
+                                            rocblas_int             k,
+                                            rocblas_int             n,
+                                            const void*             b,
+                                            rocblas_datatype        b_type,
+                                            rocblas_int             ldb,
+                                            rocblas_datatype        packed_type,
+                                            rocblas_gemm_packed_b*  packed)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      "rocblas_gemm_pack_b",
+                      trans_b,
+                      k,
+                      n,
+                      b,
+                      rocblas_datatype_string(b_type),
+                      ldb,
+                      rocblas_datatype_string(packed_type));
+
+        if(!packed)
+            return rocblas_status_invalid_pointer;
+        *packed = nullptr;
+
+        if(trans_b != rocblas_operation_none && trans_b != rocblas_operation_transpose
+           && trans_b != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        if(k < 0 || n < 0 || ldb < (trans_b == rocblas_operation_none ? k : n) || ldb < 1)
+            return rocblas_status_invalid_size;
+
+        if(k && n && !b)
+            return rocblas_status_invalid_pointer;
+
+        if(!rocblas_gemm_pack_b_type_supported(b_type, packed_type))
+            return rocblas_status_not_implemented;
+
+        // The packed B is allocated with hipMalloc, which cannot be captured
+        if(handle->is_graph_safe())
+            return rocblas_status_not_implemented;
+
+        size_t elem = rocblas_sizeof_datatype(packed_type);
+
+        auto p    = std::make_unique<_rocblas_gemm_packed_b>();
+        p->device = handle->getDevice();
+        p->type   = packed_type;
+        p->k      = k;
+        p->n      = n;
+
+        size_t align = std::max<size_t>(GEMM_PACK_ALIGN / elem, 1);
+        size_t ld    = std::max<size_t>(((size_t(k) + align - 1) / align) * align, 1);
+        if(ld > std::numeric_limits<rocblas_int>::max())
+            return rocblas_status_invalid_size;
+        p->ld = rocblas_int(ld);
+
+        if(k && n)
+        {
+            // Temporarily change the thread's default device ID to the handle's device ID
+            // cppcheck-suppress unreadVariable
+            auto saved_device_id = handle->push_device_id();
+
+            RETURN_IF_HIP_ERROR((hipMalloc)(&p->data, elem * ld * n));
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_gemm_pack_b_dispatch(handle, trans_b, b, b_type, ldb, p.get()));
+        }
+
+        *packed = p.release();
+        return rocblas_status_success;
+    }
+}
+// namespace
+
+extern "C" rocblas_status rocblas_gemm_pack_b(rocblas_handle         handle,
+                                              rocblas_operation      trans_b,
+                                              rocblas_int            k,
+                                              rocblas_int            n,
+                                              const void*            b,
+                                              rocblas_datatype       b_type,
+                                              rocblas_int            ldb,
+                                              rocblas_datatype       packed_type,
+                                              rocblas_gemm_packed_b* packed)
+try
+{
+    return rocblas_gemm_pack_b_impl(handle, trans_b, k, n, b, b_type, ldb, packed_type, packed);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_destroy_gemm_packed_b(rocblas_gemm_packed_b packed)
+try
+{
+    delete packed;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_gemm_packed_ex(rocblas_handle        handle,
+                                                 rocblas_operation     trans_a,
+                                                 rocblas_int           m,
+                                                 rocblas_int           n,
+                                                 rocblas_int           k,
+                                                 const void*           alpha,
+                                                 const void*           a,
+                                                 rocblas_datatype      a_type,
+                                                 rocblas_int           lda,
+                                                 rocblas_gemm_packed_b packed_b,
+                                                 const void*           beta,
+                                                 const void*           c,
+                                                 rocblas_datatype      c_type,
+                                                 rocblas_int           ldc,
+                                                 void*                 d,
+                                                 rocblas_datatype      d_type,
+                                                 rocblas_int           ldd,
+                                                 rocblas_datatype      compute_type,
+                                                 rocblas_gemm_algo     algo,
+                                                 uint32_t              flags)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(!packed_b)
+        return rocblas_status_invalid_pointer;
+
+    if(k != packed_b->k || n != packed_b->n)
+        return rocblas_status_invalid_size;
+
+    if(packed_b->device != handle->getDevice() || a_type != packed_b->type)
+        return rocblas_status_invalid_value;
+
+    // The packed B is always op(B) in column major order, so every call with the same sizes
+    // and A layout makes the same Tensile problem and finds it in the solution cache
+    return rocblas_gemm_ex(handle,
+                           trans_a,
+                           rocblas_operation_none,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           a,
+                           a_type,
+                           lda,
+                           packed_b->data,
+                           packed_b->type,
+                           packed_b->ld,
+                           beta,
+                           c,
+                           c_type,
+                           ldc,
+                           d,
+                           d_type,
+                           ldd,
+                           compute_type,
+                           algo,
+                           0,
+                           flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
@@ -0,0 +1,523 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+
+/*
+ * ===========================================================================
+ *    Planar complex gemm: the real and imaginary parts of the complex matrices
+ *    A, B and C are held in separate real arrays with the same leading
+ *    dimension and stride. With op(A) = Ar' + i sa Ai' and op(B) = Br' + i sb Bi',
+ *    where ' is the transpose of op without conjugation and sa, sb are -1 for
+ *    a conjugate transpose, the product P = op(A) * op(B) is
+ *        Pr = Ar' Br' - sa sb Ai' Bi'
+ *        Pi = sb Ar' Bi' + sa Ai' Br'
+ *    four real gemms on the planar arrays, with no interleaving pass.
+ *    For a real alpha they accumulate into C in place, after scaling C by a
+ *    complex beta. For a complex alpha they write P to workspace, and a
+ *    single pass computes C = alpha * P + beta * C.
+ * ===========================================================================
+ */
+
+namespace
+{
+    constexpr int GEMM_PLANAR_DIM_X = 64;
+    constexpr int GEMM_PLANAR_DIM_Y = 4;
+
+    // C = alpha * P + beta * C, or C = beta * C without P, for m x n planar matrices with the
+    // batches in grid z. P is m x n with leading dimension m. C is not read when beta is zero.
+    template <int DIM_X, int DIM_Y, typename T>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_gemm_planar_update_kernel(rocblas_int    m,
+                                      rocblas_int    n,
+                                      T              alpha_r,
+                                      T              alpha_i,
+                                      const T*       Pr,
+                                      const T*       Pi,
+                                      rocblas_stride stride_p,
+                                      T              beta_r,
+                                      T              beta_i,
+                                      T*             Cr,
+                                      T*             Ci,
+                                      rocblas_int    ldc,
+                                      rocblas_stride stride_c)
+    {
+        rocblas_int i = blockIdx.x * DIM_X + threadIdx.x;
+        rocblas_int j = blockIdx.y * DIM_Y + threadIdx.y;
+        if(i >= m || j >= n)
+            return;
+
+        size_t ic = i + j * size_t(ldc) + blockIdx.z * stride_c;
+        T      cr = 0, ci = 0;
+        if(beta_r || beta_i)
+        {
+            T r = Cr[ic], im = Ci[ic];
+            cr  = beta_r * r - beta_i * im;
+            ci  = beta_r * im + beta_i * r;
+        }
+        if(Pr)
+        {
+            size_t ip = i + j * size_t(m) + blockIdx.z * stride_p;
+            T      pr = Pr[ip], pi = Pi[ip];
+            cr += alpha_r * pr - alpha_i * pi;
+            ci += alpha_r * pi + alpha_i * pr;
+        }
+        Cr[ic] = cr;
+        Ci[ic] = ci;
+    }
+
+    template <typename T>
+    void rocblas_gemm_planar_update(rocblas_handle                handle,
+                                    rocblas_int                   m,
+                                    rocblas_int                   n,
+                                    const rocblas_complex_num<T>& alpha,
+                                    const T*                      Pr,
+                                    const T*                      Pi,
+                                    const rocblas_complex_num<T>& beta,
+                                    T*                            Cr,
+                                    T*                            Ci,
+                                    rocblas_int                   ldc,
+                                    rocblas_stride                stride_c,
+                                    rocblas_int                   batch_count)
+    {
+        dim3 grid((m - 1) / GEMM_PLANAR_DIM_X + 1, (n - 1) / GEMM_PLANAR_DIM_Y + 1, batch_count);
+        dim3 threads(GEMM_PLANAR_DIM_X, GEMM_PLANAR_DIM_Y);
+
+        hipLaunchKernelGGL(
+            (rocblas_gemm_planar_update_kernel<GEMM_PLANAR_DIM_X, GEMM_PLANAR_DIM_Y>),
+            grid,
+            threads,
+            0,
+            handle->get_stream(),
+            m,
+            n,
+            alpha.real(),
+            alpha.imag(),
+            Pr,
+            Pi,
+            rocblas_stride(m) * n,
+            beta.real(),
+            beta.imag(),
+            Cr,
+            Ci,
+            ldc,
+            stride_c);
+    }
+
+    // alpha and beta are on the host
+    template <typename T>
+    rocblas_status rocblas_gemm_planar_template(rocblas_handle                handle,
+                                                rocblas_operation             trans_a,
+                                                rocblas_operation             trans_b,
+                                                rocblas_int                   m,
+                                                rocblas_int                   n,
+                                                rocblas_int                   k,
+                                                const rocblas_complex_num<T>* alpha,
+                                                const T*                      a_real,
+                                                const T*                      a_imag,
+                                                rocblas_int                   lda,
+                                                rocblas_stride                stride_a,
+                                                const T*                      b_real,
+                                                const T*                      b_imag,
+                                                rocblas_int                   ldb,
+                                                rocblas_stride                stride_b,
+                                                const rocblas_complex_num<T>* beta,
+                                                T*                            c_real,
+                                                T*                            c_imag,
+                                                rocblas_int                   ldc,
+                                                rocblas_stride                stride_c,
+                                                rocblas_int                   batch_count,
+                                                uint32_t                      flags)
+    {
+        constexpr rocblas_datatype type = rocblas_datatype_from_type<T>;
+
+        const T sa = trans_a == rocblas_operation_conjugate_transpose ? -1 : 1;
+        const T sb = trans_b == rocblas_operation_conjugate_transpose ? -1 : 1;
+        const rocblas_operation op_a
+            = trans_a == rocblas_operation_none ? trans_a : rocblas_operation_transpose;
+        const rocblas_operation op_b
+            = trans_b == rocblas_operation_none ? trans_b : rocblas_operation_transpose;
+
+        // c = alpha_g * op(a) * op(b) + beta_g * c in place
+        auto gemm = [&](const T*       a,
+                        const T*       b,
+                        T              alpha_g,
+                        T              beta_g,
+                        T*             c,
+                        rocblas_int    ld,
+                        rocblas_stride stride) {
+            rocblas_status status = rocblas_gemm_strided_batched_ex(handle,
+                                                                    op_a,
+                                                                    op_b,
+                                                                    m,
+                                                                    n,
+                                                                    k,
+                                                                    &alpha_g,
+                                                                    a,
+                                                                    type,
+                                                                    lda,
+                                                                    stride_a,
+                                                                    b,
+                                                                    type,
+                                                                    ldb,
+                                                                    stride_b,
+                                                                    &beta_g,
+                                                                    c,
+                                                                    type,
+                                                                    ld,
+                                                                    stride,
+                                                                    c,
+                                                                    type,
+                                                                    ld,
+                                                                    stride,
+                                                                    batch_count,
+                                                                    type,
+                                                                    rocblas_gemm_algo_standard,
+                                                                    0,
+                                                                    flags);
+            return status == rocblas_status_size_unchanged
+                           || status == rocblas_status_size_increased
+                       ? rocblas_status_success
+                       : status;
+        };
+
+        // Pr (Pi) = alpha_g * real (imaginary) part of op(A) * op(B) + beta_g * Pr (Pi)
+        auto gemms = [&](T              alpha_g,
+                         T              beta_g,
+                         T*             pr,
+                         T*             pi,
+                         rocblas_int    ld,
+                         rocblas_stride stride) {
+            RETURN_IF_ROCBLAS_ERROR(gemm(a_real, b_real, alpha_g, beta_g, pr, ld, stride));
+            RETURN_IF_ROCBLAS_ERROR(gemm(a_imag, b_imag, -sa * sb * alpha_g, 1, pr, ld, stride));
+            RETURN_IF_ROCBLAS_ERROR(gemm(a_real, b_imag, sb * alpha_g, beta_g, pi, ld, stride));
+            return gemm(a_imag, b_real, sa * alpha_g, 1, pi, ld, stride);
+        };
+
+        size_t p_size = sizeof(T) * 2 * m * n * batch_count;
+        if(handle->is_device_memory_size_query())
+        {
+            // The gemms are queried with C standing in for the workspace, which is validated but
+            // not dereferenced
+            size_t gemms_size;
+            RETURN_IF_ROCBLAS_ERROR(handle->query_device_memory_size(
+                &gemms_size, [&] { return gemms(1, 0, c_real, c_imag, ldc, stride_c); }));
+            return handle->set_optimal_device_memory_size(p_size, gemms_size);
+        }
+
+        const rocblas_complex_num<T> zero = 0;
+        if(!k || !*alpha)
+        {
+            if(*beta != 1)
+                rocblas_gemm_planar_update<T>(handle,
+                                              m,
+                                              n,
+                                              zero,
+                                              nullptr,
+                                              nullptr,
+                                              *beta,
+                                              c_real,
+                                              c_imag,
+                                              ldc,
+                                              stride_c,
+                                              batch_count);
+            return rocblas_status_success;
+        }
+
+        if(!alpha->imag())
+        {
+            T beta_g = beta->real();
+            if(beta->imag())
+            {
+                rocblas_gemm_planar_update<T>(handle,
+                                              m,
+                                              n,
+                                              zero,
+                                              nullptr,
+                                              nullptr,
+                                              *beta,
+                                              c_real,
+                                              c_imag,
+                                              ldc,
+                                              stride_c,
+                                              batch_count);
+                beta_g = 1;
+            }
+            return gemms(alpha->real(), beta_g, c_real, c_imag, ldc, stride_c);
+        }
+
+        auto w_mem = handle->device_malloc(p_size);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        rocblas_stride stride_p = rocblas_stride(m) * n;
+        T*             p_real   = (T*)w_mem;
+        T*             p_imag   = p_real + stride_p * batch_count;
+        RETURN_IF_ROCBLAS_ERROR(gemms(1, 0, p_real, p_imag, m, stride_p));
+
+        rocblas_gemm_planar_update<T>(handle,
+                                      m,
+                                      n,
+                                      *alpha,
+                                      p_real,
+                                      p_imag,
+                                      *beta,
+                                      c_real,
+                                      c_imag,
+                                      ldc,
+                                      stride_c,
+                                      batch_count);
+        return rocblas_status_success;
+    }
+
+    rocblas_status rocblas_gemm_planar_ex_impl(const char*       name,
+                                               rocblas_handle    handle,
+                                               rocblas_operation trans_a,
+                                               rocblas_operation trans_b,
+                                               rocblas_int       m,
+                                               rocblas_int       n,
+                                               rocblas_int       k,
+                                               const void*       alpha,
+                                               const void*       a_real,
+                                               const void*       a_imag,
+                                               rocblas_datatype  a_type,
+                                               rocblas_int       lda,
+                                               rocblas_stride    stride_a,
+                                               const void*       b_real,
+                                               const void*       b_imag,
+                                               rocblas_datatype  b_type,
+                                               rocblas_int       ldb,
+                                               rocblas_stride    stride_b,
+                                               const void*       beta,
+                                               void*             c_real,
+                                               void*             c_imag,
+                                               rocblas_datatype  c_type,
+                                               rocblas_int       ldc,
+                                               rocblas_stride    stride_c,
+                                               rocblas_int       batch_count,
+                                               rocblas_datatype  compute_type,
+                                               uint32_t          flags)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        if(!handle->is_device_memory_size_query()
+           && handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      name,
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      alpha,
+                      a_real,
+                      a_imag,
+                      rocblas_datatype_string(a_type),
+                      lda,
+                      stride_a,
+                      b_real,
+                      b_imag,
+                      rocblas_datatype_string(b_type),
+                      ldb,
+                      stride_b,
+                      beta,
+                      c_real,
+                      c_imag,
+                      rocblas_datatype_string(c_type),
+                      ldc,
+                      stride_c,
+                      batch_count,
+                      rocblas_datatype_string(compute_type),
+                      flags);
+
+        for(auto trans : {trans_a, trans_b})
+            if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+               && trans != rocblas_operation_conjugate_transpose)
+                return rocblas_status_invalid_value;
+
+        rocblas_int a_rows = trans_a == rocblas_operation_none ? m : k;
+        rocblas_int b_rows = trans_b == rocblas_operation_none ? k : n;
+        if(m < 0 || n < 0 || k < 0 || batch_count < 0 || lda < std::max(1, a_rows)
+           || ldb < std::max(1, b_rows) || ldc < std::max(1, m))
+            return rocblas_status_invalid_size;
+
+        // The planar arrays are of the real type of the complex types, only the same for all
+        if(a_type != compute_type || b_type != compute_type || c_type != compute_type
+           || (compute_type != rocblas_datatype_f32_c && compute_type != rocblas_datatype_f64_c))
+            return rocblas_status_not_implemented;
+
+        if(!m || !n || !batch_count)
+        {
+            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+            return rocblas_status_success;
+        }
+
+        if(!handle->is_device_memory_size_query()
+           && (!alpha || !beta || !c_real || !c_imag
+               || (k && (!a_real || !a_imag || !b_real || !b_imag))))
+            return rocblas_status_invalid_pointer;
+
+        rocblas_union_t alpha_h, beta_h;
+        if(!handle->is_device_memory_size_query())
+            RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+                handle, alpha, beta, alpha_h, beta_h, k, compute_type));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+#define GEMM_PLANAR_PARM(T_, Tc_)                                                               \
+    handle, trans_a, trans_b, m, n, k, (const Tc_*)alpha, (const T_*)a_real, (const T_*)a_imag, \
+        lda, stride_a, (const T_*)b_real, (const T_*)b_imag, ldb, stride_b, (const Tc_*)beta,   \
+        (T_*)c_real, (T_*)c_imag, ldc, stride_c, batch_count, flags
+
+        if(compute_type == rocblas_datatype_f32_c)
+            return rocblas_gemm_planar_template<float>(
+                GEMM_PLANAR_PARM(float, rocblas_float_complex));
+        else
+            return rocblas_gemm_planar_template<double>(
+                GEMM_PLANAR_PARM(double, rocblas_double_complex));
+
+#undef GEMM_PLANAR_PARM
+    }
+}
+// namespace
+
+extern "C" rocblas_status rocblas_gemm_planar_ex(rocblas_handle    handle,
+                                                 rocblas_operation trans_a,
+                                                 rocblas_operation trans_b,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 rocblas_int       k,
+                                                 const void*       alpha,
+                                                 const void*       a_real,
+                                                 const void*       a_imag,
+                                                 rocblas_datatype  a_type,
+                                                 rocblas_int       lda,
+                                                 const void*       b_real,
+                                                 const void*       b_imag,
+                                                 rocblas_datatype  b_type,
+                                                 rocblas_int       ldb,
+                                                 const void*       beta,
+                                                 void*             c_real,
+                                                 void*             c_imag,
+                                                 rocblas_datatype  c_type,
+                                                 rocblas_int       ldc,
+                                                 rocblas_datatype  compute_type,
+                                                 uint32_t          flags)
+try
+{
+    return rocblas_gemm_planar_ex_impl("rocblas_gemm_planar_ex",
+                                       handle,
+                                       trans_a,
+                                       trans_b,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       a_real,
+                                       a_imag,
+                                       a_type,
+                                       lda,
+                                       0,
+                                       b_real,
+                                       b_imag,
+                                       b_type,
+                                       ldb,
+                                       0,
+                                       beta,
+                                       c_real,
+                                       c_imag,
+                                       c_type,
+                                       ldc,
+                                       0,
+                                       1,
+                                       compute_type,
+                                       flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_gemm_strided_batched_planar_ex(rocblas_handle    handle,
+                                                                 rocblas_operation trans_a,
+                                                                 rocblas_operation trans_b,
+                                                                 rocblas_int       m,
+                                                                 rocblas_int       n,
+                                                                 rocblas_int       k,
+                                                                 const void*       alpha,
+                                                                 const void*       a_real,
+                                                                 const void*       a_imag,
+                                                                 rocblas_datatype  a_type,
+                                                                 rocblas_int       lda,
+                                                                 rocblas_stride    stride_a,
+                                                                 const void*       b_real,
+                                                                 const void*       b_imag,
+                                                                 rocblas_datatype  b_type,
+                                                                 rocblas_int       ldb,
+                                                                 rocblas_stride    stride_b,
+                                                                 const void*       beta,
+                                                                 void*             c_real,
+                                                                 void*             c_imag,
+                                                                 rocblas_datatype  c_type,
+                                                                 rocblas_int       ldc,
+                                                                 rocblas_stride    stride_c,
+                                                                 rocblas_int       batch_count,
+                                                                 rocblas_datatype  compute_type,
+                                                                 uint32_t          flags)
+try
+{
+    return rocblas_gemm_planar_ex_impl("rocblas_gemm_strided_batched_planar_ex",
+                                       handle,
+                                       trans_a,
+                                       trans_b,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       a_real,
+                                       a_imag,
+                                       a_type,
+                                       lda,
+                                       stride_a,
+                                       b_real,
+                                       b_imag,
+                                       b_type,
+                                       ldb,
+                                       stride_b,
+                                       beta,
+                                       c_real,
+                                       c_imag,
+                                       c_type,
+                                       ldc,
+                                       stride_c,
+                                       batch_count,
+                                       compute_type,
+                                       flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
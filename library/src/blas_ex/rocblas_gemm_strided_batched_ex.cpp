@@ -21,6 +21,7 @@
  * ************************************************************************ */
 #include "handle.hpp"
 #include "logging.hpp"
+#include "managed_prefetch.hpp"
 #include "rocblas.h"
 #include "rocblas_gemm_ex.hpp"
 #include "rocblas_gemm_ex_get_solutions.hpp"
@@ -63,6 +64,12 @@ try
     const bool HPA = compute_type == rocblas_datatype_f32_r
                      && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
 
+    if(((flags & rocblas_gemm_ex_workspace_flags)
+        || rocblas_gemm_ex_real_complex_types(a_type, compute_type))
+       && handle->is_device_memory_size_query())
+        return handle->set_optimal_device_memory_size(
+            rocblas_gemm_ex_workspace_size(m, n, k, batch_count, a_type, compute_type, flags));
+
     if(!HPA)
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
@@ -75,7 +82,7 @@ try
     if(!handle->is_device_memory_size_query())
     {
         // Perform logging
-        auto layer_mode = handle->layer_mode;
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
               | rocblas_layer_mode_log_profile))
@@ -279,6 +286,27 @@ try
         return validArgs;
     }
 
+    // bf16_r and f16_r results are rounded stochastically from f32_r workspace
+    if(rocblas_gemm_ex_use_stochastic_rounding(
+           handle, a_type, b_type, c_type, d_type, compute_type))
+    {
+        // clang-format off
+        return rocblas_gemm_ex_stochastic_rounding(handle, trans_a, trans_b, m, n, k, alpha,
+                                                   a, a_type, lda, stride_a, b, ldb, stride_b,
+                                                   beta, c, ldc, stride_c, d, ldd, stride_d,
+                                                   batch_count, algo, solution_index, flags);
+        // clang-format on
+    }
+
+    // clang-format off
+    rocblas_prefetch_managed_gemm(handle, trans_a, trans_b, m, n, k,
+                                  a, rocblas_sizeof_datatype(a_type), lda, stride_a,
+                                  b, rocblas_sizeof_datatype(b_type), ldb, stride_b,
+                                  c, rocblas_sizeof_datatype(c_type), ldc, stride_c,
+                                  d, rocblas_sizeof_datatype(d_type), ldd, stride_d,
+                                  batch_count);
+    // clang-format on
+
     return rocblas_gemm_ex_template<false>(handle,
                                            trans_a,
                                            trans_b,
@@ -0,0 +1,230 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "logging.hpp"
+#include "rocblas_gemv_ex.hpp"
+
+namespace
+{
+    rocblas_status rocblas_gemv_ex_impl(rocblas_handle    handle,
+                                        rocblas_operation transA,
+                                        rocblas_int       m,
+                                        rocblas_int       n,
+                                        const void*       alpha,
+                                        const void*       A,
+                                        rocblas_datatype  a_type,
+                                        rocblas_int       lda,
+                                        const void*       x,
+                                        rocblas_datatype  x_type,
+                                        rocblas_int       incx,
+                                        const void*       beta,
+                                        void*             y,
+                                        rocblas_datatype  y_type,
+                                        rocblas_int       incy,
+                                        rocblas_datatype  compute_type,
+                                        const char*       name)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes = rocblas_gemv_ex_workspace_size(transA, m, n, 1, a_type, compute_type);
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(dev_bytes);
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(layer_mode & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_profile))
+        {
+            auto transA_letter = rocblas_transpose_letter(transA);
+            auto a_type_str    = rocblas_datatype_string(a_type);
+            auto x_type_str    = rocblas_datatype_string(x_type);
+            auto y_type_str    = rocblas_datatype_string(y_type);
+            auto ex_type_str   = rocblas_datatype_string(compute_type);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+            {
+                rocblas_internal_ostream alphass, betass;
+                if(handle->pointer_mode == rocblas_pointer_mode_host
+                   && log_trace_alpha_beta_ex(compute_type, alpha, beta, alphass, betass)
+                          == rocblas_status_success)
+                {
+                    log_trace(handle,
+                              name,
+                              transA,
+                              m,
+                              n,
+                              alphass.str(),
+                              A,
+                              a_type_str,
+                              lda,
+                              x,
+                              x_type_str,
+                              incx,
+                              betass.str(),
+                              y,
+                              y_type_str,
+                              incy,
+                              ex_type_str);
+                }
+                else
+                {
+                    log_trace(handle,
+                              name,
+                              transA,
+                              m,
+                              n,
+                              A,
+                              a_type_str,
+                              lda,
+                              x,
+                              x_type_str,
+                              incx,
+                              y,
+                              y_type_str,
+                              incy,
+                              ex_type_str);
+                }
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+            {
+                log_profile(handle,
+                            name,
+                            "transA",
+                            transA_letter,
+                            "M",
+                            m,
+                            "N",
+                            n,
+                            "a_type",
+                            a_type_str,
+                            "lda",
+                            lda,
+                            "b_type",
+                            x_type_str,
+                            "incx",
+                            incx,
+                            "c_type",
+                            y_type_str,
+                            "incy",
+                            incy,
+                            "compute_type",
+                            ex_type_str);
+            }
+        }
+
+        if(transA != rocblas_operation_none && transA != rocblas_operation_transpose
+           && transA != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        if(m < 0 || n < 0 || lda < m || lda < 1 || !incx || !incy)
+            return rocblas_status_invalid_size;
+
+        if(!m || !n)
+            return rocblas_status_success;
+
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        rocblas_status perf_status = rocblas_status_success;
+        auto           w_mem       = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            perf_status = rocblas_status_perf_degraded;
+
+        rocblas_status status = rocblas_gemv_ex_template<false>(name,
+                                                                handle,
+                                                                transA,
+                                                                m,
+                                                                n,
+                                                                alpha,
+                                                                A,
+                                                                a_type,
+                                                                lda,
+                                                                0,
+                                                                x,
+                                                                x_type,
+                                                                incx,
+                                                                0,
+                                                                beta,
+                                                                y,
+                                                                y_type,
+                                                                incy,
+                                                                0,
+                                                                1,
+                                                                compute_type,
+                                                                (void*)w_mem);
+
+        return status != rocblas_status_success ? status : perf_status;
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_gemv_ex(rocblas_handle    handle,
+                               rocblas_operation transA,
+                               rocblas_int       m,
+                               rocblas_int       n,
+                               const void*       alpha,
+                               const void*       A,
+                               rocblas_datatype  a_type,
+                               rocblas_int       lda,
+                               const void*       x,
+                               rocblas_datatype  x_type,
+                               rocblas_int       incx,
+                               const void*       beta,
+                               void*             y,
+                               rocblas_datatype  y_type,
+                               rocblas_int       incy,
+                               rocblas_datatype  compute_type)
+{
+    try
+    {
+        return rocblas_gemv_ex_impl(handle,
+                                    transA,
+                                    m,
+                                    n,
+                                    alpha,
+                                    A,
+                                    a_type,
+                                    lda,
+                                    x,
+                                    x_type,
+                                    incx,
+                                    beta,
+                                    y,
+                                    y_type,
+                                    incy,
+                                    compute_type,
+                                    "rocblas_gemv_ex");
+    }
+    catch(...)
+    {
+        return exception_to_rocblas_status();
+    }
+}
+
+} // extern "C"
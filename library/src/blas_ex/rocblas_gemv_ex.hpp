@@ -0,0 +1,60 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "../blas2/rocblas_gemv.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+
+//! @brief Device memory in bytes of gemv_ex, only used by the skinny transposed kernels when
+//!        all the types are compute_type.
+size_t rocblas_gemv_ex_workspace_size(rocblas_operation transA,
+                                      rocblas_int       m,
+                                      rocblas_int       n,
+                                      rocblas_int       batch_count,
+                                      rocblas_datatype  a_type,
+                                      rocblas_datatype  compute_type);
+
+template <bool BATCHED>
+rocblas_status rocblas_gemv_ex_template(const char*       name,
+                                        rocblas_handle    handle,
+                                        rocblas_operation transA,
+                                        rocblas_int       m,
+                                        rocblas_int       n,
+                                        const void*       alpha,
+                                        const void*       A,
+                                        rocblas_datatype  a_type,
+                                        rocblas_int       lda,
+                                        rocblas_stride    stride_a,
+                                        const void*       x,
+                                        rocblas_datatype  x_type,
+                                        rocblas_int       incx,
+                                        rocblas_stride    stride_x,
+                                        const void*       beta,
+                                        void*             y,
+                                        rocblas_datatype  y_type,
+                                        rocblas_int       incy,
+                                        rocblas_stride    stride_y,
+                                        rocblas_int       batch_count,
+                                        rocblas_datatype  compute_type,
+                                        void*             workspace);
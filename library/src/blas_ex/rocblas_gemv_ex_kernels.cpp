@@ -0,0 +1,420 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "check_numerics_matrix.hpp"
+#include "check_numerics_vector.hpp"
+#include "rocblas_gemv_ex.hpp"
+
+namespace
+{
+    // y of the non-transposed kernel is split into blocks of
+    // GEMVN_EX_DIM_X * rocblas_dwordx4_length<Ta> rows
+    constexpr rocblas_int GEMVN_EX_DIM_X = 64;
+    constexpr rocblas_int GEMVN_EX_DIM_Y = 8;
+    constexpr rocblas_int GEMVT_EX_NB    = 256;
+
+    template <bool BATCHED, typename T>
+    using rocblas_gemv_ex_ptr = std::conditional_t<BATCHED, T* const*, T*>;
+
+    //! @brief gemv of the mixed precision types, A and x of type Ta and Tx and y of type Ty with
+    //!        the products accumulated in Tex.
+    template <typename Ta, typename Tex, typename TConstPtrA, typename TConstPtrX, typename TPtrY>
+    rocblas_status rocblas_gemv_ex_mixed_template(rocblas_handle    handle,
+                                                  rocblas_operation transA,
+                                                  rocblas_int       m,
+                                                  rocblas_int       n,
+                                                  const Tex*        alpha,
+                                                  TConstPtrA        A,
+                                                  rocblas_int       lda,
+                                                  rocblas_stride    stride_a,
+                                                  TConstPtrX        x,
+                                                  rocblas_int       incx,
+                                                  rocblas_stride    stride_x,
+                                                  const Tex*        beta,
+                                                  TPtrY             y,
+                                                  rocblas_int       incy,
+                                                  rocblas_stride    stride_y,
+                                                  rocblas_int       batch_count)
+    {
+        hipStream_t rocblas_stream = handle->get_stream();
+
+        // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+        bool      trans  = transA != rocblas_operation_none;
+        ptrdiff_t shiftx = incx < 0 ? -ptrdiff_t(incx) * ((trans ? m : n) - 1) : 0;
+        ptrdiff_t shifty = incy < 0 ? -ptrdiff_t(incy) * ((trans ? n : m) - 1) : 0;
+
+        // the types are real, so that the conjugate transpose is the transpose
+        auto gemv_ex = [&](auto alpha_, auto beta_) {
+            if(!trans)
+            {
+                constexpr rocblas_int ROWS = GEMVN_EX_DIM_X * rocblas_dwordx4_length<Ta>;
+                dim3                  gemvn_grid((m - 1) / ROWS + 1, batch_count);
+                dim3                  gemvn_threads(GEMVN_EX_DIM_X, GEMVN_EX_DIM_Y);
+
+                hipLaunchKernelGGL((rocblas_gemvn_ex_kernel<GEMVN_EX_DIM_X, GEMVN_EX_DIM_Y, Tex>),
+                                   gemvn_grid,
+                                   gemvn_threads,
+                                   0,
+                                   rocblas_stream,
+                                   m,
+                                   n,
+                                   alpha_,
+                                   0,
+                                   A,
+                                   0,
+                                   lda,
+                                   stride_a,
+                                   x,
+                                   shiftx,
+                                   incx,
+                                   stride_x,
+                                   beta_,
+                                   0,
+                                   y,
+                                   shifty,
+                                   incy,
+                                   stride_y);
+            }
+            else
+            {
+                dim3 gemvt_grid(n, batch_count);
+                dim3 gemvt_threads(GEMVT_EX_NB);
+
+                hipLaunchKernelGGL((rocblas_gemvt_ex_kernel<GEMVT_EX_NB, Tex>),
+                                   gemvt_grid,
+                                   gemvt_threads,
+                                   0,
+                                   rocblas_stream,
+                                   m,
+                                   alpha_,
+                                   0,
+                                   A,
+                                   0,
+                                   lda,
+                                   stride_a,
+                                   x,
+                                   shiftx,
+                                   incx,
+                                   stride_x,
+                                   beta_,
+                                   0,
+                                   y,
+                                   shifty,
+                                   incy,
+                                   stride_y);
+            }
+        };
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            gemv_ex(alpha, beta);
+        else
+            gemv_ex(*alpha, *beta);
+
+        return rocblas_status_success;
+    }
+
+    template <bool BATCHED, typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty>
+    rocblas_status rocblas_gemv_ex_typecasting(const char*       name,
+                                               rocblas_handle    handle,
+                                               rocblas_operation transA,
+                                               rocblas_int       m,
+                                               rocblas_int       n,
+                                               const void*       alpha,
+                                               const void*       A,
+                                               rocblas_int       lda,
+                                               rocblas_stride    stride_a,
+                                               const void*       x,
+                                               rocblas_int       incx,
+                                               rocblas_stride    stride_x,
+                                               const void*       beta,
+                                               void*             y,
+                                               rocblas_int       incy,
+                                               rocblas_stride    stride_y,
+                                               rocblas_int       batch_count,
+                                               void*             workspace)
+    {
+        auto check_numerics = handle->check_numerics;
+
+        auto Ap = (rocblas_gemv_ex_ptr<BATCHED, const Ta>)A;
+        auto xp = (rocblas_gemv_ex_ptr<BATCHED, const Tx>)x;
+        auto yp = (rocblas_gemv_ex_ptr<BATCHED, Ty>)y;
+
+        const Tex* alphat = (const Tex*)alpha;
+        const Tex* betat  = (const Tex*)beta;
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            if(*alphat == 0 && *betat == 1)
+                return rocblas_status_success;
+
+            if(!y || (*alphat != 0 && (!A || !x)))
+                return rocblas_status_invalid_pointer;
+        }
+
+        auto gemv_ex_check_numerics = [&](bool is_input) {
+            rocblas_int    x_len = transA == rocblas_operation_none ? n : m;
+            rocblas_int    y_len = transA == rocblas_operation_none ? m : n;
+            rocblas_status status;
+            if(is_input)
+            {
+                status = rocblas_internal_check_numerics_matrix_template(
+                    name,
+                    handle,
+                    rocblas_operation_none,
+                    rocblas_fill_full,
+                    rocblas_client_general_matrix,
+                    m,
+                    n,
+                    Ap,
+                    0,
+                    lda,
+                    stride_a,
+                    batch_count,
+                    check_numerics,
+                    is_input);
+                if(status != rocblas_status_success)
+                    return status;
+
+                status = rocblas_internal_check_numerics_vector_template(name,
+                                                                         handle,
+                                                                         x_len,
+                                                                         xp,
+                                                                         0,
+                                                                         incx,
+                                                                         stride_x,
+                                                                         batch_count,
+                                                                         check_numerics,
+                                                                         is_input);
+                if(status != rocblas_status_success)
+                    return status;
+            }
+            return rocblas_internal_check_numerics_vector_template(
+                name, handle, y_len, yp, 0, incy, stride_y, batch_count, check_numerics, is_input);
+        };
+
+        if(check_numerics)
+        {
+            rocblas_status gemv_ex_check_numerics_status = gemv_ex_check_numerics(true);
+            if(gemv_ex_check_numerics_status != rocblas_status_success)
+                return gemv_ex_check_numerics_status;
+        }
+
+        rocblas_status status;
+        if constexpr(std::is_same_v<Ta, Tex> && std::is_same_v<Tx, Tex> && std::is_same_v<Ty, Tex>)
+        {
+            // a single type is the gemv of that type
+            status = rocblas_internal_gemv_template<Tex>(handle,
+                                                         transA,
+                                                         m,
+                                                         n,
+                                                         alphat,
+                                                         0,
+                                                         Ap,
+                                                         0,
+                                                         lda,
+                                                         stride_a,
+                                                         xp,
+                                                         0,
+                                                         incx,
+                                                         stride_x,
+                                                         betat,
+                                                         0,
+                                                         yp,
+                                                         0,
+                                                         incy,
+                                                         stride_y,
+                                                         batch_count,
+                                                         (Tex*)workspace);
+        }
+        else
+        {
+            status = rocblas_gemv_ex_mixed_template<Ta>(handle,
+                                                        transA,
+                                                        m,
+                                                        n,
+                                                        alphat,
+                                                        Ap,
+                                                        lda,
+                                                        stride_a,
+                                                        xp,
+                                                        incx,
+                                                        stride_x,
+                                                        betat,
+                                                        yp,
+                                                        incy,
+                                                        stride_y,
+                                                        batch_count);
+        }
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            rocblas_status gemv_ex_check_numerics_status = gemv_ex_check_numerics(false);
+            if(gemv_ex_check_numerics_status != rocblas_status_success)
+                return gemv_ex_check_numerics_status;
+        }
+        return status;
+    }
+}
+
+size_t rocblas_gemv_ex_workspace_size(rocblas_operation transA,
+                                      rocblas_int       m,
+                                      rocblas_int       n,
+                                      rocblas_int       batch_count,
+                                      rocblas_datatype  a_type,
+                                      rocblas_datatype  compute_type)
+{
+    if(a_type != compute_type)
+        return 0;
+
+    switch(compute_type)
+    {
+    case rocblas_datatype_f32_r:
+        return rocblas_internal_gemv_kernel_workspace_size<float>(transA, m, n, batch_count);
+    case rocblas_datatype_f64_r:
+        return rocblas_internal_gemv_kernel_workspace_size<double>(transA, m, n, batch_count);
+    case rocblas_datatype_f32_c:
+        return rocblas_internal_gemv_kernel_workspace_size<rocblas_float_complex>(
+            transA, m, n, batch_count);
+    case rocblas_datatype_f64_c:
+        return rocblas_internal_gemv_kernel_workspace_size<rocblas_double_complex>(
+            transA, m, n, batch_count);
+    default:
+        return 0;
+    }
+}
+
+template <bool BATCHED>
+rocblas_status rocblas_gemv_ex_template(const char*       name,
+                                        rocblas_handle    handle,
+                                        rocblas_operation transA,
+                                        rocblas_int       m,
+                                        rocblas_int       n,
+                                        const void*       alpha,
+                                        const void*       A,
+                                        rocblas_datatype  a_type,
+                                        rocblas_int       lda,
+                                        rocblas_stride    stride_a,
+                                        const void*       x,
+                                        rocblas_datatype  x_type,
+                                        rocblas_int       incx,
+                                        rocblas_stride    stride_x,
+                                        const void*       beta,
+                                        void*             y,
+                                        rocblas_datatype  y_type,
+                                        rocblas_int       incy,
+                                        rocblas_stride    stride_y,
+                                        rocblas_int       batch_count,
+                                        rocblas_datatype  compute_type,
+                                        void*             workspace)
+{
+#define rocblas_gemv_ex_typecasting_PARAM                                                      \
+    name, handle, transA, m, n, alpha, A, lda, stride_a, x, incx, stride_x, beta, y, incy, \
+        stride_y, batch_count, workspace
+
+    if(a_type != x_type)
+        return rocblas_status_not_implemented;
+
+    if(a_type == rocblas_datatype_f16_r && compute_type == rocblas_datatype_f32_r)
+    {
+        if(y_type == rocblas_datatype_f16_r)
+            return rocblas_gemv_ex_typecasting<BATCHED,
+                                               rocblas_half,
+                                               rocblas_half,
+                                               rocblas_half,
+                                               float>(rocblas_gemv_ex_typecasting_PARAM);
+        else if(y_type == rocblas_datatype_f32_r)
+            return rocblas_gemv_ex_typecasting<BATCHED, rocblas_half, rocblas_half, float, float>(
+                rocblas_gemv_ex_typecasting_PARAM);
+    }
+    else if(a_type == rocblas_datatype_bf16_r && compute_type == rocblas_datatype_f32_r)
+    {
+        if(y_type == rocblas_datatype_bf16_r)
+            return rocblas_gemv_ex_typecasting<BATCHED,
+                                               rocblas_bfloat16,
+                                               rocblas_bfloat16,
+                                               rocblas_bfloat16,
+                                               float>(rocblas_gemv_ex_typecasting_PARAM);
+        else if(y_type == rocblas_datatype_f32_r)
+            return rocblas_gemv_ex_typecasting<BATCHED,
+                                               rocblas_bfloat16,
+                                               rocblas_bfloat16,
+                                               float,
+                                               float>(rocblas_gemv_ex_typecasting_PARAM);
+    }
+    else if(a_type == compute_type && y_type == compute_type)
+    {
+        if(compute_type == rocblas_datatype_f32_r)
+            return rocblas_gemv_ex_typecasting<BATCHED, float>(rocblas_gemv_ex_typecasting_PARAM);
+        else if(compute_type == rocblas_datatype_f64_r)
+            return rocblas_gemv_ex_typecasting<BATCHED, double>(rocblas_gemv_ex_typecasting_PARAM);
+        else if(compute_type == rocblas_datatype_f32_c)
+            return rocblas_gemv_ex_typecasting<BATCHED, rocblas_float_complex>(
+                rocblas_gemv_ex_typecasting_PARAM);
+        else if(compute_type == rocblas_datatype_f64_c)
+            return rocblas_gemv_ex_typecasting<BATCHED, rocblas_double_complex>(
+                rocblas_gemv_ex_typecasting_PARAM);
+    }
+
+#undef rocblas_gemv_ex_typecasting_PARAM
+
+    return rocblas_status_not_implemented;
+}
+
+// Instantiations below will need to be manually updated to match any change in
+// template parameters in the files *gemv_ex*.cpp
+
+// clang-format off
+
+#ifdef INSTANTIATE_GEMV_EX_TEMPLATE
+#error INSTANTIATE_GEMV_EX_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_GEMV_EX_TEMPLATE(BATCHED)                               \
+template rocblas_status rocblas_gemv_ex_template<BATCHED>                   \
+                                       (const char*       name,             \
+                                        rocblas_handle    handle,           \
+                                        rocblas_operation transA,           \
+                                        rocblas_int       m,                \
+                                        rocblas_int       n,                \
+                                        const void*       alpha,            \
+                                        const void*       A,                \
+                                        rocblas_datatype  a_type,           \
+                                        rocblas_int       lda,              \
+                                        rocblas_stride    stride_a,         \
+                                        const void*       x,                \
+                                        rocblas_datatype  x_type,           \
+                                        rocblas_int       incx,             \
+                                        rocblas_stride    stride_x,         \
+                                        const void*       beta,             \
+                                        void*             y,                \
+                                        rocblas_datatype  y_type,           \
+                                        rocblas_int       incy,             \
+                                        rocblas_stride    stride_y,         \
+                                        rocblas_int       batch_count,      \
+                                        rocblas_datatype  compute_type,     \
+                                        void*             workspace);
+
+INSTANTIATE_GEMV_EX_TEMPLATE(false)
+INSTANTIATE_GEMV_EX_TEMPLATE(true)
+
+#undef INSTANTIATE_GEMV_EX_TEMPLATE
@@ -0,0 +1,342 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "../blas2/rocblas_gemv.hpp"
+#include "check_numerics_vector.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+
+namespace
+{
+    constexpr rocblas_int GEMVT_QUANTIZED_NB = 256;
+
+    template <int BITS, typename Tx, typename Ty>
+    rocblas_status rocblas_gemv_quantized_ex_template(rocblas_handle      handle,
+                                                      rocblas_int         m,
+                                                      rocblas_int         n,
+                                                      const float*        alpha,
+                                                      const uint8_t*      A,
+                                                      rocblas_int         lda,
+                                                      const rocblas_half* scales,
+                                                      const rocblas_half* zeros,
+                                                      rocblas_int         group_size,
+                                                      const Tx*           x,
+                                                      rocblas_int         incx,
+                                                      const float*        beta,
+                                                      Ty*                 y,
+                                                      rocblas_int         incy,
+                                                      const char*         name)
+    {
+        auto check_numerics = handle->check_numerics;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            if(*alpha == 0 && *beta == 1)
+                return rocblas_status_success;
+
+            if(!y || (*alpha != 0 && (!A || !scales || !x)))
+                return rocblas_status_invalid_pointer;
+        }
+
+        auto gemv_quantized_check_numerics = [&](bool is_input) {
+            if(is_input)
+            {
+                rocblas_status status = rocblas_internal_check_numerics_vector_template(
+                    name, handle, m, x, 0, incx, 0, 1, check_numerics, is_input);
+                if(status != rocblas_status_success)
+                    return status;
+            }
+            return rocblas_internal_check_numerics_vector_template(
+                name, handle, n, y, 0, incy, 0, 1, check_numerics, is_input);
+        };
+
+        if(check_numerics)
+        {
+            rocblas_status gemv_check_numerics_status = gemv_quantized_check_numerics(true);
+            if(gemv_check_numerics_status != rocblas_status_success)
+                return gemv_check_numerics_status;
+        }
+
+        // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+        const Tx* x_shifted = incx < 0 ? x - ptrdiff_t(incx) * (m - 1) : x;
+        Ty*       y_shifted = incy < 0 ? y - ptrdiff_t(incy) * (n - 1) : y;
+
+        auto gemv_quantized = [&](auto alpha_, auto beta_) {
+            hipLaunchKernelGGL((rocblas_gemvt_quantized_kernel<GEMVT_QUANTIZED_NB, BITS>),
+                               dim3(n),
+                               dim3(GEMVT_QUANTIZED_NB),
+                               0,
+                               handle->get_stream(),
+                               m,
+                               alpha_,
+                               A,
+                               lda,
+                               scales,
+                               zeros,
+                               group_size,
+                               x_shifted,
+                               incx,
+                               beta_,
+                               y_shifted,
+                               incy);
+        };
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            gemv_quantized(alpha, beta);
+        else
+            gemv_quantized(*alpha, *beta);
+
+        if(check_numerics)
+        {
+            rocblas_status gemv_check_numerics_status = gemv_quantized_check_numerics(false);
+            if(gemv_check_numerics_status != rocblas_status_success)
+                return gemv_check_numerics_status;
+        }
+        return rocblas_status_success;
+    }
+
+    template <typename Tx, typename Ty>
+    rocblas_status rocblas_gemv_quantized_ex_bits(rocblas_handle      handle,
+                                                  rocblas_int         m,
+                                                  rocblas_int         n,
+                                                  const void*         alpha,
+                                                  const void*         A,
+                                                  rocblas_int         a_bits,
+                                                  rocblas_int         lda,
+                                                  const rocblas_half* scales,
+                                                  const rocblas_half* zeros,
+                                                  rocblas_int         group_size,
+                                                  const void*         x,
+                                                  rocblas_int         incx,
+                                                  const void*         beta,
+                                                  void*               y,
+                                                  rocblas_int         incy,
+                                                  const char*         name)
+    {
+        auto gemv_quantized = [&](auto bits) {
+            return rocblas_gemv_quantized_ex_template<decltype(bits)::value>(handle,
+                                                                             m,
+                                                                             n,
+                                                                             (const float*)alpha,
+                                                                             (const uint8_t*)A,
+                                                                             lda,
+                                                                             scales,
+                                                                             zeros,
+                                                                             group_size,
+                                                                             (const Tx*)x,
+                                                                             incx,
+                                                                             (const float*)beta,
+                                                                             (Ty*)y,
+                                                                             incy,
+                                                                             name);
+        };
+
+        return a_bits == 8 ? gemv_quantized(std::integral_constant<int, 8>{})
+                           : gemv_quantized(std::integral_constant<int, 4>{});
+    }
+
+    rocblas_status rocblas_gemv_quantized_ex_impl(rocblas_handle      handle,
+                                                  rocblas_operation   transA,
+                                                  rocblas_int         m,
+                                                  rocblas_int         n,
+                                                  const void*         alpha,
+                                                  const void*         A,
+                                                  rocblas_int         a_bits,
+                                                  rocblas_int         lda,
+                                                  const rocblas_half* scales,
+                                                  const rocblas_half* zeros,
+                                                  rocblas_int         group_size,
+                                                  const void*         x,
+                                                  rocblas_datatype    x_type,
+                                                  rocblas_int         incx,
+                                                  const void*         beta,
+                                                  void*               y,
+                                                  rocblas_datatype    y_type,
+                                                  rocblas_int         incy,
+                                                  rocblas_datatype    compute_type)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        static constexpr char name[] = "rocblas_gemv_quantized_ex";
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(layer_mode & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_profile))
+        {
+            auto transA_letter = rocblas_transpose_letter(transA);
+            auto x_type_str    = rocblas_datatype_string(x_type);
+            auto y_type_str    = rocblas_datatype_string(y_type);
+            auto ex_type_str   = rocblas_datatype_string(compute_type);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(handle,
+                          name,
+                          transA,
+                          m,
+                          n,
+                          A,
+                          a_bits,
+                          lda,
+                          scales,
+                          zeros,
+                          group_size,
+                          x,
+                          x_type_str,
+                          incx,
+                          y,
+                          y_type_str,
+                          incy,
+                          ex_type_str);
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            name,
+                            "transA",
+                            transA_letter,
+                            "M",
+                            m,
+                            "N",
+                            n,
+                            "a_bits",
+                            a_bits,
+                            "lda",
+                            lda,
+                            "group_size",
+                            group_size,
+                            "b_type",
+                            x_type_str,
+                            "incx",
+                            incx,
+                            "c_type",
+                            y_type_str,
+                            "incy",
+                            incy,
+                            "compute_type",
+                            ex_type_str);
+        }
+
+        if(transA != rocblas_operation_none && transA != rocblas_operation_transpose
+           && transA != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        if(a_bits != 8 && a_bits != 4)
+            return rocblas_status_invalid_value;
+
+        // each 128-bit load of A must lie in a single group
+        const rocblas_int vec = 128 / a_bits;
+        if(m < 0 || n < 0 || lda < m || lda < 1 || (a_bits == 4 && lda % 2) || !incx || !incy
+           || group_size < 1 || (group_size < m && group_size % vec))
+            return rocblas_status_invalid_size;
+
+        if(transA == rocblas_operation_none)
+            return rocblas_status_not_implemented;
+
+        if(!m || !n)
+            return rocblas_status_success;
+
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+#define GEMV_QUANTIZED_EX_PARAM                                                                \
+    handle, m, n, alpha, A, a_bits, lda, scales, zeros, group_size, x, incx, beta, y, incy, name
+
+        if(compute_type == rocblas_datatype_f32_r && x_type == rocblas_datatype_f16_r
+           && y_type == rocblas_datatype_f16_r)
+            return rocblas_gemv_quantized_ex_bits<rocblas_half, rocblas_half>(
+                GEMV_QUANTIZED_EX_PARAM);
+        else if(compute_type == rocblas_datatype_f32_r && x_type == rocblas_datatype_f16_r
+                && y_type == rocblas_datatype_f32_r)
+            return rocblas_gemv_quantized_ex_bits<rocblas_half, float>(GEMV_QUANTIZED_EX_PARAM);
+        else if(compute_type == rocblas_datatype_f32_r && x_type == rocblas_datatype_bf16_r
+                && y_type == rocblas_datatype_bf16_r)
+            return rocblas_gemv_quantized_ex_bits<rocblas_bfloat16, rocblas_bfloat16>(
+                GEMV_QUANTIZED_EX_PARAM);
+        else if(compute_type == rocblas_datatype_f32_r && x_type == rocblas_datatype_bf16_r
+                && y_type == rocblas_datatype_f32_r)
+            return rocblas_gemv_quantized_ex_bits<rocblas_bfloat16, float>(
+                GEMV_QUANTIZED_EX_PARAM);
+        else
+            return rocblas_status_not_implemented;
+
+#undef GEMV_QUANTIZED_EX_PARAM
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_gemv_quantized_ex(rocblas_handle      handle,
+                                         rocblas_operation   transA,
+                                         rocblas_int         m,
+                                         rocblas_int         n,
+                                         const void*         alpha,
+                                         const void*         A,
+                                         rocblas_int         a_bits,
+                                         rocblas_int         lda,
+                                         const rocblas_half* scales,
+                                         const rocblas_half* zeros,
+                                         rocblas_int         group_size,
+                                         const void*         x,
+                                         rocblas_datatype    x_type,
+                                         rocblas_int         incx,
+                                         const void*         beta,
+                                         void*               y,
+                                         rocblas_datatype    y_type,
+                                         rocblas_int         incy,
+                                         rocblas_datatype    compute_type)
+{
+    try
+    {
+        return rocblas_gemv_quantized_ex_impl(handle,
+                                              transA,
+                                              m,
+                                              n,
+                                              alpha,
+                                              A,
+                                              a_bits,
+                                              lda,
+                                              scales,
+                                              zeros,
+                                              group_size,
+                                              x,
+                                              x_type,
+                                              incx,
+                                              beta,
+                                              y,
+                                              y_type,
+                                              incy,
+                                              compute_type);
+    }
+    catch(...)
+    {
+        return exception_to_rocblas_status();
+    }
+}
+
+} // extern "C"
@@ -0,0 +1,314 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "logging.hpp"
+#include "rocblas_level2_ex.hpp"
+
+namespace
+{
+    // ger_ex, ger_batched_ex and ger_strided_batched_ex, the strides being 0 and
+    // batch_count 1 for ger_ex
+    template <bool BATCHED>
+    rocblas_status rocblas_ger_ex_impl(rocblas_handle   handle,
+                                       rocblas_int      m,
+                                       rocblas_int      n,
+                                       const void*      alpha,
+                                       const void*      x,
+                                       rocblas_datatype x_type,
+                                       rocblas_int      incx,
+                                       rocblas_stride   stride_x,
+                                       const void*      y,
+                                       rocblas_datatype y_type,
+                                       rocblas_int      incy,
+                                       rocblas_stride   stride_y,
+                                       void*            A,
+                                       rocblas_datatype a_type,
+                                       rocblas_int      lda,
+                                       rocblas_stride   stride_a,
+                                       rocblas_int      batch_count,
+                                       rocblas_datatype compute_type,
+                                       const char*      name)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(layer_mode & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_profile))
+        {
+            auto x_type_str  = rocblas_datatype_string(x_type);
+            auto y_type_str  = rocblas_datatype_string(y_type);
+            auto a_type_str  = rocblas_datatype_string(a_type);
+            auto ex_type_str = rocblas_datatype_string(compute_type);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+            {
+                rocblas_internal_ostream alphass, betass;
+                if(handle->pointer_mode == rocblas_pointer_mode_host
+                   && log_trace_alpha_beta_ex(compute_type, alpha, nullptr, alphass, betass)
+                          == rocblas_status_success)
+                {
+                    log_trace(handle,
+                              name,
+                              m,
+                              n,
+                              alphass.str(),
+                              x,
+                              x_type_str,
+                              incx,
+                              stride_x,
+                              y,
+                              y_type_str,
+                              incy,
+                              stride_y,
+                              A,
+                              a_type_str,
+                              lda,
+                              stride_a,
+                              batch_count,
+                              ex_type_str);
+                }
+                else
+                {
+                    log_trace(handle,
+                              name,
+                              m,
+                              n,
+                              x,
+                              x_type_str,
+                              incx,
+                              stride_x,
+                              y,
+                              y_type_str,
+                              incy,
+                              stride_y,
+                              A,
+                              a_type_str,
+                              lda,
+                              stride_a,
+                              batch_count,
+                              ex_type_str);
+                }
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+            {
+                log_profile(handle,
+                            name,
+                            "M",
+                            m,
+                            "N",
+                            n,
+                            "a_type",
+                            x_type_str,
+                            "incx",
+                            incx,
+                            "stride_x",
+                            stride_x,
+                            "b_type",
+                            y_type_str,
+                            "incy",
+                            incy,
+                            "stride_y",
+                            stride_y,
+                            "c_type",
+                            a_type_str,
+                            "lda",
+                            lda,
+                            "stride_a",
+                            stride_a,
+                            "batch_count",
+                            batch_count,
+                            "compute_type",
+                            ex_type_str);
+            }
+        }
+
+        if(m < 0 || n < 0 || !incx || !incy || lda < m || lda < 1 || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(!m || !n || !batch_count)
+            return rocblas_status_success;
+
+        if(!alpha)
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_ger_ex_template<BATCHED>(name,
+                                                handle,
+                                                m,
+                                                n,
+                                                alpha,
+                                                x,
+                                                x_type,
+                                                incx,
+                                                stride_x,
+                                                y,
+                                                y_type,
+                                                incy,
+                                                stride_y,
+                                                A,
+                                                a_type,
+                                                lda,
+                                                stride_a,
+                                                batch_count,
+                                                compute_type);
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_ger_ex(rocblas_handle   handle,
+                              rocblas_int      m,
+                              rocblas_int      n,
+                              const void*      alpha,
+                              const void*      x,
+                              rocblas_datatype x_type,
+                              rocblas_int      incx,
+                              const void*      y,
+                              rocblas_datatype y_type,
+                              rocblas_int      incy,
+                              void*            A,
+                              rocblas_datatype a_type,
+                              rocblas_int      lda,
+                              rocblas_datatype compute_type)
+try
+{
+    return rocblas_ger_ex_impl<false>(handle,
+                                      m,
+                                      n,
+                                      alpha,
+                                      x,
+                                      x_type,
+                                      incx,
+                                      0,
+                                      y,
+                                      y_type,
+                                      incy,
+                                      0,
+                                      A,
+                                      a_type,
+                                      lda,
+                                      0,
+                                      1,
+                                      compute_type,
+                                      "rocblas_ger_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_ger_batched_ex(rocblas_handle   handle,
+                                      rocblas_int      m,
+                                      rocblas_int      n,
+                                      const void*      alpha,
+                                      const void*      x,
+                                      rocblas_datatype x_type,
+                                      rocblas_int      incx,
+                                      const void*      y,
+                                      rocblas_datatype y_type,
+                                      rocblas_int      incy,
+                                      void*            A,
+                                      rocblas_datatype a_type,
+                                      rocblas_int      lda,
+                                      rocblas_int      batch_count,
+                                      rocblas_datatype compute_type)
+try
+{
+    return rocblas_ger_ex_impl<true>(handle,
+                                     m,
+                                     n,
+                                     alpha,
+                                     x,
+                                     x_type,
+                                     incx,
+                                     0,
+                                     y,
+                                     y_type,
+                                     incy,
+                                     0,
+                                     A,
+                                     a_type,
+                                     lda,
+                                     0,
+                                     batch_count,
+                                     compute_type,
+                                     "rocblas_ger_batched_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_ger_strided_batched_ex(rocblas_handle   handle,
+                                              rocblas_int      m,
+                                              rocblas_int      n,
+                                              const void*      alpha,
+                                              const void*      x,
+                                              rocblas_datatype x_type,
+                                              rocblas_int      incx,
+                                              rocblas_stride   stride_x,
+                                              const void*      y,
+                                              rocblas_datatype y_type,
+                                              rocblas_int      incy,
+                                              rocblas_stride   stride_y,
+                                              void*            A,
+                                              rocblas_datatype a_type,
+                                              rocblas_int      lda,
+                                              rocblas_stride   stride_a,
+                                              rocblas_int      batch_count,
+                                              rocblas_datatype compute_type)
+try
+{
+    return rocblas_ger_ex_impl<false>(handle,
+                                      m,
+                                      n,
+                                      alpha,
+                                      x,
+                                      x_type,
+                                      incx,
+                                      stride_x,
+                                      y,
+                                      y_type,
+                                      incy,
+                                      stride_y,
+                                      A,
+                                      a_type,
+                                      lda,
+                                      stride_a,
+                                      batch_count,
+                                      compute_type,
+                                      "rocblas_ger_strided_batched_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,128 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "logging.hpp"
+
+// symv_ex, ger_ex, syr2_ex and trmv_ex: with f16_r or bf16_r matrices and vectors and the
+// f32_r compute type, the elements are loaded 128 bits at a time where possible and converted
+// in registers, and the results are rounded once. A single type is computed by the Level-2
+// function of that type.
+
+//! @brief Device memory in bytes of symv_ex, the f32_r sums of the mixed precision kernels or
+//!        the workspace of symv when all the types are compute_type.
+size_t rocblas_symv_ex_workspace_size(rocblas_int      n,
+                                      rocblas_int      batch_count,
+                                      rocblas_datatype a_type,
+                                      rocblas_datatype compute_type);
+
+//! @brief Device memory in bytes of trmv_ex, the copy of x computed before it is overwritten.
+size_t rocblas_trmv_ex_workspace_size(rocblas_int      n,
+                                      rocblas_int      batch_count,
+                                      rocblas_datatype a_type,
+                                      rocblas_datatype compute_type);
+
+template <bool BATCHED>
+rocblas_status rocblas_symv_ex_template(const char*      name,
+                                        rocblas_handle   handle,
+                                        rocblas_fill     uplo,
+                                        rocblas_int      n,
+                                        const void*      alpha,
+                                        const void*      A,
+                                        rocblas_datatype a_type,
+                                        rocblas_int      lda,
+                                        rocblas_stride   stride_a,
+                                        const void*      x,
+                                        rocblas_datatype x_type,
+                                        rocblas_int      incx,
+                                        rocblas_stride   stride_x,
+                                        const void*      beta,
+                                        void*            y,
+                                        rocblas_datatype y_type,
+                                        rocblas_int      incy,
+                                        rocblas_stride   stride_y,
+                                        rocblas_int      batch_count,
+                                        rocblas_datatype compute_type,
+                                        void*            workspace);
+
+template <bool BATCHED>
+rocblas_status rocblas_ger_ex_template(const char*      name,
+                                       rocblas_handle   handle,
+                                       rocblas_int      m,
+                                       rocblas_int      n,
+                                       const void*      alpha,
+                                       const void*      x,
+                                       rocblas_datatype x_type,
+                                       rocblas_int      incx,
+                                       rocblas_stride   stride_x,
+                                       const void*      y,
+                                       rocblas_datatype y_type,
+                                       rocblas_int      incy,
+                                       rocblas_stride   stride_y,
+                                       void*            A,
+                                       rocblas_datatype a_type,
+                                       rocblas_int      lda,
+                                       rocblas_stride   stride_a,
+                                       rocblas_int      batch_count,
+                                       rocblas_datatype compute_type);
+
+template <bool BATCHED>
+rocblas_status rocblas_syr2_ex_template(const char*      name,
+                                        rocblas_handle   handle,
+                                        rocblas_fill     uplo,
+                                        rocblas_int      n,
+                                        const void*      alpha,
+                                        const void*      x,
+                                        rocblas_datatype x_type,
+                                        rocblas_int      incx,
+                                        rocblas_stride   stride_x,
+                                        const void*      y,
+                                        rocblas_datatype y_type,
+                                        rocblas_int      incy,
+                                        rocblas_stride   stride_y,
+                                        void*            A,
+                                        rocblas_datatype a_type,
+                                        rocblas_int      lda,
+                                        rocblas_stride   stride_a,
+                                        rocblas_int      batch_count,
+                                        rocblas_datatype compute_type);
+
+template <bool BATCHED>
+rocblas_status rocblas_trmv_ex_template(const char*       name,
+                                        rocblas_handle    handle,
+                                        rocblas_fill      uplo,
+                                        rocblas_operation transA,
+                                        rocblas_diagonal  diag,
+                                        rocblas_int       n,
+                                        const void*       A,
+                                        rocblas_datatype  a_type,
+                                        rocblas_int       lda,
+                                        rocblas_stride    stride_a,
+                                        void*             x,
+                                        rocblas_datatype  x_type,
+                                        rocblas_int       incx,
+                                        rocblas_stride    stride_x,
+                                        rocblas_int       batch_count,
+                                        rocblas_datatype  compute_type,
+                                        void*             workspace);
@@ -0,0 +1,1521 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "../blas2/gemv_device.hpp"
+#include "../blas2/rocblas_ger.hpp"
+#include "../blas2/rocblas_hemv_symv.hpp"
+#include "../blas2/rocblas_syr2.hpp"
+#include "../blas2/rocblas_trmv.hpp"
+#include "check_numerics_matrix.hpp"
+#include "check_numerics_vector.hpp"
+#include "rocblas_level2_ex.hpp"
+
+//! @brief Loads the elements [lo, hi) of the rocblas_dwordx4_length<T> consecutive elements at p
+//!        converted to Tex, the others being zero. All of them are loaded in one 128-bit access
+//!        when p is 16 byte aligned.
+template <typename T, typename Tex>
+__device__ __forceinline__ void rocblas_level2_ex_load(const T*    p,
+                                                       rocblas_int lo,
+                                                       rocblas_int hi,
+                                                       Tex (&v)[rocblas_dwordx4_length<T>])
+{
+    constexpr rocblas_int VEC = rocblas_dwordx4_length<T>;
+
+    if(lo == 0 && hi == VEC && rocblas_dwordx4_peel(p) == 0)
+    {
+        rocblas_dwordx4<T> vp = *(const rocblas_dwordx4<T>*)p;
+        for(rocblas_int j = 0; j < VEC; j++)
+            v[j] = Tex(vp.data[j]);
+    }
+    else
+    {
+        for(rocblas_int j = 0; j < VEC; j++)
+            v[j] = j >= lo && j < hi ? Tex(p[j]) : Tex(0);
+    }
+}
+
+//! @brief Stores the elements [lo, hi) of v at p, rounded to T, as rocblas_level2_ex_load loads
+//!        them.
+template <typename T, typename Tex>
+__device__ __forceinline__ void rocblas_level2_ex_store(T*          p,
+                                                        rocblas_int lo,
+                                                        rocblas_int hi,
+                                                        const Tex (&v)[rocblas_dwordx4_length<T>])
+{
+    constexpr rocblas_int VEC = rocblas_dwordx4_length<T>;
+
+    if(lo == 0 && hi == VEC && rocblas_dwordx4_peel(p) == 0)
+    {
+        rocblas_dwordx4<T> vp;
+        for(rocblas_int j = 0; j < VEC; j++)
+            vp.data[j] = T(v[j]);
+        *(rocblas_dwordx4<T>*)p = vp;
+    }
+    else
+    {
+        for(rocblas_int j = lo; j < hi; j++)
+            p[j] = T(v[j]);
+    }
+}
+
+//! @brief Adds A * x to w for the tile (blockIdx.x, blockIdx.y) of TILE = DIM_X *
+//!        rocblas_dwordx4_length<Ta> rows and columns of the stored triangle of the symmetric A.
+//!        Each element is read once and also accumulated as the element of the other triangle,
+//!        into the rows of w of the columns of the tile. Each thread accumulates consecutive rows
+//!        of every DIM_Y-th column of the tile.
+template <rocblas_int DIM_X, rocblas_int DIM_Y, typename Tex, typename Ta, typename Tx>
+ROCBLAS_KERNEL_ILF void rocblas_symv_ex_tile_calc(bool        upper,
+                                                  rocblas_int n,
+                                                  const Ta* __restrict__ A,
+                                                  rocblas_int lda,
+                                                  const Tx* __restrict__ x,
+                                                  rocblas_int incx,
+                                                  Tex* __restrict__ w)
+{
+    constexpr rocblas_int VEC  = rocblas_dwordx4_length<Ta>;
+    constexpr rocblas_int TILE = DIM_X * VEC;
+
+    const rocblas_int thread_id = threadIdx.x + threadIdx.y * DIM_X;
+    const rocblas_int row0      = blockIdx.x * TILE;
+    const rocblas_int col0      = blockIdx.y * TILE;
+    const bool        diag      = blockIdx.x == blockIdx.y;
+
+    __shared__ Tex sx_row[TILE];
+    __shared__ Tex sx_col[TILE];
+    __shared__ Tex srow[DIM_Y][TILE];
+    __shared__ Tex scol[DIM_X][TILE];
+
+    for(rocblas_int t = thread_id; t < TILE; t += DIM_X * DIM_Y)
+    {
+        sx_row[t] = row0 + t < n ? Tex(x[(row0 + t) * int64_t(incx)]) : Tex(0);
+        sx_col[t] = col0 + t < n ? Tex(x[(col0 + t) * int64_t(incx)]) : Tex(0);
+    }
+
+    __syncthreads();
+
+    const rocblas_int r   = threadIdx.x * VEC;
+    const rocblas_int row = row0 + r;
+
+    Tex res[VEC];
+    for(rocblas_int j = 0; j < VEC; j++)
+        res[j] = 0;
+
+    for(rocblas_int c = threadIdx.y; c < TILE; c += DIM_Y)
+    {
+        const rocblas_int col    = col0 + c;
+        Tex               colsum = 0;
+
+        if(col < n && row < n)
+        {
+            // the rows [lo, hi) of the thread are in the stored triangle
+            rocblas_int lo = 0;
+            rocblas_int hi = VEC < n - row ? VEC : n - row;
+            if(diag && upper)
+                hi = hi < col - row + 1 ? hi : col - row + 1;
+            else if(diag)
+                lo = col - row > 0 ? col - row : 0;
+
+            Tex a[VEC];
+            rocblas_level2_ex_load(A + col * size_t(lda) + row, lo, hi, a);
+
+            // the diagonal is only accumulated into its row
+            for(rocblas_int j = 0; j < VEC; j++)
+            {
+                res[j] += a[j] * sx_col[c];
+                if(row + j != col)
+                    colsum += a[j] * sx_row[r + j];
+            }
+        }
+
+        scol[threadIdx.x][c] = colsum;
+    }
+
+    for(rocblas_int j = 0; j < VEC; j++)
+        srow[threadIdx.y][r + j] = res[j];
+
+    __syncthreads();
+
+    for(rocblas_int t = thread_id; t < TILE; t += DIM_X * DIM_Y)
+    {
+        if(row0 + t < n)
+        {
+            Tex sum = 0;
+            for(rocblas_int i = 0; i < DIM_Y; i++)
+                sum += srow[i][t];
+            atomicAdd(w + row0 + t, sum);
+        }
+
+        if(col0 + t < n)
+        {
+            Tex sum = 0;
+            for(rocblas_int i = 0; i < DIM_X; i++)
+                sum += scol[i][t];
+            atomicAdd(w + col0 + t, sum);
+        }
+    }
+}
+
+template <rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          typename Tex,
+          typename U,
+          typename TConstPtrA,
+          typename TConstPtrX>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_symv_ex_tile_kernel(bool           upper,
+                            rocblas_int    n,
+                            U              alpha_device_host,
+                            TConstPtrA     Aa,
+                            rocblas_int    lda,
+                            rocblas_stride strideA,
+                            TConstPtrX     xa,
+                            rocblas_stride shiftx,
+                            rocblas_int    incx,
+                            rocblas_stride stridex,
+                            Tex*           workspace)
+{
+    // only the tiles of the stored triangle
+    if(upper ? blockIdx.x > blockIdx.y : blockIdx.x < blockIdx.y)
+        return;
+
+    Tex alpha = load_scalar(alpha_device_host);
+    if(!alpha)
+        return;
+
+    const auto* A = load_ptr_batch(Aa, blockIdx.z, 0, strideA);
+    const auto* x = load_ptr_batch(xa, blockIdx.z, shiftx, stridex);
+
+    rocblas_symv_ex_tile_calc<DIM_X, DIM_Y>(
+        upper, n, A, lda, x, incx, workspace + blockIdx.z * size_t(n));
+}
+
+//! @brief y = alpha * w + beta * y, rounding the sums w of rocblas_symv_ex_tile_kernel once.
+template <rocblas_int NB, typename Tex, typename U, typename TPtrY>
+ROCBLAS_KERNEL(NB)
+rocblas_symv_ex_scale_kernel(rocblas_int    n,
+                             U              alpha_device_host,
+                             const Tex*     workspace,
+                             U              beta_device_host,
+                             TPtrY          ya,
+                             rocblas_stride shifty,
+                             rocblas_int    incy,
+                             rocblas_stride stridey)
+{
+    Tex alpha = load_scalar(alpha_device_host);
+    Tex beta  = load_scalar(beta_device_host);
+
+    if(!alpha && beta == 1)
+        return;
+
+    rocblas_int i = blockIdx.x * NB + threadIdx.x;
+    if(i >= n)
+        return;
+
+    auto* y  = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+    using Ty = std::remove_pointer_t<decltype(y)>;
+
+    Tex res = alpha ? alpha * workspace[blockIdx.y * size_t(n) + i] : Tex(0);
+    Ty& yi  = y[i * int64_t(incy)];
+    yi      = beta ? Ty(res + beta * Tex(yi)) : Ty(res);
+}
+
+//! @brief A += alpha * x * y**T, or A += alpha * (x * y**T + y * x**T) on the uplo triangle if
+//!        SYR2, for the DIM_X * rocblas_dwordx4_length<TA> rows and DIM_Y columns of the block.
+//!        Each thread updates consecutive rows of one column.
+template <bool SYR2, rocblas_int DIM_X, rocblas_int DIM_Y, typename Tex, typename Tx, typename TA>
+ROCBLAS_KERNEL_ILF void rocblas_ger_ex_kernel_calc(bool        upper,
+                                                   rocblas_int m,
+                                                   rocblas_int n,
+                                                   Tex         alpha,
+                                                   const Tx* __restrict__ x,
+                                                   rocblas_int incx,
+                                                   const Tx* __restrict__ y,
+                                                   rocblas_int incy,
+                                                   TA* __restrict__ A,
+                                                   rocblas_int lda)
+{
+    constexpr rocblas_int VEC = rocblas_dwordx4_length<TA>;
+
+    const rocblas_int row = (blockIdx.x * DIM_X + threadIdx.x) * VEC;
+    const rocblas_int col = blockIdx.y * DIM_Y + threadIdx.y;
+
+    if(row >= m || col >= n)
+        return;
+
+    rocblas_int lo = 0;
+    rocblas_int hi = VEC < m - row ? VEC : m - row;
+    if constexpr(SYR2)
+    {
+        if(upper)
+            hi = hi < col - row + 1 ? hi : col - row + 1;
+        else
+            lo = col - row > 0 ? col - row : 0;
+
+        if(lo >= hi)
+            return;
+    }
+
+    const Tex yc = alpha * Tex(y[col * int64_t(incy)]);
+    TA*       Ac = A + col * size_t(lda) + row;
+
+    Tex a[VEC];
+    rocblas_level2_ex_load(Ac, lo, hi, a);
+
+    for(rocblas_int j = lo; j < hi; j++)
+    {
+        a[j] += Tex(x[(row + j) * int64_t(incx)]) * yc;
+        if constexpr(SYR2)
+            a[j] += Tex(y[(row + j) * int64_t(incy)]) * (alpha * Tex(x[col * int64_t(incx)]));
+    }
+
+    rocblas_level2_ex_store(Ac, lo, hi, a);
+}
+
+template <bool        SYR2,
+          rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          typename Tex,
+          typename U,
+          typename TConstPtr,
+          typename TPtr>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_ger_ex_kernel(bool           upper,
+                      rocblas_int    m,
+                      rocblas_int    n,
+                      U              alpha_device_host,
+                      TConstPtr      xa,
+                      rocblas_stride shiftx,
+                      rocblas_int    incx,
+                      rocblas_stride stridex,
+                      TConstPtr      ya,
+                      rocblas_stride shifty,
+                      rocblas_int    incy,
+                      rocblas_stride stridey,
+                      TPtr           Aa,
+                      rocblas_int    lda,
+                      rocblas_stride strideA)
+{
+    Tex alpha = load_scalar(alpha_device_host);
+    if(!alpha)
+        return;
+
+    const auto* x = load_ptr_batch(xa, blockIdx.z, shiftx, stridex);
+    const auto* y = load_ptr_batch(ya, blockIdx.z, shifty, stridey);
+    auto*       A = load_ptr_batch(Aa, blockIdx.z, 0, strideA);
+
+    rocblas_ger_ex_kernel_calc<SYR2, DIM_X, DIM_Y>(upper, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+//! @brief w = A * x for the DIM_X * rocblas_dwordx4_length<Ta> rows of block blockIdx.x of the
+//!        uplo triangle of A, without the diagonal if unit. Each thread accumulates consecutive
+//!        rows of every DIM_Y-th column of the triangle.
+template <rocblas_int DIM_X, rocblas_int DIM_Y, typename Tex, typename Ta, typename Tx>
+ROCBLAS_KERNEL_ILF void rocblas_trmvn_ex_kernel_calc(bool        upper,
+                                                     bool        unit,
+                                                     rocblas_int n,
+                                                     const Ta* __restrict__ A,
+                                                     rocblas_int lda,
+                                                     const Tx* __restrict__ x,
+                                                     rocblas_int incx,
+                                                     Tex* __restrict__ w)
+{
+    constexpr rocblas_int VEC  = rocblas_dwordx4_length<Ta>;
+    constexpr rocblas_int ROWS = DIM_X * VEC;
+
+    const rocblas_int thread_id = threadIdx.x + threadIdx.y * DIM_X;
+    const rocblas_int row0      = blockIdx.x * ROWS;
+    const rocblas_int r         = threadIdx.x * VEC;
+    const rocblas_int row       = row0 + r;
+
+    __shared__ Tex sdata[DIM_Y][ROWS];
+
+    // the columns of the triangle in the rows of the block
+    const rocblas_int col_begin = upper ? row0 : 0;
+    const rocblas_int col_end   = upper ? n : (row0 + ROWS < n ? row0 + ROWS : n);
+
+    Tex res[VEC];
+    for(rocblas_int j = 0; j < VEC; j++)
+        res[j] = 0;
+
+    for(rocblas_int col = col_begin + threadIdx.y; col < col_end; col += DIM_Y)
+    {
+        // the rows [lo, hi) of the thread are in the triangle
+        rocblas_int lo = 0;
+        rocblas_int hi = VEC < n - row ? VEC : n - row;
+        if(upper)
+        {
+            rocblas_int last = col - row + (unit ? 0 : 1);
+            hi               = hi < last ? hi : last;
+        }
+        else
+        {
+            rocblas_int first = col - row + (unit ? 1 : 0);
+            lo                = first > 0 ? first : 0;
+        }
+
+        if(lo >= hi)
+            continue;
+
+        const Tex xc = Tex(x[col * int64_t(incx)]);
+
+        Tex a[VEC];
+        rocblas_level2_ex_load(A + col * size_t(lda) + row, lo, hi, a);
+        for(rocblas_int j = 0; j < VEC; j++)
+            res[j] += a[j] * xc;
+    }
+
+    for(rocblas_int j = 0; j < VEC; j++)
+        sdata[threadIdx.y][r + j] = res[j];
+
+    __syncthreads();
+
+    for(rocblas_int t = thread_id; t < ROWS; t += DIM_X * DIM_Y)
+    {
+        if(row0 + t < n)
+        {
+            Tex sum = 0;
+            for(rocblas_int i = 0; i < DIM_Y; i++)
+                sum += sdata[i][t];
+            w[row0 + t] = sum;
+        }
+    }
+}
+
+template <rocblas_int DIM_X, rocblas_int DIM_Y, typename Tex, typename TConstPtrA, typename TPtrX>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_trmvn_ex_kernel(bool           upper,
+                        bool           unit,
+                        rocblas_int    n,
+                        TConstPtrA     Aa,
+                        rocblas_int    lda,
+                        rocblas_stride strideA,
+                        TPtrX          xa,
+                        rocblas_stride shiftx,
+                        rocblas_int    incx,
+                        rocblas_stride stridex,
+                        Tex*           workspace)
+{
+    const auto* A = load_ptr_batch(Aa, blockIdx.y, 0, strideA);
+    const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+
+    rocblas_trmvn_ex_kernel_calc<DIM_X, DIM_Y>(
+        upper, unit, n, A, lda, x, incx, workspace + blockIdx.y * size_t(n));
+}
+
+//! @brief w[col] = dot(A[:, col], x) over the rows of column blockIdx.x in the uplo triangle,
+//!        without the diagonal if unit, with the column loaded as by gemv_ex.
+template <rocblas_int NB, typename Tex, typename TConstPtrA, typename TPtrX>
+ROCBLAS_KERNEL(NB)
+rocblas_trmvt_ex_kernel(bool           upper,
+                        bool           unit,
+                        rocblas_int    n,
+                        TConstPtrA     Aa,
+                        rocblas_int    lda,
+                        rocblas_stride strideA,
+                        TPtrX          xa,
+                        rocblas_stride shiftx,
+                        rocblas_int    incx,
+                        rocblas_stride stridex,
+                        Tex*           workspace)
+{
+    const rocblas_int col = blockIdx.x;
+
+    const auto* A = load_ptr_batch(Aa, blockIdx.y, 0, strideA);
+    const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+
+    const rocblas_int begin = upper ? 0 : col + (unit ? 1 : 0);
+    const rocblas_int end   = upper ? col + (unit ? 0 : 1) : n;
+
+    rocblas_gemvt_ex_kernel_calc<NB>(end - begin,
+                                     Tex(1),
+                                     A + col * size_t(lda) + begin,
+                                     x + begin * int64_t(incx),
+                                     incx,
+                                     Tex(0),
+                                     workspace + blockIdx.y * size_t(n) + col);
+}
+
+//! @brief x = w, adding the unit diagonal, rounding the result of trmv_ex once.
+template <rocblas_int NB, typename Tex, typename TPtrX>
+ROCBLAS_KERNEL(NB)
+rocblas_trmv_ex_copy_kernel(bool           unit,
+                            rocblas_int    n,
+                            const Tex*     workspace,
+                            TPtrX          xa,
+                            rocblas_stride shiftx,
+                            rocblas_int    incx,
+                            rocblas_stride stridex)
+{
+    rocblas_int i = blockIdx.x * NB + threadIdx.x;
+    if(i >= n)
+        return;
+
+    auto* x  = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+    using Tx = std::remove_pointer_t<decltype(x)>;
+
+    Tex res = workspace[blockIdx.y * size_t(n) + i];
+    Tx& xi  = x[i * int64_t(incx)];
+    xi      = unit ? Tx(res + Tex(xi)) : Tx(res);
+}
+
+namespace
+{
+    // the symmetric matrix of symv_ex is read in tiles of SYMV_EX_TILE rows and columns
+    constexpr rocblas_int SYMV_EX_TILE  = 64;
+    constexpr rocblas_int SYMV_EX_DIM_Y = 16;
+    constexpr rocblas_int GER_EX_DIM_X  = 32;
+    constexpr rocblas_int GER_EX_DIM_Y  = 8;
+    constexpr rocblas_int TRMVN_EX_DIM_X = 32;
+    constexpr rocblas_int TRMVN_EX_DIM_Y = 8;
+    constexpr rocblas_int TRMVT_EX_NB    = 256;
+    constexpr rocblas_int LEVEL2_EX_NB   = 256;
+
+    template <bool BATCHED, typename T>
+    using rocblas_level2_ex_ptr = std::conditional_t<BATCHED, T* const*, T*>;
+
+    //! @brief symv of A and x of type Ta and y of type Ty with the products accumulated in Tex,
+    //!        in the workspace of n * batch_count Tex.
+    template <typename Ta, typename Tex, typename TConstPtrA, typename TConstPtrX, typename TPtrY>
+    rocblas_status rocblas_symv_ex_mixed_template(rocblas_handle handle,
+                                                  rocblas_fill   uplo,
+                                                  rocblas_int    n,
+                                                  const Tex*     alpha,
+                                                  TConstPtrA     A,
+                                                  rocblas_int    lda,
+                                                  rocblas_stride stride_a,
+                                                  TConstPtrX     x,
+                                                  rocblas_int    incx,
+                                                  rocblas_stride stride_x,
+                                                  const Tex*     beta,
+                                                  TPtrY          y,
+                                                  rocblas_int    incy,
+                                                  rocblas_stride stride_y,
+                                                  rocblas_int    batch_count,
+                                                  Tex*           workspace)
+    {
+        hipStream_t rocblas_stream = handle->get_stream();
+
+        // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+        ptrdiff_t shiftx = incx < 0 ? -ptrdiff_t(incx) * (n - 1) : 0;
+        ptrdiff_t shifty = incy < 0 ? -ptrdiff_t(incy) * (n - 1) : 0;
+        bool      upper  = uplo == rocblas_fill_upper;
+
+        // the tiles add their sums of both triangles to the workspace
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(
+            workspace, 0, sizeof(Tex) * size_t(n) * batch_count, rocblas_stream));
+
+        constexpr rocblas_int DIM_X = SYMV_EX_TILE / rocblas_dwordx4_length<Ta>;
+        rocblas_int           tiles = (n - 1) / SYMV_EX_TILE + 1;
+        dim3                  tile_grid(tiles, tiles, batch_count);
+        dim3                  tile_threads(DIM_X, SYMV_EX_DIM_Y);
+        dim3                  scale_grid((n - 1) / LEVEL2_EX_NB + 1, batch_count);
+        dim3                  scale_threads(LEVEL2_EX_NB);
+
+        auto symv_ex = [&](auto alpha_, auto beta_) {
+            hipLaunchKernelGGL((rocblas_symv_ex_tile_kernel<DIM_X, SYMV_EX_DIM_Y, Tex>),
+                               tile_grid,
+                               tile_threads,
+                               0,
+                               rocblas_stream,
+                               upper,
+                               n,
+                               alpha_,
+                               A,
+                               lda,
+                               stride_a,
+                               x,
+                               shiftx,
+                               incx,
+                               stride_x,
+                               workspace);
+
+            hipLaunchKernelGGL((rocblas_symv_ex_scale_kernel<LEVEL2_EX_NB, Tex>),
+                               scale_grid,
+                               scale_threads,
+                               0,
+                               rocblas_stream,
+                               n,
+                               alpha_,
+                               (const Tex*)workspace,
+                               beta_,
+                               y,
+                               shifty,
+                               incy,
+                               stride_y);
+        };
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            symv_ex(alpha, beta);
+        else
+            symv_ex(*alpha, *beta);
+
+        return rocblas_status_success;
+    }
+
+    //! @brief ger, or syr2 on the uplo triangle if SYR2, of x, y and A of type T with the
+    //!        products accumulated in Tex.
+    template <bool SYR2, typename T, typename Tex, typename TConstPtr, typename TPtr>
+    rocblas_status rocblas_ger_ex_mixed_template(rocblas_handle handle,
+                                                 rocblas_fill   uplo,
+                                                 rocblas_int    m,
+                                                 rocblas_int    n,
+                                                 const Tex*     alpha,
+                                                 TConstPtr      x,
+                                                 rocblas_int    incx,
+                                                 rocblas_stride stride_x,
+                                                 TConstPtr      y,
+                                                 rocblas_int    incy,
+                                                 rocblas_stride stride_y,
+                                                 TPtr           A,
+                                                 rocblas_int    lda,
+                                                 rocblas_stride stride_a,
+                                                 rocblas_int    batch_count)
+    {
+        hipStream_t rocblas_stream = handle->get_stream();
+
+        // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+        ptrdiff_t shiftx = incx < 0 ? -ptrdiff_t(incx) * (m - 1) : 0;
+        ptrdiff_t shifty = incy < 0 ? -ptrdiff_t(incy) * (n - 1) : 0;
+
+        constexpr rocblas_int ROWS = GER_EX_DIM_X * rocblas_dwordx4_length<T>;
+        dim3 ger_grid((m - 1) / ROWS + 1, (n - 1) / GER_EX_DIM_Y + 1, batch_count);
+        dim3 ger_threads(GER_EX_DIM_X, GER_EX_DIM_Y);
+
+        auto ger_ex = [&](auto alpha_) {
+            hipLaunchKernelGGL((rocblas_ger_ex_kernel<SYR2, GER_EX_DIM_X, GER_EX_DIM_Y, Tex>),
+                               ger_grid,
+                               ger_threads,
+                               0,
+                               rocblas_stream,
+                               uplo == rocblas_fill_upper,
+                               m,
+                               n,
+                               alpha_,
+                               x,
+                               shiftx,
+                               incx,
+                               stride_x,
+                               y,
+                               shifty,
+                               incy,
+                               stride_y,
+                               A,
+                               lda,
+                               stride_a);
+        };
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            ger_ex(alpha);
+        else
+            ger_ex(*alpha);
+
+        return rocblas_status_success;
+    }
+
+    //! @brief trmv of A and x of type Ta with the products accumulated in Tex, in the workspace
+    //!        of n * batch_count Tex, from which x is overwritten.
+    template <typename Ta, typename Tex, typename TConstPtrA, typename TPtrX>
+    rocblas_status rocblas_trmv_ex_mixed_template(rocblas_handle    handle,
+                                                  rocblas_fill      uplo,
+                                                  rocblas_operation transA,
+                                                  rocblas_diagonal  diag,
+                                                  rocblas_int       n,
+                                                  TConstPtrA        A,
+                                                  rocblas_int       lda,
+                                                  rocblas_stride    stride_a,
+                                                  TPtrX             x,
+                                                  rocblas_int       incx,
+                                                  rocblas_stride    stride_x,
+                                                  rocblas_int       batch_count,
+                                                  Tex*              workspace)
+    {
+        hipStream_t rocblas_stream = handle->get_stream();
+
+        // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+        ptrdiff_t shiftx = incx < 0 ? -ptrdiff_t(incx) * (n - 1) : 0;
+        bool      upper  = uplo == rocblas_fill_upper;
+        bool      unit   = diag == rocblas_diagonal_unit;
+
+        // the types are real, so that the conjugate transpose is the transpose
+        if(transA == rocblas_operation_none)
+        {
+            constexpr rocblas_int ROWS = TRMVN_EX_DIM_X * rocblas_dwordx4_length<Ta>;
+            dim3                  trmvn_grid((n - 1) / ROWS + 1, batch_count);
+            dim3                  trmvn_threads(TRMVN_EX_DIM_X, TRMVN_EX_DIM_Y);
+
+            hipLaunchKernelGGL((rocblas_trmvn_ex_kernel<TRMVN_EX_DIM_X, TRMVN_EX_DIM_Y, Tex>),
+                               trmvn_grid,
+                               trmvn_threads,
+                               0,
+                               rocblas_stream,
+                               upper,
+                               unit,
+                               n,
+                               A,
+                               lda,
+                               stride_a,
+                               x,
+                               shiftx,
+                               incx,
+                               stride_x,
+                               workspace);
+        }
+        else
+        {
+            dim3 trmvt_grid(n, batch_count);
+            dim3 trmvt_threads(TRMVT_EX_NB);
+
+            hipLaunchKernelGGL((rocblas_trmvt_ex_kernel<TRMVT_EX_NB, Tex>),
+                               trmvt_grid,
+                               trmvt_threads,
+                               0,
+                               rocblas_stream,
+                               upper,
+                               unit,
+                               n,
+                               A,
+                               lda,
+                               stride_a,
+                               x,
+                               shiftx,
+                               incx,
+                               stride_x,
+                               workspace);
+        }
+
+        // x is only overwritten once all of it has been read
+        dim3 copy_grid((n - 1) / LEVEL2_EX_NB + 1, batch_count);
+        dim3 copy_threads(LEVEL2_EX_NB);
+
+        hipLaunchKernelGGL((rocblas_trmv_ex_copy_kernel<LEVEL2_EX_NB, Tex>),
+                           copy_grid,
+                           copy_threads,
+                           0,
+                           rocblas_stream,
+                           unit,
+                           n,
+                           (const Tex*)workspace,
+                           x,
+                           shiftx,
+                           incx,
+                           stride_x);
+
+        return rocblas_status_success;
+    }
+
+    template <bool BATCHED, typename Ta, typename Ty = Ta, typename Tex = Ty>
+    rocblas_status rocblas_symv_ex_typecasting(const char*    name,
+                                               rocblas_handle handle,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    n,
+                                               const void*    alpha,
+                                               const void*    A,
+                                               rocblas_int    lda,
+                                               rocblas_stride stride_a,
+                                               const void*    x,
+                                               rocblas_int    incx,
+                                               rocblas_stride stride_x,
+                                               const void*    beta,
+                                               void*          y,
+                                               rocblas_int    incy,
+                                               rocblas_stride stride_y,
+                                               rocblas_int    batch_count,
+                                               void*          workspace)
+    {
+        auto check_numerics = handle->check_numerics;
+
+        auto Ap = (rocblas_level2_ex_ptr<BATCHED, const Ta>)A;
+        auto xp = (rocblas_level2_ex_ptr<BATCHED, const Ta>)x;
+        auto yp = (rocblas_level2_ex_ptr<BATCHED, Ty>)y;
+
+        const Tex* alphat = (const Tex*)alpha;
+        const Tex* betat  = (const Tex*)beta;
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            if(*alphat == 0 && *betat == 1)
+                return rocblas_status_success;
+
+            if(!y || (*alphat != 0 && (!A || !x)))
+                return rocblas_status_invalid_pointer;
+        }
+
+        auto symv_ex_check_numerics = [&](bool is_input) {
+            rocblas_status status;
+            if(is_input)
+            {
+                status = rocblas_internal_check_numerics_matrix_template(
+                    name,
+                    handle,
+                    rocblas_operation_none,
+                    uplo,
+                    rocblas_client_symmetric_matrix,
+                    n,
+                    n,
+                    Ap,
+                    0,
+                    lda,
+                    stride_a,
+                    batch_count,
+                    check_numerics,
+                    is_input);
+                if(status != rocblas_status_success)
+                    return status;
+
+                status = rocblas_internal_check_numerics_vector_template(
+                    name, handle, n, xp, 0, incx, stride_x, batch_count, check_numerics, is_input);
+                if(status != rocblas_status_success)
+                    return status;
+            }
+            return rocblas_internal_check_numerics_vector_template(
+                name, handle, n, yp, 0, incy, stride_y, batch_count, check_numerics, is_input);
+        };
+
+        if(check_numerics)
+        {
+            rocblas_status symv_ex_check_numerics_status = symv_ex_check_numerics(true);
+            if(symv_ex_check_numerics_status != rocblas_status_success)
+                return symv_ex_check_numerics_status;
+        }
+
+        rocblas_status status;
+        if constexpr(std::is_same_v<Ta, Tex> && std::is_same_v<Ty, Tex>)
+        {
+            // a single type is the symv of that type
+            status = rocblas_internal_symv_template<Tex>(handle,
+                                                         uplo,
+                                                         n,
+                                                         alphat,
+                                                         0,
+                                                         Ap,
+                                                         0,
+                                                         lda,
+                                                         stride_a,
+                                                         xp,
+                                                         0,
+                                                         incx,
+                                                         stride_x,
+                                                         betat,
+                                                         0,
+                                                         yp,
+                                                         0,
+                                                         incy,
+                                                         stride_y,
+                                                         batch_count,
+                                                         (Tex*)workspace);
+        }
+        else
+        {
+            status = rocblas_symv_ex_mixed_template<Ta>(handle,
+                                                        uplo,
+                                                        n,
+                                                        alphat,
+                                                        Ap,
+                                                        lda,
+                                                        stride_a,
+                                                        xp,
+                                                        incx,
+                                                        stride_x,
+                                                        betat,
+                                                        yp,
+                                                        incy,
+                                                        stride_y,
+                                                        batch_count,
+                                                        (Tex*)workspace);
+        }
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            rocblas_status symv_ex_check_numerics_status = symv_ex_check_numerics(false);
+            if(symv_ex_check_numerics_status != rocblas_status_success)
+                return symv_ex_check_numerics_status;
+        }
+        return status;
+    }
+
+    template <bool SYR2, bool BATCHED, typename T, typename Tex = T>
+    rocblas_status rocblas_ger_ex_typecasting(const char*    name,
+                                              rocblas_handle handle,
+                                              rocblas_fill   uplo,
+                                              rocblas_int    m,
+                                              rocblas_int    n,
+                                              const void*    alpha,
+                                              const void*    x,
+                                              rocblas_int    incx,
+                                              rocblas_stride stride_x,
+                                              const void*    y,
+                                              rocblas_int    incy,
+                                              rocblas_stride stride_y,
+                                              void*          A,
+                                              rocblas_int    lda,
+                                              rocblas_stride stride_a,
+                                              rocblas_int    batch_count)
+    {
+        auto check_numerics = handle->check_numerics;
+
+        auto xp = (rocblas_level2_ex_ptr<BATCHED, const T>)x;
+        auto yp = (rocblas_level2_ex_ptr<BATCHED, const T>)y;
+        auto Ap = (rocblas_level2_ex_ptr<BATCHED, T>)A;
+
+        const Tex* alphat = (const Tex*)alpha;
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            if(*alphat == 0)
+                return rocblas_status_success;
+
+            if(!A || !x || !y)
+                return rocblas_status_invalid_pointer;
+        }
+
+        auto ger_ex_check_numerics = [&](bool is_input) {
+            rocblas_status status = rocblas_internal_check_numerics_matrix_template(
+                name,
+                handle,
+                rocblas_operation_none,
+                SYR2 ? uplo : rocblas_fill_full,
+                SYR2 ? rocblas_client_symmetric_matrix : rocblas_client_general_matrix,
+                m,
+                n,
+                Ap,
+                0,
+                lda,
+                stride_a,
+                batch_count,
+                check_numerics,
+                is_input);
+            if(status != rocblas_status_success || !is_input)
+                return status;
+
+            status = rocblas_internal_check_numerics_vector_template(
+                name, handle, m, xp, 0, incx, stride_x, batch_count, check_numerics, is_input);
+            if(status != rocblas_status_success)
+                return status;
+
+            return rocblas_internal_check_numerics_vector_template(
+                name, handle, n, yp, 0, incy, stride_y, batch_count, check_numerics, is_input);
+        };
+
+        if(check_numerics)
+        {
+            rocblas_status ger_ex_check_numerics_status = ger_ex_check_numerics(true);
+            if(ger_ex_check_numerics_status != rocblas_status_success)
+                return ger_ex_check_numerics_status;
+        }
+
+        rocblas_status status;
+        if constexpr(std::is_same_v<T, Tex> && SYR2)
+        {
+            // a single type is the syr2 of that type
+            status = rocblas_internal_syr2_template(handle,
+                                                    uplo,
+                                                    n,
+                                                    alphat,
+                                                    xp,
+                                                    0,
+                                                    incx,
+                                                    stride_x,
+                                                    yp,
+                                                    0,
+                                                    incy,
+                                                    stride_y,
+                                                    Ap,
+                                                    lda,
+                                                    0,
+                                                    stride_a,
+                                                    batch_count);
+        }
+        else if constexpr(std::is_same_v<T, Tex>)
+        {
+            // a single type is the ger of that type
+            status = rocblas_internal_ger_template<false, T>(handle,
+                                                             m,
+                                                             n,
+                                                             alphat,
+                                                             0,
+                                                             xp,
+                                                             0,
+                                                             incx,
+                                                             stride_x,
+                                                             yp,
+                                                             0,
+                                                             incy,
+                                                             stride_y,
+                                                             Ap,
+                                                             0,
+                                                             lda,
+                                                             stride_a,
+                                                             batch_count);
+        }
+        else
+        {
+            status = rocblas_ger_ex_mixed_template<SYR2, T>(handle,
+                                                            uplo,
+                                                            m,
+                                                            n,
+                                                            alphat,
+                                                            xp,
+                                                            incx,
+                                                            stride_x,
+                                                            yp,
+                                                            incy,
+                                                            stride_y,
+                                                            Ap,
+                                                            lda,
+                                                            stride_a,
+                                                            batch_count);
+        }
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            rocblas_status ger_ex_check_numerics_status = ger_ex_check_numerics(false);
+            if(ger_ex_check_numerics_status != rocblas_status_success)
+                return ger_ex_check_numerics_status;
+        }
+        return status;
+    }
+
+    template <bool BATCHED, typename T, typename Tex = T>
+    rocblas_status rocblas_trmv_ex_typecasting(const char*       name,
+                                               rocblas_handle    handle,
+                                               rocblas_fill      uplo,
+                                               rocblas_operation transA,
+                                               rocblas_diagonal  diag,
+                                               rocblas_int       n,
+                                               const void*       A,
+                                               rocblas_int       lda,
+                                               rocblas_stride    stride_a,
+                                               void*             x,
+                                               rocblas_int       incx,
+                                               rocblas_stride    stride_x,
+                                               rocblas_int       batch_count,
+                                               void*             workspace)
+    {
+        auto check_numerics = handle->check_numerics;
+
+        auto Ap = (rocblas_level2_ex_ptr<BATCHED, const T>)A;
+        auto xp = (rocblas_level2_ex_ptr<BATCHED, T>)x;
+
+        if(!A || !x)
+            return rocblas_status_invalid_pointer;
+
+        auto trmv_ex_check_numerics = [&](bool is_input) {
+            if(is_input)
+            {
+                rocblas_status status = rocblas_internal_check_numerics_matrix_template(
+                    name,
+                    handle,
+                    rocblas_operation_none,
+                    uplo,
+                    rocblas_client_triangular_matrix,
+                    n,
+                    n,
+                    Ap,
+                    0,
+                    lda,
+                    stride_a,
+                    batch_count,
+                    check_numerics,
+                    is_input);
+                if(status != rocblas_status_success)
+                    return status;
+            }
+            return rocblas_internal_check_numerics_vector_template(
+                name, handle, n, xp, 0, incx, stride_x, batch_count, check_numerics, is_input);
+        };
+
+        if(check_numerics)
+        {
+            rocblas_status trmv_ex_check_numerics_status = trmv_ex_check_numerics(true);
+            if(trmv_ex_check_numerics_status != rocblas_status_success)
+                return trmv_ex_check_numerics_status;
+        }
+
+        rocblas_status status;
+        if constexpr(std::is_same_v<T, Tex>)
+        {
+            // a single type is the trmv of that type
+            status = rocblas_internal_trmv_template(handle,
+                                                    uplo,
+                                                    transA,
+                                                    diag,
+                                                    n,
+                                                    Ap,
+                                                    0,
+                                                    lda,
+                                                    stride_a,
+                                                    xp,
+                                                    0,
+                                                    incx,
+                                                    stride_x,
+                                                    (T*)workspace,
+                                                    n,
+                                                    batch_count);
+        }
+        else
+        {
+            status = rocblas_trmv_ex_mixed_template<T>(handle,
+                                                       uplo,
+                                                       transA,
+                                                       diag,
+                                                       n,
+                                                       Ap,
+                                                       lda,
+                                                       stride_a,
+                                                       xp,
+                                                       incx,
+                                                       stride_x,
+                                                       batch_count,
+                                                       (Tex*)workspace);
+        }
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            rocblas_status trmv_ex_check_numerics_status = trmv_ex_check_numerics(false);
+            if(trmv_ex_check_numerics_status != rocblas_status_success)
+                return trmv_ex_check_numerics_status;
+        }
+        return status;
+    }
+
+    //! @brief ger_ex and syr2_ex, whose types are all the same or f16_r or bf16_r with f32_r.
+    template <bool SYR2, bool BATCHED>
+    rocblas_status rocblas_ger_ex_dispatch(const char*      name,
+                                           rocblas_handle   handle,
+                                           rocblas_fill     uplo,
+                                           rocblas_int      m,
+                                           rocblas_int      n,
+                                           const void*      alpha,
+                                           const void*      x,
+                                           rocblas_datatype x_type,
+                                           rocblas_int      incx,
+                                           rocblas_stride   stride_x,
+                                           const void*      y,
+                                           rocblas_datatype y_type,
+                                           rocblas_int      incy,
+                                           rocblas_stride   stride_y,
+                                           void*            A,
+                                           rocblas_datatype a_type,
+                                           rocblas_int      lda,
+                                           rocblas_stride   stride_a,
+                                           rocblas_int      batch_count,
+                                           rocblas_datatype compute_type)
+    {
+#define rocblas_ger_ex_typecasting_PARAM                                                    \
+    name, handle, uplo, m, n, alpha, x, incx, stride_x, y, incy, stride_y, A, lda, stride_a, \
+        batch_count
+
+        if(x_type != a_type || y_type != a_type)
+            return rocblas_status_not_implemented;
+
+        if(a_type == rocblas_datatype_f16_r && compute_type == rocblas_datatype_f32_r)
+            return rocblas_ger_ex_typecasting<SYR2, BATCHED, rocblas_half, float>(
+                rocblas_ger_ex_typecasting_PARAM);
+        else if(a_type == rocblas_datatype_bf16_r && compute_type == rocblas_datatype_f32_r)
+            return rocblas_ger_ex_typecasting<SYR2, BATCHED, rocblas_bfloat16, float>(
+                rocblas_ger_ex_typecasting_PARAM);
+        else if(a_type == compute_type)
+        {
+            if(compute_type == rocblas_datatype_f32_r)
+                return rocblas_ger_ex_typecasting<SYR2, BATCHED, float>(
+                    rocblas_ger_ex_typecasting_PARAM);
+            else if(compute_type == rocblas_datatype_f64_r)
+                return rocblas_ger_ex_typecasting<SYR2, BATCHED, double>(
+                    rocblas_ger_ex_typecasting_PARAM);
+            else if(compute_type == rocblas_datatype_f32_c)
+                return rocblas_ger_ex_typecasting<SYR2, BATCHED, rocblas_float_complex>(
+                    rocblas_ger_ex_typecasting_PARAM);
+            else if(compute_type == rocblas_datatype_f64_c)
+                return rocblas_ger_ex_typecasting<SYR2, BATCHED, rocblas_double_complex>(
+                    rocblas_ger_ex_typecasting_PARAM);
+        }
+
+#undef rocblas_ger_ex_typecasting_PARAM
+
+        return rocblas_status_not_implemented;
+    }
+
+    //! @brief Whether a_type with compute_type is computed by the mixed precision kernels.
+    bool rocblas_level2_ex_mixed(rocblas_datatype a_type, rocblas_datatype compute_type)
+    {
+        return (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r)
+               && compute_type == rocblas_datatype_f32_r;
+    }
+}
+
+size_t rocblas_symv_ex_workspace_size(rocblas_int      n,
+                                      rocblas_int      batch_count,
+                                      rocblas_datatype a_type,
+                                      rocblas_datatype compute_type)
+{
+    if(rocblas_level2_ex_mixed(a_type, compute_type))
+        return sizeof(float) * size_t(n) * batch_count;
+
+    if(a_type != compute_type)
+        return 0;
+
+    switch(compute_type)
+    {
+    case rocblas_datatype_f32_r:
+        return rocblas_internal_hemv_symv_kernel_workspace_size<float>(n, batch_count);
+    case rocblas_datatype_f64_r:
+        return rocblas_internal_hemv_symv_kernel_workspace_size<double>(n, batch_count);
+    case rocblas_datatype_f32_c:
+        return rocblas_internal_hemv_symv_kernel_workspace_size<rocblas_float_complex>(
+            n, batch_count);
+    case rocblas_datatype_f64_c:
+        return rocblas_internal_hemv_symv_kernel_workspace_size<rocblas_double_complex>(
+            n, batch_count);
+    default:
+        return 0;
+    }
+}
+
+size_t rocblas_trmv_ex_workspace_size(rocblas_int      n,
+                                      rocblas_int      batch_count,
+                                      rocblas_datatype a_type,
+                                      rocblas_datatype compute_type)
+{
+    if(rocblas_level2_ex_mixed(a_type, compute_type))
+        return sizeof(float) * size_t(n) * batch_count;
+
+    if(a_type != compute_type)
+        return 0;
+
+    switch(compute_type)
+    {
+    case rocblas_datatype_f32_r:
+        return sizeof(float) * size_t(n) * batch_count;
+    case rocblas_datatype_f64_r:
+        return sizeof(double) * size_t(n) * batch_count;
+    case rocblas_datatype_f32_c:
+        return sizeof(rocblas_float_complex) * size_t(n) * batch_count;
+    case rocblas_datatype_f64_c:
+        return sizeof(rocblas_double_complex) * size_t(n) * batch_count;
+    default:
+        return 0;
+    }
+}
+
+template <bool BATCHED>
+rocblas_status rocblas_symv_ex_template(const char*      name,
+                                        rocblas_handle   handle,
+                                        rocblas_fill     uplo,
+                                        rocblas_int      n,
+                                        const void*      alpha,
+                                        const void*      A,
+                                        rocblas_datatype a_type,
+                                        rocblas_int      lda,
+                                        rocblas_stride   stride_a,
+                                        const void*      x,
+                                        rocblas_datatype x_type,
+                                        rocblas_int      incx,
+                                        rocblas_stride   stride_x,
+                                        const void*      beta,
+                                        void*            y,
+                                        rocblas_datatype y_type,
+                                        rocblas_int      incy,
+                                        rocblas_stride   stride_y,
+                                        rocblas_int      batch_count,
+                                        rocblas_datatype compute_type,
+                                        void*            workspace)
+{
+#define rocblas_symv_ex_typecasting_PARAM                                                        \
+    name, handle, uplo, n, alpha, A, lda, stride_a, x, incx, stride_x, beta, y, incy, stride_y, \
+        batch_count, workspace
+
+    if(a_type != x_type)
+        return rocblas_status_not_implemented;
+
+    if(a_type == rocblas_datatype_f16_r && compute_type == rocblas_datatype_f32_r)
+    {
+        if(y_type == rocblas_datatype_f16_r)
+            return rocblas_symv_ex_typecasting<BATCHED, rocblas_half, rocblas_half, float>(
+                rocblas_symv_ex_typecasting_PARAM);
+        else if(y_type == rocblas_datatype_f32_r)
+            return rocblas_symv_ex_typecasting<BATCHED, rocblas_half, float, float>(
+                rocblas_symv_ex_typecasting_PARAM);
+    }
+    else if(a_type == rocblas_datatype_bf16_r && compute_type == rocblas_datatype_f32_r)
+    {
+        if(y_type == rocblas_datatype_bf16_r)
+            return rocblas_symv_ex_typecasting<BATCHED, rocblas_bfloat16, rocblas_bfloat16, float>(
+                rocblas_symv_ex_typecasting_PARAM);
+        else if(y_type == rocblas_datatype_f32_r)
+            return rocblas_symv_ex_typecasting<BATCHED, rocblas_bfloat16, float, float>(
+                rocblas_symv_ex_typecasting_PARAM);
+    }
+    else if(a_type == compute_type && y_type == compute_type)
+    {
+        if(compute_type == rocblas_datatype_f32_r)
+            return rocblas_symv_ex_typecasting<BATCHED, float>(rocblas_symv_ex_typecasting_PARAM);
+        else if(compute_type == rocblas_datatype_f64_r)
+            return rocblas_symv_ex_typecasting<BATCHED, double>(rocblas_symv_ex_typecasting_PARAM);
+        else if(compute_type == rocblas_datatype_f32_c)
+            return rocblas_symv_ex_typecasting<BATCHED, rocblas_float_complex>(
+                rocblas_symv_ex_typecasting_PARAM);
+        else if(compute_type == rocblas_datatype_f64_c)
+            return rocblas_symv_ex_typecasting<BATCHED, rocblas_double_complex>(
+                rocblas_symv_ex_typecasting_PARAM);
+    }
+
+#undef rocblas_symv_ex_typecasting_PARAM
+
+    return rocblas_status_not_implemented;
+}
+
+template <bool BATCHED>
+rocblas_status rocblas_ger_ex_template(const char*      name,
+                                       rocblas_handle   handle,
+                                       rocblas_int      m,
+                                       rocblas_int      n,
+                                       const void*      alpha,
+                                       const void*      x,
+                                       rocblas_datatype x_type,
+                                       rocblas_int      incx,
+                                       rocblas_stride   stride_x,
+                                       const void*      y,
+                                       rocblas_datatype y_type,
+                                       rocblas_int      incy,
+                                       rocblas_stride   stride_y,
+                                       void*            A,
+                                       rocblas_datatype a_type,
+                                       rocblas_int      lda,
+                                       rocblas_stride   stride_a,
+                                       rocblas_int      batch_count,
+                                       rocblas_datatype compute_type)
+{
+    return rocblas_ger_ex_dispatch<false, BATCHED>(name,
+                                                   handle,
+                                                   rocblas_fill_full,
+                                                   m,
+                                                   n,
+                                                   alpha,
+                                                   x,
+                                                   x_type,
+                                                   incx,
+                                                   stride_x,
+                                                   y,
+                                                   y_type,
+                                                   incy,
+                                                   stride_y,
+                                                   A,
+                                                   a_type,
+                                                   lda,
+                                                   stride_a,
+                                                   batch_count,
+                                                   compute_type);
+}
+
+template <bool BATCHED>
+rocblas_status rocblas_syr2_ex_template(const char*      name,
+                                        rocblas_handle   handle,
+                                        rocblas_fill     uplo,
+                                        rocblas_int      n,
+                                        const void*      alpha,
+                                        const void*      x,
+                                        rocblas_datatype x_type,
+                                        rocblas_int      incx,
+                                        rocblas_stride   stride_x,
+                                        const void*      y,
+                                        rocblas_datatype y_type,
+                                        rocblas_int      incy,
+                                        rocblas_stride   stride_y,
+                                        void*            A,
+                                        rocblas_datatype a_type,
+                                        rocblas_int      lda,
+                                        rocblas_stride   stride_a,
+                                        rocblas_int      batch_count,
+                                        rocblas_datatype compute_type)
+{
+    return rocblas_ger_ex_dispatch<true, BATCHED>(name,
+                                                  handle,
+                                                  uplo,
+                                                  n,
+                                                  n,
+                                                  alpha,
+                                                  x,
+                                                  x_type,
+                                                  incx,
+                                                  stride_x,
+                                                  y,
+                                                  y_type,
+                                                  incy,
+                                                  stride_y,
+                                                  A,
+                                                  a_type,
+                                                  lda,
+                                                  stride_a,
+                                                  batch_count,
+                                                  compute_type);
+}
+
+template <bool BATCHED>
+rocblas_status rocblas_trmv_ex_template(const char*       name,
+                                        rocblas_handle    handle,
+                                        rocblas_fill      uplo,
+                                        rocblas_operation transA,
+                                        rocblas_diagonal  diag,
+                                        rocblas_int       n,
+                                        const void*       A,
+                                        rocblas_datatype  a_type,
+                                        rocblas_int       lda,
+                                        rocblas_stride    stride_a,
+                                        void*             x,
+                                        rocblas_datatype  x_type,
+                                        rocblas_int       incx,
+                                        rocblas_stride    stride_x,
+                                        rocblas_int       batch_count,
+                                        rocblas_datatype  compute_type,
+                                        void*             workspace)
+{
+#define rocblas_trmv_ex_typecasting_PARAM                                                     \
+    name, handle, uplo, transA, diag, n, A, lda, stride_a, x, incx, stride_x, batch_count, \
+        workspace
+
+    if(a_type != x_type)
+        return rocblas_status_not_implemented;
+
+    if(a_type == rocblas_datatype_f16_r && compute_type == rocblas_datatype_f32_r)
+        return rocblas_trmv_ex_typecasting<BATCHED, rocblas_half, float>(
+            rocblas_trmv_ex_typecasting_PARAM);
+    else if(a_type == rocblas_datatype_bf16_r && compute_type == rocblas_datatype_f32_r)
+        return rocblas_trmv_ex_typecasting<BATCHED, rocblas_bfloat16, float>(
+            rocblas_trmv_ex_typecasting_PARAM);
+    else if(a_type == compute_type)
+    {
+        if(compute_type == rocblas_datatype_f32_r)
+            return rocblas_trmv_ex_typecasting<BATCHED, float>(rocblas_trmv_ex_typecasting_PARAM);
+        else if(compute_type == rocblas_datatype_f64_r)
+            return rocblas_trmv_ex_typecasting<BATCHED, double>(rocblas_trmv_ex_typecasting_PARAM);
+        else if(compute_type == rocblas_datatype_f32_c)
+            return rocblas_trmv_ex_typecasting<BATCHED, rocblas_float_complex>(
+                rocblas_trmv_ex_typecasting_PARAM);
+        else if(compute_type == rocblas_datatype_f64_c)
+            return rocblas_trmv_ex_typecasting<BATCHED, rocblas_double_complex>(
+                rocblas_trmv_ex_typecasting_PARAM);
+    }
+
+#undef rocblas_trmv_ex_typecasting_PARAM
+
+    return rocblas_status_not_implemented;
+}
+
+// Instantiations below will need to be manually updated to match any change in
+// template parameters in the files *_ex.cpp of symv, ger, syr2 and trmv
+
+// clang-format off
+
+#ifdef INSTANTIATE_LEVEL2_EX_TEMPLATE
+#error INSTANTIATE_LEVEL2_EX_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_LEVEL2_EX_TEMPLATE(BATCHED)                              \
+template rocblas_status rocblas_symv_ex_template<BATCHED>                    \
+                                       (const char*       name,              \
+                                        rocblas_handle    handle,            \
+                                        rocblas_fill      uplo,              \
+                                        rocblas_int       n,                 \
+                                        const void*       alpha,             \
+                                        const void*       A,                 \
+                                        rocblas_datatype  a_type,            \
+                                        rocblas_int       lda,               \
+                                        rocblas_stride    stride_a,          \
+                                        const void*       x,                 \
+                                        rocblas_datatype  x_type,            \
+                                        rocblas_int       incx,              \
+                                        rocblas_stride    stride_x,          \
+                                        const void*       beta,              \
+                                        void*             y,                 \
+                                        rocblas_datatype  y_type,            \
+                                        rocblas_int       incy,              \
+                                        rocblas_stride    stride_y,          \
+                                        rocblas_int       batch_count,       \
+                                        rocblas_datatype  compute_type,      \
+                                        void*             workspace);        \
+template rocblas_status rocblas_ger_ex_template<BATCHED>                     \
+                                       (const char*       name,              \
+                                        rocblas_handle    handle,            \
+                                        rocblas_int       m,                 \
+                                        rocblas_int       n,                 \
+                                        const void*       alpha,             \
+                                        const void*       x,                 \
+                                        rocblas_datatype  x_type,            \
+                                        rocblas_int       incx,              \
+                                        rocblas_stride    stride_x,          \
+                                        const void*       y,                 \
+                                        rocblas_datatype  y_type,            \
+                                        rocblas_int       incy,              \
+                                        rocblas_stride    stride_y,          \
+                                        void*             A,                 \
+                                        rocblas_datatype  a_type,            \
+                                        rocblas_int       lda,               \
+                                        rocblas_stride    stride_a,          \
+                                        rocblas_int       batch_count,       \
+                                        rocblas_datatype  compute_type);     \
+template rocblas_status rocblas_syr2_ex_template<BATCHED>                    \
+                                       (const char*       name,              \
+                                        rocblas_handle    handle,            \
+                                        rocblas_fill      uplo,              \
+                                        rocblas_int       n,                 \
+                                        const void*       alpha,             \
+                                        const void*       x,                 \
+                                        rocblas_datatype  x_type,            \
+                                        rocblas_int       incx,              \
+                                        rocblas_stride    stride_x,          \
+                                        const void*       y,                 \
+                                        rocblas_datatype  y_type,            \
+                                        rocblas_int       incy,              \
+                                        rocblas_stride    stride_y,          \
+                                        void*             A,                 \
+                                        rocblas_datatype  a_type,            \
+                                        rocblas_int       lda,               \
+                                        rocblas_stride    stride_a,          \
+                                        rocblas_int       batch_count,       \
+                                        rocblas_datatype  compute_type);     \
+template rocblas_status rocblas_trmv_ex_template<BATCHED>                    \
+                                       (const char*       name,              \
+                                        rocblas_handle    handle,            \
+                                        rocblas_fill      uplo,              \
+                                        rocblas_operation transA,            \
+                                        rocblas_diagonal  diag,              \
+                                        rocblas_int       n,                 \
+                                        const void*       A,                 \
+                                        rocblas_datatype  a_type,            \
+                                        rocblas_int       lda,               \
+                                        rocblas_stride    stride_a,          \
+                                        void*             x,                 \
+                                        rocblas_datatype  x_type,            \
+                                        rocblas_int       incx,              \
+                                        rocblas_stride    stride_x,          \
+                                        rocblas_int       batch_count,       \
+                                        rocblas_datatype  compute_type,      \
+                                        void*             workspace);
+
+INSTANTIATE_LEVEL2_EX_TEMPLATE(false)
+INSTANTIATE_LEVEL2_EX_TEMPLATE(true)
+
+#undef INSTANTIATE_LEVEL2_EX_TEMPLATE
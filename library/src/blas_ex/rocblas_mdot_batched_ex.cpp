@@ -0,0 +1,344 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "check_numerics_vector.hpp"
+#include "logging.hpp"
+#include "rocblas_block_sizes.h"
+#include "rocblas_dot_ex.hpp"
+
+namespace
+{
+    constexpr int NB = ROCBLAS_DOT_NB;
+
+    template <bool CONJ, typename Tx, typename Tr = Tx, typename Tex = Tr>
+    rocblas_status rocblas_mdot_ex_typecasting(rocblas_handle __restrict__ handle,
+                                               rocblas_int n,
+                                               rocblas_int k,
+                                               const void* __restrict__ x,
+                                               rocblas_int incx,
+                                               const void* __restrict__ y,
+                                               rocblas_int incy,
+                                               void* __restrict__ results,
+                                               void* __restrict__ workspace,
+                                               const char* name)
+    {
+        auto check_numerics = handle->check_numerics;
+
+        // x is checked as a batch of k vectors, y as a single vector
+        auto mdot_check_numerics = [&](bool is_input) {
+            rocblas_status status = rocblas_internal_check_numerics_vector_template(
+                name, handle, n, (const Tx* const*)x, 0, incx, 0, k, check_numerics, is_input);
+            if(status != rocblas_status_success)
+                return status;
+            return rocblas_internal_check_numerics_vector_template(
+                name, handle, n, (const Tx*)y, 0, incy, 0, 1, check_numerics, is_input);
+        };
+
+        if(check_numerics)
+        {
+            rocblas_status mdot_check_numerics_status = mdot_check_numerics(true);
+            if(mdot_check_numerics_status != rocblas_status_success)
+                return mdot_check_numerics_status;
+        }
+
+        rocblas_status status = rocblas_internal_mdot_template<NB, CONJ>(handle,
+                                                                         n,
+                                                                         k,
+                                                                         (const Tx* const*)x,
+                                                                         0,
+                                                                         incx,
+                                                                         (const Tx*)y,
+                                                                         0,
+                                                                         incy,
+                                                                         (Tr*)results,
+                                                                         (Tex*)workspace);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            rocblas_status mdot_check_numerics_status = mdot_check_numerics(false);
+            if(mdot_check_numerics_status != rocblas_status_success)
+                return mdot_check_numerics_status;
+        }
+        return status;
+    }
+
+    template <bool CONJ>
+    rocblas_status rocblas_mdot_ex_template(rocblas_handle __restrict__ handle,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const void* __restrict__ x,
+                                            rocblas_datatype x_type,
+                                            rocblas_int      incx,
+                                            const void* __restrict__ y,
+                                            rocblas_datatype y_type,
+                                            rocblas_int      incy,
+                                            void* __restrict__ results,
+                                            rocblas_datatype result_type,
+                                            rocblas_datatype execution_type,
+                                            void* __restrict__ workspace,
+                                            const char* name)
+    {
+#define rocblas_mdot_ex_typecasting_PARAM handle, n, k, x, incx, y, incy, results, workspace, name
+
+        if(x_type != y_type || x_type != result_type)
+            return rocblas_status_not_implemented;
+
+        if(x_type == rocblas_datatype_f16_r && execution_type == rocblas_datatype_f16_r)
+        {
+            return rocblas_mdot_ex_typecasting<CONJ, rocblas_half>(
+                rocblas_mdot_ex_typecasting_PARAM);
+        }
+        else if(x_type == rocblas_datatype_bf16_r && execution_type == rocblas_datatype_f32_r)
+        {
+            return rocblas_mdot_ex_typecasting<CONJ, rocblas_bfloat16, rocblas_bfloat16, float>(
+                rocblas_mdot_ex_typecasting_PARAM);
+        }
+        else if(x_type == rocblas_datatype_f16_r && execution_type == rocblas_datatype_f32_r)
+        {
+            return rocblas_mdot_ex_typecasting<CONJ, rocblas_half, rocblas_half, float>(
+                rocblas_mdot_ex_typecasting_PARAM);
+        }
+        else if(x_type == rocblas_datatype_f32_r && execution_type == rocblas_datatype_f32_r)
+        {
+            return rocblas_mdot_ex_typecasting<CONJ, float>(rocblas_mdot_ex_typecasting_PARAM);
+        }
+        else if(x_type == rocblas_datatype_f64_r && execution_type == rocblas_datatype_f64_r)
+        {
+            return rocblas_mdot_ex_typecasting<CONJ, double>(rocblas_mdot_ex_typecasting_PARAM);
+        }
+        else if(x_type == rocblas_datatype_f32_c && execution_type == rocblas_datatype_f32_c)
+        {
+            return rocblas_mdot_ex_typecasting<CONJ, rocblas_float_complex>(
+                rocblas_mdot_ex_typecasting_PARAM);
+        }
+        else if(x_type == rocblas_datatype_f64_c && execution_type == rocblas_datatype_f64_c)
+        {
+            return rocblas_mdot_ex_typecasting<CONJ, rocblas_double_complex>(
+                rocblas_mdot_ex_typecasting_PARAM);
+        }
+
+#undef rocblas_mdot_ex_typecasting_PARAM
+
+        return rocblas_status_not_implemented;
+    }
+
+    template <bool CONJ>
+    rocblas_status rocblas_mdot_batched_ex_impl(rocblas_handle   handle,
+                                                rocblas_int      n,
+                                                rocblas_int      k,
+                                                const void*      x,
+                                                rocblas_datatype x_type,
+                                                rocblas_int      incx,
+                                                const void*      y,
+                                                rocblas_datatype y_type,
+                                                rocblas_int      incy,
+                                                void*            result,
+                                                rocblas_datatype result_type,
+                                                rocblas_datatype execution_type,
+                                                const char*      name)
+    {
+        if(!handle)
+        {
+            return rocblas_status_invalid_handle;
+        }
+
+        // the partial sums of the k products are laid out as those of a batched dot
+        size_t dev_bytes = rocblas_reduction_kernel_workspace_size<NB>(n, k, execution_type);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0 || k <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(layer_mode & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_profile))
+        {
+            auto x_type_str      = rocblas_datatype_string(x_type);
+            auto y_type_str      = rocblas_datatype_string(y_type);
+            auto result_type_str = rocblas_datatype_string(result_type);
+            auto ex_type_str     = rocblas_datatype_string(execution_type);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+            {
+                log_trace(handle,
+                          name,
+                          n,
+                          k,
+                          x,
+                          x_type_str,
+                          incx,
+                          y,
+                          y_type_str,
+                          incy,
+                          result_type_str,
+                          ex_type_str);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+            {
+                log_profile(handle,
+                            name,
+                            "N",
+                            n,
+                            "K",
+                            k,
+                            "a_type",
+                            x_type_str,
+                            "incx",
+                            incx,
+                            "b_type",
+                            y_type_str,
+                            "incy",
+                            incy,
+                            "c_type",
+                            result_type_str,
+                            "compute_type",
+                            ex_type_str);
+            }
+        }
+
+        if(k < 0)
+            return rocblas_status_invalid_size;
+        if(k == 0)
+            return rocblas_status_success;
+
+        if(n <= 0)
+        {
+            if(!result)
+                return rocblas_status_invalid_pointer;
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(result,
+                                                   0,
+                                                   rocblas_sizeof_datatype(result_type) * k,
+                                                   handle->get_stream()));
+            else
+                memset(result, 0, rocblas_sizeof_datatype(result_type) * k);
+            return rocblas_status_success;
+        }
+
+        if(!x || !y || !result)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        return rocblas_mdot_ex_template<CONJ>(handle,
+                                              n,
+                                              k,
+                                              x,
+                                              x_type,
+                                              incx,
+                                              y,
+                                              y_type,
+                                              incy,
+                                              result,
+                                              result_type,
+                                              execution_type,
+                                              (void*)w_mem,
+                                              name);
+    }
+
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_mdot_batched_ex(rocblas_handle   handle,
+                                       rocblas_int      n,
+                                       rocblas_int      k,
+                                       const void*      x,
+                                       rocblas_datatype x_type,
+                                       rocblas_int      incx,
+                                       const void*      y,
+                                       rocblas_datatype y_type,
+                                       rocblas_int      incy,
+                                       void*            result,
+                                       rocblas_datatype result_type,
+                                       rocblas_datatype execution_type)
+{
+    try
+    {
+        return rocblas_mdot_batched_ex_impl<false>(handle,
+                                                   n,
+                                                   k,
+                                                   x,
+                                                   x_type,
+                                                   incx,
+                                                   y,
+                                                   y_type,
+                                                   incy,
+                                                   result,
+                                                   result_type,
+                                                   execution_type,
+                                                   "rocblas_mdot_batched_ex");
+    }
+    catch(...)
+    {
+        return exception_to_rocblas_status();
+    }
+}
+
+rocblas_status rocblas_mdotc_batched_ex(rocblas_handle   handle,
+                                        rocblas_int      n,
+                                        rocblas_int      k,
+                                        const void*      x,
+                                        rocblas_datatype x_type,
+                                        rocblas_int      incx,
+                                        const void*      y,
+                                        rocblas_datatype y_type,
+                                        rocblas_int      incy,
+                                        void*            result,
+                                        rocblas_datatype result_type,
+                                        rocblas_datatype execution_type)
+{
+    try
+    {
+        return rocblas_mdot_batched_ex_impl<true>(handle,
+                                                  n,
+                                                  k,
+                                                  x,
+                                                  x_type,
+                                                  incx,
+                                                  y,
+                                                  y_type,
+                                                  incy,
+                                                  result,
+                                                  result_type,
+                                                  execution_type,
+                                                  "rocblas_mdotc_batched_ex");
+    }
+    catch(...)
+    {
+        return exception_to_rocblas_status();
+    }
+}
+
+} // extern "C"
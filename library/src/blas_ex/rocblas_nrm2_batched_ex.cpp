@@ -61,7 +61,7 @@ namespace
         auto x_type_str      = rocblas_datatype_string(x_type);
         auto result_type_str = rocblas_datatype_string(result_type);
         auto ex_type_str     = rocblas_datatype_string(execution_type);
-        auto layer_mode      = handle->layer_mode;
+        auto layer_mode      = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         if(layer_mode & rocblas_layer_mode_log_trace)
         {
             log_trace(handle,
@@ -0,0 +1,441 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "check_numerics_matrix.hpp"
+#include "logging.hpp"
+#include "rocblas_geam.hpp"
+
+namespace
+{
+    template <bool BATCHED, typename Ta, typename Tb, typename Tex>
+    rocblas_status rocblas_omatcopy_ex_typecasting(const char*       name,
+                                                   rocblas_handle    handle,
+                                                   rocblas_operation trans,
+                                                   rocblas_int       m,
+                                                   rocblas_int       n,
+                                                   const void*       alpha,
+                                                   const void*       A,
+                                                   rocblas_int       lda,
+                                                   rocblas_stride    stride_a,
+                                                   void*             B,
+                                                   rocblas_int       ldb,
+                                                   rocblas_stride    stride_b,
+                                                   rocblas_int       batch_count)
+    {
+        using TConstPtr = std::conditional_t<BATCHED, const Ta* const*, const Ta*>;
+        using TPtr      = std::conditional_t<BATCHED, Tb* const*, Tb*>;
+
+        auto check_numerics = handle->check_numerics;
+
+        // B is the rows x cols matrix op(A)
+        rocblas_int rows = trans == rocblas_operation_none ? m : n;
+        rocblas_int cols = trans == rocblas_operation_none ? n : m;
+
+        if(check_numerics)
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_internal_check_numerics_matrix_template(name,
+                                                                handle,
+                                                                rocblas_operation_none,
+                                                                rocblas_fill_full,
+                                                                rocblas_client_general_matrix,
+                                                                m,
+                                                                n,
+                                                                (TConstPtr)A,
+                                                                0,
+                                                                lda,
+                                                                stride_a,
+                                                                batch_count,
+                                                                check_numerics,
+                                                                true));
+
+        RETURN_IF_ROCBLAS_ERROR(rocblas_internal_matcopy_template(handle,
+                                                                  trans,
+                                                                  rows,
+                                                                  cols,
+                                                                  (const Tex*)alpha,
+                                                                  (TConstPtr)A,
+                                                                  0,
+                                                                  lda,
+                                                                  stride_a,
+                                                                  (TPtr)B,
+                                                                  0,
+                                                                  ldb,
+                                                                  stride_b,
+                                                                  batch_count));
+
+        if(check_numerics)
+            return rocblas_internal_check_numerics_matrix_template(name,
+                                                                   handle,
+                                                                   rocblas_operation_none,
+                                                                   rocblas_fill_full,
+                                                                   rocblas_client_general_matrix,
+                                                                   rows,
+                                                                   cols,
+                                                                   (TPtr)B,
+                                                                   0,
+                                                                   ldb,
+                                                                   stride_b,
+                                                                   batch_count,
+                                                                   check_numerics,
+                                                                   false);
+        return rocblas_status_success;
+    }
+
+    //! @brief omatcopy_ex, whose types are all the same, or f16_r, bf16_r and f32_r with
+    //!        f32_r, or f32_r and f64_r with f64_r.
+    template <bool BATCHED>
+    rocblas_status rocblas_omatcopy_ex_dispatch(const char*       name,
+                                                rocblas_handle    handle,
+                                                rocblas_operation trans,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                const void*       alpha,
+                                                const void*       A,
+                                                rocblas_datatype  a_type,
+                                                rocblas_int       lda,
+                                                rocblas_stride    stride_a,
+                                                void*             B,
+                                                rocblas_datatype  b_type,
+                                                rocblas_int       ldb,
+                                                rocblas_stride    stride_b,
+                                                rocblas_int       batch_count,
+                                                rocblas_datatype  compute_type)
+    {
+#define rocblas_omatcopy_ex_typecasting_PARAM \
+    name, handle, trans, m, n, alpha, A, lda, stride_a, B, ldb, stride_b, batch_count
+
+        auto is = [&](rocblas_datatype a, rocblas_datatype b, rocblas_datatype ex) {
+            return a_type == a && b_type == b && compute_type == ex;
+        };
+
+        constexpr auto f16 = rocblas_datatype_f16_r, bf16 = rocblas_datatype_bf16_r,
+                       f32 = rocblas_datatype_f32_r, f64 = rocblas_datatype_f64_r,
+                       c32 = rocblas_datatype_f32_c, c64 = rocblas_datatype_f64_c;
+
+        if(is(f32, f32, f32))
+            return rocblas_omatcopy_ex_typecasting<BATCHED, float, float, float>(
+                rocblas_omatcopy_ex_typecasting_PARAM);
+        else if(is(f64, f64, f64))
+            return rocblas_omatcopy_ex_typecasting<BATCHED, double, double, double>(
+                rocblas_omatcopy_ex_typecasting_PARAM);
+        else if(is(c32, c32, c32))
+            return rocblas_omatcopy_ex_typecasting<BATCHED,
+                                                   rocblas_float_complex,
+                                                   rocblas_float_complex,
+                                                   rocblas_float_complex>(
+                rocblas_omatcopy_ex_typecasting_PARAM);
+        else if(is(c64, c64, c64))
+            return rocblas_omatcopy_ex_typecasting<BATCHED,
+                                                   rocblas_double_complex,
+                                                   rocblas_double_complex,
+                                                   rocblas_double_complex>(
+                rocblas_omatcopy_ex_typecasting_PARAM);
+        else if(is(f16, f16, f32))
+            return rocblas_omatcopy_ex_typecasting<BATCHED, rocblas_half, rocblas_half, float>(
+                rocblas_omatcopy_ex_typecasting_PARAM);
+        else if(is(bf16, bf16, f32))
+            return rocblas_omatcopy_ex_typecasting<BATCHED,
+                                                   rocblas_bfloat16,
+                                                   rocblas_bfloat16,
+                                                   float>(rocblas_omatcopy_ex_typecasting_PARAM);
+        else if(is(f32, f16, f32))
+            return rocblas_omatcopy_ex_typecasting<BATCHED, float, rocblas_half, float>(
+                rocblas_omatcopy_ex_typecasting_PARAM);
+        else if(is(f16, f32, f32))
+            return rocblas_omatcopy_ex_typecasting<BATCHED, rocblas_half, float, float>(
+                rocblas_omatcopy_ex_typecasting_PARAM);
+        else if(is(f32, bf16, f32))
+            return rocblas_omatcopy_ex_typecasting<BATCHED, float, rocblas_bfloat16, float>(
+                rocblas_omatcopy_ex_typecasting_PARAM);
+        else if(is(bf16, f32, f32))
+            return rocblas_omatcopy_ex_typecasting<BATCHED, rocblas_bfloat16, float, float>(
+                rocblas_omatcopy_ex_typecasting_PARAM);
+        else if(is(f64, f32, f64))
+            return rocblas_omatcopy_ex_typecasting<BATCHED, double, float, double>(
+                rocblas_omatcopy_ex_typecasting_PARAM);
+        else if(is(f32, f64, f64))
+            return rocblas_omatcopy_ex_typecasting<BATCHED, float, double, double>(
+                rocblas_omatcopy_ex_typecasting_PARAM);
+
+#undef rocblas_omatcopy_ex_typecasting_PARAM
+
+        return rocblas_status_not_implemented;
+    }
+
+    // omatcopy_ex, omatcopy_batched_ex and omatcopy_strided_batched_ex, the strides being 0 and
+    // batch_count 1 for omatcopy_ex
+    template <bool BATCHED>
+    rocblas_status rocblas_omatcopy_ex_impl(rocblas_handle    handle,
+                                            rocblas_operation trans,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const void*       alpha,
+                                            const void*       A,
+                                            rocblas_datatype  a_type,
+                                            rocblas_int       lda,
+                                            rocblas_stride    stride_a,
+                                            void*             B,
+                                            rocblas_datatype  b_type,
+                                            rocblas_int       ldb,
+                                            rocblas_stride    stride_b,
+                                            rocblas_int       batch_count,
+                                            rocblas_datatype  compute_type,
+                                            const char*       name)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(layer_mode & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_profile))
+        {
+            auto trans_letter = rocblas_transpose_letter(trans);
+            auto a_type_str   = rocblas_datatype_string(a_type);
+            auto b_type_str   = rocblas_datatype_string(b_type);
+            auto ex_type_str  = rocblas_datatype_string(compute_type);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+            {
+                rocblas_internal_ostream alphass, betass;
+                if(handle->pointer_mode == rocblas_pointer_mode_host
+                   && log_trace_alpha_beta_ex(compute_type, alpha, nullptr, alphass, betass)
+                          == rocblas_status_success)
+                {
+                    log_trace(handle,
+                              name,
+                              trans,
+                              m,
+                              n,
+                              alphass.str(),
+                              A,
+                              a_type_str,
+                              lda,
+                              stride_a,
+                              B,
+                              b_type_str,
+                              ldb,
+                              stride_b,
+                              batch_count,
+                              ex_type_str);
+                }
+                else
+                {
+                    log_trace(handle,
+                              name,
+                              trans,
+                              m,
+                              n,
+                              A,
+                              a_type_str,
+                              lda,
+                              stride_a,
+                              B,
+                              b_type_str,
+                              ldb,
+                              stride_b,
+                              batch_count,
+                              ex_type_str);
+                }
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            name,
+                            "trans",
+                            trans_letter,
+                            "M",
+                            m,
+                            "N",
+                            n,
+                            "a_type",
+                            a_type_str,
+                            "lda",
+                            lda,
+                            "stride_a",
+                            stride_a,
+                            "b_type",
+                            b_type_str,
+                            "ldb",
+                            ldb,
+                            "stride_b",
+                            stride_b,
+                            "batch_count",
+                            batch_count,
+                            "compute_type",
+                            ex_type_str);
+        }
+
+        if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+           && trans != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        rocblas_int rows = trans == rocblas_operation_none ? m : n;
+        if(m < 0 || n < 0 || batch_count < 0 || lda < m || lda < 1 || ldb < rows || ldb < 1)
+            return rocblas_status_invalid_size;
+
+        if(!m || !n || !batch_count)
+            return rocblas_status_success;
+
+        if(!alpha || !A || !B)
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_omatcopy_ex_dispatch<BATCHED>(name,
+                                                     handle,
+                                                     trans,
+                                                     m,
+                                                     n,
+                                                     alpha,
+                                                     A,
+                                                     a_type,
+                                                     lda,
+                                                     stride_a,
+                                                     B,
+                                                     b_type,
+                                                     ldb,
+                                                     stride_b,
+                                                     batch_count,
+                                                     compute_type);
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_omatcopy_ex(rocblas_handle    handle,
+                                   rocblas_operation trans,
+                                   rocblas_int       m,
+                                   rocblas_int       n,
+                                   const void*       alpha,
+                                   const void*       A,
+                                   rocblas_datatype  a_type,
+                                   rocblas_int       lda,
+                                   void*             B,
+                                   rocblas_datatype  b_type,
+                                   rocblas_int       ldb,
+                                   rocblas_datatype  compute_type)
+try
+{
+    return rocblas_omatcopy_ex_impl<false>(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           alpha,
+                                           A,
+                                           a_type,
+                                           lda,
+                                           0,
+                                           B,
+                                           b_type,
+                                           ldb,
+                                           0,
+                                           1,
+                                           compute_type,
+                                           "rocblas_omatcopy_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_omatcopy_batched_ex(rocblas_handle    handle,
+                                           rocblas_operation trans,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           const void*       alpha,
+                                           const void*       A,
+                                           rocblas_datatype  a_type,
+                                           rocblas_int       lda,
+                                           void*             B,
+                                           rocblas_datatype  b_type,
+                                           rocblas_int       ldb,
+                                           rocblas_int       batch_count,
+                                           rocblas_datatype  compute_type)
+try
+{
+    return rocblas_omatcopy_ex_impl<true>(handle,
+                                          trans,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A,
+                                          a_type,
+                                          lda,
+                                          0,
+                                          B,
+                                          b_type,
+                                          ldb,
+                                          0,
+                                          batch_count,
+                                          compute_type,
+                                          "rocblas_omatcopy_batched_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_omatcopy_strided_batched_ex(rocblas_handle    handle,
+                                                   rocblas_operation trans,
+                                                   rocblas_int       m,
+                                                   rocblas_int       n,
+                                                   const void*       alpha,
+                                                   const void*       A,
+                                                   rocblas_datatype  a_type,
+                                                   rocblas_int       lda,
+                                                   rocblas_stride    stride_a,
+                                                   void*             B,
+                                                   rocblas_datatype  b_type,
+                                                   rocblas_int       ldb,
+                                                   rocblas_stride    stride_b,
+                                                   rocblas_int       batch_count,
+                                                   rocblas_datatype  compute_type)
+try
+{
+    return rocblas_omatcopy_ex_impl<false>(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           alpha,
+                                           A,
+                                           a_type,
+                                           lda,
+                                           stride_a,
+                                           B,
+                                           b_type,
+                                           ldb,
+                                           stride_b,
+                                           batch_count,
+                                           compute_type,
+                                           "rocblas_omatcopy_strided_batched_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -49,7 +49,7 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
-        auto layer_mode  = handle->layer_mode;
+        auto layer_mode  = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         auto x_type_str  = rocblas_datatype_string(x_type);
         auto y_type_str  = rocblas_datatype_string(y_type);
         auto cs_type_str = rocblas_datatype_string(cs_type);
@@ -20,11 +20,80 @@
  *
  * ************************************************************************ */
 
+#include "../blas1/rocblas_level1_launch.hpp"
 #include "../blas1/rocblas_scal.hpp"
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "logging.hpp"
 #include "rocblas_scal_ex.hpp"
+#include "rocblas_stochastic_rounding.hpp"
+
+// scal with float execution whose results of type To are rounded stochastically, with the
+// counter offset + b * n + i of the element i of batch b
+template <rocblas_int NB, typename To, typename Ta, typename Tx>
+ROCBLAS_KERNEL(NB)
+rocblas_scal_ex_stochastic_kernel(rocblas_int    n,
+                                  Ta             alpha_device_host,
+                                  rocblas_stride stride_alpha,
+                                  Tx __restrict__ x,
+                                  rocblas_stride offset_x,
+                                  rocblas_int    incx,
+                                  rocblas_stride stride_x,
+                                  uint64_t       seed,
+                                  uint64_t       offset)
+{
+    auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
+
+    uint64_t counter = offset + uint64_t(blockIdx.y) * n;
+    for(ptrdiff_t tid = blockIdx.x * blockDim.x + threadIdx.x; tid < n;
+        tid += ptrdiff_t(gridDim.x) * blockDim.x)
+    {
+        auto tx = load_ptr_batch(x, blockIdx.y, offset_x + tid * incx, stride_x);
+
+        float    v    = float(alpha) * float(*tx);
+        uint32_t bits = rocblas_stochastic_rounding_bits(seed, counter + tid);
+        *tx           = rocblas_stochastic_round<To>(v, bits);
+    }
+}
+
+// rocblas_internal_scal_template, or the stochastic rounding kernel when the handle rounds the
+// results of type To stochastically
+template <int NB, typename To, typename Tex, typename Ta, typename Tx>
+rocblas_status rocblas_scal_ex_launch(rocblas_handle handle,
+                                      rocblas_int    n,
+                                      const Ta*      alpha,
+                                      rocblas_stride stride_alpha,
+                                      Tx             x,
+                                      rocblas_stride offset_x,
+                                      rocblas_int    incx,
+                                      rocblas_stride stride_x,
+                                      rocblas_int    batch_count)
+{
+    if(!rocblas_use_stochastic_rounding<To, Tex>(handle))
+        return rocblas_internal_scal_template<NB, To, Tex>(
+            handle, n, alpha, stride_alpha, x, offset_x, incx, stride_x, batch_count);
+
+    static constexpr rocblas_stride stride_0 = 0;
+
+    rocblas_level1_launch<NB> launch(handle, n, batch_count);
+    uint64_t                  seed   = handle->stochastic_rounding_seed;
+    uint64_t                  offset = handle->stochastic_rounding_offset;
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        // clang-format off
+        hipLaunchKernelGGL((rocblas_scal_ex_stochastic_kernel<NB, To>), launch.grid, launch.threads, 0, handle->get_stream(), n, alpha,
+                           stride_alpha, x, offset_x, incx, stride_x, seed, offset);
+        // clang-format on
+    }
+    else
+    {
+        // clang-format off
+        hipLaunchKernelGGL((rocblas_scal_ex_stochastic_kernel<NB, To>), launch.grid, launch.threads, 0, handle->get_stream(), n, *alpha,
+                           stride_0, x, offset_x, incx, stride_x, seed, offset);
+        // clang-format on
+    }
+    return rocblas_status_success;
+}
 
 template <int NB, bool BATCHED, typename Ta, typename Tx = Ta, typename Tex = Tx>
 rocblas_status rocblas_scal_ex_typecasting(rocblas_handle handle,
@@ -74,7 +143,7 @@ rocblas_status rocblas_scal_ex_typecasting(rocblas_handle handle,
                 return scal_ex_check_numerics_status;
         }
 
-        status = rocblas_internal_scal_template<NB, Tx, Tex>(
+        status = rocblas_scal_ex_launch<NB, Tx, Tex>(
             handle, n, alpha, stride_alpha, (Tx* const*)x, offset_x, incx, stride_x, batch_count);
 
         if(status != rocblas_status_success)
@@ -119,7 +188,7 @@ rocblas_status rocblas_scal_ex_typecasting(rocblas_handle handle,
                 return scal_ex_check_numerics_status;
         }
 
-        status = rocblas_internal_scal_template<NB, Tx, Tex>(
+        status = rocblas_scal_ex_launch<NB, Tx, Tex>(
             handle, n, alpha, stride_alpha, (Tx*)x, offset_x, incx, stride_x, batch_count);
 
         if(status != rocblas_status_success)
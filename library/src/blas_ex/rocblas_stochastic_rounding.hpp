@@ -0,0 +1,95 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas.h"
+
+// Uniformly distributed random bits of the element of counter index of the rounding stream
+// of seed: the splitmix64 finalizer of the counter, which needs no state between calls
+__device__ inline uint32_t rocblas_stochastic_rounding_bits(uint64_t seed, uint64_t index)
+{
+    uint64_t z = seed + (index + 1) * 0x9e3779b97f4a7c15ull;
+    z          = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z          = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return uint32_t((z ^ (z >> 31)) >> 32);
+}
+
+// Rounds v to T up or down with probabilities proportional to its distance to the two nearest
+// values of T, so that the rounding is unbiased on average. Types other than rocblas_bfloat16
+// and rocblas_half round to nearest.
+template <typename T>
+__device__ inline T rocblas_stochastic_round(float v, uint32_t bits)
+{
+    return T(v);
+}
+
+template <>
+__device__ inline rocblas_bfloat16 rocblas_stochastic_round(float v, uint32_t bits)
+{
+    union
+    {
+        float    fp32;
+        uint32_t int32;
+    } u = {v};
+
+    // Inf and NaN are rounded to nearest. Adding the random bits below the bfloat16 mantissa
+    // carries into it with the probability of the truncated fraction.
+    if(!(~u.int32 & 0x7f800000))
+        return rocblas_bfloat16(v);
+    u.int32 += bits >> 16;
+    return rocblas_bfloat16(u.fp32, rocblas_bfloat16::rocblas_truncate);
+}
+
+template <>
+__device__ inline rocblas_half rocblas_stochastic_round(float v, uint32_t bits)
+{
+    union
+    {
+        rocblas_half fp16;
+        uint16_t     int16;
+    } lo = {rocblas_half(v)}, hi = lo;
+
+    // Exact, infinite and NaN results are rounded to nearest. Otherwise the nearest half brackets
+    // v with its neighbour of smaller or larger magnitude.
+    float nearest = float(lo.fp16);
+    if(nearest == v || !(nearest - nearest == 0))
+        return lo.fp16;
+    if(fabsf(nearest) > fabsf(v))
+        lo.int16--;
+    else
+        hi.int16++;
+
+    float low  = fabsf(float(lo.fp16));
+    float high = fabsf(float(hi.fp16));
+    return float(bits >> 8) * 0x1p-24f * (high - low) < fabsf(v) - low ? hi.fp16 : lo.fp16;
+}
+
+// Whether the outputs of type T of the handle's calls with float execution are rounded
+// stochastically
+template <typename T, typename Tex>
+inline bool rocblas_use_stochastic_rounding(rocblas_handle handle)
+{
+    return handle->stochastic_rounding && std::is_same<Tex, float>{}
+           && (std::is_same<T, rocblas_bfloat16>{} || std::is_same<T, rocblas_half>{});
+}
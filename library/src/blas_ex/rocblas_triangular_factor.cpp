@@ -0,0 +1,536 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_block_sizes.h"
+#include "rocblas_trsv_inverse.hpp"
+#include "utility.hpp"
+
+/*
+ * Triangular matrix A of order k together with the inverses of its diagonal blocks, held in
+ * the invA layout accepted by rocblas_trsm_ex and rocblas_trsv_ex: for each of the batch_count
+ * matrices, BLOCK x k elements holding the packed BLOCK x BLOCK inverses followed by the
+ * inverse of any smaller block that remains
+ */
+struct _rocblas_triangular_factor
+{
+    static constexpr rocblas_int BLOCK = ROCBLAS_TRSM_NB;
+    static_assert(ROCBLAS_TRSM_NB == ROCBLAS_TRSV_EX_NB, "trsm and trsv invA layouts differ");
+
+    int              device;
+    rocblas_datatype type;
+    rocblas_fill     uplo;
+    rocblas_diagonal diag;
+    rocblas_int      k;
+    const void*      A;
+    rocblas_int      lda;
+    rocblas_stride   stride_A;
+    rocblas_int      batch_count;
+    bool             batched;
+    void*            invA     = nullptr;
+    void*            invA_arr = nullptr; // device array of pointers into invA when batched
+
+    rocblas_int invA_size() const
+    {
+        return BLOCK * k;
+    }
+
+    ~_rocblas_triangular_factor()
+    {
+        if(invA)
+            (void)(hipFree)(invA);
+        if(invA_arr)
+            (void)(hipFree)(invA_arr);
+    }
+};
+
+namespace
+{
+    constexpr rocblas_int BLOCK = _rocblas_triangular_factor::BLOCK;
+
+    // Type of A, and of a supplied invA, for a batched or a strided batched factor
+    template <bool BATCHED, typename T>
+    using const_ptr_t = std::conditional_t<BATCHED, const T* const*, const T*>;
+
+    // Inverts the diagonal blocks of A into the invA of the factor
+    template <bool BATCHED, typename T, typename U>
+    rocblas_status rocblas_triangular_factor_invert(rocblas_handle             handle,
+                                                    _rocblas_triangular_factor* factor,
+                                                    U                          A)
+    {
+        rocblas_int    k           = factor->k;
+        rocblas_int    batch_count = factor->batch_count;
+        rocblas_stride stride_invA = rocblas_stride(BLOCK) * k;
+        size_t         c_temp_els  = rocblas_trtri_trsm_c_temp_els<BLOCK>(k);
+
+        auto w_mem = handle->device_malloc(sizeof(T) * c_temp_els * batch_count,
+                                           BATCHED ? sizeof(T*) * batch_count : 0);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        if(BATCHED)
+        {
+            setup_batched_array<BLOCK>(
+                handle->get_stream(), (T*)w_mem[0], c_temp_els, (T**)w_mem[1], batch_count);
+            setup_batched_array<BLOCK>(handle->get_stream(),
+                                       (T*)factor->invA,
+                                       stride_invA,
+                                       (T**)factor->invA_arr,
+                                       batch_count);
+        }
+
+        using V = std::conditional_t<BATCHED, T* const*, T*>;
+
+        // Temporarily switch to host pointer mode, restoring on return
+        // cppcheck-suppress unreadVariable
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        return rocblas_trtri_trsm_template<BLOCK, BATCHED, T>(
+            handle,
+            (V)(BATCHED ? (void*)w_mem[1] : (void*)w_mem[0]),
+            factor->uplo,
+            factor->diag,
+            k,
+            A,
+            0,
+            factor->lda,
+            factor->stride_A,
+            (V)(BATCHED ? factor->invA_arr : factor->invA),
+            0,
+            stride_invA,
+            batch_count);
+    }
+
+    template <bool BATCHED>
+    rocblas_status rocblas_triangular_factor_invert_dispatch(rocblas_handle              handle,
+                                                             _rocblas_triangular_factor* factor)
+    {
+        switch(factor->type)
+        {
+        case rocblas_datatype_f32_r:
+            return rocblas_triangular_factor_invert<BATCHED, float>(
+                handle, factor, (const_ptr_t<BATCHED, float>)factor->A);
+        case rocblas_datatype_f64_r:
+            return rocblas_triangular_factor_invert<BATCHED, double>(
+                handle, factor, (const_ptr_t<BATCHED, double>)factor->A);
+        case rocblas_datatype_f32_c:
+            return rocblas_triangular_factor_invert<BATCHED, rocblas_float_complex>(
+                handle, factor, (const_ptr_t<BATCHED, rocblas_float_complex>)factor->A);
+        case rocblas_datatype_f64_c:
+            return rocblas_triangular_factor_invert<BATCHED, rocblas_double_complex>(
+                handle, factor, (const_ptr_t<BATCHED, rocblas_double_complex>)factor->A);
+        default:
+            return rocblas_status_not_implemented;
+        }
+    }
+
+    rocblas_status rocblas_create_triangular_factor_impl(rocblas_handle             handle,
+                                                         rocblas_fill               uplo,
+                                                         rocblas_diagonal           diag,
+                                                         rocblas_int                k,
+                                                         const void*                A,
+                                                         rocblas_int                lda,
+                                                         rocblas_stride             stride_A,
+                                                         rocblas_int                batch_count,
+                                                         bool                       batched,
+                                                         rocblas_datatype           compute_type,
+                                                         rocblas_triangular_factor* factor)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      batched ? "rocblas_create_triangular_factor_batched"
+                              : "rocblas_create_triangular_factor",
+                      uplo,
+                      diag,
+                      k,
+                      A,
+                      lda,
+                      stride_A,
+                      batch_count,
+                      rocblas_datatype_string(compute_type));
+
+        if(!factor)
+            return rocblas_status_invalid_pointer;
+        *factor = nullptr;
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+        if(diag != rocblas_diagonal_unit && diag != rocblas_diagonal_non_unit)
+            return rocblas_status_invalid_value;
+
+        // invA_size of the supplied invA functions is a rocblas_int
+        if(k < 0 || k > std::numeric_limits<rocblas_int>::max() / _rocblas_triangular_factor::BLOCK
+           || lda < k || lda < 1 || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(k && batch_count && !A)
+            return rocblas_status_invalid_pointer;
+
+        if(compute_type != rocblas_datatype_f32_r && compute_type != rocblas_datatype_f64_r
+           && compute_type != rocblas_datatype_f32_c && compute_type != rocblas_datatype_f64_c)
+            return rocblas_status_not_implemented;
+
+        // invA is allocated with hipMalloc, which cannot be captured
+        if(handle->is_graph_safe())
+            return rocblas_status_not_implemented;
+
+        size_t elem = rocblas_sizeof_datatype(compute_type);
+
+        // Only the workspace of the inversion comes from the handle
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(
+                elem * rocblas_trtri_trsm_c_temp_els<BLOCK>(k) * batch_count,
+                batched ? sizeof(void*) * batch_count : 0);
+
+        auto p         = std::make_unique<_rocblas_triangular_factor>();
+        p->device      = handle->getDevice();
+        p->type        = compute_type;
+        p->uplo        = uplo;
+        p->diag        = diag;
+        p->k           = k;
+        p->A           = A;
+        p->lda         = lda;
+        p->stride_A    = stride_A;
+        p->batch_count = batch_count;
+        p->batched     = batched;
+
+        if(k && batch_count)
+        {
+            // Temporarily change the thread's default device ID to the handle's device ID
+            // cppcheck-suppress unreadVariable
+            auto saved_device_id = handle->push_device_id();
+
+            RETURN_IF_HIP_ERROR((hipMalloc)(&p->invA, elem * p->invA_size() * batch_count));
+            if(batched)
+                RETURN_IF_HIP_ERROR((hipMalloc)(&p->invA_arr, sizeof(void*) * batch_count));
+
+            RETURN_IF_ROCBLAS_ERROR(batched
+                                        ? rocblas_triangular_factor_invert_dispatch<true>(handle,
+                                                                                          p.get())
+                                        : rocblas_triangular_factor_invert_dispatch<false>(
+                                            handle, p.get()));
+        }
+
+        *factor = p.release();
+        return rocblas_status_success;
+    }
+
+    // Solves with the factor through the supplied invA path of trsv_ex
+    template <bool BATCHED, typename T>
+    rocblas_status rocblas_trsv_factor_template(rocblas_handle                    handle,
+                                                const _rocblas_triangular_factor* factor,
+                                                rocblas_operation                 transA,
+                                                void*                             x,
+                                                rocblas_int                       incx,
+                                                rocblas_stride                    stride_x)
+    {
+        using U = const_ptr_t<BATCHED, T>;
+        using V = std::conditional_t<BATCHED, T* const*, T*>;
+
+        U    A             = (U)factor->A;
+        U    supplied_invA = (U)(BATCHED ? factor->invA_arr : factor->invA);
+        auto w_mem         = handle->device_malloc(0);
+        void* w_mem_x_temp;
+        void* w_mem_x_temp_arr;
+        void* w_mem_invA;
+        void* w_mem_invA_arr;
+
+        rocblas_status status
+            = rocblas_internal_trsv_inverse_template_mem<BLOCK, BATCHED, T>(handle,
+                                                                            factor->k,
+                                                                            factor->batch_count,
+                                                                            w_mem,
+                                                                            w_mem_x_temp,
+                                                                            w_mem_x_temp_arr,
+                                                                            w_mem_invA,
+                                                                            w_mem_invA_arr,
+                                                                            supplied_invA,
+                                                                            factor->invA_size());
+        if(status != rocblas_status_success)
+            return status;
+
+        // The batched solve reads invA through invAarr whether or not it was supplied
+        return rocblas_internal_trsv_inverse_template<BLOCK, BATCHED, T>(
+            handle,
+            factor->uplo,
+            transA,
+            factor->diag,
+            factor->k,
+            A,
+            0,
+            factor->lda,
+            factor->stride_A,
+            (V)x,
+            0,
+            incx,
+            stride_x,
+            factor->batch_count,
+            w_mem_x_temp,
+            w_mem_x_temp_arr,
+            BATCHED ? factor->invA_arr : factor->invA,
+            factor->invA_arr,
+            supplied_invA,
+            factor->invA_size(),
+            0,
+            rocblas_stride(factor->invA_size()));
+    }
+
+    template <bool BATCHED>
+    rocblas_status rocblas_trsv_factor_dispatch(rocblas_handle                    handle,
+                                                const _rocblas_triangular_factor* factor,
+                                                rocblas_operation                 transA,
+                                                void*                             x,
+                                                rocblas_int                       incx,
+                                                rocblas_stride                    stride_x)
+    {
+        switch(factor->type)
+        {
+        case rocblas_datatype_f32_r:
+            return rocblas_trsv_factor_template<BATCHED, float>(
+                handle, factor, transA, x, incx, stride_x);
+        case rocblas_datatype_f64_r:
+            return rocblas_trsv_factor_template<BATCHED, double>(
+                handle, factor, transA, x, incx, stride_x);
+        case rocblas_datatype_f32_c:
+            return rocblas_trsv_factor_template<BATCHED, rocblas_float_complex>(
+                handle, factor, transA, x, incx, stride_x);
+        case rocblas_datatype_f64_c:
+            return rocblas_trsv_factor_template<BATCHED, rocblas_double_complex>(
+                handle, factor, transA, x, incx, stride_x);
+        default:
+            return rocblas_status_not_implemented;
+        }
+    }
+}
+// namespace
+
+extern "C" rocblas_status rocblas_create_triangular_factor(rocblas_handle             handle,
+                                                           rocblas_fill               uplo,
+                                                           rocblas_diagonal           diag,
+                                                           rocblas_int                k,
+                                                           const void*                A,
+                                                           rocblas_int                lda,
+                                                           rocblas_stride             stride_A,
+                                                           rocblas_int                batch_count,
+                                                           rocblas_datatype           compute_type,
+                                                           rocblas_triangular_factor* factor)
+try
+{
+    return rocblas_create_triangular_factor_impl(
+        handle, uplo, diag, k, A, lda, stride_A, batch_count, false, compute_type, factor);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status
+    rocblas_create_triangular_factor_batched(rocblas_handle             handle,
+                                             rocblas_fill               uplo,
+                                             rocblas_diagonal           diag,
+                                             rocblas_int                k,
+                                             const void* const          A[],
+                                             rocblas_int                lda,
+                                             rocblas_int                batch_count,
+                                             rocblas_datatype           compute_type,
+                                             rocblas_triangular_factor* factor)
+try
+{
+    return rocblas_create_triangular_factor_impl(
+        handle, uplo, diag, k, A, lda, 0, batch_count, true, compute_type, factor);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_destroy_triangular_factor(rocblas_triangular_factor factor)
+try
+{
+    delete factor;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_triangular_factor_inverse(rocblas_triangular_factor factor,
+                                                                const void**              invA,
+                                                                rocblas_int*    invA_size,
+                                                                rocblas_stride* stride_invA)
+try
+{
+    if(!factor || !invA || !invA_size || !stride_invA)
+        return rocblas_status_invalid_pointer;
+
+    *invA        = factor->batched ? factor->invA_arr : factor->invA;
+    *invA_size   = factor->invA_size();
+    *stride_invA = factor->invA_size();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_trsm_factor(rocblas_handle            handle,
+                                              rocblas_triangular_factor factor,
+                                              rocblas_side              side,
+                                              rocblas_operation         transA,
+                                              rocblas_int               m,
+                                              rocblas_int               n,
+                                              const void*               alpha,
+                                              void*                     B,
+                                              rocblas_int               ldb,
+                                              rocblas_stride            stride_B)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_trsm_factor", factor, side, transA, m, n, B, ldb, stride_B);
+
+    if(!factor)
+        return rocblas_status_invalid_pointer;
+
+    if(side != rocblas_side_left && side != rocblas_side_right)
+        return rocblas_status_invalid_value;
+
+    if(m < 0 || n < 0 || (side == rocblas_side_left ? m : n) != factor->k)
+        return rocblas_status_invalid_size;
+
+    if(factor->device != handle->getDevice())
+        return rocblas_status_invalid_value;
+
+    // The inverses are in the layout of the supplied invA of trsm_ex, which then only
+    // applies them and the off diagonal blocks of A
+    if(factor->batched)
+        return rocblas_trsm_batched_ex(handle,
+                                       side,
+                                       factor->uplo,
+                                       transA,
+                                       factor->diag,
+                                       m,
+                                       n,
+                                       alpha,
+                                       factor->A,
+                                       factor->lda,
+                                       B,
+                                       ldb,
+                                       factor->batch_count,
+                                       factor->invA_arr,
+                                       factor->invA_size(),
+                                       factor->type);
+    else if(factor->batch_count == 1)
+        return rocblas_trsm_ex(handle,
+                               side,
+                               factor->uplo,
+                               transA,
+                               factor->diag,
+                               m,
+                               n,
+                               alpha,
+                               factor->A,
+                               factor->lda,
+                               B,
+                               ldb,
+                               factor->invA,
+                               factor->invA_size(),
+                               factor->type);
+    else
+        return rocblas_trsm_strided_batched_ex(handle,
+                                               side,
+                                               factor->uplo,
+                                               transA,
+                                               factor->diag,
+                                               m,
+                                               n,
+                                               alpha,
+                                               factor->A,
+                                               factor->lda,
+                                               factor->stride_A,
+                                               B,
+                                               ldb,
+                                               stride_B,
+                                               factor->batch_count,
+                                               factor->invA,
+                                               factor->invA_size(),
+                                               factor->invA_size(),
+                                               factor->type);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_trsv_factor(rocblas_handle            handle,
+                                              rocblas_triangular_factor factor,
+                                              rocblas_operation         transA,
+                                              void*                     x,
+                                              rocblas_int               incx,
+                                              rocblas_stride            stride_x)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_trsv_factor", factor, transA, x, incx, stride_x);
+
+    if(!factor)
+        return rocblas_status_invalid_pointer;
+
+    if(transA != rocblas_operation_none && transA != rocblas_operation_transpose
+       && transA != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+
+    if(!incx)
+        return rocblas_status_invalid_size;
+
+    if(factor->device != handle->getDevice())
+        return rocblas_status_invalid_value;
+
+    // quick return if possible.
+    if(!factor->k || !factor->batch_count)
+    {
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+        return rocblas_status_success;
+    }
+
+    if(!x)
+        return rocblas_status_invalid_pointer;
+
+    return factor->batched
+               ? rocblas_trsv_factor_dispatch<true>(handle, factor, transA, x, incx, stride_x)
+               : rocblas_trsv_factor_dispatch<false>(handle, factor, transA, x, incx, stride_x);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
@@ -0,0 +1,272 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "logging.hpp"
+#include "rocblas_level2_ex.hpp"
+
+namespace
+{
+    // trmv_ex, trmv_batched_ex and trmv_strided_batched_ex, the strides being 0 and
+    // batch_count 1 for trmv_ex
+    template <bool BATCHED>
+    rocblas_status rocblas_trmv_ex_impl(rocblas_handle    handle,
+                                        rocblas_fill      uplo,
+                                        rocblas_operation transA,
+                                        rocblas_diagonal  diag,
+                                        rocblas_int       n,
+                                        const void*       A,
+                                        rocblas_datatype  a_type,
+                                        rocblas_int       lda,
+                                        rocblas_stride    stride_a,
+                                        void*             x,
+                                        rocblas_datatype  x_type,
+                                        rocblas_int       incx,
+                                        rocblas_stride    stride_x,
+                                        rocblas_int       batch_count,
+                                        rocblas_datatype  compute_type,
+                                        const char*       name)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes = rocblas_trmv_ex_workspace_size(n, batch_count, a_type, compute_type);
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(dev_bytes);
+
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
+        if(layer_mode & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_profile))
+        {
+            auto uplo_letter   = rocblas_fill_letter(uplo);
+            auto transA_letter = rocblas_transpose_letter(transA);
+            auto diag_letter   = rocblas_diag_letter(diag);
+            auto a_type_str    = rocblas_datatype_string(a_type);
+            auto x_type_str    = rocblas_datatype_string(x_type);
+            auto ex_type_str   = rocblas_datatype_string(compute_type);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(handle,
+                          name,
+                          uplo,
+                          transA,
+                          diag,
+                          n,
+                          A,
+                          a_type_str,
+                          lda,
+                          stride_a,
+                          x,
+                          x_type_str,
+                          incx,
+                          stride_x,
+                          batch_count,
+                          ex_type_str);
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            name,
+                            "uplo",
+                            uplo_letter,
+                            "transA",
+                            transA_letter,
+                            "diag",
+                            diag_letter,
+                            "N",
+                            n,
+                            "a_type",
+                            a_type_str,
+                            "lda",
+                            lda,
+                            "stride_a",
+                            stride_a,
+                            "b_type",
+                            x_type_str,
+                            "incx",
+                            incx,
+                            "stride_x",
+                            stride_x,
+                            "batch_count",
+                            batch_count,
+                            "compute_type",
+                            ex_type_str);
+        }
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+
+        if(transA != rocblas_operation_none && transA != rocblas_operation_transpose
+           && transA != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        if(diag != rocblas_diagonal_unit && diag != rocblas_diagonal_non_unit)
+            return rocblas_status_invalid_value;
+
+        if(n < 0 || lda < n || lda < 1 || !incx || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(!n || !batch_count)
+            return rocblas_status_success;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        return rocblas_trmv_ex_template<BATCHED>(name,
+                                                 handle,
+                                                 uplo,
+                                                 transA,
+                                                 diag,
+                                                 n,
+                                                 A,
+                                                 a_type,
+                                                 lda,
+                                                 stride_a,
+                                                 x,
+                                                 x_type,
+                                                 incx,
+                                                 stride_x,
+                                                 batch_count,
+                                                 compute_type,
+                                                 (void*)w_mem);
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_trmv_ex(rocblas_handle    handle,
+                               rocblas_fill      uplo,
+                               rocblas_operation transA,
+                               rocblas_diagonal  diag,
+                               rocblas_int       n,
+                               const void*       A,
+                               rocblas_datatype  a_type,
+                               rocblas_int       lda,
+                               void*             x,
+                               rocblas_datatype  x_type,
+                               rocblas_int       incx,
+                               rocblas_datatype  compute_type)
+try
+{
+    return rocblas_trmv_ex_impl<false>(handle,
+                                       uplo,
+                                       transA,
+                                       diag,
+                                       n,
+                                       A,
+                                       a_type,
+                                       lda,
+                                       0,
+                                       x,
+                                       x_type,
+                                       incx,
+                                       0,
+                                       1,
+                                       compute_type,
+                                       "rocblas_trmv_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_trmv_batched_ex(rocblas_handle    handle,
+                                       rocblas_fill      uplo,
+                                       rocblas_operation transA,
+                                       rocblas_diagonal  diag,
+                                       rocblas_int       n,
+                                       const void*       A,
+                                       rocblas_datatype  a_type,
+                                       rocblas_int       lda,
+                                       void*             x,
+                                       rocblas_datatype  x_type,
+                                       rocblas_int       incx,
+                                       rocblas_int       batch_count,
+                                       rocblas_datatype  compute_type)
+try
+{
+    return rocblas_trmv_ex_impl<true>(handle,
+                                      uplo,
+                                      transA,
+                                      diag,
+                                      n,
+                                      A,
+                                      a_type,
+                                      lda,
+                                      0,
+                                      x,
+                                      x_type,
+                                      incx,
+                                      0,
+                                      batch_count,
+                                      compute_type,
+                                      "rocblas_trmv_batched_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_trmv_strided_batched_ex(rocblas_handle    handle,
+                                               rocblas_fill      uplo,
+                                               rocblas_operation transA,
+                                               rocblas_diagonal  diag,
+                                               rocblas_int       n,
+                                               const void*       A,
+                                               rocblas_datatype  a_type,
+                                               rocblas_int       lda,
+                                               rocblas_stride    stride_a,
+                                               void*             x,
+                                               rocblas_datatype  x_type,
+                                               rocblas_int       incx,
+                                               rocblas_stride    stride_x,
+                                               rocblas_int       batch_count,
+                                               rocblas_datatype  compute_type)
+try
+{
+    return rocblas_trmv_ex_impl<false>(handle,
+                                       uplo,
+                                       transA,
+                                       diag,
+                                       n,
+                                       A,
+                                       a_type,
+                                       lda,
+                                       stride_a,
+                                       x,
+                                       x_type,
+                                       incx,
+                                       stride_x,
+                                       batch_count,
+                                       compute_type,
+                                       "rocblas_trmv_strided_batched_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -44,7 +44,7 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
-        auto layer_mode = handle->layer_mode;
+        auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, "rocblas_trsv_ex", uplo, transA, diag, m, A, lda, B, incx);
 
@@ -818,8 +818,11 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         stride_invA = BLOCK * m;
         if(BATCHED)
         {
-            setup_batched_array<BLOCK>(
-                handle->get_stream(), (T*)c_temp, 0, (T**)x_temparr, batch_count);
+            setup_batched_array<BLOCK>(handle->get_stream(),
+                                       (T*)c_temp,
+                                       rocblas_trtri_trsm_c_temp_els<BLOCK>(m),
+                                       (T**)x_temparr,
+                                       batch_count);
             setup_batched_array<BLOCK>(
                 handle->get_stream(), (T*)invA, stride_invA, (T**)invAarr, batch_count);
         }
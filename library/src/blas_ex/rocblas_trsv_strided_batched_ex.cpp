@@ -50,7 +50,7 @@ namespace
 
         if(!handle->is_device_memory_size_query())
         {
-            auto layer_mode = handle->layer_mode;
+            auto layer_mode = ROCBLAS_SAMPLED_LAYER_MODE(handle);
             if(layer_mode & rocblas_layer_mode_log_trace)
                 log_trace(handle,
                           "rocblas_trsv_strided_batched_ex",
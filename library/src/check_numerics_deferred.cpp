@@ -0,0 +1,98 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "check_numerics_deferred.hpp"
+#include "check_numerics_vector.hpp"
+
+rocblas_status
+    rocblas_deferred_check_numerics::next_record(const char*                function_name,
+                                                 int                        check_numerics,
+                                                 bool                       is_input,
+                                                 hipStream_t                stream,
+                                                 rocblas_check_numerics_t** record)
+{
+    rocblas_status status = rocblas_status_success;
+
+    // Report when the buffer is full, so that the checks since the last report are not lost
+    if(!entries.empty() && (entries.size() >= capacity || entries.size() >= d_records_capacity))
+        status = report(stream);
+
+    // The buffer is resized only when no checks are pending
+    if(entries.empty() && d_records_capacity != capacity)
+    {
+        if(d_records)
+            RETURN_IF_HIP_ERROR((hipFree)(d_records));
+        d_records          = nullptr;
+        d_records_capacity = 0;
+
+        size_t bytes = capacity * sizeof(rocblas_check_numerics_t);
+        RETURN_IF_HIP_ERROR((hipMalloc)(&d_records, bytes));
+        d_records_capacity = capacity;
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_records, 0, bytes, stream));
+    }
+
+    *record = d_records + entries.size();
+    entries.push_back({function_name, check_numerics, is_input});
+    return status;
+}
+
+rocblas_status rocblas_deferred_check_numerics::report(hipStream_t stream)
+{
+    if(entries.empty())
+        return rocblas_status_success;
+
+    std::vector<entry_t> reported;
+    reported.swap(entries);
+
+    size_t n     = reported.size();
+    size_t bytes = n * sizeof(rocblas_check_numerics_t);
+    h_records.resize(n);
+
+    hipError_t hip_status
+        = hipMemcpyAsync(h_records.data(), d_records, bytes, hipMemcpyDeviceToHost, stream);
+    if(hip_status == hipSuccess)
+        hip_status = hipStreamSynchronize(stream);
+
+    // Clear the reported records for the next checks
+    if(hip_status == hipSuccess)
+        hip_status = hipMemsetAsync(d_records, 0, bytes, stream);
+
+    if(hip_status != hipSuccess)
+    {
+        // The records cannot be trusted; they are reallocated and cleared by the next check
+        (void)(hipFree)(d_records);
+        d_records          = nullptr;
+        d_records_capacity = 0;
+        return get_rocblas_status_for_hip_status(hip_status);
+    }
+
+    rocblas_status status = rocblas_status_success;
+    for(size_t i = 0; i < n; i++)
+    {
+        const entry_t& entry = reported[i];
+        if(rocblas_check_numerics_abnormal_struct(
+               entry.function_name, entry.check_numerics, entry.is_input, &h_records[i])
+           != rocblas_status_success)
+            status = rocblas_status_check_numerics_fail;
+    }
+    return status;
+}
@@ -49,17 +49,41 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     if(!m || !n || !batch_count || !A)
         return rocblas_status_success;
 
+    //In fused mode only the outputs are checked
+    if(is_input && (check_numerics & rocblas_check_numerics_mode_fused))
+        return rocblas_status_success;
+
+    //The results of the check are read on the host, which graph safe mode does not allow
+    if(handle->is_graph_safe())
+        return rocblas_status_not_implemented;
+
     //Creating structure host object
-    rocblas_check_numerics_t h_abnormal;
+    rocblas_check_numerics_t  h_abnormal;
+    rocblas_check_numerics_t* d_abnormal = nullptr;
+    rocblas_status            status     = rocblas_status_success;
+
+    //In deferred mode the result is recorded in the handle and reported later
+    bool deferred = (check_numerics & rocblas_check_numerics_mode_deferred) != 0;
 
     //Allocating memory for device structure
-    auto d_abnormal = handle->device_malloc(sizeof(rocblas_check_numerics_t));
+    auto w_abnormal = handle->device_malloc(deferred ? 0 : sizeof(rocblas_check_numerics_t));
+
+    if(deferred)
+    {
+        //The record is cleared in stream order; a full set of records is reported first
+        status = handle->get_deferred_check_numerics_record(
+            function_name, check_numerics, is_input, &d_abnormal);
+        if(status != rocblas_status_success && status != rocblas_status_check_numerics_fail)
+            return status;
+    }
+    else
+    {
+        d_abnormal = (rocblas_check_numerics_t*)w_abnormal;
 
-    //Transferring the rocblas_check_numerics_t structure from host to the device
-    RETURN_IF_HIP_ERROR(hipMemcpy((rocblas_check_numerics_t*)d_abnormal,
-                                  &h_abnormal,
-                                  sizeof(rocblas_check_numerics_t),
-                                  hipMemcpyHostToDevice));
+        //Transferring the rocblas_check_numerics_t structure from host to the device
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            d_abnormal, &h_abnormal, sizeof(rocblas_check_numerics_t), hipMemcpyHostToDevice));
+    }
 
     //Checking trans_a to transpose a matrix 'A'
     rocblas_int num_rows_a = trans_a == rocblas_operation_none ? m : n;
@@ -87,7 +111,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                            offset_a,
                            lda,
                            stride_a,
-                           (rocblas_check_numerics_t*)d_abnormal);
+                           d_abnormal);
     }
     else if(matrix_type == rocblas_client_symmetric_matrix
             || matrix_type == rocblas_client_hermitian_matrix
@@ -104,14 +128,18 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                            offset_a,
                            lda,
                            stride_a,
-                           (rocblas_check_numerics_t*)d_abnormal);
+                           d_abnormal);
+    }
+
+    if(deferred)
+    {
+        handle->set_async_status_for_check(d_abnormal, check_numerics);
+        return status;
     }
 
     //Transferring the rocblas_check_numerics_t structure from device to the host
-    RETURN_IF_HIP_ERROR(hipMemcpy(&h_abnormal,
-                                  (rocblas_check_numerics_t*)d_abnormal,
-                                  sizeof(rocblas_check_numerics_t),
-                                  hipMemcpyDeviceToHost));
+    RETURN_IF_HIP_ERROR(hipMemcpy(
+        &h_abnormal, d_abnormal, sizeof(rocblas_check_numerics_t), hipMemcpyDeviceToHost));
 
     return rocblas_check_numerics_abnormal_struct(
         function_name, check_numerics, is_input, &h_abnormal);
@@ -58,6 +58,50 @@ rocblas_status rocblas_check_numerics_abnormal_struct(const char*
     }
     return rocblas_status_success;
 }
+
+rocblas_status rocblas_fused_check_numerics::begin()
+{
+    if(!(check_numerics & rocblas_check_numerics_mode_fused))
+        return rocblas_status_success;
+
+    //The record is read on the host, which graph safe mode does not allow
+    if(handle->is_graph_safe())
+        return rocblas_status_not_implemented;
+
+    //A failure of an earlier deferred check does not stop this function, as for a separate check
+    rocblas_check_numerics_t* d_abnormal = nullptr;
+    record_status                        = handle->get_deferred_check_numerics_record(
+        function_name, check_numerics, false, &d_abnormal);
+    if(record_status != rocblas_status_success
+       && record_status != rocblas_status_check_numerics_fail)
+        return record_status;
+
+    handle->fused_check_numerics = d_abnormal;
+    active                       = true;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_fused_check_numerics::end()
+{
+    if(!active)
+        return rocblas_status_success;
+
+    const rocblas_check_numerics_t* d_abnormal = handle->fused_check_numerics;
+    handle->fused_check_numerics               = nullptr;
+    active                                     = false;
+
+    //Outside deferred mode the record is reported now, it is the only one pending
+    rocblas_status status = record_status;
+    if(check_numerics & rocblas_check_numerics_mode_deferred)
+        handle->set_async_status_for_check(d_abnormal, check_numerics);
+    else
+    {
+        rocblas_status report_status = handle->report_check_numerics();
+        if(report_status != rocblas_status_success)
+            status = report_status;
+    }
+    return status;
+}
 /**
   *
   * rocblas_internal_check_numerics_vector_template(function_name, handle, n, x, offset_x, inc_x, stride_x, batch_count, check_numerics, is_input)
@@ -103,17 +147,41 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         return rocblas_status_success;
     }
 
+    //In fused mode only the outputs are checked
+    if(is_input && (check_numerics & rocblas_check_numerics_mode_fused))
+        return rocblas_status_success;
+
+    //The results of the check are read on the host, which graph safe mode does not allow
+    if(handle->is_graph_safe())
+        return rocblas_status_not_implemented;
+
     //Creating structure host object
-    rocblas_check_numerics_t h_abnormal;
+    rocblas_check_numerics_t  h_abnormal;
+    rocblas_check_numerics_t* d_abnormal = nullptr;
+    rocblas_status            status     = rocblas_status_success;
+
+    //In deferred mode the result is recorded in the handle and reported later
+    bool deferred = (check_numerics & rocblas_check_numerics_mode_deferred) != 0;
 
     //Allocating memory for device structure
-    auto d_abnormal = handle->device_malloc(sizeof(rocblas_check_numerics_t));
+    auto w_abnormal = handle->device_malloc(deferred ? 0 : sizeof(rocblas_check_numerics_t));
+
+    if(deferred)
+    {
+        //The record is cleared in stream order; a full set of records is reported first
+        status = handle->get_deferred_check_numerics_record(
+            function_name, check_numerics, is_input, &d_abnormal);
+        if(status != rocblas_status_success && status != rocblas_status_check_numerics_fail)
+            return status;
+    }
+    else
+    {
+        d_abnormal = (rocblas_check_numerics_t*)w_abnormal;
 
-    //Transferring the rocblas_check_numerics_t structure from host to the device
-    RETURN_IF_HIP_ERROR(hipMemcpy((rocblas_check_numerics_t*)d_abnormal,
-                                  &h_abnormal,
-                                  sizeof(rocblas_check_numerics_t),
-                                  hipMemcpyHostToDevice));
+        //Transferring the rocblas_check_numerics_t structure from host to the device
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            d_abnormal, &h_abnormal, sizeof(rocblas_check_numerics_t), hipMemcpyHostToDevice));
+    }
 
     hipStream_t           rocblas_stream = handle->get_stream();
     constexpr rocblas_int NB             = 256;
@@ -130,13 +198,17 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                        offset_x,
                        inc_x,
                        stride_x,
-                       (rocblas_check_numerics_t*)d_abnormal);
+                       d_abnormal);
+
+    if(deferred)
+    {
+        handle->set_async_status_for_check(d_abnormal, check_numerics);
+        return status;
+    }
 
     //Transferring the rocblas_check_numerics_t structure from device to the host
-    RETURN_IF_HIP_ERROR(hipMemcpy(&h_abnormal,
-                                  (rocblas_check_numerics_t*)d_abnormal,
-                                  sizeof(rocblas_check_numerics_t),
-                                  hipMemcpyDeviceToHost));
+    RETURN_IF_HIP_ERROR(hipMemcpy(
+        &h_abnormal, d_abnormal, sizeof(rocblas_check_numerics_t), hipMemcpyDeviceToHost));
 
     return rocblas_check_numerics_abnormal_struct(
         function_name, check_numerics, is_input, &h_abnormal);
@@ -0,0 +1,92 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "device_power.hpp"
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <hip/hip_runtime.h>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // The hwmon file reporting the power of device in microwatts, or an empty string
+    std::string rocblas_find_device_power_file(int device)
+    {
+#ifdef __linux__
+        char bus_id[64];
+        if(hipDeviceGetPCIBusId(bus_id, sizeof(bus_id), device) != hipSuccess)
+            return {};
+
+        // sysfs names PCI devices with lowercase hexadecimal digits
+        std::string name(bus_id);
+        for(auto& c : name)
+            c = std::tolower(c);
+
+        // hwmon directories are numbered across the system. Recent drivers report the
+        // instantaneous power1_input of some devices instead of power1_average.
+        std::string hwmon = "/sys/bus/pci/devices/" + name + "/hwmon/hwmon";
+        for(int i = 0; i < 256; i++)
+            for(const char* file : {"/power1_average", "/power1_input"})
+            {
+                std::string path = hwmon + std::to_string(i) + file;
+                if(std::ifstream(path))
+                    return path;
+            }
+#endif
+        return {};
+    }
+}
+
+double rocblas_device_power(int device)
+{
+    static std::mutex               mutex;
+    static std::vector<std::string> files;
+    static std::vector<bool>        found;
+
+    if(device < 0)
+        return -1;
+
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(size_t(device) >= files.size())
+        {
+            files.resize(device + 1);
+            found.resize(device + 1, false);
+        }
+        if(!found[device])
+        {
+            files[device] = rocblas_find_device_power_file(device);
+            found[device] = true;
+        }
+        path = files[device];
+    }
+
+    uint64_t      microwatts;
+    std::ifstream file(path);
+    if(path.empty() || !(file >> microwatts))
+        return -1;
+    return microwatts * 1e-6;
+}
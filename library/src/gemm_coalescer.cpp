@@ -0,0 +1,439 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "host_numa.hpp"
+#include "logging.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*******************************************************************************
+ * Coalescing of the same-shape gemm_ex calls of several threads into one
+ * rocblas_gemm_batched_ex on the stream of a rocblas_gemm_coalescer.
+ *
+ * The first call with a new set of arguments, other than the matrix pointers
+ * and the stream, leads a batch: it waits up to the window of the coalescer for
+ * other threads to join the batch, or for it to hold max_batch calls, then
+ * launches it. The coalescer's stream waits for events recorded on the streams
+ * of the calls, and their streams wait for the batch, so that no stream is
+ * synchronized; only the calling threads wait, at most for the window.
+ ******************************************************************************/
+namespace
+{
+    // Slots of pinned host and device memory holding the pointer arrays of the launched
+    // batches, each reused once the copy of the batch RING_SLOTS launches before has completed
+    constexpr int RING_SLOTS = 4;
+
+    // The arguments a gemm_ex call must share with the other calls of its batch
+    struct rocblas_gemm_coalesced_key
+    {
+        rocblas_operation trans_a, trans_b;
+        rocblas_int       m, n, k, lda, ldb, ldc, ldd;
+        rocblas_datatype  a_type, b_type, c_type, d_type, compute_type;
+        rocblas_gemm_algo algo;
+        int32_t           solution_index;
+        uint32_t          flags;
+        rocblas_union_t   alpha, beta;
+
+        bool operator==(const rocblas_gemm_coalesced_key& rhs) const
+        {
+            // The key is zero initialized, so that its padding compares equal
+            return !memcmp(this, &rhs, sizeof(*this));
+        }
+    };
+
+    struct rocblas_gemm_coalesced_call
+    {
+        const void* a;
+        const void* b;
+        const void* c;
+        void*       d;
+        hipStream_t stream;
+        hipEvent_t  ready;
+    };
+
+    struct rocblas_gemm_coalesced_batch
+    {
+        rocblas_gemm_coalesced_key               key;
+        std::vector<rocblas_gemm_coalesced_call> calls;
+        bool                                     closed   = false;
+        bool                                     launched = false;
+        rocblas_status                           status   = rocblas_status_success;
+    };
+}
+
+struct _rocblas_gemm_coalescer
+{
+    int                       device;
+    rocblas_handle            handle = nullptr;
+    hipStream_t               stream = nullptr;
+    std::chrono::microseconds window;
+    rocblas_int               max_batch;
+
+    // Batches collecting calls, and the condition their threads wait on
+    std::mutex                                                 mutex;
+    std::condition_variable                                    cond;
+    std::vector<std::shared_ptr<rocblas_gemm_coalesced_batch>> open;
+    std::vector<hipEvent_t>                                    idle_events;
+
+    // Launches are serialized on the handle and stream
+    std::mutex launch_mutex;
+    hipEvent_t done                    = nullptr;
+    void**     host_arrays[RING_SLOTS] = {};
+    void**     device_arrays           = nullptr;
+    hipEvent_t slot_copied[RING_SLOTS] = {};
+    int        slot                    = 0;
+
+    ~_rocblas_gemm_coalescer()
+    {
+        int saved_device;
+        (void)hipGetDevice(&saved_device);
+        (void)hipSetDevice(device);
+        for(auto event : idle_events)
+            (void)hipEventDestroy(event);
+        for(int i = 0; i < RING_SLOTS; i++)
+        {
+            if(slot_copied[i])
+                (void)hipEventDestroy(slot_copied[i]);
+            if(host_arrays[i])
+                (void)hipHostFree(host_arrays[i]);
+        }
+        if(device_arrays)
+            (void)(hipFree)(device_arrays);
+        if(done)
+            (void)hipEventDestroy(done);
+        delete handle;
+        if(stream)
+            (void)hipStreamDestroy(stream);
+        (void)hipSetDevice(saved_device);
+    }
+
+    rocblas_status create()
+    {
+        RETURN_IF_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+        handle = new _rocblas_handle;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&done, hipEventDisableTiming));
+
+        size_t bytes = sizeof(void*) * 4 * max_batch;
+        RETURN_IF_HIP_ERROR((hipMalloc)(&device_arrays, bytes * RING_SLOTS));
+        for(int i = 0; i < RING_SLOTS; i++)
+        {
+            RETURN_IF_HIP_ERROR(rocblas_host_malloc_near((void**)&host_arrays[i], bytes, device));
+            RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&slot_copied[i], hipEventDisableTiming));
+        }
+        return rocblas_status_success;
+    }
+
+    // An event marking the readiness of the inputs of a call, from the idle ones if possible
+    rocblas_status acquire_event(hipEvent_t& event)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(!idle_events.empty())
+            {
+                event = idle_events.back();
+                idle_events.pop_back();
+                return rocblas_status_success;
+            }
+        }
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+        return rocblas_status_success;
+    }
+
+    // Launch the closed batch on the coalescer's stream, after the inputs of all its calls are
+    // ready, and make the streams of the calls wait for it
+    rocblas_status launch(rocblas_gemm_coalesced_batch& batch)
+    {
+        std::lock_guard<std::mutex> lock(launch_mutex);
+
+        const auto& key   = batch.key;
+        const auto& calls = batch.calls;
+        rocblas_int count = rocblas_int(calls.size());
+
+        for(auto& call : calls)
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(stream, call.ready, 0));
+
+        rocblas_status status;
+        if(count == 1)
+        {
+            // clang-format off
+            status = rocblas_gemm_ex(handle, key.trans_a, key.trans_b, key.m, key.n, key.k,
+                                     &key.alpha, calls[0].a, key.a_type, key.lda,
+                                     calls[0].b, key.b_type, key.ldb, &key.beta,
+                                     calls[0].c, key.c_type, key.ldc,
+                                     calls[0].d, key.d_type, key.ldd,
+                                     key.compute_type, key.algo, key.solution_index, key.flags);
+            // clang-format on
+        }
+        else
+        {
+            // The copy from the slot of RING_SLOTS launches before must be complete before its
+            // pointer arrays are overwritten
+            RETURN_IF_HIP_ERROR(hipEventSynchronize(slot_copied[slot]));
+            void** host   = host_arrays[slot];
+            void** device = device_arrays + size_t(4) * max_batch * slot;
+            for(rocblas_int i = 0; i < count; i++)
+            {
+                host[i]             = const_cast<void*>(calls[i].a);
+                host[count + i]     = const_cast<void*>(calls[i].b);
+                host[2 * count + i] = const_cast<void*>(calls[i].c);
+                host[3 * count + i] = calls[i].d;
+            }
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                device, host, sizeof(void*) * 4 * count, hipMemcpyHostToDevice, stream));
+            RETURN_IF_HIP_ERROR(hipEventRecord(slot_copied[slot], stream));
+            slot = (slot + 1) % RING_SLOTS;
+
+            // clang-format off
+            status = rocblas_gemm_batched_ex(handle, key.trans_a, key.trans_b, key.m, key.n, key.k,
+                                             &key.alpha, device, key.a_type, key.lda,
+                                             device + count, key.b_type, key.ldb, &key.beta,
+                                             device + 2 * count, key.c_type, key.ldc,
+                                             device + 3 * count, key.d_type, key.ldd, count,
+                                             key.compute_type, key.algo, key.solution_index,
+                                             key.flags);
+            // clang-format on
+        }
+
+        RETURN_IF_HIP_ERROR(hipEventRecord(done, stream));
+        for(auto& call : calls)
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(call.stream, done, 0));
+        return status;
+    }
+};
+
+extern "C" rocblas_status rocblas_gemm_coalescer_create(rocblas_gemm_coalescer* coalescer,
+                                                        rocblas_int             window_us,
+                                                        rocblas_int             max_batch)
+try
+{
+    if(!coalescer)
+        return rocblas_status_invalid_pointer;
+    *coalescer = nullptr;
+    if(window_us < 0 || max_batch < 1)
+        return rocblas_status_invalid_size;
+
+    auto c = std::make_unique<_rocblas_gemm_coalescer>();
+    RETURN_IF_HIP_ERROR(hipGetDevice(&c->device));
+    c->window    = std::chrono::microseconds(window_us);
+    c->max_batch = max_batch;
+    RETURN_IF_ROCBLAS_ERROR(c->create());
+
+    *coalescer = c.release();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_gemm_coalescer_destroy(rocblas_gemm_coalescer coalescer)
+try
+{
+    if(!coalescer)
+        return rocblas_status_invalid_pointer;
+
+    // The launched batches may still be running on the coalescer's stream
+    hipError_t status = hipStreamSynchronize(coalescer->stream);
+    delete coalescer;
+    return get_rocblas_status_for_hip_status(status);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_gemm_coalesced_ex(rocblas_gemm_coalescer coalescer,
+                                                    hipStream_t            stream,
+                                                    rocblas_operation      trans_a,
+                                                    rocblas_operation      trans_b,
+                                                    rocblas_int            m,
+                                                    rocblas_int            n,
+                                                    rocblas_int            k,
+                                                    const void*            alpha,
+                                                    const void*            a,
+                                                    rocblas_datatype       a_type,
+                                                    rocblas_int            lda,
+                                                    const void*            b,
+                                                    rocblas_datatype       b_type,
+                                                    rocblas_int            ldb,
+                                                    const void*            beta,
+                                                    const void*            c,
+                                                    rocblas_datatype       c_type,
+                                                    rocblas_int            ldc,
+                                                    void*                  d,
+                                                    rocblas_datatype       d_type,
+                                                    rocblas_int            ldd,
+                                                    rocblas_datatype       compute_type,
+                                                    rocblas_gemm_algo      algo,
+                                                    int32_t                solution_index,
+                                                    uint32_t               flags)
+try
+{
+    if(!coalescer)
+        return rocblas_status_invalid_handle;
+
+    if(coalescer->handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(coalescer->handle,
+                  "rocblas_gemm_coalesced_ex",
+                  stream,
+                  trans_a,
+                  trans_b,
+                  m,
+                  n,
+                  k,
+                  a,
+                  rocblas_datatype_string(a_type),
+                  lda,
+                  b,
+                  rocblas_datatype_string(b_type),
+                  ldb,
+                  c,
+                  rocblas_datatype_string(c_type),
+                  ldc,
+                  d,
+                  rocblas_datatype_string(d_type),
+                  ldd,
+                  rocblas_datatype_string(compute_type),
+                  algo,
+                  solution_index,
+                  rocblas_gemm_flags(flags));
+
+    if(m < 0 || n < 0 || k < 0)
+        return rocblas_status_invalid_size;
+    if(!m || !n)
+        return rocblas_status_success;
+
+    size_t scalar_size = rocblas_sizeof_datatype(compute_type);
+    if(!scalar_size || scalar_size > sizeof(rocblas_union_t))
+        return rocblas_status_not_implemented;
+    if(!alpha || !beta || !d || (k && (!a || !b)))
+        return rocblas_status_invalid_pointer;
+
+    rocblas_gemm_coalesced_key key;
+    memset(&key, 0, sizeof(key));
+    memcpy(&key.alpha, alpha, scalar_size);
+    memcpy(&key.beta, beta, scalar_size);
+
+    // Without C, beta must be 0 and D is given as C, of the same shape
+    if(!c)
+    {
+        rocblas_union_t zero;
+        memset(&zero, 0, sizeof(zero));
+        if(memcmp(&key.beta, &zero, sizeof(zero)))
+            return rocblas_status_invalid_pointer;
+        c      = d;
+        c_type = d_type;
+        ldc    = ldd;
+    }
+
+    key.trans_a        = trans_a;
+    key.trans_b        = trans_b;
+    key.m              = m;
+    key.n              = n;
+    key.k              = k;
+    key.lda            = lda;
+    key.ldb            = ldb;
+    key.ldc            = ldc;
+    key.ldd            = ldd;
+    key.a_type         = a_type;
+    key.b_type         = b_type;
+    key.c_type         = c_type;
+    key.d_type         = d_type;
+    key.compute_type   = compute_type;
+    key.algo           = algo;
+    key.solution_index = solution_index;
+    key.flags          = flags;
+
+    auto saved_device_id = coalescer->handle->push_device_id();
+
+    // The coalescer's stream waits for the inputs of the call on stream
+    rocblas_gemm_coalesced_call call{a, b, c, d, stream, nullptr};
+    RETURN_IF_ROCBLAS_ERROR(coalescer->acquire_event(call.ready));
+    hipError_t hip_status = hipEventRecord(call.ready, stream);
+    if(hip_status != hipSuccess)
+    {
+        std::lock_guard<std::mutex> lock(coalescer->mutex);
+        coalescer->idle_events.push_back(call.ready);
+        return get_rocblas_status_for_hip_status(hip_status);
+    }
+
+    std::unique_lock<std::mutex>                  lock(coalescer->mutex);
+    std::shared_ptr<rocblas_gemm_coalesced_batch> batch;
+    for(auto& open : coalescer->open)
+        if(!open->closed && open->key == key)
+            batch = open;
+
+    const bool leader = !batch;
+    if(leader)
+    {
+        batch      = std::make_shared<rocblas_gemm_coalesced_batch>();
+        batch->key = key;
+        batch->calls.reserve(coalescer->max_batch);
+        coalescer->open.push_back(batch);
+    }
+    batch->calls.push_back(call);
+
+    // A full batch is closed to new calls and launched at once
+    if(batch->calls.size() >= size_t(coalescer->max_batch))
+    {
+        batch->closed = true;
+        if(!leader)
+            coalescer->cond.notify_all();
+    }
+
+    if(leader)
+    {
+        coalescer->cond.wait_for(lock, coalescer->window, [&] { return batch->closed; });
+        batch->closed = true;
+        auto& open    = coalescer->open;
+        open.erase(std::find(open.begin(), open.end(), batch));
+
+        // Other calls open new batches while this one is launched
+        lock.unlock();
+        rocblas_status status = coalescer->launch(*batch);
+        lock.lock();
+
+        for(auto& call : batch->calls)
+            coalescer->idle_events.push_back(call.ready);
+        batch->status   = status;
+        batch->launched = true;
+        coalescer->cond.notify_all();
+    }
+    else
+    {
+        coalescer->cond.wait(lock, [&] { return batch->launched; });
+    }
+
+    return batch->status;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
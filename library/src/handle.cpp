@@ -20,8 +20,15 @@
  *
  * ************************************************************************ */
 #include "handle.hpp"
+#include "level1_fusion.hpp"
+#include "tuple_helper.hpp"
+#include <algorithm>
+#include <bitset>
 #include <cstdarg>
 #include <limits>
+#include <map>
+#include <mutex>
+#include <vector>
 #ifdef WIN32
 #include <windows.h>
 #endif
@@ -31,11 +38,40 @@
 // see TensileHost.cpp for normal rocblas_initialize definition
 // it isn't compiled if not BUILD_WITH_TENSILE so defining here
 extern "C" void rocblas_initialize() {}
+
+extern "C" rocblas_status rocblas_initialize_devices(const int* ids, int n)
+{
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    if(n && !ids)
+        return rocblas_status_invalid_pointer;
+    return rocblas_status_success;
+}
+
+// without Tensile there are no code objects to preload
+extern "C" rocblas_status rocblas_gemm_warmup(rocblas_handle                     handle,
+                                              rocblas_int                        count,
+                                              const rocblas_gemm_warmup_problem* problems)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(count < 0)
+        return rocblas_status_invalid_size;
+    if(count && !problems)
+        return rocblas_status_invalid_pointer;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocblas_gemm_warmup_wait()
+{
+    return rocblas_status_success;
+}
 #endif
 
 // forcing early cleanup
 extern "C" void rocblas_shutdown()
 {
+    rocblas_handle_pool_clear();
     rocblas_internal_ostream::clear_workers();
 }
 
@@ -73,23 +109,139 @@ static inline int getActiveDevice()
     return device;
 }
 
+// Properties of a device used by the handles created on it. hipGetDeviceProperties takes
+// milliseconds, so they are queried once per device and shared by all handles of the process.
+struct rocblas_device_info
+{
+    int  arch            = 0;
+    int  cu_count        = 0;
+    int  warp_size       = 0;
+    int  l2_cache_size   = 0;
+    bool pools_supported = false;
+};
+
+static rocblas_device_info getDeviceInfo(int deviceId)
+{
+    static std::mutex                         mutex;
+    static std::map<int, rocblas_device_info> cache;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto                        it = cache.find(deviceId);
+    if(it != cache.end())
+        return it->second;
+
+    // Properties which could not be queried are not cached
+    rocblas_device_info info;
+    hipDeviceProp_t     deviceProperties;
+    if(hipGetDeviceProperties(&deviceProperties, deviceId) != hipSuccess)
+        return info;
+
+    info.arch          = deviceProperties.gcnArch;
+    info.cu_count      = deviceProperties.multiProcessorCount;
+    info.warp_size     = deviceProperties.warpSize;
+    info.l2_cache_size = deviceProperties.l2CacheSize;
+#if HIP_VERSION >= 50300000
+    int pools_supported  = 0;
+    info.pools_supported = hipDeviceGetAttribute(&pools_supported,
+                                                 hipDeviceAttributeMemoryPoolsSupported,
+                                                 deviceId)
+                               == hipSuccess
+                           && pools_supported;
+#endif
+    cache.emplace(deviceId, info);
+    return info;
+}
+
 static inline int getActiveArch(int deviceId)
 {
-    hipDeviceProp_t deviceProperties;
-    hipGetDeviceProperties(&deviceProperties, deviceId);
-    return deviceProperties.gcnArch;
+    return getDeviceInfo(deviceId).arch;
 }
 
+static inline int getActiveCUCount(int deviceId)
+{
+    return getDeviceInfo(deviceId).cu_count;
+}
+
+static inline int getActiveWarpSize(int deviceId)
+{
+    return getDeviceInfo(deviceId).warp_size;
+}
+
+// Threads per block of the Level 1 reductions on the RDNA architectures which run 32 wide
+// wavefronts, on which the blocks of the wave64 sizes would have twice as many wavefronts
+struct rocblas_wave32_block_sizes
+{
+    int         arch;
+    rocblas_int dot_nb;
+    rocblas_int iamax_nb;
+};
+
+static constexpr rocblas_wave32_block_sizes rocblas_wave32_block_sizes_table[] = {
+    {1030, ROCBLAS_DOT_NB_WAVE32, ROCBLAS_IAMAX_NB_WAVE32}, // navi21
+    {1100, ROCBLAS_DOT_NB_WAVE32, ROCBLAS_IAMAX_NB_WAVE32}, // navi31
+    {1101, ROCBLAS_DOT_NB_WAVE32, ROCBLAS_IAMAX_NB_WAVE32}, // navi32
+    {1102, ROCBLAS_DOT_NB_WAVE32, ROCBLAS_IAMAX_NB_WAVE32}, // navi33
+};
+
 /*******************************************************************************
  * constructor
  ******************************************************************************/
 _rocblas_handle::_rocblas_handle()
     : device(getActiveDevice()) // active device is handle device
     , arch(getActiveArch(device))
+    , cu_count(getActiveCUCount(device))
 {
     archMajor = arch / 100; // this may need to switch to string handling in the future
 
+    // Tuned Level 2 thresholds, or the defaults for the architecture
+    level2_thresholds = rocblas_level2_tuning::instance().get(arch);
+
+    //ROCBLAS_INTERNAL_LEVEL1_BLOCKS_PER_CU
+    // Blocks per compute unit of the grid-stride Level 1 launch, 0 (the default) for a grid of
+    // one thread per element. The grid-stride blocks have four wavefronts, one per SIMD of the
+    // compute unit on wave64 architectures.
+    const char* level1_blocks_per_cu_env = read_env("ROCBLAS_INTERNAL_LEVEL1_BLOCKS_PER_CU");
+    if(level1_blocks_per_cu_env)
+        level1_blocks_per_cu = std::max(0, atoi(level1_blocks_per_cu_env));
+    level1_block_size = 4 * getActiveWarpSize(device);
+
+    //ROCBLAS_INTERNAL_WAVE32_BLOCK_SIZES
+    // Block sizes of the Level 1 reductions from the wave32 table when the device's architecture
+    // is listed and it runs 32 wide wavefronts. 0 keeps the compile time sizes.
+    const char* wave32_block_sizes_env = read_env("ROCBLAS_INTERNAL_WAVE32_BLOCK_SIZES");
+    bool        wave32_block_sizes     = !wave32_block_sizes_env || atoi(wave32_block_sizes_env);
+    if(wave32_block_sizes && getActiveWarpSize(device) == 32)
+    {
+        for(const auto& sizes : rocblas_wave32_block_sizes_table)
+        {
+            if(sizes.arch == arch)
+            {
+                dot_nb   = sizes.dot_nb;
+                iamax_nb = sizes.iamax_nb;
+            }
+        }
+    }
+
+    //ROCBLAS_INTERNAL_LEVEL1_NONTEMPORAL_BYTES
+    // Bytes of vectors above which the unit stride Level 1 kernels use nontemporal loads and
+    // stores, 0 to never use them. The default is the size of the device's L2 cache, which
+    // vectors larger than it cannot stay resident in anyway.
+    const char* level1_nontemporal_env = read_env("ROCBLAS_INTERNAL_LEVEL1_NONTEMPORAL_BYTES");
+    level1_nontemporal_bytes           = level1_nontemporal_env
+                                             ? strtoull(level1_nontemporal_env, nullptr, 0)
+                                             : size_t(getDeviceInfo(device).l2_cache_size);
+
+    //ROCBLAS_INTERNAL_FORK_STREAMS
+    // Auxiliary streams, created on first use, onto which trsm, trmm and trtri fork their
+    // independent sub-operations. The default of 0 runs them in order on the handle's stream.
+    const char* fork_streams_env = read_env("ROCBLAS_INTERNAL_FORK_STREAMS");
+    if(fork_streams_env)
+        fork_stream_count = std::min(std::max(0, atoi(fork_streams_env)), 8);
+
     //ROCBLAS_STREAM_ORDER_ALLOC
+    // Stream order allocation from a memory pool owned by the handle is the default where
+    // the device supports memory pools. ROCBLAS_STREAM_ORDER_ALLOC=0 selects a single
+    // workspace which is reallocated on demand.
     const char* stream_order_alloc_env = read_env("ROCBLAS_STREAM_ORDER_ALLOC");
 
     if(stream_order_alloc_env)
@@ -97,6 +249,10 @@ _rocblas_handle::_rocblas_handle()
         int stream_order_alloc_env_val = strtoul(stream_order_alloc_env, nullptr, 0);
         stream_order_alloc             = stream_order_alloc_env_val ? true : false;
     }
+    else
+    {
+        stream_order_alloc = getDeviceInfo(device).pools_supported;
+    }
 
     // Device memory size
     const char* env = read_env("ROCBLAS_DEVICE_MEMORY_SIZE");
@@ -125,9 +281,13 @@ _rocblas_handle::_rocblas_handle()
         }
     }
 
+    // A rocBLAS managed workspace is only allocated when it is first needed, so that creating
+    // a handle allocates no device memory; a fixed size set by ROCBLAS_DEVICE_MEMORY_SIZE is
+    // allocated up front
+    bool rocblas_managed = device_memory_owner == rocblas_device_memory_ownership::rocblas_managed;
     if(!stream_order_alloc)
     { // Allocate device memory
-        if(device_memory_size)
+        if(device_memory_size && (!rocblas_managed || !ROCBLAS_REALLOC_ON_DEMAND))
             THROW_IF_HIP_ERROR((hipMalloc)(&device_memory, device_memory_size));
     }
     else
@@ -135,14 +295,15 @@ _rocblas_handle::_rocblas_handle()
 // hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
 // Support for default stream added in hip version 5.3.0
 #if HIP_VERSION >= 50300000
-        // The following allocation & free of device memory using hipMallocAsync/hipFreeAsync will allocate memory from
-        // the OS and release it to default memory pool. Further allocation of memory using hipMallocAsync
-        // will be from the memory pool and it will be faster.
-        THROW_IF_HIP_ERROR((hipMallocAsync)(&device_memory, device_memory_size, stream));
-
-        THROW_IF_HIP_ERROR((hipFreeAsync)(device_memory, stream));
-
-        device_memory = nullptr;
+        // Memory above the release threshold is returned to the device when the stream
+        // synchronizes; by default the pool keeps the default workspace size resident. The
+        // pool is created with the first stream order allocation.
+        const char* threshold_env = read_env("ROCBLAS_MEMORY_POOL_RELEASE_THRESHOLD");
+        if(threshold_env)
+            mem_pool_release_threshold = strtoull(threshold_env, nullptr, 0);
+
+        if(!rocblas_managed && device_memory_size)
+            THROW_IF_HIP_ERROR(stream_order_malloc(&device_memory, device_memory_size, stream));
 #else
         rocblas_cerr
             << "rocBLAS internal error: Stream order allocation is supported on ROCm 5.3 and above."
@@ -151,6 +312,11 @@ _rocblas_handle::_rocblas_handle()
 #endif
     }
 
+    // Solution cache size
+    const char* solution_cache_env = read_env("ROCBLAS_SOLUTION_CACHE_SIZE");
+    if(solution_cache_env)
+        solution_cache.set_capacity(strtoul(solution_cache_env, nullptr, 0));
+
     // Initialize logging
     init_logging();
 
@@ -163,6 +329,100 @@ _rocblas_handle::_rocblas_handle()
  ******************************************************************************/
 _rocblas_handle::~_rocblas_handle()
 {
+    // Run the Level 1 operations still deferred for fusion
+    if(level1_fusion)
+    {
+        rocblas_level1_fusion_flush(this);
+        delete level1_fusion;
+    }
+
+    // Deferred host results are delivered through staging buffers owned by the handle
+    if(host_staging.get_pending())
+        hipStreamSynchronize(stream);
+
+    // Report deferred numerical checks which have not been reported yet
+    if(deferred_check_numerics.get_pending())
+        deferred_check_numerics.report(stream);
+
+    // Accumulate the GPU times of the profiled calls, which are logged with the profile
+    if(profile_timer.get_pending())
+        profile_timer.flush(stream);
+
+    // Log the host times of the GEMM problems run with Tensile with the profile
+    if((layer_mode & rocblas_layer_mode_log_profile) && log_profile_os
+       && tensile_host_profile.calls)
+    {
+        using profile_t = rocblas_tensile_host_profile;
+        const auto& p   = tensile_host_profile;
+        *log_profile_os << "- ";
+        tuple_helper::print_tuple_pairs(*log_profile_os,
+                                        std::make_tuple("rocblas_function",
+                                                        "tensile_host",
+                                                        "call_count",
+                                                        p.calls,
+                                                        "selection_count",
+                                                        p.selections,
+                                                        "launch_count",
+                                                        p.launches,
+                                                        "construct_us",
+                                                        p.stage_us[profile_t::construct],
+                                                        "select_us",
+                                                        p.stage_us[profile_t::select],
+                                                        "solve_us",
+                                                        p.stage_us[profile_t::solve],
+                                                        "launch_us",
+                                                        p.stage_us[profile_t::launch]));
+        log_profile_os->flush();
+    }
+
+    // Log the device memory allocations with the profile, for each function and in total
+    if((layer_mode & rocblas_layer_mode_log_profile) && log_profile_os
+       && device_memory_profile.get_total().allocations)
+    {
+        auto log_entry = [&](const char* func, const auto& e) {
+            *log_profile_os << "- ";
+            tuple_helper::print_tuple_pairs(*log_profile_os,
+                                            std::make_tuple("rocblas_function",
+                                                            "device_memory",
+                                                            "function",
+                                                            func,
+                                                            "allocation_count",
+                                                            e.allocations,
+                                                            "failure_count",
+                                                            e.failures,
+                                                            "mean_size",
+                                                            e.total_size / e.allocations,
+                                                            "peak_size",
+                                                            e.peak_size));
+        };
+        for(const auto& f : device_memory_profile.get_functions())
+            log_entry(f.first.c_str(), f.second);
+        log_entry("all", device_memory_profile.get_total());
+        log_profile_os->flush();
+    }
+
+    // Log the Tensile solutions and kernel variants selected by each function with the profile
+    if((layer_mode & rocblas_layer_mode_log_profile) && log_profile_os
+       && !kernel_profile.get_counts().empty())
+    {
+        for(const auto& k : kernel_profile.get_counts())
+        {
+            *log_profile_os << "- ";
+            tuple_helper::print_tuple_pairs(*log_profile_os,
+                                            std::make_tuple("rocblas_function",
+                                                            "kernel_selection",
+                                                            "function",
+                                                            std::get<0>(k.first),
+                                                            "kernel",
+                                                            std::get<1>(k.first),
+                                                            "solution_index",
+                                                            std::get<2>(k.first),
+                                                            "call_count",
+                                                            k.second));
+        }
+        log_profile_os->flush();
+    }
+
     if(device_memory_in_use)
     {
         rocblas_cerr
@@ -201,17 +461,673 @@ _rocblas_handle::~_rocblas_handle()
                              << std::endl;
                 rocblas_abort();
             };
+#endif
+        }
+    }
+
+    // Auxiliary streams of forked sub-operations
+    for(auto aux_stream : aux_streams)
+        hipStreamDestroy(aux_stream);
+    for(auto aux_event : aux_events)
+        hipEventDestroy(aux_event);
+    if(fork_event)
+        hipEventDestroy(fork_event);
+
+    // Detach from the shared workspace pool, which is destroyed with its last reference
+    if(workspace_pool)
+        workspace_pool->release();
+
+#if HIP_VERSION >= 50300000
+    // Releases the handle's memory pool back to OS; destruction is deferred by HIP
+    // until outstanding frees have completed
+    if(mem_pool)
+        hipMemPoolDestroy(mem_pool);
+#endif
+}
+
+/*******************************************************************************
+ * stream order memory pool configuration
+ ******************************************************************************/
+#if HIP_VERSION >= 50300000
+hipError_t _rocblas_handle::create_mem_pool()
+{
+    hipMemPoolProps pool_props = {};
+    pool_props.allocType       = hipMemAllocationTypePinned;
+    pool_props.location.type   = hipMemLocationTypeDevice;
+    pool_props.location.id     = device;
+
+    hipError_t status = hipMemPoolCreate(&mem_pool, &pool_props);
+    if(status == hipSuccess)
+        status = hipMemPoolSetAttribute(
+            mem_pool, hipMemPoolAttrReleaseThreshold, &mem_pool_release_threshold);
+    return status;
+}
+#endif
+
+rocblas_status _rocblas_handle::set_memory_pool_attributes(size_t   reserve_size,
+                                                           uint64_t release_threshold)
+{
+#if HIP_VERSION >= 50300000
+    if(!stream_order_alloc)
+        return rocblas_status_not_implemented;
+
+    mem_pool_release_threshold = release_threshold;
+    if(!mem_pool)
+        RETURN_IF_HIP_ERROR(create_mem_pool());
+    else
+        RETURN_IF_HIP_ERROR(
+            hipMemPoolSetAttribute(mem_pool, hipMemPoolAttrReleaseThreshold, &release_threshold));
+
+    // Grow the pool to reserve_size by allocating and freeing it in stream order;
+    // the threshold keeps it resident if reserve_size <= release_threshold
+    if(reserve_size)
+    {
+        void* reserve = nullptr;
+        RETURN_IF_HIP_ERROR(stream_order_malloc(&reserve, reserve_size, stream));
+        RETURN_IF_HIP_ERROR(hipFreeAsync(reserve, stream));
+    }
+
+    // Release anything above the threshold which is not in use
+    RETURN_IF_HIP_ERROR(
+        hipMemPoolTrimTo(mem_pool, std::max<uint64_t>(release_threshold, reserve_size)));
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+rocblas_status _rocblas_handle::get_memory_pool_attributes(size_t*   reserved_size,
+                                                           size_t*   used_size,
+                                                           uint64_t* release_threshold)
+{
+#if HIP_VERSION >= 50300000
+    if(!stream_order_alloc)
+        return rocblas_status_not_implemented;
 
-            hipMemPool_t mem_pool;
-            int          device;
-            hipGetDevice(&device);
-            hipDeviceGetDefaultMemPool(&mem_pool, device);
+    // Nothing has been allocated before the pool is created
+    if(!mem_pool)
+    {
+        if(reserved_size)
+            *reserved_size = 0;
+        if(used_size)
+            *used_size = 0;
+        if(release_threshold)
+            *release_threshold = mem_pool_release_threshold;
+        return rocblas_status_success;
+    }
 
-            //Releases device memory back to OS
-            hipMemPoolTrimTo(mem_pool, 0);
+    uint64_t value;
+    if(reserved_size)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemPoolGetAttribute(mem_pool, hipMemPoolAttrReservedMemCurrent, &value));
+        *reserved_size = value;
+    }
+    if(used_size)
+    {
+        RETURN_IF_HIP_ERROR(hipMemPoolGetAttribute(mem_pool, hipMemPoolAttrUsedMemCurrent, &value));
+        *used_size = value;
+    }
+    if(release_threshold)
+        RETURN_IF_HIP_ERROR(
+            hipMemPoolGetAttribute(mem_pool, hipMemPoolAttrReleaseThreshold, release_threshold));
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
 #endif
+}
+
+extern "C" rocblas_status rocblas_set_device_memory_pool_attributes(rocblas_handle handle,
+                                                                    size_t         reserve_size,
+                                                                    uint64_t release_threshold)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // Temporarily change the thread's default device ID to the handle's device ID
+    auto saved_device_id = handle->push_device_id();
+
+    return handle->set_memory_pool_attributes(reserve_size, release_threshold);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_device_memory_pool_attributes(rocblas_handle handle,
+                                                                    size_t*        reserved_size,
+                                                                    size_t*        used_size,
+                                                                    uint64_t* release_threshold)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    return handle->get_memory_pool_attributes(reserved_size, used_size, release_threshold);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_set_workspace_pool(rocblas_handle         handle,
+                                                     rocblas_workspace_pool pool)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // Only the rocBLAS managed workspaces of stream order allocation come from a pool
+    if(!handle->stream_order_alloc)
+        return rocblas_status_not_implemented;
+    if(pool
+       && (pool->get_device() != handle->getDevice()
+           || handle->device_memory_owner != rocblas_device_memory_ownership::rocblas_managed))
+        return rocblas_status_invalid_value;
+
+    if(pool == handle->workspace_pool)
+        return rocblas_status_success;
+
+    // Temporarily change the thread's default device ID to the handle's device ID
+    auto saved_device_id = handle->push_device_id();
+
+    if(pool)
+    {
+        pool->retain();
+
+        // The handle's own pool is not used while the workspace pool is attached, so the
+        // memory it keeps is released to the device
+        if(!handle->workspace_pool)
+        {
+            rocblas_status status = handle->set_memory_pool_attributes(0, 0);
+            if(status != rocblas_status_success)
+            {
+                pool->release();
+                return status;
+            }
         }
     }
+
+    if(handle->workspace_pool)
+        handle->workspace_pool->release();
+    handle->workspace_pool = pool;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * deferred host results of reductions
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_deferred_host_results(rocblas_handle handle, bool deferred)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    handle->deferred_host_results = deferred;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_deferred_host_results(rocblas_handle handle, bool* deferred)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!deferred)
+        return rocblas_status_invalid_pointer;
+
+    *deferred = handle->deferred_host_results;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * graph safe mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_graph_safe_mode(rocblas_handle handle, bool graph_safe)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    handle->graph_safe = graph_safe;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_graph_safe_mode(rocblas_handle handle, bool* graph_safe)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!graph_safe)
+        return rocblas_status_invalid_pointer;
+
+    *graph_safe = handle->graph_safe;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief  Enable or disable the detection of evenly strided pointer arrays by
+ * the batched gemm functions
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_batched_stride_detection(rocblas_handle handle, bool detect)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    handle->batched_stride_detection = detect;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_batched_stride_detection(rocblas_handle handle, bool* detect)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!detect)
+        return rocblas_status_invalid_pointer;
+
+    *detect = handle->batched_stride_detection;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief  Select the implementation of the GEMMs of the handle
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_gemm_backend(rocblas_handle       handle,
+                                                   rocblas_gemm_backend backend)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    switch(backend)
+    {
+    case rocblas_gemm_backend_default:
+    case rocblas_gemm_backend_source:
+        break;
+    case rocblas_gemm_backend_tensile:
+#if !BUILD_WITH_TENSILE
+        return rocblas_status_not_implemented;
+#endif
+        break;
+    default:
+        return rocblas_status_invalid_value;
+    }
+
+    handle->gemm_backend = backend;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_gemm_backend(rocblas_handle        handle,
+                                                   rocblas_gemm_backend* backend)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!backend)
+        return rocblas_status_invalid_pointer;
+
+    *backend = handle->gemm_backend;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * reproducible mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_reproducible_mode(rocblas_handle handle, bool reproducible)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    handle->reproducible = reproducible;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_reproducible_mode(rocblas_handle handle, bool* reproducible)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!reproducible)
+        return rocblas_status_invalid_pointer;
+
+    *reproducible = handle->reproducible;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * compensated summation mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_compensated_summation_mode(rocblas_handle handle,
+                                                                 bool           compensated)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    handle->compensated_summation = compensated;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_compensated_summation_mode(rocblas_handle handle,
+                                                                 bool*          compensated)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!compensated)
+        return rocblas_status_invalid_pointer;
+
+    *compensated = handle->compensated_summation;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * stochastic rounding mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_stochastic_rounding_mode(rocblas_handle handle,
+                                                               bool           stochastic,
+                                                               uint64_t       seed,
+                                                               uint64_t       offset)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    handle->stochastic_rounding        = stochastic;
+    handle->stochastic_rounding_seed   = seed;
+    handle->stochastic_rounding_offset = offset;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_stochastic_rounding_mode(rocblas_handle handle,
+                                                               bool*          stochastic,
+                                                               uint64_t*      seed,
+                                                               uint64_t*      offset)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!stochastic || !seed || !offset)
+        return rocblas_status_invalid_pointer;
+
+    *stochastic = handle->stochastic_rounding;
+    *seed       = handle->stochastic_rounding_seed;
+    *offset     = handle->stochastic_rounding_offset;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * mixed precision trsm refinement
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_trsm_refinement(rocblas_handle handle, rocblas_int max_steps)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(max_steps < 0)
+        return rocblas_status_invalid_value;
+
+    handle->trsm_refinement_steps = max_steps;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_trsm_refinement(rocblas_handle handle, rocblas_int* max_steps)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!max_steps)
+        return rocblas_status_invalid_pointer;
+
+    *max_steps = handle->trsm_refinement_steps;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * managed memory prefetching
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_managed_prefetch(rocblas_handle handle, bool prefetch)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    handle->managed_prefetch = prefetch;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_managed_prefetch(rocblas_handle handle, bool* prefetch)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!prefetch)
+        return rocblas_status_invalid_pointer;
+
+    *prefetch = handle->managed_prefetch;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * persisting ranges
+ ******************************************************************************/
+extern "C" rocblas_status
+    rocblas_add_persisting_range(rocblas_handle handle, const void* ptr, size_t size)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!ptr)
+        return rocblas_status_invalid_pointer;
+
+    if(size)
+        handle->persisting_ranges.emplace_back((const char*)ptr, size);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_clear_persisting_ranges(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    handle->persisting_ranges.clear();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * per batch scalars
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_batched_scalar_stride(rocblas_handle handle,
+                                                            rocblas_stride alpha_stride,
+                                                            rocblas_stride beta_stride)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    handle->alpha_batch_stride = alpha_stride;
+    handle->beta_batch_stride  = beta_stride;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_batched_scalar_stride(rocblas_handle  handle,
+                                                            rocblas_stride* alpha_stride,
+                                                            rocblas_stride* beta_stride)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!alpha_stride || !beta_stride)
+        return rocblas_status_invalid_pointer;
+
+    *alpha_stride = handle->alpha_batch_stride;
+    *beta_stride  = handle->beta_batch_stride;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * asynchronous error status
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_async_status_mode(rocblas_handle handle, bool async_status)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(async_status)
+    {
+        rocblas_status status = handle->init_async_status();
+        if(status != rocblas_status_success)
+            return status;
+    }
+
+    handle->async_status_mode = async_status;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_async_status_mode(rocblas_handle handle, bool* async_status)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!async_status)
+        return rocblas_status_invalid_pointer;
+
+    *async_status = handle->async_status_mode;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_async_status(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    return handle->take_async_status();
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * deferred numerical checking
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_report_check_numerics(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    return handle->report_check_numerics();
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
 }
 
 /*******************************************************************************
@@ -220,8 +1136,14 @@ _rocblas_handle::~_rocblas_handle()
 #if ROCBLAS_REALLOC_ON_DEMAND
 bool _rocblas_handle::device_allocator(size_t size)
 {
-    bool success = size <= device_memory_size - device_memory_in_use;
-    if(!success && device_memory_owner == rocblas_device_memory_ownership::rocblas_managed)
+    // A rocBLAS managed workspace of device_memory_size is only allocated when first needed
+    bool success = (device_memory || !size) && size <= device_memory_size - device_memory_in_use;
+
+    // Reallocation synchronizes the device, and cannot be captured into a graph. The first
+    // allocation frees nothing, and is made in graph safe mode as well. The workspace holding
+    // the regions of open workspace scopes is never reallocated.
+    if(!success && device_memory_owner == rocblas_device_memory_ownership::rocblas_managed
+       && workspace_scopes.empty() && (!device_memory || !is_graph_safe()))
     {
         if(device_memory_in_use)
         {
@@ -234,12 +1156,14 @@ bool _rocblas_handle::device_allocator(size_t size)
         // cppcheck-suppress unreadVariable
         auto saved_device_id = push_device_id();
 
+        // The first allocation is of at least the default size
+        size_t alloc_size  = device_memory ? size : std::max(size, device_memory_size);
         device_memory_size = 0;
         if(!device_memory || (hipFree)(device_memory) == hipSuccess)
         {
-            success = (hipMalloc)(&device_memory, size) == hipSuccess;
+            success = (hipMalloc)(&device_memory, alloc_size) == hipSuccess;
             if(success)
-                device_memory_size = size;
+                device_memory_size = alloc_size;
             else
                 device_memory = nullptr;
         }
@@ -372,7 +1296,7 @@ try
 // Support for default stream added in hip version 5.3.0
 #if HIP_VERSION >= 50300000
     else
-        hipStatus = (hipMallocAsync)(&handle->device_memory, size, handle->stream);
+        hipStatus = handle->stream_order_malloc(&handle->device_memory, size, handle->stream);
 #endif
 
     if(hipStatus != hipSuccess)
@@ -628,6 +1552,146 @@ extern "C" rocblas_status rocblas_device_malloc_free(rocblas_device_malloc_base*
     return rocblas_status_success;
 }
 
+/*! \brief
+    \details
+    Opens a workspace scope: reserves reserved_size bytes of the device memory of handle, and
+    makes sure that nested_size more bytes remain for the rocBLAS calls made in the scope,
+    which then take their memory from the rest of the workspace without allocating any.
+    During a device memory size query, nothing is reserved and reserved_size is added to the
+    sizes collected until the scope is closed.
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_pointer
+    if reserved is nullptr; rocblas_status_memory_error if the workspace cannot hold
+    reserved_size + nested_size bytes; rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+    reserved_size   size of the region reserved by the caller
+    nested_size     size needed by the calls made in the scope
+    @param[out]
+    reserved        pointer to the reserved region, nullptr during a query or if reserved_size is 0
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_push_workspace_scope(rocblas_handle handle,
+                                                       size_t         reserved_size,
+                                                       size_t         nested_size,
+                                                       void**         reserved)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!reserved)
+        return rocblas_status_invalid_pointer;
+    *reserved = nullptr;
+
+    size_t size   = roundup_device_memory_size(reserved_size);
+    size_t needed = size + roundup_device_memory_size(nested_size);
+
+    if(handle->device_memory_size_query)
+    {
+        handle->set_optimal_device_memory_size(needed);
+        handle->device_memory_query_base += size;
+        handle->workspace_scopes.push_back({size, true, nullptr, 0});
+        return rocblas_status_success;
+    }
+
+    // Temporarily change the thread's default device ID to the handle's device ID
+    auto saved_device_id = handle->push_device_id();
+
+    void*  block      = nullptr;
+    size_t saved_size = 0;
+    if(handle->is_stream_order_workspace())
+    {
+        // The outermost scope of a handle allocating in stream order takes one block for
+        // itself and the scopes and calls nested in it, in place of the unused workspace
+#if HIP_VERSION >= 50300000
+        if(needed && handle->workspace_malloc(&block, needed, handle->stream) != hipSuccess)
+            return rocblas_status_memory_error;
+#endif
+        saved_size                   = handle->device_memory_size;
+        handle->device_memory        = block;
+        handle->device_memory_size   = block ? needed : 0;
+        handle->device_memory_in_use = 0;
+    }
+    else
+    {
+        bool success = (handle->device_memory || !needed)
+                       && needed <= handle->device_memory_size - handle->device_memory_in_use;
+#if ROCBLAS_REALLOC_ON_DEMAND
+        if(!success && !handle->device_memory_in_use)
+            success = handle->device_allocator(needed);
+#endif
+        if(!success)
+            return rocblas_status_memory_error;
+    }
+
+    if(size)
+    {
+        *reserved = static_cast<char*>(handle->device_memory) + handle->device_memory_in_use;
+        handle->device_memory_in_use += size;
+        handle->device_memory_profile.allocate(size, true);
+    }
+    handle->workspace_scopes.push_back({size, false, block, saved_size});
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*! \brief
+    \details
+    Closes the innermost workspace scope opened by rocblas_push_workspace_scope, releasing its
+    reserved region. The memory taken by the calls made in the scope must have been released.
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_value if
+    no scope is open; rocblas_status_size_query_mismatch if the scope was opened in a device
+    memory size query and the query has stopped, or the reverse; rocblas_status_success
+    otherwise
+    @param[in]
+    handle          rocblas handle
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_pop_workspace_scope(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->workspace_scopes.empty())
+        return rocblas_status_invalid_value;
+
+    auto scope = handle->workspace_scopes.back();
+    if(scope.query != handle->device_memory_size_query)
+        return rocblas_status_size_query_mismatch;
+    handle->workspace_scopes.pop_back();
+
+    if(scope.query)
+    {
+        handle->device_memory_query_base -= scope.reserved;
+        return rocblas_status_success;
+    }
+
+    if(scope.reserved)
+    {
+        handle->device_memory_in_use -= scope.reserved;
+        handle->device_memory_profile.release(scope.reserved);
+    }
+
+    // Restore the unused workspace of a handle allocating in stream order
+    if(handle->is_stream_order_workspace())
+    {
+        size_t block_size          = handle->device_memory_size;
+        handle->device_memory      = nullptr;
+        handle->device_memory_size = scope.saved_device_memory_size;
+#if HIP_VERSION >= 50300000
+        if(scope.block
+           && handle->workspace_free(scope.block, block_size, handle->stream) != hipSuccess)
+            return rocblas_status_internal_error;
+#endif
+    }
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /**
  *  @brief Logging function
  *
@@ -667,18 +1731,108 @@ void _rocblas_handle::init_logging()
     {
         layer_mode = static_cast<rocblas_layer_mode>(strtol(str_layer_mode, 0, 0));
 
+        // timing profiled calls implies profile logging
+        if(layer_mode & rocblas_layer_mode_log_profile_time)
+            layer_mode = static_cast<rocblas_layer_mode>(layer_mode
+                                                         | rocblas_layer_mode_log_profile);
+
+#ifndef ROCBLAS_ROCTX
+        // ROCTX ranges need a build with BUILD_WITH_ROCTX
+        if(layer_mode & rocblas_layer_mode_roctx)
+        {
+            static int once = (rocblas_cerr << "rocBLAS warning: rocblas_layer_mode_roctx is "
+                                               "ignored without BUILD_WITH_ROCTX"
+                                            << std::endl,
+                               0);
+            layer_mode = static_cast<rocblas_layer_mode>(layer_mode & ~rocblas_layer_mode_roctx);
+        }
+#endif
+
         // open log_trace file
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace_os = open_log_stream("ROCBLAS_LOG_TRACE_PATH");
 
-        // open log_bench file
+        // open log_bench file, or the binary bench log shared by all handles
         if(layer_mode & rocblas_layer_mode_log_bench)
-            log_bench_os = open_log_stream("ROCBLAS_LOG_BENCH_PATH");
+        {
+            const char* binary_path = read_env("ROCBLAS_LOG_BENCH_BINARY_PATH");
+            if(binary_path)
+            {
+                const char* records = read_env("ROCBLAS_LOG_BENCH_BINARY_RECORDS");
+                log_bench_binary    = rocblas_binary_log::open(
+                    binary_path, records ? strtoull(records, nullptr, 0) : 0);
+                if(!log_bench_binary)
+                    rocblas_cerr << "rocBLAS warning: unable to create binary bench log "
+                                 << binary_path << std::endl;
+            }
+            if(!log_bench_binary)
+                log_bench_os = open_log_stream("ROCBLAS_LOG_BENCH_PATH");
+        }
 
         // open log_profile file
         if(layer_mode & rocblas_layer_mode_log_profile)
             log_profile_os = open_log_stream("ROCBLAS_LOG_PROFILE_PATH");
+
+        // sample the trace and bench logging of each function
+        const char* sample_every = read_env("ROCBLAS_LOG_SAMPLE_EVERY");
+        if(sample_every)
+            log_sample_every = std::max(rocblas_int(strtol(sample_every, 0, 0)), 1);
+
+        const char* sample_max_per_second = read_env("ROCBLAS_LOG_SAMPLE_MAX_PER_SECOND");
+        if(sample_max_per_second)
+            log_sample_max_per_second
+                = std::max(rocblas_int(strtol(sample_max_per_second, 0, 0)), 0);
+    }
+}
+
+/*******************************************************************************
+ * Logging of the kernels selected by the calls
+ ******************************************************************************/
+void _rocblas_handle::log_kernel_selection(const char* kernel, int solution_index)
+{
+    if(layer_mode & rocblas_layer_mode_log_profile)
+        kernel_profile.add(kernel, solution_index);
+
+#ifdef ROCBLAS_ROCTX
+    if(layer_mode & rocblas_layer_mode_roctx)
+    {
+        std::string mark = std::string("kernel,") + kernel;
+        if(solution_index)
+            mark += ",solution_index," + std::to_string(solution_index);
+        rocblas_roctx_call::mark(mark);
     }
+#endif
+}
+
+/*******************************************************************************
+ * Sampling of the trace and bench logging
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_log_sampling(rocblas_handle handle,
+                                                   rocblas_int    sample_every,
+                                                   rocblas_int    max_per_second)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(sample_every < 0 || max_per_second < 0)
+        return rocblas_status_invalid_value;
+
+    handle->log_sample_every          = sample_every ? sample_every : 1;
+    handle->log_sample_max_per_second = max_per_second;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocblas_get_log_sampling(rocblas_handle handle,
+                                                   rocblas_int*   sample_every,
+                                                   rocblas_int*   max_per_second)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!sample_every || !max_per_second)
+        return rocblas_status_invalid_pointer;
+
+    *sample_every   = handle->log_sample_every;
+    *max_per_second = handle->log_sample_max_per_second;
+    return rocblas_status_success;
 }
 
 /*******************************************************************************
@@ -691,6 +1845,9 @@ extern "C" rocblas_status rocblas_set_solution_fitness_query(rocblas_handle hand
     handle->solution_fitness_query = fitness;
     if(fitness)
         *fitness = std::numeric_limits<double>::lowest();
+
+    // Previously selected solutions were not selected with this query
+    handle->solution_cache.clear();
     return rocblas_status_success;
 }
 
@@ -704,6 +1861,9 @@ extern "C" rocblas_status rocblas_set_performance_metric(rocblas_handle
         return rocblas_status_invalid_handle;
 
     handle->performance_metric = metric;
+
+    // Previously selected solutions may not be optimal for the new metric
+    handle->solution_cache.clear();
     return rocblas_status_success;
 }
 
@@ -721,6 +1881,271 @@ extern "C" rocblas_status rocblas_get_performance_metric(rocblas_handle
         return rocblas_status_invalid_pointer;
 }
 
+/*******************************************************************************
+ * Compute units targeted by solution selection
+ ******************************************************************************/
+void _rocblas_handle::update_stream_properties()
+{
+    // The default stream is never masked and has the default priority
+    stream_cu_count      = 0;
+    stream_high_priority = false;
+    if(!stream)
+        return;
+
+    // Lower numbers are higher priorities, the least priority being the default
+    int priority, least_priority, greatest_priority;
+    if(hipStreamGetPriority(stream, &priority) == hipSuccess
+       && hipDeviceGetStreamPriorityRange(&least_priority, &greatest_priority) == hipSuccess)
+        stream_high_priority = priority < least_priority;
+
+    std::vector<uint32_t> cu_mask((cu_count + 31) / 32);
+    if(hipExtStreamGetCUMask(stream, uint32_t(cu_mask.size()), cu_mask.data()) != hipSuccess)
+        return;
+
+    int enabled = 0;
+    for(uint32_t bits : cu_mask)
+        enabled += int(std::bitset<32>(bits).count());
+    if(enabled < cu_count)
+        stream_cu_count = enabled;
+}
+
+/*******************************************************************************
+ * Forking of independent sub-operations onto auxiliary streams
+ ******************************************************************************/
+rocblas_int _rocblas_handle::fork(rocblas_int tasks)
+{
+    // The auxiliary streams are neither masked nor prioritized like a masked or high priority
+    // stream, and graph capture and size queries run the sub-operations in order
+    rocblas_int count = std::min(tasks, fork_stream_count + 1);
+    if(count < 2 || forked || device_memory_size_query || stream_cu_count || stream_high_priority
+       || is_graph_safe())
+        return 1;
+
+    if(!fork_event && hipEventCreateWithFlags(&fork_event, hipEventDisableTiming) != hipSuccess)
+    {
+        fork_event = nullptr;
+        return 1;
+    }
+
+    while(rocblas_int(aux_streams.size()) < count - 1)
+    {
+        hipStream_t aux_stream;
+        hipEvent_t  aux_event;
+        if(hipStreamCreateWithFlags(&aux_stream, hipStreamNonBlocking) != hipSuccess)
+            break;
+        if(hipEventCreateWithFlags(&aux_event, hipEventDisableTiming) != hipSuccess)
+        {
+            hipStreamDestroy(aux_stream);
+            break;
+        }
+        aux_streams.push_back(aux_stream);
+        aux_events.push_back(aux_event);
+    }
+    count = std::min(count, rocblas_int(aux_streams.size()) + 1);
+    if(count < 2 || hipEventRecord(fork_event, stream) != hipSuccess)
+        return 1;
+
+    for(rocblas_int i = 0; i < count - 1; i++)
+        if(hipStreamWaitEvent(aux_streams[i], fork_event, 0) != hipSuccess)
+        {
+            // Only the streams which waited for the fork are used
+            if(!i)
+                return 1;
+            count = i + 1;
+            break;
+        }
+
+    forked = true;
+    return count;
+}
+
+void _rocblas_handle::join(hipStream_t user_stream, rocblas_int count)
+{
+    stream = user_stream;
+    forked = false;
+    for(rocblas_int i = 0; i < count - 1; i++)
+    {
+        if(hipEventRecord(aux_events[i], aux_streams[i]) != hipSuccess
+           || hipStreamWaitEvent(stream, aux_events[i], 0) != hipSuccess)
+            hipStreamSynchronize(aux_streams[i]);
+    }
+}
+
+extern "C" rocblas_status rocblas_set_cu_count(rocblas_handle handle, rocblas_int cu_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(cu_count < 0)
+        return rocblas_status_invalid_value;
+
+    handle->cu_count_limit = cu_count;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocblas_get_cu_count(rocblas_handle handle, rocblas_int* cu_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!cu_count)
+        return rocblas_status_invalid_pointer;
+
+    int limit = handle->get_cu_count_limit();
+    *cu_count = limit ? limit : handle->getCUCount();
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * Solution cache introspection and eviction
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_solution_cache_info(rocblas_handle               handle,
+                                                          rocblas_solution_cache_info* info)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!info)
+        return rocblas_status_invalid_pointer;
+
+    auto& cache     = handle->get_solution_cache();
+    info->capacity  = cache.get_capacity();
+    info->entries   = cache.get_entries();
+    info->hits      = cache.get_hits();
+    info->misses    = cache.get_misses();
+    info->evictions = cache.get_evictions();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_set_solution_cache_capacity(rocblas_handle handle,
+                                                              size_t         capacity)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->get_solution_cache().set_capacity(capacity);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_clear_solution_cache(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->get_solution_cache().clear();
+    handle->get_solution_cache().reset_statistics();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Counts and host times of the GEMM problems run with Tensile
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_tensile_host_stats(rocblas_handle              handle,
+                                                         rocblas_tensile_host_stats* stats)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!stats)
+        return rocblas_status_invalid_pointer;
+
+    using profile_t     = rocblas_tensile_host_profile;
+    const auto& p       = handle->get_tensile_host_profile();
+    stats->calls        = p.calls;
+    stats->selections   = p.selections;
+    stats->launches     = p.launches;
+    stats->construct_us = p.stage_us[profile_t::construct];
+    stats->select_us    = p.stage_us[profile_t::select];
+    stats->solve_us     = p.stage_us[profile_t::solve];
+    stats->launch_us    = p.stage_us[profile_t::launch];
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_set_tensile_host_timing(rocblas_handle handle, rocblas_int enable)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->get_tensile_host_profile().timing = enable != 0;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_reset_tensile_host_stats(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->get_tensile_host_profile().reset();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_device_memory_stats(rocblas_handle               handle,
+                                                          const char*                  function,
+                                                          rocblas_device_memory_stats* stats)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!stats)
+        return rocblas_status_invalid_pointer;
+
+    const auto&                            p = handle->get_device_memory_profile();
+    rocblas_device_memory_profile::entry_t entry;
+    if(!function)
+        entry = p.get_total();
+    else
+    {
+        auto it = p.get_functions().find(function);
+        if(it != p.get_functions().end())
+            entry = it->second;
+    }
+
+    stats->allocations = entry.allocations;
+    stats->failures    = entry.failures;
+    stats->total_size  = entry.total_size;
+    stats->peak_size   = entry.peak_size;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_reset_device_memory_stats(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->get_device_memory_profile().reset();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  * Numeric_check initialization
  ******************************************************************************/
@@ -733,4 +2158,9 @@ void _rocblas_handle::init_check_numerics()
         check_numerics
             = static_cast<rocblas_check_numerics_mode>(strtol(str_check_numerics_mode, 0, 0));
     }
+
+    // number of deferred checks recorded between two reports
+    const char* str_report_interval = read_env("ROCBLAS_CHECK_NUMERICS_REPORT_INTERVAL");
+    if(str_report_interval)
+        set_check_numerics_report_interval(strtoul(str_report_interval, nullptr, 0));
 }
@@ -0,0 +1,268 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*******************************************************************************
+ * Library pool of the handles released with rocblas_handle_pool_release, which
+ * rocblas_handle_pool_acquire hands out again instead of creating new ones.
+ *
+ * The idle handles of each device keep their workspace, and an event recorded
+ * on the stream of their last use, which the stream they are acquired for
+ * waits for if it is another one. The settings of an acquired handle are saved
+ * when it is acquired, and restored when it is released.
+ ******************************************************************************/
+namespace
+{
+    using rocblas_handle_settings = decltype(std::declval<_rocblas_handle&>().push_settings());
+
+    struct rocblas_pooled_handle
+    {
+        rocblas_handle handle;
+        hipEvent_t     released;
+        hipStream_t    stream;
+    };
+
+    struct rocblas_acquired_handle
+    {
+        hipEvent_t              released;
+        rocblas_handle_settings settings;
+    };
+
+    struct rocblas_handle_pool
+    {
+        std::mutex                                                  mutex;
+        std::unordered_map<int, std::vector<rocblas_pooled_handle>> idle;
+        std::unordered_map<rocblas_handle, rocblas_acquired_handle> acquired;
+
+        // Destroy the idle handles of all devices
+        void clear()
+        {
+            std::unordered_map<int, std::vector<rocblas_pooled_handle>> handles;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                handles.swap(idle);
+            }
+            for(auto& device : handles)
+            {
+                for(auto& pooled : device.second)
+                {
+                    {
+                        auto saved_device_id = pooled.handle->push_device_id();
+                        hipEventDestroy(pooled.released);
+                    }
+                    delete pooled.handle;
+                }
+            }
+        }
+
+        ~rocblas_handle_pool()
+        {
+            clear();
+        }
+    };
+
+    rocblas_handle_pool& get_handle_pool()
+    {
+        static rocblas_handle_pool pool;
+        return pool;
+    }
+
+    // Create a handle of the current device, with the event marking its release
+    rocblas_status create_pooled_handle(rocblas_pooled_handle& pooled)
+    {
+        hipEvent_t released;
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&released, hipEventDisableTiming));
+        try
+        {
+            pooled.handle = new _rocblas_handle;
+        }
+        catch(...)
+        {
+            hipEventDestroy(released);
+            throw;
+        }
+        pooled.released = released;
+        pooled.stream   = 0;
+        return rocblas_status_success;
+    }
+}
+
+extern "C" rocblas_status rocblas_handle_pool_acquire(rocblas_handle* handle, hipStream_t stream)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    int device;
+    RETURN_IF_HIP_ERROR(hipGetDevice(&device));
+
+    rocblas_handle_pool&  pool = get_handle_pool();
+    rocblas_pooled_handle pooled;
+    bool                  found = false;
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        auto                        it = pool.idle.find(device);
+        if(it != pool.idle.end() && !it->second.empty())
+        {
+            pooled = it->second.back();
+            it->second.pop_back();
+            found = true;
+        }
+    }
+
+    if(!found)
+    {
+        rocblas_status status = create_pooled_handle(pooled);
+        if(status != rocblas_status_success)
+            return status;
+    }
+
+    // Work enqueued with the handle on another stream is ordered before its new uses, which
+    // share its workspace
+    rocblas_status status = rocblas_set_stream(pooled.handle, stream);
+    if(status == rocblas_status_success && found && stream != pooled.stream)
+        status = get_rocblas_status_for_hip_status(hipStreamWaitEvent(stream, pooled.released, 0));
+    if(status != rocblas_status_success)
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        pool.idle[device].push_back(pooled);
+        return status;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        pool.acquired.emplace(
+            pooled.handle,
+            rocblas_acquired_handle{pooled.released, pooled.handle->push_settings()});
+    }
+
+    *handle = pooled.handle;
+    if(pooled.handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(pooled.handle, "rocblas_handle_pool_acquire", stream);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_handle_pool_release(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocblas_handle_pool& pool = get_handle_pool();
+    hipEvent_t           released;
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        auto                        it = pool.acquired.find(handle);
+        if(it == pool.acquired.end())
+            return rocblas_status_invalid_handle;
+        released = it->second.released;
+    }
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_handle_pool_release");
+
+    // Temporarily change the thread's default device ID to the handle's device ID
+    auto saved_device_id = handle->push_device_id();
+
+    // Report the deferred numerical checks and end the profiled call on the stream used
+    rocblas_status status = handle->report_check_numerics();
+    handle->stop_profile_timer();
+
+    hipStream_t stream = handle->get_stream();
+    if(status == rocblas_status_success)
+        status = get_rocblas_status_for_hip_status(hipEventRecord(released, stream));
+
+    // A workspace of the application, which it may free, and a shared workspace pool are not
+    // kept by the idle handle; rocblas_set_workspace_pool is not implemented without stream
+    // order allocation, where no pool can be attached
+    if(status == rocblas_status_success && handle->is_device_memory_user_owned())
+        status = rocblas_set_workspace(handle, nullptr, 0);
+    if(status == rocblas_status_success)
+    {
+        status = rocblas_set_workspace_pool(handle, nullptr);
+        if(status == rocblas_status_not_implemented)
+            status = rocblas_status_success;
+    }
+
+    // Restore the settings of the handle when it was acquired
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.acquired.erase(handle);
+    pool.idle[handle->getDevice()].push_back({handle, released, stream});
+    return status;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_handle_pool_reserve(rocblas_int count)
+try
+{
+    if(count < 0)
+        return rocblas_status_invalid_size;
+
+    int device;
+    RETURN_IF_HIP_ERROR(hipGetDevice(&device));
+
+    rocblas_handle_pool& pool = get_handle_pool();
+    for(;;)
+    {
+        {
+            std::lock_guard<std::mutex> lock(pool.mutex);
+            if(pool.idle[device].size() >= size_t(count))
+                return rocblas_status_success;
+        }
+
+        rocblas_pooled_handle pooled;
+        rocblas_status        status = create_pooled_handle(pooled);
+        if(status != rocblas_status_success)
+            return status;
+
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        pool.idle[device].push_back(pooled);
+    }
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_handle_pool_clear()
+try
+{
+    get_handle_pool().clear();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
@@ -0,0 +1,295 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "logging.hpp"
+#include "utility.hpp"
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+/*******************************************************************************
+ * Bulk host conversions between float and rocblas_bfloat16 or rocblas_half.
+ * Each has a scalar version, which gives exactly the results of the conversions
+ * of rocblas_bfloat16 and rocblas_half, and a SIMD version with the same
+ * results: AVX2 and F16C on x86-64, selected at runtime, or NEON on AArch64.
+ * AVX-512 BF16 is not used, since its conversion flushes subnormals to zero.
+ ******************************************************************************/
+namespace
+{
+    using float_to_bf16_fn = void (*)(size_t n, const float* x, uint16_t* y, bool truncate);
+    using bf16_to_float_fn = void (*)(size_t n, const uint16_t* x, float* y);
+    using float_to_half_fn = void (*)(size_t n, const float* x, rocblas_half* y);
+    using half_to_float_fn = void (*)(size_t n, const rocblas_half* x, float* y);
+
+    void float_to_bf16_scalar(size_t n, const float* x, uint16_t* y, bool truncate)
+    {
+        if(truncate)
+            for(size_t i = 0; i < n; i++)
+                y[i] = rocblas_bfloat16(x[i], rocblas_bfloat16::rocblas_truncate).data;
+        else
+            for(size_t i = 0; i < n; i++)
+                y[i] = rocblas_bfloat16(x[i]).data;
+    }
+
+    void bf16_to_float_scalar(size_t n, const uint16_t* x, float* y)
+    {
+        for(size_t i = 0; i < n; i++)
+        {
+            uint32_t u = uint32_t(x[i]) << 16;
+            memcpy(&y[i], &u, sizeof(u));
+        }
+    }
+
+    void float_to_half_scalar(size_t n, const float* x, rocblas_half* y)
+    {
+        for(size_t i = 0; i < n; i++)
+            y[i] = rocblas_half(x[i]);
+    }
+
+    void half_to_float_scalar(size_t n, const rocblas_half* x, float* y)
+    {
+        for(size_t i = 0; i < n; i++)
+            y[i] = float(x[i]);
+    }
+
+#if defined(__x86_64__)
+
+    __attribute__((target("avx2"))) void
+        float_to_bf16_avx2(size_t n, const float* x, uint16_t* y, bool truncate)
+    {
+        const __m256i exp_mask = _mm256_set1_epi32(0x7f800000);
+        const __m256i low_mask = _mm256_set1_epi32(0xffff);
+        const __m256i bias     = _mm256_set1_epi32(0x7fff);
+        const __m256i one      = _mm256_set1_epi32(1);
+        const __m256i zero     = _mm256_setzero_si256();
+
+        size_t i = 0;
+        for(; i + 8 <= n; i += 8)
+        {
+            __m256i u = _mm256_loadu_si256((const __m256i*)(x + i));
+
+            // Inf or NaN, and 1 where any of the lower 16 bits is set
+            __m256i nonfinite = _mm256_cmpeq_epi32(_mm256_and_si256(u, exp_mask), exp_mask);
+            __m256i low_set   = _mm256_andnot_si256(
+                _mm256_cmpeq_epi32(_mm256_and_si256(u, low_mask), zero), one);
+
+            __m256i r;
+            if(truncate)
+                r = _mm256_or_si256(_mm256_srli_epi32(u, 16), _mm256_and_si256(nonfinite, low_set));
+            else
+            {
+                // round to nearest even, preserving signaling NaN
+                __m256i odd     = _mm256_and_si256(_mm256_srli_epi32(u, 16), one);
+                __m256i rounded = _mm256_add_epi32(_mm256_add_epi32(u, bias), odd);
+                __m256i nan     = _mm256_or_si256(u, _mm256_slli_epi32(low_set, 16));
+                r = _mm256_srli_epi32(_mm256_blendv_epi8(rounded, nan, nonfinite), 16);
+            }
+
+            // packus works within 128-bit lanes, so gather the two low halves
+            __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), 0xd8);
+            _mm_storeu_si128((__m128i*)(y + i), _mm256_castsi256_si128(packed));
+        }
+        float_to_bf16_scalar(n - i, x + i, y + i, truncate);
+    }
+
+    __attribute__((target("avx2"))) void bf16_to_float_avx2(size_t n, const uint16_t* x, float* y)
+    {
+        size_t i = 0;
+        for(; i + 8 <= n; i += 8)
+        {
+            __m256i u = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(x + i)));
+            _mm256_storeu_si256((__m256i*)(y + i), _mm256_slli_epi32(u, 16));
+        }
+        bf16_to_float_scalar(n - i, x + i, y + i);
+    }
+
+    __attribute__((target("avx2,f16c"))) void
+        float_to_half_f16c(size_t n, const float* x, rocblas_half* y)
+    {
+        size_t i = 0;
+        for(; i + 8 <= n; i += 8)
+            _mm_storeu_si128(
+                (__m128i*)(y + i),
+                _mm256_cvtps_ph(_mm256_loadu_ps(x + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        float_to_half_scalar(n - i, x + i, y + i);
+    }
+
+    __attribute__((target("avx2,f16c"))) void
+        half_to_float_f16c(size_t n, const rocblas_half* x, float* y)
+    {
+        size_t i = 0;
+        for(; i + 8 <= n; i += 8)
+            _mm256_storeu_ps(y + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(x + i))));
+        half_to_float_scalar(n - i, x + i, y + i);
+    }
+
+#elif defined(__aarch64__)
+
+    void float_to_bf16_neon(size_t n, const float* x, uint16_t* y, bool truncate)
+    {
+        const uint32x4_t exp_mask = vdupq_n_u32(0x7f800000);
+        const uint32x4_t low_mask = vdupq_n_u32(0xffff);
+        const uint32x4_t bias     = vdupq_n_u32(0x7fff);
+        const uint32x4_t one      = vdupq_n_u32(1);
+
+        size_t i = 0;
+        for(; i + 4 <= n; i += 4)
+        {
+            uint32x4_t u = vld1q_u32((const uint32_t*)(x + i));
+
+            uint32x4_t nonfinite = vceqq_u32(vandq_u32(u, exp_mask), exp_mask);
+            uint32x4_t low_set   = vandq_u32(vtstq_u32(u, low_mask), one);
+
+            uint32x4_t r;
+            if(truncate)
+                r = vorrq_u32(vshrq_n_u32(u, 16), vandq_u32(nonfinite, low_set));
+            else
+            {
+                uint32x4_t odd     = vandq_u32(vshrq_n_u32(u, 16), one);
+                uint32x4_t rounded = vaddq_u32(vaddq_u32(u, bias), odd);
+                uint32x4_t nan     = vorrq_u32(u, vshlq_n_u32(low_set, 16));
+                r                  = vshrq_n_u32(vbslq_u32(nonfinite, nan, rounded), 16);
+            }
+            vst1_u16(y + i, vmovn_u32(r));
+        }
+        float_to_bf16_scalar(n - i, x + i, y + i, truncate);
+    }
+
+    void bf16_to_float_neon(size_t n, const uint16_t* x, float* y)
+    {
+        size_t i = 0;
+        for(; i + 4 <= n; i += 4)
+            vst1q_u32((uint32_t*)(y + i), vshll_n_u16(vld1_u16(x + i), 16));
+        bf16_to_float_scalar(n - i, x + i, y + i);
+    }
+
+    void float_to_half_neon(size_t n, const float* x, rocblas_half* y)
+    {
+        size_t i = 0;
+        for(; i + 4 <= n; i += 4)
+            vst1_u16((uint16_t*)(y + i), vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(x + i))));
+        float_to_half_scalar(n - i, x + i, y + i);
+    }
+
+    void half_to_float_neon(size_t n, const rocblas_half* x, float* y)
+    {
+        size_t i = 0;
+        for(; i + 4 <= n; i += 4)
+            vst1q_f32(y + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16((const uint16_t*)(x + i)))));
+        half_to_float_scalar(n - i, x + i, y + i);
+    }
+
+#endif
+
+    struct host_convert_functions
+    {
+        float_to_bf16_fn float_to_bf16 = float_to_bf16_scalar;
+        bf16_to_float_fn bf16_to_float = bf16_to_float_scalar;
+        float_to_half_fn float_to_half = float_to_half_scalar;
+        half_to_float_fn half_to_float = half_to_float_scalar;
+
+        host_convert_functions()
+        {
+#if defined(__x86_64__)
+            // every CPU with AVX2 also has F16C
+            if(__builtin_cpu_supports("avx2"))
+            {
+                float_to_bf16 = float_to_bf16_avx2;
+                bf16_to_float = bf16_to_float_avx2;
+                float_to_half = float_to_half_f16c;
+                half_to_float = half_to_float_f16c;
+            }
+#elif defined(__aarch64__)
+            float_to_bf16 = float_to_bf16_neon;
+            bf16_to_float = bf16_to_float_neon;
+            float_to_half = float_to_half_neon;
+            half_to_float = half_to_float_neon;
+#endif
+        }
+    };
+
+    const host_convert_functions& host_convert()
+    {
+        static const host_convert_functions functions;
+        return functions;
+    }
+}
+
+extern "C" rocblas_status rocblas_convert_float_to_bfloat16(size_t            n,
+                                                            const float*      x,
+                                                            rocblas_bfloat16* y,
+                                                            bool              truncate)
+try
+{
+    if(n && (!x || !y))
+        return rocblas_status_invalid_pointer;
+    host_convert().float_to_bf16(n, x, (uint16_t*)y, truncate);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status
+    rocblas_convert_bfloat16_to_float(size_t n, const rocblas_bfloat16* x, float* y)
+try
+{
+    if(n && (!x || !y))
+        return rocblas_status_invalid_pointer;
+    host_convert().bf16_to_float(n, (const uint16_t*)x, y);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_convert_float_to_half(size_t n, const float* x, rocblas_half* y)
+try
+{
+    if(n && (!x || !y))
+        return rocblas_status_invalid_pointer;
+    host_convert().float_to_half(n, x, y);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_convert_half_to_float(size_t n, const rocblas_half* x, float* y)
+try
+{
+    if(n && (!x || !y))
+        return rocblas_status_invalid_pointer;
+    host_convert().half_to_float(n, x, y);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
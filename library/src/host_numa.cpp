@@ -0,0 +1,131 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "host_numa.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include <cctype>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+#ifdef __linux__
+    // Memory policy modes of <numaif.h>, which comes with libnuma
+    constexpr int ROCBLAS_MPOL_DEFAULT   = 0;
+    constexpr int ROCBLAS_MPOL_PREFERRED = 1;
+
+    // Node mask large enough for any kernel configuration
+    constexpr unsigned long NUMA_MASK_BITS  = 4096;
+    constexpr size_t        NUMA_WORD_BITS  = 8 * sizeof(unsigned long);
+    constexpr size_t        NUMA_MASK_WORDS = NUMA_MASK_BITS / NUMA_WORD_BITS;
+#endif
+
+    int rocblas_read_device_numa_node(int device)
+    {
+#ifdef __linux__
+        char bus_id[64];
+        if(hipDeviceGetPCIBusId(bus_id, sizeof(bus_id), device) != hipSuccess)
+            return -1;
+
+        // sysfs names PCI devices with lowercase hexadecimal digits
+        std::string name(bus_id);
+        for(auto& c : name)
+            c = std::tolower(c);
+
+        std::ifstream file("/sys/bus/pci/devices/" + name + "/numa_node");
+        int           node = -1;
+        if(!(file >> node) || node < 0 || node >= int(NUMA_MASK_BITS))
+            return -1;
+        return node;
+#else
+        return -1;
+#endif
+    }
+}
+
+int rocblas_device_numa_node(int device)
+{
+    static std::mutex       mutex;
+    static std::vector<int> nodes; // -2 until the node of a device has been read
+
+    if(device < 0)
+        return -1;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if(size_t(device) >= nodes.size())
+        nodes.resize(device + 1, -2);
+    if(nodes[device] == -2)
+        nodes[device] = rocblas_read_device_numa_node(device);
+    return nodes[device];
+}
+
+hipError_t rocblas_host_malloc_near(void** ptr, size_t bytes, int device)
+{
+#ifdef __linux__
+    int node = rocblas_device_numa_node(device);
+    if(node >= 0)
+    {
+        // The pages are faulted in by this thread while the memory is pinned, so they
+        // follow its policy: prefer the node of the device, then restore the policy
+        int           old_mode                   = ROCBLAS_MPOL_DEFAULT;
+        unsigned long old_mask[NUMA_MASK_WORDS]  = {};
+        unsigned long node_mask[NUMA_MASK_WORDS] = {};
+        node_mask[node / NUMA_WORD_BITS]         = 1UL << (node % NUMA_WORD_BITS);
+
+        if(!syscall(SYS_get_mempolicy, &old_mode, old_mask, NUMA_MASK_BITS, nullptr, 0)
+           && !syscall(SYS_set_mempolicy, ROCBLAS_MPOL_PREFERRED, node_mask, NUMA_MASK_BITS))
+        {
+            hipError_t status = hipHostMalloc(ptr, bytes, hipHostMallocNumaUser);
+            (void)syscall(SYS_set_mempolicy,
+                          old_mode,
+                          old_mode == ROCBLAS_MPOL_DEFAULT ? nullptr : old_mask,
+                          NUMA_MASK_BITS);
+            return status;
+        }
+    }
+#endif
+    return hipHostMalloc(ptr, bytes, hipHostMallocDefault);
+}
+
+extern "C" rocblas_status rocblas_get_host_numa_node(rocblas_handle handle, int* numa_node)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!numa_node)
+        return rocblas_status_invalid_pointer;
+
+    *numa_node = rocblas_device_numa_node(handle->getDevice());
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
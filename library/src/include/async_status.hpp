@@ -0,0 +1,86 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include "utility.hpp"
+#include <hip/hip_runtime.h>
+
+/*******************************************************************************
+ * rocblas_async_status holds the first error found on a handle by device code,
+ * so that checks of device data do not synchronize the stream to return their
+ * result. The status is a word of coherent pinned host memory mapped into the
+ * device address space: kernels set it with a system scope atomic, and the host
+ * reads and clears it without a copy once the user has synchronized the stream.
+ *
+ * The word is allocated when the async status mode is first enabled on the
+ * handle, and device_status() is null until then.
+ ******************************************************************************/
+class rocblas_async_status
+{
+public:
+    rocblas_async_status() = default;
+
+    ~rocblas_async_status()
+    {
+        if(h_status)
+            (void)hipHostFree(h_status);
+    }
+
+    rocblas_async_status(const rocblas_async_status&) = delete;
+    rocblas_async_status& operator=(const rocblas_async_status&) = delete;
+
+    // Allocate the status word, cleared, if it is not allocated yet
+    rocblas_status init();
+
+    // Device address of the status word
+    rocblas_status* device_status() const
+    {
+        return d_status;
+    }
+
+    // Return the first error set since the last call, and clear it
+    rocblas_status take()
+    {
+        if(!h_status)
+            return rocblas_status_success;
+        return rocblas_status(__atomic_exchange_n(
+            reinterpret_cast<int*>(h_status), int(rocblas_status_success), __ATOMIC_SEQ_CST));
+    }
+
+private:
+    rocblas_status* h_status = nullptr;
+    rocblas_status* d_status = nullptr;
+};
+
+// Set the async status of a handle to error, unless it already holds an earlier error
+__device__ inline void rocblas_set_async_status_device(rocblas_status* status, rocblas_status error)
+{
+    atomicCAS_system(reinterpret_cast<int*>(status), int(rocblas_status_success), int(error));
+}
+
+// Enqueue on stream a kernel setting *status to rocblas_status_check_numerics_fail if the
+// check of *record found a NaN, Inf or denormal value
+void rocblas_check_numerics_set_async_status(hipStream_t                     stream,
+                                             const rocblas_check_numerics_t* record,
+                                             rocblas_status*                 status);
@@ -0,0 +1,223 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_ostream.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+/*******************************************************************************
+ * rocblas_binary_log is a compact alternative to the text bench log. When
+ * ROCBLAS_LOG_BENCH_BINARY_PATH is set, log_bench stores its arguments in a
+ * fixed-size record of a ring buffer in a memory-mapped file, instead of
+ * formatting them through rocblas_internal_ostream. Strings are stored once in
+ * a string table in the same file and referred to by offset, and the other
+ * arguments are stored as 64-bit values, so that logging a call costs a few
+ * table lookups and stores.
+ *
+ * A "%p" in the path is replaced by the process id. The file is decoded into
+ * rocblas-bench command lines by scripts/utilities/decode-binary-bench-log.py.
+ * The file layout is:
+ *
+ *   header_t                                  at offset 0
+ *   string table of strings_size bytes        at strings_offset
+ *   capacity records of record_size bytes     at records_offset
+ *
+ * Record i of the log is written to slot i % capacity, so the ring holds the
+ * last capacity calls. A record's sequence is 0 while it is being written and
+ * i + 1 once it is complete. Strings are stored as a 32-bit length followed by
+ * the characters and a terminating zero.
+ ******************************************************************************/
+class rocblas_binary_log
+{
+public:
+    static constexpr char     MAGIC[8]         = {'R', 'B', 'L', 'O', 'G', 'B', 'I', 'N'};
+    static constexpr uint32_t VERSION          = 1;
+    static constexpr size_t   MAX_ARGS         = 64;
+    static constexpr size_t   DEFAULT_CAPACITY = 65536;
+    static constexpr size_t   STRINGS_SIZE     = 1 << 20;
+    static constexpr uint32_t NO_STRING        = 0xffffffff;
+
+    // Types of arguments
+    enum : uint8_t
+    {
+        arg_string = 1, // offset of a string in the string table
+        arg_char   = 2,
+        arg_int    = 3, // signed 64-bit integer
+        arg_uint   = 4, // unsigned 64-bit integer
+        arg_double = 5, // bits of a double
+    };
+
+    struct header_t
+    {
+        char     magic[8];
+        uint32_t version;
+        uint32_t record_size;
+        uint64_t capacity;
+        uint64_t strings_offset;
+        uint64_t strings_size;
+        uint64_t records_offset;
+        uint64_t strings_used; // bytes of the string table in use
+        uint64_t next_record; // number of records started
+        uint64_t start_time; // system clock at creation, in ns since the epoch
+        uint64_t start_ticks; // steady clock at creation, in ns
+    };
+
+    enum : uint16_t
+    {
+        record_truncated = 1, // more than MAX_ARGS arguments were logged
+    };
+
+    struct record_t
+    {
+        uint64_t sequence;
+        uint64_t timestamp; // steady clock, in ns
+        uint32_t function; // string of the first logged argument, the rocblas-bench command
+        uint16_t count; // number of arguments after the first
+        uint16_t flags;
+        uint8_t  types[MAX_ARGS];
+        uint64_t values[MAX_ARGS];
+    };
+
+    // The process-wide log, shared by all handles, which is created with a ring of
+    // capacity records in the file path by the first call; returns nullptr if the
+    // file cannot be created
+    static rocblas_binary_log* open(const char* path, size_t capacity);
+
+    // Append a record with the arguments of log_bench
+    template <typename H, typename... Ts>
+    void log(const H& head, const Ts&... xs)
+    {
+        uint64_t  index;
+        record_t* record = begin_record(index);
+        record->function = intern(head);
+        (add(record, xs), ...);
+        end_record(record, index);
+    }
+
+private:
+    // The log is never destroyed, since handles may log until the process exits
+    explicit rocblas_binary_log(header_t* header);
+    ~rocblas_binary_log() = default;
+
+    rocblas_binary_log(const rocblas_binary_log&) = delete;
+    rocblas_binary_log& operator=(const rocblas_binary_log&) = delete;
+
+    // Start record index of the log, and mark it complete
+    record_t* begin_record(uint64_t& index);
+    void      end_record(record_t* record, uint64_t index);
+
+    // Strings cached per thread before a cache is cleared
+    static constexpr size_t MAX_CACHED_STRINGS = 4096;
+
+    // Offset of a string in the string table, which is added if it is not there yet;
+    // NO_STRING if the table is full
+    uint32_t intern(const char* s);
+    uint32_t intern(const std::string& s);
+    uint32_t add_string(const char* s, size_t length);
+
+    void add_value(record_t* record, uint8_t type, uint64_t value)
+    {
+        if(record->count < MAX_ARGS)
+        {
+            record->types[record->count]  = type;
+            record->values[record->count] = value;
+            record->count++;
+        }
+        else
+            record->flags |= record_truncated;
+    }
+
+    void add(record_t* record, const char* s)
+    {
+        add_value(record, arg_string, intern(s));
+    }
+
+    void add(record_t* record, const std::string& s)
+    {
+        add_value(record, arg_string, intern(s));
+    }
+
+    void add(record_t* record, char c)
+    {
+        add_value(record, arg_char, uint8_t(c));
+    }
+
+    void add(record_t* record, bool b)
+    {
+        add_value(record, arg_int, b);
+    }
+
+    template <typename T,
+              std::enable_if_t<std::is_integral<T>{} && std::is_signed<T>{}, int> = 0>
+    void add(record_t* record, T x)
+    {
+        add_value(record, arg_int, uint64_t(int64_t(x)));
+    }
+
+    template <typename T,
+              std::enable_if_t<std::is_integral<T>{} && std::is_unsigned<T>{}, int> = 0>
+    void add(record_t* record, T x)
+    {
+        add_value(record, arg_uint, uint64_t(x));
+    }
+
+    template <typename T, std::enable_if_t<std::is_floating_point<T>{}, int> = 0>
+    void add(record_t* record, T x)
+    {
+        double   d = x;
+        uint64_t bits;
+        memcpy(&bits, &d, sizeof(bits));
+        add_value(record, arg_double, bits);
+    }
+
+    // Other arguments are stored as the text log would print them
+    template <typename T,
+              std::enable_if_t<!std::is_arithmetic<T>{} && !std::is_convertible<T, const char*>{}
+                                   && !std::is_convertible<T, std::string>{},
+                               int> = 0>
+    void add(record_t* record, const T& x)
+    {
+        rocblas_internal_ostream os;
+        os << x;
+        add(record, os.str());
+    }
+
+    const char* string_at(uint32_t offset) const
+    {
+        return strings + offset + sizeof(uint32_t);
+    }
+
+    header_t* header;
+    char*     strings;
+    record_t* records;
+
+    // String table index, used when a thread's cache misses
+    std::mutex                                mutex;
+    std::unordered_map<std::string, uint32_t> string_offsets;
+};
@@ -0,0 +1,102 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include "utility.hpp"
+#include <cstddef>
+#include <hip/hip_runtime.h>
+#include <vector>
+
+/*******************************************************************************
+ * rocblas_deferred_check_numerics holds the results of numerical checks made
+ * in rocblas_check_numerics_mode_deferred, so that a checked call neither
+ * clears nor reads back its result with a blocking copy.
+ *
+ * Each check gets its own rocblas_check_numerics_t record in a persistent
+ * device buffer, which is cleared in stream order with hipMemsetAsync. The
+ * records are read back and reported with a single copy by report(), which is
+ * called by rocblas_report_check_numerics, when the buffer is full, when the
+ * handle's stream changes and when the handle is destroyed.
+ ******************************************************************************/
+class rocblas_deferred_check_numerics
+{
+public:
+    // Default number of checks recorded between two reports
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    rocblas_deferred_check_numerics() = default;
+
+    // Callers must make sure no checks are pending, e.g. by calling report()
+    ~rocblas_deferred_check_numerics()
+    {
+        if(d_records)
+            (void)(hipFree)(d_records);
+    }
+
+    rocblas_deferred_check_numerics(const rocblas_deferred_check_numerics&) = delete;
+    rocblas_deferred_check_numerics& operator=(const rocblas_deferred_check_numerics&) = delete;
+
+    // Set the number of checks recorded between two reports; takes effect once no
+    // checks are pending
+    void set_capacity(size_t new_capacity)
+    {
+        capacity = new_capacity ? new_capacity : 1;
+    }
+
+    // Number of checks which have not been reported yet
+    size_t get_pending() const
+    {
+        return entries.size();
+    }
+
+    // Returns in *record the cleared device record for the next check on stream. A full
+    // buffer is reported first, and its status is returned. function_name must remain
+    // valid until the check has been reported.
+    rocblas_status next_record(const char*                function_name,
+                               int                        check_numerics,
+                               bool                       is_input,
+                               hipStream_t                stream,
+                               rocblas_check_numerics_t** record);
+
+    // Wait for the checks pending on stream, report them according to the mode each was
+    // made with, and clear them. Returns rocblas_status_check_numerics_fail if a check
+    // made with rocblas_check_numerics_mode_fail found a NaN, Inf or denormal value.
+    rocblas_status report(hipStream_t stream);
+
+private:
+    struct entry_t
+    {
+        const char* function_name;
+        int         check_numerics;
+        bool        is_input;
+    };
+
+    rocblas_check_numerics_t* d_records          = nullptr;
+    size_t                    d_records_capacity = 0;
+    size_t                    capacity           = DEFAULT_CAPACITY;
+    std::vector<entry_t>      entries;
+
+    // Host copy of the records, kept to avoid an allocation per report
+    std::vector<rocblas_check_numerics_t> h_records;
+};
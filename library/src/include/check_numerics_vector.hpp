@@ -26,6 +26,31 @@
 
 #include "handle.hpp"
 
+//! @brief Records a zero/NaN/Inf/denormal value in abnormal.
+template <typename T>
+__device__ __forceinline__ void rocblas_check_numerics_value(const T&                  value,
+                                                             rocblas_check_numerics_t* abnormal)
+{
+    if(!abnormal->has_zero && rocblas_iszero(value))
+        abnormal->has_zero = true;
+    if(!abnormal->has_NaN && rocblas_isnan(value))
+        abnormal->has_NaN = true;
+    if(!abnormal->has_Inf && rocblas_isinf(value))
+        abnormal->has_Inf = true;
+    if(!abnormal->has_denorm && rocblas_isdenorm(value))
+        abnormal->has_denorm = true;
+}
+
+//! @brief Checks a value written by a compute kernel which checks its outputs, see
+//!        rocblas_fused_check_numerics; no code is generated when CHECK_NUMERICS is false.
+template <bool CHECK_NUMERICS, typename T>
+__device__ __forceinline__ void rocblas_check_numerics_output(const T&                  value,
+                                                              rocblas_check_numerics_t* abnormal)
+{
+    if constexpr(CHECK_NUMERICS)
+        rocblas_check_numerics_value(value, abnormal);
+}
+
 /**
   *
   * rocblas_check_numerics_vector_kernel(n, xa, offset_x, inc_x, stride_x, abnormal)
@@ -59,17 +84,7 @@ rocblas_check_numerics_vector_kernel(rocblas_int               n,
 
     //Check every element of the x vector for a NaN/zero/Inf/denormal value
     if(tid < n)
-    {
-        auto value = x[tid * inc_x];
-        if(!abnormal->has_zero && rocblas_iszero(value))
-            abnormal->has_zero = true;
-        if(!abnormal->has_NaN && rocblas_isnan(value))
-            abnormal->has_NaN = true;
-        if(!abnormal->has_Inf && rocblas_isinf(value))
-            abnormal->has_Inf = true;
-        if(!abnormal->has_denorm && rocblas_isdenorm(value))
-            abnormal->has_denorm = true;
-    }
+        rocblas_check_numerics_value(x[tid * inc_x], abnormal);
 }
 
 rocblas_status rocblas_check_numerics_abnormal_struct(const char*               function_name,
@@ -77,6 +92,53 @@ rocblas_status rocblas_check_numerics_abnormal_struct(const char*
                                                       bool                      is_input,
                                                       rocblas_check_numerics_t* h_abnormal);
 
+/*******************************************************************************
+ * rocblas_fused_check_numerics checks the outputs of axpy, scal and ger in
+ * their compute kernels with rocblas_check_numerics_mode_fused, instead of
+ * rereading them in a separate check. begin() sets a cleared deferred record as
+ * handle->fused_check_numerics, for which the internal templates launch their
+ * kernels with CHECK_NUMERICS, which check the values they write with
+ * rocblas_check_numerics_output. end() removes the record from the handle and
+ * reports it, unless rocblas_check_numerics_mode_deferred is also set.
+ ******************************************************************************/
+class rocblas_fused_check_numerics
+{
+public:
+    rocblas_fused_check_numerics(rocblas_handle handle,
+                                 const char*    function_name,
+                                 int            check_numerics)
+        : handle(handle)
+        , function_name(function_name)
+        , check_numerics(check_numerics)
+    {
+    }
+
+    ~rocblas_fused_check_numerics()
+    {
+        if(active)
+            handle->fused_check_numerics = nullptr;
+    }
+
+    rocblas_fused_check_numerics(const rocblas_fused_check_numerics&) = delete;
+    rocblas_fused_check_numerics& operator=(const rocblas_fused_check_numerics&) = delete;
+
+    // Whether the outputs are checked by the compute kernels, between begin() and end()
+    bool is_active() const
+    {
+        return active;
+    }
+
+    rocblas_status begin();
+    rocblas_status end();
+
+private:
+    rocblas_handle handle;
+    const char*    function_name;
+    int            check_numerics;
+    bool           active        = false;
+    rocblas_status record_status = rocblas_status_success;
+};
+
 template <typename T>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     rocblas_internal_check_numerics_vector_template(const char*    function_name,
@@ -0,0 +1,115 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+/*******************************************************************************
+ * rocblas_device_memory_profile counts the device memory allocations a handle
+ * makes with device_malloc, and the largest amount of device memory they hold
+ * at once, in total and for each rocBLAS function.
+ *
+ * The function an allocation is attributed to is the one last named with
+ * set_function(), which the profile logging layer calls for every logged call,
+ * so that allocations are only counted per function with
+ * rocblas_layer_mode_log_profile. Function names must have static storage.
+ * Like the rest of the handle, the profile is not updated concurrently.
+ ******************************************************************************/
+class rocblas_device_memory_profile
+{
+public:
+    struct entry_t
+    {
+        size_t allocations = 0; // allocations of a nonzero size
+        size_t failures    = 0; // allocations which could not be satisfied
+        size_t total_size  = 0; // sum of the allocation sizes in bytes
+        size_t peak_size   = 0; // largest device memory in use at once in bytes
+    };
+
+    // Attribute the following allocations to func, or only to the total if nullptr
+    void set_function(const char* func)
+    {
+        if(func != function)
+        {
+            function       = func;
+            function_entry = nullptr;
+        }
+    }
+
+    // Record an allocation of size bytes, which holds the memory if successful
+    void allocate(size_t size, bool success)
+    {
+        if(function && !function_entry)
+            function_entry = &functions[function];
+
+        size_t peak = in_use + size;
+        if(success)
+            in_use = peak;
+
+        for(entry_t* entry : {&total, function_entry})
+        {
+            if(entry)
+            {
+                entry->allocations++;
+                entry->failures += !success;
+                entry->total_size += size;
+                if(entry->peak_size < peak)
+                    entry->peak_size = peak;
+            }
+        }
+    }
+
+    // Record the release of a successful allocation of size bytes
+    void release(size_t size)
+    {
+        in_use -= size;
+    }
+
+    const entry_t& get_total() const
+    {
+        return total;
+    }
+
+    // The entry of each function which has made allocations
+    const std::map<std::string, entry_t>& get_functions() const
+    {
+        return functions;
+    }
+
+    // Clear the counts; the memory in use remains counted in the next peaks
+    void reset()
+    {
+        total = {};
+        functions.clear();
+        function_entry = nullptr;
+    }
+
+private:
+    entry_t                        total;
+    std::map<std::string, entry_t> functions;
+    const char*                    function       = nullptr;
+    entry_t*                       function_entry = nullptr; // entry of function, once used
+    size_t                         in_use         = 0;
+};
@@ -22,10 +22,24 @@
 
 #pragma once
 
+#include "binary_log.hpp"
+#include "async_status.hpp"
+#include "check_numerics_deferred.hpp"
+#include "device_memory_profile.hpp"
 #include "macros.hpp"
+#include "host_staging.hpp"
+#include "kernel_profile.hpp"
+#include "level2_tuning.hpp"
+#include "log_sampler.hpp"
+#include "pointer_array_cache.hpp"
+#include "profile_timer.hpp"
 #include "rocblas.h"
+#include "rocblas_block_sizes.h"
 #include "rocblas_ostream.hpp"
+#include "solution_cache.hpp"
+#include "tensile_host_profile.hpp"
 #include "utility.hpp"
+#include "workspace_pool.hpp"
 #include <array>
 #include <cstddef>
 #include <hip/hip_runtime.h>
@@ -40,6 +54,7 @@
 #include <unistd.h>
 #endif
 #include <utility>
+#include <vector>
 
 // forcing early cleanup
 extern "C" ROCBLAS_EXPORT void rocblas_shutdown();
@@ -73,6 +88,12 @@ enum class rocblas_device_memory_ownership
 // helper function in handle.cpp
 static rocblas_status free_existing_device_memory(rocblas_handle);
 
+// Destroys the thread handles created for handle by rocblas_get_thread_handle, in thread_handle.cpp
+void rocblas_destroy_thread_handles(rocblas_handle handle);
+
+struct _rocblas_recording;
+struct _rocblas_level1_fusion;
+
 /*******************************************************************************
  * \brief rocblas_handle is a structure holding the rocblas library context.
  * It must be initialized using rocblas_create_handle() and the returned handle mus
@@ -175,6 +196,60 @@ private:
     };
     // clang-format on
 
+    // Class forking the handle's stream into concurrent streams for independent sub-operations,
+    // joining them back to the handle's stream on destruction
+    // clang-format off
+    class [[nodiscard]] _forked_streams
+    {
+        _rocblas_handle* handle;
+        hipStream_t      user_stream;
+        rocblas_int      count;
+
+    public:
+        // Constructor
+        _forked_streams(_rocblas_handle* handle, rocblas_int tasks)
+            : handle(handle)
+            , user_stream(handle->stream)
+            , count(handle->fork(tasks))
+        {
+        }
+
+        // Number of streams the sub-operations are distributed over, 1 if not forked
+        rocblas_int size() const
+        {
+            return count;
+        }
+
+        // Direct the operations on the handle's stream to forked stream i < size(); stream 0
+        // is the handle's own
+        void select(rocblas_int i)
+        {
+            if(count > 1)
+                handle->stream = i ? handle->aux_streams[i - 1] : user_stream;
+        }
+
+        // The handle's stream waits for the forked streams on destruction
+        ~_forked_streams()
+        {
+            if(count > 1)
+                handle->join(user_stream, count);
+        }
+
+        // Move constructor
+        _forked_streams(_forked_streams&& other)
+            : handle(other.handle)
+            , user_stream(other.user_stream)
+            , count(other.count)
+        {
+            other.count = 1;
+        }
+
+        _forked_streams(const _forked_streams&) = delete;
+        _forked_streams& operator=(const _forked_streams&) = delete;
+        _forked_streams& operator=(_forked_streams&&) = delete;
+    };
+    // clang-format on
+
 public:
     _rocblas_handle();
     ~_rocblas_handle();
@@ -203,6 +278,31 @@ public:
         return archMajor;
     }
 
+    // Number of compute units of the handle's device
+    int getCUCount()
+    {
+        return cu_count;
+    }
+
+    // Number of compute units GEMM solutions are selected for, if fewer than the device's
+    // because of rocblas_set_cu_count or the CU mask of the stream, and 0 otherwise
+    int get_cu_count_limit() const
+    {
+        int limit = cu_count_limit && cu_count_limit < cu_count ? cu_count_limit : cu_count;
+        if(stream_cu_count && stream_cu_count < limit)
+            limit = stream_cu_count;
+        return limit < cu_count ? limit : 0;
+    }
+
+    // Compute units targeted with rocblas_set_cu_count, 0 for all of the device's
+    rocblas_int cu_count_limit = 0;
+
+    // Whether the handle's stream was created with a priority above the default
+    bool is_stream_high_priority() const
+    {
+        return stream_high_priority;
+    }
+
     // hipEvent_t pointers (for internal use only)
     hipEvent_t startEvent = nullptr;
     hipEvent_t stopEvent  = nullptr;
@@ -213,6 +313,29 @@ public:
     // default logging_mode is no logging
     rocblas_layer_mode layer_mode = rocblas_layer_mode_none;
 
+    // trace and bench logging of one call in every log_sample_every of each function, and of at
+    // most log_sample_max_per_second calls of each function per second unless 0
+    rocblas_int log_sample_every          = 1;
+    rocblas_int log_sample_max_per_second = 0;
+
+    // Layer mode of a call whose function is sampled by sampler, see ROCBLAS_SAMPLED_LAYER_MODE
+    rocblas_layer_mode get_sampled_layer_mode(rocblas_log_sampler& sampler, uint32_t& calls) const
+    {
+        constexpr int sampled = rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+                                | rocblas_layer_mode_roctx;
+        if(!(layer_mode & sampled) || (log_sample_every <= 1 && !log_sample_max_per_second)
+           || sampler.sample(calls, log_sample_every, log_sample_max_per_second))
+        {
+#ifdef ROCBLAS_ROCTX
+            // log_trace pushes the ROCTX range of the call
+            if(layer_mode & rocblas_layer_mode_roctx)
+                return rocblas_layer_mode(layer_mode | rocblas_layer_mode_log_trace);
+#endif
+            return layer_mode;
+        }
+        return rocblas_layer_mode(layer_mode & ~sampled);
+    }
+
     // default atomics mode allows atomic operations
     rocblas_atomics_mode atomics_mode = rocblas_atomics_allowed;
 
@@ -222,6 +345,117 @@ public:
     // default check_numerics_mode is no numeric_check
     rocblas_check_numerics_mode check_numerics = rocblas_check_numerics_mode_no_check;
 
+    // Device record of the check of the outputs of the current function made by its compute
+    // kernels in rocblas_check_numerics_mode_fused, see rocblas_fused_check_numerics
+    rocblas_check_numerics_t* fused_check_numerics = nullptr;
+
+    // when set, GEMMs run with an explicit solution index are recorded in the tuning database
+    bool tuning_db_record = false;
+
+    // tuning database generation observed by the solution cache
+    uint64_t tuning_db_generation = 0;
+
+    // when greater than 1, the first GEMM of each problem times this many Tensile solutions
+    // and runs the fastest from then on
+    rocblas_int gemm_autotune_candidates = 0;
+
+    // when greater than 0, the workgroup mapping (WGM) of the C tiles requested for GEMMs: the
+    // Tensile solution is replaced by one of the same tile with this mapping, and the source
+    // kernels visit C in strips of this many tile rows
+    rocblas_int gemm_workgroup_mapping = 0;
+
+    // implementation of the GEMMs of rocblas_internal_gemm_template, for comparisons: the default
+    // selection, or only Tensile or only the source kernels
+    rocblas_gemm_backend gemm_backend = rocblas_gemm_backend_default;
+
+    // Level 2 kernel selection thresholds for the architecture of the device
+    rocblas_level2_thresholds level2_thresholds;
+
+    // Level 1 grid-stride launch sizing: unless 0, the axpy, scal, copy and swap kernels run at
+    // most level1_blocks_per_cu blocks of level1_block_size threads per compute unit, looping
+    // over the elements, instead of one thread per element
+    rocblas_int level1_blocks_per_cu = 0;
+    rocblas_int level1_block_size    = 256;
+
+    // Threads per block of the multiple block dot and of the single pass iamax and iamin: the
+    // compile time ROCBLAS_DOT_NB and ROCBLAS_IAMAX_NB, or their wave32 instantiations on the
+    // architectures of the table in handle.cpp
+    rocblas_int dot_nb   = ROCBLAS_DOT_NB;
+    rocblas_int iamax_nb = ROCBLAS_IAMAX_NB;
+
+    // Unit stride Level 1 kernels touching more than level1_nontemporal_bytes of vectors over
+    // all batches use nontemporal loads and stores, unless 0, so as not to evict the L2 cache
+    // lines of concurrent kernels for data they will not reuse
+    size_t level1_nontemporal_bytes = 0;
+
+    // Auxiliary streams which the independent sub-operations of the blocked triangular
+    // functions may be forked onto, with the handle's stream, 0 to run them in order
+    rocblas_int fork_stream_count = 0;
+
+    // Level 1 calls deferred for fusion while rocblas_set_level1_fusion is enabled, or null
+    _rocblas_level1_fusion* level1_fusion = nullptr;
+
+    // when set, reductions in host pointer mode return without waiting for their results,
+    // which are written to host memory once the stream reaches them
+    bool deferred_host_results = false;
+
+    // when set, functions avoid host synchronization and device memory reallocation so that
+    // they can be captured into a graph, and fail with rocblas_status_not_implemented otherwise
+    bool graph_safe = false;
+
+    // when set, batched gemm checks on the device whether the pointer arrays are evenly
+    // strided, and if so runs the strided batched implementation
+    bool batched_stride_detection = false;
+
+    // when set, dot, asum, nrm2 and gemv use the reproducible reductions, whose results do not
+    // depend on the device or on the launch configuration
+    bool reproducible = false;
+
+    // when set, dot, asum and nrm2 keep the rounding errors of their sums apart and add them
+    // at the end, unless reproducible is also set
+    bool compensated_summation = false;
+
+    // when set, the bf16_r and f16_r results of axpy_ex, scal_ex and gemm_ex with f32_r
+    // execution are rounded stochastically, with the random bits of the element counters from
+    // stochastic_rounding_offset in the stream of stochastic_rounding_seed
+    bool     stochastic_rounding        = false;
+    uint64_t stochastic_rounding_seed   = 0;
+    uint64_t stochastic_rounding_offset = 0;
+
+    // when greater than 0, rocblas_trsm_ex solves double precision systems in single precision
+    // and refines the solution with at most this many corrections from double residuals
+    rocblas_int trsm_refinement_steps = 0;
+
+    // when set, the gemm functions prefetch their managed memory operands to the device
+    bool managed_prefetch = false;
+
+    // device memory ranges reused across calls, added by rocblas_add_persisting_range. While
+    // any are set, gemv reads a matrix outside of them with nontemporal loads so that streaming
+    // it does not evict them from the caches.
+    std::vector<std::pair<const char*, size_t>> persisting_ranges;
+
+    // Whether [ptr, ptr + bytes) is streamed past persisting ranges, which it does not overlap
+    bool is_streamed(const void* ptr, size_t bytes) const
+    {
+        if(persisting_ranges.empty())
+            return false;
+
+        auto p = (const char*)ptr;
+        for(const auto& range : persisting_ranges)
+            if(p < range.first + range.second && range.first < p + bytes)
+                return false;
+        return true;
+    }
+
+    // when set, deferred numerical checks in rocblas_check_numerics_mode_fail also record
+    // their failure in async_status, read by rocblas_get_async_status
+    bool async_status_mode = false;
+
+    // strides between the device alpha and beta of consecutive batches of the batched and
+    // strided batched axpy, scal and gemv functions, set by rocblas_set_batched_scalar_stride
+    rocblas_stride alpha_batch_stride = 0;
+    rocblas_stride beta_batch_stride  = 0;
+
     // used by hipBLAS to set int8 datatype to int8_t or rocblas_int8x4
     rocblas_int8_type_for_hipblas rocblas_int8_type = rocblas_int8_type_for_hipblas_default;
 
@@ -232,16 +466,26 @@ public:
     void                                      init_logging();
     void                                      init_check_numerics();
 
+    // binary bench log, used instead of log_bench_os when ROCBLAS_LOG_BENCH_BINARY_PATH is set
+    rocblas_binary_log* log_bench_binary = nullptr;
+
     // C interfaces for manipulating device memory
     friend rocblas_status(::rocblas_start_device_memory_size_query)(_rocblas_handle*);
     friend rocblas_status(::rocblas_stop_device_memory_size_query)(_rocblas_handle*, size_t*);
     friend rocblas_status(::rocblas_get_device_memory_size)(_rocblas_handle*, size_t*);
     friend rocblas_status(::rocblas_set_device_memory_size)(_rocblas_handle*, size_t);
+    friend rocblas_status(::rocblas_push_workspace_scope)(_rocblas_handle*, size_t, size_t, void**);
+    friend rocblas_status(::rocblas_pop_workspace_scope)(_rocblas_handle*);
     friend rocblas_status(::free_existing_device_memory)(rocblas_handle);
     friend rocblas_status(::rocblas_set_workspace)(_rocblas_handle*, void*, size_t);
+    friend rocblas_status(::rocblas_set_workspace_pool)(_rocblas_handle*,
+                                                        _rocblas_workspace_pool*);
     friend bool(::rocblas_is_managing_device_memory)(_rocblas_handle*);
     friend bool(::rocblas_is_user_managing_device_memory)(_rocblas_handle*);
     friend rocblas_status(::rocblas_set_stream)(_rocblas_handle*, hipStream_t);
+    friend rocblas_status(::rocblas_get_thread_handle)(_rocblas_handle*, _rocblas_handle**);
+    friend rocblas_status(::rocblas_begin_recording)(_rocblas_handle*, size_t);
+    friend rocblas_status(::rocblas_end_recording)(_rocblas_handle*, _rocblas_recording**);
 
     // C interfaces that interact with the solution selection process
     friend rocblas_status(::rocblas_set_solution_fitness_query)(_rocblas_handle*, double*);
@@ -258,7 +502,20 @@ public:
 
     size_t get_available_workspace()
     {
-        return (device_memory_size - device_memory_in_use);
+        // Sub-operations on forked streams would share the workspace concurrently
+        return forked ? 0 : (device_memory_size - device_memory_in_use);
+    }
+
+    // Whether rocBLAS owns the device memory of the handle and may grow it on demand
+    bool is_device_memory_managed() const
+    {
+        return device_memory_owner == rocblas_device_memory_ownership::rocblas_managed;
+    }
+
+    // Whether the device memory of the handle is owned by the application (rocblas_set_workspace)
+    bool is_device_memory_user_owned() const
+    {
+        return device_memory_owner == rocblas_device_memory_ownership::user_owned;
     }
 
     // Get the solution fitness query
@@ -267,6 +524,165 @@ public:
         return solution_fitness_query;
     }
 
+    // Configure the handle's stream order memory pool: reserve_size bytes are kept allocated
+    // from the device, and memory above release_threshold is returned to the device
+    rocblas_status set_memory_pool_attributes(size_t reserve_size, uint64_t release_threshold);
+
+    // Query the handle's stream order memory pool; any output pointer may be nullptr
+    rocblas_status get_memory_pool_attributes(size_t*   reserved_size,
+                                              size_t*   used_size,
+                                              uint64_t* release_threshold);
+
+    // Copy results from device memory to host memory. With deferred_host_results the copy
+    // does not block, and dst is written once the stream reaches it.
+    rocblas_status copy_results_to_host(void* dst, const void* src, size_t bytes)
+    {
+        // Only pinned memory can be written by copies captured into a graph
+        if(is_graph_safe())
+        {
+            if(!rocblas_host_staging::is_pinned(dst))
+                return rocblas_status_not_implemented;
+            return get_rocblas_status_for_hip_status(
+                hipMemcpyAsync(dst, src, bytes, hipMemcpyDeviceToHost, stream));
+        }
+        if(deferred_host_results)
+            return get_rocblas_status_for_hip_status(
+                host_staging.copy_to_host(dst, src, bytes, stream));
+        return get_rocblas_status_for_hip_status(
+            hipMemcpy(dst, src, bytes, hipMemcpyDeviceToHost));
+    }
+
+    // Number of deferred result copies which have not been written to host memory yet
+    size_t get_pending_host_results() const
+    {
+        return host_staging.get_pending();
+    }
+
+    // Device record for a check made in rocblas_check_numerics_mode_deferred, which is
+    // reported by report_check_numerics
+    rocblas_status get_deferred_check_numerics_record(const char*                function_name,
+                                                      int                        check_numerics,
+                                                      bool                       is_input,
+                                                      rocblas_check_numerics_t** record)
+    {
+        return deferred_check_numerics.next_record(
+            function_name, check_numerics, is_input, stream, record);
+    }
+
+    // In async status mode, make the failure of the deferred check of record, made with
+    // check_numerics, readable by rocblas_get_async_status without synchronizing
+    void set_async_status_for_check(const rocblas_check_numerics_t* record, int check_numerics)
+    {
+        if(async_status_mode && (check_numerics & rocblas_check_numerics_mode_fail))
+            rocblas_check_numerics_set_async_status(stream, record, async_status.device_status());
+    }
+
+    // Strides between the alpha and beta of consecutive batches, which are only read per batch
+    // from device memory
+    rocblas_stride get_alpha_batch_stride() const
+    {
+        return pointer_mode == rocblas_pointer_mode_device ? alpha_batch_stride : 0;
+    }
+
+    rocblas_stride get_beta_batch_stride() const
+    {
+        return pointer_mode == rocblas_pointer_mode_device ? beta_batch_stride : 0;
+    }
+
+    // Allocate the async status, when async status mode is first enabled
+    rocblas_status init_async_status()
+    {
+        return async_status.init();
+    }
+
+    // First error found by device code since the last call, which is cleared
+    rocblas_status take_async_status()
+    {
+        return async_status.take();
+    }
+
+    // Device array of the batch_count pointers base + i * stride_bytes kept by the handle, which
+    // the caller writes unless *cached. In graph safe mode only cached arrays are returned.
+    rocblas_status get_cached_pointer_array(void*          base,
+                                            rocblas_stride stride_bytes,
+                                            rocblas_int    batch_count,
+                                            void***        array,
+                                            bool*          cached)
+    {
+        // Temporarily change the thread's default device ID to the handle's device ID
+        // cppcheck-suppress unreadVariable
+        auto saved_device_id = push_device_id();
+
+        return pointer_array_cache.get(
+            base, stride_bytes, batch_count, !is_graph_safe(), array, cached);
+    }
+
+    // Report and clear the deferred checks made on the handle's stream
+    rocblas_status report_check_numerics()
+    {
+        return deferred_check_numerics.report(stream);
+    }
+
+    // Set the number of deferred checks recorded between two reports
+    void set_check_numerics_report_interval(size_t interval)
+    {
+        deferred_check_numerics.set_capacity(interval);
+    }
+
+    // Time the call being profiled on the handle's stream, accumulating into *time, until
+    // the next profiled call (rocblas_layer_mode_log_profile_time). Calls made while the
+    // stream is being captured are not timed.
+    void start_profile_timer(rocblas_profile_time* time)
+    {
+        if(!is_stream_in_capture_mode())
+            profile_timer.start(time, stream);
+    }
+
+    // End the profiled call being timed on the handle's stream
+    void stop_profile_timer()
+    {
+        profile_timer.stop(stream);
+    }
+
+    // Get the cache of previously selected solutions
+    rocblas_solution_cache& get_solution_cache()
+    {
+        return solution_cache;
+    }
+
+    // Get the counts and host times of the GEMM problems run with Tensile
+    rocblas_tensile_host_profile& get_tensile_host_profile()
+    {
+        return tensile_host_profile;
+    }
+
+    // Get the counts and peak sizes of the device memory allocations
+    rocblas_device_memory_profile& get_device_memory_profile()
+    {
+        return device_memory_profile;
+    }
+
+    // Get the counts of the kernels selected by each function
+    rocblas_kernel_profile& get_kernel_profile()
+    {
+        return kernel_profile;
+    }
+
+    // Whether the kernels selected by the calls are logged, with the profile or in the ROCTX
+    // range of the call
+    bool is_kernel_logged() const
+    {
+        return layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx);
+    }
+
+    // Log the Tensile solution, with its index, or the internal kernel variant selected by the
+    // current call
+    void log_kernel(const char* kernel, int solution_index = 0)
+    {
+        if(is_kernel_logged())
+            log_kernel_selection(kernel, solution_index);
+    }
+
     // Sets the optimal size(s) of device memory for a kernel call
     // Maximum size is accumulated in device_memory_query_size
     // Returns rocblas_status_size_increased or rocblas_status_size_unchanged
@@ -285,12 +701,49 @@ public:
         size_t total = 0;
         auto   dummy = {total += roundup_device_memory_size(sizes)...};
 #endif
+        // Regions reserved by the workspace scopes open during the query
+        total += device_memory_query_base;
 
         return total > device_memory_query_size ? device_memory_query_size = total,
                                                   rocblas_status_size_increased
                                                 : rocblas_status_size_unchanged;
     }
 
+    // Runs func as a device memory size query, independently of any query in progress,
+    // and returns in *size the device memory it would request. Logging and numerical checks
+    // are disabled, and pointer arguments passed by func are validated but never dereferenced,
+    // except for host scalars.
+    template <typename F>
+    rocblas_status query_device_memory_size(size_t* size, F&& func)
+    {
+        if(!size)
+            return rocblas_status_invalid_pointer;
+
+        rocblas_status status;
+        size_t         query_size;
+        {
+            auto saved_query = _pushed_state<bool>(device_memory_size_query, true);
+            auto saved_size  = _pushed_state<size_t>(device_memory_query_size, 0);
+            auto saved_base  = _pushed_state<size_t>(device_memory_query_base, 0);
+            auto saved_check = _pushed_state<rocblas_check_numerics_mode>(
+                check_numerics, rocblas_check_numerics_mode_no_check);
+            auto saved_mode = _pushed_state<rocblas_pointer_mode>(pointer_mode,
+                                                                  rocblas_pointer_mode_host);
+            auto saved_layer = _pushed_state<rocblas_layer_mode>(layer_mode,
+                                                                 rocblas_layer_mode_none);
+
+            status     = func();
+            query_size = device_memory_query_size;
+        }
+
+        if(status != rocblas_status_success && status != rocblas_status_size_unchanged
+           && status != rocblas_status_size_increased)
+            return status;
+
+        *size = query_size;
+        return rocblas_status_success;
+    }
+
     // Temporarily change pointer mode, returning object which restores old mode when destroyed
     auto push_pointer_mode(rocblas_pointer_mode mode)
     {
@@ -306,6 +759,85 @@ public:
         return _pushed_state<bool>(any_order, new_any_order);
     }
 
+    // Temporarily change deferred_host_results flag
+    auto push_deferred_host_results(bool new_deferred_host_results)
+    {
+        return _pushed_state<bool>(deferred_host_results, new_deferred_host_results);
+    }
+
+    // Save the settings which applications change with the rocblas_set_* functions, returning
+    // an object which restores them when destroyed
+    auto push_settings()
+    {
+        return std::make_tuple(
+            _pushed_state<rocblas_pointer_mode>(pointer_mode, pointer_mode),
+            _pushed_state<rocblas_atomics_mode>(atomics_mode, atomics_mode),
+            _pushed_state<rocblas_performance_metric>(performance_metric, performance_metric),
+            _pushed_state<rocblas_int8_type_for_hipblas>(rocblas_int8_type, rocblas_int8_type),
+            _pushed_state<bool>(tuning_db_record, tuning_db_record),
+            _pushed_state<rocblas_int>(gemm_autotune_candidates, gemm_autotune_candidates),
+            _pushed_state<rocblas_int>(gemm_workgroup_mapping, gemm_workgroup_mapping),
+            _pushed_state<rocblas_gemm_backend>(gemm_backend, gemm_backend),
+            _pushed_state<bool>(deferred_host_results, deferred_host_results),
+            _pushed_state<bool>(graph_safe, graph_safe),
+            _pushed_state<bool>(batched_stride_detection, batched_stride_detection),
+            _pushed_state<bool>(reproducible, reproducible),
+            _pushed_state<bool>(compensated_summation, compensated_summation),
+            _pushed_state<bool>(stochastic_rounding, stochastic_rounding),
+            _pushed_state<uint64_t>(stochastic_rounding_seed, stochastic_rounding_seed),
+            _pushed_state<uint64_t>(stochastic_rounding_offset, stochastic_rounding_offset),
+            _pushed_state<rocblas_int>(trsm_refinement_steps, trsm_refinement_steps),
+            _pushed_state<rocblas_stride>(alpha_batch_stride, alpha_batch_stride),
+            _pushed_state<rocblas_stride>(beta_batch_stride, beta_batch_stride),
+            _pushed_state<rocblas_int>(cu_count_limit, cu_count_limit),
+            _pushed_state<rocblas_int>(log_sample_every, log_sample_every),
+            _pushed_state<rocblas_int>(log_sample_max_per_second, log_sample_max_per_second),
+            _pushed_state<hipEvent_t>(startEvent, startEvent),
+            _pushed_state<hipEvent_t>(stopEvent, stopEvent),
+            _pushed_state<double*>(solution_fitness_query, solution_fitness_query));
+    }
+
+    // Copy the settings which applications change with the rocblas_set_* functions from other,
+    // except for its events and solution fitness query, which belong to its calls
+    void copy_settings(const _rocblas_handle& other)
+    {
+        pointer_mode               = other.pointer_mode;
+        atomics_mode               = other.atomics_mode;
+        performance_metric         = other.performance_metric;
+        rocblas_int8_type          = other.rocblas_int8_type;
+        tuning_db_record           = other.tuning_db_record;
+        gemm_autotune_candidates   = other.gemm_autotune_candidates;
+        gemm_workgroup_mapping     = other.gemm_workgroup_mapping;
+        gemm_backend               = other.gemm_backend;
+        deferred_host_results      = other.deferred_host_results;
+        graph_safe                 = other.graph_safe;
+        batched_stride_detection   = other.batched_stride_detection;
+        reproducible               = other.reproducible;
+        compensated_summation      = other.compensated_summation;
+        stochastic_rounding        = other.stochastic_rounding;
+        stochastic_rounding_seed   = other.stochastic_rounding_seed;
+        stochastic_rounding_offset = other.stochastic_rounding_offset;
+        trsm_refinement_steps      = other.trsm_refinement_steps;
+        alpha_batch_stride         = other.alpha_batch_stride;
+        beta_batch_stride          = other.beta_batch_stride;
+        cu_count_limit             = other.cu_count_limit;
+        log_sample_every           = other.log_sample_every;
+        log_sample_max_per_second  = other.log_sample_max_per_second;
+    }
+
+    // Handle of which this is the thread handle of one thread, created by
+    // rocblas_get_thread_handle, or nullptr
+    const _rocblas_handle* shared_handle = nullptr;
+
+    // Fork the handle's stream into at most tasks streams for independent sub-operations: the
+    // handle's stream and up to fork_stream_count auxiliary streams waiting for its work so far.
+    // Nested forks, device memory size queries and graph safe calls are not forked, and device
+    // memory cannot be allocated while forked.
+    auto fork_streams(rocblas_int tasks)
+    {
+        return _forked_streams(this, tasks);
+    }
+
     // Return the current stream
     hipStream_t get_stream() const
     {
@@ -324,6 +856,13 @@ public:
             return false;
     }
 
+    // Whether host synchronization and device memory reallocation must be avoided, because
+    // graph safe mode is set or the stream is being captured into a graph
+    bool is_graph_safe()
+    {
+        return graph_safe || is_stream_in_capture_mode();
+    }
+
 private:
     // device memory work buffer
     static constexpr size_t DEFAULT_DEVICE_MEMORY_SIZE = 32 * 1024 * 1024;
@@ -336,15 +875,127 @@ private:
     bool                            alpha_beta_memcpy_complete = false;
     rocblas_device_memory_ownership device_memory_owner;
     size_t                          device_memory_query_size;
+    size_t                          device_memory_query_base = 0;
+
+    // Workspace scopes opened by rocblas_push_workspace_scope, innermost last. Within a scope,
+    // device_malloc takes memory from the workspace past the reserved regions, and neither
+    // reallocates the workspace nor allocates in stream order.
+    struct workspace_scope
+    {
+        size_t reserved; // size of the region reserved by the scope
+        bool   query; // whether the scope was opened during a device memory size query
+        void*  block; // workspace allocated in stream order by an outermost scope, if any
+        size_t saved_device_memory_size; // device_memory_size replaced by block
+    };
+    std::vector<workspace_scope> workspace_scopes;
 
     bool stream_order_alloc = false;
 
+    // Whether device_malloc allocates in stream order instead of from the workspace
+    bool is_stream_order_workspace() const
+    {
+        return stream_order_alloc && is_device_memory_managed() && workspace_scopes.empty();
+    }
+
+// hipMallocFromPoolAsync and hipMemPoolCreate are used for stream order allocation
+// Support for default stream added in hip version 5.3.0
+#if HIP_VERSION >= 50300000
+    // Memory pool owned by this handle, from which stream order allocations are made. It is
+    // created with the first allocation, with mem_pool_release_threshold.
+    hipMemPool_t mem_pool                   = nullptr;
+    uint64_t     mem_pool_release_threshold = DEFAULT_DEVICE_MEMORY_SIZE;
+
+    hipError_t create_mem_pool();
+
+    // Stream order allocation from the handle's memory pool
+    hipError_t stream_order_malloc(void** ptr, size_t size, hipStream_t stream_in_use)
+    {
+        hipError_t status = mem_pool ? hipSuccess : create_mem_pool();
+        return status == hipSuccess ? hipMallocFromPoolAsync(ptr, size, mem_pool, stream_in_use)
+                                    : status;
+    }
+#endif
+
+    // Workspace pool shared with other handles, from which the stream order allocations of
+    // device_malloc are made instead of from mem_pool when attached
+    _rocblas_workspace_pool* workspace_pool = nullptr;
+
+    // Recording in progress between rocblas_begin_recording and rocblas_end_recording
+    _rocblas_recording* recording = nullptr;
+
+#if HIP_VERSION >= 50300000
+    // Stream order allocation and free of the workspace of device_malloc
+    hipError_t workspace_malloc(void** ptr, size_t size, hipStream_t stream_in_use)
+    {
+        return workspace_pool ? workspace_pool->allocate(ptr, size, stream_in_use)
+                              : stream_order_malloc(ptr, size, stream_in_use);
+    }
+
+    hipError_t workspace_free(void* ptr, size_t size, hipStream_t stream_in_use)
+    {
+        return workspace_pool ? workspace_pool->deallocate(ptr, size, stream_in_use)
+                              : hipFreeAsync(ptr, stream_in_use);
+    }
+#endif
+
     // Solution fitness query (used for internal testing)
     double* solution_fitness_query = nullptr;
 
+    // Cache of solutions selected for previously seen problems
+    rocblas_solution_cache solution_cache;
+
+    // Counts and host times of the GEMM problems run with Tensile
+    rocblas_tensile_host_profile tensile_host_profile;
+
+    // Counts and peak sizes of the device memory allocations, in total and per function
+    rocblas_device_memory_profile device_memory_profile;
+
+    // Kernels selected by the profiled calls
+    rocblas_kernel_profile kernel_profile;
+    void                   log_kernel_selection(const char* kernel, int solution_index);
+
+    // Pinned staging buffers for deferred host results
+    rocblas_host_staging host_staging;
+
+    // Results of numerical checks made in rocblas_check_numerics_mode_deferred
+    rocblas_deferred_check_numerics deferred_check_numerics;
+
+    // First error found by device code in async status mode
+    rocblas_async_status async_status;
+
+    // Device pointer arrays returned by rocblas_get_pointer_array
+    rocblas_pointer_array_cache pointer_array_cache;
+
+    // GPU times of the profiled calls with rocblas_layer_mode_log_profile_time
+    rocblas_profile_timer profile_timer;
+
     // rocblas by default take the system default stream 0 users cannot create
     hipStream_t stream = 0;
 
+    // Compute units enabled by the CU mask of the stream, 0 if it is not masked
+    int stream_cu_count = 0;
+
+    // Whether the stream has a priority above the device's default
+    bool stream_high_priority = false;
+
+    // Update stream_cu_count and stream_high_priority for the current stream
+    void update_stream_properties();
+
+    // Auxiliary streams created for forking, with the events recorded to join them, and the
+    // event the auxiliary streams wait on when forked
+    std::vector<hipStream_t> aux_streams;
+    std::vector<hipEvent_t>  aux_events;
+    hipEvent_t               fork_event = nullptr;
+
+    // Whether the handle's stream is currently forked
+    bool forked = false;
+
+    // Fork the stream, returning the number of streams forked, 1 if not forked
+    rocblas_int fork(rocblas_int tasks);
+
+    // Restore user_stream, which waits for the count - 1 auxiliary streams
+    void join(hipStream_t user_stream, rocblas_int count);
+
 #if ROCBLAS_REALLOC_ON_DEMAND
     // Helper for device memory allocator
     bool device_allocator(size_t size);
@@ -357,6 +1008,9 @@ private:
     const int arch;
     int       archMajor;
 
+    // Compute unit count, which is queried with the arch at handle creation time.
+    const int cu_count;
+
     // Opaque smart allocator class to perform device memory allocations
     // clang-format off
     class [[nodiscard]] _device_malloc : public rocblas_device_malloc_base
@@ -369,6 +1023,7 @@ private:
         void*          dev_mem = nullptr;
         hipStream_t    stream_in_use;
         bool           success;
+        bool           stream_ordered;
 
     private:
         std::vector<void*> pointers; // Important: must come last
@@ -385,8 +1040,14 @@ private:
             const size_t offsets[] = {(old = size, size += roundup_device_memory_size(sizes), old)...};
             char* addr = nullptr;
 
-            if(handle->stream_order_alloc &&
-                handle->device_memory_owner == rocblas_device_memory_ownership::rocblas_managed)
+            // Sub-operations on forked streams cannot share the workspace
+            if(size && handle->forked)
+            {
+                success = false;
+                return decltype(pointers)(sizeof...(sizes));
+            }
+
+            if(stream_ordered)
             {
 // hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
 // Support for default stream added in hip version 5.3.0
@@ -394,7 +1055,7 @@ private:
                 if(!size)
                     return decltype(pointers)(sizeof...(sizes));
 
-                hipError_t hipStatus = hipMallocAsync(&dev_mem, size, stream_in_use);
+                hipError_t hipStatus = handle->workspace_malloc(&dev_mem, size, stream_in_use);
                 if(hipStatus != hipSuccess)
                 {
                     success = false;
@@ -436,9 +1097,11 @@ private:
             , size(0)
             , stream_in_use(handle->stream)
             , success(true)
+            , stream_ordered(handle->is_stream_order_workspace())
             , pointers(allocate_pointers(size_t(sizes)...))
         {
-
+            if(size)
+                handle->device_memory_profile.allocate(size, success);
         }
 
         // Constructor for allocating count pointers of a certain total size
@@ -448,17 +1111,22 @@ private:
             , size(roundup_device_memory_size(total))
             , stream_in_use(handle->stream)
             , success(true)
+            , stream_ordered(handle->is_stream_order_workspace())
         {
-            if(handle->stream_order_alloc &&
-                handle->device_memory_owner == rocblas_device_memory_ownership::rocblas_managed)
+            if(size && handle->forked)
+            {
+                success = false;
+                pointers.resize(count, nullptr);
+            }
+            else if(stream_ordered)
             {
 // hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
 // Support for default stream added in hip version 5.3.0
 #if HIP_VERSION >= 50300000
-                bool status = hipMallocAsync(&dev_mem, size, stream_in_use) == hipSuccess ;
+                success = !size || handle->workspace_malloc(&dev_mem, size, stream_in_use) == hipSuccess ;
 
                 for(auto i= 0 ; i < count ; i++)
-                    pointers.push_back(status ? dev_mem : nullptr);
+                    pointers.push_back(success ? dev_mem : nullptr);
 #endif
             }
             else
@@ -476,6 +1144,9 @@ private:
             if(success)
                 handle->device_memory_in_use += size;
             }
+
+            if(size)
+                handle->device_memory_profile.allocate(size, success);
         }
 
         // Move constructor
@@ -492,6 +1163,7 @@ private:
             , dev_mem(other.dev_mem)
             , stream_in_use(other.stream_in_use)
             , success(other.success)
+            , stream_ordered(other.stream_ordered)
             , pointers(std::move(other.pointers))
         {
             other.success = false;
@@ -515,8 +1187,9 @@ private:
             // If success == false or size == 0, the destructor is a no-op
             if(success && size)
             {
-                if(handle->stream_order_alloc &&
-                    handle->device_memory_owner == rocblas_device_memory_ownership::rocblas_managed)
+                handle->device_memory_profile.release(size);
+
+                if(stream_ordered)
                 {
 // hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
 // Support for default stream added in hip version 5.3.0
@@ -524,7 +1197,7 @@ private:
                         if(dev_mem)
                         {
 
-                            bool status = hipFreeAsync(dev_mem, stream_in_use) == hipSuccess ;
+                            bool status = handle->workspace_free(dev_mem, size, stream_in_use) == hipSuccess ;
                             if(!status)
                             {
                                 rocblas_cerr << " rocBLAS internal error: hipFreeAsync() Failed, "
@@ -0,0 +1,174 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <hip/hip_runtime.h>
+#include <mutex>
+#include <vector>
+
+/*******************************************************************************
+ * rocblas_host_staging copies small results from device memory to host memory
+ * in stream order, without blocking the host.
+ *
+ * Pinned destinations are written directly by hipMemcpyAsync. Pageable
+ * destinations cannot be written asynchronously by the copy engine, so the
+ * result is copied into a pinned staging buffer owned by this object, and a
+ * host function enqueued after the copy moves it to the destination and
+ * returns the buffer to the free list. Either way the destination is written
+ * once the stream reaches the copy.
+ ******************************************************************************/
+class rocblas_host_staging
+{
+public:
+    // Smallest staging buffer allocated; reduction results are a few bytes per batch
+    static constexpr size_t MIN_BUFFER_SIZE = 256;
+
+    rocblas_host_staging() = default;
+
+    // Callers must make sure no copies are pending, e.g. by synchronizing the stream
+    ~rocblas_host_staging()
+    {
+        for(auto* b : free_buffers)
+        {
+            hipHostFree(b->data);
+            delete b;
+        }
+    }
+
+    rocblas_host_staging(const rocblas_host_staging&) = delete;
+    rocblas_host_staging& operator=(const rocblas_host_staging&) = delete;
+
+    // Copy bytes from device memory src to host memory dst in stream order.
+    // dst must remain valid until the stream has completed the copy.
+    hipError_t copy_to_host(void* dst, const void* src, size_t bytes, hipStream_t stream)
+    {
+        if(!bytes)
+            return hipSuccess;
+
+        if(is_pinned(dst))
+            return hipMemcpyAsync(dst, src, bytes, hipMemcpyDeviceToHost, stream);
+
+        buffer_t* b = acquire(bytes);
+        if(!b)
+            return hipErrorOutOfMemory;
+        b->dst   = dst;
+        b->bytes = bytes;
+
+        hipError_t status = hipMemcpyAsync(b->data, src, bytes, hipMemcpyDeviceToHost, stream);
+        if(status != hipSuccess)
+        {
+            release(b);
+            return status;
+        }
+
+        pending.fetch_add(1, std::memory_order_relaxed);
+        status = hipLaunchHostFunc(stream, complete, b);
+        if(status != hipSuccess)
+        {
+            // The copy into the staging buffer is already enqueued; wait for it
+            // so that the result is not lost and the buffer can be reused
+            status = hipStreamSynchronize(stream);
+            complete(b);
+        }
+        return status;
+    }
+
+    // Number of copies whose destinations have not been written yet
+    size_t get_pending() const
+    {
+        return pending.load(std::memory_order_acquire);
+    }
+
+    // Registered or hipHostMalloc'd memory is reported with a host pointer
+    static bool is_pinned(const void* ptr)
+    {
+        hipPointerAttribute_t attribute;
+        if(hipPointerGetAttributes(&attribute, ptr) != hipSuccess)
+        {
+            // Pageable memory is unknown to HIP; clear the error
+            (void)hipGetLastError();
+            return false;
+        }
+        return attribute.hostPointer == ptr;
+    }
+
+private:
+    struct buffer_t
+    {
+        rocblas_host_staging* owner;
+        void*                 data;
+        size_t                size;
+        void*                 dst;
+        size_t                bytes;
+    };
+
+    buffer_t* acquire(size_t bytes)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for(size_t i = 0; i < free_buffers.size(); ++i)
+            {
+                if(free_buffers[i]->size >= bytes)
+                {
+                    buffer_t* b     = free_buffers[i];
+                    free_buffers[i] = free_buffers.back();
+                    free_buffers.pop_back();
+                    return b;
+                }
+            }
+        }
+
+        size_t size = MIN_BUFFER_SIZE;
+        while(size < bytes)
+            size <<= 1;
+
+        void* data = nullptr;
+        if(hipHostMalloc(&data, size) != hipSuccess)
+            return nullptr;
+        return new buffer_t{this, data, size, nullptr, 0};
+    }
+
+    void release(buffer_t* b)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        free_buffers.push_back(b);
+    }
+
+    // Host function run by the stream after the copy into the staging buffer.
+    // It must not call HIP.
+    static void complete(void* userData)
+    {
+        auto* b = static_cast<buffer_t*>(userData);
+        memcpy(b->dst, b->data, b->bytes);
+        rocblas_host_staging* owner = b->owner;
+        owner->release(b);
+        owner->pending.fetch_sub(1, std::memory_order_release);
+    }
+
+    std::mutex             mutex;
+    std::vector<buffer_t*> free_buffers;
+    std::atomic<size_t>    pending{0};
+};
@@ -0,0 +1,106 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+/*******************************************************************************
+ * Helpers for the 64-bit integer (_64) API.
+ *
+ * The _64 functions take int64_t sizes and increments, but the kernels keep
+ * their 32-bit index arithmetic. A problem which fits in rocblas_int is passed
+ * through unchanged; otherwise it is split into chunks which each fit, and the
+ * 32-bit implementation is called on every chunk with offset pointers.
+ ******************************************************************************/
+
+constexpr int64_t c_i32_max = std::numeric_limits<rocblas_int>::max();
+constexpr int64_t c_i32_min = std::numeric_limits<rocblas_int>::min();
+
+inline bool rocblas_fits_int32(int64_t value)
+{
+    return value >= c_i32_min && value <= c_i32_max;
+}
+
+// Largest number of elements of a vector with increment inc for which every
+// element offset within the chunk fits in rocblas_int
+inline int64_t rocblas_chunk_size_64(int64_t inc)
+{
+    int64_t abs_inc = inc < 0 ? -inc : inc;
+    return abs_inc ? std::max<int64_t>(1, c_i32_max / abs_inc) : c_i32_max;
+}
+
+// Offset of the chunk holding elements [i0, i0 + count) of a vector of length n.
+// With a negative increment element 0 is the last one in memory, so the chunk
+// starts after the n - i0 - count elements which follow it in the vector.
+inline int64_t rocblas_chunk_offset_64(int64_t n, int64_t i0, int64_t count, int64_t inc)
+{
+    return inc >= 0 ? i0 * inc : (n - i0 - count) * -inc;
+}
+
+// Increment passed to the 32-bit implementation for a chunk. An increment which
+// does not fit only occurs with single element chunks, which never step, so only
+// its sign is kept.
+inline rocblas_int rocblas_chunk_inc_64(int64_t inc)
+{
+    return rocblas_fits_int32(inc) ? rocblas_int(inc) : (inc > 0 ? 1 : -1);
+}
+
+// Pointer to a chunk. A null pointer stays null, so that every chunk fails the
+// argument checks of the 32-bit implementation in the same way.
+template <typename T>
+inline T* rocblas_chunk_ptr_64(T* ptr, int64_t offset)
+{
+    return ptr ? ptr + offset : ptr;
+}
+
+/*******************************************************************************
+ * Calls func(offset_x, offset_y, n, incx, incy) with 32-bit sizes and increments
+ * for each chunk of a pair of vectors of length n, stopping at the first error.
+ * A device memory size query only runs the first chunk, which is the largest.
+ ******************************************************************************/
+template <typename F>
+rocblas_status rocblas_chunk_vectors_64(
+    rocblas_handle handle, int64_t n, int64_t incx, int64_t incy, F&& func)
+{
+    if(n <= c_i32_max && rocblas_fits_int32(incx) && rocblas_fits_int32(incy))
+        return func(
+            0, 0, rocblas_int(std::max<int64_t>(n, 0)), rocblas_int(incx), rocblas_int(incy));
+
+    int64_t chunk = std::min(rocblas_chunk_size_64(incx), rocblas_chunk_size_64(incy));
+    for(int64_t i0 = 0; i0 < n; i0 += chunk)
+    {
+        int64_t count = std::min(chunk, n - i0);
+
+        rocblas_status status = func(rocblas_chunk_offset_64(n, i0, count, incx),
+                                     rocblas_chunk_offset_64(n, i0, count, incy),
+                                     rocblas_int(count),
+                                     rocblas_chunk_inc_64(incx),
+                                     rocblas_chunk_inc_64(incy));
+        if(status != rocblas_status_success || handle->is_device_memory_size_query())
+            return status;
+    }
+    return rocblas_status_success;
+}
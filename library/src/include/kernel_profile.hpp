@@ -0,0 +1,67 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <tuple>
+
+/*******************************************************************************
+ * rocblas_kernel_profile counts the Tensile solutions and internal kernel
+ * variants selected by the calls of each rocBLAS function on a handle, so that
+ * the profile log shows which kernels the calls ran, and selection changes
+ * between rocBLAS versions can be found without tuning again.
+ *
+ * As with rocblas_device_memory_profile, the function a selection is counted
+ * for is the one last named with set_function() by the profile logging layer.
+ * Function names must have static storage; kernel names are copied.
+ ******************************************************************************/
+class rocblas_kernel_profile
+{
+public:
+    // function, kernel and Tensile solution index, 0 for the internal kernels
+    using key_t = std::tuple<std::string, std::string, int>;
+
+    // Count the following selections for func, or for no function if nullptr
+    void set_function(const char* func)
+    {
+        function = func;
+    }
+
+    // Count a selection of kernel
+    void add(const char* kernel, int solution_index)
+    {
+        counts[key_t(function ? function : "", kernel, solution_index)]++;
+    }
+
+    // The number of selections of each kernel by each function
+    const std::map<key_t, size_t>& get_counts() const
+    {
+        return counts;
+    }
+
+private:
+    std::map<key_t, size_t> counts;
+    const char*             function = nullptr;
+};
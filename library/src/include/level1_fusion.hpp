@@ -0,0 +1,238 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "utility.hpp"
+#include <cstdint>
+#include <type_traits>
+
+/*******************************************************************************
+ * _rocblas_level1_fusion holds the Level 1 calls deferred by the fusion mode
+ * of rocblas_set_level1_fusion.
+ *
+ * Unit stride float and double axpy, scal and copy calls in host pointer mode
+ * are queued instead of run. Every queued operation has the same length n, and
+ * each distinct vector they access gets a slot. When the queue is flushed, one
+ * kernel loads each slot that is read before it is written, applies the queued
+ * operations element by element in registers, and stores each slot that was
+ * written, so a vector is read and written at most once however many calls
+ * touched it.
+ *
+ * A dot call, or a float nrm2 call, over the same vectors flushes the queue in
+ * the same kernel, the reduction being made in double on the values computed
+ * for each element, and its result is returned as usual.
+ *
+ * The queue is also flushed by rocblas_flush_level1_fusion, by disabling the
+ * fusion mode, by rocblas_set_stream, when the handle is destroyed, and before
+ * a Level 1 call which cannot be queued, such as one of another length or
+ * precision or one on a vector which partially overlaps a queued one.
+ ******************************************************************************/
+struct _rocblas_level1_fusion
+{
+    static constexpr int MAX_OPS     = 8;
+    static constexpr int MAX_VECTORS = 8;
+
+    enum class op_kind : int8_t
+    {
+        axpy, // v[dst] := alpha * v[src] + v[dst]
+        scal, // v[dst] := alpha * v[dst]
+        copy, // v[dst] := v[src]
+    };
+
+    struct op
+    {
+        op_kind kind;
+        int8_t  dst;
+        int8_t  src;
+        double  alpha;
+    };
+
+    rocblas_datatype type      = rocblas_datatype_invalid;
+    rocblas_int      n         = 0;
+    int              n_ops     = 0;
+    int              n_vectors = 0;
+
+    // Slots read before they are written are loaded; slots written are stored
+    uint32_t load_mask  = 0;
+    uint32_t store_mask = 0;
+
+    void* vectors[MAX_VECTORS];
+    op    ops[MAX_OPS];
+
+    void clear()
+    {
+        n_ops = n_vectors = 0;
+        load_mask = store_mask = 0;
+    }
+
+    // Slot of the vector of n elements of size elem_size at x, adding it if it is new, or
+    // -1 when x partially overlaps a slot or all slots are taken
+    int slot(const void* x, size_t elem_size);
+
+    // Marks slot s as read, loading it unless it was written before
+    void read(int s)
+    {
+        if(!(store_mask & (1u << s)))
+            load_mask |= 1u << s;
+    }
+};
+
+// Runs the deferred Level 1 operations of the handle, if any
+rocblas_status rocblas_level1_fusion_flush(rocblas_handle handle);
+
+// Queues an axpy, scal or copy, flushing first when it cannot join the queue
+rocblas_status rocblas_level1_fusion_record(rocblas_handle                  handle,
+                                            rocblas_datatype                type,
+                                            rocblas_int                     n,
+                                            _rocblas_level1_fusion::op_kind kind,
+                                            double                          alpha,
+                                            const void*                     x,
+                                            void*                           y);
+
+// Flushes the queue together with a dot product of x and y, or the 2-norm of x when y is
+// null, written to result. Returns rocblas_status_continue, after flushing, when the
+// reduction cannot be fused and must run as usual.
+rocblas_status rocblas_level1_fusion_reduce(rocblas_handle   handle,
+                                            rocblas_datatype type,
+                                            rocblas_int      n,
+                                            const void*      x,
+                                            const void*      y,
+                                            void*            result);
+
+/*******************************************************************************
+ * Hooks of the Level 1 functions for the fusion mode, called once their
+ * arguments are checked. Each returns rocblas_status_continue when the call was
+ * not deferred and must run as usual, after any deferred operation it may
+ * depend on was run.
+ ******************************************************************************/
+template <typename T>
+constexpr bool rocblas_level1_fusion_type = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+inline bool rocblas_level1_fusion_can_defer(rocblas_handle handle)
+{
+    return handle->pointer_mode == rocblas_pointer_mode_host && !handle->check_numerics;
+}
+
+// Reproducible and compensated summation are left to the reductions themselves
+inline bool rocblas_level1_fusion_can_reduce(rocblas_handle handle)
+{
+    return !handle->check_numerics && !handle->reproducible && !handle->compensated_summation;
+}
+
+inline rocblas_status rocblas_level1_fusion_no_defer(rocblas_handle handle)
+{
+    rocblas_status status = rocblas_level1_fusion_flush(handle);
+    return status == rocblas_status_success ? rocblas_status_continue : status;
+}
+
+template <typename T>
+rocblas_status rocblas_level1_fusion_axpy(rocblas_handle handle,
+                                          rocblas_int    n,
+                                          const T*       alpha,
+                                          const T*       x,
+                                          rocblas_int    incx,
+                                          T*             y,
+                                          rocblas_int    incy)
+{
+    if(!handle->level1_fusion)
+        return rocblas_status_continue;
+    if constexpr(rocblas_level1_fusion_type<T>)
+        if(incx == 1 && incy == 1 && rocblas_level1_fusion_can_defer(handle))
+            return rocblas_level1_fusion_record(handle,
+                                                rocblas_datatype_from_type<T>,
+                                                n,
+                                                _rocblas_level1_fusion::op_kind::axpy,
+                                                *alpha,
+                                                x,
+                                                y);
+    return rocblas_level1_fusion_no_defer(handle);
+}
+
+template <typename T, typename U>
+rocblas_status rocblas_level1_fusion_scal(
+    rocblas_handle handle, rocblas_int n, const U* alpha, T* x, rocblas_int incx)
+{
+    if(!handle->level1_fusion)
+        return rocblas_status_continue;
+    if constexpr(rocblas_level1_fusion_type<T> && std::is_same_v<T, U>)
+        if(incx == 1 && rocblas_level1_fusion_can_defer(handle))
+            return rocblas_level1_fusion_record(handle,
+                                                rocblas_datatype_from_type<T>,
+                                                n,
+                                                _rocblas_level1_fusion::op_kind::scal,
+                                                *alpha,
+                                                x,
+                                                x);
+    return rocblas_level1_fusion_no_defer(handle);
+}
+
+template <typename T>
+rocblas_status rocblas_level1_fusion_copy(
+    rocblas_handle handle, rocblas_int n, const T* x, rocblas_int incx, T* y, rocblas_int incy)
+{
+    if(!handle->level1_fusion)
+        return rocblas_status_continue;
+    if constexpr(rocblas_level1_fusion_type<T>)
+        if(incx == 1 && incy == 1 && !handle->check_numerics)
+            return rocblas_level1_fusion_record(handle,
+                                                rocblas_datatype_from_type<T>,
+                                                n,
+                                                _rocblas_level1_fusion::op_kind::copy,
+                                                0,
+                                                x,
+                                                y);
+    return rocblas_level1_fusion_no_defer(handle);
+}
+
+template <typename T, typename Tr>
+rocblas_status rocblas_level1_fusion_dot(rocblas_handle handle,
+                                         rocblas_int    n,
+                                         const T*       x,
+                                         rocblas_int    incx,
+                                         const T*       y,
+                                         rocblas_int    incy,
+                                         Tr*            result)
+{
+    if(!handle->level1_fusion)
+        return rocblas_status_continue;
+    if constexpr(rocblas_level1_fusion_type<T> && std::is_same_v<T, Tr>)
+        if(incx == 1 && incy == 1 && rocblas_level1_fusion_can_reduce(handle))
+            return rocblas_level1_fusion_reduce(
+                handle, rocblas_datatype_from_type<T>, n, x, y, result);
+    return rocblas_level1_fusion_no_defer(handle);
+}
+
+template <typename T, typename Tr>
+rocblas_status rocblas_level1_fusion_nrm2(
+    rocblas_handle handle, rocblas_int n, const T* x, rocblas_int incx, Tr* result)
+{
+    if(!handle->level1_fusion)
+        return rocblas_status_continue;
+    // The squares of double values may overflow without the scaling of nrm2
+    if constexpr(std::is_same_v<T, float> && std::is_same_v<Tr, float>)
+        if(incx == 1 && rocblas_level1_fusion_can_reduce(handle))
+            return rocblas_level1_fusion_reduce(
+                handle, rocblas_datatype_from_type<T>, n, x, nullptr, result);
+    return rocblas_level1_fusion_no_defer(handle);
+}
@@ -0,0 +1,96 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+
+// Threshold value which disables the kernel it selects
+constexpr int c_level2_threshold_disabled = std::numeric_limits<int>::max();
+
+/*******************************************************************************
+ * Level 2 kernel selection thresholds which are chosen at run time. Each handle
+ * holds the thresholds for the architecture of its device: the tuned values, if
+ * any have been loaded or measured, and otherwise the defaults, which are the
+ * constexpr thresholds of rocblas_level2_threshold.hpp.
+ ******************************************************************************/
+struct rocblas_level2_thresholds
+{
+    // gemv (transpose): square sizes above which the double buffered kernel is used
+    int sgemvt_double_buffered;
+    int dgemvt_double_buffered;
+
+    // gemv (transpose): single precision sizes below which the warp reduction kernel is
+    // used on gfx10 and gfx11
+    int sgemvt_warp_reduce;
+
+    // gemv (transpose): sizes below which the shared memory reduction kernel is used
+    // instead of the warp reduction kernel
+    int gemvt;
+
+    // gemv (transpose): ratio of m to n from which the skinny n kernel is used
+    int gemvt_skinny_ratio;
+};
+
+// Thresholds used for a gcnArch when none have been tuned
+rocblas_level2_thresholds rocblas_level2_default_thresholds(int arch);
+
+/*******************************************************************************
+ * rocblas_level2_tuning is a process-wide table of tuned Level 2 thresholds,
+ * keyed by GPU architecture name (as returned by rocblas_internal_get_arch_name).
+ *
+ * The table is stored as a text file with one "<arch> <threshold> <value>" line
+ * per tuned threshold, so that it can be edited by hand; thresholds which are
+ * not listed keep their defaults. The file named by the environment variable
+ * ROCBLAS_LEVEL2_THRESHOLDS is loaded the first time the table is used, which
+ * is when the first handle is created.
+ ******************************************************************************/
+class rocblas_level2_tuning
+{
+public:
+    static rocblas_level2_tuning& instance();
+
+    // Replace the table with the contents of a file; a null path clears it
+    rocblas_status load(const char* path);
+
+    // Write the table to a file
+    rocblas_status save(const char* path) const;
+
+    // Thresholds for the current device, whose gcnArch is arch
+    rocblas_level2_thresholds get(int arch) const;
+
+    // Replace the thresholds of an architecture
+    void record(const std::string& arch_name, const rocblas_level2_thresholds& thresholds);
+
+private:
+    rocblas_level2_tuning();
+
+    rocblas_level2_tuning(const rocblas_level2_tuning&) = delete;
+    rocblas_level2_tuning& operator=(const rocblas_level2_tuning&) = delete;
+
+    mutable std::mutex                                mutex;
+    std::map<std::string, std::map<std::string, int>> table;
+};
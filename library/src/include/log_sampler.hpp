@@ -0,0 +1,89 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_roctx.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+/*******************************************************************************
+ * rocblas_log_sampler decides which calls of one function are logged with
+ * rocblas_layer_mode_log_trace and rocblas_layer_mode_log_bench when sampling
+ * is enabled with rocblas_set_log_sampling or ROCBLAS_LOG_SAMPLE_EVERY and
+ * ROCBLAS_LOG_SAMPLE_MAX_PER_SECOND.
+ *
+ * One call in every sample_every on each thread is kept by a thread-local
+ * counter, and at most max_per_second of those calls per second are logged
+ * on all threads. The rate is counted per second of the steady clock, which
+ * is only read for the calls kept by the counter; a call racing with the
+ * start of the next second may be counted in either second.
+ ******************************************************************************/
+class rocblas_log_sampler
+{
+public:
+    bool sample(uint32_t& calls, uint32_t sample_every, uint32_t max_per_second)
+    {
+        if(sample_every > 1)
+        {
+            if(++calls < sample_every)
+                return false;
+            calls = 0;
+        }
+
+        if(!max_per_second)
+            return true;
+
+        int64_t now = std::chrono::duration_cast<std::chrono::seconds>(
+                          std::chrono::steady_clock::now().time_since_epoch())
+                          .count();
+        int64_t second = m_second.load(std::memory_order_relaxed);
+        if(second != now
+           && m_second.compare_exchange_strong(second, now, std::memory_order_relaxed))
+            m_logged.store(0, std::memory_order_relaxed);
+
+        return m_logged.fetch_add(1, std::memory_order_relaxed) < max_per_second;
+    }
+
+private:
+    std::atomic<int64_t>  m_second{0};
+    std::atomic<uint32_t> m_logged{0};
+};
+
+// Layer mode of a call of the function which contains it, with log_trace, log_bench and roctx
+// cleared unless the call is sampled. Each expansion, and each template instantiation, has its
+// own sampler, so that functions and precisions are sampled independently of each other. With
+// ROCTX, the layer mode also pops the range of the call when it goes out of scope.
+#define ROCBLAS_LOG_SAMPLER_LAYER_MODE(handle)                    \
+    [](rocblas_handle handle_) {                                  \
+        static rocblas_log_sampler   sampler_;                    \
+        static thread_local uint32_t calls_ = 0;                  \
+        return handle_->get_sampled_layer_mode(sampler_, calls_); \
+    }(handle)
+
+#ifdef ROCBLAS_ROCTX
+#define ROCBLAS_SAMPLED_LAYER_MODE(handle) \
+    rocblas_roctx_call(ROCBLAS_LOG_SAMPLER_LAYER_MODE(handle))
+#else
+#define ROCBLAS_SAMPLED_LAYER_MODE(handle) ROCBLAS_LOG_SAMPLER_LAYER_MODE(handle)
+#endif
@@ -23,6 +23,7 @@
 #pragma once
 
 #include "handle.hpp"
+#include "profile_timer.hpp"
 #include "rocblas_ostream.hpp"
 #include "tuple_helper.hpp"
 #include <cmath>
@@ -52,11 +53,19 @@ class argument_profile
     // Mutex for multithreaded access to table
     mutable std::shared_timed_mutex mutex;
 
-    // Table mapping argument tuples into counts
-    // size_t is used for the map target type since atomic types are not movable, and
-    // the map elements will only be moved when we hold an exclusive lock to the map.
+    // Count of the calls with one argument tuple, and their GPU times when profile logging
+    // is enabled with rocblas_layer_mode_log_profile_time
+    // size_t is used for the count since atomic types are not movable, and the map
+    // elements will only be moved when we hold an exclusive lock to the map.
+    struct entry_t
+    {
+        size_t               count;
+        rocblas_profile_time time;
+    };
+
+    // Table mapping argument tuples into counts and times
     std::unordered_map<TUP,
-                       size_t,
+                       entry_t,
                        typename tuple_helper::hash_t<TUP>,
                        typename tuple_helper::equal_t<TUP>>
         map;
@@ -65,7 +74,8 @@ public:
     // A tuple of arguments is looked up in an unordered map.
     // A count of the number of calls with these arguments is kept.
     // arg is assumed to be an rvalue for efficiency
-    void operator()(TUP&& arg)
+    // Returns the times of the calls with these arguments, which stay at the same address
+    rocblas_profile_time* operator()(TUP&& arg)
     {
         { // Acquire a shared lock for reading map
             std::shared_lock<std::shared_timed_mutex> lock(mutex);
@@ -76,8 +86,8 @@ public:
             // If tuple already exists, atomically increment count and return
             if(p != map.end())
             {
-                __atomic_fetch_add(&p->second, 1, __ATOMIC_SEQ_CST);
-                return;
+                __atomic_fetch_add(&p->second.count, 1, __ATOMIC_SEQ_CST);
+                return &p->second.time;
             }
         } // Release shared lock
 
@@ -87,7 +97,9 @@ public:
             // If doesn't already exist, insert tuple by moving arg and initializing count to 0.
             // Increment the count after searching for tuple and returning old or new match.
             // We hold a lock to the map, so we don't have to increment the count atomically.
-            map.emplace(std::move(arg), 0).first->second++;
+            auto& entry = map.emplace(std::move(arg), entry_t{}).first->second;
+            entry.count++;
+            return &entry.time;
         } // Release exclusive lock
     }
 
@@ -111,8 +123,31 @@ public:
         for(const auto& p : map)
         {
             os << "- ";
-            tuple_helper::print_tuple_pairs(
-                os, std::tuple_cat(p.first, std::make_tuple("call_count", p.second)));
+            auto count = std::make_tuple("call_count", p.second.count);
+
+            std::unique_lock<std::mutex> time_lock(rocblas_profile_time::get_mutex());
+            const rocblas_profile_time&  time = p.second.time;
+            if(time.count())
+                tuple_helper::print_tuple_pairs(
+                    os,
+                    std::tuple_cat(p.first,
+                                   count,
+                                   std::make_tuple("gpu_time_count",
+                                                   time.count(),
+                                                   "gpu_time_total_us",
+                                                   time.total(),
+                                                   "gpu_time_min_us",
+                                                   time.min(),
+                                                   "gpu_time_max_us",
+                                                   time.max(),
+                                                   "gpu_time_p50_us",
+                                                   time.percentile(0.5),
+                                                   "gpu_time_p90_us",
+                                                   time.percentile(0.9),
+                                                   "gpu_time_p99_us",
+                                                   time.percentile(0.99))));
+            else
+                tuple_helper::print_tuple_pairs(os, std::tuple_cat(p.first, count));
         }
 
         // Flush out the dump
@@ -134,7 +169,9 @@ public:
 // if profile logging is turned on with
 // (handle->layer_mode & rocblas_layer_mode_log_profile) != 0
 // log_profile will call argument_profile to profile actual arguments,
-// keeping count of the number of times each set of arguments is used
+// keeping count of the number of times each set of arguments is used and the
+// device memory allocated by each function, and with
+// rocblas_layer_mode_log_profile_time the GPU time of the calls
 template <typename... Ts>
 void log_profile(rocblas_handle handle, const char* func, Ts&&... xs)
 {
@@ -149,7 +186,15 @@ void log_profile(rocblas_handle handle, const char* func, Ts&&... xs)
     static int aqe = at_quick_exit([] { profile.~argument_profile(); });
 
     // Profile the tuple
-    profile(std::move(tup));
+    rocblas_profile_time* time = profile(std::move(tup));
+
+    // Attribute the device memory allocations and the kernels selected by the call to func
+    handle->get_device_memory_profile().set_function(func);
+    handle->get_kernel_profile().set_function(func);
+
+    // Time the call on the handle's stream
+    if(handle->layer_mode & rocblas_layer_mode_log_profile_time)
+        handle->start_profile_timer(time);
 }
 
 /********************************************
@@ -168,9 +213,24 @@ void log_arguments(rocblas_internal_ostream& os, const char* sep, H&& head, Ts&&
 // if trace logging is turned on with
 // (handle->layer_mode & rocblas_layer_mode_log_trace) != 0
 // log_function will call log_arguments to log arguments with a comma separator
+// with rocblas_layer_mode_roctx, the trace line also names the ROCTX range of the call
 template <typename... Ts>
 void log_trace(rocblas_handle handle, Ts&&... xs)
 {
+#ifdef ROCBLAS_ROCTX
+    if(handle->layer_mode & rocblas_layer_mode_roctx)
+    {
+        rocblas_internal_ostream os;
+        log_arguments(os, ",", std::forward<Ts>(xs)..., handle->atomics_mode);
+        std::string line = os.str();
+        line.pop_back();
+        rocblas_roctx_call::push(line);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            *handle->log_trace_os << line << std::endl;
+        return;
+    }
+#endif
     log_arguments(*handle->log_trace_os, ",", std::forward<Ts>(xs)..., handle->atomics_mode);
 }
 
@@ -181,6 +241,16 @@ void log_trace(rocblas_handle handle, Ts&&... xs)
 template <typename... Ts>
 void log_bench(rocblas_handle handle, Ts&&... xs)
 {
+    // With ROCBLAS_LOG_BENCH_BINARY_PATH the arguments are stored without formatting
+    if(handle->log_bench_binary)
+    {
+        if(handle->atomics_mode == rocblas_atomics_not_allowed)
+            handle->log_bench_binary->log(xs..., "--atomics_not_allowed");
+        else
+            handle->log_bench_binary->log(xs...);
+        return;
+    }
+
     if(handle->atomics_mode == rocblas_atomics_not_allowed)
         log_arguments(*handle->log_bench_os, " ", std::forward<Ts>(xs)..., "--atomics_not_allowed");
     else
@@ -216,8 +286,14 @@ std::string log_trace_scalar_value(rocblas_handle handle, const T* value)
     T                        host;
     if(value && handle->pointer_mode == rocblas_pointer_mode_device)
     {
-        hipMemcpy(&host, value, sizeof(host), hipMemcpyDeviceToHost);
-        value = &host;
+        // Device scalars cannot be read in graph safe mode, and are logged as NaN
+        if(handle->is_graph_safe())
+            value = nullptr;
+        else
+        {
+            hipMemcpy(&host, value, sizeof(host), hipMemcpyDeviceToHost);
+            value = &host;
+        }
     }
     os << log_trace_scalar_value(value);
     return os.str();
@@ -260,8 +336,14 @@ std::string log_bench_scalar_value(rocblas_handle handle, const char* name, cons
     T host;
     if(value && handle->pointer_mode == rocblas_pointer_mode_device)
     {
-        hipMemcpy(&host, value, sizeof(host), hipMemcpyDeviceToHost);
-        value = &host;
+        // Device scalars cannot be read in graph safe mode, and are logged as NaN
+        if(handle->is_graph_safe())
+            value = nullptr;
+        else
+        {
+            hipMemcpy(&host, value, sizeof(host), hipMemcpyDeviceToHost);
+            value = &host;
+        }
     }
     return log_bench_scalar_value(name, value);
 }
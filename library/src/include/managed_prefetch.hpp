@@ -0,0 +1,107 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include <cstddef>
+#include <cstdint>
+
+/*******************************************************************************
+ * Prefetching of managed memory operands, enabled by rocblas_set_managed_prefetch.
+ * Without it the kernels fault the pages of hipMallocManaged operands in on first
+ * touch, which is much slower than a bulk migration for the sizes of level 3 BLAS.
+ ******************************************************************************/
+
+// Ranges smaller than this are left to on demand migration, whose cost for a few
+// pages is below that of the advice and prefetch calls
+constexpr size_t ROCBLAS_MANAGED_PREFETCH_MIN_BYTES = 64 * 1024;
+
+// When managed prefetch is enabled on handle, and ptr is managed memory, advises that
+// the device of handle accesses [ptr, ptr + bytes) and prefetches it to the device on
+// the stream of handle. Does nothing for other memory, for small ranges, during device
+// memory size queries and while the stream is captured. Errors are cleared and
+// ignored, since the kernels still fault the pages in.
+void rocblas_prefetch_managed(rocblas_handle handle, const void* ptr, size_t bytes);
+
+// Prefetches batch_count column major rows by cols matrices of elements of elem_size
+// bytes, with leading dimension ld and stride elements apart, starting at ptr
+inline void rocblas_prefetch_managed_matrix(rocblas_handle handle,
+                                            const void*    ptr,
+                                            int64_t        rows,
+                                            int64_t        cols,
+                                            int64_t        ld,
+                                            rocblas_stride stride,
+                                            int64_t        batch_count,
+                                            size_t         elem_size)
+{
+    if(!handle->managed_prefetch || !ptr || rows <= 0 || cols <= 0 || batch_count <= 0
+       || stride < 0)
+        return;
+
+    size_t elements = size_t((cols - 1) * ld + rows) + size_t((batch_count - 1) * stride);
+    rocblas_prefetch_managed(handle, ptr, elements * elem_size);
+}
+
+// Prefetches op( A ), op( B ), C and D of a strided batched gemm, D being skipped when it
+// is C. The strides are ignored for a single batch.
+inline void rocblas_prefetch_managed_gemm(rocblas_handle    handle,
+                                          rocblas_operation trans_a,
+                                          rocblas_operation trans_b,
+                                          int64_t           m,
+                                          int64_t           n,
+                                          int64_t           k,
+                                          const void*       a,
+                                          size_t            a_size,
+                                          int64_t           lda,
+                                          rocblas_stride    stride_a,
+                                          const void*       b,
+                                          size_t            b_size,
+                                          int64_t           ldb,
+                                          rocblas_stride    stride_b,
+                                          const void*       c,
+                                          size_t            c_size,
+                                          int64_t           ldc,
+                                          rocblas_stride    stride_c,
+                                          const void*       d,
+                                          size_t            d_size,
+                                          int64_t           ldd,
+                                          rocblas_stride    stride_d,
+                                          int64_t           batch_count)
+{
+    if(!handle->managed_prefetch)
+        return;
+
+    if(batch_count == 1)
+        stride_a = stride_b = stride_c = stride_d = 0;
+
+    bool    a_none = trans_a == rocblas_operation_none;
+    bool    b_none = trans_b == rocblas_operation_none;
+    int64_t a_rows = a_none ? m : k, a_cols = a_none ? k : m;
+    int64_t b_rows = b_none ? k : n, b_cols = b_none ? n : k;
+
+    rocblas_prefetch_managed_matrix(handle, a, a_rows, a_cols, lda, stride_a, batch_count, a_size);
+    rocblas_prefetch_managed_matrix(handle, b, b_rows, b_cols, ldb, stride_b, batch_count, b_size);
+    rocblas_prefetch_managed_matrix(handle, c, m, n, ldc, stride_c, batch_count, c_size);
+    if(d != c)
+        rocblas_prefetch_managed_matrix(handle, d, m, n, ldd, stride_d, batch_count, d_size);
+}
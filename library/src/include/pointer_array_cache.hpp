@@ -0,0 +1,79 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <cstddef>
+#include <hip/hip_runtime.h>
+#include <list>
+
+/*******************************************************************************
+ * rocblas_pointer_array_cache keeps, per handle, the device arrays of pointers
+ * built by rocblas_get_pointer_array, so that batched calls repeated on the
+ * same strided data do not build or upload their pointer arrays again.
+ *
+ * An array is keyed by its base address, its stride in bytes and its number of
+ * pointers. It is written on the device by a kernel on the first request, and
+ * is never written again, so that kernels still reading it are not disturbed. At
+ * most CAPACITY arrays are kept; the least recently used one is freed to make
+ * room, which synchronizes the device as hipFree does.
+ ******************************************************************************/
+class rocblas_pointer_array_cache
+{
+public:
+    // Number of arrays kept per handle
+    static constexpr size_t CAPACITY = 64;
+
+    rocblas_pointer_array_cache() = default;
+
+    ~rocblas_pointer_array_cache()
+    {
+        for(auto& entry : entries)
+            (void)(hipFree)(entry.array);
+    }
+
+    rocblas_pointer_array_cache(const rocblas_pointer_array_cache&) = delete;
+    rocblas_pointer_array_cache& operator=(const rocblas_pointer_array_cache&) = delete;
+
+    // Returns in *array the device array of the batch_count pointers base + i * stride_bytes,
+    // and sets *cached. If it is not cached, an array is allocated for the caller to write,
+    // only if may_allocate; rocblas_status_not_implemented is returned otherwise.
+    rocblas_status get(void*          base,
+                       rocblas_stride stride_bytes,
+                       rocblas_int    batch_count,
+                       bool           may_allocate,
+                       void***        array,
+                       bool*          cached);
+
+private:
+    struct entry_t
+    {
+        void*          base;
+        rocblas_stride stride_bytes;
+        rocblas_int    batch_count;
+        void**         array;
+    };
+
+    // Most recently used first
+    std::list<entry_t> entries;
+};
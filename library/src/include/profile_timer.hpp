@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <hip/hip_runtime.h>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+/*******************************************************************************
+ * rocblas_profile_time accumulates the GPU execution times, in microseconds,
+ * of the calls made with one set of arguments when profile logging is enabled
+ * with rocblas_layer_mode_log_profile_time. Times are counted in a histogram
+ * with BINS_PER_OCTAVE logarithmic bins per power of two, from which
+ * percentiles are estimated to within about 5%.
+ *
+ * Calls from several handles may be timed with the same arguments, so updates
+ * and reads are made under get_mutex().
+ ******************************************************************************/
+class rocblas_profile_time
+{
+public:
+    static constexpr int BINS_PER_OCTAVE = 8;
+    static constexpr int MIN_OCTAVE      = -10; // 2^-10 us, about 1 ns
+    static constexpr int OCTAVES         = 42; // up to 2^32 us, about 70 minutes
+    static constexpr int BINS            = BINS_PER_OCTAVE * OCTAVES;
+
+    static std::mutex& get_mutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    void add(double us);
+
+    size_t count() const
+    {
+        return n;
+    }
+
+    double total() const
+    {
+        return sum;
+    }
+
+    double min() const
+    {
+        return n ? lo : 0;
+    }
+
+    double max() const
+    {
+        return hi;
+    }
+
+    // Estimate the time below which a fraction p of the calls ran
+    double percentile(double p) const;
+
+private:
+    size_t   n   = 0;
+    double   sum = 0;
+    double   lo  = std::numeric_limits<double>::infinity();
+    double   hi  = 0;
+    uint64_t bins[BINS]{};
+};
+
+/*******************************************************************************
+ * rocblas_profile_timer times the calls profiled on a handle with pairs of
+ * pooled hipEvents recorded on the handle's stream.
+ *
+ * The end of a call is not visible to the logging layer, which runs before the
+ * call enqueues its work, so a call is timed until the next profiled call on
+ * the handle starts, or until stop() is called when the handle's stream
+ * changes or the handle is destroyed. Completed events are collected without
+ * blocking when the next call starts; only flush() and a backlog of
+ * MAX_PENDING calls wait for the stream.
+ ******************************************************************************/
+class rocblas_profile_timer
+{
+public:
+    // Maximum number of timed calls waiting for their events to complete
+    static constexpr size_t MAX_PENDING = 4096;
+
+    rocblas_profile_timer() = default;
+
+    // Callers must make sure no calls are being timed, e.g. by calling flush()
+    ~rocblas_profile_timer();
+
+    rocblas_profile_timer(const rocblas_profile_timer&) = delete;
+    rocblas_profile_timer& operator=(const rocblas_profile_timer&) = delete;
+
+    // End the call being timed, and start timing a call on stream which is
+    // accumulated into *time. time must remain valid until the call is collected.
+    void start(rocblas_profile_time* time, hipStream_t stream);
+
+    // End the call being timed on stream
+    void stop(hipStream_t stream);
+
+    // End the call being timed, then wait for and accumulate all timed calls
+    void flush(hipStream_t stream);
+
+    // Number of timed calls which have not been accumulated yet
+    size_t get_pending() const
+    {
+        return pending.size() + (current.time != nullptr);
+    }
+
+private:
+    struct entry_t
+    {
+        rocblas_profile_time* time;
+        hipEvent_t            start;
+        hipEvent_t            stop;
+    };
+
+    hipEvent_t get_event();
+    void       collect(bool wait);
+
+    entry_t                 current{};
+    std::deque<entry_t>     pending;
+    std::vector<hipEvent_t> free_events;
+};
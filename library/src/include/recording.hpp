@@ -0,0 +1,64 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include <cstddef>
+#include <hip/hip_runtime.h>
+
+/*******************************************************************************
+ * _rocblas_recording is a sequence of rocBLAS calls captured into a HIP graph
+ * between rocblas_begin_recording and rocblas_end_recording, and instantiated
+ * for replay with rocblas_launch_recording.
+ *
+ * Workspace is hoisted out of the graph: while recording, the handle takes its
+ * workspace from a buffer owned by the recording, allocated before the capture
+ * begins, so the graph contains no allocations and every replay reuses the
+ * same memory. The handle's own workspace, and its stream if the handle was on
+ * the null stream, which cannot be captured, are restored when recording ends.
+ *
+ * Re-recording into an existing recording updates its executable graph in
+ * place with hipGraphExecUpdate when the calls have the same structure, which
+ * is much cheaper than instantiating a new graph.
+ ******************************************************************************/
+struct _rocblas_recording
+{
+    _rocblas_recording() = default;
+    _rocblas_recording(const _rocblas_recording&) = delete;
+    _rocblas_recording& operator=(const _rocblas_recording&) = delete;
+    ~_rocblas_recording();
+
+    hipGraphExec_t exec = nullptr;
+
+    // Workspace of the recorded calls
+    void*  workspace      = nullptr;
+    size_t workspace_size = 0;
+
+    // State of the handle while recording: the stream created for the capture if the
+    // handle was on the null stream, and the handle's stream and workspace to restore
+    hipStream_t                     capture_stream = nullptr;
+    hipStream_t                     saved_stream   = nullptr;
+    void*                           saved_device_memory      = nullptr;
+    size_t                          saved_device_memory_size = 0;
+    rocblas_device_memory_ownership saved_device_memory_owner;
+};
@@ -34,6 +34,17 @@
 //
 // rocblas_internal_trsm_template_mem(..., mem, ...)
 //
+// A whole algorithm can run in one block of device memory allocated up front with
+// workspace scopes, whose reserved regions live across the rocBLAS calls made in them:
+//
+// rocblas_workspace_scope scope(handle, panel_size, trsm_size);
+//
+// if(!scope) return scope.status();
+//
+// double* panel = static_cast<double*>(scope);
+//
+// rocblas_dtrsm(handle, ...); // takes trsm_size bytes after the panel
+//
 // This header should be included in other projects to use the rocblas_handle
 // C++ device memory allocation API. It is unlikely to change very often.
 
@@ -146,6 +157,54 @@ public:
 };
 // clang-format on
 
+// Workspace scope in a RAII class, see rocblas_push_workspace_scope
+class [[nodiscard]] rocblas_workspace_scope
+{
+    rocblas_handle handle;
+    void*          reserved;
+    rocblas_status push_status;
+
+public:
+    explicit rocblas_workspace_scope(rocblas_handle handle,
+                                     size_t         reserved_size,
+                                     size_t         nested_size = 0)
+        : handle(handle)
+        , reserved(nullptr)
+        , push_status(
+              rocblas_push_workspace_scope(handle, reserved_size, nested_size, &reserved))
+    {
+    }
+
+    // Conversion to a pointer type, to get the address of the reserved region
+    template <typename T>
+    explicit operator T*() &
+    {
+        return static_cast<T*>(reserved);
+    }
+
+    // Conversion to bool indicates whether the scope was opened
+    explicit operator bool() const
+    {
+        return push_status == rocblas_status_success;
+    }
+
+    rocblas_status status() const
+    {
+        return push_status;
+    }
+
+    // Destructor closes the scope
+    ~rocblas_workspace_scope()
+    {
+        if(push_status == rocblas_status_success)
+            rocblas_pop_workspace_scope(handle);
+    }
+
+    // Copying and assigning to rocblas_workspace_scope are deleted
+    rocblas_workspace_scope(const rocblas_workspace_scope&) = delete;
+    rocblas_workspace_scope& operator=(const rocblas_workspace_scope&) = delete;
+};
+
 // Set optimal device memory size in handle
 template <
     typename... Ss,
@@ -24,6 +24,7 @@
 
 #include "rocblas.h"
 #include "utility.hpp"
+#include <atomic>
 #include <cmath>
 #include <complex>
 #include <condition_variable>
@@ -36,12 +37,12 @@
 #include <memory>
 #include <mutex>
 #include <ostream>
-#include <queue>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
 #include <thread>
 #include <utility>
+#include <vector>
 #ifdef WIN32
 #include <io.h>
 #include <iostream>
@@ -76,66 +77,88 @@ class ROCBLAS_INTERNAL_EXPORT rocblas_internal_ostream
     /**************************************************************************
      * The worker class sets up a worker thread for writing to log files. Two *
      * files are considered the same if they have the same device ID / inode. *
+     *                                                                        *
+     * Each stream sends its strings through its own single producer, single  *
+     * consumer ring, which the worker thread drains without locking, writing *
+     * the strings collected from all rings with one write. Each string is    *
+     * written whole, so lines flushed by different threads never interleave. *
      **************************************************************************/
     class worker
     {
-        // task_t represents a payload of data and a promise to finish
-        class task_t
+    public:
+        // Ring of the strings sent by one stream, written by the stream's thread and read
+        // by the worker thread
+        class ring_t
         {
-            std::string        m_str;
-            std::promise<void> m_promise;
-
-        public:
-            // The task takes ownership of the string payload and promise
-            task_t(std::string&& str, std::promise<void>&& promise)
-                : m_str(std::move(str))
-                , m_promise(std::move(promise))
-            {
-            }
+            friend class worker;
 
-            // Notify the future to wake up
-            void set_value()
-            {
-                m_promise.set_value();
-            }
+            static constexpr size_t CAPACITY = 64;
 
-            // Size of the string payload
-            size_t size() const
-            {
-                return m_str.size();
-            }
+            std::string m_slots[CAPACITY];
 
-            // Data of the string payload
-            const char* data() const
-            {
-                return m_str.data();
-            }
+            // Number of strings sent, read, and written to the file by the worker
+            std::atomic<size_t> m_head{0};
+            std::atomic<size_t> m_tail{0};
+            std::atomic<size_t> m_written{0};
+
+            // Threads wait on m_cond when the ring is full or for its strings to be written
+            std::atomic<int>        m_waiters{0};
+            std::mutex              m_mutex;
+            std::condition_variable m_cond;
         };
 
+    private:
         // FILE is used for safety in the presence of signals
         FILE* m_file = nullptr;
 
         // This worker's thread
         std::thread m_thread;
 
-        // Condition variable for worker notification
-        std::condition_variable m_cond;
+        // Rings of the streams writing to the file; only locked when a stream opens or closes
+        // its ring, or when the worker thread moves the new strings out of the rings
+        std::mutex                           m_rings_mutex;
+        std::vector<std::shared_ptr<ring_t>> m_rings;
 
-        // Mutex for this thread's queue
-        std::mutex m_mutex;
+        // The worker thread waits on m_cond when all rings are empty
+        std::atomic<bool>       m_sleeping{false};
+        bool                    m_notified = false;
+        bool                    m_exit     = false;
+        std::mutex              m_mutex;
+        std::condition_variable m_cond;
 
-        // Queue of tasks
-        std::queue<task_t> m_queue;
+        // Set by the worker thread when it exits
+        std::promise<void> m_exited;
 
-        // Worker thread which waits for and handles tasks sequentially
+        // Worker thread which writes the strings of the rings in batches
         void thread_function();
 
+        // Move the unread strings of the rings into batch, returning their number, and add the
+        // rings read with their new tail to read
+        size_t collect(std::string&                                             batch,
+                       std::vector<std::pair<std::shared_ptr<ring_t>, size_t>>& read);
+
+        // Whether all rings are empty
+        bool empty();
+
+        // Wait on ring until done() is true
+        template <typename F>
+        static void wait(ring_t& ring, F done);
+
     public:
         // Worker constructor creates a worker thread for a raw filehandle
         explicit worker(int fd);
 
-        // Send a string to be written
-        void send(std::string);
+        // Send a non-empty string to be written, through ring, which is opened if it is null
+        void send(std::shared_ptr<ring_t>& ring, std::string str);
+
+        // Wait for the strings sent through ring to be written
+        void wait_written(ring_t& ring);
+
+        // Wait for the strings sent through ring to be written, and close it
+        void close(std::shared_ptr<ring_t>& ring);
+
+        // Wait for the strings sent through all rings to be written
+        void wait_all_written();
 
         // Destroy a worker when all std::shared_ptr references to it are gone
         ~worker();
@@ -181,6 +204,12 @@ class ROCBLAS_INTERNAL_EXPORT rocblas_internal_ostream
     // Worker thread for accepting tasks
     std::shared_ptr<worker> m_worker_ptr;
 
+    // Ring through which the output is sent to the worker, opened with the first flush
+    std::shared_ptr<worker::ring_t> m_ring;
+
+    // Flag indicating whether a flush waits for the output to be written
+    bool m_sync = false;
+
     // Flag indicating whether YAML mode is turned on
     bool m_yaml = false;
 
@@ -193,6 +222,7 @@ class ROCBLAS_INTERNAL_EXPORT rocblas_internal_ostream
     // Private explicit copy constructor duplicates the worker and starts a new buffer
     explicit rocblas_internal_ostream(const rocblas_internal_ostream& other)
         : m_worker_ptr(other.m_worker_ptr)
+        , m_sync(other.m_sync)
     {
     }
 
@@ -204,13 +234,14 @@ public:
     rocblas_internal_ostream(rocblas_internal_ostream&&) = default;
 
     // Move assignment
-    rocblas_internal_ostream& operator=(rocblas_internal_ostream&&) & = default;
+    rocblas_internal_ostream& operator=(rocblas_internal_ostream&&) &;
 
     // Copy assignment is deleted
     rocblas_internal_ostream& operator=(const rocblas_internal_ostream&) = delete;
 
-    // Construct from a file descriptor, which is duped
-    explicit rocblas_internal_ostream(int fd);
+    // Construct from a file descriptor, which is duped. With sync, each flush waits for the
+    // output to be written; otherwise the output is written by the time the stream is destroyed
+    explicit rocblas_internal_ostream(int fd, bool sync = false);
 
     // Construct from a C filename
     explicit rocblas_internal_ostream(const char* filename);
@@ -261,14 +292,14 @@ public:
     // Implemented as singleton to avoid the static initialization order fiasco
     static rocblas_internal_ostream& cout()
     {
-        thread_local rocblas_internal_ostream t_cout{STDOUT_FILENO};
+        thread_local rocblas_internal_ostream t_cout{STDOUT_FILENO, true};
         return t_cout;
     }
 
     // Implemented as singleton to avoid the static initialization order fiasco
     static rocblas_internal_ostream& cerr()
     {
-        thread_local rocblas_internal_ostream t_cerr{STDERR_FILENO};
+        thread_local rocblas_internal_ostream t_cerr{STDERR_FILENO, true};
         return t_cerr;
     }
 
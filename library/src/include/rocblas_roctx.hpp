@@ -0,0 +1,107 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#ifdef ROCBLAS_ROCTX
+
+#include "rocblas.h"
+#include <roctracer/roctx.h>
+#include <string>
+
+/*******************************************************************************
+ * rocblas_roctx_call is the layer mode of a rocBLAS function call in builds
+ * with ROCTX ranges. log_trace pushes a range named by the trace line of the
+ * call, with rocblas_layer_mode_roctx, and the range is popped when the
+ * rocblas_roctx_call of the call goes out of scope at the end of the function,
+ * so that the kernels it launches are nested in it by rocprof and omnitrace.
+ *
+ * Ranges are counted per thread, so that a call only pops the ranges pushed
+ * since it started, also when it returns early or throws. Ranges are only
+ * pushed within a call, so that the trace lines logged by the functions which
+ * do not time their calls, such as the auxiliary functions, are not left open.
+ ******************************************************************************/
+class rocblas_roctx_call
+{
+    rocblas_layer_mode m_layer_mode;
+    int                m_depth;
+
+    // Ranges pushed and calls in progress on this thread
+    static int& depth()
+    {
+        thread_local int t_depth = 0;
+        return t_depth;
+    }
+
+    static int& calls()
+    {
+        thread_local int t_calls = 0;
+        return t_calls;
+    }
+
+public:
+    explicit rocblas_roctx_call(rocblas_layer_mode layer_mode)
+        : m_layer_mode(layer_mode)
+        , m_depth(depth())
+    {
+        ++calls();
+    }
+
+    rocblas_roctx_call(const rocblas_roctx_call&) = delete;
+    rocblas_roctx_call& operator=(const rocblas_roctx_call&) = delete;
+
+    ~rocblas_roctx_call()
+    {
+        for(; depth() > m_depth; --depth())
+            roctxRangePop();
+        --calls();
+    }
+
+    operator rocblas_layer_mode() const
+    {
+        return m_layer_mode;
+    }
+
+    friend int operator&(const rocblas_roctx_call& call, int mask)
+    {
+        return call.m_layer_mode & mask;
+    }
+
+    // Push the range of the current call
+    static void push(const std::string& message)
+    {
+        if(calls())
+        {
+            roctxRangePushA(message.c_str());
+            ++depth();
+        }
+    }
+
+    // Mark an event, such as the kernel selected, in the range of the current call
+    static void mark(const std::string& message)
+    {
+        if(depth())
+            roctxMarkA(message.c_str());
+    }
+};
+
+#endif
@@ -0,0 +1,332 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*******************************************************************************
+ * rocblas_solution_cache remembers which Tensile solution was selected for a
+ * GEMM problem descriptor, so that repeated calls with the same shape skip
+ * solution selection. It does not reference any Tensile identifiers: solutions
+ * are stored as opaque pointers, owned by the Tensile library, which outlives
+ * every handle.
+ *
+ * The cache is a bounded, direct-mapped table with a short linear probe.
+ * Lookups are lock-free: each slot is protected by a sequence counter
+ * (seqlock), and a reader retries or misses if a writer modified the slot
+ * while it was being read. Insertions, evictions and resizing take a mutex.
+ * A table replaced by resizing is retired, and freed once no lookup is in
+ * progress, since a lookup which started before the resize may still read it.
+ ******************************************************************************/
+class rocblas_solution_cache
+{
+public:
+    // Number of 64-bit words in a problem key
+    static constexpr size_t KEY_WORDS = 28;
+
+    using key_t = std::array<uint64_t, KEY_WORDS>;
+
+    // Default number of entries, overridden by ROCBLAS_SOLUTION_CACHE_SIZE
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    // Maximum number of slots probed per lookup or insertion
+    static constexpr size_t MAX_PROBE = 4;
+
+    explicit rocblas_solution_cache(size_t capacity = DEFAULT_CAPACITY)
+        : requested_capacity(capacity)
+    {
+    }
+
+    ~rocblas_solution_cache()
+    {
+        delete table.load(std::memory_order_relaxed);
+    }
+
+    rocblas_solution_cache(const rocblas_solution_cache&) = delete;
+    rocblas_solution_cache& operator=(const rocblas_solution_cache&) = delete;
+
+    // Hash a key (FNV-1a over 64-bit words, followed by a final mix)
+    static uint64_t hash(const key_t& key)
+    {
+        uint64_t h = 0xcbf29ce484222325ull;
+        for(auto w : key)
+        {
+            h ^= w;
+            h *= 0x100000001b3ull;
+        }
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    // Look up a key. Returns true and fills solution and workspace_size on a hit.
+    // Entries whose workspace requirement exceeds max_workspace_size do not match.
+    bool find(const key_t& key,
+              uint64_t     h,
+              size_t       max_workspace_size,
+              const void*& solution,
+              size_t&      workspace_size)
+    {
+        reader_guard guard(readers);
+        table_t*     t = table.load(std::memory_order_seq_cst);
+        if(t)
+        {
+            for(size_t p = 0; p < MAX_PROBE && p < t->slots.size(); ++p)
+            {
+                slot_t&  s   = t->slots[(h + p) & t->mask];
+                uint32_t seq = s.seq.load(std::memory_order_acquire);
+                if(seq & 1)
+                    continue; // writer in progress; treat as a miss for this slot
+
+                const void* sol = s.solution.load(std::memory_order_relaxed);
+                if(!sol || s.hash.load(std::memory_order_relaxed) != h)
+                    continue;
+
+                bool match = true;
+                for(size_t i = 0; i < KEY_WORDS && match; ++i)
+                    match = s.key[i].load(std::memory_order_relaxed) == key[i];
+                size_t ws = s.workspace_size.load(std::memory_order_relaxed);
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if(match && ws <= max_workspace_size
+                   && s.seq.load(std::memory_order_relaxed) == seq)
+                {
+                    solution       = sol;
+                    workspace_size = ws;
+                    hits.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+        }
+        misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Insert a key, evicting the entry at its home slot if the probe sequence is full
+    void insert(const key_t& key, uint64_t h, const void* solution, size_t workspace_size)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        reclaim_retired_locked();
+
+        table_t* t = table.load(std::memory_order_relaxed);
+        if(!t)
+        {
+            if(!requested_capacity)
+                return;
+            t = new table_t(requested_capacity);
+            table.store(t, std::memory_order_release);
+        }
+
+        slot_t* target = nullptr;
+        for(size_t p = 0; p < MAX_PROBE && p < t->slots.size(); ++p)
+        {
+            slot_t& s = t->slots[(h + p) & t->mask];
+            if(!s.solution.load(std::memory_order_relaxed))
+            {
+                target = &s;
+                break;
+            }
+            if(s.hash.load(std::memory_order_relaxed) == h)
+            {
+                bool match = true;
+                for(size_t i = 0; i < KEY_WORDS && match; ++i)
+                    match = s.key[i].load(std::memory_order_relaxed) == key[i];
+                if(match)
+                {
+                    target = &s;
+                    break;
+                }
+            }
+        }
+
+        if(!target)
+        {
+            target = &t->slots[h & t->mask];
+            evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if(!target->solution.load(std::memory_order_relaxed))
+        {
+            entries.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        write_slot(*target, &key, h, solution, workspace_size);
+    }
+
+    // Remove all entries. Statistics are preserved.
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        clear_locked();
+        reclaim_retired_locked();
+    }
+
+    // Change the maximum number of entries. A capacity of 0 disables the cache.
+    // The table is reallocated on the next insertion.
+    void set_capacity(size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        requested_capacity = capacity;
+
+        // Retire the old table rather than freeing it, so that concurrent
+        // lock-free readers never dereference freed memory.
+        table_t* t = table.exchange(nullptr, std::memory_order_seq_cst);
+        if(t)
+            retired.emplace_back(t);
+        entries.store(0, std::memory_order_relaxed);
+        reclaim_retired_locked();
+    }
+
+    size_t get_capacity() const
+    {
+        return requested_capacity.load(std::memory_order_relaxed);
+    }
+
+    size_t get_entries() const
+    {
+        return entries.load(std::memory_order_relaxed);
+    }
+
+    size_t get_hits() const
+    {
+        return hits.load(std::memory_order_relaxed);
+    }
+
+    size_t get_misses() const
+    {
+        return misses.load(std::memory_order_relaxed);
+    }
+
+    size_t get_evictions() const
+    {
+        return evictions.load(std::memory_order_relaxed);
+    }
+
+    void reset_statistics()
+    {
+        hits.store(0, std::memory_order_relaxed);
+        misses.store(0, std::memory_order_relaxed);
+        evictions.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    struct slot_t
+    {
+        std::atomic<uint32_t>    seq{0};
+        std::atomic<uint64_t>    hash{0};
+        std::atomic<const void*> solution{nullptr};
+        std::atomic<size_t>      workspace_size{0};
+        std::atomic<uint64_t>    key[KEY_WORDS] = {};
+    };
+
+    struct table_t
+    {
+        std::vector<slot_t> slots;
+        size_t              mask;
+
+        // Capacity is rounded up to a power of 2
+        explicit table_t(size_t capacity)
+            : slots(round_up_pow2(capacity))
+            , mask(slots.size() - 1)
+        {
+        }
+
+        static size_t round_up_pow2(size_t n)
+        {
+            size_t p = 1;
+            while(p < n)
+                p <<= 1;
+            return p;
+        }
+    };
+
+    // Seqlock write of a slot; callers must hold the mutex
+    static void write_slot(
+        slot_t& s, const key_t* key, uint64_t h, const void* solution, size_t workspace_size)
+    {
+        uint32_t seq = s.seq.load(std::memory_order_relaxed);
+        s.seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        s.hash.store(h, std::memory_order_relaxed);
+        s.solution.store(solution, std::memory_order_relaxed);
+        s.workspace_size.store(workspace_size, std::memory_order_relaxed);
+        for(size_t i = 0; i < KEY_WORDS; ++i)
+            s.key[i].store(key ? (*key)[i] : 0, std::memory_order_relaxed);
+
+        s.seq.store(seq + 2, std::memory_order_release);
+    }
+
+    // Counts a lookup in progress for the duration of its scope
+    struct reader_guard
+    {
+        std::atomic<size_t>& readers;
+
+        explicit reader_guard(std::atomic<size_t>& readers)
+            : readers(readers)
+        {
+            readers.fetch_add(1, std::memory_order_seq_cst);
+        }
+
+        ~reader_guard()
+        {
+            readers.fetch_sub(1, std::memory_order_release);
+        }
+    };
+
+    // Free the retired tables if no lookup is in progress; callers must hold the mutex.
+    // A lookup counted after the check loads the table after it was replaced, so it
+    // cannot read a retired table.
+    void reclaim_retired_locked()
+    {
+        if(!retired.empty() && !readers.load(std::memory_order_seq_cst))
+            retired.clear();
+    }
+
+    void clear_locked()
+    {
+        table_t* t = table.load(std::memory_order_relaxed);
+        if(t)
+            for(auto& s : t->slots)
+                if(s.solution.load(std::memory_order_relaxed))
+                    write_slot(s, nullptr, 0, nullptr, 0);
+        entries.store(0, std::memory_order_relaxed);
+    }
+
+    std::atomic<table_t*>                 table{nullptr};
+    std::vector<std::unique_ptr<table_t>> retired;
+    std::atomic<size_t>                   readers{0};
+    std::mutex                            mutex;
+    std::atomic<size_t>                   requested_capacity;
+
+    std::atomic<size_t> entries{0};
+    std::atomic<size_t> hits{0};
+    std::atomic<size_t> misses{0};
+    std::atomic<size_t> evictions{0};
+};
@@ -0,0 +1,87 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+/*******************************************************************************
+ * rocblas_tensile_host_profile counts the GEMM problems a handle runs with
+ * Tensile, and with timing enabled accumulates the host time spent in each
+ * stage of runContractionProblem: the construction of the Tensile problem,
+ * the solution lookup and selection, the packing of the kernel arguments by
+ * the solution, and the kernel launches.
+ *
+ * A stage is timed from the time point returned by start() or by the end of
+ * the previous stage; without timing the time points are not read. Like the
+ * rest of the handle, the profile is not updated concurrently.
+ ******************************************************************************/
+class rocblas_tensile_host_profile
+{
+public:
+    using clock      = std::chrono::steady_clock;
+    using time_point = clock::time_point;
+
+    enum stage_t : int
+    {
+        construct,
+        select,
+        solve,
+        launch,
+        NUM_STAGES
+    };
+
+    // Whether the stages are timed, in addition to rocblas_layer_mode_log_profile
+    bool timing = false;
+
+    size_t calls      = 0; // problems run with Tensile
+    size_t selections = 0; // solution selections by Tensile, which missed the solution caches
+    size_t launches   = 0; // problems whose kernels were launched
+
+    double stage_us[NUM_STAGES]{};
+
+    // Start timing the first stage of a problem
+    time_point start(bool enabled)
+    {
+        calls++;
+        return enabled ? clock::now() : time_point{};
+    }
+
+    // End the stage started at t, returning the start of the next stage
+    time_point stop(stage_t stage, time_point t)
+    {
+        if(t == time_point{})
+            return t;
+        time_point now = clock::now();
+        stage_us[stage] += std::chrono::duration<double, std::micro>(now - t).count();
+        return now;
+    }
+
+    void reset()
+    {
+        calls      = 0;
+        selections = 0;
+        launches   = 0;
+        for(auto& us : stage_us)
+            us = 0;
+    }
+};
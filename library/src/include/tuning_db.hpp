@@ -0,0 +1,141 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+
+/*******************************************************************************
+ * rocblas_tuning_db is a process-wide table of tuned GEMM solution indices,
+ * keyed by GPU architecture name (as returned by rocblas_internal_get_arch_name)
+ * and a problem key built by TuningDBKey in tensile_host.cpp. The problem key is
+ * independent of the rocblas_solution_cache key, which also holds handle and
+ * device state, so that the on-disk format only changes with VERSION.
+ *
+ * Each entry may also carry a tuned workgroup mapping, which is applied as the
+ * default of rocblas_set_gemm_workgroup_mapping for the problem.
+ *
+ * The on-disk database is a sorted array of fixed-size records which is memory
+ * mapped read-only and binary searched, so loading a large database costs no
+ * parsing. Entries recorded at run time (see rocblas_set_tuning_db_record) are
+ * kept in an in-memory overlay which takes precedence over the mapped file, and
+ * are merged into it by rocblas_save_tuning_db.
+ *
+ * The database named by the environment variable ROCBLAS_TUNING_DB is loaded
+ * the first time the database is used.
+ ******************************************************************************/
+class rocblas_tuning_db
+{
+public:
+    // Number of 64-bit words in a problem key
+    static constexpr size_t KEY_WORDS = 27;
+
+    using key_t = std::array<uint64_t, KEY_WORDS>;
+
+    // VERSION must be incremented whenever the layout of the problem key or of the
+    // file changes, so that databases written before the change are rejected by load
+    static constexpr uint32_t VERSION        = 2;
+    static constexpr size_t   ARCH_NAME_SIZE = 32;
+    static constexpr char     MAGIC[8]       = {'R', 'B', 'T', 'U', 'N', 'E', 'D', 'B'};
+
+    struct file_header
+    {
+        char     magic[8];
+        uint32_t version;
+        uint32_t key_words;
+        uint64_t count;
+    };
+
+    struct file_entry
+    {
+        char     arch[ARCH_NAME_SIZE];
+        uint64_t key[KEY_WORDS];
+        int32_t  solution_index;
+        int32_t  workgroup_mapping;
+    };
+
+    static rocblas_tuning_db& instance();
+
+    // Map a database file; a null path unmaps the current file
+    rocblas_status load(const char* path);
+
+    // Write the mapped entries merged with the overlay to path, sorted
+    rocblas_status save(const char* path);
+
+    // Returns the tuned solution index (as used with rocblas_gemm_algo_solution_index),
+    // or 0 if the problem is not in the database or has no tuned solution. The tuned
+    // workgroup mapping of the problem, or 0, is returned in workgroup_mapping if not null.
+    int32_t find(const char* arch, const key_t& key, int32_t* workgroup_mapping = nullptr) const;
+
+    // Record a tuned solution index and workgroup mapping in the overlay
+    void record(const char*  arch,
+                const key_t& key,
+                int32_t      solution_index,
+                int32_t      workgroup_mapping = 0);
+
+    // Discard the overlay
+    void clear_recorded();
+
+    // Cheap check used on the GEMM path before computing a key
+    bool empty() const
+    {
+        return !num_entries.load(std::memory_order_acquire);
+    }
+
+    // Incremented whenever the contents change, so that handles can invalidate
+    // solutions cached before the change
+    uint64_t get_generation() const
+    {
+        return generation.load(std::memory_order_acquire);
+    }
+
+    ~rocblas_tuning_db();
+
+private:
+    rocblas_tuning_db();
+
+    rocblas_tuning_db(const rocblas_tuning_db&) = delete;
+    rocblas_tuning_db& operator=(const rocblas_tuning_db&) = delete;
+
+    using overlay_key_t = std::pair<std::string, key_t>;
+
+    void unmap();
+    void update_num_entries();
+
+    static int compare(const file_entry& entry, const char* arch, const key_t& key);
+
+    mutable std::shared_mutex                            mutex;
+    const file_entry*                                    mapped_entries = nullptr;
+    size_t                                               mapped_count   = 0;
+    void*                                                mapped_base    = nullptr;
+    size_t                                               mapped_size    = 0;
+    std::map<overlay_key_t, std::pair<int32_t, int32_t>> overlay;
+    std::atomic<size_t>                                  num_entries{0};
+    std::atomic<uint64_t>                                generation{0};
+};
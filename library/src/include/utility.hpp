@@ -182,24 +182,33 @@ __forceinline__ __device__ __host__ T*
 }
 // clang-format on
 
-// Helper for batched functions with temporary memory, currently just trsm and trsv.
-// Copys addresses to array of pointers for batched versions.
+// Helper for batched functions with temporary memory, currently trsm, trsv and trtri.
+// Copys addresses to array of pointers for batched versions, one thread per pointer.
 template <rocblas_int NB, typename T>
 ROCBLAS_KERNEL(NB)
-setup_batched_array_kernel(T* src, rocblas_stride src_stride, T* dst[])
+setup_batched_array_kernel(T* src, rocblas_stride src_stride, T* dst[], rocblas_int batch_count)
 {
-    dst[blockIdx.x] = src + blockIdx.x * src_stride;
+    rocblas_int batch = blockIdx.x * NB + threadIdx.x;
+    if(batch < batch_count)
+        dst[batch] = src + batch * src_stride;
 }
 
 template <rocblas_int BLOCK, typename T>
 void setup_batched_array(
     hipStream_t stream, T* src, rocblas_stride src_stride, T* dst[], rocblas_int batch_count)
 {
-    dim3 grid(batch_count);
+    dim3 grid((batch_count - 1) / BLOCK + 1);
     dim3 threads(BLOCK);
 
-    hipLaunchKernelGGL(
-        (setup_batched_array_kernel<BLOCK, T>), grid, threads, 0, stream, src, src_stride, dst);
+    hipLaunchKernelGGL((setup_batched_array_kernel<BLOCK, T>),
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       src,
+                       src_stride,
+                       dst,
+                       batch_count);
 }
 
 template <rocblas_int NB, typename T>
@@ -308,6 +317,8 @@ constexpr const char* rocblas_datatype_string(rocblas_datatype type)
     case rocblas_datatype_u32_c:   return "u32_c";
     case rocblas_datatype_bf16_r:  return "bf16_r";
     case rocblas_datatype_bf16_c:  return "bf16_c";
+    case rocblas_datatype_f8_r:    return "f8_r";
+    case rocblas_datatype_bf8_r:   return "bf8_r";
     case rocblas_datatype_invalid: return "invalid";
     }
     return "invalid";
@@ -334,6 +345,8 @@ constexpr size_t rocblas_sizeof_datatype(rocblas_datatype type)
     case rocblas_datatype_u32_c:   return 8;
     case rocblas_datatype_bf16_r:  return 2;
     case rocblas_datatype_bf16_c:  return 4;
+    case rocblas_datatype_f8_r:    return 1;
+    case rocblas_datatype_bf8_r:   return 1;
     case rocblas_datatype_invalid: return 4;
     }
     return 0;
@@ -677,6 +690,28 @@ struct rocblas_real_t_impl<std::complex<T>>
 template <typename T>
 using real_t = typename rocblas_real_t_impl<T>::type;
 
+// Load *p with a nontemporal load if nontemporal is true, so that a streamed operand does not
+// evict the data marked as persisting on the handle from the caches. Types other than real and
+// complex float and double are always loaded normally.
+template <typename T>
+__forceinline__ __device__ T load_nontemporal_if(bool nontemporal, const T* p)
+{
+    if constexpr(std::is_same<real_t<T>, float>{} || std::is_same<real_t<T>, double>{})
+    {
+        if(nontemporal)
+        {
+            if constexpr(rocblas_is_complex<T>)
+            {
+                auto r = (const real_t<T>*)p;
+                return T(__builtin_nontemporal_load(r), __builtin_nontemporal_load(r + 1));
+            }
+            else
+                return __builtin_nontemporal_load(p);
+        }
+    }
+    return *p;
+}
+
 // Get array2 types from base type
 template <typename T, typename = void>
 struct rocblas_array2_t_impl
@@ -761,6 +796,19 @@ constexpr double value_category(const T& beta)
 // We assume true if the value is greater than or equal to 906
 bool rocblas_internal_tensile_supports_ldc_ne_ldd(rocblas_handle handle);
 
+// Internal use, whether the count device arrays of batch_count pointers are arithmetic
+// progressions with strides of whole elements of elem_sizes[j] bytes, so that a batched
+// function can run its strided batched implementation on bases[j] with strides[j]. Only
+// checked when batched stride detection is enabled on the handle and it is not graph safe,
+// since the result is read on the host. A null array has a null base and a stride of 0.
+bool rocblas_internal_detect_pointer_array_strides(rocblas_handle     handle,
+                                                   rocblas_int        batch_count,
+                                                   int                count,
+                                                   const void* const* arrays,
+                                                   const size_t*      elem_sizes,
+                                                   void**             bases,
+                                                   rocblas_stride*    strides);
+
 // for internal use during testing, fetch arch name
 ROCBLAS_INTERNAL_EXPORT std::string rocblas_internal_get_arch_name();
 
@@ -0,0 +1,95 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <atomic>
+#include <cstddef>
+#include <hip/hip_runtime.h>
+
+/*******************************************************************************
+ * _rocblas_workspace_pool is a device memory pool shared by the handles of a
+ * device attached to it with rocblas_set_workspace_pool, which make their
+ * stream-ordered workspace allocations from it instead of from their own pools.
+ *
+ * The pool keeps max_size bytes allocated from the device. HIP reuses memory
+ * freed on one stream for an allocation on another stream once the free has
+ * completed, or when the allocating stream depends on the free through an
+ * event, so the workspaces of all handles are served by the same memory. The
+ * allocations held at once are limited to max_size bytes; an allocation above
+ * it fails as with a fixed size workspace. Memory whose free has not completed
+ * yet may briefly be held in addition to max_size.
+ *
+ * The pool is reference counted by the user's reference and by each attached
+ * handle, and is destroyed by the last release; HIP defers the destruction of
+ * the underlying hipMemPool_t until the outstanding frees have completed.
+ ******************************************************************************/
+struct _rocblas_workspace_pool
+{
+    // Create a pool on device of max_size bytes, which are reserved on stream
+    _rocblas_workspace_pool(int device, size_t max_size, hipStream_t stream);
+
+    _rocblas_workspace_pool(const _rocblas_workspace_pool&) = delete;
+    _rocblas_workspace_pool& operator=(const _rocblas_workspace_pool&) = delete;
+
+    // Stream-ordered allocation and free of size bytes
+    hipError_t allocate(void** ptr, size_t size, hipStream_t stream);
+    hipError_t deallocate(void* ptr, size_t size, hipStream_t stream);
+
+    void retain()
+    {
+        refs++;
+    }
+
+    // Drop a reference, destroying the pool with the last one
+    void release()
+    {
+        if(--refs == 0)
+            delete this;
+    }
+
+    int get_device() const
+    {
+        return device;
+    }
+
+    size_t get_max_size() const
+    {
+        return max_size;
+    }
+
+    // Bytes held by the allocations made from the pool
+    size_t get_used_size() const
+    {
+        return used;
+    }
+
+private:
+    ~_rocblas_workspace_pool();
+
+    const int           device;
+    const size_t        max_size;
+    hipMemPool_t        pool = nullptr;
+    std::atomic<size_t> used{0};
+    std::atomic<int>    refs{1};
+};
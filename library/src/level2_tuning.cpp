@@ -0,0 +1,187 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "level2_tuning.hpp"
+#include "blas2/rocblas_level2_threshold.hpp"
+#include "handle.hpp"
+#include "rocblas_ostream.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+    // Names of the thresholds in a tuning file
+    struct rocblas_level2_threshold_field
+    {
+        const char* name;
+        int rocblas_level2_thresholds::*member;
+    };
+
+    constexpr rocblas_level2_threshold_field rocblas_level2_threshold_fields[] = {
+        {"sgemvt_double_buffered", &rocblas_level2_thresholds::sgemvt_double_buffered},
+        {"dgemvt_double_buffered", &rocblas_level2_thresholds::dgemvt_double_buffered},
+        {"sgemvt_warp_reduce", &rocblas_level2_thresholds::sgemvt_warp_reduce},
+        {"gemvt", &rocblas_level2_thresholds::gemvt},
+        {"gemvt_skinny_ratio", &rocblas_level2_thresholds::gemvt_skinny_ratio},
+    };
+
+    const rocblas_level2_threshold_field* rocblas_find_level2_threshold(const std::string& name)
+    {
+        for(const auto& field : rocblas_level2_threshold_fields)
+            if(name == field.name)
+                return &field;
+        return nullptr;
+    }
+}
+
+rocblas_level2_thresholds rocblas_level2_default_thresholds(int arch)
+{
+    int  arch_major = arch / 100;
+    bool is_gfx908  = arch == 908;
+
+    rocblas_level2_thresholds thresholds;
+    thresholds.sgemvt_double_buffered
+        = is_gfx908 ? sgemvt_gfx908_lower_threshold : c_level2_threshold_disabled;
+    thresholds.dgemvt_double_buffered
+        = is_gfx908 ? dgemvt_gfx908_lower_threshold : c_level2_threshold_disabled;
+    thresholds.sgemvt_warp_reduce
+        = arch_major == 10 || arch_major == 11 ? sgemvt_gfx_arch_10_11_threshold : 0;
+    thresholds.gemvt              = gemvt_threshold;
+    thresholds.gemvt_skinny_ratio = gemvt_skinny_ratio_threshold;
+    return thresholds;
+}
+
+rocblas_level2_tuning& rocblas_level2_tuning::instance()
+{
+    static rocblas_level2_tuning tuning;
+    return tuning;
+}
+
+rocblas_level2_tuning::rocblas_level2_tuning()
+{
+    const char* path = getenv("ROCBLAS_LEVEL2_THRESHOLDS");
+    if(path && *path && load(path) != rocblas_status_success)
+        rocblas_cerr << "rocBLAS warning: unable to load level 2 thresholds " << path << std::endl;
+}
+
+rocblas_status rocblas_level2_tuning::load(const char* path)
+{
+    std::map<std::string, std::map<std::string, int>> new_table;
+
+    if(path)
+    {
+        std::ifstream file(path);
+        if(!file)
+            return rocblas_status_invalid_value;
+
+        std::string line;
+        while(std::getline(file, line))
+        {
+            std::istringstream fields(line);
+            std::string        arch, name;
+            long long          value;
+            if(!(fields >> arch) || arch[0] == '#')
+                continue;
+            if(!(fields >> name >> value) || !rocblas_find_level2_threshold(name) || value < 0
+               || value > c_level2_threshold_disabled)
+                return rocblas_status_invalid_value;
+            new_table[arch][name] = int(value);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    table = std::move(new_table);
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_level2_tuning::save(const char* path) const
+{
+    if(!path)
+        return rocblas_status_invalid_pointer;
+
+    std::ofstream file(path, std::ios::trunc);
+    if(!file)
+        return rocblas_status_invalid_value;
+
+    file << "# rocBLAS level 2 thresholds: <arch> <threshold> <value>\n";
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for(const auto& arch : table)
+            for(const auto& threshold : arch.second)
+                file << arch.first << ' ' << threshold.first << ' ' << threshold.second << '\n';
+    }
+
+    file.close();
+    return file ? rocblas_status_success : rocblas_status_invalid_value;
+}
+
+rocblas_level2_thresholds rocblas_level2_tuning::get(int arch) const
+{
+    rocblas_level2_thresholds thresholds = rocblas_level2_default_thresholds(arch);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if(table.empty())
+        return thresholds;
+
+    auto it = table.find(rocblas_internal_get_arch_name());
+    if(it != table.end())
+        for(const auto& threshold : it->second)
+            thresholds.*(rocblas_find_level2_threshold(threshold.first)->member) = threshold.second;
+
+    // The gemv workspace is sized for the default ratio, so the skinny n kernel is never
+    // selected for a smaller one
+    thresholds.gemvt_skinny_ratio
+        = std::max(thresholds.gemvt_skinny_ratio, gemvt_skinny_ratio_threshold);
+    return thresholds;
+}
+
+void rocblas_level2_tuning::record(const std::string&               arch_name,
+                                   const rocblas_level2_thresholds& thresholds)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto&                       entry = table[arch_name];
+    for(const auto& field : rocblas_level2_threshold_fields)
+        entry[field.name] = thresholds.*field.member;
+}
+
+extern "C" rocblas_status rocblas_load_level2_thresholds(const char* path)
+try
+{
+    return rocblas_level2_tuning::instance().load(path);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_save_level2_thresholds(const char* path)
+try
+{
+    return rocblas_level2_tuning::instance().save(path);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
@@ -0,0 +1,47 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "managed_prefetch.hpp"
+#include "handle.hpp"
+
+void rocblas_prefetch_managed(rocblas_handle handle, const void* ptr, size_t bytes)
+{
+    if(!handle->managed_prefetch || !ptr || bytes < ROCBLAS_MANAGED_PREFETCH_MIN_BYTES
+       || handle->is_device_memory_size_query())
+        return;
+
+    hipPointerAttribute_t attribute;
+    if(hipPointerGetAttributes(&attribute, ptr) != hipSuccess)
+    {
+        // Pageable memory is unknown to HIP; clear the error
+        (void)hipGetLastError();
+        return;
+    }
+    if(!attribute.isManaged || handle->is_stream_in_capture_mode())
+        return;
+
+    int device = handle->getDevice();
+    if(hipMemAdvise(ptr, bytes, hipMemAdviseSetAccessedBy, device) != hipSuccess)
+        (void)hipGetLastError();
+    if(hipMemPrefetchAsync(ptr, bytes, device, handle->get_stream()) != hipSuccess)
+        (void)hipGetLastError();
+}
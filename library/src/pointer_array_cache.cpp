@@ -0,0 +1,61 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "pointer_array_cache.hpp"
+#include "utility.hpp"
+
+rocblas_status rocblas_pointer_array_cache::get(void*          base,
+                                                rocblas_stride stride_bytes,
+                                                rocblas_int    batch_count,
+                                                bool           may_allocate,
+                                                void***        array,
+                                                bool*          cached)
+{
+    for(auto it = entries.begin(); it != entries.end(); ++it)
+    {
+        if(it->base == base && it->stride_bytes == stride_bytes && it->batch_count == batch_count)
+        {
+            entries.splice(entries.begin(), entries, it);
+            *array  = it->array;
+            *cached = true;
+            return rocblas_status_success;
+        }
+    }
+
+    // Allocating, and freeing the least recently used array, synchronize the device
+    if(!may_allocate)
+        return rocblas_status_not_implemented;
+
+    if(entries.size() >= CAPACITY)
+    {
+        RETURN_IF_HIP_ERROR((hipFree)(entries.back().array));
+        entries.pop_back();
+    }
+
+    void** d_array = nullptr;
+    RETURN_IF_HIP_ERROR((hipMalloc)(&d_array, sizeof(void*) * batch_count));
+
+    entries.push_front({base, stride_bytes, batch_count, d_array});
+    *array  = d_array;
+    *cached = false;
+    return rocblas_status_success;
+}
@@ -0,0 +1,148 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "profile_timer.hpp"
+#include <algorithm>
+#include <cmath>
+
+void rocblas_profile_time::add(double us)
+{
+    n++;
+    sum += us;
+    lo = std::min(lo, us);
+    hi = std::max(hi, us);
+
+    int bin = 0;
+    if(us > 0)
+        bin = int(std::floor(std::log2(us) * BINS_PER_OCTAVE)) - MIN_OCTAVE * BINS_PER_OCTAVE;
+    bins[std::min(std::max(bin, 0), BINS - 1)]++;
+}
+
+double rocblas_profile_time::percentile(double p) const
+{
+    if(!n)
+        return 0;
+
+    // Smallest bin holding at least p * n calls at or below it
+    size_t rank = std::max(size_t(std::ceil(p * n)), size_t(1));
+    size_t seen = 0;
+    int    bin  = 0;
+    while(bin < BINS - 1 && (seen += bins[bin]) < rank)
+        bin++;
+
+    // Geometric middle of the bin, limited to the times actually seen
+    double us = std::exp2((bin + MIN_OCTAVE * BINS_PER_OCTAVE + 0.5) / BINS_PER_OCTAVE);
+    return std::min(std::max(us, lo), hi);
+}
+
+rocblas_profile_timer::~rocblas_profile_timer()
+{
+    for(auto& e : pending)
+    {
+        (void)hipEventDestroy(e.start);
+        (void)hipEventDestroy(e.stop);
+    }
+    if(current.time)
+        (void)hipEventDestroy(current.start);
+    for(auto event : free_events)
+        (void)hipEventDestroy(event);
+}
+
+hipEvent_t rocblas_profile_timer::get_event()
+{
+    hipEvent_t event = nullptr;
+    if(!free_events.empty())
+    {
+        event = free_events.back();
+        free_events.pop_back();
+    }
+    else if(hipEventCreate(&event) != hipSuccess)
+    {
+        event = nullptr;
+    }
+    return event;
+}
+
+void rocblas_profile_timer::collect(bool wait)
+{
+    std::lock_guard<std::mutex> lock(rocblas_profile_time::get_mutex());
+
+    while(!pending.empty())
+    {
+        entry_t&   e      = pending.front();
+        hipError_t status = wait ? hipEventSynchronize(e.stop) : hipEventQuery(e.stop);
+        if(status == hipErrorNotReady)
+            break;
+
+        // Calls whose events failed are not counted
+        float ms = 0;
+        if(status == hipSuccess && hipEventElapsedTime(&ms, e.start, e.stop) == hipSuccess)
+            e.time->add(ms * 1000.0);
+
+        free_events.push_back(e.start);
+        free_events.push_back(e.stop);
+        pending.pop_front();
+    }
+}
+
+void rocblas_profile_timer::start(rocblas_profile_time* time, hipStream_t stream)
+{
+    stop(stream);
+
+    // Collect the completed calls, waiting for all of them if the backlog is too long
+    collect(pending.size() >= MAX_PENDING);
+
+    hipEvent_t event = get_event();
+    if(!event)
+        return;
+    if(hipEventRecord(event, stream) != hipSuccess)
+    {
+        free_events.push_back(event);
+        return;
+    }
+    current = {time, event, nullptr};
+}
+
+void rocblas_profile_timer::stop(hipStream_t stream)
+{
+    if(!current.time)
+        return;
+
+    current.stop = get_event();
+    if(current.stop && hipEventRecord(current.stop, stream) == hipSuccess)
+    {
+        pending.push_back(current);
+    }
+    else
+    {
+        free_events.push_back(current.start);
+        if(current.stop)
+            free_events.push_back(current.stop);
+    }
+    current = {};
+}
+
+void rocblas_profile_timer::flush(hipStream_t stream)
+{
+    stop(stream);
+    collect(true);
+}
@@ -0,0 +1,190 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "recording.hpp"
+#include "logging.hpp"
+#include "utility.hpp"
+
+_rocblas_recording::~_rocblas_recording()
+{
+    if(exec)
+        (void)hipGraphExecDestroy(exec);
+    if(workspace)
+        (void)(hipFree)(workspace);
+}
+
+extern "C" rocblas_status rocblas_begin_recording(rocblas_handle handle, size_t workspace_size)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_begin_recording", workspace_size);
+
+    // Recordings do not nest, and cannot be made inside a capture begun by the user, or while
+    // the handle's workspace is in use or being sized
+    if(handle->recording || handle->is_stream_in_capture_mode() || handle->device_memory_in_use
+       || handle->device_memory_size_query)
+        return rocblas_status_invalid_value;
+
+    // Temporarily change the thread's default device ID to the handle's device ID
+    // cppcheck-suppress unreadVariable
+    auto saved_device_id = handle->push_device_id();
+
+    auto recording = std::make_unique<_rocblas_recording>();
+
+    recording->workspace_size
+        = workspace_size ? workspace_size : _rocblas_handle::DEFAULT_DEVICE_MEMORY_SIZE;
+    RETURN_IF_HIP_ERROR((hipMalloc)(&recording->workspace, recording->workspace_size));
+
+    // The null stream cannot be captured, so a stream is created for the recording
+    recording->saved_stream = handle->stream;
+    if(!handle->stream)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipStreamCreateWithFlags(&recording->capture_stream, hipStreamNonBlocking));
+        handle->stream = recording->capture_stream;
+    }
+
+    recording->saved_device_memory       = handle->device_memory;
+    recording->saved_device_memory_size  = handle->device_memory_size;
+    recording->saved_device_memory_owner = handle->device_memory_owner;
+    handle->device_memory                = recording->workspace;
+    handle->device_memory_size           = recording->workspace_size;
+    handle->device_memory_owner          = rocblas_device_memory_ownership::user_owned;
+
+    hipError_t status = hipStreamBeginCapture(handle->stream, hipStreamCaptureModeThreadLocal);
+    if(status != hipSuccess)
+    {
+        handle->device_memory       = recording->saved_device_memory;
+        handle->device_memory_size  = recording->saved_device_memory_size;
+        handle->device_memory_owner = recording->saved_device_memory_owner;
+        handle->stream              = recording->saved_stream;
+        if(recording->capture_stream)
+            (void)hipStreamDestroy(recording->capture_stream);
+        return get_rocblas_status_for_hip_status(status);
+    }
+
+    handle->recording = recording.release();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_end_recording(rocblas_handle     handle,
+                                                rocblas_recording* recording)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_end_recording", recording ? *recording : nullptr);
+
+    if(!handle->recording)
+        return rocblas_status_invalid_value;
+
+    // The handle's state is restored whether or not the graph can be made
+    std::unique_ptr<_rocblas_recording> recorded(handle->recording);
+    handle->recording = nullptr;
+
+    hipGraph_t graph  = nullptr;
+    hipError_t status = hipStreamEndCapture(handle->stream, &graph);
+
+    handle->device_memory       = recorded->saved_device_memory;
+    handle->device_memory_size  = recorded->saved_device_memory_size;
+    handle->device_memory_owner = recorded->saved_device_memory_owner;
+    handle->stream              = recorded->saved_stream;
+    if(recorded->capture_stream)
+    {
+        (void)hipStreamDestroy(recorded->capture_stream);
+        recorded->capture_stream = nullptr;
+    }
+
+    if(status != hipSuccess)
+        return get_rocblas_status_for_hip_status(status);
+    if(!recording)
+    {
+        (void)hipGraphDestroy(graph);
+        return rocblas_status_invalid_pointer;
+    }
+
+    // Temporarily change the thread's default device ID to the handle's device ID
+    // cppcheck-suppress unreadVariable
+    auto saved_device_id = handle->push_device_id();
+
+    // An existing recording of calls with the same structure is updated in place, and then
+    // uses the new workspace; otherwise the new graph is instantiated
+    if(*recording && (*recording)->exec)
+    {
+        hipGraphNode_t           error_node;
+        hipGraphExecUpdateResult update_result;
+        if(hipGraphExecUpdate((*recording)->exec, graph, &error_node, &update_result)
+           == hipSuccess)
+        {
+            std::swap((*recording)->workspace, recorded->workspace);
+            std::swap((*recording)->workspace_size, recorded->workspace_size);
+            (void)hipGraphDestroy(graph);
+            return rocblas_status_success;
+        }
+    }
+
+    status = hipGraphInstantiate(&recorded->exec, graph, nullptr, nullptr, 0);
+    (void)hipGraphDestroy(graph);
+    RETURN_IF_HIP_ERROR(status);
+
+    delete *recording;
+    *recording = recorded.release();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_launch_recording(rocblas_recording recording, hipStream_t stream)
+try
+{
+    if(!recording || !recording->exec)
+        return rocblas_status_invalid_pointer;
+
+    RETURN_IF_HIP_ERROR(hipGraphLaunch(recording->exec, stream));
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_destroy_recording(rocblas_recording recording)
+try
+{
+    delete recording;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
@@ -21,12 +21,18 @@
  *
  * ************************************************************************ */
 #include "handle.hpp"
+#include "host_numa.hpp"
+#include "level1_fusion.hpp"
 #include "logging.hpp"
 #include "rocblas-auxiliary.h"
+#include "utility.hpp"
+#include <algorithm>
 #include <cctype>
 #include <cstdlib>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 /* ============================================================================================ */
 
@@ -241,6 +247,10 @@ try
         return rocblas_status_invalid_handle;
     if(handle->layer_mode & rocblas_layer_mode_log_trace)
         log_trace(handle, "rocblas_destroy_handle");
+    // thread handles are destroyed with their shared handle
+    if(handle->shared_handle)
+        return rocblas_status_invalid_handle;
+    rocblas_destroy_thread_handles(handle);
     // call destructor
     delete handle;
 
@@ -275,9 +285,19 @@ try
     if(stream != 0 && hipStreamQuery(stream) == hipErrorInvalidResourceHandle)
         return rocblas_status_invalid_value;
 
-    // Set the new stream
+    // Level 1 operations deferred for fusion run on the stream they were called on
+    RETURN_IF_ROCBLAS_ERROR(rocblas_level1_fusion_flush(handle));
+
+    // Deferred numerical checks are read back on the stream they were made on
+    rocblas_status check_numerics_status = handle->report_check_numerics();
+
+    // A profiled call being timed ends on the stream its work was enqueued on
+    handle->stop_profile_timer();
+
+    // Set the new stream, whose CU mask and priority affect the GEMM solutions selected
     handle->stream = stream;
-    return rocblas_status_success;
+    handle->update_stream_properties();
+    return check_numerics_status;
 }
 catch(...)
 {
@@ -305,14 +325,11 @@ catch(...)
 {
     return exception_to_rocblas_status();
 }
-
 /*******************************************************************************
  *! \brief  Non-unit stride vector copy on device. Vectors are void pointers
      with element size elem_size
  ******************************************************************************/
-// arbitrarily assign max buffer size to 1Mb
-constexpr size_t      VEC_BUFF_MAX_BYTES = 1048576;
-constexpr rocblas_int NB_X               = 256;
+constexpr rocblas_int NB_X = 256;
 
 template <rocblas_int NB>
 ROCBLAS_KERNEL(NB)
@@ -331,29 +348,227 @@ rocblas_copy_void_ptr_vector_kernel(rocblas_int n,
     }
 }
 
-/* ============================================================================================ */
-// TODO: Need to replace this with new device memory allocation system
+/*******************************************************************************
+ * Pinned staging for the blocking transfers rocblas_set/get_vector and
+ * rocblas_set/get_matrix. A transfer which is packed or unpacked on the host is
+ * split into chunks, which go through STAGING_BUFF_COUNT pinned buffers in
+ * turn: the host packs (or unpacks) one chunk while the copy engine moves
+ * another, and every DMA reads from or writes to pinned memory.
+ *
+ * These functions take no handle, so the staging sets are kept in a
+ * process-wide pool and reused across calls; pinned allocation costs far more
+ * than a transfer of a few chunks.
+ ******************************************************************************/
+constexpr size_t STAGING_BUFF_BYTES = 4 * 1048576;
+constexpr int    STAGING_BUFF_COUNT = 2;
 
-// device_malloc wraps hipMalloc and provides same API as malloc
-static void* device_malloc(size_t byte_size)
-{
-    void* pointer = nullptr;
-    PRINT_IF_HIP_ERROR((hipMalloc)(&pointer, byte_size));
-    return pointer;
-}
+// A slot is refilled while the chunk of the other slot is in flight
+static_assert(STAGING_BUFF_COUNT >= 2, "staging needs at least two buffers");
 
-// device_free wraps hipFree and provides same API as free
-static void device_free(void* ptr)
+namespace
 {
-    PRINT_IF_HIP_ERROR((hipFree)(ptr));
-}
+    struct rocblas_staging_slot
+    {
+        void*      host   = nullptr; // pinned host buffer
+        void*      device = nullptr; // device buffer, allocated on first use
+        hipEvent_t event  = nullptr; // recorded after the last operation using the slot
+    };
+
+    struct rocblas_staging_set
+    {
+        int                  device;
+        rocblas_staging_slot slots[STAGING_BUFF_COUNT];
+
+        explicit rocblas_staging_set(int device)
+            : device(device)
+        {
+        }
+
+        ~rocblas_staging_set()
+        {
+            for(auto& slot : slots)
+            {
+                if(slot.event)
+                    PRINT_IF_HIP_ERROR(hipEventDestroy(slot.event));
+                if(slot.device)
+                    PRINT_IF_HIP_ERROR((hipFree)(slot.device));
+                if(slot.host)
+                    PRINT_IF_HIP_ERROR(hipHostFree(slot.host));
+            }
+        }
+
+        rocblas_staging_set(const rocblas_staging_set&) = delete;
+        rocblas_staging_set& operator=(const rocblas_staging_set&) = delete;
+
+        bool init()
+        {
+            for(auto& slot : slots)
+                if(rocblas_host_malloc_near(&slot.host, STAGING_BUFF_BYTES, device) != hipSuccess
+                   || hipEventCreateWithFlags(&slot.event, hipEventDisableTiming) != hipSuccess)
+                    return false;
+            return true;
+        }
+
+        // Device buffer of a slot, or nullptr if it cannot be allocated
+        void* device_buffer(rocblas_staging_slot& slot)
+        {
+            if(!slot.device && (hipMalloc)(&slot.device, STAGING_BUFF_BYTES) != hipSuccess)
+                slot.device = nullptr;
+            return slot.device;
+        }
+    };
+
+    class rocblas_staging_pool
+    {
+        struct release
+        {
+            void operator()(rocblas_staging_set* set) const
+            {
+                instance().put(set);
+            }
+        };
+
+    public:
+        using set_ptr = std::unique_ptr<rocblas_staging_set, release>;
+
+        // Staging set for the current device, or nullptr if it cannot be allocated
+        static set_ptr acquire()
+        {
+            int device;
+            if(hipGetDevice(&device) != hipSuccess)
+                return nullptr;
+            return instance().get(device);
+        }
+
+    private:
+        // Never destroyed, since pinned memory cannot be freed once the HIP runtime
+        // has been torn down at exit
+        static rocblas_staging_pool& instance()
+        {
+            static auto* pool = new rocblas_staging_pool;
+            return *pool;
+        }
+
+        set_ptr get(int device)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                for(size_t i = 0; i < free_sets.size(); ++i)
+                {
+                    if(free_sets[i]->device == device)
+                    {
+                        rocblas_staging_set* set = free_sets[i];
+                        free_sets[i]             = free_sets.back();
+                        free_sets.pop_back();
+                        return set_ptr(set);
+                    }
+                }
+            }
+
+            auto set = std::make_unique<rocblas_staging_set>(device);
+            if(!set->init())
+                return nullptr;
+            return set_ptr(set.release());
+        }
+
+        void put(rocblas_staging_set* set)
+        {
+            // A transfer which failed part way may leave copies in flight
+            for(auto& slot : set->slots)
+                PRINT_IF_HIP_ERROR(hipEventSynchronize(slot.event));
+
+            std::lock_guard<std::mutex> lock(mutex);
+            free_sets.push_back(set);
+        }
+
+        std::mutex                        mutex;
+        std::vector<rocblas_staging_set*> free_sets;
+    };
+
+    /***************************************************************************
+     * Host to device transfer of n_chunks chunks through a staging set.
+     * pack(i, t_h) copies chunk i from host memory into the pinned buffer t_h,
+     * and send(i, t_h, t_d, stream) enqueues its transfer to the destination,
+     * using the device buffer t_d if use_device_buffer is set. The transfers are
+     * enqueued on stream, and it returns once the whole transfer has completed.
+     **************************************************************************/
+    template <typename PACK, typename SEND>
+    rocblas_status rocblas_staged_host_to_device(int         n_chunks,
+                                                 bool        use_device_buffer,
+                                                 PACK        pack,
+                                                 SEND        send,
+                                                 hipStream_t stream = 0)
+    {
+        auto staging = rocblas_staging_pool::acquire();
+        if(!staging)
+            return rocblas_status_memory_error;
+
+        for(int i = 0; i < n_chunks; i++)
+        {
+            auto& slot = staging->slots[i % STAGING_BUFF_COUNT];
+            void* t_d  = use_device_buffer ? staging->device_buffer(slot) : nullptr;
+            if(use_device_buffer && !t_d)
+                return rocblas_status_memory_error;
+
+            // the chunk previously staged in this slot must have left it
+            RETURN_IF_HIP_ERROR(hipEventSynchronize(slot.event));
+            pack(i, slot.host);
+            RETURN_IF_HIP_ERROR(send(i, slot.host, t_d, stream));
+            RETURN_IF_HIP_ERROR(hipEventRecord(slot.event, stream));
+        }
+        // the chunks are in order on stream, so the last one completes the transfer
+        if(n_chunks > 0)
+            RETURN_IF_HIP_ERROR(
+                hipEventSynchronize(staging->slots[(n_chunks - 1) % STAGING_BUFF_COUNT].event));
+        return rocblas_status_success;
+    }
 
-using rocblas_unique_ptr = std::unique_ptr<void, void (*)(void*)>;
+    /***************************************************************************
+     * Device to host transfer of n_chunks chunks through a staging set.
+     * receive(i, t_h, t_d, stream) enqueues the transfer of chunk i into the
+     * pinned buffer t_h, using the device buffer t_d if use_device_buffer is
+     * set, and unpack(i, t_h) copies it from t_h to host memory. The transfers
+     * are enqueued on stream.
+     **************************************************************************/
+    template <typename RECEIVE, typename UNPACK>
+    rocblas_status rocblas_staged_device_to_host(int         n_chunks,
+                                                 bool        use_device_buffer,
+                                                 RECEIVE     receive,
+                                                 UNPACK      unpack,
+                                                 hipStream_t stream = 0)
+    {
+        auto staging = rocblas_staging_pool::acquire();
+        if(!staging)
+            return rocblas_status_memory_error;
+
+        for(int i = 0; i <= n_chunks; i++)
+        {
+            if(i < n_chunks)
+            {
+                auto& slot = staging->slots[i % STAGING_BUFF_COUNT];
+                void* t_d  = use_device_buffer ? staging->device_buffer(slot) : nullptr;
+                if(use_device_buffer && !t_d)
+                    return rocblas_status_memory_error;
+
+                RETURN_IF_HIP_ERROR(receive(i, slot.host, t_d, stream));
+                RETURN_IF_HIP_ERROR(hipEventRecord(slot.event, stream));
+            }
+
+            // unpack the previous chunk while this one is in flight
+            if(i > 0)
+            {
+                auto& slot = staging->slots[(i - 1) % STAGING_BUFF_COUNT];
+                RETURN_IF_HIP_ERROR(hipEventSynchronize(slot.event));
+                unpack(i - 1, slot.host);
+            }
+        }
+        return rocblas_status_success;
+    }
+}
 
 /*******************************************************************************
  *! \brief   copies void* vector x with stride incx on host to void* vector
      y with stride incy on device. Vectors have n elements of size elem_size.
-  TODO: Need to replace device memory allocation with new system
  ******************************************************************************/
 extern "C" rocblas_status rocblas_set_vector(rocblas_int n,
                                              rocblas_int elem_size,
@@ -370,107 +585,74 @@ try
     if(!x_h || !y_d)
         return rocblas_status_invalid_pointer;
 
+    size_t x_h_byte_stride = (size_t)elem_size * incx;
+    size_t y_d_byte_stride = (size_t)elem_size * incy;
+
     if(incx == 1 && incy == 1) // contiguous host vector -> contiguous device vector
     {
-        PRINT_IF_HIP_ERROR(hipMemcpy(y_d, x_h, elem_size * n, hipMemcpyHostToDevice));
+        PRINT_IF_HIP_ERROR(hipMemcpy(y_d, x_h, (size_t)elem_size * n, hipMemcpyHostToDevice));
     }
-    else // either non-contiguous host vector or non-contiguous device vector
+    // elements too large to fit in staging buffer, copy vector element by element
+    else if(size_t(elem_size) > STAGING_BUFF_BYTES)
     {
-        size_t bytes_to_copy = static_cast<size_t>(elem_size) * static_cast<size_t>(n);
-        size_t temp_byte_size
-            = bytes_to_copy < VEC_BUFF_MAX_BYTES ? bytes_to_copy : VEC_BUFF_MAX_BYTES;
-        int n_elem = temp_byte_size / elem_size; // number of elements in buffer
-        int n_copy = ((n - 1) / n_elem) + 1; // number of times buffer is copied
-
-        int  blocks = (n_elem - 1) / NB_X + 1; // parameters for device kernel
-        dim3 grid(blocks);
-        dim3 threads(NB_X);
+        for(size_t i = 0; i < size_t(n); i++)
+        {
+            PRINT_IF_HIP_ERROR(hipMemcpy((char*)y_d + i * y_d_byte_stride,
+                                         (const char*)x_h + i * x_h_byte_stride,
+                                         elem_size,
+                                         hipMemcpyHostToDevice));
+        }
+    }
+    // pack chunks of the host vector in pinned buffers, hipMemcpyAsync host->device,
+    // unpack on the device if it is non-contiguous
+    else
+    {
+        int n_elem   = std::min(STAGING_BUFF_BYTES / elem_size, size_t(n)); // elements per chunk
+        int n_chunks = ((n - 1) / n_elem) + 1;
 
-        size_t x_h_byte_stride = (size_t)elem_size * incx;
-        size_t y_d_byte_stride = (size_t)elem_size * incy;
-        size_t t_h_byte_stride = (size_t)elem_size;
+        auto chunk_elems = [=](int i_chunk) { return std::min(n - i_chunk * n_elem, n_elem); };
 
-        for(int i_copy = 0; i_copy < n_copy; i_copy++)
-        {
-            int         i_start     = i_copy * n_elem;
-            int         n_elem_max  = n - i_start < n_elem ? n - i_start : n_elem;
-            int         contig_size = n_elem_max * elem_size;
-            void*       y_d_start   = (char*)y_d + i_start * y_d_byte_stride;
-            const void* x_h_start   = (const char*)x_h + i_start * x_h_byte_stride;
+        auto pack = [=](int i_chunk, void* t_h) {
+            int         n_elem_max = chunk_elems(i_chunk);
+            const char* x_h_start  = (const char*)x_h + size_t(i_chunk) * n_elem * x_h_byte_stride;
 
-            if((incx != 1) && (incy != 1))
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_h_managed = rocblas_unique_ptr{malloc(temp_byte_size), free};
-                void* t_h         = t_h_managed.get();
-                if(!t_h)
-                    return rocblas_status_memory_error;
-                auto  t_d_managed = rocblas_unique_ptr{device_malloc(temp_byte_size), device_free};
-                void* t_d         = t_d_managed.get();
-                if(!t_d)
-                    return rocblas_status_memory_error;
-                // non-contiguous host vector -> host buffer
-                for(size_t i_b = 0, i_x = i_start; i_b < n_elem_max; i_b++, i_x++)
-                {
-                    memcpy((char*)t_h + i_b * t_h_byte_stride,
-                           (const char*)x_h + i_x * x_h_byte_stride,
+            if(incx == 1)
+                memcpy(t_h, x_h_start, size_t(n_elem_max) * elem_size);
+            else // non-contiguous host vector -> pinned buffer
+                for(size_t i_b = 0; i_b < size_t(n_elem_max); i_b++)
+                    memcpy((char*)t_h + i_b * elem_size,
+                           x_h_start + i_b * x_h_byte_stride,
                            elem_size);
-                }
-                // host buffer -> device buffer
-                PRINT_IF_HIP_ERROR(hipMemcpy(t_d, t_h, contig_size, hipMemcpyHostToDevice));
-                // device buffer -> non-contiguous device vector
-                hipLaunchKernelGGL((rocblas_copy_void_ptr_vector_kernel<NB_X>),
-                                   grid,
-                                   threads,
-                                   0,
-                                   0,
-                                   n_elem_max,
-                                   elem_size,
-                                   t_d,
-                                   1,
-                                   y_d_start,
-                                   incy);
-            }
-            else if(incx == 1 && incy != 1)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_d_managed = rocblas_unique_ptr{device_malloc(temp_byte_size), device_free};
-                void* t_d         = t_d_managed.get();
-                if(!t_d)
-                    return rocblas_status_memory_error;
-                // contiguous host vector -> device buffer
-                PRINT_IF_HIP_ERROR(hipMemcpy(t_d, x_h_start, contig_size, hipMemcpyHostToDevice));
-                // device buffer -> non-contiguous device vector
-                hipLaunchKernelGGL((rocblas_copy_void_ptr_vector_kernel<NB_X>),
-                                   grid,
-                                   threads,
-                                   0,
-                                   0,
-                                   n_elem_max,
-                                   elem_size,
-                                   t_d,
-                                   1,
-                                   y_d_start,
-                                   incy);
-            }
-            else if(incx != 1 && incy == 1)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_h_managed = rocblas_unique_ptr{malloc(temp_byte_size), free};
-                void* t_h         = t_h_managed.get();
-                if(!t_h)
-                    return rocblas_status_memory_error;
-                // non-contiguous host vector -> host buffer
-                for(size_t i_b = 0, i_x = i_start; i_b < n_elem_max; i_b++, i_x++)
-                {
-                    memcpy((char*)t_h + i_b * t_h_byte_stride,
-                           (const char*)x_h + i_x * x_h_byte_stride,
-                           elem_size);
-                }
-                // host buffer -> contiguous device vector
-                PRINT_IF_HIP_ERROR(hipMemcpy(y_d_start, t_h, contig_size, hipMemcpyHostToDevice));
-            }
-        }
+        };
+
+        auto send = [=](int i_chunk, const void* t_h, void* t_d, hipStream_t stream) {
+            int    n_elem_max  = chunk_elems(i_chunk);
+            size_t contig_size = size_t(n_elem_max) * elem_size;
+            void*  y_d_start   = (char*)y_d + size_t(i_chunk) * n_elem * y_d_byte_stride;
+
+            if(incy == 1)
+                return hipMemcpyAsync(y_d_start, t_h, contig_size, hipMemcpyHostToDevice, stream);
+
+            // pinned buffer -> device buffer -> non-contiguous device vector
+            hipError_t status
+                = hipMemcpyAsync(t_d, t_h, contig_size, hipMemcpyHostToDevice, stream);
+            if(status != hipSuccess)
+                return status;
+            hipLaunchKernelGGL((rocblas_copy_void_ptr_vector_kernel<NB_X>),
+                               dim3((n_elem_max - 1) / NB_X + 1),
+                               dim3(NB_X),
+                               0,
+                               stream,
+                               n_elem_max,
+                               elem_size,
+                               t_d,
+                               1,
+                               y_d_start,
+                               incy);
+            return hipGetLastError();
+        };
+
+        return rocblas_staged_host_to_device(n_chunks, incy != 1, pack, send);
     }
     return rocblas_status_success;
 }
@@ -498,108 +680,73 @@ try
     if(!x_d || !y_h)
         return rocblas_status_invalid_pointer;
 
+    size_t x_d_byte_stride = (size_t)elem_size * incx;
+    size_t y_h_byte_stride = (size_t)elem_size * incy;
+
     if(incx == 1 && incy == 1) // congiguous device vector -> congiguous host vector
     {
-        PRINT_IF_HIP_ERROR(hipMemcpy(y_h, x_d, elem_size * n, hipMemcpyDeviceToHost));
+        PRINT_IF_HIP_ERROR(hipMemcpy(y_h, x_d, (size_t)elem_size * n, hipMemcpyDeviceToHost));
     }
-    else // either device or host vector is non-contiguous
+    // elements too large to fit in staging buffer, copy vector element by element
+    else if(size_t(elem_size) > STAGING_BUFF_BYTES)
     {
-        size_t bytes_to_copy = static_cast<size_t>(elem_size) * static_cast<size_t>(n);
-        size_t temp_byte_size
-            = bytes_to_copy < VEC_BUFF_MAX_BYTES ? bytes_to_copy : VEC_BUFF_MAX_BYTES;
-        int n_elem = temp_byte_size / elem_size; // number elements in buffer
-        int n_copy = ((n - 1) / n_elem) + 1; // number of times buffer is copied
-
-        int  blocks = (n_elem - 1) / NB_X + 1; // parameters for device kernel
-        dim3 grid(blocks);
-        dim3 threads(NB_X);
-
-        size_t x_d_byte_stride = (size_t)elem_size * incx;
-        size_t y_h_byte_stride = (size_t)elem_size * incy;
-        size_t t_h_byte_stride = (size_t)elem_size;
-
-        for(int i_copy = 0; i_copy < n_copy; i_copy++)
+        for(size_t i = 0; i < size_t(n); i++)
         {
-            int i_start           = i_copy * n_elem;
-            int n_elem_max        = n - (n_elem * i_copy) < n_elem ? n - (n_elem * i_copy) : n_elem;
-            int contig_size       = elem_size * n_elem_max;
-            const void* x_d_start = (const char*)x_d + i_start * x_d_byte_stride;
-            void*       y_h_start = (char*)y_h + i_start * y_h_byte_stride;
-
-            if(incx != 1 && incy != 1)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_h_managed = rocblas_unique_ptr{malloc(temp_byte_size), free};
-                void* t_h         = t_h_managed.get();
-                if(!t_h)
-                    return rocblas_status_memory_error;
-                auto  t_d_managed = rocblas_unique_ptr{device_malloc(temp_byte_size), device_free};
-                void* t_d         = t_d_managed.get();
-                if(!t_d)
-                    return rocblas_status_memory_error;
-                // non-contiguous device vector -> device buffer
-                hipLaunchKernelGGL((rocblas_copy_void_ptr_vector_kernel<NB_X>),
-                                   grid,
-                                   threads,
-                                   0,
-                                   0,
-                                   n_elem_max,
-                                   elem_size,
-                                   x_d_start,
-                                   incx,
-                                   t_d,
-                                   1);
-                // device buffer -> host buffer
-                PRINT_IF_HIP_ERROR(hipMemcpy(t_h, t_d, contig_size, hipMemcpyDeviceToHost));
-                // host buffer -> non-contiguous host vector
-                for(size_t i_b = 0, i_y = i_start; i_b < n_elem_max; i_b++, i_y++)
-                {
-                    memcpy((char*)y_h + i_y * y_h_byte_stride,
-                           (const char*)t_h + i_b * t_h_byte_stride,
+            PRINT_IF_HIP_ERROR(hipMemcpy((char*)y_h + i * y_h_byte_stride,
+                                         (const char*)x_d + i * x_d_byte_stride,
+                                         elem_size,
+                                         hipMemcpyDeviceToHost));
+        }
+    }
+    // pack chunks on the device if it is non-contiguous, hipMemcpyAsync device->host
+    // into pinned buffers, unpack chunks into the host vector
+    else
+    {
+        int n_elem   = std::min(STAGING_BUFF_BYTES / elem_size, size_t(n)); // elements per chunk
+        int n_chunks = ((n - 1) / n_elem) + 1;
+
+        auto chunk_elems = [=](int i_chunk) { return std::min(n - i_chunk * n_elem, n_elem); };
+
+        auto receive = [=](int i_chunk, void* t_h, void* t_d, hipStream_t stream) {
+            int         n_elem_max  = chunk_elems(i_chunk);
+            size_t      contig_size = size_t(n_elem_max) * elem_size;
+            const void* x_d_start = (const char*)x_d + size_t(i_chunk) * n_elem * x_d_byte_stride;
+
+            if(incx == 1)
+                return hipMemcpyAsync(t_h, x_d_start, contig_size, hipMemcpyDeviceToHost, stream);
+
+            // non-contiguous device vector -> device buffer -> pinned buffer
+            hipLaunchKernelGGL((rocblas_copy_void_ptr_vector_kernel<NB_X>),
+                               dim3((n_elem_max - 1) / NB_X + 1),
+                               dim3(NB_X),
+                               0,
+                               stream,
+                               n_elem_max,
+                               elem_size,
+                               x_d_start,
+                               incx,
+                               t_d,
+                               1);
+            hipError_t status = hipGetLastError();
+            if(status != hipSuccess)
+                return status;
+            return hipMemcpyAsync(t_h, t_d, contig_size, hipMemcpyDeviceToHost, stream);
+        };
+
+        auto unpack = [=](int i_chunk, const void* t_h) {
+            int   n_elem_max = chunk_elems(i_chunk);
+            char* y_h_start  = (char*)y_h + size_t(i_chunk) * n_elem * y_h_byte_stride;
+
+            if(incy == 1)
+                memcpy(y_h_start, t_h, size_t(n_elem_max) * elem_size);
+            else // pinned buffer -> non-contiguous host vector
+                for(size_t i_b = 0; i_b < size_t(n_elem_max); i_b++)
+                    memcpy(y_h_start + i_b * y_h_byte_stride,
+                           (const char*)t_h + i_b * elem_size,
                            elem_size);
-                }
-            }
-            else if(incx == 1 && incy != 1)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_h_managed = rocblas_unique_ptr{malloc(temp_byte_size), free};
-                void* t_h         = t_h_managed.get();
-                if(!t_h)
-                    return rocblas_status_memory_error;
-                // congiguous device vector -> host buffer
-                PRINT_IF_HIP_ERROR(hipMemcpy(t_h, x_d_start, contig_size, hipMemcpyDeviceToHost));
+        };
 
-                // host buffer -> non-contiguous host vector
-                for(size_t i_b = 0, i_y = i_start; i_b < n_elem_max; i_b++, i_y++)
-                {
-                    memcpy((char*)y_h + i_y * y_h_byte_stride,
-                           (const char*)t_h + i_b * t_h_byte_stride,
-                           elem_size);
-                }
-            }
-            else if(incx != 1 && incy == 1)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_d_managed = rocblas_unique_ptr{device_malloc(temp_byte_size), device_free};
-                void* t_d         = t_d_managed.get();
-                if(!t_d)
-                    return rocblas_status_memory_error;
-                // non-contiguous device vector -> device buffer
-                hipLaunchKernelGGL((rocblas_copy_void_ptr_vector_kernel<NB_X>),
-                                   grid,
-                                   threads,
-                                   0,
-                                   0,
-                                   n_elem_max,
-                                   elem_size,
-                                   x_d_start,
-                                   incx,
-                                   t_d,
-                                   1);
-                // device buffer -> contiguous host vector
-                PRINT_IF_HIP_ERROR(hipMemcpy(y_h_start, t_d, contig_size, hipMemcpyDeviceToHost));
-            }
-        }
+        return rocblas_staged_device_to_host(n_chunks, incx != 1, receive, unpack);
     }
     return rocblas_status_success;
 }
@@ -699,9 +846,8 @@ catch(...) // catch all exceptions
      size elem_size
  ******************************************************************************/
 
-constexpr size_t      MAT_BUFF_MAX_BYTES = 1048576;
-constexpr rocblas_int MATRIX_DIM_X       = 128;
-constexpr rocblas_int MATRIX_DIM_Y       = 8;
+constexpr rocblas_int MATRIX_DIM_X = 128;
+constexpr rocblas_int MATRIX_DIM_Y = 8;
 
 template <rocblas_int DIM_X, rocblas_int DIM_Y>
 ROCBLAS_KERNEL(DIM_X* DIM_Y)
@@ -744,6 +890,10 @@ try
     if(!a_h || !b_d)
         return rocblas_status_invalid_pointer;
 
+    size_t lda_h_byte = (size_t)elem_size * lda;
+    size_t ldb_d_byte = (size_t)elem_size * ldb;
+    size_t ldt_h_byte = (size_t)elem_size * rows;
+
     // contiguous host matrix -> contiguous device matrix
     if(lda == rows && ldb == rows)
     {
@@ -751,8 +901,8 @@ try
                                * static_cast<size_t>(cols);
         PRINT_IF_HIP_ERROR(hipMemcpy(b_d, a_h, bytes_to_copy, hipMemcpyHostToDevice));
     }
-    // matrix colums too large to fit in temp buffer, copy matrix col by col
-    else if(rows * elem_size > MAT_BUFF_MAX_BYTES)
+    // matrix colums too large to fit in staging buffer, copy matrix col by col
+    else if(ldt_h_byte > STAGING_BUFF_BYTES)
     {
         for(size_t i = 0; i < cols; i++)
         {
@@ -762,111 +912,57 @@ try
                                          hipMemcpyHostToDevice));
         }
     }
-    // columns fit in temp buffer, pack columns in buffer, hipMemcpy host->device, unpack
-    // columns
+    // columns fit in staging buffer, pack chunks of columns in pinned buffers,
+    // hipMemcpyAsync host->device, unpack columns on the device
     else
     {
-        size_t bytes_to_copy = static_cast<size_t>(elem_size) * static_cast<size_t>(rows)
-                               * static_cast<size_t>(cols);
-        size_t temp_byte_size
-            = bytes_to_copy < MAT_BUFF_MAX_BYTES ? bytes_to_copy : MAT_BUFF_MAX_BYTES;
-        int n_cols = temp_byte_size / (elem_size * rows); // number of columns in buffer
-        int n_copy = ((cols - 1) / n_cols) + 1; // number of times buffer is copied
-
-        rocblas_int blocksX = ((rows - 1) / MATRIX_DIM_X) + 1; // parameters for device kernel
-        rocblas_int blocksY = ((n_cols - 1) / MATRIX_DIM_Y) + 1;
-        dim3        grid(blocksX, blocksY);
-        dim3        threads(MATRIX_DIM_X, MATRIX_DIM_Y);
-
-        size_t lda_h_byte = (size_t)elem_size * lda;
-        size_t ldb_d_byte = (size_t)elem_size * ldb;
-        size_t ldt_h_byte = (size_t)elem_size * rows;
-
-        for(int i_copy = 0; i_copy < n_copy; i_copy++)
-        {
-            size_t      i_start     = i_copy * n_cols;
-            int         n_cols_max  = cols - i_start < n_cols ? cols - i_start : n_cols;
-            int         contig_size = elem_size * rows * n_cols_max;
-            void*       b_d_start   = (char*)b_d + i_start * ldb_d_byte;
-            const void* a_h_start   = (const char*)a_h + i_start * lda_h_byte;
-
-            if((lda != rows) && (ldb != rows))
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_h_managed = rocblas_unique_ptr{malloc(temp_byte_size), free};
-                void* t_h         = t_h_managed.get();
-                if(!t_h)
-                    return rocblas_status_memory_error;
-                auto  t_d_managed = rocblas_unique_ptr{device_malloc(temp_byte_size), device_free};
-                void* t_d         = t_d_managed.get();
-                if(!t_d)
-                    return rocblas_status_memory_error;
-                // non-contiguous host matrix -> host buffer
-                for(size_t i_t = 0, i_a = i_start; i_t < n_cols_max; i_t++, i_a++)
-                {
-                    memcpy((char*)t_h + i_t * ldt_h_byte,
-                           (const char*)a_h + i_a * lda_h_byte,
-                           ldt_h_byte);
-                }
-                // host buffer -> device buffer
-                PRINT_IF_HIP_ERROR(hipMemcpy(t_d, t_h, contig_size, hipMemcpyHostToDevice));
-                // device buffer -> non-contiguous device matrix
-                hipLaunchKernelGGL(
-                    (rocblas_copy_void_ptr_matrix_kernel<MATRIX_DIM_X, MATRIX_DIM_Y>),
-                    grid,
-                    threads,
-                    0,
-                    0,
-                    rows,
-                    n_cols_max,
-                    elem_size,
-                    t_d,
-                    rows,
-                    b_d_start,
-                    ldb);
-            }
-            else if(lda == rows && ldb != rows)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_d_managed = rocblas_unique_ptr{device_malloc(temp_byte_size), device_free};
-                void* t_d         = t_d_managed.get();
-                if(!t_d)
-                    return rocblas_status_memory_error;
-                // contiguous host matrix -> device buffer
-                PRINT_IF_HIP_ERROR(hipMemcpy(t_d, a_h_start, contig_size, hipMemcpyHostToDevice));
-                // device buffer -> non-contiguous device matrix
-                hipLaunchKernelGGL(
-                    (rocblas_copy_void_ptr_matrix_kernel<MATRIX_DIM_X, MATRIX_DIM_Y>),
-                    grid,
-                    threads,
-                    0,
-                    0,
-                    rows,
-                    n_cols_max,
-                    elem_size,
-                    t_d,
-                    rows,
-                    b_d_start,
-                    ldb);
-            }
-            else if(lda != rows && ldb == rows)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_h_managed = rocblas_unique_ptr{malloc(temp_byte_size), free};
-                void* t_h         = t_h_managed.get();
-                if(!t_h)
-                    return rocblas_status_memory_error;
-                // non-contiguous host matrix -> host buffer
-                for(size_t i_t = 0, i_a = i_start; i_t < n_cols_max; i_t++, i_a++)
-                {
-                    memcpy((char*)t_h + i_t * ldt_h_byte,
-                           (const char*)a_h + i_a * lda_h_byte,
-                           ldt_h_byte);
-                }
-                // host buffer -> contiguous device matrix
-                PRINT_IF_HIP_ERROR(hipMemcpy(b_d_start, t_h, contig_size, hipMemcpyHostToDevice));
-            }
-        }
+        int n_cols   = std::min(STAGING_BUFF_BYTES / ldt_h_byte, size_t(cols)); // columns per chunk
+        int n_chunks = ((cols - 1) / n_cols) + 1;
+
+        auto chunk_cols = [=](int i_chunk) { return std::min(cols - i_chunk * n_cols, n_cols); };
+
+        auto pack = [=](int i_chunk, void* t_h) {
+            int         n_cols_max = chunk_cols(i_chunk);
+            const char* a_h_start  = (const char*)a_h + size_t(i_chunk) * n_cols * lda_h_byte;
+
+            if(lda == rows)
+                memcpy(t_h, a_h_start, ldt_h_byte * n_cols_max);
+            else // non-contiguous host matrix -> pinned buffer
+                for(size_t i_t = 0; i_t < size_t(n_cols_max); i_t++)
+                    memcpy((char*)t_h + i_t * ldt_h_byte, a_h_start + i_t * lda_h_byte, ldt_h_byte);
+        };
+
+        auto send = [=](int i_chunk, const void* t_h, void* t_d, hipStream_t stream) {
+            int    n_cols_max  = chunk_cols(i_chunk);
+            size_t contig_size = ldt_h_byte * n_cols_max;
+            void*  b_d_start   = (char*)b_d + size_t(i_chunk) * n_cols * ldb_d_byte;
+
+            if(ldb == rows)
+                return hipMemcpyAsync(b_d_start, t_h, contig_size, hipMemcpyHostToDevice, stream);
+
+            // pinned buffer -> device buffer -> non-contiguous device matrix
+            hipError_t status
+                = hipMemcpyAsync(t_d, t_h, contig_size, hipMemcpyHostToDevice, stream);
+            if(status != hipSuccess)
+                return status;
+            dim3 grid((rows - 1) / MATRIX_DIM_X + 1, (n_cols_max - 1) / MATRIX_DIM_Y + 1);
+            dim3 threads(MATRIX_DIM_X, MATRIX_DIM_Y);
+            hipLaunchKernelGGL((rocblas_copy_void_ptr_matrix_kernel<MATRIX_DIM_X, MATRIX_DIM_Y>),
+                               grid,
+                               threads,
+                               0,
+                               stream,
+                               rows,
+                               n_cols_max,
+                               elem_size,
+                               t_d,
+                               rows,
+                               b_d_start,
+                               ldb);
+            return hipGetLastError();
+        };
+
+        return rocblas_staged_host_to_device(n_chunks, ldb != rows, pack, send);
     }
     return rocblas_status_success;
 }
@@ -897,126 +993,79 @@ try
     if(!a_d || !b_h)
         return rocblas_status_invalid_pointer;
 
+    size_t lda_d_byte = (size_t)elem_size * lda;
+    size_t ldb_h_byte = (size_t)elem_size * ldb;
+    size_t ldt_h_byte = (size_t)elem_size * rows;
+
     // congiguous device matrix -> congiguous host matrix
     if(lda == rows && ldb == rows)
     {
         size_t bytes_to_copy = elem_size * static_cast<size_t>(rows) * cols;
         PRINT_IF_HIP_ERROR(hipMemcpy(b_h, a_d, bytes_to_copy, hipMemcpyDeviceToHost));
     }
-    // columns too large for temp buffer, hipMemcpy column by column
-    else if(rows * elem_size > MAT_BUFF_MAX_BYTES)
+    // columns too large for staging buffer, hipMemcpy column by column
+    else if(ldt_h_byte > STAGING_BUFF_BYTES)
     {
         for(size_t i = 0; i < cols; i++)
         {
-            PRINT_IF_HIP_ERROR(hipMemcpy((char*)b_h + i * ldb * elem_size,
-                                         (const char*)a_d + i * lda * elem_size,
-                                         elem_size * rows,
+            PRINT_IF_HIP_ERROR(hipMemcpy((char*)b_h + i * ldb_h_byte,
+                                         (const char*)a_d + i * lda_d_byte,
+                                         ldt_h_byte,
                                          hipMemcpyDeviceToHost));
         }
     }
-    // columns fit in temp buffer, pack columns in buffer, hipMemcpy device->host, unpack
-    // columns
+    // columns fit in staging buffer, pack columns on the device, hipMemcpyAsync
+    // device->host into pinned buffers, unpack chunks of columns into the host matrix
     else
     {
-        size_t bytes_to_copy = elem_size * static_cast<size_t>(rows) * cols;
-        size_t temp_byte_size
-            = bytes_to_copy < MAT_BUFF_MAX_BYTES ? bytes_to_copy : MAT_BUFF_MAX_BYTES;
-        int n_cols = temp_byte_size / (elem_size * rows); // number of columns in buffer
-        int n_copy = ((cols - 1) / n_cols) + 1; // number times buffer copied
-
-        rocblas_int blocksX = ((rows - 1) / MATRIX_DIM_X) + 1; // parameters for device kernel
-        rocblas_int blocksY = ((n_cols - 1) / MATRIX_DIM_Y) + 1;
-        dim3        grid(blocksX, blocksY);
-        dim3        threads(MATRIX_DIM_X, MATRIX_DIM_Y);
-
-        size_t lda_d_byte = (size_t)elem_size * lda;
-        size_t ldb_h_byte = (size_t)elem_size * ldb;
-        size_t ldt_h_byte = (size_t)elem_size * rows;
-
-        for(int i_copy = 0; i_copy < n_copy; i_copy++)
-        {
-            int         i_start     = i_copy * n_cols;
-            int         n_cols_max  = cols - i_start < n_cols ? cols - i_start : n_cols;
-            size_t      contig_size = elem_size * (size_t)rows * n_cols_max;
-            const void* a_d_start   = (const char*)a_d + i_start * lda_d_byte;
-            void*       b_h_start   = (char*)b_h + i_start * ldb_h_byte;
-            if(lda != rows && ldb != rows)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_h_managed = rocblas_unique_ptr{malloc(temp_byte_size), free};
-                void* t_h         = t_h_managed.get();
-                if(!t_h)
-                    return rocblas_status_memory_error;
-                auto  t_d_managed = rocblas_unique_ptr{device_malloc(temp_byte_size), device_free};
-                void* t_d         = t_d_managed.get();
-                if(!t_d)
-                    return rocblas_status_memory_error;
-                // non-contiguous device matrix -> device buffer
-                hipLaunchKernelGGL(
-                    (rocblas_copy_void_ptr_matrix_kernel<MATRIX_DIM_X, MATRIX_DIM_Y>),
-                    grid,
-                    threads,
-                    0,
-                    0,
-                    rows,
-                    n_cols_max,
-                    elem_size,
-                    a_d_start,
-                    lda,
-                    t_d,
-                    rows);
-                // device buffer -> host buffer
-                PRINT_IF_HIP_ERROR(hipMemcpy(t_h, t_d, contig_size, hipMemcpyDeviceToHost));
-                // host buffer -> non-contiguous host matrix
-                for(size_t i_t = 0, i_b = i_start; i_t < n_cols_max; i_t++, i_b++)
-                {
-                    memcpy((char*)b_h + i_b * ldb_h_byte,
+        int n_cols   = std::min(STAGING_BUFF_BYTES / ldt_h_byte, size_t(cols)); // columns per chunk
+        int n_chunks = ((cols - 1) / n_cols) + 1;
+
+        auto chunk_cols = [=](int i_chunk) { return std::min(cols - i_chunk * n_cols, n_cols); };
+
+        auto receive = [=](int i_chunk, void* t_h, void* t_d, hipStream_t stream) {
+            int         n_cols_max  = chunk_cols(i_chunk);
+            size_t      contig_size = ldt_h_byte * n_cols_max;
+            const void* a_d_start   = (const char*)a_d + size_t(i_chunk) * n_cols * lda_d_byte;
+
+            if(lda == rows)
+                return hipMemcpyAsync(t_h, a_d_start, contig_size, hipMemcpyDeviceToHost, stream);
+
+            // non-contiguous device matrix -> device buffer -> pinned buffer
+            dim3 grid((rows - 1) / MATRIX_DIM_X + 1, (n_cols_max - 1) / MATRIX_DIM_Y + 1);
+            dim3 threads(MATRIX_DIM_X, MATRIX_DIM_Y);
+            hipLaunchKernelGGL((rocblas_copy_void_ptr_matrix_kernel<MATRIX_DIM_X, MATRIX_DIM_Y>),
+                               grid,
+                               threads,
+                               0,
+                               stream,
+                               rows,
+                               n_cols_max,
+                               elem_size,
+                               a_d_start,
+                               lda,
+                               t_d,
+                               rows);
+            hipError_t status = hipGetLastError();
+            if(status != hipSuccess)
+                return status;
+            return hipMemcpyAsync(t_h, t_d, contig_size, hipMemcpyDeviceToHost, stream);
+        };
+
+        auto unpack = [=](int i_chunk, const void* t_h) {
+            int   n_cols_max = chunk_cols(i_chunk);
+            char* b_h_start  = (char*)b_h + size_t(i_chunk) * n_cols * ldb_h_byte;
+
+            if(ldb == rows)
+                memcpy(b_h_start, t_h, ldt_h_byte * n_cols_max);
+            else // pinned buffer -> non-contiguous host matrix
+                for(size_t i_t = 0; i_t < size_t(n_cols_max); i_t++)
+                    memcpy(b_h_start + i_t * ldb_h_byte,
                            (const char*)t_h + i_t * ldt_h_byte,
                            ldt_h_byte);
-                }
-            }
-            else if(lda == rows && ldb != rows)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_h_managed = rocblas_unique_ptr{malloc(temp_byte_size), free};
-                void* t_h         = t_h_managed.get();
-                if(!t_h)
-                    return rocblas_status_memory_error;
-                // congiguous device matrix -> host buffer
-                PRINT_IF_HIP_ERROR(hipMemcpy(t_h, a_d_start, contig_size, hipMemcpyDeviceToHost));
-                // host buffer -> non-contiguous host matrix
-                for(size_t i_t = 0, i_b = i_start; i_t < n_cols_max; i_t++, i_b++)
-                {
-                    memcpy((char*)b_h + i_b * ldb_h_byte,
-                           (const char*)t_h + i_t * ldt_h_byte,
-                           ldt_h_byte);
-                }
-            }
-            else if(lda != rows && ldb == rows)
-            {
-                // used unique_ptr to avoid memory leak
-                auto  t_d_managed = rocblas_unique_ptr{device_malloc(temp_byte_size), device_free};
-                void* t_d         = t_d_managed.get();
-                if(!t_d)
-                    return rocblas_status_memory_error;
-                // non-contiguous device matrix -> device buffer
-                hipLaunchKernelGGL(
-                    (rocblas_copy_void_ptr_matrix_kernel<MATRIX_DIM_X, MATRIX_DIM_Y>),
-                    grid,
-                    threads,
-                    0,
-                    0,
-                    rows,
-                    n_cols_max,
-                    elem_size,
-                    a_d_start,
-                    lda,
-                    t_d,
-                    rows);
-                // device temp buffer -> contiguous host matrix
-                PRINT_IF_HIP_ERROR(hipMemcpy(b_h_start, t_d, contig_size, hipMemcpyDeviceToHost));
-            }
-        }
+        };
+
+        return rocblas_staged_device_to_host(n_chunks, lda != rows, receive, unpack);
     }
     return rocblas_status_success;
 }
@@ -1120,6 +1169,951 @@ catch(...) // catch all exceptions
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ * Batched transfers. A run of consecutive matrices which are adjacent in both
+ * host and device memory is a single 2D copy. Matrices in runs smaller than
+ * BATCHED_DIRECT_BYTES are packed together in the pinned staging buffers,
+ * behind a table of their device addresses, and a kernel scatters them to (or
+ * gathers them from) their device addresses, so that a batch of small
+ * matrices costs a few operations per staging buffer instead of one copy per
+ * matrix.
+ ******************************************************************************/
+constexpr size_t      BATCHED_DIRECT_BYTES = 65536;
+constexpr size_t      BATCHED_TABLE_ALIGN  = 256;
+constexpr rocblas_int BATCHED_NB           = 256;
+
+// Block (b, y) copies elements of matrix b between its device address in the
+// table at t_d and its packed copy after the table of table_bytes bytes
+template <bool SCATTER, rocblas_int NB>
+ROCBLAS_KERNEL(NB)
+rocblas_batched_staging_matrix_kernel(rocblas_int rows,
+                                      rocblas_int cols,
+                                      size_t      elem_size,
+                                      char*       t_d,
+                                      size_t      table_bytes,
+                                      rocblas_int ld)
+{
+    size_t tid = size_t(blockIdx.y) * NB + threadIdx.x;
+    if(tid < size_t(rows) * cols)
+    {
+        size_t i = tid % rows, j = tid / rows;
+        char*  packed = t_d + table_bytes + (size_t(blockIdx.x) * rows * cols + tid) * elem_size;
+        char*  matrix = ((char* const*)t_d)[blockIdx.x] + (i + j * ld) * elem_size;
+        if(SCATTER)
+            memcpy(matrix, packed, elem_size);
+        else
+            memcpy(packed, matrix, elem_size);
+    }
+}
+
+namespace
+{
+    /***************************************************************************
+     * Host to device (h2d) or device to host transfer of batch_count matrices
+     * of rows x cols elements, where host(b) and device(b) are the addresses of
+     * matrix b in host memory, with leading dimension ld_h, and in device
+     * memory, with leading dimension ld_d. The direct copies are enqueued on
+     * stream; the staged matrices have been transferred when it returns.
+     **************************************************************************/
+    template <typename HOST, typename DEVICE>
+    rocblas_status rocblas_transfer_matrix_batched(bool        h2d,
+                                                   rocblas_int rows,
+                                                   rocblas_int cols,
+                                                   rocblas_int elem_size,
+                                                   HOST        host,
+                                                   rocblas_int ld_h,
+                                                   DEVICE      device,
+                                                   rocblas_int ld_d,
+                                                   rocblas_int batch_count,
+                                                   hipStream_t stream)
+    {
+        const size_t col_bytes = size_t(elem_size) * rows;
+        const size_t mat_bytes = col_bytes * cols;
+        const size_t host_next = size_t(elem_size) * ld_h * cols;
+        const size_t dev_next  = size_t(elem_size) * ld_d * cols;
+
+        std::vector<rocblas_int> staged; // matrices of the runs too small to copy directly
+        for(rocblas_int b = 0, run; b < batch_count; b += run)
+        {
+            char* h = host(b);
+            char* d = device(b);
+            for(run = 1; b + run < batch_count; run++)
+                if(host(b + run) != h + run * host_next || device(b + run) != d + run * dev_next)
+                    break;
+
+            // a batch which is a single run is one copy either way
+            if(run < batch_count && size_t(run) * mat_bytes < BATCHED_DIRECT_BYTES)
+            {
+                for(rocblas_int r = 0; r < run; r++)
+                    staged.push_back(b + r);
+                continue;
+            }
+
+            // the run is one matrix of run * cols columns
+            void*       dst  = h2d ? d : h;
+            const void* src  = h2d ? h : d;
+            auto        kind = h2d ? hipMemcpyHostToDevice : hipMemcpyDeviceToHost;
+            if(ld_h == rows && ld_d == rows)
+                RETURN_IF_HIP_ERROR(hipMemcpyAsync(dst, src, mat_bytes * run, kind, stream));
+            else
+                RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(dst,
+                                                     size_t(elem_size) * (h2d ? ld_d : ld_h),
+                                                     src,
+                                                     size_t(elem_size) * (h2d ? ld_h : ld_d),
+                                                     col_bytes,
+                                                     size_t(cols) * run,
+                                                     kind,
+                                                     stream));
+        }
+        if(staged.empty())
+            return rocblas_status_success;
+
+        // matrices per staging buffer, packed after the table of their device addresses
+        auto table_bytes = [](size_t n_mat) {
+            return (n_mat * sizeof(void*) + BATCHED_TABLE_ALIGN - 1) / BATCHED_TABLE_ALIGN
+                   * BATCHED_TABLE_ALIGN;
+        };
+        size_t n_mat = STAGING_BUFF_BYTES / (mat_bytes + sizeof(void*));
+        while(table_bytes(n_mat) + n_mat * mat_bytes > STAGING_BUFF_BYTES)
+            n_mat--;
+        n_mat        = std::min(n_mat, staged.size());
+        int n_chunks = int((staged.size() - 1) / n_mat + 1);
+
+        const rocblas_int* first = staged.data();
+        const size_t       total = staged.size();
+        auto chunk_mats = [=](int i_chunk) { return std::min(total - i_chunk * n_mat, n_mat); };
+
+        auto write_table = [=](int i_chunk, void* t_h) {
+            for(size_t k = 0; k < chunk_mats(i_chunk); k++)
+                ((void**)t_h)[k] = device(first[i_chunk * n_mat + k]);
+        };
+
+        // copies the matrices of a chunk between host memory and the packed copies in t_h
+        auto copy_host = [=](int i_chunk, char* t_h) {
+            size_t n = chunk_mats(i_chunk);
+            char*  t = t_h + table_bytes(n);
+            for(size_t k = 0; k < n; k++, t += mat_bytes)
+            {
+                char* h = host(first[i_chunk * n_mat + k]);
+                for(size_t j = 0; j < size_t(ld_h == rows ? 1 : cols); j++)
+                {
+                    size_t bytes = ld_h == rows ? mat_bytes : col_bytes;
+                    char*  h_col = h + j * ld_h * elem_size;
+                    char*  t_col = t + j * col_bytes;
+                    if(h2d)
+                        memcpy(t_col, h_col, bytes);
+                    else
+                        memcpy(h_col, t_col, bytes);
+                }
+            }
+        };
+
+        auto launch = [=](int i_chunk, void* t_d, hipStream_t stream) {
+            size_t n = chunk_mats(i_chunk);
+            dim3   grid(n, (size_t(rows) * cols - 1) / BATCHED_NB + 1);
+            if(h2d)
+                hipLaunchKernelGGL((rocblas_batched_staging_matrix_kernel<true, BATCHED_NB>),
+                                   grid,
+                                   dim3(BATCHED_NB),
+                                   0,
+                                   stream,
+                                   rows,
+                                   cols,
+                                   size_t(elem_size),
+                                   (char*)t_d,
+                                   table_bytes(n),
+                                   ld_d);
+            else
+                hipLaunchKernelGGL((rocblas_batched_staging_matrix_kernel<false, BATCHED_NB>),
+                                   grid,
+                                   dim3(BATCHED_NB),
+                                   0,
+                                   stream,
+                                   rows,
+                                   cols,
+                                   size_t(elem_size),
+                                   (char*)t_d,
+                                   table_bytes(n),
+                                   ld_d);
+            return hipGetLastError();
+        };
+
+        if(h2d)
+        {
+            auto pack = [=](int i_chunk, void* t_h) {
+                write_table(i_chunk, t_h);
+                copy_host(i_chunk, (char*)t_h);
+            };
+
+            // one upload of the table and the packed matrices, which are scattered on the device
+            auto send = [=](int i_chunk, const void* t_h, void* t_d, hipStream_t stream) {
+                size_t     n      = chunk_mats(i_chunk);
+                hipError_t status = hipMemcpyAsync(
+                    t_d, t_h, table_bytes(n) + n * mat_bytes, hipMemcpyHostToDevice, stream);
+                return status == hipSuccess ? launch(i_chunk, t_d, stream) : status;
+            };
+
+            return rocblas_staged_host_to_device(n_chunks, true, pack, send, stream);
+        }
+
+        // upload of the table, gather on the device and one download of the packed matrices
+        auto receive = [=](int i_chunk, void* t_h, void* t_d, hipStream_t stream) {
+            size_t n  = chunk_mats(i_chunk);
+            size_t tb = table_bytes(n);
+            write_table(i_chunk, t_h);
+            hipError_t status = hipMemcpyAsync(t_d, t_h, tb, hipMemcpyHostToDevice, stream);
+            if(status == hipSuccess)
+                status = launch(i_chunk, t_d, stream);
+            if(status == hipSuccess)
+                status = hipMemcpyAsync((char*)t_h + tb,
+                                        (char*)t_d + tb,
+                                        n * mat_bytes,
+                                        hipMemcpyDeviceToHost,
+                                        stream);
+            return status;
+        };
+
+        auto unpack = [=](int i_chunk, void* t_h) { copy_host(i_chunk, (char*)t_h); };
+
+        return rocblas_staged_device_to_host(n_chunks, true, receive, unpack, stream);
+    }
+
+    rocblas_status rocblas_check_matrix_batched(rocblas_int rows,
+                                                rocblas_int cols,
+                                                rocblas_int elem_size,
+                                                rocblas_int lda,
+                                                rocblas_int ldb,
+                                                rocblas_int batch_count)
+    {
+        if(rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || rows > lda || rows > ldb
+           || elem_size <= 0 || batch_count < 0)
+            return rocblas_status_invalid_size;
+        return rocblas_status_continue;
+    }
+}
+
+/*******************************************************************************
+ *! \brief   copies batch_count void* matrices a_h[b] with leading dimension lda
+     on host to void* matrices b_d[b] with leading dimension ldb on device.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_matrix_batched_async(rocblas_int       rows,
+                                                           rocblas_int       cols,
+                                                           rocblas_int       elem_size,
+                                                           const void* const a_h[],
+                                                           rocblas_int       lda,
+                                                           void* const       b_d[],
+                                                           rocblas_int       ldb,
+                                                           rocblas_int       batch_count,
+                                                           hipStream_t       stream)
+try
+{
+    rocblas_status status
+        = rocblas_check_matrix_batched(rows, cols, elem_size, lda, ldb, batch_count);
+    if(status != rocblas_status_continue)
+        return status;
+    if(rows == 0 || cols == 0 || batch_count == 0) // quick return
+        return rocblas_status_success;
+    if(!a_h || !b_d)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_transfer_matrix_batched(
+        true,
+        rows,
+        cols,
+        elem_size,
+        [=](rocblas_int b) { return (char*)a_h[b]; },
+        lda,
+        [=](rocblas_int b) { return (char*)b_d[b]; },
+        ldb,
+        batch_count,
+        stream);
+}
+catch(...) // catch all exceptions
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ *! \brief   copies batch_count void* matrices a_d[b] with leading dimension lda
+     on device to void* matrices b_h[b] with leading dimension ldb on host.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_matrix_batched_async(rocblas_int       rows,
+                                                           rocblas_int       cols,
+                                                           rocblas_int       elem_size,
+                                                           const void* const a_d[],
+                                                           rocblas_int       lda,
+                                                           void* const       b_h[],
+                                                           rocblas_int       ldb,
+                                                           rocblas_int       batch_count,
+                                                           hipStream_t       stream)
+try
+{
+    rocblas_status status
+        = rocblas_check_matrix_batched(rows, cols, elem_size, lda, ldb, batch_count);
+    if(status != rocblas_status_continue)
+        return status;
+    if(rows == 0 || cols == 0 || batch_count == 0) // quick return
+        return rocblas_status_success;
+    if(!a_d || !b_h)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_transfer_matrix_batched(
+        false,
+        rows,
+        cols,
+        elem_size,
+        [=](rocblas_int b) { return (char*)b_h[b]; },
+        ldb,
+        [=](rocblas_int b) { return (char*)a_d[b]; },
+        lda,
+        batch_count,
+        stream);
+}
+catch(...) // catch all exceptions
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ *! \brief   copies batch_count void* matrices a_h + b * stride_a with leading
+     dimension lda on host to void* matrices b_d + b * stride_b with leading
+     dimension ldb on device. Strides are in elements.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_matrix_strided_batched_async(rocblas_int    rows,
+                                                                   rocblas_int    cols,
+                                                                   rocblas_int    elem_size,
+                                                                   const void*    a_h,
+                                                                   rocblas_int    lda,
+                                                                   rocblas_stride stride_a,
+                                                                   void*          b_d,
+                                                                   rocblas_int    ldb,
+                                                                   rocblas_stride stride_b,
+                                                                   rocblas_int    batch_count,
+                                                                   hipStream_t    stream)
+try
+{
+    rocblas_status status
+        = rocblas_check_matrix_batched(rows, cols, elem_size, lda, ldb, batch_count);
+    if(status != rocblas_status_continue)
+        return status;
+    if(rows == 0 || cols == 0 || batch_count == 0) // quick return
+        return rocblas_status_success;
+    if(!a_h || !b_d)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_transfer_matrix_batched(
+        true,
+        rows,
+        cols,
+        elem_size,
+        [=](rocblas_int b) { return (char*)a_h + b * stride_a * elem_size; },
+        lda,
+        [=](rocblas_int b) { return (char*)b_d + b * stride_b * elem_size; },
+        ldb,
+        batch_count,
+        stream);
+}
+catch(...) // catch all exceptions
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ *! \brief   copies batch_count void* matrices a_d + b * stride_a with leading
+     dimension lda on device to void* matrices b_h + b * stride_b with leading
+     dimension ldb on host. Strides are in elements.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_matrix_strided_batched_async(rocblas_int    rows,
+                                                                   rocblas_int    cols,
+                                                                   rocblas_int    elem_size,
+                                                                   const void*    a_d,
+                                                                   rocblas_int    lda,
+                                                                   rocblas_stride stride_a,
+                                                                   void*          b_h,
+                                                                   rocblas_int    ldb,
+                                                                   rocblas_stride stride_b,
+                                                                   rocblas_int    batch_count,
+                                                                   hipStream_t    stream)
+try
+{
+    rocblas_status status
+        = rocblas_check_matrix_batched(rows, cols, elem_size, lda, ldb, batch_count);
+    if(status != rocblas_status_continue)
+        return status;
+    if(rows == 0 || cols == 0 || batch_count == 0) // quick return
+        return rocblas_status_success;
+    if(!a_d || !b_h)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_transfer_matrix_batched(
+        false,
+        rows,
+        cols,
+        elem_size,
+        [=](rocblas_int b) { return (char*)b_h + b * stride_b * elem_size; },
+        ldb,
+        [=](rocblas_int b) { return (char*)a_d + b * stride_a * elem_size; },
+        lda,
+        batch_count,
+        stream);
+}
+catch(...) // catch all exceptions
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * The batched vector transfers are those of the matrices of n rows with
+ * contiguous vectors, and of a single row otherwise.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_vector_batched_async(rocblas_int       n,
+                                                           rocblas_int       elem_size,
+                                                           const void* const x_h[],
+                                                           rocblas_int       incx,
+                                                           void* const       y_d[],
+                                                           rocblas_int       incy,
+                                                           rocblas_int       batch_count,
+                                                           hipStream_t       stream)
+{
+    if(n < 0 || incx <= 0 || incy <= 0)
+        return rocblas_status_invalid_size;
+    if(incx == 1 && incy == 1)
+        return rocblas_set_matrix_batched_async(
+            n, 1, elem_size, x_h, std::max(n, 1), y_d, std::max(n, 1), batch_count, stream);
+    return rocblas_set_matrix_batched_async(
+        1, n, elem_size, x_h, incx, y_d, incy, batch_count, stream);
+}
+
+extern "C" rocblas_status rocblas_get_vector_batched_async(rocblas_int       n,
+                                                           rocblas_int       elem_size,
+                                                           const void* const x_d[],
+                                                           rocblas_int       incx,
+                                                           void* const       y_h[],
+                                                           rocblas_int       incy,
+                                                           rocblas_int       batch_count,
+                                                           hipStream_t       stream)
+{
+    if(n < 0 || incx <= 0 || incy <= 0)
+        return rocblas_status_invalid_size;
+    if(incx == 1 && incy == 1)
+        return rocblas_get_matrix_batched_async(
+            n, 1, elem_size, x_d, std::max(n, 1), y_h, std::max(n, 1), batch_count, stream);
+    return rocblas_get_matrix_batched_async(
+        1, n, elem_size, x_d, incx, y_h, incy, batch_count, stream);
+}
+
+extern "C" rocblas_status rocblas_set_vector_strided_batched_async(rocblas_int    n,
+                                                                   rocblas_int    elem_size,
+                                                                   const void*    x_h,
+                                                                   rocblas_int    incx,
+                                                                   rocblas_stride stride_x,
+                                                                   void*          y_d,
+                                                                   rocblas_int    incy,
+                                                                   rocblas_stride stride_y,
+                                                                   rocblas_int    batch_count,
+                                                                   hipStream_t    stream)
+{
+    if(n < 0 || incx <= 0 || incy <= 0)
+        return rocblas_status_invalid_size;
+    if(incx == 1 && incy == 1)
+        return rocblas_set_matrix_strided_batched_async(n,
+                                                        1,
+                                                        elem_size,
+                                                        x_h,
+                                                        std::max(n, 1),
+                                                        stride_x,
+                                                        y_d,
+                                                        std::max(n, 1),
+                                                        stride_y,
+                                                        batch_count,
+                                                        stream);
+    return rocblas_set_matrix_strided_batched_async(
+        1, n, elem_size, x_h, incx, stride_x, y_d, incy, stride_y, batch_count, stream);
+}
+
+extern "C" rocblas_status rocblas_get_vector_strided_batched_async(rocblas_int    n,
+                                                                   rocblas_int    elem_size,
+                                                                   const void*    x_d,
+                                                                   rocblas_int    incx,
+                                                                   rocblas_stride stride_x,
+                                                                   void*          y_h,
+                                                                   rocblas_int    incy,
+                                                                   rocblas_stride stride_y,
+                                                                   rocblas_int    batch_count,
+                                                                   hipStream_t    stream)
+{
+    if(n < 0 || incx <= 0 || incy <= 0)
+        return rocblas_status_invalid_size;
+    if(incx == 1 && incy == 1)
+        return rocblas_get_matrix_strided_batched_async(n,
+                                                        1,
+                                                        elem_size,
+                                                        x_d,
+                                                        std::max(n, 1),
+                                                        stride_x,
+                                                        y_h,
+                                                        std::max(n, 1),
+                                                        stride_y,
+                                                        batch_count,
+                                                        stream);
+    return rocblas_get_matrix_strided_batched_async(
+        1, n, elem_size, x_d, incx, stride_x, y_h, incy, stride_y, batch_count, stream);
+}
+
+/*******************************************************************************
+ * Transfers with a conversion of the elements on the host, into or out of the
+ * pinned staging buffers, so that only the narrower device type crosses the
+ * link. The float and 16-bit conversions are the SIMD bulk conversions.
+ ******************************************************************************/
+namespace
+{
+    using rocblas_host_convert_fn = void (*)(size_t n, const void* x, void* y);
+
+    template <typename Ti, typename To>
+    void rocblas_host_convert(size_t n, const void* x, void* y)
+    {
+        auto xi = static_cast<const Ti*>(x);
+        auto yo = static_cast<To*>(y);
+        for(size_t i = 0; i < n; i++)
+            yo[i] = To(xi[i]);
+    }
+
+    // Conversion between a host type and a narrower device type, or nullptr
+    rocblas_host_convert_fn rocblas_host_convert_function(rocblas_datatype from,
+                                                          rocblas_datatype to)
+    {
+        if(from == rocblas_datatype_f32_r && to == rocblas_datatype_f16_r)
+            return [](size_t n, const void* x, void* y) {
+                rocblas_convert_float_to_half(n, (const float*)x, (rocblas_half*)y);
+            };
+        if(from == rocblas_datatype_f32_r && to == rocblas_datatype_bf16_r)
+            return [](size_t n, const void* x, void* y) {
+                rocblas_convert_float_to_bfloat16(n, (const float*)x, (rocblas_bfloat16*)y, false);
+            };
+        if(from == rocblas_datatype_f64_r && to == rocblas_datatype_f32_r)
+            return rocblas_host_convert<double, float>;
+        if(from == rocblas_datatype_f16_r && to == rocblas_datatype_f32_r)
+            return [](size_t n, const void* x, void* y) {
+                rocblas_convert_half_to_float(n, (const rocblas_half*)x, (float*)y);
+            };
+        if(from == rocblas_datatype_bf16_r && to == rocblas_datatype_f32_r)
+            return [](size_t n, const void* x, void* y) {
+                rocblas_convert_bfloat16_to_float(n, (const rocblas_bfloat16*)x, (float*)y);
+            };
+        if(from == rocblas_datatype_f32_r && to == rocblas_datatype_f64_r)
+            return rocblas_host_convert<float, double>;
+        return nullptr;
+    }
+
+    /***************************************************************************
+     * Chunks of a rows x cols matrix of elem_size byte elements which fit in a
+     * staging buffer: whole columns while a column fits, otherwise segments of
+     * a single column
+     **************************************************************************/
+    struct rocblas_staging_chunks
+    {
+        rocblas_int rows_per_chunk, cols_per_chunk, row_chunks, col_chunks;
+        rocblas_int rows, cols;
+
+        rocblas_staging_chunks(rocblas_int rows, rocblas_int cols, size_t elem_size)
+            : rows(rows)
+            , cols(cols)
+        {
+            rows_per_chunk = rocblas_int(std::min(size_t(rows), STAGING_BUFF_BYTES / elem_size));
+            cols_per_chunk
+                = rows_per_chunk < rows
+                      ? 1
+                      : rocblas_int(std::min(size_t(cols),
+                                             STAGING_BUFF_BYTES / (elem_size * rows)));
+            row_chunks = (rows - 1) / rows_per_chunk + 1;
+            col_chunks = (cols - 1) / cols_per_chunk + 1;
+        }
+
+        int count() const
+        {
+            return row_chunks * col_chunks;
+        }
+
+        // first row, first column, and number of rows and columns of chunk i
+        void get(int i, rocblas_int& r0, rocblas_int& c0, rocblas_int& nr, rocblas_int& nc) const
+        {
+            r0 = (i % row_chunks) * rows_per_chunk;
+            c0 = (i / row_chunks) * cols_per_chunk;
+            nr = std::min(rows - r0, rows_per_chunk);
+            nc = std::min(cols - c0, cols_per_chunk);
+        }
+    };
+}
+
+/*******************************************************************************
+ *! \brief   copies matrix a_h of type a_type with leading dimension lda on host
+     to matrix b_d of type b_type with leading dimension ldb on device,
+     converting the elements on the host. Matrices have size rows * cols.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_matrix_ex(rocblas_int      rows,
+                                                rocblas_int      cols,
+                                                const void*      a_h,
+                                                rocblas_datatype a_type,
+                                                rocblas_int      lda,
+                                                void*            b_d,
+                                                rocblas_datatype b_type,
+                                                rocblas_int      ldb)
+try
+{
+    if(a_type == b_type)
+        return rocblas_set_matrix(
+            rows, cols, rocblas_int(rocblas_sizeof_datatype(a_type)), a_h, lda, b_d, ldb);
+
+    rocblas_host_convert_fn convert = rocblas_host_convert_function(a_type, b_type);
+    size_t                  a_size  = rocblas_sizeof_datatype(a_type);
+    size_t                  b_size  = rocblas_sizeof_datatype(b_type);
+
+    // Only conversions to a narrower device type reduce the bytes transferred
+    if(!convert || b_size >= a_size)
+        return rocblas_status_not_implemented;
+    if(rows == 0 || cols == 0) // quick return
+        return rocblas_status_success;
+    if(rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || rows > lda || rows > ldb)
+        return rocblas_status_invalid_size;
+    if(!a_h || !b_d)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_staging_chunks chunks(rows, cols, b_size);
+
+    auto pack = [=](int i_chunk, void* t_h) {
+        rocblas_int r0, c0, nr, nc;
+        chunks.get(i_chunk, r0, c0, nr, nc);
+        for(rocblas_int j = 0; j < nc; j++)
+            convert(nr,
+                    (const char*)a_h + ((c0 + j) * size_t(lda) + r0) * a_size,
+                    (char*)t_h + size_t(j) * nr * b_size);
+    };
+
+    auto send = [=](int i_chunk, const void* t_h, void* t_d, hipStream_t stream) {
+        rocblas_int r0, c0, nr, nc;
+        chunks.get(i_chunk, r0, c0, nr, nc);
+        size_t contig_size = size_t(nr) * nc * b_size;
+        void*  b_d_start   = (char*)b_d + (c0 * size_t(ldb) + r0) * b_size;
+
+        if(nc == 1 || ldb == nr)
+            return hipMemcpyAsync(b_d_start, t_h, contig_size, hipMemcpyHostToDevice, stream);
+
+        // pinned buffer -> device buffer -> non-contiguous device matrix
+        hipError_t status = hipMemcpyAsync(t_d, t_h, contig_size, hipMemcpyHostToDevice, stream);
+        if(status != hipSuccess)
+            return status;
+        dim3 grid((nr - 1) / MATRIX_DIM_X + 1, (nc - 1) / MATRIX_DIM_Y + 1);
+        dim3 threads(MATRIX_DIM_X, MATRIX_DIM_Y);
+        hipLaunchKernelGGL((rocblas_copy_void_ptr_matrix_kernel<MATRIX_DIM_X, MATRIX_DIM_Y>),
+                           grid,
+                           threads,
+                           0,
+                           stream,
+                           nr,
+                           nc,
+                           b_size,
+                           t_d,
+                           nr,
+                           b_d_start,
+                           ldb);
+        return hipGetLastError();
+    };
+
+    return rocblas_staged_host_to_device(chunks.count(), ldb != rows, pack, send);
+}
+catch(...) // catch all exceptions
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ *! \brief   copies matrix a_d of type a_type with leading dimension lda on
+     device to matrix b_h of type b_type with leading dimension ldb on host,
+     converting the elements on the host. Matrices have size rows * cols.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_matrix_ex(rocblas_int      rows,
+                                                rocblas_int      cols,
+                                                const void*      a_d,
+                                                rocblas_datatype a_type,
+                                                rocblas_int      lda,
+                                                void*            b_h,
+                                                rocblas_datatype b_type,
+                                                rocblas_int      ldb)
+try
+{
+    if(a_type == b_type)
+        return rocblas_get_matrix(
+            rows, cols, rocblas_int(rocblas_sizeof_datatype(a_type)), a_d, lda, b_h, ldb);
+
+    rocblas_host_convert_fn convert = rocblas_host_convert_function(a_type, b_type);
+    size_t                  a_size  = rocblas_sizeof_datatype(a_type);
+    size_t                  b_size  = rocblas_sizeof_datatype(b_type);
+
+    // Only conversions from a narrower device type reduce the bytes transferred
+    if(!convert || a_size >= b_size)
+        return rocblas_status_not_implemented;
+    if(rows == 0 || cols == 0) // quick return
+        return rocblas_status_success;
+    if(rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || rows > lda || rows > ldb)
+        return rocblas_status_invalid_size;
+    if(!a_d || !b_h)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_staging_chunks chunks(rows, cols, a_size);
+
+    auto receive = [=](int i_chunk, void* t_h, void* t_d, hipStream_t stream) {
+        rocblas_int r0, c0, nr, nc;
+        chunks.get(i_chunk, r0, c0, nr, nc);
+        size_t      contig_size = size_t(nr) * nc * a_size;
+        const void* a_d_start   = (const char*)a_d + (c0 * size_t(lda) + r0) * a_size;
+
+        if(nc == 1 || lda == nr)
+            return hipMemcpyAsync(t_h, a_d_start, contig_size, hipMemcpyDeviceToHost, stream);
+
+        // non-contiguous device matrix -> device buffer -> pinned buffer
+        dim3 grid((nr - 1) / MATRIX_DIM_X + 1, (nc - 1) / MATRIX_DIM_Y + 1);
+        dim3 threads(MATRIX_DIM_X, MATRIX_DIM_Y);
+        hipLaunchKernelGGL((rocblas_copy_void_ptr_matrix_kernel<MATRIX_DIM_X, MATRIX_DIM_Y>),
+                           grid,
+                           threads,
+                           0,
+                           stream,
+                           nr,
+                           nc,
+                           a_size,
+                           a_d_start,
+                           lda,
+                           t_d,
+                           nr);
+        hipError_t status = hipGetLastError();
+        if(status != hipSuccess)
+            return status;
+        return hipMemcpyAsync(t_h, t_d, contig_size, hipMemcpyDeviceToHost, stream);
+    };
+
+    auto unpack = [=](int i_chunk, const void* t_h) {
+        rocblas_int r0, c0, nr, nc;
+        chunks.get(i_chunk, r0, c0, nr, nc);
+        for(rocblas_int j = 0; j < nc; j++)
+            convert(nr,
+                    (const char*)t_h + size_t(j) * nr * a_size,
+                    (char*)b_h + ((c0 + j) * size_t(ldb) + r0) * b_size);
+    };
+
+    return rocblas_staged_device_to_host(chunks.count(), lda != rows, receive, unpack);
+}
+catch(...) // catch all exceptions
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ *! \brief   writes the device array of pointers ptr_array[i] = base + i * stride
+     elements of size elem_size, the arrays of pointers of the batched functions
+ ******************************************************************************/
+template <rocblas_int NB>
+ROCBLAS_KERNEL(NB)
+rocblas_set_pointer_array_kernel(rocblas_int    elem_size,
+                                 char*          base,
+                                 rocblas_stride stride,
+                                 rocblas_int    batch_count,
+                                 void**         ptr_array)
+{
+    ptrdiff_t tid = blockIdx.x * blockDim.x + threadIdx.x;
+    if(tid < batch_count)
+        ptr_array[tid] = base + tid * stride * elem_size;
+}
+
+extern "C" rocblas_status rocblas_set_pointer_array(rocblas_handle handle,
+                                                    rocblas_int    elem_size,
+                                                    void*          base,
+                                                    rocblas_stride stride,
+                                                    rocblas_int    batch_count,
+                                                    void**         ptr_array)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(elem_size <= 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(!batch_count) // quick return
+        return rocblas_status_success;
+    if(!base || !ptr_array)
+        return rocblas_status_invalid_pointer;
+
+    dim3 grid((batch_count - 1) / NB_X + 1);
+    dim3 threads(NB_X);
+    hipLaunchKernelGGL((rocblas_set_pointer_array_kernel<NB_X>),
+                       grid,
+                       threads,
+                       0,
+                       handle->get_stream(),
+                       elem_size,
+                       (char*)base,
+                       stride,
+                       batch_count,
+                       ptr_array);
+    return rocblas_status_success;
+}
+catch(...) // catch all exceptions
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ *! \brief   returns the device array of pointers ptr_array[i] = base + i * stride
+     elements of size elem_size from the cache of the handle, writing it only the
+     first time it is requested
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_pointer_array(rocblas_handle handle,
+                                                    rocblas_int    elem_size,
+                                                    void*          base,
+                                                    rocblas_stride stride,
+                                                    rocblas_int    batch_count,
+                                                    void* const**  ptr_array)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(elem_size <= 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(!ptr_array)
+        return rocblas_status_invalid_pointer;
+    if(!batch_count) // quick return
+    {
+        *ptr_array = nullptr;
+        return rocblas_status_success;
+    }
+    if(!base)
+        return rocblas_status_invalid_pointer;
+
+    void** array  = nullptr;
+    bool   cached = false;
+    RETURN_IF_ROCBLAS_ERROR(
+        handle->get_cached_pointer_array(base, stride * elem_size, batch_count, &array, &cached));
+
+    if(!cached)
+    {
+        dim3 grid((batch_count - 1) / NB_X + 1);
+        dim3 threads(NB_X);
+        hipLaunchKernelGGL((rocblas_set_pointer_array_kernel<NB_X>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           elem_size,
+                           (char*)base,
+                           stride,
+                           batch_count,
+                           array);
+    }
+
+    *ptr_array = array;
+    return rocblas_status_success;
+}
+catch(...) // catch all exceptions
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ *! \brief   detects whether device arrays of pointers are arithmetic progressions,
+     so that the batched functions can run their strided batched implementations
+ ******************************************************************************/
+constexpr int ROCBLAS_MAX_DETECTED_POINTER_ARRAYS = 4;
+
+struct rocblas_detected_pointer_arrays
+{
+    const char* const* array[ROCBLAS_MAX_DETECTED_POINTER_ARRAYS];
+};
+
+// mismatch[blockIdx.y] is set if a pointer of array blockIdx.y is not in the progression of its
+// first two pointers
+template <rocblas_int NB>
+ROCBLAS_KERNEL(NB)
+rocblas_pointer_array_stride_kernel(rocblas_int                     batch_count,
+                                    rocblas_detected_pointer_arrays arrays,
+                                    int*                            mismatch)
+{
+    ptrdiff_t          tid = blockIdx.x * blockDim.x + threadIdx.x;
+    const char* const* a   = arrays.array[blockIdx.y];
+    if(a && tid >= 2 && tid < batch_count && a[tid] - a[0] != tid * (a[1] - a[0]))
+        mismatch[blockIdx.y] = 1;
+}
+
+bool rocblas_internal_detect_pointer_array_strides(rocblas_handle     handle,
+                                                   rocblas_int        batch_count,
+                                                   int                count,
+                                                   const void* const* arrays,
+                                                   const size_t*      elem_sizes,
+                                                   void**             bases,
+                                                   rocblas_stride*    strides)
+try
+{
+    if(!handle->batched_stride_detection || batch_count < 2 || count < 1
+       || count > ROCBLAS_MAX_DETECTED_POINTER_ARRAYS || handle->is_graph_safe())
+        return false;
+
+    auto w_mem = handle->device_malloc(sizeof(int) * count);
+    if(!w_mem)
+        return false;
+    int* mismatch = (int*)w_mem;
+
+    hipStream_t                     stream = handle->get_stream();
+    rocblas_detected_pointer_arrays d_arrays{};
+    for(int j = 0; j < count; j++)
+        d_arrays.array[j] = (const char* const*)arrays[j];
+
+    if(hipMemsetAsync(mismatch, 0, sizeof(int) * count, stream) != hipSuccess)
+        return false;
+
+    dim3 grid((batch_count - 1) / NB_X + 1, count);
+    dim3 threads(NB_X);
+    hipLaunchKernelGGL((rocblas_pointer_array_stride_kernel<NB_X>),
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       batch_count,
+                       d_arrays,
+                       mismatch);
+
+    // The first two pointers of each array give its base and stride
+    const char* heads[ROCBLAS_MAX_DETECTED_POINTER_ARRAYS][2];
+    int         h_mismatch[ROCBLAS_MAX_DETECTED_POINTER_ARRAYS];
+    for(int j = 0; j < count; j++)
+        if(arrays[j]
+           && hipMemcpyAsync(heads[j], arrays[j], sizeof(heads[j]), hipMemcpyDeviceToHost, stream)
+                  != hipSuccess)
+            return false;
+    if(hipMemcpyAsync(h_mismatch, mismatch, sizeof(int) * count, hipMemcpyDeviceToHost, stream)
+           != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return false;
+
+    for(int j = 0; j < count; j++)
+    {
+        if(!arrays[j])
+        {
+            bases[j]   = nullptr;
+            strides[j] = 0;
+            continue;
+        }
+
+        ptrdiff_t bytes = heads[j][1] - heads[j][0];
+        if(h_mismatch[j] || bytes < 0 || bytes % elem_sizes[j])
+            return false;
+
+        bases[j]   = (void*)heads[j][0];
+        strides[j] = bytes / ptrdiff_t(elem_sizes[j]);
+    }
+    return true;
+}
+catch(...)
+{
+    return false;
+}
+
 // Convert rocblas_status to string
 extern "C" const char* rocblas_status_to_string(rocblas_status status)
 {
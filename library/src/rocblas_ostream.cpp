@@ -24,6 +24,7 @@
 static void rocblas_abort_once [[noreturn]] ();
 
 #include "rocblas_ostream.hpp"
+#include <algorithm>
 #include <csignal>
 #include <fcntl.h>
 #include <iostream>
@@ -146,8 +147,9 @@ std::shared_ptr<rocblas_internal_ostream::worker> rocblas_internal_ostream::get_
 }
 
 // Construct rocblas_internal_ostream from a file descriptor
-rocblas_internal_ostream::rocblas_internal_ostream(int fd)
+rocblas_internal_ostream::rocblas_internal_ostream(int fd, bool sync)
     : m_worker_ptr(get_worker(fd))
+    , m_sync(sync)
 {
     if(!m_worker_ptr)
     {
@@ -172,6 +174,29 @@ rocblas_internal_ostream::rocblas_internal_ostream(const char* filename)
 rocblas_internal_ostream::~rocblas_internal_ostream()
 {
     flush(); // Flush any pending IO
+
+    // Wait for the output to be written
+    if(m_ring)
+        m_worker_ptr->close(m_ring);
+}
+
+// Move assignment writes the output of this stream before replacing it
+rocblas_internal_ostream& rocblas_internal_ostream::operator=(rocblas_internal_ostream&& other) &
+{
+    if(this != &other)
+    {
+        flush();
+        if(m_ring)
+            m_worker_ptr->close(m_ring);
+
+        m_os         = std::move(other.m_os);
+        m_worker_ptr = std::move(other.m_worker_ptr);
+        m_ring       = std::move(other.m_ring);
+        m_sync       = other.m_sync;
+        m_yaml       = other.m_yaml;
+        m_csv        = other.m_csv;
+    }
+    return *this;
 }
 
 // Flush the output
@@ -183,9 +208,13 @@ void rocblas_internal_ostream::flush()
         // The contents of the string buffer
         auto str = m_os.str();
 
-        // Empty string buffers kill the worker thread, so they are not flushed here
+        // Empty string buffers are not sent
         if(str.size())
-            m_worker_ptr->send(std::move(str));
+        {
+            m_worker_ptr->send(m_ring, std::move(str));
+            if(m_sync)
+                m_worker_ptr->wait_written(*m_ring);
+        }
 
         // Clear the string buffer
         clear();
@@ -195,6 +224,12 @@ void rocblas_internal_ostream::flush()
 void rocblas_internal_ostream::clear_workers()
 {
     std::lock_guard<std::recursive_mutex> lock(worker_map_mutex());
+
+    // The workers of the streams still open are only destroyed with their streams, but all the
+    // output sent so far is written
+    for(auto& file_worker : worker_map())
+        if(file_worker.second)
+            file_worker.second->wait_all_written();
     worker_map().clear();
 }
 
@@ -213,97 +248,174 @@ std::ostream& rocblas_internal_ostream::yaml_off(std::ostream& os)
  * rocblas_internal_ostream::worker functions handle logging in a single thread *
  ***********************************************************************/
 
-// Send a string to the worker thread for this stream's device/inode
-// Empty strings tell the worker thread to exit
-void rocblas_internal_ostream::worker::send(std::string str)
+// Wait on ring until done() is true
+template <typename F>
+void rocblas_internal_ostream::worker::wait(ring_t& ring, F done)
 {
-    // Create a promise to wait for the operation to complete
-    std::promise<void> promise;
+    if(done())
+        return;
+
+    // The worker checks for waiters after updating the ring, so one of the two sees the other
+    std::unique_lock<std::mutex> lock(ring.m_mutex);
+    ring.m_waiters++;
+    ring.m_cond.wait(lock, done);
+    ring.m_waiters--;
+}
 
-    // The future indicating when the operation has completed
-    auto future = promise.get_future();
+// Send a string through ring to the worker thread for this stream's device/inode
+void rocblas_internal_ostream::worker::send(std::shared_ptr<ring_t>& ring, std::string str)
+{
+    // Open the ring with the first string
+    if(!ring)
+    {
+        ring = std::make_shared<ring_t>();
+        std::lock_guard<std::mutex> lock(m_rings_mutex);
+        m_rings.push_back(ring);
+    }
 
-#ifdef WIN32
-    // Passing an empty string will make the worker thread exit.
-    // The below flag will be used to handle worker thread exit condition for Windows
-    bool empty_string = str.empty();
-#endif
+    // Wait for a free slot if the ring is full
+    size_t head = ring->m_head.load(std::memory_order_relaxed);
+    if(head - ring->m_tail.load(std::memory_order_acquire) == ring_t::CAPACITY)
+        wait(*ring, [&] { return head - ring->m_tail.load() < ring_t::CAPACITY; });
 
-    // task_t consists of string and promise
-    // std::move transfers ownership of str and promise to task
-    task_t worker_task(std::move(str), std::move(promise));
+    // Publish the string; only this thread writes the slots which the worker has read
+    ring->m_slots[head % ring_t::CAPACITY] = std::move(str);
+    ring->m_head.store(head + 1);
 
-    // Submit the task to the worker assigned to this device/inode
-    // Hold mutex for as short as possible, to reduce contention
+    // Wake up the worker thread if it is waiting for strings. The worker announces that it
+    // is sleeping before checking the rings a last time, so one of the two sees the other.
+    if(m_sleeping.load())
     {
         std::lock_guard<std::mutex> lock(m_mutex);
-        m_queue.push(std::move(worker_task));
-
-        // no lock needed for notification but keeping here
+        m_notified = true;
         m_cond.notify_one();
     }
-
-// Wait for the task to be completed, to ensure flushed IO
-#ifdef WIN32
-    if(empty_string)
-        // Occassionaly this thread is not getting the promise set by the 'worker' thread during exit condition.
-        // Added a timed wait to exit after one second, if we do not get the promise from worker thread.
-        future.wait_for(std::chrono::seconds(1));
-    else
-        future.get();
-#else
-    future.get();
-#endif
 }
 
-// Worker thread which serializes data to be written to a device/inode
-void rocblas_internal_ostream::worker::thread_function()
+// Wait for the strings sent through ring to be written
+void rocblas_internal_ostream::worker::wait_written(ring_t& ring)
 {
-    // Clear any errors in the FILE
-    clearerr(m_file);
+    size_t head = ring.m_head.load();
+    wait(ring, [&] { return ring.m_written.load() >= head; });
+}
 
-    // Lock the mutex in preparation for cond.wait
-    std::unique_lock<std::mutex> lock(m_mutex);
+// Wait for the strings sent through ring to be written, and close it
+void rocblas_internal_ostream::worker::close(std::shared_ptr<ring_t>& ring)
+{
+    wait_written(*ring);
+    {
+        std::lock_guard<std::mutex> lock(m_rings_mutex);
+        m_rings.erase(std::find(m_rings.begin(), m_rings.end(), ring));
+    }
+    ring.reset();
+}
 
-    while(true)
+// Wait for the strings sent through all rings to be written
+void rocblas_internal_ostream::worker::wait_all_written()
+{
+    std::vector<std::shared_ptr<ring_t>> rings;
     {
-        // Wait for any data, ignoring spurious wakeups, locks lock on continue
-        m_cond.wait(lock, [&] { return !m_queue.empty(); });
+        std::lock_guard<std::mutex> lock(m_rings_mutex);
+        rings = m_rings;
+    }
+    for(auto& ring : rings)
+        wait_written(*ring);
+}
 
-        // With the mutex locked, get and pop data from the front of queue
-        task_t task = std::move(m_queue.front());
-        m_queue.pop();
+// Move the unread strings of the rings into batch
+size_t rocblas_internal_ostream::worker::collect(
+    std::string& batch, std::vector<std::pair<std::shared_ptr<ring_t>, size_t>>& read)
+{
+    std::lock_guard<std::mutex> lock(m_rings_mutex);
 
-        // Temporarily unlock queue mutex, unblocking other threads
-        lock.unlock();
+    size_t count = 0;
+    for(auto& ring : m_rings)
+    {
+        size_t tail = ring->m_tail.load(std::memory_order_relaxed);
+        size_t head = ring->m_head.load();
+        if(tail == head)
+            continue;
 
-        // An empty message indicates the closing of the stream
-        if(!task.size())
+        for(size_t i = tail; i != head; ++i)
         {
-            // Tell future to wake up
-            task.set_value();
-            break;
+            std::string& slot = ring->m_slots[i % ring_t::CAPACITY];
+            batch += slot;
+            slot.clear();
         }
+        read.emplace_back(ring, head);
+        count += head - tail;
+    }
+    return count;
+}
 
-        // Write the data
-        fwrite(task.data(), 1, task.size(), m_file);
+// Whether all rings are empty
+bool rocblas_internal_ostream::worker::empty()
+{
+    std::lock_guard<std::mutex> lock(m_rings_mutex);
+    for(auto& ring : m_rings)
+        if(ring->m_tail.load(std::memory_order_relaxed) != ring->m_head.load())
+            return false;
+    return true;
+}
 
-        // Detect any error and flush the C FILE stream
-        if(ferror(m_file) || fflush(m_file))
-        {
-            perror("Error writing log file");
+// Worker thread which serializes data to be written to a device/inode
+void rocblas_internal_ostream::worker::thread_function()
+{
+    // Clear any errors in the FILE
+    clearerr(m_file);
 
-            // Tell future to wake up
-            task.set_value();
-            break;
-        }
+    bool                                                    failed = false;
+    std::string                                             batch;
+    std::vector<std::pair<std::shared_ptr<ring_t>, size_t>> read;
 
-        // Promise that the data has been written
-        task.set_value();
+    while(true)
+    {
+        if(collect(batch, read))
+        {
+            // Write the strings of all rings at once. After an error the strings are dropped,
+            // so that the streams do not wait for them forever.
+            if(!failed)
+            {
+                fwrite(batch.data(), 1, batch.size(), m_file);
+
+                // Detect any error and flush the C FILE stream
+                if(ferror(m_file) || fflush(m_file))
+                {
+                    perror("Error writing log file");
+                    failed = true;
+                }
+            }
+            batch.clear();
+
+            // Free the slots read, and wake up the threads waiting for them to be written
+            for(auto& ring_read : read)
+            {
+                ring_t& ring = *ring_read.first;
+                ring.m_tail.store(ring_read.second, std::memory_order_release);
+                ring.m_written.store(ring_read.second);
+                if(ring.m_waiters.load())
+                {
+                    std::lock_guard<std::mutex> lock(ring.m_mutex);
+                    ring.m_cond.notify_all();
+                }
+            }
+            read.clear();
+            continue;
+        }
 
-        // Re-lock the mutex in preparation for cond.wait
-        lock.lock();
+        // Wait for strings, or for the worker to be destroyed once all rings are closed
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if(m_exit)
+            break;
+        m_sleeping.store(true);
+        if(empty())
+            m_cond.wait(lock, [&] { return m_notified || m_exit; });
+        m_notified = false;
+        m_sleeping.store(false);
     }
+
+    // Tell the destructor that the thread has exited
+    m_exited.set_value();
 }
 
 // Constructor creates a worker thread from a file descriptor
@@ -332,8 +444,21 @@ rocblas_internal_ostream::worker::worker(int fd)
 
 rocblas_internal_ostream::worker::~worker()
 {
-    // Tell worker thread to exit, by sending it an empty string
-    send({});
+    // Tell worker thread to exit
+    auto exited = m_exited.get_future();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_exit = true;
+        m_cond.notify_one();
+    }
+
+#ifdef WIN32
+    // Occassionaly this thread is not getting the promise set by the 'worker' thread during exit
+    // condition. Added a timed wait to exit after one second, if we do not get the promise.
+    exited.wait_for(std::chrono::seconds(1));
+#else
+    exited.get();
+#endif
 
     // Close the FILE
     if(m_file)
@@ -31,7 +31,9 @@ extern "C" void rocblas_shutdown();
  * or reference Tensile identifiers. tensile_host.hpp defines the interface. *
  *****************************************************************************/
 
+#include "device_power.hpp"
 #include "tensile_host.hpp"
+#include "tuning_db.hpp"
 //#include <Tensile/AMDGPU.hpp>
 #include <Tensile/Contractions.hpp>
 #include <Tensile/EmbeddedLibrary.hpp>
@@ -43,14 +45,22 @@ extern "C" void rocblas_shutdown();
 #include <Tensile/hip/HipHardware.hpp>
 #include <Tensile/hip/HipSolutionAdapter.hpp>
 #include <Tensile/hip/HipUtils.hpp>
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cmath>
 #include <complex>
 #include <exception>
 #include <future>
 #include <iomanip>
+#include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <set>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -185,11 +195,16 @@ namespace
     // to reduce fragmentation in the Tensile Solution cache
     constexpr size_t HPA_GSU_WORKSPACE_SIZE_GRANULARITY = 256;
 
+    // Solutions measured by the energy efficiency performance metric when autotuning is not
+    // enabled on the handle
+    constexpr rocblas_int ENERGY_AUTOTUNE_CANDIDATES = 8;
+
     Tensile::PerformanceMetric performanceMetricMap(rocblas_performance_metric metric)
     {
         switch(metric)
         {
         case rocblas_cu_efficiency_performance_metric:
+        case rocblas_latency_performance_metric:
             return Tensile::PerformanceMetric::CUEfficiency;
         case rocblas_device_efficiency_performance_metric:
         default:
@@ -215,6 +230,21 @@ namespace
         }
     };
 
+    // Size of GSU workspace available to Tensile. It is max size_t for a size query.
+    size_t AvailableWorkspaceSize(rocblas_handle handle)
+    {
+        return handle->is_device_memory_size_query()
+                   ? ~size_t{0}
+                   : (handle->get_available_workspace() / HPA_GSU_WORKSPACE_SIZE_GRANULARITY)
+                         * HPA_GSU_WORKSPACE_SIZE_GRANULARITY;
+    }
+
+    // Whether the Tensile libraries of the handle's device have xf32 kernels (gfx940-gfx942)
+    bool Xf32Supported(rocblas_handle handle)
+    {
+        return handle->getArch() >= 940 && handle->getArch() <= 942;
+    }
+
     /****************************************************************
      * Construct a Tensile Problem from a RocblasContractionProblem *
      ****************************************************************/
@@ -321,11 +351,7 @@ namespace
                                     prob.buffer_offset_d};
 
         // Size of GSU workspace. We set it to max size_t if this is a size query.
-        size_t workspace_size
-            = prob.handle->is_device_memory_size_query()
-                  ? ~size_t{0}
-                  : (prob.handle->get_available_workspace() / HPA_GSU_WORKSPACE_SIZE_GRANULARITY)
-                        * HPA_GSU_WORKSPACE_SIZE_GRANULARITY;
+        size_t workspace_size = AvailableWorkspaceSize(prob.handle);
 
         // The ContractionProblem
         Tensile::ContractionProblem tensileProblem{a,
@@ -396,9 +422,139 @@ namespace
         else
             tensileProblem.setFp16AltImpl(prob.flags & rocblas_gemm_flags_fp16_alt_impl);
 
+        // xf32 matrix instructions are only requested of the gfx94x libraries for single
+        // precision, so that other devices and types select the same solutions as without it
+        if(std::is_same<Ti, float>{} && std::is_same<To, float>{} && std::is_same<Tc, float>{}
+           && (prob.flags & rocblas_gemm_flags_xf32) && Xf32Supported(prob.handle))
+            tensileProblem.setF32XdlMathOp(Tensile::DataType::XFloat32);
+
         return tensileProblem;
     }
 
+    /*********************************************************************
+     * Construct the key of a RocblasContractionProblem in the handle's   *
+     * solution cache. Every argument and handle mode which can influence *
+     * solution selection in ConstructTensileProblem must be included, so *
+     * that a cached solution is always one Tensile would have selected.  *
+     *********************************************************************/
+    template <typename Ti, typename To, typename Tc>
+    auto ConstructSolutionCacheKey(const RocblasContractionProblem<Ti, To, Tc>& prob)
+    {
+        // alpha==0 is treated as K=0 by ConstructTensileProblem
+        auto k = prob.k && *prob.alpha ? prob.k : 0;
+
+        // Scalar values only matter through their category (0, 1, -1, or other)
+        auto alpha_category = k ? value_category(*prob.alpha) : 0.0;
+        auto beta_category  = value_category(*prob.beta);
+
+        rocblas_solution_cache::key_t key{
+            {uint64_t(tensile_datatype<Ti>) | uint64_t(tensile_datatype<To>) << 8
+                 | uint64_t(tensile_datatype<Tc>) << 16,
+             uint64_t(prob.trans_a),
+             uint64_t(prob.trans_b),
+             uint64_t(prob.flags),
+             uint64_t(prob.strided_batch) | uint64_t(prob.C == prob.D) << 1
+                 | uint64_t(prob.handle->atomics_mode) << 2
+                 | uint64_t(uint32_t(prob.handle->gemm_workgroup_mapping)) << 32,
+             uint64_t(prob.handle->performance_metric)
+                 | uint64_t(prob.handle->performance_metric == rocblas_latency_performance_metric
+                            && prob.handle->is_stream_high_priority())
+                       << 8
+                 | uint64_t(prob.handle->get_cu_count_limit()) << 32,
+             prob.m,
+             prob.n,
+             k,
+             prob.batch_count,
+             prob.row_stride_a,
+             prob.row_stride_b,
+             prob.row_stride_c,
+             prob.row_stride_d,
+             prob.col_stride_a,
+             prob.col_stride_b,
+             prob.col_stride_c,
+             prob.col_stride_d,
+             prob.batch_stride_a,
+             prob.batch_stride_b,
+             prob.batch_stride_c,
+             prob.batch_stride_d,
+             prob.buffer_offset_a,
+             prob.buffer_offset_b,
+             prob.buffer_offset_c,
+             prob.buffer_offset_d,
+             uint64_t(int64_t(alpha_category)) << 32 | uint32_t(int32_t(beta_category)),
+             // Handles of different devices share a thread's problem cache, and the arch
+             // decides xf32 support
+             uint64_t(uint32_t(prob.handle->getDevice()))
+                 | uint64_t(uint32_t(prob.handle->getArch())) << 32}};
+        return key;
+    }
+
+    /*************************************************************
+     * GPU architecture name used to key the tuning database     *
+     * and the Tensile libraries, stripping xnack/ecc as         *
+     * rocblas_internal_get_arch_name does                       *
+     *************************************************************/
+    std::string TuningDBArchName(const hipDeviceProp_t& prop)
+    {
+        std::string gcnArchName(prop.gcnArchName);
+        return gcnArchName.substr(0, gcnArchName.find(":"));
+    }
+
+    /*********************************************************************
+     * Construct the key of a RocblasContractionProblem in the tuning     *
+     * database. It holds the problem, and the handle modes under which   *
+     * it was tuned, but not the workgroup mapping hint or the device,    *
+     * so that entries are shared by all the devices of an arch. It is    *
+     * stored in database files, so rocblas_tuning_db::VERSION must be   *
+     * incremented whenever it changes.                                   *
+     *********************************************************************/
+    template <typename Ti, typename To, typename Tc>
+    auto TuningDBKey(const RocblasContractionProblem<Ti, To, Tc>& prob)
+    {
+        // alpha==0 is treated as K=0 by ConstructTensileProblem
+        auto k = prob.k && *prob.alpha ? prob.k : 0;
+
+        // Scalar values only matter through their category (0, 1, -1, or other)
+        auto alpha_category = k ? value_category(*prob.alpha) : 0.0;
+        auto beta_category  = value_category(*prob.beta);
+
+        rocblas_tuning_db::key_t key{
+            {uint64_t(tensile_datatype<Ti>) | uint64_t(tensile_datatype<To>) << 8
+                 | uint64_t(tensile_datatype<Tc>) << 16,
+             uint64_t(prob.trans_a),
+             uint64_t(prob.trans_b),
+             uint64_t(prob.flags),
+             uint64_t(prob.strided_batch) | uint64_t(prob.C == prob.D) << 1
+                 | uint64_t(prob.handle->atomics_mode) << 2,
+             uint64_t(prob.handle->performance_metric)
+                 | uint64_t(prob.handle->performance_metric == rocblas_latency_performance_metric
+                            && prob.handle->is_stream_high_priority())
+                       << 8
+                 | uint64_t(prob.handle->get_cu_count_limit()) << 32,
+             prob.m,
+             prob.n,
+             k,
+             prob.batch_count,
+             prob.row_stride_a,
+             prob.row_stride_b,
+             prob.row_stride_c,
+             prob.row_stride_d,
+             prob.col_stride_a,
+             prob.col_stride_b,
+             prob.col_stride_c,
+             prob.col_stride_d,
+             prob.batch_stride_a,
+             prob.batch_stride_b,
+             prob.batch_stride_c,
+             prob.batch_stride_d,
+             prob.buffer_offset_a,
+             prob.buffer_offset_b,
+             prob.buffer_offset_c,
+             prob.buffer_offset_d,
+             uint64_t(int64_t(alpha_category)) << 32 | uint32_t(int32_t(beta_category))}};
+        return key;
+    }
+
     /***************************************************************
      * Construct the inputs to a Tensile ContractionProblem        *
      ***************************************************************/
@@ -454,14 +610,86 @@ namespace
         return inputs;
     }
 
+    /**************************************************************************
+     * Tensile problems recently constructed by a thread. A problem is fully  *
+     * determined by its solution cache key and the available workspace, so   *
+     * repeated calls reuse it instead of constructing, and allocating, its   *
+     * tensor descriptors and index lists again.                              *
+     **************************************************************************/
+    class TensileProblemCache
+    {
+        static constexpr size_t SLOTS = 16;
+
+        struct slot_t
+        {
+            rocblas_solution_cache::key_t              key;
+            size_t                                     workspace_size;
+            std::optional<Tensile::ContractionProblem> problem;
+        };
+
+        slot_t slots[SLOTS];
+
+    public:
+        template <typename Ti, typename To, typename Tc>
+        const Tensile::ContractionProblem& get(const RocblasContractionProblem<Ti, To, Tc>& prob,
+                                               const rocblas_solution_cache::key_t&         key,
+                                               uint64_t                                     hash)
+        {
+            slot_t& s              = slots[hash % SLOTS];
+            size_t  workspace_size = AvailableWorkspaceSize(prob.handle);
+            if(!s.problem || s.workspace_size != workspace_size || s.key != key)
+            {
+                s.problem.emplace(ConstructTensileProblem(prob));
+                s.key            = key;
+                s.workspace_size = workspace_size;
+            }
+            return *s.problem;
+        }
+    };
+
+    // Capacity of the solution cache shared by the handles of a device, 0 to disable it
+    static const size_t rocblas_shared_solution_cache_size = [] {
+        constexpr size_t SHARED_SOLUTION_CACHE_SIZE = 4 * rocblas_solution_cache::DEFAULT_CAPACITY;
+        size_t           size;
+        const char*      env = getenv("ROCBLAS_INTERNAL_SHARED_SOLUTION_CACHE_SIZE");
+        return env && sscanf(env, "%zu", &size) == 1 ? size : SHARED_SOLUTION_CACHE_SIZE;
+    }();
+
+    /**************************************************************************
+     * Solutions selected for a device by any handle, looked up when a        *
+     * handle's own cache misses, so that new handles and threads do not      *
+     * repeat solution selection                                              *
+     **************************************************************************/
+    struct shared_solution_cache
+    {
+        rocblas_solution_cache cache{rocblas_shared_solution_cache_size};
+
+        // Generation of the tuning database when the cache was last cleared
+        std::atomic<uint64_t> tuning_db_generation{0};
+    };
+
     /**************************************************
      * The TensileHost struct interfaces with Tensile *
      **************************************************/
     class TensileHost
     {
-        // The library object
-        std::shared_ptr<Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>> m_library;
-        std::shared_ptr<hipDeviceProp_t>                                             m_deviceProp;
+        // The library of a GPU architecture, which is loaded by the first device of the
+        // architecture to be initialized, and shared by the devices of the architecture
+        struct library_s
+        {
+            std::shared_ptr<Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>> library;
+
+            // The library file, decoded asynchronously while the code objects are loaded
+            std::future<std::shared_ptr<Tensile::SolutionLibrary<Tensile::ContractionProblem>>>
+                ftr_lib;
+
+            std::once_flag load_started;
+            std::once_flag load_finished;
+        };
+
+        // The libraries of the architectures of the devices initialized so far, by name
+        std::map<std::string, library_s> m_libraries;
+        std::mutex                       m_libraries_mutex;
 
         // The adapter object. mutable is used to allow adapters to be modified
         // even when they are stored in a const vector which is immutable in size
@@ -469,6 +697,50 @@ namespace
         {
             mutable std::atomic<Tensile::hip::SolutionAdapter*> adapter{nullptr};
             mutable std::mutex                                  mutex;
+
+            // The device properties, Tensile hardware, library and code object directory are
+            // set before the adapter is published and are immutable afterwards, so once the
+            // adapter is seen they are read without locking and without reference counting
+            mutable hipDeviceProp_t                    deviceProp{};
+            mutable std::shared_ptr<Tensile::Hardware> hardware;
+            mutable library_s*                         library = nullptr;
+
+            // The directory of the code object files, if they are loaded lazily
+            mutable std::string codeObjectPath;
+
+            // Tensile hardware of the device restricted to fewer compute units, by count
+            mutable std::map<int, std::shared_ptr<Tensile::Hardware>> restricted_hardware;
+
+            // Tensile hardware of the device with only cuCount compute units, so that the
+            // solutions selected for a CU limit or a CU-masked stream fit in them.
+            // Entries are never removed, so each thread remembers its last lookup and
+            // repeated calls with the same limit do not take the device's lock.
+            const Tensile::Hardware* get_restricted_hardware(int cuCount) const
+            {
+                struct last_lookup
+                {
+                    const adapter_s*         adapter  = nullptr;
+                    int                      cuCount  = 0;
+                    const Tensile::Hardware* hardware = nullptr;
+                };
+                static thread_local last_lookup last;
+                if(last.adapter == this && last.cuCount == cuCount)
+                    return last.hardware;
+
+                std::lock_guard<std::mutex> lock(mutex);
+                auto&                       restricted = restricted_hardware[cuCount];
+                if(!restricted)
+                {
+                    hipDeviceProp_t prop     = deviceProp;
+                    prop.multiProcessorCount = cuCount;
+                    restricted               = Tensile::hip::GetDevice(prop);
+                }
+                last = {this, cuCount, restricted.get()};
+                return restricted.get();
+            }
+
+            // Solutions selected for the device by any handle
+            mutable shared_solution_cache shared_cache;
         };
 
         // Each device contains an adapter
@@ -507,16 +779,6 @@ namespace
                 delete a.adapter;
         }
 
-        auto& get_library() const
-        {
-            return m_library;
-        }
-
-        auto& get_device_property() const
-        {
-            return m_deviceProp;
-        }
-
         auto& get_adapters() const
         {
             return m_adapters;
@@ -536,25 +798,51 @@ namespace
 
         /*********************************************************************
          * Initialize adapter and library according to environment variables *
-         * and default paths based on librocblas.so location and GPU         *
+         * and default paths based on librocblas.so location and GPU, for    *
+         * the device whose properties are in a.deviceProp                   *
          *********************************************************************/
-        void initialize(Tensile::hip::SolutionAdapter& adapter, rocblas_int deviceId)
+        void initialize(Tensile::hip::SolutionAdapter& adapter, const adapter_s& a)
         {
             std::string path;
             std::string tensileLibraryPath;
             bool        tensile_lazy_load_enabled = false;
-            static std::future<
-                std::shared_ptr<Tensile::SolutionLibrary<Tensile::ContractionProblem>>>
-                ftr_lib;
 
 #ifndef WIN32
             path.reserve(PATH_MAX);
 #endif
 
-            // The name of the current GPU platform
-            std::string processor = rocblas_internal_get_arch_name();
+            // The name of the device's GPU platform, which may differ between the devices
+            std::string processor = TuningDBArchName(a.deviceProp);
+
+            library_s* lib;
+            {
+                std::lock_guard<std::mutex> lock(m_libraries_mutex);
+                lib = &m_libraries[processor];
+            }
 
             const char* env = getenv("ROCBLAS_TENSILE_LIBPATH");
+
+#ifdef ROCBLAS_TENSILE_EMBEDDED
+            // A build with Tensile_EMBED_LIBRARY carries the library and the code objects of its
+            // architectures in librocblas itself, so that initialization does no file system I/O,
+            // which matters when many processes start at once on a shared file system. Setting
+            // ROCBLAS_TENSILE_LIBPATH still loads the library files of a directory instead.
+            if(!env)
+            {
+                std::call_once(lib->load_started, [&] {
+                    lib->ftr_lib = std::async(std::launch::async, [] {
+                        return Tensile::EmbeddedLibrary<Tensile::ContractionProblem>::Get();
+                    });
+                });
+
+                // Code objects of the other architectures of the build do not load on this device
+                adapter.loadEmbeddedCodeObjects();
+
+                finish_loading(lib, "the embedded Tensile library", a);
+                return;
+            }
+#endif
+
             if(env)
             {
                 path = env;
@@ -636,17 +924,21 @@ namespace
             else
                 tensile_lazy_load_enabled = true;
 
+            // The master library is decoded by Tensile into objects on the heap of each process,
+            // so that mapping the file would not share them between processes; its format and
+            // decoding belong to Tensile. The lazy library keeps the startup cost of decoding
+            // small: only the problem types used by the process have their solutions decoded,
+            // and only their code objects are loaded.
             if(!tensile_lazy_load_enabled || rocblas_initialize_called())
             {
 
-                static int once = [&] {
-                    ftr_lib = std::async(
+                std::call_once(lib->load_started, [&] {
+                    lib->ftr_lib = std::async(
                         std::launch::async,
                         Tensile::LoadLibraryFilePreload<Tensile::ContractionProblem>,
                         tensileLibraryPath,
                         std::vector<Tensile::LazyLoadingInit>{Tensile::LazyLoadingInit::All});
-                    return 0;
-                }();
+                });
 
                 // only load modules for the current architecture
                 auto dir = path + "/*" + processor + "*co";
@@ -705,57 +997,78 @@ namespace
             }
             else // initialize lazy loading
             {
-                static int once = [&] {
-                    ftr_lib
+                std::call_once(lib->load_started, [&] {
+                    lib->ftr_lib
                         = std::async(std::launch::async,
                                      Tensile::LoadLibraryFilePreload<Tensile::ContractionProblem>,
                                      tensileLibraryPath,
                                      std::vector<Tensile::LazyLoadingInit>{});
-
-                    return 0;
-                }();
+                });
 
                 adapter.initializeLazyLoading(processor, path);
+                a.codeObjectPath = path;
             }
 
-            {
-                static int once = [&] {
-                    auto lib = ftr_lib.get();
-                    if(!lib)
-                        rocblas_cerr << "\nrocBLAS error: Could not load " << tensileLibraryPath
-                                     << std::endl;
-                    else
-                    {
-                        using MSL = Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>;
-                        m_library = std::dynamic_pointer_cast<MSL>(lib);
-                    }
-                    return 0;
-                }();
-            }
-            if(!m_library)
+            finish_loading(lib, tensileLibraryPath, a);
+        }
+
+        /*********************************************************************
+         * Wait for the library of an architecture to be decoded, once, and  *
+         * attach it to the adapter of a device                              *
+         *********************************************************************/
+        static void finish_loading(library_s*         lib,
+                                   const std::string& tensileLibraryPath,
+                                   const adapter_s&   a)
+        {
+            std::call_once(lib->load_finished, [&] {
+                auto loaded = lib->ftr_lib.get();
+                if(!loaded)
+                    rocblas_cerr << "\nrocBLAS error: Could not load " << tensileLibraryPath
+                                 << std::endl;
+                else
+                {
+                    using MSL    = Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>;
+                    lib->library = std::dynamic_pointer_cast<MSL>(loaded);
+                }
+            });
+
+            a.library = lib;
+            if(!lib->library)
             {
                 rocblas_cerr << "\nrocBLAS error: Could not initialize Tensile library"
                              << std::endl;
                 rocblas_abort();
             }
-
-            hipDeviceProp_t prop;
-            HIP_CHECK_EXC(hipGetDeviceProperties(&prop, deviceId));
-
-            m_deviceProp = std::make_shared<hipDeviceProp_t>(prop);
         }
     };
 
-    // Return the library and adapter for the current HIP device
+    // Return the TensileHost, which is constructed on the first call
+    TensileHost& get_tensile_host()
+    {
+        static TensileHost host;
+        return host;
+    }
+
+    /**************************************************************************
+     * Return the library and adapter for the current HIP device. After the   *
+     * first call for a device, this only performs an atomic load; the others *
+     * are returned as raw pointers, to avoid contended reference counting    *
+     * when many host threads launch on the same device.                      *
+     * The hardware restricted to cuCount compute units is looked up under    *
+     * the device's lock.                                                     *
+     **************************************************************************/
     auto& get_library_and_adapter(
-        std::shared_ptr<Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>>* library
-        = nullptr,
-        std::shared_ptr<hipDeviceProp_t>* deviceProp = nullptr,
-        int                               device     = -1)
+        Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>** library        = nullptr,
+        const hipDeviceProp_t**                                       deviceProp     = nullptr,
+        const Tensile::Hardware**                                     hardware       = nullptr,
+        int                                                           device         = -1,
+        std::string*                                                  codeObjectPath = nullptr,
+        shared_solution_cache**                                       sharedCache    = nullptr,
+        int                                                           cuCount        = 0)
     try
     {
         // TensileHost is initialized on the first call
-        static TensileHost host;
+        auto& host = get_tensile_host();
 
         if(device == -1)
             hipGetDevice(&device);
@@ -773,11 +1086,17 @@ namespace
             adapter = a.adapter.load(std::memory_order_relaxed);
             if(!adapter)
             {
+                // The library, kernel selection and performance metrics follow the
+                // architecture and compute units of the device, which may differ between the
+                // devices of a node or the partitions of a device
+                HIP_CHECK_EXC(hipGetDeviceProperties(&a.deviceProp, device));
+                a.hardware = Tensile::hip::GetDevice(a.deviceProp);
+
                 // Allocate a new adapter using the current HIP device
                 adapter = new Tensile::hip::SolutionAdapter;
 
-                // Initialize the adapter and possibly the library
-                host.initialize(*adapter, device);
+                // Initialize the adapter and possibly the library of the device's architecture
+                host.initialize(*adapter, a);
 
                 // Atomically change the adapter stored for this device ID
                 a.adapter.store(adapter, std::memory_order_release);
@@ -786,9 +1105,15 @@ namespace
 
         // If an adapter is found, it is assumed that the library is initialized
         if(library)
-            *library = host.get_library();
+            *library = a.library->library.get();
         if(deviceProp)
-            *deviceProp = host.get_device_property();
+            *deviceProp = &a.deviceProp;
+        if(hardware)
+            *hardware = cuCount ? a.get_restricted_hardware(cuCount) : a.hardware.get();
+        if(codeObjectPath)
+            *codeObjectPath = a.codeObjectPath;
+        if(sharedCache)
+            *sharedCache = &a.shared_cache;
 
         return *adapter;
     }
@@ -826,6 +1151,241 @@ namespace
             rocblas_cerr << msg << std::endl;
     }
 
+    /**************************************************************************
+     * In GEMM autotuning mode, the first time a problem is seen, the solution *
+     * selected by Tensile and the other solutions which can solve it are run  *
+     * on the problem's data and timed, and the fastest is returned. D is     *
+     * written to a scratch buffer, so the inputs, including a C aliased by D, *
+     * are not changed. Only candidates-1 other solutions are timed, ranked by *
+     * the fraction of their macro tiles which pads the m x n result.         *
+     * With rocblas_energy_efficiency_performance_metric, each candidate is   *
+     * rerun for ENERGY_WINDOW_US while the power of the device is sampled,   *
+     * and the candidate using the least energy, its time times its average  *
+     * power, is returned instead of the fastest.                             *
+     * Returns best if no other candidate can be timed, or if the stream is   *
+     * being captured.                                                        *
+     **************************************************************************/
+    template <typename Ti, typename To, typename Tc>
+    std::shared_ptr<Tensile::ContractionSolution>
+        AutotuneSolution(const RocblasContractionProblem<Ti, To, Tc>&                 prob,
+                         const Tensile::ContractionProblem&                           tensile_prob,
+                         Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>* library,
+                         const Tensile::Hardware&                                     hardware,
+                         Tensile::hip::SolutionAdapter&                               adapter,
+                         std::shared_ptr<Tensile::ContractionSolution>                best,
+                         rocblas_int                                                  candidates)
+    {
+        // Each candidate is run once to load its code object, then timed over AUTOTUNE_ITERS runs
+        constexpr int AUTOTUNE_ITERS = 3;
+
+        // The driver averages the power over milliseconds, so candidates are measured for
+        // longer than that, with at most ENERGY_MAX_RUNS runs
+        constexpr double ENERGY_WINDOW_US = 50000;
+        constexpr int    ENERGY_MAX_RUNS  = 100000;
+
+        auto handle = prob.handle;
+        bool energy = handle->performance_metric == rocblas_energy_efficiency_performance_metric
+                      && rocblas_device_power(handle->getDevice()) >= 0;
+
+        // Timing synchronizes the stream, which is invalid while it is captured into a graph,
+        // so the library's selection is kept unless the stream is known not to be capturing
+        hipStreamCaptureStatus capture_status = hipStreamCaptureStatusActive;
+        if(hipStreamIsCapturing(handle->get_stream(), &capture_status) != hipSuccess
+           || capture_status != hipStreamCaptureStatusNone)
+            return best;
+
+        // D must be written contiguously from a single buffer
+        if(prob.batch_D || !prob.m || !prob.n || !prob.batch_count)
+            return best;
+
+        size_t d_size = prob.buffer_offset_d + (prob.batch_count - 1) * prob.batch_stride_d
+                        + (prob.n - 1) * prob.col_stride_d + prob.m;
+        auto   scratch = handle->device_malloc(sizeof(To) * d_size);
+        if(!scratch)
+            return best;
+
+        size_t max_workspace_size = AvailableWorkspaceSize(handle);
+        double m = double(prob.m), n = double(prob.n);
+
+        std::vector<std::pair<double, std::shared_ptr<Tensile::ContractionSolution>>> ranked;
+        for(auto& solution : library->findAllSolutions(tensile_prob, hardware))
+        {
+            if(!solution || solution.get() == best.get()
+               || !solution->canSolve(tensile_prob, hardware)
+               || solution->requiredWorkspaceSize(tensile_prob) > max_workspace_size)
+                continue;
+
+            double mt_x  = solution->sizeMapping.macroTile.x;
+            double mt_y  = solution->sizeMapping.macroTile.y;
+            double tiles = std::ceil(m / mt_x) * mt_x * std::ceil(n / mt_y) * mt_y;
+
+            // Among equally padded tiles, larger ones rank first
+            ranked.emplace_back(1 - m * n / tiles - tiles * 1e-12, solution);
+        }
+        if(ranked.empty())
+            return best;
+
+        size_t others = std::min(ranked.size(), size_t(candidates - 1));
+        std::partial_sort(ranked.begin(),
+                          ranked.begin() + others,
+                          ranked.end(),
+                          [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        std::vector<std::shared_ptr<Tensile::ContractionSolution>> tuned{best};
+        for(size_t i = 0; i < others; i++)
+            tuned.push_back(ranked[i].second);
+
+        hipEvent_t start, stop;
+        if(hipEventCreate(&start) != hipSuccess)
+            return best;
+        if(hipEventCreate(&stop) != hipSuccess)
+        {
+            (void)hipEventDestroy(start);
+            return best;
+        }
+
+        auto tune_prob = prob;
+        tune_prob.D    = static_cast<To*>(scratch[0]);
+
+        hipStream_t stream    = handle->get_stream();
+        auto        fastest   = best;
+        float       best_time = std::numeric_limits<float>::max();
+        for(auto& solution : tuned)
+        {
+            // The scratch D may leave too little workspace for the selected solution
+            size_t workspace_size = solution->requiredWorkspaceSize(tensile_prob);
+            if(workspace_size > max_workspace_size)
+                continue;
+            auto gsu_malloc = handle->gsu_malloc_by_size(workspace_size);
+
+            auto  kernels = solution->solve(tensile_prob, GetTensileInputs(tune_prob), hardware);
+            float time    = 0;
+            bool  ok      = adapter.launchKernels(kernels, stream, nullptr, nullptr) == hipSuccess
+                       && hipEventRecord(start, stream) == hipSuccess;
+            for(int i = 0; ok && i < AUTOTUNE_ITERS; i++)
+                ok = adapter.launchKernels(kernels, stream, nullptr, nullptr) == hipSuccess;
+            ok = ok && hipEventRecord(stop, stream) == hipSuccess
+                 && hipEventSynchronize(stop) == hipSuccess
+                 && hipEventElapsedTime(&time, start, stop) == hipSuccess;
+
+            if(ok && energy)
+            {
+                double run_us = std::max(time * 1000.0 / AUTOTUNE_ITERS, 1.0);
+                int    runs   = int(std::min(std::ceil(ENERGY_WINDOW_US / run_us),
+                                        double(ENERGY_MAX_RUNS)));
+                for(int i = 0; ok && i < runs; i++)
+                    ok = adapter.launchKernels(kernels, stream, nullptr, nullptr) == hipSuccess;
+
+                double power   = 0;
+                int    samples = 0;
+                do
+                {
+                    double watts = rocblas_device_power(handle->getDevice());
+                    if(watts >= 0)
+                    {
+                        power += watts;
+                        samples++;
+                    }
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                } while(ok && hipStreamQuery(stream) == hipErrorNotReady);
+                ok = ok && hipStreamSynchronize(stream) == hipSuccess && samples;
+
+                // Energy of AUTOTUNE_ITERS runs, compared like their time
+                if(ok)
+                    time *= float(power / samples);
+            }
+
+            if(ok && time < best_time)
+            {
+                best_time = time;
+                fastest   = solution;
+            }
+        }
+
+        (void)hipEventDestroy(start);
+        (void)hipEventDestroy(stop);
+        return fastest;
+    }
+
+    /**************************************************************************
+     * With rocblas_latency_performance_metric, the solution expected to      *
+     * finish first on the targeted compute units is selected: the fewest     *
+     * waves of workgroups, at one workgroup per compute unit, times the work *
+     * of each workgroup. K is only split across workgroups (global split U)  *
+     * on high-priority streams, whose workgroups are dispatched ahead of     *
+     * those of other streams. Returns selected if no other solution is       *
+     * expected to finish sooner.                                             *
+     **************************************************************************/
+    template <typename Ti, typename To, typename Tc>
+    std::shared_ptr<Tensile::ContractionSolution>
+        LatencySolution(const RocblasContractionProblem<Ti, To, Tc>&                 prob,
+                        const Tensile::ContractionProblem&                           tensile_prob,
+                        Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>* library,
+                        const Tensile::Hardware&                                     hardware,
+                        std::shared_ptr<Tensile::ContractionSolution>                selected,
+                        size_t max_workspace_size)
+    {
+        auto   handle   = prob.handle;
+        int    cu_limit = handle->get_cu_count_limit();
+        double cus      = cu_limit ? cu_limit : handle->getCUCount();
+        bool   split_k  = handle->is_stream_high_priority();
+        double m = prob.m, n = prob.n, k = std::max<double>(prob.k, 1);
+        double batches  = prob.batch_count;
+
+        auto latency = [&](const Tensile::ContractionSolution& solution) {
+            double mt_x   = solution.sizeMapping.macroTile.x;
+            double mt_y   = solution.sizeMapping.macroTile.y;
+            double splits = std::max(solution.sizeMapping.globalSplitU, 1);
+            double wgs    = std::ceil(m / mt_x) * std::ceil(n / mt_y) * batches * splits;
+            return std::ceil(wgs / cus) * mt_x * mt_y * std::ceil(k / splits);
+        };
+
+        auto   fastest      = selected;
+        double best_latency = latency(*selected);
+        for(auto& solution : library->findAllSolutions(tensile_prob, hardware))
+        {
+            if(!solution || (!split_k && solution->sizeMapping.globalSplitU > 1)
+               || !solution->canSolve(tensile_prob, hardware)
+               || solution->requiredWorkspaceSize(tensile_prob) > max_workspace_size)
+                continue;
+
+            double solution_latency = latency(*solution);
+            if(solution_latency < best_latency)
+            {
+                best_latency = solution_latency;
+                fastest      = solution;
+            }
+        }
+        return fastest;
+    }
+
+    /**************************************************************************
+     * Returns a solution with the workgroup mapping wgm and the macro tile of *
+     * selected which can solve the problem, or selected if there is none     *
+     **************************************************************************/
+    std::shared_ptr<Tensile::ContractionSolution> WorkgroupMappingSolution(
+        const Tensile::ContractionProblem&                           tensile_prob,
+        Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>* library,
+        const Tensile::Hardware&                                     hardware,
+        std::shared_ptr<Tensile::ContractionSolution>                selected,
+        int32_t                                                      wgm,
+        size_t                                                       max_workspace_size)
+    {
+        if(selected->sizeMapping.workGroupMapping == wgm)
+            return selected;
+
+        for(auto& solution : library->findAllSolutions(tensile_prob, hardware))
+        {
+            if(solution && solution->sizeMapping.workGroupMapping == wgm
+               && solution->sizeMapping.macroTile.x == selected->sizeMapping.macroTile.x
+               && solution->sizeMapping.macroTile.y == selected->sizeMapping.macroTile.y
+               && solution->canSolve(tensile_prob, hardware)
+               && solution->requiredWorkspaceSize(tensile_prob) <= max_workspace_size)
+                return solution;
+        }
+        return selected;
+    }
+
 } // namespace
 
 /******************************************************************************
@@ -842,17 +1402,39 @@ rocblas_status runContractionProblem(const RocblasContractionProblem<Ti, To, Tc>
 
     try
     {
-        std::shared_ptr<Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>> library;
-        std::shared_ptr<hipDeviceProp_t>                                             deviceProp;
-        std::shared_ptr<Tensile::Hardware>                                           hardware;
-
-        auto& adapter = get_library_and_adapter(&library, &deviceProp, prob.handle->getDevice());
-
-        hardware = Tensile::hip::GetDevice(*deviceProp);
-
-        auto  tensile_prob  = ConstructTensileProblem(prob);
-        auto  handle        = prob.handle;
-        auto* fitness_query = handle->get_solution_fitness_query();
+        Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>* library;
+        const hipDeviceProp_t*                                       deviceProp;
+        const Tensile::Hardware*                                     hardware;
+        shared_solution_cache*                                       shared_cache;
+
+        auto& adapter = get_library_and_adapter(&library,
+                                                &deviceProp,
+                                                &hardware,
+                                                prob.handle->getDevice(),
+                                                nullptr,
+                                                &shared_cache,
+                                                prob.handle->get_cu_count_limit());
+
+        // Count the problem, and time its host stages if enabled
+        auto& host_profile = prob.handle->get_tensile_host_profile();
+        auto  stage_start  = host_profile.start(
+            host_profile.timing || (prob.handle->layer_mode & rocblas_layer_mode_log_profile));
+
+        // The key identifies the problem both in the solution caches and in the thread's
+        // cache of constructed Tensile problems
+        static thread_local TensileProblemCache problem_cache;
+
+        auto        key           = ConstructSolutionCacheKey(prob);
+        auto        hash          = rocblas_solution_cache::hash(key);
+        const auto& tensile_prob  = problem_cache.get(prob, key, hash);
+        auto        handle        = prob.handle;
+        auto*       fitness_query = handle->get_solution_fitness_query();
+
+        stage_start = host_profile.stop(rocblas_tensile_host_profile::construct, stage_start);
+
+        // Whether the selected solution is known to solve the problem, and its workspace size
+        bool   solution_validated = false;
+        size_t workspace_size     = 0;
 
         if(algo == rocblas_gemm_algo_solution_index && solution_index > 0)
         {
@@ -864,10 +1446,134 @@ rocblas_status runContractionProblem(const RocblasContractionProblem<Ti, To, Tc>
                 solution = library->getSolutionByIndex(solution_index - 1);
             }
         }
-        else
+        else if(fitness_query)
         {
+            // Fitness queries always perform solution selection, bypassing the cache
             solution = library->findBestSolution(tensile_prob, *hardware, fitness_query);
+            host_profile.selections++;
         }
+        else
+        {
+            // Look up the problem in the handle's solution cache before selecting a solution
+            auto&       cache     = handle->get_solution_cache();
+            auto&       tuning_db = rocblas_tuning_db::instance();
+            const void* cached_solution;
+
+            // Solutions cached before the tuning database changed may no longer be the tuned ones
+            uint64_t tuning_db_generation = tuning_db.get_generation();
+            if(handle->tuning_db_generation != tuning_db_generation)
+            {
+                cache.clear();
+                handle->tuning_db_generation = tuning_db_generation;
+            }
+            if(shared_cache->tuning_db_generation.load(std::memory_order_acquire)
+               != tuning_db_generation)
+            {
+                shared_cache->cache.clear();
+                shared_cache->tuning_db_generation.store(tuning_db_generation,
+                                                         std::memory_order_release);
+            }
+
+            // A solution selected by another handle of the device is added to this handle's cache
+            size_t max_workspace_size = AvailableWorkspaceSize(handle);
+            bool   cache_hit
+                = cache.find(key, hash, max_workspace_size, cached_solution, workspace_size);
+            if(!cache_hit
+               && shared_cache->cache.find(
+                   key, hash, max_workspace_size, cached_solution, workspace_size))
+            {
+                cache.insert(key, hash, cached_solution, workspace_size);
+                cache_hit = true;
+            }
+
+            if(cache_hit)
+            {
+                // Solutions are owned by the library, so a non-owning shared_ptr is used
+                solution = std::shared_ptr<Tensile::ContractionSolution>(
+                    std::shared_ptr<void>{},
+                    const_cast<Tensile::ContractionSolution*>(
+                        static_cast<const Tensile::ContractionSolution*>(cached_solution)));
+                solution_validated = true;
+            }
+            else
+            {
+                // The handle's workgroup mapping takes precedence over a tuned one
+                int32_t wgm = handle->gemm_workgroup_mapping;
+
+                // A tuned solution from the tuning database overrides Tensile's selection
+                if(!tuning_db.empty())
+                {
+                    int32_t tuned_wgm;
+                    int32_t tuned_index = tuning_db.find(
+                        TuningDBArchName(*deviceProp).c_str(), TuningDBKey(prob), &tuned_wgm);
+                    if(!wgm)
+                        wgm = tuned_wgm;
+                    if(tuned_index > 0)
+                    {
+                        solution = library->getSolutionByIndex(tuned_index - 1);
+                        if(!solution)
+                        {
+                            library->findAllSolutions(tensile_prob, *hardware);
+                            solution = library->getSolutionByIndex(tuned_index - 1);
+                        }
+                        if(solution && !solution->canSolve(tensile_prob, *hardware))
+                            solution = nullptr;
+                    }
+                }
+
+                if(!solution)
+                {
+                    solution = library->findBestSolution(tensile_prob, *hardware, nullptr);
+                    host_profile.selections++;
+
+                    if(solution
+                       && handle->performance_metric == rocblas_latency_performance_metric
+                       && !(prob.flags & rocblas_gemm_flags_use_cu_efficiency))
+                        solution = LatencySolution(
+                            prob, tensile_prob, library, *hardware, solution, max_workspace_size);
+
+                    if(solution && wgm > 0)
+                        solution = WorkgroupMappingSolution(
+                            tensile_prob, library, *hardware, solution, wgm, max_workspace_size);
+
+                    // The energy efficiency of the solutions is measured, so that metric
+                    // autotunes even if autotuning is not enabled on the handle
+                    rocblas_int candidates = handle->gemm_autotune_candidates;
+                    if(candidates <= 1
+                       && handle->performance_metric
+                              == rocblas_energy_efficiency_performance_metric)
+                        candidates = ENERGY_AUTOTUNE_CANDIDATES;
+
+                    // Autotuning times the candidates, so it is skipped where it cannot synchronize
+                    if(solution && candidates > 1 && !handle->is_device_memory_size_query()
+                       && !handle->is_graph_safe()
+                       && !(prob.flags & rocblas_gemm_flags_check_solution_index))
+                    {
+                        solution = AutotuneSolution(prob,
+                                                    tensile_prob,
+                                                    library,
+                                                    *hardware,
+                                                    adapter,
+                                                    solution,
+                                                    candidates);
+                        if(handle->tuning_db_record)
+                            tuning_db.record(TuningDBArchName(*deviceProp).c_str(),
+                                             TuningDBKey(prob),
+                                             solution->index + 1,
+                                             handle->gemm_workgroup_mapping);
+                    }
+                }
+                if(solution && solution->canSolve(tensile_prob, *hardware))
+                {
+                    workspace_size     = solution->requiredWorkspaceSize(tensile_prob);
+                    solution_validated = true;
+                    cache.insert(key, hash, solution.get(), workspace_size);
+                    shared_cache->cache.insert(key, hash, solution.get(), workspace_size);
+                }
+            }
+        }
+
+        stage_start = host_profile.stop(rocblas_tensile_host_profile::select, stage_start);
 
         if(!solution)
         {
@@ -884,31 +1590,50 @@ rocblas_status runContractionProblem(const RocblasContractionProblem<Ti, To, Tc>
         }
         else
         {
+            if(!fitness_query && !solution_validated)
+                workspace_size = solution->requiredWorkspaceSize(tensile_prob);
+
             if(fitness_query)
                 status = rocblas_status_success;
             else if(handle->is_device_memory_size_query())
             {
                 status = handle->set_optimal_device_memory_size(
-                    ((solution->requiredWorkspaceSize(tensile_prob)
-                      + HPA_GSU_WORKSPACE_SIZE_GRANULARITY - 1)
+                    ((workspace_size + HPA_GSU_WORKSPACE_SIZE_GRANULARITY - 1)
                      / HPA_GSU_WORKSPACE_SIZE_GRANULARITY)
                     * HPA_GSU_WORKSPACE_SIZE_GRANULARITY);
             }
             else
             {
                 // check if the solution requires workspace for GSU and allocate it.
-                size_t WorkspaceSize = solution->requiredWorkspaceSize(tensile_prob);
-                auto   gsu_malloc    = prob.handle->gsu_malloc_by_size(WorkspaceSize);
+                auto gsu_malloc = prob.handle->gsu_malloc_by_size(workspace_size);
 
-                if(solution->canSolve(tensile_prob, *hardware))
+                if(solution_validated || solution->canSolve(tensile_prob, *hardware))
                 {
                     if(!(prob.flags & rocblas_gemm_flags_check_solution_index))
                     {
-                        adapter.launchKernels(
-                            solution->solve(tensile_prob, GetTensileInputs(prob), *hardware),
-                            handle->get_stream(),
-                            handle->startEvent,
-                            handle->stopEvent);
+                        // Solution indices are reported 1-based, as rocblas_gemm_ex takes them
+                        if(handle->is_kernel_logged())
+                            handle->log_kernel(solution->name().c_str(), solution->index + 1);
+
+                        auto kernels
+                            = solution->solve(tensile_prob, GetTensileInputs(prob), *hardware);
+                        stage_start
+                            = host_profile.stop(rocblas_tensile_host_profile::solve, stage_start);
+
+                        adapter.launchKernels(kernels,
+                                              handle->get_stream(),
+                                              handle->startEvent,
+                                              handle->stopEvent);
+                        host_profile.stop(rocblas_tensile_host_profile::launch, stage_start);
+                        host_profile.launches++;
+
+                        // Record the explicitly chosen solution as the tuned one for this problem
+                        if(handle->tuning_db_record && algo == rocblas_gemm_algo_solution_index
+                           && solution_index > 0)
+                            rocblas_tuning_db::instance().record(
+                                TuningDBArchName(*deviceProp).c_str(),
+                                TuningDBKey(prob),
+                                solution_index);
                     }
                     status = rocblas_status_success;
                 }
@@ -942,12 +1667,17 @@ rocblas_status getAllSolutions(const RocblasContractionProblem<Ti, To, Tc>& prob
     std::set<std::shared_ptr<Tensile::ContractionSolution>> solutions;
     try
     {
-        std::shared_ptr<Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>> library;
-        std::shared_ptr<hipDeviceProp_t>                                             deviceProp;
-        std::shared_ptr<Tensile::Hardware>                                           hardware;
-
-        auto& adapter = get_library_and_adapter(&library, &deviceProp, prob.handle->getDevice());
-        hardware      = Tensile::hip::GetDevice(*deviceProp);
+        Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>* library;
+        const hipDeviceProp_t*                                       deviceProp;
+        const Tensile::Hardware*                                     hardware;
+
+        get_library_and_adapter(&library,
+                                &deviceProp,
+                                &hardware,
+                                prob.handle->getDevice(),
+                                nullptr,
+                                nullptr,
+                                prob.handle->get_cu_count_limit());
         auto tensile_prob = ConstructTensileProblem(prob);
 
         solutions = library->findAllSolutions(tensile_prob, *hardware);
@@ -987,6 +1717,271 @@ rocblas_status getAllSolutions(const RocblasContractionProblem<Ti, To, Tc>& prob
     return status;
 }
 
+namespace
+{
+    /*************************************************************************
+     * Load a code object file into an adapter, unless it has been preloaded *
+     * already, trying the xnack variants of the file name as Tensile does  *
+     *************************************************************************/
+    void preloadCodeObjectFile(Tensile::hip::SolutionAdapter& adapter,
+                               const std::string&             codeObjectPath,
+                               const std::string&             codeObjectFile)
+    {
+        static std::mutex                                                         mutex;
+        static std::set<std::pair<Tensile::hip::SolutionAdapter*, std::string>> preloaded;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(!preloaded.emplace(&adapter, codeObjectFile).second)
+                return;
+        }
+
+        size_t loc = codeObjectFile.rfind('.');
+        for(auto ver : {"", "-xnack-", "-xnack+"})
+        {
+            std::string name = codeObjectFile;
+            name.insert(loc == std::string::npos ? name.size() : loc, ver);
+            if(adapter.loadCodeObjectFile(codeObjectPath + "/" + name) == hipSuccess)
+                break;
+        }
+    }
+
+    /**************************************************************************
+     * preloadContractionProblem loads the code objects of the kernels which  *
+     * solve a RocblasContractionProblem. Under lazy loading, the code object *
+     * of a kernel is otherwise loaded when the kernel is first launched.     *
+     **************************************************************************/
+    template <typename Ti, typename To, typename Tc>
+    rocblas_status preloadContractionProblem(const RocblasContractionProblem<Ti, To, Tc>& prob)
+    {
+        Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>* library;
+        const hipDeviceProp_t*                                       deviceProp;
+        const Tensile::Hardware*                                     hardware;
+        std::string                                                  codeObjectPath;
+
+        auto& adapter = get_library_and_adapter(&library,
+                                                &deviceProp,
+                                                &hardware,
+                                                prob.handle->getDevice(),
+                                                &codeObjectPath,
+                                                nullptr,
+                                                prob.handle->get_cu_count_limit());
+
+        // Without lazy loading, all code objects are loaded at initialization
+        if(codeObjectPath.empty())
+            return rocblas_status_success;
+
+        auto tensile_prob = ConstructTensileProblem(prob);
+        auto solution     = library->findBestSolution(tensile_prob, *hardware, nullptr);
+        if(!solution)
+            return rocblas_status_not_implemented;
+
+        // Matrix pointers are not dereferenced in building the kernel invocations
+        for(auto& kernel : solution->solve(tensile_prob, GetTensileInputs(prob), *hardware))
+            if(!kernel.codeObjectFile.empty())
+                preloadCodeObjectFile(adapter, codeObjectPath, kernel.codeObjectFile);
+
+        return rocblas_status_success;
+    }
+
+    // Build the contraction problem of a warm-up problem, without matrices
+    template <typename Ti, typename To = Ti, typename Tc = To>
+    rocblas_status preloadGemmProblem(rocblas_handle                     handle,
+                                      const rocblas_gemm_warmup_problem& p)
+    {
+        const Tc          alpha = Tc(1), beta = Tc(0);
+        const rocblas_int lda = std::max(1, p.trans_a == rocblas_operation_none ? p.m : p.k);
+        const rocblas_int ldb = std::max(1, p.trans_b == rocblas_operation_none ? p.k : p.n);
+        const rocblas_int ldc = std::max(1, p.m);
+
+        RocblasContractionProblem<Ti, To, Tc> problem{
+            handle,
+            p.trans_a,
+            p.trans_b,
+            p.m,
+            p.n,
+            p.k,
+            &alpha,
+            nullptr,
+            nullptr,
+            lda,
+            rocblas_stride(lda) * (p.trans_a == rocblas_operation_none ? p.k : p.m),
+            0,
+            nullptr,
+            nullptr,
+            ldb,
+            rocblas_stride(ldb) * (p.trans_b == rocblas_operation_none ? p.n : p.k),
+            0,
+            &beta,
+            nullptr,
+            nullptr,
+            ldc,
+            rocblas_stride(ldc) * p.n,
+            0,
+            p.batch_count,
+            true,
+            rocblas_gemm_flags_none};
+
+        return preloadContractionProblem(problem);
+    }
+
+    // Dispatch a warm-up problem on the types supported by rocblas_gemm_ex
+    rocblas_status preloadGemmProblem(rocblas_handle handle, const rocblas_gemm_warmup_problem& p)
+    {
+        if(!p.m || !p.n || !p.batch_count)
+            return rocblas_status_success;
+
+        auto a_type = p.a_type, c_type = p.c_type, compute_type = p.compute_type;
+
+        if(a_type == rocblas_datatype_f64_r && c_type == rocblas_datatype_f64_r
+           && compute_type == rocblas_datatype_f64_r)
+            return preloadGemmProblem<double>(handle, p);
+        else if(a_type == rocblas_datatype_f32_r && c_type == rocblas_datatype_f32_r
+                && compute_type == rocblas_datatype_f32_r)
+            return preloadGemmProblem<float>(handle, p);
+        else if(a_type == rocblas_datatype_f16_r && c_type == rocblas_datatype_f16_r
+                && compute_type == rocblas_datatype_f16_r)
+            return preloadGemmProblem<rocblas_half>(handle, p);
+        else if(a_type == rocblas_datatype_f16_r && c_type == rocblas_datatype_f16_r
+                && compute_type == rocblas_datatype_f32_r)
+            return preloadGemmProblem<rocblas_half, rocblas_half, float>(handle, p);
+        else if(a_type == rocblas_datatype_f16_r && c_type == rocblas_datatype_f32_r
+                && compute_type == rocblas_datatype_f32_r)
+            return preloadGemmProblem<rocblas_half, float, float>(handle, p);
+        else if(a_type == rocblas_datatype_bf16_r && c_type == rocblas_datatype_bf16_r
+                && compute_type == rocblas_datatype_f32_r)
+            return preloadGemmProblem<rocblas_bfloat16, rocblas_bfloat16, float>(handle, p);
+        else if(a_type == rocblas_datatype_bf16_r && c_type == rocblas_datatype_f32_r
+                && compute_type == rocblas_datatype_f32_r)
+            return preloadGemmProblem<rocblas_bfloat16, float, float>(handle, p);
+        else if(a_type == rocblas_datatype_i8_r && c_type == rocblas_datatype_i32_r
+                && compute_type == rocblas_datatype_i32_r)
+            return preloadGemmProblem<int8_t, int32_t, int32_t>(handle, p);
+        else if(a_type == rocblas_datatype_f32_c && c_type == rocblas_datatype_f32_c
+                && compute_type == rocblas_datatype_f32_c)
+            return preloadGemmProblem<rocblas_float_complex>(handle, p);
+        else if(a_type == rocblas_datatype_f64_c && c_type == rocblas_datatype_f64_c
+                && compute_type == rocblas_datatype_f64_c)
+            return preloadGemmProblem<rocblas_double_complex>(handle, p);
+        else
+            return rocblas_status_not_implemented;
+    }
+
+    // Preload the code objects of warm-up problems on a device, from a background thread
+    rocblas_status preloadGemmProblems(int                                             device,
+                                       rocblas_atomics_mode                            atomics_mode,
+                                       const std::vector<rocblas_gemm_warmup_problem>& problems)
+    try
+    {
+        // The warm-up uses its own handle, so that the application's handle is not shared
+        // between threads
+        RETURN_IF_HIP_ERROR(hipSetDevice(device));
+        _rocblas_handle handle;
+        handle.atomics_mode = atomics_mode;
+
+        rocblas_status status = rocblas_status_success;
+        for(auto& p : problems)
+        {
+            rocblas_status problem_status = preloadGemmProblem(&handle, p);
+            if(status == rocblas_status_success)
+                status = problem_status;
+        }
+        return status;
+    }
+    catch(...)
+    {
+        return exception_to_rocblas_status();
+    }
+
+    /*****************************************************************************
+     * Warm-up requests running in the background. The TensileHost is constructed *
+     * first, so that it is destroyed after the requests are waited for at exit.   *
+     *****************************************************************************/
+    struct gemm_warmup_state
+    {
+        std::mutex                               mutex;
+        std::vector<std::future<rocblas_status>> requests;
+    };
+
+    gemm_warmup_state& get_gemm_warmup_state()
+    {
+        get_tensile_host();
+        static gemm_warmup_state state;
+        return state;
+    }
+} // namespace
+
+/******************************************************************************
+ * ! \brief  Preload the code objects which solve a list of GEMM problems on  *
+ * the device of a handle in the background, so that the first call of each *
+ * problem does not load them under lazy loading.                            *
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_gemm_warmup(rocblas_handle                     handle,
+                                              rocblas_int                        count,
+                                              const rocblas_gemm_warmup_problem* problems)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(count < 0)
+        return rocblas_status_invalid_size;
+    if(!count)
+        return rocblas_status_success;
+    if(!problems)
+        return rocblas_status_invalid_pointer;
+
+    for(rocblas_int i = 0; i < count; i++)
+    {
+        auto& p = problems[i];
+        if(p.m < 0 || p.n < 0 || p.k < 0 || p.batch_count < 0)
+            return rocblas_status_invalid_size;
+        for(auto trans : {p.trans_a, p.trans_b})
+            if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+               && trans != rocblas_operation_conjugate_transpose)
+                return rocblas_status_invalid_value;
+    }
+
+    auto& state = get_gemm_warmup_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.requests.push_back(std::async(std::launch::async,
+                                        preloadGemmProblems,
+                                        handle->getDevice(),
+                                        handle->atomics_mode,
+                                        std::vector<rocblas_gemm_warmup_problem>(
+                                            problems, problems + count)));
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief  Wait for all background warm-up requests, returning the first error *
+ *******************************************************************************/
+extern "C" rocblas_status rocblas_gemm_warmup_wait()
+try
+{
+    auto&                                    state = get_gemm_warmup_state();
+    std::vector<std::future<rocblas_status>> requests;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        requests.swap(state.requests);
+    }
+
+    rocblas_status status = rocblas_status_success;
+    for(auto& request : requests)
+    {
+        rocblas_status request_status = request.get();
+        if(status == rocblas_status_success)
+            status = request_status;
+    }
+    return status;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /***************************************************************
  * ! \brief  Initialize rocBLAS for the current HIP device, to *
  * avoid costly startup time at the first call on that device. *
@@ -997,6 +1992,57 @@ extern "C" void rocblas_initialize()
     get_library_and_adapter();
 }
 
+/******************************************************************************
+ * ! \brief  Initialize rocBLAS on a list of HIP devices concurrently, one    *
+ * thread per device. The library of each architecture is decoded once, by    *
+ * the first of its devices, while every device loads its own code objects.   *
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_initialize_devices(const int* ids, int n)
+try
+{
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    if(!n)
+        return rocblas_status_success;
+    if(!ids)
+        return rocblas_status_invalid_pointer;
+
+    int count = 0;
+    RETURN_IF_HIP_ERROR(hipGetDeviceCount(&count));
+
+    std::vector<int> devices(ids, ids + n);
+    for(int id : devices)
+        if(id < 0 || id >= count)
+            return rocblas_status_invalid_value;
+    std::sort(devices.begin(), devices.end());
+    devices.erase(std::unique(devices.begin(), devices.end()), devices.end());
+
+    rocblas_initialize_called() = true;
+
+    // Each device's adapter is published as soon as it is initialized, so that calls on it
+    // do not wait for the other devices
+    std::vector<std::future<rocblas_status>> requests;
+    for(int id : devices)
+        requests.push_back(std::async(std::launch::async, [id]() -> rocblas_status {
+            RETURN_IF_HIP_ERROR(hipSetDevice(id));
+            get_library_and_adapter(nullptr, nullptr, nullptr, id);
+            return rocblas_status_success;
+        }));
+
+    rocblas_status status = rocblas_status_success;
+    for(auto& request : requests)
+    {
+        rocblas_status request_status = request.get();
+        if(status == rocblas_status_success)
+            status = request_status;
+    }
+    return status;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /******************************************************************************
  * Intantiate the cases of runContractionProblem which are needed to satisfy  *
  * rocBLAS dependencies. This file's template functions are not defined in a  *
@@ -0,0 +1,196 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*******************************************************************************
+ * Thread handles of the handles shared by several host threads, created by
+ * rocblas_get_thread_handle on the first call of each thread.
+ *
+ * The registry owns the thread handles of each shared handle, which are
+ * destroyed with the shared handle or when their thread exits. Each thread
+ * caches its own thread handles to find them without taking the registry lock;
+ * the cache is dropped whenever a shared handle is destroyed, since a new
+ * handle can be created at the same address.
+ ******************************************************************************/
+namespace
+{
+    using rocblas_thread_handle_list = std::vector<std::pair<std::thread::id, rocblas_handle>>;
+
+    struct rocblas_thread_handle_registry
+    {
+        std::mutex                                                     mutex;
+        std::unordered_map<rocblas_handle, rocblas_thread_handle_list> handles;
+        std::atomic<size_t>                                            epoch{0};
+    };
+
+    rocblas_thread_handle_registry& get_thread_handle_registry()
+    {
+        static rocblas_thread_handle_registry registry;
+        return registry;
+    }
+
+    struct rocblas_thread_handle_cache
+    {
+        size_t                                                 epoch = 0;
+        std::vector<std::pair<rocblas_handle, rocblas_handle>> handles;
+
+        rocblas_handle find(rocblas_handle shared, size_t current_epoch)
+        {
+            if(epoch != current_epoch)
+            {
+                handles.clear();
+                epoch = current_epoch;
+            }
+            for(auto& cached : handles)
+                if(cached.first == shared)
+                    return cached.second;
+            return nullptr;
+        }
+
+        // Destroy the thread handles of the exiting thread which are still registered
+        ~rocblas_thread_handle_cache()
+        {
+            std::vector<rocblas_handle>     destroyed;
+            rocblas_thread_handle_registry& registry = get_thread_handle_registry();
+            auto                            id       = std::this_thread::get_id();
+            {
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                for(auto& cached : handles)
+                {
+                    auto it = registry.handles.find(cached.first);
+                    if(it == registry.handles.end())
+                        continue;
+                    auto& list = it->second;
+                    for(size_t i = 0; i < list.size(); ++i)
+                    {
+                        if(list[i].first == id && list[i].second == cached.second)
+                        {
+                            destroyed.push_back(list[i].second);
+                            list[i] = list.back();
+                            list.pop_back();
+                            break;
+                        }
+                    }
+                }
+            }
+            for(auto thread_handle : destroyed)
+                delete thread_handle;
+        }
+    };
+
+    thread_local rocblas_thread_handle_cache t_thread_handles;
+
+    // Find the thread handle of the calling thread among the registered ones
+    rocblas_handle find_registered_thread_handle(rocblas_thread_handle_registry& registry,
+                                                 rocblas_handle                  handle)
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        auto                        it = registry.handles.find(handle);
+        if(it != registry.handles.end())
+        {
+            auto id = std::this_thread::get_id();
+            for(auto& registered : it->second)
+                if(registered.first == id)
+                    return registered.second;
+        }
+        return nullptr;
+    }
+}
+
+void rocblas_destroy_thread_handles(rocblas_handle handle)
+{
+    rocblas_thread_handle_registry& registry = get_thread_handle_registry();
+    rocblas_thread_handle_list      destroyed;
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        auto                        it = registry.handles.find(handle);
+        if(it == registry.handles.end())
+            return;
+        destroyed.swap(it->second);
+        registry.handles.erase(it);
+        ++registry.epoch;
+    }
+    for(auto& registered : destroyed)
+        delete registered.second;
+}
+
+extern "C" rocblas_status rocblas_get_thread_handle(rocblas_handle  handle,
+                                                    rocblas_handle* thread_handle)
+try
+{
+    if(!handle || !thread_handle || handle->shared_handle)
+        return rocblas_status_invalid_handle;
+
+    rocblas_thread_handle_registry& registry = get_thread_handle_registry();
+    rocblas_handle                  cached   = t_thread_handles.find(handle, registry.epoch.load());
+    if(!cached)
+    {
+        cached = find_registered_thread_handle(registry, handle);
+        if(cached)
+            t_thread_handles.handles.emplace_back(handle, cached);
+    }
+    if(cached)
+    {
+        *thread_handle = cached;
+        return rocblas_status_success;
+    }
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_thread_handle");
+
+    // The thread handle is created on the device of the shared handle
+    auto saved_device_id = handle->push_device_id();
+
+    std::unique_ptr<_rocblas_handle> created(new _rocblas_handle);
+    created->copy_settings(*handle);
+    created->shared_handle = handle;
+
+    rocblas_status status = rocblas_set_stream(created.get(), handle->get_stream());
+
+    // The thread handles share the workspace pool of the shared handle. Without a pool, each
+    // thread handle allocates and keeps its own workspace.
+    if(status == rocblas_status_success && handle->workspace_pool)
+        status = rocblas_set_workspace_pool(created.get(), handle->workspace_pool);
+    if(status != rocblas_status_success)
+        return status;
+
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.handles[handle].emplace_back(std::this_thread::get_id(), created.get());
+    }
+    t_thread_handles.handles.emplace_back(handle, created.get());
+
+    *thread_handle = created.release();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
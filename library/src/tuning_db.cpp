@@ -0,0 +1,376 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "tuning_db.hpp"
+#include "handle.hpp"
+#include "rocblas_ostream.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#ifdef WIN32
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+constexpr char rocblas_tuning_db::MAGIC[8];
+
+rocblas_tuning_db& rocblas_tuning_db::instance()
+{
+    static rocblas_tuning_db db;
+    return db;
+}
+
+rocblas_tuning_db::rocblas_tuning_db()
+{
+    const char* path = getenv("ROCBLAS_TUNING_DB");
+    if(path && *path && load(path) != rocblas_status_success)
+        rocblas_cerr << "rocBLAS warning: unable to load tuning database " << path << std::endl;
+}
+
+rocblas_tuning_db::~rocblas_tuning_db()
+{
+    unmap();
+}
+
+void rocblas_tuning_db::unmap()
+{
+    if(mapped_base)
+    {
+#ifdef WIN32
+        delete[] static_cast<char*>(mapped_base);
+#else
+        munmap(mapped_base, mapped_size);
+#endif
+    }
+    mapped_base    = nullptr;
+    mapped_size    = 0;
+    mapped_entries = nullptr;
+    mapped_count   = 0;
+}
+
+void rocblas_tuning_db::update_num_entries()
+{
+    num_entries.store(mapped_count + overlay.size(), std::memory_order_release);
+    generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
+rocblas_status rocblas_tuning_db::load(const char* path)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    unmap();
+    update_num_entries();
+
+    if(!path)
+        return rocblas_status_success;
+
+    void*  base = nullptr;
+    size_t size = 0;
+
+#ifdef WIN32
+    std::ifstream file(path, std::ios::binary);
+    if(!file)
+        return rocblas_status_invalid_value;
+    std::vector<char> contents((std::istreambuf_iterator<char>(file)),
+                               std::istreambuf_iterator<char>());
+    size = contents.size();
+    if(size)
+    {
+        base = new char[size];
+        memcpy(base, contents.data(), size);
+    }
+#else
+    int fd = open(path, O_RDONLY);
+    if(fd < 0)
+        return rocblas_status_invalid_value;
+    struct stat st;
+    if(fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        size = st.st_size;
+        base = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(base == MAP_FAILED)
+            base = nullptr;
+    }
+    close(fd);
+#endif
+
+    if(!base)
+        return rocblas_status_invalid_value;
+
+    mapped_base = base;
+    mapped_size = size;
+
+    auto* header = static_cast<const file_header*>(base);
+    if(size < sizeof(file_header) || memcmp(header->magic, MAGIC, sizeof(MAGIC))
+       || header->version != VERSION || header->key_words != KEY_WORDS
+       || header->count > (size - sizeof(file_header)) / sizeof(file_entry))
+    {
+        unmap();
+        return rocblas_status_invalid_value;
+    }
+
+    mapped_entries = reinterpret_cast<const file_entry*>(header + 1);
+    mapped_count   = header->count;
+    update_num_entries();
+    return rocblas_status_success;
+}
+
+int rocblas_tuning_db::compare(const file_entry& entry, const char* arch, const key_t& key)
+{
+    int c = strncmp(entry.arch, arch, ARCH_NAME_SIZE);
+    if(c)
+        return c;
+    for(size_t i = 0; i < KEY_WORDS; ++i)
+        if(entry.key[i] != key[i])
+            return entry.key[i] < key[i] ? -1 : 1;
+    return 0;
+}
+
+int32_t
+    rocblas_tuning_db::find(const char* arch, const key_t& key, int32_t* workgroup_mapping) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex);
+
+    if(workgroup_mapping)
+        *workgroup_mapping = 0;
+
+    if(!overlay.empty())
+    {
+        auto it = overlay.find({arch, key});
+        if(it != overlay.end())
+        {
+            if(workgroup_mapping)
+                *workgroup_mapping = it->second.second;
+            return it->second.first;
+        }
+    }
+
+    // Binary search of the sorted, mapped entries
+    size_t lo = 0, hi = mapped_count;
+    while(lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        int    c   = compare(mapped_entries[mid], arch, key);
+        if(!c)
+        {
+            if(workgroup_mapping)
+                *workgroup_mapping = mapped_entries[mid].workgroup_mapping;
+            return mapped_entries[mid].solution_index;
+        }
+        if(c < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return 0;
+}
+
+void rocblas_tuning_db::record(const char*  arch,
+                               const key_t& key,
+                               int32_t      solution_index,
+                               int32_t      workgroup_mapping)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    overlay[{std::string(arch).substr(0, ARCH_NAME_SIZE - 1), key}]
+        = {solution_index, workgroup_mapping};
+    update_num_entries();
+}
+
+void rocblas_tuning_db::clear_recorded()
+{
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    overlay.clear();
+    update_num_entries();
+}
+
+rocblas_status rocblas_tuning_db::save(const char* path)
+{
+    if(!path)
+        return rocblas_status_invalid_pointer;
+
+    std::vector<file_entry> entries;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+
+        // Overlay entries replace mapped entries with the same arch and key
+        entries.reserve(mapped_count + overlay.size());
+        for(size_t i = 0; i < mapped_count; ++i)
+        {
+            const auto& e = mapped_entries[i];
+            key_t       key;
+            std::copy(std::begin(e.key), std::end(e.key), key.begin());
+            if(!overlay.count({std::string(e.arch, strnlen(e.arch, ARCH_NAME_SIZE)), key}))
+                entries.push_back(e);
+        }
+        for(const auto& o : overlay)
+        {
+            file_entry e{};
+            strncpy(e.arch, o.first.first.c_str(), ARCH_NAME_SIZE - 1);
+            std::copy(o.first.second.begin(), o.first.second.end(), e.key);
+            e.solution_index    = o.second.first;
+            e.workgroup_mapping = o.second.second;
+            entries.push_back(e);
+        }
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const file_entry& a, const file_entry& b) {
+        key_t key;
+        std::copy(std::begin(b.key), std::end(b.key), key.begin());
+        return compare(a, b.arch, key) < 0;
+    });
+
+    // Write to a temporary file and rename it, so that processes mapping the
+    // existing database never observe a partially written file
+    std::string   tmp = std::string(path) + ".tmp";
+    std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+    if(!file)
+        return rocblas_status_invalid_value;
+
+    file_header header{};
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version   = VERSION;
+    header.key_words = KEY_WORDS;
+    header.count     = entries.size();
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(file_entry));
+    file.close();
+    if(!file)
+    {
+        std::remove(tmp.c_str());
+        return rocblas_status_invalid_value;
+    }
+
+#ifdef WIN32
+    std::remove(path);
+#endif
+    if(std::rename(tmp.c_str(), path))
+    {
+        std::remove(tmp.c_str());
+        return rocblas_status_invalid_value;
+    }
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * C API
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_load_tuning_db(const char* path)
+try
+{
+    return rocblas_tuning_db::instance().load(path);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_save_tuning_db(const char* path)
+try
+{
+    return rocblas_tuning_db::instance().save(path);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_set_tuning_db_record(rocblas_handle handle, bool record)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->tuning_db_record = record;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_set_gemm_autotune(rocblas_handle handle, rocblas_int candidates)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(candidates < 0)
+        return rocblas_status_invalid_value;
+    handle->gemm_autotune_candidates = candidates;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_gemm_autotune(rocblas_handle handle, rocblas_int* candidates)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!candidates)
+        return rocblas_status_invalid_pointer;
+    *candidates = handle->gemm_autotune_candidates;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_set_gemm_workgroup_mapping(rocblas_handle handle, rocblas_int wgm)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(wgm < 0)
+        return rocblas_status_invalid_value;
+    handle->gemm_workgroup_mapping = wgm;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_gemm_workgroup_mapping(rocblas_handle handle,
+                                                             rocblas_int*   wgm)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!wgm)
+        return rocblas_status_invalid_pointer;
+    *wgm = handle->gemm_workgroup_mapping;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
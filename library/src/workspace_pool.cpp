@@ -0,0 +1,140 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "workspace_pool.hpp"
+#include "utility.hpp"
+
+_rocblas_workspace_pool::_rocblas_workspace_pool(int device, size_t max_size, hipStream_t stream)
+    : device(device)
+    , max_size(max_size)
+{
+#if HIP_VERSION >= 50300000
+    hipMemPoolProps pool_props = {};
+    pool_props.allocType       = hipMemAllocationTypePinned;
+    pool_props.location.type   = hipMemLocationTypeDevice;
+    pool_props.location.id     = device;
+    THROW_IF_HIP_ERROR(hipMemPoolCreate(&pool, &pool_props));
+
+    // Keep max_size bytes resident, allocating them from the device once
+    uint64_t release_threshold = max_size;
+
+    hipError_t status
+        = hipMemPoolSetAttribute(pool, hipMemPoolAttrReleaseThreshold, &release_threshold);
+    if(status == hipSuccess && max_size)
+    {
+        void* reserve = nullptr;
+        status        = hipMallocFromPoolAsync(&reserve, max_size, pool, stream);
+        if(status == hipSuccess)
+            status = hipFreeAsync(reserve, stream);
+    }
+    if(status != hipSuccess)
+    {
+        hipMemPoolDestroy(pool);
+        THROW_IF_HIP_ERROR(status);
+    }
+#else
+    throw rocblas_status_not_implemented;
+#endif
+}
+
+_rocblas_workspace_pool::~_rocblas_workspace_pool()
+{
+#if HIP_VERSION >= 50300000
+    if(pool)
+        hipMemPoolDestroy(pool);
+#endif
+}
+
+hipError_t _rocblas_workspace_pool::allocate(void** ptr, size_t size, hipStream_t stream)
+{
+    // Reserve size bytes of the limit before allocating them
+    size_t current = used;
+    do
+    {
+        if(size > max_size - current)
+            return hipErrorOutOfMemory;
+    } while(!used.compare_exchange_weak(current, current + size));
+
+#if HIP_VERSION >= 50300000
+    hipError_t status = hipMallocFromPoolAsync(ptr, size, pool, stream);
+#else
+    hipError_t status = hipErrorNotSupported;
+#endif
+    if(status != hipSuccess)
+        used -= size;
+    return status;
+}
+
+hipError_t _rocblas_workspace_pool::deallocate(void* ptr, size_t size, hipStream_t stream)
+{
+#if HIP_VERSION >= 50300000
+    hipError_t status = hipFreeAsync(ptr, stream);
+#else
+    hipError_t status = hipErrorNotSupported;
+#endif
+    if(status == hipSuccess)
+        used -= size;
+    return status;
+}
+
+extern "C" rocblas_status rocblas_create_workspace_pool(rocblas_workspace_pool* pool,
+                                                        size_t                  max_size)
+try
+{
+    if(!pool)
+        return rocblas_status_invalid_pointer;
+
+    int device;
+    RETURN_IF_HIP_ERROR(hipGetDevice(&device));
+
+#if HIP_VERSION >= 50300000
+    int pools_supported = 0;
+    RETURN_IF_HIP_ERROR(
+        hipDeviceGetAttribute(&pools_supported, hipDeviceAttributeMemoryPoolsSupported, device));
+    if(!pools_supported)
+        return rocblas_status_not_implemented;
+
+    *pool = new _rocblas_workspace_pool(device, max_size, nullptr);
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_destroy_workspace_pool(rocblas_workspace_pool pool)
+try
+{
+    if(!pool)
+        return rocblas_status_invalid_pointer;
+
+    // Attached handles keep the pool alive until they are detached or destroyed
+    pool->release();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
@@ -74,6 +74,9 @@ def parse_args():
     parser.add_argument(      '--codecoverage', required=False, default=False, action='store_true',
                         help='Code coverage build. Requires Debug (-g|--debug) or RelWithDebInfo mode (-k|--relwithdebinfo), (optional, default: False)')
 
+    parser.add_argument(      '--distributed', required=False, default=False, action='store_true',
+                        help='Also build the rocblas-distributed library of distributed GEMM and SYRK, which requires RCCL. (optional, default: False)')
+
     parser.add_argument( '-d', '--dependencies', required=False, default=False, action='store_true',
                         help='Build and install external dependencies. (Handled by install.sh and on Windows rdeps.py')
 
@@ -98,12 +101,24 @@ def parse_args():
     parser.add_argument('-l', '--logic', dest='tensile_logic', type=str, required=False, default="asm_full",
                         help='Specify the Tensile logic target, e.g., asm_full, asm_lite, etc. (optional, default: asm_full)')
 
+    parser.add_argument(    '--logic-datatypes', dest='tensile_logic_datatypes', type=str, required=False, default="",
+                        help='Only build the Tensile logic of these datatypes, e.g., "HHS;BBS;S" (optional, default: all)')
+
+    parser.add_argument(    '--logic-transposes', dest='tensile_logic_transposes', type=str, required=False, default="",
+                        help='Only build the Tensile logic of these transposes, e.g., "NN;NT" (optional, default: all)')
+
+    parser.add_argument(    '--logic-shape-log', dest='tensile_logic_shape_log', type=str, required=False, default="",
+                        help='Only build the Tensile logic of the GEMMs of a rocblas-bench log written with ROCBLAS_LAYER=2 (optional)')
+
     parser.add_argument(    '--lazy-library-loading', dest='tensile_lazy_library_loading', required=False, default=True, action='store_true',
                         help='Enable on-demand loading of Tensile Library files, speeds up the rocblas initialization. (Default is enabled)')
 
     parser.add_argument(    '--no-lazy-library-loading', dest='tensile_lazy_library_loading', required=False, default=True, action='store_false',
                         help='Disable on-demand loading of Tensile Library files. (Default is enabled)')
 
+    parser.add_argument(    '--embed-tensile-library', dest='tensile_embed_library', required=False, default=False, action='store_true',
+                        help='Embed the Tensile Library and code objects in the rocBLAS library, so that initialization reads no files; disables lazy loading and separate architectures. (optional, default: False)')
+
     parser.add_argument(     '--library-path', dest='library_dir_installed', type=str, required=False, default="",
                         help='Specify path to a pre-built rocBLAS library, when building clients only using --clients-only flag. (optional, default: /opt/rocm/rocblas)')
 
@@ -285,6 +300,9 @@ def config_cmd():
         else:
             fatal("*** Code coverage is not supported for Release build! Aborting. ***")
 
+    if args.distributed:
+        cmake_options.append(f"-DBUILD_DISTRIBUTED=ON")
+
     if args.address_sanitizer:
         cmake_options.append(f"-DBUILD_ADDRESS_SANITIZER=ON")
 
@@ -332,6 +350,12 @@ def config_cmd():
         cmake_options.append(f"-DTensile_CODE_OBJECT_VERSION=default")
         if args.tensile_logic:
             cmake_options.append(f"-DTensile_LOGIC={args.tensile_logic}")
+        if args.tensile_logic_datatypes:
+            cmake_options.append(f'-DTensile_LOGIC_DATATYPES=\"{args.tensile_logic_datatypes}\"')
+        if args.tensile_logic_transposes:
+            cmake_options.append(f'-DTensile_LOGIC_TRANSPOSES=\"{args.tensile_logic_transposes}\"')
+        if args.tensile_logic_shape_log:
+            cmake_options.append(f"-DTensile_LOGIC_SHAPE_LOG={os.path.abspath(args.tensile_logic_shape_log)}")
         if args.tensile_fork:
             cmake_options.append(f"-Dtensile_fork={args.tensile_fork}")
         if args.tensile_tag:
@@ -346,6 +370,8 @@ def config_cmd():
             cmake_options.append(f"-DTensile_SEPARATE_ARCHITECTURES=ON")
         if args.tensile_lazy_library_loading:
             cmake_options.append(f"-DTensile_LAZY_LIBRARY_LOADING=ON")
+        if args.tensile_embed_library:
+            cmake_options.append(f"-DTensile_EMBED_LIBRARY=ON")
         if args.tensile_msgpack_backend:
             cmake_options.append(f"-DTensile_LIBRARY_FORMAT=msgpack")
         else:
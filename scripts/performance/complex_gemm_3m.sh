@@ -0,0 +1,32 @@
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: N, M: 1024, N: 1024, K: 1024, alpha: 1.0, alphai: 1.0, a_type: f32_c, lda: 1024, b_type: f32_c, ldb: 1024, beta: 0.0, c_type: f32_c, ldc: 1024, d_type: f32_c, ldd: 1024, compute_type: f32_c, algo: 0, solution_index: 0, flags: 0, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: N, M: 1024, N: 1024, K: 1024, alpha: 1.0, alphai: 1.0, a_type: f32_c, lda: 1024, b_type: f32_c, ldb: 1024, beta: 0.0, c_type: f32_c, ldc: 1024, d_type: f32_c, ldd: 1024, compute_type: f32_c, algo: 0, solution_index: 0, flags: 32, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: C, transB: N, M: 1024, N: 1024, K: 1024, alpha: 1.0, alphai: 1.0, a_type: f32_c, lda: 1024, b_type: f32_c, ldb: 1024, beta: 0.0, c_type: f32_c, ldc: 1024, d_type: f32_c, ldd: 1024, compute_type: f32_c, algo: 0, solution_index: 0, flags: 0, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: C, transB: N, M: 1024, N: 1024, K: 1024, alpha: 1.0, alphai: 1.0, a_type: f32_c, lda: 1024, b_type: f32_c, ldb: 1024, beta: 0.0, c_type: f32_c, ldc: 1024, d_type: f32_c, ldd: 1024, compute_type: f32_c, algo: 0, solution_index: 0, flags: 32, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: N, M: 2048, N: 2048, K: 2048, alpha: 1.0, alphai: 1.0, a_type: f32_c, lda: 2048, b_type: f32_c, ldb: 2048, beta: 0.0, c_type: f32_c, ldc: 2048, d_type: f32_c, ldd: 2048, compute_type: f32_c, algo: 0, solution_index: 0, flags: 0, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: N, M: 2048, N: 2048, K: 2048, alpha: 1.0, alphai: 1.0, a_type: f32_c, lda: 2048, b_type: f32_c, ldb: 2048, beta: 0.0, c_type: f32_c, ldc: 2048, d_type: f32_c, ldd: 2048, compute_type: f32_c, algo: 0, solution_index: 0, flags: 32, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: C, transB: N, M: 2048, N: 2048, K: 2048, alpha: 1.0, alphai: 1.0, a_type: f32_c, lda: 2048, b_type: f32_c, ldb: 2048, beta: 0.0, c_type: f32_c, ldc: 2048, d_type: f32_c, ldd: 2048, compute_type: f32_c, algo: 0, solution_index: 0, flags: 0, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: C, transB: N, M: 2048, N: 2048, K: 2048, alpha: 1.0, alphai: 1.0, a_type: f32_c, lda: 2048, b_type: f32_c, ldb: 2048, beta: 0.0, c_type: f32_c, ldc: 2048, d_type: f32_c, ldd: 2048, compute_type: f32_c, algo: 0, solution_index: 0, flags: 32, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: N, M: 4096, N: 4096, K: 4096, alpha: 1.0, alphai: 1.0, a_type: f32_c, lda: 4096, b_type: f32_c, ldb: 4096, beta: 0.0, c_type: f32_c, ldc: 4096, d_type: f32_c, ldd: 4096, compute_type: f32_c, algo: 0, solution_index: 0, flags: 0, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: N, M: 4096, N: 4096, K: 4096, alpha: 1.0, alphai: 1.0, a_type: f32_c, lda: 4096, b_type: f32_c, ldb: 4096, beta: 0.0, c_type: f32_c, ldc: 4096, d_type: f32_c, ldd: 4096, compute_type: f32_c, algo: 0, solution_index: 0, flags: 32, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: C, transB: N, M: 4096, N: 4096, K: 4096, alpha: 1.0, alphai: 1.0, a_type: f32_c, lda: 4096, b_type: f32_c, ldb: 4096, beta: 0.0, c_type: f32_c, ldc: 4096, d_type: f32_c, ldd: 4096, compute_type: f32_c, algo: 0, solution_index: 0, flags: 0, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: C, transB: N, M: 4096, N: 4096, K: 4096, alpha: 1.0, alphai: 1.0, a_type: f32_c, lda: 4096, b_type: f32_c, ldb: 4096, beta: 0.0, c_type: f32_c, ldc: 4096, d_type: f32_c, ldd: 4096, compute_type: f32_c, algo: 0, solution_index: 0, flags: 32, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: N, M: 8192, N: 512, K: 8192, alpha: 1.0, alphai: 1.0, a_type: f32_c, lda: 8192, b_type: f32_c, ldb: 8192, beta: 0.0, c_type: f32_c, ldc: 8192, d_type: f32_c, ldd: 8192, compute_type: f32_c, algo: 0, solution_index: 0, flags: 0, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: N, M: 8192, N: 512, K: 8192, alpha: 1.0, alphai: 1.0, a_type: f32_c, lda: 8192, b_type: f32_c, ldb: 8192, beta: 0.0, c_type: f32_c, ldc: 8192, d_type: f32_c, ldd: 8192, compute_type: f32_c, algo: 0, solution_index: 0, flags: 32, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: C, transB: N, M: 8192, N: 512, K: 8192, alpha: 1.0, alphai: 1.0, a_type: f32_c, lda: 8192, b_type: f32_c, ldb: 8192, beta: 0.0, c_type: f32_c, ldc: 8192, d_type: f32_c, ldd: 8192, compute_type: f32_c, algo: 0, solution_index: 0, flags: 0, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: C, transB: N, M: 8192, N: 512, K: 8192, alpha: 1.0, alphai: 1.0, a_type: f32_c, lda: 8192, b_type: f32_c, ldb: 8192, beta: 0.0, c_type: f32_c, ldc: 8192, d_type: f32_c, ldd: 8192, compute_type: f32_c, algo: 0, solution_index: 0, flags: 32, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: N, M: 1024, N: 1024, K: 1024, alpha: 1.0, alphai: 1.0, a_type: f64_c, lda: 1024, b_type: f64_c, ldb: 1024, beta: 0.0, c_type: f64_c, ldc: 1024, d_type: f64_c, ldd: 1024, compute_type: f64_c, algo: 0, solution_index: 0, flags: 0, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: N, M: 1024, N: 1024, K: 1024, alpha: 1.0, alphai: 1.0, a_type: f64_c, lda: 1024, b_type: f64_c, ldb: 1024, beta: 0.0, c_type: f64_c, ldc: 1024, d_type: f64_c, ldd: 1024, compute_type: f64_c, algo: 0, solution_index: 0, flags: 32, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: C, transB: N, M: 1024, N: 1024, K: 1024, alpha: 1.0, alphai: 1.0, a_type: f64_c, lda: 1024, b_type: f64_c, ldb: 1024, beta: 0.0, c_type: f64_c, ldc: 1024, d_type: f64_c, ldd: 1024, compute_type: f64_c, algo: 0, solution_index: 0, flags: 0, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: C, transB: N, M: 1024, N: 1024, K: 1024, alpha: 1.0, alphai: 1.0, a_type: f64_c, lda: 1024, b_type: f64_c, ldb: 1024, beta: 0.0, c_type: f64_c, ldc: 1024, d_type: f64_c, ldd: 1024, compute_type: f64_c, algo: 0, solution_index: 0, flags: 32, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: N, M: 2048, N: 2048, K: 2048, alpha: 1.0, alphai: 1.0, a_type: f64_c, lda: 2048, b_type: f64_c, ldb: 2048, beta: 0.0, c_type: f64_c, ldc: 2048, d_type: f64_c, ldd: 2048, compute_type: f64_c, algo: 0, solution_index: 0, flags: 0, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: N, M: 2048, N: 2048, K: 2048, alpha: 1.0, alphai: 1.0, a_type: f64_c, lda: 2048, b_type: f64_c, ldb: 2048, beta: 0.0, c_type: f64_c, ldc: 2048, d_type: f64_c, ldd: 2048, compute_type: f64_c, algo: 0, solution_index: 0, flags: 32, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: C, transB: N, M: 2048, N: 2048, K: 2048, alpha: 1.0, alphai: 1.0, a_type: f64_c, lda: 2048, b_type: f64_c, ldb: 2048, beta: 0.0, c_type: f64_c, ldc: 2048, d_type: f64_c, ldd: 2048, compute_type: f64_c, algo: 0, solution_index: 0, flags: 0, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: C, transB: N, M: 2048, N: 2048, K: 2048, alpha: 1.0, alphai: 1.0, a_type: f64_c, lda: 2048, b_type: f64_c, ldb: 2048, beta: 0.0, c_type: f64_c, ldc: 2048, d_type: f64_c, ldd: 2048, compute_type: f64_c, algo: 0, solution_index: 0, flags: 32, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: N, M: 4096, N: 4096, K: 4096, alpha: 1.0, alphai: 1.0, a_type: f64_c, lda: 4096, b_type: f64_c, ldb: 4096, beta: 0.0, c_type: f64_c, ldc: 4096, d_type: f64_c, ldd: 4096, compute_type: f64_c, algo: 0, solution_index: 0, flags: 0, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: N, M: 4096, N: 4096, K: 4096, alpha: 1.0, alphai: 1.0, a_type: f64_c, lda: 4096, b_type: f64_c, ldb: 4096, beta: 0.0, c_type: f64_c, ldc: 4096, d_type: f64_c, ldd: 4096, compute_type: f64_c, algo: 0, solution_index: 0, flags: 32, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: C, transB: N, M: 4096, N: 4096, K: 4096, alpha: 1.0, alphai: 1.0, a_type: f64_c, lda: 4096, b_type: f64_c, ldb: 4096, beta: 0.0, c_type: f64_c, ldc: 4096, d_type: f64_c, ldd: 4096, compute_type: f64_c, algo: 0, solution_index: 0, flags: 0, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: C, transB: N, M: 4096, N: 4096, K: 4096, alpha: 1.0, alphai: 1.0, a_type: f64_c, lda: 4096, b_type: f64_c, ldb: 4096, beta: 0.0, c_type: f64_c, ldc: 4096, d_type: f64_c, ldd: 4096, compute_type: f64_c, algo: 0, solution_index: 0, flags: 32, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: N, M: 8192, N: 512, K: 8192, alpha: 1.0, alphai: 1.0, a_type: f64_c, lda: 8192, b_type: f64_c, ldb: 8192, beta: 0.0, c_type: f64_c, ldc: 8192, d_type: f64_c, ldd: 8192, compute_type: f64_c, algo: 0, solution_index: 0, flags: 0, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: N, M: 8192, N: 512, K: 8192, alpha: 1.0, alphai: 1.0, a_type: f64_c, lda: 8192, b_type: f64_c, ldb: 8192, beta: 0.0, c_type: f64_c, ldc: 8192, d_type: f64_c, ldd: 8192, compute_type: f64_c, algo: 0, solution_index: 0, flags: 32, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: C, transB: N, M: 8192, N: 512, K: 8192, alpha: 1.0, alphai: 1.0, a_type: f64_c, lda: 8192, b_type: f64_c, ldb: 8192, beta: 0.0, c_type: f64_c, ldc: 8192, d_type: f64_c, ldd: 8192, compute_type: f64_c, algo: 0, solution_index: 0, flags: 0, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: C, transB: N, M: 8192, N: 512, K: 8192, alpha: 1.0, alphai: 1.0, a_type: f64_c, lda: 8192, b_type: f64_c, ldb: 8192, beta: 0.0, c_type: f64_c, ldc: 8192, d_type: f64_c, ldd: 8192, compute_type: f64_c, algo: 0, solution_index: 0, flags: 32, iters: 10 }
@@ -0,0 +1,16 @@
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: T, M: 1024, N: 1024, K: 1024, alpha: 1.0, a_type: f64_r, lda: 1024, b_type: f64_r, ldb: 1024, beta: 1.0, c_type: f64_r, ldc: 1024, d_type: f64_r, ldd: 1024, compute_type: f64_r, algo: 0, solution_index: 0, flags: 0, initialization: hpl, norm_check: 1, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: T, M: 1024, N: 1024, K: 1024, alpha: 1.0, a_type: f64_r, lda: 1024, b_type: f64_r, ldb: 1024, beta: 1.0, c_type: f64_r, ldc: 1024, d_type: f64_r, ldd: 1024, compute_type: f64_r, algo: 0, solution_index: 0, flags: 64, initialization: hpl, norm_check: 1, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: T, M: 1024, N: 1024, K: 1024, alpha: 1.0, a_type: f64_r, lda: 1024, b_type: f64_r, ldb: 1024, beta: 1.0, c_type: f64_r, ldc: 1024, d_type: f64_r, ldd: 1024, compute_type: f64_r, algo: 0, solution_index: 0, flags: 67108928, initialization: hpl, norm_check: 1, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: T, M: 1024, N: 1024, K: 1024, alpha: 1.0, a_type: f64_r, lda: 1024, b_type: f64_r, ldb: 1024, beta: 1.0, c_type: f64_r, ldc: 1024, d_type: f64_r, ldd: 1024, compute_type: f64_r, algo: 0, solution_index: 0, flags: 100663360, initialization: hpl, norm_check: 1, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: T, M: 4096, N: 4096, K: 4096, alpha: 1.0, a_type: f64_r, lda: 4096, b_type: f64_r, ldb: 4096, beta: 1.0, c_type: f64_r, ldc: 4096, d_type: f64_r, ldd: 4096, compute_type: f64_r, algo: 0, solution_index: 0, flags: 0, initialization: hpl, norm_check: 1, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: T, M: 4096, N: 4096, K: 4096, alpha: 1.0, a_type: f64_r, lda: 4096, b_type: f64_r, ldb: 4096, beta: 1.0, c_type: f64_r, ldc: 4096, d_type: f64_r, ldd: 4096, compute_type: f64_r, algo: 0, solution_index: 0, flags: 64, initialization: hpl, norm_check: 1, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: T, M: 4096, N: 4096, K: 4096, alpha: 1.0, a_type: f64_r, lda: 4096, b_type: f64_r, ldb: 4096, beta: 1.0, c_type: f64_r, ldc: 4096, d_type: f64_r, ldd: 4096, compute_type: f64_r, algo: 0, solution_index: 0, flags: 67108928, initialization: hpl, norm_check: 1, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: T, M: 4096, N: 4096, K: 4096, alpha: 1.0, a_type: f64_r, lda: 4096, b_type: f64_r, ldb: 4096, beta: 1.0, c_type: f64_r, ldc: 4096, d_type: f64_r, ldd: 4096, compute_type: f64_r, algo: 0, solution_index: 0, flags: 100663360, initialization: hpl, norm_check: 1, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: T, M: 8192, N: 8192, K: 8192, alpha: 1.0, a_type: f64_r, lda: 8192, b_type: f64_r, ldb: 8192, beta: 1.0, c_type: f64_r, ldc: 8192, d_type: f64_r, ldd: 8192, compute_type: f64_r, algo: 0, solution_index: 0, flags: 0, initialization: hpl, norm_check: 1, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: T, M: 8192, N: 8192, K: 8192, alpha: 1.0, a_type: f64_r, lda: 8192, b_type: f64_r, ldb: 8192, beta: 1.0, c_type: f64_r, ldc: 8192, d_type: f64_r, ldd: 8192, compute_type: f64_r, algo: 0, solution_index: 0, flags: 64, initialization: hpl, norm_check: 1, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: T, M: 8192, N: 8192, K: 8192, alpha: 1.0, a_type: f64_r, lda: 8192, b_type: f64_r, ldb: 8192, beta: 1.0, c_type: f64_r, ldc: 8192, d_type: f64_r, ldd: 8192, compute_type: f64_r, algo: 0, solution_index: 0, flags: 67108928, initialization: hpl, norm_check: 1, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: T, M: 8192, N: 8192, K: 8192, alpha: 1.0, a_type: f64_r, lda: 8192, b_type: f64_r, ldb: 8192, beta: 1.0, c_type: f64_r, ldc: 8192, d_type: f64_r, ldd: 8192, compute_type: f64_r, algo: 0, solution_index: 0, flags: 100663360, initialization: hpl, norm_check: 1, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: T, M: 16384, N: 512, K: 16384, alpha: 1.0, a_type: f64_r, lda: 16384, b_type: f64_r, ldb: 512, beta: 1.0, c_type: f64_r, ldc: 16384, d_type: f64_r, ldd: 16384, compute_type: f64_r, algo: 0, solution_index: 0, flags: 0, initialization: hpl, norm_check: 1, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: T, M: 16384, N: 512, K: 16384, alpha: 1.0, a_type: f64_r, lda: 16384, b_type: f64_r, ldb: 512, beta: 1.0, c_type: f64_r, ldc: 16384, d_type: f64_r, ldd: 16384, compute_type: f64_r, algo: 0, solution_index: 0, flags: 64, initialization: hpl, norm_check: 1, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: T, M: 16384, N: 512, K: 16384, alpha: 1.0, a_type: f64_r, lda: 16384, b_type: f64_r, ldb: 512, beta: 1.0, c_type: f64_r, ldc: 16384, d_type: f64_r, ldd: 16384, compute_type: f64_r, algo: 0, solution_index: 0, flags: 67108928, initialization: hpl, norm_check: 1, iters: 10 }
+- {rocblas_function: rocblas_gemm_ex, transA: N, transB: T, M: 16384, N: 512, K: 16384, alpha: 1.0, a_type: f64_r, lda: 16384, b_type: f64_r, ldb: 512, beta: 1.0, c_type: f64_r, ldc: 16384, d_type: f64_r, ldd: 16384, compute_type: f64_r, algo: 0, solution_index: 0, flags: 100663360, initialization: hpl, norm_check: 1, iters: 10 }
@@ -0,0 +1,222 @@
+"""Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+   ies of the Software, and to permit persons to whom the Software is furnished
+   to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+   PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+   CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+"""
+
+"""Performance regression suite.
+
+run:     benchmark a problem yaml file several times with rocblas-bench and store the samples
+         in STORE/<arch>/<rocm version>/<commit>.yaml
+compare: compare two stored results and flag the problems whose median time is slower by more
+         than the threshold, with a Mann-Whitney U test p-value below alpha
+list:    list the stored results
+
+Example usage:
+    python3 regression.py run -b ../../../build/release/clients/staging/rocblas-bench
+    python3 regression.py list
+    python3 regression.py compare gfx90a/5.6.0/1a2b3c4 gfx90a/5.7.0/5d6e7f8
+"""
+
+import argparse
+import math
+import os
+import shlex
+import subprocess
+import sys
+from pathlib import Path
+import yaml
+
+sys.path.append(os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), 'blas'))
+import getspecs
+
+script_dir = os.path.dirname(os.path.abspath(__file__))
+
+# First column of the performance fields appended by rocblas-bench after the arguments
+perfColumns = ['rocblas-Gflops', 'rocblas-GB/s', 'us']
+
+def gitCommit(repo_dir):
+    try:
+        return subprocess.check_output(['git', '-C', repo_dir, 'rev-parse', '--short', 'HEAD'],
+                                       stderr=subprocess.DEVNULL).decode('utf-8').strip()
+    except (subprocess.CalledProcessError, OSError):
+        return 'unknown'
+
+def parseBenchOutput(output):
+    """Return a list of (problem, us) for each benchmark line of the rocblas-bench output,
+    where problem is the string of argument names and values preceding the performance fields"""
+    results = []
+    keys = None
+    for line in output.split('\n'):
+        if keys is not None:
+            values = [v.strip() for v in line.split(',')]
+            fields = dict(zip(keys, values))
+            perf = min([keys.index(p) for p in perfColumns if p in keys], default=len(keys))
+            if 'us' in fields:
+                problem = ','.join(k + '=' + v for k, v in zip(keys[:perf], values[:perf]))
+                results.append((problem, float(fields['us'])))
+            keys = None
+        elif line.startswith('function'):
+            keys = [k.strip() for k in line.split(',')]
+    return results
+
+def runSuite(args):
+    results = {}
+    for i in range(args.samples):
+        print('Sample ({}/{})'.format(i + 1, args.samples))
+        output = subprocess.check_output([args.bench_command,
+                                          '--device', str(args.device),
+                                          '--log_function_name',
+                                          '--log_datatype',
+                                          '--yaml', args.yaml] + shlex.split(args.bench_args)).decode('utf-8')
+        for problem, us in parseBenchOutput(output):
+            results.setdefault(problem, []).append(us)
+
+    arch   = getspecs.getgfx(args.device, False)
+    rocm   = getspecs.getrocmversion()
+    commit = args.commit if args.commit else gitCommit(args.repo)
+
+    record = {'arch': arch,
+              'rocm': rocm,
+              'commit': commit,
+              'suite': os.path.basename(args.yaml),
+              'device': getspecs.getdeviceinfo(args.device, False),
+              'system clock': getspecs.getsclk(args.device, False),
+              'memory clock': getspecs.getmclk(args.device, False),
+              'results': [{'problem': p, 'us': s} for p, s in results.items()]}
+
+    outputDir = os.path.join(args.store, arch, rocm)
+    Path(outputDir).mkdir(parents=True, exist_ok=True)
+    outputFile = os.path.join(outputDir, commit + '.yaml')
+    with open(outputFile, 'w') as f:
+        yaml.dump(record, f)
+    print('Writing results to {}'.format(outputFile))
+
+def loadResults(store, name):
+    path = name if os.path.isfile(name) else os.path.join(store, name + '.yaml')
+    with open(path, 'r') as f:
+        record = yaml.safe_load(f)
+    return record, {r['problem']: r['us'] for r in record['results']}
+
+def median(samples):
+    s = sorted(samples)
+    n = len(s)
+    return s[n // 2] if n % 2 else (s[n // 2 - 1] + s[n // 2]) / 2
+
+def mannWhitneyU(a, b):
+    """Two-sided p-value of the Mann-Whitney U test, normal approximation with tie correction"""
+    n1, n2 = len(a), len(b)
+    pooled = sorted([(v, 0) for v in a] + [(v, 1) for v in b])
+
+    # average ranks of tied values
+    ranks = [0.0] * len(pooled)
+    ties = 0.0
+    i = 0
+    while i < len(pooled):
+        j = i
+        while j + 1 < len(pooled) and pooled[j + 1][0] == pooled[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1
+        t = j - i + 1
+        ties += t ** 3 - t
+        i = j + 1
+
+    r1 = sum(r for r, (_, g) in zip(ranks, pooled) if g == 0)
+    u = r1 - n1 * (n1 + 1) / 2.0
+    mean = n1 * n2 / 2.0
+    n = n1 + n2
+    var = n1 * n2 / 12.0 * ((n + 1) - ties / (n * (n - 1)))
+    if var <= 0:
+        return 1.0
+    z = (abs(u - mean) - 0.5) / math.sqrt(var)
+    return min(1.0, math.erfc(max(z, 0.0) / math.sqrt(2)))
+
+def compareResults(args):
+    baseRecord, base = loadResults(args.store, args.baseline)
+    candRecord, cand = loadResults(args.store, args.candidate)
+
+    print('baseline:  {} {} {}'.format(baseRecord['arch'], baseRecord['rocm'], baseRecord['commit']))
+    print('candidate: {} {} {}'.format(candRecord['arch'], candRecord['rocm'], candRecord['commit']))
+
+    regressions = 0
+    improvements = 0
+    for problem, baseSamples in base.items():
+        if problem not in cand:
+            print('missing in candidate: ' + problem)
+            continue
+        candSamples = cand[problem]
+        ratio = median(candSamples) / median(baseSamples)
+        p = mannWhitneyU(baseSamples, candSamples)
+
+        if p < args.alpha and ratio > 1 + args.threshold:
+            regressions += 1
+            status = 'REGRESSION'
+        elif p < args.alpha and ratio < 1 - args.threshold:
+            improvements += 1
+            status = 'improvement'
+        elif args.verbose:
+            status = 'unchanged'
+        else:
+            continue
+
+        print('{:<11} {:+7.1%} p={:.4f} median us {:.2f} -> {:.2f}: {}'.format(
+            status, ratio - 1, p, median(baseSamples), median(candSamples), problem))
+
+    print('{} regressions, {} improvements in {} problems'.format(regressions, improvements, len(base)))
+    return 1 if regressions else 0
+
+def listResults(args):
+    for path in sorted(Path(args.store).glob('*/*/*.yaml')):
+        print(os.path.splitext(os.path.relpath(path, args.store))[0])
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='rocBLAS performance regression suite')
+    parser.add_argument('-d', help='result store directory.', dest='store',
+                        default=os.path.join(script_dir, 'regression_results'))
+    subparsers = parser.add_subparsers(dest='command', required=True)
+
+    run = subparsers.add_parser('run', help='benchmark the suite and store the results')
+    run.add_argument('-b', help='bench command.', dest='bench_command',
+                     default='../../../build/release/clients/staging/rocblas-bench')
+    run.add_argument('-y', help='problem yaml file.', dest='yaml',
+                     default=os.path.join(script_dir, 'benchmarks', 'production_problems.yaml'))
+    run.add_argument('-s', help='number of samples.', dest='samples', type=int, default=10)
+    run.add_argument('--device', help='device id.', type=int, default=0)
+    run.add_argument('--commit', help='commit the results are stored for, default the HEAD of --repo.')
+    run.add_argument('--repo', help='rocBLAS git repository of the rocblas-bench build.',
+                     default=script_dir)
+    run.add_argument('--bench_args', help='extra rocblas-bench options, e.g. --reproducible.',
+                     default='')
+
+    compare = subparsers.add_parser('compare', help='flag regressions of candidate relative to baseline')
+    compare.add_argument('baseline', help='arch/rocm/commit in the store, or a result file path')
+    compare.add_argument('candidate', help='arch/rocm/commit in the store, or a result file path')
+    compare.add_argument('--threshold', help='minimum relative slowdown of the median.', type=float,
+                         default=0.03)
+    compare.add_argument('--alpha', help='significance level.', type=float, default=0.01)
+    compare.add_argument('-v', help='also print unchanged problems.', dest='verbose', action='store_true')
+
+    subparsers.add_parser('list', help='list the stored results')
+
+    args = parser.parse_args()
+    if args.command == 'run':
+        runSuite(args)
+    elif args.command == 'compare':
+        sys.exit(compareResults(args))
+    else:
+        listResults(args)
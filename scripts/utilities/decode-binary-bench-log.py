@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+
+"""Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+   ies of the Software, and to permit persons to whom the Software is furnished
+   to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+   PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+   CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+"""
+
+"""Decode a binary bench log into rocblas-bench command lines.
+
+rocBLAS writes the binary bench log instead of the text bench log when bench
+logging is enabled (ROCBLAS_LAYER=2) and ROCBLAS_LOG_BENCH_BINARY_PATH is set.
+The layout is described in library/src/include/binary_log.hpp. The log can be
+decoded while the application is running, or after it has exited or crashed.
+
+usage: decode-binary-bench-log.py [--timestamps] LOG
+"""
+
+import argparse
+import datetime
+import struct
+import sys
+
+MAGIC = b'RBLOGBIN'
+VERSION = 1
+MAX_ARGS = 64
+NO_STRING = 0xffffffff
+RECORD_TRUNCATED = 1
+
+ARG_STRING = 1
+ARG_CHAR = 2
+ARG_INT = 3
+ARG_UINT = 4
+ARG_DOUBLE = 5
+
+HEADER = struct.Struct('<8sII8Q')
+RECORD = struct.Struct('<QQIHH{0}B{0}Q'.format(MAX_ARGS))
+
+
+class BinaryBenchLog:
+    def __init__(self, data):
+        (magic, version, record_size, self.capacity, self.strings_offset,
+         self.strings_size, self.records_offset, self.strings_used,
+         self.next_record, self.start_time,
+         self.start_ticks) = HEADER.unpack_from(data, 0)
+
+        if magic != MAGIC:
+            raise ValueError('not a rocBLAS binary bench log')
+        if version != VERSION or record_size != RECORD.size:
+            raise ValueError('unsupported binary bench log version {}'.format(version))
+        self.data = data
+
+    def string(self, offset):
+        if offset == NO_STRING:
+            return '<string table full>'
+        position = self.strings_offset + offset
+        (length,) = struct.unpack_from('<I', self.data, position)
+        return self.data[position + 4:position + 4 + length].decode('utf-8', 'replace')
+
+    def argument(self, arg_type, value):
+        if arg_type == ARG_STRING:
+            return self.string(value)
+        if arg_type == ARG_CHAR:
+            return chr(value)
+        if arg_type == ARG_INT:
+            return str(value - (1 << 64) if value >= 1 << 63 else value)
+        if arg_type == ARG_UINT:
+            return str(value)
+        if arg_type == ARG_DOUBLE:
+            return '{:g}'.format(struct.unpack('<d', struct.pack('<Q', value))[0])
+        raise ValueError('unknown argument type {}'.format(arg_type))
+
+    def records(self):
+        """Yield (timestamp, command line, truncated) for the complete records, oldest first."""
+        records = []
+        for slot in range(self.capacity):
+            fields = RECORD.unpack_from(self.data, self.records_offset + slot * RECORD.size)
+            if fields[0]:
+                records.append(fields)
+        records.sort(key=lambda fields: fields[0])
+
+        for fields in records:
+            sequence, timestamp, function, count, flags = fields[:5]
+            types = fields[5:5 + MAX_ARGS]
+            values = fields[5 + MAX_ARGS:]
+            args = [self.string(function)]
+            args += [self.argument(types[i], values[i]) for i in range(count)]
+            yield timestamp, ' '.join(args), bool(flags & RECORD_TRUNCATED)
+
+    def time(self, timestamp):
+        """Wall clock time of a record timestamp."""
+        nanoseconds = self.start_time + timestamp - self.start_ticks
+        return datetime.datetime.fromtimestamp(nanoseconds / 1e9)
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(
+        description='Decode a rocBLAS binary bench log into rocblas-bench command lines.')
+    parser.add_argument('log', help='binary bench log file')
+    parser.add_argument('--timestamps', action='store_true',
+                        help='prefix each command with the time of the call')
+    args = parser.parse_args(argv)
+
+    with open(args.log, 'rb') as f:
+        log = BinaryBenchLog(f.read())
+
+    if log.next_record > log.capacity:
+        sys.stderr.write('{} earlier calls were overwritten in the ring of {} records\n'.format(
+            log.next_record - log.capacity, log.capacity))
+
+    for timestamp, command, truncated in log.records():
+        if truncated:
+            sys.stderr.write('arguments beyond the first {} were dropped: {}\n'.format(
+                MAX_ARGS, command))
+        if args.timestamps:
+            print('{} {}'.format(log.time(timestamp).isoformat(), command))
+        else:
+            print(command)
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -0,0 +1,252 @@
+#!/usr/bin/env python3
+
+"""Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+   ies of the Software, and to permit persons to whom the Software is furnished
+   to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+   PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+   CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+"""
+
+"""Replay a bench log in one rocblas-bench process and report where the GPU time goes.
+
+The rocblas-bench command lines of a text bench log (ROCBLAS_LAYER=2), or of a binary bench
+log (ROCBLAS_LOG_BENCH_BINARY_PATH) with --binary, are deduplicated and converted into one
+YAML data file, which rocblas-bench runs with --yaml so that rocBLAS and Tensile are
+initialized once. Each unique call is timed, and the calls are reported sorted by their total
+time, the time per call multiplied by the number of times the call appears in the log.
+
+usage: replay-bench-log.py [-b BENCH] [--binary] [-o REPORT.csv] [--top N] LOG [LOG ...]
+"""
+
+import argparse
+import collections
+import importlib.util
+import os
+import shlex
+import subprocess
+import sys
+import tempfile
+
+# rocblas-bench options and the Arguments fields they set, with the rocblas-bench defaults,
+# which differ from the YAML defaults of rocblas_common.yaml
+OPTIONS = {
+    '-m': 'M', '--sizem': 'M', '-n': 'N', '--sizen': 'N', '-k': 'K', '--sizek': 'K',
+    '--kl': 'KL', '--ku': 'KU',
+    '--lda': 'lda', '--ldb': 'ldb', '--ldc': 'ldc', '--ldd': 'ldd',
+    '--stride_a': 'stride_a', '--stride_b': 'stride_b', '--stride_c': 'stride_c',
+    '--stride_d': 'stride_d', '--stride_x': 'stride_x', '--stride_y': 'stride_y',
+    '--incx': 'incx', '--incy': 'incy', '--incb': 'incb',
+    '--alpha': 'alpha', '--alphai': 'alphai', '--beta': 'beta', '--betai': 'betai',
+    '-f': 'function', '--function': 'function', '-r': 'precision', '--precision': 'precision',
+    '--a_type': 'a_type', '--b_type': 'b_type', '--c_type': 'c_type', '--d_type': 'd_type',
+    '--compute_type': 'compute_type',
+    '--transposeA': 'transA', '--transposeB': 'transB',
+    '--side': 'side', '--uplo': 'uplo', '--diag': 'diag',
+    '--batch_count': 'batch_count', '--batch': 'batch_count',
+    '--algo': 'algo', '--solution_index': 'solution_index', '--flags': 'flags',
+    '--geam_ex_op': 'geam_ex_op', '--workspace': 'user_allocated_workspace',
+}
+
+SWITCHES = {
+    '--atomics_not_allowed': ('atomics_mode', 0),
+    '--c_noalias_d': ('c_noalias_d', True),
+    '--fortran': ('fortran', True),
+}
+
+DEFAULTS = {
+    'M': 128, 'N': 128, 'K': 128, 'KL': 32, 'KU': 32,
+    'lda': 128, 'ldb': 128, 'ldc': 128, 'ldd': 128,
+    'stride_a': 128 * 128, 'stride_b': 128 * 128, 'stride_c': 128 * 128,
+    'stride_d': 128 * 128, 'stride_x': 128 * 128, 'stride_y': 128 * 128,
+    'incx': 1, 'incy': 1, 'incb': 1,
+    'alpha': 1.0, 'alphai': 0.0, 'beta': 0.0, 'betai': 0.0,
+    'precision': 'f32_r', 'transA': 'N', 'transB': 'N', 'side': 'L', 'uplo': 'U', 'diag': 'N',
+    'batch_count': 1, 'algo': 0, 'solution_index': 0, 'flags': 0, 'geam_ex_op': 0,
+    'user_allocated_workspace': 0, 'atomics_mode': 1, 'c_noalias_d': False, 'fortran': False,
+}
+
+TYPES = ['a_type', 'b_type', 'c_type', 'd_type', 'compute_type']
+
+
+def read_commands(logs, binary):
+    """Yield the rocblas-bench arguments of each call in the logs, as a string."""
+    if binary:
+        path = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                            'decode-binary-bench-log.py')
+        spec = importlib.util.spec_from_file_location('decode_binary_bench_log', path)
+        decoder = importlib.util.module_from_spec(spec)
+        spec.loader.exec_module(decoder)
+
+    for log in logs:
+        if binary:
+            with open(log, 'rb') as f:
+                lines = [command for _, command, _ in decoder.BinaryBenchLog(f.read()).records()]
+        else:
+            with open(log, 'r', errors='replace') as f:
+                lines = f.readlines()
+
+        for line in lines:
+            position = line.find('rocblas-bench')
+            if position >= 0:
+                yield line[position + len('rocblas-bench'):].strip()
+            elif line.lstrip().startswith('-f '):
+                yield line.strip()
+
+
+def parse_command(command):
+    """Arguments fields of a rocblas-bench command line, or None if it cannot be replayed."""
+    tokens = shlex.split(command)
+    fields = dict(DEFAULTS)
+    i = 0
+    while i < len(tokens):
+        token = tokens[i]
+        if token in SWITCHES:
+            name, value = SWITCHES[token]
+            fields[name] = value
+            i += 1
+        elif token in OPTIONS and i + 1 < len(tokens):
+            fields[OPTIONS[token]] = tokens[i + 1]
+            i += 2
+        else:
+            return None, token
+
+    if 'function' not in fields:
+        return None, '-f'
+
+    precision = fields.pop('precision')
+    for t in TYPES:
+        fields.setdefault(t, precision)
+    return fields, None
+
+
+def yaml_value(value):
+    if isinstance(value, bool):
+        return 'true' if value else 'false'
+    if isinstance(value, str) and len(value) == 1 and value.isalpha():
+        return "'{}'".format(value)
+    return str(value)
+
+
+def write_yaml(problems, iters, cold_iters, filename):
+    # No document start: the problems continue the rocblas_template.yaml document, whose
+    # Arguments and Defaults they use
+    with open(filename, 'w') as f:
+        f.write('Tests:\n')
+        for index, fields in enumerate(problems):
+            entry = dict(fields)
+            entry.update({'name': 'replay_{}'.format(index), 'category': 'bench',
+                          'iters': iters, 'cold_iters': cold_iters})
+            f.write('- { ' + ', '.join('{}: {}'.format(k, yaml_value(v))
+                                       for k, v in entry.items()) + ' }\n')
+
+
+def parse_bench_output(output, problems):
+    """Time per call in us, and Gflops, of each problem, matched in order by function name."""
+    results = [None] * len(problems)
+    keys = None
+    index = 0
+    for line in output.split('\n'):
+        if keys is not None:
+            values = dict(zip(keys, [v.strip() for v in line.split(',')]))
+            keys = None
+            while index < len(problems) and problems[index]['function'] != values.get('function'):
+                index += 1
+            if index < len(problems) and 'us' in values:
+                results[index] = (float(values['us']), values.get('rocblas-Gflops', ''))
+                index += 1
+        elif line.startswith('function'):
+            keys = [k.strip() for k in line.split(',')]
+    return results
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(
+        description='Replay a rocBLAS bench log in one process and report where the GPU time goes.')
+    parser.add_argument('logs', nargs='+', help='bench log files')
+    parser.add_argument('-b', dest='bench', default='./rocblas-bench', help='rocblas-bench path')
+    parser.add_argument('--binary', action='store_true', help='the logs are binary bench logs')
+    parser.add_argument('-i', dest='iters', type=int, default=10, help='timed calls per problem')
+    parser.add_argument('-j', dest='cold_iters', type=int, default=2,
+                        help='untimed calls per problem')
+    parser.add_argument('-o', dest='report', help='write the full report to this CSV file')
+    parser.add_argument('--top', type=int, default=50, help='number of calls printed')
+    parser.add_argument('--yaml', help='keep the generated YAML data file with this name')
+    parser.add_argument('--bench_args', default='',
+                        help='extra rocblas-bench options, e.g. "--flush --stats"')
+    args = parser.parse_args(argv)
+
+    counts = collections.Counter(read_commands(args.logs, args.binary))
+    problems = []
+    commands = []
+    skipped = collections.Counter()
+    for command, count in counts.most_common():
+        fields, bad = parse_command(command)
+        if fields is None:
+            skipped[bad] += count
+            continue
+        problems.append(fields)
+        commands.append((command, count))
+
+    total_calls = sum(counts.values())
+    print('{} calls, {} unique, {} unique replayed'.format(total_calls, len(counts), len(problems)))
+    for option, count in skipped.items():
+        sys.stderr.write('skipped {} calls with unsupported option {}\n'.format(count, option))
+    if not problems:
+        return 1
+
+    yaml_file = args.yaml or tempfile.NamedTemporaryFile(suffix='.yaml', delete=False).name
+    write_yaml(problems, args.iters, args.cold_iters, yaml_file)
+
+    command = [args.bench, '--log_function_name', '--yaml', yaml_file] + shlex.split(args.bench_args)
+    output = subprocess.run(command, stdout=subprocess.PIPE, universal_newlines=True).stdout
+    if not args.yaml:
+        os.remove(yaml_file)
+
+    report = []
+    for (command, count), result in zip(commands, parse_bench_output(output, problems)):
+        if result is None:
+            sys.stderr.write('no timing for: {}\n'.format(command))
+            continue
+        us, gflops = result
+        report.append((us * count, count, us, gflops, command))
+    report.sort(reverse=True)
+
+    total_us = sum(r[0] for r in report) or 1.0
+    header = ['rank', 'total-ms', 'time-%', 'cumulative-%', 'calls', 'us', 'rocblas-Gflops',
+              'command']
+    rows = []
+    cumulative = 0.0
+    for rank, (time_us, count, us, gflops, command) in enumerate(report, 1):
+        cumulative += time_us
+        rows.append([rank, '{:.3f}'.format(time_us / 1e3), '{:.2f}'.format(100 * time_us / total_us),
+                     '{:.2f}'.format(100 * cumulative / total_us), count, '{:.3f}'.format(us),
+                     gflops, command])
+
+    print('replayed GPU time {:.3f} ms'.format(total_us / 1e3))
+    print(','.join(header))
+    for row in rows[:args.top]:
+        print(','.join(str(v) for v in row))
+
+    if args.report:
+        with open(args.report, 'w') as f:
+            f.write(','.join(header) + '\n')
+            for row in rows:
+                f.write(','.join(str(v) for v in row[:-1]) + ',"' + row[-1] + '"\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))